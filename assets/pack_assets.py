@@ -0,0 +1,148 @@
+#!/usr/bin/env python3
+# Packs fonts and icons into an asset archive for esp32-weather-epd.
+# Copyright (C) 2022-2026  Luke Marzen
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <https://www.gnu.org/licenses/>.
+#
+# The archive layout is documented in platformio/include/asset_store.h.
+#
+# usage: python3 pack_assets.py [-h] [--family FreeSans] [--sizes 32 64 196]
+#                               [--version N] [-o assets.bin]
+#
+# The icons packed are the ones looked up with getConditionsIcon() in
+# platformio/src/display_utils.cpp, at each of the given sizes.
+
+import argparse
+import os
+import re
+import struct
+import sys
+import time
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..',
+                    'platformio')
+ASSETS = os.path.join(ROOT, 'lib', 'esp32-weather-epd-assets')
+
+ASSET_MAGIC = 0x41445045  # "EPDA"
+ASSET_FORMAT_VERSION = 1
+ASSET_BITMAP = 0
+ASSET_FONT = 1
+HEADER = struct.Struct('<IHHII')
+ENTRY = struct.Struct('<IIIHH')
+FONT = struct.Struct('<IIHHB3x')
+GLYPH = struct.Struct('<HBBBbbx')  # matches sizeof(GFXglyph) == 8
+
+FONT_SIZES = ['4pt8b', '5pt8b', '6pt8b', '7pt8b', '8pt8b', '9pt8b', '10pt8b',
+              '11pt8b', '12pt8b', '14pt8b', '16pt8b', '18pt8b', '20pt8b',
+              '22pt8b', '24pt8b', '26pt8b', '48pt8b_temperature']
+
+
+def asset_key(name):
+    """FNV-1a, same as assetKey() in asset_store.h."""
+    h = 2166136261
+    for c in name.encode():
+        h = ((h ^ c) * 16777619) & 0xFFFFFFFF
+    return h
+
+
+def hex_bytes(text):
+    return bytes(int(x, 16) for x in re.findall(r'0x([0-9A-Fa-f]{2})', text))
+
+
+def load_icon(name, size):
+    path = os.path.join(ASSETS, 'icons', '%dx%d' % (size, size),
+                        '%s_%dx%d.h' % (name, size, size))
+    with open(path) as f:
+        data = hex_bytes(f.read().split('{', 1)[1])
+    if len(data) != size * ((size + 7) // 8):
+        sys.exit('unexpected bitmap size in ' + path)
+    return data
+
+
+def load_font(family, size):
+    path = os.path.join(ASSETS, 'fonts', family, '%s_%s.h' % (family, size))
+    with open(path, encoding='latin-1') as f:  # glyph comments are 8-bit
+        text = f.read()
+    bitmaps = hex_bytes(re.search(r'Bitmaps\[\] PROGMEM = \{(.*?)\};', text,
+                                  re.S).group(1))
+    glyph_src = re.search(r'Glyphs\[\] PROGMEM = \{(.*?)\};', text, re.S)
+    glyphs = re.findall(r'\{\s*(-?\d+),\s*(-?\d+),\s*(-?\d+),\s*(-?\d+),'
+                        r'\s*(-?\d+),\s*(-?\d+)\s*\}', glyph_src.group(1))
+    first, last, y_advance = re.search(
+        r'\(GFXglyph \*\)\w+,\s*(0x[0-9A-Fa-f]+|\d+),\s*(0x[0-9A-Fa-f]+|\d+),'
+        r'\s*(\d+)\s*\}', text).groups()
+    first, last = int(first, 0), int(last, 0)
+    if len(glyphs) != last - first + 1:
+        sys.exit('unexpected glyph count in ' + path)
+
+    glyph_data = b''.join(GLYPH.pack(*map(int, g)) for g in glyphs)
+    glyph_offset = FONT.size
+    bitmap_offset = glyph_offset + len(glyph_data)
+    return (FONT.pack(glyph_offset, bitmap_offset, first, last, int(y_advance))
+            + glyph_data + bitmaps)
+
+
+def conditions_icons():
+    with open(os.path.join(ROOT, 'src', 'display_utils.cpp')) as f:
+        names = re.findall(r'return getConditionsIcon\((\w+),', f.read())
+    return sorted(set(names))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument('--family', default='FreeSans',
+                        help='font family, a directory of fonts/')
+    parser.add_argument('--sizes', type=int, nargs='+', default=[32, 64, 196],
+                        help='icon sizes to pack, 196 only for ICONS_DOWNSCALE')
+    parser.add_argument('--version', type=int, default=int(time.time()),
+                        help='archive version, defaults to the current time')
+    parser.add_argument('-o', '--output', default='assets.bin')
+    args = parser.parse_args()
+
+    assets = []
+    for size in FONT_SIZES:
+        assets.append(('FONT_' + size, ASSET_FONT,
+                       load_font(args.family, size)))
+    for name in conditions_icons():
+        for size in args.sizes:
+            assets.append(('%s_%dx%d' % (name, size, size), ASSET_BITMAP,
+                           load_icon(name, size)))
+
+    entries = sorted((asset_key(name), name, type, data)
+                     for name, type, data in assets)
+    for a, b in zip(entries, entries[1:]):
+        if a[0] == b[0]:
+            sys.exit('asset key collision: %s %s' % (a[1], b[1]))
+
+    offset = HEADER.size + ENTRY.size * len(entries)
+    index = b''
+    payload = b''
+    for key, name, type, data in entries:
+        pad = -offset % 4  # keep glyph tables aligned
+        payload += b'\0' * pad
+        offset += pad
+        index += ENTRY.pack(key, offset, len(data), type, 0)
+        payload += data
+        offset += len(data)
+
+    header = HEADER.pack(ASSET_MAGIC, ASSET_FORMAT_VERSION, len(entries),
+                         args.version & 0xFFFFFFFF, offset)
+    with open(args.output, 'wb') as f:
+        f.write(header + index + payload)
+    print('%s: %d assets, %d bytes, version %d'
+          % (args.output, len(entries), offset, args.version))
+
+
+if __name__ == '__main__':
+    main()
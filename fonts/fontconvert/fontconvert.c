@@ -22,6 +22,8 @@ See notes at end for glyph nomenclature & other tidbits.
 #include <ft2build.h>
 #include <stdint.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include FT_GLYPH_H
 #include FT_MODULE_H
 #include FT_TRUETYPE_DRIVER_H
@@ -29,25 +31,76 @@ See notes at end for glyph nomenclature & other tidbits.
 
 #define DPI 141 // Approximate res. of Adafruit 2.8" TFT
 
-// Accumulate bits for output, with periodic hexadecimal byte write
+// Output buffers, glyph bitmaps are collected before being written so that
+// the smaller of the plain and run-length encodings can be chosen.
+typedef struct {
+  uint8_t *data;
+  int len, cap;
+} buffer_t;
+
+static buffer_t raw = {NULL, 0, 0}, rle = {NULL, 0, 0};
+
+void bufput(buffer_t *b, uint8_t value) {
+  if (b->len >= b->cap) {
+    b->cap = b->cap ? b->cap * 2 : 4096;
+    if (!(b->data = realloc(b->data, b->cap))) {
+      fprintf(stderr, "Malloc error\n");
+      exit(1);
+    }
+  }
+  b->data[b->len++] = value;
+}
+
+// Accumulate bits for output, one byte is buffered when complete
 void enbit(uint8_t value) {
-  static uint8_t row = 0, sum = 0, bit = 0x80, firstCall = 1;
+  static uint8_t sum = 0, bit = 0x80;
   if (value)
     sum |= bit;          // Set bit if needed
   if (!(bit >>= 1)) {    // Advance to next bit, end of byte reached?
-    if (!firstCall) {    // Format output table nicely
-      if (++row >= 12) { // Last entry on line?
-        printf(",\n  "); //   Newline format output
-        row = 0;         //   Reset row counter
-      } else {           // Not end of line
-        printf(", ");    //   Simple comma delim
+    bufput(&raw, sum);   // Buffer byte value
+    sum = 0;             // Clear for next byte
+    bit = 0x80;          // Reset bit counter
+  }
+}
+
+// Buffer one background/foreground run pair, see enrle()
+void rlepair(int bg, int fg) {
+  while (bg > 15) {
+    bufput(&rle, 0xF0);
+    bg -= 15;
+  }
+  while (fg > 15) {
+    bufput(&rle, (bg << 4) | 15);
+    bg = 0;
+    fg -= 15;
+  }
+  bufput(&rle, (bg << 4) | fg);
+}
+
+// Run-length encode one glyph. The w*h pixels are read row by row as a single
+// stream of alternating background/foreground runs, starting with background.
+// Each byte holds a pair of runs: background length in the high nibble,
+// foreground length in the low nibble. Runs longer than 15 pixels continue in
+// the next byte with a zero-length run of the other color. The renderer draws
+// each foreground run as horizontal spans.
+void enrle(const FT_Bitmap *bitmap) {
+  int x, y, bg = 0, fg = 0, on, prev = 0;
+  for (y = 0; y < bitmap->rows; y++) {
+    for (x = 0; x < bitmap->width; x++) {
+      on = (bitmap->buffer[y * bitmap->pitch + x / 8] & (0x80 >> (x & 7))) != 0;
+      if (prev && !on) { // foreground run ended
+        rlepair(bg, fg);
+        bg = fg = 0;
       }
+      if (on)
+        fg++;
+      else
+        bg++;
+      prev = on;
     }
-    printf("0x%02X", sum); // Write byte value
-    sum = 0;               // Clear for next byte
-    bit = 0x80;            // Reset bit counter
-    firstCall = 0;         // Formatting flag
   }
+  if (bitmap->width && bitmap->rows) // last pair
+    rlepair(bg, fg);
 }
 
 int main(int argc, char *argv[]) {
@@ -59,7 +112,9 @@ int main(int argc, char *argv[]) {
   FT_Bitmap *bitmap;
   FT_BitmapGlyphRec *g;
   GFXglyph *table;
+  uint16_t *rleOffset;
   uint8_t bit;
+  int useRle = 0;
 
   // Parse command line.  Valid syntaxes are:
   //   fontconvert [filename] [size]
@@ -68,8 +123,17 @@ int main(int argc, char *argv[]) {
   // Unless overridden, default first and last chars are
   // ' ' (space) and 255, respectively
 
+  //   fontconvert -r [filename] [size] ...
+  // -r run-length encodes the glyph bitmaps when that is smaller
+
+  if ((argc > 1) && !strcmp(argv[1], "-r")) {
+    useRle = 1;
+    argv++;
+    argc--;
+  }
+
   if (argc < 3) {
-    fprintf(stderr, "Usage: %s fontfile size [first] [last]\n", argv[0]);
+    fprintf(stderr, "Usage: %s [-r] fontfile size [first] [last]\n", argv[0]);
     return 1;
   }
 
@@ -96,7 +160,8 @@ int main(int argc, char *argv[]) {
 
   // Allocate space for font name and glyph table
   if ((!(fontName = malloc(strlen(ptr) + 20))) ||
-      (!(table = (GFXglyph *)malloc((last - first + 1) * sizeof(GFXglyph))))) {
+      (!(table = (GFXglyph *)malloc((last - first + 1) * sizeof(GFXglyph)))) ||
+      (!(rleOffset = (uint16_t *)malloc((last - first + 1) * sizeof(uint16_t))))) {
     fprintf(stderr, "Malloc error\n");
     return 1;
   }
@@ -145,8 +210,6 @@ int main(int argc, char *argv[]) {
   // the right symbols, and that's not done yet.
   // fprintf(stderr, "%ld glyphs\n", face->num_glyphs);
 
-  printf("const uint8_t %sBitmaps[] PROGMEM = {\n  ", fontName);
-
   // Process glyphs and output huge bitmap data array
   for (i = first, j = 0; i <= last; i++, j++) {
     // MONO renderer provides clean image with perfect crop
@@ -178,6 +241,7 @@ int main(int argc, char *argv[]) {
     // check that size & offsets are within bounds either for
     // that matter...please convert fonts responsibly.)
     table[j].bitmapOffset = bitmapOffset;
+    rleOffset[j] = rle.len;
     table[j].width = bitmap->width;
     table[j].height = bitmap->rows;
     table[j].xAdvance = face->glyph->advance.x >> 6;
@@ -200,10 +264,33 @@ int main(int argc, char *argv[]) {
         enbit(0);
     }
     bitmapOffset += (bitmap->width * bitmap->rows + 7) / 8;
+    enrle(bitmap);
 
     FT_Done_Glyph(glyph);
   }
 
+  // Keep the run-length encoding only if it is smaller
+  buffer_t *out = &raw;
+  if (useRle && (rle.len < raw.len)) {
+    out = &rle;
+    bitmapOffset = rle.len;
+    for (i = first, j = 0; i <= last; i++, j++)
+      table[j].bitmapOffset = rleOffset[j];
+    printf("// Run-length encoded glyph bitmaps (fontconvert -r)\n");
+    printf("#define %s_RLE\n\n", fontName);
+  }
+
+  // Output bitmap data array
+  printf("const uint8_t %sBitmaps[] PROGMEM = {\n  ", fontName);
+  for (i = 0; i < out->len; i++) {
+    if (i) {                 // Format output table nicely
+      if (i % 12 == 0)       // Last entry on line?
+        printf(",\n  ");     //   Newline format output
+      else                   // Not end of line
+        printf(", ");        //   Simple comma delim
+    }
+    printf("0x%02X", out->data[i]); // Write byte value
+  }
   printf(" };\n\n"); // End bitmap array
 
   // Output glyph attributes table (one per character)
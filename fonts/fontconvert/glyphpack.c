@@ -0,0 +1,272 @@
+/*
+Unicode glyph page packer for esp32-weather-epd.
+
+NOT AN ARDUINO SKETCH.  This is a command-line tool that renders glyphs the
+same way as fontconvert (FreeType mono rendering at 141 DPI) and writes them
+to a binary file indexed by codepoint, to be stored in the "glyphs" flash
+partition and read on demand by the firmware (see USE_GLYPH_PAGES and
+platformio/include/glyph_pages.h for the layout).
+
+Usage:
+  ./glyphpack -o glyphs.bin [-s sizes] [-r first-last]... [-t file]...
+              fontfile [fontfile...]
+
+  -s  comma separated point sizes, default 10,11,12,14,16,18,20,22,24,26
+  -r  codepoint range, hexadecimal (e.g. -r 0400-04FF for Cyrillic)
+  -t  add every codepoint found in a UTF-8 text file (e.g. a list of common
+      CJK characters, so that the whole block does not need to be packed)
+
+Each codepoint is taken from the first font file that has a glyph for it,
+codepoints without a glyph in any font are skipped.
+
+REQUIRES FREETYPE LIBRARY.  www.freetype.org
+*/
+#ifndef ARDUINO
+
+#include <ft2build.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include FT_GLYPH_H
+#include FT_MODULE_H
+#include FT_TRUETYPE_DRIVER_H
+
+#define DPI 141 // same as fontconvert
+
+#define GLYPH_PAGES_MAGIC 0x47445045 // "EPDG"
+#define GLYPH_PAGES_FORMAT_VERSION 1
+#define MAX_FONTS 8
+#define MAX_SIZES 32
+
+static uint32_t *codepoints = NULL;
+static int cp_count = 0, cp_cap = 0;
+
+static uint8_t *out = NULL;
+static uint32_t out_len = 0, out_cap = 0;
+
+void *xrealloc(void *p, size_t n) {
+  if (!(p = realloc(p, n))) {
+    fprintf(stderr, "Malloc error\n");
+    exit(1);
+  }
+  return p;
+}
+
+void addcp(uint32_t cp) {
+  if (cp_count >= cp_cap) {
+    cp_cap = cp_cap ? cp_cap * 2 : 1024;
+    codepoints = xrealloc(codepoints, cp_cap * sizeof(uint32_t));
+  }
+  codepoints[cp_count++] = cp;
+}
+
+int cmpcp(const void *a, const void *b) {
+  uint32_t x = *(const uint32_t *)a, y = *(const uint32_t *)b;
+  return (x > y) - (x < y);
+}
+
+// Adds the codepoints of a UTF-8 text file, invalid sequences are ignored
+void addtext(const char *path) {
+  FILE *f = fopen(path, "rb");
+  int c, n = 0;
+  uint32_t cp = 0;
+  if (!f) {
+    fprintf(stderr, "Can not open %s\n", path);
+    exit(1);
+  }
+  while ((c = fgetc(f)) != EOF) {
+    if ((c & 0xC0) == 0x80 && n) {
+      cp = (cp << 6) | (c & 0x3F);
+      if (!--n && cp >= 0x20)
+        addcp(cp);
+      continue;
+    }
+    n = 0;
+    if (c < 0x80) {
+      if (c >= 0x20)
+        addcp(c);
+    } else if ((c & 0xE0) == 0xC0) {
+      cp = c & 0x1F;
+      n = 1;
+    } else if ((c & 0xF0) == 0xE0) {
+      cp = c & 0x0F;
+      n = 2;
+    } else if ((c & 0xF8) == 0xF0) {
+      cp = c & 0x07;
+      n = 3;
+    }
+  }
+  fclose(f);
+}
+
+// Little endian output, the buffer is written in one go at the end
+void put(uint32_t offset, uint32_t value, int bytes) {
+  while (offset + bytes > out_cap) {
+    out_cap = out_cap ? out_cap * 2 : 65536;
+    out = xrealloc(out, out_cap);
+    memset(out + out_len, 0, out_cap - out_len);
+  }
+  for (int i = 0; i < bytes; i++)
+    out[offset + i] = (value >> (8 * i)) & 0xFF;
+  if (offset + bytes > out_len)
+    out_len = offset + bytes;
+}
+
+int main(int argc, char *argv[]) {
+  const char *outname = NULL, *fontfiles[MAX_FONTS];
+  int sizes[MAX_SIZES] = {10, 11, 12, 14, 16, 18, 20, 22, 24, 26};
+  int size_count = 10, font_count = 0, i, j, k, err;
+  FT_Library library;
+  FT_Face faces[MAX_FONTS];
+
+  for (i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "-o") && i + 1 < argc) {
+      outname = argv[++i];
+    } else if (!strcmp(argv[i], "-s") && i + 1 < argc) {
+      char *p = argv[++i];
+      for (size_count = 0; *p && size_count < MAX_SIZES; size_count++) {
+        sizes[size_count] = strtol(p, &p, 10);
+        if (*p == ',')
+          p++;
+      }
+    } else if (!strcmp(argv[i], "-r") && i + 1 < argc) {
+      char *p = argv[++i];
+      uint32_t first = strtoul(p, &p, 16), last = first;
+      if (*p == '-')
+        last = strtoul(p + 1, NULL, 16);
+      for (uint32_t cp = first; cp <= last; cp++)
+        addcp(cp);
+    } else if (!strcmp(argv[i], "-t") && i + 1 < argc) {
+      addtext(argv[++i]);
+    } else if (argv[i][0] != '-' && font_count < MAX_FONTS) {
+      fontfiles[font_count++] = argv[i];
+    } else {
+      font_count = 0;
+      break;
+    }
+  }
+  if (!outname || !font_count || !cp_count) {
+    fprintf(stderr,
+            "Usage: %s -o glyphs.bin [-s sizes] [-r first-last]... "
+            "[-t file]... fontfile [fontfile...]\n",
+            argv[0]);
+    return 1;
+  }
+
+  // sorted without duplicates, the firmware binary searches the index
+  qsort(codepoints, cp_count, sizeof(uint32_t), cmpcp);
+  for (i = 1, j = 1; i < cp_count; i++)
+    if (codepoints[i] != codepoints[j - 1])
+      codepoints[j++] = codepoints[i];
+  cp_count = j;
+
+  if ((err = FT_Init_FreeType(&library))) {
+    fprintf(stderr, "FreeType init error: %d", err);
+    return err;
+  }
+  // same rendering as fontconvert, see there
+  FT_UInt interpreter_version = TT_INTERPRETER_VERSION_35;
+  FT_Property_Set(library, "truetype", "interpreter-version",
+                  &interpreter_version);
+  for (i = 0; i < font_count; i++) {
+    if ((err = FT_New_Face(library, fontfiles[i], 0, &faces[i]))) {
+      fprintf(stderr, "Font load error: %d", err);
+      FT_Done_FreeType(library);
+      return err;
+    }
+  }
+
+  // header (12 bytes) and font table (16 bytes per size)
+  put(0, GLYPH_PAGES_MAGIC, 4);
+  put(4, GLYPH_PAGES_FORMAT_VERSION, 2);
+  put(6, size_count, 2);
+  uint32_t pos = 12 + 16 * size_count;
+
+  for (k = 0; k < size_count; k++) {
+    FT_Face face = NULL;
+    uint32_t glyph_count = 0, bitmap_len = 0;
+    uint32_t index = pos;
+
+    for (i = 0; i < font_count; i++)
+      FT_Set_Char_Size(faces[i], sizes[k] << 6, 0, DPI, 0);
+
+    // index first (16 bytes per glyph), bitmaps are appended after it
+    for (j = 0; j < cp_count; j++) {
+      for (i = 0; i < font_count; i++)
+        if (FT_Get_Char_Index(faces[i], codepoints[j]))
+          break;
+      glyph_count += (i < font_count);
+    }
+    uint32_t bitmaps = index + 16 * glyph_count;
+
+    for (j = 0; j < cp_count; j++) {
+      for (i = 0; i < font_count; i++)
+        if (FT_Get_Char_Index(faces[i], codepoints[j]))
+          break;
+      if (i == font_count)
+        continue;
+      face = faces[i];
+      FT_Glyph glyph;
+      if ((err = FT_Load_Char(face, codepoints[j], FT_LOAD_TARGET_MONO)) ||
+          (err = FT_Render_Glyph(face->glyph, FT_RENDER_MODE_MONO)) ||
+          (err = FT_Get_Glyph(face->glyph, &glyph))) {
+        fprintf(stderr, "Error %d rendering U+%04X\n", err, codepoints[j]);
+        return 1;
+      }
+      FT_Bitmap *bitmap = &face->glyph->bitmap;
+      FT_BitmapGlyphRec *g = (FT_BitmapGlyphRec *)glyph;
+
+      put(index, codepoints[j], 4);
+      put(index + 4, bitmap_len, 4);
+      put(index + 8, bitmap->width, 1);
+      put(index + 9, bitmap->rows, 1);
+      put(index + 10, face->glyph->advance.x >> 6, 1);
+      put(index + 11, (uint8_t)g->left, 1);
+      put(index + 12, (uint8_t)(1 - g->top), 1);
+      index += 16;
+
+      // bit packed like the Adafruit_GFX glyphs, padded to a whole byte
+      uint8_t sum = 0, bit = 0x80;
+      for (int y = 0; y < (int)bitmap->rows; y++) {
+        for (int x = 0; x < (int)bitmap->width; x++) {
+          if (bitmap->buffer[y * bitmap->pitch + x / 8] & (0x80 >> (x & 7)))
+            sum |= bit;
+          if (!(bit >>= 1)) {
+            put(bitmaps + bitmap_len++, sum, 1);
+            sum = 0;
+            bit = 0x80;
+          }
+        }
+      }
+      if (bit != 0x80)
+        put(bitmaps + bitmap_len++, sum, 1);
+      FT_Done_Glyph(glyph);
+    }
+
+    // yAdvance of the primary font, for reference
+    FT_Set_Char_Size(faces[0], sizes[k] << 6, 0, DPI, 0);
+    put(12 + 16 * k, sizes[k], 2);
+    put(12 + 16 * k + 2, faces[0]->size->metrics.height >> 6, 1);
+    put(12 + 16 * k + 4, glyph_count, 4);
+    put(12 + 16 * k + 8, pos, 4);
+    put(12 + 16 * k + 12, bitmaps, 4);
+    fprintf(stderr, "%dpt: %u glyphs, %u bytes\n", sizes[k], glyph_count,
+            bitmaps + bitmap_len - pos);
+    pos = bitmaps + bitmap_len;
+  }
+  put(8, pos, 4);
+
+  FILE *f = fopen(outname, "wb");
+  if (!f || fwrite(out, 1, pos, f) != pos) {
+    fprintf(stderr, "Can not write %s\n", outname);
+    return 1;
+  }
+  fclose(f);
+  fprintf(stderr, "%s: %u bytes\n", outname, pos);
+
+  FT_Done_FreeType(library);
+  return 0;
+}
+
+#endif /* !ARDUINO */
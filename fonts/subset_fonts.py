@@ -0,0 +1,198 @@
+#!/usr/bin/env python3
+# Locale-aware font subsetting for esp32-weather-epd.
+# Copyright (C) 2022-2026  Luke Marzen
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <https://www.gnu.org/licenses/>.
+#
+# Writes a copy of the FONT_HEADER family in which only the glyphs that can be
+# drawn keep their bitmaps:
+#   - printable ASCII (numbers, units, city names, times...)
+#   - every character of the string literals in include/config.h and in the
+#     selected locale (locale_<LOCALE>.inc and locale_<LOCALE>_labels.inc)
+#   - the accented letters OpenWeatherMap may return in descriptions and
+#     alerts for OWM_LANG, both as UTF-8 bytes (drawn byte by byte) and as
+#     Latin-1 (drawn decoded when USE_GLYPH_PAGES is defined)
+# Other glyphs keep their metrics but have an empty bitmap.
+#
+# Runs as a PlatformIO pre-build script (extra_scripts in platformio.ini). When
+# FONT_SUBSET is defined in include/config.h the family is written to
+# $BUILD_DIR/font_subset, which is added to the include path.
+# It can also be run by hand:
+#   python3 subset_fonts.py --locale de_DE --font fonts/FreeSans.h -o out
+
+import argparse
+import os
+import re
+import sys
+
+# Latin-1 letters used by each OWM language
+OWM_LANG_LETTERS = {
+  'de':    'ÄÖÜäöüß',
+  'en':    '',
+  'es':    'ÁÉÍÓÚÑÜáéíóúñü¡¿',
+  'fi':    'ÄÖÅäöå',
+  'fr':    'ÀÂÆÇÉÈÊËÎÏÔÙÛÜàâæçéèêëîïôùûüÿ',
+  'it':    'ÀÈÉÌÍÒÓÙàèéìíòóù',
+  'nl':    'ËÏÖëïöéè',
+  'pt_br': 'ÀÁÂÃÇÉÊÍÓÔÕÚàáâãçéêíóôõú',
+  'ro':    'ÂÎâî',
+}
+
+
+def c_strings(data):
+    """Returns the bytes of every C string literal in data (bytes)."""
+    data = re.sub(rb'//[^\n]*|/\*.*?\*/', b'', data, flags=re.S)
+    out = bytearray()
+    for lit in re.findall(rb'"((?:[^"\\\n]|\\.)*)"', data):
+        i = 0
+        while i < len(lit):
+            c = lit[i]
+            if c != ord('\\'):
+                out.append(c)
+                i += 1
+                continue
+            m = re.match(rb'\\([0-7]{1,3}|x[0-9A-Fa-f]+|.)', lit[i:])
+            esc = m.group(1)
+            if esc[:1].isdigit():
+                out.append(int(esc, 8) & 0xFF)
+            elif esc[:1] == b'x':
+                out.append(int(esc[1:], 16) & 0xFF)
+            else:
+                out += {b'n': b'\n', b't': b'\t'}.get(esc, esc)
+            i += len(m.group(0))
+    return out
+
+
+def used_chars(include_dir, locale):
+    chars = set(range(0x20, 0x7F))
+    paths = [os.path.join(include_dir, 'config.h'),
+             os.path.join(include_dir, 'locales', 'locale_%s.inc' % locale),
+             os.path.join(include_dir, 'locales',
+                          'locale_%s_labels.inc' % locale)]
+    lang = 'en'
+    for path in paths:
+        with open(path, 'rb') as f:
+            data = f.read()
+        chars.update(c_strings(data))
+        m = re.search(rb'OWM_LANG\s*=\s*"(\w+)"', data)
+        if m:
+            lang = m.group(1).decode()
+    letters = OWM_LANG_LETTERS.get(lang, '')
+    chars.update(letters.encode('utf-8'))
+    # USE_GLYPH_PAGES decodes UTF-8, the Latin-1 glyphs are drawn instead
+    chars.update(letters.encode('latin-1'))
+    return chars
+
+
+def subset_header(text, chars):
+    """Rewrites one fontconvert header keeping only the bitmaps of chars."""
+    bitmaps = bytes(int(x, 16) for x in re.findall(
+        r'0x([0-9A-Fa-f]{2})',
+        re.search(r'Bitmaps\[\] PROGMEM = \{(.*?)\};', text, re.S).group(1)))
+    glyph_re = re.compile(r'\{\s*(-?\d+),\s*(-?\d+),\s*(-?\d+),\s*(-?\d+),'
+                          r'\s*(-?\d+),\s*(-?\d+)\s*\}')
+    glyph_src = re.search(r'(Glyphs\[\] PROGMEM = \{)(.*?)(\};)', text, re.S)
+    glyphs = [list(map(int, g)) for g in glyph_re.findall(glyph_src.group(2))]
+    first = int(re.search(r'\(GFXglyph \*\)\w+,\s*(0x[0-9A-Fa-f]+|\d+)',
+                          text).group(1), 0)
+    if '_RLE\n' in text:
+        sys.exit('run-length encoded fonts can not be subset')
+
+    out = bytearray()
+    for i, g in enumerate(glyphs):
+        offset, w, h = g[0], g[1], g[2]
+        if (first + i) in chars:
+            g[0] = len(out)
+            out += bitmaps[offset:offset + (w * h + 7) // 8]
+        else:
+            g[0], g[1], g[2] = 0, 0, 0
+
+    lines = ', '.join('0x%02X' % b for b in out) or '0x00'
+    lines = re.sub(r'((?:0x[0-9A-F]{2}, ){11}0x[0-9A-F]{2}), ', r'\1,\n  ',
+                   lines)
+    text = re.sub(r'(Bitmaps\[\] PROGMEM = \{\n  ).*?( \};)',
+                  lambda m: m.group(1) + lines + m.group(2), text, count=1,
+                  flags=re.S)
+    it = iter(glyphs)
+    table = glyph_re.sub(
+        lambda m: '{ %5d, %3d, %3d, %3d, %4d, %4d }' % tuple(next(it)),
+        glyph_src.group(2))
+    text = text.replace(glyph_src.group(2), table, 1)
+    text = re.sub(r'// Approx\. \d+ bytes',
+                  '// Approx. %d bytes' % (len(out) + len(glyphs) * 7 + 7),
+                  text)
+    return text, len(bitmaps), len(out)
+
+
+def subset_family(font_header, fonts_dir, chars, out_dir):
+    """Writes <out_dir>/font_subset.h and the subset headers it includes."""
+    with open(os.path.join(fonts_dir, font_header)) as f:
+        family = f.read()
+    total_in = total_out = 0
+    for inc in re.findall(r'#include "([^"]+)"', family):
+        with open(os.path.join(fonts_dir, os.path.dirname(font_header), inc),
+                  encoding='latin-1') as f:
+            text, n_in, n_out = subset_header(f.read(), chars)
+        path = os.path.join(out_dir, inc)
+        os.makedirs(os.path.dirname(path), exist_ok=True)
+        with open(path, 'w', encoding='latin-1') as f:
+            f.write(text)
+        total_in += n_in
+        total_out += n_out
+    with open(os.path.join(out_dir, 'font_subset.h'), 'w') as f:
+        f.write('// Generated by fonts/subset_fonts.py from %s\n' % font_header)
+        f.write(family.replace('__FONTS_', '__FONT_SUBSET_', 2))
+    return total_in, total_out
+
+
+def config_define(config, name):
+    m = re.search(r'^#define %s\s+(.*?)\s*$' % name, config, re.M)
+    return m.group(1) if m else None
+
+
+def main(argv=None):
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument('--locale', required=True, help='e.g. en_US')
+    parser.add_argument('--font', required=True,
+                        help='FONT_HEADER, e.g. fonts/FreeSans.h')
+    parser.add_argument('--project', default=os.path.join(
+        os.path.dirname(os.path.abspath(__file__)), '..', 'platformio'))
+    parser.add_argument('-o', '--output', required=True)
+    args = parser.parse_args(argv)
+    run(args.project, args.locale, args.font, args.output)
+
+
+def run(project, locale, font_header, out_dir):
+    chars = used_chars(os.path.join(project, 'include'), locale)
+    fonts_dir = os.path.join(project, 'lib', 'esp32-weather-epd-assets')
+    n_in, n_out = subset_family(font_header, fonts_dir, chars, out_dir)
+    print('Font subset %s (%s): %d glyphs, bitmaps %d -> %d bytes'
+          % (font_header, locale, len(chars), n_in, n_out))
+
+
+try:
+    Import('env')  # noqa: F821
+except NameError:
+    if __name__ == '__main__':
+        main()
+else:
+    # PlatformIO pre-build script
+    project = env.subst('$PROJECT_DIR')  # noqa: F821
+    with open(os.path.join(project, 'include', 'config.h')) as f:
+        config = f.read()
+    if config_define(config, 'FONT_SUBSET') is not None:
+        out_dir = os.path.join(env.subst('$BUILD_DIR'), 'font_subset')  # noqa
+        run(project, config_define(config, 'LOCALE'),
+            config_define(config, 'FONT_HEADER').strip('"'), out_dir)
+        env.Append(CPPPATH=[out_dir])  # noqa: F821
@@ -18,6 +18,9 @@ TTF_FILES=ttf/*
 OUTPUT_PATH="./fonts"
 SIZES=(4 5 6 7 8 9 10 11 12 14 16 18 20 22 24 26)
 TEMPERATURE_SIZES=(48)
+# Set to 1 to also generate run-length encoded families (<font>_RLE.h, see
+# fontconvert -r). Each size is only encoded when that makes it smaller.
+RLE=${RLE:-0}
 
 # clean fonts output
 echo "Cleaning $OUTPUT_PATH"
@@ -31,6 +34,62 @@ make
 cd ../
 
 
+# convert_family <font file> <temperature subset file> <family> [-r]
+convert_family()
+{
+  local fontfile=$1
+  local SUBSET_OUT=$2
+  local FONT=$3
+  local FLAGS=$4
+  local BASE=${FONT%_RLE}
+  echo $FONT
+  mkdir $OUTPUT_PATH/$FONT
+  for SI in ${SIZES[*]}
+    do
+    OUTFILE=$OUTPUT_PATH/$FONT/$FONT"_"$SI"pt8b.h"
+    echo "fontconvert $FLAGS ${fontfile} $SI > $OUTFILE"
+    ./fontconvert/fontconvert $FLAGS ${fontfile} $SI > $OUTFILE
+    sed -i "s/${SI}pt8b/_${SI}pt8b/g" $OUTFILE
+    sed -i "s/\b${BASE}_\([0-9]\)/${FONT}_\1/g" $OUTFILE
+    # glyph tables are constexpr so text widths can be computed at build time
+    sed -i "s/^const GFXglyph/constexpr GFXglyph/;s/^const GFXfont/constexpr GFXfont/" $OUTFILE
+    # sed -i "s/_remap${SI}pt8b/${SI}pt8b/g" $OUTFILE
+  done
+  for SI in ${TEMPERATURE_SIZES[*]}
+    do
+    OUTFILE=$OUTPUT_PATH/$FONT/$FONT"_"$SI"pt8b_temperature.h"
+    echo "fontconvert $FLAGS $SUBSET_OUT $SI > $OUTFILE"
+    ./fontconvert/fontconvert $FLAGS $SUBSET_OUT $SI > $OUTFILE
+    sed -i "s/_temperature_set${SI}pt8b/_${SI}pt8b_temperature/g" $OUTFILE
+    sed -i "s/\b${BASE}_\([0-9]\)/${FONT}_\1/g" $OUTFILE
+    sed -i "s/^const GFXglyph/constexpr GFXglyph/;s/^const GFXfont/constexpr GFXfont/" $OUTFILE
+  done
+
+  # create header file (this will make fonts way easier to include)
+  HEADER_FILE=$OUTPUT_PATH/$FONT".h"
+  echo "#ifndef __FONTS_"${FONT^^}"_H__" >> $HEADER_FILE
+  echo "#define __FONTS_"${FONT^^}"_H__" >> $HEADER_FILE
+  for FILE in $OUTPUT_PATH/$FONT/*
+    do
+    echo "#include \"$FONT/`basename $FILE`\"" >> $HEADER_FILE
+  done
+  echo "" >> $HEADER_FILE
+  for FILE in $OUTPUT_PATH/$FONT/*
+    do
+    FONT_SUFFIX=$(echo "`basename $FILE .h`" | grep -oP '(?<=pt8b)\w+')
+    FONT_SIZE=$(echo "`basename $FILE .h`" | grep -oP '\d+(?=pt8b)')
+
+    echo "#define FONT_"$FONT_SIZE"pt8b"$FONT_SUFFIX" `basename $FILE .h`" >> $HEADER_FILE
+  done
+  # fonts drawn with the run-length glyph renderer
+  RLE_FONTS=$(grep -ho '^#define [A-Za-z0-9_]*_RLE$' $OUTPUT_PATH/$FONT/* \
+              | sed 's/#define \(.*\)_RLE/\&\1,/' | tr '\n' ' ')
+  if [ -n "$RLE_FONTS" ]; then
+    echo "#define FONT_RLE_LIST $RLE_FONTS" >> $HEADER_FILE
+  fi
+  echo "#endif" >> $HEADER_FILE
+}
+
 for fontfile in $TTF_FILES
   do
   # ascii hexidecimal value of the character to remap degree symbol to
@@ -63,23 +122,10 @@ for fontfile in $TTF_FILES
 
   # convert .otf/.ttf files to c-style arrays
   FONT=`basename ${fontfile%%.*} | tr '-' '_'`
-  echo $FONT
-  mkdir $OUTPUT_PATH/$FONT
-  for SI in ${SIZES[*]}
-    do
-    OUTFILE=$OUTPUT_PATH/$FONT/$FONT"_"$SI"pt8b.h"
-    echo "fontconvert ${fontfile} $SI > $OUTFILE"
-    ./fontconvert/fontconvert ${fontfile} $SI > $OUTFILE
-    sed -i "s/${SI}pt8b/_${SI}pt8b/g" $OUTFILE
-    # sed -i "s/_remap${SI}pt8b/${SI}pt8b/g" $OUTFILE
-  done
-  for SI in ${TEMPERATURE_SIZES[*]}
-    do
-    OUTFILE=$OUTPUT_PATH/$FONT/$FONT"_"$SI"pt8b_temperature.h"
-    echo "fontconvert $SUBSET_OUT $SI > $OUTFILE"
-    ./fontconvert/fontconvert $SUBSET_OUT $SI > $OUTFILE
-    sed -i "s/_temperature_set${SI}pt8b/_${SI}pt8b_temperature/g" $OUTFILE
-  done
+  convert_family ${fontfile} $SUBSET_OUT $FONT
+  if [ "$RLE" = "1" ]; then
+    convert_family ${fontfile} $SUBSET_OUT $FONT"_RLE" -r
+  fi
 
   # clean up
   echo "rm $SUBSET_OUT"
@@ -87,24 +133,6 @@ for fontfile in $TTF_FILES
   # echo "rm $REMAP_OUT"
   # rm $REMAP_OUT
 
-  # create header file (this will make fonts way easier to include)
-  HEADER_FILE=$OUTPUT_PATH/$FONT".h"
-  echo "#ifndef __FONTS_"${FONT^^}"_H__" >> $HEADER_FILE
-  echo "#define __FONTS_"${FONT^^}"_H__" >> $HEADER_FILE
-  for FILE in $OUTPUT_PATH/$FONT/*
-    do
-    echo "#include \"$FONT/`basename $FILE`\"" >> $HEADER_FILE
-  done
-  echo "" >> $HEADER_FILE
-  for FILE in $OUTPUT_PATH/$FONT/*
-    do
-    FONT_SUFFIX=$(echo "`basename $FILE .h`" | grep -oP '(?<=pt8b)\w+')
-    FONT_SIZE=$(echo "`basename $FILE .h`" | grep -oP '\d+(?=pt8b)')
-
-    echo "#define FONT_"$FONT_SIZE"pt8b"$FONT_SUFFIX" `basename $FILE .h`" >> $HEADER_FILE
-  done
-  echo "#endif" >> $HEADER_FILE
-
 done
 
 # clean up
@@ -21,6 +21,7 @@
 #include <vector>
 #include <Arduino.h>
 #include <aqi.h>
+#include "config.h"
 
 #ifdef WEB_SVR
 extern const String W_PAGENOTFOUND;
@@ -87,82 +88,15 @@ extern const char *LC_ERA_T_FMT;
 // OWM LANGUAGE
 extern const String OWM_LANG;
 
-// CURRENT CONDITIONS
-extern const char *TXT_FEELS_LIKE;
-extern const char *TXT_SUNRISE;
-extern const char *TXT_SUNSET;
-extern const char *TXT_MOONRISE;
-extern const char *TXT_MOONSET;
-extern const char *TXT_WIND;
-extern const char *TXT_HUMIDITY;
-extern const char *TXT_UV_INDEX;
-extern const char *TXT_PRESSURE;
-extern const char *TXT_AIR_QUALITY;
-extern const char *TXT_AIR_POLLUTION;
-extern const char *TXT_VISIBILITY;
-extern const char *TXT_INDOOR_TEMPERATURE;
-extern const char *TXT_INDOOR_HUMIDITY;
-extern const char *TXT_DEWPOINT;
-
-// MOON PHASE
-extern const char *TXT_MOONPHASE;
-extern const char *TXT_NEW_MOON;
-extern const char *TXT_WAXING_CRESCENT;
-extern const char *TXT_FIRST_QUARTER;
-extern const char *TXT_WAXING_GIBBOUS;
-extern const char *TXT_FULL_MOON;
-extern const char *TXT_WANING_GIBBOUS;
-extern const char *TXT_THIRD_QUARTER;
-extern const char *TXT_WANING_CRESCENT;
-
-// UV INDEX
-extern const char *TXT_UV_LOW;
-extern const char *TXT_UV_MODERATE;
-extern const char *TXT_UV_HIGH;
-extern const char *TXT_UV_VERY_HIGH;
-extern const char *TXT_UV_EXTREME;
-
-// WIFI
-extern const char *TXT_WIFI_EXCELLENT;
-extern const char *TXT_WIFI_GOOD;
-extern const char *TXT_WIFI_FAIR;
-extern const char *TXT_WIFI_WEAK;
-extern const char *TXT_WIFI_NO_CONNECTION;
-
-// UNIT SYMBOLS - TEMPERATURE
-extern const char *TXT_UNITS_TEMP_KELVIN;
-extern const char *TXT_UNITS_TEMP_CELSIUS;
-extern const char *TXT_UNITS_TEMP_FAHRENHEIT;
-// UNIT SYMBOLS - WIND SPEED
-extern const char *TXT_UNITS_SPEED_METERSPERSECOND;
-extern const char *TXT_UNITS_SPEED_FEETPERSECOND;
-extern const char *TXT_UNITS_SPEED_KILOMETERSPERHOUR;
-extern const char *TXT_UNITS_SPEED_MILESPERHOUR;
-extern const char *TXT_UNITS_SPEED_KNOTS;
-extern const char *TXT_UNITS_SPEED_BEAUFORT;
-// UNIT SYMBOLS - PRESSURE
-extern const char *TXT_UNITS_PRES_HECTOPASCALS;
-extern const char *TXT_UNITS_PRES_PASCALS;
-extern const char *TXT_UNITS_PRES_MILLIMETERSOFMERCURY;
-extern const char *TXT_UNITS_PRES_INCHESOFMERCURY;
-extern const char *TXT_UNITS_PRES_MILLIBARS;
-extern const char *TXT_UNITS_PRES_ATMOSPHERES;
-extern const char *TXT_UNITS_PRES_GRAMSPERSQUARECENTIMETER;
-extern const char *TXT_UNITS_PRES_POUNDSPERSQUAREINCH;
-// UNIT SYMBOLS - VISIBILITY DISTANCE
-extern const char *TXT_UNITS_DIST_KILOMETERS;
-extern const char *TXT_UNITS_DIST_MILES;
-// UNIT SYMBOLS - PRECIPITATION
-extern const char *TXT_UNITS_PRECIP_MILLIMETERS;
-extern const char *TXT_UNITS_PRECIP_CENTIMETERS;
-extern const char *TXT_UNITS_PRECIP_INCHES;
+// CURRENT CONDITIONS, MOON PHASE, UV INDEX, WIFI, UNIT SYMBOLS, Title Case
+// MESSAGES
+// These are constexpr so their widths can be computed at compile time.
+#define LABELS_STR(s) #s
+#define X_LABELS_INC(code) LABELS_STR(locales/locale_ ## code ## _labels.inc)
+#define LABELS_INC(code) X_LABELS_INC(code)
+#include LABELS_INC(LOCALE)
 
 // MISCELLANEOUS MESSAGES
-// Title Case
-extern const char *TXT_LOW_BATTERY;
-extern const char *TXT_NETWORK_NOT_AVAILABLE;
-extern const char *TXT_TIME_SYNCHRONIZATION_FAILED;
-extern const char *TXT_WIFI_CONNECTION_FAILED;
 // First Word Capitalized
 extern const char *TXT_ATTEMPTING_HTTP_REQ;
 extern const char *TXT_AWAKE_FOR;
@@ -213,6 +213,25 @@ typedef struct owm_resp_air_pollution
 
 DeserializationError deserializeOneCall(WiFiClient &json,
                                         owm_resp_onecall_t &r);
+#ifdef PARSE_PIPELINE
+/*
+ * Sections of the One Call response, published by
+ * deserializeOneCallSections() as soon as they are parsed.
+ */
+typedef enum onecall_section
+{
+  ONECALL_CURRENT = 1 << 0, // current and timezone_offset
+  ONECALL_HOURLY  = 1 << 1,
+  ONECALL_DAILY   = 1 << 2,
+  ONECALL_ALERTS  = 1 << 3,
+  ONECALL_ALL     = 0x0F
+} onecall_section_t;
+typedef void (*onecall_published_t)(void *ctx, uint32_t sections);
+DeserializationError deserializeOneCallSections(WiFiClient &json,
+                                                owm_resp_onecall_t &r,
+                                                onecall_published_t published,
+                                                void *ctx);
+#endif
 DeserializationError deserializeAirQuality(WiFiClient &json,
                                            owm_resp_air_pollution_t &r);
 
@@ -0,0 +1,55 @@
+/* Font declarations for the asset archive for esp32-weather-epd.
+ * Copyright (C) 2022-2026  Luke Marzen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef __ASSET_FONTS_H__
+#define __ASSET_FONTS_H__
+
+#include <gfxfont.h>
+
+/*
+ * Used as FONT_HEADER when USE_ASSET_PARTITION is defined. The fonts are bound
+ * to the asset archive by assetsBegin(); the family is chosen when the archive
+ * is packed.
+ */
+#define ASSET_FONTS(X) \
+  X(4pt8b)  X(5pt8b)  X(6pt8b)  X(7pt8b)  X(8pt8b)  X(9pt8b)  X(10pt8b)      \
+  X(11pt8b) X(12pt8b) X(14pt8b) X(16pt8b) X(18pt8b) X(20pt8b) X(22pt8b)      \
+  X(24pt8b) X(26pt8b) X(48pt8b_temperature)
+
+#define ASSET_FONT_DECL(name) extern GFXfont asset_FONT_##name;
+ASSET_FONTS(ASSET_FONT_DECL)
+#undef ASSET_FONT_DECL
+
+#define FONT_4pt8b  asset_FONT_4pt8b
+#define FONT_5pt8b  asset_FONT_5pt8b
+#define FONT_6pt8b  asset_FONT_6pt8b
+#define FONT_7pt8b  asset_FONT_7pt8b
+#define FONT_8pt8b  asset_FONT_8pt8b
+#define FONT_9pt8b  asset_FONT_9pt8b
+#define FONT_10pt8b asset_FONT_10pt8b
+#define FONT_11pt8b asset_FONT_11pt8b
+#define FONT_12pt8b asset_FONT_12pt8b
+#define FONT_14pt8b asset_FONT_14pt8b
+#define FONT_16pt8b asset_FONT_16pt8b
+#define FONT_18pt8b asset_FONT_18pt8b
+#define FONT_20pt8b asset_FONT_20pt8b
+#define FONT_22pt8b asset_FONT_22pt8b
+#define FONT_24pt8b asset_FONT_24pt8b
+#define FONT_26pt8b asset_FONT_26pt8b
+#define FONT_48pt8b_temperature asset_FONT_48pt8b_temperature
+
+#endif
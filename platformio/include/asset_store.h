@@ -0,0 +1,120 @@
+/* Asset archive declarations for esp32-weather-epd.
+ * Copyright (C) 2022-2026  Luke Marzen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef __ASSET_STORE_H__
+#define __ASSET_STORE_H__
+
+#include <cstdint>
+#include <gfxfont.h>
+
+/*
+ * The asset archive is a packed image of fonts and icons written to its own
+ * flash data partition by assets/pack_assets.py, so that it can be updated
+ * independently of the firmware. It is memory mapped and used in place.
+ *
+ * Layout (little endian):
+ *   asset_header_t
+ *   asset_entry_t[entry_count]  sorted by key
+ *   data
+ * Icon data is the raw 1-bit bitmap. Font data is an asset_font_t followed by
+ * the GFXglyph table and the glyph bitmaps.
+ */
+#define ASSET_MAGIC          0x41445045 // "EPDA"
+#define ASSET_FORMAT_VERSION 1
+
+typedef struct asset_header
+{
+  uint32_t magic;
+  uint16_t format_version;
+  uint16_t entry_count;
+  uint32_t asset_version;  // set by the packer, reported at boot
+  uint32_t total_size;     // archive size in bytes
+} asset_header_t;
+
+enum asset_type : uint16_t
+{
+  ASSET_BITMAP = 0,
+  ASSET_FONT   = 1,
+};
+
+typedef struct asset_entry
+{
+  uint32_t key;     // assetKey() of the asset name
+  uint32_t offset;  // from the start of the archive
+  uint32_t size;
+  uint16_t type;
+  uint16_t reserved;
+} asset_entry_t;
+
+typedef struct asset_font
+{
+  uint32_t glyph_offset;   // from the start of this struct
+  uint32_t bitmap_offset;  // from the start of this struct
+  uint16_t first;
+  uint16_t last;
+  uint8_t  yAdvance;
+  uint8_t  reserved[3];
+} asset_font_t;
+
+/*
+ * assetKey
+ *
+ * FNV-1a hash of the asset name, e.g. "FONT_10pt8b". Icons are named like the
+ * bitmaps in the icon headers: assetKey("wi_day_sunny", 32) hashes
+ * "wi_day_sunny_32x32".
+ */
+constexpr uint32_t assetHash(uint32_t h, char c)
+{
+  return (h ^ static_cast<uint8_t>(c)) * 16777619u;
+}
+constexpr uint32_t assetHash(uint32_t h, const char *s)
+{
+  for (; *s; ++s)
+  {
+    h = assetHash(h, *s);
+  }
+  return h;
+}
+constexpr uint32_t assetHash(uint32_t h, unsigned n)
+{
+  unsigned d = 1;
+  while (n / d >= 10)
+  {
+    d *= 10;
+  }
+  for (; d; d /= 10)
+  {
+    h = assetHash(h, static_cast<char>('0' + n / d % 10));
+  }
+  return h;
+}
+constexpr uint32_t assetKey(const char *name)
+{
+  return assetHash(2166136261u, name);
+}
+constexpr uint32_t assetKey(const char *name, unsigned size)
+{
+  uint32_t h = assetHash(assetHash(assetKey(name), '_'), size);
+  return assetHash(assetHash(h, 'x'), size);
+}
+
+bool assetsBegin();
+void assetsEnd();
+uint32_t getAssetsVersion();
+const uint8_t *getAssetBitmap(uint32_t key);
+
+#endif
@@ -63,14 +63,18 @@ extern int           SilentErr;
 void drawWebIcon     ( int active );
 #endif //WEB_SVR
 
+class ParsePipeline;
+
 wl_status_t startWiFi(int &wifiRSSI, int web_mode);
 void        killWiFi();
 
 #ifdef USE_HTTP
-  int getOWMonecall(WiFiClient &client, owm_resp_onecall_t &r);
+  int getOWMonecall(WiFiClient &client, owm_resp_onecall_t &r,
+                    ParsePipeline *pipeline = nullptr);
   int getOWMairpollution(WiFiClient &client, owm_resp_air_pollution_t &r, int64_t curdt);
 #else
-  int getOWMonecall(WiFiClientSecure &client, owm_resp_onecall_t &r);
+  int getOWMonecall(WiFiClientSecure &client, owm_resp_onecall_t &r,
+                    ParsePipeline *pipeline = nullptr);
   int getOWMairpollution(WiFiClientSecure &client, owm_resp_air_pollution_t &r, int64_t curdt);
 #endif
 
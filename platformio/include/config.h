@@ -142,6 +142,27 @@ extern unsigned int  WicTemp;
 // Hide password in Wifi Web page when defined
 //#define WEB_HIDE_PWD
 
+// Single page configuration UI, served at /ui
+// The page, script and style sheet under web/ are gzip-compressed at build
+// time (web/pack_web.py, with the labels of LOCALE) and stored in the
+// firmware. They are sent as they are, with an ETag so that the browser asks
+// again only after a firmware update; the configuration itself is fetched
+// from /api/config. The former pages remain available.
+//#define WEB_UI
+
+// Apply the parameters without reboot
+// "Update" refreshes the display from the Web loop, with the WiFi connection
+// in use, and the Web server stays active. Without it (or when only the local
+// access point is up), the station enters deep sleep and boots again.
+#define WEB_APPLY_IN_PLACE
+
+// Preview of the frame in RAM, at /preview (requires DISPLAY_RLE_FRAME)
+// /preview.pbm sends the frame shown on the panel as a PBM image, or with
+// /preview.pbm?render a frame drawn with the current parameters (weather
+// fetched again), without refreshing the panel. The image is packed from the
+// encoded rows as it is sent. Colors other than white are black in the image.
+//#define WEB_PREVIEW
+
 // Max Active time (sec) allowed after Web server started (msec)
 // Reset every time Wifi or Weather Web pages are submitted
 #define DEF_MAXACT_TIM 180
@@ -160,6 +181,8 @@ extern unsigned int  WicTemp;
  */
 void retrieve_config ( void );
 void web_svr_setup   ( void );
+void config_flush    ( void );
+void config_hold     ( int hold );
 
 extern String VLoc[];
 extern String VLat[];
@@ -187,6 +210,9 @@ void drawWebIcon     ( int active );
 
 extern unsigned long startTime;
 extern unsigned long restart_delay;
+extern unsigned long refreshTime;
+extern volatile unsigned long refresh_at;
+extern volatile int           refresh_pending;
 
 #else
 /*
@@ -513,12 +539,17 @@ extern unsigned long restart_delay;
 //   Secondary Intercardinal   16  ±11.250°   1,152B  NNE
 //   Tertiary Intercardinal    32   ±5.625°   2,304B  NbE
 //   (360)                    360   ±0.500°  25,920B  1°
+//   (360) Procedural         360   ±0.500°     470B  1°
+// Procedural icons are rotated at runtime from a single master arrow. The last
+// WIND_ICONS_CACHE_SIZE rotated icons are kept in RAM (72B each).
 // Uncomment your preferred wind level direction precision.
 // #define WIND_ICONS_CARDINAL
 // #define WIND_ICONS_INTERCARDINAL
 #define WIND_ICONS_SECONDARY_INTERCARDINAL
 // #define WIND_ICONS_TERTIARY_INTERCARDINAL
 // #define WIND_ICONS_360
+// #define WIND_ICONS_PROCEDURAL
+#define WIND_ICONS_CACHE_SIZE 1
 
 // WIDGET POSITIONS
 // Set the order of current condition you want to display
@@ -553,6 +584,26 @@ extern unsigned long restart_delay;
 // #define MOONPHASE_PRIMARY
 #define MOONPHASE_ALTERNATIVE
 
+// Draw the moon phase procedurally instead of using the 48x48 icons. The phase
+// is continuous rather than one of 28 steps, and the icon set is not linked.
+// The lit side is mirrored when MOONPHASE_SOUTHERN_HEMISPHERE is defined.
+// #define MOONPHASE_PROCEDURAL
+// #define MOONPHASE_SOUTHERN_HEMISPHERE
+
+// WEATHER CONDITIONS ICONS
+// By default the weather conditions icons are stored at every size they are
+// drawn (32x32 hourly, 64x64 daily, 196x196 current). When ICONS_DOWNSCALE is
+// defined only the ICONS_MASTER_SIZE icons are stored, the smaller sizes are
+// box filtered at runtime and the last ICONS_CACHE_SIZE results are kept in RAM
+// (ICONS_CACHE_MAX_SIZE^2/8 bytes each).
+//   STORAGE    per size   master only
+//   Flash        ~277kB        ~245kB
+//   RAM              0B     ~4kB (8 x 64x64)
+// #define ICONS_DOWNSCALE
+#define ICONS_MASTER_SIZE    196
+#define ICONS_CACHE_SIZE     8
+#define ICONS_CACHE_MAX_SIZE 64
+
 // FONTS
 // A handful of popular Open Source typefaces have been included with this
 // project for your convenience. Change the font by selecting its corresponding
@@ -574,6 +625,10 @@ extern unsigned long restart_delay;
 //   Ubuntu         Ubuntu_R.h               Ubuntu font     UFL v1.0
 //   Ubuntu Mono    UbuntuMono_R.h           Ubuntu font     UFL v1.0
 //
+// FreeSans_RLE.h is FreeSans with run-length encoded glyphs for sizes 12pt and
+// up (~25% less flash), drawn as spans by the renderer. Other families can be
+// generated the same way, see fonts/README.
+//
 // Adding new fonts is relatively straightforward, see fonts/README.
 //
 // Note:
@@ -583,6 +638,177 @@ extern unsigned long restart_delay;
 //   other artifacts.
 #define FONT_HEADER "fonts/FreeSans.h"
 
+// FONT SUBSET
+// Uncomment to build with a copy of the FONT_HEADER family that only keeps the
+// bitmaps of the glyphs that can be drawn for LOCALE: printable ASCII, the
+// characters of the locale strings and the accented letters OpenWeatherMap
+// uses for OWM_LANG. Saves ~65-100kB of flash with FreeSans. The headers are
+// generated at build time by fonts/subset_fonts.py. Characters typed in the
+// web configuration that are not part of the subset are drawn as blanks.
+// #define FONT_SUBSET
+#ifdef FONT_SUBSET
+  #undef FONT_HEADER
+  #define FONT_HEADER "font_subset.h"
+#endif
+
+// ASSET PARTITION
+// Fonts and weather conditions icons can be read from a separate flash data
+// partition instead of being compiled into the firmware, so OTA updates of the
+// firmware are smaller and the assets can be updated on their own. The archive
+// is built with assets/pack_assets.py (the font family is chosen there and
+// FONT_HEADER is ignored) and the partition table must have an
+// ASSET_PARTITION_LABEL data partition, see partitions_assets.csv.
+// #define USE_ASSET_PARTITION
+#define ASSET_PARTITION_LABEL "assets"
+#define ASSET_MAX_BITMAP_SIZE 196
+#ifdef USE_ASSET_PARTITION
+  #undef FONT_HEADER
+  #define FONT_HEADER "asset_fonts.h"
+#endif
+
+// FULL FRAME RENDERING
+// The 3-color and 7-color panels are rendered in 2 and 4 pages: the whole
+// screen is drawn once per page, clipped to it, because a full frame buffer
+// (96kB and 192kB) does not fit in internal RAM. When DISPLAY_FULL_FRAME_PSRAM
+// is defined and the board has PSRAM (e.g. WROVER modules) the frame buffer is
+// allocated there and every frame is drawn in a single pass. Without PSRAM the
+// display falls back to pages at boot. With LOG_LEVEL 4 (debug) the draw time,
+// total frame time, page count and free memory are logged after each full
+// refresh, in either mode.
+// #define DISPLAY_FULL_FRAME_PSRAM
+
+// RLE FRAME BUFFER
+// Alternatively every panel can be rendered in a single pass without PSRAM:
+// when DISPLAY_RLE_FRAME is defined the frame is drawn into rows of color runs
+// in internal RAM (~40kB for a busy weather screen, against 96kB/192kB for a
+// full 3C/7C frame) and sent to the panel in strips of RLE_FRAME_STRIP_ROWS
+// rows. Drawing decodes the
+// rows it touches into RLE_FRAME_ROW_CACHE lines of DISP_WIDTH bytes. The
+// previous frame is kept (rows are shared copy-on-write): a full refresh is
+// skipped when nothing changed, partial refreshes only update the changed area.
+// #define DISPLAY_RLE_FRAME
+#define RLE_FRAME_ROW_CACHE  16
+#define RLE_FRAME_STRIP_ROWS 16
+
+// PIPELINED PAGE TRANSFER
+// With the default paged rendering each page is drawn, then sent to the panel
+// controller over SPI while the CPU waits, so a frame takes the sum of the two.
+// When DISPLAY_PAGE_PIPELINE is defined pages of PAGE_PIPELINE_HEIGHT rows are
+// drawn into two buffers in turn, and a task on core PAGE_PIPELINE_CORE sends
+// each completed page while the next one is drawn. Uses 2 page buffers
+// (2 x 12kB for 120 rows on the 7.5in BW panel, 24kB for 3C, 48kB for 7C).
+// As with GxEPD2 paged rendering, the BW panels draw the pages a second time
+// after a refresh, to write the controller buffer used by partial refreshes.
+// #define DISPLAY_PAGE_PIPELINE
+#define PAGE_PIPELINE_HEIGHT 120
+#define PAGE_PIPELINE_CORE   0
+
+// PARSE PIPELINE
+// By default the One Call response is received and parsed as a whole, and the
+// screen is drawn once every request is complete. When PARSE_PIPELINE is
+// defined and the display is drawn in a single page (BW panels, or
+// DISPLAY_RLE_FRAME, or DISPLAY_FULL_FRAME_PSRAM with PSRAM) the response is
+// parsed one section at a time and, as soon as their data is parsed, the
+// location/date, forecast, outlook graph and alerts are drawn by a task on core
+// PARSE_PIPELINE_CORE, while this core finishes parsing and requests the air
+// pollution and reads the sensor. The display is powered on from the start of
+// the request.
+// #define PARSE_PIPELINE
+#define PARSE_PIPELINE_CORE       0
+#define PARSE_PIPELINE_STACK      8192
+#define PARSE_PIPELINE_MAX_STAGES 8
+
+// STATIC LAYER
+// The icons and labels of the current conditions and the axis and gridlines of
+// the outlook graph do not depend on the weather data. When STATIC_LAYER is
+// defined they are rendered once into a 1-bit layer, stored compressed in the
+// STATIC_LAYER_PARTITION_LABEL flash partition and drawn from it at the start
+// of every frame. The layer partition of partitions_assets.csv and
+// partitions_glyphs.csv is used, or else the spiffs partition of
+// min_spiffs.csv, which this firmware does not use. Without the partition the
+// layer is not used. The layer is rendered again when the number of hours
+// of the graph, the graph icons settings or the firmware (units, slot
+// positions, locale) change. It is rendered in bands of STATIC_LAYER_BAND_ROWS
+// rows, and is not stored when larger than STATIC_LAYER_MAX_BYTES.
+// #define STATIC_LAYER
+#define STATIC_LAYER_MAX_BYTES       32768
+#define STATIC_LAYER_BAND_ROWS       32
+
+// RENDER PROFILER
+// When RENDER_PROFILER is defined the time spent in each widget (drawForecast,
+// drawOutlookGraph...) and in each page of the weather screen is measured with
+// the CPU cycle counter. The report is printed on the serial monitor after the
+// full refresh and, when the web server is enabled, served at /profile.
+// Without it the instrumentation is not compiled.
+// #define RENDER_PROFILER
+#define PROFILE_MAX_PAGES 8
+
+// STATION METRICS
+// When STATION_METRICS is defined the duration of the wake phases (boot, WiFi,
+// OWM requests, sensor, drawing, whole wake), the latency, parse time, size,
+// errors and retries of the OWM requests, the time of each page, the WiFi RSSI
+// and the battery voltage are accumulated in RTC memory across deep sleeps
+// (from power on). While the web server is active they are served with the
+// heap usage at /metrics, in the Prometheus text format; scraping does not
+// require the web key nor keep the station awake.
+// #define STATION_METRICS
+
+// LOGGING
+// Log lines have a level: 1 error, 2 warning, 3 info, 4 debug. The lines above
+// LOG_LEVEL are not compiled (0 removes them all); the level can be lowered at
+// run time with /log?level=N, kept across deep sleeps. A line is formatted in
+// a buffer of LOG_LINE_MAX bytes (longer ones are cut) without heap
+// allocation, and appended to a ring of LOG_RING_SIZE bytes (power of 2) in
+// RTC memory, which keeps the last lines of the previous wakes until power
+// off; when the web server is enabled it can be read at /log. The serial port
+// only gets what its transmit buffer can take, the rest follows with the next
+// lines, from the Web loop, and for up to LOG_FLUSH_MS before deep sleep.
+#define LOG_LEVEL     3
+#define LOG_LINE_MAX  160
+#define LOG_RING_SIZE 2048
+#define LOG_FLUSH_MS  50
+
+// ADAPTIVE REFRESH
+// When FAST_REFRESH is defined the weather screen is normally updated with the
+// panel's fast full refresh waveform (7.5in v2 panel only, others always use
+// the standard one), which takes less time but leaves some ghosting. A clean
+// refresh with the standard waveform is done:
+//   - after FAST_REFRESH_CLEAN_INTERVAL fast refreshes,
+//   - on the first update from FAST_REFRESH_CLEAN_HOUR (0-23) each day, -1 to
+//     disable,
+//   - when the indoor temperature is below FAST_REFRESH_MIN_TEMP (Celsius), the
+//     fast waveform is not compensated for low temperatures,
+//   - when FAST_REFRESH_MAX_CHANGES or more of the current and forecast icons,
+//     alert count and date changed since the previous screen,
+//   - after a power on or an error screen.
+// #define FAST_REFRESH
+#define FAST_REFRESH_CLEAN_INTERVAL 12
+#define FAST_REFRESH_CLEAN_HOUR      3
+#define FAST_REFRESH_MIN_TEMP       10
+#define FAST_REFRESH_MAX_CHANGES     3
+
+// GLYPH PAGES
+// The 8-bit fonts only cover Latin-1. When USE_GLYPH_PAGES is defined, strings
+// are decoded as UTF-8 and characters outside the font (Cyrillic, Greek, CJK...
+// in city names or in OpenWeatherMap descriptions for OWM_LANG) are drawn from
+// glyph pages stored in the GLYPH_PARTITION_LABEL flash partition and indexed
+// by codepoint. Only the glyphs on the display are read, the last
+// GLYPH_CACHE_SIZE glyphs (at most GLYPH_CACHE_BYTES bytes of bitmaps) are kept
+// in RAM. The pages are built with fonts/fontconvert/glyphpack, see
+// fonts/README and partitions_glyphs.csv.
+// #define USE_GLYPH_PAGES
+#define GLYPH_PARTITION_LABEL "glyphs"
+#define GLYPH_CACHE_SIZE  64
+#define GLYPH_CACHE_BYTES 8192
+
+// Partition of the static layer (see STATIC LAYER), from the partition table
+// the options above select
+#if defined(USE_ASSET_PARTITION) || defined(USE_GLYPH_PAGES)
+  #define STATIC_LAYER_PARTITION_LABEL "layer"
+#else
+  #define STATIC_LAYER_PARTITION_LABEL "spiffs"
+#endif
+
 // FORECAST TEMPERATURE ORDER
 // The order of temperture Hi|Lo can optionally be configured using
 // the following options.
@@ -785,9 +1011,33 @@ extern const uint32_t MIN_BATTERY_VOLTAGE;
       ^ defined(WIND_ICONS_INTERCARDINAL)           \
       ^ defined(WIND_ICONS_SECONDARY_INTERCARDINAL) \
       ^ defined(WIND_ICONS_TERTIARY_INTERCARDINAL)  \
-      ^ defined(WIND_ICONS_360))
+      ^ defined(WIND_ICONS_360)                     \
+      ^ defined(WIND_ICONS_PROCEDURAL))
   #error Invalid configuration. Exactly one wind direction icon precision level must be selected.
 #endif
+#if defined(WIND_ICONS_PROCEDURAL) && !(WIND_ICONS_CACHE_SIZE >= 1)
+  #error Invalid configuration. WIND_ICONS_CACHE_SIZE must be at least 1.
+#endif
+#if defined(DISPLAY_RLE_FRAME) && defined(DISPLAY_FULL_FRAME_PSRAM)
+  #error Invalid configuration. DISPLAY_RLE_FRAME and DISPLAY_FULL_FRAME_PSRAM can not be combined.
+#endif
+#if defined(DISPLAY_RLE_FRAME) && !(RLE_FRAME_ROW_CACHE >= 2)
+  #error Invalid configuration. RLE_FRAME_ROW_CACHE must be at least 2.
+#endif
+#if defined(DISPLAY_PAGE_PIPELINE) \
+ && (defined(DISPLAY_RLE_FRAME) || defined(DISPLAY_FULL_FRAME_PSRAM))
+  #error Invalid configuration. DISPLAY_PAGE_PIPELINE can not be combined with DISPLAY_RLE_FRAME or DISPLAY_FULL_FRAME_PSRAM.
+#endif
+#if defined(DISPLAY_PAGE_PIPELINE) && !(PAGE_PIPELINE_HEIGHT >= 1)
+  #error Invalid configuration. PAGE_PIPELINE_HEIGHT must be at least 1.
+#endif
+#if defined(FAST_REFRESH) && !(FAST_REFRESH_CLEAN_HOUR >= -1 \
+                               && FAST_REFRESH_CLEAN_HOUR <= 23)
+  #error Invalid configuration. FAST_REFRESH_CLEAN_HOUR must be -1 or 0-23.
+#endif
+#if defined(USE_GLYPH_PAGES) && !(GLYPH_CACHE_SIZE >= 1)
+  #error Invalid configuration. GLYPH_CACHE_SIZE must be at least 1.
+#endif
 #if !(defined(FONT_HEADER))
   #error Invalid configuration. Font not selected.
 #endif
@@ -810,5 +1060,26 @@ extern const uint32_t MIN_BATTERY_VOLTAGE;
       ^ defined(MOONPHASE_ALTERNATIVE))
   #error Invalid configuration. Exactly one moon phase style must be selected.
 #endif
+#if defined(STATIC_LAYER) && (STATIC_LAYER_BAND_ROWS < 1)
+  #error Invalid configuration. STATIC_LAYER_BAND_ROWS must be at least 1.
+#endif
+#if defined(WEB_UI) && !defined(WEB_SVR)
+  #error Invalid configuration. WEB_UI requires WEB_SVR.
+#endif
+#if defined(STATION_METRICS) && !defined(WEB_SVR)
+  #error Invalid configuration. STATION_METRICS requires WEB_SVR.
+#endif
+#if defined(WEB_PREVIEW) && !(defined(WEB_SVR) && defined(DISPLAY_RLE_FRAME))
+  #error Invalid configuration. WEB_PREVIEW requires WEB_SVR and DISPLAY_RLE_FRAME.
+#endif
+#if !defined(LOG_LEVEL) || (LOG_LEVEL < 0) || (LOG_LEVEL > 4)
+  #error Invalid configuration. LOG_LEVEL must be 0-4.
+#endif
+#if (LOG_RING_SIZE < LOG_LINE_MAX) || (LOG_RING_SIZE & (LOG_RING_SIZE - 1))
+  #error Invalid configuration. LOG_RING_SIZE must be a power of 2, at least LOG_LINE_MAX.
+#endif
+#if LOG_LINE_MAX < 32
+  #error Invalid configuration. LOG_LINE_MAX must be at least 32.
+#endif
 
 #endif
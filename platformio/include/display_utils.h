@@ -78,7 +78,9 @@ const char *getHttpResponsePhrase(int code);
 const char *getWifiStatusPhrase(wl_status_t status);
 void printHeapUsage();
 void disableBuiltinLED();
+#ifndef MOONPHASE_PROCEDURAL
 const uint8_t *getMoonPhaseBitmap48(const owm_daily_t &daily);
+#endif
 const char *getMoonPhaseStr(const owm_daily_t &daily);
 
 #endif
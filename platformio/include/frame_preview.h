@@ -0,0 +1,74 @@
+/* Frame buffer preview for esp32-weather-epd.
+ * Copyright (C) 2022-2026  Luke Marzen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef __FRAME_PREVIEW_H__
+#define __FRAME_PREVIEW_H__
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include "config.h"
+
+#ifdef WEB_PREVIEW
+#include "rle_frame.h"
+
+/*
+ * Sends a frame as a binary PBM image (P4), white pixels are 0 and all the
+ * other colors 1. The bytes are packed from the runs of the encoded rows as
+ * read() is called, without a copy of the frame or of a row, so the frame
+ * must not be drawn on until the image is sent.
+ */
+class PbmStream
+{
+public:
+  explicit PbmStream(RleFrame &frame);
+
+  // Fills buf with up to len bytes of the image, returns 0 at the end
+  size_t read(uint8_t *buf, size_t len);
+
+private:
+  RleFrame       &_frame;
+  char            _header[20];
+  size_t          _header_len;
+  size_t          _header_sent;
+  int16_t         _y;      // row being sent
+  int16_t         _x;      // first pixel of the next byte
+  const uint16_t *_run;    // run of pixel _x, nullptr at the start of a row
+  uint16_t        _left;   // pixels left in the run
+}; // end class PbmStream
+
+/*
+ * The preview is requested by the Web server and the frame is drawn by the
+ * Web loop: the server moves the state from IDLE to CURRENT (the frame shown
+ * on the panel) or RENDER (a frame drawn with the current parameters), the
+ * loop draws it then moves the state to READY, and the server sends the
+ * frame until the client disconnects (DONE). The loop then drops the drawn
+ * frame and goes back to IDLE. The frame is not drawn on in between.
+ */
+typedef enum preview_state
+{
+  PREVIEW_IDLE,
+  PREVIEW_CURRENT,
+  PREVIEW_RENDER,
+  PREVIEW_READY,
+  PREVIEW_DONE,
+} preview_state_t;
+
+extern std::atomic<int> preview_state;
+
+#endif // WEB_PREVIEW
+#endif
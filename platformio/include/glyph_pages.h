@@ -0,0 +1,89 @@
+/* Unicode glyph pages for esp32-weather-epd.
+ * Copyright (C) 2022-2026  Luke Marzen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef __GLYPH_PAGES_H__
+#define __GLYPH_PAGES_H__
+
+#include <cstdint>
+
+/*
+ * Glyph pages hold the characters that the 8-bit fonts can not draw (Cyrillic,
+ * Greek, CJK...), indexed by codepoint, in their own flash data partition. They
+ * are written by fonts/fontconvert/glyphpack and are not memory mapped: each
+ * glyph is read from flash the first time a frame draws it and then kept in a
+ * small LRU cache, so RAM use depends on the number of different glyphs on the
+ * display rather than on the size of the character set.
+ *
+ * Layout (little endian):
+ *   glyph_pages_header_t
+ *   glyph_pages_font_t[font_count]        one per point size
+ *   per font:
+ *     glyph_pages_glyph_t[glyph_count]    sorted by codepoint
+ *     bitmaps                             bit packed like GFXfont bitmaps
+ */
+#define GLYPH_PAGES_MAGIC          0x47445045 // "EPDG"
+#define GLYPH_PAGES_FORMAT_VERSION 1
+
+typedef struct glyph_pages_header
+{
+  uint32_t magic;
+  uint16_t format_version;
+  uint16_t font_count;
+  uint32_t total_size;
+} glyph_pages_header_t;
+
+typedef struct glyph_pages_font
+{
+  uint16_t size_pt;
+  uint8_t  yAdvance;
+  uint8_t  reserved;
+  uint32_t glyph_count;
+  uint32_t index_offset;   // from the start of the partition
+  uint32_t bitmap_offset;  // from the start of the partition
+} glyph_pages_font_t;
+
+typedef struct glyph_pages_glyph
+{
+  uint32_t codepoint;
+  uint32_t bitmap_offset;  // from the font bitmap_offset
+  uint8_t  width;
+  uint8_t  height;
+  uint8_t  xAdvance;
+  int8_t   xOffset;
+  int8_t   yOffset;
+  uint8_t  reserved[3];
+} glyph_pages_glyph_t;
+
+/*
+ * A glyph read from the pages. The bitmap is owned by the cache and stays
+ * valid until the next call to getPagedGlyph().
+ */
+typedef struct paged_glyph
+{
+  uint8_t  width;
+  uint8_t  height;
+  uint8_t  xAdvance;
+  int8_t   xOffset;
+  int8_t   yOffset;
+  const uint8_t *bitmap;
+} paged_glyph_t;
+
+bool glyphPagesBegin();
+void glyphPagesEnd();
+const paged_glyph_t *getPagedGlyph(uint16_t size_pt, uint32_t codepoint);
+
+#endif
@@ -0,0 +1,94 @@
+/* Levelled logging for esp32-weather-epd.
+ * Copyright (C) 2022-2026  Luke Marzen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef __LOGGER_H__
+#define __LOGGER_H__
+
+#include <cstddef>
+#include <cstdint>
+#include "config.h"
+
+#define LOG_LEVEL_NONE  0
+#define LOG_LEVEL_ERROR 1
+#define LOG_LEVEL_WARN  2
+#define LOG_LEVEL_INFO  3
+#define LOG_LEVEL_DEBUG 4
+
+/*
+ * Log lines are formatted with printf into a buffer on the stack (no heap),
+ * prefixed with the time since reset and the level, and appended to a ring
+ * kept in RTC memory: it holds the last LOG_RING_SIZE bytes of the logs of
+ * the previous wakes too (it starts empty on power on). The serial port is
+ * fed from the ring only with what its transmit buffer can take, so a log
+ * call never waits for the UART; what is left is sent by the next calls or by
+ * logDrain().
+ */
+
+// Serial.begin(), with a transmit buffer for the drain; marks the wake
+// in the ring
+void logBegin(unsigned long baud);
+void logWrite(uint8_t level, const char *fmt, ...)
+  __attribute__((format(printf, 2, 3)));
+// Sends to the serial port what its transmit buffer can take
+void logDrain();
+// Sends the rest for up to ms milliseconds (before deep sleep)
+void logFlush(uint32_t ms);
+// Run time level, up to LOG_LEVEL, kept across deep sleeps
+void logSetLevel(uint8_t level);
+uint8_t logGetLevel();
+
+/*
+ * Writes the lines of the ring into the buffers given by read(), from the
+ * oldest one to the last one logged when the stream was created. Lines
+ * overwritten meanwhile are skipped.
+ */
+class LogStream
+{
+public:
+  LogStream();
+
+  // Fills buf with up to len bytes of the log, returns 0 at the end
+  size_t read(uint8_t *buf, size_t len);
+
+private:
+  uint32_t _pos;
+  uint32_t _end;
+  bool     _skipPartial; // up to the start of the next line
+};
+
+#if LOG_LEVEL >= LOG_LEVEL_ERROR
+  #define LOG_E(...) logWrite(LOG_LEVEL_ERROR, __VA_ARGS__)
+#else
+  #define LOG_E(...) ((void)0)
+#endif
+#if LOG_LEVEL >= LOG_LEVEL_WARN
+  #define LOG_W(...) logWrite(LOG_LEVEL_WARN, __VA_ARGS__)
+#else
+  #define LOG_W(...) ((void)0)
+#endif
+#if LOG_LEVEL >= LOG_LEVEL_INFO
+  #define LOG_I(...) logWrite(LOG_LEVEL_INFO, __VA_ARGS__)
+#else
+  #define LOG_I(...) ((void)0)
+#endif
+#if LOG_LEVEL >= LOG_LEVEL_DEBUG
+  #define LOG_D(...) logWrite(LOG_LEVEL_DEBUG, __VA_ARGS__)
+#else
+  #define LOG_D(...) ((void)0)
+#endif
+
+#endif
@@ -0,0 +1,119 @@
+/* Station metrics for esp32-weather-epd.
+ * Copyright (C) 2022-2026  Luke Marzen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef __METRICS_H__
+#define __METRICS_H__
+
+#include <cstddef>
+#include <cstdint>
+#include "config.h"
+
+/*
+ * Counters, gauges and histograms of the wake cycles, kept in RTC memory so
+ * they add up across deep sleeps (they start again from zero on power on),
+ * and written in the Prometheus text exposition format. Durations are given
+ * in milliseconds. When STATION_METRICS is not defined the macros expand to
+ * nothing.
+ */
+typedef enum metrics_phase
+{
+  METRICS_BOOT,    // reset to WiFi start
+  METRICS_WIFI,    // WiFi connection
+  METRICS_FETCH,   // OWM requests
+  METRICS_SENSOR,  // indoor sensor
+  METRICS_RENDER,  // drawing and panel refresh
+  METRICS_AWAKE,   // reset to deep sleep
+  METRICS_PHASE_COUNT
+} metrics_phase_t;
+
+typedef enum metrics_endpoint
+{
+  METRICS_ONECALL,
+  METRICS_AIR_POLLUTION,
+  METRICS_ENDPOINT_COUNT
+} metrics_endpoint_t;
+
+#ifdef STATION_METRICS
+
+void metricsBeginCycle();
+void metricsPhase(metrics_phase_t phase, uint32_t ms);
+// The phases follow each other: metricsPhaseEnd() records the time since the
+// previous end (or mark, or reset) for phase
+void metricsMark();
+void metricsPhaseEnd(metrics_phase_t phase);
+// One attempt: status as returned by getOWM*(), latency up to the response
+// headers, parse time (body included), Content-Length (< 0 if unknown)
+void metricsHttp(metrics_endpoint_t endpoint, int status, uint32_t latency_ms,
+                 uint32_t parse_ms, int32_t bytes);
+void metricsRetry(metrics_endpoint_t endpoint);
+void metricsPage(uint32_t ms);
+void metricsWiFi(int rssi);
+void metricsBattery(uint32_t mv);
+void metricsHeap();
+
+/*
+ * Writes the metrics into the buffers given by read(), a line at a time,
+ * without formatting the whole text at once.
+ */
+class MetricsStream
+{
+public:
+  MetricsStream();
+
+  // Fills buf with up to len bytes of the text, returns 0 at the end
+  size_t read(uint8_t *buf, size_t len);
+
+private:
+  uint8_t _family;
+  uint8_t _series;
+  uint8_t _line;
+  size_t  _len;    // length of the line in _text
+  size_t  _sent;   // bytes of the line already sent
+  char    _text[160];
+
+  bool nextLine();
+}; // end class MetricsStream
+
+#define METRICS_BEGIN_CYCLE()            metricsBeginCycle()
+#define METRICS_PHASE(phase, ms)         metricsPhase(phase, ms)
+#define METRICS_MARK()                   metricsMark()
+#define METRICS_PHASE_END(phase)         metricsPhaseEnd(phase)
+#define METRICS_HTTP(ep, st, lat, parse, bytes) \
+  metricsHttp(ep, st, lat, parse, bytes)
+#define METRICS_RETRY(ep)                metricsRetry(ep)
+#define METRICS_PAGE(ms)                 metricsPage(ms)
+#define METRICS_WIFI(rssi)               metricsWiFi(rssi)
+#define METRICS_BATTERY(mv)              metricsBattery(mv)
+#define METRICS_HEAP()                   metricsHeap()
+
+#else
+
+// statements, so that they can be the body of an if
+#define METRICS_BEGIN_CYCLE()                   ((void)0)
+#define METRICS_PHASE(phase, ms)                ((void)0)
+#define METRICS_MARK()                          ((void)0)
+#define METRICS_PHASE_END(phase)                ((void)0)
+#define METRICS_HTTP(ep, st, lat, parse, bytes) ((void)0)
+#define METRICS_RETRY(ep)                       ((void)0)
+#define METRICS_PAGE(ms)                        ((void)0)
+#define METRICS_WIFI(rssi)                      ((void)0)
+#define METRICS_BATTERY(mv)                     ((void)0)
+#define METRICS_HEAP()                          ((void)0)
+
+#endif // STATION_METRICS
+
+#endif
@@ -0,0 +1,203 @@
+/* Double-buffered page rendering for esp32-weather-epd.
+ * Copyright (C) 2022-2026  Luke Marzen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef __PAGE_PIPELINE_H__
+#define __PAGE_PIPELINE_H__
+
+#include <cstddef>
+#include <cstdint>
+#include <Adafruit_GFX.h>
+#include "config.h"
+
+/*
+ * Paged rendering with two page buffers. When a page is complete it is handed
+ * to a transfer task, which writes it to the controller while the next page is
+ * rendered into the other buffer. Drawing only waits for a transfer when both
+ * buffers are in use, so the frame takes about the longer of the total render
+ * time and the total transfer time instead of their sum.
+ *
+ * Buffers use the panel's native format: 1 bit per pixel (white set) for the
+ * black and white panels, a black plane followed by a color plane for the
+ * 3-color panel, 4 bits per pixel for the 7-color panel. Their rows span the
+ * window (aligned to bytes), the full width unless a partial window is set.
+ *
+ * As GxEPD2_BW, when the panel has fast partial update the frame is drawn a
+ * second time after the refresh (nextPage() returns true again) and its pages
+ * are written to the other controller buffer, which the next partial refresh
+ * compares against.
+ */
+
+/*
+ * Runs one job at a time on a worker (a FreeRTOS task pinned to
+ * PAGE_PIPELINE_CORE, or a std::thread on host builds). Completion is
+ * signalled to wait() by the worker.
+ */
+class PageTransfer
+{
+public:
+  typedef void (*job_t)(void *ctx);
+
+  PageTransfer();
+  ~PageTransfer();
+  // Waits for the previous job, then starts job(ctx) on the worker
+  void start(job_t job, void *ctx);
+  // Blocks until the last job started is complete
+  void wait();
+
+private:
+  struct impl;
+  impl *_impl;
+}; // end class PageTransfer
+
+class PagedFrame : public Adafruit_GFX
+{
+public:
+  PagedFrame(int16_t w, int16_t h, int16_t page_height);
+  virtual ~PagedFrame();
+
+  void drawPixel(int16_t x, int16_t y, uint16_t color) override;
+  void fillScreen(uint16_t color) override;
+  // As GxEPD2: pixels whose bit is clear are drawn with color
+  void drawInvertedBitmap(int16_t x, int16_t y, const uint8_t bitmap[],
+                          int16_t w, int16_t h, uint16_t color);
+
+  void setFullWindow();
+  void setPartialWindow(int16_t x, int16_t y, int16_t w, int16_t h);
+  void firstPage();
+  bool nextPage();
+  uint16_t pages() const;
+  uint16_t pageHeight() const;
+
+  static size_t bufferSize(int16_t w, int16_t page_height);
+
+protected:
+  // Controller buffers written by writePage(): the current one before a
+  // partial refresh (writeImage), both before a full refresh
+  // (writeImageForFullRefresh), the other one after a refresh
+  // (writeImageAgain)
+  typedef enum page_write
+  {
+    PAGE_WRITE_CURRENT,
+    PAGE_WRITE_FULL,
+    PAGE_WRITE_AGAIN,
+  } page_write_t;
+
+  // Called on the transfer worker with columns [x, x + w) of rows
+  // [y, y + rows) of the frame
+  virtual void writePage(const uint8_t *buf, int16_t x, int16_t y, int16_t w,
+                         int16_t rows, page_write_t mode) = 0;
+  // Called once all pages are written; partial is true for a partial window
+  virtual void refresh(bool partial, int16_t x, int16_t y, int16_t w,
+                       int16_t h) = 0;
+  // True if the pages must be written again after the refresh
+  virtual bool writeAgain() const = 0;
+
+private:
+  const int16_t _page_height;
+  uint8_t *_buf[2];
+  uint8_t  _cur;         // buffer being drawn
+  int16_t  _page_y;      // first row of the page being drawn
+  int16_t  _page_rows;
+  int16_t  _y0, _y1;     // rows of the window
+  int16_t  _bx, _bw;     // columns of the buffer rows, the window's aligned
+  bool     _partial;
+  bool     _again;       // second pass, after the refresh
+  int16_t  _wx, _wy, _ww, _wh;
+  PageTransfer _transfer;
+
+  // job arguments, read by the worker
+  const uint8_t *_job_buf;
+  int16_t _job_y, _job_rows;
+  page_write_t _job_mode;
+
+  static void transferJob(void *ctx);
+  void startPage(int16_t y);
+}; // end class PagedFrame
+
+#ifdef ARDUINO
+#include <GxEPD2_EPD.h>
+
+/*
+ * PagedFrame writing to a GxEPD2 driver, with the subset of the GxEPD2 paged
+ * API used by the renderer.
+ */
+template <typename Driver>
+class PipelinedDisplay : public PagedFrame
+{
+public:
+  Driver epd2;
+
+  PipelinedDisplay(Driver driver)
+    : PagedFrame(Driver::WIDTH, Driver::HEIGHT, PAGE_PIPELINE_HEIGHT),
+      epd2(driver) {}
+
+  void init(uint32_t serial_diag_bitrate, bool initial,
+            uint16_t reset_duration, bool pulldown_rst_mode)
+  {
+    epd2.init(serial_diag_bitrate, initial, reset_duration, pulldown_rst_mode);
+  }
+  void hibernate()
+  {
+    epd2.hibernate();
+  }
+
+protected:
+  // The 3-color and 7-color drivers have no fast partial update and only
+  // take writeImage/writeNative
+  void writePage(const uint8_t *buf, int16_t x, int16_t y, int16_t w,
+                 int16_t rows, page_write_t mode) override
+  {
+#if defined(DISP_7C_F)
+    epd2.writeNative(buf, nullptr, x, y, w, rows, false, false, false);
+#elif defined(DISP_3C_B)
+    epd2.writeImage(buf, buf + rows * w / 8, x, y, w, rows,
+                    false, false, false);
+#else
+    if (mode == PAGE_WRITE_FULL)
+    {
+      epd2.writeImageForFullRefresh(buf, x, y, w, rows, false, false, false);
+    }
+    else if (mode == PAGE_WRITE_AGAIN)
+    {
+      epd2.writeImageAgain(buf, x, y, w, rows, false, false, false);
+    }
+    else
+    {
+      epd2.writeImage(buf, x, y, w, rows, false, false, false);
+    }
+#endif
+  }
+  void refresh(bool partial, int16_t x, int16_t y, int16_t w,
+               int16_t h) override
+  {
+    if (partial && epd2.hasPartialUpdate)
+    {
+      epd2.refresh(x, y, w, h);
+    }
+    else
+    {
+      epd2.refresh(false);
+    }
+  }
+  bool writeAgain() const override
+  {
+    return epd2.hasFastPartialUpdate;
+  }
+}; // end class PipelinedDisplay
+#endif // ARDUINO
+
+#endif
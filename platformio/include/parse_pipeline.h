@@ -0,0 +1,140 @@
+/* Parse-to-render pipeline for esp32-weather-epd.
+ * Copyright (C) 2022-2026  Luke Marzen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef __PARSE_PIPELINE_H__
+#define __PARSE_PIPELINE_H__
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#ifndef ARDUINO
+#include <thread>
+#endif
+#include "config.h"
+
+/*
+ * Lock-free single producer, single consumer ring buffer. Holds up to N - 1
+ * items. push() is only called by the producer and pop() by the consumer; an
+ * item and everything written before pushing it are visible to the consumer
+ * once popped.
+ */
+template <typename T, size_t N>
+class SpscQueue
+{
+public:
+  bool push(const T &item)
+  {
+    const size_t head = _head.load(std::memory_order_relaxed);
+    const size_t next = (head + 1) % N;
+    if (next == _tail.load(std::memory_order_acquire))
+    {
+      return false; // full
+    }
+    _items[head] = item;
+    _head.store(next, std::memory_order_release);
+    return true;
+  }
+
+  bool pop(T &item)
+  {
+    const size_t tail = _tail.load(std::memory_order_relaxed);
+    if (tail == _head.load(std::memory_order_acquire))
+    {
+      return false; // empty
+    }
+    item = _items[tail];
+    _tail.store((tail + 1) % N, std::memory_order_release);
+    return true;
+  }
+
+  // Only while neither side is running
+  void clear()
+  {
+    _head.store(0, std::memory_order_relaxed);
+    _tail.store(0, std::memory_order_relaxed);
+  }
+
+private:
+  T _items[N];
+  std::atomic<size_t> _head{0};
+  std::atomic<size_t> _tail{0};
+}; // end class SpscQueue
+
+/*
+ * Runs stages (widget layout and drawing) on a worker, a FreeRTOS task pinned
+ * to PARSE_PIPELINE_CORE or a std::thread on host builds, while the calling
+ * core parses the response and then carries on with the other requests. The
+ * parser publishes sections (bits of a mask) through a SpscQueue as soon as
+ * they are complete, each stage runs once, as soon as all the sections it
+ * needs have been published.
+ *
+ * The parser must not modify a section after publishing it, the stages only
+ * read the sections they declared. Until end() returns, the stages own
+ * whatever they draw on.
+ */
+class ParsePipeline
+{
+public:
+  typedef std::function<void()> stage_t;
+
+  ~ParsePipeline();
+  // Returns false if PARSE_PIPELINE_MAX_STAGES stages were already added
+  bool addStage(uint32_t inputs, stage_t stage);
+  // Starts the worker, every stage runs again (e.g. for a retry)
+  void begin();
+  // Called by the parser
+  void publish(uint32_t sections);
+  // publish() as a plain callback, ctx is the pipeline
+  static void publishTo(void *ctx, uint32_t sections);
+  // Waits for the worker. When complete is true every stage still waiting is
+  // run first, otherwise they are dropped (the parse failed).
+  void end(bool complete);
+  bool running() const;
+
+private:
+  typedef struct stage
+  {
+    uint32_t inputs;
+    bool     done;
+    stage_t  fn;
+  } stage_s;
+
+  enum
+  {
+    PIPELINE_RUN,
+    PIPELINE_FINISH,
+    PIPELINE_ABORT
+  };
+
+  stage_s  _stages[PARSE_PIPELINE_MAX_STAGES];
+  size_t   _stage_count = 0;
+  SpscQueue<uint32_t, 16> _events;
+  std::atomic<int> _stop{PIPELINE_RUN};
+  bool     _running = false;
+  bool     _inline = false; // begin() could not start the worker
+#ifdef ARDUINO
+  void    *_done = nullptr; // SemaphoreHandle_t
+#else
+  std::thread _worker;
+#endif
+
+  static void work(void *arg);
+  void runStages(uint32_t ready);
+}; // end class ParsePipeline
+
+#endif
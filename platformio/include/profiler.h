@@ -0,0 +1,98 @@
+/* Render profiler for esp32-weather-epd.
+ * Copyright (C) 2022-2026  Luke Marzen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef __PROFILER_H__
+#define __PROFILER_H__
+
+#include <cstddef>
+#include <cstdint>
+#include "config.h"
+
+/*
+ * Time spent in each widget and each page of a frame. PROFILE_SCOPE(section)
+ * times the rest of the enclosing block with the CPU cycle counter (device) or
+ * std::chrono::steady_clock (host builds) and adds it to the section. When
+ * RENDER_PROFILER is not defined the macros expand to nothing.
+ */
+typedef enum profile_section
+{
+  PROF_PAGE,
+  PROF_CURRENT_CONDITIONS,
+  PROF_FORECAST,
+  PROF_LOCATION_DATE,
+  PROF_OUTLOOK_GRAPH,
+  PROF_ALERTS,
+  PROF_STATUS_BAR,
+  PROF_STATIC_LAYER,
+  PROF_ERROR,
+  PROF_SECTION_COUNT
+} profile_section_t;
+
+#ifdef RENDER_PROFILER
+
+#ifdef ARDUINO
+#include <esp_idf_version.h>
+#if ESP_IDF_VERSION_MAJOR >= 5
+#include <esp_cpu.h>
+#define PROFILE_TICKS() esp_cpu_get_cycle_count()
+#else
+#include <soc/cpu.h>
+#define PROFILE_TICKS() esp_cpu_get_ccount()
+#endif
+#else
+#include <chrono>
+#define PROFILE_TICKS() static_cast<uint32_t>(                    \
+  std::chrono::duration_cast<std::chrono::nanoseconds>(          \
+    std::chrono::steady_clock::now().time_since_epoch()).count())
+#endif
+
+void profileAdd(profile_section_t section, uint32_t ticks);
+void profileReset();
+size_t profileFormat(char *buf, size_t len);
+void profilePrint();
+
+class ProfileScope
+{
+public:
+  explicit ProfileScope(profile_section_t section)
+    : _section(section), _start(PROFILE_TICKS()) {}
+  ~ProfileScope()
+  {
+    profileAdd(_section, PROFILE_TICKS() - _start);
+  }
+
+private:
+  const profile_section_t _section;
+  const uint32_t _start;
+}; // end class ProfileScope
+
+#define PROFILE_CONCAT_(a, b) a##b
+#define PROFILE_CONCAT(a, b)  PROFILE_CONCAT_(a, b)
+#define PROFILE_SCOPE(section) \
+  ProfileScope PROFILE_CONCAT(profile_scope_, __LINE__)(section)
+#define PROFILE_RESET() profileReset()
+#define PROFILE_PRINT() profilePrint()
+
+#else
+
+#define PROFILE_SCOPE(section)
+#define PROFILE_RESET()
+#define PROFILE_PRINT()
+
+#endif // RENDER_PROFILER
+
+#endif
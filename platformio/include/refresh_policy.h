@@ -0,0 +1,47 @@
+/* Refresh waveform policy for esp32-weather-epd.
+ * Copyright (C) 2022-2026  Luke Marzen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef __REFRESH_POLICY_H__
+#define __REFRESH_POLICY_H__
+
+#include <time.h>
+#include "api_response.h"
+
+/*
+ * Chooses the waveform of each full refresh of the weather screen. Routine
+ * updates use the panel's fast waveform, which leaves some ghosting that
+ * builds up over successive updates. A clean (standard waveform) refresh is
+ * forced after FAST_REFRESH_CLEAN_INTERVAL fast ones, once a day from
+ * FAST_REFRESH_CLEAN_HOUR, when the indoor temperature is below
+ * FAST_REFRESH_MIN_TEMP, and when the layout changed a lot since the previous
+ * screen (weather icons, alerts or date, see FAST_REFRESH_MAX_CHANGES).
+ *
+ * The state is kept in RTC memory, which survives deep sleep. After a power on
+ * or reset it is lost, as is the panel content, and the first refresh is clean.
+ */
+typedef enum refresh_mode
+{
+  REFRESH_CLEAN,
+  REFRESH_FAST
+} refresh_mode_t;
+
+refresh_mode_t selectRefreshMode(const owm_resp_onecall_t &onecall,
+                                 const tm *timeInfo, float inTemp);
+void refreshCompleted(refresh_mode_t mode);
+void refreshInvalidate();
+
+#endif
@@ -23,34 +23,63 @@
 #include <time.h>
 #include "api_response.h"
 #include "config.h"
+#include "logger.h"
+
+#ifdef DISPLAY_FULL_FRAME_PSRAM
+  // the display is chosen at boot, drawn through the virtual GxEPD2_GFX base
+  #define ENABLE_GxEPD2_GFX 1
+#endif
 
 #ifdef DISP_BW_V2
   #define DISP_WIDTH  800
   #define DISP_HEIGHT 480
   #include <GxEPD2_BW.h>
-  extern GxEPD2_BW<GxEPD2_750_GDEY075T7,
-                   GxEPD2_750_GDEY075T7::HEIGHT> display;
+  typedef GxEPD2_750_GDEY075T7 epd_driver_t;
+  template <uint16_t page_height>
+  using epd_display_t = GxEPD2_BW<epd_driver_t, page_height>;
+  #define EPD_PAGE_HEIGHT GxEPD2_750_GDEY075T7::HEIGHT
 #endif
 #ifdef DISP_3C_B
   #define DISP_WIDTH  800
   #define DISP_HEIGHT 480
   #include <GxEPD2_3C.h>
-  extern GxEPD2_3C<GxEPD2_750c_GDEY075Z08,
-                   GxEPD2_750c_GDEY075Z08::HEIGHT / 2> display;
+  typedef GxEPD2_750c_GDEY075Z08 epd_driver_t;
+  template <uint16_t page_height>
+  using epd_display_t = GxEPD2_3C<epd_driver_t, page_height>;
+  #define EPD_PAGE_HEIGHT (GxEPD2_750c_GDEY075Z08::HEIGHT / 2)
 #endif
 #ifdef DISP_7C_F
   #define DISP_WIDTH  800
   #define DISP_HEIGHT 480
   #include <GxEPD2_7C.h>
-  extern GxEPD2_7C<GxEPD2_730c_GDEY073D46, 
-                   GxEPD2_730c_GDEY073D46::HEIGHT / 4> display;
+  typedef GxEPD2_730c_GDEY073D46 epd_driver_t;
+  template <uint16_t page_height>
+  using epd_display_t = GxEPD2_7C<epd_driver_t, page_height>;
+  #define EPD_PAGE_HEIGHT (GxEPD2_730c_GDEY073D46::HEIGHT / 4)
 #endif
 #ifdef DISP_BW_V1
   #define DISP_WIDTH  640
   #define DISP_HEIGHT 384
   #include <GxEPD2_BW.h>
-  extern GxEPD2_BW<GxEPD2_750,
-                   GxEPD2_750::HEIGHT> display;
+  typedef GxEPD2_750 epd_driver_t;
+  template <uint16_t page_height>
+  using epd_display_t = GxEPD2_BW<epd_driver_t, page_height>;
+  #define EPD_PAGE_HEIGHT GxEPD2_750::HEIGHT
+#endif
+
+#if defined(DISPLAY_RLE_FRAME)
+  // single pass into a run-length encoded frame buffer
+  #include "rle_frame.h"
+  extern RleDisplay<epd_driver_t> display;
+#elif defined(DISPLAY_FULL_FRAME_PSRAM)
+  // full frame buffer in PSRAM when available, else EPD_PAGE_HEIGHT pages
+  extern GxEPD2_GFX &display;
+#elif defined(DISPLAY_PAGE_PIPELINE)
+  // double-buffered pages sent by a transfer task while the next is drawn
+  #include "page_pipeline.h"
+  extern PipelinedDisplay<epd_driver_t> display;
+#else
+  extern epd_display_t<EPD_PAGE_HEIGHT> display;
 #endif
 
 typedef enum alignment
@@ -64,13 +93,25 @@ uint16_t getStringWidth(const String &text);
 uint16_t getStringHeight(const String &text);
 void drawString(int16_t x, int16_t y, const String &text, alignment_t alignment,
                 uint16_t color=GxEPD_BLACK);
+void drawString(int16_t x, int16_t y, const char *text, uint16_t width,
+                alignment_t alignment, uint16_t color=GxEPD_BLACK);
 void drawMultiLnString(int16_t x, int16_t y, const String &text,
                        alignment_t alignment, uint16_t max_width,
                        uint16_t max_lines, int16_t line_spacing,
                        uint16_t color=GxEPD_BLACK);
+#ifdef MOONPHASE_PROCEDURAL
+void drawMoonPhase(int16_t x, int16_t y, int16_t size, float moon_phase,
+                   uint16_t color=GxEPD_BLACK);
+#endif
 // parameter indicates if refresh is partial or complete
 void initDisplay(int); // WEB_SVR
 void powerOffDisplay();
+#ifdef FAST_REFRESH
+bool setFastRefresh(bool fast);
+#endif
+#if LOG_LEVEL >= LOG_LEVEL_DEBUG
+void logRenderStats(unsigned long draw_ms, unsigned long total_ms);
+#endif
 void drawCurrentConditions(const owm_current_t &current,
                            const owm_daily_t &today,
                            const owm_resp_air_pollution_t &owm_air_pollution,
@@ -81,6 +122,9 @@ void drawAlerts(std::vector<owm_alerts_t> &alerts,
 void drawLocationDate(const String &city, const String &date);
 void drawOutlookGraph(const owm_hourly_t *hourly,
                       const owm_daily_t *daily, int tz_off); // AUTO_TZ
+#ifdef STATIC_LAYER
+bool drawStaticLayer();
+#endif
 void drawStatusBar(const String &statusStr, const String &refreshTimeStr,
                    int rssi, uint32_t batVoltage);
 void drawError(const uint8_t *bitmap_196x196,
@@ -0,0 +1,361 @@
+/* Run-length encoded frame buffer for esp32-weather-epd.
+ * Copyright (C) 2022-2026  Luke Marzen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef __RLE_FRAME_H__
+#define __RLE_FRAME_H__
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <Adafruit_GFX.h>
+#include "config.h"
+
+/*
+ * A frame buffer that keeps every row as runs of one color, so that a whole
+ * frame of a mostly white screen fits in internal RAM and can be rendered in a
+ * single pass on any panel.
+ *
+ * Row encoding: uint16_t count, then count runs of (length << 4 | color),
+ * covering the width of the frame. Colors are the 7-color panel codes
+ * (rle_color_t), the other panels use a subset.
+ *
+ * Drawing decodes the rows it touches into a small LRU cache of one byte per
+ * pixel lines (RLE_FRAME_ROW_CACHE of them), which are encoded back when
+ * evicted or when the frame is read. Rows are copy-on-write: a frame started
+ * with beginFrame(true) shares its rows with the previous frame until they are
+ * drawn on, and comparing row pointers then encodings gives the area that
+ * changed between the two frames.
+ */
+// GxEPD2 color values (GxEPD2.h)
+#define RLE_GXEPD_BLACK     0x0000
+#define RLE_GXEPD_DARKGREY  0x7BEF
+#define RLE_GXEPD_LIGHTGREY 0xC618
+#define RLE_GXEPD_WHITE     0xFFFF
+#define RLE_GXEPD_RED       0xF800
+#define RLE_GXEPD_YELLOW    0xFFE0
+#define RLE_GXEPD_GREEN     0x07E0
+#define RLE_GXEPD_BLUE      0x001F
+#define RLE_GXEPD_ORANGE    0xFC00
+
+typedef enum rle_color : uint8_t
+{
+  RLE_BLACK  = 0,
+  RLE_WHITE  = 1,
+  RLE_GREEN  = 2,
+  RLE_BLUE   = 3,
+  RLE_RED    = 4,
+  RLE_YELLOW = 5,
+  RLE_ORANGE = 6,
+} rle_color_t;
+
+class RleFrame : public Adafruit_GFX
+{
+public:
+  RleFrame(int16_t w, int16_t h);
+  ~RleFrame();
+
+  void drawPixel(int16_t x, int16_t y, uint16_t color) override;
+  void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override;
+  void writeFastHLine(int16_t x, int16_t y, int16_t w,
+                      uint16_t color) override;
+  void fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                uint16_t color) override;
+  void fillScreen(uint16_t color) override;
+  // As GxEPD2: pixels whose bit is clear are drawn with color
+  void drawInvertedBitmap(int16_t x, int16_t y, const uint8_t bitmap[],
+                          int16_t w, int16_t h, uint16_t color);
+
+  // Starts a new frame, the current one becomes the previous frame. The new
+  // frame is blank, or shares the rows of the previous one when keep is true.
+  void beginFrame(bool keep);
+  // Bounding box of the pixels that differ from the previous frame, returns
+  // false if the frames are identical.
+  bool getChangedArea(int16_t &x, int16_t &y, int16_t &w, int16_t &h);
+  // Decodes n rows from y into one byte per pixel color codes.
+  void readRows(int16_t y, int16_t n, uint8_t *dst);
+  // Bytes used by the encoded rows of the current frame
+  size_t frameBytes() const;
+  // Drops the current frame, the previous one becomes current again (the
+  // previous frame is then the same as the current one)
+  void dropFrame();
+  // Encoded row y of the current frame, valid until the frame is drawn on
+  const uint16_t *encodedRow(int16_t y);
+  // Size of the frame, whatever the rotation
+  int16_t frameWidth() const
+  {
+    return WIDTH;
+  }
+  int16_t frameHeight() const
+  {
+    return HEIGHT;
+  }
+
+  // Maps a GxEPD2 color to the code stored in the runs
+  static rle_color_t colorCode(uint16_t color)
+  {
+    switch (color)
+    {
+    case RLE_GXEPD_WHITE:
+    case RLE_GXEPD_LIGHTGREY: return RLE_WHITE;
+    case RLE_GXEPD_RED:       return RLE_RED;
+    case RLE_GXEPD_YELLOW:    return RLE_YELLOW;
+    case RLE_GXEPD_GREEN:     return RLE_GREEN;
+    case RLE_GXEPD_BLUE:      return RLE_BLUE;
+    case RLE_GXEPD_ORANGE:    return RLE_ORANGE;
+    default:                  return RLE_BLACK;
+    }
+  }
+
+private:
+  typedef struct row_cache
+  {
+    int16_t  y;      // -1 if unused
+    bool     dirty;  // modified since decoded
+    uint32_t last_used;
+    uint8_t *px;
+  } row_cache_t;
+
+  uint16_t **_rows;
+  uint16_t **_prev_rows;  // nullptr before the second frame
+  uint16_t   _blank[2];   // white row shared by all blank rows
+  row_cache_t _cache[RLE_FRAME_ROW_CACHE];
+  uint32_t _clock;
+
+  uint8_t *lockRow(int16_t y);
+  void flushRow(row_cache_t &line);
+  void flushAll();
+  void decodeRow(const uint16_t *row, uint8_t *dst) const;
+  void setRow(int16_t y, uint16_t *row);
+  void freeRow(uint16_t *row) const;
+  bool ownsRow(int16_t y) const;
+  void hline(int16_t x, int16_t y, int16_t w, rle_color_t c);
+}; // end class RleFrame
+
+#ifdef ARDUINO
+#include <GxEPD2_EPD.h>
+
+/*
+ * Display backed by an RleFrame, with the subset of the GxEPD2 paged API used
+ * by the renderer. Every frame is drawn in one pass (pages() == 1) and sent to
+ * the controller in strips of RLE_FRAME_STRIP_ROWS rows, decoded to the
+ * panel's native buffer format.
+ *
+ * A full window refresh is skipped when the frame is identical to the previous
+ * one. In partial window mode the frame keeps the previous content outside the
+ * window (rows are shared copy-on-write) and only the area that changed is
+ * written and refreshed.
+ */
+template <typename Driver>
+class RleDisplay : public RleFrame
+{
+public:
+  Driver epd2;
+
+  RleDisplay(Driver driver)
+    : RleFrame(Driver::WIDTH, Driver::HEIGHT), epd2(driver) {}
+
+  void init(uint32_t serial_diag_bitrate, bool initial,
+            uint16_t reset_duration, bool pulldown_rst_mode)
+  {
+    epd2.init(serial_diag_bitrate, initial, reset_duration, pulldown_rst_mode);
+    _initial = initial;
+  }
+  void setFullWindow()
+  {
+    _partial = false;
+  }
+  void setPartialWindow(int16_t x, int16_t y, int16_t w, int16_t h)
+  {
+    _partial = true;
+    _wx = x;
+    _wy = y;
+    _ww = w;
+    _wh = h;
+  }
+  void firstPage()
+  {
+    // a preview is drawn in a single frame, the previous one stays the frame
+    // shown on the panel
+    if (!_preview || !_previewDrawn)
+    {
+      beginFrame(_partial);
+      _previewDrawn = _preview;
+    }
+    else if (!_partial)
+    {
+      fillScreen(0xFFFF);
+    }
+    if (_partial)
+    {
+      fillRect(_wx, _wy, _ww, _wh, 0xFFFF);
+    }
+  }
+  uint16_t pages()
+  {
+    return 1;
+  }
+  void hibernate()
+  {
+    epd2.hibernate();
+  }
+
+  /*
+   * Frames drawn between beginPreview() and endPreview() are kept in RAM only,
+   * without writing or refreshing the panel. endPreview() drops the preview
+   * and makes the frame shown on the panel current again.
+   */
+  void beginPreview()
+  {
+    _preview = true;
+    _previewDrawn = false;
+  }
+  void endPreview()
+  {
+    if (_previewDrawn)
+    {
+      dropFrame();
+    }
+    _preview = false;
+    _previewDrawn = false;
+  }
+  bool previewing() const
+  {
+    return _preview;
+  }
+
+  /*
+   * Writes the frame (or the changed area) and refreshes the panel, always
+   * returns false: a single pass is enough. Both controller buffers are
+   * written as GxEPD2_BW::nextPage() does, so that the next partial refresh
+   * compares against the frame shown.
+   */
+  bool nextPage()
+  {
+    if (_preview)
+    {
+      return false;
+    }
+    int16_t x, y, w, h;
+    bool changed = getChangedArea(x, y, w, h);
+    if (!_partial || _initial || !epd2.hasPartialUpdate)
+    {
+      if (changed || _initial)
+      {
+        writeRows(0, Driver::HEIGHT, WRITE_FULL);
+        epd2.refresh(false);
+        if (epd2.hasFastPartialUpdate)
+        {
+          writeRows(0, Driver::HEIGHT, WRITE_AGAIN);
+        }
+      }
+    }
+    else if (changed)
+    {
+      writeRows(y, h, WRITE_CURRENT);
+      epd2.refresh(x, y, w, h);
+      if (epd2.hasFastPartialUpdate)
+      {
+        writeRows(y, h, WRITE_AGAIN);
+      }
+    }
+    _initial = false;
+    return false;
+  }
+
+private:
+  bool    _partial = false;
+  bool    _initial = true;
+  bool    _preview = false;
+  bool    _previewDrawn = false;
+  int16_t _wx = 0, _wy = 0, _ww = 0, _wh = 0;
+
+  // Controller buffers written by writeRows(): the current one
+  // (writeImage), both before a full refresh (writeImageForFullRefresh), or
+  // again after a refresh (writeImageAgain). The 3-color and 7-color drivers
+  // have no fast partial update and only take writeImage/writeNative.
+  typedef enum write_mode
+  {
+    WRITE_CURRENT,
+    WRITE_FULL,
+    WRITE_AGAIN,
+  } write_mode_t;
+
+  /*
+   * Streams rows [y, y + n) to the controller RAM in strips.
+   */
+  void writeRows(int16_t y, int16_t n, write_mode_t mode)
+  {
+    const int16_t W = Driver::WIDTH;
+    static uint8_t px[RLE_FRAME_STRIP_ROWS * Driver::WIDTH];
+#if defined(DISP_7C_F)
+    static uint8_t native[RLE_FRAME_STRIP_ROWS * Driver::WIDTH / 2];
+#elif defined(DISP_3C_B)
+    static uint8_t black[RLE_FRAME_STRIP_ROWS * Driver::WIDTH / 8];
+    static uint8_t color[RLE_FRAME_STRIP_ROWS * Driver::WIDTH / 8];
+#else
+    static uint8_t black[RLE_FRAME_STRIP_ROWS * Driver::WIDTH / 8];
+#endif
+    for (int16_t ys = y; ys < y + n; ys += RLE_FRAME_STRIP_ROWS)
+    {
+      const int16_t rows = std::min<int16_t>(RLE_FRAME_STRIP_ROWS, y + n - ys);
+      readRows(ys, rows, px);
+      for (int32_t i = 0; i < rows * W; i += 2)
+      {
+#if defined(DISP_7C_F)
+        native[i / 2] = (px[i] << 4) | px[i + 1];
+#else
+        // bits are set for white, on the 3-color panel red, yellow and
+        // orange are drawn by the color plane and are white in the black one
+        const uint8_t bit0 = 0x80 >> (i & 7), bit1 = bit0 >> 1;
+        uint8_t &b = black[i / 8];
+#if defined(DISP_3C_B)
+        const bool c0 = px[i] >= RLE_RED, c1 = px[i + 1] >= RLE_RED;
+        uint8_t &c = color[i / 8];
+        c = (c & ~(bit0 | bit1)) | (c0 ? 0 : bit0) | (c1 ? 0 : bit1);
+#else
+        const bool c0 = false, c1 = false;
+#endif
+        b = (b & ~(bit0 | bit1))
+          | ((px[i]     == RLE_WHITE || c0) ? bit0 : 0)
+          | ((px[i + 1] == RLE_WHITE || c1) ? bit1 : 0);
+#endif
+      }
+#if defined(DISP_7C_F)
+      epd2.writeNative(native, nullptr, 0, ys, W, rows, false, false, false);
+#elif defined(DISP_3C_B)
+      epd2.writeImage(black, color, 0, ys, W, rows, false, false, false);
+#else
+      if (mode == WRITE_FULL)
+      {
+        epd2.writeImageForFullRefresh(black, 0, ys, W, rows,
+                                      false, false, false);
+      }
+      else if (mode == WRITE_AGAIN)
+      {
+        epd2.writeImageAgain(black, 0, ys, W, rows, false, false, false);
+      }
+      else
+      {
+        epd2.writeImage(black, 0, ys, W, rows, false, false, false);
+      }
+#endif
+    }
+  }
+}; // end class RleDisplay
+#endif // ARDUINO
+
+#endif
@@ -0,0 +1,89 @@
+/* Cached static layer for esp32-weather-epd.
+ * Copyright (C) 2022-2026  Luke Marzen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef __STATIC_LAYER_H__
+#define __STATIC_LAYER_H__
+
+#include <cstddef>
+#include <cstdint>
+#include <Adafruit_GFX.h>
+#include "config.h"
+
+/*
+ * A static layer holds the parts of a screen that do not depend on the data
+ * (icons of the current conditions slots, labels, graph axes...) as a 1-bit
+ * image, set bits are ink. It is rendered once, stored in flash with its rows
+ * PackBits compressed, and drawn at the start of every frame instead of being
+ * rendered again.
+ *
+ * Stored layout: static_layer_header_t, then the packed rows in order. The
+ * header is written last, so a layer is only valid once completely written.
+ */
+#define STATIC_LAYER_MAGIC 0x5259414C // "LAYR"
+
+typedef struct static_layer_header
+{
+  uint32_t magic;
+  uint32_t key;     // layout the layer was rendered for
+  uint16_t width;
+  uint16_t height;
+  uint32_t size;    // bytes of packed rows after the header
+} static_layer_header_t;
+
+/*
+ * 1-bit canvas covering a band of rows of a layer, rotation is not supported.
+ * Pixels drawn with any color but white are set, white clears them.
+ */
+class LayerCanvas : public Adafruit_GFX
+{
+public:
+  LayerCanvas(int16_t w, int16_t h, int16_t band_rows);
+  ~LayerCanvas();
+
+  void drawPixel(int16_t x, int16_t y, uint16_t color) override;
+  // As GxEPD2: pixels whose bit is clear are drawn with color
+  void drawInvertedBitmap(int16_t x, int16_t y, const uint8_t bitmap[],
+                          int16_t w, int16_t h, uint16_t color);
+
+  // False if the band could not be allocated
+  bool valid() const;
+  // Clears the band and moves it to rows [y, y + band_rows)
+  void setBand(int16_t y);
+  int16_t bandRows() const;
+  // Packed bits of row y of the band
+  const uint8_t *row(int16_t y) const;
+
+private:
+  uint8_t *_buf;
+  int16_t  _band_y;
+  int16_t  _band_rows;
+}; // end class LayerCanvas
+
+typedef void (*layer_draw_t)(LayerCanvas &canvas);
+
+// Hash of a description of the layout, used as the key of the layer
+uint32_t staticLayerHash(const void *data, size_t len,
+                         uint32_t seed = 2166136261u);
+// Loads the stored layer into RAM if it was rendered for key
+bool staticLayerLoad(uint32_t key);
+// Renders a w x h layer with draw (called once per band of
+// STATIC_LAYER_BAND_ROWS rows), stores it for key and loads it
+bool staticLayerBuild(uint32_t key, int16_t w, int16_t h, layer_draw_t draw);
+// Draws the set pixels of the loaded layer with color
+void staticLayerBlit(Adafruit_GFX &gfx, uint16_t color);
+
+#endif
@@ -0,0 +1,148 @@
+/* Compile-time text metrics for esp32-weather-epd.
+ * Copyright (C) 2022-2026  Luke Marzen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef __TEXT_METRICS_H__
+#define __TEXT_METRICS_H__
+
+#include <cstdint>
+#include <gfxfont.h>
+#include "config.h"
+
+/*
+ * The font headers declare their glyph tables and GFXfont descriptors as
+ * constexpr, so the functions below can be evaluated by the compiler when both
+ * the font and the string are constants (locale labels, unit symbols...).
+ *
+ * Results match Adafruit_GFX::getTextBounds() for a text size of 1 and text
+ * wrap disabled (the settings applied by initDisplay()). The width does not
+ * depend on the cursor position, hence it can be used for any alignment.
+ */
+
+/*
+ * getTextWidth
+ *
+ * Returns the width in pixels of the bounding box of the string
+ */
+constexpr uint16_t getTextWidth(const GFXfont &font, const char *text)
+{
+  int16_t x = 0;
+  int16_t minx = 0x7FFF;
+  int16_t maxx = -1;
+
+  for (; *text; ++text)
+  {
+    uint8_t c = static_cast<uint8_t>(*text);
+    if (c == '\n')
+    {
+      x = 0;
+    }
+    else if (c != '\r' && c >= font.first && c <= font.last)
+    {
+      const GFXglyph &g = font.glyph[c - font.first];
+      int16_t x1 = x + g.xOffset;
+      int16_t x2 = x1 + g.width - 1;
+      if (x1 < minx)
+        minx = x1;
+      if (x2 > maxx)
+        maxx = x2;
+      x += g.xAdvance;
+    }
+  }
+
+  return (maxx >= minx) ? static_cast<uint16_t>(maxx - minx + 1) : 0;
+} // end getTextWidth
+
+/*
+ * getTextHeight
+ *
+ * Returns the height in pixels of the bounding box of the string
+ */
+constexpr uint16_t getTextHeight(const GFXfont &font, const char *text)
+{
+  int16_t y = 0;
+  int16_t miny = 0x7FFF;
+  int16_t maxy = -1;
+
+  for (; *text; ++text)
+  {
+    uint8_t c = static_cast<uint8_t>(*text);
+    if (c == '\n')
+    {
+      y += font.yAdvance;
+    }
+    else if (c != '\r' && c >= font.first && c <= font.last)
+    {
+      const GFXglyph &g = font.glyph[c - font.first];
+      int16_t y1 = y + g.yOffset;
+      int16_t y2 = y1 + g.height - 1;
+      if (y1 < miny)
+        miny = y1;
+      if (y2 > maxy)
+        maxy = y2;
+    }
+  }
+
+  return (maxy >= miny) ? static_cast<uint16_t>(maxy - miny + 1) : 0;
+} // end getTextHeight
+
+/*
+ * getTextAdvance
+ *
+ * Returns how far the cursor moves when the string is printed
+ */
+constexpr int16_t getTextAdvance(const GFXfont &font, const char *text)
+{
+  int16_t x = 0;
+
+  for (; *text; ++text)
+  {
+    uint8_t c = static_cast<uint8_t>(*text);
+    if (c == '\n')
+    {
+      x = 0;
+    }
+    else if (c != '\r' && c >= font.first && c <= font.last)
+    {
+      x += font.glyph[c - font.first].xAdvance;
+    }
+  }
+
+  return x;
+} // end getTextAdvance
+
+/*
+ * Forces evaluation at compile time, e.g.
+ *   drawString(x, y, "|", TEXT_WIDTH(FONT_10pt8b, "|"), CENTER);
+ */
+template <uint16_t N>
+struct text_metric_t
+{
+  static constexpr uint16_t value = N;
+};
+#ifdef USE_ASSET_PARTITION
+// fonts are loaded from the asset archive at runtime
+#define TEXT_WIDTH(font, text)  getTextWidth(font, text)
+#define TEXT_HEIGHT(font, text) getTextHeight(font, text)
+#define TEXT_ADVANCE(font, text) getTextAdvance(font, text)
+#else
+#define TEXT_WIDTH(font, text)  (text_metric_t<getTextWidth(font, text)>::value)
+#define TEXT_HEIGHT(font, text) (text_metric_t<getTextHeight(font, text)>::value)
+#define TEXT_ADVANCE(font, text) \
+  (text_metric_t<getTextAdvance(font, text)>::value)
+#endif
+
+#endif
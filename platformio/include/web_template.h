@@ -0,0 +1,78 @@
+/* Streaming HTML templates for esp32-weather-epd.
+ * Copyright (C) 2022-2026  Luke Marzen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef __WEB_TEMPLATE_H__
+#define __WEB_TEMPLATE_H__
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include "config.h"
+
+/*
+ * A page is an array of sections, terminated by {nullptr, 0}. The text of a
+ * section is a constant string (in flash) sent rows times, with %name%
+ * placeholders replaced by the value of name for that row; %% is a literal %.
+ */
+typedef struct web_tpl_section
+{
+  const char *text;
+  uint8_t     rows;
+} web_tpl_section_t;
+
+#define WEB_TPL_SCRATCH 24
+
+/*
+ * Returns the value of the placeholder name (len chars, not terminated) for
+ * row, or nullptr if unknown. The value may point into existing strings, or
+ * be formatted into scratch (WEB_TPL_SCRATCH bytes). It is only used until
+ * the function returns, and must not change while the page is sent.
+ */
+typedef const char *(*web_tpl_value_t)(const char *name, size_t len,
+                                       uint8_t row, char *scratch);
+
+/*
+ * Renders a page into the buffers given by read(), as many bytes as fit each
+ * time, without allocating. A placeholder that does not fit is continued on
+ * the next call, its value is looked up again then instead of being kept.
+ */
+class WebTemplate
+{
+public:
+  WebTemplate(const web_tpl_section_t *page, web_tpl_value_t value);
+
+  // Fills buf with up to len bytes of the page, returns 0 at the end
+  size_t read(uint8_t *buf, size_t len);
+
+private:
+  const web_tpl_section_t *_section;
+  const char     *_pos;      // next char of the section text
+  uint8_t         _row;
+  const char     *_name;     // placeholder being sent, nullptr if none
+  size_t          _name_len;
+  size_t          _sent;     // bytes of its value already sent
+  web_tpl_value_t _value;
+  char            _scratch[WEB_TPL_SCRATCH];
+}; // end class WebTemplate
+
+// True if the placeholder name (len chars) is key
+inline bool webTplIs(const char *name, size_t len, const char *key)
+{
+  return strncmp(name, key, len) == 0 && key[len] == '\0';
+}
+
+#endif
@@ -0,0 +1,45 @@
+/* Precompressed configuration UI for esp32-weather-epd.
+ * Copyright (C) 2022-2026  Luke Marzen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef __WEB_UI_H__
+#define __WEB_UI_H__
+
+#include <cstddef>
+#include <cstdint>
+#include "config.h"
+
+#ifdef WEB_UI
+
+/*
+ * A file of the UI, gzip-compressed by web/pack_web.py
+ */
+typedef struct web_ui_file
+{
+  const char    *path;
+  const char    *type;
+  const uint8_t *data;
+  size_t         len;
+} web_ui_file_t;
+
+extern const web_ui_file_t web_ui_files[];
+extern const size_t        web_ui_file_count;
+
+// Quoted ETag of the files, changes with their content and the locale
+extern const char * const  web_ui_etag;
+
+#endif // WEB_UI
+#endif
@@ -245,7 +245,7 @@ const uint8_t FreeMono_10pt8bBitmaps[] PROGMEM = {
   0x40, 0x3E, 0x00, 0x33, 0x0C, 0xC0, 0x03, 0x87, 0x40, 0x88, 0x42, 0x10,
   0x48, 0x12, 0x03, 0x00, 0xC0, 0x20, 0x08, 0x04, 0x0F, 0xC0 };
 
-const GFXglyph FreeMono_10pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph FreeMono_10pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,  12,    0,    0 },   // 0x20 ' '
   {     1,   2,  12,  12,    5,  -11 },   // 0x21 '!'
   {     4,   6,   6,  12,    3,  -11 },   // 0x22 '"'
@@ -471,7 +471,7 @@ const GFXglyph FreeMono_10pt8bGlyphs[] PROGMEM = {
   {  2898,  11,  15,  12,    0,  -10 },   // 0xFE ''
   {  2919,  10,  15,  12,    1,  -10 } }; // 0xFF ''
 
-const GFXfont FreeMono_10pt8b PROGMEM = {
+constexpr GFXfont FreeMono_10pt8b PROGMEM = {
   (uint8_t  *)FreeMono_10pt8bBitmaps,
   (GFXglyph *)FreeMono_10pt8bGlyphs,
   0x20, 0xFF, 20 };
@@ -292,7 +292,7 @@ const uint8_t FreeMono_11pt8bBitmaps[] PROGMEM = {
   0x04, 0x11, 0x02, 0x20, 0x28, 0x05, 0x00, 0x40, 0x08, 0x02, 0x00, 0x40,
   0xFC, 0x00 };
 
-const GFXglyph FreeMono_11pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph FreeMono_11pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,  13,    0,    0 },   // 0x20 ' '
   {     1,   3,  14,  13,    5,  -13 },   // 0x21 '!'
   {     7,   7,   6,  13,    3,  -12 },   // 0x22 '"'
@@ -518,7 +518,7 @@ const GFXglyph FreeMono_11pt8bGlyphs[] PROGMEM = {
   {  3446,  12,  16,  13,    0,  -11 },   // 0xFE ''
   {  3470,  11,  17,  13,    1,  -12 } }; // 0xFF ''
 
-const GFXfont FreeMono_11pt8b PROGMEM = {
+constexpr GFXfont FreeMono_11pt8b PROGMEM = {
   (uint8_t  *)FreeMono_11pt8bBitmaps,
   (GFXglyph *)FreeMono_11pt8bGlyphs,
   0x20, 0xFF, 22 };
@@ -343,7 +343,7 @@ const uint8_t FreeMono_12pt8bBitmaps[] PROGMEM = {
   0x04, 0x10, 0x81, 0x88, 0x09, 0x00, 0xD0, 0x06, 0x00, 0x20, 0x04, 0x00,
   0x40, 0x08, 0x0F, 0xE0 };
 
-const GFXglyph FreeMono_12pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph FreeMono_12pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,  14,    0,    0 },   // 0x20 ' '
   {     1,   2,  15,  14,    6,  -14 },   // 0x21 '!'
   {     5,   8,   7,  14,    3,  -13 },   // 0x22 '"'
@@ -569,7 +569,7 @@ const GFXglyph FreeMono_12pt8bGlyphs[] PROGMEM = {
   {  4054,  12,  18,  14,    1,  -13 },   // 0xFE ''
   {  4081,  12,  18,  14,    1,  -13 } }; // 0xFF ''
 
-const GFXfont FreeMono_12pt8b PROGMEM = {
+constexpr GFXfont FreeMono_12pt8b PROGMEM = {
   (uint8_t  *)FreeMono_12pt8bBitmaps,
   (GFXglyph *)FreeMono_12pt8bGlyphs,
   0x20, 0xFF, 24 };
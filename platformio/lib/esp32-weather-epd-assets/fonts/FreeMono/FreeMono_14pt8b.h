@@ -471,7 +471,7 @@ const uint8_t FreeMono_14pt8bBitmaps[] PROGMEM = {
   0x10, 0x40, 0x80, 0x82, 0x02, 0x10, 0x04, 0x40, 0x12, 0x00, 0x28, 0x00,
   0xE0, 0x01, 0x00, 0x0C, 0x00, 0x20, 0x01, 0x80, 0x04, 0x01, 0xFC, 0x00 };
 
-const GFXglyph FreeMono_14pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph FreeMono_14pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,  16,    0,    0 },   // 0x20 ' '
   {     1,   3,  17,  16,    7,  -16 },   // 0x21 '!'
   {     8,   8,   8,  16,    4,  -16 },   // 0x22 '"'
@@ -697,7 +697,7 @@ const GFXglyph FreeMono_14pt8bGlyphs[] PROGMEM = {
   {  5576,  14,  21,  16,    1,  -15 },   // 0xFE ''
   {  5613,  14,  22,  16,    1,  -16 } }; // 0xFF ''
 
-const GFXfont FreeMono_14pt8b PROGMEM = {
+constexpr GFXfont FreeMono_14pt8b PROGMEM = {
   (uint8_t  *)FreeMono_14pt8bBitmaps,
   (GFXglyph *)FreeMono_14pt8bGlyphs,
   0x20, 0xFF, 27 };
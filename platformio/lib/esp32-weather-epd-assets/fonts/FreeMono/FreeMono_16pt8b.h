@@ -614,7 +614,7 @@ const uint8_t FreeMono_16pt8bBitmaps[] PROGMEM = {
   0x10, 0x03, 0x40, 0x02, 0x80, 0x06, 0x00, 0x04, 0x00, 0x10, 0x00, 0x20,
   0x00, 0x80, 0x01, 0x00, 0x7F, 0xC0 };
 
-const GFXglyph FreeMono_16pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph FreeMono_16pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,  19,    0,    0 },   // 0x20 ' '
   {     1,   3,  20,  19,    8,  -19 },   // 0x21 '!'
   {     9,   9,   9,  19,    5,  -18 },   // 0x22 '"'
@@ -840,7 +840,7 @@ const GFXglyph FreeMono_16pt8bGlyphs[] PROGMEM = {
   {  7269,  16,  24,  19,    1,  -17 },   // 0xFE ''
   {  7317,  15,  24,  19,    2,  -17 } }; // 0xFF ''
 
-const GFXfont FreeMono_16pt8b PROGMEM = {
+constexpr GFXfont FreeMono_16pt8b PROGMEM = {
   (uint8_t  *)FreeMono_16pt8bBitmaps,
   (GFXglyph *)FreeMono_16pt8bGlyphs,
   0x20, 0xFF, 31 };
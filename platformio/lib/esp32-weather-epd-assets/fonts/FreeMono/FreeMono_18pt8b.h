@@ -759,7 +759,7 @@ const uint8_t FreeMono_18pt8bBitmaps[] PROGMEM = {
   0x58, 0x00, 0x38, 0x00, 0x0C, 0x00, 0x04, 0x00, 0x06, 0x00, 0x02, 0x00,
   0x03, 0x00, 0x01, 0x00, 0x3F, 0xF0, 0x00 };
 
-const GFXglyph FreeMono_18pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph FreeMono_18pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,  21,    0,    0 },   // 0x20 ' '
   {     1,   5,  22,  21,    8,  -21 },   // 0x21 '!'
   {    15,  11,  10,  21,    5,  -20 },   // 0x22 '"'
@@ -985,7 +985,7 @@ const GFXglyph FreeMono_18pt8bGlyphs[] PROGMEM = {
   {  8986,  18,  26,  21,    1,  -19 },   // 0xFE ''
   {  9045,  17,  27,  21,    2,  -20 } }; // 0xFF ''
 
-const GFXfont FreeMono_18pt8b PROGMEM = {
+constexpr GFXfont FreeMono_18pt8b PROGMEM = {
   (uint8_t  *)FreeMono_18pt8bBitmaps,
   (GFXglyph *)FreeMono_18pt8bGlyphs,
   0x20, 0xFF, 35 };
@@ -923,7 +923,7 @@ const uint8_t FreeMono_20pt8bBitmaps[] PROGMEM = {
   0x60, 0x00, 0x04, 0x00, 0x00, 0xC0, 0x00, 0x08, 0x00, 0x01, 0x80, 0x00,
   0x10, 0x00, 0x7F, 0xE0, 0x0F, 0xFE, 0x00 };
 
-const GFXglyph FreeMono_20pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph FreeMono_20pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,  24,    0,    0 },   // 0x20 ' '
   {     1,   5,  25,  24,    9,  -24 },   // 0x21 '!'
   {    17,  12,  11,  24,    6,  -22 },   // 0x22 '"'
@@ -1149,7 +1149,7 @@ const GFXglyph FreeMono_20pt8bGlyphs[] PROGMEM = {
   { 10923,  20,  29,  24,    1,  -21 },   // 0xFE ''
   { 10996,  20,  30,  24,    2,  -22 } }; // 0xFF ''
 
-const GFXfont FreeMono_20pt8b PROGMEM = {
+constexpr GFXfont FreeMono_20pt8b PROGMEM = {
   (uint8_t  *)FreeMono_20pt8bBitmaps,
   (GFXglyph *)FreeMono_20pt8bGlyphs,
   0x20, 0xFF, 39 };
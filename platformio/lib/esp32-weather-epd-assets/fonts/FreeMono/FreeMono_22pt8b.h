@@ -1157,7 +1157,7 @@ const uint8_t FreeMono_22pt8bBitmaps[] PROGMEM = {
   0x18, 0x00, 0x00, 0xC0, 0x00, 0x03, 0x00, 0x00, 0x18, 0x00, 0x1F, 0xFE,
   0x00, 0x7F, 0xF8, 0x00 };
 
-const GFXglyph FreeMono_22pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph FreeMono_22pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,  26,    0,    0 },   // 0x20 ' '
   {     1,   6,  27,  26,   10,  -25 },   // 0x21 '!'
   {    22,  14,  12,  26,    6,  -25 },   // 0x22 '"'
@@ -1383,7 +1383,7 @@ const GFXglyph FreeMono_22pt8bGlyphs[] PROGMEM = {
   { 13691,  22,  34,  26,    1,  -25 },   // 0xFE ''
   { 13785,  22,  33,  26,    2,  -24 } }; // 0xFF ''
 
-const GFXfont FreeMono_22pt8b PROGMEM = {
+constexpr GFXfont FreeMono_22pt8b PROGMEM = {
   (uint8_t  *)FreeMono_22pt8bBitmaps,
   (GFXglyph *)FreeMono_22pt8bGlyphs,
   0x20, 0xFF, 43 };
@@ -1379,7 +1379,7 @@ const uint8_t FreeMono_24pt8bBitmaps[] PROGMEM = {
   0x30, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0xC0, 0x00, 0x7F,
   0xFC, 0x00, 0x7F, 0xFC, 0x00 };
 
-const GFXglyph FreeMono_24pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph FreeMono_24pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,  28,    0,    0 },   // 0x20 ' '
   {     1,   6,  30,  28,   11,  -28 },   // 0x21 '!'
   {    24,  14,  14,  28,    7,  -28 },   // 0x22 '"'
@@ -1605,7 +1605,7 @@ const GFXglyph FreeMono_24pt8bGlyphs[] PROGMEM = {
   { 16316,  24,  38,  28,    1,  -28 },   // 0xFE ''
   { 16430,  24,  37,  28,    2,  -27 } }; // 0xFF ''
 
-const GFXfont FreeMono_24pt8b PROGMEM = {
+constexpr GFXfont FreeMono_24pt8b PROGMEM = {
   (uint8_t  *)FreeMono_24pt8bBitmaps,
   (GFXglyph *)FreeMono_24pt8bGlyphs,
   0x20, 0xFF, 47 };
@@ -1643,7 +1643,7 @@ const uint8_t FreeMono_26pt8bBitmaps[] PROGMEM = {
   0x00, 0x38, 0x00, 0x00, 0x18, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x0C, 0x00,
   0x07, 0xFF, 0xE0, 0x03, 0xFF, 0xF0, 0x00 };
 
-const GFXglyph FreeMono_26pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph FreeMono_26pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,  31,    0,    0 },   // 0x20 ' '
   {     1,   6,  32,  31,   12,  -30 },   // 0x21 '!'
   {    25,  16,  15,  31,    7,  -30 },   // 0x22 '"'
@@ -1869,7 +1869,7 @@ const GFXglyph FreeMono_26pt8bGlyphs[] PROGMEM = {
   { 19457,  27,  39,  31,    1,  -29 },   // 0xFE ''
   { 19589,  25,  39,  31,    3,  -29 } }; // 0xFF ''
 
-const GFXfont FreeMono_26pt8b PROGMEM = {
+constexpr GFXfont FreeMono_26pt8b PROGMEM = {
   (uint8_t  *)FreeMono_26pt8bBitmaps,
   (GFXglyph *)FreeMono_26pt8bGlyphs,
   0x20, 0xFF, 51 };
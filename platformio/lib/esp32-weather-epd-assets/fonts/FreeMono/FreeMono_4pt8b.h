@@ -52,7 +52,7 @@ const uint8_t FreeMono_4pt8bBitmaps[] PROGMEM = {
   0x20, 0x19, 0x97, 0x51, 0x99, 0x70, 0x00, 0x07, 0x62, 0x40, 0x07, 0x99,
   0x52, 0x50, 0x07, 0x62, 0x40 };
 
-const GFXglyph FreeMono_4pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph FreeMono_4pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   5,    0,    0 },   // 0x20 ' '
   {     1,   1,   5,   5,    2,   -4 },   // 0x21 '!'
   {     2,   3,   2,   5,    1,   -4 },   // 0x22 '"'
@@ -278,7 +278,7 @@ const GFXglyph FreeMono_4pt8bGlyphs[] PROGMEM = {
   {   610,   4,   6,   5,    0,   -4 },   // 0xFE ''
   {   613,   4,   7,   5,    0,   -5 } }; // 0xFF ''
 
-const GFXfont FreeMono_4pt8b PROGMEM = {
+constexpr GFXfont FreeMono_4pt8b PROGMEM = {
   (uint8_t  *)FreeMono_4pt8bBitmaps,
   (GFXglyph *)FreeMono_4pt8bGlyphs,
   0x20, 0xFF, 8 };
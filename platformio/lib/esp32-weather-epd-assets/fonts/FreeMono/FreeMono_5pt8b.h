@@ -70,7 +70,7 @@ const uint8_t FreeMono_5pt8bBitmaps[] PROGMEM = {
   0x10, 0x00, 0x95, 0x18, 0x84, 0x00, 0x05, 0x93, 0x14, 0xDA, 0x08, 0x48,
   0x00, 0x95, 0x18, 0x84, 0x00 };
 
-const GFXglyph FreeMono_5pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph FreeMono_5pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   6,    0,    0 },   // 0x20 ' '
   {     1,   2,   6,   6,    2,   -5 },   // 0x21 '!'
   {     3,   3,   3,   6,    1,   -5 },   // 0x22 '"'
@@ -296,7 +296,7 @@ const GFXglyph FreeMono_5pt8bGlyphs[] PROGMEM = {
   {   822,   5,   8,   6,    0,   -5 },   // 0xFE ''
   {   827,   5,   9,   6,    0,   -6 } }; // 0xFF ''
 
-const GFXfont FreeMono_5pt8b PROGMEM = {
+constexpr GFXfont FreeMono_5pt8b PROGMEM = {
   (uint8_t  *)FreeMono_5pt8bBitmaps,
   (GFXglyph *)FreeMono_5pt8bGlyphs,
   0x20, 0xFF, 10 };
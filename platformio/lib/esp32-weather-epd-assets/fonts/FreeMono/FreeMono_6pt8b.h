@@ -100,7 +100,7 @@ const uint8_t FreeMono_6pt8bBitmaps[] PROGMEM = {
   0x42, 0x00, 0x41, 0x07, 0x91, 0x45, 0x16, 0x94, 0x40, 0x50, 0x23, 0x25,
   0x30, 0x88, 0x40 };
 
-const GFXglyph FreeMono_6pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph FreeMono_6pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   7,    0,    0 },   // 0x20 ' '
   {     1,   1,   7,   7,    3,   -6 },   // 0x21 '!'
   {     2,   3,   3,   7,    2,   -6 },   // 0x22 '"'
@@ -326,7 +326,7 @@ const GFXglyph FreeMono_6pt8bGlyphs[] PROGMEM = {
   {  1178,   6,   9,   7,    0,   -6 },   // 0xFE ''
   {  1185,   5,   9,   7,    1,   -6 } }; // 0xFF ''
 
-const GFXfont FreeMono_6pt8b PROGMEM = {
+constexpr GFXfont FreeMono_6pt8b PROGMEM = {
   (uint8_t  *)FreeMono_6pt8bBitmaps,
   (GFXglyph *)FreeMono_6pt8bGlyphs,
   0x20, 0xFF, 12 };
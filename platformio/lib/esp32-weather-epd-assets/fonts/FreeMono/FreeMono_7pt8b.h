@@ -122,7 +122,7 @@ const uint8_t FreeMono_7pt8bBitmaps[] PROGMEM = {
   0x80, 0xC0, 0x81, 0x73, 0x14, 0x28, 0x50, 0xBE, 0x40, 0x83, 0xC0, 0x48,
   0x03, 0x34, 0x24, 0x89, 0x0C, 0x08, 0x20, 0x43, 0xC0 };
 
-const GFXglyph FreeMono_7pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph FreeMono_7pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   8,    0,    0 },   // 0x20 ' '
   {     1,   2,   9,   8,    3,   -8 },   // 0x21 '!'
   {     4,   4,   4,   8,    2,   -7 },   // 0x22 '"'
@@ -348,7 +348,7 @@ const GFXglyph FreeMono_7pt8bGlyphs[] PROGMEM = {
   {  1441,   7,  11,   8,    0,   -7 },   // 0xFE ''
   {  1451,   7,  11,   8,    1,   -7 } }; // 0xFF ''
 
-const GFXfont FreeMono_7pt8b PROGMEM = {
+constexpr GFXfont FreeMono_7pt8b PROGMEM = {
   (uint8_t  *)FreeMono_7pt8bBitmaps,
   (GFXglyph *)FreeMono_7pt8bGlyphs,
   0x20, 0xFF, 14 };
@@ -163,7 +163,7 @@ const uint8_t FreeMono_8pt8bBitmaps[] PROGMEM = {
   0x40, 0xF0, 0x04, 0x64, 0x00, 0xC7, 0x42, 0x44, 0x24, 0x28, 0x28, 0x10,
   0x10, 0x20, 0xF0 };
 
-const GFXglyph FreeMono_8pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph FreeMono_8pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   9,    0,    0 },   // 0x20 ' '
   {     1,   2,  10,   9,    4,   -9 },   // 0x21 '!'
   {     4,   5,   5,   9,    2,   -9 },   // 0x22 '"'
@@ -389,7 +389,7 @@ const GFXglyph FreeMono_8pt8bGlyphs[] PROGMEM = {
   {  1921,   8,  13,   9,    0,   -9 },   // 0xFE ''
   {  1934,   8,  13,   9,    1,   -9 } }; // 0xFF ''
 
-const GFXfont FreeMono_8pt8b PROGMEM = {
+constexpr GFXfont FreeMono_8pt8b PROGMEM = {
   (uint8_t  *)FreeMono_8pt8bBitmaps,
   (GFXglyph *)FreeMono_8pt8bGlyphs,
   0x20, 0xFF, 16 };
@@ -207,7 +207,7 @@ const uint8_t FreeMono_9pt8bBitmaps[] PROGMEM = {
   0x00, 0x26, 0x11, 0x00, 0x1C, 0x74, 0x12, 0x10, 0x88, 0x48, 0x14, 0x0C,
   0x02, 0x02, 0x01, 0x07, 0xC0 };
 
-const GFXglyph FreeMono_9pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph FreeMono_9pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,  11,    0,    0 },   // 0x20 ' '
   {     1,   2,  11,  11,    4,  -10 },   // 0x21 '!'
   {     4,   5,   5,  11,    3,  -10 },   // 0x22 '"'
@@ -433,7 +433,7 @@ const GFXglyph FreeMono_9pt8bGlyphs[] PROGMEM = {
   {  2443,  10,  14,  11,    0,  -10 },   // 0xFE ''
   {  2461,   9,  14,  11,    1,  -10 } }; // 0xFF ''
 
-const GFXfont FreeMono_9pt8b PROGMEM = {
+constexpr GFXfont FreeMono_9pt8b PROGMEM = {
   (uint8_t  *)FreeMono_9pt8bBitmaps,
   (GFXglyph *)FreeMono_9pt8bGlyphs,
   0x20, 0xFF, 18 };
@@ -347,7 +347,7 @@ const uint8_t FreeSans_10pt8bBitmaps[] PROGMEM = {
   0x23, 0x19, 0x0D, 0x82, 0x81, 0xC0, 0xE0, 0x20, 0x30, 0x18, 0x38, 0x18,
   0x00 };
 
-const GFXglyph FreeSans_10pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph FreeSans_10pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   5,    0,    0 },   // 0x20 ' '
   {     1,   2,  15,   7,    2,  -14 },   // 0x21 '!'
   {     5,   5,   5,   7,    1,  -13 },   // 0x22 '"'
@@ -573,7 +573,7 @@ const GFXglyph FreeSans_10pt8bGlyphs[] PROGMEM = {
   {  4110,   9,  18,  11,    1,  -13 },   // 0xFE ''
   {  4131,   9,  19,   9,    0,  -14 } }; // 0xFF ''
 
-const GFXfont FreeSans_10pt8b PROGMEM = {
+constexpr GFXfont FreeSans_10pt8b PROGMEM = {
   (uint8_t  *)FreeSans_10pt8bBitmaps,
   (GFXglyph *)FreeSans_10pt8bGlyphs,
   0x20, 0xFF, 24 };
@@ -407,7 +407,7 @@ const uint8_t FreeSans_11pt8bBitmaps[] PROGMEM = {
   0xC0, 0xD8, 0x36, 0x19, 0x86, 0x31, 0x8C, 0xC3, 0x30, 0x48, 0x1E, 0x07,
   0x80, 0xC0, 0x30, 0x0C, 0x06, 0x01, 0x81, 0xE0, 0x60, 0x00 };
 
-const GFXglyph FreeSans_11pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph FreeSans_11pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   5,    0,    0 },   // 0x20 ' '
   {     1,   1,  16,   7,    3,  -15 },   // 0x21 '!'
   {     3,   5,   5,   7,    1,  -14 },   // 0x22 '"'
@@ -633,7 +633,7 @@ const GFXglyph FreeSans_11pt8bGlyphs[] PROGMEM = {
   {  4830,  10,  20,  12,    1,  -15 },   // 0xFE ''
   {  4855,  10,  21,  10,    0,  -15 } }; // 0xFF ''
 
-const GFXfont FreeSans_11pt8b PROGMEM = {
+constexpr GFXfont FreeSans_11pt8b PROGMEM = {
   (uint8_t  *)FreeSans_11pt8bBitmaps,
   (GFXglyph *)FreeSans_11pt8bGlyphs,
   0x20, 0xFF, 26 };
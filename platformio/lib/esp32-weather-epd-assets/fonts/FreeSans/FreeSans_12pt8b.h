@@ -483,7 +483,7 @@ const uint8_t FreeSans_12pt8bBitmaps[] PROGMEM = {
   0x86, 0x30, 0xC6, 0x0D, 0x81, 0xB0, 0x36, 0x03, 0x80, 0x70, 0x0E, 0x01,
   0x80, 0x30, 0x0E, 0x07, 0x80, 0xE0, 0x00 };
 
-const GFXglyph FreeSans_12pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph FreeSans_12pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   6,    0,    0 },   // 0x20 ' '
   {     1,   2,  17,   8,    3,  -16 },   // 0x21 '!'
   {     6,   6,   6,   8,    1,  -16 },   // 0x22 '"'
@@ -709,7 +709,7 @@ const GFXglyph FreeSans_12pt8bGlyphs[] PROGMEM = {
   {  5729,  11,  22,  13,    1,  -16 },   // 0xFE ''
   {  5760,  11,  22,  11,    0,  -16 } }; // 0xFF ''
 
-const GFXfont FreeSans_12pt8b PROGMEM = {
+constexpr GFXfont FreeSans_12pt8b PROGMEM = {
   (uint8_t  *)FreeSans_12pt8bBitmaps,
   (GFXglyph *)FreeSans_12pt8bGlyphs,
   0x20, 0xFF, 28 };
@@ -657,7 +657,7 @@ const uint8_t FreeSans_14pt8bBitmaps[] PROGMEM = {
   0x80, 0x78, 0x01, 0xC0, 0x0E, 0x00, 0x60, 0x03, 0x00, 0x38, 0x03, 0x80,
   0x7C, 0x03, 0xC0, 0x00 };
 
-const GFXglyph FreeSans_14pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph FreeSans_14pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   7,    0,    0 },   // 0x20 ' '
   {     1,   3,  20,   9,    3,  -19 },   // 0x21 '!'
   {     9,   7,   7,   9,    1,  -18 },   // 0x22 '"'
@@ -883,7 +883,7 @@ const GFXglyph FreeSans_14pt8bGlyphs[] PROGMEM = {
   {  7795,  12,  25,  15,    2,  -19 },   // 0xFE ''
   {  7833,  13,  26,  13,    0,  -19 } }; // 0xFF ''
 
-const GFXfont FreeSans_14pt8b PROGMEM = {
+constexpr GFXfont FreeSans_14pt8b PROGMEM = {
   (uint8_t  *)FreeSans_14pt8bBitmaps,
   (GFXglyph *)FreeSans_14pt8bGlyphs,
   0x20, 0xFF, 33 };
@@ -862,7 +862,7 @@ const uint8_t FreeSans_16pt8bBitmaps[] PROGMEM = {
   0x00, 0xE0, 0x01, 0x80, 0x07, 0x00, 0x0E, 0x00, 0x38, 0x03, 0xF0, 0x07,
   0xC0, 0x0F, 0x00, 0x00 };
 
-const GFXglyph FreeSans_16pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph FreeSans_16pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   8,    0,    0 },   // 0x20 ' '
   {     1,   3,  23,  10,    4,  -22 },   // 0x21 '!'
   {    10,   8,   8,  10,    1,  -21 },   // 0x22 '"'
@@ -1088,7 +1088,7 @@ const GFXglyph FreeSans_16pt8bGlyphs[] PROGMEM = {
   { 10226,  15,  28,  17,    2,  -21 },   // 0xFE ''
   { 10279,  15,  30,  15,    0,  -22 } }; // 0xFF ''
 
-const GFXfont FreeSans_16pt8b PROGMEM = {
+constexpr GFXfont FreeSans_16pt8b PROGMEM = {
   (uint8_t  *)FreeSans_16pt8bBitmaps,
   (GFXglyph *)FreeSans_16pt8bGlyphs,
   0x20, 0xFF, 38 };
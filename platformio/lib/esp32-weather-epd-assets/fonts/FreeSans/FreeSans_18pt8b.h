@@ -1087,7 +1087,7 @@ const uint8_t FreeSans_18pt8bBitmaps[] PROGMEM = {
   0x03, 0xE0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0x80, 0x03, 0x80,
   0x07, 0x00, 0x07, 0x00, 0x3F, 0x00, 0x3E, 0x00, 0x38, 0x00 };
 
-const GFXglyph FreeSans_18pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph FreeSans_18pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   9,    0,    0 },   // 0x20 ' '
   {     1,   3,  26,  12,    4,  -25 },   // 0x21 '!'
   {    11,   9,   9,  12,    1,  -24 },   // 0x22 '"'
@@ -1313,7 +1313,7 @@ const GFXglyph FreeSans_18pt8bGlyphs[] PROGMEM = {
   { 12906,  17,  32,  20,    2,  -24 },   // 0xFE ''
   { 12974,  16,  34,  17,    0,  -25 } }; // 0xFF ''
 
-const GFXfont FreeSans_18pt8b PROGMEM = {
+constexpr GFXfont FreeSans_18pt8b PROGMEM = {
   (uint8_t  *)FreeSans_18pt8bBitmaps,
   (GFXglyph *)FreeSans_18pt8bGlyphs,
   0x20, 0xFF, 42 };
@@ -1357,7 +1357,7 @@ const uint8_t FreeSans_20pt8bBitmaps[] PROGMEM = {
   0x0F, 0x00, 0x03, 0x80, 0x01, 0xE0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3E,
   0x00, 0x00 };
 
-const GFXglyph FreeSans_20pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph FreeSans_20pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,  10,    0,    0 },   // 0x20 ' '
   {     1,   3,  29,  13,    5,  -28 },   // 0x21 '!'
   {    12,   9,  10,  13,    2,  -26 },   // 0x22 '"'
@@ -1583,7 +1583,7 @@ const GFXglyph FreeSans_20pt8bGlyphs[] PROGMEM = {
   { 16104,  19,  36,  22,    2,  -27 },   // 0xFE ''
   { 16190,  18,  37,  19,    0,  -28 } }; // 0xFF ''
 
-const GFXfont FreeSans_20pt8b PROGMEM = {
+constexpr GFXfont FreeSans_20pt8b PROGMEM = {
   (uint8_t  *)FreeSans_20pt8bBitmaps,
   (GFXglyph *)FreeSans_20pt8bGlyphs,
   0x20, 0xFF, 47 };
@@ -1635,7 +1635,7 @@ const uint8_t FreeSans_22pt8bBitmaps[] PROGMEM = {
   0x01, 0xE0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x03, 0xF8, 0x00, 0x3F, 0x80,
   0x03, 0xF0, 0x00, 0x18, 0x00, 0x00 };
 
-const GFXglyph FreeSans_22pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph FreeSans_22pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,  11,    0,    0 },   // 0x20 ' '
   {     1,   4,  31,  14,    5,  -30 },   // 0x21 '!'
   {    17,  11,  11,  14,    2,  -30 },   // 0x22 '"'
@@ -1861,7 +1861,7 @@ const GFXglyph FreeSans_22pt8bGlyphs[] PROGMEM = {
   { 19408,  20,  41,  24,    3,  -31 },   // 0xFE ''
   { 19511,  20,  41,  21,    0,  -30 } }; // 0xFF ''
 
-const GFXfont FreeSans_22pt8b PROGMEM = {
+constexpr GFXfont FreeSans_22pt8b PROGMEM = {
   (uint8_t  *)FreeSans_22pt8bBitmaps,
   (GFXglyph *)FreeSans_22pt8bGlyphs,
   0x20, 0xFF, 52 };
@@ -1933,7 +1933,7 @@ const uint8_t FreeSans_24pt8bBitmaps[] PROGMEM = {
   0x00, 0x1E, 0x00, 0x00, 0xF8, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03,
   0xF8, 0x00, 0x0F, 0x80, 0x00 };
 
-const GFXglyph FreeSans_24pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph FreeSans_24pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,  12,    0,    0 },   // 0x20 ' '
   {     1,   4,  34,  16,    6,  -33 },   // 0x21 '!'
   {    18,  12,  12,  16,    2,  -33 },   // 0x22 '"'
@@ -2159,7 +2159,7 @@ const GFXglyph FreeSans_24pt8bGlyphs[] PROGMEM = {
   { 22947,  22,  44,  26,    3,  -33 },   // 0xFE ''
   { 23068,  22,  44,  22,    0,  -33 } }; // 0xFF ''
 
-const GFXfont FreeSans_24pt8b PROGMEM = {
+constexpr GFXfont FreeSans_24pt8b PROGMEM = {
   (uint8_t  *)FreeSans_24pt8bBitmaps,
   (GFXglyph *)FreeSans_24pt8bGlyphs,
   0x20, 0xFF, 56 };
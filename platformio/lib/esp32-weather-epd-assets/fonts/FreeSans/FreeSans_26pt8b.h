@@ -2275,7 +2275,7 @@ const uint8_t FreeSans_26pt8bBitmaps[] PROGMEM = {
   0xF0, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F,
   0x00, 0x00 };
 
-const GFXglyph FreeSans_26pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph FreeSans_26pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,  13,    0,    0 },   // 0x20 ' '
   {     1,   5,  37,  17,    6,  -36 },   // 0x21 '!'
   {    25,  13,  12,  17,    2,  -36 },   // 0x22 '"'
@@ -2501,7 +2501,7 @@ const GFXglyph FreeSans_26pt8bGlyphs[] PROGMEM = {
   { 27002,  24,  48,  28,    3,  -36 },   // 0xFE ''
   { 27146,  24,  48,  24,    0,  -36 } }; // 0xFF ''
 
-const GFXfont FreeSans_26pt8b PROGMEM = {
+constexpr GFXfont FreeSans_26pt8b PROGMEM = {
   (uint8_t  *)FreeSans_26pt8bBitmaps,
   (GFXglyph *)FreeSans_26pt8bGlyphs,
   0x20, 0xFF, 61 };
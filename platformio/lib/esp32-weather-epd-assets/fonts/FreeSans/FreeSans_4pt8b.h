@@ -69,7 +69,7 @@ const uint8_t FreeSans_4pt8bBitmaps[] PROGMEM = {
   0x20, 0xAA, 0xA6, 0x44, 0x80, 0x8F, 0x99, 0x9F, 0x88, 0x6A, 0xAA, 0x64,
   0x48 };
 
-const GFXglyph FreeSans_4pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph FreeSans_4pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   2,    0,    0 },   // 0x20 ' '
   {     1,   1,   6,   3,    1,   -5 },   // 0x21 '!'
   {     2,   2,   2,   3,    0,   -5 },   // 0x22 '"'
@@ -295,7 +295,7 @@ const GFXglyph FreeSans_4pt8bGlyphs[] PROGMEM = {
   {   809,   4,   8,   4,    0,   -5 },   // 0xFE ''
   {   813,   4,   8,   4,    0,   -5 } }; // 0xFF ''
 
-const GFXfont FreeSans_4pt8b PROGMEM = {
+constexpr GFXfont FreeSans_4pt8b PROGMEM = {
   (uint8_t  *)FreeSans_4pt8bBitmaps,
   (GFXglyph *)FreeSans_4pt8bGlyphs,
   0x20, 0xFF, 9 };
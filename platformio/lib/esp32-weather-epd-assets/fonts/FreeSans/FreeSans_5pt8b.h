@@ -97,7 +97,7 @@ const uint8_t FreeSans_5pt8bBitmaps[] PROGMEM = {
   0x99, 0x9F, 0x20, 0x25, 0x25, 0x31, 0x84, 0x46, 0x00, 0x08, 0xE9, 0x99,
   0x9E, 0x80, 0x50, 0x25, 0x25, 0x31, 0x84, 0x46, 0x00 };
 
-const GFXglyph FreeSans_5pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph FreeSans_5pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   2,    0,    0 },   // 0x20 ' '
   {     1,   1,   8,   3,    1,   -7 },   // 0x21 '!'
   {     2,   3,   2,   3,    0,   -6 },   // 0x22 '"'
@@ -323,7 +323,7 @@ const GFXglyph FreeSans_5pt8bGlyphs[] PROGMEM = {
   {  1149,   4,  10,   5,    1,   -7 },   // 0xFE ''
   {  1154,   5,  10,   5,    0,   -7 } }; // 0xFF ''
 
-const GFXfont FreeSans_5pt8b PROGMEM = {
+constexpr GFXfont FreeSans_5pt8b PROGMEM = {
   (uint8_t  *)FreeSans_5pt8bBitmaps,
   (GFXglyph *)FreeSans_5pt8bGlyphs,
   0x20, 0xFF, 12 };
@@ -139,7 +139,7 @@ const uint8_t FreeSans_6pt8bBitmaps[] PROGMEM = {
   0x84, 0x3D, 0x18, 0xC6, 0x31, 0xF4, 0x20, 0x78, 0x22, 0x94, 0xA9, 0x46,
   0x21, 0x08, 0x80 };
 
-const GFXglyph FreeSans_6pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph FreeSans_6pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   3,    0,    0 },   // 0x20 ' '
   {     1,   1,   9,   4,    1,   -8 },   // 0x21 '!'
   {     3,   3,   3,   4,    0,   -8 },   // 0x22 '"'
@@ -365,7 +365,7 @@ const GFXglyph FreeSans_6pt8bGlyphs[] PROGMEM = {
   {  1644,   5,  11,   7,    1,   -8 },   // 0xFE ''
   {  1651,   5,  12,   6,    0,   -8 } }; // 0xFF ''
 
-const GFXfont FreeSans_6pt8b PROGMEM = {
+constexpr GFXfont FreeSans_6pt8b PROGMEM = {
   (uint8_t  *)FreeSans_6pt8bBitmaps,
   (GFXglyph *)FreeSans_6pt8bGlyphs,
   0x20, 0xFF, 14 };
@@ -175,7 +175,7 @@ const uint8_t FreeSans_7pt8bBitmaps[] PROGMEM = {
   0x86, 0x18, 0x61, 0xCE, 0xE8, 0x20, 0x80, 0x28, 0x08, 0x51, 0x4D, 0x22,
   0x8E, 0x30, 0xC3, 0x08, 0x60 };
 
-const GFXglyph FreeSans_7pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph FreeSans_7pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   3,    0,    0 },   // 0x20 ' '
   {     1,   1,  10,   5,    2,   -9 },   // 0x21 '!'
   {     3,   3,   3,   5,    1,   -9 },   // 0x22 '"'
@@ -401,7 +401,7 @@ const GFXglyph FreeSans_7pt8bGlyphs[] PROGMEM = {
   {  2073,   6,  13,   8,    1,   -9 },   // 0xFE ''
   {  2083,   6,  13,   7,    0,   -9 } }; // 0xFF ''
 
-const GFXfont FreeSans_7pt8b PROGMEM = {
+constexpr GFXfont FreeSans_7pt8b PROGMEM = {
   (uint8_t  *)FreeSans_7pt8bBitmaps,
   (GFXglyph *)FreeSans_7pt8bGlyphs,
   0x20, 0xFF, 16 };
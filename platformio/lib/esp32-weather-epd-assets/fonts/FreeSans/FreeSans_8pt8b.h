@@ -223,7 +223,7 @@ const uint8_t FreeSans_8pt8bBitmaps[] PROGMEM = {
   0xC1, 0x83, 0x8F, 0x1D, 0xE8, 0x10, 0x20, 0x00, 0x24, 0x48, 0x06, 0x14,
   0x68, 0x99, 0x16, 0x28, 0x70, 0x60, 0x81, 0x06, 0x18, 0x00 };
 
-const GFXglyph FreeSans_8pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph FreeSans_8pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   4,    0,    0 },   // 0x20 ' '
   {     1,   1,  12,   5,    2,  -11 },   // 0x21 '!'
   {     3,   4,   4,   5,    1,  -10 },   // 0x22 '"'
@@ -449,7 +449,7 @@ const GFXglyph FreeSans_8pt8bGlyphs[] PROGMEM = {
   {  2646,   7,  15,   9,    1,  -11 },   // 0xFE ''
   {  2660,   7,  15,   7,    0,  -11 } }; // 0xFF ''
 
-const GFXfont FreeSans_8pt8b PROGMEM = {
+constexpr GFXfont FreeSans_8pt8b PROGMEM = {
   (uint8_t  *)FreeSans_8pt8bBitmaps,
   (GFXglyph *)FreeSans_8pt8bGlyphs,
   0x20, 0xFF, 19 };
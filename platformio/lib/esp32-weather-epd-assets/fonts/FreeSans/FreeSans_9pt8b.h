@@ -274,7 +274,7 @@ const uint8_t FreeSans_9pt8bBitmaps[] PROGMEM = {
   0xC0, 0x36, 0x36, 0x00, 0xC3, 0x43, 0x42, 0x66, 0x26, 0x24, 0x34, 0x1C,
   0x18, 0x18, 0x18, 0x10, 0x30, 0x60 };
 
-const GFXglyph FreeSans_9pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph FreeSans_9pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   4,    0,    0 },   // 0x20 ' '
   {     1,   2,  13,   6,    2,  -12 },   // 0x21 '!'
   {     5,   4,   4,   6,    1,  -12 },   // 0x22 '"'
@@ -500,7 +500,7 @@ const GFXglyph FreeSans_9pt8bGlyphs[] PROGMEM = {
   {  3249,   8,  16,  10,    1,  -12 },   // 0xFE ''
   {  3265,   8,  17,   8,    0,  -12 } }; // 0xFF ''
 
-const GFXfont FreeSans_9pt8b PROGMEM = {
+constexpr GFXfont FreeSans_9pt8b PROGMEM = {
   (uint8_t  *)FreeSans_9pt8bBitmaps,
   (GFXglyph *)FreeSans_9pt8bGlyphs,
   0x20, 0xFF, 21 };
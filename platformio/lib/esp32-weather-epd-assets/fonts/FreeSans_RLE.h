@@ -0,0 +1,39 @@
+#ifndef __FONTS_FREESANS_RLE_H__
+#define __FONTS_FREESANS_RLE_H__
+#include "FreeSans_RLE/FreeSans_RLE_10pt8b.h"
+#include "FreeSans_RLE/FreeSans_RLE_11pt8b.h"
+#include "FreeSans_RLE/FreeSans_RLE_12pt8b.h"
+#include "FreeSans_RLE/FreeSans_RLE_14pt8b.h"
+#include "FreeSans_RLE/FreeSans_RLE_16pt8b.h"
+#include "FreeSans_RLE/FreeSans_RLE_18pt8b.h"
+#include "FreeSans_RLE/FreeSans_RLE_20pt8b.h"
+#include "FreeSans_RLE/FreeSans_RLE_22pt8b.h"
+#include "FreeSans_RLE/FreeSans_RLE_24pt8b.h"
+#include "FreeSans_RLE/FreeSans_RLE_26pt8b.h"
+#include "FreeSans_RLE/FreeSans_RLE_48pt8b_temperature.h"
+#include "FreeSans_RLE/FreeSans_RLE_4pt8b.h"
+#include "FreeSans_RLE/FreeSans_RLE_5pt8b.h"
+#include "FreeSans_RLE/FreeSans_RLE_6pt8b.h"
+#include "FreeSans_RLE/FreeSans_RLE_7pt8b.h"
+#include "FreeSans_RLE/FreeSans_RLE_8pt8b.h"
+#include "FreeSans_RLE/FreeSans_RLE_9pt8b.h"
+
+#define FONT_10pt8b FreeSans_RLE_10pt8b
+#define FONT_11pt8b FreeSans_RLE_11pt8b
+#define FONT_12pt8b FreeSans_RLE_12pt8b
+#define FONT_14pt8b FreeSans_RLE_14pt8b
+#define FONT_16pt8b FreeSans_RLE_16pt8b
+#define FONT_18pt8b FreeSans_RLE_18pt8b
+#define FONT_20pt8b FreeSans_RLE_20pt8b
+#define FONT_22pt8b FreeSans_RLE_22pt8b
+#define FONT_24pt8b FreeSans_RLE_24pt8b
+#define FONT_26pt8b FreeSans_RLE_26pt8b
+#define FONT_48pt8b_temperature FreeSans_RLE_48pt8b_temperature
+#define FONT_4pt8b FreeSans_RLE_4pt8b
+#define FONT_5pt8b FreeSans_RLE_5pt8b
+#define FONT_6pt8b FreeSans_RLE_6pt8b
+#define FONT_7pt8b FreeSans_RLE_7pt8b
+#define FONT_8pt8b FreeSans_RLE_8pt8b
+#define FONT_9pt8b FreeSans_RLE_9pt8b
+#define FONT_RLE_LIST &FreeSans_RLE_12pt8b, &FreeSans_RLE_14pt8b, &FreeSans_RLE_16pt8b, &FreeSans_RLE_18pt8b, &FreeSans_RLE_20pt8b, &FreeSans_RLE_22pt8b, &FreeSans_RLE_24pt8b, &FreeSans_RLE_26pt8b, &FreeSans_RLE_48pt8b_temperature, 
+#endif
@@ -0,0 +1,581 @@
+const uint8_t FreeSans_RLE_10pt8bBitmaps[] PROGMEM = {
+  0x00, 0xFF, 0xFF, 0x55, 0x3C, 0xDE, 0xF7, 0x29, 0x00, 0x08, 0x81, 0x10,
+  0x22, 0x0C, 0xC7, 0xFE, 0x33, 0x04, 0x40, 0x88, 0x11, 0x1F, 0xF8, 0xCC,
+  0x19, 0x02, 0x20, 0x44, 0x00, 0x08, 0x3F, 0x32, 0xD9, 0x38, 0x86, 0x43,
+  0xA0, 0x7C, 0x0F, 0x04, 0xE2, 0x71, 0x3C, 0x9F, 0x58, 0xF8, 0x10, 0x08,
+  0x00, 0x00, 0x10, 0x78, 0x20, 0xCC, 0x20, 0x84, 0x40, 0x84, 0xC0, 0xCC,
+  0x80, 0x79, 0x80, 0x01, 0x00, 0x03, 0x3E, 0x02, 0x62, 0x04, 0x63, 0x04,
+  0x63, 0x08, 0x36, 0x18, 0x1C, 0x1E, 0x06, 0x60, 0x84, 0x10, 0x83, 0x30,
+  0x3C, 0x06, 0x03, 0x62, 0xC6, 0x58, 0x7B, 0x06, 0x60, 0xC7, 0xFC, 0x78,
+  0xC0, 0xFF, 0x00, 0x10, 0x88, 0x46, 0x21, 0x08, 0xC6, 0x30, 0x84, 0x31,
+  0x84, 0x30, 0x80, 0x84, 0x46, 0x22, 0x33, 0x33, 0x33, 0x32, 0x26, 0x48,
+  0x20, 0x8F, 0xCC, 0x59, 0x00, 0x08, 0x04, 0x02, 0x01, 0x0F, 0xF8, 0x40,
+  0x20, 0x10, 0x08, 0x00, 0xF5, 0x80, 0xF8, 0xF0, 0x08, 0x20, 0x84, 0x10,
+  0x43, 0x08, 0x20, 0x84, 0x10, 0x42, 0x08, 0x00, 0x3C, 0x3F, 0x98, 0xD8,
+  0x3C, 0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xE0, 0xF0, 0x68, 0x67, 0x71, 0xE0,
+  0x08, 0xCF, 0xF1, 0x8C, 0x63, 0x18, 0xC6, 0x31, 0x8C, 0x3E, 0x3F, 0xB0,
+  0x78, 0x3C, 0x18, 0x0C, 0x0C, 0x1C, 0x1C, 0x38, 0x18, 0x18, 0x0F, 0xFF,
+  0xFC, 0x3E, 0x3F, 0xB0, 0xD8, 0x20, 0x10, 0x18, 0x78, 0x0E, 0x01, 0x80,
+  0xE0, 0x78, 0x37, 0xF1, 0xF0, 0x06, 0x03, 0x03, 0x83, 0xC1, 0x61, 0xB1,
+  0x99, 0x8C, 0x86, 0x7F, 0xFF, 0xE0, 0xC0, 0x60, 0x30, 0x7F, 0x3F, 0x90,
+  0x08, 0x04, 0x87, 0xFB, 0x8C, 0x03, 0x01, 0x80, 0xF0, 0x78, 0x27, 0xF1,
+  0xF0, 0x1E, 0x3F, 0x98, 0xD8, 0x3C, 0x06, 0xF3, 0xFD, 0x83, 0xC1, 0xE0,
+  0xF0, 0x68, 0x37, 0xF1, 0xF0, 0xFF, 0xFF, 0xC0, 0x40, 0x60, 0x20, 0x30,
+  0x30, 0x18, 0x18, 0x0C, 0x04, 0x06, 0x03, 0x01, 0x80, 0x3E, 0x3F, 0xB0,
+  0xD8, 0x3C, 0x13, 0xB8, 0xF9, 0xC6, 0xC1, 0xC0, 0xF0, 0x78, 0x37, 0xF1,
+  0xF0, 0x3C, 0x3F, 0xB0, 0xD8, 0x3C, 0x1E, 0x0F, 0x0E, 0xFF, 0x3D, 0x80,
+  0xC0, 0x58, 0x67, 0xE1, 0xE0, 0xF0, 0x00, 0x3C, 0xF0, 0x00, 0x3D, 0xA0,
+  0x01, 0x83, 0x8F, 0x1E, 0x0C, 0x03, 0xC0, 0x38, 0x07, 0x00, 0x80, 0xFF,
+  0x80, 0x00, 0x00, 0x0F, 0xF8, 0xC0, 0x1E, 0x01, 0xE0, 0x0E, 0x01, 0xC1,
+  0xC3, 0xC3, 0xC0, 0x80, 0x00, 0x3E, 0x3F, 0x98, 0x68, 0x34, 0x18, 0x0C,
+  0x0C, 0x0C, 0x0C, 0x06, 0x02, 0x00, 0x00, 0x00, 0x40, 0x20, 0x03, 0xF0,
+  0x03, 0xFF, 0x01, 0xC0, 0x60, 0xC0, 0x0C, 0x60, 0x01, 0x98, 0x7B, 0x6C,
+  0x33, 0x8B, 0x18, 0x63, 0x8C, 0x18, 0xE3, 0x04, 0x28, 0xC3, 0x1B, 0x30,
+  0xC6, 0xC6, 0x73, 0x10, 0xE7, 0x86, 0x00, 0x00, 0xE0, 0x00, 0x1F, 0xF8,
+  0x01, 0xFC, 0x00, 0x07, 0x00, 0x38, 0x01, 0x60, 0x1B, 0x00, 0xD8, 0x04,
+  0x60, 0x63, 0x03, 0x18, 0x30, 0x61, 0xFF, 0x0F, 0xF8, 0xC0, 0x66, 0x03,
+  0x30, 0x1B, 0x00, 0x60, 0xFF, 0x3F, 0xE8, 0x1A, 0x03, 0x80, 0xE0, 0x6F,
+  0xF3, 0xFE, 0x81, 0xE0, 0x38, 0x0E, 0x03, 0x80, 0xFF, 0xEF, 0xF0, 0x0F,
+  0x83, 0xFC, 0x60, 0x66, 0x03, 0xC0, 0x3C, 0x00, 0xC0, 0x0C, 0x00, 0xC0,
+  0x0C, 0x03, 0xC0, 0x36, 0x03, 0x70, 0x63, 0xFC, 0x0F, 0x80, 0xFE, 0x1F,
+  0xF2, 0x07, 0x40, 0x68, 0x07, 0x00, 0xE0, 0x1C, 0x03, 0x80, 0x70, 0x0E,
+  0x01, 0xC0, 0x68, 0x1D, 0xFF, 0x3F, 0x80, 0xFF, 0xBF, 0xE8, 0x02, 0x00,
+  0x80, 0x20, 0x0F, 0xFB, 0xFE, 0x80, 0x20, 0x08, 0x02, 0x00, 0x80, 0x3F,
+  0xFF, 0xFC, 0xFF, 0xFF, 0xE0, 0x10, 0x08, 0x04, 0x03, 0xFD, 0xFE, 0x80,
+  0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x00, 0x0F, 0x81, 0xFF, 0x1C, 0x1C,
+  0xC0, 0x6C, 0x01, 0xE0, 0x03, 0x00, 0x18, 0x3F, 0xC1, 0xFE, 0x00, 0xF0,
+  0x06, 0xC0, 0x77, 0x03, 0x9F, 0xFC, 0x3E, 0x20, 0x80, 0x70, 0x0E, 0x01,
+  0xC0, 0x38, 0x07, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x70, 0x0E, 0x01, 0xC0,
+  0x38, 0x07, 0x00, 0xE0, 0x18, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xC3, 0xC3, 0xC6, 0xFE, 0x7C,
+  0x80, 0xD0, 0x32, 0x0C, 0x43, 0x88, 0xE1, 0x38, 0x2E, 0x07, 0xE0, 0xEE,
+  0x18, 0xC2, 0x0C, 0x41, 0xC8, 0x19, 0x01, 0xA0, 0x38, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0xFF,
+  0xC0, 0x3F, 0x01, 0xF8, 0x0F, 0x40, 0xFB, 0x07, 0xD8, 0x2E, 0x43, 0x73,
+  0x1B, 0x98, 0x9C, 0x4C, 0xE2, 0x67, 0x1A, 0x38, 0x71, 0xC3, 0x8E, 0x18,
+  0x60, 0xC0, 0x78, 0x0F, 0x81, 0xD8, 0x3B, 0x07, 0x30, 0xE6, 0x1C, 0x63,
+  0x86, 0x70, 0xCE, 0x0D, 0xC0, 0xF8, 0x1F, 0x01, 0xE0, 0x38, 0x0F, 0x80,
+  0xFF, 0x87, 0x03, 0x18, 0x06, 0xC0, 0x1B, 0x00, 0x6C, 0x00, 0xF0, 0x03,
+  0xC0, 0x0F, 0x00, 0x2C, 0x01, 0x98, 0x06, 0x70, 0x30, 0xFF, 0x80, 0xF8,
+  0x00, 0xFF, 0x3F, 0xE8, 0x1E, 0x03, 0x80, 0xE0, 0x38, 0x1B, 0xFE, 0xFE,
+  0x20, 0x08, 0x02, 0x00, 0x80, 0x20, 0x08, 0x00, 0x0F, 0x80, 0xFF, 0x87,
+  0x03, 0x18, 0x06, 0xC0, 0x1B, 0x00, 0x6C, 0x00, 0xF0, 0x03, 0xC0, 0x0F,
+  0x00, 0x6C, 0x01, 0x98, 0x36, 0x70, 0x70, 0xFF, 0xC0, 0xF9, 0x80, 0x02,
+  0xFF, 0x9F, 0xFA, 0x03, 0x40, 0x28, 0x05, 0x01, 0xA0, 0x37, 0xFC, 0xFF,
+  0x90, 0x1A, 0x03, 0x40, 0x68, 0x0D, 0x01, 0xA0, 0x18, 0x1F, 0x0F, 0xF9,
+  0x83, 0x60, 0x3C, 0x00, 0xC0, 0x1F, 0x00, 0xFC, 0x01, 0xC0, 0x0F, 0x01,
+  0xE0, 0x3E, 0x06, 0xFF, 0x87, 0xC0, 0xFF, 0xFF, 0xFC, 0x30, 0x06, 0x00,
+  0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC0,
+  0x18, 0x03, 0x00, 0x80, 0x70, 0x0E, 0x01, 0xC0, 0x38, 0x07, 0x00, 0xE0,
+  0x1C, 0x03, 0x80, 0x70, 0x0E, 0x01, 0xE0, 0x6C, 0x0C, 0xFF, 0x0F, 0xC0,
+  0xC0, 0x36, 0x03, 0x60, 0x36, 0x06, 0x30, 0x63, 0x06, 0x10, 0xC1, 0x8C,
+  0x18, 0xC0, 0x98, 0x0D, 0x80, 0xD8, 0x05, 0x00, 0x70, 0x07, 0x00, 0xC0,
+  0xC0, 0xD8, 0x38, 0x36, 0x0E, 0x19, 0x87, 0x86, 0x61, 0xA1, 0x8C, 0x4C,
+  0x63, 0x33, 0x10, 0xCC, 0xCC, 0x33, 0x13, 0x04, 0x86, 0xC1, 0xE1, 0xB0,
+  0x78, 0x68, 0x1E, 0x0E, 0x03, 0x03, 0x80, 0xC0, 0xE0, 0x60, 0x31, 0x83,
+  0x0C, 0x18, 0x31, 0x80, 0xD8, 0x06, 0xC0, 0x1C, 0x00, 0xE0, 0x07, 0x00,
+  0x6C, 0x06, 0x70, 0x31, 0x83, 0x06, 0x30, 0x39, 0x80, 0xC0, 0x60, 0x1B,
+  0x01, 0x8C, 0x1C, 0x70, 0xC1, 0x8C, 0x06, 0x60, 0x36, 0x00, 0xF0, 0x07,
+  0x00, 0x18, 0x00, 0xC0, 0x06, 0x00, 0x30, 0x01, 0x80, 0x0C, 0x00, 0xFF,
+  0xFF, 0xF0, 0x0C, 0x06, 0x03, 0x01, 0xC0, 0x60, 0x30, 0x18, 0x0E, 0x03,
+  0x01, 0x80, 0xE0, 0x3F, 0xFF, 0xFC, 0xFC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC,
+  0xCC, 0xCC, 0xCC, 0xF0, 0x82, 0x04, 0x10, 0x40, 0x82, 0x08, 0x30, 0x41,
+  0x04, 0x08, 0x20, 0x80, 0xF3, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+  0x33, 0xF0, 0x10, 0x70, 0xA3, 0x64, 0x48, 0xF0, 0x80, 0xFF, 0xE0, 0x61,
+  0x84, 0x3E, 0x3F, 0xB0, 0xC0, 0x60, 0x73, 0xFB, 0x0D, 0x06, 0x83, 0x77,
+  0x9E, 0x60, 0xC0, 0x60, 0x30, 0x18, 0x0D, 0xE7, 0xFB, 0x87, 0x83, 0xC0,
+  0xE0, 0x70, 0x38, 0x3E, 0x1F, 0xFB, 0x78, 0x3C, 0x7E, 0xC3, 0xC1, 0x80,
+  0x80, 0x80, 0xC1, 0xC3, 0x7E, 0x3C, 0x01, 0x80, 0xC0, 0x60, 0x33, 0xDB,
+  0xFF, 0x0F, 0x83, 0x81, 0xC0, 0xE0, 0x78, 0x3C, 0x3B, 0xFC, 0xFE, 0x3E,
+  0x3F, 0xB0, 0xD8, 0x38, 0x1F, 0xFE, 0x01, 0x83, 0xC3, 0x3F, 0x8F, 0x00,
+  0x19, 0x88, 0x4F, 0x90, 0x84, 0x21, 0x08, 0x42, 0x10, 0x80, 0x3D, 0xBF,
+  0xF0, 0xF8, 0x38, 0x1C, 0x0E, 0x07, 0x83, 0xC3, 0xBF, 0xCF, 0x60, 0x2C,
+  0x37, 0x38, 0xF0, 0xC0, 0xC0, 0xC0, 0xC0, 0xDE, 0xF7, 0xE3, 0xC1, 0xC1,
+  0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xF0, 0xFF, 0xFF, 0xFC, 0x24, 0x02,
+  0x49, 0x24, 0x92, 0x49, 0x27, 0x80, 0xC0, 0x60, 0x30, 0x18, 0x0C, 0x36,
+  0x33, 0x31, 0xB0, 0xF8, 0x76, 0x33, 0x18, 0xCC, 0x66, 0x1B, 0x06, 0xFF,
+  0xFF, 0xFF, 0xFC, 0xDE, 0x7B, 0xDF, 0x6C, 0x30, 0xF0, 0xC3, 0xC3, 0x0F,
+  0x0C, 0x3C, 0x30, 0xF0, 0xC3, 0xC3, 0x0F, 0x0C, 0x3C, 0x30, 0xC0, 0xDE,
+  0xF7, 0xE3, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0x3C, 0x3F,
+  0xB0, 0xD8, 0x38, 0x1C, 0x0E, 0x07, 0x83, 0xC3, 0x3F, 0x8F, 0x00, 0xDE,
+  0x7F, 0xB8, 0x78, 0x3C, 0x0E, 0x07, 0x03, 0x83, 0xE1, 0xFF, 0xB7, 0x98,
+  0x0C, 0x06, 0x03, 0x00, 0x3D, 0xBF, 0xF0, 0xF8, 0x38, 0x1C, 0x0E, 0x07,
+  0x83, 0xC3, 0xBF, 0xCF, 0x60, 0x30, 0x18, 0x0C, 0x06, 0xDF, 0xF9, 0x8C,
+  0x63, 0x18, 0xC6, 0x30, 0x3C, 0xFE, 0xC3, 0xC0, 0xE0, 0x7E, 0x07, 0x83,
+  0xC3, 0xFE, 0x7C, 0x21, 0x09, 0xF2, 0x10, 0x84, 0x21, 0x08, 0x43, 0x1C,
+  0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC3, 0xC3, 0xE7, 0x7D, 0xC0,
+  0x90, 0x66, 0x19, 0x84, 0x23, 0x0C, 0xC3, 0x20, 0x58, 0x1C, 0x07, 0x00,
+  0xC0, 0xC3, 0x0D, 0x0C, 0x36, 0x78, 0x99, 0xE6, 0x65, 0x98, 0x92, 0x43,
+  0x4D, 0x0F, 0x3C, 0x3C, 0xF0, 0x61, 0x81, 0x86, 0x00, 0x61, 0xB1, 0x8C,
+  0x82, 0xC1, 0xC0, 0x60, 0x70, 0x6C, 0x33, 0x31, 0x90, 0x60, 0xC1, 0xA0,
+  0xD8, 0x4C, 0x62, 0x31, 0x90, 0xD8, 0x28, 0x1C, 0x0E, 0x02, 0x03, 0x01,
+  0x83, 0x81, 0x80, 0xFF, 0x03, 0x06, 0x0C, 0x18, 0x18, 0x30, 0x60, 0xC0,
+  0xC0, 0xFF, 0x32, 0x66, 0x66, 0x66, 0x6C, 0xC6, 0x66, 0x66, 0x66, 0x30,
+  0xFF, 0xFF, 0xC0, 0xC3, 0x08, 0x42, 0x10, 0x84, 0x30, 0xCC, 0x42, 0x10,
+  0x84, 0x21, 0x38, 0xF1, 0x99, 0x8E, 0xFF, 0xFE, 0x00, 0x38, 0x78, 0xE3,
+  0xF3, 0x98, 0x6E, 0x41, 0xB9, 0x06, 0xE0, 0x1B, 0x80, 0xCE, 0x06, 0x38,
+  0x30, 0xE0, 0xC3, 0x83, 0x0E, 0x00, 0x38, 0x00, 0xE0, 0xC3, 0x83, 0x0E,
+  0x00, 0x3F, 0xFF, 0xC0, 0xFF, 0xFE, 0x00, 0x38, 0x78, 0xE3, 0xF3, 0x98,
+  0x6E, 0x41, 0xB9, 0x06, 0xE0, 0x1B, 0x80, 0xCE, 0x06, 0x38, 0x30, 0xE0,
+  0xC3, 0x83, 0x0E, 0x00, 0x38, 0x00, 0xE0, 0xC3, 0x83, 0x0E, 0x00, 0x3F,
+  0xFF, 0xC0, 0xFF, 0xFE, 0x00, 0x38, 0x78, 0xE3, 0xF3, 0x98, 0x6E, 0x41,
+  0xB9, 0x06, 0xE0, 0x1B, 0x80, 0xCE, 0x06, 0x38, 0x30, 0xE0, 0xC3, 0x83,
+  0x0E, 0x00, 0x38, 0x00, 0xE0, 0xC3, 0x83, 0x0E, 0x00, 0x3F, 0xFF, 0xC0,
+  0xFF, 0xFE, 0x00, 0x38, 0x78, 0xE3, 0xF3, 0x98, 0x6E, 0x41, 0xB9, 0x06,
+  0xE0, 0x1B, 0x80, 0xCE, 0x06, 0x38, 0x30, 0xE0, 0xC3, 0x83, 0x0E, 0x00,
+  0x38, 0x00, 0xE0, 0xC3, 0x83, 0x0E, 0x00, 0x3F, 0xFF, 0xC0, 0xFF, 0xFE,
+  0x00, 0x38, 0x78, 0xE3, 0xF3, 0x98, 0x6E, 0x41, 0xB9, 0x06, 0xE0, 0x1B,
+  0x80, 0xCE, 0x06, 0x38, 0x30, 0xE0, 0xC3, 0x83, 0x0E, 0x00, 0x38, 0x00,
+  0xE0, 0xC3, 0x83, 0x0E, 0x00, 0x3F, 0xFF, 0xC0, 0xFF, 0xFE, 0x00, 0x38,
+  0x78, 0xE3, 0xF3, 0x98, 0x6E, 0x41, 0xB9, 0x06, 0xE0, 0x1B, 0x80, 0xCE,
+  0x06, 0x38, 0x30, 0xE0, 0xC3, 0x83, 0x0E, 0x00, 0x38, 0x00, 0xE0, 0xC3,
+  0x83, 0x0E, 0x00, 0x3F, 0xFF, 0xC0, 0xFF, 0xFE, 0x00, 0x38, 0x78, 0xE3,
+  0xF3, 0x98, 0x6E, 0x41, 0xB9, 0x06, 0xE0, 0x1B, 0x80, 0xCE, 0x06, 0x38,
+  0x30, 0xE0, 0xC3, 0x83, 0x0E, 0x00, 0x38, 0x00, 0xE0, 0xC3, 0x83, 0x0E,
+  0x00, 0x3F, 0xFF, 0xC0, 0xFF, 0xFE, 0x00, 0x38, 0x78, 0xE3, 0xF3, 0x98,
+  0x6E, 0x41, 0xB9, 0x06, 0xE0, 0x1B, 0x80, 0xCE, 0x06, 0x38, 0x30, 0xE0,
+  0xC3, 0x83, 0x0E, 0x00, 0x38, 0x00, 0xE0, 0xC3, 0x83, 0x0E, 0x00, 0x3F,
+  0xFF, 0xC0, 0xFF, 0xFE, 0x00, 0x38, 0x78, 0xE3, 0xF3, 0x98, 0x6E, 0x41,
+  0xB9, 0x06, 0xE0, 0x1B, 0x80, 0xCE, 0x06, 0x38, 0x30, 0xE0, 0xC3, 0x83,
+  0x0E, 0x00, 0x38, 0x00, 0xE0, 0xC3, 0x83, 0x0E, 0x00, 0x3F, 0xFF, 0xC0,
+  0xFF, 0xFE, 0x00, 0x38, 0x78, 0xE3, 0xF3, 0x98, 0x6E, 0x41, 0xB9, 0x06,
+  0xE0, 0x1B, 0x80, 0xCE, 0x06, 0x38, 0x30, 0xE0, 0xC3, 0x83, 0x0E, 0x00,
+  0x38, 0x00, 0xE0, 0xC3, 0x83, 0x0E, 0x00, 0x3F, 0xFF, 0xC0, 0xFF, 0xFE,
+  0x00, 0x38, 0x78, 0xE3, 0xF3, 0x98, 0x6E, 0x41, 0xB9, 0x06, 0xE0, 0x1B,
+  0x80, 0xCE, 0x06, 0x38, 0x30, 0xE0, 0xC3, 0x83, 0x0E, 0x00, 0x38, 0x00,
+  0xE0, 0xC3, 0x83, 0x0E, 0x00, 0x3F, 0xFF, 0xC0, 0xFF, 0xFE, 0x00, 0x38,
+  0x78, 0xE3, 0xF3, 0x98, 0x6E, 0x41, 0xB9, 0x06, 0xE0, 0x1B, 0x80, 0xCE,
+  0x06, 0x38, 0x30, 0xE0, 0xC3, 0x83, 0x0E, 0x00, 0x38, 0x00, 0xE0, 0xC3,
+  0x83, 0x0E, 0x00, 0x3F, 0xFF, 0xC0, 0xFF, 0xFE, 0x00, 0x38, 0x78, 0xE3,
+  0xF3, 0x98, 0x6E, 0x41, 0xB9, 0x06, 0xE0, 0x1B, 0x80, 0xCE, 0x06, 0x38,
+  0x30, 0xE0, 0xC3, 0x83, 0x0E, 0x00, 0x38, 0x00, 0xE0, 0xC3, 0x83, 0x0E,
+  0x00, 0x3F, 0xFF, 0xC0, 0xFF, 0xFE, 0x00, 0x38, 0x78, 0xE3, 0xF3, 0x98,
+  0x6E, 0x41, 0xB9, 0x06, 0xE0, 0x1B, 0x80, 0xCE, 0x06, 0x38, 0x30, 0xE0,
+  0xC3, 0x83, 0x0E, 0x00, 0x38, 0x00, 0xE0, 0xC3, 0x83, 0x0E, 0x00, 0x3F,
+  0xFF, 0xC0, 0xFF, 0xFE, 0x00, 0x38, 0x78, 0xE3, 0xF3, 0x98, 0x6E, 0x41,
+  0xB9, 0x06, 0xE0, 0x1B, 0x80, 0xCE, 0x06, 0x38, 0x30, 0xE0, 0xC3, 0x83,
+  0x0E, 0x00, 0x38, 0x00, 0xE0, 0xC3, 0x83, 0x0E, 0x00, 0x3F, 0xFF, 0xC0,
+  0xFF, 0xFE, 0x00, 0x38, 0x78, 0xE3, 0xF3, 0x98, 0x6E, 0x41, 0xB9, 0x06,
+  0xE0, 0x1B, 0x80, 0xCE, 0x06, 0x38, 0x30, 0xE0, 0xC3, 0x83, 0x0E, 0x00,
+  0x38, 0x00, 0xE0, 0xC3, 0x83, 0x0E, 0x00, 0x3F, 0xFF, 0xC0, 0xFF, 0xFE,
+  0x00, 0x38, 0x78, 0xE3, 0xF3, 0x98, 0x6E, 0x41, 0xB9, 0x06, 0xE0, 0x1B,
+  0x80, 0xCE, 0x06, 0x38, 0x30, 0xE0, 0xC3, 0x83, 0x0E, 0x00, 0x38, 0x00,
+  0xE0, 0xC3, 0x83, 0x0E, 0x00, 0x3F, 0xFF, 0xC0, 0xFF, 0xFE, 0x00, 0x38,
+  0x78, 0xE3, 0xF3, 0x98, 0x6E, 0x41, 0xB9, 0x06, 0xE0, 0x1B, 0x80, 0xCE,
+  0x06, 0x38, 0x30, 0xE0, 0xC3, 0x83, 0x0E, 0x00, 0x38, 0x00, 0xE0, 0xC3,
+  0x83, 0x0E, 0x00, 0x3F, 0xFF, 0xC0, 0xFF, 0xFE, 0x00, 0x38, 0x78, 0xE3,
+  0xF3, 0x98, 0x6E, 0x41, 0xB9, 0x06, 0xE0, 0x1B, 0x80, 0xCE, 0x06, 0x38,
+  0x30, 0xE0, 0xC3, 0x83, 0x0E, 0x00, 0x38, 0x00, 0xE0, 0xC3, 0x83, 0x0E,
+  0x00, 0x3F, 0xFF, 0xC0, 0xFF, 0xFE, 0x00, 0x38, 0x78, 0xE3, 0xF3, 0x98,
+  0x6E, 0x41, 0xB9, 0x06, 0xE0, 0x1B, 0x80, 0xCE, 0x06, 0x38, 0x30, 0xE0,
+  0xC3, 0x83, 0x0E, 0x00, 0x38, 0x00, 0xE0, 0xC3, 0x83, 0x0E, 0x00, 0x3F,
+  0xFF, 0xC0, 0xFF, 0xFE, 0x00, 0x38, 0x78, 0xE3, 0xF3, 0x98, 0x6E, 0x41,
+  0xB9, 0x06, 0xE0, 0x1B, 0x80, 0xCE, 0x06, 0x38, 0x30, 0xE0, 0xC3, 0x83,
+  0x0E, 0x00, 0x38, 0x00, 0xE0, 0xC3, 0x83, 0x0E, 0x00, 0x3F, 0xFF, 0xC0,
+  0xFF, 0xFE, 0x00, 0x38, 0x78, 0xE3, 0xF3, 0x98, 0x6E, 0x41, 0xB9, 0x06,
+  0xE0, 0x1B, 0x80, 0xCE, 0x06, 0x38, 0x30, 0xE0, 0xC3, 0x83, 0x0E, 0x00,
+  0x38, 0x00, 0xE0, 0xC3, 0x83, 0x0E, 0x00, 0x3F, 0xFF, 0xC0, 0xFF, 0xFE,
+  0x00, 0x38, 0x78, 0xE3, 0xF3, 0x98, 0x6E, 0x41, 0xB9, 0x06, 0xE0, 0x1B,
+  0x80, 0xCE, 0x06, 0x38, 0x30, 0xE0, 0xC3, 0x83, 0x0E, 0x00, 0x38, 0x00,
+  0xE0, 0xC3, 0x83, 0x0E, 0x00, 0x3F, 0xFF, 0xC0, 0xFF, 0xFE, 0x00, 0x38,
+  0x78, 0xE3, 0xF3, 0x98, 0x6E, 0x41, 0xB9, 0x06, 0xE0, 0x1B, 0x80, 0xCE,
+  0x06, 0x38, 0x30, 0xE0, 0xC3, 0x83, 0x0E, 0x00, 0x38, 0x00, 0xE0, 0xC3,
+  0x83, 0x0E, 0x00, 0x3F, 0xFF, 0xC0, 0xFF, 0xFE, 0x00, 0x38, 0x78, 0xE3,
+  0xF3, 0x98, 0x6E, 0x41, 0xB9, 0x06, 0xE0, 0x1B, 0x80, 0xCE, 0x06, 0x38,
+  0x30, 0xE0, 0xC3, 0x83, 0x0E, 0x00, 0x38, 0x00, 0xE0, 0xC3, 0x83, 0x0E,
+  0x00, 0x3F, 0xFF, 0xC0, 0xFF, 0xFE, 0x00, 0x38, 0x78, 0xE3, 0xF3, 0x98,
+  0x6E, 0x41, 0xB9, 0x06, 0xE0, 0x1B, 0x80, 0xCE, 0x06, 0x38, 0x30, 0xE0,
+  0xC3, 0x83, 0x0E, 0x00, 0x38, 0x00, 0xE0, 0xC3, 0x83, 0x0E, 0x00, 0x3F,
+  0xFF, 0xC0, 0xFF, 0xFE, 0x00, 0x38, 0x78, 0xE3, 0xF3, 0x98, 0x6E, 0x41,
+  0xB9, 0x06, 0xE0, 0x1B, 0x80, 0xCE, 0x06, 0x38, 0x30, 0xE0, 0xC3, 0x83,
+  0x0E, 0x00, 0x38, 0x00, 0xE0, 0xC3, 0x83, 0x0E, 0x00, 0x3F, 0xFF, 0xC0,
+  0xFF, 0xFE, 0x00, 0x38, 0x78, 0xE3, 0xF3, 0x98, 0x6E, 0x41, 0xB9, 0x06,
+  0xE0, 0x1B, 0x80, 0xCE, 0x06, 0x38, 0x30, 0xE0, 0xC3, 0x83, 0x0E, 0x00,
+  0x38, 0x00, 0xE0, 0xC3, 0x83, 0x0E, 0x00, 0x3F, 0xFF, 0xC0, 0xFF, 0xFE,
+  0x00, 0x38, 0x78, 0xE3, 0xF3, 0x98, 0x6E, 0x41, 0xB9, 0x06, 0xE0, 0x1B,
+  0x80, 0xCE, 0x06, 0x38, 0x30, 0xE0, 0xC3, 0x83, 0x0E, 0x00, 0x38, 0x00,
+  0xE0, 0xC3, 0x83, 0x0E, 0x00, 0x3F, 0xFF, 0xC0, 0xFF, 0xFE, 0x00, 0x38,
+  0x78, 0xE3, 0xF3, 0x98, 0x6E, 0x41, 0xB9, 0x06, 0xE0, 0x1B, 0x80, 0xCE,
+  0x06, 0x38, 0x30, 0xE0, 0xC3, 0x83, 0x0E, 0x00, 0x38, 0x00, 0xE0, 0xC3,
+  0x83, 0x0E, 0x00, 0x3F, 0xFF, 0xC0, 0xFF, 0xFE, 0x00, 0x38, 0x78, 0xE3,
+  0xF3, 0x98, 0x6E, 0x41, 0xB9, 0x06, 0xE0, 0x1B, 0x80, 0xCE, 0x06, 0x38,
+  0x30, 0xE0, 0xC3, 0x83, 0x0E, 0x00, 0x38, 0x00, 0xE0, 0xC3, 0x83, 0x0E,
+  0x00, 0x3F, 0xFF, 0xC0, 0xFF, 0xFE, 0x00, 0x38, 0x78, 0xE3, 0xF3, 0x98,
+  0x6E, 0x41, 0xB9, 0x06, 0xE0, 0x1B, 0x80, 0xCE, 0x06, 0x38, 0x30, 0xE0,
+  0xC3, 0x83, 0x0E, 0x00, 0x38, 0x00, 0xE0, 0xC3, 0x83, 0x0E, 0x00, 0x3F,
+  0xFF, 0xC0, 0xFF, 0xFE, 0x00, 0x38, 0x78, 0xE3, 0xF3, 0x98, 0x6E, 0x41,
+  0xB9, 0x06, 0xE0, 0x1B, 0x80, 0xCE, 0x06, 0x38, 0x30, 0xE0, 0xC3, 0x83,
+  0x0E, 0x00, 0x38, 0x00, 0xE0, 0xC3, 0x83, 0x0E, 0x00, 0x3F, 0xFF, 0xC0,
+  0x00, 0xF1, 0x5F, 0xFF, 0xF0, 0x08, 0x04, 0x07, 0x8F, 0xE6, 0x9E, 0x4F,
+  0x21, 0x90, 0xC8, 0x64, 0xDA, 0x6F, 0xE1, 0xE0, 0x40, 0x20, 0x1F, 0x0F,
+  0xE6, 0x0D, 0x83, 0x60, 0xD8, 0x03, 0x03, 0xF8, 0x18, 0x06, 0x01, 0x80,
+  0x40, 0x20, 0x1F, 0xF4, 0x3C, 0x00, 0x6F, 0x9F, 0xCC, 0x64, 0x33, 0x19,
+  0xFC, 0xFE, 0x00, 0x00, 0xC0, 0x4C, 0x18, 0x82, 0x18, 0xC1, 0x10, 0x36,
+  0x03, 0x83, 0xFE, 0x04, 0x00, 0x81, 0xFF, 0x02, 0x00, 0x40, 0x08, 0x00,
+  0xFF, 0x1F, 0xC0, 0x1E, 0x1F, 0x98, 0xCC, 0x67, 0x01, 0xC3, 0x39, 0x0E,
+  0x83, 0xE0, 0xD8, 0x67, 0x31, 0xF0, 0x70, 0x0C, 0x86, 0x43, 0x3F, 0x0F,
+  0x00, 0xEF, 0xB0, 0x0F, 0x80, 0xE1, 0x86, 0x01, 0x13, 0xE2, 0xC8, 0xCA,
+  0x61, 0x19, 0x00, 0x64, 0x01, 0x98, 0x47, 0x61, 0x24, 0xFC, 0x98, 0xC4,
+  0x38, 0x60, 0x3E, 0x00, 0x72, 0x20, 0xBE, 0x8A, 0x6E, 0xC0, 0xF8, 0x22,
+  0xCF, 0x36, 0x66, 0x64, 0x40, 0xFF, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0,
+  0xF8, 0x0F, 0x80, 0xE1, 0x86, 0x01, 0x13, 0xE2, 0xC8, 0x4A, 0x21, 0x18,
+  0x8C, 0x63, 0xE1, 0x88, 0x47, 0x21, 0x24, 0x84, 0x98, 0x04, 0x38, 0x60,
+  0x3E, 0x00, 0xF8, 0x7B, 0x38, 0x73, 0x78, 0x08, 0x04, 0x02, 0x01, 0x0F,
+  0xF8, 0x40, 0x20, 0x10, 0x08, 0x00, 0x00, 0x1F, 0xF0, 0x39, 0x14, 0x41,
+  0x19, 0x84, 0x3F, 0x79, 0x34, 0x41, 0x18, 0x1C, 0x51, 0x78, 0x64, 0x80,
+  0xC1, 0x30, 0x4C, 0x13, 0x04, 0xC1, 0x30, 0x4C, 0x13, 0x04, 0xC3, 0x39,
+  0xEF, 0xDF, 0x00, 0xC0, 0x30, 0x0C, 0x00, 0x3F, 0xBC, 0xBE, 0x5F, 0x2F,
+  0x97, 0xCB, 0xE4, 0xF2, 0x39, 0x04, 0x82, 0x41, 0x20, 0x90, 0x48, 0x24,
+  0x12, 0x09, 0x04, 0x80, 0xF0, 0x21, 0x87, 0xE0, 0x13, 0xF3, 0x33, 0x33,
+  0x30, 0x74, 0x63, 0x18, 0xC5, 0xC0, 0xF8, 0x09, 0x99, 0x99, 0x16, 0x79,
+  0xA2, 0x00, 0x20, 0x10, 0xE0, 0x10, 0x20, 0x20, 0x20, 0x60, 0x20, 0x40,
+  0x20, 0x84, 0x20, 0x84, 0x21, 0x0C, 0x02, 0x14, 0x02, 0x34, 0x04, 0x24,
+  0x04, 0x7F, 0x08, 0x04, 0x10, 0x04, 0x20, 0x00, 0x20, 0x10, 0xE0, 0x20,
+  0x20, 0x20, 0x20, 0x40, 0x20, 0x80, 0x20, 0x80, 0x21, 0x1E, 0x23, 0x22,
+  0x02, 0x23, 0x04, 0x02, 0x0C, 0x0C, 0x08, 0x30, 0x10, 0x20, 0x10, 0x3E,
+  0x38, 0x00, 0x44, 0x08, 0x44, 0x08, 0x04, 0x10, 0x18, 0x30, 0x04, 0x20,
+  0x44, 0x42, 0x44, 0x46, 0x38, 0x86, 0x01, 0x0A, 0x01, 0x12, 0x02, 0x32,
+  0x06, 0x3F, 0x04, 0x02, 0x08, 0x02, 0x18, 0x18, 0x00, 0x00, 0x18, 0x18,
+  0x38, 0x70, 0xE0, 0xC0, 0xC1, 0xC3, 0xE7, 0x7E, 0x0E, 0x00, 0x18, 0x00,
+  0x00, 0x0E, 0x00, 0x70, 0x02, 0xC0, 0x36, 0x01, 0xB0, 0x08, 0xC0, 0xC6,
+  0x06, 0x30, 0x60, 0xC3, 0xFE, 0x1F, 0xF1, 0x80, 0xCC, 0x06, 0x60, 0x36,
+  0x00, 0xC0, 0x01, 0x80, 0x10, 0x00, 0x00, 0x0E, 0x00, 0x70, 0x02, 0xC0,
+  0x36, 0x01, 0xB0, 0x08, 0xC0, 0xC6, 0x06, 0x30, 0x60, 0xC3, 0xFE, 0x1F,
+  0xF1, 0x80, 0xCC, 0x06, 0x60, 0x36, 0x00, 0xC0, 0x07, 0x00, 0x6C, 0x00,
+  0x00, 0x0E, 0x00, 0x70, 0x02, 0xC0, 0x36, 0x01, 0xB0, 0x08, 0xC0, 0xC6,
+  0x06, 0x30, 0x60, 0xC3, 0xFE, 0x1F, 0xF1, 0x80, 0xCC, 0x06, 0x60, 0x36,
+  0x00, 0xC0, 0x0E, 0xC0, 0x5C, 0x00, 0x00, 0x0E, 0x00, 0x70, 0x02, 0xC0,
+  0x36, 0x01, 0xB0, 0x08, 0xC0, 0xC6, 0x06, 0x30, 0x60, 0xC3, 0xFE, 0x1F,
+  0xF1, 0x80, 0xCC, 0x06, 0x60, 0x36, 0x00, 0xC0, 0x0D, 0x80, 0x6C, 0x00,
+  0x00, 0x0E, 0x00, 0x70, 0x02, 0xC0, 0x36, 0x01, 0xB0, 0x08, 0xC0, 0xC6,
+  0x06, 0x30, 0x60, 0xC3, 0xFE, 0x1F, 0xF1, 0x80, 0xCC, 0x06, 0x60, 0x36,
+  0x00, 0xC0, 0x07, 0x00, 0x2C, 0x01, 0x60, 0x0E, 0x00, 0x00, 0x03, 0x80,
+  0x1C, 0x00, 0xB0, 0x0D, 0x80, 0x6C, 0x02, 0x30, 0x31, 0x81, 0x8C, 0x18,
+  0x30, 0xFF, 0x87, 0xFC, 0x60, 0x33, 0x01, 0x98, 0x0D, 0x80, 0x30, 0x03,
+  0xFF, 0xC0, 0x7F, 0xF8, 0x19, 0x80, 0x03, 0x30, 0x00, 0xC6, 0x00, 0x18,
+  0xC0, 0x02, 0x1F, 0xF0, 0xC3, 0xFE, 0x18, 0x60, 0x07, 0xFC, 0x00, 0xFF,
+  0x80, 0x18, 0x30, 0x06, 0x06, 0x00, 0xC0, 0xFF, 0xF0, 0x1F, 0xF8, 0x0F,
+  0x83, 0xFC, 0x60, 0x66, 0x03, 0xC0, 0x3C, 0x00, 0xC0, 0x0C, 0x00, 0xC0,
+  0x0C, 0x03, 0xC0, 0x36, 0x03, 0x70, 0x63, 0xFC, 0x1F, 0x80, 0x40, 0x07,
+  0x00, 0x10, 0x0E, 0x00, 0x18, 0x01, 0x00, 0x03, 0xFE, 0xFF, 0xA0, 0x08,
+  0x02, 0x00, 0x80, 0x3F, 0xEF, 0xFA, 0x00, 0x80, 0x20, 0x08, 0x02, 0x00,
+  0xFF, 0xFF, 0xF0, 0x0C, 0x06, 0x00, 0x03, 0xFE, 0xFF, 0xA0, 0x08, 0x02,
+  0x00, 0x80, 0x3F, 0xEF, 0xFA, 0x00, 0x80, 0x20, 0x08, 0x02, 0x00, 0xFF,
+  0xFF, 0xF0, 0x1C, 0x0D, 0x80, 0x03, 0xFE, 0xFF, 0xA0, 0x08, 0x02, 0x00,
+  0x80, 0x3F, 0xEF, 0xFA, 0x00, 0x80, 0x20, 0x08, 0x02, 0x00, 0xFF, 0xFF,
+  0xF0, 0x36, 0x0D, 0x80, 0x03, 0xFE, 0xFF, 0xA0, 0x08, 0x02, 0x00, 0x80,
+  0x3F, 0xEF, 0xFA, 0x00, 0x80, 0x20, 0x08, 0x02, 0x00, 0xFF, 0xFF, 0xF0,
+  0x61, 0x03, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x7C, 0x06, 0x66,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x79, 0x20, 0x0C, 0x30, 0xC3, 0x0C,
+  0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xC0, 0xCF, 0x30, 0x0C, 0x30,
+  0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xC0, 0x3F, 0xC1,
+  0xFF, 0x0C, 0x0C, 0x60, 0x63, 0x01, 0x98, 0x0C, 0xC0, 0x7F, 0xC3, 0x30,
+  0x19, 0x80, 0xCC, 0x06, 0x60, 0x63, 0x03, 0x1F, 0xF0, 0xFF, 0x00, 0x19,
+  0x05, 0xE0, 0x00, 0x60, 0x3C, 0x07, 0xC0, 0xEC, 0x1D, 0x83, 0x98, 0x73,
+  0x0E, 0x31, 0xC3, 0x38, 0x67, 0x06, 0xE0, 0x7C, 0x0F, 0x80, 0xF0, 0x1C,
+  0x0E, 0x00, 0x08, 0x00, 0x10, 0x03, 0xE0, 0x3F, 0xE1, 0xC0, 0xC6, 0x01,
+  0xB0, 0x06, 0xC0, 0x1B, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0B, 0x00,
+  0x66, 0x01, 0x9C, 0x0C, 0x3F, 0xE0, 0x3E, 0x00, 0x01, 0x80, 0x0C, 0x00,
+  0x00, 0x03, 0xE0, 0x3F, 0xE1, 0xC0, 0xC6, 0x01, 0xB0, 0x06, 0xC0, 0x1B,
+  0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0B, 0x00, 0x66, 0x01, 0x9C, 0x0C,
+  0x3F, 0xE0, 0x3E, 0x00, 0x07, 0x00, 0x16, 0x00, 0x80, 0x03, 0xE0, 0x3F,
+  0xE1, 0xC0, 0xC6, 0x01, 0xB0, 0x06, 0xC0, 0x1B, 0x00, 0x3C, 0x00, 0xF0,
+  0x03, 0xC0, 0x0B, 0x00, 0x66, 0x01, 0x9C, 0x0C, 0x3F, 0xE0, 0x3E, 0x00,
+  0x0C, 0xC0, 0x2E, 0x00, 0x00, 0x03, 0xE0, 0x3F, 0xE1, 0xC0, 0xC6, 0x01,
+  0xB0, 0x06, 0xC0, 0x1B, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0B, 0x00,
+  0x66, 0x01, 0x9C, 0x0C, 0x3F, 0xE0, 0x3E, 0x00, 0x0D, 0x80, 0x36, 0x00,
+  0x00, 0x03, 0xE0, 0x3F, 0xE1, 0xC0, 0xC6, 0x01, 0xB0, 0x06, 0xC0, 0x1B,
+  0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0B, 0x00, 0x66, 0x01, 0x9C, 0x0C,
+  0x3F, 0xE0, 0x3E, 0x00, 0xC2, 0x66, 0x3C, 0x18, 0x3C, 0x66, 0xC2, 0x0F,
+  0x8C, 0xFF, 0xE7, 0x03, 0x18, 0x1E, 0xC0, 0x5B, 0x02, 0x6C, 0x10, 0xF0,
+  0x83, 0xC4, 0x0F, 0x20, 0x6D, 0x01, 0x9C, 0x06, 0x70, 0x33, 0xFF, 0x88,
+  0xF8, 0x00, 0x1C, 0x00, 0x80, 0x00, 0x40, 0x38, 0x07, 0x00, 0xE0, 0x1C,
+  0x03, 0x80, 0x70, 0x0E, 0x01, 0xC0, 0x38, 0x07, 0x00, 0xF0, 0x36, 0x06,
+  0x7F, 0x87, 0xE0, 0x06, 0x01, 0x00, 0x00, 0x40, 0x38, 0x07, 0x00, 0xE0,
+  0x1C, 0x03, 0x80, 0x70, 0x0E, 0x01, 0xC0, 0x38, 0x07, 0x00, 0xF0, 0x36,
+  0x06, 0x7F, 0x87, 0xE0, 0x1E, 0x02, 0x60, 0x00, 0x40, 0x38, 0x07, 0x00,
+  0xE0, 0x1C, 0x03, 0x80, 0x70, 0x0E, 0x01, 0xC0, 0x38, 0x07, 0x00, 0xF0,
+  0x36, 0x06, 0x7F, 0x87, 0xE0, 0x33, 0x06, 0x60, 0x00, 0x40, 0x38, 0x07,
+  0x00, 0xE0, 0x1C, 0x03, 0x80, 0x70, 0x0E, 0x01, 0xC0, 0x38, 0x07, 0x00,
+  0xF0, 0x36, 0x06, 0x7F, 0x87, 0xE0, 0x03, 0x80, 0x30, 0x00, 0x00, 0xC0,
+  0x36, 0x03, 0x18, 0x38, 0xE1, 0x83, 0x18, 0x0C, 0xC0, 0x6C, 0x01, 0xE0,
+  0x0E, 0x00, 0x30, 0x01, 0x80, 0x0C, 0x00, 0x60, 0x03, 0x00, 0x18, 0x00,
+  0x80, 0x20, 0x0F, 0xE3, 0xFE, 0x81, 0xA0, 0x38, 0x0E, 0x03, 0x81, 0xFF,
+  0xEF, 0xF2, 0x00, 0x80, 0x20, 0x08, 0x00, 0x7E, 0x61, 0xA0, 0xD0, 0x68,
+  0x34, 0xF2, 0x1D, 0x03, 0x81, 0xC0, 0xE0, 0x70, 0x69, 0xF4, 0xE0, 0x30,
+  0x0C, 0x02, 0x00, 0x03, 0xE3, 0xFB, 0x0C, 0x06, 0x07, 0x3F, 0xB0, 0xD0,
+  0x68, 0x37, 0x79, 0xE6, 0x0C, 0x04, 0x04, 0x00, 0x03, 0xE3, 0xFB, 0x0C,
+  0x06, 0x07, 0x3F, 0xB0, 0xD0, 0x68, 0x37, 0x79, 0xE6, 0x1C, 0x0A, 0x08,
+  0x80, 0x03, 0xE3, 0xFB, 0x0C, 0x06, 0x07, 0x3F, 0xB0, 0xD0, 0x68, 0x37,
+  0x79, 0xE6, 0x3A, 0x37, 0x00, 0x07, 0xC7, 0xF6, 0x18, 0x0C, 0x0E, 0x7F,
+  0x61, 0xA0, 0xD0, 0x6E, 0xF3, 0xCC, 0x36, 0x1B, 0x00, 0x00, 0x03, 0xE3,
+  0xFB, 0x0C, 0x06, 0x07, 0x3F, 0xB0, 0xD0, 0x68, 0x37, 0x79, 0xE6, 0x1C,
+  0x1A, 0x07, 0x00, 0x03, 0xE3, 0xFB, 0x0C, 0x06, 0x07, 0x3F, 0xB0, 0xD0,
+  0x68, 0x37, 0x79, 0xE6, 0x3C, 0x78, 0xFD, 0xFB, 0x0E, 0x18, 0x18, 0x10,
+  0x30, 0x2F, 0xFF, 0xF0, 0xC0, 0x41, 0x81, 0x83, 0x87, 0xD9, 0xF9, 0xE1,
+  0xE0, 0x3C, 0x7E, 0xC3, 0xC1, 0x80, 0x80, 0x80, 0xC1, 0xC3, 0x7E, 0x3C,
+  0x10, 0x1C, 0x0C, 0x38, 0x30, 0x0C, 0x02, 0x00, 0x03, 0xE3, 0xFB, 0x0D,
+  0x83, 0x81, 0xFF, 0xE0, 0x18, 0x3C, 0x33, 0xF8, 0xF0, 0x0C, 0x04, 0x04,
+  0x00, 0x03, 0xE3, 0xFB, 0x0D, 0x83, 0x81, 0xFF, 0xE0, 0x18, 0x3C, 0x33,
+  0xF8, 0xF0, 0x1C, 0x0A, 0x08, 0x80, 0x03, 0xE3, 0xFB, 0x0D, 0x83, 0x81,
+  0xFF, 0xE0, 0x18, 0x3C, 0x33, 0xF8, 0xF0, 0x36, 0x1B, 0x00, 0x00, 0x03,
+  0xE3, 0xFB, 0x0D, 0x83, 0x81, 0xFF, 0xE0, 0x18, 0x3C, 0x33, 0xF8, 0xF0,
+  0xE6, 0x30, 0x66, 0x66, 0x66, 0x66, 0x66, 0x60, 0x36, 0x40, 0x66, 0x66,
+  0x66, 0x66, 0x66, 0x60, 0x72, 0xA2, 0x02, 0x10, 0x84, 0x21, 0x08, 0x42,
+  0x10, 0x80, 0xDE, 0xC0, 0x02, 0x10, 0x84, 0x21, 0x08, 0x42, 0x10, 0x80,
+  0x64, 0x1C, 0x1E, 0x01, 0x83, 0xE3, 0xBB, 0x0D, 0x83, 0x81, 0xC0, 0xE0,
+  0x78, 0x3C, 0x33, 0xF8, 0xF0, 0x3A, 0x6E, 0x00, 0xDE, 0xF7, 0xE3, 0xC1,
+  0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0x30, 0x0C, 0x02, 0x00, 0x03,
+  0xC3, 0xFB, 0x0D, 0x83, 0x81, 0xC0, 0xE0, 0x78, 0x3C, 0x33, 0xF8, 0xF0,
+  0x0C, 0x04, 0x04, 0x00, 0x03, 0xC3, 0xFB, 0x0D, 0x83, 0x81, 0xC0, 0xE0,
+  0x78, 0x3C, 0x33, 0xF8, 0xF0, 0x18, 0x1A, 0x09, 0x80, 0x03, 0xC3, 0xFB,
+  0x0D, 0x83, 0x81, 0xC0, 0xE0, 0x78, 0x3C, 0x33, 0xF8, 0xF0, 0x3A, 0x37,
+  0x00, 0x07, 0x87, 0xF6, 0x1B, 0x07, 0x03, 0x81, 0xC0, 0xF0, 0x78, 0x67,
+  0xF1, 0xE0, 0x66, 0x33, 0x00, 0x00, 0x03, 0xC3, 0xFB, 0x0D, 0x83, 0x81,
+  0xC0, 0xE0, 0x78, 0x3C, 0x33, 0xF8, 0xF0, 0x0C, 0x06, 0x00, 0x00, 0x0F,
+  0xF8, 0x00, 0x00, 0x18, 0x0C, 0x00, 0x1E, 0x4F, 0xE6, 0x19, 0x8F, 0x42,
+  0xD1, 0x34, 0x8D, 0xC3, 0x61, 0x9F, 0xE9, 0xE0, 0x30, 0x18, 0x08, 0x00,
+  0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC3, 0xC3, 0xE7, 0x7D, 0x06,
+  0x0C, 0x18, 0x00, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC3, 0xC3,
+  0xE7, 0x7D, 0x18, 0x34, 0x26, 0x00, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1,
+  0xC1, 0xC3, 0xC3, 0xE7, 0x7D, 0x36, 0x36, 0x00, 0x00, 0xC1, 0xC1, 0xC1,
+  0xC1, 0xC1, 0xC1, 0xC1, 0xC3, 0xC3, 0xE7, 0x7D, 0x06, 0x06, 0x02, 0x00,
+  0x0C, 0x1A, 0x0D, 0x84, 0xC6, 0x23, 0x19, 0x0D, 0x82, 0x81, 0xC0, 0xE0,
+  0x20, 0x30, 0x18, 0x38, 0x18, 0x00, 0xC0, 0x60, 0x30, 0x1B, 0xCF, 0xF7,
+  0x0F, 0x07, 0x81, 0xC0, 0xE0, 0x70, 0x7C, 0x3F, 0xF6, 0xF3, 0x01, 0x80,
+  0xC0, 0x60, 0x00, 0x33, 0x19, 0x80, 0x00, 0x0C, 0x1A, 0x0D, 0x84, 0xC6,
+  0x23, 0x19, 0x0D, 0x82, 0x81, 0xC0, 0xE0, 0x20, 0x30, 0x18, 0x38, 0x18,
+  0x00 };
+
+constexpr GFXglyph FreeSans_RLE_10pt8bGlyphs[] PROGMEM = {
+  {     0,   1,   1,   5,    0,    0 },   // 0x20 ' '
+  {     1,   2,  15,   7,    2,  -14 },   // 0x21 '!'
+  {     5,   5,   5,   7,    1,  -13 },   // 0x22 '"'
+  {     9,  11,  14,  11,    0,  -13 },   // 0x23 '#'
+  {    29,   9,  17,  11,    1,  -14 },   // 0x24 '$'
+  {    49,  16,  14,  17,    1,  -13 },   // 0x25 '%'
+  {    77,  11,  14,  13,    1,  -13 },   // 0x26 '&'
+  {    97,   2,   5,   4,    1,  -13 },   // 0x27 '''
+  {    99,   5,  18,   7,    1,  -14 },   // 0x28 '('
+  {   111,   4,  18,   7,    1,  -14 },   // 0x29 ')'
+  {   120,   6,   6,   8,    1,  -14 },   // 0x2A '*'
+  {   125,   9,   9,  11,    1,   -8 },   // 0x2B '+'
+  {   136,   2,   5,   5,    2,   -1 },   // 0x2C ','
+  {   138,   5,   1,   7,    1,   -5 },   // 0x2D '-'
+  {   139,   2,   2,   5,    2,   -1 },   // 0x2E '.'
+  {   140,   6,  15,   5,    0,  -14 },   // 0x2F '/'
+  {   152,   9,  14,  11,    1,  -13 },   // 0x30 '0'
+  {   168,   5,  14,  11,    2,  -13 },   // 0x31 '1'
+  {   177,   9,  14,  11,    1,  -13 },   // 0x32 '2'
+  {   193,   9,  14,  11,    1,  -13 },   // 0x33 '3'
+  {   209,   9,  14,  11,    1,  -13 },   // 0x34 '4'
+  {   225,   9,  14,  11,    1,  -13 },   // 0x35 '5'
+  {   241,   9,  14,  11,    1,  -13 },   // 0x36 '6'
+  {   257,   9,  14,  11,    1,  -13 },   // 0x37 '7'
+  {   273,   9,  14,  11,    1,  -13 },   // 0x38 '8'
+  {   289,   9,  14,  11,    1,  -13 },   // 0x39 '9'
+  {   305,   2,  11,   5,    2,  -10 },   // 0x3A ':'
+  {   308,   2,  14,   5,    2,  -10 },   // 0x3B ';'
+  {   312,   9,   9,  11,    1,   -8 },   // 0x3C '<'
+  {   323,   9,   5,  11,    1,   -6 },   // 0x3D '='
+  {   329,  10,   9,  11,    1,   -8 },   // 0x3E '>'
+  {   341,   9,  15,  11,    1,  -14 },   // 0x3F '?'
+  {   358,  18,  18,  20,    1,  -14 },   // 0x40 '@'
+  {   399,  13,  15,  13,    0,  -14 },   // 0x41 'A'
+  {   424,  10,  15,  13,    2,  -14 },   // 0x42 'B'
+  {   443,  12,  15,  14,    1,  -14 },   // 0x43 'C'
+  {   466,  11,  15,  14,    2,  -14 },   // 0x44 'D'
+  {   487,  10,  15,  12,    2,  -14 },   // 0x45 'E'
+  {   506,   9,  15,  12,    2,  -14 },   // 0x46 'F'
+  {   523,  13,  15,  15,    1,  -14 },   // 0x47 'G'
+  {   548,  11,  15,  14,    2,  -14 },   // 0x48 'H'
+  {   569,   2,  15,   5,    2,  -14 },   // 0x49 'I'
+  {   573,   8,  15,  10,    1,  -14 },   // 0x4A 'J'
+  {   588,  11,  15,  13,    2,  -14 },   // 0x4B 'K'
+  {   609,   8,  15,  11,    2,  -14 },   // 0x4C 'L'
+  {   624,  13,  15,  17,    2,  -14 },   // 0x4D 'M'
+  {   649,  11,  15,  14,    2,  -14 },   // 0x4E 'N'
+  {   670,  14,  15,  15,    1,  -14 },   // 0x4F 'O'
+  {   697,  10,  15,  13,    2,  -14 },   // 0x50 'P'
+  {   716,  14,  16,  15,    1,  -14 },   // 0x51 'Q'
+  {   744,  11,  15,  14,    2,  -14 },   // 0x52 'R'
+  {   765,  11,  15,  13,    1,  -14 },   // 0x53 'S'
+  {   786,  11,  15,  12,    1,  -14 },   // 0x54 'T'
+  {   807,  11,  15,  14,    2,  -14 },   // 0x55 'U'
+  {   828,  12,  15,  13,    0,  -14 },   // 0x56 'V'
+  {   851,  18,  15,  18,    0,  -14 },   // 0x57 'W'
+  {   885,  13,  15,  13,    0,  -14 },   // 0x58 'X'
+  {   910,  13,  15,  13,    0,  -14 },   // 0x59 'Y'
+  {   935,  10,  15,  12,    1,  -14 },   // 0x5A 'Z'
+  {   954,   4,  19,   5,    1,  -14 },   // 0x5B '['
+  {   964,   6,  15,   5,    0,  -14 },   // 0x5C '\'
+  {   976,   4,  19,   5,    0,  -14 },   // 0x5D ']'
+  {   986,   7,   7,   9,    1,  -13 },   // 0x5E '^'
+  {   993,  11,   1,  11,    0,    3 },   // 0x5F '_'
+  {   995,   5,   3,   5,    0,  -14 },   // 0x60 '`'
+  {   997,   9,  11,  11,    1,  -10 },   // 0x61 'a'
+  {  1010,   9,  15,  11,    1,  -14 },   // 0x62 'b'
+  {  1027,   8,  11,  10,    1,  -10 },   // 0x63 'c'
+  {  1038,   9,  15,  11,    1,  -14 },   // 0x64 'd'
+  {  1055,   9,  11,  10,    1,  -10 },   // 0x65 'e'
+  {  1068,   5,  15,   5,    0,  -14 },   // 0x66 'f'
+  {  1078,   9,  15,  11,    1,  -10 },   // 0x67 'g'
+  {  1095,   8,  15,  11,    1,  -14 },   // 0x68 'h'
+  {  1110,   2,  15,   4,    1,  -14 },   // 0x69 'i'
+  {  1114,   3,  19,   5,    0,  -14 },   // 0x6A 'j'
+  {  1122,   9,  15,  10,    1,  -14 },   // 0x6B 'k'
+  {  1139,   2,  15,   4,    1,  -14 },   // 0x6C 'l'
+  {  1143,  14,  11,  16,    1,  -10 },   // 0x6D 'm'
+  {  1163,   8,  11,  11,    1,  -10 },   // 0x6E 'n'
+  {  1174,   9,  11,  10,    1,  -10 },   // 0x6F 'o'
+  {  1187,   9,  15,  11,    1,  -10 },   // 0x70 'p'
+  {  1204,   9,  15,  11,    1,  -10 },   // 0x71 'q'
+  {  1221,   5,  11,   7,    1,  -10 },   // 0x72 'r'
+  {  1228,   8,  11,  10,    1,  -10 },   // 0x73 's'
+  {  1239,   5,  14,   5,    0,  -13 },   // 0x74 't'
+  {  1248,   8,  11,  11,    1,  -10 },   // 0x75 'u'
+  {  1259,  10,  11,  10,    0,  -10 },   // 0x76 'v'
+  {  1273,  14,  11,  14,    0,  -10 },   // 0x77 'w'
+  {  1293,   9,  11,   9,    0,  -10 },   // 0x78 'x'
+  {  1306,   9,  15,   9,    0,  -10 },   // 0x79 'y'
+  {  1323,   8,  11,  10,    1,  -10 },   // 0x7A 'z'
+  {  1334,   4,  19,   7,    1,  -14 },   // 0x7B '{'
+  {  1344,   1,  18,   5,    2,  -14 },   // 0x7C '|'
+  {  1347,   5,  19,   7,    1,  -14 },   // 0x7D '}'
+  {  1359,   8,   3,  10,    1,   -7 },   // 0x7E '~'
+  {  1362,  14,  19,  16,    1,  -15 },   // 0x7F ''
+  {  1396,  14,  19,  16,    1,  -15 },   // 0x80 ''
+  {  1430,  14,  19,  16,    1,  -15 },   // 0x81 ''
+  {  1464,  14,  19,  16,    1,  -15 },   // 0x82 ''
+  {  1498,  14,  19,  16,    1,  -15 },   // 0x83 ''
+  {  1532,  14,  19,  16,    1,  -15 },   // 0x84 ''
+  {  1566,  14,  19,  16,    1,  -15 },   // 0x85 ''
+  {  1600,  14,  19,  16,    1,  -15 },   // 0x86 ''
+  {  1634,  14,  19,  16,    1,  -15 },   // 0x87 ''
+  {  1668,  14,  19,  16,    1,  -15 },   // 0x88 ''
+  {  1702,  14,  19,  16,    1,  -15 },   // 0x89 ''
+  {  1736,  14,  19,  16,    1,  -15 },   // 0x8A ''
+  {  1770,  14,  19,  16,    1,  -15 },   // 0x8B ''
+  {  1804,  14,  19,  16,    1,  -15 },   // 0x8C ''
+  {  1838,  14,  19,  16,    1,  -15 },   // 0x8D ''
+  {  1872,  14,  19,  16,    1,  -15 },   // 0x8E ''
+  {  1906,  14,  19,  16,    1,  -15 },   // 0x8F ''
+  {  1940,  14,  19,  16,    1,  -15 },   // 0x90 ''
+  {  1974,  14,  19,  16,    1,  -15 },   // 0x91 ''
+  {  2008,  14,  19,  16,    1,  -15 },   // 0x92 ''
+  {  2042,  14,  19,  16,    1,  -15 },   // 0x93 ''
+  {  2076,  14,  19,  16,    1,  -15 },   // 0x94 ''
+  {  2110,  14,  19,  16,    1,  -15 },   // 0x95 ''
+  {  2144,  14,  19,  16,    1,  -15 },   // 0x96 ''
+  {  2178,  14,  19,  16,    1,  -15 },   // 0x97 ''
+  {  2212,  14,  19,  16,    1,  -15 },   // 0x98 ''
+  {  2246,  14,  19,  16,    1,  -15 },   // 0x99 ''
+  {  2280,  14,  19,  16,    1,  -15 },   // 0x9A ''
+  {  2314,  14,  19,  16,    1,  -15 },   // 0x9B ''
+  {  2348,  14,  19,  16,    1,  -15 },   // 0x9C ''
+  {  2382,  14,  19,  16,    1,  -15 },   // 0x9D ''
+  {  2416,  14,  19,  16,    1,  -15 },   // 0x9E ''
+  {  2450,  14,  19,  16,    1,  -15 },   // 0x9F ''
+  {  2484,   1,   1,   5,    0,    0 },   // 0xA0 ''
+  {  2485,   2,  14,   7,    2,   -9 },   // 0xA1 ''
+  {  2489,   9,  15,  11,    1,  -12 },   // 0xA2 ''
+  {  2506,  10,  15,  11,    0,  -14 },   // 0xA3 ''
+  {  2525,   9,   9,  11,    1,  -10 },   // 0xA4 ''
+  {  2536,  11,  14,  11,    0,  -13 },   // 0xA5 ''
+  {  2556,   1,  18,   5,    2,  -14 },   // 0xA6 ''
+  {  2559,   9,  19,  11,    1,  -14 },   // 0xA7 ''
+  {  2581,   6,   2,   7,    0,  -13 },   // 0xA8 ''
+  {  2583,  14,  14,  16,    1,  -13 },   // 0xA9 ''
+  {  2608,   6,   9,   7,    1,  -14 },   // 0xAA ''
+  {  2615,   7,   6,  10,    1,   -7 },   // 0xAB ''
+  {  2621,  10,   5,  11,    1,   -6 },   // 0xAC ''
+  {  2628,   5,   1,   7,    1,   -5 },   // 0xAD ''
+  {  2629,  14,  14,  16,    1,  -13 },   // 0xAE ''
+  {  2654,   5,   1,   7,    1,  -13 },   // 0xAF ''
+  {  2655,   6,   5,  12,    3,  -12 },   // 0xB0 ''
+  {  2659,   9,  12,  11,    1,  -11 },   // 0xB1 ''
+  {  2673,   6,   8,   7,    0,  -15 },   // 0xB2 ''
+  {  2679,   6,   9,   7,    0,  -15 },   // 0xB3 ''
+  {  2686,   4,   3,   7,    2,  -14 },   // 0xB4 ''
+  {  2688,  10,  15,  11,    1,  -10 },   // 0xB5 ''
+  {  2707,   9,  18,  11,    1,  -14 },   // 0xB6 ''
+  {  2728,   2,   2,   5,    2,   -5 },   // 0xB7 ''
+  {  2729,   5,   4,   7,    1,    1 },   // 0xB8 ''
+  {  2732,   4,   9,   7,    1,  -16 },   // 0xB9 ''
+  {  2737,   5,   9,   7,    1,  -14 },   // 0xBA ''
+  {  2743,   7,   7,  10,    1,   -8 },   // 0xBB ''
+  {  2750,  16,  14,  17,    1,  -13 },   // 0xBC ''
+  {  2778,  16,  15,  17,    1,  -14 },   // 0xBD ''
+  {  2808,  16,  15,  17,    0,  -14 },   // 0xBE ''
+  {  2838,   8,  14,  11,    2,   -9 },   // 0xBF ''
+  {  2852,  13,  18,  13,    0,  -17 },   // 0xC0 ''
+  {  2882,  13,  18,  13,    0,  -17 },   // 0xC1 ''
+  {  2912,  13,  18,  13,    0,  -17 },   // 0xC2 ''
+  {  2942,  13,  18,  13,    0,  -17 },   // 0xC3 ''
+  {  2972,  13,  18,  13,    0,  -17 },   // 0xC4 ''
+  {  3002,  13,  20,  13,    0,  -19 },   // 0xC5 ''
+  {  3035,  19,  15,  19,    0,  -14 },   // 0xC6 ''
+  {  3071,  12,  19,  14,    1,  -14 },   // 0xC7 ''
+  {  3100,  10,  18,  12,    2,  -17 },   // 0xC8 ''
+  {  3123,  10,  18,  12,    2,  -17 },   // 0xC9 ''
+  {  3146,  10,  18,  12,    2,  -17 },   // 0xCA ''
+  {  3169,  10,  18,  12,    2,  -17 },   // 0xCB ''
+  {  3192,   4,  18,   5,    0,  -17 },   // 0xCC ''
+  {  3201,   4,  18,   5,    1,  -17 },   // 0xCD ''
+  {  3210,   6,  18,   6,    0,  -17 },   // 0xCE ''
+  {  3224,   6,  18,   6,    0,  -17 },   // 0xCF ''
+  {  3238,  13,  15,  14,    0,  -14 },   // 0xD0 ''
+  {  3263,  11,  18,  14,    2,  -17 },   // 0xD1 ''
+  {  3288,  14,  18,  15,    1,  -17 },   // 0xD2 ''
+  {  3320,  14,  18,  15,    1,  -17 },   // 0xD3 ''
+  {  3352,  14,  18,  15,    1,  -17 },   // 0xD4 ''
+  {  3384,  14,  18,  15,    1,  -17 },   // 0xD5 ''
+  {  3416,  14,  18,  15,    1,  -17 },   // 0xD6 ''
+  {  3448,   8,   7,  11,    2,   -7 },   // 0xD7 ''
+  {  3455,  14,  15,  15,    1,  -14 },   // 0xD8 ''
+  {  3482,  11,  18,  14,    2,  -17 },   // 0xD9 ''
+  {  3507,  11,  18,  14,    2,  -17 },   // 0xDA ''
+  {  3532,  11,  18,  14,    2,  -17 },   // 0xDB ''
+  {  3557,  11,  18,  14,    2,  -17 },   // 0xDC ''
+  {  3582,  13,  18,  13,    0,  -17 },   // 0xDD ''
+  {  3612,  10,  15,  13,    2,  -14 },   // 0xDE ''
+  {  3631,   9,  14,  12,    2,  -13 },   // 0xDF ''
+  {  3647,   9,  15,  11,    1,  -14 },   // 0xE0 ''
+  {  3664,   9,  15,  11,    1,  -14 },   // 0xE1 ''
+  {  3681,   9,  15,  11,    1,  -14 },   // 0xE2 ''
+  {  3698,   9,  14,  11,    1,  -13 },   // 0xE3 ''
+  {  3714,   9,  15,  11,    1,  -14 },   // 0xE4 ''
+  {  3731,   9,  15,  11,    1,  -14 },   // 0xE5 ''
+  {  3748,  15,  11,  17,    1,  -10 },   // 0xE6 ''
+  {  3769,   8,  15,  10,    1,  -10 },   // 0xE7 ''
+  {  3784,   9,  15,  10,    1,  -14 },   // 0xE8 ''
+  {  3801,   9,  15,  10,    1,  -14 },   // 0xE9 ''
+  {  3818,   9,  15,  10,    1,  -14 },   // 0xEA ''
+  {  3835,   9,  15,  10,    1,  -14 },   // 0xEB ''
+  {  3852,   4,  15,   4,    0,  -14 },   // 0xEC ''
+  {  3860,   4,  15,   4,    0,  -14 },   // 0xED ''
+  {  3868,   5,  15,   5,    0,  -14 },   // 0xEE ''
+  {  3878,   5,  15,   5,    0,  -14 },   // 0xEF ''
+  {  3888,   9,  15,  10,    1,  -14 },   // 0xF0 ''
+  {  3905,   8,  14,  11,    1,  -13 },   // 0xF1 ''
+  {  3919,   9,  15,  10,    1,  -14 },   // 0xF2 ''
+  {  3936,   9,  15,  10,    1,  -14 },   // 0xF3 ''
+  {  3953,   9,  15,  10,    1,  -14 },   // 0xF4 ''
+  {  3970,   9,  14,  10,    1,  -13 },   // 0xF5 ''
+  {  3986,   9,  15,  10,    1,  -14 },   // 0xF6 ''
+  {  4003,   9,   9,  11,    1,   -8 },   // 0xF7 ''
+  {  4014,  10,  11,  10,    0,  -10 },   // 0xF8 ''
+  {  4028,   8,  15,  11,    1,  -14 },   // 0xF9 ''
+  {  4043,   8,  15,  11,    1,  -14 },   // 0xFA ''
+  {  4058,   8,  15,  11,    1,  -14 },   // 0xFB ''
+  {  4073,   8,  15,  11,    1,  -14 },   // 0xFC ''
+  {  4088,   9,  19,   9,    0,  -14 },   // 0xFD ''
+  {  4110,   9,  18,  11,    1,  -13 },   // 0xFE ''
+  {  4131,   9,  19,   9,    0,  -14 } }; // 0xFF ''
+
+constexpr GFXfont FreeSans_RLE_10pt8b PROGMEM = {
+  (uint8_t  *)FreeSans_RLE_10pt8bBitmaps,
+  (GFXglyph *)FreeSans_RLE_10pt8bGlyphs,
+  0x20, 0xFF, 24 };
+
+// Approx. 5728 bytes
@@ -0,0 +1,641 @@
+const uint8_t FreeSans_RLE_11pt8bBitmaps[] PROGMEM = {
+  0x00, 0xFF, 0xF3, 0xDE, 0xF7, 0x98, 0x80, 0x0C, 0x40, 0xCC, 0x0C, 0xC0,
+  0x8C, 0x7F, 0xF1, 0x88, 0x18, 0x81, 0x98, 0x19, 0x81, 0x18, 0xFF, 0xE3,
+  0x10, 0x33, 0x03, 0x30, 0x23, 0x00, 0x0C, 0x0F, 0x87, 0xFB, 0x36, 0xCC,
+  0xF3, 0x0C, 0xC1, 0xF0, 0x3E, 0x03, 0xE0, 0xDC, 0x33, 0x8C, 0xF3, 0x3C,
+  0xCD, 0xFE, 0x3F, 0x03, 0x00, 0xC0, 0x00, 0x08, 0x1F, 0x06, 0x0C, 0x61,
+  0x02, 0x18, 0xC0, 0x86, 0x20, 0x31, 0x90, 0x07, 0xCC, 0x00, 0x42, 0x00,
+  0x01, 0x8F, 0x00, 0x47, 0xE0, 0x33, 0x08, 0x08, 0xC2, 0x04, 0x30, 0x83,
+  0x07, 0xE0, 0x80, 0xF0, 0x0E, 0x01, 0xFC, 0x0C, 0x60, 0x63, 0x03, 0x18,
+  0x0D, 0x80, 0x78, 0x07, 0x80, 0x66, 0x26, 0x1B, 0x30, 0x79, 0x83, 0x8E,
+  0x0E, 0x3F, 0xB0, 0xF8, 0xC0, 0xFF, 0x40, 0x12, 0x26, 0x4C, 0xCC, 0x88,
+  0x88, 0x8C, 0xC4, 0x46, 0x21, 0x82, 0x18, 0x42, 0x18, 0xC2, 0x10, 0x86,
+  0x21, 0x18, 0xC6, 0x23, 0x11, 0x80, 0x30, 0x4F, 0xCC, 0x79, 0x20, 0x04,
+  0x00, 0x80, 0x10, 0x02, 0x0F, 0xFF, 0xFF, 0xC1, 0x00, 0x20, 0x04, 0x00,
+  0x80, 0xF5, 0x80, 0xFF, 0xC0, 0xF0, 0x04, 0x30, 0x82, 0x18, 0x41, 0x04,
+  0x20, 0x82, 0x10, 0x41, 0x08, 0x20, 0x1E, 0x0F, 0xC6, 0x1B, 0x06, 0xC0,
+  0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x06, 0x61, 0x8F, 0xC1,
+  0xE0, 0x08, 0x47, 0xF0, 0x84, 0x21, 0x08, 0x42, 0x10, 0x84, 0x20, 0x1F,
+  0x1F, 0xE6, 0x1F, 0x03, 0xC0, 0xC0, 0x30, 0x18, 0x0E, 0x0E, 0x0F, 0x07,
+  0x01, 0x80, 0xC0, 0x3F, 0xFF, 0xFC, 0x3E, 0x1F, 0xEE, 0x1B, 0x06, 0xC1,
+  0x80, 0x60, 0xF0, 0x3C, 0x01, 0x80, 0x3C, 0x0F, 0x03, 0xC1, 0x9F, 0xE3,
+  0xE0, 0x03, 0x01, 0xC0, 0x70, 0x3C, 0x1B, 0x04, 0xC3, 0x31, 0x8C, 0xC3,
+  0x30, 0xCF, 0xFF, 0xFF, 0x03, 0x00, 0xC0, 0x30, 0x7F, 0x9F, 0xE6, 0x01,
+  0x80, 0x40, 0x17, 0x8F, 0xFB, 0x07, 0x00, 0xC0, 0x30, 0x0F, 0x03, 0xC1,
+  0x9F, 0xE3, 0xE0, 0x1F, 0x0F, 0xE6, 0x19, 0x83, 0xC0, 0x33, 0x8F, 0xFB,
+  0x86, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0x61, 0x9F, 0xE1, 0xE0, 0xFF, 0xFF,
+  0xF0, 0x0C, 0x06, 0x03, 0x00, 0xC0, 0x60, 0x10, 0x0C, 0x03, 0x01, 0x80,
+  0x60, 0x18, 0x0C, 0x03, 0x00, 0x1E, 0x1F, 0xE6, 0x1B, 0x02, 0xC1, 0x98,
+  0x63, 0xF1, 0xFE, 0xE1, 0xF0, 0x3C, 0x0F, 0x03, 0xE1, 0xDF, 0xE3, 0xE0,
+  0x1E, 0x1F, 0xCE, 0x1B, 0x02, 0xC0, 0xF0, 0x3C, 0x0F, 0x87, 0x7F, 0xC7,
+  0x30, 0x0F, 0x06, 0xE1, 0x9F, 0xC3, 0xE0, 0xF0, 0x00, 0x0F, 0xF0, 0x00,
+  0x0F, 0x58, 0x00, 0xE0, 0x78, 0x3C, 0x3C, 0x0E, 0x01, 0xE0, 0x0F, 0x00,
+  0x3C, 0x01, 0xE0, 0x0C, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
+  0xC0, 0xC0, 0x0F, 0x00, 0x78, 0x03, 0xC0, 0x0E, 0x03, 0xC1, 0xC1, 0xE0,
+  0xF0, 0x10, 0x00, 0x3E, 0x3F, 0xB0, 0xF8, 0x3C, 0x18, 0x0C, 0x0C, 0x0C,
+  0x0C, 0x0C, 0x06, 0x03, 0x00, 0x00, 0x00, 0x60, 0x30, 0x01, 0xF8, 0x00,
+  0xFF, 0xE0, 0x70, 0x0E, 0x1C, 0x00, 0xE3, 0x00, 0x0E, 0xC3, 0xEC, 0xF0,
+  0xE7, 0x9E, 0x18, 0x61, 0xC6, 0x0C, 0x38, 0xC1, 0x8F, 0x18, 0x21, 0xE3,
+  0x0C, 0x7C, 0x63, 0x9D, 0xC7, 0xFF, 0x18, 0x00, 0x01, 0x80, 0x00, 0x1C,
+  0x00, 0x01, 0xFF, 0x80, 0x0F, 0xE0, 0x00, 0x03, 0x80, 0x1E, 0x00, 0x78,
+  0x01, 0xB0, 0x0C, 0xC0, 0x33, 0x00, 0xC6, 0x06, 0x18, 0x18, 0x60, 0x7F,
+  0xC3, 0xFF, 0x0C, 0x0C, 0x30, 0x19, 0x80, 0x66, 0x01, 0xB8, 0x03, 0xFF,
+  0x9F, 0xFB, 0x03, 0x60, 0x3C, 0x07, 0x80, 0xF0, 0x37, 0xFC, 0xFF, 0xD8,
+  0x0F, 0x01, 0xE0, 0x3C, 0x07, 0x80, 0xFF, 0xF7, 0xFC, 0x0F, 0xC1, 0xFF,
+  0x0C, 0x0C, 0xC0, 0x7E, 0x01, 0xE0, 0x03, 0x00, 0x18, 0x00, 0xC0, 0x06,
+  0x00, 0x30, 0x07, 0xC0, 0x36, 0x03, 0xB8, 0x18, 0xFF, 0x81, 0xF8, 0xFF,
+  0x0F, 0xFC, 0xC0, 0xEC, 0x06, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0,
+  0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x6C, 0x0E, 0xFF, 0xCF, 0xF0, 0xFF,
+  0xFF, 0xFF, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x07, 0xFE, 0xFF, 0xD8,
+  0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
+  0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0xFE, 0xFF, 0xB0, 0x0C, 0x03, 0x00,
+  0xC0, 0x30, 0x0C, 0x03, 0x00, 0x0F, 0xC0, 0x7F, 0xC3, 0x83, 0x98, 0x07,
+  0xE0, 0x0F, 0x00, 0x0C, 0x00, 0x30, 0x3F, 0xC0, 0xFF, 0x00, 0x3C, 0x00,
+  0xD8, 0x03, 0x60, 0x1C, 0xE0, 0xF1, 0xFF, 0x43, 0xF1, 0xC0, 0x3C, 0x03,
+  0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3F, 0xFF, 0xFF, 0xFC, 0x03,
+  0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x01, 0x80, 0xC0, 0x60, 0x30, 0x18, 0x0C, 0x06, 0x03, 0x01, 0x80,
+  0xC0, 0x78, 0x3C, 0x36, 0x19, 0xFC, 0x78, 0xC0, 0x7C, 0x0E, 0xC1, 0xCC,
+  0x38, 0xC7, 0x0C, 0xE0, 0xDC, 0x0F, 0xC0, 0xF6, 0x0E, 0x70, 0xC3, 0x0C,
+  0x18, 0xC1, 0xCC, 0x0C, 0xC0, 0x6C, 0x07, 0xC0, 0x60, 0x30, 0x18, 0x0C,
+  0x06, 0x03, 0x01, 0x80, 0xC0, 0x60, 0x30, 0x18, 0x0C, 0x06, 0x03, 0xFF,
+  0xFF, 0xE0, 0x0F, 0xC0, 0x3F, 0x80, 0x7F, 0x80, 0xBF, 0x03, 0x7A, 0x06,
+  0xF6, 0x09, 0xEC, 0x33, 0xC8, 0x67, 0x98, 0x8F, 0x33, 0x1E, 0x26, 0x3C,
+  0x68, 0x78, 0xF0, 0xF0, 0xE1, 0xE1, 0x83, 0xC0, 0x3E, 0x03, 0xE0, 0x3F,
+  0x03, 0xD8, 0x3D, 0x83, 0xCC, 0x3C, 0xE3, 0xC6, 0x3C, 0x33, 0xC3, 0x3C,
+  0x1B, 0xC0, 0xFC, 0x0F, 0xC0, 0x7C, 0x07, 0x07, 0xC0, 0x3F, 0xE0, 0xE0,
+  0xE3, 0x00, 0xE6, 0x00, 0xD8, 0x00, 0xF0, 0x01, 0xE0, 0x03, 0xC0, 0x07,
+  0x80, 0x0F, 0x00, 0x1B, 0x00, 0x66, 0x00, 0xC7, 0x07, 0x07, 0xFC, 0x03,
+  0xE0, 0xFF, 0x9F, 0xFB, 0x03, 0xE0, 0x3C, 0x07, 0x80, 0xF0, 0x3F, 0xFE,
+  0xFF, 0x98, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0x07,
+  0xC0, 0x3F, 0xE0, 0xE0, 0xE3, 0x00, 0xE6, 0x00, 0xD8, 0x00, 0xF0, 0x01,
+  0xE0, 0x03, 0xC0, 0x07, 0x80, 0x0F, 0x00, 0x1B, 0x02, 0x66, 0x06, 0xC7,
+  0x07, 0x07, 0xFF, 0x03, 0xE7, 0x00, 0x04, 0xFF, 0xCF, 0xFE, 0xC0, 0x6C,
+  0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x6F, 0xFC, 0xFF, 0xCC, 0x06, 0xC0, 0x6C,
+  0x06, 0xC0, 0x6C, 0x06, 0xC0, 0x3C, 0x03, 0x1F, 0x83, 0xFE, 0x60, 0x66,
+  0x03, 0xE0, 0x36, 0x00, 0x78, 0x03, 0xF8, 0x07, 0xE0, 0x07, 0x00, 0x3C,
+  0x03, 0xC0, 0x36, 0x07, 0x3F, 0xE1, 0xF8, 0xFF, 0xFF, 0xFF, 0x06, 0x00,
+  0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00,
+  0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0xC0, 0x3C, 0x03, 0xC0, 0x3C,
+  0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C,
+  0x03, 0xC0, 0x7E, 0x0E, 0x7F, 0xC1, 0xF8, 0xE0, 0x19, 0x80, 0x66, 0x01,
+  0x8C, 0x0C, 0x30, 0x30, 0xC0, 0xC1, 0x86, 0x06, 0x18, 0x18, 0x60, 0x33,
+  0x00, 0xCC, 0x03, 0x30, 0x07, 0x80, 0x1E, 0x00, 0x78, 0x00, 0xC0, 0xE0,
+  0x60, 0x76, 0x07, 0x06, 0x60, 0xF0, 0x66, 0x0F, 0x06, 0x70, 0xF0, 0x63,
+  0x09, 0x8C, 0x31, 0x98, 0xC3, 0x19, 0x8C, 0x31, 0x88, 0xC1, 0xB0, 0xC8,
+  0x1B, 0x0D, 0x81, 0xB0, 0xD8, 0x1A, 0x07, 0x80, 0xE0, 0x70, 0x0E, 0x07,
+  0x00, 0xE0, 0x30, 0x60, 0x18, 0xC0, 0xE3, 0x83, 0x06, 0x18, 0x0C, 0xE0,
+  0x3B, 0x00, 0x78, 0x00, 0xC0, 0x07, 0x80, 0x1E, 0x00, 0xCC, 0x07, 0x38,
+  0x18, 0x60, 0xC0, 0xC7, 0x03, 0x98, 0x06, 0x60, 0x0D, 0xC0, 0x63, 0x03,
+  0x8E, 0x0C, 0x18, 0x70, 0x31, 0x80, 0xEC, 0x01, 0xB0, 0x03, 0x80, 0x0E,
+  0x00, 0x30, 0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0xFF,
+  0xFF, 0xFF, 0x00, 0x60, 0x0C, 0x01, 0xC0, 0x38, 0x03, 0x00, 0x60, 0x0C,
+  0x01, 0xC0, 0x38, 0x03, 0x00, 0x60, 0x0E, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCF, 0xF0, 0x82, 0x04,
+  0x10, 0x40, 0x82, 0x08, 0x10, 0x41, 0x06, 0x08, 0x20, 0xC1, 0xFF, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1F, 0xF0, 0x18, 0x18, 0x3C,
+  0x24, 0x66, 0x62, 0x42, 0xC3, 0xFF, 0xF0, 0x61, 0x86, 0x3E, 0x1F, 0xCC,
+  0x1B, 0x06, 0x01, 0x8F, 0xEF, 0x9B, 0x06, 0xC1, 0xB0, 0xEF, 0xFD, 0xF3,
+  0xC0, 0x30, 0x0C, 0x03, 0x00, 0xDF, 0x3F, 0xEE, 0x1F, 0x83, 0xC0, 0xF0,
+  0x3C, 0x07, 0x03, 0xE0, 0xF8, 0x7F, 0xFB, 0x7C, 0x3E, 0x3F, 0xB8, 0x78,
+  0x3C, 0x06, 0x03, 0x01, 0x80, 0xC1, 0xF0, 0xDF, 0xC7, 0xC0, 0x00, 0xC0,
+  0x30, 0x0C, 0x03, 0x3E, 0xDF, 0xFE, 0x1F, 0x07, 0xC0, 0xF0, 0x3C, 0x0F,
+  0x03, 0xC1, 0xF8, 0x77, 0xFC, 0xFB, 0x00, 0x00, 0x1E, 0x1F, 0xCE, 0x1B,
+  0x02, 0xC0, 0xFF, 0xFC, 0x03, 0x00, 0xC0, 0xF8, 0x67, 0xF0, 0xF8, 0x1C,
+  0xF3, 0x0C, 0xFC, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x3C,
+  0xDF, 0xFE, 0x1F, 0x07, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC1, 0xF8, 0x77,
+  0xEC, 0xF2, 0x00, 0xB0, 0x67, 0xF0, 0xF8, 0xC0, 0x60, 0x30, 0x18, 0x0C,
+  0xF7, 0xFF, 0x87, 0x83, 0xC1, 0xE0, 0xF0, 0x78, 0x3C, 0x1E, 0x0F, 0x07,
+  0x83, 0xF0, 0xFF, 0xFF, 0xFF, 0x33, 0x00, 0x33, 0x33, 0x33, 0x33, 0x33,
+  0x33, 0x33, 0x3E, 0x80, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC3, 0xB1, 0xCC,
+  0x63, 0x30, 0xD8, 0x3F, 0x0E, 0xE3, 0x18, 0xC3, 0x30, 0xCC, 0x1B, 0x07,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0x3D, 0xFE, 0xFF, 0x86, 0x1E, 0x0C, 0x3C,
+  0x18, 0x78, 0x30, 0xF0, 0x61, 0xE0, 0xC3, 0xC1, 0x87, 0x83, 0x0F, 0x06,
+  0x1E, 0x0C, 0x30, 0xDF, 0x7F, 0xF8, 0x78, 0x3C, 0x1E, 0x0F, 0x07, 0x83,
+  0xC1, 0xE0, 0xF0, 0x78, 0x30, 0x3E, 0x1F, 0xCE, 0x1B, 0x02, 0xC0, 0xF0,
+  0x3C, 0x0F, 0x03, 0xC0, 0xF8, 0x67, 0xF0, 0xF8, 0xDF, 0x3F, 0xEE, 0x1F,
+  0x83, 0xC0, 0xF0, 0x3C, 0x07, 0x03, 0xE0, 0xF8, 0x7F, 0xFB, 0x7C, 0xC0,
+  0x30, 0x0C, 0x03, 0x00, 0x3E, 0xDF, 0xFE, 0x1F, 0x07, 0xC0, 0xF0, 0x3C,
+  0x0F, 0x03, 0xC1, 0xF8, 0x77, 0xFC, 0xFB, 0x00, 0xC0, 0x30, 0x0C, 0x03,
+  0xCF, 0x7E, 0x38, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0x3E, 0x3F, 0xB0,
+  0xD8, 0x0E, 0x03, 0xE0, 0x7C, 0x07, 0xC1, 0xE0, 0xFF, 0xC7, 0xC0, 0x30,
+  0xC3, 0x3F, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xF3, 0xC0, 0xC1,
+  0xE0, 0xF0, 0x78, 0x3C, 0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xE0, 0xDF, 0xE7,
+  0xD0, 0x00, 0xC0, 0xD8, 0x36, 0x0D, 0x86, 0x31, 0x8C, 0x43, 0x30, 0x6C,
+  0x1A, 0x07, 0x80, 0xE0, 0x30, 0xC1, 0x86, 0xC7, 0x0D, 0x8E, 0x1B, 0x16,
+  0x66, 0x2C, 0xC6, 0xD9, 0x8D, 0x93, 0x1B, 0x34, 0x14, 0x78, 0x38, 0xF0,
+  0x70, 0xC0, 0xE1, 0x80, 0x60, 0xD8, 0x63, 0x30, 0x6C, 0x1E, 0x03, 0x00,
+  0xE0, 0x78, 0x33, 0x0C, 0xC6, 0x19, 0x83, 0xC0, 0xD8, 0x36, 0x19, 0x86,
+  0x31, 0x8C, 0xC3, 0x30, 0x48, 0x1E, 0x07, 0x80, 0xC0, 0x30, 0x0C, 0x06,
+  0x01, 0x81, 0xE0, 0x60, 0x00, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xE0,
+  0x60, 0x60, 0x60, 0x70, 0x3F, 0xFF, 0xF0, 0x39, 0x88, 0x42, 0x10, 0x84,
+  0x67, 0x30, 0xC6, 0x10, 0x84, 0x21, 0x08, 0x70, 0xFF, 0xFF, 0xF0, 0xE3,
+  0x0C, 0x63, 0x18, 0xC6, 0x30, 0xC6, 0x63, 0x18, 0xC6, 0x31, 0x8D, 0xC0,
+  0xF0, 0xCE, 0xC1, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0E, 0x3E, 0x1C,
+  0xFE, 0x3B, 0x06, 0x76, 0x0C, 0xEC, 0x19, 0xC0, 0x33, 0x80, 0xC7, 0x03,
+  0x0E, 0x0C, 0x1C, 0x18, 0x38, 0x20, 0x70, 0x00, 0xE0, 0x01, 0xC1, 0x03,
+  0x82, 0x07, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x00, 0x0E, 0x3E, 0x1C, 0xFE, 0x3B, 0x06, 0x76, 0x0C, 0xEC, 0x19, 0xC0,
+  0x33, 0x80, 0xC7, 0x03, 0x0E, 0x0C, 0x1C, 0x18, 0x38, 0x20, 0x70, 0x00,
+  0xE0, 0x01, 0xC1, 0x03, 0x82, 0x07, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0E, 0x3E, 0x1C, 0xFE, 0x3B, 0x06, 0x76,
+  0x0C, 0xEC, 0x19, 0xC0, 0x33, 0x80, 0xC7, 0x03, 0x0E, 0x0C, 0x1C, 0x18,
+  0x38, 0x20, 0x70, 0x00, 0xE0, 0x01, 0xC1, 0x03, 0x82, 0x07, 0x00, 0x0F,
+  0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0E, 0x3E, 0x1C,
+  0xFE, 0x3B, 0x06, 0x76, 0x0C, 0xEC, 0x19, 0xC0, 0x33, 0x80, 0xC7, 0x03,
+  0x0E, 0x0C, 0x1C, 0x18, 0x38, 0x20, 0x70, 0x00, 0xE0, 0x01, 0xC1, 0x03,
+  0x82, 0x07, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x00, 0x0E, 0x3E, 0x1C, 0xFE, 0x3B, 0x06, 0x76, 0x0C, 0xEC, 0x19, 0xC0,
+  0x33, 0x80, 0xC7, 0x03, 0x0E, 0x0C, 0x1C, 0x18, 0x38, 0x20, 0x70, 0x00,
+  0xE0, 0x01, 0xC1, 0x03, 0x82, 0x07, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0E, 0x3E, 0x1C, 0xFE, 0x3B, 0x06, 0x76,
+  0x0C, 0xEC, 0x19, 0xC0, 0x33, 0x80, 0xC7, 0x03, 0x0E, 0x0C, 0x1C, 0x18,
+  0x38, 0x20, 0x70, 0x00, 0xE0, 0x01, 0xC1, 0x03, 0x82, 0x07, 0x00, 0x0F,
+  0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0E, 0x3E, 0x1C,
+  0xFE, 0x3B, 0x06, 0x76, 0x0C, 0xEC, 0x19, 0xC0, 0x33, 0x80, 0xC7, 0x03,
+  0x0E, 0x0C, 0x1C, 0x18, 0x38, 0x20, 0x70, 0x00, 0xE0, 0x01, 0xC1, 0x03,
+  0x82, 0x07, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x00, 0x0E, 0x3E, 0x1C, 0xFE, 0x3B, 0x06, 0x76, 0x0C, 0xEC, 0x19, 0xC0,
+  0x33, 0x80, 0xC7, 0x03, 0x0E, 0x0C, 0x1C, 0x18, 0x38, 0x20, 0x70, 0x00,
+  0xE0, 0x01, 0xC1, 0x03, 0x82, 0x07, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0E, 0x3E, 0x1C, 0xFE, 0x3B, 0x06, 0x76,
+  0x0C, 0xEC, 0x19, 0xC0, 0x33, 0x80, 0xC7, 0x03, 0x0E, 0x0C, 0x1C, 0x18,
+  0x38, 0x20, 0x70, 0x00, 0xE0, 0x01, 0xC1, 0x03, 0x82, 0x07, 0x00, 0x0F,
+  0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0E, 0x3E, 0x1C,
+  0xFE, 0x3B, 0x06, 0x76, 0x0C, 0xEC, 0x19, 0xC0, 0x33, 0x80, 0xC7, 0x03,
+  0x0E, 0x0C, 0x1C, 0x18, 0x38, 0x20, 0x70, 0x00, 0xE0, 0x01, 0xC1, 0x03,
+  0x82, 0x07, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x00, 0x0E, 0x3E, 0x1C, 0xFE, 0x3B, 0x06, 0x76, 0x0C, 0xEC, 0x19, 0xC0,
+  0x33, 0x80, 0xC7, 0x03, 0x0E, 0x0C, 0x1C, 0x18, 0x38, 0x20, 0x70, 0x00,
+  0xE0, 0x01, 0xC1, 0x03, 0x82, 0x07, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0E, 0x3E, 0x1C, 0xFE, 0x3B, 0x06, 0x76,
+  0x0C, 0xEC, 0x19, 0xC0, 0x33, 0x80, 0xC7, 0x03, 0x0E, 0x0C, 0x1C, 0x18,
+  0x38, 0x20, 0x70, 0x00, 0xE0, 0x01, 0xC1, 0x03, 0x82, 0x07, 0x00, 0x0F,
+  0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0E, 0x3E, 0x1C,
+  0xFE, 0x3B, 0x06, 0x76, 0x0C, 0xEC, 0x19, 0xC0, 0x33, 0x80, 0xC7, 0x03,
+  0x0E, 0x0C, 0x1C, 0x18, 0x38, 0x20, 0x70, 0x00, 0xE0, 0x01, 0xC1, 0x03,
+  0x82, 0x07, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x00, 0x0E, 0x3E, 0x1C, 0xFE, 0x3B, 0x06, 0x76, 0x0C, 0xEC, 0x19, 0xC0,
+  0x33, 0x80, 0xC7, 0x03, 0x0E, 0x0C, 0x1C, 0x18, 0x38, 0x20, 0x70, 0x00,
+  0xE0, 0x01, 0xC1, 0x03, 0x82, 0x07, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0E, 0x3E, 0x1C, 0xFE, 0x3B, 0x06, 0x76,
+  0x0C, 0xEC, 0x19, 0xC0, 0x33, 0x80, 0xC7, 0x03, 0x0E, 0x0C, 0x1C, 0x18,
+  0x38, 0x20, 0x70, 0x00, 0xE0, 0x01, 0xC1, 0x03, 0x82, 0x07, 0x00, 0x0F,
+  0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0E, 0x3E, 0x1C,
+  0xFE, 0x3B, 0x06, 0x76, 0x0C, 0xEC, 0x19, 0xC0, 0x33, 0x80, 0xC7, 0x03,
+  0x0E, 0x0C, 0x1C, 0x18, 0x38, 0x20, 0x70, 0x00, 0xE0, 0x01, 0xC1, 0x03,
+  0x82, 0x07, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x00, 0x0E, 0x3E, 0x1C, 0xFE, 0x3B, 0x06, 0x76, 0x0C, 0xEC, 0x19, 0xC0,
+  0x33, 0x80, 0xC7, 0x03, 0x0E, 0x0C, 0x1C, 0x18, 0x38, 0x20, 0x70, 0x00,
+  0xE0, 0x01, 0xC1, 0x03, 0x82, 0x07, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0E, 0x3E, 0x1C, 0xFE, 0x3B, 0x06, 0x76,
+  0x0C, 0xEC, 0x19, 0xC0, 0x33, 0x80, 0xC7, 0x03, 0x0E, 0x0C, 0x1C, 0x18,
+  0x38, 0x20, 0x70, 0x00, 0xE0, 0x01, 0xC1, 0x03, 0x82, 0x07, 0x00, 0x0F,
+  0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0E, 0x3E, 0x1C,
+  0xFE, 0x3B, 0x06, 0x76, 0x0C, 0xEC, 0x19, 0xC0, 0x33, 0x80, 0xC7, 0x03,
+  0x0E, 0x0C, 0x1C, 0x18, 0x38, 0x20, 0x70, 0x00, 0xE0, 0x01, 0xC1, 0x03,
+  0x82, 0x07, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x00, 0x0E, 0x3E, 0x1C, 0xFE, 0x3B, 0x06, 0x76, 0x0C, 0xEC, 0x19, 0xC0,
+  0x33, 0x80, 0xC7, 0x03, 0x0E, 0x0C, 0x1C, 0x18, 0x38, 0x20, 0x70, 0x00,
+  0xE0, 0x01, 0xC1, 0x03, 0x82, 0x07, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0E, 0x3E, 0x1C, 0xFE, 0x3B, 0x06, 0x76,
+  0x0C, 0xEC, 0x19, 0xC0, 0x33, 0x80, 0xC7, 0x03, 0x0E, 0x0C, 0x1C, 0x18,
+  0x38, 0x20, 0x70, 0x00, 0xE0, 0x01, 0xC1, 0x03, 0x82, 0x07, 0x00, 0x0F,
+  0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0E, 0x3E, 0x1C,
+  0xFE, 0x3B, 0x06, 0x76, 0x0C, 0xEC, 0x19, 0xC0, 0x33, 0x80, 0xC7, 0x03,
+  0x0E, 0x0C, 0x1C, 0x18, 0x38, 0x20, 0x70, 0x00, 0xE0, 0x01, 0xC1, 0x03,
+  0x82, 0x07, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x00, 0x0E, 0x3E, 0x1C, 0xFE, 0x3B, 0x06, 0x76, 0x0C, 0xEC, 0x19, 0xC0,
+  0x33, 0x80, 0xC7, 0x03, 0x0E, 0x0C, 0x1C, 0x18, 0x38, 0x20, 0x70, 0x00,
+  0xE0, 0x01, 0xC1, 0x03, 0x82, 0x07, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0E, 0x3E, 0x1C, 0xFE, 0x3B, 0x06, 0x76,
+  0x0C, 0xEC, 0x19, 0xC0, 0x33, 0x80, 0xC7, 0x03, 0x0E, 0x0C, 0x1C, 0x18,
+  0x38, 0x20, 0x70, 0x00, 0xE0, 0x01, 0xC1, 0x03, 0x82, 0x07, 0x00, 0x0F,
+  0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0E, 0x3E, 0x1C,
+  0xFE, 0x3B, 0x06, 0x76, 0x0C, 0xEC, 0x19, 0xC0, 0x33, 0x80, 0xC7, 0x03,
+  0x0E, 0x0C, 0x1C, 0x18, 0x38, 0x20, 0x70, 0x00, 0xE0, 0x01, 0xC1, 0x03,
+  0x82, 0x07, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x00, 0x0E, 0x3E, 0x1C, 0xFE, 0x3B, 0x06, 0x76, 0x0C, 0xEC, 0x19, 0xC0,
+  0x33, 0x80, 0xC7, 0x03, 0x0E, 0x0C, 0x1C, 0x18, 0x38, 0x20, 0x70, 0x00,
+  0xE0, 0x01, 0xC1, 0x03, 0x82, 0x07, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0E, 0x3E, 0x1C, 0xFE, 0x3B, 0x06, 0x76,
+  0x0C, 0xEC, 0x19, 0xC0, 0x33, 0x80, 0xC7, 0x03, 0x0E, 0x0C, 0x1C, 0x18,
+  0x38, 0x20, 0x70, 0x00, 0xE0, 0x01, 0xC1, 0x03, 0x82, 0x07, 0x00, 0x0F,
+  0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0E, 0x3E, 0x1C,
+  0xFE, 0x3B, 0x06, 0x76, 0x0C, 0xEC, 0x19, 0xC0, 0x33, 0x80, 0xC7, 0x03,
+  0x0E, 0x0C, 0x1C, 0x18, 0x38, 0x20, 0x70, 0x00, 0xE0, 0x01, 0xC1, 0x03,
+  0x82, 0x07, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x00, 0x0E, 0x3E, 0x1C, 0xFE, 0x3B, 0x06, 0x76, 0x0C, 0xEC, 0x19, 0xC0,
+  0x33, 0x80, 0xC7, 0x03, 0x0E, 0x0C, 0x1C, 0x18, 0x38, 0x20, 0x70, 0x00,
+  0xE0, 0x01, 0xC1, 0x03, 0x82, 0x07, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0E, 0x3E, 0x1C, 0xFE, 0x3B, 0x06, 0x76,
+  0x0C, 0xEC, 0x19, 0xC0, 0x33, 0x80, 0xC7, 0x03, 0x0E, 0x0C, 0x1C, 0x18,
+  0x38, 0x20, 0x70, 0x00, 0xE0, 0x01, 0xC1, 0x03, 0x82, 0x07, 0x00, 0x0F,
+  0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0E, 0x3E, 0x1C,
+  0xFE, 0x3B, 0x06, 0x76, 0x0C, 0xEC, 0x19, 0xC0, 0x33, 0x80, 0xC7, 0x03,
+  0x0E, 0x0C, 0x1C, 0x18, 0x38, 0x20, 0x70, 0x00, 0xE0, 0x01, 0xC1, 0x03,
+  0x82, 0x07, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x00, 0x0E, 0x3E, 0x1C, 0xFE, 0x3B, 0x06, 0x76, 0x0C, 0xEC, 0x19, 0xC0,
+  0x33, 0x80, 0xC7, 0x03, 0x0E, 0x0C, 0x1C, 0x18, 0x38, 0x20, 0x70, 0x00,
+  0xE0, 0x01, 0xC1, 0x03, 0x82, 0x07, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0E, 0x3E, 0x1C, 0xFE, 0x3B, 0x06, 0x76,
+  0x0C, 0xEC, 0x19, 0xC0, 0x33, 0x80, 0xC7, 0x03, 0x0E, 0x0C, 0x1C, 0x18,
+  0x38, 0x20, 0x70, 0x00, 0xE0, 0x01, 0xC1, 0x03, 0x82, 0x07, 0x00, 0x0F,
+  0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xDF, 0xFE, 0x04, 0x01, 0x01, 0xF0, 0xFE,
+  0x65, 0xD1, 0x3C, 0x43, 0x10, 0xC4, 0x31, 0x0C, 0x4D, 0x97, 0x3F, 0x87,
+  0xC0, 0x40, 0x10, 0x1F, 0x0F, 0xF1, 0x87, 0x60, 0x6C, 0x0D, 0x80, 0x18,
+  0x03, 0x00, 0xFE, 0x06, 0x00, 0xC0, 0x18, 0x02, 0x00, 0xB8, 0xBF, 0xF4,
+  0x3E, 0x00, 0x3F, 0xE7, 0xF9, 0x86, 0x61, 0x98, 0x66, 0x31, 0xFE, 0x6C,
+  0x80, 0x40, 0x26, 0x06, 0x20, 0x43, 0x0C, 0x19, 0x81, 0x98, 0x0F, 0x00,
+  0xF0, 0x7F, 0xE0, 0x60, 0x7F, 0xE0, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00,
+  0xFF, 0x8F, 0xF0, 0x1E, 0x0F, 0xC6, 0x19, 0x86, 0x30, 0x0F, 0x06, 0xE3,
+  0x1C, 0xC1, 0xB0, 0x3E, 0x0D, 0xC3, 0x3C, 0x83, 0xE0, 0x70, 0x0C, 0x61,
+  0x98, 0x66, 0x30, 0xFC, 0x1C, 0x00, 0xDF, 0x70, 0x07, 0xC0, 0x38, 0x60,
+  0xC0, 0x63, 0x3E, 0x2C, 0xC6, 0x71, 0x04, 0x66, 0x00, 0xCC, 0x01, 0x98,
+  0x03, 0x90, 0x47, 0x31, 0x9B, 0x3E, 0x23, 0x01, 0x83, 0x8E, 0x01, 0xF0,
+  0x00, 0x7B, 0x20, 0x9E, 0x8A, 0x2F, 0xC0, 0xFC, 0x22, 0xCF, 0x34, 0x4C,
+  0xCC, 0xC8, 0x80, 0xFF, 0xFF, 0xFC, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC0,
+  0xFF, 0xC0, 0x07, 0xC0, 0x38, 0x60, 0xC0, 0x63, 0x7E, 0x2C, 0x82, 0x71,
+  0x04, 0x62, 0x08, 0xC7, 0xE1, 0x88, 0x63, 0x90, 0x47, 0x20, 0x9B, 0x41,
+  0x23, 0x01, 0x83, 0x8E, 0x01, 0xF0, 0x00, 0xFF, 0xF0, 0x38, 0xDB, 0x1C,
+  0x1C, 0x6D, 0x8E, 0x00, 0x04, 0x00, 0x80, 0x10, 0x02, 0x0F, 0xFF, 0xFF,
+  0xC1, 0x00, 0x20, 0x04, 0x00, 0x80, 0x00, 0x7F, 0xFF, 0xFE, 0x3C, 0x8D,
+  0x08, 0x31, 0xC6, 0x10, 0x7F, 0x3C, 0x89, 0x18, 0x21, 0x80, 0xC0, 0xE1,
+  0x46, 0x78, 0x36, 0xC0, 0xC0, 0x98, 0x13, 0x02, 0x60, 0x4C, 0x09, 0x81,
+  0x30, 0x26, 0x0C, 0xC1, 0x9C, 0x33, 0xFB, 0xFE, 0x7C, 0x01, 0x80, 0x30,
+  0x06, 0x00, 0x1F, 0xDF, 0x27, 0xCB, 0xF2, 0xFC, 0xBF, 0x2F, 0xC9, 0xF2,
+  0x7C, 0x8F, 0x20, 0xC8, 0x32, 0x0C, 0x83, 0x20, 0xC8, 0x32, 0x0C, 0x83,
+  0x20, 0xC8, 0x32, 0xF0, 0x21, 0xC7, 0x37, 0x00, 0x13, 0xF1, 0x11, 0x11,
+  0x10, 0x7B, 0x38, 0x61, 0x87, 0x37, 0x80, 0xFC, 0x89, 0x99, 0x9B, 0x1C,
+  0x71, 0x00, 0x00, 0x30, 0x04, 0x78, 0x04, 0x0C, 0x06, 0x06, 0x02, 0x03,
+  0x02, 0x01, 0x83, 0x00, 0xC1, 0x0C, 0x61, 0x06, 0x31, 0x87, 0x00, 0x85,
+  0x80, 0x86, 0xC0, 0x42, 0x60, 0x43, 0xF8, 0x60, 0x18, 0x20, 0x0C, 0x10,
+  0x00, 0x18, 0x04, 0x3C, 0x06, 0x06, 0x02, 0x03, 0x02, 0x01, 0x83, 0x00,
+  0xC1, 0x00, 0x61, 0x1E, 0x31, 0x99, 0x98, 0x88, 0x40, 0x80, 0x20, 0x40,
+  0x60, 0x40, 0xE0, 0x40, 0xC0, 0x20, 0x40, 0x20, 0x3F, 0x78, 0x00, 0x66,
+  0x06, 0x23, 0x02, 0x01, 0x82, 0x03, 0x81, 0x00, 0x61, 0x02, 0x11, 0x81,
+  0x18, 0x86, 0x78, 0x87, 0x00, 0xC7, 0x80, 0x42, 0xC0, 0x42, 0x60, 0x23,
+  0x30, 0x21, 0xFC, 0x30, 0x0C, 0x10, 0x06, 0x0C, 0x06, 0x00, 0x00, 0x00,
+  0xC0, 0x60, 0x70, 0x70, 0x70, 0x30, 0x30, 0x18, 0x3C, 0x1F, 0x0D, 0xFC,
+  0x38, 0x0E, 0x00, 0x0C, 0x00, 0x18, 0x00, 0x00, 0x03, 0x80, 0x1E, 0x00,
+  0x78, 0x01, 0xB0, 0x0C, 0xC0, 0x33, 0x00, 0xC6, 0x06, 0x18, 0x18, 0x60,
+  0x7F, 0xC3, 0xFF, 0x0C, 0x0C, 0x30, 0x19, 0x80, 0x66, 0x01, 0xB8, 0x03,
+  0x00, 0xC0, 0x06, 0x00, 0x30, 0x00, 0x00, 0x03, 0x80, 0x1E, 0x00, 0x78,
+  0x01, 0xB0, 0x0C, 0xC0, 0x33, 0x00, 0xC6, 0x06, 0x18, 0x18, 0x60, 0x7F,
+  0xC3, 0xFF, 0x0C, 0x0C, 0x30, 0x19, 0x80, 0x66, 0x01, 0xB8, 0x03, 0x03,
+  0x00, 0x1E, 0x00, 0xCC, 0x00, 0x00, 0x03, 0x80, 0x1E, 0x00, 0x78, 0x01,
+  0xB0, 0x0C, 0xC0, 0x33, 0x00, 0xC6, 0x06, 0x18, 0x18, 0x60, 0x7F, 0xC3,
+  0xFF, 0x0C, 0x0C, 0x30, 0x19, 0x80, 0x66, 0x01, 0xB8, 0x03, 0x0F, 0x40,
+  0x27, 0x00, 0x00, 0x00, 0xE0, 0x07, 0x80, 0x1E, 0x00, 0x6C, 0x03, 0x30,
+  0x0C, 0xC0, 0x31, 0x81, 0x86, 0x06, 0x18, 0x1F, 0xF0, 0xFF, 0xC3, 0x03,
+  0x0C, 0x06, 0x60, 0x19, 0x80, 0x6E, 0x00, 0xC0, 0x0E, 0xC0, 0x3B, 0x00,
+  0x00, 0x00, 0xE0, 0x07, 0x80, 0x1E, 0x00, 0x6C, 0x03, 0x30, 0x0C, 0xC0,
+  0x31, 0x81, 0x86, 0x06, 0x18, 0x1F, 0xF0, 0xFF, 0xC3, 0x03, 0x0C, 0x06,
+  0x60, 0x19, 0x80, 0x6E, 0x00, 0xC0, 0x03, 0x80, 0x1A, 0x00, 0x48, 0x01,
+  0xE0, 0x00, 0x00, 0x0E, 0x00, 0x78, 0x01, 0xE0, 0x06, 0xC0, 0x33, 0x00,
+  0xCC, 0x03, 0x18, 0x18, 0x60, 0x61, 0x81, 0xFF, 0x0F, 0xFC, 0x30, 0x30,
+  0xC0, 0x66, 0x01, 0x98, 0x06, 0xE0, 0x0C, 0x01, 0xFF, 0xF0, 0x1F, 0xFF,
+  0x80, 0xCC, 0x00, 0x0C, 0x60, 0x00, 0x63, 0x00, 0x03, 0x18, 0x00, 0x30,
+  0xFF, 0xC1, 0x87, 0xFE, 0x18, 0x30, 0x00, 0xFF, 0x80, 0x07, 0xFC, 0x00,
+  0x60, 0x60, 0x03, 0x03, 0x00, 0x30, 0x18, 0x01, 0x80, 0xFF, 0xEC, 0x07,
+  0xFF, 0x0F, 0xC1, 0xFF, 0x0C, 0x0C, 0xC0, 0x7E, 0x01, 0xE0, 0x03, 0x00,
+  0x18, 0x00, 0xC0, 0x06, 0x00, 0x30, 0x07, 0xC0, 0x36, 0x03, 0x98, 0x18,
+  0xFF, 0x81, 0xF8, 0x02, 0x00, 0x1C, 0x00, 0x60, 0x1E, 0x00, 0x18, 0x01,
+  0x80, 0x18, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x06, 0x00, 0xC0, 0x18, 0x03,
+  0x00, 0x7F, 0xEF, 0xFD, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03, 0xFF,
+  0xFF, 0xF0, 0x07, 0x01, 0xC0, 0x20, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x06,
+  0x00, 0xC0, 0x18, 0x03, 0x00, 0x7F, 0xEF, 0xFD, 0x80, 0x30, 0x06, 0x00,
+  0xC0, 0x18, 0x03, 0xFF, 0xFF, 0xF0, 0x0C, 0x03, 0xC0, 0xCC, 0x00, 0x0F,
+  0xFF, 0xFF, 0xF0, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x7F, 0xEF, 0xFD,
+  0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03, 0xFF, 0xFF, 0xF0, 0x33, 0x06,
+  0x60, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03,
+  0xFF, 0x7F, 0xEC, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x1F, 0xFF, 0xFF,
+  0x80, 0xE1, 0x86, 0x03, 0x18, 0xC6, 0x31, 0x8C, 0x63, 0x18, 0xC6, 0x31,
+  0x8C, 0x60, 0x3B, 0x30, 0x06, 0x31, 0x8C, 0x63, 0x18, 0xC6, 0x31, 0x8C,
+  0x63, 0x18, 0xC0, 0x31, 0xE4, 0xC0, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x0C,
+  0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0xCF, 0x30, 0x0C, 0x30, 0xC3, 0x0C,
+  0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x00, 0x3F, 0xE0, 0xFF,
+  0xC3, 0x03, 0x8C, 0x07, 0x30, 0x0C, 0xC0, 0x33, 0x00, 0xFF, 0xC3, 0x30,
+  0x0C, 0xC0, 0x33, 0x00, 0xCC, 0x03, 0x30, 0x18, 0xC0, 0xE3, 0xFF, 0x0F,
+  0xF8, 0x1F, 0x81, 0x78, 0x00, 0x0C, 0x03, 0xE0, 0x3E, 0x03, 0xF0, 0x3D,
+  0x83, 0xD8, 0x3C, 0xC3, 0xCE, 0x3C, 0x63, 0xC3, 0x3C, 0x33, 0xC1, 0xBC,
+  0x0F, 0xC0, 0xFC, 0x07, 0xC0, 0x70, 0x0E, 0x00, 0x06, 0x00, 0x06, 0x00,
+  0x00, 0x00, 0x7C, 0x03, 0xFE, 0x0E, 0x0E, 0x30, 0x0E, 0x60, 0x0D, 0x80,
+  0x0F, 0x00, 0x1E, 0x00, 0x3C, 0x00, 0x78, 0x00, 0xF0, 0x01, 0xB0, 0x06,
+  0x60, 0x0C, 0x70, 0x70, 0x7F, 0xC0, 0x3E, 0x00, 0x00, 0xE0, 0x03, 0x00,
+  0x0C, 0x00, 0x00, 0x00, 0x7C, 0x03, 0xFE, 0x0E, 0x0E, 0x30, 0x0E, 0x60,
+  0x0D, 0x80, 0x0F, 0x00, 0x1E, 0x00, 0x3C, 0x00, 0x78, 0x00, 0xF0, 0x01,
+  0xB0, 0x06, 0x60, 0x0C, 0x70, 0x70, 0x7F, 0xC0, 0x3E, 0x00, 0x03, 0x80,
+  0x07, 0x00, 0x11, 0x00, 0x00, 0x00, 0x7C, 0x03, 0xFE, 0x0E, 0x0E, 0x30,
+  0x0E, 0x60, 0x0D, 0x80, 0x0F, 0x00, 0x1E, 0x00, 0x3C, 0x00, 0x78, 0x00,
+  0xF0, 0x01, 0xB0, 0x06, 0x60, 0x0C, 0x70, 0x70, 0x7F, 0xC0, 0x3E, 0x00,
+  0x07, 0x60, 0x1B, 0x80, 0x00, 0x00, 0x3E, 0x01, 0xFF, 0x07, 0x07, 0x18,
+  0x07, 0x30, 0x06, 0xC0, 0x07, 0x80, 0x0F, 0x00, 0x1E, 0x00, 0x3C, 0x00,
+  0x78, 0x00, 0xD8, 0x03, 0x30, 0x06, 0x38, 0x38, 0x3F, 0xE0, 0x1F, 0x00,
+  0x0E, 0xE0, 0x1D, 0xC0, 0x00, 0x00, 0x3E, 0x01, 0xFF, 0x07, 0x07, 0x18,
+  0x07, 0x30, 0x06, 0xC0, 0x07, 0x80, 0x0F, 0x00, 0x1E, 0x00, 0x3C, 0x00,
+  0x78, 0x00, 0xD8, 0x03, 0x30, 0x06, 0x38, 0x38, 0x3F, 0xE0, 0x1F, 0x00,
+  0xC1, 0x31, 0x8D, 0x83, 0x81, 0xC1, 0xB1, 0x8D, 0x82, 0x07, 0xC2, 0x3F,
+  0xE8, 0xE0, 0xE3, 0x00, 0xE6, 0x02, 0xD8, 0x08, 0xF0, 0x21, 0xE0, 0x83,
+  0xC3, 0x07, 0x8C, 0x0F, 0x30, 0x1B, 0xC0, 0x67, 0x00, 0xCF, 0x07, 0x37,
+  0xFC, 0x43, 0xE0, 0x1C, 0x00, 0xC0, 0x02, 0x00, 0x00, 0xC0, 0x3C, 0x03,
+  0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03,
+  0xC0, 0x3C, 0x03, 0xC0, 0x7E, 0x0E, 0x7F, 0xC1, 0xF8, 0x03, 0x80, 0x60,
+  0x0C, 0x00, 0x00, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03,
+  0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x7E, 0x0E,
+  0x7F, 0xC1, 0xF8, 0x06, 0x00, 0xF0, 0x19, 0x80, 0x00, 0xC0, 0x3C, 0x03,
+  0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03,
+  0xC0, 0x3C, 0x03, 0xC0, 0x7E, 0x0E, 0x7F, 0xC1, 0xF8, 0x19, 0x81, 0x98,
+  0x00, 0x0C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03,
+  0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x07, 0xE0, 0xE7, 0xFC,
+  0x1F, 0x80, 0x00, 0xC0, 0x06, 0x00, 0x30, 0x00, 0x00, 0x60, 0x0D, 0xC0,
+  0x63, 0x03, 0x8E, 0x0C, 0x18, 0x70, 0x31, 0x80, 0xEC, 0x01, 0xB0, 0x03,
+  0x80, 0x0E, 0x00, 0x30, 0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x00,
+  0xC0, 0xC0, 0x18, 0x03, 0x00, 0x7F, 0xCF, 0xFD, 0x81, 0xF0, 0x1E, 0x03,
+  0xC0, 0x78, 0x1F, 0xFF, 0x7F, 0x8C, 0x01, 0x80, 0x30, 0x06, 0x00, 0x3E,
+  0x1F, 0xCC, 0x1B, 0x06, 0xC1, 0xB0, 0x6C, 0xF3, 0x3C, 0xC1, 0xB0, 0x3C,
+  0x0F, 0x03, 0xC0, 0xF0, 0x6D, 0xFB, 0x78, 0x38, 0x06, 0x00, 0xC0, 0x00,
+  0x3E, 0x1F, 0xCC, 0x1B, 0x06, 0x01, 0x8F, 0xEF, 0x9B, 0x06, 0xC1, 0xB0,
+  0xEF, 0xFD, 0xF3, 0x06, 0x03, 0x01, 0x80, 0x00, 0x3E, 0x1F, 0xCC, 0x1B,
+  0x06, 0x01, 0x8F, 0xEF, 0x9B, 0x06, 0xC1, 0xB0, 0xEF, 0xFD, 0xF3, 0x0C,
+  0x07, 0x83, 0x30, 0x00, 0x3E, 0x1F, 0xCC, 0x1B, 0x06, 0x01, 0x8F, 0xEF,
+  0x9B, 0x06, 0xC1, 0xB0, 0xEF, 0xFD, 0xF3, 0x3D, 0x0B, 0xC0, 0x00, 0xF8,
+  0x7F, 0x30, 0x6C, 0x18, 0x06, 0x3F, 0xBE, 0x6C, 0x1B, 0x06, 0xC3, 0xBF,
+  0xF7, 0xCC, 0x33, 0x0C, 0xC0, 0x00, 0x00, 0x3E, 0x1F, 0xCC, 0x1B, 0x06,
+  0x01, 0x8F, 0xEF, 0x9B, 0x06, 0xC1, 0xB0, 0xEF, 0xFD, 0xF3, 0x1C, 0x05,
+  0x81, 0x20, 0x78, 0x00, 0x0F, 0x87, 0xF3, 0x06, 0xC1, 0x80, 0x63, 0xFB,
+  0xE6, 0xC1, 0xB0, 0x6C, 0x3B, 0xFF, 0x7C, 0xC0, 0x3E, 0x3C, 0x3F, 0xBF,
+  0xB0, 0x70, 0xD8, 0x30, 0x30, 0x18, 0x19, 0xFF, 0xFF, 0xE6, 0x01, 0x83,
+  0x00, 0xC1, 0x81, 0xE1, 0xE1, 0xBF, 0xBF, 0xCF, 0x87, 0x80, 0x3E, 0x3F,
+  0xB8, 0x78, 0x3C, 0x06, 0x03, 0x01, 0x80, 0xC1, 0xF0, 0xDF, 0xC7, 0xC0,
+  0x80, 0xE0, 0x18, 0x78, 0x38, 0x06, 0x00, 0xC0, 0x00, 0x1E, 0x1F, 0xCE,
+  0x1B, 0x02, 0xC0, 0xFF, 0xFC, 0x03, 0x00, 0xC0, 0xF8, 0x67, 0xF0, 0xF8,
+  0x06, 0x03, 0x00, 0x80, 0x00, 0x1E, 0x1F, 0xCE, 0x1B, 0x02, 0xC0, 0xFF,
+  0xFC, 0x03, 0x00, 0xC0, 0xF8, 0x67, 0xF0, 0xF8, 0x0C, 0x07, 0x83, 0x30,
+  0x00, 0x1E, 0x1F, 0xCE, 0x1B, 0x02, 0xC0, 0xFF, 0xFC, 0x03, 0x00, 0xC0,
+  0xF8, 0x67, 0xF0, 0xF8, 0x33, 0x0C, 0xC0, 0x00, 0x00, 0x1E, 0x1F, 0xCE,
+  0x1B, 0x02, 0xC0, 0xFF, 0xFC, 0x03, 0x00, 0xC0, 0xF8, 0x67, 0xF0, 0xF8,
+  0xE3, 0x0C, 0x06, 0x31, 0x8C, 0x63, 0x18, 0xC6, 0x31, 0x8C, 0x33, 0x10,
+  0x06, 0x31, 0x8C, 0x63, 0x18, 0xC6, 0x31, 0x8C, 0x71, 0x6C, 0xC0, 0x30,
+  0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0xCF, 0x30, 0x00, 0x30,
+  0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x66, 0x0E, 0x06, 0xC0,
+  0x18, 0x3F, 0x1F, 0xEE, 0x1B, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0,
+  0xF8, 0x67, 0xF0, 0xF8, 0x3D, 0x13, 0x80, 0x1B, 0xEF, 0xFF, 0x0F, 0x07,
+  0x83, 0xC1, 0xE0, 0xF0, 0x78, 0x3C, 0x1E, 0x0F, 0x06, 0x38, 0x06, 0x00,
+  0xC0, 0x00, 0x3E, 0x1F, 0xCE, 0x1B, 0x02, 0xC0, 0xF0, 0x3C, 0x0F, 0x03,
+  0xC0, 0xF8, 0x67, 0xF0, 0xF8, 0x06, 0x03, 0x00, 0x80, 0x00, 0x3E, 0x1F,
+  0xCE, 0x1B, 0x02, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF8, 0x67, 0xF0,
+  0xF8, 0x1C, 0x05, 0x83, 0x20, 0x00, 0x3E, 0x1F, 0xCE, 0x1B, 0x02, 0xC0,
+  0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF8, 0x67, 0xF0, 0xF8, 0x3F, 0x0B, 0xC0,
+  0x00, 0xF8, 0x7F, 0x38, 0x6C, 0x0B, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03,
+  0xE1, 0x9F, 0xC3, 0xE0, 0x33, 0x0C, 0xC0, 0x00, 0x00, 0x3E, 0x1F, 0xCE,
+  0x1B, 0x02, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF8, 0x67, 0xF0, 0xF8,
+  0x0C, 0x01, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0C,
+  0x01, 0x80, 0x1F, 0x27, 0xF9, 0xC3, 0x30, 0xE6, 0x16, 0x84, 0xD1, 0x1B,
+  0x43, 0x70, 0xCE, 0x19, 0xFE, 0x4F, 0x80, 0x30, 0x0C, 0x03, 0x00, 0x0C,
+  0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xE0, 0xF0, 0x78, 0x3C, 0x1E, 0x0D, 0xFE,
+  0x7D, 0x00, 0x00, 0x06, 0x02, 0x02, 0x00, 0x0C, 0x1E, 0x0F, 0x07, 0x83,
+  0xC1, 0xE0, 0xF0, 0x78, 0x3C, 0x1E, 0x0D, 0xFE, 0x7D, 0x00, 0x00, 0x1C,
+  0x0B, 0x0C, 0x80, 0x0C, 0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xE0, 0xF0, 0x78,
+  0x3C, 0x1E, 0x0D, 0xFE, 0x7D, 0x00, 0x00, 0x33, 0x19, 0x80, 0x00, 0x0C,
+  0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xE0, 0xF0, 0x78, 0x3C, 0x1E, 0x0D, 0xFE,
+  0x7D, 0x00, 0x00, 0x03, 0x01, 0x80, 0xC0, 0x00, 0xC0, 0xD8, 0x36, 0x19,
+  0x86, 0x31, 0x8C, 0xC3, 0x30, 0x48, 0x1E, 0x07, 0x80, 0xC0, 0x30, 0x0C,
+  0x06, 0x01, 0x81, 0xE0, 0x60, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xDF,
+  0x3F, 0xEE, 0x1F, 0x83, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xE0, 0xF8, 0x7F,
+  0xFB, 0x7C, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0x3B, 0x0E, 0xC0, 0x00, 0x00,
+  0xC0, 0xD8, 0x36, 0x19, 0x86, 0x31, 0x8C, 0xC3, 0x30, 0x48, 0x1E, 0x07,
+  0x80, 0xC0, 0x30, 0x0C, 0x06, 0x01, 0x81, 0xE0, 0x60, 0x00 };
+
+constexpr GFXglyph FreeSans_RLE_11pt8bGlyphs[] PROGMEM = {
+  {     0,   1,   1,   5,    0,    0 },   // 0x20 ' '
+  {     1,   1,  16,   7,    3,  -15 },   // 0x21 '!'
+  {     3,   5,   5,   7,    1,  -14 },   // 0x22 '"'
+  {     7,  12,  15,  12,    0,  -14 },   // 0x23 '#'
+  {    30,  10,  19,  12,    1,  -16 },   // 0x24 '$'
+  {    54,  18,  15,  19,    1,  -14 },   // 0x25 '%'
+  {    88,  13,  15,  14,    1,  -14 },   // 0x26 '&'
+  {   113,   2,   5,   4,    1,  -14 },   // 0x27 '''
+  {   115,   4,  20,   7,    2,  -15 },   // 0x28 '('
+  {   125,   5,  20,   7,    1,  -15 },   // 0x29 ')'
+  {   138,   6,   6,   8,    1,  -15 },   // 0x2A '*'
+  {   143,  11,  10,  13,    1,   -9 },   // 0x2B '+'
+  {   157,   2,   5,   6,    2,   -1 },   // 0x2C ','
+  {   159,   5,   2,   7,    1,   -6 },   // 0x2D '-'
+  {   161,   2,   2,   5,    2,   -1 },   // 0x2E '.'
+  {   162,   6,  16,   6,    0,  -15 },   // 0x2F '/'
+  {   174,  10,  15,  12,    1,  -14 },   // 0x30 '0'
+  {   193,   5,  15,  12,    2,  -14 },   // 0x31 '1'
+  {   203,  10,  15,  12,    1,  -14 },   // 0x32 '2'
+  {   222,  10,  15,  12,    1,  -14 },   // 0x33 '3'
+  {   241,  10,  15,  12,    1,  -14 },   // 0x34 '4'
+  {   260,  10,  15,  12,    1,  -14 },   // 0x35 '5'
+  {   279,  10,  15,  12,    1,  -14 },   // 0x36 '6'
+  {   298,  10,  15,  12,    1,  -14 },   // 0x37 '7'
+  {   317,  10,  15,  12,    1,  -14 },   // 0x38 '8'
+  {   336,  10,  15,  12,    1,  -14 },   // 0x39 '9'
+  {   355,   2,  12,   5,    2,  -11 },   // 0x3A ':'
+  {   358,   2,  15,   5,    2,  -11 },   // 0x3B ';'
+  {   362,  11,  10,  13,    1,   -9 },   // 0x3C '<'
+  {   376,  11,   6,  13,    1,   -7 },   // 0x3D '='
+  {   385,  11,  10,  13,    1,   -9 },   // 0x3E '>'
+  {   399,   9,  16,  12,    2,  -15 },   // 0x3F '?'
+  {   417,  19,  19,  22,    1,  -15 },   // 0x40 '@'
+  {   463,  14,  16,  14,    0,  -15 },   // 0x41 'A'
+  {   491,  11,  16,  14,    2,  -15 },   // 0x42 'B'
+  {   513,  13,  16,  15,    1,  -15 },   // 0x43 'C'
+  {   539,  12,  16,  15,    2,  -15 },   // 0x44 'D'
+  {   563,  11,  16,  14,    2,  -15 },   // 0x45 'E'
+  {   585,  10,  16,  13,    2,  -15 },   // 0x46 'F'
+  {   605,  14,  16,  16,    1,  -15 },   // 0x47 'G'
+  {   633,  12,  16,  16,    2,  -15 },   // 0x48 'H'
+  {   657,   2,  16,   6,    2,  -15 },   // 0x49 'I'
+  {   661,   9,  16,  11,    1,  -15 },   // 0x4A 'J'
+  {   679,  12,  16,  15,    2,  -15 },   // 0x4B 'K'
+  {   703,   9,  16,  12,    2,  -15 },   // 0x4C 'L'
+  {   721,  15,  16,  18,    2,  -15 },   // 0x4D 'M'
+  {   751,  12,  16,  16,    2,  -15 },   // 0x4E 'N'
+  {   775,  15,  16,  17,    1,  -15 },   // 0x4F 'O'
+  {   805,  11,  16,  14,    2,  -15 },   // 0x50 'P'
+  {   827,  15,  17,  17,    1,  -15 },   // 0x51 'Q'
+  {   859,  12,  16,  15,    2,  -15 },   // 0x52 'R'
+  {   883,  12,  16,  14,    1,  -15 },   // 0x53 'S'
+  {   907,  12,  16,  14,    1,  -15 },   // 0x54 'T'
+  {   931,  12,  16,  16,    2,  -15 },   // 0x55 'U'
+  {   955,  14,  16,  14,    0,  -15 },   // 0x56 'V'
+  {   983,  20,  16,  20,    0,  -15 },   // 0x57 'W'
+  {  1023,  14,  16,  14,    0,  -15 },   // 0x58 'X'
+  {  1051,  14,  16,  15,    0,  -15 },   // 0x59 'Y'
+  {  1079,  12,  16,  13,    1,  -15 },   // 0x5A 'Z'
+  {  1103,   4,  21,   6,    1,  -15 },   // 0x5B '['
+  {  1114,   6,  16,   6,    0,  -15 },   // 0x5C '\'
+  {  1126,   4,  21,   6,    0,  -15 },   // 0x5D ']'
+  {  1137,   8,   8,  10,    1,  -14 },   // 0x5E '^'
+  {  1145,  12,   1,  12,    0,    4 },   // 0x5F '_'
+  {  1147,   5,   3,   5,    0,  -15 },   // 0x60 '`'
+  {  1149,  10,  12,  12,    1,  -11 },   // 0x61 'a'
+  {  1164,  10,  16,  12,    1,  -15 },   // 0x62 'b'
+  {  1184,   9,  12,  11,    1,  -11 },   // 0x63 'c'
+  {  1198,  10,  17,  12,    1,  -15 },   // 0x64 'd'
+  {  1220,  10,  12,  11,    1,  -11 },   // 0x65 'e'
+  {  1235,   6,  16,   6,    0,  -15 },   // 0x66 'f'
+  {  1247,  10,  16,  12,    1,  -11 },   // 0x67 'g'
+  {  1267,   9,  16,  12,    1,  -15 },   // 0x68 'h'
+  {  1285,   2,  16,   5,    1,  -15 },   // 0x69 'i'
+  {  1289,   4,  21,   5,    0,  -15 },   // 0x6A 'j'
+  {  1300,  10,  16,  11,    1,  -15 },   // 0x6B 'k'
+  {  1320,   2,  16,   5,    1,  -15 },   // 0x6C 'l'
+  {  1324,  15,  12,  18,    1,  -11 },   // 0x6D 'm'
+  {  1347,   9,  12,  12,    1,  -11 },   // 0x6E 'n'
+  {  1361,  10,  12,  12,    1,  -11 },   // 0x6F 'o'
+  {  1376,  10,  16,  12,    1,  -11 },   // 0x70 'p'
+  {  1396,  10,  16,  12,    1,  -11 },   // 0x71 'q'
+  {  1416,   6,  12,   7,    1,  -11 },   // 0x72 'r'
+  {  1425,   9,  12,  11,    1,  -11 },   // 0x73 's'
+  {  1439,   6,  15,   6,    0,  -14 },   // 0x74 't'
+  {  1451,   9,  13,  12,    1,  -11 },   // 0x75 'u'
+  {  1466,  10,  12,  11,    0,  -11 },   // 0x76 'v'
+  {  1481,  15,  12,  16,    0,  -11 },   // 0x77 'w'
+  {  1504,  10,  12,  10,    0,  -11 },   // 0x78 'x'
+  {  1519,  10,  17,  10,    0,  -11 },   // 0x79 'y'
+  {  1541,   9,  12,  10,    1,  -11 },   // 0x7A 'z'
+  {  1555,   5,  20,   7,    1,  -15 },   // 0x7B '{'
+  {  1568,   1,  20,   5,    2,  -15 },   // 0x7C '|'
+  {  1571,   5,  20,   7,    1,  -15 },   // 0x7D '}'
+  {  1584,   9,   3,  11,    1,   -8 },   // 0x7E '~'
+  {  1588,  15,  21,  17,    1,  -17 },   // 0x7F ''
+  {  1628,  15,  21,  17,    1,  -17 },   // 0x80 ''
+  {  1668,  15,  21,  17,    1,  -17 },   // 0x81 ''
+  {  1708,  15,  21,  17,    1,  -17 },   // 0x82 ''
+  {  1748,  15,  21,  17,    1,  -17 },   // 0x83 ''
+  {  1788,  15,  21,  17,    1,  -17 },   // 0x84 ''
+  {  1828,  15,  21,  17,    1,  -17 },   // 0x85 ''
+  {  1868,  15,  21,  17,    1,  -17 },   // 0x86 ''
+  {  1908,  15,  21,  17,    1,  -17 },   // 0x87 ''
+  {  1948,  15,  21,  17,    1,  -17 },   // 0x88 ''
+  {  1988,  15,  21,  17,    1,  -17 },   // 0x89 ''
+  {  2028,  15,  21,  17,    1,  -17 },   // 0x8A ''
+  {  2068,  15,  21,  17,    1,  -17 },   // 0x8B ''
+  {  2108,  15,  21,  17,    1,  -17 },   // 0x8C ''
+  {  2148,  15,  21,  17,    1,  -17 },   // 0x8D ''
+  {  2188,  15,  21,  17,    1,  -17 },   // 0x8E ''
+  {  2228,  15,  21,  17,    1,  -17 },   // 0x8F ''
+  {  2268,  15,  21,  17,    1,  -17 },   // 0x90 ''
+  {  2308,  15,  21,  17,    1,  -17 },   // 0x91 ''
+  {  2348,  15,  21,  17,    1,  -17 },   // 0x92 ''
+  {  2388,  15,  21,  17,    1,  -17 },   // 0x93 ''
+  {  2428,  15,  21,  17,    1,  -17 },   // 0x94 ''
+  {  2468,  15,  21,  17,    1,  -17 },   // 0x95 ''
+  {  2508,  15,  21,  17,    1,  -17 },   // 0x96 ''
+  {  2548,  15,  21,  17,    1,  -17 },   // 0x97 ''
+  {  2588,  15,  21,  17,    1,  -17 },   // 0x98 ''
+  {  2628,  15,  21,  17,    1,  -17 },   // 0x99 ''
+  {  2668,  15,  21,  17,    1,  -17 },   // 0x9A ''
+  {  2708,  15,  21,  17,    1,  -17 },   // 0x9B ''
+  {  2748,  15,  21,  17,    1,  -17 },   // 0x9C ''
+  {  2788,  15,  21,  17,    1,  -17 },   // 0x9D ''
+  {  2828,  15,  21,  17,    1,  -17 },   // 0x9E ''
+  {  2868,  15,  21,  17,    1,  -17 },   // 0x9F ''
+  {  2908,   1,   1,   6,    0,    0 },   // 0xA0 ''
+  {  2909,   1,  15,   7,    3,  -10 },   // 0xA1 ''
+  {  2911,  10,  16,  12,    1,  -13 },   // 0xA2 ''
+  {  2931,  11,  16,  12,    1,  -15 },   // 0xA3 ''
+  {  2953,  10,   9,  12,    1,  -11 },   // 0xA4 ''
+  {  2965,  12,  15,  12,    0,  -14 },   // 0xA5 ''
+  {  2988,   1,  20,   6,    2,  -15 },   // 0xA6 ''
+  {  2991,  10,  21,  12,    1,  -15 },   // 0xA7 ''
+  {  3018,   6,   2,   7,    1,  -14 },   // 0xA8 ''
+  {  3020,  15,  15,  17,    1,  -14 },   // 0xA9 ''
+  {  3049,   6,   9,   8,    1,  -15 },   // 0xAA ''
+  {  3056,   7,   7,  11,    2,   -8 },   // 0xAB ''
+  {  3063,  11,   6,  13,    1,   -7 },   // 0xAC ''
+  {  3072,   5,   2,   7,    1,   -6 },   // 0xAD ''
+  {  3074,  15,  15,  17,    1,  -14 },   // 0xAE ''
+  {  3103,   6,   2,   7,    1,  -14 },   // 0xAF ''
+  {  3105,   7,   7,  13,    3,  -14 },   // 0xB0 ''
+  {  3112,  11,  13,  13,    1,  -12 },   // 0xB1 ''
+  {  3130,   7,   8,   8,    0,  -16 },   // 0xB2 ''
+  {  3137,   7,  10,   8,    0,  -17 },   // 0xB3 ''
+  {  3146,   4,   3,   7,    2,  -15 },   // 0xB4 ''
+  {  3148,  11,  16,  12,    1,  -11 },   // 0xB5 ''
+  {  3170,  10,  20,  12,    1,  -15 },   // 0xB6 ''
+  {  3195,   2,   2,   5,    2,   -6 },   // 0xB7 ''
+  {  3196,   5,   5,   7,    1,    1 },   // 0xB8 ''
+  {  3200,   4,   9,   8,    1,  -17 },   // 0xB9 ''
+  {  3205,   6,   9,   8,    1,  -15 },   // 0xBA ''
+  {  3212,   7,   7,  11,    2,   -8 },   // 0xBB ''
+  {  3219,  17,  15,  19,    1,  -14 },   // 0xBC ''
+  {  3251,  17,  16,  19,    1,  -15 },   // 0xBD ''
+  {  3285,  17,  16,  19,    1,  -15 },   // 0xBE ''
+  {  3319,   9,  16,  12,    2,  -10 },   // 0xBF ''
+  {  3337,  14,  20,  14,    0,  -19 },   // 0xC0 ''
+  {  3372,  14,  20,  14,    0,  -19 },   // 0xC1 ''
+  {  3407,  14,  20,  14,    0,  -19 },   // 0xC2 ''
+  {  3442,  14,  19,  14,    0,  -18 },   // 0xC3 ''
+  {  3476,  14,  19,  14,    0,  -18 },   // 0xC4 ''
+  {  3510,  14,  21,  14,    0,  -20 },   // 0xC5 ''
+  {  3547,  21,  16,  21,    0,  -15 },   // 0xC6 ''
+  {  3589,  13,  20,  15,    1,  -15 },   // 0xC7 ''
+  {  3622,  11,  20,  14,    2,  -19 },   // 0xC8 ''
+  {  3650,  11,  20,  14,    2,  -19 },   // 0xC9 ''
+  {  3678,  11,  20,  14,    2,  -19 },   // 0xCA ''
+  {  3706,  11,  19,  14,    2,  -18 },   // 0xCB ''
+  {  3733,   5,  20,   6,    0,  -19 },   // 0xCC ''
+  {  3746,   5,  20,   6,    1,  -19 },   // 0xCD ''
+  {  3759,   6,  20,   6,    0,  -19 },   // 0xCE ''
+  {  3774,   6,  19,   6,    0,  -18 },   // 0xCF ''
+  {  3789,  14,  16,  15,    0,  -15 },   // 0xD0 ''
+  {  3817,  12,  19,  16,    2,  -18 },   // 0xD1 ''
+  {  3846,  15,  20,  17,    1,  -19 },   // 0xD2 ''
+  {  3884,  15,  20,  17,    1,  -19 },   // 0xD3 ''
+  {  3922,  15,  20,  17,    1,  -19 },   // 0xD4 ''
+  {  3960,  15,  19,  17,    1,  -18 },   // 0xD5 ''
+  {  3996,  15,  19,  17,    1,  -18 },   // 0xD6 ''
+  {  4032,   9,   8,  13,    2,   -8 },   // 0xD7 ''
+  {  4041,  15,  16,  17,    1,  -15 },   // 0xD8 ''
+  {  4071,  12,  20,  16,    2,  -19 },   // 0xD9 ''
+  {  4101,  12,  20,  16,    2,  -19 },   // 0xDA ''
+  {  4131,  12,  20,  16,    2,  -19 },   // 0xDB ''
+  {  4161,  12,  19,  16,    2,  -18 },   // 0xDC ''
+  {  4190,  14,  20,  15,    0,  -19 },   // 0xDD ''
+  {  4225,  11,  16,  14,    2,  -15 },   // 0xDE ''
+  {  4247,  10,  16,  13,    2,  -15 },   // 0xDF ''
+  {  4267,  10,  16,  12,    1,  -15 },   // 0xE0 ''
+  {  4287,  10,  16,  12,    1,  -15 },   // 0xE1 ''
+  {  4307,  10,  16,  12,    1,  -15 },   // 0xE2 ''
+  {  4327,  10,  15,  12,    1,  -14 },   // 0xE3 ''
+  {  4346,  10,  16,  12,    1,  -15 },   // 0xE4 ''
+  {  4366,  10,  17,  12,    1,  -16 },   // 0xE5 ''
+  {  4388,  17,  12,  19,    1,  -11 },   // 0xE6 ''
+  {  4414,   9,  16,  11,    1,  -11 },   // 0xE7 ''
+  {  4432,  10,  16,  11,    1,  -15 },   // 0xE8 ''
+  {  4452,  10,  16,  11,    1,  -15 },   // 0xE9 ''
+  {  4472,  10,  16,  11,    1,  -15 },   // 0xEA ''
+  {  4492,  10,  16,  11,    1,  -15 },   // 0xEB ''
+  {  4512,   5,  16,   5,    0,  -15 },   // 0xEC ''
+  {  4522,   5,  16,   5,    0,  -15 },   // 0xED ''
+  {  4532,   6,  16,   6,    0,  -15 },   // 0xEE ''
+  {  4544,   6,  16,   6,    0,  -15 },   // 0xEF ''
+  {  4556,  10,  16,  12,    1,  -15 },   // 0xF0 ''
+  {  4576,   9,  15,  12,    1,  -14 },   // 0xF1 ''
+  {  4593,  10,  16,  12,    1,  -15 },   // 0xF2 ''
+  {  4613,  10,  16,  12,    1,  -15 },   // 0xF3 ''
+  {  4633,  10,  16,  12,    1,  -15 },   // 0xF4 ''
+  {  4653,  10,  15,  12,    1,  -14 },   // 0xF5 ''
+  {  4672,  10,  16,  12,    1,  -15 },   // 0xF6 ''
+  {  4692,  11,  10,  13,    1,   -9 },   // 0xF7 ''
+  {  4706,  11,  12,  12,    0,  -11 },   // 0xF8 ''
+  {  4723,   9,  17,  12,    1,  -15 },   // 0xF9 ''
+  {  4743,   9,  17,  12,    1,  -15 },   // 0xFA ''
+  {  4763,   9,  17,  12,    1,  -15 },   // 0xFB ''
+  {  4783,   9,  17,  12,    1,  -15 },   // 0xFC ''
+  {  4803,  10,  21,  10,    0,  -15 },   // 0xFD ''
+  {  4830,  10,  20,  12,    1,  -15 },   // 0xFE ''
+  {  4855,  10,  21,  10,    0,  -15 } }; // 0xFF ''
+
+constexpr GFXfont FreeSans_RLE_11pt8b PROGMEM = {
+  (uint8_t  *)FreeSans_RLE_11pt8bBitmaps,
+  (GFXglyph *)FreeSans_RLE_11pt8bGlyphs,
+  0x20, 0xFF, 26 };
+
+// Approx. 6457 bytes
@@ -0,0 +1,683 @@
+// Run-length encoded glyph bitmaps (fontconvert -r)
+#define FreeSans_RLE_12pt8b_RLE
+
+const uint8_t FreeSans_RLE_12pt8bBitmaps[] PROGMEM = {
+  0x10, 0x0F, 0x0A, 0x54, 0x02, 0x24, 0x24, 0x24, 0x24, 0x24, 0x21, 0x10,
+  0x52, 0x22, 0x71, 0x32, 0x62, 0x32, 0x62, 0x32, 0x3C, 0x1C, 0x41, 0x32,
+  0x62, 0x32, 0x62, 0x32, 0x62, 0x32, 0x3C, 0x1C, 0x32, 0x32, 0x62, 0x32,
+  0x62, 0x32, 0x62, 0x31, 0x50, 0x51, 0x93, 0x67, 0x32, 0x21, 0x22, 0x12,
+  0x31, 0x22, 0x12, 0x31, 0x34, 0x31, 0x53, 0x21, 0x63, 0x11, 0x76, 0x76,
+  0x61, 0x14, 0x51, 0x34, 0x31, 0x34, 0x31, 0x34, 0x31, 0x35, 0x21, 0x23,
+  0x19, 0x36, 0x81, 0xA1, 0x50, 0xD2, 0x64, 0x62, 0x66, 0x52, 0x52, 0x41,
+  0x42, 0x61, 0x52, 0x31, 0x71, 0x52, 0x22, 0x72, 0x32, 0x31, 0x96, 0x22,
+  0xA3, 0x41, 0xF0, 0x22, 0x42, 0xB1, 0x36, 0x82, 0x32, 0x32, 0x62, 0x32,
+  0x42, 0x62, 0x32, 0x42, 0x52, 0x42, 0x42, 0x51, 0x66, 0x52, 0x74, 0x20,
+  0x44, 0x96, 0x72, 0x42, 0x62, 0x42, 0x62, 0x42, 0x72, 0x23, 0x76, 0x93,
+  0x95, 0x83, 0x22, 0x31, 0x32, 0x33, 0x12, 0x22, 0x55, 0x22, 0x64, 0x22,
+  0x72, 0x42, 0x45, 0x38, 0x13, 0x44, 0x43, 0x08, 0x11, 0x11, 0x32, 0x22,
+  0x32, 0x22, 0x32, 0x31, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+  0x32, 0x32, 0x41, 0x42, 0x32, 0x41, 0x42, 0x41, 0x10, 0x02, 0x41, 0x42,
+  0x41, 0x42, 0x32, 0x41, 0x42, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+  0x31, 0x32, 0x32, 0x31, 0x32, 0x31, 0x32, 0x30, 0x31, 0x61, 0x37, 0x15,
+  0x33, 0x32, 0x12, 0x80, 0x52, 0xA2, 0xA2, 0xA2, 0xA2, 0x5F, 0x09, 0x52,
+  0xA2, 0xA2, 0xA2, 0x50, 0x06, 0x11, 0x21, 0x21, 0x11, 0x20, 0x0C, 0x04,
+  0x52, 0x51, 0x61, 0x52, 0x51, 0x61, 0x52, 0x51, 0x61, 0x52, 0x51, 0x61,
+  0x52, 0x51, 0x61, 0x52, 0x51, 0x60, 0x35, 0x57, 0x33, 0x33, 0x22, 0x52,
+  0x13, 0x52, 0x12, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x75, 0x52, 0x22,
+  0x52, 0x23, 0x33, 0x37, 0x55, 0x30, 0x51, 0x42, 0x42, 0x1B, 0x42, 0x42,
+  0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x35, 0x58,
+  0x23, 0x42, 0x22, 0x55, 0x74, 0x72, 0x92, 0x82, 0x74, 0x63, 0x64, 0x63,
+  0x73, 0x73, 0x82, 0x9F, 0x07, 0x35, 0x48, 0x32, 0x43, 0x12, 0x62, 0x12,
+  0x62, 0x92, 0x92, 0x55, 0x65, 0xA2, 0x93, 0x94, 0x74, 0x66, 0x52, 0x28,
+  0x55, 0x30, 0x72, 0x83, 0x74, 0x74, 0x62, 0x12, 0x52, 0x22, 0x52, 0x22,
+  0x42, 0x32, 0x32, 0x42, 0x23, 0x42, 0x22, 0x52, 0x2F, 0x07, 0x72, 0x92,
+  0x92, 0x92, 0x20, 0x28, 0x29, 0x22, 0x92, 0x92, 0x92, 0x97, 0x49, 0x13,
+  0x43, 0x93, 0x92, 0x92, 0x94, 0x66, 0x52, 0x28, 0x55, 0x30, 0x44, 0x58,
+  0x23, 0x42, 0x22, 0x53, 0x12, 0x82, 0x92, 0x24, 0x32, 0x16, 0x24, 0x33,
+  0x13, 0x55, 0x74, 0x74, 0x72, 0x12, 0x53, 0x13, 0x42, 0x37, 0x55, 0x30,
+  0x0F, 0x07, 0x92, 0x82, 0x82, 0x92, 0x82, 0x92, 0x82, 0x92, 0x82, 0x92,
+  0x83, 0x82, 0x92, 0x92, 0x83, 0x60, 0x35, 0x57, 0x32, 0x43, 0x22, 0x52,
+  0x13, 0x52, 0x22, 0x52, 0x23, 0x33, 0x37, 0x47, 0x32, 0x52, 0x12, 0x74,
+  0x74, 0x74, 0x72, 0x12, 0x52, 0x29, 0x45, 0x30, 0x35, 0x48, 0x32, 0x43,
+  0x12, 0x62, 0x12, 0x74, 0x74, 0x74, 0x63, 0x12, 0x44, 0x17, 0x12, 0x34,
+  0x22, 0x92, 0x82, 0x13, 0x52, 0x22, 0x43, 0x28, 0x54, 0x40, 0x04, 0xF0,
+  0x34, 0x04, 0xF0, 0x34, 0x11, 0x11, 0x12, 0x10, 0xA2, 0x75, 0x54, 0x55,
+  0x54, 0x83, 0xA4, 0xA5, 0xA4, 0xA4, 0xA2, 0x0F, 0x09, 0xF0, 0x9F, 0x09,
+  0x02, 0xA5, 0xA4, 0xA4, 0xA5, 0x93, 0x74, 0x54, 0x64, 0x64, 0x81, 0xB0,
+  0x25, 0x48, 0x13, 0x45, 0x64, 0x62, 0x82, 0x72, 0x73, 0x63, 0x63, 0x72,
+  0x82, 0xF0, 0xF0, 0x82, 0x82, 0x40, 0x87, 0xCB, 0x84, 0x64, 0x63, 0xA3,
+  0x43, 0xC3, 0x23, 0x54, 0x22, 0x13, 0x12, 0x49, 0x34, 0x52, 0x43, 0x34,
+  0x42, 0x53, 0x34, 0x33, 0x52, 0x44, 0x32, 0x62, 0x44, 0x32, 0x62, 0x44,
+  0x33, 0x42, 0x42, 0x12, 0x42, 0x33, 0x33, 0x22, 0x36, 0x15, 0x43, 0x51,
+  0x42, 0x73, 0xF0, 0x44, 0xF0, 0x4B, 0xC7, 0x70, 0x63, 0xC4, 0xB4, 0xA2,
+  0x13, 0x92, 0x22, 0x83, 0x22, 0x82, 0x33, 0x72, 0x42, 0x63, 0x42, 0x62,
+  0x53, 0x5A, 0x4B, 0x42, 0x73, 0x32, 0x82, 0x23, 0x82, 0x22, 0x93, 0x12,
+  0xA2, 0x09, 0x4B, 0x22, 0x73, 0x12, 0x82, 0x12, 0x82, 0x12, 0x82, 0x12,
+  0x72, 0x2A, 0x3B, 0x22, 0x73, 0x12, 0x82, 0x12, 0x85, 0x85, 0x82, 0x12,
+  0x73, 0x1B, 0x2A, 0x30, 0x56, 0x79, 0x53, 0x53, 0x33, 0x73, 0x22, 0x92,
+  0x13, 0xC2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD3, 0x93, 0x12, 0x92, 0x23, 0x73,
+  0x33, 0x53, 0x59, 0x86, 0x40, 0x09, 0x4B, 0x22, 0x73, 0x12, 0x82, 0x12,
+  0x85, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x85, 0x82, 0x12, 0x73,
+  0x1B, 0x29, 0x40, 0x0F, 0x0B, 0xA2, 0xA2, 0xA2, 0xA2, 0xAB, 0x1B, 0x12,
+  0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xAF, 0x09, 0x0F, 0x09, 0x92, 0x92, 0x92,
+  0x92, 0x9A, 0x1A, 0x12, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x90,
+  0x56, 0x8A, 0x54, 0x53, 0x33, 0x83, 0x22, 0xA2, 0x13, 0xD2, 0xE2, 0xE2,
+  0x6A, 0x6A, 0xC5, 0xA3, 0x12, 0xA3, 0x13, 0x84, 0x23, 0x65, 0x3A, 0x12,
+  0x57, 0x22, 0x02, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x9F, 0x0F, 0x94,
+  0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x92, 0x0F, 0x0F, 0x0F, 0x06, 0x72,
+  0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x74, 0x54, 0x54,
+  0x55, 0x33, 0x17, 0x35, 0x20, 0x02, 0x85, 0x73, 0x12, 0x63, 0x22, 0x53,
+  0x32, 0x43, 0x42, 0x33, 0x52, 0x23, 0x62, 0x14, 0x68, 0x54, 0x22, 0x53,
+  0x33, 0x42, 0x53, 0x32, 0x62, 0x32, 0x63, 0x22, 0x73, 0x12, 0x82, 0x12,
+  0x92, 0x02, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92,
+  0x92, 0x92, 0x92, 0x92, 0x9F, 0x07, 0x03, 0xA6, 0x98, 0x88, 0x86, 0x11,
+  0x72, 0x14, 0x12, 0x62, 0x14, 0x12, 0x62, 0x14, 0x21, 0x52, 0x24, 0x22,
+  0x42, 0x24, 0x22, 0x42, 0x24, 0x32, 0x22, 0x34, 0x32, 0x22, 0x34, 0x32,
+  0x22, 0x34, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x52, 0x52, 0x03, 0x85,
+  0x86, 0x77, 0x64, 0x12, 0x64, 0x13, 0x54, 0x22, 0x54, 0x32, 0x44, 0x33,
+  0x34, 0x42, 0x34, 0x52, 0x24, 0x53, 0x14, 0x62, 0x14, 0x76, 0x76, 0x85,
+  0x83, 0x56, 0x8A, 0x54, 0x53, 0x33, 0x83, 0x22, 0xA6, 0xB4, 0xC4, 0xC4,
+  0xC4, 0xC4, 0xC5, 0xB2, 0x12, 0xA3, 0x13, 0x83, 0x33, 0x63, 0x5A, 0x86,
+  0x50, 0x0A, 0x2B, 0x12, 0x75, 0x84, 0x84, 0x84, 0x84, 0x7E, 0x1A, 0x22,
+  0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA0, 0x56, 0x8A, 0x54, 0x53, 0x33,
+  0x83, 0x22, 0xA6, 0xB4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC5, 0xB2, 0x12, 0x71,
+  0x23, 0x13, 0x65, 0x33, 0x63, 0x5C, 0x66, 0x32, 0xF0, 0x10, 0x0A, 0x4C,
+  0x22, 0x83, 0x12, 0x83, 0x12, 0x92, 0x12, 0x92, 0x12, 0x83, 0x12, 0x82,
+  0x2B, 0x3B, 0x32, 0x82, 0x22, 0x83, 0x12, 0x83, 0x12, 0x92, 0x12, 0x92,
+  0x12, 0x92, 0x12, 0x93, 0x46, 0x69, 0x43, 0x62, 0x32, 0x73, 0x22, 0x82,
+  0x22, 0xC3, 0xC6, 0xA7, 0xB5, 0xB3, 0x12, 0x95, 0x96, 0x82, 0x23, 0x63,
+  0x3A, 0x66, 0x40, 0x0F, 0x0B, 0x53, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3,
+  0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0x50, 0x02, 0x94, 0x94,
+  0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x95, 0x73,
+  0x13, 0x53, 0x39, 0x57, 0x30, 0x12, 0x93, 0x12, 0x92, 0x23, 0x82, 0x32,
+  0x73, 0x32, 0x72, 0x43, 0x62, 0x52, 0x53, 0x52, 0x52, 0x63, 0x42, 0x72,
+  0x32, 0x82, 0x32, 0x83, 0x22, 0x92, 0x12, 0xA2, 0x12, 0xB4, 0xB3, 0xC3,
+  0x60, 0x03, 0x72, 0x73, 0x12, 0x64, 0x62, 0x22, 0x64, 0x62, 0x23, 0x54,
+  0x53, 0x23, 0x54, 0x53, 0x32, 0x42, 0x22, 0x42, 0x42, 0x42, 0x22, 0x42,
+  0x43, 0x32, 0x22, 0x42, 0x52, 0x22, 0x33, 0x22, 0x62, 0x22, 0x42, 0x22,
+  0x62, 0x22, 0x42, 0x22, 0x62, 0x22, 0x42, 0x22, 0x74, 0x64, 0x84, 0x64,
+  0x84, 0x64, 0x84, 0x64, 0x92, 0x82, 0x50, 0x13, 0x82, 0x32, 0x73, 0x33,
+  0x62, 0x53, 0x42, 0x72, 0x33, 0x73, 0x22, 0x95, 0xB4, 0xB3, 0xC4, 0xA2,
+  0x13, 0x83, 0x22, 0x73, 0x33, 0x62, 0x53, 0x43, 0x62, 0x33, 0x73, 0x22,
+  0x93, 0x12, 0xA2, 0x23, 0x83, 0x33, 0x63, 0x52, 0x62, 0x63, 0x43, 0x72,
+  0x42, 0x83, 0x23, 0x93, 0x12, 0xB4, 0xC4, 0xD2, 0xE2, 0xE2, 0xE2, 0xE2,
+  0xE2, 0xE2, 0x70, 0x0F, 0x0B, 0xA2, 0xA3, 0x93, 0x93, 0x93, 0xA2, 0xA3,
+  0x93, 0x93, 0x93, 0xA2, 0xA3, 0x93, 0xAF, 0x0B, 0x0C, 0x32, 0x32, 0x32,
+  0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+  0x32, 0x32, 0x3A, 0x01, 0x62, 0x61, 0x61, 0x62, 0x61, 0x61, 0x62, 0x61,
+  0x61, 0x62, 0x61, 0x61, 0x62, 0x61, 0x61, 0x62, 0x08, 0x22, 0x22, 0x22,
+  0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+  0x22, 0x22, 0x2A, 0x33, 0x63, 0x61, 0x11, 0x52, 0x12, 0x41, 0x31, 0x32,
+  0x32, 0x22, 0x32, 0x21, 0x51, 0x12, 0x52, 0x0F, 0x03, 0x22, 0x32, 0x26,
+  0x48, 0x23, 0x43, 0x12, 0x62, 0x92, 0x65, 0x29, 0x13, 0x52, 0x12, 0x62,
+  0x12, 0x62, 0x12, 0x53, 0x1B, 0x24, 0x23, 0x02, 0x92, 0x92, 0x92, 0x92,
+  0x24, 0x32, 0x17, 0x14, 0x46, 0x65, 0x64, 0x74, 0x74, 0x75, 0x65, 0x66,
+  0x42, 0x1A, 0x12, 0x24, 0x30, 0x35, 0x38, 0x22, 0x45, 0x64, 0x82, 0x82,
+  0x82, 0x82, 0x64, 0x62, 0x12, 0x43, 0x18, 0x45, 0x20, 0x92, 0x92, 0x92,
+  0x92, 0x34, 0x22, 0x17, 0x12, 0x12, 0x46, 0x65, 0x65, 0x74, 0x74, 0x74,
+  0x65, 0x63, 0x12, 0x44, 0x1A, 0x35, 0x12, 0xB0, 0x35, 0x48, 0x32, 0x43,
+  0x12, 0x62, 0x12, 0x7F, 0x0B, 0x92, 0x92, 0x62, 0x22, 0x43, 0x28, 0x55,
+  0x30, 0x33, 0x24, 0x22, 0x42, 0x2C, 0x22, 0x42, 0x42, 0x42, 0x42, 0x42,
+  0x42, 0x42, 0x42, 0x42, 0x42, 0x20, 0x34, 0x22, 0x17, 0x12, 0x12, 0x46,
+  0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x63, 0x12, 0x43, 0x27, 0x11, 0x44,
+  0x12, 0x92, 0x12, 0x62, 0x22, 0x43, 0x28, 0x63, 0x40, 0x02, 0x82, 0x82,
+  0x82, 0x82, 0x25, 0x12, 0x1B, 0x45, 0x55, 0x54, 0x64, 0x64, 0x64, 0x64,
+  0x64, 0x64, 0x64, 0x62, 0x04, 0x4F, 0x0B, 0x22, 0x22, 0xA2, 0x22, 0x22,
+  0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+  0x29, 0x10, 0x02, 0x92, 0x92, 0x92, 0x92, 0x53, 0x12, 0x43, 0x22, 0x33,
+  0x32, 0x23, 0x42, 0x13, 0x56, 0x54, 0x12, 0x43, 0x23, 0x32, 0x42, 0x32,
+  0x43, 0x22, 0x52, 0x22, 0x62, 0x12, 0x63, 0x0F, 0x0F, 0x04, 0x02, 0x15,
+  0x34, 0x29, 0x16, 0x13, 0x44, 0x36, 0x43, 0x54, 0x62, 0x54, 0x62, 0x54,
+  0x62, 0x54, 0x62, 0x54, 0x62, 0x54, 0x62, 0x54, 0x62, 0x54, 0x62, 0x54,
+  0x62, 0x52, 0x02, 0x25, 0x12, 0x1B, 0x45, 0x55, 0x54, 0x64, 0x64, 0x64,
+  0x64, 0x64, 0x64, 0x64, 0x62, 0x35, 0x48, 0x32, 0x43, 0x12, 0x62, 0x12,
+  0x74, 0x74, 0x74, 0x74, 0x74, 0x62, 0x22, 0x43, 0x28, 0x55, 0x30, 0x02,
+  0x15, 0x3A, 0x14, 0x42, 0x13, 0x65, 0x64, 0x74, 0x74, 0x75, 0x65, 0x66,
+  0x42, 0x12, 0x17, 0x12, 0x24, 0x32, 0x92, 0x92, 0x92, 0x92, 0x90, 0x34,
+  0x22, 0x1A, 0x12, 0x47, 0x55, 0x65, 0x74, 0x74, 0x74, 0x65, 0x63, 0x12,
+  0x44, 0x17, 0x12, 0x34, 0x22, 0x92, 0x92, 0x92, 0x92, 0x92, 0x02, 0x24,
+  0x17, 0x23, 0x33, 0x32, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x40,
+  0x25, 0x48, 0x13, 0x42, 0x12, 0x52, 0x13, 0x84, 0x76, 0x74, 0x85, 0x65,
+  0x43, 0x18, 0x36, 0x20, 0x22, 0x42, 0x42, 0x2C, 0x22, 0x42, 0x42, 0x42,
+  0x42, 0x42, 0x42, 0x42, 0x42, 0x44, 0x33, 0x02, 0x64, 0x64, 0x64, 0x64,
+  0x64, 0x64, 0x64, 0x64, 0x64, 0x65, 0x43, 0x19, 0x25, 0x12, 0xA0, 0x03,
+  0x62, 0x12, 0x62, 0x12, 0x53, 0x13, 0x42, 0x32, 0x42, 0x32, 0x32, 0x42,
+  0x32, 0x52, 0x22, 0x52, 0x12, 0x62, 0x12, 0x74, 0x73, 0x83, 0x40, 0x03,
+  0x43, 0x43, 0x12, 0x43, 0x42, 0x22, 0x43, 0x42, 0x22, 0x32, 0x12, 0x32,
+  0x23, 0x22, 0x12, 0x22, 0x42, 0x22, 0x12, 0x22, 0x42, 0x22, 0x12, 0x22,
+  0x42, 0x21, 0x31, 0x22, 0x54, 0x34, 0x64, 0x34, 0x64, 0x34, 0x63, 0x44,
+  0x72, 0x52, 0x40, 0x12, 0x53, 0x13, 0x42, 0x32, 0x32, 0x52, 0x13, 0x55,
+  0x73, 0x83, 0x83, 0x72, 0x12, 0x62, 0x13, 0x42, 0x32, 0x32, 0x52, 0x22,
+  0x53, 0x02, 0x72, 0x12, 0x52, 0x22, 0x52, 0x22, 0x52, 0x32, 0x32, 0x42,
+  0x32, 0x42, 0x32, 0x52, 0x12, 0x62, 0x12, 0x62, 0x12, 0x73, 0x83, 0x83,
+  0x82, 0x92, 0x83, 0x64, 0x73, 0x70, 0x09, 0x19, 0x73, 0x72, 0x72, 0x73,
+  0x63, 0x72, 0x72, 0x72, 0x73, 0x7F, 0x05, 0x32, 0x23, 0x22, 0x32, 0x32,
+  0x32, 0x32, 0x32, 0x32, 0x22, 0x22, 0x33, 0x32, 0x42, 0x32, 0x32, 0x32,
+  0x32, 0x32, 0x32, 0x33, 0x32, 0x0F, 0x0F, 0x0E, 0x03, 0x34, 0x42, 0x42,
+  0x42, 0x42, 0x42, 0x42, 0x42, 0x52, 0x52, 0x33, 0x31, 0x42, 0x42, 0x42,
+  0x42, 0x42, 0x42, 0x42, 0x24, 0x23, 0x30, 0x21, 0x75, 0x42, 0x23, 0x23,
+  0x44, 0x81, 0x20, 0x0F, 0x0F, 0x06, 0xD4, 0x45, 0x44, 0x37, 0x34, 0x22,
+  0x52, 0x24, 0x22, 0x52, 0x24, 0x12, 0x63, 0x14, 0x92, 0x24, 0x83, 0x24,
+  0x73, 0x34, 0x63, 0x44, 0x53, 0x54, 0x52, 0x64, 0x52, 0x64, 0xD4, 0xD4,
+  0x52, 0x64, 0x52, 0x64, 0xDF, 0x0F, 0x06, 0x0F, 0x0F, 0x06, 0xD4, 0x45,
+  0x44, 0x37, 0x34, 0x22, 0x52, 0x24, 0x22, 0x52, 0x24, 0x12, 0x63, 0x14,
+  0x92, 0x24, 0x83, 0x24, 0x73, 0x34, 0x63, 0x44, 0x53, 0x54, 0x52, 0x64,
+  0x52, 0x64, 0xD4, 0xD4, 0x52, 0x64, 0x52, 0x64, 0xDF, 0x0F, 0x06, 0x0F,
+  0x0F, 0x06, 0xD4, 0x45, 0x44, 0x37, 0x34, 0x22, 0x52, 0x24, 0x22, 0x52,
+  0x24, 0x12, 0x63, 0x14, 0x92, 0x24, 0x83, 0x24, 0x73, 0x34, 0x63, 0x44,
+  0x53, 0x54, 0x52, 0x64, 0x52, 0x64, 0xD4, 0xD4, 0x52, 0x64, 0x52, 0x64,
+  0xDF, 0x0F, 0x06, 0x0F, 0x0F, 0x06, 0xD4, 0x45, 0x44, 0x37, 0x34, 0x22,
+  0x52, 0x24, 0x22, 0x52, 0x24, 0x12, 0x63, 0x14, 0x92, 0x24, 0x83, 0x24,
+  0x73, 0x34, 0x63, 0x44, 0x53, 0x54, 0x52, 0x64, 0x52, 0x64, 0xD4, 0xD4,
+  0x52, 0x64, 0x52, 0x64, 0xDF, 0x0F, 0x06, 0x0F, 0x0F, 0x06, 0xD4, 0x45,
+  0x44, 0x37, 0x34, 0x22, 0x52, 0x24, 0x22, 0x52, 0x24, 0x12, 0x63, 0x14,
+  0x92, 0x24, 0x83, 0x24, 0x73, 0x34, 0x63, 0x44, 0x53, 0x54, 0x52, 0x64,
+  0x52, 0x64, 0xD4, 0xD4, 0x52, 0x64, 0x52, 0x64, 0xDF, 0x0F, 0x06, 0x0F,
+  0x0F, 0x06, 0xD4, 0x45, 0x44, 0x37, 0x34, 0x22, 0x52, 0x24, 0x22, 0x52,
+  0x24, 0x12, 0x63, 0x14, 0x92, 0x24, 0x83, 0x24, 0x73, 0x34, 0x63, 0x44,
+  0x53, 0x54, 0x52, 0x64, 0x52, 0x64, 0xD4, 0xD4, 0x52, 0x64, 0x52, 0x64,
+  0xDF, 0x0F, 0x06, 0x0F, 0x0F, 0x06, 0xD4, 0x45, 0x44, 0x37, 0x34, 0x22,
+  0x52, 0x24, 0x22, 0x52, 0x24, 0x12, 0x63, 0x14, 0x92, 0x24, 0x83, 0x24,
+  0x73, 0x34, 0x63, 0x44, 0x53, 0x54, 0x52, 0x64, 0x52, 0x64, 0xD4, 0xD4,
+  0x52, 0x64, 0x52, 0x64, 0xDF, 0x0F, 0x06, 0x0F, 0x0F, 0x06, 0xD4, 0x45,
+  0x44, 0x37, 0x34, 0x22, 0x52, 0x24, 0x22, 0x52, 0x24, 0x12, 0x63, 0x14,
+  0x92, 0x24, 0x83, 0x24, 0x73, 0x34, 0x63, 0x44, 0x53, 0x54, 0x52, 0x64,
+  0x52, 0x64, 0xD4, 0xD4, 0x52, 0x64, 0x52, 0x64, 0xDF, 0x0F, 0x06, 0x0F,
+  0x0F, 0x06, 0xD4, 0x45, 0x44, 0x37, 0x34, 0x22, 0x52, 0x24, 0x22, 0x52,
+  0x24, 0x12, 0x63, 0x14, 0x92, 0x24, 0x83, 0x24, 0x73, 0x34, 0x63, 0x44,
+  0x53, 0x54, 0x52, 0x64, 0x52, 0x64, 0xD4, 0xD4, 0x52, 0x64, 0x52, 0x64,
+  0xDF, 0x0F, 0x06, 0x0F, 0x0F, 0x06, 0xD4, 0x45, 0x44, 0x37, 0x34, 0x22,
+  0x52, 0x24, 0x22, 0x52, 0x24, 0x12, 0x63, 0x14, 0x92, 0x24, 0x83, 0x24,
+  0x73, 0x34, 0x63, 0x44, 0x53, 0x54, 0x52, 0x64, 0x52, 0x64, 0xD4, 0xD4,
+  0x52, 0x64, 0x52, 0x64, 0xDF, 0x0F, 0x06, 0x0F, 0x0F, 0x06, 0xD4, 0x45,
+  0x44, 0x37, 0x34, 0x22, 0x52, 0x24, 0x22, 0x52, 0x24, 0x12, 0x63, 0x14,
+  0x92, 0x24, 0x83, 0x24, 0x73, 0x34, 0x63, 0x44, 0x53, 0x54, 0x52, 0x64,
+  0x52, 0x64, 0xD4, 0xD4, 0x52, 0x64, 0x52, 0x64, 0xDF, 0x0F, 0x06, 0x0F,
+  0x0F, 0x06, 0xD4, 0x45, 0x44, 0x37, 0x34, 0x22, 0x52, 0x24, 0x22, 0x52,
+  0x24, 0x12, 0x63, 0x14, 0x92, 0x24, 0x83, 0x24, 0x73, 0x34, 0x63, 0x44,
+  0x53, 0x54, 0x52, 0x64, 0x52, 0x64, 0xD4, 0xD4, 0x52, 0x64, 0x52, 0x64,
+  0xDF, 0x0F, 0x06, 0x0F, 0x0F, 0x06, 0xD4, 0x45, 0x44, 0x37, 0x34, 0x22,
+  0x52, 0x24, 0x22, 0x52, 0x24, 0x12, 0x63, 0x14, 0x92, 0x24, 0x83, 0x24,
+  0x73, 0x34, 0x63, 0x44, 0x53, 0x54, 0x52, 0x64, 0x52, 0x64, 0xD4, 0xD4,
+  0x52, 0x64, 0x52, 0x64, 0xDF, 0x0F, 0x06, 0x0F, 0x0F, 0x06, 0xD4, 0x45,
+  0x44, 0x37, 0x34, 0x22, 0x52, 0x24, 0x22, 0x52, 0x24, 0x12, 0x63, 0x14,
+  0x92, 0x24, 0x83, 0x24, 0x73, 0x34, 0x63, 0x44, 0x53, 0x54, 0x52, 0x64,
+  0x52, 0x64, 0xD4, 0xD4, 0x52, 0x64, 0x52, 0x64, 0xDF, 0x0F, 0x06, 0x0F,
+  0x0F, 0x06, 0xD4, 0x45, 0x44, 0x37, 0x34, 0x22, 0x52, 0x24, 0x22, 0x52,
+  0x24, 0x12, 0x63, 0x14, 0x92, 0x24, 0x83, 0x24, 0x73, 0x34, 0x63, 0x44,
+  0x53, 0x54, 0x52, 0x64, 0x52, 0x64, 0xD4, 0xD4, 0x52, 0x64, 0x52, 0x64,
+  0xDF, 0x0F, 0x06, 0x0F, 0x0F, 0x06, 0xD4, 0x45, 0x44, 0x37, 0x34, 0x22,
+  0x52, 0x24, 0x22, 0x52, 0x24, 0x12, 0x63, 0x14, 0x92, 0x24, 0x83, 0x24,
+  0x73, 0x34, 0x63, 0x44, 0x53, 0x54, 0x52, 0x64, 0x52, 0x64, 0xD4, 0xD4,
+  0x52, 0x64, 0x52, 0x64, 0xDF, 0x0F, 0x06, 0x0F, 0x0F, 0x06, 0xD4, 0x45,
+  0x44, 0x37, 0x34, 0x22, 0x52, 0x24, 0x22, 0x52, 0x24, 0x12, 0x63, 0x14,
+  0x92, 0x24, 0x83, 0x24, 0x73, 0x34, 0x63, 0x44, 0x53, 0x54, 0x52, 0x64,
+  0x52, 0x64, 0xD4, 0xD4, 0x52, 0x64, 0x52, 0x64, 0xDF, 0x0F, 0x06, 0x0F,
+  0x0F, 0x06, 0xD4, 0x45, 0x44, 0x37, 0x34, 0x22, 0x52, 0x24, 0x22, 0x52,
+  0x24, 0x12, 0x63, 0x14, 0x92, 0x24, 0x83, 0x24, 0x73, 0x34, 0x63, 0x44,
+  0x53, 0x54, 0x52, 0x64, 0x52, 0x64, 0xD4, 0xD4, 0x52, 0x64, 0x52, 0x64,
+  0xDF, 0x0F, 0x06, 0x0F, 0x0F, 0x06, 0xD4, 0x45, 0x44, 0x37, 0x34, 0x22,
+  0x52, 0x24, 0x22, 0x52, 0x24, 0x12, 0x63, 0x14, 0x92, 0x24, 0x83, 0x24,
+  0x73, 0x34, 0x63, 0x44, 0x53, 0x54, 0x52, 0x64, 0x52, 0x64, 0xD4, 0xD4,
+  0x52, 0x64, 0x52, 0x64, 0xDF, 0x0F, 0x06, 0x0F, 0x0F, 0x06, 0xD4, 0x45,
+  0x44, 0x37, 0x34, 0x22, 0x52, 0x24, 0x22, 0x52, 0x24, 0x12, 0x63, 0x14,
+  0x92, 0x24, 0x83, 0x24, 0x73, 0x34, 0x63, 0x44, 0x53, 0x54, 0x52, 0x64,
+  0x52, 0x64, 0xD4, 0xD4, 0x52, 0x64, 0x52, 0x64, 0xDF, 0x0F, 0x06, 0x0F,
+  0x0F, 0x06, 0xD4, 0x45, 0x44, 0x37, 0x34, 0x22, 0x52, 0x24, 0x22, 0x52,
+  0x24, 0x12, 0x63, 0x14, 0x92, 0x24, 0x83, 0x24, 0x73, 0x34, 0x63, 0x44,
+  0x53, 0x54, 0x52, 0x64, 0x52, 0x64, 0xD4, 0xD4, 0x52, 0x64, 0x52, 0x64,
+  0xDF, 0x0F, 0x06, 0x0F, 0x0F, 0x06, 0xD4, 0x45, 0x44, 0x37, 0x34, 0x22,
+  0x52, 0x24, 0x22, 0x52, 0x24, 0x12, 0x63, 0x14, 0x92, 0x24, 0x83, 0x24,
+  0x73, 0x34, 0x63, 0x44, 0x53, 0x54, 0x52, 0x64, 0x52, 0x64, 0xD4, 0xD4,
+  0x52, 0x64, 0x52, 0x64, 0xDF, 0x0F, 0x06, 0x0F, 0x0F, 0x06, 0xD4, 0x45,
+  0x44, 0x37, 0x34, 0x22, 0x52, 0x24, 0x22, 0x52, 0x24, 0x12, 0x63, 0x14,
+  0x92, 0x24, 0x83, 0x24, 0x73, 0x34, 0x63, 0x44, 0x53, 0x54, 0x52, 0x64,
+  0x52, 0x64, 0xD4, 0xD4, 0x52, 0x64, 0x52, 0x64, 0xDF, 0x0F, 0x06, 0x0F,
+  0x0F, 0x06, 0xD4, 0x45, 0x44, 0x37, 0x34, 0x22, 0x52, 0x24, 0x22, 0x52,
+  0x24, 0x12, 0x63, 0x14, 0x92, 0x24, 0x83, 0x24, 0x73, 0x34, 0x63, 0x44,
+  0x53, 0x54, 0x52, 0x64, 0x52, 0x64, 0xD4, 0xD4, 0x52, 0x64, 0x52, 0x64,
+  0xDF, 0x0F, 0x06, 0x0F, 0x0F, 0x06, 0xD4, 0x45, 0x44, 0x37, 0x34, 0x22,
+  0x52, 0x24, 0x22, 0x52, 0x24, 0x12, 0x63, 0x14, 0x92, 0x24, 0x83, 0x24,
+  0x73, 0x34, 0x63, 0x44, 0x53, 0x54, 0x52, 0x64, 0x52, 0x64, 0xD4, 0xD4,
+  0x52, 0x64, 0x52, 0x64, 0xDF, 0x0F, 0x06, 0x0F, 0x0F, 0x06, 0xD4, 0x45,
+  0x44, 0x37, 0x34, 0x22, 0x52, 0x24, 0x22, 0x52, 0x24, 0x12, 0x63, 0x14,
+  0x92, 0x24, 0x83, 0x24, 0x73, 0x34, 0x63, 0x44, 0x53, 0x54, 0x52, 0x64,
+  0x52, 0x64, 0xD4, 0xD4, 0x52, 0x64, 0x52, 0x64, 0xDF, 0x0F, 0x06, 0x0F,
+  0x0F, 0x06, 0xD4, 0x45, 0x44, 0x37, 0x34, 0x22, 0x52, 0x24, 0x22, 0x52,
+  0x24, 0x12, 0x63, 0x14, 0x92, 0x24, 0x83, 0x24, 0x73, 0x34, 0x63, 0x44,
+  0x53, 0x54, 0x52, 0x64, 0x52, 0x64, 0xD4, 0xD4, 0x52, 0x64, 0x52, 0x64,
+  0xDF, 0x0F, 0x06, 0x0F, 0x0F, 0x06, 0xD4, 0x45, 0x44, 0x37, 0x34, 0x22,
+  0x52, 0x24, 0x22, 0x52, 0x24, 0x12, 0x63, 0x14, 0x92, 0x24, 0x83, 0x24,
+  0x73, 0x34, 0x63, 0x44, 0x53, 0x54, 0x52, 0x64, 0x52, 0x64, 0xD4, 0xD4,
+  0x52, 0x64, 0x52, 0x64, 0xDF, 0x0F, 0x06, 0x0F, 0x0F, 0x06, 0xD4, 0x45,
+  0x44, 0x37, 0x34, 0x22, 0x52, 0x24, 0x22, 0x52, 0x24, 0x12, 0x63, 0x14,
+  0x92, 0x24, 0x83, 0x24, 0x73, 0x34, 0x63, 0x44, 0x53, 0x54, 0x52, 0x64,
+  0x52, 0x64, 0xD4, 0xD4, 0x52, 0x64, 0x52, 0x64, 0xDF, 0x0F, 0x06, 0x0F,
+  0x0F, 0x06, 0xD4, 0x45, 0x44, 0x37, 0x34, 0x22, 0x52, 0x24, 0x22, 0x52,
+  0x24, 0x12, 0x63, 0x14, 0x92, 0x24, 0x83, 0x24, 0x73, 0x34, 0x63, 0x44,
+  0x53, 0x54, 0x52, 0x64, 0x52, 0x64, 0xD4, 0xD4, 0x52, 0x64, 0x52, 0x64,
+  0xDF, 0x0F, 0x06, 0x0F, 0x0F, 0x06, 0xD4, 0x45, 0x44, 0x37, 0x34, 0x22,
+  0x52, 0x24, 0x22, 0x52, 0x24, 0x12, 0x63, 0x14, 0x92, 0x24, 0x83, 0x24,
+  0x73, 0x34, 0x63, 0x44, 0x53, 0x54, 0x52, 0x64, 0x52, 0x64, 0xD4, 0xD4,
+  0x52, 0x64, 0x52, 0x64, 0xDF, 0x0F, 0x06, 0x0F, 0x0F, 0x06, 0xD4, 0x45,
+  0x44, 0x37, 0x34, 0x22, 0x52, 0x24, 0x22, 0x52, 0x24, 0x12, 0x63, 0x14,
+  0x92, 0x24, 0x83, 0x24, 0x73, 0x34, 0x63, 0x44, 0x53, 0x54, 0x52, 0x64,
+  0x52, 0x64, 0xD4, 0xD4, 0x52, 0x64, 0x52, 0x64, 0xDF, 0x0F, 0x06, 0x0F,
+  0x0F, 0x06, 0xD4, 0x45, 0x44, 0x37, 0x34, 0x22, 0x52, 0x24, 0x22, 0x52,
+  0x24, 0x12, 0x63, 0x14, 0x92, 0x24, 0x83, 0x24, 0x73, 0x34, 0x63, 0x44,
+  0x53, 0x54, 0x52, 0x64, 0x52, 0x64, 0xD4, 0xD4, 0x52, 0x64, 0x52, 0x64,
+  0xDF, 0x0F, 0x06, 0x10, 0x04, 0x41, 0x1F, 0x09, 0x51, 0xA1, 0x94, 0x58,
+  0x23, 0x11, 0x22, 0x22, 0x21, 0x35, 0x21, 0x52, 0x31, 0x52, 0x31, 0x52,
+  0x31, 0x53, 0x21, 0x32, 0x12, 0x21, 0x32, 0x13, 0x11, 0x22, 0x38, 0x45,
+  0x81, 0xA1, 0x50, 0x35, 0x68, 0x33, 0x42, 0x23, 0x62, 0x12, 0x72, 0x13,
+  0xA2, 0xA3, 0x88, 0x62, 0xB2, 0xA2, 0x92, 0xA2, 0x95, 0x41, 0x1B, 0x21,
+  0x44, 0x20, 0x96, 0x1E, 0x32, 0x12, 0x54, 0x55, 0x32, 0x1F, 0x03, 0x90,
+  0x12, 0x82, 0x12, 0x72, 0x32, 0x52, 0x42, 0x52, 0x52, 0x32, 0x62, 0x32,
+  0x72, 0x12, 0x82, 0x12, 0x93, 0x7A, 0x72, 0xB2, 0x7A, 0x72, 0xB2, 0xB2,
+  0xB2, 0x50, 0x0F, 0x03, 0x8F, 0x03, 0x44, 0x57, 0x42, 0x33, 0x23, 0x42,
+  0x23, 0x42, 0x33, 0x84, 0x62, 0x14, 0x32, 0x43, 0x22, 0x53, 0x12, 0x66,
+  0x62, 0x14, 0x42, 0x33, 0x22, 0x55, 0x83, 0x92, 0x32, 0x43, 0x22, 0x43,
+  0x23, 0x32, 0x47, 0x54, 0x40, 0x02, 0x24, 0x22, 0x65, 0xA3, 0x33, 0x63,
+  0x72, 0x42, 0x42, 0x42, 0x32, 0x26, 0x32, 0x12, 0x32, 0x32, 0x31, 0x12,
+  0x22, 0x51, 0x33, 0x32, 0x93, 0x31, 0xA3, 0x31, 0xA4, 0x22, 0x52, 0x24,
+  0x22, 0x51, 0x31, 0x22, 0x23, 0x22, 0x22, 0x32, 0x25, 0x22, 0x43, 0x72,
+  0x73, 0x33, 0xA5, 0x60, 0x14, 0x22, 0x22, 0x61, 0x34, 0x12, 0x31, 0x11,
+  0x41, 0x12, 0x13, 0x23, 0x12, 0x77, 0x21, 0x41, 0x12, 0x35, 0x22, 0x11,
+  0x32, 0x22, 0x22, 0x23, 0x23, 0x21, 0x32, 0x80, 0x0F, 0x09, 0xA2, 0xA2,
+  0xA2, 0xA2, 0xA2, 0x0C, 0x65, 0xA3, 0x33, 0x63, 0x72, 0x42, 0xA2, 0x32,
+  0x18, 0x22, 0x12, 0x22, 0x42, 0x31, 0x12, 0x22, 0x51, 0x33, 0x32, 0x51,
+  0x33, 0x38, 0x33, 0x38, 0x34, 0x22, 0x51, 0x34, 0x22, 0x51, 0x31, 0x22,
+  0x12, 0x51, 0x22, 0x34, 0x54, 0x43, 0x72, 0x73, 0x33, 0xA5, 0x60, 0x0C,
+  0x14, 0x22, 0x22, 0x11, 0x41, 0x11, 0x43, 0x41, 0x12, 0x22, 0x24, 0x20,
+  0x52, 0xA2, 0xA2, 0xA2, 0xA2, 0x5F, 0x09, 0x52, 0xA2, 0xA2, 0xA2, 0xA2,
+  0xF0, 0x2F, 0x09, 0x25, 0x22, 0x31, 0x21, 0x42, 0x62, 0x52, 0x43, 0x42,
+  0x52, 0x61, 0x68, 0x24, 0x32, 0x22, 0x21, 0x41, 0x62, 0x43, 0x72, 0x74,
+  0x41, 0x22, 0x22, 0x34, 0x20, 0x23, 0x13, 0x22, 0x20, 0x01, 0x62, 0x21,
+  0x62, 0x21, 0x62, 0x21, 0x62, 0x21, 0x62, 0x21, 0x62, 0x21, 0x62, 0x21,
+  0x62, 0x21, 0x62, 0x22, 0x52, 0x22, 0x43, 0x2C, 0x14, 0x24, 0xA1, 0xA1,
+  0xA1, 0xA1, 0xA0, 0x38, 0x29, 0x15, 0x22, 0x16, 0x22, 0x16, 0x22, 0x16,
+  0x22, 0x16, 0x22, 0x16, 0x22, 0x25, 0x22, 0x25, 0x22, 0x43, 0x22, 0x61,
+  0x22, 0x61, 0x22, 0x61, 0x22, 0x61, 0x22, 0x61, 0x22, 0x61, 0x22, 0x61,
+  0x22, 0x61, 0x22, 0x61, 0x22, 0x61, 0x22, 0x10, 0x04, 0x31, 0x43, 0x53,
+  0x32, 0x14, 0x10, 0x21, 0x24, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21,
+  0x14, 0x22, 0x22, 0x11, 0x41, 0x11, 0x43, 0x44, 0x31, 0x21, 0x22, 0x24,
+  0x96, 0x10, 0x01, 0x31, 0x32, 0x23, 0x22, 0x32, 0x21, 0x41, 0x12, 0x34,
+  0x32, 0x11, 0x32, 0x61, 0x30, 0x31, 0xA1, 0x62, 0x92, 0x44, 0x91, 0x81,
+  0x81, 0x91, 0x72, 0x91, 0x71, 0xA1, 0x62, 0xA1, 0x61, 0x51, 0x51, 0x51,
+  0x52, 0x51, 0x42, 0x43, 0xA1, 0x42, 0x11, 0x91, 0x51, 0x21, 0x91, 0x41,
+  0x31, 0x81, 0x48, 0x52, 0x91, 0x71, 0xA1, 0x61, 0xB1, 0x20, 0x31, 0x92,
+  0x62, 0x91, 0x54, 0x81, 0x91, 0x72, 0x91, 0x71, 0xA1, 0x61, 0xB1, 0x52,
+  0xB1, 0x51, 0x35, 0x41, 0x42, 0x22, 0x32, 0x31, 0x41, 0x31, 0x42, 0x71,
+  0x92, 0x62, 0x82, 0x71, 0x73, 0x71, 0x72, 0x82, 0x62, 0x91, 0x71, 0x92,
+  0x77, 0x14, 0x91, 0x42, 0x22, 0x71, 0x51, 0x41, 0x71, 0xA1, 0x61, 0x83,
+  0x62, 0xB1, 0x51, 0xC2, 0x31, 0x81, 0x42, 0x22, 0x51, 0x22, 0x31, 0x31,
+  0x52, 0x35, 0x22, 0x43, 0xA1, 0x42, 0x11, 0x91, 0x51, 0x21, 0x82, 0x42,
+  0x21, 0x81, 0x42, 0x31, 0x72, 0x48, 0x51, 0xA1, 0x61, 0xB1, 0x20, 0x43,
+  0x73, 0xF0, 0xC3, 0x73, 0x72, 0x82, 0x63, 0x63, 0x72, 0x73, 0x72, 0x64,
+  0x62, 0x12, 0x52, 0x18, 0x45, 0x20, 0x53, 0xD3, 0xE2, 0xF0, 0xB3, 0xC4,
+  0xB4, 0xA2, 0x13, 0x92, 0x22, 0x83, 0x22, 0x82, 0x33, 0x72, 0x42, 0x63,
+  0x42, 0x62, 0x53, 0x5A, 0x4B, 0x42, 0x73, 0x32, 0x82, 0x23, 0x82, 0x22,
+  0x93, 0x12, 0xA2, 0x83, 0xC2, 0xC1, 0xF0, 0xD3, 0xC4, 0xB4, 0xA2, 0x13,
+  0x92, 0x22, 0x83, 0x22, 0x82, 0x33, 0x72, 0x42, 0x63, 0x42, 0x62, 0x53,
+  0x5A, 0x4B, 0x42, 0x73, 0x32, 0x82, 0x23, 0x82, 0x22, 0x93, 0x12, 0xA2,
+  0x63, 0xC4, 0xA2, 0x22, 0xF0, 0xA3, 0xC4, 0xB4, 0xA2, 0x13, 0x92, 0x22,
+  0x83, 0x22, 0x82, 0x33, 0x72, 0x42, 0x63, 0x42, 0x62, 0x53, 0x5A, 0x4B,
+  0x42, 0x73, 0x32, 0x82, 0x23, 0x82, 0x22, 0x93, 0x12, 0xA2, 0x62, 0x22,
+  0x86, 0x82, 0x31, 0xF0, 0xB3, 0xC4, 0xB4, 0xA2, 0x13, 0x92, 0x22, 0x83,
+  0x22, 0x82, 0x33, 0x72, 0x42, 0x63, 0x42, 0x62, 0x53, 0x5A, 0x4B, 0x42,
+  0x73, 0x32, 0x82, 0x23, 0x82, 0x22, 0x93, 0x12, 0xA2, 0x52, 0x22, 0x92,
+  0x22, 0xF0, 0xA3, 0xC4, 0xB4, 0xA2, 0x13, 0x92, 0x22, 0x83, 0x22, 0x82,
+  0x33, 0x72, 0x42, 0x63, 0x42, 0x62, 0x53, 0x5A, 0x4B, 0x42, 0x73, 0x32,
+  0x82, 0x23, 0x82, 0x22, 0x93, 0x12, 0xA2, 0x64, 0xA2, 0x21, 0xA2, 0x21,
+  0xB4, 0xF0, 0xB3, 0xC4, 0xB4, 0xA2, 0x13, 0x92, 0x22, 0x83, 0x22, 0x82,
+  0x33, 0x72, 0x42, 0x63, 0x42, 0x62, 0x53, 0x5A, 0x4B, 0x42, 0x73, 0x32,
+  0x82, 0x23, 0x82, 0x22, 0x93, 0x12, 0xA2, 0x7F, 0x7F, 0x63, 0x22, 0xF2,
+  0x32, 0xF2, 0x32, 0xE2, 0x42, 0xE2, 0x42, 0xD3, 0x4B, 0x42, 0x5B, 0x33,
+  0x52, 0xCA, 0xCA, 0xB3, 0x62, 0xB2, 0x72, 0xA3, 0x72, 0xA2, 0x8B, 0x12,
+  0x8B, 0x56, 0x79, 0x53, 0x53, 0x33, 0x73, 0x22, 0x92, 0x13, 0xC2, 0xD2,
+  0xD2, 0xD2, 0xD2, 0xD3, 0x93, 0x12, 0x92, 0x23, 0x73, 0x33, 0x53, 0x59,
+  0x86, 0xB1, 0xD3, 0xE2, 0x91, 0x32, 0xA4, 0x60, 0x33, 0xB2, 0xB2, 0xF0,
+  0x1F, 0x0B, 0xA2, 0xA2, 0xA2, 0xA2, 0xAB, 0x1B, 0x12, 0xA2, 0xA2, 0xA2,
+  0xA2, 0xA2, 0xAF, 0x09, 0x62, 0x92, 0x92, 0xF0, 0x3F, 0x0B, 0xA2, 0xA2,
+  0xA2, 0xA2, 0xAB, 0x1B, 0x12, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xAF, 0x09,
+  0x43, 0x94, 0x72, 0x22, 0xFF, 0x0B, 0xA2, 0xA2, 0xA2, 0xA2, 0xAB, 0x1B,
+  0x12, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xAF, 0x09, 0x32, 0x22, 0x62, 0x22,
+  0xFF, 0x0B, 0xA2, 0xA2, 0xA2, 0xA2, 0xAB, 0x1B, 0x12, 0xA2, 0xA2, 0xA2,
+  0xA2, 0xA2, 0xAF, 0x09, 0x12, 0x42, 0x42, 0x73, 0x23, 0x23, 0x23, 0x23,
+  0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+  0x23, 0x23, 0x31, 0xB3, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+  0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x20, 0x23, 0x35, 0x21,
+  0x32, 0x93, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+  0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x20, 0x03, 0x16, 0x13, 0x93, 0x43,
+  0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+  0x43, 0x43, 0x43, 0x20, 0x29, 0x7B, 0x52, 0x73, 0x42, 0x83, 0x32, 0x92,
+  0x32, 0x92, 0x32, 0x9B, 0x5B, 0x53, 0x22, 0x93, 0x22, 0x93, 0x22, 0x92,
+  0x32, 0x92, 0x32, 0x83, 0x32, 0x73, 0x4B, 0x59, 0x50, 0x91, 0x67, 0x61,
+  0x23, 0xF0, 0x23, 0x85, 0x86, 0x77, 0x64, 0x12, 0x64, 0x13, 0x54, 0x22,
+  0x54, 0x32, 0x44, 0x33, 0x34, 0x42, 0x34, 0x52, 0x24, 0x53, 0x14, 0x62,
+  0x14, 0x76, 0x76, 0x85, 0x83, 0x53, 0xF2, 0xF2, 0xF0, 0xC6, 0x8A, 0x54,
+  0x53, 0x33, 0x83, 0x22, 0xA6, 0xB4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC5, 0xB2,
+  0x12, 0xA3, 0x13, 0x83, 0x33, 0x63, 0x5A, 0x86, 0x50, 0x92, 0xD2, 0xD2,
+  0xF0, 0xD6, 0x8A, 0x54, 0x53, 0x33, 0x83, 0x22, 0xA6, 0xB4, 0xC4, 0xC4,
+  0xC4, 0xC4, 0xC5, 0xB2, 0x12, 0xA3, 0x13, 0x83, 0x33, 0x63, 0x5A, 0x86,
+  0x50, 0x73, 0xC4, 0xB2, 0x22, 0xF0, 0xB6, 0x8A, 0x54, 0x53, 0x33, 0x83,
+  0x22, 0xA6, 0xB4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC5, 0xB2, 0x12, 0xA3, 0x13,
+  0x83, 0x33, 0x63, 0x5A, 0x86, 0x50, 0xA2, 0x97, 0x91, 0x23, 0xF0, 0xB6,
+  0x8A, 0x54, 0x53, 0x33, 0x83, 0x22, 0xA6, 0xB4, 0xC4, 0xC4, 0xC4, 0xC4,
+  0xC5, 0xB2, 0x12, 0xA3, 0x13, 0x83, 0x33, 0x63, 0x5A, 0x86, 0x50, 0x52,
+  0x23, 0x92, 0x23, 0xF0, 0xA6, 0x8A, 0x54, 0x53, 0x33, 0x83, 0x22, 0xA6,
+  0xB4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC5, 0xB2, 0x12, 0xA3, 0x13, 0x83, 0x33,
+  0x63, 0x5A, 0x86, 0x50, 0x11, 0x61, 0x12, 0x42, 0x22, 0x22, 0x44, 0x62,
+  0x64, 0x42, 0x22, 0x22, 0x42, 0x11, 0x61, 0x56, 0x42, 0x3A, 0x12, 0x34,
+  0x54, 0x33, 0x83, 0x32, 0x85, 0x13, 0x72, 0x22, 0x12, 0x72, 0x32, 0x12,
+  0x62, 0x42, 0x12, 0x52, 0x52, 0x12, 0x42, 0x62, 0x12, 0x32, 0x72, 0x13,
+  0x12, 0x82, 0x24, 0x83, 0x23, 0x83, 0x34, 0x63, 0x32, 0x1A, 0x41, 0x46,
+  0x60, 0x43, 0xB2, 0xC2, 0xF0, 0x32, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94,
+  0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x95, 0x73, 0x13, 0x53, 0x39, 0x57,
+  0x30, 0x72, 0xA2, 0xA2, 0xF0, 0x42, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94,
+  0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x95, 0x73, 0x13, 0x53, 0x39, 0x57,
+  0x30, 0x53, 0x95, 0x72, 0x32, 0xF0, 0x12, 0x94, 0x94, 0x94, 0x94, 0x94,
+  0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x95, 0x73, 0x13, 0x53, 0x39,
+  0x57, 0x30, 0x33, 0x22, 0x63, 0x22, 0xF0, 0x12, 0x94, 0x94, 0x94, 0x94,
+  0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x95, 0x73, 0x13, 0x53,
+  0x39, 0x57, 0x30, 0x83, 0xC3, 0xC2, 0xF0, 0xA2, 0xA2, 0x23, 0x83, 0x33,
+  0x63, 0x52, 0x62, 0x63, 0x43, 0x72, 0x42, 0x83, 0x23, 0x93, 0x12, 0xB4,
+  0xC4, 0xD2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0x70, 0x02, 0xA2, 0xA2,
+  0xAA, 0x2B, 0x12, 0x75, 0x84, 0x84, 0x84, 0x75, 0x7E, 0x19, 0x32, 0xA2,
+  0xA2, 0xA2, 0xA0, 0x34, 0x58, 0x23, 0x43, 0x12, 0x62, 0x12, 0x62, 0x12,
+  0x62, 0x12, 0x53, 0x12, 0x25, 0x22, 0x25, 0x22, 0x53, 0x12, 0x65, 0x74,
+  0x74, 0x74, 0x65, 0x53, 0x12, 0x25, 0x22, 0x24, 0x30, 0x32, 0xA2, 0xA1,
+  0xF0, 0x36, 0x48, 0x23, 0x43, 0x12, 0x62, 0x92, 0x65, 0x29, 0x13, 0x52,
+  0x12, 0x62, 0x12, 0x62, 0x12, 0x53, 0x1B, 0x24, 0x23, 0x53, 0x82, 0x82,
+  0xF0, 0x36, 0x48, 0x23, 0x43, 0x12, 0x62, 0x92, 0x65, 0x29, 0x13, 0x52,
+  0x12, 0x62, 0x12, 0x62, 0x12, 0x53, 0x1B, 0x24, 0x23, 0x43, 0x83, 0x72,
+  0x12, 0x52, 0x32, 0xF6, 0x48, 0x23, 0x43, 0x12, 0x62, 0x92, 0x65, 0x29,
+  0x13, 0x52, 0x12, 0x62, 0x12, 0x62, 0x12, 0x53, 0x1B, 0x24, 0x23, 0x32,
+  0x31, 0x47, 0x82, 0xF0, 0x16, 0x48, 0x23, 0x43, 0x12, 0x62, 0x92, 0x65,
+  0x29, 0x13, 0x52, 0x12, 0x62, 0x12, 0x62, 0x12, 0x53, 0x1B, 0x24, 0x23,
+  0x23, 0x13, 0x43, 0x13, 0xF0, 0xB6, 0x48, 0x23, 0x43, 0x12, 0x62, 0x92,
+  0x65, 0x29, 0x13, 0x52, 0x12, 0x62, 0x12, 0x62, 0x12, 0x53, 0x1B, 0x24,
+  0x23, 0x34, 0x72, 0x12, 0x62, 0x12, 0x64, 0xF0, 0x26, 0x48, 0x23, 0x43,
+  0x12, 0x62, 0x92, 0x65, 0x29, 0x13, 0x52, 0x12, 0x62, 0x12, 0x62, 0x12,
+  0x53, 0x1B, 0x24, 0x23, 0x26, 0x35, 0x48, 0x17, 0x23, 0x44, 0x43, 0x12,
+  0x62, 0x62, 0x92, 0x72, 0x5E, 0x1F, 0x06, 0x52, 0x92, 0x62, 0x92, 0x62,
+  0x62, 0x12, 0x54, 0x43, 0x18, 0x18, 0x35, 0x55, 0x30, 0x35, 0x38, 0x22,
+  0x45, 0x64, 0x82, 0x82, 0x82, 0x82, 0x64, 0x62, 0x12, 0x43, 0x18, 0x45,
+  0x61, 0x93, 0x91, 0x51, 0x22, 0x54, 0x40, 0x32, 0xA2, 0xA1, 0xB1, 0x75,
+  0x48, 0x32, 0x43, 0x12, 0x62, 0x12, 0x7F, 0x0B, 0x92, 0x92, 0x62, 0x22,
+  0x43, 0x28, 0x55, 0x30, 0x62, 0x82, 0x82, 0xF0, 0x45, 0x48, 0x32, 0x43,
+  0x12, 0x62, 0x12, 0x7F, 0x0B, 0x92, 0x92, 0x62, 0x22, 0x43, 0x28, 0x55,
+  0x30, 0x43, 0x83, 0x72, 0x12, 0x52, 0x32, 0xF0, 0x15, 0x48, 0x32, 0x43,
+  0x12, 0x62, 0x12, 0x7F, 0x0B, 0x92, 0x92, 0x62, 0x22, 0x43, 0x28, 0x55,
+  0x30, 0x23, 0x13, 0x43, 0x13, 0xF0, 0xC5, 0x48, 0x32, 0x43, 0x12, 0x62,
+  0x12, 0x7F, 0x0B, 0x92, 0x92, 0x62, 0x22, 0x43, 0x28, 0x55, 0x30, 0x03,
+  0x33, 0x32, 0x82, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+  0x32, 0x32, 0x32, 0x10, 0x23, 0x22, 0x22, 0x92, 0x32, 0x32, 0x32, 0x32,
+  0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x10, 0x23, 0x24, 0x12,
+  0x23, 0x41, 0x82, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+  0x42, 0x42, 0x42, 0x20, 0x02, 0x24, 0x22, 0xF0, 0x52, 0x42, 0x42, 0x42,
+  0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x20, 0x21, 0x93,
+  0x13, 0x63, 0x62, 0x13, 0x93, 0x66, 0x38, 0x32, 0x43, 0x12, 0x62, 0x12,
+  0x74, 0x74, 0x74, 0x74, 0x74, 0x62, 0x22, 0x43, 0x28, 0x55, 0x30, 0x32,
+  0x31, 0x37, 0xF0, 0x62, 0x25, 0x12, 0x1B, 0x45, 0x55, 0x54, 0x64, 0x64,
+  0x64, 0x64, 0x64, 0x64, 0x64, 0x62, 0x32, 0xA2, 0xA1, 0xB1, 0x75, 0x48,
+  0x32, 0x43, 0x12, 0x62, 0x12, 0x74, 0x74, 0x74, 0x74, 0x74, 0x62, 0x22,
+  0x43, 0x28, 0x55, 0x30, 0x53, 0x82, 0x82, 0xF0, 0x45, 0x48, 0x32, 0x43,
+  0x12, 0x62, 0x12, 0x74, 0x74, 0x74, 0x74, 0x74, 0x62, 0x22, 0x43, 0x28,
+  0x55, 0x30, 0x43, 0x74, 0x62, 0x22, 0x51, 0x42, 0x55, 0x48, 0x32, 0x43,
+  0x12, 0x62, 0x12, 0x74, 0x74, 0x74, 0x74, 0x74, 0x62, 0x22, 0x43, 0x28,
+  0x55, 0x30, 0x32, 0x31, 0x47, 0xF0, 0xC5, 0x48, 0x32, 0x43, 0x12, 0x62,
+  0x12, 0x74, 0x74, 0x74, 0x74, 0x74, 0x62, 0x22, 0x43, 0x28, 0x55, 0x30,
+  0x22, 0x23, 0x42, 0x23, 0xF0, 0xC5, 0x48, 0x32, 0x43, 0x12, 0x62, 0x12,
+  0x74, 0x74, 0x74, 0x74, 0x74, 0x62, 0x22, 0x43, 0x28, 0x55, 0x30, 0x52,
+  0xA2, 0xF0, 0xEF, 0x09, 0xF0, 0xF0, 0xB2, 0xA2, 0x50, 0x45, 0x21, 0x2A,
+  0x22, 0x43, 0x22, 0x53, 0x22, 0x45, 0x12, 0x41, 0x22, 0x12, 0x31, 0x32,
+  0x12, 0x21, 0x42, 0x12, 0x11, 0x43, 0x13, 0x52, 0x32, 0x43, 0x29, 0x22,
+  0x25, 0x30, 0x23, 0x83, 0x82, 0xE2, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+  0x64, 0x64, 0x64, 0x65, 0x43, 0x19, 0x25, 0x12, 0xA0, 0x62, 0x72, 0x72,
+  0xE2, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x65, 0x43,
+  0x19, 0x25, 0x12, 0xA0, 0x43, 0x64, 0x61, 0x22, 0x41, 0x42, 0x12, 0x64,
+  0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x65, 0x43, 0x19, 0x25,
+  0x12, 0xA0, 0x22, 0x23, 0x32, 0x23, 0xF0, 0x62, 0x64, 0x64, 0x64, 0x64,
+  0x64, 0x64, 0x64, 0x64, 0x64, 0x65, 0x43, 0x19, 0x25, 0x12, 0xA0, 0x63,
+  0x82, 0x82, 0xF2, 0x72, 0x12, 0x52, 0x22, 0x52, 0x22, 0x52, 0x32, 0x32,
+  0x42, 0x32, 0x42, 0x32, 0x52, 0x12, 0x62, 0x12, 0x62, 0x12, 0x73, 0x83,
+  0x83, 0x82, 0x92, 0x83, 0x64, 0x73, 0x70, 0x02, 0x92, 0x92, 0x92, 0x92,
+  0x24, 0x32, 0x17, 0x14, 0x42, 0x13, 0x65, 0x64, 0x74, 0x74, 0x75, 0x65,
+  0x66, 0x42, 0x12, 0x17, 0x12, 0x24, 0x32, 0x92, 0x92, 0x92, 0x92, 0x90,
+  0x32, 0x22, 0x52, 0x22, 0xF0, 0x92, 0x72, 0x12, 0x52, 0x22, 0x52, 0x22,
+  0x52, 0x32, 0x32, 0x42, 0x32, 0x42, 0x32, 0x52, 0x12, 0x62, 0x12, 0x62,
+  0x12, 0x73, 0x83, 0x83, 0x82, 0x92, 0x83, 0x64, 0x73, 0x70 };
+
+constexpr GFXglyph FreeSans_RLE_12pt8bGlyphs[] PROGMEM = {
+  {     0,   1,   1,   6,    0,    0 },   // 0x20 ' '
+  {     1,   2,  17,   8,    3,  -16 },   // 0x21 '!'
+  {     4,   6,   6,   8,    1,  -16 },   // 0x22 '"'
+  {    12,  13,  16,  13,    0,  -15 },   // 0x23 '#'
+  {    41,  11,  21,  13,    1,  -18 },   // 0x24 '$'
+  {    77,  19,  17,  21,    1,  -16 },   // 0x25 '%'
+  {   120,  14,  17,  16,    1,  -16 },   // 0x26 '&'
+  {   151,   2,   6,   5,    1,  -16 },   // 0x27 '''
+  {   154,   5,  22,   8,    2,  -16 },   // 0x28 '('
+  {   177,   5,  22,   8,    1,  -16 },   // 0x29 ')'
+  {   200,   7,   7,   9,    1,  -16 },   // 0x2A '*'
+  {   208,  12,  11,  14,    1,  -10 },   // 0x2B '+'
+  {   220,   3,   6,   7,    2,   -1 },   // 0x2C ','
+  {   226,   6,   2,   8,    1,   -6 },   // 0x2D '-'
+  {   227,   2,   2,   6,    2,   -1 },   // 0x2E '.'
+  {   228,   7,  17,   7,    0,  -16 },   // 0x2F '/'
+  {   246,  11,  17,  13,    1,  -16 },   // 0x30 '0'
+  {   270,   6,  17,  13,    2,  -16 },   // 0x31 '1'
+  {   286,  11,  17,  13,    1,  -16 },   // 0x32 '2'
+  {   305,  11,  17,  13,    1,  -16 },   // 0x33 '3'
+  {   326,  11,  17,  13,    1,  -16 },   // 0x34 '4'
+  {   351,  11,  17,  13,    1,  -16 },   // 0x35 '5'
+  {   370,  11,  17,  13,    1,  -16 },   // 0x36 '6'
+  {   396,  11,  17,  13,    1,  -16 },   // 0x37 '7'
+  {   414,  11,  17,  13,    1,  -16 },   // 0x38 '8'
+  {   440,  11,  17,  13,    1,  -16 },   // 0x39 '9'
+  {   466,   2,  13,   6,    2,  -12 },   // 0x3A ':'
+  {   469,   2,  17,   6,    2,  -12 },   // 0x3B ';'
+  {   476,  12,  11,  14,    1,  -10 },   // 0x3C '<'
+  {   487,  12,   6,  14,    1,   -7 },   // 0x3D '='
+  {   492,  12,  11,  14,    1,  -10 },   // 0x3E '>'
+  {   504,  10,  17,  13,    2,  -16 },   // 0x3F '?'
+  {   522,  21,  20,  24,    1,  -16 },   // 0x40 '@'
+  {   572,  15,  17,  16,    0,  -16 },   // 0x41 'A'
+  {   601,  13,  17,  16,    2,  -16 },   // 0x42 'B'
+  {   628,  15,  17,  17,    1,  -16 },   // 0x43 'C'
+  {   653,  13,  17,  16,    2,  -16 },   // 0x44 'D'
+  {   675,  12,  17,  15,    2,  -16 },   // 0x45 'E'
+  {   691,  11,  17,  14,    2,  -16 },   // 0x46 'F'
+  {   708,  16,  17,  18,    1,  -16 },   // 0x47 'G'
+  {   734,  13,  17,  17,    2,  -16 },   // 0x48 'H'
+  {   751,   3,  17,   7,    2,  -16 },   // 0x49 'I'
+  {   755,   9,  17,  12,    1,  -16 },   // 0x4A 'J'
+  {   773,  13,  17,  16,    2,  -16 },   // 0x4B 'K'
+  {   805,  11,  17,  13,    2,  -16 },   // 0x4C 'L'
+  {   822,  16,  17,  20,    2,  -16 },   // 0x4D 'M'
+  {   862,  13,  17,  17,    2,  -16 },   // 0x4E 'N'
+  {   889,  16,  17,  18,    1,  -16 },   // 0x4F 'O'
+  {   913,  12,  17,  15,    2,  -16 },   // 0x50 'P'
+  {   931,  16,  18,  18,    1,  -16 },   // 0x51 'Q'
+  {   958,  14,  17,  17,    2,  -16 },   // 0x52 'R'
+  {   988,  14,  17,  16,    1,  -16 },   // 0x53 'S'
+  {  1011,  13,  17,  15,    1,  -16 },   // 0x54 'T'
+  {  1029,  13,  17,  17,    2,  -16 },   // 0x55 'U'
+  {  1049,  15,  17,  15,    0,  -16 },   // 0x56 'V'
+  {  1081,  22,  17,  22,    0,  -16 },   // 0x57 'W'
+  {  1135,  15,  17,  15,    0,  -16 },   // 0x58 'X'
+  {  1165,  16,  17,  16,    0,  -16 },   // 0x59 'Y'
+  {  1191,  13,  17,  14,    1,  -16 },   // 0x5A 'Z'
+  {  1208,   5,  22,   7,    1,  -16 },   // 0x5B '['
+  {  1227,   7,  17,   7,    0,  -16 },   // 0x5C '\'
+  {  1244,   4,  22,   7,    1,  -16 },   // 0x5D ']'
+  {  1263,   9,   9,  11,    1,  -16 },   // 0x5E '^'
+  {  1279,  15,   1,  13,   -1,    4 },   // 0x5F '_'
+  {  1280,   4,   3,   6,    1,  -16 },   // 0x60 '`'
+  {  1283,  11,  13,  13,    1,  -12 },   // 0x61 'a'
+  {  1303,  11,  17,  13,    1,  -16 },   // 0x62 'b'
+  {  1325,  10,  13,  12,    1,  -12 },   // 0x63 'c'
+  {  1341,  11,  18,  13,    1,  -16 },   // 0x64 'd'
+  {  1364,  11,  13,  13,    1,  -12 },   // 0x65 'e'
+  {  1381,   6,  17,   7,    0,  -16 },   // 0x66 'f'
+  {  1398,  11,  18,  13,    1,  -12 },   // 0x67 'g'
+  {  1425,  10,  17,  13,    1,  -16 },   // 0x68 'h'
+  {  1444,   2,  17,   5,    2,  -16 },   // 0x69 'i'
+  {  1447,   4,  22,   6,    0,  -16 },   // 0x6A 'j'
+  {  1466,  11,  17,  12,    1,  -16 },   // 0x6B 'k'
+  {  1495,   2,  17,   5,    1,  -16 },   // 0x6C 'l'
+  {  1498,  17,  13,  19,    1,  -12 },   // 0x6D 'm'
+  {  1526,  10,  13,  13,    1,  -12 },   // 0x6E 'n'
+  {  1541,  11,  13,  13,    1,  -12 },   // 0x6F 'o'
+  {  1559,  11,  18,  13,    1,  -12 },   // 0x70 'p'
+  {  1583,  11,  18,  13,    1,  -12 },   // 0x71 'q'
+  {  1606,   6,  13,   8,    1,  -12 },   // 0x72 'r'
+  {  1620,  10,  13,  12,    1,  -12 },   // 0x73 's'
+  {  1636,   6,  16,   7,    0,  -15 },   // 0x74 't'
+  {  1651,  10,  14,  13,    1,  -12 },   // 0x75 'u'
+  {  1667,  11,  13,  12,    0,  -12 },   // 0x76 'v'
+  {  1691,  17,  13,  17,    0,  -12 },   // 0x77 'w'
+  {  1731,  11,  13,  11,    0,  -12 },   // 0x78 'x'
+  {  1753,  11,  18,  11,    0,  -12 },   // 0x79 'y'
+  {  1782,  10,  13,  11,    1,  -12 },   // 0x7A 'z'
+  {  1795,   5,  22,   8,    1,  -16 },   // 0x7B '{'
+  {  1817,   2,  22,   6,    2,  -16 },   // 0x7C '|'
+  {  1820,   6,  22,   8,    1,  -16 },   // 0x7D '}'
+  {  1843,  10,   5,  12,    1,  -10 },   // 0x7E '~'
+  {  1851,  17,  22,  19,    1,  -18 },   // 0x7F ''
+  {  1891,  17,  22,  19,    1,  -18 },   // 0x80 ''
+  {  1931,  17,  22,  19,    1,  -18 },   // 0x81 ''
+  {  1971,  17,  22,  19,    1,  -18 },   // 0x82 ''
+  {  2011,  17,  22,  19,    1,  -18 },   // 0x83 ''
+  {  2051,  17,  22,  19,    1,  -18 },   // 0x84 ''
+  {  2091,  17,  22,  19,    1,  -18 },   // 0x85 ''
+  {  2131,  17,  22,  19,    1,  -18 },   // 0x86 ''
+  {  2171,  17,  22,  19,    1,  -18 },   // 0x87 ''
+  {  2211,  17,  22,  19,    1,  -18 },   // 0x88 ''
+  {  2251,  17,  22,  19,    1,  -18 },   // 0x89 ''
+  {  2291,  17,  22,  19,    1,  -18 },   // 0x8A ''
+  {  2331,  17,  22,  19,    1,  -18 },   // 0x8B ''
+  {  2371,  17,  22,  19,    1,  -18 },   // 0x8C ''
+  {  2411,  17,  22,  19,    1,  -18 },   // 0x8D ''
+  {  2451,  17,  22,  19,    1,  -18 },   // 0x8E ''
+  {  2491,  17,  22,  19,    1,  -18 },   // 0x8F ''
+  {  2531,  17,  22,  19,    1,  -18 },   // 0x90 ''
+  {  2571,  17,  22,  19,    1,  -18 },   // 0x91 ''
+  {  2611,  17,  22,  19,    1,  -18 },   // 0x92 ''
+  {  2651,  17,  22,  19,    1,  -18 },   // 0x93 ''
+  {  2691,  17,  22,  19,    1,  -18 },   // 0x94 ''
+  {  2731,  17,  22,  19,    1,  -18 },   // 0x95 ''
+  {  2771,  17,  22,  19,    1,  -18 },   // 0x96 ''
+  {  2811,  17,  22,  19,    1,  -18 },   // 0x97 ''
+  {  2851,  17,  22,  19,    1,  -18 },   // 0x98 ''
+  {  2891,  17,  22,  19,    1,  -18 },   // 0x99 ''
+  {  2931,  17,  22,  19,    1,  -18 },   // 0x9A ''
+  {  2971,  17,  22,  19,    1,  -18 },   // 0x9B ''
+  {  3011,  17,  22,  19,    1,  -18 },   // 0x9C ''
+  {  3051,  17,  22,  19,    1,  -18 },   // 0x9D ''
+  {  3091,  17,  22,  19,    1,  -18 },   // 0x9E ''
+  {  3131,  17,  22,  19,    1,  -18 },   // 0x9F ''
+  {  3171,   1,   1,   7,    0,    0 },   // 0xA0 ''
+  {  3172,   2,  17,   8,    3,  -11 },   // 0xA1 ''
+  {  3176,  11,  17,  13,    1,  -14 },   // 0xA2 ''
+  {  3207,  12,  17,  13,    1,  -16 },   // 0xA3 ''
+  {  3230,   9,  10,  13,    2,  -12 },   // 0xA4 ''
+  {  3240,  13,  17,  13,    0,  -16 },   // 0xA5 ''
+  {  3266,   2,  22,   6,    2,  -16 },   // 0xA6 ''
+  {  3270,  11,  22,  13,    1,  -16 },   // 0xA7 ''
+  {  3305,   6,   2,   8,    1,  -16 },   // 0xA8 ''
+  {  3308,  17,  17,  19,    1,  -16 },   // 0xA9 ''
+  {  3352,   7,  10,   9,    1,  -16 },   // 0xAA ''
+  {  3366,   8,   8,  12,    2,   -9 },   // 0xAB ''
+  {  3380,  12,   7,  14,    1,   -8 },   // 0xAC ''
+  {  3387,   6,   2,   8,    1,   -6 },   // 0xAD ''
+  {  3388,  17,  17,  19,    1,  -16 },   // 0xAE ''
+  {  3431,   6,   2,   8,    1,  -16 },   // 0xAF ''
+  {  3432,   7,   7,  14,    4,  -15 },   // 0xB0 ''
+  {  3444,  12,  15,  14,    1,  -14 },   // 0xB1 ''
+  {  3459,   8,  10,   8,    0,  -18 },   // 0xB2 ''
+  {  3471,   8,  10,   8,    0,  -18 },   // 0xB3 ''
+  {  3485,   5,   3,   8,    2,  -16 },   // 0xB4 ''
+  {  3489,  11,  18,  13,    2,  -12 },   // 0xB5 ''
+  {  3519,  11,  21,  13,    1,  -16 },   // 0xB6 ''
+  {  3560,   2,   2,   6,    2,   -7 },   // 0xB7 ''
+  {  3561,   6,   5,   8,    1,    1 },   // 0xB8 ''
+  {  3567,   3,  10,   8,    2,  -18 },   // 0xB9 ''
+  {  3576,   7,  10,   9,    1,  -16 },   // 0xBA ''
+  {  3590,   8,   8,  12,    2,   -9 },   // 0xBB ''
+  {  3605,  19,  17,  20,    1,  -16 },   // 0xBC ''
+  {  3646,  19,  17,  20,    1,  -16 },   // 0xBD ''
+  {  3685,  19,  17,  21,    1,  -16 },   // 0xBE ''
+  {  3731,  10,  17,  13,    2,  -11 },   // 0xBF ''
+  {  3750,  15,  21,  16,    0,  -20 },   // 0xC0 ''
+  {  3783,  15,  21,  16,    0,  -20 },   // 0xC1 ''
+  {  3816,  15,  21,  16,    0,  -20 },   // 0xC2 ''
+  {  3850,  15,  21,  16,    0,  -20 },   // 0xC3 ''
+  {  3885,  15,  20,  16,    0,  -19 },   // 0xC4 ''
+  {  3919,  15,  22,  16,    0,  -21 },   // 0xC5 ''
+  {  3955,  22,  17,  23,    0,  -16 },   // 0xC6 ''
+  {  3985,  15,  22,  17,    1,  -16 },   // 0xC7 ''
+  {  4016,  12,  21,  15,    2,  -20 },   // 0xC8 ''
+  {  4036,  12,  21,  15,    2,  -20 },   // 0xC9 ''
+  {  4056,  12,  21,  15,    2,  -20 },   // 0xCA ''
+  {  4076,  12,  20,  15,    2,  -19 },   // 0xCB ''
+  {  4096,   5,  21,   7,    0,  -20 },   // 0xCC ''
+  {  4116,   6,  21,   7,    1,  -20 },   // 0xCD ''
+  {  4137,   7,  21,   7,    0,  -20 },   // 0xCE ''
+  {  4159,   7,  20,   7,    0,  -19 },   // 0xCF ''
+  {  4180,  16,  17,  17,    0,  -16 },   // 0xD0 ''
+  {  4209,  13,  21,  17,    2,  -20 },   // 0xD1 ''
+  {  4241,  16,  21,  18,    1,  -20 },   // 0xD2 ''
+  {  4269,  16,  21,  18,    1,  -20 },   // 0xD3 ''
+  {  4297,  16,  21,  18,    1,  -20 },   // 0xD4 ''
+  {  4326,  16,  21,  18,    1,  -20 },   // 0xD5 ''
+  {  4355,  16,  20,  18,    1,  -19 },   // 0xD6 ''
+  {  4384,   9,   9,  14,    2,   -9 },   // 0xD7 ''
+  {  4399,  17,  17,  19,    1,  -16 },   // 0xD8 ''
+  {  4441,  13,  21,  17,    2,  -20 },   // 0xD9 ''
+  {  4465,  13,  21,  17,    2,  -20 },   // 0xDA ''
+  {  4489,  13,  21,  17,    2,  -20 },   // 0xDB ''
+  {  4514,  13,  20,  17,    2,  -19 },   // 0xDC ''
+  {  4539,  16,  21,  16,    0,  -20 },   // 0xDD ''
+  {  4569,  12,  17,  15,    2,  -16 },   // 0xDE ''
+  {  4587,  11,  18,  14,    2,  -17 },   // 0xDF ''
+  {  4617,  11,  17,  13,    1,  -16 },   // 0xE0 ''
+  {  4641,  11,  17,  13,    1,  -16 },   // 0xE1 ''
+  {  4665,  11,  18,  13,    1,  -17 },   // 0xE2 ''
+  {  4691,  11,  17,  13,    1,  -16 },   // 0xE3 ''
+  {  4716,  11,  17,  13,    1,  -16 },   // 0xE4 ''
+  {  4741,  11,  18,  13,    1,  -17 },   // 0xE5 ''
+  {  4768,  19,  13,  20,    1,  -12 },   // 0xE6 ''
+  {  4797,  10,  18,  12,    1,  -12 },   // 0xE7 ''
+  {  4819,  11,  17,  13,    1,  -16 },   // 0xE8 ''
+  {  4840,  11,  17,  13,    1,  -16 },   // 0xE9 ''
+  {  4861,  11,  18,  13,    1,  -17 },   // 0xEA ''
+  {  4885,  11,  17,  13,    1,  -16 },   // 0xEB ''
+  {  4907,   5,  17,   5,    0,  -16 },   // 0xEC ''
+  {  4924,   5,  17,   5,    0,  -16 },   // 0xED ''
+  {  4941,   6,  18,   6,    0,  -17 },   // 0xEE ''
+  {  4960,   6,  18,   6,    0,  -17 },   // 0xEF ''
+  {  4978,  11,  18,  13,    1,  -17 },   // 0xF0 ''
+  {  5003,  10,  17,  13,    1,  -16 },   // 0xF1 ''
+  {  5022,  11,  17,  13,    1,  -16 },   // 0xF2 ''
+  {  5044,  11,  17,  13,    1,  -16 },   // 0xF3 ''
+  {  5066,  11,  17,  13,    1,  -16 },   // 0xF4 ''
+  {  5090,  11,  17,  13,    1,  -16 },   // 0xF5 ''
+  {  5112,  11,  17,  13,    1,  -16 },   // 0xF6 ''
+  {  5135,  12,  11,  14,    1,  -10 },   // 0xF7 ''
+  {  5145,  12,  13,  13,    0,  -12 },   // 0xF8 ''
+  {  5174,  10,  18,  13,    1,  -16 },   // 0xF9 ''
+  {  5193,  10,  18,  13,    1,  -16 },   // 0xFA ''
+  {  5212,  10,  18,  13,    1,  -16 },   // 0xFB ''
+  {  5234,  10,  18,  13,    1,  -16 },   // 0xFC ''
+  {  5255,  11,  22,  11,    0,  -16 },   // 0xFD ''
+  {  5287,  11,  22,  13,    1,  -16 },   // 0xFE ''
+  {  5316,  11,  22,  11,    0,  -16 } }; // 0xFF ''
+
+constexpr GFXfont FreeSans_RLE_12pt8b PROGMEM = {
+  (uint8_t  *)FreeSans_RLE_12pt8bBitmaps,
+  (GFXglyph *)FreeSans_RLE_12pt8bGlyphs,
+  0x20, 0xFF, 28 };
+
+// Approx. 6925 bytes
@@ -0,0 +1,788 @@
+// Run-length encoded glyph bitmaps (fontconvert -r)
+#define FreeSans_RLE_14pt8b_RLE
+
+const uint8_t FreeSans_RLE_14pt8bBitmaps[] PROGMEM = {
+  0x10, 0x0F, 0x0F, 0x12, 0x11, 0x21, 0x21, 0x21, 0x79, 0x03, 0x16, 0x16,
+  0x16, 0x24, 0x32, 0x11, 0x32, 0x11, 0x31, 0x10, 0x62, 0x32, 0x72, 0x42,
+  0x72, 0x42, 0x72, 0x42, 0x72, 0x32, 0x4E, 0x1E, 0x42, 0x42, 0x72, 0x42,
+  0x72, 0x33, 0x72, 0x32, 0x82, 0x32, 0x4E, 0x1E, 0x42, 0x42, 0x72, 0x32,
+  0x82, 0x32, 0x73, 0x32, 0x72, 0x42, 0x50, 0x61, 0xA5, 0x69, 0x33, 0x21,
+  0x23, 0x22, 0x31, 0x32, 0x13, 0x31, 0x35, 0x41, 0x63, 0x31, 0x73, 0x21,
+  0x76, 0x88, 0x87, 0x71, 0x24, 0x61, 0x33, 0x61, 0x44, 0x41, 0x44, 0x41,
+  0x45, 0x31, 0x33, 0x13, 0x21, 0x23, 0x39, 0x57, 0x91, 0xC1, 0xC1, 0x60,
+  0xF2, 0x85, 0x82, 0x77, 0x62, 0x73, 0x33, 0x52, 0x72, 0x52, 0x42, 0x82,
+  0x52, 0x41, 0x93, 0x33, 0x32, 0xA7, 0x32, 0xC5, 0x42, 0xF0, 0x52, 0xF0,
+  0x62, 0x44, 0xC2, 0x37, 0xB1, 0x42, 0x42, 0x92, 0x32, 0x52, 0x82, 0x42,
+  0x62, 0x72, 0x42, 0x52, 0x72, 0x62, 0x42, 0x72, 0x67, 0x72, 0x94, 0x30,
+  0x55, 0xA7, 0x83, 0x32, 0x82, 0x43, 0x72, 0x52, 0x72, 0x43, 0x73, 0x23,
+  0x96, 0xB4, 0xA6, 0x93, 0x22, 0x33, 0x23, 0x33, 0x23, 0x22, 0x53, 0x12,
+  0x23, 0x65, 0x23, 0x73, 0x42, 0x74, 0x34, 0x36, 0x48, 0x23, 0x46, 0x43,
+  0x09, 0x12, 0x12, 0x12, 0x11, 0x10, 0x42, 0x32, 0x42, 0x32, 0x42, 0x32,
+  0x42, 0x42, 0x33, 0x32, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x52,
+  0x42, 0x42, 0x42, 0x52, 0x42, 0x52, 0x51, 0x52, 0x02, 0x52, 0x42, 0x52,
+  0x42, 0x52, 0x42, 0x42, 0x42, 0x43, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+  0x33, 0x32, 0x42, 0x42, 0x32, 0x42, 0x42, 0x32, 0x41, 0x42, 0x40, 0x32,
+  0x62, 0x32, 0x12, 0x29, 0x32, 0x54, 0x32, 0x22, 0x31, 0x31, 0x10, 0x62,
+  0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0x6F, 0x0D, 0x62, 0xC2, 0xC2, 0xC2, 0xC2,
+  0x60, 0x09, 0x21, 0x21, 0x14, 0x10, 0x0E, 0x09, 0x62, 0x61, 0x62, 0x62,
+  0x61, 0x62, 0x62, 0x61, 0x62, 0x62, 0x61, 0x71, 0x62, 0x61, 0x71, 0x62,
+  0x61, 0x71, 0x62, 0x61, 0x70, 0x45, 0x78, 0x43, 0x33, 0x33, 0x53, 0x22,
+  0x72, 0x22, 0x72, 0x13, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x73, 0x12,
+  0x72, 0x22, 0x72, 0x23, 0x53, 0x33, 0x33, 0x57, 0x75, 0x40, 0x52, 0x43,
+  0x43, 0x2F, 0x04, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+  0x43, 0x43, 0x43, 0x43, 0x45, 0x69, 0x34, 0x34, 0x23, 0x63, 0x12, 0x76,
+  0x76, 0x73, 0xA3, 0x93, 0x93, 0x84, 0x75, 0x74, 0x83, 0x93, 0x93, 0xA3,
+  0xAF, 0x0B, 0x45, 0x69, 0x33, 0x44, 0x22, 0x63, 0x13, 0x72, 0x13, 0x72,
+  0xB2, 0x94, 0x65, 0x86, 0xB3, 0xB3, 0xA5, 0x86, 0x76, 0x72, 0x23, 0x44,
+  0x39, 0x56, 0x40, 0x82, 0xA3, 0xA3, 0x94, 0x85, 0x73, 0x12, 0x72, 0x22,
+  0x62, 0x32, 0x53, 0x32, 0x43, 0x42, 0x42, 0x52, 0x32, 0x62, 0x3F, 0x0B,
+  0x82, 0xB2, 0xB2, 0xB2, 0xB2, 0x30, 0x2A, 0x3A, 0x32, 0xA3, 0xA3, 0xA2,
+  0xB2, 0x15, 0x5A, 0x34, 0x34, 0x22, 0x72, 0xB3, 0xA3, 0xB2, 0xB5, 0x76,
+  0x72, 0x23, 0x44, 0x39, 0x65, 0x40, 0x54, 0x78, 0x44, 0x24, 0x23, 0x62,
+  0x22, 0x73, 0x12, 0xA3, 0xA3, 0x16, 0x3B, 0x25, 0x43, 0x14, 0x66, 0x76,
+  0x85, 0x82, 0x12, 0x73, 0x13, 0x62, 0x33, 0x34, 0x39, 0x65, 0x40, 0x0F,
+  0x0B, 0xB2, 0xA2, 0xA2, 0xB2, 0xA2, 0xA3, 0xA2, 0xA2, 0xB2, 0xA3, 0xA2,
+  0xA3, 0xA2, 0xB2, 0xA3, 0xA3, 0xA2, 0x80, 0x45, 0x69, 0x34, 0x34, 0x23,
+  0x53, 0x22, 0x72, 0x22, 0x72, 0x23, 0x62, 0x24, 0x34, 0x47, 0x59, 0x33,
+  0x53, 0x13, 0x76, 0x75, 0x95, 0x76, 0x73, 0x14, 0x34, 0x39, 0x65, 0x40,
+  0x45, 0x69, 0x34, 0x33, 0x32, 0x63, 0x13, 0x72, 0x13, 0x76, 0x76, 0x76,
+  0x73, 0x13, 0x45, 0x2B, 0x36, 0x13, 0xA3, 0xA2, 0x13, 0x72, 0x22, 0x63,
+  0x23, 0x43, 0x48, 0x75, 0x40, 0x09, 0xF0, 0xC9, 0x09, 0xF0, 0xC9, 0x21,
+  0x21, 0x14, 0x10, 0xC2, 0xA4, 0x75, 0x75, 0x65, 0x75, 0x93, 0xC5, 0xB5,
+  0xB5, 0xC5, 0xB4, 0xC2, 0x0F, 0x0D, 0xF0, 0xF0, 0xCF, 0x0D, 0x02, 0xC4,
+  0xC5, 0xB5, 0xC5, 0xB5, 0xB3, 0x94, 0x75, 0x75, 0x65, 0x84, 0xA2, 0xC0,
+  0x36, 0x58, 0x33, 0x43, 0x22, 0x66, 0x65, 0x73, 0x93, 0x92, 0x93, 0x83,
+  0x83, 0x83, 0x92, 0xA2, 0xA2, 0xF0, 0xF0, 0x42, 0xA2, 0xA2, 0x50, 0xA7,
+  0xFC, 0xC4, 0x65, 0x84, 0xA4, 0x63, 0xE3, 0x43, 0xF0, 0x13, 0x32, 0x74,
+  0x63, 0x23, 0x57, 0x12, 0x33, 0x12, 0x53, 0x44, 0x36, 0x43, 0x63, 0x44,
+  0x52, 0x72, 0x54, 0x43, 0x63, 0x54, 0x43, 0x62, 0x55, 0x43, 0x62, 0x52,
+  0x12, 0x43, 0x53, 0x43, 0x13, 0x43, 0x34, 0x33, 0x32, 0x47, 0x17, 0x43,
+  0x54, 0x26, 0x63, 0xF0, 0x74, 0xF0, 0x74, 0xF0, 0x85, 0x62, 0xDC, 0xF0,
+  0x17, 0x90, 0x74, 0xE4, 0xE5, 0xC6, 0xC3, 0x12, 0xC2, 0x23, 0xA3, 0x23,
+  0xA2, 0x42, 0x93, 0x43, 0x83, 0x43, 0x82, 0x63, 0x63, 0x63, 0x6C, 0x6D,
+  0x43, 0x83, 0x43, 0x83, 0x42, 0xA3, 0x23, 0xA3, 0x23, 0xA3, 0x22, 0xC3,
+  0x0B, 0x4D, 0x23, 0x74, 0x13, 0x83, 0x13, 0x92, 0x13, 0x92, 0x13, 0x92,
+  0x13, 0x83, 0x13, 0x73, 0x2C, 0x3D, 0x23, 0x83, 0x13, 0x96, 0x96, 0xA5,
+  0x96, 0x96, 0x74, 0x1D, 0x2C, 0x30, 0x66, 0x9A, 0x64, 0x44, 0x43, 0x83,
+  0x23, 0xA2, 0x23, 0xA3, 0x12, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xC2,
+  0x12, 0xB3, 0x13, 0xA3, 0x13, 0xA3, 0x23, 0x83, 0x44, 0x44, 0x6A, 0x96,
+  0x50, 0x0B, 0x5D, 0x33, 0x65, 0x23, 0x83, 0x23, 0x93, 0x13, 0xA2, 0x13,
+  0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA2, 0x13, 0x93, 0x13,
+  0x83, 0x23, 0x65, 0x2D, 0x3B, 0x50, 0x0E, 0x1E, 0x13, 0xC3, 0xC3, 0xC3,
+  0xC3, 0xC3, 0xC3, 0xCE, 0x1E, 0x13, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3,
+  0xCF, 0x0F, 0x0F, 0x0F, 0x01, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xBC,
+  0x2C, 0x23, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB0, 0x67,
+  0x9B, 0x65, 0x44, 0x43, 0x93, 0x23, 0xB3, 0x13, 0xB3, 0x12, 0xF3, 0xF3,
+  0xF3, 0x7B, 0x7B, 0xD5, 0xD2, 0x12, 0xD2, 0x13, 0xB3, 0x13, 0xB3, 0x24,
+  0x84, 0x35, 0x37, 0x4B, 0x12, 0x67, 0x41, 0xF0, 0x30, 0x03, 0xA6, 0xA6,
+  0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xAF, 0x0F, 0x08, 0xA6, 0xA6, 0xA6,
+  0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA3, 0x0F, 0x0F, 0x0A, 0x92, 0x92, 0x92,
+  0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x95, 0x65, 0x65,
+  0x56, 0x53, 0x13, 0x33, 0x29, 0x45, 0x30, 0x03, 0x97, 0x84, 0x13, 0x74,
+  0x23, 0x64, 0x33, 0x54, 0x43, 0x44, 0x53, 0x34, 0x63, 0x24, 0x73, 0x14,
+  0x89, 0x75, 0x22, 0x74, 0x33, 0x63, 0x53, 0x53, 0x63, 0x43, 0x63, 0x43,
+  0x73, 0x33, 0x83, 0x23, 0x83, 0x23, 0x93, 0x13, 0xA3, 0x03, 0xA3, 0xA3,
+  0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3,
+  0xA3, 0xA3, 0xA3, 0xAF, 0x0B, 0x04, 0xB8, 0xB9, 0xA9, 0x92, 0x17, 0x92,
+  0x18, 0x82, 0x15, 0x12, 0x72, 0x25, 0x12, 0x72, 0x25, 0x13, 0x62, 0x25,
+  0x22, 0x52, 0x35, 0x22, 0x52, 0x35, 0x23, 0x42, 0x35, 0x32, 0x32, 0x45,
+  0x32, 0x32, 0x45, 0x33, 0x22, 0x45, 0x42, 0x12, 0x55, 0x42, 0x12, 0x55,
+  0x45, 0x55, 0x53, 0x65, 0x53, 0x62, 0x03, 0xA7, 0x98, 0x88, 0x89, 0x76,
+  0x12, 0x76, 0x13, 0x66, 0x23, 0x56, 0x32, 0x56, 0x33, 0x46, 0x43, 0x36,
+  0x43, 0x36, 0x53, 0x26, 0x63, 0x16, 0x63, 0x16, 0x79, 0x88, 0x88, 0x97,
+  0xA3, 0x67, 0xAB, 0x75, 0x44, 0x54, 0x83, 0x34, 0xA3, 0x23, 0xC3, 0x12,
+  0xD6, 0xD6, 0xE5, 0xE5, 0xE5, 0xE5, 0xE2, 0x12, 0xD3, 0x13, 0xC3, 0x13,
+  0xB3, 0x34, 0x83, 0x55, 0x44, 0x7B, 0xA7, 0x60, 0x0B, 0x4D, 0x23, 0x74,
+  0x13, 0x83, 0x13, 0x96, 0x96, 0x96, 0x83, 0x13, 0x74, 0x1D, 0x2C, 0x33,
+  0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC0, 0x67, 0xAB, 0x75,
+  0x44, 0x54, 0x83, 0x34, 0xA3, 0x23, 0xC2, 0x22, 0xD6, 0xE5, 0xE5, 0xE5,
+  0xE5, 0xE5, 0xE2, 0x12, 0xD3, 0x13, 0x81, 0x32, 0x23, 0x73, 0x13, 0x34,
+  0x65, 0x55, 0x45, 0x6E, 0x77, 0x33, 0xF0, 0x21, 0x10, 0x0C, 0x4E, 0x23,
+  0x84, 0x13, 0x93, 0x13, 0xA2, 0x13, 0xA2, 0x13, 0xA2, 0x13, 0x93, 0x13,
+  0x83, 0x2D, 0x3D, 0x33, 0x83, 0x23, 0x93, 0x13, 0x93, 0x13, 0xA2, 0x13,
+  0xA2, 0x13, 0xA2, 0x13, 0xA2, 0x13, 0xA6, 0xA3, 0x56, 0x8A, 0x54, 0x44,
+  0x33, 0x83, 0x23, 0x92, 0x23, 0x92, 0x23, 0xD4, 0xD6, 0xB9, 0xB7, 0xD4,
+  0xE6, 0xA6, 0xA3, 0x12, 0xA3, 0x13, 0x92, 0x35, 0x35, 0x4B, 0x77, 0x40,
+  0x0F, 0x0F, 0x02, 0x63, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3,
+  0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0x70, 0x03, 0xA6,
+  0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6,
+  0xA6, 0xA2, 0x13, 0xA2, 0x23, 0x83, 0x25, 0x44, 0x4B, 0x86, 0x50, 0x12,
+  0xB3, 0x13, 0xA3, 0x13, 0xA2, 0x32, 0x93, 0x33, 0x83, 0x33, 0x82, 0x52,
+  0x73, 0x53, 0x63, 0x53, 0x62, 0x72, 0x53, 0x73, 0x43, 0x82, 0x42, 0x92,
+  0x33, 0x93, 0x23, 0xA2, 0x22, 0xB6, 0xB6, 0xC4, 0xD4, 0xD4, 0x60, 0x12,
+  0x83, 0x83, 0x13, 0x74, 0x73, 0x13, 0x74, 0x73, 0x13, 0x65, 0x72, 0x32,
+  0x65, 0x63, 0x33, 0x52, 0x13, 0x53, 0x33, 0x52, 0x22, 0x53, 0x33, 0x43,
+  0x22, 0x52, 0x52, 0x42, 0x33, 0x33, 0x52, 0x42, 0x33, 0x33, 0x53, 0x32,
+  0x42, 0x33, 0x53, 0x23, 0x42, 0x32, 0x72, 0x22, 0x53, 0x22, 0x72, 0x22,
+  0x62, 0x13, 0x76, 0x62, 0x13, 0x76, 0x65, 0x94, 0x75, 0x94, 0x84, 0x94,
+  0x84, 0x93, 0x93, 0x50, 0x13, 0xA3, 0x33, 0x83, 0x53, 0x73, 0x53, 0x63,
+  0x73, 0x43, 0x93, 0x32, 0xA3, 0x23, 0xB6, 0xD4, 0xE4, 0xE4, 0xD6, 0xC2,
+  0x22, 0xB3, 0x23, 0x93, 0x43, 0x82, 0x54, 0x63, 0x63, 0x53, 0x83, 0x33,
+  0x94, 0x23, 0xA3, 0x10, 0x13, 0xB3, 0x13, 0xA3, 0x33, 0x93, 0x43, 0x73,
+  0x53, 0x63, 0x73, 0x53, 0x82, 0x43, 0x93, 0x33, 0xA3, 0x13, 0xB3, 0x12,
+  0xD5, 0xE3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0x70, 0x1E,
+  0x1E, 0xC3, 0xB3, 0xB3, 0xB4, 0xB3, 0xB3, 0xB3, 0xB3, 0xB4, 0xB3, 0xB3,
+  0xB3, 0xB4, 0xB3, 0xB3, 0xB3, 0xCF, 0x0F, 0x0C, 0x32, 0x32, 0x32, 0x32,
+  0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+  0x32, 0x32, 0x32, 0x32, 0x32, 0x3A, 0x01, 0x72, 0x71, 0x71, 0x72, 0x71,
+  0x71, 0x72, 0x71, 0x71, 0x72, 0x62, 0x71, 0x72, 0x62, 0x71, 0x72, 0x62,
+  0x71, 0x72, 0x0A, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+  0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+  0x2D, 0x43, 0x83, 0x72, 0x11, 0x72, 0x12, 0x61, 0x22, 0x52, 0x32, 0x42,
+  0x32, 0x32, 0x51, 0x32, 0x52, 0x21, 0x62, 0x10, 0x0F, 0x02, 0x03, 0x33,
+  0x32, 0x42, 0x36, 0x69, 0x33, 0x43, 0x32, 0x63, 0x13, 0x63, 0xA3, 0x67,
+  0x3A, 0x15, 0x43, 0x13, 0x63, 0x12, 0x73, 0x12, 0x73, 0x13, 0x45, 0x28,
+  0x13, 0x25, 0x33, 0x02, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0x25, 0x42, 0x17,
+  0x34, 0x43, 0x23, 0x63, 0x12, 0x73, 0x12, 0x82, 0x12, 0x82, 0x12, 0x82,
+  0x12, 0x82, 0x12, 0x82, 0x12, 0x73, 0x13, 0x63, 0x14, 0x43, 0x2A, 0x32,
+  0x25, 0x40, 0x45, 0x58, 0x34, 0x33, 0x22, 0x66, 0x65, 0xA2, 0xA2, 0xA2,
+  0xA2, 0xA3, 0x63, 0x12, 0x63, 0x13, 0x43, 0x38, 0x65, 0x30, 0xA3, 0xA3,
+  0xA3, 0xA3, 0xA3, 0x35, 0x23, 0x2B, 0x14, 0x35, 0x12, 0x67, 0x75, 0x85,
+  0x85, 0x85, 0x85, 0x86, 0x73, 0x12, 0x64, 0x14, 0x35, 0x28, 0x12, 0x36,
+  0x22, 0xD0, 0x45, 0x69, 0x34, 0x33, 0x32, 0x63, 0x13, 0x72, 0x12, 0x8F,
+  0x0F, 0x01, 0xB2, 0xB3, 0x72, 0x22, 0x63, 0x24, 0x34, 0x39, 0x65, 0x40,
+  0x33, 0x24, 0x13, 0x33, 0x33, 0x2C, 0x13, 0x33, 0x33, 0x33, 0x33, 0x33,
+  0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x20, 0x44, 0x22, 0x2A, 0x14,
+  0x34, 0x12, 0x66, 0x74, 0x84, 0x84, 0x84, 0x84, 0x85, 0x72, 0x12, 0x63,
+  0x13, 0x44, 0x27, 0x12, 0x35, 0x22, 0xA5, 0x63, 0x13, 0x43, 0x39, 0x46,
+  0x30, 0x02, 0x92, 0x92, 0x92, 0x92, 0x92, 0x25, 0x22, 0x17, 0x14, 0x46,
+  0x55, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x72,
+  0x06, 0x4F, 0x0F, 0x23, 0x23, 0x23, 0xC3, 0x23, 0x23, 0x23, 0x23, 0x23,
+  0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+  0x27, 0x13, 0x20, 0x02, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0x62, 0x22, 0x53,
+  0x22, 0x43, 0x32, 0x33, 0x42, 0x23, 0x52, 0x13, 0x67, 0x54, 0x12, 0x53,
+  0x23, 0x42, 0x43, 0x32, 0x43, 0x32, 0x53, 0x22, 0x53, 0x22, 0x63, 0x12,
+  0x73, 0x0F, 0x0F, 0x0A, 0x02, 0x15, 0x45, 0x2A, 0x17, 0x14, 0x35, 0x33,
+  0x13, 0x53, 0x55, 0x62, 0x65, 0x62, 0x65, 0x62, 0x65, 0x62, 0x65, 0x62,
+  0x65, 0x62, 0x65, 0x62, 0x65, 0x62, 0x65, 0x62, 0x65, 0x62, 0x65, 0x62,
+  0x63, 0x02, 0x25, 0x2A, 0x14, 0x46, 0x55, 0x74, 0x74, 0x74, 0x74, 0x74,
+  0x74, 0x74, 0x74, 0x74, 0x74, 0x72, 0x45, 0x69, 0x34, 0x33, 0x32, 0x63,
+  0x13, 0x72, 0x12, 0x85, 0x85, 0x85, 0x85, 0x86, 0x72, 0x22, 0x63, 0x24,
+  0x33, 0x49, 0x65, 0x40, 0x02, 0x16, 0x4A, 0x34, 0x43, 0x23, 0x63, 0x13,
+  0x63, 0x12, 0x82, 0x12, 0x82, 0x12, 0x85, 0x82, 0x12, 0x82, 0x13, 0x63,
+  0x13, 0x63, 0x14, 0x43, 0x2A, 0x32, 0x25, 0x42, 0xB2, 0xB2, 0xB2, 0xB2,
+  0xB0, 0x45, 0x22, 0x28, 0x12, 0x14, 0x35, 0x12, 0x67, 0x75, 0x85, 0x85,
+  0x85, 0x85, 0x86, 0x73, 0x12, 0x64, 0x14, 0x35, 0x2B, 0x35, 0x23, 0xA3,
+  0xA3, 0xA3, 0xA3, 0xA3, 0x02, 0x25, 0x1A, 0x13, 0x42, 0x52, 0x52, 0x52,
+  0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x50, 0x36, 0x49, 0x33, 0x34,
+  0x13, 0x53, 0x13, 0x93, 0xA6, 0x78, 0x85, 0xA2, 0x12, 0x76, 0x62, 0x14,
+  0x43, 0x29, 0x56, 0x30, 0x13, 0x33, 0x33, 0x33, 0x2C, 0x13, 0x33, 0x33,
+  0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x44, 0x24, 0x02, 0x74,
+  0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x65, 0x66, 0x4F,
+  0x26, 0x12, 0xB0, 0x03, 0x82, 0x12, 0x73, 0x13, 0x62, 0x23, 0x62, 0x32,
+  0x53, 0x33, 0x42, 0x43, 0x42, 0x52, 0x33, 0x53, 0x22, 0x63, 0x22, 0x72,
+  0x12, 0x82, 0x12, 0x85, 0x93, 0xA3, 0x50, 0x03, 0x53, 0x62, 0x22, 0x54,
+  0x52, 0x22, 0x54, 0x43, 0x23, 0x44, 0x43, 0x32, 0x32, 0x12, 0x42, 0x42,
+  0x32, 0x13, 0x32, 0x42, 0x32, 0x22, 0x23, 0x43, 0x22, 0x22, 0x22, 0x62,
+  0x13, 0x22, 0x22, 0x62, 0x12, 0x33, 0x12, 0x62, 0x12, 0x45, 0x65, 0x44,
+  0x84, 0x44, 0x83, 0x54, 0x83, 0x62, 0x50, 0x12, 0x72, 0x32, 0x53, 0x33,
+  0x33, 0x52, 0x32, 0x63, 0x13, 0x75, 0x93, 0xA3, 0xA4, 0x82, 0x12, 0x73,
+  0x13, 0x62, 0x33, 0x42, 0x52, 0x33, 0x53, 0x22, 0x72, 0x10, 0x03, 0x73,
+  0x12, 0x72, 0x23, 0x53, 0x23, 0x53, 0x32, 0x52, 0x42, 0x43, 0x43, 0x33,
+  0x52, 0x32, 0x62, 0x23, 0x63, 0x12, 0x82, 0x12, 0x85, 0x84, 0xA3, 0xA3,
+  0xA2, 0xB2, 0xA3, 0x93, 0x85, 0x84, 0x80, 0x0B, 0x1B, 0x93, 0x83, 0x83,
+  0x92, 0x93, 0x83, 0x83, 0x92, 0x93, 0x83, 0x83, 0x9F, 0x09, 0x43, 0x34,
+  0x23, 0x42, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x43, 0x33, 0x43,
+  0x53, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x53, 0x43, 0x54, 0x43,
+  0x0F, 0x0B, 0x03, 0x33, 0x52, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+  0x42, 0x43, 0x43, 0x33, 0x23, 0x32, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+  0x42, 0x33, 0x23, 0x32, 0x40, 0x13, 0x86, 0x44, 0x24, 0x23, 0x55, 0x83,
+  0x20, 0x0F, 0x0F, 0x0C, 0xF0, 0x14, 0x56, 0x54, 0x49, 0x34, 0x33, 0x43,
+  0x34, 0x23, 0x63, 0x24, 0x23, 0x63, 0x24, 0x22, 0x73, 0x24, 0xB3, 0x24,
+  0xA3, 0x34, 0x94, 0x34, 0x84, 0x44, 0x74, 0x54, 0x73, 0x64, 0x72, 0x74,
+  0x72, 0x74, 0xF0, 0x14, 0xF0, 0x14, 0xF0, 0x14, 0x72, 0x74, 0x72, 0x74,
+  0x72, 0x74, 0xF0, 0x1F, 0x0F, 0x0C, 0x0F, 0x0F, 0x0C, 0xF0, 0x14, 0x56,
+  0x54, 0x49, 0x34, 0x33, 0x43, 0x34, 0x23, 0x63, 0x24, 0x23, 0x63, 0x24,
+  0x22, 0x73, 0x24, 0xB3, 0x24, 0xA3, 0x34, 0x94, 0x34, 0x84, 0x44, 0x74,
+  0x54, 0x73, 0x64, 0x72, 0x74, 0x72, 0x74, 0xF0, 0x14, 0xF0, 0x14, 0xF0,
+  0x14, 0x72, 0x74, 0x72, 0x74, 0x72, 0x74, 0xF0, 0x1F, 0x0F, 0x0C, 0x0F,
+  0x0F, 0x0C, 0xF0, 0x14, 0x56, 0x54, 0x49, 0x34, 0x33, 0x43, 0x34, 0x23,
+  0x63, 0x24, 0x23, 0x63, 0x24, 0x22, 0x73, 0x24, 0xB3, 0x24, 0xA3, 0x34,
+  0x94, 0x34, 0x84, 0x44, 0x74, 0x54, 0x73, 0x64, 0x72, 0x74, 0x72, 0x74,
+  0xF0, 0x14, 0xF0, 0x14, 0xF0, 0x14, 0x72, 0x74, 0x72, 0x74, 0x72, 0x74,
+  0xF0, 0x1F, 0x0F, 0x0C, 0x0F, 0x0F, 0x0C, 0xF0, 0x14, 0x56, 0x54, 0x49,
+  0x34, 0x33, 0x43, 0x34, 0x23, 0x63, 0x24, 0x23, 0x63, 0x24, 0x22, 0x73,
+  0x24, 0xB3, 0x24, 0xA3, 0x34, 0x94, 0x34, 0x84, 0x44, 0x74, 0x54, 0x73,
+  0x64, 0x72, 0x74, 0x72, 0x74, 0xF0, 0x14, 0xF0, 0x14, 0xF0, 0x14, 0x72,
+  0x74, 0x72, 0x74, 0x72, 0x74, 0xF0, 0x1F, 0x0F, 0x0C, 0x0F, 0x0F, 0x0C,
+  0xF0, 0x14, 0x56, 0x54, 0x49, 0x34, 0x33, 0x43, 0x34, 0x23, 0x63, 0x24,
+  0x23, 0x63, 0x24, 0x22, 0x73, 0x24, 0xB3, 0x24, 0xA3, 0x34, 0x94, 0x34,
+  0x84, 0x44, 0x74, 0x54, 0x73, 0x64, 0x72, 0x74, 0x72, 0x74, 0xF0, 0x14,
+  0xF0, 0x14, 0xF0, 0x14, 0x72, 0x74, 0x72, 0x74, 0x72, 0x74, 0xF0, 0x1F,
+  0x0F, 0x0C, 0x0F, 0x0F, 0x0C, 0xF0, 0x14, 0x56, 0x54, 0x49, 0x34, 0x33,
+  0x43, 0x34, 0x23, 0x63, 0x24, 0x23, 0x63, 0x24, 0x22, 0x73, 0x24, 0xB3,
+  0x24, 0xA3, 0x34, 0x94, 0x34, 0x84, 0x44, 0x74, 0x54, 0x73, 0x64, 0x72,
+  0x74, 0x72, 0x74, 0xF0, 0x14, 0xF0, 0x14, 0xF0, 0x14, 0x72, 0x74, 0x72,
+  0x74, 0x72, 0x74, 0xF0, 0x1F, 0x0F, 0x0C, 0x0F, 0x0F, 0x0C, 0xF0, 0x14,
+  0x56, 0x54, 0x49, 0x34, 0x33, 0x43, 0x34, 0x23, 0x63, 0x24, 0x23, 0x63,
+  0x24, 0x22, 0x73, 0x24, 0xB3, 0x24, 0xA3, 0x34, 0x94, 0x34, 0x84, 0x44,
+  0x74, 0x54, 0x73, 0x64, 0x72, 0x74, 0x72, 0x74, 0xF0, 0x14, 0xF0, 0x14,
+  0xF0, 0x14, 0x72, 0x74, 0x72, 0x74, 0x72, 0x74, 0xF0, 0x1F, 0x0F, 0x0C,
+  0x0F, 0x0F, 0x0C, 0xF0, 0x14, 0x56, 0x54, 0x49, 0x34, 0x33, 0x43, 0x34,
+  0x23, 0x63, 0x24, 0x23, 0x63, 0x24, 0x22, 0x73, 0x24, 0xB3, 0x24, 0xA3,
+  0x34, 0x94, 0x34, 0x84, 0x44, 0x74, 0x54, 0x73, 0x64, 0x72, 0x74, 0x72,
+  0x74, 0xF0, 0x14, 0xF0, 0x14, 0xF0, 0x14, 0x72, 0x74, 0x72, 0x74, 0x72,
+  0x74, 0xF0, 0x1F, 0x0F, 0x0C, 0x0F, 0x0F, 0x0C, 0xF0, 0x14, 0x56, 0x54,
+  0x49, 0x34, 0x33, 0x43, 0x34, 0x23, 0x63, 0x24, 0x23, 0x63, 0x24, 0x22,
+  0x73, 0x24, 0xB3, 0x24, 0xA3, 0x34, 0x94, 0x34, 0x84, 0x44, 0x74, 0x54,
+  0x73, 0x64, 0x72, 0x74, 0x72, 0x74, 0xF0, 0x14, 0xF0, 0x14, 0xF0, 0x14,
+  0x72, 0x74, 0x72, 0x74, 0x72, 0x74, 0xF0, 0x1F, 0x0F, 0x0C, 0x0F, 0x0F,
+  0x0C, 0xF0, 0x14, 0x56, 0x54, 0x49, 0x34, 0x33, 0x43, 0x34, 0x23, 0x63,
+  0x24, 0x23, 0x63, 0x24, 0x22, 0x73, 0x24, 0xB3, 0x24, 0xA3, 0x34, 0x94,
+  0x34, 0x84, 0x44, 0x74, 0x54, 0x73, 0x64, 0x72, 0x74, 0x72, 0x74, 0xF0,
+  0x14, 0xF0, 0x14, 0xF0, 0x14, 0x72, 0x74, 0x72, 0x74, 0x72, 0x74, 0xF0,
+  0x1F, 0x0F, 0x0C, 0x0F, 0x0F, 0x0C, 0xF0, 0x14, 0x56, 0x54, 0x49, 0x34,
+  0x33, 0x43, 0x34, 0x23, 0x63, 0x24, 0x23, 0x63, 0x24, 0x22, 0x73, 0x24,
+  0xB3, 0x24, 0xA3, 0x34, 0x94, 0x34, 0x84, 0x44, 0x74, 0x54, 0x73, 0x64,
+  0x72, 0x74, 0x72, 0x74, 0xF0, 0x14, 0xF0, 0x14, 0xF0, 0x14, 0x72, 0x74,
+  0x72, 0x74, 0x72, 0x74, 0xF0, 0x1F, 0x0F, 0x0C, 0x0F, 0x0F, 0x0C, 0xF0,
+  0x14, 0x56, 0x54, 0x49, 0x34, 0x33, 0x43, 0x34, 0x23, 0x63, 0x24, 0x23,
+  0x63, 0x24, 0x22, 0x73, 0x24, 0xB3, 0x24, 0xA3, 0x34, 0x94, 0x34, 0x84,
+  0x44, 0x74, 0x54, 0x73, 0x64, 0x72, 0x74, 0x72, 0x74, 0xF0, 0x14, 0xF0,
+  0x14, 0xF0, 0x14, 0x72, 0x74, 0x72, 0x74, 0x72, 0x74, 0xF0, 0x1F, 0x0F,
+  0x0C, 0x0F, 0x0F, 0x0C, 0xF0, 0x14, 0x56, 0x54, 0x49, 0x34, 0x33, 0x43,
+  0x34, 0x23, 0x63, 0x24, 0x23, 0x63, 0x24, 0x22, 0x73, 0x24, 0xB3, 0x24,
+  0xA3, 0x34, 0x94, 0x34, 0x84, 0x44, 0x74, 0x54, 0x73, 0x64, 0x72, 0x74,
+  0x72, 0x74, 0xF0, 0x14, 0xF0, 0x14, 0xF0, 0x14, 0x72, 0x74, 0x72, 0x74,
+  0x72, 0x74, 0xF0, 0x1F, 0x0F, 0x0C, 0x0F, 0x0F, 0x0C, 0xF0, 0x14, 0x56,
+  0x54, 0x49, 0x34, 0x33, 0x43, 0x34, 0x23, 0x63, 0x24, 0x23, 0x63, 0x24,
+  0x22, 0x73, 0x24, 0xB3, 0x24, 0xA3, 0x34, 0x94, 0x34, 0x84, 0x44, 0x74,
+  0x54, 0x73, 0x64, 0x72, 0x74, 0x72, 0x74, 0xF0, 0x14, 0xF0, 0x14, 0xF0,
+  0x14, 0x72, 0x74, 0x72, 0x74, 0x72, 0x74, 0xF0, 0x1F, 0x0F, 0x0C, 0x0F,
+  0x0F, 0x0C, 0xF0, 0x14, 0x56, 0x54, 0x49, 0x34, 0x33, 0x43, 0x34, 0x23,
+  0x63, 0x24, 0x23, 0x63, 0x24, 0x22, 0x73, 0x24, 0xB3, 0x24, 0xA3, 0x34,
+  0x94, 0x34, 0x84, 0x44, 0x74, 0x54, 0x73, 0x64, 0x72, 0x74, 0x72, 0x74,
+  0xF0, 0x14, 0xF0, 0x14, 0xF0, 0x14, 0x72, 0x74, 0x72, 0x74, 0x72, 0x74,
+  0xF0, 0x1F, 0x0F, 0x0C, 0x0F, 0x0F, 0x0C, 0xF0, 0x14, 0x56, 0x54, 0x49,
+  0x34, 0x33, 0x43, 0x34, 0x23, 0x63, 0x24, 0x23, 0x63, 0x24, 0x22, 0x73,
+  0x24, 0xB3, 0x24, 0xA3, 0x34, 0x94, 0x34, 0x84, 0x44, 0x74, 0x54, 0x73,
+  0x64, 0x72, 0x74, 0x72, 0x74, 0xF0, 0x14, 0xF0, 0x14, 0xF0, 0x14, 0x72,
+  0x74, 0x72, 0x74, 0x72, 0x74, 0xF0, 0x1F, 0x0F, 0x0C, 0x0F, 0x0F, 0x0C,
+  0xF0, 0x14, 0x56, 0x54, 0x49, 0x34, 0x33, 0x43, 0x34, 0x23, 0x63, 0x24,
+  0x23, 0x63, 0x24, 0x22, 0x73, 0x24, 0xB3, 0x24, 0xA3, 0x34, 0x94, 0x34,
+  0x84, 0x44, 0x74, 0x54, 0x73, 0x64, 0x72, 0x74, 0x72, 0x74, 0xF0, 0x14,
+  0xF0, 0x14, 0xF0, 0x14, 0x72, 0x74, 0x72, 0x74, 0x72, 0x74, 0xF0, 0x1F,
+  0x0F, 0x0C, 0x0F, 0x0F, 0x0C, 0xF0, 0x14, 0x56, 0x54, 0x49, 0x34, 0x33,
+  0x43, 0x34, 0x23, 0x63, 0x24, 0x23, 0x63, 0x24, 0x22, 0x73, 0x24, 0xB3,
+  0x24, 0xA3, 0x34, 0x94, 0x34, 0x84, 0x44, 0x74, 0x54, 0x73, 0x64, 0x72,
+  0x74, 0x72, 0x74, 0xF0, 0x14, 0xF0, 0x14, 0xF0, 0x14, 0x72, 0x74, 0x72,
+  0x74, 0x72, 0x74, 0xF0, 0x1F, 0x0F, 0x0C, 0x0F, 0x0F, 0x0C, 0xF0, 0x14,
+  0x56, 0x54, 0x49, 0x34, 0x33, 0x43, 0x34, 0x23, 0x63, 0x24, 0x23, 0x63,
+  0x24, 0x22, 0x73, 0x24, 0xB3, 0x24, 0xA3, 0x34, 0x94, 0x34, 0x84, 0x44,
+  0x74, 0x54, 0x73, 0x64, 0x72, 0x74, 0x72, 0x74, 0xF0, 0x14, 0xF0, 0x14,
+  0xF0, 0x14, 0x72, 0x74, 0x72, 0x74, 0x72, 0x74, 0xF0, 0x1F, 0x0F, 0x0C,
+  0x0F, 0x0F, 0x0C, 0xF0, 0x14, 0x56, 0x54, 0x49, 0x34, 0x33, 0x43, 0x34,
+  0x23, 0x63, 0x24, 0x23, 0x63, 0x24, 0x22, 0x73, 0x24, 0xB3, 0x24, 0xA3,
+  0x34, 0x94, 0x34, 0x84, 0x44, 0x74, 0x54, 0x73, 0x64, 0x72, 0x74, 0x72,
+  0x74, 0xF0, 0x14, 0xF0, 0x14, 0xF0, 0x14, 0x72, 0x74, 0x72, 0x74, 0x72,
+  0x74, 0xF0, 0x1F, 0x0F, 0x0C, 0x0F, 0x0F, 0x0C, 0xF0, 0x14, 0x56, 0x54,
+  0x49, 0x34, 0x33, 0x43, 0x34, 0x23, 0x63, 0x24, 0x23, 0x63, 0x24, 0x22,
+  0x73, 0x24, 0xB3, 0x24, 0xA3, 0x34, 0x94, 0x34, 0x84, 0x44, 0x74, 0x54,
+  0x73, 0x64, 0x72, 0x74, 0x72, 0x74, 0xF0, 0x14, 0xF0, 0x14, 0xF0, 0x14,
+  0x72, 0x74, 0x72, 0x74, 0x72, 0x74, 0xF0, 0x1F, 0x0F, 0x0C, 0x0F, 0x0F,
+  0x0C, 0xF0, 0x14, 0x56, 0x54, 0x49, 0x34, 0x33, 0x43, 0x34, 0x23, 0x63,
+  0x24, 0x23, 0x63, 0x24, 0x22, 0x73, 0x24, 0xB3, 0x24, 0xA3, 0x34, 0x94,
+  0x34, 0x84, 0x44, 0x74, 0x54, 0x73, 0x64, 0x72, 0x74, 0x72, 0x74, 0xF0,
+  0x14, 0xF0, 0x14, 0xF0, 0x14, 0x72, 0x74, 0x72, 0x74, 0x72, 0x74, 0xF0,
+  0x1F, 0x0F, 0x0C, 0x0F, 0x0F, 0x0C, 0xF0, 0x14, 0x56, 0x54, 0x49, 0x34,
+  0x33, 0x43, 0x34, 0x23, 0x63, 0x24, 0x23, 0x63, 0x24, 0x22, 0x73, 0x24,
+  0xB3, 0x24, 0xA3, 0x34, 0x94, 0x34, 0x84, 0x44, 0x74, 0x54, 0x73, 0x64,
+  0x72, 0x74, 0x72, 0x74, 0xF0, 0x14, 0xF0, 0x14, 0xF0, 0x14, 0x72, 0x74,
+  0x72, 0x74, 0x72, 0x74, 0xF0, 0x1F, 0x0F, 0x0C, 0x0F, 0x0F, 0x0C, 0xF0,
+  0x14, 0x56, 0x54, 0x49, 0x34, 0x33, 0x43, 0x34, 0x23, 0x63, 0x24, 0x23,
+  0x63, 0x24, 0x22, 0x73, 0x24, 0xB3, 0x24, 0xA3, 0x34, 0x94, 0x34, 0x84,
+  0x44, 0x74, 0x54, 0x73, 0x64, 0x72, 0x74, 0x72, 0x74, 0xF0, 0x14, 0xF0,
+  0x14, 0xF0, 0x14, 0x72, 0x74, 0x72, 0x74, 0x72, 0x74, 0xF0, 0x1F, 0x0F,
+  0x0C, 0x0F, 0x0F, 0x0C, 0xF0, 0x14, 0x56, 0x54, 0x49, 0x34, 0x33, 0x43,
+  0x34, 0x23, 0x63, 0x24, 0x23, 0x63, 0x24, 0x22, 0x73, 0x24, 0xB3, 0x24,
+  0xA3, 0x34, 0x94, 0x34, 0x84, 0x44, 0x74, 0x54, 0x73, 0x64, 0x72, 0x74,
+  0x72, 0x74, 0xF0, 0x14, 0xF0, 0x14, 0xF0, 0x14, 0x72, 0x74, 0x72, 0x74,
+  0x72, 0x74, 0xF0, 0x1F, 0x0F, 0x0C, 0x0F, 0x0F, 0x0C, 0xF0, 0x14, 0x56,
+  0x54, 0x49, 0x34, 0x33, 0x43, 0x34, 0x23, 0x63, 0x24, 0x23, 0x63, 0x24,
+  0x22, 0x73, 0x24, 0xB3, 0x24, 0xA3, 0x34, 0x94, 0x34, 0x84, 0x44, 0x74,
+  0x54, 0x73, 0x64, 0x72, 0x74, 0x72, 0x74, 0xF0, 0x14, 0xF0, 0x14, 0xF0,
+  0x14, 0x72, 0x74, 0x72, 0x74, 0x72, 0x74, 0xF0, 0x1F, 0x0F, 0x0C, 0x0F,
+  0x0F, 0x0C, 0xF0, 0x14, 0x56, 0x54, 0x49, 0x34, 0x33, 0x43, 0x34, 0x23,
+  0x63, 0x24, 0x23, 0x63, 0x24, 0x22, 0x73, 0x24, 0xB3, 0x24, 0xA3, 0x34,
+  0x94, 0x34, 0x84, 0x44, 0x74, 0x54, 0x73, 0x64, 0x72, 0x74, 0x72, 0x74,
+  0xF0, 0x14, 0xF0, 0x14, 0xF0, 0x14, 0x72, 0x74, 0x72, 0x74, 0x72, 0x74,
+  0xF0, 0x1F, 0x0F, 0x0C, 0x0F, 0x0F, 0x0C, 0xF0, 0x14, 0x56, 0x54, 0x49,
+  0x34, 0x33, 0x43, 0x34, 0x23, 0x63, 0x24, 0x23, 0x63, 0x24, 0x22, 0x73,
+  0x24, 0xB3, 0x24, 0xA3, 0x34, 0x94, 0x34, 0x84, 0x44, 0x74, 0x54, 0x73,
+  0x64, 0x72, 0x74, 0x72, 0x74, 0xF0, 0x14, 0xF0, 0x14, 0xF0, 0x14, 0x72,
+  0x74, 0x72, 0x74, 0x72, 0x74, 0xF0, 0x1F, 0x0F, 0x0C, 0x0F, 0x0F, 0x0C,
+  0xF0, 0x14, 0x56, 0x54, 0x49, 0x34, 0x33, 0x43, 0x34, 0x23, 0x63, 0x24,
+  0x23, 0x63, 0x24, 0x22, 0x73, 0x24, 0xB3, 0x24, 0xA3, 0x34, 0x94, 0x34,
+  0x84, 0x44, 0x74, 0x54, 0x73, 0x64, 0x72, 0x74, 0x72, 0x74, 0xF0, 0x14,
+  0xF0, 0x14, 0xF0, 0x14, 0x72, 0x74, 0x72, 0x74, 0x72, 0x74, 0xF0, 0x1F,
+  0x0F, 0x0C, 0x0F, 0x0F, 0x0C, 0xF0, 0x14, 0x56, 0x54, 0x49, 0x34, 0x33,
+  0x43, 0x34, 0x23, 0x63, 0x24, 0x23, 0x63, 0x24, 0x22, 0x73, 0x24, 0xB3,
+  0x24, 0xA3, 0x34, 0x94, 0x34, 0x84, 0x44, 0x74, 0x54, 0x73, 0x64, 0x72,
+  0x74, 0x72, 0x74, 0xF0, 0x14, 0xF0, 0x14, 0xF0, 0x14, 0x72, 0x74, 0x72,
+  0x74, 0x72, 0x74, 0xF0, 0x1F, 0x0F, 0x0C, 0x0F, 0x0F, 0x0C, 0xF0, 0x14,
+  0x56, 0x54, 0x49, 0x34, 0x33, 0x43, 0x34, 0x23, 0x63, 0x24, 0x23, 0x63,
+  0x24, 0x22, 0x73, 0x24, 0xB3, 0x24, 0xA3, 0x34, 0x94, 0x34, 0x84, 0x44,
+  0x74, 0x54, 0x73, 0x64, 0x72, 0x74, 0x72, 0x74, 0xF0, 0x14, 0xF0, 0x14,
+  0xF0, 0x14, 0x72, 0x74, 0x72, 0x74, 0x72, 0x74, 0xF0, 0x1F, 0x0F, 0x0C,
+  0x0F, 0x0F, 0x0C, 0xF0, 0x14, 0x56, 0x54, 0x49, 0x34, 0x33, 0x43, 0x34,
+  0x23, 0x63, 0x24, 0x23, 0x63, 0x24, 0x22, 0x73, 0x24, 0xB3, 0x24, 0xA3,
+  0x34, 0x94, 0x34, 0x84, 0x44, 0x74, 0x54, 0x73, 0x64, 0x72, 0x74, 0x72,
+  0x74, 0xF0, 0x14, 0xF0, 0x14, 0xF0, 0x14, 0x72, 0x74, 0x72, 0x74, 0x72,
+  0x74, 0xF0, 0x1F, 0x0F, 0x0C, 0x0F, 0x0F, 0x0C, 0xF0, 0x14, 0x56, 0x54,
+  0x49, 0x34, 0x33, 0x43, 0x34, 0x23, 0x63, 0x24, 0x23, 0x63, 0x24, 0x22,
+  0x73, 0x24, 0xB3, 0x24, 0xA3, 0x34, 0x94, 0x34, 0x84, 0x44, 0x74, 0x54,
+  0x73, 0x64, 0x72, 0x74, 0x72, 0x74, 0xF0, 0x14, 0xF0, 0x14, 0xF0, 0x14,
+  0x72, 0x74, 0x72, 0x74, 0x72, 0x74, 0xF0, 0x1F, 0x0F, 0x0C, 0x10, 0x06,
+  0x71, 0x21, 0x21, 0x21, 0x21, 0x1F, 0x0F, 0x03, 0x62, 0xB2, 0x96, 0x68,
+  0x43, 0x12, 0x13, 0x23, 0x22, 0x23, 0x12, 0x32, 0x23, 0x12, 0x32, 0x53,
+  0x32, 0x53, 0x32, 0x53, 0x32, 0x62, 0x32, 0x62, 0x32, 0x23, 0x13, 0x22,
+  0x23, 0x23, 0x12, 0x13, 0x48, 0x66, 0x92, 0xB2, 0xB2, 0x50, 0x46, 0x78,
+  0x53, 0x43, 0x33, 0x63, 0x22, 0x73, 0x13, 0x73, 0x13, 0xC2, 0xC3, 0xA9,
+  0x59, 0x82, 0xC3, 0xB3, 0xB2, 0xC2, 0xB2, 0xB8, 0x13, 0x1E, 0x11, 0x55,
+  0x20, 0x11, 0x9B, 0x1A, 0x13, 0x33, 0x22, 0x52, 0x13, 0x56, 0x53, 0x12,
+  0x52, 0x23, 0x33, 0x2F, 0x03, 0x12, 0x11, 0x90, 0x12, 0x93, 0x13, 0x82,
+  0x32, 0x73, 0x33, 0x62, 0x52, 0x52, 0x72, 0x42, 0x72, 0x32, 0x92, 0x13,
+  0x95, 0xB3, 0x8C, 0x73, 0xC3, 0x8C, 0x73, 0xC3, 0xC3, 0xC3, 0xC3, 0x60,
+  0x0B, 0x4B, 0x54, 0x77, 0x53, 0x33, 0x43, 0x43, 0x32, 0x53, 0x32, 0x53,
+  0x33, 0xB4, 0x87, 0x52, 0x34, 0x32, 0x54, 0x22, 0x73, 0x13, 0x73, 0x13,
+  0x72, 0x14, 0x62, 0x34, 0x33, 0x44, 0x13, 0x75, 0x93, 0xB3, 0x32, 0x62,
+  0x33, 0x52, 0x33, 0x52, 0x43, 0x33, 0x48, 0x75, 0x40, 0x03, 0x25, 0x25,
+  0x22, 0x76, 0xCA, 0x83, 0x83, 0x53, 0x34, 0x33, 0x33, 0x28, 0x22, 0x32,
+  0x32, 0x42, 0x32, 0x21, 0x32, 0x62, 0x31, 0x12, 0x32, 0xB4, 0x32, 0xB4,
+  0x31, 0xC4, 0x32, 0xB4, 0x32, 0x62, 0x32, 0x11, 0x32, 0x62, 0x31, 0x22,
+  0x32, 0x42, 0x32, 0x32, 0x36, 0x32, 0x43, 0x34, 0x33, 0x53, 0x83, 0x8A,
+  0xC6, 0x70, 0x16, 0x12, 0x32, 0x12, 0x41, 0x53, 0x24, 0x11, 0x12, 0x41,
+  0x12, 0x32, 0x13, 0x13, 0x24, 0x12, 0x88, 0x31, 0x51, 0x22, 0x42, 0x13,
+  0x32, 0x13, 0x32, 0x21, 0x51, 0x32, 0x42, 0x33, 0x23, 0x32, 0x42, 0x31,
+  0x51, 0x0F, 0x0D, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0x0E, 0x76, 0xCA,
+  0x83, 0x83, 0x59, 0x43, 0x33, 0x19, 0x22, 0x32, 0x22, 0x52, 0x32, 0x21,
+  0x32, 0x62, 0x31, 0x12, 0x32, 0x61, 0x44, 0x32, 0x52, 0x44, 0x38, 0x54,
+  0x32, 0x52, 0x44, 0x32, 0x52, 0x42, 0x11, 0x32, 0x61, 0x41, 0x22, 0x22,
+  0x61, 0x32, 0x32, 0x12, 0x62, 0x12, 0x43, 0xA3, 0x53, 0x83, 0x8A, 0xC6,
+  0x70, 0x0E, 0x24, 0x36, 0x12, 0x44, 0x53, 0x53, 0x51, 0x12, 0x32, 0x25,
+  0x42, 0x30, 0x62, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0x6F, 0x0D, 0x62, 0xC2,
+  0xC2, 0xC2, 0xC2, 0xC2, 0xF0, 0xF0, 0x4F, 0x0D, 0x16, 0x12, 0x35, 0x44,
+  0x42, 0x62, 0x43, 0x43, 0x33, 0x42, 0x62, 0x6F, 0x01, 0x25, 0x32, 0x32,
+  0x21, 0x51, 0x21, 0x51, 0x54, 0x53, 0x83, 0x74, 0x52, 0x12, 0x32, 0x36,
+  0x10, 0x23, 0x13, 0x22, 0x22, 0x30, 0x02, 0x72, 0x22, 0x72, 0x22, 0x72,
+  0x22, 0x72, 0x22, 0x72, 0x22, 0x72, 0x22, 0x72, 0x22, 0x72, 0x22, 0x72,
+  0x22, 0x72, 0x22, 0x63, 0x22, 0x63, 0x23, 0x44, 0x28, 0x1B, 0x35, 0xB2,
+  0xB2, 0xB2, 0xB2, 0xB0, 0x49, 0x2B, 0x26, 0x22, 0x27, 0x22, 0x27, 0x22,
+  0x18, 0x22, 0x18, 0x22, 0x18, 0x22, 0x27, 0x22, 0x27, 0x22, 0x27, 0x22,
+  0x36, 0x22, 0x54, 0x22, 0x72, 0x22, 0x72, 0x22, 0x72, 0x22, 0x72, 0x22,
+  0x72, 0x22, 0x72, 0x22, 0x72, 0x22, 0x72, 0x22, 0x72, 0x22, 0x72, 0x22,
+  0x72, 0x22, 0x72, 0x22, 0x10, 0x09, 0x31, 0x63, 0x62, 0x54, 0x23, 0x15,
+  0x10, 0x31, 0x26, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x16,
+  0x22, 0x22, 0x12, 0x44, 0x44, 0x44, 0x44, 0x42, 0x16, 0x34, 0xA8, 0x01,
+  0x41, 0x42, 0x41, 0x33, 0x33, 0x32, 0x33, 0x31, 0x42, 0x22, 0x36, 0x33,
+  0x12, 0x42, 0x21, 0x41, 0x40, 0x31, 0xB2, 0x53, 0xB1, 0x54, 0xA2, 0x72,
+  0x92, 0x82, 0x91, 0x92, 0x82, 0x92, 0x81, 0xA2, 0x71, 0xB2, 0x62, 0x61,
+  0x42, 0x61, 0x62, 0x42, 0x52, 0x53, 0xA2, 0x52, 0x11, 0xA1, 0x52, 0x21,
+  0x92, 0x51, 0x31, 0x82, 0x52, 0x31, 0x81, 0x68, 0x52, 0xB1, 0x71, 0xC1,
+  0x61, 0xD1, 0x52, 0xF0, 0x10, 0x31, 0xF0, 0x42, 0xB1, 0x63, 0xA2, 0x54,
+  0x92, 0x82, 0x91, 0x92, 0x82, 0x92, 0x72, 0xA2, 0x71, 0xB2, 0x62, 0xB2,
+  0x52, 0x36, 0x32, 0x51, 0x33, 0x32, 0x22, 0x42, 0x32, 0x42, 0x72, 0x42,
+  0x42, 0x71, 0xA3, 0x62, 0x93, 0x71, 0x83, 0x81, 0x82, 0x92, 0x72, 0xA1,
+  0x88, 0x31, 0x98, 0x24, 0xF0, 0x26, 0x92, 0x42, 0x42, 0x81, 0x52, 0x42,
+  0x72, 0xB1, 0x72, 0x93, 0x81, 0xC2, 0x62, 0xD2, 0x42, 0x81, 0x52, 0x41,
+  0x61, 0x22, 0x42, 0x32, 0x52, 0x27, 0x41, 0x53, 0x44, 0x41, 0x54, 0xB2,
+  0x51, 0x12, 0xB1, 0x52, 0x12, 0xA2, 0x42, 0x22, 0x92, 0x42, 0x32, 0x91,
+  0x59, 0x62, 0xA2, 0x72, 0xB2, 0x71, 0xC2, 0x62, 0xF0, 0x10, 0x52, 0x92,
+  0xF0, 0xF0, 0xC2, 0x92, 0x83, 0x83, 0x73, 0x73, 0x73, 0x73, 0x82, 0x92,
+  0x74, 0x75, 0x57, 0x34, 0x19, 0x45, 0x30, 0x63, 0xF0, 0x22, 0xF0, 0x22,
+  0xF0, 0xF0, 0x24, 0xE4, 0xE5, 0xC6, 0xC3, 0x12, 0xC2, 0x23, 0xA3, 0x23,
+  0xA2, 0x42, 0x93, 0x43, 0x83, 0x43, 0x82, 0x63, 0x63, 0x63, 0x6C, 0x6D,
+  0x43, 0x83, 0x43, 0x83, 0x42, 0xA3, 0x23, 0xA3, 0x23, 0xA3, 0x22, 0xC3,
+  0x94, 0xE2, 0xF2, 0xF0, 0xF0, 0x34, 0xE4, 0xE5, 0xC6, 0xC3, 0x12, 0xC2,
+  0x23, 0xA3, 0x23, 0xA2, 0x42, 0x93, 0x43, 0x83, 0x43, 0x82, 0x63, 0x63,
+  0x63, 0x6C, 0x6D, 0x43, 0x83, 0x43, 0x83, 0x42, 0xA3, 0x23, 0xA3, 0x23,
+  0xA3, 0x22, 0xC3, 0x74, 0xD6, 0xC2, 0x32, 0xF0, 0xF4, 0xE4, 0xE5, 0xC6,
+  0xC3, 0x12, 0xC2, 0x23, 0xA3, 0x23, 0xA2, 0x42, 0x93, 0x43, 0x83, 0x43,
+  0x82, 0x63, 0x63, 0x63, 0x6C, 0x6D, 0x43, 0x83, 0x43, 0x83, 0x42, 0xA3,
+  0x23, 0xA3, 0x23, 0xA3, 0x22, 0xC3, 0x63, 0x31, 0xA8, 0xA2, 0x32, 0xF0,
+  0xF0, 0x14, 0xE4, 0xE5, 0xC6, 0xC3, 0x12, 0xC2, 0x23, 0xA3, 0x23, 0xA2,
+  0x42, 0x93, 0x43, 0x83, 0x43, 0x82, 0x63, 0x63, 0x63, 0x6C, 0x6D, 0x43,
+  0x83, 0x43, 0x83, 0x42, 0xA3, 0x23, 0xA3, 0x23, 0xA3, 0x22, 0xC3, 0x53,
+  0x23, 0xA3, 0x23, 0xA3, 0x23, 0xF0, 0xF4, 0xE4, 0xE5, 0xC6, 0xC3, 0x12,
+  0xC2, 0x23, 0xA3, 0x23, 0xA2, 0x42, 0x93, 0x43, 0x83, 0x43, 0x82, 0x63,
+  0x63, 0x63, 0x6C, 0x6D, 0x43, 0x83, 0x43, 0x83, 0x42, 0xA3, 0x23, 0xA3,
+  0x23, 0xA3, 0x22, 0xC3, 0x82, 0xF5, 0xC2, 0x22, 0xC2, 0x22, 0xD5, 0xE3,
+  0xF0, 0xF0, 0x24, 0xE4, 0xE5, 0xC6, 0xC3, 0x12, 0xC2, 0x23, 0xA3, 0x23,
+  0xA2, 0x42, 0x93, 0x43, 0x83, 0x43, 0x82, 0x63, 0x63, 0x63, 0x6C, 0x6D,
+  0x43, 0x83, 0x43, 0x83, 0x42, 0xA3, 0x23, 0xA3, 0x23, 0xA3, 0x22, 0xC3,
+  0x8F, 0x03, 0x8F, 0x03, 0x82, 0x32, 0xF0, 0x33, 0x32, 0xF0, 0x32, 0x42,
+  0xF0, 0x23, 0x42, 0xF0, 0x23, 0x42, 0xF0, 0x22, 0x52, 0xF0, 0x13, 0x52,
+  0xF0, 0x12, 0x6C, 0x53, 0x6C, 0x53, 0x62, 0xEC, 0xEC, 0xE2, 0x82, 0xD3,
+  0x82, 0xD3, 0x82, 0xC3, 0x92, 0xC3, 0x9D, 0x12, 0xAD, 0x66, 0x9A, 0x64,
+  0x44, 0x43, 0x83, 0x23, 0xA2, 0x23, 0xA3, 0x12, 0xE3, 0xE3, 0xE3, 0xE3,
+  0xE3, 0xE3, 0xC2, 0x12, 0xB3, 0x13, 0xA3, 0x13, 0xA3, 0x23, 0x83, 0x44,
+  0x44, 0x6A, 0x96, 0xD1, 0xF4, 0xF0, 0x12, 0xA1, 0x33, 0xB5, 0x60, 0x44,
+  0xD3, 0xD2, 0xF0, 0x6E, 0x1E, 0x13, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3,
+  0xCE, 0x1E, 0x13, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xCF, 0x0F, 0x73,
+  0xB2, 0xC2, 0xF0, 0x8E, 0x1E, 0x13, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3,
+  0xCE, 0x1E, 0x13, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xCF, 0x0F, 0x54,
+  0xA6, 0x92, 0x32, 0xF0, 0x4E, 0x1E, 0x13, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3,
+  0xC3, 0xCE, 0x1E, 0x13, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xCF, 0x0F,
+  0x33, 0x23, 0x73, 0x23, 0x73, 0x23, 0xF0, 0x4E, 0x1E, 0x13, 0xC3, 0xC3,
+  0xC3, 0xC3, 0xC3, 0xC3, 0xCE, 0x1E, 0x13, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3,
+  0xC3, 0xCF, 0x0F, 0x13, 0x52, 0x52, 0x92, 0x42, 0x42, 0x42, 0x42, 0x42,
+  0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+  0x42, 0x42, 0x10, 0x24, 0x32, 0x42, 0xD2, 0x52, 0x52, 0x52, 0x52, 0x52,
+  0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
+  0x52, 0x52, 0x30, 0x24, 0x36, 0x22, 0x32, 0xB2, 0x62, 0x62, 0x62, 0x62,
+  0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62,
+  0x62, 0x62, 0x62, 0x30, 0x03, 0x26, 0x26, 0x23, 0xB2, 0x62, 0x62, 0x62,
+  0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62,
+  0x62, 0x62, 0x62, 0x62, 0x30, 0x1B, 0x6D, 0x43, 0x74, 0x33, 0x84, 0x23,
+  0x93, 0x23, 0xA3, 0x13, 0xA3, 0x13, 0xA3, 0x13, 0xBB, 0x6B, 0x62, 0x13,
+  0xB2, 0x13, 0xB2, 0x13, 0xA3, 0x13, 0xA3, 0x13, 0x93, 0x23, 0x93, 0x23,
+  0x74, 0x3D, 0x4B, 0x50, 0x52, 0x32, 0x88, 0x81, 0x33, 0xF0, 0x63, 0xA7,
+  0x98, 0x88, 0x89, 0x76, 0x12, 0x76, 0x13, 0x66, 0x23, 0x56, 0x32, 0x56,
+  0x33, 0x46, 0x43, 0x36, 0x43, 0x36, 0x53, 0x26, 0x63, 0x16, 0x63, 0x16,
+  0x79, 0x88, 0x88, 0x97, 0xA3, 0x64, 0xF0, 0x23, 0xF0, 0x22, 0xF0, 0xF0,
+  0x37, 0xAB, 0x75, 0x44, 0x54, 0x83, 0x34, 0xA3, 0x23, 0xC3, 0x12, 0xD6,
+  0xD6, 0xE5, 0xE5, 0xE5, 0xE5, 0xE2, 0x12, 0xD3, 0x13, 0xC3, 0x13, 0xB3,
+  0x34, 0x83, 0x55, 0x44, 0x7B, 0xA7, 0x60, 0xA3, 0xF3, 0xF2, 0xF0, 0xF0,
+  0x47, 0xAB, 0x75, 0x44, 0x54, 0x83, 0x34, 0xA3, 0x23, 0xC3, 0x12, 0xD6,
+  0xD6, 0xE5, 0xE5, 0xE5, 0xE5, 0xE2, 0x12, 0xD3, 0x13, 0xC3, 0x13, 0xB3,
+  0x34, 0x83, 0x55, 0x44, 0x7B, 0xA7, 0x60, 0x84, 0xE6, 0xC2, 0x32, 0xF0,
+  0xF0, 0x17, 0xAB, 0x75, 0x44, 0x54, 0x83, 0x34, 0xA3, 0x23, 0xC3, 0x12,
+  0xD6, 0xD6, 0xE5, 0xE5, 0xE5, 0xE5, 0xE2, 0x12, 0xD3, 0x13, 0xC3, 0x13,
+  0xB3, 0x34, 0x83, 0x55, 0x44, 0x7B, 0xA7, 0x60, 0x72, 0x32, 0xB8, 0xA2,
+  0x33, 0xF0, 0xF0, 0x17, 0xAB, 0x75, 0x44, 0x54, 0x83, 0x34, 0xA3, 0x23,
+  0xC3, 0x12, 0xD6, 0xD6, 0xE5, 0xE5, 0xE5, 0xE5, 0xE2, 0x12, 0xD3, 0x13,
+  0xC3, 0x13, 0xB3, 0x34, 0x83, 0x55, 0x44, 0x7B, 0xA7, 0x60, 0x63, 0x23,
+  0xB3, 0x23, 0xB3, 0x23, 0xF0, 0xF7, 0xAB, 0x75, 0x44, 0x54, 0x83, 0x34,
+  0xA3, 0x23, 0xC3, 0x12, 0xD6, 0xD6, 0xE5, 0xE5, 0xE5, 0xE5, 0xE2, 0x12,
+  0xD3, 0x13, 0xC3, 0x13, 0xB3, 0x34, 0x83, 0x55, 0x44, 0x7B, 0xA7, 0x60,
+  0xA2, 0x65, 0x43, 0x13, 0x23, 0x36, 0x54, 0x64, 0x56, 0x33, 0x23, 0x13,
+  0x45, 0x62, 0x67, 0x51, 0x5B, 0x22, 0x45, 0x37, 0x44, 0x83, 0x44, 0x94,
+  0x33, 0x92, 0x13, 0x22, 0x92, 0x23, 0x13, 0x82, 0x42, 0x13, 0x72, 0x52,
+  0x13, 0x62, 0x62, 0x13, 0x52, 0x72, 0x13, 0x42, 0x82, 0x13, 0x32, 0x92,
+  0x22, 0x22, 0x93, 0x25, 0xA3, 0x24, 0xA3, 0x44, 0x83, 0x47, 0x44, 0x42,
+  0x2B, 0xC6, 0x70, 0x53, 0xF2, 0xF2, 0xF0, 0x73, 0xA6, 0xA6, 0xA6, 0xA6,
+  0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA2, 0x13,
+  0xA2, 0x23, 0x83, 0x25, 0x44, 0x4B, 0x86, 0x50, 0x83, 0xC2, 0xD2, 0xF0,
+  0x93, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6,
+  0xA6, 0xA6, 0xA6, 0xA2, 0x13, 0xA2, 0x23, 0x83, 0x25, 0x44, 0x4B, 0x86,
+  0x50, 0x64, 0xB6, 0x92, 0x33, 0xF0, 0x53, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6,
+  0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA2, 0x13, 0xA2,
+  0x23, 0x83, 0x25, 0x44, 0x4B, 0x86, 0x50, 0x43, 0x23, 0x83, 0x23, 0x83,
+  0x23, 0xF0, 0x53, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6,
+  0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA2, 0x13, 0xA2, 0x23, 0x83, 0x25, 0x44,
+  0x4B, 0x86, 0x50, 0x94, 0xD3, 0xF2, 0xF0, 0xC3, 0xB3, 0x13, 0xA3, 0x33,
+  0x93, 0x43, 0x73, 0x53, 0x63, 0x73, 0x53, 0x82, 0x43, 0x93, 0x33, 0xA3,
+  0x13, 0xB3, 0x12, 0xD5, 0xE3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3,
+  0xF3, 0x70, 0x03, 0xC3, 0xC3, 0xCB, 0x4D, 0x23, 0x74, 0x13, 0x83, 0x13,
+  0x92, 0x13, 0x96, 0x96, 0x92, 0x13, 0x83, 0x13, 0x74, 0x1D, 0x2B, 0x43,
+  0xC3, 0xC3, 0xC3, 0xC3, 0xC0, 0x36, 0x69, 0x33, 0x44, 0x22, 0x63, 0x13,
+  0x72, 0x13, 0x72, 0x13, 0x72, 0x13, 0x63, 0x13, 0x53, 0x23, 0x34, 0x33,
+  0x35, 0x23, 0x63, 0x13, 0x76, 0x85, 0x85, 0x85, 0x76, 0x76, 0x54, 0x13,
+  0x26, 0x23, 0x24, 0x40, 0x33, 0xB3, 0xB2, 0xC2, 0xF0, 0x66, 0x69, 0x33,
+  0x43, 0x32, 0x63, 0x13, 0x63, 0xA3, 0x67, 0x3A, 0x15, 0x43, 0x13, 0x63,
+  0x12, 0x73, 0x12, 0x73, 0x13, 0x45, 0x28, 0x13, 0x25, 0x33, 0x63, 0xA2,
+  0xA2, 0xA2, 0xF0, 0x86, 0x69, 0x33, 0x43, 0x32, 0x63, 0x13, 0x63, 0xA3,
+  0x67, 0x3A, 0x15, 0x43, 0x13, 0x63, 0x12, 0x73, 0x12, 0x73, 0x13, 0x45,
+  0x28, 0x13, 0x25, 0x33, 0x53, 0x92, 0x12, 0x82, 0x13, 0x62, 0x32, 0xF0,
+  0x46, 0x69, 0x33, 0x43, 0x32, 0x63, 0x13, 0x63, 0xA3, 0x67, 0x3A, 0x15,
+  0x43, 0x13, 0x63, 0x12, 0x73, 0x12, 0x73, 0x13, 0x45, 0x28, 0x13, 0x25,
+  0x33, 0x34, 0x22, 0x57, 0x52, 0x33, 0xF0, 0x46, 0x69, 0x33, 0x43, 0x32,
+  0x63, 0x13, 0x63, 0xA3, 0x67, 0x3A, 0x15, 0x43, 0x13, 0x63, 0x12, 0x73,
+  0x12, 0x73, 0x13, 0x45, 0x28, 0x13, 0x25, 0x33, 0x33, 0x23, 0x53, 0x23,
+  0x53, 0x23, 0xF0, 0xF0, 0x16, 0x69, 0x33, 0x43, 0x32, 0x63, 0x13, 0x63,
+  0xA3, 0x67, 0x3A, 0x15, 0x43, 0x13, 0x63, 0x12, 0x73, 0x12, 0x73, 0x13,
+  0x45, 0x28, 0x13, 0x25, 0x33, 0x62, 0x95, 0x82, 0x12, 0x81, 0x31, 0x82,
+  0x12, 0x85, 0x93, 0x86, 0x69, 0x33, 0x43, 0x32, 0x63, 0x13, 0x63, 0xA3,
+  0x67, 0x3A, 0x15, 0x43, 0x13, 0x63, 0x12, 0x73, 0x12, 0x73, 0x13, 0x45,
+  0x28, 0x13, 0x25, 0x33, 0x36, 0x45, 0x68, 0x28, 0x33, 0x46, 0x34, 0x22,
+  0x64, 0x62, 0xA3, 0x73, 0x93, 0x82, 0x4F, 0x03, 0x1F, 0x0A, 0x52, 0xB3,
+  0x63, 0xA2, 0x73, 0x75, 0x65, 0x62, 0x13, 0x43, 0x13, 0x34, 0x28, 0x29,
+  0x45, 0x65, 0x40, 0x45, 0x58, 0x34, 0x33, 0x22, 0x66, 0x65, 0xA2, 0xA2,
+  0xA2, 0xA2, 0xA3, 0x63, 0x12, 0x63, 0x13, 0x43, 0x38, 0x65, 0x81, 0xA4,
+  0xB2, 0x51, 0x33, 0x65, 0x40, 0x33, 0xB3, 0xB2, 0xC2, 0xF0, 0x75, 0x69,
+  0x34, 0x33, 0x32, 0x63, 0x13, 0x72, 0x12, 0x8F, 0x0F, 0x01, 0xB2, 0xB3,
+  0x72, 0x22, 0x63, 0x24, 0x34, 0x39, 0x65, 0x40, 0x73, 0x93, 0x93, 0xA2,
+  0xF0, 0x85, 0x69, 0x34, 0x33, 0x32, 0x63, 0x13, 0x72, 0x12, 0x8F, 0x0F,
+  0x01, 0xB2, 0xB3, 0x72, 0x22, 0x63, 0x24, 0x34, 0x39, 0x65, 0x40, 0x53,
+  0x92, 0x12, 0x82, 0x22, 0x62, 0x32, 0xF0, 0x55, 0x69, 0x34, 0x33, 0x32,
+  0x63, 0x13, 0x72, 0x12, 0x8F, 0x0F, 0x01, 0xB2, 0xB3, 0x72, 0x22, 0x63,
+  0x24, 0x34, 0x39, 0x65, 0x40, 0x32, 0x32, 0x62, 0x32, 0x62, 0x32, 0xF0,
+  0xF0, 0x35, 0x69, 0x34, 0x33, 0x32, 0x63, 0x13, 0x72, 0x12, 0x8F, 0x0F,
+  0x01, 0xB2, 0xB3, 0x72, 0x22, 0x63, 0x24, 0x34, 0x39, 0x65, 0x40, 0x03,
+  0x43, 0x43, 0x42, 0x92, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+  0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x20, 0x33, 0x23, 0x23, 0x32, 0xB2,
+  0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+  0x42, 0x42, 0x20, 0x23, 0x45, 0x32, 0x13, 0x12, 0x32, 0xF0, 0x43, 0x53,
+  0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
+  0x53, 0x30, 0x03, 0x25, 0x25, 0x22, 0xF0, 0x83, 0x43, 0x43, 0x43, 0x43,
+  0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x20, 0x21,
+  0xB4, 0x22, 0x75, 0x75, 0x82, 0x23, 0xB3, 0x67, 0x59, 0x34, 0x34, 0x22,
+  0x63, 0x13, 0x72, 0x12, 0x85, 0x85, 0x85, 0x85, 0x86, 0x72, 0x22, 0x63,
+  0x24, 0x34, 0x39, 0x65, 0x40, 0x24, 0x22, 0x37, 0x32, 0x33, 0xD2, 0x25,
+  0x2A, 0x14, 0x46, 0x55, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
+  0x74, 0x74, 0x72, 0x33, 0xB3, 0xB2, 0xC2, 0xF0, 0x75, 0x69, 0x34, 0x33,
+  0x32, 0x63, 0x13, 0x72, 0x12, 0x85, 0x85, 0x85, 0x85, 0x86, 0x72, 0x22,
+  0x63, 0x24, 0x33, 0x49, 0x65, 0x40, 0x63, 0xA2, 0xA2, 0xB1, 0xF0, 0x95,
+  0x69, 0x34, 0x33, 0x32, 0x63, 0x13, 0x72, 0x12, 0x85, 0x85, 0x85, 0x85,
+  0x86, 0x72, 0x22, 0x63, 0x24, 0x33, 0x49, 0x65, 0x40, 0x53, 0x94, 0x82,
+  0x22, 0x72, 0x32, 0xF0, 0x55, 0x69, 0x34, 0x33, 0x32, 0x63, 0x13, 0x72,
+  0x12, 0x85, 0x85, 0x85, 0x85, 0x86, 0x72, 0x22, 0x63, 0x24, 0x33, 0x49,
+  0x65, 0x40, 0x33, 0x32, 0x57, 0x52, 0x33, 0xF0, 0x55, 0x69, 0x34, 0x33,
+  0x32, 0x63, 0x13, 0x72, 0x12, 0x85, 0x85, 0x85, 0x85, 0x86, 0x72, 0x22,
+  0x63, 0x24, 0x33, 0x49, 0x65, 0x40, 0x23, 0x23, 0x53, 0x23, 0x53, 0x23,
+  0xF0, 0xF0, 0x35, 0x69, 0x34, 0x33, 0x32, 0x63, 0x13, 0x72, 0x12, 0x85,
+  0x85, 0x85, 0x85, 0x86, 0x72, 0x22, 0x63, 0x24, 0x33, 0x49, 0x65, 0x40,
+  0x62, 0xC2, 0xC2, 0xF0, 0xF0, 0xF0, 0x3F, 0x0D, 0xF0, 0xF0, 0x42, 0xC2,
+  0xC2, 0x60, 0x55, 0x31, 0x38, 0x12, 0x24, 0x34, 0x32, 0x63, 0x23, 0x54,
+  0x22, 0x52, 0x13, 0x12, 0x42, 0x23, 0x12, 0x41, 0x33, 0x12, 0x31, 0x43,
+  0x12, 0x21, 0x53, 0x14, 0x62, 0x32, 0x63, 0x34, 0x33, 0x3B, 0x22, 0x35,
+  0x40, 0x23, 0x92, 0xA2, 0xA2, 0xF2, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
+  0x74, 0x74, 0x74, 0x74, 0x65, 0x66, 0x4F, 0x26, 0x12, 0xB0, 0x63, 0x73,
+  0x82, 0x82, 0xF0, 0x12, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
+  0x74, 0x74, 0x65, 0x66, 0x4F, 0x26, 0x12, 0xB0, 0x43, 0x75, 0x53, 0x12,
+  0x52, 0x32, 0xD2, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
+  0x74, 0x65, 0x66, 0x4F, 0x26, 0x12, 0xB0, 0x22, 0x23, 0x42, 0x23, 0x42,
+  0x23, 0xF0, 0x92, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
+  0x74, 0x65, 0x66, 0x4F, 0x26, 0x12, 0xB0, 0x73, 0xA2, 0xA2, 0xA2, 0xF0,
+  0x43, 0x73, 0x12, 0x72, 0x23, 0x53, 0x23, 0x53, 0x32, 0x52, 0x42, 0x43,
+  0x43, 0x33, 0x52, 0x32, 0x62, 0x23, 0x63, 0x12, 0x82, 0x12, 0x85, 0x84,
+  0xA3, 0xA3, 0xA2, 0xB2, 0xA3, 0x93, 0x85, 0x84, 0x80, 0x02, 0xA2, 0xA2,
+  0xA2, 0xA2, 0xA2, 0x25, 0x3A, 0x24, 0x43, 0x13, 0x65, 0x75, 0x84, 0x84,
+  0x84, 0x84, 0x84, 0x76, 0x67, 0x43, 0x1A, 0x22, 0x25, 0x32, 0xA2, 0xA2,
+  0xA2, 0xA2, 0xA0, 0x33, 0x23, 0x53, 0x23, 0x53, 0x23, 0xF0, 0xD3, 0x73,
+  0x12, 0x72, 0x23, 0x53, 0x23, 0x53, 0x32, 0x52, 0x42, 0x43, 0x43, 0x33,
+  0x52, 0x32, 0x62, 0x23, 0x63, 0x12, 0x82, 0x12, 0x85, 0x84, 0xA3, 0xA3,
+  0xA2, 0xB2, 0xA3, 0x93, 0x85, 0x84, 0x80 };
+
+constexpr GFXglyph FreeSans_RLE_14pt8bGlyphs[] PROGMEM = {
+  {     0,   1,   1,   7,    0,    0 },   // 0x20 ' '
+  {     1,   3,  20,   9,    3,  -19 },   // 0x21 '!'
+  {     9,   7,   7,   9,    1,  -18 },   // 0x22 '"'
+  {    20,  15,  19,  15,    0,  -18 },   // 0x23 '#'
+  {    55,  13,  24,  15,    1,  -20 },   // 0x24 '$'
+  {    96,  23,  19,  24,    1,  -18 },   // 0x25 '%'
+  {   144,  16,  19,  18,    1,  -18 },   // 0x26 '&'
+  {   180,   3,   7,   5,    1,  -18 },   // 0x27 '''
+  {   186,   6,  26,   9,    2,  -19 },   // 0x28 '('
+  {   212,   6,  26,   9,    1,  -19 },   // 0x29 ')'
+  {   239,   8,   8,  11,    1,  -19 },   // 0x2A '*'
+  {   251,  14,  13,  16,    1,  -12 },   // 0x2B '+'
+  {   265,   3,   7,   8,    2,   -2 },   // 0x2C ','
+  {   270,   7,   2,   9,    1,   -8 },   // 0x2D '-'
+  {   271,   3,   3,   7,    2,   -2 },   // 0x2E '.'
+  {   272,   8,  20,   8,    0,  -19 },   // 0x2F '/'
+  {   293,  13,  19,  15,    1,  -18 },   // 0x30 '0'
+  {   322,   7,  19,  15,    3,  -18 },   // 0x31 '1'
+  {   340,  13,  19,  15,    1,  -18 },   // 0x32 '2'
+  {   362,  13,  19,  15,    1,  -18 },   // 0x33 '3'
+  {   387,  13,  19,  15,    1,  -18 },   // 0x34 '4'
+  {   414,  13,  19,  15,    1,  -18 },   // 0x35 '5'
+  {   438,  13,  19,  15,    1,  -18 },   // 0x36 '6'
+  {   467,  13,  19,  15,    1,  -18 },   // 0x37 '7'
+  {   487,  13,  19,  15,    1,  -18 },   // 0x38 '8'
+  {   516,  13,  19,  15,    1,  -18 },   // 0x39 '9'
+  {   545,   3,  15,   7,    2,  -14 },   // 0x3A ':'
+  {   548,   3,  19,   7,    2,  -14 },   // 0x3B ';'
+  {   555,  14,  13,  16,    1,  -12 },   // 0x3C '<'
+  {   568,  14,   7,  16,    1,   -9 },   // 0x3D '='
+  {   574,  14,  13,  16,    1,  -12 },   // 0x3E '>'
+  {   588,  12,  20,  15,    2,  -19 },   // 0x3F '?'
+  {   611,  25,  24,  28,    1,  -19 },   // 0x40 '@'
+  {   674,  18,  20,  18,    0,  -19 },   // 0x41 'A'
+  {   708,  15,  20,  18,    2,  -19 },   // 0x42 'B'
+  {   738,  17,  20,  19,    1,  -19 },   // 0x43 'C'
+  {   769,  16,  20,  19,    2,  -19 },   // 0x44 'D'
+  {   798,  15,  20,  17,    2,  -19 },   // 0x45 'E'
+  {   818,  14,  20,  16,    2,  -19 },   // 0x46 'F'
+  {   839,  18,  21,  21,    1,  -19 },   // 0x47 'G'
+  {   873,  16,  20,  20,    2,  -19 },   // 0x48 'H'
+  {   894,   2,  20,   8,    3,  -19 },   // 0x49 'I'
+  {   897,  11,  20,  14,    1,  -19 },   // 0x4A 'J'
+  {   919,  16,  20,  18,    2,  -19 },   // 0x4B 'K'
+  {   957,  13,  20,  15,    2,  -19 },   // 0x4C 'L'
+  {   977,  19,  20,  23,    2,  -19 },   // 0x4D 'M'
+  {  1026,  16,  20,  20,    2,  -19 },   // 0x4E 'N'
+  {  1057,  19,  20,  22,    1,  -19 },   // 0x4F 'O'
+  {  1088,  15,  20,  18,    2,  -19 },   // 0x50 'P'
+  {  1113,  19,  21,  22,    1,  -19 },   // 0x51 'Q'
+  {  1149,  16,  20,  19,    2,  -19 },   // 0x52 'R'
+  {  1184,  16,  20,  18,    1,  -19 },   // 0x53 'S'
+  {  1212,  16,  20,  17,    1,  -19 },   // 0x54 'T'
+  {  1234,  16,  20,  20,    2,  -19 },   // 0x55 'U'
+  {  1259,  17,  20,  18,    0,  -19 },   // 0x56 'V'
+  {  1295,  25,  20,  26,    0,  -19 },   // 0x57 'W'
+  {  1360,  18,  20,  18,    0,  -19 },   // 0x58 'X'
+  {  1396,  18,  20,  19,    0,  -19 },   // 0x59 'Y'
+  {  1427,  15,  20,  17,    1,  -19 },   // 0x5A 'Z'
+  {  1447,   5,  26,   8,    2,  -19 },   // 0x5B '['
+  {  1470,   8,  20,   8,    0,  -19 },   // 0x5C '\'
+  {  1490,   5,  26,   8,    1,  -19 },   // 0x5D ']'
+  {  1513,  11,  10,  13,    1,  -18 },   // 0x5E '^'
+  {  1532,  17,   1,  15,   -1,    5 },   // 0x5F '_'
+  {  1534,   5,   4,   7,    1,  -19 },   // 0x60 '`'
+  {  1538,  13,  15,  15,    1,  -14 },   // 0x61 'a'
+  {  1563,  13,  20,  15,    2,  -19 },   // 0x62 'b'
+  {  1598,  12,  15,  14,    1,  -14 },   // 0x63 'c'
+  {  1618,  13,  21,  15,    1,  -19 },   // 0x64 'd'
+  {  1646,  13,  15,  15,    1,  -14 },   // 0x65 'e'
+  {  1668,   6,  20,   8,    1,  -19 },   // 0x66 'f'
+  {  1688,  12,  20,  15,    1,  -14 },   // 0x67 'g'
+  {  1717,  11,  20,  15,    2,  -19 },   // 0x68 'h'
+  {  1740,   2,  20,   6,    2,  -19 },   // 0x69 'i'
+  {  1743,   5,  26,   7,    0,  -19 },   // 0x6A 'j'
+  {  1767,  12,  20,  14,    2,  -19 },   // 0x6B 'k'
+  {  1801,   2,  20,   6,    2,  -19 },   // 0x6C 'l'
+  {  1804,  19,  15,  22,    2,  -14 },   // 0x6D 'm'
+  {  1837,  11,  15,  15,    2,  -14 },   // 0x6E 'n'
+  {  1854,  13,  15,  15,    1,  -14 },   // 0x6F 'o'
+  {  1876,  13,  20,  15,    2,  -14 },   // 0x70 'p'
+  {  1909,  13,  20,  15,    1,  -14 },   // 0x71 'q'
+  {  1936,   7,  15,   9,    2,  -14 },   // 0x72 'r'
+  {  1952,  12,  15,  14,    1,  -14 },   // 0x73 's'
+  {  1972,   6,  19,   8,    1,  -18 },   // 0x74 't'
+  {  1990,  11,  16,  15,    2,  -14 },   // 0x75 'u'
+  {  2007,  13,  15,  14,    0,  -14 },   // 0x76 'v'
+  {  2035,  20,  15,  20,    0,  -14 },   // 0x77 'w'
+  {  2083,  13,  15,  13,    0,  -14 },   // 0x78 'x'
+  {  2110,  13,  21,  13,    0,  -14 },   // 0x79 'y'
+  {  2143,  12,  15,  13,    1,  -14 },   // 0x7A 'z'
+  {  2158,   7,  26,   9,    1,  -19 },   // 0x7B '{'
+  {  2184,   1,  26,   7,    3,  -19 },   // 0x7C '|'
+  {  2186,   6,  26,   9,    2,  -19 },   // 0x7D '}'
+  {  2213,  12,   5,  14,    1,  -11 },   // 0x7E '~'
+  {  2221,  20,  26,  22,    1,  -21 },   // 0x7F ''
+  {  2274,  20,  26,  22,    1,  -21 },   // 0x80 ''
+  {  2327,  20,  26,  22,    1,  -21 },   // 0x81 ''
+  {  2380,  20,  26,  22,    1,  -21 },   // 0x82 ''
+  {  2433,  20,  26,  22,    1,  -21 },   // 0x83 ''
+  {  2486,  20,  26,  22,    1,  -21 },   // 0x84 ''
+  {  2539,  20,  26,  22,    1,  -21 },   // 0x85 ''
+  {  2592,  20,  26,  22,    1,  -21 },   // 0x86 ''
+  {  2645,  20,  26,  22,    1,  -21 },   // 0x87 ''
+  {  2698,  20,  26,  22,    1,  -21 },   // 0x88 ''
+  {  2751,  20,  26,  22,    1,  -21 },   // 0x89 ''
+  {  2804,  20,  26,  22,    1,  -21 },   // 0x8A ''
+  {  2857,  20,  26,  22,    1,  -21 },   // 0x8B ''
+  {  2910,  20,  26,  22,    1,  -21 },   // 0x8C ''
+  {  2963,  20,  26,  22,    1,  -21 },   // 0x8D ''
+  {  3016,  20,  26,  22,    1,  -21 },   // 0x8E ''
+  {  3069,  20,  26,  22,    1,  -21 },   // 0x8F ''
+  {  3122,  20,  26,  22,    1,  -21 },   // 0x90 ''
+  {  3175,  20,  26,  22,    1,  -21 },   // 0x91 ''
+  {  3228,  20,  26,  22,    1,  -21 },   // 0x92 ''
+  {  3281,  20,  26,  22,    1,  -21 },   // 0x93 ''
+  {  3334,  20,  26,  22,    1,  -21 },   // 0x94 ''
+  {  3387,  20,  26,  22,    1,  -21 },   // 0x95 ''
+  {  3440,  20,  26,  22,    1,  -21 },   // 0x96 ''
+  {  3493,  20,  26,  22,    1,  -21 },   // 0x97 ''
+  {  3546,  20,  26,  22,    1,  -21 },   // 0x98 ''
+  {  3599,  20,  26,  22,    1,  -21 },   // 0x99 ''
+  {  3652,  20,  26,  22,    1,  -21 },   // 0x9A ''
+  {  3705,  20,  26,  22,    1,  -21 },   // 0x9B ''
+  {  3758,  20,  26,  22,    1,  -21 },   // 0x9C ''
+  {  3811,  20,  26,  22,    1,  -21 },   // 0x9D ''
+  {  3864,  20,  26,  22,    1,  -21 },   // 0x9E ''
+  {  3917,  20,  26,  22,    1,  -21 },   // 0x9F ''
+  {  3970,   1,   1,   8,    0,    0 },   // 0xA0 ''
+  {  3971,   3,  20,   9,    3,  -13 },   // 0xA1 ''
+  {  3980,  13,  20,  15,    1,  -16 },   // 0xA2 ''
+  {  4018,  14,  20,  15,    1,  -19 },   // 0xA3 ''
+  {  4045,  11,  12,  15,    2,  -14 },   // 0xA4 ''
+  {  4064,  15,  19,  15,    0,  -18 },   // 0xA5 ''
+  {  4092,   1,  26,   7,    3,  -19 },   // 0xA6 ''
+  {  4094,  13,  26,  15,    1,  -19 },   // 0xA7 ''
+  {  4137,   7,   3,   9,    1,  -19 },   // 0xA8 ''
+  {  4141,  20,  19,  22,    1,  -18 },   // 0xA9 ''
+  {  4190,   8,  11,  10,    1,  -19 },   // 0xAA ''
+  {  4207,  10,   9,  14,    2,  -11 },   // 0xAB ''
+  {  4225,  14,   8,  16,    1,   -9 },   // 0xAC ''
+  {  4233,   7,   2,   9,    1,   -8 },   // 0xAD ''
+  {  4234,  20,  19,  22,    1,  -18 },   // 0xAE ''
+  {  4285,   7,   2,   9,    1,  -18 },   // 0xAF ''
+  {  4286,   8,   9,  17,    4,  -18 },   // 0xB0 ''
+  {  4298,  14,  18,  16,    1,  -17 },   // 0xB1 ''
+  {  4316,   8,  12,  10,    1,  -21 },   // 0xB2 ''
+  {  4329,   9,  11,  10,    0,  -21 },   // 0xB3 ''
+  {  4345,   5,   4,   9,    3,  -19 },   // 0xB4 ''
+  {  4350,  13,  20,  15,    2,  -14 },   // 0xB5 ''
+  {  4384,  13,  25,  15,    1,  -19 },   // 0xB6 ''
+  {  4433,   3,   3,   7,    2,   -8 },   // 0xB7 ''
+  {  4434,   7,   6,   9,    1,    1 },   // 0xB8 ''
+  {  4441,   4,  11,  10,    2,  -21 },   // 0xB9 ''
+  {  4451,   8,  11,  10,    1,  -19 },   // 0xBA ''
+  {  4463,  10,   9,  14,    2,  -11 },   // 0xBB ''
+  {  4481,  21,  20,  24,    2,  -18 },   // 0xBC ''
+  {  4529,  21,  20,  24,    2,  -19 },   // 0xBD ''
+  {  4575,  22,  21,  24,    1,  -19 },   // 0xBE ''
+  {  4630,  11,  20,  15,    3,  -13 },   // 0xBF ''
+  {  4651,  18,  24,  18,    0,  -23 },   // 0xC0 ''
+  {  4692,  18,  24,  18,    0,  -23 },   // 0xC1 ''
+  {  4731,  18,  24,  18,    0,  -23 },   // 0xC2 ''
+  {  4770,  18,  24,  18,    0,  -23 },   // 0xC3 ''
+  {  4811,  18,  24,  18,    0,  -23 },   // 0xC4 ''
+  {  4852,  18,  27,  18,    0,  -26 },   // 0xC5 ''
+  {  4896,  26,  20,  27,    0,  -19 },   // 0xC6 ''
+  {  4941,  17,  25,  19,    1,  -19 },   // 0xC7 ''
+  {  4979,  15,  24,  17,    2,  -23 },   // 0xC8 ''
+  {  5003,  15,  24,  17,    2,  -23 },   // 0xC9 ''
+  {  5027,  15,  24,  17,    2,  -23 },   // 0xCA ''
+  {  5052,  15,  24,  17,    2,  -23 },   // 0xCB ''
+  {  5079,   6,  24,   8,    0,  -23 },   // 0xCC ''
+  {  5103,   7,  24,   8,    1,  -23 },   // 0xCD ''
+  {  5127,   8,  24,   8,    0,  -23 },   // 0xCE ''
+  {  5152,   8,  24,   8,    0,  -23 },   // 0xCF ''
+  {  5177,  17,  20,  19,    1,  -19 },   // 0xD0 ''
+  {  5212,  16,  24,  20,    2,  -23 },   // 0xD1 ''
+  {  5249,  19,  24,  22,    1,  -23 },   // 0xD2 ''
+  {  5287,  19,  24,  22,    1,  -23 },   // 0xD3 ''
+  {  5323,  19,  24,  22,    1,  -23 },   // 0xD4 ''
+  {  5360,  19,  24,  22,    1,  -23 },   // 0xD5 ''
+  {  5398,  19,  24,  22,    1,  -23 },   // 0xD6 ''
+  {  5436,  10,  11,  16,    3,  -11 },   // 0xD7 ''
+  {  5450,  20,  20,  22,    1,  -19 },   // 0xD8 ''
+  {  5499,  16,  24,  20,    2,  -23 },   // 0xD9 ''
+  {  5528,  16,  24,  20,    2,  -23 },   // 0xDA ''
+  {  5557,  16,  24,  20,    2,  -23 },   // 0xDB ''
+  {  5587,  16,  24,  20,    2,  -23 },   // 0xDC ''
+  {  5619,  18,  24,  19,    0,  -23 },   // 0xDD ''
+  {  5654,  15,  20,  18,    2,  -19 },   // 0xDE ''
+  {  5681,  13,  21,  16,    2,  -20 },   // 0xDF ''
+  {  5716,  13,  20,  15,    1,  -19 },   // 0xE0 ''
+  {  5746,  13,  20,  15,    1,  -19 },   // 0xE1 ''
+  {  5776,  13,  20,  15,    1,  -19 },   // 0xE2 ''
+  {  5809,  13,  19,  15,    1,  -18 },   // 0xE3 ''
+  {  5840,  13,  20,  15,    1,  -19 },   // 0xE4 ''
+  {  5873,  13,  22,  15,    1,  -21 },   // 0xE5 ''
+  {  5908,  22,  15,  24,    1,  -14 },   // 0xE6 ''
+  {  5943,  12,  20,  14,    1,  -14 },   // 0xE7 ''
+  {  5969,  13,  20,  15,    1,  -19 },   // 0xE8 ''
+  {  5996,  13,  20,  15,    1,  -19 },   // 0xE9 ''
+  {  6023,  13,  20,  15,    1,  -19 },   // 0xEA ''
+  {  6053,  13,  20,  15,    1,  -19 },   // 0xEB ''
+  {  6083,   6,  20,   6,    0,  -19 },   // 0xEC ''
+  {  6103,   6,  20,   6,    0,  -19 },   // 0xED ''
+  {  6123,   8,  21,   7,    0,  -20 },   // 0xEE ''
+  {  6146,   7,  21,   7,    0,  -20 },   // 0xEF ''
+  {  6167,  13,  21,  15,    1,  -20 },   // 0xF0 ''
+  {  6197,  11,  19,  15,    2,  -18 },   // 0xF1 ''
+  {  6219,  13,  20,  15,    1,  -19 },   // 0xF2 ''
+  {  6246,  13,  20,  15,    1,  -19 },   // 0xF3 ''
+  {  6273,  13,  20,  15,    1,  -19 },   // 0xF4 ''
+  {  6302,  13,  19,  15,    1,  -18 },   // 0xF5 ''
+  {  6330,  13,  20,  15,    1,  -19 },   // 0xF6 ''
+  {  6360,  14,  13,  16,    1,  -12 },   // 0xF7 ''
+  {  6374,  14,  15,  15,    0,  -14 },   // 0xF8 ''
+  {  6409,  11,  21,  15,    2,  -19 },   // 0xF9 ''
+  {  6430,  11,  21,  15,    2,  -19 },   // 0xFA ''
+  {  6452,  11,  21,  15,    2,  -19 },   // 0xFB ''
+  {  6475,  11,  21,  15,    2,  -19 },   // 0xFC ''
+  {  6499,  13,  26,  13,    0,  -19 },   // 0xFD ''
+  {  6537,  12,  25,  15,    2,  -19 },   // 0xFE ''
+  {  6567,  13,  26,  13,    0,  -19 } }; // 0xFF ''
+
+constexpr GFXfont FreeSans_RLE_14pt8b PROGMEM = {
+  (uint8_t  *)FreeSans_RLE_14pt8bBitmaps,
+  (GFXglyph *)FreeSans_RLE_14pt8bGlyphs,
+  0x20, 0xFF, 33 };
+
+// Approx. 8182 bytes
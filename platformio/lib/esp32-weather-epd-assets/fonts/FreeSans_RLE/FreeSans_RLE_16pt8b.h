@@ -0,0 +1,894 @@
+// Run-length encoded glyph bitmaps (fontconvert -r)
+#define FreeSans_RLE_16pt8b_RLE
+
+const uint8_t FreeSans_RLE_16pt8bBitmaps[] PROGMEM = {
+  0x10, 0x0F, 0x0F, 0x05, 0x12, 0x12, 0x12, 0x12, 0x12, 0x21, 0x79, 0x03,
+  0x26, 0x26, 0x26, 0x26, 0x23, 0x12, 0x32, 0x12, 0x32, 0x11, 0x41, 0x10,
+  0x63, 0x42, 0x83, 0x33, 0x82, 0x43, 0x82, 0x43, 0x82, 0x42, 0x83, 0x42,
+  0x5F, 0x2F, 0x52, 0x43, 0x82, 0x42, 0x92, 0x42, 0x83, 0x42, 0x83, 0x42,
+  0x82, 0x43, 0x4F, 0x01, 0x1F, 0x01, 0x43, 0x42, 0x83, 0x42, 0x83, 0x33,
+  0x82, 0x43, 0x82, 0x42, 0x92, 0x42, 0x60, 0x71, 0xE1, 0xB7, 0x6B, 0x34,
+  0x21, 0x24, 0x23, 0x31, 0x33, 0x22, 0x41, 0x42, 0x13, 0x41, 0x46, 0x41,
+  0x82, 0x41, 0x83, 0x31, 0x85, 0x11, 0x99, 0x89, 0x97, 0x81, 0x34, 0x71,
+  0x43, 0x71, 0x55, 0x41, 0x55, 0x41, 0x55, 0x41, 0x43, 0x13, 0x31, 0x34,
+  0x14, 0x21, 0x24, 0x3B, 0x67, 0xB1, 0xE1, 0xE1, 0x70, 0xF0, 0x32, 0x95,
+  0x92, 0x88, 0x82, 0x82, 0x43, 0x62, 0x82, 0x62, 0x62, 0x82, 0x63, 0x42,
+  0x92, 0x63, 0x32, 0xA3, 0x52, 0x42, 0xB3, 0x33, 0x32, 0xD7, 0x42, 0xE4,
+  0x52, 0xF0, 0x92, 0xF0, 0x82, 0x55, 0xD3, 0x47, 0xC2, 0x43, 0x33, 0xA2,
+  0x43, 0x53, 0x92, 0x42, 0x72, 0x82, 0x52, 0x72, 0x82, 0x53, 0x53, 0x72,
+  0x73, 0x33, 0x82, 0x87, 0x82, 0xA5, 0x30, 0x55, 0xC7, 0xA3, 0x33, 0x83,
+  0x52, 0x83, 0x53, 0x73, 0x53, 0x73, 0x52, 0x93, 0x33, 0xA7, 0xB6, 0xC4,
+  0xC7, 0xA3, 0x33, 0x33, 0x23, 0x53, 0x23, 0x22, 0x73, 0x12, 0x32, 0x76,
+  0x32, 0x85, 0x33, 0x83, 0x44, 0x65, 0x45, 0x15, 0x13, 0x49, 0x24, 0x46,
+  0x54, 0x0E, 0x12, 0x12, 0x12, 0x10, 0x52, 0x42, 0x52, 0x42, 0x52, 0x42,
+  0x52, 0x43, 0x43, 0x42, 0x52, 0x52, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+  0x52, 0x52, 0x52, 0x53, 0x52, 0x52, 0x53, 0x52, 0x52, 0x62, 0x62, 0x02,
+  0x62, 0x62, 0x52, 0x53, 0x52, 0x52, 0x53, 0x52, 0x52, 0x53, 0x43, 0x43,
+  0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x42, 0x52, 0x52, 0x43, 0x42, 0x52,
+  0x42, 0x52, 0x42, 0x52, 0x40, 0x42, 0x82, 0x82, 0x4A, 0x18, 0x44, 0x64,
+  0x52, 0x22, 0x41, 0x41, 0x20, 0x62, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2,
+  0x7F, 0x0F, 0x62, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0x70, 0x09, 0x12, 0x12,
+  0x12, 0x11, 0x12, 0x10, 0x0F, 0x01, 0x0C, 0x72, 0x71, 0x72, 0x72, 0x71,
+  0x72, 0x72, 0x71, 0x72, 0x72, 0x71, 0x72, 0x72, 0x72, 0x62, 0x72, 0x72,
+  0x71, 0x72, 0x72, 0x71, 0x72, 0x72, 0x70, 0x55, 0x89, 0x55, 0x15, 0x43,
+  0x53, 0x33, 0x73, 0x23, 0x73, 0x23, 0x82, 0x22, 0x96, 0x96, 0x96, 0x96,
+  0x96, 0x96, 0x93, 0x12, 0x93, 0x13, 0x82, 0x23, 0x73, 0x23, 0x73, 0x33,
+  0x53, 0x44, 0x34, 0x59, 0x85, 0x50, 0x62, 0x53, 0x53, 0x3F, 0x06, 0x53,
+  0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
+  0x53, 0x53, 0x53, 0x56, 0x7A, 0x45, 0x16, 0x24, 0x63, 0x23, 0x83, 0x13,
+  0x83, 0x12, 0x93, 0x12, 0x93, 0xC3, 0xB3, 0xB4, 0x95, 0x85, 0x95, 0x85,
+  0x94, 0xA4, 0xB3, 0xC2, 0xCF, 0x0F, 0x0F, 0x46, 0x89, 0x55, 0x15, 0x33,
+  0x64, 0x23, 0x73, 0x22, 0x83, 0x13, 0x83, 0xC3, 0xB3, 0x86, 0x96, 0xC5,
+  0xC3, 0xD3, 0xC6, 0x96, 0x96, 0x83, 0x23, 0x73, 0x26, 0x15, 0x4A, 0x77,
+  0x40, 0xA2, 0xC3, 0xB4, 0xA5, 0xA5, 0x96, 0x83, 0x13, 0x73, 0x23, 0x72,
+  0x33, 0x63, 0x33, 0x53, 0x43, 0x43, 0x53, 0x42, 0x63, 0x33, 0x63, 0x3F,
+  0x0F, 0x93, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0x30, 0x2C, 0x3C, 0x3C, 0x33,
+  0xC2, 0xD2, 0xC3, 0xC3, 0x16, 0x5B, 0x46, 0x16, 0x23, 0x73, 0xC4, 0xC3,
+  0xC3, 0xC3, 0xC6, 0x96, 0x83, 0x23, 0x73, 0x35, 0x15, 0x4A, 0x76, 0x50,
+  0x65, 0x88, 0x6A, 0x43, 0x63, 0x33, 0x63, 0x23, 0x83, 0x13, 0xC2, 0xD2,
+  0x35, 0x43, 0x19, 0x2E, 0x15, 0x63, 0x14, 0x86, 0x96, 0x93, 0x12, 0x93,
+  0x13, 0x83, 0x13, 0x83, 0x23, 0x63, 0x3B, 0x59, 0x86, 0x40, 0x0F, 0x0F,
+  0x0F, 0xC2, 0xC3, 0xB3, 0xC2, 0xC3, 0xC2, 0xC3, 0xB3, 0xC3, 0xB3, 0xC3,
+  0xC2, 0xC3, 0xC3, 0xC2, 0xC3, 0xC3, 0xC3, 0xB3, 0x90, 0x55, 0x89, 0x55,
+  0x15, 0x34, 0x63, 0x23, 0x73, 0x23, 0x73, 0x23, 0x73, 0x23, 0x73, 0x33,
+  0x53, 0x59, 0x69, 0x55, 0x24, 0x33, 0x73, 0x13, 0x96, 0x96, 0x96, 0x96,
+  0x93, 0x13, 0x73, 0x35, 0x16, 0x4A, 0x76, 0x40, 0x55, 0x89, 0x55, 0x15,
+  0x33, 0x64, 0x23, 0x73, 0x13, 0x92, 0x13, 0x96, 0x96, 0x93, 0x13, 0x74,
+  0x13, 0x65, 0x25, 0x17, 0x38, 0x13, 0x46, 0x23, 0xC3, 0xC2, 0x22, 0x83,
+  0x23, 0x73, 0x23, 0x63, 0x45, 0x14, 0x68, 0x86, 0x50, 0x0C, 0xF0, 0xF0,
+  0xEC, 0x13, 0x13, 0x13, 0xF0, 0xF0, 0xEC, 0x22, 0x22, 0x22, 0x12, 0x12,
+  0x20, 0xE2, 0xC4, 0x96, 0x86, 0x86, 0x76, 0x86, 0xA4, 0xC6, 0xD5, 0xD6,
+  0xC6, 0xD6, 0xC4, 0xF1, 0x0F, 0x0F, 0xF0, 0xF0, 0xFF, 0x0F, 0x01, 0xE3,
+  0xC6, 0xB6, 0xC5, 0xC6, 0xC5, 0xC3, 0x96, 0x76, 0x75, 0x76, 0x76, 0x93,
+  0xC1, 0xE0, 0x46, 0x6A, 0x4B, 0x23, 0x63, 0x22, 0x83, 0x12, 0x86, 0x83,
+  0xB3, 0xA3, 0xA4, 0x94, 0x94, 0x94, 0xA3, 0xB2, 0xC2, 0xC2, 0xF0, 0xF0,
+  0xF0, 0x92, 0xC2, 0xC2, 0x60, 0xC7, 0xF0, 0x4D, 0xE7, 0x28, 0xB4, 0xA5,
+  0x93, 0xE4, 0x73, 0xF0, 0x14, 0x53, 0xF0, 0x33, 0x43, 0x84, 0x83, 0x32,
+  0x77, 0x22, 0x33, 0x23, 0x63, 0x45, 0x43, 0x12, 0x63, 0x63, 0x53, 0x12,
+  0x53, 0x73, 0x56, 0x53, 0x73, 0x56, 0x43, 0x82, 0x66, 0x43, 0x82, 0x62,
+  0x13, 0x43, 0x73, 0x53, 0x13, 0x43, 0x72, 0x63, 0x13, 0x53, 0x53, 0x53,
+  0x33, 0x44, 0x35, 0x24, 0x43, 0x57, 0x18, 0x54, 0x55, 0x36, 0x74, 0xF0,
+  0xB4, 0xF0, 0xB4, 0xF0, 0xB6, 0x73, 0xFE, 0xF0, 0x2B, 0x90, 0x85, 0xF5,
+  0xF5, 0xE3, 0x13, 0xD3, 0x13, 0xD3, 0x13, 0xC3, 0x33, 0xB3, 0x33, 0xB3,
+  0x33, 0xA3, 0x53, 0x93, 0x53, 0x92, 0x63, 0x83, 0x73, 0x73, 0x73, 0x6E,
+  0x6F, 0x53, 0x93, 0x43, 0xA3, 0x43, 0xB3, 0x33, 0xB3, 0x23, 0xC4, 0x13,
+  0xD3, 0x13, 0xD3, 0x0D, 0x5F, 0x3F, 0x01, 0x23, 0x94, 0x23, 0xA3, 0x23,
+  0xB3, 0x13, 0xB2, 0x23, 0xA3, 0x23, 0xA3, 0x23, 0x93, 0x3E, 0x4F, 0x3F,
+  0x01, 0x23, 0xA4, 0x13, 0xB3, 0x13, 0xB3, 0x13, 0xC6, 0xC2, 0x13, 0xB3,
+  0x13, 0xA4, 0x1F, 0x01, 0x2F, 0x3E, 0x40, 0x77, 0xBB, 0x8D, 0x64, 0x74,
+  0x44, 0x94, 0x33, 0xB3, 0x23, 0xC3, 0x23, 0xF0, 0x22, 0xF0, 0x23, 0xF0,
+  0x23, 0xF0, 0x23, 0xF0, 0x23, 0xF0, 0x23, 0xF0, 0x32, 0xE3, 0x13, 0xD3,
+  0x13, 0xC4, 0x14, 0xB3, 0x34, 0x94, 0x44, 0x74, 0x6D, 0x8B, 0xB7, 0x60,
+  0x0C, 0x7E, 0x5F, 0x01, 0x33, 0x94, 0x33, 0xB3, 0x23, 0xB4, 0x13, 0xC3,
+  0x13, 0xC3, 0x13, 0xC3, 0x13, 0xD6, 0xD6, 0xD6, 0xD6, 0xD2, 0x13, 0xC3,
+  0x13, 0xC3, 0x13, 0xC3, 0x13, 0xB4, 0x13, 0xB3, 0x23, 0x94, 0x3F, 0x01,
+  0x3E, 0x5D, 0x60, 0x0F, 0x01, 0x1F, 0x01, 0x1F, 0x01, 0x13, 0xE3, 0xE3,
+  0xE3, 0xE3, 0xE3, 0xE3, 0xEF, 0x01, 0x1F, 0x01, 0x1F, 0x01, 0x13, 0xE3,
+  0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xEF, 0x0F, 0x0F, 0x06, 0x0F, 0x0F, 0x0F,
+  0x06, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xDE, 0x2E, 0x2E, 0x23, 0xD3,
+  0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD0, 0x78, 0xBC, 0x8E,
+  0x64, 0x84, 0x44, 0xA4, 0x33, 0xC3, 0x23, 0xE3, 0x13, 0xF0, 0x32, 0xF0,
+  0x33, 0xF0, 0x33, 0x9C, 0x9C, 0x9C, 0xF0, 0x12, 0x13, 0xE3, 0x13, 0xE3,
+  0x13, 0xE3, 0x23, 0xC4, 0x24, 0xA5, 0x34, 0x86, 0x4E, 0x12, 0x5C, 0x22,
+  0x78, 0x42, 0xF0, 0x60, 0x03, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6,
+  0xC6, 0xC6, 0xCF, 0x0F, 0x0F, 0x0F, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6,
+  0xC6, 0xC6, 0xC6, 0xC3, 0x0F, 0x0F, 0x0F, 0x0F, 0x09, 0xA3, 0xA3, 0xA3,
+  0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA6,
+  0x76, 0x76, 0x76, 0x73, 0x13, 0x53, 0x25, 0x15, 0x39, 0x56, 0x40, 0x03,
+  0xB4, 0x13, 0xA4, 0x23, 0x94, 0x33, 0x84, 0x43, 0x74, 0x53, 0x64, 0x63,
+  0x54, 0x73, 0x44, 0x83, 0x34, 0x93, 0x33, 0xA3, 0x16, 0x93, 0x17, 0x86,
+  0x23, 0x85, 0x43, 0x74, 0x54, 0x63, 0x73, 0x63, 0x83, 0x53, 0x84, 0x43,
+  0x94, 0x33, 0xA3, 0x33, 0xA4, 0x23, 0xB4, 0x13, 0xC3, 0x10, 0x03, 0xC3,
+  0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3,
+  0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xCF, 0x0F, 0x0F, 0x05, 0xD9, 0xCA,
+  0xCB, 0xBB, 0xA9, 0x12, 0xA9, 0x13, 0x92, 0x16, 0x13, 0x83, 0x16, 0x22,
+  0x83, 0x16, 0x23, 0x72, 0x26, 0x32, 0x63, 0x26, 0x32, 0x63, 0x26, 0x33,
+  0x52, 0x36, 0x42, 0x43, 0x36, 0x42, 0x43, 0x36, 0x43, 0x32, 0x46, 0x52,
+  0x23, 0x46, 0x52, 0x23, 0x46, 0x53, 0x12, 0x56, 0x65, 0x56, 0x65, 0x56,
+  0x64, 0x66, 0x73, 0x63, 0x04, 0xC7, 0xB7, 0xB8, 0xA9, 0x95, 0x13, 0x95,
+  0x23, 0x85, 0x23, 0x85, 0x33, 0x75, 0x34, 0x65, 0x43, 0x65, 0x53, 0x55,
+  0x54, 0x45, 0x63, 0x45, 0x73, 0x35, 0x74, 0x25, 0x83, 0x25, 0x93, 0x15,
+  0x93, 0x15, 0xA8, 0xA8, 0xB7, 0xC3, 0x87, 0xCC, 0x9E, 0x74, 0x85, 0x44,
+  0xB3, 0x43, 0xD3, 0x23, 0xE3, 0x23, 0xF3, 0x13, 0xF6, 0xF0, 0x16, 0xF0,
+  0x16, 0xF0, 0x16, 0xF0, 0x16, 0xF0, 0x13, 0x13, 0xF3, 0x13, 0xF3, 0x13,
+  0xE3, 0x33, 0xD3, 0x34, 0xB3, 0x54, 0x85, 0x6F, 0x8C, 0xD7, 0x70, 0x0D,
+  0x4F, 0x2F, 0x01, 0x13, 0xA3, 0x13, 0xA7, 0xB6, 0xB6, 0xB6, 0xA7, 0xA3,
+  0x1F, 0x01, 0x1F, 0x2D, 0x43, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3,
+  0xE3, 0xE3, 0xE0, 0x87, 0xCC, 0x9F, 0x64, 0x85, 0x44, 0xB3, 0x43, 0xC4,
+  0x23, 0xE3, 0x23, 0xF3, 0x13, 0xF6, 0xF0, 0x16, 0xF0, 0x16, 0xF0, 0x16,
+  0xF0, 0x16, 0xF0, 0x13, 0x13, 0xF3, 0x13, 0xF3, 0x13, 0xA1, 0x33, 0x33,
+  0x83, 0x23, 0x34, 0x86, 0x54, 0x84, 0x7F, 0x01, 0x7F, 0x01, 0x97, 0x43,
+  0xF0, 0x51, 0x10, 0x0E, 0x5F, 0x01, 0x3F, 0x02, 0x23, 0xB4, 0x13, 0xC3,
+  0x13, 0xC3, 0x13, 0xC3, 0x13, 0xC3, 0x13, 0xC3, 0x13, 0xB3, 0x2F, 0x01,
+  0x3F, 0x4F, 0x01, 0x33, 0xA4, 0x23, 0xB3, 0x23, 0xB3, 0x23, 0xC3, 0x13,
+  0xC3, 0x13, 0xC2, 0x23, 0xC3, 0x13, 0xC3, 0x13, 0xC3, 0x13, 0xC4, 0x67,
+  0x9B, 0x66, 0x16, 0x43, 0x84, 0x24, 0x93, 0x23, 0xB3, 0x13, 0xB3, 0x13,
+  0xF0, 0x14, 0xE7, 0xCA, 0xAA, 0xC8, 0xE5, 0xF6, 0xC3, 0x12, 0xD2, 0x13,
+  0xB3, 0x13, 0xB3, 0x23, 0x94, 0x2F, 0x5C, 0x87, 0x50, 0x0F, 0x0F, 0x0F,
+  0x09, 0x73, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3,
+  0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0x80, 0x03, 0xC6,
+  0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6,
+  0xC6, 0xC6, 0xC3, 0x12, 0xC3, 0x13, 0xB3, 0x13, 0xA3, 0x33, 0x84, 0x3E,
+  0x5C, 0x97, 0x50, 0x13, 0xC4, 0x13, 0xC3, 0x23, 0xC3, 0x33, 0xA4, 0x33,
+  0xA3, 0x44, 0x93, 0x53, 0x92, 0x63, 0x83, 0x64, 0x73, 0x73, 0x72, 0x83,
+  0x63, 0x93, 0x53, 0x93, 0x52, 0xA3, 0x43, 0xB3, 0x33, 0xB3, 0x32, 0xC3,
+  0x23, 0xD3, 0x13, 0xD3, 0x12, 0xE6, 0xF5, 0xF4, 0xF0, 0x14, 0x80, 0x13,
+  0x93, 0x94, 0x13, 0x94, 0x84, 0x13, 0x85, 0x83, 0x24, 0x75, 0x83, 0x33,
+  0x75, 0x83, 0x33, 0x72, 0x13, 0x63, 0x43, 0x63, 0x13, 0x63, 0x43, 0x63,
+  0x22, 0x63, 0x53, 0x52, 0x33, 0x53, 0x53, 0x52, 0x33, 0x43, 0x63, 0x43,
+  0x33, 0x43, 0x63, 0x43, 0x42, 0x43, 0x73, 0x32, 0x53, 0x33, 0x73, 0x23,
+  0x53, 0x32, 0x83, 0x23, 0x62, 0x23, 0x83, 0x23, 0x63, 0x13, 0x93, 0x12,
+  0x73, 0x13, 0x96, 0x73, 0x12, 0xA6, 0x85, 0xA5, 0x95, 0xB4, 0x95, 0xB4,
+  0x94, 0xC4, 0xA3, 0x60, 0x14, 0xB3, 0x33, 0xA4, 0x43, 0x93, 0x54, 0x73,
+  0x73, 0x64, 0x83, 0x53, 0x94, 0x33, 0xB3, 0x24, 0xC3, 0x13, 0xD6, 0xF5,
+  0xF4, 0xF0, 0x15, 0xE7, 0xC4, 0x13, 0xC3, 0x33, 0xA3, 0x44, 0x84, 0x53,
+  0x83, 0x73, 0x63, 0x84, 0x44, 0x93, 0x34, 0xB3, 0x23, 0xC4, 0x13, 0xD3,
+  0x24, 0xB4, 0x34, 0xA3, 0x53, 0x94, 0x54, 0x83, 0x73, 0x73, 0x93, 0x54,
+  0x94, 0x43, 0xB3, 0x34, 0xB4, 0x23, 0xD3, 0x13, 0xF6, 0xF5, 0xF0, 0x23,
+  0xF0, 0x33, 0xF0, 0x33, 0xF0, 0x33, 0xF0, 0x33, 0xF0, 0x33, 0xF0, 0x33,
+  0xF0, 0x33, 0xF0, 0x33, 0xF0, 0x33, 0x90, 0x1F, 0x01, 0x1F, 0x01, 0x1F,
+  0x01, 0xD4, 0xC4, 0xC4, 0xD3, 0xD4, 0xC4, 0xC4, 0xD3, 0xD3, 0xD4, 0xC4,
+  0xD3, 0xD3, 0xD4, 0xC4, 0xC4, 0xD3, 0xDF, 0x0F, 0x0F, 0x06, 0x0F, 0x33,
+  0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+  0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+  0x3C, 0x02, 0x72, 0x81, 0x82, 0x72, 0x72, 0x82, 0x72, 0x72, 0x82, 0x72,
+  0x72, 0x82, 0x72, 0x72, 0x81, 0x82, 0x72, 0x81, 0x82, 0x72, 0x81, 0x82,
+  0x0C, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+  0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+  0x33, 0x33, 0x3F, 0x53, 0x93, 0x84, 0x82, 0x12, 0x63, 0x12, 0x62, 0x32,
+  0x52, 0x32, 0x42, 0x43, 0x32, 0x52, 0x23, 0x52, 0x22, 0x72, 0x12, 0x72,
+  0x0F, 0x0F, 0x08, 0x04, 0x33, 0x43, 0x43, 0x42, 0x47, 0x6A, 0x45, 0x25,
+  0x33, 0x63, 0x32, 0x82, 0xD2, 0xC3, 0x78, 0x4B, 0x35, 0x52, 0x23, 0x82,
+  0x23, 0x82, 0x23, 0x73, 0x23, 0x73, 0x24, 0x37, 0x29, 0x14, 0x35, 0x43,
+  0x02, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0x35, 0x52, 0x19, 0x32, 0x1A,
+  0x24, 0x63, 0x23, 0x83, 0x13, 0x83, 0x13, 0x92, 0x13, 0x95, 0xA6, 0x92,
+  0x13, 0x92, 0x13, 0x83, 0x13, 0x83, 0x14, 0x63, 0x2D, 0x22, 0x19, 0x32,
+  0x35, 0x50, 0x55, 0x79, 0x45, 0x15, 0x23, 0x63, 0x23, 0x76, 0x86, 0xB3,
+  0xB3, 0xB3, 0xB3, 0xB3, 0x83, 0x13, 0x73, 0x13, 0x63, 0x35, 0x15, 0x49,
+  0x75, 0x40, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0x46, 0x23, 0x38, 0x13,
+  0x25, 0x17, 0x14, 0x55, 0x13, 0x77, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
+  0x93, 0x13, 0x74, 0x14, 0x55, 0x25, 0x17, 0x3C, 0x47, 0x13, 0xF0, 0x55,
+  0x89, 0x55, 0x15, 0x33, 0x64, 0x23, 0x73, 0x13, 0x92, 0x13, 0x9F, 0x0F,
+  0x06, 0xC3, 0xC3, 0x92, 0x23, 0x73, 0x23, 0x64, 0x35, 0x15, 0x59, 0x85,
+  0x50, 0x34, 0x25, 0x23, 0x42, 0x52, 0x52, 0x3E, 0x22, 0x52, 0x52, 0x52,
+  0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x30,
+  0x45, 0x32, 0x38, 0x12, 0x25, 0x16, 0x13, 0x64, 0x13, 0x76, 0x86, 0x86,
+  0x95, 0x95, 0x95, 0x86, 0x83, 0x13, 0x73, 0x13, 0x64, 0x25, 0x13, 0x12,
+  0x37, 0x22, 0x45, 0x32, 0xB6, 0x83, 0x13, 0x73, 0x14, 0x53, 0x3A, 0x58,
+  0x30, 0x02, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0x35, 0x32, 0x28, 0x12,
+  0x13, 0x24, 0x14, 0x66, 0x76, 0x76, 0x75, 0x85, 0x85, 0x85, 0x85, 0x85,
+  0x85, 0x85, 0x85, 0x85, 0x83, 0x09, 0x9F, 0x0F, 0x0F, 0x06, 0x32, 0x32,
+  0x32, 0xF0, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+  0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x2C,
+  0x10, 0x02, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0x73, 0x22, 0x63, 0x32,
+  0x53, 0x42, 0x43, 0x52, 0x33, 0x62, 0x23, 0x72, 0x14, 0x78, 0x64, 0x14,
+  0x53, 0x33, 0x52, 0x53, 0x42, 0x53, 0x42, 0x63, 0x32, 0x64, 0x22, 0x73,
+  0x22, 0x83, 0x12, 0x83, 0x10, 0x0F, 0x0F, 0x0F, 0x0F, 0x09, 0x02, 0x26,
+  0x45, 0x32, 0x18, 0x28, 0x15, 0x37, 0x24, 0x14, 0x54, 0x53, 0x13, 0x64,
+  0x66, 0x63, 0x76, 0x63, 0x76, 0x63, 0x76, 0x63, 0x76, 0x63, 0x76, 0x63,
+  0x76, 0x63, 0x76, 0x63, 0x76, 0x63, 0x76, 0x63, 0x76, 0x63, 0x76, 0x63,
+  0x73, 0x02, 0x26, 0x32, 0x19, 0x16, 0x24, 0x14, 0x66, 0x76, 0x76, 0x76,
+  0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x73, 0x46, 0x89,
+  0x55, 0x15, 0x33, 0x64, 0x23, 0x73, 0x13, 0x92, 0x13, 0x96, 0x96, 0x96,
+  0x96, 0x96, 0x92, 0x23, 0x73, 0x23, 0x64, 0x35, 0x15, 0x59, 0x85, 0x50,
+  0x02, 0x26, 0x52, 0x19, 0x3D, 0x24, 0x63, 0x23, 0x83, 0x13, 0x83, 0x13,
+  0x92, 0x13, 0x96, 0x96, 0x96, 0x92, 0x13, 0x83, 0x13, 0x83, 0x14, 0x63,
+  0x2D, 0x2C, 0x33, 0x25, 0x53, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC0, 0x46,
+  0x23, 0x3C, 0x25, 0x17, 0x14, 0x55, 0x13, 0x77, 0x96, 0x96, 0x96, 0x96,
+  0x96, 0x96, 0x93, 0x13, 0x74, 0x14, 0x55, 0x25, 0x17, 0x29, 0x13, 0x46,
+  0x23, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0x02, 0x35, 0x26, 0x19, 0x43,
+  0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
+  0x50, 0x46, 0x59, 0x35, 0x15, 0x23, 0x57, 0x76, 0xB4, 0x97, 0x88, 0x87,
+  0xA3, 0xB5, 0x86, 0x63, 0x15, 0x25, 0x2A, 0x47, 0x30, 0x22, 0x52, 0x52,
+  0x52, 0x52, 0x3E, 0x22, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
+  0x52, 0x52, 0x53, 0x43, 0x45, 0x34, 0x02, 0x85, 0x85, 0x85, 0x85, 0x85,
+  0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x86, 0x76, 0x68, 0x36, 0x19, 0x12,
+  0x27, 0x22, 0xD0, 0x03, 0x93, 0x13, 0x83, 0x13, 0x73, 0x23, 0x73, 0x33,
+  0x63, 0x33, 0x53, 0x43, 0x53, 0x53, 0x42, 0x63, 0x33, 0x72, 0x33, 0x73,
+  0x22, 0x83, 0x13, 0x92, 0x13, 0x95, 0xA5, 0xB3, 0xC3, 0x60, 0x03, 0x73,
+  0x63, 0x13, 0x54, 0x63, 0x13, 0x54, 0x63, 0x13, 0x55, 0x43, 0x32, 0x55,
+  0x43, 0x33, 0x33, 0x12, 0x43, 0x33, 0x33, 0x12, 0x42, 0x43, 0x32, 0x23,
+  0x32, 0x52, 0x32, 0x23, 0x23, 0x53, 0x13, 0x32, 0x23, 0x53, 0x13, 0x32,
+  0x22, 0x72, 0x12, 0x43, 0x12, 0x72, 0x12, 0x46, 0x75, 0x54, 0x85, 0x54,
+  0x93, 0x64, 0x93, 0x64, 0x40, 0x13, 0x73, 0x33, 0x62, 0x43, 0x53, 0x53,
+  0x33, 0x72, 0x32, 0x83, 0x13, 0x95, 0xB3, 0xC3, 0xB5, 0xA5, 0x93, 0x13,
+  0x73, 0x33, 0x63, 0x33, 0x53, 0x53, 0x33, 0x73, 0x23, 0x73, 0x10, 0x03,
+  0x92, 0x23, 0x73, 0x23, 0x73, 0x23, 0x72, 0x43, 0x53, 0x43, 0x53, 0x43,
+  0x52, 0x62, 0x43, 0x63, 0x33, 0x63, 0x32, 0x82, 0x23, 0x83, 0x13, 0x83,
+  0x12, 0xA5, 0xA5, 0xA4, 0xC3, 0xC2, 0xC3, 0xC3, 0xB3, 0x96, 0x95, 0xA4,
+  0xA0, 0x1C, 0x1C, 0xA3, 0x93, 0x93, 0x93, 0x94, 0x93, 0x93, 0x93, 0x93,
+  0x94, 0x93, 0x93, 0x93, 0xAF, 0x0B, 0x44, 0x35, 0x33, 0x52, 0x62, 0x62,
+  0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x53, 0x43, 0x43, 0x54, 0x62, 0x63,
+  0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x63, 0x55, 0x44,
+  0x0F, 0x0F, 0x0F, 0x0D, 0x03, 0x44, 0x52, 0x53, 0x43, 0x43, 0x43, 0x43,
+  0x43, 0x43, 0x43, 0x43, 0x52, 0x53, 0x53, 0x43, 0x33, 0x42, 0x43, 0x43,
+  0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x42, 0x34, 0x33, 0x40, 0x23,
+  0xA6, 0x55, 0x14, 0x41, 0x12, 0x43, 0x22, 0x12, 0x56, 0x94, 0x20, 0x0F,
+  0x0F, 0x0F, 0x04, 0xF0, 0x26, 0x66, 0x56, 0x49, 0x46, 0x35, 0x15, 0x36,
+  0x24, 0x63, 0x26, 0x23, 0x73, 0x26, 0x23, 0x82, 0x26, 0x23, 0x82, 0x26,
+  0xC3, 0x26, 0xC3, 0x26, 0xB3, 0x36, 0xA3, 0x46, 0x93, 0x56, 0x83, 0x66,
+  0x73, 0x76, 0x73, 0x76, 0x73, 0x76, 0x73, 0x76, 0xF0, 0x26, 0xF0, 0x26,
+  0xF0, 0x26, 0x73, 0x76, 0x73, 0x76, 0x73, 0x76, 0xF0, 0x2F, 0x0F, 0x0F,
+  0x04, 0x0F, 0x0F, 0x0F, 0x04, 0xF0, 0x26, 0x66, 0x56, 0x49, 0x46, 0x35,
+  0x15, 0x36, 0x24, 0x63, 0x26, 0x23, 0x73, 0x26, 0x23, 0x82, 0x26, 0x23,
+  0x82, 0x26, 0xC3, 0x26, 0xC3, 0x26, 0xB3, 0x36, 0xA3, 0x46, 0x93, 0x56,
+  0x83, 0x66, 0x73, 0x76, 0x73, 0x76, 0x73, 0x76, 0x73, 0x76, 0xF0, 0x26,
+  0xF0, 0x26, 0xF0, 0x26, 0x73, 0x76, 0x73, 0x76, 0x73, 0x76, 0xF0, 0x2F,
+  0x0F, 0x0F, 0x04, 0x0F, 0x0F, 0x0F, 0x04, 0xF0, 0x26, 0x66, 0x56, 0x49,
+  0x46, 0x35, 0x15, 0x36, 0x24, 0x63, 0x26, 0x23, 0x73, 0x26, 0x23, 0x82,
+  0x26, 0x23, 0x82, 0x26, 0xC3, 0x26, 0xC3, 0x26, 0xB3, 0x36, 0xA3, 0x46,
+  0x93, 0x56, 0x83, 0x66, 0x73, 0x76, 0x73, 0x76, 0x73, 0x76, 0x73, 0x76,
+  0xF0, 0x26, 0xF0, 0x26, 0xF0, 0x26, 0x73, 0x76, 0x73, 0x76, 0x73, 0x76,
+  0xF0, 0x2F, 0x0F, 0x0F, 0x04, 0x0F, 0x0F, 0x0F, 0x04, 0xF0, 0x26, 0x66,
+  0x56, 0x49, 0x46, 0x35, 0x15, 0x36, 0x24, 0x63, 0x26, 0x23, 0x73, 0x26,
+  0x23, 0x82, 0x26, 0x23, 0x82, 0x26, 0xC3, 0x26, 0xC3, 0x26, 0xB3, 0x36,
+  0xA3, 0x46, 0x93, 0x56, 0x83, 0x66, 0x73, 0x76, 0x73, 0x76, 0x73, 0x76,
+  0x73, 0x76, 0xF0, 0x26, 0xF0, 0x26, 0xF0, 0x26, 0x73, 0x76, 0x73, 0x76,
+  0x73, 0x76, 0xF0, 0x2F, 0x0F, 0x0F, 0x04, 0x0F, 0x0F, 0x0F, 0x04, 0xF0,
+  0x26, 0x66, 0x56, 0x49, 0x46, 0x35, 0x15, 0x36, 0x24, 0x63, 0x26, 0x23,
+  0x73, 0x26, 0x23, 0x82, 0x26, 0x23, 0x82, 0x26, 0xC3, 0x26, 0xC3, 0x26,
+  0xB3, 0x36, 0xA3, 0x46, 0x93, 0x56, 0x83, 0x66, 0x73, 0x76, 0x73, 0x76,
+  0x73, 0x76, 0x73, 0x76, 0xF0, 0x26, 0xF0, 0x26, 0xF0, 0x26, 0x73, 0x76,
+  0x73, 0x76, 0x73, 0x76, 0xF0, 0x2F, 0x0F, 0x0F, 0x04, 0x0F, 0x0F, 0x0F,
+  0x04, 0xF0, 0x26, 0x66, 0x56, 0x49, 0x46, 0x35, 0x15, 0x36, 0x24, 0x63,
+  0x26, 0x23, 0x73, 0x26, 0x23, 0x82, 0x26, 0x23, 0x82, 0x26, 0xC3, 0x26,
+  0xC3, 0x26, 0xB3, 0x36, 0xA3, 0x46, 0x93, 0x56, 0x83, 0x66, 0x73, 0x76,
+  0x73, 0x76, 0x73, 0x76, 0x73, 0x76, 0xF0, 0x26, 0xF0, 0x26, 0xF0, 0x26,
+  0x73, 0x76, 0x73, 0x76, 0x73, 0x76, 0xF0, 0x2F, 0x0F, 0x0F, 0x04, 0x0F,
+  0x0F, 0x0F, 0x04, 0xF0, 0x26, 0x66, 0x56, 0x49, 0x46, 0x35, 0x15, 0x36,
+  0x24, 0x63, 0x26, 0x23, 0x73, 0x26, 0x23, 0x82, 0x26, 0x23, 0x82, 0x26,
+  0xC3, 0x26, 0xC3, 0x26, 0xB3, 0x36, 0xA3, 0x46, 0x93, 0x56, 0x83, 0x66,
+  0x73, 0x76, 0x73, 0x76, 0x73, 0x76, 0x73, 0x76, 0xF0, 0x26, 0xF0, 0x26,
+  0xF0, 0x26, 0x73, 0x76, 0x73, 0x76, 0x73, 0x76, 0xF0, 0x2F, 0x0F, 0x0F,
+  0x04, 0x0F, 0x0F, 0x0F, 0x04, 0xF0, 0x26, 0x66, 0x56, 0x49, 0x46, 0x35,
+  0x15, 0x36, 0x24, 0x63, 0x26, 0x23, 0x73, 0x26, 0x23, 0x82, 0x26, 0x23,
+  0x82, 0x26, 0xC3, 0x26, 0xC3, 0x26, 0xB3, 0x36, 0xA3, 0x46, 0x93, 0x56,
+  0x83, 0x66, 0x73, 0x76, 0x73, 0x76, 0x73, 0x76, 0x73, 0x76, 0xF0, 0x26,
+  0xF0, 0x26, 0xF0, 0x26, 0x73, 0x76, 0x73, 0x76, 0x73, 0x76, 0xF0, 0x2F,
+  0x0F, 0x0F, 0x04, 0x0F, 0x0F, 0x0F, 0x04, 0xF0, 0x26, 0x66, 0x56, 0x49,
+  0x46, 0x35, 0x15, 0x36, 0x24, 0x63, 0x26, 0x23, 0x73, 0x26, 0x23, 0x82,
+  0x26, 0x23, 0x82, 0x26, 0xC3, 0x26, 0xC3, 0x26, 0xB3, 0x36, 0xA3, 0x46,
+  0x93, 0x56, 0x83, 0x66, 0x73, 0x76, 0x73, 0x76, 0x73, 0x76, 0x73, 0x76,
+  0xF0, 0x26, 0xF0, 0x26, 0xF0, 0x26, 0x73, 0x76, 0x73, 0x76, 0x73, 0x76,
+  0xF0, 0x2F, 0x0F, 0x0F, 0x04, 0x0F, 0x0F, 0x0F, 0x04, 0xF0, 0x26, 0x66,
+  0x56, 0x49, 0x46, 0x35, 0x15, 0x36, 0x24, 0x63, 0x26, 0x23, 0x73, 0x26,
+  0x23, 0x82, 0x26, 0x23, 0x82, 0x26, 0xC3, 0x26, 0xC3, 0x26, 0xB3, 0x36,
+  0xA3, 0x46, 0x93, 0x56, 0x83, 0x66, 0x73, 0x76, 0x73, 0x76, 0x73, 0x76,
+  0x73, 0x76, 0xF0, 0x26, 0xF0, 0x26, 0xF0, 0x26, 0x73, 0x76, 0x73, 0x76,
+  0x73, 0x76, 0xF0, 0x2F, 0x0F, 0x0F, 0x04, 0x0F, 0x0F, 0x0F, 0x04, 0xF0,
+  0x26, 0x66, 0x56, 0x49, 0x46, 0x35, 0x15, 0x36, 0x24, 0x63, 0x26, 0x23,
+  0x73, 0x26, 0x23, 0x82, 0x26, 0x23, 0x82, 0x26, 0xC3, 0x26, 0xC3, 0x26,
+  0xB3, 0x36, 0xA3, 0x46, 0x93, 0x56, 0x83, 0x66, 0x73, 0x76, 0x73, 0x76,
+  0x73, 0x76, 0x73, 0x76, 0xF0, 0x26, 0xF0, 0x26, 0xF0, 0x26, 0x73, 0x76,
+  0x73, 0x76, 0x73, 0x76, 0xF0, 0x2F, 0x0F, 0x0F, 0x04, 0x0F, 0x0F, 0x0F,
+  0x04, 0xF0, 0x26, 0x66, 0x56, 0x49, 0x46, 0x35, 0x15, 0x36, 0x24, 0x63,
+  0x26, 0x23, 0x73, 0x26, 0x23, 0x82, 0x26, 0x23, 0x82, 0x26, 0xC3, 0x26,
+  0xC3, 0x26, 0xB3, 0x36, 0xA3, 0x46, 0x93, 0x56, 0x83, 0x66, 0x73, 0x76,
+  0x73, 0x76, 0x73, 0x76, 0x73, 0x76, 0xF0, 0x26, 0xF0, 0x26, 0xF0, 0x26,
+  0x73, 0x76, 0x73, 0x76, 0x73, 0x76, 0xF0, 0x2F, 0x0F, 0x0F, 0x04, 0x0F,
+  0x0F, 0x0F, 0x04, 0xF0, 0x26, 0x66, 0x56, 0x49, 0x46, 0x35, 0x15, 0x36,
+  0x24, 0x63, 0x26, 0x23, 0x73, 0x26, 0x23, 0x82, 0x26, 0x23, 0x82, 0x26,
+  0xC3, 0x26, 0xC3, 0x26, 0xB3, 0x36, 0xA3, 0x46, 0x93, 0x56, 0x83, 0x66,
+  0x73, 0x76, 0x73, 0x76, 0x73, 0x76, 0x73, 0x76, 0xF0, 0x26, 0xF0, 0x26,
+  0xF0, 0x26, 0x73, 0x76, 0x73, 0x76, 0x73, 0x76, 0xF0, 0x2F, 0x0F, 0x0F,
+  0x04, 0x0F, 0x0F, 0x0F, 0x04, 0xF0, 0x26, 0x66, 0x56, 0x49, 0x46, 0x35,
+  0x15, 0x36, 0x24, 0x63, 0x26, 0x23, 0x73, 0x26, 0x23, 0x82, 0x26, 0x23,
+  0x82, 0x26, 0xC3, 0x26, 0xC3, 0x26, 0xB3, 0x36, 0xA3, 0x46, 0x93, 0x56,
+  0x83, 0x66, 0x73, 0x76, 0x73, 0x76, 0x73, 0x76, 0x73, 0x76, 0xF0, 0x26,
+  0xF0, 0x26, 0xF0, 0x26, 0x73, 0x76, 0x73, 0x76, 0x73, 0x76, 0xF0, 0x2F,
+  0x0F, 0x0F, 0x04, 0x0F, 0x0F, 0x0F, 0x04, 0xF0, 0x26, 0x66, 0x56, 0x49,
+  0x46, 0x35, 0x15, 0x36, 0x24, 0x63, 0x26, 0x23, 0x73, 0x26, 0x23, 0x82,
+  0x26, 0x23, 0x82, 0x26, 0xC3, 0x26, 0xC3, 0x26, 0xB3, 0x36, 0xA3, 0x46,
+  0x93, 0x56, 0x83, 0x66, 0x73, 0x76, 0x73, 0x76, 0x73, 0x76, 0x73, 0x76,
+  0xF0, 0x26, 0xF0, 0x26, 0xF0, 0x26, 0x73, 0x76, 0x73, 0x76, 0x73, 0x76,
+  0xF0, 0x2F, 0x0F, 0x0F, 0x04, 0x0F, 0x0F, 0x0F, 0x04, 0xF0, 0x26, 0x66,
+  0x56, 0x49, 0x46, 0x35, 0x15, 0x36, 0x24, 0x63, 0x26, 0x23, 0x73, 0x26,
+  0x23, 0x82, 0x26, 0x23, 0x82, 0x26, 0xC3, 0x26, 0xC3, 0x26, 0xB3, 0x36,
+  0xA3, 0x46, 0x93, 0x56, 0x83, 0x66, 0x73, 0x76, 0x73, 0x76, 0x73, 0x76,
+  0x73, 0x76, 0xF0, 0x26, 0xF0, 0x26, 0xF0, 0x26, 0x73, 0x76, 0x73, 0x76,
+  0x73, 0x76, 0xF0, 0x2F, 0x0F, 0x0F, 0x04, 0x0F, 0x0F, 0x0F, 0x04, 0xF0,
+  0x26, 0x66, 0x56, 0x49, 0x46, 0x35, 0x15, 0x36, 0x24, 0x63, 0x26, 0x23,
+  0x73, 0x26, 0x23, 0x82, 0x26, 0x23, 0x82, 0x26, 0xC3, 0x26, 0xC3, 0x26,
+  0xB3, 0x36, 0xA3, 0x46, 0x93, 0x56, 0x83, 0x66, 0x73, 0x76, 0x73, 0x76,
+  0x73, 0x76, 0x73, 0x76, 0xF0, 0x26, 0xF0, 0x26, 0xF0, 0x26, 0x73, 0x76,
+  0x73, 0x76, 0x73, 0x76, 0xF0, 0x2F, 0x0F, 0x0F, 0x04, 0x0F, 0x0F, 0x0F,
+  0x04, 0xF0, 0x26, 0x66, 0x56, 0x49, 0x46, 0x35, 0x15, 0x36, 0x24, 0x63,
+  0x26, 0x23, 0x73, 0x26, 0x23, 0x82, 0x26, 0x23, 0x82, 0x26, 0xC3, 0x26,
+  0xC3, 0x26, 0xB3, 0x36, 0xA3, 0x46, 0x93, 0x56, 0x83, 0x66, 0x73, 0x76,
+  0x73, 0x76, 0x73, 0x76, 0x73, 0x76, 0xF0, 0x26, 0xF0, 0x26, 0xF0, 0x26,
+  0x73, 0x76, 0x73, 0x76, 0x73, 0x76, 0xF0, 0x2F, 0x0F, 0x0F, 0x04, 0x0F,
+  0x0F, 0x0F, 0x04, 0xF0, 0x26, 0x66, 0x56, 0x49, 0x46, 0x35, 0x15, 0x36,
+  0x24, 0x63, 0x26, 0x23, 0x73, 0x26, 0x23, 0x82, 0x26, 0x23, 0x82, 0x26,
+  0xC3, 0x26, 0xC3, 0x26, 0xB3, 0x36, 0xA3, 0x46, 0x93, 0x56, 0x83, 0x66,
+  0x73, 0x76, 0x73, 0x76, 0x73, 0x76, 0x73, 0x76, 0xF0, 0x26, 0xF0, 0x26,
+  0xF0, 0x26, 0x73, 0x76, 0x73, 0x76, 0x73, 0x76, 0xF0, 0x2F, 0x0F, 0x0F,
+  0x04, 0x0F, 0x0F, 0x0F, 0x04, 0xF0, 0x26, 0x66, 0x56, 0x49, 0x46, 0x35,
+  0x15, 0x36, 0x24, 0x63, 0x26, 0x23, 0x73, 0x26, 0x23, 0x82, 0x26, 0x23,
+  0x82, 0x26, 0xC3, 0x26, 0xC3, 0x26, 0xB3, 0x36, 0xA3, 0x46, 0x93, 0x56,
+  0x83, 0x66, 0x73, 0x76, 0x73, 0x76, 0x73, 0x76, 0x73, 0x76, 0xF0, 0x26,
+  0xF0, 0x26, 0xF0, 0x26, 0x73, 0x76, 0x73, 0x76, 0x73, 0x76, 0xF0, 0x2F,
+  0x0F, 0x0F, 0x04, 0x0F, 0x0F, 0x0F, 0x04, 0xF0, 0x26, 0x66, 0x56, 0x49,
+  0x46, 0x35, 0x15, 0x36, 0x24, 0x63, 0x26, 0x23, 0x73, 0x26, 0x23, 0x82,
+  0x26, 0x23, 0x82, 0x26, 0xC3, 0x26, 0xC3, 0x26, 0xB3, 0x36, 0xA3, 0x46,
+  0x93, 0x56, 0x83, 0x66, 0x73, 0x76, 0x73, 0x76, 0x73, 0x76, 0x73, 0x76,
+  0xF0, 0x26, 0xF0, 0x26, 0xF0, 0x26, 0x73, 0x76, 0x73, 0x76, 0x73, 0x76,
+  0xF0, 0x2F, 0x0F, 0x0F, 0x04, 0x0F, 0x0F, 0x0F, 0x04, 0xF0, 0x26, 0x66,
+  0x56, 0x49, 0x46, 0x35, 0x15, 0x36, 0x24, 0x63, 0x26, 0x23, 0x73, 0x26,
+  0x23, 0x82, 0x26, 0x23, 0x82, 0x26, 0xC3, 0x26, 0xC3, 0x26, 0xB3, 0x36,
+  0xA3, 0x46, 0x93, 0x56, 0x83, 0x66, 0x73, 0x76, 0x73, 0x76, 0x73, 0x76,
+  0x73, 0x76, 0xF0, 0x26, 0xF0, 0x26, 0xF0, 0x26, 0x73, 0x76, 0x73, 0x76,
+  0x73, 0x76, 0xF0, 0x2F, 0x0F, 0x0F, 0x04, 0x0F, 0x0F, 0x0F, 0x04, 0xF0,
+  0x26, 0x66, 0x56, 0x49, 0x46, 0x35, 0x15, 0x36, 0x24, 0x63, 0x26, 0x23,
+  0x73, 0x26, 0x23, 0x82, 0x26, 0x23, 0x82, 0x26, 0xC3, 0x26, 0xC3, 0x26,
+  0xB3, 0x36, 0xA3, 0x46, 0x93, 0x56, 0x83, 0x66, 0x73, 0x76, 0x73, 0x76,
+  0x73, 0x76, 0x73, 0x76, 0xF0, 0x26, 0xF0, 0x26, 0xF0, 0x26, 0x73, 0x76,
+  0x73, 0x76, 0x73, 0x76, 0xF0, 0x2F, 0x0F, 0x0F, 0x04, 0x0F, 0x0F, 0x0F,
+  0x04, 0xF0, 0x26, 0x66, 0x56, 0x49, 0x46, 0x35, 0x15, 0x36, 0x24, 0x63,
+  0x26, 0x23, 0x73, 0x26, 0x23, 0x82, 0x26, 0x23, 0x82, 0x26, 0xC3, 0x26,
+  0xC3, 0x26, 0xB3, 0x36, 0xA3, 0x46, 0x93, 0x56, 0x83, 0x66, 0x73, 0x76,
+  0x73, 0x76, 0x73, 0x76, 0x73, 0x76, 0xF0, 0x26, 0xF0, 0x26, 0xF0, 0x26,
+  0x73, 0x76, 0x73, 0x76, 0x73, 0x76, 0xF0, 0x2F, 0x0F, 0x0F, 0x04, 0x0F,
+  0x0F, 0x0F, 0x04, 0xF0, 0x26, 0x66, 0x56, 0x49, 0x46, 0x35, 0x15, 0x36,
+  0x24, 0x63, 0x26, 0x23, 0x73, 0x26, 0x23, 0x82, 0x26, 0x23, 0x82, 0x26,
+  0xC3, 0x26, 0xC3, 0x26, 0xB3, 0x36, 0xA3, 0x46, 0x93, 0x56, 0x83, 0x66,
+  0x73, 0x76, 0x73, 0x76, 0x73, 0x76, 0x73, 0x76, 0xF0, 0x26, 0xF0, 0x26,
+  0xF0, 0x26, 0x73, 0x76, 0x73, 0x76, 0x73, 0x76, 0xF0, 0x2F, 0x0F, 0x0F,
+  0x04, 0x0F, 0x0F, 0x0F, 0x04, 0xF0, 0x26, 0x66, 0x56, 0x49, 0x46, 0x35,
+  0x15, 0x36, 0x24, 0x63, 0x26, 0x23, 0x73, 0x26, 0x23, 0x82, 0x26, 0x23,
+  0x82, 0x26, 0xC3, 0x26, 0xC3, 0x26, 0xB3, 0x36, 0xA3, 0x46, 0x93, 0x56,
+  0x83, 0x66, 0x73, 0x76, 0x73, 0x76, 0x73, 0x76, 0x73, 0x76, 0xF0, 0x26,
+  0xF0, 0x26, 0xF0, 0x26, 0x73, 0x76, 0x73, 0x76, 0x73, 0x76, 0xF0, 0x2F,
+  0x0F, 0x0F, 0x04, 0x0F, 0x0F, 0x0F, 0x04, 0xF0, 0x26, 0x66, 0x56, 0x49,
+  0x46, 0x35, 0x15, 0x36, 0x24, 0x63, 0x26, 0x23, 0x73, 0x26, 0x23, 0x82,
+  0x26, 0x23, 0x82, 0x26, 0xC3, 0x26, 0xC3, 0x26, 0xB3, 0x36, 0xA3, 0x46,
+  0x93, 0x56, 0x83, 0x66, 0x73, 0x76, 0x73, 0x76, 0x73, 0x76, 0x73, 0x76,
+  0xF0, 0x26, 0xF0, 0x26, 0xF0, 0x26, 0x73, 0x76, 0x73, 0x76, 0x73, 0x76,
+  0xF0, 0x2F, 0x0F, 0x0F, 0x04, 0x0F, 0x0F, 0x0F, 0x04, 0xF0, 0x26, 0x66,
+  0x56, 0x49, 0x46, 0x35, 0x15, 0x36, 0x24, 0x63, 0x26, 0x23, 0x73, 0x26,
+  0x23, 0x82, 0x26, 0x23, 0x82, 0x26, 0xC3, 0x26, 0xC3, 0x26, 0xB3, 0x36,
+  0xA3, 0x46, 0x93, 0x56, 0x83, 0x66, 0x73, 0x76, 0x73, 0x76, 0x73, 0x76,
+  0x73, 0x76, 0xF0, 0x26, 0xF0, 0x26, 0xF0, 0x26, 0x73, 0x76, 0x73, 0x76,
+  0x73, 0x76, 0xF0, 0x2F, 0x0F, 0x0F, 0x04, 0x0F, 0x0F, 0x0F, 0x04, 0xF0,
+  0x26, 0x66, 0x56, 0x49, 0x46, 0x35, 0x15, 0x36, 0x24, 0x63, 0x26, 0x23,
+  0x73, 0x26, 0x23, 0x82, 0x26, 0x23, 0x82, 0x26, 0xC3, 0x26, 0xC3, 0x26,
+  0xB3, 0x36, 0xA3, 0x46, 0x93, 0x56, 0x83, 0x66, 0x73, 0x76, 0x73, 0x76,
+  0x73, 0x76, 0x73, 0x76, 0xF0, 0x26, 0xF0, 0x26, 0xF0, 0x26, 0x73, 0x76,
+  0x73, 0x76, 0x73, 0x76, 0xF0, 0x2F, 0x0F, 0x0F, 0x04, 0x0F, 0x0F, 0x0F,
+  0x04, 0xF0, 0x26, 0x66, 0x56, 0x49, 0x46, 0x35, 0x15, 0x36, 0x24, 0x63,
+  0x26, 0x23, 0x73, 0x26, 0x23, 0x82, 0x26, 0x23, 0x82, 0x26, 0xC3, 0x26,
+  0xC3, 0x26, 0xB3, 0x36, 0xA3, 0x46, 0x93, 0x56, 0x83, 0x66, 0x73, 0x76,
+  0x73, 0x76, 0x73, 0x76, 0x73, 0x76, 0xF0, 0x26, 0xF0, 0x26, 0xF0, 0x26,
+  0x73, 0x76, 0x73, 0x76, 0x73, 0x76, 0xF0, 0x2F, 0x0F, 0x0F, 0x04, 0x0F,
+  0x0F, 0x0F, 0x04, 0xF0, 0x26, 0x66, 0x56, 0x49, 0x46, 0x35, 0x15, 0x36,
+  0x24, 0x63, 0x26, 0x23, 0x73, 0x26, 0x23, 0x82, 0x26, 0x23, 0x82, 0x26,
+  0xC3, 0x26, 0xC3, 0x26, 0xB3, 0x36, 0xA3, 0x46, 0x93, 0x56, 0x83, 0x66,
+  0x73, 0x76, 0x73, 0x76, 0x73, 0x76, 0x73, 0x76, 0xF0, 0x26, 0xF0, 0x26,
+  0xF0, 0x26, 0x73, 0x76, 0x73, 0x76, 0x73, 0x76, 0xF0, 0x2F, 0x0F, 0x0F,
+  0x04, 0x0F, 0x0F, 0x0F, 0x04, 0xF0, 0x26, 0x66, 0x56, 0x49, 0x46, 0x35,
+  0x15, 0x36, 0x24, 0x63, 0x26, 0x23, 0x73, 0x26, 0x23, 0x82, 0x26, 0x23,
+  0x82, 0x26, 0xC3, 0x26, 0xC3, 0x26, 0xB3, 0x36, 0xA3, 0x46, 0x93, 0x56,
+  0x83, 0x66, 0x73, 0x76, 0x73, 0x76, 0x73, 0x76, 0x73, 0x76, 0xF0, 0x26,
+  0xF0, 0x26, 0xF0, 0x26, 0x73, 0x76, 0x73, 0x76, 0x73, 0x76, 0xF0, 0x2F,
+  0x0F, 0x0F, 0x04, 0x0F, 0x0F, 0x0F, 0x04, 0xF0, 0x26, 0x66, 0x56, 0x49,
+  0x46, 0x35, 0x15, 0x36, 0x24, 0x63, 0x26, 0x23, 0x73, 0x26, 0x23, 0x82,
+  0x26, 0x23, 0x82, 0x26, 0xC3, 0x26, 0xC3, 0x26, 0xB3, 0x36, 0xA3, 0x46,
+  0x93, 0x56, 0x83, 0x66, 0x73, 0x76, 0x73, 0x76, 0x73, 0x76, 0x73, 0x76,
+  0xF0, 0x26, 0xF0, 0x26, 0xF0, 0x26, 0x73, 0x76, 0x73, 0x76, 0x73, 0x76,
+  0xF0, 0x2F, 0x0F, 0x0F, 0x04, 0x10, 0x06, 0x4F, 0x0F, 0x04, 0x62, 0xC2,
+  0xC2, 0xA6, 0x79, 0x4B, 0x23, 0x22, 0x23, 0x13, 0x32, 0x36, 0x32, 0x36,
+  0x32, 0x62, 0x42, 0x62, 0x42, 0x62, 0x42, 0x63, 0x32, 0x63, 0x32, 0x36,
+  0x32, 0x33, 0x13, 0x22, 0x23, 0x2C, 0x3A, 0x66, 0xA2, 0xC2, 0xC2, 0x60,
+  0x56, 0x8A, 0x5C, 0x43, 0x63, 0x33, 0x83, 0x23, 0x83, 0x23, 0x83, 0x23,
+  0xD3, 0xD4, 0xD3, 0xBA, 0x6A, 0xA2, 0xE3, 0xD3, 0xD2, 0xD3, 0xC3, 0xC8,
+  0x51, 0x1F, 0x2E, 0x21, 0x75, 0x20, 0x12, 0x81, 0x1D, 0x1B, 0x24, 0x34,
+  0x23, 0x53, 0x22, 0x72, 0x22, 0x72, 0x22, 0x72, 0x23, 0x53, 0x34, 0x15,
+  0x2C, 0x12, 0x15, 0x13, 0xB1, 0x10, 0x12, 0xB3, 0x13, 0xA2, 0x32, 0x93,
+  0x33, 0x73, 0x53, 0x62, 0x72, 0x53, 0x73, 0x42, 0x92, 0x33, 0x93, 0x22,
+  0xB6, 0xB5, 0x8E, 0x3E, 0x83, 0xE3, 0x9E, 0x3E, 0x83, 0xE3, 0xE3, 0xE3,
+  0xE3, 0x70, 0x0F, 0x0B, 0x8F, 0x09, 0x65, 0x88, 0x64, 0x15, 0x43, 0x53,
+  0x43, 0x62, 0x43, 0x63, 0x43, 0xC5, 0xA6, 0x73, 0x25, 0x52, 0x45, 0x33,
+  0x64, 0x23, 0x74, 0x13, 0x84, 0x13, 0x83, 0x14, 0x73, 0x24, 0x63, 0x35,
+  0x42, 0x55, 0x23, 0x77, 0x95, 0xC3, 0xD3, 0x33, 0x63, 0x33, 0x63, 0x43,
+  0x53, 0x43, 0x43, 0x69, 0x77, 0x40, 0x03, 0x27, 0x27, 0x24, 0x87, 0xEB,
+  0xA4, 0x74, 0x73, 0xB3, 0x53, 0x46, 0x33, 0x42, 0x39, 0x32, 0x32, 0x42,
+  0x52, 0x42, 0x22, 0x32, 0x72, 0x32, 0x12, 0x42, 0xD1, 0x12, 0x42, 0xD4,
+  0x33, 0xD4, 0x33, 0xD4, 0x42, 0xD2, 0x12, 0x32, 0x72, 0x42, 0x12, 0x32,
+  0x72, 0x32, 0x22, 0x42, 0x53, 0x32, 0x32, 0x39, 0x32, 0x43, 0x37, 0x33,
+  0x53, 0xB3, 0x74, 0x74, 0xAB, 0xE7, 0x80, 0x25, 0x37, 0x22, 0x32, 0x81,
+  0x54, 0x25, 0x11, 0x12, 0x51, 0x12, 0x42, 0x12, 0x33, 0x25, 0x12, 0x31,
+  0x32, 0x9F, 0x03, 0x41, 0x51, 0x32, 0x51, 0x23, 0x33, 0x13, 0x33, 0x13,
+  0x42, 0x22, 0x51, 0x33, 0x43, 0x24, 0x33, 0x32, 0x42, 0x41, 0x51, 0x0F,
+  0x0F, 0x02, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0x0F, 0x01, 0x87,
+  0xEB, 0xA4, 0x74, 0x73, 0xB3, 0x53, 0x18, 0x43, 0x42, 0x2A, 0x32, 0x32,
+  0x32, 0x63, 0x32, 0x22, 0x32, 0x72, 0x32, 0x12, 0x42, 0x72, 0x41, 0x12,
+  0x42, 0x63, 0x44, 0x4A, 0x54, 0x4A, 0x54, 0x42, 0x62, 0x52, 0x12, 0x32,
+  0x62, 0x52, 0x12, 0x32, 0x71, 0x42, 0x22, 0x32, 0x71, 0x42, 0x32, 0x22,
+  0x72, 0x22, 0x43, 0x12, 0x72, 0x13, 0x53, 0xB3, 0x74, 0x74, 0xAB, 0xE7,
+  0x80, 0x0F, 0x01, 0x33, 0x47, 0x13, 0x32, 0x12, 0x54, 0x54, 0x54, 0x55,
+  0x33, 0x17, 0x35, 0x20, 0x62, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0x7F,
+  0x0F, 0x62, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xF0, 0xF0, 0xF0, 0x7F, 0x0F,
+  0x33, 0x47, 0x13, 0x35, 0x54, 0x52, 0x72, 0x63, 0x44, 0x43, 0x43, 0x53,
+  0x62, 0x7F, 0x03, 0x42, 0x67, 0x23, 0x32, 0x22, 0x52, 0x12, 0x52, 0x72,
+  0x54, 0x65, 0x92, 0x82, 0x12, 0x52, 0x12, 0x43, 0x18, 0x45, 0x20, 0x33,
+  0x23, 0x23, 0x32, 0x32, 0x40, 0x03, 0x73, 0x23, 0x73, 0x23, 0x73, 0x23,
+  0x73, 0x23, 0x73, 0x23, 0x73, 0x23, 0x73, 0x23, 0x73, 0x23, 0x73, 0x23,
+  0x73, 0x23, 0x73, 0x23, 0x73, 0x23, 0x73, 0x23, 0x64, 0x25, 0x23, 0x12,
+  0x2A, 0x1C, 0x37, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC0, 0x5A, 0x3C, 0x27,
+  0x32, 0x37, 0x32, 0x28, 0x32, 0x28, 0x32, 0x28, 0x32, 0x19, 0x32, 0x28,
+  0x32, 0x28, 0x32, 0x28, 0x32, 0x28, 0x32, 0x37, 0x32, 0x46, 0x32, 0x64,
+  0x32, 0x82, 0x32, 0x82, 0x32, 0x82, 0x32, 0x82, 0x32, 0x82, 0x32, 0x82,
+  0x32, 0x82, 0x32, 0x82, 0x32, 0x82, 0x32, 0x82, 0x32, 0x82, 0x32, 0x82,
+  0x32, 0x82, 0x32, 0x10, 0x09, 0x41, 0x71, 0x64, 0x63, 0x65, 0x23, 0x25,
+  0x10, 0x41, 0x32, 0x37, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+  0x32, 0x32, 0x34, 0x37, 0x22, 0x35, 0x54, 0x54, 0x54, 0x52, 0x11, 0x52,
+  0x12, 0x32, 0x36, 0x51, 0xE8, 0x18, 0x01, 0xA2, 0x51, 0x33, 0x42, 0x33,
+  0x34, 0x23, 0x42, 0x41, 0x51, 0x23, 0x42, 0x13, 0x37, 0x42, 0x22, 0x51,
+  0xE0, 0x41, 0xF0, 0x82, 0xD2, 0x73, 0xC2, 0x65, 0xC1, 0xA2, 0xB2, 0xA2,
+  0xA2, 0xB2, 0xA2, 0xB2, 0x92, 0xC2, 0x82, 0xD2, 0x82, 0xD2, 0x72, 0x71,
+  0x62, 0x71, 0x72, 0x62, 0x62, 0x63, 0x62, 0x52, 0x62, 0x11, 0xD2, 0x52,
+  0x21, 0xC2, 0x62, 0x21, 0xB2, 0x62, 0x31, 0xB2, 0x52, 0x41, 0xA2, 0x6A,
+  0x71, 0x7A, 0x62, 0xD1, 0x82, 0xE1, 0x82, 0xE1, 0x72, 0xF0, 0x40, 0x32,
+  0xF0, 0x72, 0xC2, 0x73, 0xB2, 0x65, 0xB2, 0x92, 0xA2, 0xA2, 0x92, 0xB2,
+  0x92, 0xB2, 0x82, 0xC2, 0x81, 0xD2, 0x72, 0xD2, 0x62, 0x45, 0x52, 0x61,
+  0x48, 0x32, 0x52, 0x33, 0x42, 0x32, 0x42, 0x42, 0x52, 0x92, 0x42, 0x52,
+  0x82, 0xC2, 0x72, 0xB3, 0x82, 0x94, 0x82, 0x93, 0x92, 0x92, 0xB2, 0x82,
+  0xB2, 0x99, 0x41, 0xA9, 0x25, 0xF0, 0x47, 0xB2, 0x42, 0x52, 0x92, 0x52,
+  0x52, 0x82, 0xD2, 0x82, 0xA4, 0x82, 0xB4, 0x81, 0xF2, 0x62, 0xF2, 0x52,
+  0x92, 0x52, 0x52, 0x61, 0x22, 0x52, 0x42, 0x62, 0x23, 0x33, 0x32, 0x63,
+  0x37, 0x42, 0x54, 0x53, 0x52, 0x64, 0xD1, 0x62, 0x12, 0xC2, 0x52, 0x22,
+  0xB2, 0x52, 0x32, 0xB2, 0x52, 0x32, 0xA2, 0x5A, 0x72, 0x6A, 0x72, 0xC2,
+  0x82, 0xD2, 0x81, 0xE2, 0x72, 0xF0, 0x30, 0x62, 0xC2, 0xC2, 0xF0, 0xF0,
+  0xF0, 0x92, 0xC2, 0xB3, 0xB3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA4, 0xA3, 0x86,
+  0x82, 0x13, 0x82, 0x13, 0x73, 0x23, 0x63, 0x2B, 0x49, 0x84, 0x50, 0x73,
+  0xF0, 0x33, 0xF0, 0x33, 0xF0, 0x42, 0xF0, 0xF0, 0x55, 0xF5, 0xF5, 0xE3,
+  0x13, 0xD3, 0x13, 0xD3, 0x13, 0xC3, 0x33, 0xB3, 0x33, 0xB3, 0x33, 0xA3,
+  0x53, 0x93, 0x53, 0x92, 0x63, 0x83, 0x73, 0x73, 0x73, 0x6E, 0x6F, 0x53,
+  0x93, 0x43, 0xA3, 0x43, 0xB3, 0x33, 0xB3, 0x23, 0xC4, 0x13, 0xD3, 0x13,
+  0xD3, 0xB4, 0xF4, 0xF0, 0x12, 0xF0, 0x22, 0xF0, 0xF0, 0x75, 0xF5, 0xF5,
+  0xE3, 0x13, 0xD3, 0x13, 0xD3, 0x13, 0xC3, 0x33, 0xB3, 0x33, 0xB3, 0x33,
+  0xA3, 0x53, 0x93, 0x53, 0x92, 0x63, 0x83, 0x73, 0x73, 0x73, 0x6E, 0x6F,
+  0x53, 0x93, 0x43, 0xA3, 0x43, 0xB3, 0x33, 0xB3, 0x23, 0xC4, 0x13, 0xD3,
+  0x13, 0xD3, 0x93, 0xF0, 0x15, 0xE3, 0x13, 0xC3, 0x33, 0xF0, 0xF0, 0x35,
+  0xF5, 0xF5, 0xE3, 0x13, 0xD3, 0x13, 0xD3, 0x13, 0xC3, 0x33, 0xB3, 0x33,
+  0xB3, 0x33, 0xA3, 0x53, 0x93, 0x53, 0x92, 0x63, 0x83, 0x73, 0x73, 0x73,
+  0x6E, 0x6F, 0x53, 0x93, 0x43, 0xA3, 0x43, 0xB3, 0x33, 0xB3, 0x23, 0xC4,
+  0x13, 0xD3, 0x13, 0xD3, 0x74, 0x22, 0xB9, 0xB2, 0x24, 0xF0, 0xF0, 0xF0,
+  0x95, 0xF5, 0xF5, 0xE3, 0x13, 0xD3, 0x13, 0xD3, 0x13, 0xC3, 0x33, 0xB3,
+  0x33, 0xB3, 0x33, 0xA3, 0x53, 0x93, 0x53, 0x92, 0x63, 0x83, 0x73, 0x73,
+  0x73, 0x6E, 0x6F, 0x53, 0x93, 0x43, 0xA3, 0x43, 0xB3, 0x33, 0xB3, 0x23,
+  0xC4, 0x13, 0xD3, 0x13, 0xD3, 0x63, 0x33, 0xB3, 0x33, 0xB3, 0x33, 0xF0,
+  0xF0, 0xF0, 0x85, 0xF5, 0xF5, 0xE3, 0x13, 0xD3, 0x13, 0xD3, 0x13, 0xC3,
+  0x33, 0xB3, 0x33, 0xB3, 0x33, 0xA3, 0x53, 0x93, 0x53, 0x92, 0x63, 0x83,
+  0x73, 0x73, 0x73, 0x6E, 0x6F, 0x53, 0x93, 0x43, 0xA3, 0x43, 0xB3, 0x33,
+  0xB3, 0x23, 0xC4, 0x13, 0xD3, 0x13, 0xD3, 0x93, 0xF0, 0x15, 0xE2, 0x32,
+  0xD2, 0x32, 0xE5, 0xF0, 0x13, 0xF0, 0xF0, 0x65, 0xF5, 0xF5, 0xE3, 0x13,
+  0xD3, 0x13, 0xD3, 0x13, 0xC3, 0x33, 0xB3, 0x33, 0xB3, 0x33, 0xA3, 0x53,
+  0x93, 0x53, 0x92, 0x63, 0x83, 0x73, 0x73, 0x73, 0x6E, 0x6F, 0x53, 0x93,
+  0x43, 0xA3, 0x43, 0xB3, 0x33, 0xB3, 0x23, 0xC4, 0x13, 0xD3, 0x13, 0xD3,
+  0xAF, 0x04, 0xAF, 0x05, 0xAF, 0x05, 0x93, 0x43, 0xF0, 0x53, 0x43, 0xF0,
+  0x52, 0x53, 0xF0, 0x43, 0x53, 0xF0, 0x43, 0x53, 0xF0, 0x33, 0x63, 0xF0,
+  0x33, 0x63, 0xF0, 0x32, 0x7E, 0x63, 0x7E, 0x63, 0x7E, 0x5E, 0xF0, 0x1E,
+  0xF0, 0x1E, 0xF3, 0x93, 0xF3, 0x93, 0xE3, 0xA3, 0xE3, 0xA3, 0xD4, 0xAF,
+  0x13, 0xBF, 0x13, 0xBF, 0x77, 0xBB, 0x8D, 0x64, 0x74, 0x44, 0x94, 0x33,
+  0xB3, 0x23, 0xC3, 0x23, 0xF0, 0x22, 0xF0, 0x23, 0xF0, 0x23, 0xF0, 0x23,
+  0xF0, 0x23, 0xF0, 0x23, 0xF0, 0x32, 0xE3, 0x13, 0xD3, 0x13, 0xC4, 0x14,
+  0xB3, 0x34, 0x94, 0x44, 0x74, 0x6D, 0x8B, 0xB7, 0xF1, 0xF0, 0x44, 0xF0,
+  0x32, 0xF0, 0x33, 0xC2, 0x23, 0xE5, 0x80, 0x54, 0xE3, 0xF0, 0x12, 0xF0,
+  0x12, 0xF0, 0x8F, 0x01, 0x1F, 0x01, 0x1F, 0x01, 0x13, 0xE3, 0xE3, 0xE3,
+  0xE3, 0xE3, 0xE3, 0xEF, 0x01, 0x1F, 0x01, 0x1F, 0x01, 0x13, 0xE3, 0xE3,
+  0xE3, 0xE3, 0xE3, 0xE3, 0xEF, 0x0F, 0x0F, 0x06, 0x84, 0xD3, 0xD2, 0xE2,
+  0xF0, 0xBF, 0x01, 0x1F, 0x01, 0x1F, 0x01, 0x13, 0xE3, 0xE3, 0xE3, 0xE3,
+  0xE3, 0xE3, 0xEF, 0x01, 0x1F, 0x01, 0x1F, 0x01, 0x13, 0xE3, 0xE3, 0xE3,
+  0xE3, 0xE3, 0xE3, 0xEF, 0x0F, 0x0F, 0x06, 0x73, 0xD5, 0xB3, 0x13, 0x93,
+  0x33, 0xF0, 0x6F, 0x01, 0x1F, 0x01, 0x1F, 0x01, 0x13, 0xE3, 0xE3, 0xE3,
+  0xE3, 0xE3, 0xE3, 0xEF, 0x01, 0x1F, 0x01, 0x1F, 0x01, 0x13, 0xE3, 0xE3,
+  0xE3, 0xE3, 0xE3, 0xE3, 0xEF, 0x0F, 0x0F, 0x06, 0x43, 0x33, 0x83, 0x33,
+  0x83, 0x33, 0xF0, 0xF0, 0x8F, 0x01, 0x1F, 0x01, 0x1F, 0x01, 0x13, 0xE3,
+  0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xEF, 0x01, 0x1F, 0x01, 0x1F, 0x01, 0x13,
+  0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xEF, 0x0F, 0x0F, 0x06, 0x13, 0x53,
+  0x53, 0x62, 0xA3, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+  0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+  0x43, 0x10, 0x24, 0x33, 0x32, 0x42, 0xD3, 0x43, 0x43, 0x43, 0x43, 0x43,
+  0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+  0x43, 0x43, 0x43, 0x43, 0x43, 0x30, 0x34, 0x45, 0x33, 0x13, 0x22, 0x42,
+  0xC3, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
+  0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x30,
+  0x04, 0x27, 0x27, 0x23, 0xF0, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
+  0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
+  0x63, 0x63, 0x63, 0x63, 0x30, 0x2C, 0x8E, 0x6F, 0x53, 0x94, 0x43, 0xA3,
+  0x43, 0xB3, 0x33, 0xB3, 0x33, 0xC2, 0x33, 0xC3, 0x23, 0xCD, 0x7D, 0x73,
+  0x23, 0xC3, 0x23, 0xC3, 0x23, 0xC3, 0x23, 0xB3, 0x33, 0xB3, 0x33, 0xB3,
+  0x33, 0xA3, 0x43, 0x94, 0x4F, 0x5E, 0x6C, 0x60, 0x64, 0x22, 0x99, 0x83,
+  0x24, 0xF0, 0x84, 0xC7, 0xB7, 0xB8, 0xA9, 0x95, 0x13, 0x95, 0x23, 0x85,
+  0x23, 0x85, 0x33, 0x75, 0x34, 0x65, 0x43, 0x65, 0x53, 0x55, 0x54, 0x45,
+  0x63, 0x45, 0x73, 0x35, 0x74, 0x25, 0x83, 0x25, 0x93, 0x15, 0x93, 0x15,
+  0xA8, 0xA8, 0xB7, 0xC3, 0x74, 0xF0, 0x44, 0xF0, 0x53, 0xF0, 0x52, 0xF0,
+  0xF0, 0x97, 0xCC, 0x9E, 0x74, 0x85, 0x44, 0xB3, 0x43, 0xD3, 0x23, 0xE3,
+  0x23, 0xF3, 0x13, 0xF6, 0xF0, 0x16, 0xF0, 0x16, 0xF0, 0x16, 0xF0, 0x16,
+  0xF0, 0x13, 0x13, 0xF3, 0x13, 0xF3, 0x13, 0xE3, 0x33, 0xD3, 0x34, 0xB3,
+  0x54, 0x85, 0x6F, 0x8C, 0xD7, 0x70, 0xC4, 0xF0, 0x23, 0xF0, 0x33, 0xF0,
+  0x33, 0xF0, 0xF0, 0xA7, 0xCC, 0x9E, 0x74, 0x85, 0x44, 0xB3, 0x43, 0xD3,
+  0x23, 0xE3, 0x23, 0xF3, 0x13, 0xF6, 0xF0, 0x16, 0xF0, 0x16, 0xF0, 0x16,
+  0xF0, 0x16, 0xF0, 0x13, 0x13, 0xF3, 0x13, 0xF3, 0x13, 0xE3, 0x33, 0xD3,
+  0x34, 0xB3, 0x54, 0x85, 0x6F, 0x8C, 0xD7, 0x70, 0x94, 0xF0, 0x35, 0xF0,
+  0x13, 0x13, 0xE2, 0x42, 0xF0, 0xF0, 0x77, 0xCC, 0x9E, 0x74, 0x85, 0x44,
+  0xB3, 0x43, 0xD3, 0x23, 0xE3, 0x23, 0xF3, 0x13, 0xF6, 0xF0, 0x16, 0xF0,
+  0x16, 0xF0, 0x16, 0xF0, 0x16, 0xF0, 0x13, 0x13, 0xF3, 0x13, 0xF3, 0x13,
+  0xE3, 0x33, 0xD3, 0x34, 0xB3, 0x54, 0x85, 0x6F, 0x8C, 0xD7, 0x70, 0x75,
+  0x22, 0xD9, 0xC2, 0x34, 0xF0, 0xF0, 0x77, 0xCC, 0x9E, 0x74, 0x85, 0x44,
+  0xB3, 0x43, 0xD3, 0x23, 0xE3, 0x23, 0xF3, 0x13, 0xF6, 0xF0, 0x16, 0xF0,
+  0x16, 0xF0, 0x16, 0xF0, 0x16, 0xF0, 0x13, 0x13, 0xF3, 0x13, 0xF3, 0x13,
+  0xE3, 0x33, 0xD3, 0x34, 0xB3, 0x54, 0x85, 0x6F, 0x8C, 0xD7, 0x70, 0x73,
+  0x24, 0xD3, 0x24, 0xD3, 0x24, 0xF0, 0xF0, 0x67, 0xCC, 0x9E, 0x74, 0x85,
+  0x44, 0xB3, 0x43, 0xD3, 0x23, 0xE3, 0x23, 0xF3, 0x13, 0xF6, 0xF0, 0x16,
+  0xF0, 0x16, 0xF0, 0x16, 0xF0, 0x16, 0xF0, 0x13, 0x13, 0xF3, 0x13, 0xF3,
+  0x13, 0xE3, 0x33, 0xD3, 0x34, 0xB3, 0x54, 0x85, 0x6F, 0x8C, 0xD7, 0x70,
+  0x11, 0x85, 0x63, 0x13, 0x43, 0x33, 0x23, 0x56, 0x74, 0x84, 0x76, 0x53,
+  0x23, 0x33, 0x43, 0x13, 0x63, 0x11, 0x81, 0x10, 0x87, 0x52, 0x5C, 0x23,
+  0x4E, 0x12, 0x44, 0x85, 0x44, 0xB3, 0x43, 0xB5, 0x23, 0xB2, 0x13, 0x23,
+  0xA2, 0x33, 0x13, 0x92, 0x46, 0x92, 0x56, 0x82, 0x66, 0x72, 0x76, 0x62,
+  0x86, 0x52, 0x93, 0x13, 0x32, 0xA3, 0x13, 0x22, 0xB3, 0x13, 0x12, 0xB3,
+  0x34, 0xB4, 0x34, 0xB3, 0x45, 0x85, 0x32, 0x1F, 0x33, 0x2C, 0x61, 0x67,
+  0x70, 0x63, 0xF0, 0x13, 0xF0, 0x13, 0xF0, 0x13, 0xF0, 0x93, 0xC6, 0xC6,
+  0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6,
+  0xC6, 0xC3, 0x12, 0xC3, 0x13, 0xB3, 0x13, 0xA3, 0x33, 0x84, 0x3E, 0x5C,
+  0x97, 0x50, 0xA3, 0xE3, 0xE3, 0xE2, 0xF0, 0xC3, 0xC6, 0xC6, 0xC6, 0xC6,
+  0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC3,
+  0x12, 0xC3, 0x13, 0xB3, 0x13, 0xA3, 0x33, 0x84, 0x3E, 0x5C, 0x97, 0x50,
+  0x83, 0xE5, 0xC3, 0x13, 0xA2, 0x43, 0xF0, 0x73, 0xC6, 0xC6, 0xC6, 0xC6,
+  0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC3,
+  0x12, 0xC3, 0x13, 0xB3, 0x13, 0xA3, 0x33, 0x84, 0x3E, 0x5C, 0x97, 0x50,
+  0x53, 0x33, 0x93, 0x33, 0x93, 0x33, 0xF0, 0xF0, 0xA3, 0xC6, 0xC6, 0xC6,
+  0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6,
+  0xC3, 0x12, 0xC3, 0x13, 0xB3, 0x13, 0xA3, 0x33, 0x84, 0x3E, 0x5C, 0x97,
+  0x50, 0xB4, 0xF0, 0x13, 0xF0, 0x23, 0xF0, 0x23, 0xF0, 0xF0, 0x23, 0xD3,
+  0x24, 0xB4, 0x34, 0xA3, 0x53, 0x94, 0x54, 0x83, 0x73, 0x73, 0x93, 0x54,
+  0x94, 0x43, 0xB3, 0x34, 0xB4, 0x23, 0xD3, 0x13, 0xF6, 0xF5, 0xF0, 0x23,
+  0xF0, 0x33, 0xF0, 0x33, 0xF0, 0x33, 0xF0, 0x33, 0xF0, 0x33, 0xF0, 0x33,
+  0xF0, 0x33, 0xF0, 0x33, 0xF0, 0x33, 0x90, 0x03, 0xE3, 0xE3, 0xE3, 0xED,
+  0x4F, 0x2F, 0x01, 0x13, 0x94, 0x13, 0xA7, 0xB6, 0xB6, 0xB6, 0xA7, 0xA3,
+  0x1F, 0x01, 0x1F, 0x2D, 0x43, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE0, 0x38,
+  0x6B, 0x34, 0x54, 0x23, 0x73, 0x22, 0x83, 0x13, 0x92, 0x13, 0x83, 0x13,
+  0x83, 0x13, 0x64, 0x23, 0x45, 0x33, 0x46, 0x23, 0x65, 0x13, 0x87, 0x96,
+  0x96, 0x96, 0x96, 0x96, 0x96, 0x83, 0x13, 0x38, 0x13, 0x37, 0x23, 0x35,
+  0x40, 0x43, 0xD3, 0xD2, 0xE2, 0xE1, 0xF0, 0xA7, 0x6A, 0x45, 0x25, 0x33,
+  0x63, 0x32, 0x82, 0xD2, 0xC3, 0x78, 0x4B, 0x35, 0x52, 0x23, 0x82, 0x23,
+  0x82, 0x23, 0x73, 0x23, 0x73, 0x24, 0x37, 0x29, 0x14, 0x35, 0x43, 0x74,
+  0xB3, 0xB3, 0xB3, 0xC2, 0xF0, 0xC7, 0x6A, 0x45, 0x25, 0x33, 0x63, 0x32,
+  0x82, 0xD2, 0xC3, 0x78, 0x4B, 0x35, 0x52, 0x23, 0x82, 0x23, 0x82, 0x23,
+  0x73, 0x23, 0x73, 0x24, 0x37, 0x29, 0x14, 0x35, 0x43, 0x63, 0xB5, 0xA2,
+  0x13, 0x82, 0x32, 0x72, 0x52, 0xF0, 0x77, 0x6A, 0x45, 0x25, 0x33, 0x63,
+  0x32, 0x82, 0xD2, 0xC3, 0x78, 0x4B, 0x35, 0x52, 0x23, 0x82, 0x23, 0x82,
+  0x23, 0x73, 0x23, 0x73, 0x24, 0x37, 0x29, 0x14, 0x35, 0x43, 0x44, 0x22,
+  0x69, 0x62, 0x25, 0xF0, 0xF0, 0x77, 0x6A, 0x45, 0x25, 0x33, 0x63, 0x32,
+  0x82, 0xD2, 0xC3, 0x78, 0x4B, 0x35, 0x52, 0x23, 0x82, 0x23, 0x82, 0x23,
+  0x73, 0x23, 0x73, 0x24, 0x37, 0x29, 0x14, 0x35, 0x43, 0x34, 0x23, 0x64,
+  0x23, 0x64, 0x23, 0xF0, 0xF0, 0xF0, 0x77, 0x6A, 0x45, 0x25, 0x33, 0x63,
+  0x32, 0x82, 0xD2, 0xC3, 0x78, 0x4B, 0x35, 0x52, 0x23, 0x82, 0x23, 0x82,
+  0x23, 0x73, 0x23, 0x73, 0x24, 0x37, 0x29, 0x14, 0x35, 0x43, 0x63, 0xB5,
+  0x92, 0x32, 0x82, 0x32, 0x95, 0xB3, 0xF0, 0xA7, 0x6A, 0x45, 0x25, 0x33,
+  0x63, 0x32, 0x82, 0xD2, 0xC3, 0x78, 0x4B, 0x35, 0x52, 0x23, 0x82, 0x23,
+  0x82, 0x23, 0x73, 0x23, 0x73, 0x24, 0x37, 0x29, 0x14, 0x35, 0x43, 0x46,
+  0x56, 0x6A, 0x29, 0x35, 0x2F, 0x01, 0x23, 0x65, 0x63, 0x22, 0x83, 0x83,
+  0xB3, 0x83, 0xA3, 0x93, 0x4F, 0x06, 0x28, 0x1E, 0x14, 0x62, 0xC3, 0x82,
+  0xC3, 0x83, 0x86, 0x74, 0x86, 0x66, 0x63, 0x14, 0x34, 0x24, 0x25, 0x29,
+  0x3A, 0x55, 0x76, 0x40, 0x55, 0x79, 0x45, 0x15, 0x23, 0x63, 0x23, 0x76,
+  0x86, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0x83, 0x13, 0x73, 0x13, 0x63, 0x35,
+  0x15, 0x49, 0x75, 0xA1, 0xC4, 0xC3, 0xC2, 0x72, 0x23, 0x85, 0x50, 0x43,
+  0xD3, 0xD2, 0xE2, 0xE2, 0xF0, 0xA5, 0x89, 0x55, 0x15, 0x33, 0x64, 0x23,
+  0x73, 0x13, 0x92, 0x13, 0x9F, 0x0F, 0x06, 0xC3, 0xC3, 0x92, 0x23, 0x73,
+  0x23, 0x64, 0x35, 0x15, 0x59, 0x85, 0x50, 0x83, 0xB3, 0xC2, 0xC2, 0xC2,
+  0xF0, 0xD5, 0x89, 0x55, 0x15, 0x33, 0x64, 0x23, 0x73, 0x13, 0x92, 0x13,
+  0x9F, 0x0F, 0x06, 0xC3, 0xC3, 0x92, 0x23, 0x73, 0x23, 0x64, 0x35, 0x15,
+  0x59, 0x85, 0x50, 0x63, 0xB5, 0xA2, 0x13, 0x82, 0x32, 0x72, 0x52, 0xF0,
+  0x85, 0x89, 0x55, 0x15, 0x33, 0x64, 0x23, 0x73, 0x13, 0x92, 0x13, 0x9F,
+  0x0F, 0x06, 0xC3, 0xC3, 0x92, 0x23, 0x73, 0x23, 0x64, 0x35, 0x15, 0x59,
+  0x85, 0x50, 0x33, 0x33, 0x63, 0x33, 0x63, 0x33, 0xF0, 0xF0, 0xF0, 0x85,
+  0x89, 0x55, 0x15, 0x33, 0x64, 0x23, 0x73, 0x13, 0x92, 0x13, 0x9F, 0x0F,
+  0x06, 0xC3, 0xC3, 0x92, 0x23, 0x73, 0x23, 0x64, 0x35, 0x15, 0x59, 0x85,
+  0x50, 0x04, 0x44, 0x43, 0x53, 0x52, 0xA3, 0x43, 0x43, 0x43, 0x43, 0x43,
+  0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x20,
+  0x33, 0x33, 0x42, 0x42, 0x42, 0xE3, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+  0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x20, 0x24,
+  0x54, 0x43, 0x12, 0x32, 0x23, 0x12, 0x42, 0xF0, 0x72, 0x72, 0x72, 0x72,
+  0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72,
+  0x72, 0x40, 0x03, 0x27, 0x27, 0x24, 0xF0, 0xF2, 0x72, 0x72, 0x72, 0x72,
+  0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72,
+  0x40, 0x23, 0x41, 0x87, 0x94, 0x97, 0x82, 0x33, 0xD3, 0x88, 0x6A, 0x45,
+  0x15, 0x33, 0x64, 0x23, 0x73, 0x13, 0x92, 0x13, 0x96, 0x96, 0x96, 0x96,
+  0x96, 0x92, 0x23, 0x73, 0x23, 0x64, 0x35, 0x15, 0x59, 0x76, 0x50, 0x34,
+  0x32, 0x39, 0x42, 0x25, 0xF0, 0xD2, 0x26, 0x32, 0x19, 0x16, 0x24, 0x14,
+  0x66, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
+  0x76, 0x73, 0x43, 0xD3, 0xD2, 0xE2, 0xE2, 0xF0, 0x96, 0x89, 0x55, 0x15,
+  0x33, 0x64, 0x23, 0x73, 0x13, 0x92, 0x13, 0x96, 0x96, 0x96, 0x96, 0x96,
+  0x92, 0x23, 0x73, 0x23, 0x64, 0x35, 0x15, 0x59, 0x85, 0x50, 0x83, 0xB3,
+  0xB3, 0xC2, 0xC2, 0xF0, 0xC6, 0x89, 0x55, 0x15, 0x33, 0x64, 0x23, 0x73,
+  0x13, 0x92, 0x13, 0x96, 0x96, 0x96, 0x96, 0x96, 0x92, 0x23, 0x73, 0x23,
+  0x64, 0x35, 0x15, 0x59, 0x85, 0x50, 0x54, 0xB5, 0x93, 0x12, 0x92, 0x32,
+  0x72, 0x52, 0xF0, 0x76, 0x89, 0x55, 0x15, 0x33, 0x64, 0x23, 0x73, 0x13,
+  0x92, 0x13, 0x96, 0x96, 0x96, 0x96, 0x96, 0x92, 0x23, 0x73, 0x23, 0x64,
+  0x35, 0x15, 0x59, 0x85, 0x50, 0x44, 0x22, 0x69, 0x62, 0x24, 0xF0, 0xF0,
+  0x86, 0x89, 0x55, 0x15, 0x33, 0x64, 0x23, 0x73, 0x13, 0x92, 0x13, 0x96,
+  0x96, 0x96, 0x96, 0x96, 0x92, 0x23, 0x73, 0x23, 0x64, 0x35, 0x15, 0x59,
+  0x85, 0x50, 0x33, 0x24, 0x63, 0x24, 0x63, 0x24, 0xF0, 0xF0, 0xF0, 0x76,
+  0x89, 0x55, 0x15, 0x33, 0x64, 0x23, 0x73, 0x13, 0x92, 0x13, 0x96, 0x96,
+  0x96, 0x96, 0x96, 0x92, 0x23, 0x73, 0x23, 0x64, 0x35, 0x15, 0x59, 0x85,
+  0x50, 0x63, 0xC3, 0xC3, 0xF0, 0xF0, 0xF0, 0xF0, 0x6F, 0x0F, 0xF0, 0xF0,
+  0xF0, 0x63, 0xC3, 0xC3, 0x60, 0x56, 0x41, 0x49, 0x12, 0x35, 0x16, 0x33,
+  0x64, 0x33, 0x64, 0x23, 0x62, 0x12, 0x23, 0x52, 0x23, 0x13, 0x42, 0x33,
+  0x13, 0x32, 0x43, 0x13, 0x31, 0x53, 0x13, 0x21, 0x63, 0x13, 0x12, 0x62,
+  0x34, 0x63, 0x33, 0x64, 0x36, 0x15, 0x32, 0x19, 0x32, 0x36, 0x50, 0x24,
+  0xA3, 0xB3, 0xB3, 0xB2, 0xF0, 0x32, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85,
+  0x85, 0x85, 0x85, 0x85, 0x85, 0x86, 0x76, 0x68, 0x36, 0x19, 0x12, 0x27,
+  0x22, 0xD0, 0x74, 0x93, 0x93, 0x93, 0xA2, 0xF0, 0x42, 0x85, 0x85, 0x85,
+  0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x86, 0x76, 0x68, 0x36,
+  0x19, 0x12, 0x27, 0x22, 0xD0, 0x53, 0x95, 0x73, 0x13, 0x62, 0x32, 0x52,
+  0x52, 0xF2, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85,
+  0x85, 0x86, 0x76, 0x68, 0x36, 0x19, 0x12, 0x27, 0x22, 0xD0, 0x23, 0x33,
+  0x43, 0x33, 0x43, 0x33, 0xF0, 0xF0, 0xB2, 0x85, 0x85, 0x85, 0x85, 0x85,
+  0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x86, 0x76, 0x68, 0x36, 0x19, 0x12,
+  0x27, 0x22, 0xD0, 0x84, 0xB3, 0xB3, 0xB3, 0xC2, 0xF0, 0x73, 0x92, 0x23,
+  0x73, 0x23, 0x73, 0x23, 0x72, 0x43, 0x53, 0x43, 0x53, 0x43, 0x52, 0x62,
+  0x43, 0x63, 0x33, 0x63, 0x32, 0x82, 0x23, 0x83, 0x13, 0x83, 0x12, 0xA5,
+  0xA5, 0xA4, 0xC3, 0xC2, 0xC3, 0xC3, 0xB3, 0x96, 0x95, 0xA4, 0xA0, 0x02,
+  0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0x35, 0x52, 0x19, 0x3D, 0x24, 0x63, 0x23,
+  0x83, 0x13, 0x83, 0x13, 0x92, 0x13, 0x92, 0x12, 0xA6, 0x92, 0x13, 0x92,
+  0x13, 0x83, 0x13, 0x83, 0x14, 0x63, 0x2D, 0x22, 0x19, 0x32, 0x35, 0x52,
+  0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD0, 0x34, 0x23, 0x64, 0x23, 0x64, 0x23,
+  0xF0, 0xF0, 0xF0, 0x33, 0x92, 0x23, 0x73, 0x23, 0x73, 0x23, 0x72, 0x43,
+  0x53, 0x43, 0x53, 0x43, 0x52, 0x62, 0x43, 0x63, 0x33, 0x63, 0x32, 0x82,
+  0x23, 0x83, 0x13, 0x83, 0x12, 0xA5, 0xA5, 0xA4, 0xC3, 0xC2, 0xC3, 0xC3,
+  0xB3, 0x96, 0x95, 0xA4, 0xA0 };
+
+constexpr GFXglyph FreeSans_RLE_16pt8bGlyphs[] PROGMEM = {
+  {     0,   1,   1,   8,    0,    0 },   // 0x20 ' '
+  {     1,   3,  23,  10,    4,  -22 },   // 0x21 '!'
+  {    11,   8,   8,  10,    1,  -21 },   // 0x22 '"'
+  {    24,  17,  22,  17,    0,  -21 },   // 0x23 '#'
+  {    67,  15,  28,  17,    1,  -24 },   // 0x24 '$'
+  {   117,  26,  22,  28,    1,  -21 },   // 0x25 '%'
+  {   175,  18,  22,  21,    2,  -21 },   // 0x26 '&'
+  {   217,   3,   8,   6,    2,  -21 },   // 0x27 '''
+  {   222,   7,  29,  10,    2,  -22 },   // 0x28 '('
+  {   251,   7,  29,  10,    1,  -22 },   // 0x29 ')'
+  {   281,  10,   9,  12,    1,  -22 },   // 0x2A '*'
+  {   293,  15,  15,  18,    2,  -14 },   // 0x2B '+'
+  {   309,   3,   8,   9,    3,   -2 },   // 0x2C ','
+  {   316,   8,   2,  10,    1,   -9 },   // 0x2D '-'
+  {   318,   4,   3,   8,    2,   -2 },   // 0x2E '.'
+  {   319,   9,  23,   9,    0,  -22 },   // 0x2F '/'
+  {   343,  15,  22,  17,    1,  -21 },   // 0x30 '0'
+  {   378,   8,  22,  17,    3,  -21 },   // 0x31 '1'
+  {   399,  15,  22,  17,    1,  -21 },   // 0x32 '2'
+  {   427,  15,  22,  17,    1,  -21 },   // 0x33 '3'
+  {   457,  15,  22,  17,    1,  -21 },   // 0x34 '4'
+  {   488,  15,  22,  17,    1,  -21 },   // 0x35 '5'
+  {   516,  15,  22,  17,    1,  -21 },   // 0x36 '6'
+  {   550,  15,  22,  17,    1,  -21 },   // 0x37 '7'
+  {   573,  15,  22,  17,    1,  -21 },   // 0x38 '8'
+  {   608,  15,  22,  17,    1,  -21 },   // 0x39 '9'
+  {   645,   4,  17,   8,    2,  -16 },   // 0x3A ':'
+  {   649,   4,  22,   8,    2,  -16 },   // 0x3B ';'
+  {   661,  16,  15,  18,    1,  -14 },   // 0x3C '<'
+  {   676,  15,   7,  18,    2,  -10 },   // 0x3D '='
+  {   682,  15,  15,  18,    2,  -14 },   // 0x3E '>'
+  {   698,  14,  23,  17,    2,  -22 },   // 0x3F '?'
+  {   725,  29,  27,  32,    1,  -22 },   // 0x40 '@'
+  {   802,  20,  23,  21,    0,  -22 },   // 0x41 'A'
+  {   843,  18,  23,  21,    2,  -22 },   // 0x42 'B'
+  {   883,  20,  23,  22,    1,  -22 },   // 0x43 'C'
+  {   924,  19,  23,  22,    2,  -22 },   // 0x44 'D'
+  {   963,  17,  23,  20,    2,  -22 },   // 0x45 'E'
+  {   993,  16,  23,  19,    2,  -22 },   // 0x46 'F'
+  {  1017,  21,  24,  24,    1,  -22 },   // 0x47 'G'
+  {  1060,  18,  23,  23,    2,  -22 },   // 0x48 'H'
+  {  1084,   3,  23,   9,    3,  -22 },   // 0x49 'I'
+  {  1089,  13,  23,  17,    1,  -22 },   // 0x4A 'J'
+  {  1115,  19,  23,  21,    2,  -22 },   // 0x4B 'K'
+  {  1162,  15,  23,  18,    2,  -22 },   // 0x4C 'L'
+  {  1185,  22,  23,  27,    2,  -22 },   // 0x4D 'M'
+  {  1240,  18,  23,  23,    2,  -22 },   // 0x4E 'N'
+  {  1278,  22,  23,  25,    1,  -22 },   // 0x4F 'O'
+  {  1319,  17,  23,  21,    2,  -22 },   // 0x50 'P'
+  {  1347,  22,  24,  25,    1,  -22 },   // 0x51 'Q'
+  {  1395,  19,  23,  22,    2,  -22 },   // 0x52 'R'
+  {  1439,  18,  23,  21,    1,  -22 },   // 0x53 'S'
+  {  1473,  18,  23,  20,    1,  -22 },   // 0x54 'T'
+  {  1498,  18,  23,  23,    2,  -22 },   // 0x55 'U'
+  {  1527,  20,  23,  20,    0,  -22 },   // 0x56 'V'
+  {  1571,  29,  23,  29,    0,  -22 },   // 0x57 'W'
+  {  1648,  20,  23,  21,    0,  -22 },   // 0x58 'X'
+  {  1690,  21,  23,  21,    0,  -22 },   // 0x59 'Y'
+  {  1735,  17,  23,  19,    1,  -22 },   // 0x5A 'Z'
+  {  1762,   6,  30,   9,    2,  -22 },   // 0x5B '['
+  {  1789,   9,  23,   9,    0,  -22 },   // 0x5C '\'
+  {  1812,   6,  30,   9,    1,  -22 },   // 0x5D ']'
+  {  1839,  12,  12,  15,    1,  -21 },   // 0x5E '^'
+  {  1860,  19,   2,  17,   -1,    5 },   // 0x5F '_'
+  {  1863,   6,   5,   8,    1,  -22 },   // 0x60 '`'
+  {  1868,  15,  17,  17,    1,  -16 },   // 0x61 'a'
+  {  1896,  15,  23,  18,    2,  -22 },   // 0x62 'b'
+  {  1934,  14,  17,  16,    1,  -16 },   // 0x63 'c'
+  {  1958,  15,  24,  18,    1,  -22 },   // 0x64 'd'
+  {  1991,  15,  17,  17,    1,  -16 },   // 0x65 'e'
+  {  2017,   7,  23,   9,    1,  -22 },   // 0x66 'f'
+  {  2040,  14,  23,  17,    1,  -16 },   // 0x67 'g'
+  {  2077,  13,  23,  17,    2,  -22 },   // 0x68 'h'
+  {  2105,   3,  23,   7,    2,  -22 },   // 0x69 'i'
+  {  2110,   5,  30,   8,    0,  -22 },   // 0x6A 'j'
+  {  2137,  14,  23,  16,    2,  -22 },   // 0x6B 'k'
+  {  2177,   3,  23,   7,    2,  -22 },   // 0x6C 'l'
+  {  2182,  22,  17,  25,    2,  -16 },   // 0x6D 'm'
+  {  2221,  13,  17,  17,    2,  -16 },   // 0x6E 'n'
+  {  2242,  15,  17,  17,    1,  -16 },   // 0x6F 'o'
+  {  2268,  15,  23,  18,    2,  -16 },   // 0x70 'p'
+  {  2303,  15,  23,  18,    1,  -16 },   // 0x71 'q'
+  {  2335,   8,  17,  10,    2,  -16 },   // 0x72 'r'
+  {  2353,  13,  17,  15,    1,  -16 },   // 0x73 's'
+  {  2373,   7,  22,   9,    1,  -21 },   // 0x74 't'
+  {  2394,  13,  18,  17,    2,  -16 },   // 0x75 'u'
+  {  2415,  15,  17,  16,    0,  -16 },   // 0x76 'v'
+  {  2446,  22,  17,  23,    0,  -16 },   // 0x77 'w'
+  {  2501,  15,  17,  15,    0,  -16 },   // 0x78 'x'
+  {  2531,  15,  24,  15,    0,  -16 },   // 0x79 'y'
+  {  2569,  13,  17,  15,    1,  -16 },   // 0x7A 'z'
+  {  2586,   8,  30,  10,    1,  -22 },   // 0x7B '{'
+  {  2616,   2,  29,   8,    3,  -22 },   // 0x7C '|'
+  {  2620,   7,  30,  10,    2,  -22 },   // 0x7D '}'
+  {  2651,  14,   6,  16,    1,  -13 },   // 0x7E '~'
+  {  2663,  23,  29,  25,    1,  -24 },   // 0x7F ''
+  {  2725,  23,  29,  25,    1,  -24 },   // 0x80 ''
+  {  2787,  23,  29,  25,    1,  -24 },   // 0x81 ''
+  {  2849,  23,  29,  25,    1,  -24 },   // 0x82 ''
+  {  2911,  23,  29,  25,    1,  -24 },   // 0x83 ''
+  {  2973,  23,  29,  25,    1,  -24 },   // 0x84 ''
+  {  3035,  23,  29,  25,    1,  -24 },   // 0x85 ''
+  {  3097,  23,  29,  25,    1,  -24 },   // 0x86 ''
+  {  3159,  23,  29,  25,    1,  -24 },   // 0x87 ''
+  {  3221,  23,  29,  25,    1,  -24 },   // 0x88 ''
+  {  3283,  23,  29,  25,    1,  -24 },   // 0x89 ''
+  {  3345,  23,  29,  25,    1,  -24 },   // 0x8A ''
+  {  3407,  23,  29,  25,    1,  -24 },   // 0x8B ''
+  {  3469,  23,  29,  25,    1,  -24 },   // 0x8C ''
+  {  3531,  23,  29,  25,    1,  -24 },   // 0x8D ''
+  {  3593,  23,  29,  25,    1,  -24 },   // 0x8E ''
+  {  3655,  23,  29,  25,    1,  -24 },   // 0x8F ''
+  {  3717,  23,  29,  25,    1,  -24 },   // 0x90 ''
+  {  3779,  23,  29,  25,    1,  -24 },   // 0x91 ''
+  {  3841,  23,  29,  25,    1,  -24 },   // 0x92 ''
+  {  3903,  23,  29,  25,    1,  -24 },   // 0x93 ''
+  {  3965,  23,  29,  25,    1,  -24 },   // 0x94 ''
+  {  4027,  23,  29,  25,    1,  -24 },   // 0x95 ''
+  {  4089,  23,  29,  25,    1,  -24 },   // 0x96 ''
+  {  4151,  23,  29,  25,    1,  -24 },   // 0x97 ''
+  {  4213,  23,  29,  25,    1,  -24 },   // 0x98 ''
+  {  4275,  23,  29,  25,    1,  -24 },   // 0x99 ''
+  {  4337,  23,  29,  25,    1,  -24 },   // 0x9A ''
+  {  4399,  23,  29,  25,    1,  -24 },   // 0x9B ''
+  {  4461,  23,  29,  25,    1,  -24 },   // 0x9C ''
+  {  4523,  23,  29,  25,    1,  -24 },   // 0x9D ''
+  {  4585,  23,  29,  25,    1,  -24 },   // 0x9E ''
+  {  4647,  23,  29,  25,    1,  -24 },   // 0x9F ''
+  {  4709,   1,   1,   9,    0,    0 },   // 0xA0 ''
+  {  4710,   2,  22,  10,    4,  -15 },   // 0xA1 ''
+  {  4714,  14,  23,  17,    2,  -19 },   // 0xA2 ''
+  {  4752,  16,  23,  17,    1,  -22 },   // 0xA3 ''
+  {  4782,  13,  13,  17,    2,  -16 },   // 0xA4 ''
+  {  4806,  17,  22,  17,    0,  -21 },   // 0xA5 ''
+  {  4838,   2,  29,   8,    3,  -22 },   // 0xA6 ''
+  {  4842,  15,  29,  17,    1,  -22 },   // 0xA7 ''
+  {  4890,   9,   3,  10,    1,  -21 },   // 0xA8 ''
+  {  4894,  23,  22,  25,    1,  -21 },   // 0xA9 ''
+  {  4951,   9,  14,  12,    1,  -22 },   // 0xAA ''
+  {  4971,  11,  10,  16,    2,  -13 },   // 0xAB ''
+  {  4991,  16,   9,  18,    1,  -11 },   // 0xAC ''
+  {  5001,   8,   2,  10,    1,   -9 },   // 0xAD ''
+  {  5003,  23,  22,  25,    1,  -21 },   // 0xAE ''
+  {  5065,   8,   2,  10,    1,  -21 },   // 0xAF ''
+  {  5067,   9,  10,  19,    5,  -21 },   // 0xB0 ''
+  {  5080,  15,  20,  18,    2,  -19 },   // 0xB1 ''
+  {  5100,   9,  14,  11,    1,  -25 },   // 0xB2 ''
+  {  5115,  10,  14,  11,    0,  -25 },   // 0xB3 ''
+  {  5135,   6,   5,  10,    3,  -22 },   // 0xB4 ''
+  {  5141,  15,  23,  17,    2,  -16 },   // 0xB5 ''
+  {  5181,  15,  28,  17,    1,  -22 },   // 0xB6 ''
+  {  5236,   3,   3,   8,    3,   -9 },   // 0xB7 ''
+  {  5237,   8,   7,  10,    1,    1 },   // 0xB8 ''
+  {  5245,   5,  14,  11,    2,  -25 },   // 0xB9 ''
+  {  5258,   9,  14,  11,    1,  -22 },   // 0xBA ''
+  {  5274,  11,  11,  16,    2,  -13 },   // 0xBB ''
+  {  5293,  25,  24,  27,    2,  -22 },   // 0xBC ''
+  {  5351,  24,  23,  27,    2,  -22 },   // 0xBD ''
+  {  5404,  25,  24,  28,    1,  -22 },   // 0xBE ''
+  {  5467,  14,  23,  17,    3,  -15 },   // 0xBF ''
+  {  5495,  20,  28,  21,    0,  -27 },   // 0xC0 ''
+  {  5545,  20,  28,  21,    0,  -27 },   // 0xC1 ''
+  {  5594,  20,  28,  21,    0,  -27 },   // 0xC2 ''
+  {  5644,  20,  28,  21,    0,  -27 },   // 0xC3 ''
+  {  5693,  20,  28,  21,    0,  -27 },   // 0xC4 ''
+  {  5743,  20,  30,  21,    0,  -29 },   // 0xC5 ''
+  {  5796,  30,  23,  31,    0,  -22 },   // 0xC6 ''
+  {  5848,  20,  29,  22,    1,  -22 },   // 0xC7 ''
+  {  5899,  17,  28,  20,    2,  -27 },   // 0xC8 ''
+  {  5936,  17,  28,  20,    2,  -27 },   // 0xC9 ''
+  {  5971,  17,  28,  20,    2,  -27 },   // 0xCA ''
+  {  6008,  17,  28,  20,    2,  -27 },   // 0xCB ''
+  {  6046,   7,  28,   9,    0,  -27 },   // 0xCC ''
+  {  6074,   7,  28,   9,    2,  -27 },   // 0xCD ''
+  {  6102,   9,  28,   9,    0,  -27 },   // 0xCE ''
+  {  6132,   9,  28,   9,    0,  -27 },   // 0xCF ''
+  {  6161,  20,  23,  22,    1,  -22 },   // 0xD0 ''
+  {  6200,  18,  27,  23,    2,  -26 },   // 0xD1 ''
+  {  6244,  22,  28,  25,    1,  -27 },   // 0xD2 ''
+  {  6294,  22,  28,  25,    1,  -27 },   // 0xD3 ''
+  {  6344,  22,  28,  25,    1,  -27 },   // 0xD4 ''
+  {  6395,  22,  27,  25,    1,  -26 },   // 0xD5 ''
+  {  6443,  22,  27,  25,    1,  -26 },   // 0xD6 ''
+  {  6492,  12,  12,  18,    3,  -12 },   // 0xD7 ''
+  {  6512,  22,  23,  25,    1,  -22 },   // 0xD8 ''
+  {  6565,  18,  28,  23,    2,  -27 },   // 0xD9 ''
+  {  6602,  18,  28,  23,    2,  -27 },   // 0xDA ''
+  {  6636,  18,  28,  23,    2,  -27 },   // 0xDB ''
+  {  6672,  18,  28,  23,    2,  -27 },   // 0xDC ''
+  {  6709,  21,  28,  21,    0,  -27 },   // 0xDD ''
+  {  6763,  17,  23,  20,    2,  -22 },   // 0xDE ''
+  {  6791,  15,  23,  19,    2,  -22 },   // 0xDF ''
+  {  6829,  15,  23,  17,    1,  -22 },   // 0xE0 ''
+  {  6863,  15,  23,  17,    1,  -22 },   // 0xE1 ''
+  {  6897,  15,  23,  17,    1,  -22 },   // 0xE2 ''
+  {  6934,  15,  22,  17,    1,  -21 },   // 0xE3 ''
+  {  6969,  15,  23,  17,    1,  -22 },   // 0xE4 ''
+  {  7006,  15,  24,  17,    1,  -23 },   // 0xE5 ''
+  {  7043,  25,  17,  27,    1,  -16 },   // 0xE6 ''
+  {  7084,  14,  23,  16,    1,  -16 },   // 0xE7 ''
+  {  7115,  15,  23,  17,    1,  -22 },   // 0xE8 ''
+  {  7147,  15,  23,  17,    1,  -22 },   // 0xE9 ''
+  {  7179,  15,  23,  17,    1,  -22 },   // 0xEA ''
+  {  7214,  15,  23,  17,    1,  -22 },   // 0xEB ''
+  {  7249,   7,  23,   7,    0,  -22 },   // 0xEC ''
+  {  7272,   7,  23,   7,    0,  -22 },   // 0xED ''
+  {  7295,   9,  24,   8,    0,  -23 },   // 0xEE ''
+  {  7322,   9,  23,   8,    0,  -22 },   // 0xEF ''
+  {  7345,  15,  23,  17,    1,  -22 },   // 0xF0 ''
+  {  7379,  13,  22,  17,    2,  -21 },   // 0xF1 ''
+  {  7406,  15,  23,  17,    1,  -22 },   // 0xF2 ''
+  {  7438,  15,  23,  17,    1,  -22 },   // 0xF3 ''
+  {  7470,  15,  23,  17,    1,  -22 },   // 0xF4 ''
+  {  7505,  15,  22,  17,    1,  -21 },   // 0xF5 ''
+  {  7538,  15,  23,  17,    1,  -22 },   // 0xF6 ''
+  {  7573,  15,  15,  18,    2,  -14 },   // 0xF7 ''
+  {  7589,  16,  17,  17,    0,  -16 },   // 0xF8 ''
+  {  7631,  13,  24,  17,    2,  -22 },   // 0xF9 ''
+  {  7658,  13,  24,  17,    2,  -22 },   // 0xFA ''
+  {  7685,  13,  24,  17,    2,  -22 },   // 0xFB ''
+  {  7714,  13,  24,  17,    2,  -22 },   // 0xFC ''
+  {  7743,  15,  30,  15,    0,  -22 },   // 0xFD ''
+  {  7787,  15,  28,  17,    2,  -21 },   // 0xFE ''
+  {  7830,  15,  30,  15,    0,  -22 } }; // 0xFF ''
+
+constexpr GFXfont FreeSans_RLE_16pt8b PROGMEM = {
+  (uint8_t  *)FreeSans_RLE_16pt8bBitmaps,
+  (GFXglyph *)FreeSans_RLE_16pt8bGlyphs,
+  0x20, 0xFF, 38 };
+
+// Approx. 9452 bytes
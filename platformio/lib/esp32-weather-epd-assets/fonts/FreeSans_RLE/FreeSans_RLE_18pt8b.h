@@ -0,0 +1,990 @@
+// Run-length encoded glyph bitmaps (fontconvert -r)
+#define FreeSans_RLE_18pt8b_RLE
+
+const uint8_t FreeSans_RLE_18pt8bBitmaps[] PROGMEM = {
+  0x10, 0x0F, 0x0F, 0x09, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x6C,
+  0x04, 0x27, 0x27, 0x27, 0x23, 0x13, 0x23, 0x12, 0x33, 0x12, 0x42, 0x12,
+  0x42, 0x12, 0x41, 0x10, 0x73, 0x43, 0x93, 0x43, 0x92, 0x53, 0x92, 0x52,
+  0x93, 0x52, 0x93, 0x43, 0x93, 0x43, 0x5F, 0x02, 0x2F, 0x02, 0x53, 0x52,
+  0x93, 0x43, 0x93, 0x43, 0x93, 0x43, 0x92, 0x53, 0x92, 0x52, 0x5F, 0x03,
+  0x1F, 0x03, 0x53, 0x43, 0x93, 0x43, 0x92, 0x52, 0x93, 0x52, 0x93, 0x43,
+  0x93, 0x43, 0x93, 0x43, 0x60, 0x82, 0xF2, 0xC7, 0x8B, 0x5D, 0x34, 0x32,
+  0x24, 0x23, 0x42, 0x33, 0x23, 0x42, 0x33, 0x22, 0x52, 0x42, 0x23, 0x42,
+  0x83, 0x42, 0x84, 0x32, 0x85, 0x22, 0x99, 0xAA, 0x99, 0xA8, 0x92, 0x34,
+  0x82, 0x43, 0x82, 0x46, 0x52, 0x46, 0x52, 0x46, 0x52, 0x43, 0x13, 0x42,
+  0x43, 0x14, 0x32, 0x33, 0x35, 0x18, 0x4B, 0x87, 0xD2, 0xF2, 0xF2, 0xF2,
+  0x70, 0xF0, 0x52, 0xB4, 0xC2, 0x98, 0x92, 0x9A, 0x82, 0x92, 0x63, 0x62,
+  0x93, 0x63, 0x53, 0x92, 0x82, 0x52, 0xA3, 0x72, 0x43, 0xA3, 0x63, 0x42,
+  0xC3, 0x43, 0x43, 0xD9, 0x42, 0xF6, 0x52, 0xF0, 0xB3, 0xF0, 0xB2, 0x64,
+  0xF0, 0x13, 0x48, 0xE2, 0x59, 0xC3, 0x43, 0x53, 0xB2, 0x52, 0x63, 0xA3,
+  0x43, 0x72, 0xA2, 0x53, 0x72, 0x92, 0x63, 0x72, 0x83, 0x73, 0x53, 0x82,
+  0x85, 0x14, 0x83, 0x98, 0x92, 0xC5, 0x30, 0x65, 0xE8, 0xB4, 0x15, 0x93,
+  0x53, 0x93, 0x53, 0x93, 0x62, 0x93, 0x62, 0x93, 0x53, 0xA3, 0x34, 0xA9,
+  0xC7, 0xD5, 0xD7, 0xC4, 0x23, 0x43, 0x34, 0x34, 0x33, 0x24, 0x54, 0x23,
+  0x23, 0x74, 0x13, 0x23, 0x86, 0x33, 0x86, 0x33, 0x94, 0x44, 0x85, 0x44,
+  0x58, 0x3C, 0x23, 0x4A, 0x34, 0x56, 0x64, 0x0F, 0x06, 0x11, 0x21, 0x10,
+  0x52, 0x42, 0x52, 0x42, 0x52, 0x43, 0x42, 0x43, 0x43, 0x42, 0x43, 0x43,
+  0x43, 0x43, 0x42, 0x52, 0x52, 0x52, 0x52, 0x53, 0x43, 0x43, 0x43, 0x52,
+  0x52, 0x53, 0x52, 0x52, 0x53, 0x52, 0x53, 0x52, 0x62, 0x12, 0x62, 0x72,
+  0x63, 0x62, 0x62, 0x63, 0x62, 0x63, 0x53, 0x53, 0x62, 0x63, 0x53, 0x53,
+  0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x52, 0x62, 0x53, 0x53, 0x52, 0x53,
+  0x53, 0x52, 0x53, 0x52, 0x52, 0x62, 0x50, 0x52, 0x92, 0x92, 0x53, 0x12,
+  0x1E, 0x35, 0x74, 0x62, 0x13, 0x43, 0x22, 0x51, 0x32, 0x20, 0x73, 0xE3,
+  0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0x7F, 0x0F, 0x04, 0x73, 0xE3, 0xE3,
+  0xE3, 0xE3, 0xE3, 0xE3, 0x70, 0x0F, 0x01, 0x22, 0x22, 0x22, 0x12, 0x13,
+  0x10, 0x0F, 0x09, 0x0C, 0x82, 0x82, 0x72, 0x82, 0x82, 0x72, 0x82, 0x82,
+  0x72, 0x82, 0x82, 0x72, 0x82, 0x82, 0x72, 0x82, 0x82, 0x72, 0x82, 0x82,
+  0x72, 0x82, 0x82, 0x81, 0x82, 0x82, 0x80, 0x56, 0x89, 0x6B, 0x44, 0x54,
+  0x33, 0x73, 0x24, 0x83, 0x13, 0x93, 0x13, 0x93, 0x13, 0x97, 0xA6, 0xA6,
+  0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0x97, 0x93, 0x13, 0x93, 0x14, 0x83, 0x23,
+  0x73, 0x34, 0x54, 0x4B, 0x69, 0x96, 0x50, 0x62, 0x62, 0x53, 0x53, 0x2F,
+  0x07, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
+  0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x66, 0x9A, 0x6C, 0x44, 0x64,
+  0x24, 0x83, 0x23, 0x94, 0x13, 0xA3, 0x13, 0xA3, 0x13, 0xA3, 0xD4, 0xD3,
+  0xD4, 0xB5, 0xA6, 0xA5, 0xA6, 0xA5, 0xB4, 0xC4, 0xC4, 0xD3, 0xE3, 0xDF,
+  0x0F, 0x0F, 0x06, 0x57, 0x8B, 0x5D, 0x44, 0x54, 0x34, 0x74, 0x23, 0x93,
+  0x23, 0x93, 0x23, 0x93, 0xE3, 0xD3, 0x97, 0xA6, 0xB8, 0xD5, 0xE3, 0xE4,
+  0xE6, 0xB6, 0xB7, 0x94, 0x13, 0x93, 0x24, 0x74, 0x3D, 0x5B, 0x87, 0x50,
+  0xB3, 0xD4, 0xD4, 0xC5, 0xB6, 0xA3, 0x13, 0xA3, 0x13, 0x93, 0x23, 0x83,
+  0x33, 0x74, 0x33, 0x73, 0x43, 0x63, 0x53, 0x53, 0x63, 0x53, 0x63, 0x43,
+  0x73, 0x33, 0x83, 0x3F, 0x0F, 0x0F, 0x06, 0xB3, 0xE3, 0xE3, 0xE3, 0xE3,
+  0xE3, 0x30, 0x3D, 0x4D, 0x4D, 0x33, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0x24,
+  0x82, 0x19, 0x4E, 0x35, 0x55, 0x24, 0x74, 0xE4, 0xE3, 0xE3, 0xE3, 0xE6,
+  0xB7, 0x94, 0x13, 0x93, 0x24, 0x65, 0x3D, 0x5B, 0x86, 0x60, 0x56, 0x99,
+  0x6B, 0x44, 0x54, 0x24, 0x73, 0x23, 0x83, 0x13, 0xD3, 0xD3, 0xD3, 0x34,
+  0x63, 0x19, 0x3E, 0x26, 0x45, 0x14, 0x83, 0x13, 0x97, 0xA6, 0xA6, 0xA6,
+  0xA6, 0x94, 0x13, 0x83, 0x24, 0x64, 0x3C, 0x5A, 0x86, 0x50, 0x0F, 0x0F,
+  0x0F, 0x03, 0xD3, 0xC3, 0xC3, 0xD3, 0xC3, 0xC3, 0xD3, 0xC3, 0xD3, 0xC3,
+  0xD3, 0xC3, 0xD3, 0xC3, 0xD3, 0xD3, 0xC3, 0xD3, 0xD3, 0xC4, 0xC3, 0xD3,
+  0xA0, 0x66, 0x9A, 0x6C, 0x44, 0x54, 0x34, 0x74, 0x23, 0x93, 0x23, 0x93,
+  0x23, 0x93, 0x24, 0x83, 0x34, 0x63, 0x5B, 0x79, 0x7B, 0x54, 0x54, 0x34,
+  0x83, 0x23, 0x98, 0xA6, 0xB7, 0xA3, 0x13, 0xA3, 0x13, 0x93, 0x25, 0x64,
+  0x3D, 0x5B, 0x96, 0x50, 0x66, 0x99, 0x6C, 0x54, 0x54, 0x34, 0x74, 0x23,
+  0x93, 0x14, 0x93, 0x14, 0xA7, 0xA7, 0x94, 0x13, 0x94, 0x14, 0x75, 0x24,
+  0x56, 0x2B, 0x13, 0x48, 0x23, 0x64, 0x43, 0xD4, 0xD3, 0xE3, 0x23, 0x84,
+  0x24, 0x73, 0x44, 0x54, 0x4C, 0x6A, 0x96, 0x60, 0x0C, 0xF0, 0xF0, 0x3C,
+  0x0F, 0x01, 0xF0, 0xF0, 0xEF, 0x01, 0x22, 0x21, 0x31, 0x22, 0x12, 0x20,
+  0xF0, 0x11, 0xD4, 0xB6, 0x96, 0x87, 0x86, 0x87, 0x95, 0xC3, 0xE5, 0xD7,
+  0xD6, 0xD7, 0xD6, 0xD6, 0xD4, 0xF0, 0x11, 0x0F, 0x0F, 0x04, 0xF0, 0xF0,
+  0xF0, 0xF0, 0x8F, 0x0F, 0x04, 0x01, 0xF0, 0x13, 0xE6, 0xD6, 0xD6, 0xD7,
+  0xD6, 0xD6, 0xE3, 0xB6, 0x96, 0x87, 0x86, 0x87, 0x96, 0xB3, 0xE1, 0xF0,
+  0x10, 0x47, 0x6A, 0x4D, 0x23, 0x64, 0x13, 0x87, 0x96, 0x96, 0x93, 0xB4,
+  0xB3, 0xB4, 0xA4, 0xA4, 0xA4, 0xA4, 0xB3, 0xB4, 0xB4, 0xB4, 0xF0, 0xF0,
+  0xF0, 0xB4, 0xB4, 0xB4, 0xB4, 0x60, 0xD8, 0xF0, 0x8D, 0xF0, 0x3F, 0x02,
+  0xE6, 0x96, 0xB4, 0xE5, 0x94, 0xF0, 0x15, 0x74, 0xF0, 0x34, 0x64, 0xF0,
+  0x54, 0x53, 0x86, 0x23, 0x33, 0x43, 0x79, 0x13, 0x34, 0x33, 0x64, 0x46,
+  0x43, 0x23, 0x64, 0x64, 0x53, 0x23, 0x63, 0x74, 0x53, 0x23, 0x53, 0x84,
+  0x57, 0x63, 0x83, 0x63, 0x13, 0x63, 0x83, 0x63, 0x13, 0x54, 0x83, 0x63,
+  0x13, 0x53, 0x83, 0x73, 0x13, 0x54, 0x73, 0x63, 0x24, 0x53, 0x64, 0x54,
+  0x33, 0x53, 0x64, 0x44, 0x43, 0x55, 0x27, 0x24, 0x54, 0x58, 0x19, 0x74,
+  0x64, 0x46, 0xA3, 0xF0, 0xF5, 0xF0, 0xE5, 0xF0, 0xE6, 0xB1, 0xF0, 0x2F,
+  0x02, 0xF0, 0x3F, 0xF0, 0x69, 0xC0, 0x94, 0xF0, 0x25, 0xF0, 0x26, 0xF7,
+  0xF3, 0x13, 0xF3, 0x14, 0xD4, 0x23, 0xD3, 0x34, 0xC3, 0x34, 0xB4, 0x43,
+  0xB3, 0x54, 0xA3, 0x54, 0x94, 0x63, 0x93, 0x74, 0x83, 0x74, 0x7F, 0x7F,
+  0x01, 0x6F, 0x01, 0x54, 0xA3, 0x53, 0xB4, 0x34, 0xB4, 0x34, 0xC3, 0x33,
+  0xD4, 0x14, 0xD4, 0x14, 0xE3, 0x13, 0xF4, 0x0D, 0x6F, 0x4F, 0x02, 0x23,
+  0xA4, 0x23, 0xB4, 0x13, 0xB4, 0x13, 0xC3, 0x13, 0xC3, 0x13, 0xB4, 0x13,
+  0xB3, 0x23, 0xA4, 0x2F, 0x4F, 0x4F, 0x02, 0x23, 0xA5, 0x13, 0xC3, 0x13,
+  0xC7, 0xD6, 0xD6, 0xD6, 0xC7, 0xC3, 0x13, 0xB4, 0x1F, 0x02, 0x2F, 0x01,
+  0x3E, 0x50, 0x88, 0xDC, 0xAE, 0x85, 0x65, 0x64, 0xA4, 0x44, 0xC3, 0x43,
+  0xD4, 0x24, 0xE3, 0x23, 0xF0, 0x53, 0xF0, 0x53, 0xF0, 0x44, 0xF0, 0x44,
+  0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x53, 0xF0, 0x53, 0xF4, 0x13, 0xF3, 0x24,
+  0xE3, 0x33, 0xD4, 0x34, 0xC3, 0x54, 0xA4, 0x65, 0x65, 0x8E, 0xAC, 0xD8,
+  0x70, 0x0D, 0x7F, 0x5F, 0x01, 0x43, 0x95, 0x33, 0xB4, 0x23, 0xC4, 0x13,
+  0xD3, 0x13, 0xD3, 0x13, 0xD7, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6,
+  0xE6, 0xD7, 0xD3, 0x13, 0xD3, 0x13, 0xC4, 0x13, 0xB4, 0x23, 0x95, 0x3F,
+  0x01, 0x4F, 0x5D, 0x70, 0x0F, 0x0F, 0x0F, 0x0C, 0xF3, 0xF3, 0xF3, 0xF3,
+  0xF3, 0xF3, 0xF3, 0xFF, 0x02, 0x1F, 0x02, 0x1F, 0x02, 0x13, 0xF3, 0xF3,
+  0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xFF, 0x0F, 0x0F, 0x09, 0x0F, 0x0F,
+  0x0F, 0x09, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xEF, 0x2F, 0x2F,
+  0x23, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3,
+  0xE0, 0x98, 0xDD, 0xAF, 0x85, 0x75, 0x64, 0xB4, 0x44, 0xD4, 0x33, 0xF3,
+  0x24, 0xF3, 0x23, 0xF0, 0x63, 0xF0, 0x63, 0xF0, 0x54, 0xF0, 0x54, 0x9F,
+  0x9F, 0x9B, 0x13, 0xF0, 0x23, 0x13, 0xF0, 0x23, 0x13, 0xF0, 0x23, 0x14,
+  0xF4, 0x24, 0xE4, 0x24, 0xD5, 0x34, 0xB6, 0x45, 0x78, 0x5F, 0x13, 0x6D,
+  0x23, 0x98, 0x52, 0xF0, 0x90, 0x03, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7,
+  0xD7, 0xD7, 0xD7, 0xD7, 0xDF, 0x0F, 0x0F, 0x0F, 0x07, 0xD7, 0xD7, 0xD7,
+  0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD4, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x03, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4,
+  0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB8, 0x78, 0x78, 0x78, 0x73,
+  0x14, 0x73, 0x24, 0x54, 0x3B, 0x59, 0x76, 0x50, 0x03, 0xC8, 0xB5, 0x13,
+  0xA5, 0x23, 0x95, 0x33, 0x94, 0x43, 0x84, 0x53, 0x74, 0x63, 0x64, 0x73,
+  0x54, 0x83, 0x44, 0x93, 0x34, 0xA3, 0x25, 0xA3, 0x17, 0x96, 0x24, 0x86,
+  0x33, 0x85, 0x44, 0x74, 0x64, 0x63, 0x83, 0x63, 0x84, 0x53, 0x94, 0x43,
+  0xA3, 0x43, 0xA4, 0x33, 0xB4, 0x23, 0xC4, 0x13, 0xC4, 0x13, 0xD4, 0x03,
+  0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3,
+  0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xDF, 0x0F,
+  0x0F, 0x03, 0x05, 0xEA, 0xEA, 0xEB, 0xCC, 0xCC, 0xC2, 0x16, 0x13, 0xA3,
+  0x16, 0x13, 0xA3, 0x16, 0x13, 0xA2, 0x26, 0x23, 0x83, 0x26, 0x23, 0x83,
+  0x26, 0x23, 0x82, 0x36, 0x33, 0x63, 0x36, 0x33, 0x63, 0x36, 0x33, 0x62,
+  0x46, 0x43, 0x43, 0x46, 0x43, 0x43, 0x46, 0x43, 0x42, 0x56, 0x53, 0x23,
+  0x56, 0x53, 0x23, 0x56, 0x53, 0x23, 0x56, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x66, 0x74, 0x76, 0x74, 0x73, 0x04, 0xD7, 0xD8, 0xC9, 0xB9, 0xBA, 0xA6,
+  0x13, 0xA6, 0x23, 0x96, 0x24, 0x86, 0x33, 0x86, 0x34, 0x76, 0x44, 0x66,
+  0x53, 0x66, 0x54, 0x56, 0x64, 0x46, 0x73, 0x46, 0x74, 0x36, 0x83, 0x36,
+  0x84, 0x26, 0x94, 0x16, 0xA3, 0x16, 0xAA, 0xB9, 0xC8, 0xC8, 0xD4, 0x98,
+  0xFC, 0xBF, 0x01, 0x85, 0x76, 0x65, 0xA5, 0x44, 0xD4, 0x44, 0xE4, 0x24,
+  0xF0, 0x13, 0x23, 0xF0, 0x24, 0x13, 0xF0, 0x24, 0x13, 0xF0, 0x37, 0xF0,
+  0x37, 0xF0, 0x37, 0xF0, 0x37, 0xF0, 0x33, 0x13, 0xF0, 0x33, 0x13, 0xF0,
+  0x24, 0x14, 0xF0, 0x14, 0x14, 0xF0, 0x13, 0x34, 0xE4, 0x34, 0xD4, 0x54,
+  0xB5, 0x65, 0x76, 0x8F, 0x01, 0xBC, 0xF8, 0x80, 0x0E, 0x4F, 0x01, 0x2F,
+  0x02, 0x13, 0xA4, 0x13, 0xB7, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xB7, 0x95,
+  0x1F, 0x02, 0x1F, 0x01, 0x2E, 0x43, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3,
+  0xF3, 0xF3, 0xF3, 0xF3, 0xF0, 0x97, 0xF0, 0x1C, 0xBF, 0x95, 0x76, 0x65,
+  0xA5, 0x44, 0xD4, 0x44, 0xE4, 0x24, 0xF0, 0x13, 0x23, 0xF0, 0x24, 0x13,
+  0xF0, 0x24, 0x13, 0xF0, 0x37, 0xF0, 0x37, 0xF0, 0x37, 0xF0, 0x37, 0xF0,
+  0x33, 0x13, 0xF0, 0x33, 0x13, 0xF0, 0x24, 0x13, 0xF0, 0x24, 0x14, 0xF0,
+  0x13, 0x33, 0xA3, 0x24, 0x34, 0x98, 0x54, 0x96, 0x75, 0x76, 0x8F, 0x03,
+  0x9C, 0x14, 0xA8, 0x44, 0xF0, 0x72, 0x10, 0x0F, 0x5F, 0x02, 0x3F, 0x03,
+  0x23, 0xB5, 0x13, 0xC4, 0x13, 0xD3, 0x13, 0xD3, 0x13, 0xD3, 0x13, 0xD3,
+  0x13, 0xD3, 0x13, 0xC4, 0x13, 0xB4, 0x2F, 0x02, 0x3F, 0x01, 0x4F, 0x02,
+  0x33, 0xB4, 0x23, 0xC4, 0x13, 0xD3, 0x13, 0xD3, 0x13, 0xD3, 0x13, 0xD3,
+  0x13, 0xD3, 0x13, 0xD3, 0x13, 0xD3, 0x13, 0xD7, 0xD4, 0x67, 0xBC, 0x6F,
+  0x54, 0x75, 0x34, 0xA3, 0x33, 0xB4, 0x14, 0xC3, 0x14, 0xC3, 0x23, 0xF0,
+  0x24, 0xF0, 0x17, 0xEA, 0xCB, 0xCA, 0xE7, 0xF0, 0x15, 0xF0, 0x27, 0xD7,
+  0xE6, 0xE7, 0xC4, 0x14, 0xA4, 0x25, 0x85, 0x3F, 0x01, 0x6C, 0xA8, 0x60,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x93, 0xF0, 0x23, 0xF0, 0x23, 0xF0, 0x23, 0xF0,
+  0x23, 0xF0, 0x23, 0xF0, 0x23, 0xF0, 0x23, 0xF0, 0x23, 0xF0, 0x23, 0xF0,
+  0x23, 0xF0, 0x23, 0xF0, 0x23, 0xF0, 0x23, 0xF0, 0x23, 0xF0, 0x23, 0xF0,
+  0x23, 0xF0, 0x23, 0xF0, 0x23, 0xF0, 0x23, 0xF0, 0x23, 0xF0, 0x23, 0xF0,
+  0x23, 0x80, 0x03, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7,
+  0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD3, 0x14,
+  0xB4, 0x24, 0xA4, 0x25, 0x75, 0x4F, 0x7C, 0xA8, 0x60, 0x03, 0xF7, 0xD8,
+  0xD3, 0x23, 0xD3, 0x24, 0xB4, 0x24, 0xB3, 0x43, 0xB3, 0x44, 0x94, 0x53,
+  0x93, 0x63, 0x93, 0x64, 0x74, 0x73, 0x73, 0x83, 0x73, 0x84, 0x54, 0x93,
+  0x53, 0xA3, 0x53, 0xA4, 0x34, 0xB3, 0x33, 0xC3, 0x33, 0xC4, 0x14, 0xD3,
+  0x13, 0xE3, 0x13, 0xE6, 0xF0, 0x15, 0xF0, 0x15, 0xF0, 0x23, 0x90, 0x03,
+  0xB3, 0xB7, 0x95, 0x98, 0x95, 0x98, 0x95, 0x94, 0x13, 0x87, 0x83, 0x23,
+  0x83, 0x13, 0x83, 0x24, 0x73, 0x13, 0x74, 0x24, 0x73, 0x13, 0x74, 0x33,
+  0x63, 0x33, 0x63, 0x43, 0x63, 0x33, 0x63, 0x44, 0x53, 0x33, 0x54, 0x44,
+  0x53, 0x33, 0x54, 0x53, 0x43, 0x53, 0x43, 0x63, 0x43, 0x53, 0x43, 0x64,
+  0x33, 0x53, 0x43, 0x64, 0x33, 0x54, 0x24, 0x73, 0x23, 0x73, 0x23, 0x83,
+  0x23, 0x73, 0x23, 0x83, 0x23, 0x73, 0x23, 0x87, 0x97, 0x96, 0x96, 0xA6,
+  0x96, 0xA6, 0x96, 0xA5, 0xB5, 0xB4, 0xB4, 0xC4, 0xB4, 0x60, 0x04, 0xD4,
+  0x24, 0xB4, 0x44, 0xA3, 0x54, 0x94, 0x64, 0x74, 0x84, 0x63, 0x94, 0x54,
+  0xA4, 0x34, 0xC4, 0x23, 0xD4, 0x14, 0xE7, 0xF0, 0x15, 0xF0, 0x25, 0xF0,
+  0x25, 0xF0, 0x17, 0xF3, 0x13, 0xE4, 0x14, 0xC4, 0x34, 0xB3, 0x54, 0x94,
+  0x54, 0x84, 0x74, 0x73, 0x94, 0x54, 0x94, 0x44, 0xB4, 0x33, 0xD4, 0x14,
+  0xD4, 0x10, 0x04, 0xE8, 0xE3, 0x24, 0xC4, 0x34, 0xA4, 0x44, 0xA4, 0x54,
+  0x84, 0x73, 0x83, 0x84, 0x64, 0x94, 0x53, 0xA4, 0x44, 0xB4, 0x24, 0xD3,
+  0x23, 0xE8, 0xF6, 0xF0, 0x25, 0xF0, 0x24, 0xF0, 0x34, 0xF0, 0x34, 0xF0,
+  0x34, 0xF0, 0x34, 0xF0, 0x34, 0xF0, 0x34, 0xF0, 0x34, 0xF0, 0x34, 0xF0,
+  0x34, 0xF0, 0x34, 0x90, 0x1F, 0x04, 0x1F, 0x04, 0x1F, 0x04, 0xF4, 0xF4,
+  0xF5, 0xF4, 0xF4, 0xF4, 0xF5, 0xF4, 0xF4, 0xF4, 0xF5, 0xF4, 0xF4, 0xF4,
+  0xF4, 0xF0, 0x14, 0xF4, 0xF4, 0xF4, 0xF0, 0x14, 0xFF, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x09, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+  0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+  0x43, 0x43, 0x43, 0x43, 0x43, 0x4F, 0x06, 0x02, 0x82, 0x82, 0x92, 0x82,
+  0x82, 0x92, 0x82, 0x82, 0x92, 0x82, 0x82, 0x92, 0x82, 0x82, 0x92, 0x82,
+  0x82, 0x92, 0x82, 0x82, 0x92, 0x82, 0x82, 0x92, 0x82, 0x0F, 0x03, 0x33,
+  0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+  0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+  0x33, 0x33, 0x3F, 0x06, 0x53, 0x94, 0x95, 0x82, 0x12, 0x73, 0x12, 0x72,
+  0x23, 0x53, 0x32, 0x52, 0x43, 0x42, 0x52, 0x33, 0x52, 0x32, 0x63, 0x13,
+  0x72, 0x12, 0x83, 0x0F, 0x0F, 0x0C, 0x04, 0x44, 0x43, 0x53, 0x53, 0x57,
+  0x8B, 0x5D, 0x34, 0x64, 0x33, 0x83, 0x33, 0x83, 0xE3, 0xD4, 0x7A, 0x4D,
+  0x36, 0x53, 0x24, 0x83, 0x23, 0x93, 0x23, 0x93, 0x23, 0x84, 0x24, 0x65,
+  0x3F, 0x01, 0x29, 0x24, 0x36, 0x53, 0x03, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3,
+  0xE3, 0xE3, 0x36, 0x53, 0x19, 0x4E, 0x36, 0x54, 0x25, 0x74, 0x14, 0x93,
+  0x13, 0xA3, 0x13, 0xA7, 0xA7, 0xB6, 0xB6, 0xA3, 0x13, 0xA3, 0x14, 0x93,
+  0x15, 0x74, 0x16, 0x54, 0x2E, 0x33, 0x19, 0x43, 0x36, 0x50, 0x56, 0x8A,
+  0x5C, 0x44, 0x54, 0x24, 0x73, 0x23, 0x83, 0x14, 0x96, 0xD3, 0xD3, 0xD3,
+  0xD3, 0xD4, 0x93, 0x13, 0x84, 0x13, 0x83, 0x34, 0x54, 0x3C, 0x5A, 0x86,
+  0x50, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0x56, 0x33, 0x39, 0x23,
+  0x2B, 0x13, 0x24, 0x56, 0x14, 0x75, 0x13, 0x98, 0x97, 0xA7, 0xB6, 0xB6,
+  0xB6, 0xA8, 0x94, 0x13, 0x94, 0x14, 0x75, 0x24, 0x56, 0x2F, 0x3A, 0x13,
+  0x57, 0x23, 0xF0, 0x20, 0x57, 0x99, 0x6C, 0x54, 0x54, 0x34, 0x74, 0x23,
+  0x93, 0x13, 0xA3, 0x13, 0xBF, 0x0F, 0x0A, 0xE3, 0xE3, 0xF3, 0x93, 0x23,
+  0x84, 0x34, 0x54, 0x4D, 0x5B, 0x87, 0x50, 0x44, 0x35, 0x26, 0x23, 0x53,
+  0x53, 0x53, 0x3F, 0x01, 0x23, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
+  0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x30, 0x56, 0x23,
+  0x39, 0x13, 0x2B, 0x12, 0x24, 0x55, 0x14, 0x74, 0x13, 0x88, 0x96, 0xA6,
+  0xA6, 0xA6, 0xA6, 0xA7, 0x93, 0x13, 0x84, 0x14, 0x74, 0x24, 0x55, 0x2E,
+  0x39, 0x13, 0x55, 0x33, 0xD3, 0x13, 0x93, 0x13, 0x83, 0x24, 0x73, 0x3C,
+  0x5A, 0x87, 0x40, 0x03, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0x36,
+  0x33, 0x19, 0x2E, 0x15, 0x68, 0x78, 0x86, 0x96, 0x96, 0x96, 0x96, 0x96,
+  0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x93, 0x0C, 0x9F, 0x0F, 0x0F,
+  0x0C, 0x33, 0x33, 0x33, 0x33, 0xF0, 0x63, 0x33, 0x33, 0x33, 0x33, 0x33,
+  0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+  0x33, 0x33, 0x33, 0x33, 0x33, 0x2F, 0x70, 0x03, 0xD3, 0xD3, 0xD3, 0xD3,
+  0xD3, 0xD3, 0xD3, 0x74, 0x23, 0x64, 0x33, 0x54, 0x43, 0x44, 0x53, 0x34,
+  0x63, 0x33, 0x73, 0x23, 0x83, 0x15, 0x79, 0x75, 0x14, 0x64, 0x34, 0x53,
+  0x53, 0x53, 0x54, 0x43, 0x63, 0x43, 0x64, 0x33, 0x74, 0x23, 0x83, 0x23,
+  0x84, 0x13, 0x93, 0x10, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x03, 0xF0, 0xA3,
+  0x26, 0x56, 0x33, 0x19, 0x28, 0x2D, 0x1A, 0x15, 0x56, 0x53, 0x14, 0x65,
+  0x63, 0x13, 0x83, 0x77, 0x83, 0x86, 0x83, 0x86, 0x83, 0x86, 0x83, 0x86,
+  0x83, 0x86, 0x83, 0x86, 0x83, 0x86, 0x83, 0x86, 0x83, 0x86, 0x83, 0x86,
+  0x83, 0x86, 0x83, 0x86, 0x83, 0x83, 0xF3, 0x27, 0x33, 0x19, 0x2E, 0x15,
+  0x68, 0x78, 0x86, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
+  0x96, 0x96, 0x96, 0x93, 0x56, 0x9A, 0x6C, 0x54, 0x54, 0x34, 0x74, 0x23,
+  0x93, 0x14, 0x93, 0x13, 0xA7, 0xB6, 0xB6, 0xB6, 0xA8, 0x93, 0x23, 0x93,
+  0x24, 0x74, 0x34, 0x54, 0x4D, 0x5A, 0x96, 0x60, 0xF0, 0x23, 0x26, 0x63,
+  0x19, 0x4E, 0x36, 0x54, 0x25, 0x74, 0x14, 0x93, 0x13, 0xA3, 0x13, 0xA3,
+  0x13, 0xA7, 0xB6, 0xB6, 0xA7, 0xA3, 0x14, 0x93, 0x15, 0x74, 0x16, 0x54,
+  0x2E, 0x33, 0x19, 0x43, 0x36, 0x53, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3,
+  0xE0, 0x56, 0x33, 0x3A, 0x13, 0x2F, 0x24, 0x56, 0x14, 0x75, 0x13, 0x98,
+  0x97, 0xA7, 0xB6, 0xB6, 0xB6, 0xA8, 0x94, 0x13, 0x94, 0x14, 0x75, 0x15,
+  0x56, 0x2B, 0x13, 0x39, 0x23, 0x56, 0x33, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3,
+  0xE3, 0xE3, 0x03, 0x36, 0x27, 0x1B, 0x35, 0x44, 0x53, 0x63, 0x63, 0x63,
+  0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x60, 0x56, 0x7A,
+  0x4C, 0x24, 0x54, 0x23, 0x73, 0x23, 0x73, 0x23, 0xC5, 0xB8, 0x8A, 0x88,
+  0xB5, 0xC6, 0x97, 0x83, 0x14, 0x64, 0x1D, 0x3B, 0x67, 0x40, 0x23, 0x53,
+  0x53, 0x53, 0x53, 0x3F, 0x01, 0x23, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
+  0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x56, 0x35, 0x35, 0x03, 0x96,
+  0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
+  0x87, 0x88, 0x65, 0x1E, 0x29, 0x13, 0x37, 0x23, 0xF0, 0x13, 0xA3, 0x13,
+  0x94, 0x13, 0x93, 0x33, 0x83, 0x33, 0x73, 0x43, 0x73, 0x53, 0x63, 0x53,
+  0x53, 0x63, 0x53, 0x73, 0x43, 0x73, 0x33, 0x83, 0x33, 0x93, 0x22, 0xA3,
+  0x13, 0xA3, 0x13, 0xB5, 0xC5, 0xC5, 0xD3, 0x70, 0x04, 0x74, 0x73, 0x13,
+  0x74, 0x64, 0x13, 0x65, 0x63, 0x23, 0x65, 0x63, 0x33, 0x52, 0x13, 0x53,
+  0x33, 0x52, 0x13, 0x44, 0x33, 0x43, 0x13, 0x43, 0x44, 0x33, 0x13, 0x43,
+  0x53, 0x33, 0x23, 0x33, 0x53, 0x32, 0x33, 0x23, 0x63, 0x23, 0x33, 0x23,
+  0x73, 0x13, 0x33, 0x23, 0x73, 0x13, 0x43, 0x13, 0x73, 0x12, 0x56, 0x86,
+  0x56, 0x95, 0x56, 0x95, 0x64, 0xA4, 0x74, 0xB3, 0x74, 0x50, 0x13, 0x93,
+  0x23, 0x73, 0x34, 0x54, 0x43, 0x53, 0x63, 0x33, 0x74, 0x14, 0x83, 0x13,
+  0xA5, 0xB5, 0xC3, 0xC5, 0xA7, 0x93, 0x13, 0x83, 0x24, 0x64, 0x34, 0x53,
+  0x53, 0x43, 0x64, 0x24, 0x73, 0x23, 0x93, 0x04, 0x93, 0x13, 0x93, 0x13,
+  0x84, 0x14, 0x73, 0x33, 0x73, 0x33, 0x64, 0x34, 0x53, 0x53, 0x53, 0x53,
+  0x43, 0x64, 0x33, 0x73, 0x33, 0x73, 0x23, 0x83, 0x23, 0x93, 0x13, 0x96,
+  0xA6, 0xB5, 0xB4, 0xC4, 0xC4, 0xC3, 0xD3, 0xC3, 0xD3, 0xA6, 0xA5, 0xB3,
+  0xB0, 0x1E, 0x1E, 0x1E, 0xA4, 0xB3, 0xB3, 0xB4, 0xA4, 0xA4, 0xB3, 0xB3,
+  0xB4, 0xA4, 0xA4, 0xB3, 0xB3, 0xBF, 0x0F, 0x0F, 0x44, 0x35, 0x33, 0x43,
+  0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x43, 0x44,
+  0x43, 0x53, 0x63, 0x63, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
+  0x53, 0x53, 0x53, 0x65, 0x44, 0x0F, 0x0F, 0x0F, 0x0F, 0x06, 0x04, 0x45,
+  0x53, 0x62, 0x63, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
+  0x53, 0x64, 0x53, 0x53, 0x43, 0x43, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
+  0x53, 0x53, 0x53, 0x52, 0x53, 0x35, 0x34, 0x40, 0x24, 0xA7, 0x55, 0x34,
+  0x34, 0x5A, 0x75, 0x10, 0x0F, 0x0F, 0x0F, 0x0A, 0xF0, 0x56, 0x76, 0x76,
+  0x5A, 0x56, 0x4C, 0x46, 0x43, 0x64, 0x36, 0x33, 0x83, 0x36, 0x33, 0x84,
+  0x26, 0x33, 0x93, 0x26, 0x33, 0x93, 0x26, 0xE4, 0x26, 0xE3, 0x36, 0xD4,
+  0x36, 0xC4, 0x46, 0xB4, 0x56, 0xA4, 0x66, 0x94, 0x76, 0x93, 0x86, 0x84,
+  0x86, 0x84, 0x86, 0x84, 0x86, 0xF0, 0x56, 0xF0, 0x56, 0xF0, 0x56, 0x84,
+  0x86, 0x84, 0x86, 0x84, 0x86, 0x84, 0x86, 0xF0, 0x56, 0xF0, 0x5F, 0x0F,
+  0x0F, 0x0A, 0x0F, 0x0F, 0x0F, 0x0A, 0xF0, 0x56, 0x76, 0x76, 0x5A, 0x56,
+  0x4C, 0x46, 0x43, 0x64, 0x36, 0x33, 0x83, 0x36, 0x33, 0x84, 0x26, 0x33,
+  0x93, 0x26, 0x33, 0x93, 0x26, 0xE4, 0x26, 0xE3, 0x36, 0xD4, 0x36, 0xC4,
+  0x46, 0xB4, 0x56, 0xA4, 0x66, 0x94, 0x76, 0x93, 0x86, 0x84, 0x86, 0x84,
+  0x86, 0x84, 0x86, 0xF0, 0x56, 0xF0, 0x56, 0xF0, 0x56, 0x84, 0x86, 0x84,
+  0x86, 0x84, 0x86, 0x84, 0x86, 0xF0, 0x56, 0xF0, 0x5F, 0x0F, 0x0F, 0x0A,
+  0x0F, 0x0F, 0x0F, 0x0A, 0xF0, 0x56, 0x76, 0x76, 0x5A, 0x56, 0x4C, 0x46,
+  0x43, 0x64, 0x36, 0x33, 0x83, 0x36, 0x33, 0x84, 0x26, 0x33, 0x93, 0x26,
+  0x33, 0x93, 0x26, 0xE4, 0x26, 0xE3, 0x36, 0xD4, 0x36, 0xC4, 0x46, 0xB4,
+  0x56, 0xA4, 0x66, 0x94, 0x76, 0x93, 0x86, 0x84, 0x86, 0x84, 0x86, 0x84,
+  0x86, 0xF0, 0x56, 0xF0, 0x56, 0xF0, 0x56, 0x84, 0x86, 0x84, 0x86, 0x84,
+  0x86, 0x84, 0x86, 0xF0, 0x56, 0xF0, 0x5F, 0x0F, 0x0F, 0x0A, 0x0F, 0x0F,
+  0x0F, 0x0A, 0xF0, 0x56, 0x76, 0x76, 0x5A, 0x56, 0x4C, 0x46, 0x43, 0x64,
+  0x36, 0x33, 0x83, 0x36, 0x33, 0x84, 0x26, 0x33, 0x93, 0x26, 0x33, 0x93,
+  0x26, 0xE4, 0x26, 0xE3, 0x36, 0xD4, 0x36, 0xC4, 0x46, 0xB4, 0x56, 0xA4,
+  0x66, 0x94, 0x76, 0x93, 0x86, 0x84, 0x86, 0x84, 0x86, 0x84, 0x86, 0xF0,
+  0x56, 0xF0, 0x56, 0xF0, 0x56, 0x84, 0x86, 0x84, 0x86, 0x84, 0x86, 0x84,
+  0x86, 0xF0, 0x56, 0xF0, 0x5F, 0x0F, 0x0F, 0x0A, 0x0F, 0x0F, 0x0F, 0x0A,
+  0xF0, 0x56, 0x76, 0x76, 0x5A, 0x56, 0x4C, 0x46, 0x43, 0x64, 0x36, 0x33,
+  0x83, 0x36, 0x33, 0x84, 0x26, 0x33, 0x93, 0x26, 0x33, 0x93, 0x26, 0xE4,
+  0x26, 0xE3, 0x36, 0xD4, 0x36, 0xC4, 0x46, 0xB4, 0x56, 0xA4, 0x66, 0x94,
+  0x76, 0x93, 0x86, 0x84, 0x86, 0x84, 0x86, 0x84, 0x86, 0xF0, 0x56, 0xF0,
+  0x56, 0xF0, 0x56, 0x84, 0x86, 0x84, 0x86, 0x84, 0x86, 0x84, 0x86, 0xF0,
+  0x56, 0xF0, 0x5F, 0x0F, 0x0F, 0x0A, 0x0F, 0x0F, 0x0F, 0x0A, 0xF0, 0x56,
+  0x76, 0x76, 0x5A, 0x56, 0x4C, 0x46, 0x43, 0x64, 0x36, 0x33, 0x83, 0x36,
+  0x33, 0x84, 0x26, 0x33, 0x93, 0x26, 0x33, 0x93, 0x26, 0xE4, 0x26, 0xE3,
+  0x36, 0xD4, 0x36, 0xC4, 0x46, 0xB4, 0x56, 0xA4, 0x66, 0x94, 0x76, 0x93,
+  0x86, 0x84, 0x86, 0x84, 0x86, 0x84, 0x86, 0xF0, 0x56, 0xF0, 0x56, 0xF0,
+  0x56, 0x84, 0x86, 0x84, 0x86, 0x84, 0x86, 0x84, 0x86, 0xF0, 0x56, 0xF0,
+  0x5F, 0x0F, 0x0F, 0x0A, 0x0F, 0x0F, 0x0F, 0x0A, 0xF0, 0x56, 0x76, 0x76,
+  0x5A, 0x56, 0x4C, 0x46, 0x43, 0x64, 0x36, 0x33, 0x83, 0x36, 0x33, 0x84,
+  0x26, 0x33, 0x93, 0x26, 0x33, 0x93, 0x26, 0xE4, 0x26, 0xE3, 0x36, 0xD4,
+  0x36, 0xC4, 0x46, 0xB4, 0x56, 0xA4, 0x66, 0x94, 0x76, 0x93, 0x86, 0x84,
+  0x86, 0x84, 0x86, 0x84, 0x86, 0xF0, 0x56, 0xF0, 0x56, 0xF0, 0x56, 0x84,
+  0x86, 0x84, 0x86, 0x84, 0x86, 0x84, 0x86, 0xF0, 0x56, 0xF0, 0x5F, 0x0F,
+  0x0F, 0x0A, 0x0F, 0x0F, 0x0F, 0x0A, 0xF0, 0x56, 0x76, 0x76, 0x5A, 0x56,
+  0x4C, 0x46, 0x43, 0x64, 0x36, 0x33, 0x83, 0x36, 0x33, 0x84, 0x26, 0x33,
+  0x93, 0x26, 0x33, 0x93, 0x26, 0xE4, 0x26, 0xE3, 0x36, 0xD4, 0x36, 0xC4,
+  0x46, 0xB4, 0x56, 0xA4, 0x66, 0x94, 0x76, 0x93, 0x86, 0x84, 0x86, 0x84,
+  0x86, 0x84, 0x86, 0xF0, 0x56, 0xF0, 0x56, 0xF0, 0x56, 0x84, 0x86, 0x84,
+  0x86, 0x84, 0x86, 0x84, 0x86, 0xF0, 0x56, 0xF0, 0x5F, 0x0F, 0x0F, 0x0A,
+  0x0F, 0x0F, 0x0F, 0x0A, 0xF0, 0x56, 0x76, 0x76, 0x5A, 0x56, 0x4C, 0x46,
+  0x43, 0x64, 0x36, 0x33, 0x83, 0x36, 0x33, 0x84, 0x26, 0x33, 0x93, 0x26,
+  0x33, 0x93, 0x26, 0xE4, 0x26, 0xE3, 0x36, 0xD4, 0x36, 0xC4, 0x46, 0xB4,
+  0x56, 0xA4, 0x66, 0x94, 0x76, 0x93, 0x86, 0x84, 0x86, 0x84, 0x86, 0x84,
+  0x86, 0xF0, 0x56, 0xF0, 0x56, 0xF0, 0x56, 0x84, 0x86, 0x84, 0x86, 0x84,
+  0x86, 0x84, 0x86, 0xF0, 0x56, 0xF0, 0x5F, 0x0F, 0x0F, 0x0A, 0x0F, 0x0F,
+  0x0F, 0x0A, 0xF0, 0x56, 0x76, 0x76, 0x5A, 0x56, 0x4C, 0x46, 0x43, 0x64,
+  0x36, 0x33, 0x83, 0x36, 0x33, 0x84, 0x26, 0x33, 0x93, 0x26, 0x33, 0x93,
+  0x26, 0xE4, 0x26, 0xE3, 0x36, 0xD4, 0x36, 0xC4, 0x46, 0xB4, 0x56, 0xA4,
+  0x66, 0x94, 0x76, 0x93, 0x86, 0x84, 0x86, 0x84, 0x86, 0x84, 0x86, 0xF0,
+  0x56, 0xF0, 0x56, 0xF0, 0x56, 0x84, 0x86, 0x84, 0x86, 0x84, 0x86, 0x84,
+  0x86, 0xF0, 0x56, 0xF0, 0x5F, 0x0F, 0x0F, 0x0A, 0x0F, 0x0F, 0x0F, 0x0A,
+  0xF0, 0x56, 0x76, 0x76, 0x5A, 0x56, 0x4C, 0x46, 0x43, 0x64, 0x36, 0x33,
+  0x83, 0x36, 0x33, 0x84, 0x26, 0x33, 0x93, 0x26, 0x33, 0x93, 0x26, 0xE4,
+  0x26, 0xE3, 0x36, 0xD4, 0x36, 0xC4, 0x46, 0xB4, 0x56, 0xA4, 0x66, 0x94,
+  0x76, 0x93, 0x86, 0x84, 0x86, 0x84, 0x86, 0x84, 0x86, 0xF0, 0x56, 0xF0,
+  0x56, 0xF0, 0x56, 0x84, 0x86, 0x84, 0x86, 0x84, 0x86, 0x84, 0x86, 0xF0,
+  0x56, 0xF0, 0x5F, 0x0F, 0x0F, 0x0A, 0x0F, 0x0F, 0x0F, 0x0A, 0xF0, 0x56,
+  0x76, 0x76, 0x5A, 0x56, 0x4C, 0x46, 0x43, 0x64, 0x36, 0x33, 0x83, 0x36,
+  0x33, 0x84, 0x26, 0x33, 0x93, 0x26, 0x33, 0x93, 0x26, 0xE4, 0x26, 0xE3,
+  0x36, 0xD4, 0x36, 0xC4, 0x46, 0xB4, 0x56, 0xA4, 0x66, 0x94, 0x76, 0x93,
+  0x86, 0x84, 0x86, 0x84, 0x86, 0x84, 0x86, 0xF0, 0x56, 0xF0, 0x56, 0xF0,
+  0x56, 0x84, 0x86, 0x84, 0x86, 0x84, 0x86, 0x84, 0x86, 0xF0, 0x56, 0xF0,
+  0x5F, 0x0F, 0x0F, 0x0A, 0x0F, 0x0F, 0x0F, 0x0A, 0xF0, 0x56, 0x76, 0x76,
+  0x5A, 0x56, 0x4C, 0x46, 0x43, 0x64, 0x36, 0x33, 0x83, 0x36, 0x33, 0x84,
+  0x26, 0x33, 0x93, 0x26, 0x33, 0x93, 0x26, 0xE4, 0x26, 0xE3, 0x36, 0xD4,
+  0x36, 0xC4, 0x46, 0xB4, 0x56, 0xA4, 0x66, 0x94, 0x76, 0x93, 0x86, 0x84,
+  0x86, 0x84, 0x86, 0x84, 0x86, 0xF0, 0x56, 0xF0, 0x56, 0xF0, 0x56, 0x84,
+  0x86, 0x84, 0x86, 0x84, 0x86, 0x84, 0x86, 0xF0, 0x56, 0xF0, 0x5F, 0x0F,
+  0x0F, 0x0A, 0x0F, 0x0F, 0x0F, 0x0A, 0xF0, 0x56, 0x76, 0x76, 0x5A, 0x56,
+  0x4C, 0x46, 0x43, 0x64, 0x36, 0x33, 0x83, 0x36, 0x33, 0x84, 0x26, 0x33,
+  0x93, 0x26, 0x33, 0x93, 0x26, 0xE4, 0x26, 0xE3, 0x36, 0xD4, 0x36, 0xC4,
+  0x46, 0xB4, 0x56, 0xA4, 0x66, 0x94, 0x76, 0x93, 0x86, 0x84, 0x86, 0x84,
+  0x86, 0x84, 0x86, 0xF0, 0x56, 0xF0, 0x56, 0xF0, 0x56, 0x84, 0x86, 0x84,
+  0x86, 0x84, 0x86, 0x84, 0x86, 0xF0, 0x56, 0xF0, 0x5F, 0x0F, 0x0F, 0x0A,
+  0x0F, 0x0F, 0x0F, 0x0A, 0xF0, 0x56, 0x76, 0x76, 0x5A, 0x56, 0x4C, 0x46,
+  0x43, 0x64, 0x36, 0x33, 0x83, 0x36, 0x33, 0x84, 0x26, 0x33, 0x93, 0x26,
+  0x33, 0x93, 0x26, 0xE4, 0x26, 0xE3, 0x36, 0xD4, 0x36, 0xC4, 0x46, 0xB4,
+  0x56, 0xA4, 0x66, 0x94, 0x76, 0x93, 0x86, 0x84, 0x86, 0x84, 0x86, 0x84,
+  0x86, 0xF0, 0x56, 0xF0, 0x56, 0xF0, 0x56, 0x84, 0x86, 0x84, 0x86, 0x84,
+  0x86, 0x84, 0x86, 0xF0, 0x56, 0xF0, 0x5F, 0x0F, 0x0F, 0x0A, 0x0F, 0x0F,
+  0x0F, 0x0A, 0xF0, 0x56, 0x76, 0x76, 0x5A, 0x56, 0x4C, 0x46, 0x43, 0x64,
+  0x36, 0x33, 0x83, 0x36, 0x33, 0x84, 0x26, 0x33, 0x93, 0x26, 0x33, 0x93,
+  0x26, 0xE4, 0x26, 0xE3, 0x36, 0xD4, 0x36, 0xC4, 0x46, 0xB4, 0x56, 0xA4,
+  0x66, 0x94, 0x76, 0x93, 0x86, 0x84, 0x86, 0x84, 0x86, 0x84, 0x86, 0xF0,
+  0x56, 0xF0, 0x56, 0xF0, 0x56, 0x84, 0x86, 0x84, 0x86, 0x84, 0x86, 0x84,
+  0x86, 0xF0, 0x56, 0xF0, 0x5F, 0x0F, 0x0F, 0x0A, 0x0F, 0x0F, 0x0F, 0x0A,
+  0xF0, 0x56, 0x76, 0x76, 0x5A, 0x56, 0x4C, 0x46, 0x43, 0x64, 0x36, 0x33,
+  0x83, 0x36, 0x33, 0x84, 0x26, 0x33, 0x93, 0x26, 0x33, 0x93, 0x26, 0xE4,
+  0x26, 0xE3, 0x36, 0xD4, 0x36, 0xC4, 0x46, 0xB4, 0x56, 0xA4, 0x66, 0x94,
+  0x76, 0x93, 0x86, 0x84, 0x86, 0x84, 0x86, 0x84, 0x86, 0xF0, 0x56, 0xF0,
+  0x56, 0xF0, 0x56, 0x84, 0x86, 0x84, 0x86, 0x84, 0x86, 0x84, 0x86, 0xF0,
+  0x56, 0xF0, 0x5F, 0x0F, 0x0F, 0x0A, 0x0F, 0x0F, 0x0F, 0x0A, 0xF0, 0x56,
+  0x76, 0x76, 0x5A, 0x56, 0x4C, 0x46, 0x43, 0x64, 0x36, 0x33, 0x83, 0x36,
+  0x33, 0x84, 0x26, 0x33, 0x93, 0x26, 0x33, 0x93, 0x26, 0xE4, 0x26, 0xE3,
+  0x36, 0xD4, 0x36, 0xC4, 0x46, 0xB4, 0x56, 0xA4, 0x66, 0x94, 0x76, 0x93,
+  0x86, 0x84, 0x86, 0x84, 0x86, 0x84, 0x86, 0xF0, 0x56, 0xF0, 0x56, 0xF0,
+  0x56, 0x84, 0x86, 0x84, 0x86, 0x84, 0x86, 0x84, 0x86, 0xF0, 0x56, 0xF0,
+  0x5F, 0x0F, 0x0F, 0x0A, 0x0F, 0x0F, 0x0F, 0x0A, 0xF0, 0x56, 0x76, 0x76,
+  0x5A, 0x56, 0x4C, 0x46, 0x43, 0x64, 0x36, 0x33, 0x83, 0x36, 0x33, 0x84,
+  0x26, 0x33, 0x93, 0x26, 0x33, 0x93, 0x26, 0xE4, 0x26, 0xE3, 0x36, 0xD4,
+  0x36, 0xC4, 0x46, 0xB4, 0x56, 0xA4, 0x66, 0x94, 0x76, 0x93, 0x86, 0x84,
+  0x86, 0x84, 0x86, 0x84, 0x86, 0xF0, 0x56, 0xF0, 0x56, 0xF0, 0x56, 0x84,
+  0x86, 0x84, 0x86, 0x84, 0x86, 0x84, 0x86, 0xF0, 0x56, 0xF0, 0x5F, 0x0F,
+  0x0F, 0x0A, 0x0F, 0x0F, 0x0F, 0x0A, 0xF0, 0x56, 0x76, 0x76, 0x5A, 0x56,
+  0x4C, 0x46, 0x43, 0x64, 0x36, 0x33, 0x83, 0x36, 0x33, 0x84, 0x26, 0x33,
+  0x93, 0x26, 0x33, 0x93, 0x26, 0xE4, 0x26, 0xE3, 0x36, 0xD4, 0x36, 0xC4,
+  0x46, 0xB4, 0x56, 0xA4, 0x66, 0x94, 0x76, 0x93, 0x86, 0x84, 0x86, 0x84,
+  0x86, 0x84, 0x86, 0xF0, 0x56, 0xF0, 0x56, 0xF0, 0x56, 0x84, 0x86, 0x84,
+  0x86, 0x84, 0x86, 0x84, 0x86, 0xF0, 0x56, 0xF0, 0x5F, 0x0F, 0x0F, 0x0A,
+  0x0F, 0x0F, 0x0F, 0x0A, 0xF0, 0x56, 0x76, 0x76, 0x5A, 0x56, 0x4C, 0x46,
+  0x43, 0x64, 0x36, 0x33, 0x83, 0x36, 0x33, 0x84, 0x26, 0x33, 0x93, 0x26,
+  0x33, 0x93, 0x26, 0xE4, 0x26, 0xE3, 0x36, 0xD4, 0x36, 0xC4, 0x46, 0xB4,
+  0x56, 0xA4, 0x66, 0x94, 0x76, 0x93, 0x86, 0x84, 0x86, 0x84, 0x86, 0x84,
+  0x86, 0xF0, 0x56, 0xF0, 0x56, 0xF0, 0x56, 0x84, 0x86, 0x84, 0x86, 0x84,
+  0x86, 0x84, 0x86, 0xF0, 0x56, 0xF0, 0x5F, 0x0F, 0x0F, 0x0A, 0x0F, 0x0F,
+  0x0F, 0x0A, 0xF0, 0x56, 0x76, 0x76, 0x5A, 0x56, 0x4C, 0x46, 0x43, 0x64,
+  0x36, 0x33, 0x83, 0x36, 0x33, 0x84, 0x26, 0x33, 0x93, 0x26, 0x33, 0x93,
+  0x26, 0xE4, 0x26, 0xE3, 0x36, 0xD4, 0x36, 0xC4, 0x46, 0xB4, 0x56, 0xA4,
+  0x66, 0x94, 0x76, 0x93, 0x86, 0x84, 0x86, 0x84, 0x86, 0x84, 0x86, 0xF0,
+  0x56, 0xF0, 0x56, 0xF0, 0x56, 0x84, 0x86, 0x84, 0x86, 0x84, 0x86, 0x84,
+  0x86, 0xF0, 0x56, 0xF0, 0x5F, 0x0F, 0x0F, 0x0A, 0x0F, 0x0F, 0x0F, 0x0A,
+  0xF0, 0x56, 0x76, 0x76, 0x5A, 0x56, 0x4C, 0x46, 0x43, 0x64, 0x36, 0x33,
+  0x83, 0x36, 0x33, 0x84, 0x26, 0x33, 0x93, 0x26, 0x33, 0x93, 0x26, 0xE4,
+  0x26, 0xE3, 0x36, 0xD4, 0x36, 0xC4, 0x46, 0xB4, 0x56, 0xA4, 0x66, 0x94,
+  0x76, 0x93, 0x86, 0x84, 0x86, 0x84, 0x86, 0x84, 0x86, 0xF0, 0x56, 0xF0,
+  0x56, 0xF0, 0x56, 0x84, 0x86, 0x84, 0x86, 0x84, 0x86, 0x84, 0x86, 0xF0,
+  0x56, 0xF0, 0x5F, 0x0F, 0x0F, 0x0A, 0x0F, 0x0F, 0x0F, 0x0A, 0xF0, 0x56,
+  0x76, 0x76, 0x5A, 0x56, 0x4C, 0x46, 0x43, 0x64, 0x36, 0x33, 0x83, 0x36,
+  0x33, 0x84, 0x26, 0x33, 0x93, 0x26, 0x33, 0x93, 0x26, 0xE4, 0x26, 0xE3,
+  0x36, 0xD4, 0x36, 0xC4, 0x46, 0xB4, 0x56, 0xA4, 0x66, 0x94, 0x76, 0x93,
+  0x86, 0x84, 0x86, 0x84, 0x86, 0x84, 0x86, 0xF0, 0x56, 0xF0, 0x56, 0xF0,
+  0x56, 0x84, 0x86, 0x84, 0x86, 0x84, 0x86, 0x84, 0x86, 0xF0, 0x56, 0xF0,
+  0x5F, 0x0F, 0x0F, 0x0A, 0x0F, 0x0F, 0x0F, 0x0A, 0xF0, 0x56, 0x76, 0x76,
+  0x5A, 0x56, 0x4C, 0x46, 0x43, 0x64, 0x36, 0x33, 0x83, 0x36, 0x33, 0x84,
+  0x26, 0x33, 0x93, 0x26, 0x33, 0x93, 0x26, 0xE4, 0x26, 0xE3, 0x36, 0xD4,
+  0x36, 0xC4, 0x46, 0xB4, 0x56, 0xA4, 0x66, 0x94, 0x76, 0x93, 0x86, 0x84,
+  0x86, 0x84, 0x86, 0x84, 0x86, 0xF0, 0x56, 0xF0, 0x56, 0xF0, 0x56, 0x84,
+  0x86, 0x84, 0x86, 0x84, 0x86, 0x84, 0x86, 0xF0, 0x56, 0xF0, 0x5F, 0x0F,
+  0x0F, 0x0A, 0x0F, 0x0F, 0x0F, 0x0A, 0xF0, 0x56, 0x76, 0x76, 0x5A, 0x56,
+  0x4C, 0x46, 0x43, 0x64, 0x36, 0x33, 0x83, 0x36, 0x33, 0x84, 0x26, 0x33,
+  0x93, 0x26, 0x33, 0x93, 0x26, 0xE4, 0x26, 0xE3, 0x36, 0xD4, 0x36, 0xC4,
+  0x46, 0xB4, 0x56, 0xA4, 0x66, 0x94, 0x76, 0x93, 0x86, 0x84, 0x86, 0x84,
+  0x86, 0x84, 0x86, 0xF0, 0x56, 0xF0, 0x56, 0xF0, 0x56, 0x84, 0x86, 0x84,
+  0x86, 0x84, 0x86, 0x84, 0x86, 0xF0, 0x56, 0xF0, 0x5F, 0x0F, 0x0F, 0x0A,
+  0x0F, 0x0F, 0x0F, 0x0A, 0xF0, 0x56, 0x76, 0x76, 0x5A, 0x56, 0x4C, 0x46,
+  0x43, 0x64, 0x36, 0x33, 0x83, 0x36, 0x33, 0x84, 0x26, 0x33, 0x93, 0x26,
+  0x33, 0x93, 0x26, 0xE4, 0x26, 0xE3, 0x36, 0xD4, 0x36, 0xC4, 0x46, 0xB4,
+  0x56, 0xA4, 0x66, 0x94, 0x76, 0x93, 0x86, 0x84, 0x86, 0x84, 0x86, 0x84,
+  0x86, 0xF0, 0x56, 0xF0, 0x56, 0xF0, 0x56, 0x84, 0x86, 0x84, 0x86, 0x84,
+  0x86, 0x84, 0x86, 0xF0, 0x56, 0xF0, 0x5F, 0x0F, 0x0F, 0x0A, 0x0F, 0x0F,
+  0x0F, 0x0A, 0xF0, 0x56, 0x76, 0x76, 0x5A, 0x56, 0x4C, 0x46, 0x43, 0x64,
+  0x36, 0x33, 0x83, 0x36, 0x33, 0x84, 0x26, 0x33, 0x93, 0x26, 0x33, 0x93,
+  0x26, 0xE4, 0x26, 0xE3, 0x36, 0xD4, 0x36, 0xC4, 0x46, 0xB4, 0x56, 0xA4,
+  0x66, 0x94, 0x76, 0x93, 0x86, 0x84, 0x86, 0x84, 0x86, 0x84, 0x86, 0xF0,
+  0x56, 0xF0, 0x56, 0xF0, 0x56, 0x84, 0x86, 0x84, 0x86, 0x84, 0x86, 0x84,
+  0x86, 0xF0, 0x56, 0xF0, 0x5F, 0x0F, 0x0F, 0x0A, 0x0F, 0x0F, 0x0F, 0x0A,
+  0xF0, 0x56, 0x76, 0x76, 0x5A, 0x56, 0x4C, 0x46, 0x43, 0x64, 0x36, 0x33,
+  0x83, 0x36, 0x33, 0x84, 0x26, 0x33, 0x93, 0x26, 0x33, 0x93, 0x26, 0xE4,
+  0x26, 0xE3, 0x36, 0xD4, 0x36, 0xC4, 0x46, 0xB4, 0x56, 0xA4, 0x66, 0x94,
+  0x76, 0x93, 0x86, 0x84, 0x86, 0x84, 0x86, 0x84, 0x86, 0xF0, 0x56, 0xF0,
+  0x56, 0xF0, 0x56, 0x84, 0x86, 0x84, 0x86, 0x84, 0x86, 0x84, 0x86, 0xF0,
+  0x56, 0xF0, 0x5F, 0x0F, 0x0F, 0x0A, 0x0F, 0x0F, 0x0F, 0x0A, 0xF0, 0x56,
+  0x76, 0x76, 0x5A, 0x56, 0x4C, 0x46, 0x43, 0x64, 0x36, 0x33, 0x83, 0x36,
+  0x33, 0x84, 0x26, 0x33, 0x93, 0x26, 0x33, 0x93, 0x26, 0xE4, 0x26, 0xE3,
+  0x36, 0xD4, 0x36, 0xC4, 0x46, 0xB4, 0x56, 0xA4, 0x66, 0x94, 0x76, 0x93,
+  0x86, 0x84, 0x86, 0x84, 0x86, 0x84, 0x86, 0xF0, 0x56, 0xF0, 0x56, 0xF0,
+  0x56, 0x84, 0x86, 0x84, 0x86, 0x84, 0x86, 0x84, 0x86, 0xF0, 0x56, 0xF0,
+  0x5F, 0x0F, 0x0F, 0x0A, 0x0F, 0x0F, 0x0F, 0x0A, 0xF0, 0x56, 0x76, 0x76,
+  0x5A, 0x56, 0x4C, 0x46, 0x43, 0x64, 0x36, 0x33, 0x83, 0x36, 0x33, 0x84,
+  0x26, 0x33, 0x93, 0x26, 0x33, 0x93, 0x26, 0xE4, 0x26, 0xE3, 0x36, 0xD4,
+  0x36, 0xC4, 0x46, 0xB4, 0x56, 0xA4, 0x66, 0x94, 0x76, 0x93, 0x86, 0x84,
+  0x86, 0x84, 0x86, 0x84, 0x86, 0xF0, 0x56, 0xF0, 0x56, 0xF0, 0x56, 0x84,
+  0x86, 0x84, 0x86, 0x84, 0x86, 0x84, 0x86, 0xF0, 0x56, 0xF0, 0x5F, 0x0F,
+  0x0F, 0x0A, 0x0F, 0x0F, 0x0F, 0x0A, 0xF0, 0x56, 0x76, 0x76, 0x5A, 0x56,
+  0x4C, 0x46, 0x43, 0x64, 0x36, 0x33, 0x83, 0x36, 0x33, 0x84, 0x26, 0x33,
+  0x93, 0x26, 0x33, 0x93, 0x26, 0xE4, 0x26, 0xE3, 0x36, 0xD4, 0x36, 0xC4,
+  0x46, 0xB4, 0x56, 0xA4, 0x66, 0x94, 0x76, 0x93, 0x86, 0x84, 0x86, 0x84,
+  0x86, 0x84, 0x86, 0xF0, 0x56, 0xF0, 0x56, 0xF0, 0x56, 0x84, 0x86, 0x84,
+  0x86, 0x84, 0x86, 0x84, 0x86, 0xF0, 0x56, 0xF0, 0x5F, 0x0F, 0x0F, 0x0A,
+  0x0F, 0x0F, 0x0F, 0x0A, 0xF0, 0x56, 0x76, 0x76, 0x5A, 0x56, 0x4C, 0x46,
+  0x43, 0x64, 0x36, 0x33, 0x83, 0x36, 0x33, 0x84, 0x26, 0x33, 0x93, 0x26,
+  0x33, 0x93, 0x26, 0xE4, 0x26, 0xE3, 0x36, 0xD4, 0x36, 0xC4, 0x46, 0xB4,
+  0x56, 0xA4, 0x66, 0x94, 0x76, 0x93, 0x86, 0x84, 0x86, 0x84, 0x86, 0x84,
+  0x86, 0xF0, 0x56, 0xF0, 0x56, 0xF0, 0x56, 0x84, 0x86, 0x84, 0x86, 0x84,
+  0x86, 0x84, 0x86, 0xF0, 0x56, 0xF0, 0x5F, 0x0F, 0x0F, 0x0A, 0x10, 0x09,
+  0x71, 0x22, 0x12, 0x12, 0x12, 0x1F, 0x0F, 0x0E, 0x81, 0xF1, 0xF1, 0xC7,
+  0x7A, 0x5C, 0x34, 0x31, 0x24, 0x23, 0x41, 0x33, 0x14, 0x41, 0x46, 0x51,
+  0x73, 0x51, 0x73, 0x51, 0x73, 0x51, 0x73, 0x51, 0x73, 0x51, 0x73, 0x51,
+  0x47, 0x41, 0x43, 0x13, 0x41, 0x33, 0x24, 0x31, 0x24, 0x3C, 0x5A, 0x86,
+  0xD1, 0xF1, 0xF1, 0x70, 0x66, 0xAA, 0x7C, 0x54, 0x64, 0x43, 0x83, 0x33,
+  0x94, 0x23, 0xA3, 0x23, 0xA3, 0x23, 0xF4, 0xF3, 0xF4, 0xCC, 0x6C, 0xA3,
+  0xF4, 0xF3, 0xF3, 0xE3, 0xF3, 0xE3, 0xE3, 0xF2, 0x16, 0x42, 0x1F, 0x03,
+  0x1F, 0x01, 0x31, 0x76, 0x20, 0x21, 0xD3, 0x23, 0x32, 0x2E, 0x2C, 0x34,
+  0x34, 0x43, 0x63, 0x23, 0x73, 0x23, 0x73, 0x23, 0x73, 0x23, 0x73, 0x33,
+  0x63, 0x34, 0x34, 0x4C, 0x2E, 0x13, 0x24, 0x22, 0x31, 0xC0, 0x13, 0xC3,
+  0x13, 0xB3, 0x33, 0xA3, 0x33, 0x93, 0x53, 0x83, 0x63, 0x63, 0x73, 0x62,
+  0x93, 0x43, 0x93, 0x33, 0xB3, 0x23, 0xC6, 0xD6, 0x8F, 0x4F, 0xA3, 0xF0,
+  0x13, 0xF0, 0x13, 0xAF, 0x4F, 0xA3, 0xF0, 0x13, 0xF0, 0x13, 0xF0, 0x13,
+  0xF0, 0x13, 0xF0, 0x13, 0x80, 0x0F, 0x0D, 0xAF, 0x0D, 0x56, 0x98, 0x7A,
+  0x54, 0x44, 0x43, 0x63, 0x43, 0x63, 0x43, 0x63, 0x44, 0xD4, 0xC6, 0x89,
+  0x63, 0x36, 0x43, 0x55, 0x32, 0x75, 0x22, 0x94, 0x13, 0x97, 0xA8, 0x83,
+  0x15, 0x73, 0x25, 0x63, 0x36, 0x33, 0x65, 0x13, 0x87, 0xB4, 0xD4, 0xD4,
+  0x33, 0x73, 0x33, 0x73, 0x33, 0x73, 0x34, 0x53, 0x53, 0x44, 0x5A, 0x78,
+  0xB3, 0x70, 0x04, 0x28, 0x28, 0x28, 0x24, 0xA7, 0xF0, 0x1C, 0xC5, 0x65,
+  0x94, 0xB3, 0x73, 0xE3, 0x62, 0x57, 0x43, 0x43, 0x3A, 0x42, 0x33, 0x43,
+  0x53, 0x33, 0x22, 0x43, 0x63, 0x42, 0x22, 0x42, 0x82, 0x42, 0x13, 0x33,
+  0xE6, 0x33, 0xF4, 0x43, 0xF5, 0x33, 0xF5, 0x33, 0xE3, 0x12, 0x42, 0x82,
+  0x42, 0x22, 0x43, 0x72, 0x42, 0x23, 0x33, 0x63, 0x33, 0x33, 0x35, 0x14,
+  0x42, 0x52, 0x48, 0x43, 0x54, 0x45, 0x43, 0x74, 0xA4, 0x95, 0x65, 0xCC,
+  0xF0, 0x27, 0x90, 0x35, 0x48, 0x32, 0x42, 0x32, 0x52, 0x83, 0x47, 0x25,
+  0x22, 0x13, 0x52, 0x12, 0x53, 0x13, 0x43, 0x2A, 0x24, 0x23, 0xC9, 0x29,
+  0x10, 0xF0, 0x22, 0x61, 0x33, 0x43, 0x24, 0x34, 0x13, 0x43, 0x23, 0x52,
+  0x33, 0x52, 0x34, 0x43, 0x34, 0x43, 0x43, 0x43, 0x42, 0x52, 0x51, 0x61,
+  0x0F, 0x0F, 0x06, 0xF0, 0x12, 0xF0, 0x12, 0xF0, 0x12, 0xF0, 0x12, 0xF0,
+  0x12, 0xF0, 0x12, 0xF0, 0x12, 0xF0, 0x12, 0x0F, 0x09, 0xA7, 0xF0, 0x1C,
+  0xC5, 0x65, 0x94, 0xB3, 0x73, 0xE3, 0x62, 0x2A, 0x43, 0x43, 0x2B, 0x42,
+  0x33, 0x33, 0x63, 0x33, 0x22, 0x43, 0x72, 0x42, 0x22, 0x43, 0x72, 0x42,
+  0x13, 0x43, 0x72, 0x46, 0x43, 0x62, 0x64, 0x5B, 0x65, 0x4B, 0x65, 0x43,
+  0x62, 0x53, 0x12, 0x43, 0x63, 0x42, 0x22, 0x43, 0x72, 0x42, 0x23, 0x33,
+  0x72, 0x33, 0x33, 0x23, 0x72, 0x32, 0x52, 0x23, 0x72, 0x23, 0x54, 0xD3,
+  0x74, 0xA4, 0x95, 0x65, 0xCC, 0xF0, 0x27, 0x90, 0x0F, 0x05, 0x35, 0x57,
+  0x33, 0x33, 0x22, 0x64, 0x74, 0x72, 0x12, 0x62, 0x13, 0x33, 0x37, 0x55,
+  0x30, 0x73, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0x7F, 0x0F, 0x04, 0x73,
+  0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xF0, 0xF0, 0xF0, 0xDF, 0x0F,
+  0x04, 0x34, 0x48, 0x22, 0x46, 0x54, 0x62, 0x82, 0x73, 0x63, 0x54, 0x44,
+  0x53, 0x63, 0x72, 0x8F, 0x05, 0x34, 0x48, 0x13, 0x42, 0x12, 0x55, 0x62,
+  0x82, 0x72, 0x54, 0x65, 0x83, 0x84, 0x64, 0x65, 0x43, 0x18, 0x35, 0x30,
+  0x34, 0x43, 0x43, 0x43, 0x52, 0x50, 0x03, 0x93, 0x23, 0x93, 0x23, 0x93,
+  0x23, 0x93, 0x23, 0x93, 0x23, 0x93, 0x23, 0x93, 0x23, 0x93, 0x23, 0x93,
+  0x23, 0x93, 0x23, 0x93, 0x23, 0x93, 0x23, 0x93, 0x23, 0x84, 0x24, 0x74,
+  0x24, 0x65, 0x2F, 0x01, 0x1B, 0x18, 0x15, 0x47, 0xE3, 0xE3, 0xE3, 0xE3,
+  0xE3, 0xE3, 0xE0, 0x5B, 0x3D, 0x27, 0x32, 0x38, 0x32, 0x38, 0x32, 0x29,
+  0x32, 0x29, 0x32, 0x29, 0x32, 0x29, 0x32, 0x29, 0x32, 0x29, 0x32, 0x29,
+  0x32, 0x38, 0x32, 0x38, 0x32, 0x47, 0x32, 0x56, 0x32, 0x83, 0x32, 0x92,
+  0x32, 0x92, 0x32, 0x92, 0x32, 0x92, 0x32, 0x92, 0x32, 0x92, 0x32, 0x92,
+  0x32, 0x92, 0x32, 0x92, 0x32, 0x92, 0x32, 0x92, 0x32, 0x92, 0x32, 0x92,
+  0x32, 0x92, 0x32, 0x92, 0x32, 0x20, 0x0F, 0x01, 0x51, 0x72, 0x74, 0x73,
+  0x63, 0x11, 0x43, 0x17, 0x10, 0x42, 0x42, 0x3F, 0x42, 0x42, 0x42, 0x42,
+  0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x35, 0x47, 0x23, 0x33, 0x12, 0x55,
+  0x54, 0x64, 0x65, 0x52, 0x12, 0x52, 0x13, 0x33, 0x27, 0x45, 0xD9, 0x19,
+  0x01, 0x61, 0x42, 0x52, 0x33, 0x43, 0x33, 0x44, 0x23, 0x43, 0x32, 0x52,
+  0x23, 0x43, 0x13, 0x43, 0x13, 0x43, 0x22, 0x52, 0x31, 0x61, 0x40, 0x42,
+  0xF0, 0xB2, 0xE2, 0x93, 0xE2, 0x66, 0xD2, 0x76, 0xC3, 0xB2, 0xC2, 0xC2,
+  0xB2, 0xD2, 0xB2, 0xD2, 0xA2, 0xE2, 0x92, 0xF2, 0x92, 0xF2, 0x82, 0x82,
+  0x62, 0x82, 0x73, 0x62, 0x72, 0x74, 0x62, 0x62, 0x75, 0x62, 0x62, 0x75,
+  0xD2, 0x72, 0x13, 0xC2, 0x72, 0x23, 0xC2, 0x63, 0x23, 0xB2, 0x72, 0x33,
+  0xB2, 0x62, 0x43, 0xA2, 0x7B, 0x72, 0x8B, 0x72, 0xE3, 0x82, 0xF3, 0x73,
+  0xF3, 0x72, 0xF0, 0x60, 0x42, 0xF0, 0xB2, 0xD3, 0x93, 0xD2, 0x76, 0xC2,
+  0x86, 0xC2, 0xC2, 0xB2, 0xD2, 0xA2, 0xE2, 0xA2, 0xE2, 0x92, 0xF2, 0x82,
+  0xF0, 0x12, 0x82, 0xF0, 0x12, 0x72, 0x55, 0x72, 0x63, 0x39, 0x52, 0x62,
+  0x43, 0x42, 0x52, 0x52, 0x43, 0x53, 0xB2, 0x43, 0x62, 0xA2, 0xD3, 0x92,
+  0xD3, 0xA2, 0xC3, 0xA2, 0xB4, 0xA2, 0xA4, 0xC2, 0x94, 0xC2, 0xA2, 0xD3,
+  0x93, 0xD2, 0xAB, 0x42, 0xBB, 0x35, 0xF0, 0x68, 0xC2, 0x62, 0x43, 0xB2,
+  0x53, 0x52, 0xA2, 0x62, 0x62, 0x92, 0xF2, 0x92, 0xB5, 0x92, 0xC5, 0x92,
+  0xF3, 0x72, 0xF0, 0x23, 0x52, 0xF0, 0x33, 0x52, 0xA2, 0x63, 0x42, 0x72,
+  0x22, 0x62, 0x42, 0x73, 0x32, 0x43, 0x42, 0x73, 0x38, 0x42, 0x74, 0x55,
+  0x52, 0x62, 0x12, 0xE2, 0x63, 0x12, 0xD2, 0x72, 0x22, 0xD2, 0x62, 0x32,
+  0xC2, 0x62, 0x42, 0xB3, 0x53, 0x42, 0xB2, 0x6B, 0x82, 0x7B, 0x82, 0xE2,
+  0x92, 0xF2, 0x82, 0xF0, 0x12, 0x82, 0xF0, 0x50, 0x73, 0xD3, 0xD3, 0xF0,
+  0xF0, 0xF0, 0xF0, 0xF0, 0x23, 0xD3, 0xC4, 0xC3, 0xC4, 0xB4, 0xB4, 0xB4,
+  0xB4, 0xC3, 0xC4, 0x97, 0x97, 0x83, 0x23, 0x83, 0x24, 0x73, 0x25, 0x44,
+  0x4C, 0x5A, 0xA3, 0x60, 0x65, 0xF0, 0x43, 0xF0, 0x53, 0xF0, 0x53, 0xF0,
+  0xF0, 0xF0, 0xF0, 0x24, 0xF0, 0x25, 0xF0, 0x26, 0xF7, 0xF3, 0x13, 0xF3,
+  0x14, 0xD4, 0x23, 0xD3, 0x34, 0xC3, 0x34, 0xB4, 0x43, 0xB3, 0x54, 0xA3,
+  0x54, 0x94, 0x63, 0x93, 0x74, 0x83, 0x74, 0x7F, 0x7F, 0x01, 0x6F, 0x01,
+  0x54, 0xA3, 0x53, 0xB4, 0x34, 0xB4, 0x34, 0xC3, 0x33, 0xD4, 0x14, 0xD4,
+  0x14, 0xE3, 0x13, 0xF4, 0xC4, 0xF0, 0x24, 0xF0, 0x23, 0xF0, 0x33, 0xF0,
+  0xF0, 0xF0, 0xF0, 0x34, 0xF0, 0x25, 0xF0, 0x26, 0xF7, 0xF3, 0x13, 0xF3,
+  0x14, 0xD4, 0x23, 0xD3, 0x34, 0xC3, 0x34, 0xB4, 0x43, 0xB3, 0x54, 0xA3,
+  0x54, 0x94, 0x63, 0x93, 0x74, 0x83, 0x74, 0x7F, 0x7F, 0x01, 0x6F, 0x01,
+  0x54, 0xA3, 0x53, 0xB4, 0x34, 0xB4, 0x34, 0xC3, 0x33, 0xD4, 0x14, 0xD4,
+  0x14, 0xE3, 0x13, 0xF4, 0x94, 0xF0, 0x26, 0xF3, 0x13, 0xE3, 0x33, 0xF0,
+  0xF0, 0xF0, 0xF4, 0xF0, 0x25, 0xF0, 0x26, 0xF7, 0xF3, 0x13, 0xF3, 0x14,
+  0xD4, 0x23, 0xD3, 0x34, 0xC3, 0x34, 0xB4, 0x43, 0xB3, 0x54, 0xA3, 0x54,
+  0x94, 0x63, 0x93, 0x74, 0x83, 0x74, 0x7F, 0x7F, 0x01, 0x6F, 0x01, 0x54,
+  0xA3, 0x53, 0xB4, 0x34, 0xB4, 0x34, 0xC3, 0x33, 0xD4, 0x14, 0xD4, 0x14,
+  0xE3, 0x13, 0xF4, 0x81, 0xF0, 0x55, 0x13, 0xCA, 0xB3, 0x34, 0xF0, 0xF0,
+  0xF0, 0xF4, 0xF0, 0x25, 0xF0, 0x26, 0xF7, 0xF3, 0x13, 0xF3, 0x14, 0xD4,
+  0x23, 0xD3, 0x34, 0xC3, 0x34, 0xB4, 0x43, 0xB3, 0x54, 0xA3, 0x54, 0x94,
+  0x63, 0x93, 0x74, 0x83, 0x74, 0x7F, 0x7F, 0x01, 0x6F, 0x01, 0x54, 0xA3,
+  0x53, 0xB4, 0x34, 0xB4, 0x34, 0xC3, 0x33, 0xD4, 0x14, 0xD4, 0x14, 0xE3,
+  0x13, 0xF4, 0x64, 0x24, 0xC4, 0x24, 0xC4, 0x24, 0xC4, 0x24, 0xF0, 0xF0,
+  0x74, 0xF0, 0x25, 0xF0, 0x26, 0xF7, 0xF3, 0x13, 0xF3, 0x14, 0xD4, 0x23,
+  0xD3, 0x34, 0xC3, 0x34, 0xB4, 0x43, 0xB3, 0x54, 0xA3, 0x54, 0x94, 0x63,
+  0x93, 0x74, 0x83, 0x74, 0x7F, 0x7F, 0x01, 0x6F, 0x01, 0x54, 0xA3, 0x53,
+  0xB4, 0x34, 0xB4, 0x34, 0xC3, 0x33, 0xD4, 0x14, 0xD4, 0x14, 0xE3, 0x13,
+  0xF4, 0x94, 0xF0, 0x26, 0xF3, 0x22, 0xF2, 0x33, 0xE3, 0x22, 0xF0, 0x16,
+  0xF0, 0x24, 0xF0, 0xF0, 0xA4, 0xF0, 0x25, 0xF0, 0x26, 0xF7, 0xF3, 0x13,
+  0xF3, 0x14, 0xD4, 0x23, 0xD3, 0x34, 0xC3, 0x34, 0xB4, 0x43, 0xB3, 0x54,
+  0xA3, 0x54, 0x94, 0x63, 0x93, 0x74, 0x83, 0x74, 0x7F, 0x7F, 0x01, 0x6F,
+  0x01, 0x54, 0xA3, 0x53, 0xB4, 0x34, 0xB4, 0x34, 0xC3, 0x33, 0xD4, 0x14,
+  0xD4, 0x14, 0xE3, 0x13, 0xF4, 0xAF, 0x07, 0xAF, 0x08, 0xAF, 0x08, 0xA3,
+  0x43, 0xF0, 0x73, 0x53, 0xF0, 0x73, 0x53, 0xF0, 0x64, 0x53, 0xF0, 0x63,
+  0x63, 0xF0, 0x63, 0x63, 0xF0, 0x53, 0x73, 0xF0, 0x53, 0x73, 0xF0, 0x44,
+  0x7F, 0x73, 0x8F, 0x73, 0x8F, 0x63, 0x93, 0xF0, 0x3F, 0xF0, 0x2F, 0x01,
+  0xF0, 0x2F, 0x01, 0xF0, 0x23, 0xA3, 0xF0, 0x14, 0xA3, 0xF0, 0x13, 0xB3,
+  0xF4, 0xB3, 0xF3, 0xC3, 0xF3, 0xCF, 0x06, 0xCF, 0x05, 0xDF, 0x02, 0x88,
+  0xDC, 0xAE, 0x85, 0x65, 0x64, 0xA4, 0x44, 0xC3, 0x43, 0xD4, 0x24, 0xE3,
+  0x23, 0xF0, 0x53, 0xF0, 0x53, 0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x44, 0xF0,
+  0x44, 0xF0, 0x53, 0xF0, 0x53, 0xF4, 0x13, 0xF3, 0x24, 0xE3, 0x33, 0xD4,
+  0x34, 0xC3, 0x54, 0xA4, 0x65, 0x65, 0x8E, 0xAC, 0xD8, 0xF0, 0x22, 0xF0,
+  0x64, 0xF0, 0x63, 0xF0, 0x62, 0xF1, 0x52, 0xF8, 0xF0, 0x16, 0x90, 0x54,
+  0xF4, 0xF4, 0xF0, 0x12, 0xF0, 0x31, 0xF0, 0x9F, 0x0F, 0x0F, 0x0C, 0xF3,
+  0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xFF, 0x02, 0x1F, 0x02, 0x1F, 0x02,
+  0x13, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xFF, 0x0F, 0x0F,
+  0x09, 0x94, 0xD4, 0xD3, 0xE3, 0xF0, 0xF0, 0xFF, 0x0F, 0x0F, 0x0C, 0xF3,
+  0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xFF, 0x02, 0x1F, 0x02, 0x1F, 0x02,
+  0x13, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xFF, 0x0F, 0x0F,
+  0x09, 0x74, 0xD6, 0xB3, 0x13, 0xA3, 0x33, 0xF0, 0xF0, 0xBF, 0x0F, 0x0F,
+  0x0C, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xFF, 0x02, 0x1F, 0x02,
+  0x1F, 0x02, 0x13, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xFF,
+  0x0F, 0x0F, 0x09, 0x44, 0x24, 0x84, 0x24, 0x84, 0x24, 0x84, 0x24, 0xF0,
+  0xF0, 0xAF, 0x0F, 0x0F, 0x0C, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3,
+  0xFF, 0x02, 0x1F, 0x02, 0x1F, 0x02, 0x13, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3,
+  0xF3, 0xF3, 0xF3, 0xFF, 0x0F, 0x0F, 0x09, 0x14, 0x54, 0x53, 0x72, 0x81,
+  0xC3, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
+  0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
+  0x53, 0x53, 0x10, 0x34, 0x34, 0x34, 0x33, 0xF0, 0x83, 0x53, 0x53, 0x53,
+  0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
+  0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x30, 0x34,
+  0x65, 0x43, 0x13, 0x23, 0x33, 0xF0, 0x93, 0x73, 0x73, 0x73, 0x73, 0x73,
+  0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73,
+  0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x30, 0x04, 0x37, 0x37,
+  0x37, 0x33, 0xF0, 0x93, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73,
+  0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73,
+  0x73, 0x73, 0x73, 0x73, 0x73, 0x30, 0x2D, 0xAF, 0x01, 0x7F, 0x02, 0x63,
+  0xA5, 0x53, 0xB4, 0x53, 0xC4, 0x43, 0xD3, 0x43, 0xD4, 0x33, 0xE3, 0x33,
+  0xE3, 0x33, 0xE3, 0x33, 0xE3, 0x1B, 0x83, 0x1B, 0x83, 0x33, 0xE3, 0x33,
+  0xE3, 0x33, 0xE3, 0x33, 0xE3, 0x33, 0xD4, 0x33, 0xD3, 0x43, 0xC4, 0x43,
+  0xB4, 0x53, 0xA5, 0x5F, 0x02, 0x6F, 0x01, 0x7E, 0x70, 0x62, 0x52, 0xA6,
+  0x13, 0x93, 0x16, 0xA2, 0x43, 0xF0, 0xC4, 0xD7, 0xD8, 0xC9, 0xB9, 0xBA,
+  0xA6, 0x13, 0xA6, 0x23, 0x96, 0x24, 0x86, 0x33, 0x86, 0x34, 0x76, 0x44,
+  0x66, 0x53, 0x66, 0x54, 0x56, 0x64, 0x46, 0x73, 0x46, 0x74, 0x36, 0x83,
+  0x36, 0x84, 0x26, 0x94, 0x16, 0xA3, 0x16, 0xAA, 0xB9, 0xC8, 0xC8, 0xD4,
+  0x85, 0xF0, 0x74, 0xF0, 0x73, 0xF0, 0x92, 0xF0, 0xF0, 0xE8, 0xFC, 0xBF,
+  0x01, 0x85, 0x76, 0x65, 0xA5, 0x44, 0xD4, 0x44, 0xE4, 0x24, 0xF0, 0x13,
+  0x23, 0xF0, 0x24, 0x13, 0xF0, 0x24, 0x13, 0xF0, 0x37, 0xF0, 0x37, 0xF0,
+  0x37, 0xF0, 0x37, 0xF0, 0x33, 0x13, 0xF0, 0x33, 0x13, 0xF0, 0x24, 0x14,
+  0xF0, 0x14, 0x14, 0xF0, 0x13, 0x34, 0xE4, 0x34, 0xD4, 0x54, 0xB5, 0x65,
+  0x76, 0x8F, 0x01, 0xBC, 0xF8, 0x80, 0xD5, 0xF0, 0x44, 0xF0, 0x54, 0xF0,
+  0x62, 0xF0, 0xF0, 0xF0, 0x18, 0xFC, 0xBF, 0x01, 0x85, 0x76, 0x65, 0xA5,
+  0x44, 0xD4, 0x44, 0xE4, 0x24, 0xF0, 0x13, 0x23, 0xF0, 0x24, 0x13, 0xF0,
+  0x24, 0x13, 0xF0, 0x37, 0xF0, 0x37, 0xF0, 0x37, 0xF0, 0x37, 0xF0, 0x33,
+  0x13, 0xF0, 0x33, 0x13, 0xF0, 0x24, 0x14, 0xF0, 0x14, 0x14, 0xF0, 0x13,
+  0x34, 0xE4, 0x34, 0xD4, 0x54, 0xB5, 0x65, 0x76, 0x8F, 0x01, 0xBC, 0xF8,
+  0x80, 0xA5, 0xF0, 0x56, 0xF0, 0x33, 0x23, 0xF0, 0x13, 0x43, 0xF0, 0xF0,
+  0xB8, 0xFC, 0xBF, 0x01, 0x85, 0x76, 0x65, 0xA5, 0x44, 0xD4, 0x44, 0xE4,
+  0x24, 0xF0, 0x13, 0x23, 0xF0, 0x24, 0x13, 0xF0, 0x24, 0x13, 0xF0, 0x37,
+  0xF0, 0x37, 0xF0, 0x37, 0xF0, 0x37, 0xF0, 0x33, 0x13, 0xF0, 0x33, 0x13,
+  0xF0, 0x24, 0x14, 0xF0, 0x14, 0x14, 0xF0, 0x13, 0x34, 0xE4, 0x34, 0xD4,
+  0x54, 0xB5, 0x65, 0x76, 0x8F, 0x01, 0xBC, 0xF8, 0x80, 0x92, 0x52, 0xF6,
+  0x13, 0xE3, 0x16, 0xF2, 0x43, 0xF0, 0xF0, 0xD8, 0xFC, 0xBF, 0x01, 0x85,
+  0x76, 0x65, 0xA5, 0x44, 0xD4, 0x44, 0xE4, 0x24, 0xF0, 0x13, 0x23, 0xF0,
+  0x24, 0x13, 0xF0, 0x24, 0x13, 0xF0, 0x37, 0xF0, 0x37, 0xF0, 0x37, 0xF0,
+  0x37, 0xF0, 0x33, 0x13, 0xF0, 0x33, 0x13, 0xF0, 0x24, 0x14, 0xF0, 0x14,
+  0x14, 0xF0, 0x13, 0x34, 0xE4, 0x34, 0xD4, 0x54, 0xB5, 0x65, 0x76, 0x8F,
+  0x01, 0xBC, 0xF8, 0x80, 0x84, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24,
+  0xF0, 0xF0, 0xB8, 0xFC, 0xBF, 0x01, 0x85, 0x76, 0x65, 0xA5, 0x44, 0xD4,
+  0x44, 0xE4, 0x24, 0xF0, 0x13, 0x23, 0xF0, 0x24, 0x13, 0xF0, 0x24, 0x13,
+  0xF0, 0x37, 0xF0, 0x37, 0xF0, 0x37, 0xF0, 0x37, 0xF0, 0x33, 0x13, 0xF0,
+  0x33, 0x13, 0xF0, 0x24, 0x14, 0xF0, 0x14, 0x14, 0xF0, 0x13, 0x34, 0xE4,
+  0x34, 0xD4, 0x54, 0xB5, 0x65, 0x76, 0x8F, 0x01, 0xBC, 0xF8, 0x80, 0x21,
+  0x91, 0x23, 0x73, 0x14, 0x53, 0x34, 0x33, 0x54, 0x13, 0x76, 0x94, 0xA5,
+  0x87, 0x63, 0x24, 0x43, 0x44, 0x23, 0x64, 0x12, 0x83, 0xC1, 0x10, 0x98,
+  0x62, 0x7C, 0x33, 0x5F, 0x13, 0x55, 0x77, 0x55, 0xA5, 0x44, 0xC5, 0x44,
+  0xB7, 0x24, 0xB3, 0x23, 0x23, 0xC2, 0x34, 0x13, 0xB2, 0x44, 0x13, 0xA2,
+  0x67, 0x92, 0x77, 0x82, 0x87, 0x72, 0x97, 0x62, 0xA3, 0x13, 0x52, 0xB3,
+  0x13, 0x42, 0xB4, 0x14, 0x22, 0xC4, 0x14, 0x12, 0xD3, 0x36, 0xC4, 0x35,
+  0xC4, 0x54, 0xB5, 0x47, 0x76, 0x43, 0x1F, 0x01, 0x43, 0x4C, 0x71, 0x78,
+  0x80, 0x55, 0xF0, 0x23, 0xF0, 0x33, 0xF0, 0x33, 0xF0, 0xF0, 0xF0, 0x33,
+  0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7,
+  0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD3, 0x14, 0xB4, 0x24, 0xA4,
+  0x25, 0x75, 0x4F, 0x7C, 0xA8, 0x60, 0xA4, 0xF4, 0xF4, 0xF0, 0x12, 0xF0,
+  0x21, 0xF0, 0xF0, 0x23, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7,
+  0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD3,
+  0x14, 0xB4, 0x24, 0xA4, 0x25, 0x75, 0x4F, 0x7C, 0xA8, 0x60, 0x84, 0xF6,
+  0xD3, 0x13, 0xC3, 0x33, 0xF0, 0xF0, 0xF0, 0x13, 0xD7, 0xD7, 0xD7, 0xD7,
+  0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7,
+  0xD7, 0xD7, 0xD7, 0xD3, 0x14, 0xB4, 0x24, 0xA4, 0x25, 0x75, 0x4F, 0x7C,
+  0xA8, 0x60, 0x54, 0x24, 0xA4, 0x24, 0xA4, 0x24, 0xA4, 0x24, 0xF0, 0xF0,
+  0xF3, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7,
+  0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD3, 0x14, 0xB4, 0x24,
+  0xA4, 0x25, 0x75, 0x4F, 0x7C, 0xA8, 0x60, 0xB5, 0xF0, 0x23, 0xF0, 0x33,
+  0xF0, 0x33, 0xF0, 0xF0, 0xF0, 0x94, 0xE8, 0xE3, 0x24, 0xC4, 0x34, 0xA4,
+  0x44, 0xA4, 0x54, 0x84, 0x73, 0x83, 0x84, 0x64, 0x94, 0x53, 0xA4, 0x44,
+  0xB4, 0x24, 0xD3, 0x23, 0xE8, 0xF6, 0xF0, 0x25, 0xF0, 0x24, 0xF0, 0x34,
+  0xF0, 0x34, 0xF0, 0x34, 0xF0, 0x34, 0xF0, 0x34, 0xF0, 0x34, 0xF0, 0x34,
+  0xF0, 0x34, 0xF0, 0x34, 0xF0, 0x34, 0x90, 0x03, 0xF3, 0xF3, 0xF3, 0xFD,
+  0x5F, 0x3F, 0x02, 0x13, 0x95, 0x13, 0xB7, 0xB7, 0xC6, 0xC6, 0xC6, 0xB7,
+  0xB7, 0xA4, 0x1F, 0x02, 0x1F, 0x01, 0x2E, 0x43, 0xF3, 0xF3, 0xF3, 0xF3,
+  0xF3, 0xF3, 0xF0, 0x63, 0xB9, 0x7C, 0x44, 0x54, 0x34, 0x74, 0x23, 0x93,
+  0x23, 0x93, 0x23, 0x93, 0x23, 0x93, 0x23, 0x84, 0x23, 0x74, 0x33, 0x46,
+  0x43, 0x47, 0x33, 0x48, 0x23, 0x85, 0x13, 0x94, 0x13, 0xA3, 0x13, 0xA7,
+  0xA3, 0x13, 0xA3, 0x13, 0xA3, 0x13, 0xA3, 0x13, 0x94, 0x13, 0x84, 0x23,
+  0x38, 0x33, 0x37, 0x43, 0x35, 0x60, 0x44, 0xE4, 0xE3, 0xF3, 0xF2, 0xF0,
+  0xF0, 0xF0, 0x17, 0x8B, 0x5D, 0x34, 0x64, 0x33, 0x83, 0x33, 0x83, 0xE3,
+  0xD4, 0x7A, 0x4D, 0x36, 0x53, 0x24, 0x83, 0x23, 0x93, 0x23, 0x93, 0x23,
+  0x84, 0x24, 0x65, 0x3F, 0x01, 0x29, 0x24, 0x36, 0x53, 0x93, 0xD3, 0xD3,
+  0xE2, 0xE2, 0xF0, 0xF0, 0xF0, 0x37, 0x8B, 0x5D, 0x34, 0x64, 0x33, 0x83,
+  0x33, 0x83, 0xE3, 0xD4, 0x7A, 0x4D, 0x36, 0x53, 0x24, 0x83, 0x23, 0x93,
+  0x23, 0x93, 0x23, 0x84, 0x24, 0x65, 0x3F, 0x01, 0x29, 0x24, 0x36, 0x53,
+  0x74, 0xC6, 0xA3, 0x13, 0xA2, 0x33, 0x82, 0x52, 0xF0, 0xB7, 0x8B, 0x5D,
+  0x34, 0x64, 0x33, 0x83, 0x33, 0x83, 0xE3, 0xD4, 0x7A, 0x4D, 0x36, 0x53,
+  0x24, 0x83, 0x23, 0x93, 0x23, 0x93, 0x23, 0x84, 0x24, 0x65, 0x3F, 0x01,
+  0x29, 0x24, 0x36, 0x53, 0x54, 0x32, 0x7A, 0x63, 0x25, 0x72, 0xF0, 0xF0,
+  0xF0, 0x67, 0x8B, 0x5D, 0x34, 0x64, 0x33, 0x83, 0x33, 0x83, 0xE3, 0xD4,
+  0x7A, 0x4D, 0x36, 0x53, 0x24, 0x83, 0x23, 0x93, 0x23, 0x93, 0x23, 0x84,
+  0x24, 0x65, 0x3F, 0x01, 0x29, 0x24, 0x36, 0x53, 0x43, 0x34, 0x73, 0x34,
+  0x73, 0x34, 0x73, 0x34, 0xF0, 0xF0, 0xF0, 0xE7, 0x8B, 0x5D, 0x34, 0x64,
+  0x33, 0x83, 0x33, 0x83, 0xE3, 0xD4, 0x7A, 0x4D, 0x36, 0x53, 0x24, 0x83,
+  0x23, 0x93, 0x23, 0x93, 0x23, 0x84, 0x24, 0x65, 0x3F, 0x01, 0x29, 0x24,
+  0x36, 0x53, 0x74, 0xC6, 0xA3, 0x22, 0xA2, 0x32, 0xA3, 0x22, 0xB6, 0xB5,
+  0xF0, 0xD7, 0x8B, 0x5D, 0x34, 0x64, 0x33, 0x83, 0x33, 0x83, 0xE3, 0xD4,
+  0x7A, 0x4D, 0x36, 0x53, 0x24, 0x83, 0x23, 0x93, 0x23, 0x93, 0x23, 0x84,
+  0x24, 0x65, 0x3F, 0x01, 0x29, 0x24, 0x36, 0x53, 0x56, 0x75, 0x9A, 0x39,
+  0x6C, 0x1B, 0x44, 0x67, 0x54, 0x33, 0x84, 0x84, 0x23, 0x84, 0x93, 0xD3,
+  0xA3, 0xC4, 0xA4, 0x5F, 0x09, 0x2F, 0x0C, 0x17, 0x43, 0xE4, 0x83, 0xE3,
+  0x93, 0xE3, 0x94, 0x93, 0x13, 0x85, 0x84, 0x14, 0x63, 0x13, 0x64, 0x3B,
+  0x2D, 0x49, 0x4A, 0x76, 0x87, 0x50, 0x56, 0x8A, 0x5C, 0x44, 0x54, 0x24,
+  0x73, 0x23, 0x83, 0x14, 0x96, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xA3, 0x13,
+  0x84, 0x13, 0x83, 0x33, 0x64, 0x3C, 0x5A, 0x86, 0xC1, 0xE5, 0xB1, 0x13,
+  0xE3, 0x71, 0x52, 0x88, 0x96, 0x60, 0x44, 0xE4, 0xE3, 0xF3, 0xF3, 0xF0,
+  0xF0, 0xF7, 0x99, 0x6C, 0x54, 0x54, 0x34, 0x74, 0x23, 0x93, 0x13, 0xA3,
+  0x13, 0xBF, 0x0F, 0x0A, 0xE3, 0xE3, 0xF3, 0x93, 0x23, 0x84, 0x34, 0x54,
+  0x4D, 0x5B, 0x87, 0x50, 0x94, 0xC4, 0xD3, 0xD3, 0xD3, 0xF0, 0xF0, 0xF0,
+  0x27, 0x99, 0x6C, 0x54, 0x54, 0x34, 0x74, 0x23, 0x93, 0x13, 0xA3, 0x13,
+  0xBF, 0x0F, 0x0A, 0xE3, 0xE3, 0xF3, 0x93, 0x23, 0x84, 0x34, 0x54, 0x4D,
+  0x5B, 0x87, 0x50, 0x74, 0xC6, 0xA3, 0x13, 0xA2, 0x33, 0x82, 0x52, 0xF0,
+  0xB7, 0x99, 0x6C, 0x54, 0x54, 0x34, 0x74, 0x23, 0x93, 0x13, 0xA3, 0x13,
+  0xBF, 0x0F, 0x0A, 0xE3, 0xE3, 0xF3, 0x93, 0x23, 0x84, 0x34, 0x54, 0x4D,
+  0x5B, 0x87, 0x50, 0x43, 0x34, 0x73, 0x34, 0x73, 0x34, 0x73, 0x34, 0xF0,
+  0xF0, 0xF0, 0xE7, 0x99, 0x6C, 0x54, 0x54, 0x34, 0x74, 0x23, 0x93, 0x13,
+  0xA3, 0x13, 0xBF, 0x0F, 0x0A, 0xE3, 0xE3, 0xF3, 0x93, 0x23, 0x84, 0x34,
+  0x54, 0x4D, 0x5B, 0x87, 0x50, 0x04, 0x44, 0x44, 0x52, 0x62, 0xF0, 0x13,
+  0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+  0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x20, 0x34, 0x43, 0x43, 0x52, 0x52,
+  0xF0, 0x83, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
+  0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x30, 0x25, 0x55, 0x43,
+  0x13, 0x32, 0x33, 0x12, 0x52, 0xF0, 0x93, 0x73, 0x73, 0x73, 0x73, 0x73,
+  0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73,
+  0x73, 0x40, 0x03, 0x37, 0x37, 0x37, 0x34, 0xF0, 0xF0, 0x33, 0x73, 0x73,
+  0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73,
+  0x73, 0x73, 0x73, 0x73, 0x40, 0x32, 0xE5, 0x14, 0x96, 0xB6, 0x94, 0x14,
+  0x91, 0x44, 0xE4, 0x99, 0x6B, 0x5D, 0x35, 0x54, 0x34, 0x74, 0x23, 0x93,
+  0x14, 0x93, 0x13, 0xA7, 0xB6, 0xB6, 0xB6, 0xA8, 0x93, 0x23, 0x93, 0x24,
+  0x74, 0x25, 0x54, 0x4D, 0x5A, 0x96, 0x60, 0x44, 0x32, 0x5A, 0x43, 0x25,
+  0x52, 0xF0, 0xF0, 0xB3, 0x27, 0x33, 0x19, 0x2E, 0x15, 0x68, 0x78, 0x86,
+  0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
+  0x93, 0x44, 0xE4, 0xE3, 0xF3, 0xF3, 0xF0, 0xF0, 0xF6, 0x9A, 0x6C, 0x54,
+  0x54, 0x34, 0x74, 0x23, 0x93, 0x14, 0x93, 0x13, 0xA7, 0xB6, 0xB6, 0xB6,
+  0xA8, 0x93, 0x23, 0x93, 0x24, 0x74, 0x34, 0x54, 0x4D, 0x5A, 0x96, 0x60,
+  0x94, 0xC4, 0xC4, 0xD3, 0xD3, 0xF0, 0xF0, 0xF0, 0x26, 0x9A, 0x6C, 0x54,
+  0x54, 0x34, 0x74, 0x23, 0x93, 0x14, 0x93, 0x13, 0xA7, 0xB6, 0xB6, 0xB6,
+  0xA8, 0x93, 0x23, 0x93, 0x24, 0x74, 0x34, 0x54, 0x4D, 0x5A, 0x96, 0x60,
+  0x64, 0xD5, 0xB3, 0x13, 0x93, 0x32, 0x92, 0x43, 0xF0, 0xF0, 0xD6, 0x9A,
+  0x6C, 0x54, 0x54, 0x34, 0x74, 0x23, 0x93, 0x14, 0x93, 0x13, 0xA7, 0xB6,
+  0xB6, 0xB6, 0xA8, 0x93, 0x23, 0x93, 0x24, 0x74, 0x34, 0x54, 0x4D, 0x5A,
+  0x96, 0x60, 0x54, 0x32, 0x7A, 0x63, 0x25, 0x72, 0xF0, 0xF0, 0xF0, 0x66,
+  0x9A, 0x6C, 0x54, 0x54, 0x34, 0x74, 0x23, 0x93, 0x14, 0x93, 0x13, 0xA7,
+  0xB6, 0xB6, 0xB6, 0xA8, 0x93, 0x23, 0x93, 0x24, 0x74, 0x34, 0x54, 0x4D,
+  0x5A, 0x96, 0x60, 0x34, 0x33, 0x74, 0x33, 0x74, 0x33, 0x74, 0x33, 0xF0,
+  0xF0, 0xF0, 0xF6, 0x9A, 0x6C, 0x54, 0x54, 0x34, 0x74, 0x23, 0x93, 0x14,
+  0x93, 0x13, 0xA7, 0xB6, 0xB6, 0xB6, 0xA8, 0x93, 0x23, 0x93, 0x24, 0x74,
+  0x34, 0x54, 0x4D, 0x5A, 0x96, 0x60, 0x64, 0xD4, 0xD4, 0xD4, 0xF0, 0xF0,
+  0xF0, 0xF0, 0xFF, 0x0F, 0x04, 0xF0, 0xF0, 0xF0, 0xC4, 0xD4, 0xD4, 0xD4,
+  0x70, 0x66, 0x51, 0x4A, 0x22, 0x3E, 0x35, 0x54, 0x44, 0x74, 0x33, 0x75,
+  0x23, 0x72, 0x13, 0x23, 0x62, 0x24, 0x13, 0x52, 0x43, 0x13, 0x42, 0x53,
+  0x13, 0x42, 0x44, 0x13, 0x32, 0x54, 0x13, 0x22, 0x63, 0x35, 0x73, 0x34,
+  0x74, 0x44, 0x54, 0x4D, 0x42, 0x1A, 0x51, 0x47, 0x50, 0x34, 0xC3, 0xD3,
+  0xD3, 0xD2, 0xF0, 0xF0, 0x63, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
+  0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x87, 0x88, 0x65, 0x1E, 0x29, 0x13,
+  0x37, 0x23, 0xF0, 0x84, 0xB3, 0xB3, 0xB3, 0xC2, 0xF0, 0xF0, 0x73, 0x96,
+  0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
+  0x87, 0x88, 0x65, 0x1E, 0x29, 0x13, 0x37, 0x23, 0xF0, 0x54, 0xB5, 0x93,
+  0x13, 0x82, 0x32, 0x72, 0x52, 0xF0, 0xF0, 0x33, 0x96, 0x96, 0x96, 0x96,
+  0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x87, 0x88, 0x65,
+  0x1E, 0x29, 0x13, 0x37, 0x23, 0xF0, 0x33, 0x34, 0x53, 0x34, 0x53, 0x34,
+  0x53, 0x34, 0xF0, 0xF0, 0xF0, 0x23, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
+  0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x87, 0x88, 0x65, 0x1E, 0x29,
+  0x13, 0x37, 0x23, 0xF0, 0x94, 0xC3, 0xC3, 0xC3, 0xD2, 0xF0, 0xF0, 0x94,
+  0x93, 0x13, 0x93, 0x13, 0x84, 0x14, 0x73, 0x33, 0x73, 0x33, 0x64, 0x34,
+  0x53, 0x53, 0x53, 0x53, 0x43, 0x64, 0x33, 0x73, 0x33, 0x73, 0x23, 0x83,
+  0x23, 0x93, 0x13, 0x96, 0xA6, 0xB5, 0xB4, 0xC4, 0xC4, 0xC3, 0xD3, 0xC3,
+  0xD3, 0xA6, 0xA5, 0xB3, 0xB0, 0x03, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3,
+  0x35, 0x63, 0x19, 0x4E, 0x36, 0x54, 0x25, 0x74, 0x14, 0x93, 0x13, 0xA3,
+  0x13, 0xA3, 0x13, 0xA7, 0xB6, 0xA7, 0xA3, 0x13, 0xA3, 0x14, 0x93, 0x15,
+  0x74, 0x16, 0x54, 0x2E, 0x33, 0x19, 0x43, 0x36, 0x53, 0xE3, 0xE3, 0xE3,
+  0xE3, 0xE3, 0xE3, 0xE0, 0x44, 0x24, 0x64, 0x24, 0x64, 0x24, 0x64, 0x24,
+  0xF0, 0xF0, 0xF0, 0x54, 0x93, 0x13, 0x93, 0x13, 0x84, 0x14, 0x73, 0x33,
+  0x73, 0x33, 0x64, 0x34, 0x53, 0x53, 0x53, 0x53, 0x43, 0x64, 0x33, 0x73,
+  0x33, 0x73, 0x23, 0x83, 0x23, 0x93, 0x13, 0x96, 0xA6, 0xB5, 0xB4, 0xC4,
+  0xC4, 0xC3, 0xD3, 0xC3, 0xD3, 0xA6, 0xA5, 0xB3, 0xB0 };
+
+constexpr GFXglyph FreeSans_RLE_18pt8bGlyphs[] PROGMEM = {
+  {     0,   1,   1,   9,    0,    0 },   // 0x20 ' '
+  {     1,   3,  26,  12,    4,  -25 },   // 0x21 '!'
+  {    12,   9,   9,  12,    1,  -24 },   // 0x22 '"'
+  {    28,  19,  24,  20,    0,  -23 },   // 0x23 '#'
+  {    77,  17,  32,  20,    1,  -27 },   // 0x24 '$'
+  {   133,  29,  25,  31,    1,  -24 },   // 0x25 '%'
+  {   199,  20,  25,  24,    2,  -24 },   // 0x26 '&'
+  {   247,   3,   9,   7,    2,  -24 },   // 0x27 '''
+  {   252,   7,  33,  12,    3,  -25 },   // 0x28 '('
+  {   285,   8,  33,  12,    1,  -25 },   // 0x29 ')'
+  {   319,  11,  10,  14,    1,  -25 },   // 0x2A '*'
+  {   334,  17,  17,  21,    2,  -16 },   // 0x2B '+'
+  {   353,   4,   9,  10,    3,   -3 },   // 0x2C ','
+  {   361,   8,   3,  12,    2,  -10 },   // 0x2D '-'
+  {   363,   3,   4,   9,    3,   -3 },   // 0x2E '.'
+  {   364,  10,  26,  10,    0,  -25 },   // 0x2F '/'
+  {   391,  16,  25,  20,    2,  -24 },   // 0x30 '0'
+  {   427,   8,  25,  20,    4,  -24 },   // 0x31 '1'
+  {   451,  17,  25,  20,    1,  -24 },   // 0x32 '2'
+  {   483,  17,  25,  20,    1,  -24 },   // 0x33 '3'
+  {   516,  17,  25,  20,    1,  -24 },   // 0x34 '4'
+  {   554,  17,  25,  20,    1,  -24 },   // 0x35 '5'
+  {   586,  16,  25,  20,    2,  -24 },   // 0x36 '6'
+  {   622,  16,  25,  20,    2,  -24 },   // 0x37 '7'
+  {   649,  17,  25,  20,    1,  -24 },   // 0x38 '8'
+  {   688,  17,  25,  20,    1,  -24 },   // 0x39 '9'
+  {   728,   3,  19,   9,    3,  -18 },   // 0x3A ':'
+  {   732,   4,  24,   9,    3,  -18 },   // 0x3B ';'
+  {   744,  17,  17,  21,    2,  -16 },   // 0x3C '<'
+  {   763,  17,   8,  21,    2,  -11 },   // 0x3D '='
+  {   773,  17,  17,  21,    2,  -16 },   // 0x3E '>'
+  {   793,  15,  26,  20,    3,  -25 },   // 0x3F '?'
+  {   822,  33,  31,  36,    1,  -25 },   // 0x40 '@'
+  {   918,  22,  26,  23,    1,  -25 },   // 0x41 'A'
+  {   967,  19,  26,  23,    3,  -25 },   // 0x42 'B'
+  {  1010,  23,  26,  25,    1,  -25 },   // 0x43 'C'
+  {  1057,  20,  26,  25,    3,  -25 },   // 0x44 'D'
+  {  1096,  18,  26,  22,    3,  -25 },   // 0x45 'E'
+  {  1126,  17,  26,  21,    3,  -25 },   // 0x46 'F'
+  {  1153,  24,  27,  27,    1,  -25 },   // 0x47 'G'
+  {  1205,  20,  26,  25,    3,  -25 },   // 0x48 'H'
+  {  1233,   3,  26,  10,    4,  -25 },   // 0x49 'I'
+  {  1239,  15,  26,  19,    1,  -25 },   // 0x4A 'J'
+  {  1268,  20,  26,  24,    3,  -25 },   // 0x4B 'K'
+  {  1319,  16,  26,  20,    3,  -25 },   // 0x4C 'L'
+  {  1346,  24,  26,  30,    3,  -25 },   // 0x4D 'M'
+  {  1409,  20,  26,  26,    3,  -25 },   // 0x4E 'N'
+  {  1451,  25,  26,  28,    1,  -25 },   // 0x4F 'O'
+  {  1508,  18,  26,  23,    3,  -25 },   // 0x50 'P'
+  {  1541,  25,  27,  28,    1,  -25 },   // 0x51 'Q'
+  {  1603,  20,  26,  25,    3,  -25 },   // 0x52 'R'
+  {  1653,  20,  26,  24,    2,  -25 },   // 0x53 'S'
+  {  1692,  20,  26,  22,    1,  -25 },   // 0x54 'T'
+  {  1742,  20,  26,  25,    3,  -25 },   // 0x55 'U'
+  {  1773,  21,  26,  23,    1,  -25 },   // 0x56 'V'
+  {  1823,  31,  26,  33,    1,  -25 },   // 0x57 'W'
+  {  1906,  22,  26,  23,    1,  -25 },   // 0x58 'X'
+  {  1958,  22,  26,  24,    1,  -25 },   // 0x59 'Y'
+  {  2008,  20,  26,  22,    1,  -25 },   // 0x5A 'Z'
+  {  2040,   7,  34,  10,    2,  -25 },   // 0x5B '['
+  {  2071,  10,  26,  10,    0,  -25 },   // 0x5C '\'
+  {  2097,   6,  34,  10,    1,  -25 },   // 0x5D ']'
+  {  2128,  13,  13,  17,    2,  -24 },   // 0x5E '^'
+  {  2151,  21,   2,  20,   -1,    5 },   // 0x5F '_'
+  {  2154,   7,   5,   9,    1,  -25 },   // 0x60 '`'
+  {  2159,  17,  19,  19,    1,  -18 },   // 0x61 'a'
+  {  2190,  17,  26,  20,    2,  -25 },   // 0x62 'b'
+  {  2230,  16,  19,  18,    1,  -18 },   // 0x63 'c'
+  {  2257,  17,  27,  20,    1,  -25 },   // 0x64 'd'
+  {  2296,  17,  19,  19,    1,  -18 },   // 0x65 'e'
+  {  2323,   8,  26,  10,    1,  -25 },   // 0x66 'f'
+  {  2350,  16,  26,  19,    1,  -18 },   // 0x67 'g'
+  {  2391,  15,  26,  19,    2,  -25 },   // 0x68 'h'
+  {  2420,   3,  26,   8,    2,  -25 },   // 0x69 'i'
+  {  2425,   6,  34,   9,    0,  -25 },   // 0x6A 'j'
+  {  2455,  16,  26,  18,    2,  -25 },   // 0x6B 'k'
+  {  2500,   3,  26,   8,    2,  -25 },   // 0x6C 'l'
+  {  2506,  25,  20,  29,    2,  -19 },   // 0x6D 'm'
+  {  2550,  15,  20,  19,    2,  -19 },   // 0x6E 'n'
+  {  2572,  17,  19,  19,    1,  -18 },   // 0x6F 'o'
+  {  2600,  17,  27,  20,    2,  -19 },   // 0x70 'p'
+  {  2641,  17,  26,  20,    1,  -18 },   // 0x71 'q'
+  {  2678,   9,  19,  12,    2,  -18 },   // 0x72 'r'
+  {  2698,  15,  19,  17,    1,  -18 },   // 0x73 's'
+  {  2722,   8,  24,  10,    1,  -23 },   // 0x74 't'
+  {  2746,  15,  20,  19,    2,  -18 },   // 0x75 'u'
+  {  2769,  17,  19,  17,    0,  -18 },   // 0x76 'v'
+  {  2804,  25,  19,  25,    0,  -18 },   // 0x77 'w'
+  {  2866,  16,  19,  17,    0,  -18 },   // 0x78 'x'
+  {  2899,  16,  27,  17,    0,  -18 },   // 0x79 'y'
+  {  2941,  15,  19,  17,    1,  -18 },   // 0x7A 'z'
+  {  2960,   8,  33,  12,    2,  -25 },   // 0x7B '{'
+  {  2993,   2,  33,   9,    3,  -25 },   // 0x7C '|'
+  {  2998,   8,  33,  12,    2,  -25 },   // 0x7D '}'
+  {  3032,  15,   5,  18,    1,  -14 },   // 0x7E '~'
+  {  3040,  26,  33,  28,    1,  -27 },   // 0x7F ''
+  {  3110,  26,  33,  28,    1,  -27 },   // 0x80 ''
+  {  3180,  26,  33,  28,    1,  -27 },   // 0x81 ''
+  {  3250,  26,  33,  28,    1,  -27 },   // 0x82 ''
+  {  3320,  26,  33,  28,    1,  -27 },   // 0x83 ''
+  {  3390,  26,  33,  28,    1,  -27 },   // 0x84 ''
+  {  3460,  26,  33,  28,    1,  -27 },   // 0x85 ''
+  {  3530,  26,  33,  28,    1,  -27 },   // 0x86 ''
+  {  3600,  26,  33,  28,    1,  -27 },   // 0x87 ''
+  {  3670,  26,  33,  28,    1,  -27 },   // 0x88 ''
+  {  3740,  26,  33,  28,    1,  -27 },   // 0x89 ''
+  {  3810,  26,  33,  28,    1,  -27 },   // 0x8A ''
+  {  3880,  26,  33,  28,    1,  -27 },   // 0x8B ''
+  {  3950,  26,  33,  28,    1,  -27 },   // 0x8C ''
+  {  4020,  26,  33,  28,    1,  -27 },   // 0x8D ''
+  {  4090,  26,  33,  28,    1,  -27 },   // 0x8E ''
+  {  4160,  26,  33,  28,    1,  -27 },   // 0x8F ''
+  {  4230,  26,  33,  28,    1,  -27 },   // 0x90 ''
+  {  4300,  26,  33,  28,    1,  -27 },   // 0x91 ''
+  {  4370,  26,  33,  28,    1,  -27 },   // 0x92 ''
+  {  4440,  26,  33,  28,    1,  -27 },   // 0x93 ''
+  {  4510,  26,  33,  28,    1,  -27 },   // 0x94 ''
+  {  4580,  26,  33,  28,    1,  -27 },   // 0x95 ''
+  {  4650,  26,  33,  28,    1,  -27 },   // 0x96 ''
+  {  4720,  26,  33,  28,    1,  -27 },   // 0x97 ''
+  {  4790,  26,  33,  28,    1,  -27 },   // 0x98 ''
+  {  4860,  26,  33,  28,    1,  -27 },   // 0x99 ''
+  {  4930,  26,  33,  28,    1,  -27 },   // 0x9A ''
+  {  5000,  26,  33,  28,    1,  -27 },   // 0x9B ''
+  {  5070,  26,  33,  28,    1,  -27 },   // 0x9C ''
+  {  5140,  26,  33,  28,    1,  -27 },   // 0x9D ''
+  {  5210,  26,  33,  28,    1,  -27 },   // 0x9E ''
+  {  5280,  26,  33,  28,    1,  -27 },   // 0x9F ''
+  {  5350,   1,   1,  10,    0,    0 },   // 0xA0 ''
+  {  5351,   3,  25,  12,    4,  -17 },   // 0xA1 ''
+  {  5360,  16,  25,  20,    2,  -21 },   // 0xA2 ''
+  {  5404,  18,  26,  20,    1,  -25 },   // 0xA3 ''
+  {  5441,  15,  16,  20,    2,  -19 },   // 0xA4 ''
+  {  5470,  19,  25,  20,    0,  -24 },   // 0xA5 ''
+  {  5513,   2,  33,   9,    4,  -25 },   // 0xA6 ''
+  {  5517,  16,  34,  20,    2,  -25 },   // 0xA7 ''
+  {  5570,  10,   4,  12,    1,  -24 },   // 0xA8 ''
+  {  5575,  26,  25,  28,    1,  -24 },   // 0xA9 ''
+  {  5643,  11,  15,  13,    1,  -25 },   // 0xAA ''
+  {  5665,  13,  12,  18,    2,  -15 },   // 0xAB ''
+  {  5688,  18,  10,  21,    1,  -12 },   // 0xAC ''
+  {  5707,   8,   3,  12,    2,  -10 },   // 0xAD ''
+  {  5709,  26,  25,  28,    1,  -24 },   // 0xAE ''
+  {  5780,  10,   2,  12,    1,  -24 },   // 0xAF ''
+  {  5782,  11,  10,  21,    5,  -23 },   // 0xB0 ''
+  {  5797,  17,  22,  21,    2,  -21 },   // 0xB1 ''
+  {  5821,  10,  15,  12,    1,  -28 },   // 0xB2 ''
+  {  5837,  10,  16,  12,    1,  -28 },   // 0xB3 ''
+  {  5856,   8,   5,  12,    3,  -25 },   // 0xB4 ''
+  {  5862,  17,  26,  20,    2,  -18 },   // 0xB5 ''
+  {  5907,  16,  32,  19,    2,  -25 },   // 0xB6 ''
+  {  5970,   4,   4,   9,    3,  -11 },   // 0xB7 ''
+  {  5972,   9,   7,  12,    1,    1 },   // 0xB8 ''
+  {  5981,   6,  15,  12,    2,  -28 },   // 0xB9 ''
+  {  5994,  10,  15,  13,    1,  -25 },   // 0xBA ''
+  {  6012,  12,  11,  18,    3,  -14 },   // 0xBB ''
+  {  6035,  28,  27,  31,    2,  -25 },   // 0xBC ''
+  {  6100,  28,  26,  31,    2,  -25 },   // 0xBD ''
+  {  6161,  28,  27,  31,    1,  -25 },   // 0xBE ''
+  {  6236,  16,  26,  20,    3,  -17 },   // 0xBF ''
+  {  6268,  22,  32,  23,    1,  -31 },   // 0xC0 ''
+  {  6328,  22,  32,  23,    1,  -31 },   // 0xC1 ''
+  {  6388,  22,  32,  23,    1,  -31 },   // 0xC2 ''
+  {  6447,  22,  32,  23,    1,  -31 },   // 0xC3 ''
+  {  6506,  22,  31,  23,    1,  -30 },   // 0xC4 ''
+  {  6565,  22,  34,  23,    1,  -33 },   // 0xC5 ''
+  {  6629,  33,  26,  35,    1,  -25 },   // 0xC6 ''
+  {  6695,  23,  33,  25,    1,  -25 },   // 0xC7 ''
+  {  6755,  18,  32,  22,    3,  -31 },   // 0xC8 ''
+  {  6793,  18,  32,  22,    3,  -31 },   // 0xC9 ''
+  {  6829,  18,  32,  22,    3,  -31 },   // 0xCA ''
+  {  6867,  18,  32,  22,    3,  -31 },   // 0xCB ''
+  {  6907,   8,  32,  10,    0,  -31 },   // 0xCC ''
+  {  6939,   8,  32,  10,    2,  -31 },   // 0xCD ''
+  {  6971,  10,  32,  11,    0,  -31 },   // 0xCE ''
+  {  7005,  10,  32,  11,    0,  -31 },   // 0xCF ''
+  {  7038,  23,  26,  25,    1,  -25 },   // 0xD0 ''
+  {  7089,  20,  31,  26,    3,  -30 },   // 0xD1 ''
+  {  7140,  25,  31,  28,    1,  -30 },   // 0xD2 ''
+  {  7206,  25,  31,  28,    1,  -30 },   // 0xD3 ''
+  {  7273,  25,  31,  28,    1,  -30 },   // 0xD4 ''
+  {  7341,  25,  31,  28,    1,  -30 },   // 0xD5 ''
+  {  7408,  25,  31,  28,    1,  -30 },   // 0xD6 ''
+  {  7475,  14,  14,  21,    3,  -14 },   // 0xD7 ''
+  {  7499,  25,  26,  28,    1,  -25 },   // 0xD8 ''
+  {  7561,  20,  32,  25,    3,  -31 },   // 0xD9 ''
+  {  7602,  20,  32,  25,    3,  -31 },   // 0xDA ''
+  {  7642,  20,  32,  25,    3,  -31 },   // 0xDB ''
+  {  7682,  20,  32,  25,    3,  -31 },   // 0xDC ''
+  {  7723,  22,  32,  24,    1,  -31 },   // 0xDD ''
+  {  7783,  18,  26,  23,    3,  -25 },   // 0xDE ''
+  {  7815,  17,  27,  21,    3,  -26 },   // 0xDF ''
+  {  7866,  17,  26,  19,    1,  -25 },   // 0xE0 ''
+  {  7905,  17,  26,  19,    1,  -25 },   // 0xE1 ''
+  {  7944,  17,  25,  19,    1,  -24 },   // 0xE2 ''
+  {  7984,  17,  25,  19,    1,  -24 },   // 0xE3 ''
+  {  8024,  17,  26,  19,    1,  -25 },   // 0xE4 ''
+  {  8066,  17,  27,  19,    1,  -26 },   // 0xE5 ''
+  {  8108,  29,  19,  31,    1,  -18 },   // 0xE6 ''
+  {  8154,  16,  26,  18,    1,  -18 },   // 0xE7 ''
+  {  8190,  17,  26,  19,    1,  -25 },   // 0xE8 ''
+  {  8224,  17,  26,  19,    1,  -25 },   // 0xE9 ''
+  {  8259,  17,  25,  19,    1,  -24 },   // 0xEA ''
+  {  8295,  17,  26,  19,    1,  -25 },   // 0xEB ''
+  {  8333,   7,  26,   8,    0,  -25 },   // 0xEC ''
+  {  8359,   8,  26,   8,    0,  -25 },   // 0xED ''
+  {  8385,  10,  26,   9,    0,  -25 },   // 0xEE ''
+  {  8414,  10,  26,   9,    0,  -25 },   // 0xEF ''
+  {  8441,  17,  26,  19,    1,  -25 },   // 0xF0 ''
+  {  8479,  15,  25,  19,    2,  -24 },   // 0xF1 ''
+  {  8509,  17,  26,  19,    1,  -25 },   // 0xF2 ''
+  {  8544,  17,  26,  19,    1,  -25 },   // 0xF3 ''
+  {  8580,  17,  26,  19,    1,  -25 },   // 0xF4 ''
+  {  8618,  17,  25,  19,    1,  -24 },   // 0xF5 ''
+  {  8655,  17,  26,  19,    1,  -25 },   // 0xF6 ''
+  {  8694,  17,  17,  21,    2,  -16 },   // 0xF7 ''
+  {  8713,  18,  19,  19,    0,  -18 },   // 0xF8 ''
+  {  8757,  15,  27,  19,    2,  -25 },   // 0xF9 ''
+  {  8787,  15,  27,  19,    2,  -25 },   // 0xFA ''
+  {  8817,  15,  27,  19,    2,  -25 },   // 0xFB ''
+  {  8850,  15,  27,  19,    2,  -25 },   // 0xFC ''
+  {  8884,  16,  34,  17,    0,  -25 },   // 0xFD ''
+  {  8933,  17,  32,  20,    2,  -24 },   // 0xFE ''
+  {  8980,  16,  34,  17,    0,  -25 } }; // 0xFF ''
+
+constexpr GFXfont FreeSans_RLE_18pt8b PROGMEM = {
+  (uint8_t  *)FreeSans_RLE_18pt8bBitmaps,
+  (GFXglyph *)FreeSans_RLE_18pt8bGlyphs,
+  0x20, 0xFF, 42 };
+
+// Approx. 10608 bytes
@@ -0,0 +1,1127 @@
+// Run-length encoded glyph bitmaps (fontconvert -r)
+#define FreeSans_RLE_20pt8b_RLE
+
+const uint8_t FreeSans_RLE_20pt8bBitmaps[] PROGMEM = {
+  0x10, 0x0F, 0x0F, 0x0F, 0x0F, 0x11, 0x21, 0xAC, 0x03, 0x36, 0x36, 0x36,
+  0x36, 0x36, 0x36, 0x36, 0x35, 0x52, 0x11, 0x51, 0x10, 0x73, 0x53, 0x93,
+  0x53, 0x93, 0x43, 0x93, 0x53, 0x93, 0x53, 0x93, 0x53, 0x93, 0x53, 0x4F,
+  0x04, 0x1F, 0x04, 0x1F, 0x04, 0x53, 0x53, 0x93, 0x53, 0x93, 0x53, 0x93,
+  0x43, 0x93, 0x53, 0x93, 0x53, 0x93, 0x53, 0x5F, 0x04, 0x1F, 0x04, 0x1F,
+  0x04, 0x43, 0x53, 0x93, 0x53, 0x93, 0x53, 0x93, 0x53, 0x93, 0x43, 0x93,
+  0x53, 0x93, 0x53, 0x70, 0x92, 0xF0, 0x22, 0xE7, 0xAB, 0x7E, 0x44, 0x32,
+  0x24, 0x34, 0x42, 0x34, 0x23, 0x52, 0x43, 0x23, 0x52, 0x43, 0x23, 0x52,
+  0x43, 0x23, 0x52, 0x93, 0x52, 0x94, 0x42, 0xA5, 0x22, 0xA9, 0xBB, 0xAB,
+  0xB9, 0xB2, 0x16, 0xA2, 0x35, 0x92, 0x44, 0x92, 0x56, 0x62, 0x57, 0x52,
+  0x57, 0x52, 0x53, 0x13, 0x52, 0x44, 0x14, 0x42, 0x43, 0x34, 0x32, 0x25,
+  0x3F, 0x5D, 0x98, 0xE2, 0xF0, 0x22, 0xF0, 0x22, 0xF0, 0x22, 0x80, 0xF0,
+  0x82, 0xC5, 0xD3, 0xB8, 0xA3, 0xBA, 0x92, 0xB3, 0x54, 0x73, 0xA3, 0x73,
+  0x72, 0xB3, 0x82, 0x63, 0xB3, 0x82, 0x62, 0xC3, 0x82, 0x53, 0xC4, 0x63,
+  0x43, 0xE4, 0x44, 0x42, 0xF0, 0x1A, 0x43, 0xF0, 0x28, 0x52, 0xF0, 0x54,
+  0x63, 0xF0, 0xF2, 0x74, 0xF0, 0x43, 0x58, 0xF0, 0x13, 0x5A, 0xF2, 0x54,
+  0x44, 0xD3, 0x53, 0x63, 0xD2, 0x53, 0x83, 0xB3, 0x53, 0x83, 0xB2, 0x63,
+  0x83, 0xA3, 0x73, 0x63, 0xA3, 0x84, 0x44, 0xA2, 0xAA, 0xA3, 0xB8, 0xB2,
+  0xD6, 0x40, 0x76, 0xF9, 0xDB, 0xC4, 0x44, 0xA4, 0x63, 0xA3, 0x73, 0xA3,
+  0x73, 0xA4, 0x63, 0xB3, 0x54, 0xB4, 0x34, 0xD4, 0x14, 0xF7, 0xF0, 0x15,
+  0xF0, 0x18, 0xD5, 0x23, 0x53, 0x44, 0x44, 0x43, 0x43, 0x64, 0x33, 0x34,
+  0x74, 0x23, 0x33, 0x98, 0x33, 0x97, 0x43, 0xA6, 0x44, 0xA4, 0x64, 0x95,
+  0x55, 0x59, 0x5D, 0x24, 0x5A, 0x45, 0x66, 0x75, 0x0F, 0x0C, 0x22, 0x22,
+  0x22, 0x10, 0x62, 0x52, 0x53, 0x52, 0x53, 0x53, 0x43, 0x53, 0x53, 0x43,
+  0x53, 0x53, 0x44, 0x43, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
+  0x53, 0x53, 0x63, 0x53, 0x53, 0x53, 0x63, 0x53, 0x53, 0x63, 0x53, 0x63,
+  0x62, 0x63, 0x62, 0x12, 0x73, 0x72, 0x73, 0x72, 0x73, 0x72, 0x73, 0x63,
+  0x72, 0x73, 0x63, 0x63, 0x64, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
+  0x63, 0x63, 0x53, 0x63, 0x63, 0x63, 0x62, 0x63, 0x63, 0x62, 0x63, 0x62,
+  0x63, 0x62, 0x63, 0x62, 0x60, 0x43, 0x83, 0x83, 0x42, 0x23, 0x2D, 0x19,
+  0x53, 0x75, 0x53, 0x13, 0x33, 0x33, 0x32, 0x32, 0x20, 0x83, 0xF0, 0x13,
+  0xF0, 0x13, 0xF0, 0x13, 0xF0, 0x13, 0xF0, 0x13, 0xF0, 0x13, 0xF0, 0x13,
+  0x8F, 0x0F, 0x0F, 0x0C, 0x83, 0xF0, 0x13, 0xF0, 0x13, 0xF0, 0x13, 0xF0,
+  0x13, 0xF0, 0x13, 0xF0, 0x13, 0xF0, 0x13, 0x80, 0x0F, 0x05, 0x23, 0x22,
+  0x32, 0x32, 0x14, 0x12, 0x30, 0x0F, 0x0C, 0x0F, 0x01, 0x92, 0x83, 0x82,
+  0x92, 0x92, 0x82, 0x92, 0x92, 0x82, 0x92, 0x92, 0x82, 0x92, 0x92, 0x82,
+  0x92, 0x92, 0x83, 0x82, 0x92, 0x83, 0x82, 0x92, 0x83, 0x82, 0x92, 0x83,
+  0x82, 0x92, 0x90, 0x66, 0xAA, 0x7C, 0x55, 0x45, 0x34, 0x74, 0x34, 0x84,
+  0x23, 0x94, 0x14, 0xA3, 0x14, 0xA3, 0x13, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7,
+  0xB7, 0xB7, 0xB7, 0xB8, 0xA3, 0x14, 0xA3, 0x23, 0x94, 0x24, 0x84, 0x24,
+  0x74, 0x44, 0x55, 0x5C, 0x7A, 0xA6, 0x60, 0x73, 0x73, 0x64, 0x64, 0x4F,
+  0x0F, 0x06, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+  0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x67, 0xAC, 0x6E,
+  0x46, 0x46, 0x34, 0x84, 0x33, 0xA4, 0x14, 0xA4, 0x14, 0xA4, 0x13, 0xB4,
+  0xF4, 0xF4, 0xE4, 0xE5, 0xC6, 0xC6, 0xB6, 0xB6, 0xC5, 0xC5, 0xE4, 0xE4,
+  0xE4, 0xF3, 0xF0, 0x13, 0xF0, 0x1F, 0x0F, 0x0F, 0x0B, 0x67, 0xAB, 0x7D,
+  0x55, 0x55, 0x43, 0x85, 0x24, 0x94, 0x24, 0x94, 0x23, 0xA4, 0xF4, 0xF3,
+  0xE5, 0xA8, 0xB6, 0xD8, 0xF0, 0x15, 0xF4, 0xF0, 0x14, 0xF8, 0xB8, 0xB4,
+  0x13, 0xB4, 0x14, 0xA3, 0x24, 0x94, 0x35, 0x55, 0x4E, 0x7B, 0xA7, 0x60,
+  0xC3, 0xF0, 0x13, 0xF4, 0xE5, 0xD6, 0xD6, 0xC3, 0x13, 0xB4, 0x13, 0xB3,
+  0x23, 0xA3, 0x33, 0x93, 0x43, 0x84, 0x43, 0x83, 0x53, 0x73, 0x63, 0x64,
+  0x63, 0x54, 0x73, 0x53, 0x83, 0x43, 0x93, 0x4F, 0x0F, 0x0F, 0x0C, 0xC3,
+  0xF0, 0x13, 0xF0, 0x13, 0xF0, 0x13, 0xF0, 0x13, 0xF0, 0x13, 0x40, 0x3F,
+  0x4F, 0x4F, 0x43, 0xF0, 0x13, 0xF4, 0xF4, 0xF3, 0xF0, 0x13, 0xF0, 0x13,
+  0x26, 0x8D, 0x6F, 0x36, 0x56, 0x24, 0x94, 0xF0, 0x14, 0xF4, 0xF4, 0xF0,
+  0x13, 0xF0, 0x13, 0xF4, 0x13, 0xB4, 0x14, 0xA3, 0x24, 0x94, 0x35, 0x55,
+  0x5D, 0x7B, 0xA7, 0x60, 0x67, 0x9A, 0x7C, 0x55, 0x45, 0x44, 0x74, 0x24,
+  0x84, 0x23, 0xA3, 0x14, 0xE4, 0xE3, 0xF3, 0x37, 0x53, 0x2A, 0x33, 0x1C,
+  0x27, 0x55, 0x15, 0x84, 0x14, 0xA8, 0xA7, 0xB7, 0xC7, 0xA8, 0xA4, 0x13,
+  0xA3, 0x24, 0x84, 0x35, 0x45, 0x5C, 0x7A, 0xA6, 0x60, 0x0F, 0x0F, 0x0F,
+  0x09, 0xF3, 0xE3, 0xE3, 0xF3, 0xE3, 0xE3, 0xF3, 0xE3, 0xE4, 0xE3, 0xE4,
+  0xE3, 0xE4, 0xE3, 0xE4, 0xE3, 0xF3, 0xE4, 0xE3, 0xF3, 0xE4, 0xE4, 0xE3,
+  0xF3, 0xB0, 0x76, 0xAB, 0x7D, 0x55, 0x55, 0x44, 0x84, 0x33, 0x94, 0x24,
+  0xA3, 0x24, 0xA3, 0x33, 0x94, 0x34, 0x84, 0x44, 0x55, 0x6C, 0x8A, 0x7D,
+  0x55, 0x64, 0x34, 0x94, 0x24, 0xA4, 0x13, 0xB8, 0xC7, 0xC3, 0x13, 0xB4,
+  0x14, 0xA4, 0x15, 0x84, 0x35, 0x56, 0x4E, 0x6B, 0xA7, 0x60, 0x67, 0xAB,
+  0x7D, 0x55, 0x55, 0x44, 0x74, 0x34, 0x94, 0x23, 0xB3, 0x23, 0xB3, 0x14,
+  0xB8, 0xB4, 0x13, 0xB4, 0x14, 0x95, 0x14, 0x95, 0x25, 0x57, 0x3F, 0x01,
+  0x4A, 0x14, 0x66, 0x34, 0xF4, 0xF3, 0xF0, 0x13, 0x24, 0x94, 0x24, 0x93,
+  0x44, 0x74, 0x45, 0x45, 0x6C, 0x8A, 0xB6, 0x70, 0x0F, 0x01, 0xF0, 0xF0,
+  0xF0, 0x7F, 0x01, 0x0F, 0x01, 0xF0, 0xF0, 0xF0, 0x7F, 0x01, 0x22, 0x22,
+  0x22, 0x25, 0x12, 0x20, 0xF0, 0x31, 0xF0, 0x13, 0xD6, 0xB7, 0xA7, 0x97,
+  0xA7, 0x97, 0xB6, 0xD4, 0xF6, 0xE7, 0xF7, 0xE7, 0xE8, 0xE7, 0xE6, 0xF4,
+  0xF0, 0x31, 0x0F, 0x0F, 0x0F, 0x0C, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x1F,
+  0x0F, 0x0F, 0x0C, 0x01, 0xF0, 0x33, 0xF0, 0x16, 0xE7, 0xE7, 0xE8, 0xE7,
+  0xE7, 0xF6, 0xF4, 0xD6, 0xB7, 0x97, 0xA7, 0x98, 0x97, 0xB6, 0xD4, 0xF1,
+  0xF0, 0x30, 0x57, 0x8B, 0x5D, 0x35, 0x55, 0x24, 0x74, 0x14, 0x98, 0x97,
+  0xA7, 0xA4, 0xD4, 0xC4, 0xD4, 0xC4, 0xB5, 0xB5, 0xC4, 0xC4, 0xD3, 0xD4,
+  0xD4, 0xD4, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x64, 0xD4, 0xD4, 0xD4, 0x70,
+  0xF9, 0xF0, 0x9F, 0xF0, 0x4F, 0x04, 0xF7, 0x87, 0xD6, 0xD6, 0xA5, 0xF0,
+  0x16, 0x84, 0xF0, 0x54, 0x74, 0xF0, 0x74, 0x63, 0xF0, 0x94, 0x44, 0x87,
+  0x33, 0x34, 0x34, 0x89, 0x23, 0x44, 0x23, 0x84, 0x47, 0x44, 0x14, 0x74,
+  0x65, 0x54, 0x13, 0x74, 0x84, 0x63, 0x13, 0x64, 0x94, 0x63, 0x13, 0x64,
+  0x93, 0x77, 0x63, 0xA3, 0x77, 0x54, 0x94, 0x68, 0x54, 0x93, 0x78, 0x54,
+  0x93, 0x73, 0x14, 0x54, 0x84, 0x64, 0x23, 0x63, 0x83, 0x73, 0x33, 0x64,
+  0x64, 0x64, 0x34, 0x55, 0x37, 0x35, 0x44, 0x69, 0x1B, 0x64, 0x67, 0x39,
+  0x75, 0xF0, 0x24, 0xB4, 0xF0, 0xF0, 0x35, 0xF0, 0xF0, 0x25, 0xF0, 0xF0,
+  0x26, 0xF0, 0xF0, 0x17, 0x84, 0xF0, 0x4F, 0x03, 0xF0, 0x5F, 0x01, 0xF0,
+  0x89, 0xD0, 0xA5, 0xF0, 0x36, 0xF0, 0x36, 0xF0, 0x37, 0xF0, 0x18, 0xF0,
+  0x14, 0x13, 0xF4, 0x24, 0xE4, 0x24, 0xE3, 0x43, 0xD4, 0x44, 0xC4, 0x44,
+  0xC3, 0x63, 0xB4, 0x64, 0xA4, 0x64, 0xA3, 0x83, 0x94, 0x84, 0x84, 0x84,
+  0x8F, 0x02, 0x6F, 0x03, 0x6F, 0x03, 0x63, 0xC4, 0x44, 0xC4, 0x44, 0xC4,
+  0x43, 0xE4, 0x24, 0xE4, 0x24, 0xE4, 0x14, 0xF0, 0x18, 0xF0, 0x18, 0xF0,
+  0x14, 0x0F, 0x6F, 0x02, 0x4F, 0x03, 0x34, 0x96, 0x24, 0xB5, 0x14, 0xC4,
+  0x14, 0xC4, 0x14, 0xC4, 0x14, 0xC4, 0x14, 0xC4, 0x14, 0xC4, 0x14, 0xB4,
+  0x24, 0x95, 0x3F, 0x02, 0x4F, 0x02, 0x4F, 0x04, 0x24, 0xB5, 0x14, 0xD8,
+  0xD8, 0xE7, 0xE7, 0xE7, 0xE7, 0xD8, 0xC9, 0xB5, 0x1F, 0x04, 0x2F, 0x03,
+  0x3F, 0x01, 0x50, 0x98, 0xDD, 0xAF, 0x77, 0x56, 0x65, 0x95, 0x44, 0xC4,
+  0x34, 0xE4, 0x24, 0xE4, 0x23, 0xF0, 0x13, 0x14, 0xF0, 0x54, 0xF0, 0x53,
+  0xF0, 0x63, 0xF0, 0x63, 0xF0, 0x63, 0xF0, 0x63, 0xF0, 0x63, 0xF0, 0x63,
+  0xF0, 0x64, 0xF0, 0x18, 0xF0, 0x18, 0xF0, 0x14, 0x14, 0xE4, 0x24, 0xE4,
+  0x34, 0xC5, 0x45, 0x95, 0x57, 0x56, 0x8F, 0xAD, 0xE7, 0x80, 0x0F, 0x8F,
+  0x02, 0x6F, 0x03, 0x54, 0x96, 0x44, 0xB5, 0x34, 0xC5, 0x24, 0xD4, 0x24,
+  0xE4, 0x14, 0xE4, 0x14, 0xF3, 0x14, 0xF3, 0x14, 0xF8, 0xF8, 0xF8, 0xF8,
+  0xF8, 0xF8, 0xF8, 0xF3, 0x14, 0xF3, 0x14, 0xE4, 0x14, 0xE4, 0x14, 0xD4,
+  0x24, 0xC5, 0x24, 0xB5, 0x34, 0x96, 0x4F, 0x03, 0x5F, 0x02, 0x6F, 0x80,
+  0x0F, 0x05, 0x1F, 0x05, 0x1F, 0x05, 0x14, 0xF0, 0x24, 0xF0, 0x24, 0xF0,
+  0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0,
+  0x24, 0xF0, 0x2F, 0x04, 0x2F, 0x04, 0x2F, 0x04, 0x24, 0xF0, 0x24, 0xF0,
+  0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0,
+  0x24, 0xF0, 0x24, 0xF0, 0x2F, 0x0F, 0x0F, 0x0F, 0x03, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x01, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xFF,
+  0x02, 0x2F, 0x02, 0x2F, 0x02, 0x24, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4,
+  0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF0, 0x98, 0xF0, 0x1D, 0xBF, 0x01,
+  0x97, 0x48, 0x65, 0xA5, 0x55, 0xD4, 0x44, 0xE4, 0x34, 0xF0, 0x14, 0x24,
+  0xF0, 0x14, 0x14, 0xF0, 0x74, 0xF0, 0x74, 0xF0, 0x73, 0xF0, 0x83, 0xF0,
+  0x83, 0xBF, 0xBF, 0xBF, 0xF0, 0x48, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x34,
+  0x14, 0xF0, 0x15, 0x15, 0xF5, 0x25, 0xD6, 0x35, 0xA8, 0x47, 0x5A, 0x5F,
+  0x01, 0x23, 0x6E, 0x33, 0x99, 0x53, 0xF0, 0xB0, 0x04, 0xE8, 0xE8, 0xE8,
+  0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xEF, 0x0F, 0x0F,
+  0x0F, 0x0E, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8,
+  0xE8, 0xE8, 0xE4, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0B, 0xD3,
+  0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3,
+  0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD7, 0x97, 0x97, 0x97, 0x84, 0x13, 0x84,
+  0x14, 0x74, 0x15, 0x45, 0x3D, 0x4A, 0x86, 0x50, 0x04, 0xD5, 0x14, 0xD4,
+  0x24, 0xC4, 0x34, 0xB4, 0x44, 0xA4, 0x54, 0x94, 0x64, 0x84, 0x74, 0x74,
+  0x84, 0x64, 0x94, 0x54, 0xA4, 0x44, 0xB4, 0x34, 0xC4, 0x26, 0xB4, 0x17,
+  0xB8, 0x14, 0xA7, 0x25, 0x96, 0x44, 0x95, 0x64, 0x84, 0x75, 0x74, 0x84,
+  0x74, 0x94, 0x64, 0x95, 0x54, 0xA4, 0x54, 0xB4, 0x44, 0xB5, 0x34, 0xC4,
+  0x34, 0xD4, 0x24, 0xD5, 0x14, 0xE4, 0x10, 0x04, 0xE4, 0xE4, 0xE4, 0xE4,
+  0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4,
+  0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xEF, 0x0F, 0x0F,
+  0x09, 0x05, 0xF0, 0x2B, 0xFC, 0xFC, 0xFD, 0xDE, 0xD3, 0x1A, 0xD3, 0x1B,
+  0xB4, 0x17, 0x13, 0xB3, 0x27, 0x13, 0xB3, 0x27, 0x14, 0x94, 0x27, 0x23,
+  0x93, 0x37, 0x23, 0x93, 0x37, 0x24, 0x74, 0x37, 0x33, 0x73, 0x47, 0x33,
+  0x73, 0x47, 0x34, 0x63, 0x47, 0x43, 0x53, 0x57, 0x43, 0x53, 0x57, 0x53,
+  0x43, 0x57, 0x53, 0x33, 0x67, 0x53, 0x33, 0x67, 0x63, 0x23, 0x67, 0x63,
+  0x13, 0x77, 0x63, 0x13, 0x77, 0x76, 0x77, 0x75, 0x87, 0x75, 0x87, 0x84,
+  0x83, 0x04, 0xF8, 0xE9, 0xD9, 0xDA, 0xCB, 0xBB, 0xB7, 0x14, 0xA7, 0x14,
+  0xA7, 0x24, 0x97, 0x34, 0x87, 0x34, 0x87, 0x44, 0x77, 0x54, 0x67, 0x54,
+  0x67, 0x64, 0x57, 0x64, 0x57, 0x74, 0x47, 0x84, 0x37, 0x84, 0x37, 0x94,
+  0x27, 0xA4, 0x17, 0xA4, 0x17, 0xBB, 0xCA, 0xCA, 0xD9, 0xD9, 0xE4, 0x98,
+  0xF0, 0x2D, 0xCF, 0x02, 0x97, 0x57, 0x75, 0xA6, 0x55, 0xD4, 0x45, 0xF4,
+  0x34, 0xF0, 0x24, 0x24, 0xF0, 0x24, 0x14, 0xF0, 0x43, 0x14, 0xF0, 0x47,
+  0xF0, 0x57, 0xF0, 0x57, 0xF0, 0x57, 0xF0, 0x57, 0xF0, 0x57, 0xF0, 0x57,
+  0xF0, 0x58, 0xF0, 0x48, 0xF0, 0x43, 0x23, 0xF0, 0x34, 0x24, 0xF0, 0x24,
+  0x34, 0xF4, 0x45, 0xD5, 0x55, 0xA6, 0x77, 0x57, 0x9F, 0x02, 0xCD, 0xF0,
+  0x18, 0xA0, 0x0F, 0x6F, 0x03, 0x3F, 0x04, 0x24, 0x96, 0x24, 0xB5, 0x14,
+  0xC4, 0x14, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xC4, 0x14, 0xB5, 0x14, 0x96,
+  0x2F, 0x04, 0x2F, 0x03, 0x3F, 0x01, 0x54, 0xF0, 0x24, 0xF0, 0x24, 0xF0,
+  0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0,
+  0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x20, 0x98, 0xF0, 0x2D, 0xCF, 0x02,
+  0x97, 0x57, 0x75, 0xA6, 0x55, 0xD5, 0x35, 0xF4, 0x34, 0xF0, 0x24, 0x24,
+  0xF0, 0x24, 0x14, 0xF0, 0x43, 0x14, 0xF0, 0x47, 0xF0, 0x57, 0xF0, 0x57,
+  0xF0, 0x57, 0xF0, 0x57, 0xF0, 0x57, 0xF0, 0x57, 0xF0, 0x58, 0xF0, 0x48,
+  0xF0, 0x43, 0x23, 0xF0, 0x34, 0x24, 0xB2, 0x44, 0x34, 0x95, 0x14, 0x45,
+  0x98, 0x65, 0xA6, 0x77, 0x58, 0x8F, 0x05, 0x9D, 0x15, 0xA8, 0x63, 0xF0,
+  0xA2, 0x10, 0x0F, 0x02, 0x6F, 0x04, 0x4F, 0x05, 0x34, 0xB6, 0x24, 0xD4,
+  0x24, 0xE4, 0x14, 0xE4, 0x14, 0xE4, 0x14, 0xE4, 0x14, 0xE4, 0x14, 0xE4,
+  0x14, 0xD4, 0x24, 0xC4, 0x3F, 0x04, 0x4F, 0x03, 0x5F, 0x04, 0x44, 0xB5,
+  0x34, 0xD4, 0x24, 0xD4, 0x24, 0xE3, 0x24, 0xE3, 0x24, 0xE3, 0x24, 0xE3,
+  0x24, 0xE3, 0x24, 0xE3, 0x24, 0xE4, 0x14, 0xE4, 0x14, 0xE4, 0x14, 0xE5,
+  0x78, 0xBD, 0x8F, 0x01, 0x56, 0x66, 0x44, 0xA4, 0x34, 0xC4, 0x24, 0xC4,
+  0x23, 0xE3, 0x23, 0xE3, 0x24, 0xF0, 0x35, 0xF0, 0x36, 0xF0, 0x1A, 0xEC,
+  0xCD, 0xDA, 0xF0, 0x17, 0xF0, 0x26, 0xF0, 0x37, 0xF7, 0xF0, 0x17, 0xF7,
+  0xE4, 0x14, 0xD4, 0x15, 0xB4, 0x37, 0x57, 0x4F, 0x02, 0x6E, 0xB9, 0x60,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x09, 0xA3, 0xF0, 0x53, 0xF0, 0x53, 0xF0, 0x53,
+  0xF0, 0x53, 0xF0, 0x53, 0xF0, 0x53, 0xF0, 0x53, 0xF0, 0x53, 0xF0, 0x53,
+  0xF0, 0x53, 0xF0, 0x53, 0xF0, 0x53, 0xF0, 0x53, 0xF0, 0x53, 0xF0, 0x53,
+  0xF0, 0x53, 0xF0, 0x53, 0xF0, 0x53, 0xF0, 0x53, 0xF0, 0x53, 0xF0, 0x53,
+  0xF0, 0x53, 0xF0, 0x53, 0xF0, 0x53, 0xF0, 0x53, 0xA0, 0x04, 0xE8, 0xE8,
+  0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8,
+  0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE4, 0x14, 0xC4, 0x25,
+  0xA5, 0x37, 0x47, 0x5F, 0x01, 0x7E, 0xB8, 0x70, 0x04, 0xF0, 0x18, 0xF4,
+  0x14, 0xF4, 0x24, 0xE3, 0x34, 0xD4, 0x43, 0xD4, 0x44, 0xC3, 0x54, 0xB4,
+  0x63, 0xB4, 0x64, 0xA3, 0x74, 0x94, 0x83, 0x94, 0x84, 0x83, 0x94, 0x74,
+  0xA3, 0x74, 0xA4, 0x63, 0xB4, 0x54, 0xC3, 0x54, 0xC4, 0x43, 0xD4, 0x34,
+  0xE4, 0x24, 0xE4, 0x23, 0xF0, 0x13, 0x23, 0xF0, 0x18, 0xF0, 0x17, 0xF0,
+  0x36, 0xF0, 0x36, 0xF0, 0x35, 0xF0, 0x54, 0xA0, 0x04, 0xB4, 0xC8, 0xB5,
+  0xB8, 0xB5, 0xA4, 0x14, 0xA6, 0xA4, 0x24, 0x97, 0x94, 0x24, 0x97, 0x94,
+  0x24, 0x93, 0x13, 0x93, 0x34, 0x84, 0x13, 0x84, 0x44, 0x73, 0x24, 0x74,
+  0x44, 0x73, 0x24, 0x74, 0x44, 0x73, 0x33, 0x73, 0x54, 0x64, 0x33, 0x64,
+  0x64, 0x53, 0x44, 0x54, 0x64, 0x53, 0x53, 0x54, 0x64, 0x44, 0x53, 0x53,
+  0x74, 0x44, 0x54, 0x43, 0x83, 0x43, 0x64, 0x34, 0x84, 0x33, 0x73, 0x34,
+  0x84, 0x24, 0x73, 0x33, 0x94, 0x23, 0x84, 0x23, 0xA3, 0x23, 0x93, 0x14,
+  0xA4, 0x13, 0x93, 0x14, 0xA8, 0x97, 0xB7, 0xA7, 0xC6, 0xB6, 0xC6, 0xB6,
+  0xC6, 0xB5, 0xE4, 0xC5, 0xE4, 0xD4, 0x70, 0x14, 0xE4, 0x25, 0xC5, 0x34,
+  0xC4, 0x54, 0xA4, 0x65, 0x85, 0x74, 0x84, 0x94, 0x64, 0xA4, 0x55, 0xB4,
+  0x44, 0xD4, 0x24, 0xE4, 0x24, 0xF8, 0xF0, 0x26, 0xF0, 0x35, 0xF0, 0x45,
+  0xF0, 0x46, 0xF0, 0x28, 0xF4, 0x14, 0xF4, 0x24, 0xD4, 0x35, 0xB5, 0x44,
+  0xB4, 0x64, 0x94, 0x75, 0x75, 0x84, 0x74, 0xA4, 0x54, 0xB5, 0x35, 0xC4,
+  0x34, 0xE4, 0x14, 0xF5, 0x04, 0xF0, 0x15, 0x14, 0xF4, 0x25, 0xD4, 0x44,
+  0xD4, 0x45, 0xB4, 0x64, 0xA5, 0x74, 0x94, 0x85, 0x74, 0xA4, 0x74, 0xB4,
+  0x54, 0xC4, 0x54, 0xD4, 0x34, 0xE5, 0x14, 0xF0, 0x14, 0x14, 0xF0, 0x27,
+  0xF0, 0x37, 0xF0, 0x45, 0xF0, 0x63, 0xF0, 0x73, 0xF0, 0x73, 0xF0, 0x73,
+  0xF0, 0x73, 0xF0, 0x73, 0xF0, 0x73, 0xF0, 0x73, 0xF0, 0x73, 0xF0, 0x73,
+  0xF0, 0x73, 0xF0, 0x73, 0xB0, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0xF0,
+  0x25, 0xF0, 0x15, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x25, 0xF0, 0x15, 0xF0,
+  0x24, 0xF0, 0x24, 0xF0, 0x25, 0xF0, 0x15, 0xF0, 0x24, 0xF0, 0x24, 0xF0,
+  0x25, 0xF0, 0x15, 0xF0, 0x15, 0xF0, 0x24, 0xF0, 0x25, 0xF0, 0x15, 0xF0,
+  0x15, 0xF0, 0x24, 0xF0, 0x25, 0xF0, 0x15, 0xF0, 0x15, 0xF0, 0x2F, 0x0F,
+  0x0F, 0x0F, 0x06, 0x0F, 0x0D, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+  0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+  0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x4F,
+  0x09, 0x02, 0x92, 0x93, 0x92, 0x92, 0x93, 0x92, 0x92, 0x93, 0x92, 0x92,
+  0x93, 0x92, 0x92, 0x92, 0xA2, 0x92, 0x92, 0xA2, 0x92, 0x92, 0xA2, 0x92,
+  0x92, 0xA2, 0x92, 0x92, 0x93, 0x92, 0x0F, 0x06, 0x43, 0x43, 0x43, 0x43,
+  0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+  0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+  0x43, 0x43, 0x4F, 0x09, 0x54, 0xB4, 0xB5, 0x96, 0x93, 0x12, 0x83, 0x23,
+  0x73, 0x32, 0x72, 0x43, 0x53, 0x43, 0x53, 0x52, 0x43, 0x63, 0x33, 0x72,
+  0x32, 0x83, 0x13, 0x83, 0x13, 0x92, 0x10, 0x0F, 0x0F, 0x0F, 0x03, 0x05,
+  0x44, 0x54, 0x54, 0x53, 0x63, 0x67, 0x9C, 0x6E, 0x54, 0x65, 0x34, 0x84,
+  0x34, 0x93, 0xF0, 0x13, 0xF0, 0x13, 0xE5, 0x8B, 0x5E, 0x38, 0x53, 0x34,
+  0x93, 0x24, 0xA3, 0x24, 0xA3, 0x24, 0x94, 0x24, 0x85, 0x34, 0x66, 0x3C,
+  0x15, 0x2A, 0x25, 0x46, 0x54, 0x04, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4,
+  0xF4, 0xF4, 0x36, 0x64, 0x1A, 0x4F, 0x01, 0x37, 0x46, 0x26, 0x74, 0x25,
+  0x94, 0x14, 0xA4, 0x14, 0xB3, 0x14, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB3,
+  0x14, 0xA4, 0x15, 0x94, 0x16, 0x74, 0x27, 0x46, 0x2F, 0x01, 0x33, 0x2A,
+  0x43, 0x46, 0x60, 0x67, 0x9A, 0x7D, 0x45, 0x54, 0x44, 0x74, 0x24, 0x93,
+  0x23, 0xA3, 0x14, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xA4, 0x13, 0xA3,
+  0x24, 0x93, 0x24, 0x84, 0x35, 0x54, 0x5D, 0x6A, 0xA7, 0x50, 0xF4, 0xF4,
+  0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0x66, 0x34, 0x4A, 0x14, 0x3F, 0x01,
+  0x25, 0x57, 0x15, 0x76, 0x14, 0x95, 0x13, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8,
+  0xB8, 0xB8, 0xB4, 0x13, 0xB4, 0x14, 0x95, 0x15, 0x76, 0x25, 0x57, 0x3F,
+  0x01, 0x4B, 0x13, 0x68, 0x23, 0xF0, 0x40, 0x67, 0xAB, 0x7D, 0x55, 0x55,
+  0x44, 0x74, 0x34, 0x94, 0x23, 0xB3, 0x23, 0xB3, 0x14, 0xB3, 0x1F, 0x0F,
+  0x0F, 0x0F, 0x01, 0xF4, 0xF0, 0x13, 0xB3, 0x24, 0x94, 0x24, 0x94, 0x35,
+  0x55, 0x5D, 0x7B, 0xA7, 0x60, 0x54, 0x36, 0x36, 0x33, 0x63, 0x63, 0x63,
+  0x63, 0x3F, 0x0C, 0x33, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
+  0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x30, 0x66, 0x33,
+  0x4A, 0x13, 0x3F, 0x25, 0x47, 0x24, 0x75, 0x14, 0x94, 0x13, 0xA8, 0xA8,
+  0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB3, 0x13, 0xA4, 0x14, 0x94, 0x15, 0x75,
+  0x25, 0x56, 0x3B, 0x13, 0x49, 0x23, 0x65, 0x43, 0xF3, 0x13, 0xA4, 0x13,
+  0xA3, 0x24, 0x84, 0x34, 0x64, 0x5D, 0x6A, 0xB5, 0x60, 0x04, 0xD4, 0xD4,
+  0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0x36, 0x44, 0x1A, 0x2F, 0x01, 0x17,
+  0x54, 0x15, 0x89, 0x88, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
+  0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x94, 0x0C, 0xCF, 0x0F, 0x0F, 0x0F,
+  0x03, 0x34, 0x34, 0x34, 0x34, 0xF0, 0xF0, 0x14, 0x34, 0x34, 0x34, 0x34,
+  0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34,
+  0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x3A, 0x16, 0x14,
+  0x30, 0x04, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0x84, 0x24,
+  0x74, 0x34, 0x64, 0x44, 0x54, 0x54, 0x44, 0x64, 0x34, 0x74, 0x24, 0x84,
+  0x14, 0x9A, 0x8B, 0x76, 0x14, 0x75, 0x34, 0x64, 0x54, 0x54, 0x54, 0x54,
+  0x64, 0x44, 0x64, 0x44, 0x74, 0x34, 0x84, 0x24, 0x84, 0x24, 0x94, 0x14,
+  0x94, 0x10, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0B, 0xF0, 0xC3,
+  0x36, 0x66, 0x33, 0x29, 0x39, 0x13, 0x1B, 0x1F, 0x02, 0x57, 0x59, 0x75,
+  0x77, 0x84, 0x87, 0x84, 0x87, 0x84, 0x87, 0x84, 0x87, 0x84, 0x87, 0x84,
+  0x87, 0x84, 0x87, 0x84, 0x87, 0x84, 0x87, 0x84, 0x87, 0x84, 0x87, 0x84,
+  0x87, 0x84, 0x87, 0x84, 0x87, 0x84, 0x87, 0x84, 0x83, 0xF0, 0x23, 0x37,
+  0x43, 0x2A, 0x23, 0x1C, 0x17, 0x54, 0x15, 0x89, 0x88, 0x98, 0x98, 0x98,
+  0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x94,
+  0x67, 0xAB, 0x7D, 0x55, 0x55, 0x35, 0x74, 0x34, 0x94, 0x23, 0xB3, 0x14,
+  0xB3, 0x14, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB3, 0x23, 0xB3, 0x24, 0x94,
+  0x25, 0x74, 0x45, 0x55, 0x5D, 0x7B, 0xA7, 0x60, 0xF0, 0x43, 0x37, 0x63,
+  0x2A, 0x43, 0x1C, 0x37, 0x46, 0x26, 0x74, 0x25, 0x94, 0x14, 0xA4, 0x14,
+  0xB3, 0x14, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB3, 0x14, 0xA4, 0x15, 0x94,
+  0x16, 0x74, 0x27, 0x55, 0x2F, 0x01, 0x34, 0x1A, 0x44, 0x36, 0x64, 0xF4,
+  0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF0, 0x66, 0x43, 0x4A, 0x23, 0x3C,
+  0x13, 0x25, 0x57, 0x24, 0x76, 0x14, 0x95, 0x13, 0xA9, 0xB8, 0xB8, 0xB8,
+  0xB8, 0xB8, 0xB8, 0xB4, 0x13, 0xB4, 0x14, 0x95, 0x15, 0x76, 0x25, 0x57,
+  0x3F, 0x01, 0x4A, 0x14, 0x66, 0x34, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4,
+  0xF4, 0xF4, 0x03, 0x46, 0x28, 0x28, 0x1C, 0x45, 0x54, 0x64, 0x64, 0x64,
+  0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x60,
+  0x57, 0x8B, 0x5D, 0x35, 0x55, 0x24, 0x74, 0x23, 0x93, 0x23, 0xE4, 0xD6,
+  0xCA, 0x9A, 0xA9, 0xC5, 0xE8, 0xA7, 0x94, 0x14, 0x84, 0x15, 0x55, 0x3E,
+  0x4B, 0x87, 0x50, 0x33, 0x63, 0x63, 0x63, 0x63, 0x63, 0x3F, 0x0C, 0x33,
+  0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
+  0x63, 0x63, 0x66, 0x36, 0x45, 0x04, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
+  0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x89, 0x85, 0x14,
+  0x57, 0x1C, 0x13, 0x2B, 0x13, 0x47, 0x33, 0xF0, 0x20, 0x13, 0xB4, 0x14,
+  0xA3, 0x24, 0x94, 0x33, 0x94, 0x34, 0x83, 0x44, 0x74, 0x53, 0x74, 0x53,
+  0x73, 0x64, 0x54, 0x73, 0x53, 0x83, 0x53, 0x84, 0x34, 0x93, 0x33, 0xA3,
+  0x33, 0xA4, 0x14, 0xB3, 0x13, 0xC3, 0x13, 0xC6, 0xE5, 0xE5, 0xE4, 0x80,
+  0x13, 0x84, 0x84, 0x13, 0x84, 0x83, 0x24, 0x66, 0x73, 0x24, 0x66, 0x64,
+  0x33, 0x66, 0x64, 0x33, 0x66, 0x63, 0x44, 0x57, 0x53, 0x53, 0x43, 0x23,
+  0x44, 0x53, 0x43, 0x23, 0x43, 0x63, 0x43, 0x23, 0x43, 0x64, 0x33, 0x24,
+  0x33, 0x73, 0x23, 0x43, 0x24, 0x73, 0x23, 0x43, 0x23, 0x83, 0x23, 0x43,
+  0x23, 0x84, 0x13, 0x44, 0x13, 0x96, 0x66, 0xA6, 0x66, 0xA6, 0x66, 0xB5,
+  0x66, 0xB4, 0x84, 0xC4, 0x84, 0x60, 0x14, 0x94, 0x23, 0x84, 0x34, 0x73,
+  0x54, 0x54, 0x63, 0x44, 0x74, 0x33, 0x94, 0x14, 0xA3, 0x13, 0xB6, 0xD5,
+  0xD4, 0xE5, 0xC7, 0xA4, 0x13, 0xA3, 0x24, 0x84, 0x34, 0x64, 0x53, 0x63,
+  0x64, 0x44, 0x74, 0x24, 0x84, 0x23, 0xA4, 0x13, 0xB3, 0x13, 0xA4, 0x14,
+  0x93, 0x33, 0x93, 0x33, 0x84, 0x34, 0x73, 0x53, 0x64, 0x53, 0x64, 0x54,
+  0x53, 0x73, 0x44, 0x73, 0x43, 0x84, 0x33, 0x93, 0x24, 0x93, 0x23, 0xA4,
+  0x13, 0xB7, 0xB6, 0xC6, 0xD5, 0xD4, 0xE4, 0xE3, 0xF3, 0xE4, 0xE3, 0xE4,
+  0xB6, 0xC6, 0xC5, 0xB0, 0x1F, 0x2F, 0x2F, 0xD4, 0xC4, 0xC4, 0xC4, 0xD4,
+  0xC4, 0xC4, 0xC4, 0xC4, 0xD4, 0xC4, 0xC4, 0xC4, 0xC4, 0xD4, 0xCF, 0x0F,
+  0x0F, 0x06, 0x54, 0x45, 0x36, 0x33, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
+  0x63, 0x63, 0x63, 0x63, 0x54, 0x53, 0x54, 0x44, 0x53, 0x64, 0x64, 0x63,
+  0x63, 0x73, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
+  0x63, 0x66, 0x45, 0x72, 0x0F, 0x0F, 0x0F, 0x0F, 0x0E, 0x04, 0x55, 0x46,
+  0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x73,
+  0x63, 0x64, 0x64, 0x63, 0x54, 0x44, 0x53, 0x63, 0x53, 0x63, 0x63, 0x63,
+  0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x36, 0x35, 0x42, 0x70,
+  0x33, 0xC7, 0x72, 0x19, 0x52, 0x12, 0x45, 0x35, 0x5B, 0x86, 0xD2, 0x30,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x01, 0xF0, 0x77, 0x77, 0x87, 0x5B,
+  0x67, 0x4D, 0x57, 0x44, 0x55, 0x47, 0x34, 0x84, 0x37, 0x33, 0x94, 0x37,
+  0x33, 0xA3, 0x37, 0x24, 0xA3, 0x37, 0x24, 0xA3, 0x37, 0xF4, 0x37, 0xF4,
+  0x37, 0xE4, 0x47, 0xD4, 0x57, 0xC4, 0x67, 0xB4, 0x77, 0xA4, 0x87, 0x94,
+  0x97, 0x94, 0x97, 0x93, 0xA7, 0x93, 0xA7, 0x93, 0xA7, 0xF0, 0x77, 0xF0,
+  0x77, 0xF0, 0x77, 0xF0, 0x77, 0x93, 0xA7, 0x93, 0xA7, 0x93, 0xA7, 0x93,
+  0xA7, 0xF0, 0x77, 0xF0, 0x7F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x01, 0xF0, 0x77, 0x77, 0x87, 0x5B, 0x67, 0x4D,
+  0x57, 0x44, 0x55, 0x47, 0x34, 0x84, 0x37, 0x33, 0x94, 0x37, 0x33, 0xA3,
+  0x37, 0x24, 0xA3, 0x37, 0x24, 0xA3, 0x37, 0xF4, 0x37, 0xF4, 0x37, 0xE4,
+  0x47, 0xD4, 0x57, 0xC4, 0x67, 0xB4, 0x77, 0xA4, 0x87, 0x94, 0x97, 0x94,
+  0x97, 0x93, 0xA7, 0x93, 0xA7, 0x93, 0xA7, 0xF0, 0x77, 0xF0, 0x77, 0xF0,
+  0x77, 0xF0, 0x77, 0x93, 0xA7, 0x93, 0xA7, 0x93, 0xA7, 0x93, 0xA7, 0xF0,
+  0x77, 0xF0, 0x7F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x01, 0xF0, 0x77, 0x77, 0x87, 0x5B, 0x67, 0x4D, 0x57, 0x44,
+  0x55, 0x47, 0x34, 0x84, 0x37, 0x33, 0x94, 0x37, 0x33, 0xA3, 0x37, 0x24,
+  0xA3, 0x37, 0x24, 0xA3, 0x37, 0xF4, 0x37, 0xF4, 0x37, 0xE4, 0x47, 0xD4,
+  0x57, 0xC4, 0x67, 0xB4, 0x77, 0xA4, 0x87, 0x94, 0x97, 0x94, 0x97, 0x93,
+  0xA7, 0x93, 0xA7, 0x93, 0xA7, 0xF0, 0x77, 0xF0, 0x77, 0xF0, 0x77, 0xF0,
+  0x77, 0x93, 0xA7, 0x93, 0xA7, 0x93, 0xA7, 0x93, 0xA7, 0xF0, 0x77, 0xF0,
+  0x7F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x01, 0xF0, 0x77, 0x77, 0x87, 0x5B, 0x67, 0x4D, 0x57, 0x44, 0x55, 0x47,
+  0x34, 0x84, 0x37, 0x33, 0x94, 0x37, 0x33, 0xA3, 0x37, 0x24, 0xA3, 0x37,
+  0x24, 0xA3, 0x37, 0xF4, 0x37, 0xF4, 0x37, 0xE4, 0x47, 0xD4, 0x57, 0xC4,
+  0x67, 0xB4, 0x77, 0xA4, 0x87, 0x94, 0x97, 0x94, 0x97, 0x93, 0xA7, 0x93,
+  0xA7, 0x93, 0xA7, 0xF0, 0x77, 0xF0, 0x77, 0xF0, 0x77, 0xF0, 0x77, 0x93,
+  0xA7, 0x93, 0xA7, 0x93, 0xA7, 0x93, 0xA7, 0xF0, 0x77, 0xF0, 0x7F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x01, 0xF0,
+  0x77, 0x77, 0x87, 0x5B, 0x67, 0x4D, 0x57, 0x44, 0x55, 0x47, 0x34, 0x84,
+  0x37, 0x33, 0x94, 0x37, 0x33, 0xA3, 0x37, 0x24, 0xA3, 0x37, 0x24, 0xA3,
+  0x37, 0xF4, 0x37, 0xF4, 0x37, 0xE4, 0x47, 0xD4, 0x57, 0xC4, 0x67, 0xB4,
+  0x77, 0xA4, 0x87, 0x94, 0x97, 0x94, 0x97, 0x93, 0xA7, 0x93, 0xA7, 0x93,
+  0xA7, 0xF0, 0x77, 0xF0, 0x77, 0xF0, 0x77, 0xF0, 0x77, 0x93, 0xA7, 0x93,
+  0xA7, 0x93, 0xA7, 0x93, 0xA7, 0xF0, 0x77, 0xF0, 0x7F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x01, 0xF0, 0x77, 0x77,
+  0x87, 0x5B, 0x67, 0x4D, 0x57, 0x44, 0x55, 0x47, 0x34, 0x84, 0x37, 0x33,
+  0x94, 0x37, 0x33, 0xA3, 0x37, 0x24, 0xA3, 0x37, 0x24, 0xA3, 0x37, 0xF4,
+  0x37, 0xF4, 0x37, 0xE4, 0x47, 0xD4, 0x57, 0xC4, 0x67, 0xB4, 0x77, 0xA4,
+  0x87, 0x94, 0x97, 0x94, 0x97, 0x93, 0xA7, 0x93, 0xA7, 0x93, 0xA7, 0xF0,
+  0x77, 0xF0, 0x77, 0xF0, 0x77, 0xF0, 0x77, 0x93, 0xA7, 0x93, 0xA7, 0x93,
+  0xA7, 0x93, 0xA7, 0xF0, 0x77, 0xF0, 0x7F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x01, 0xF0, 0x77, 0x77, 0x87, 0x5B,
+  0x67, 0x4D, 0x57, 0x44, 0x55, 0x47, 0x34, 0x84, 0x37, 0x33, 0x94, 0x37,
+  0x33, 0xA3, 0x37, 0x24, 0xA3, 0x37, 0x24, 0xA3, 0x37, 0xF4, 0x37, 0xF4,
+  0x37, 0xE4, 0x47, 0xD4, 0x57, 0xC4, 0x67, 0xB4, 0x77, 0xA4, 0x87, 0x94,
+  0x97, 0x94, 0x97, 0x93, 0xA7, 0x93, 0xA7, 0x93, 0xA7, 0xF0, 0x77, 0xF0,
+  0x77, 0xF0, 0x77, 0xF0, 0x77, 0x93, 0xA7, 0x93, 0xA7, 0x93, 0xA7, 0x93,
+  0xA7, 0xF0, 0x77, 0xF0, 0x7F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x01, 0xF0, 0x77, 0x77, 0x87, 0x5B, 0x67, 0x4D,
+  0x57, 0x44, 0x55, 0x47, 0x34, 0x84, 0x37, 0x33, 0x94, 0x37, 0x33, 0xA3,
+  0x37, 0x24, 0xA3, 0x37, 0x24, 0xA3, 0x37, 0xF4, 0x37, 0xF4, 0x37, 0xE4,
+  0x47, 0xD4, 0x57, 0xC4, 0x67, 0xB4, 0x77, 0xA4, 0x87, 0x94, 0x97, 0x94,
+  0x97, 0x93, 0xA7, 0x93, 0xA7, 0x93, 0xA7, 0xF0, 0x77, 0xF0, 0x77, 0xF0,
+  0x77, 0xF0, 0x77, 0x93, 0xA7, 0x93, 0xA7, 0x93, 0xA7, 0x93, 0xA7, 0xF0,
+  0x77, 0xF0, 0x7F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x01, 0xF0, 0x77, 0x77, 0x87, 0x5B, 0x67, 0x4D, 0x57, 0x44,
+  0x55, 0x47, 0x34, 0x84, 0x37, 0x33, 0x94, 0x37, 0x33, 0xA3, 0x37, 0x24,
+  0xA3, 0x37, 0x24, 0xA3, 0x37, 0xF4, 0x37, 0xF4, 0x37, 0xE4, 0x47, 0xD4,
+  0x57, 0xC4, 0x67, 0xB4, 0x77, 0xA4, 0x87, 0x94, 0x97, 0x94, 0x97, 0x93,
+  0xA7, 0x93, 0xA7, 0x93, 0xA7, 0xF0, 0x77, 0xF0, 0x77, 0xF0, 0x77, 0xF0,
+  0x77, 0x93, 0xA7, 0x93, 0xA7, 0x93, 0xA7, 0x93, 0xA7, 0xF0, 0x77, 0xF0,
+  0x7F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x01, 0xF0, 0x77, 0x77, 0x87, 0x5B, 0x67, 0x4D, 0x57, 0x44, 0x55, 0x47,
+  0x34, 0x84, 0x37, 0x33, 0x94, 0x37, 0x33, 0xA3, 0x37, 0x24, 0xA3, 0x37,
+  0x24, 0xA3, 0x37, 0xF4, 0x37, 0xF4, 0x37, 0xE4, 0x47, 0xD4, 0x57, 0xC4,
+  0x67, 0xB4, 0x77, 0xA4, 0x87, 0x94, 0x97, 0x94, 0x97, 0x93, 0xA7, 0x93,
+  0xA7, 0x93, 0xA7, 0xF0, 0x77, 0xF0, 0x77, 0xF0, 0x77, 0xF0, 0x77, 0x93,
+  0xA7, 0x93, 0xA7, 0x93, 0xA7, 0x93, 0xA7, 0xF0, 0x77, 0xF0, 0x7F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x01, 0xF0,
+  0x77, 0x77, 0x87, 0x5B, 0x67, 0x4D, 0x57, 0x44, 0x55, 0x47, 0x34, 0x84,
+  0x37, 0x33, 0x94, 0x37, 0x33, 0xA3, 0x37, 0x24, 0xA3, 0x37, 0x24, 0xA3,
+  0x37, 0xF4, 0x37, 0xF4, 0x37, 0xE4, 0x47, 0xD4, 0x57, 0xC4, 0x67, 0xB4,
+  0x77, 0xA4, 0x87, 0x94, 0x97, 0x94, 0x97, 0x93, 0xA7, 0x93, 0xA7, 0x93,
+  0xA7, 0xF0, 0x77, 0xF0, 0x77, 0xF0, 0x77, 0xF0, 0x77, 0x93, 0xA7, 0x93,
+  0xA7, 0x93, 0xA7, 0x93, 0xA7, 0xF0, 0x77, 0xF0, 0x7F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x01, 0xF0, 0x77, 0x77,
+  0x87, 0x5B, 0x67, 0x4D, 0x57, 0x44, 0x55, 0x47, 0x34, 0x84, 0x37, 0x33,
+  0x94, 0x37, 0x33, 0xA3, 0x37, 0x24, 0xA3, 0x37, 0x24, 0xA3, 0x37, 0xF4,
+  0x37, 0xF4, 0x37, 0xE4, 0x47, 0xD4, 0x57, 0xC4, 0x67, 0xB4, 0x77, 0xA4,
+  0x87, 0x94, 0x97, 0x94, 0x97, 0x93, 0xA7, 0x93, 0xA7, 0x93, 0xA7, 0xF0,
+  0x77, 0xF0, 0x77, 0xF0, 0x77, 0xF0, 0x77, 0x93, 0xA7, 0x93, 0xA7, 0x93,
+  0xA7, 0x93, 0xA7, 0xF0, 0x77, 0xF0, 0x7F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x01, 0xF0, 0x77, 0x77, 0x87, 0x5B,
+  0x67, 0x4D, 0x57, 0x44, 0x55, 0x47, 0x34, 0x84, 0x37, 0x33, 0x94, 0x37,
+  0x33, 0xA3, 0x37, 0x24, 0xA3, 0x37, 0x24, 0xA3, 0x37, 0xF4, 0x37, 0xF4,
+  0x37, 0xE4, 0x47, 0xD4, 0x57, 0xC4, 0x67, 0xB4, 0x77, 0xA4, 0x87, 0x94,
+  0x97, 0x94, 0x97, 0x93, 0xA7, 0x93, 0xA7, 0x93, 0xA7, 0xF0, 0x77, 0xF0,
+  0x77, 0xF0, 0x77, 0xF0, 0x77, 0x93, 0xA7, 0x93, 0xA7, 0x93, 0xA7, 0x93,
+  0xA7, 0xF0, 0x77, 0xF0, 0x7F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x01, 0xF0, 0x77, 0x77, 0x87, 0x5B, 0x67, 0x4D,
+  0x57, 0x44, 0x55, 0x47, 0x34, 0x84, 0x37, 0x33, 0x94, 0x37, 0x33, 0xA3,
+  0x37, 0x24, 0xA3, 0x37, 0x24, 0xA3, 0x37, 0xF4, 0x37, 0xF4, 0x37, 0xE4,
+  0x47, 0xD4, 0x57, 0xC4, 0x67, 0xB4, 0x77, 0xA4, 0x87, 0x94, 0x97, 0x94,
+  0x97, 0x93, 0xA7, 0x93, 0xA7, 0x93, 0xA7, 0xF0, 0x77, 0xF0, 0x77, 0xF0,
+  0x77, 0xF0, 0x77, 0x93, 0xA7, 0x93, 0xA7, 0x93, 0xA7, 0x93, 0xA7, 0xF0,
+  0x77, 0xF0, 0x7F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x01, 0xF0, 0x77, 0x77, 0x87, 0x5B, 0x67, 0x4D, 0x57, 0x44,
+  0x55, 0x47, 0x34, 0x84, 0x37, 0x33, 0x94, 0x37, 0x33, 0xA3, 0x37, 0x24,
+  0xA3, 0x37, 0x24, 0xA3, 0x37, 0xF4, 0x37, 0xF4, 0x37, 0xE4, 0x47, 0xD4,
+  0x57, 0xC4, 0x67, 0xB4, 0x77, 0xA4, 0x87, 0x94, 0x97, 0x94, 0x97, 0x93,
+  0xA7, 0x93, 0xA7, 0x93, 0xA7, 0xF0, 0x77, 0xF0, 0x77, 0xF0, 0x77, 0xF0,
+  0x77, 0x93, 0xA7, 0x93, 0xA7, 0x93, 0xA7, 0x93, 0xA7, 0xF0, 0x77, 0xF0,
+  0x7F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x01, 0xF0, 0x77, 0x77, 0x87, 0x5B, 0x67, 0x4D, 0x57, 0x44, 0x55, 0x47,
+  0x34, 0x84, 0x37, 0x33, 0x94, 0x37, 0x33, 0xA3, 0x37, 0x24, 0xA3, 0x37,
+  0x24, 0xA3, 0x37, 0xF4, 0x37, 0xF4, 0x37, 0xE4, 0x47, 0xD4, 0x57, 0xC4,
+  0x67, 0xB4, 0x77, 0xA4, 0x87, 0x94, 0x97, 0x94, 0x97, 0x93, 0xA7, 0x93,
+  0xA7, 0x93, 0xA7, 0xF0, 0x77, 0xF0, 0x77, 0xF0, 0x77, 0xF0, 0x77, 0x93,
+  0xA7, 0x93, 0xA7, 0x93, 0xA7, 0x93, 0xA7, 0xF0, 0x77, 0xF0, 0x7F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x01, 0xF0,
+  0x77, 0x77, 0x87, 0x5B, 0x67, 0x4D, 0x57, 0x44, 0x55, 0x47, 0x34, 0x84,
+  0x37, 0x33, 0x94, 0x37, 0x33, 0xA3, 0x37, 0x24, 0xA3, 0x37, 0x24, 0xA3,
+  0x37, 0xF4, 0x37, 0xF4, 0x37, 0xE4, 0x47, 0xD4, 0x57, 0xC4, 0x67, 0xB4,
+  0x77, 0xA4, 0x87, 0x94, 0x97, 0x94, 0x97, 0x93, 0xA7, 0x93, 0xA7, 0x93,
+  0xA7, 0xF0, 0x77, 0xF0, 0x77, 0xF0, 0x77, 0xF0, 0x77, 0x93, 0xA7, 0x93,
+  0xA7, 0x93, 0xA7, 0x93, 0xA7, 0xF0, 0x77, 0xF0, 0x7F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x01, 0xF0, 0x77, 0x77,
+  0x87, 0x5B, 0x67, 0x4D, 0x57, 0x44, 0x55, 0x47, 0x34, 0x84, 0x37, 0x33,
+  0x94, 0x37, 0x33, 0xA3, 0x37, 0x24, 0xA3, 0x37, 0x24, 0xA3, 0x37, 0xF4,
+  0x37, 0xF4, 0x37, 0xE4, 0x47, 0xD4, 0x57, 0xC4, 0x67, 0xB4, 0x77, 0xA4,
+  0x87, 0x94, 0x97, 0x94, 0x97, 0x93, 0xA7, 0x93, 0xA7, 0x93, 0xA7, 0xF0,
+  0x77, 0xF0, 0x77, 0xF0, 0x77, 0xF0, 0x77, 0x93, 0xA7, 0x93, 0xA7, 0x93,
+  0xA7, 0x93, 0xA7, 0xF0, 0x77, 0xF0, 0x7F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x01, 0xF0, 0x77, 0x77, 0x87, 0x5B,
+  0x67, 0x4D, 0x57, 0x44, 0x55, 0x47, 0x34, 0x84, 0x37, 0x33, 0x94, 0x37,
+  0x33, 0xA3, 0x37, 0x24, 0xA3, 0x37, 0x24, 0xA3, 0x37, 0xF4, 0x37, 0xF4,
+  0x37, 0xE4, 0x47, 0xD4, 0x57, 0xC4, 0x67, 0xB4, 0x77, 0xA4, 0x87, 0x94,
+  0x97, 0x94, 0x97, 0x93, 0xA7, 0x93, 0xA7, 0x93, 0xA7, 0xF0, 0x77, 0xF0,
+  0x77, 0xF0, 0x77, 0xF0, 0x77, 0x93, 0xA7, 0x93, 0xA7, 0x93, 0xA7, 0x93,
+  0xA7, 0xF0, 0x77, 0xF0, 0x7F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x01, 0xF0, 0x77, 0x77, 0x87, 0x5B, 0x67, 0x4D,
+  0x57, 0x44, 0x55, 0x47, 0x34, 0x84, 0x37, 0x33, 0x94, 0x37, 0x33, 0xA3,
+  0x37, 0x24, 0xA3, 0x37, 0x24, 0xA3, 0x37, 0xF4, 0x37, 0xF4, 0x37, 0xE4,
+  0x47, 0xD4, 0x57, 0xC4, 0x67, 0xB4, 0x77, 0xA4, 0x87, 0x94, 0x97, 0x94,
+  0x97, 0x93, 0xA7, 0x93, 0xA7, 0x93, 0xA7, 0xF0, 0x77, 0xF0, 0x77, 0xF0,
+  0x77, 0xF0, 0x77, 0x93, 0xA7, 0x93, 0xA7, 0x93, 0xA7, 0x93, 0xA7, 0xF0,
+  0x77, 0xF0, 0x7F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x01, 0xF0, 0x77, 0x77, 0x87, 0x5B, 0x67, 0x4D, 0x57, 0x44,
+  0x55, 0x47, 0x34, 0x84, 0x37, 0x33, 0x94, 0x37, 0x33, 0xA3, 0x37, 0x24,
+  0xA3, 0x37, 0x24, 0xA3, 0x37, 0xF4, 0x37, 0xF4, 0x37, 0xE4, 0x47, 0xD4,
+  0x57, 0xC4, 0x67, 0xB4, 0x77, 0xA4, 0x87, 0x94, 0x97, 0x94, 0x97, 0x93,
+  0xA7, 0x93, 0xA7, 0x93, 0xA7, 0xF0, 0x77, 0xF0, 0x77, 0xF0, 0x77, 0xF0,
+  0x77, 0x93, 0xA7, 0x93, 0xA7, 0x93, 0xA7, 0x93, 0xA7, 0xF0, 0x77, 0xF0,
+  0x7F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x01, 0xF0, 0x77, 0x77, 0x87, 0x5B, 0x67, 0x4D, 0x57, 0x44, 0x55, 0x47,
+  0x34, 0x84, 0x37, 0x33, 0x94, 0x37, 0x33, 0xA3, 0x37, 0x24, 0xA3, 0x37,
+  0x24, 0xA3, 0x37, 0xF4, 0x37, 0xF4, 0x37, 0xE4, 0x47, 0xD4, 0x57, 0xC4,
+  0x67, 0xB4, 0x77, 0xA4, 0x87, 0x94, 0x97, 0x94, 0x97, 0x93, 0xA7, 0x93,
+  0xA7, 0x93, 0xA7, 0xF0, 0x77, 0xF0, 0x77, 0xF0, 0x77, 0xF0, 0x77, 0x93,
+  0xA7, 0x93, 0xA7, 0x93, 0xA7, 0x93, 0xA7, 0xF0, 0x77, 0xF0, 0x7F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x01, 0xF0,
+  0x77, 0x77, 0x87, 0x5B, 0x67, 0x4D, 0x57, 0x44, 0x55, 0x47, 0x34, 0x84,
+  0x37, 0x33, 0x94, 0x37, 0x33, 0xA3, 0x37, 0x24, 0xA3, 0x37, 0x24, 0xA3,
+  0x37, 0xF4, 0x37, 0xF4, 0x37, 0xE4, 0x47, 0xD4, 0x57, 0xC4, 0x67, 0xB4,
+  0x77, 0xA4, 0x87, 0x94, 0x97, 0x94, 0x97, 0x93, 0xA7, 0x93, 0xA7, 0x93,
+  0xA7, 0xF0, 0x77, 0xF0, 0x77, 0xF0, 0x77, 0xF0, 0x77, 0x93, 0xA7, 0x93,
+  0xA7, 0x93, 0xA7, 0x93, 0xA7, 0xF0, 0x77, 0xF0, 0x7F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x01, 0xF0, 0x77, 0x77,
+  0x87, 0x5B, 0x67, 0x4D, 0x57, 0x44, 0x55, 0x47, 0x34, 0x84, 0x37, 0x33,
+  0x94, 0x37, 0x33, 0xA3, 0x37, 0x24, 0xA3, 0x37, 0x24, 0xA3, 0x37, 0xF4,
+  0x37, 0xF4, 0x37, 0xE4, 0x47, 0xD4, 0x57, 0xC4, 0x67, 0xB4, 0x77, 0xA4,
+  0x87, 0x94, 0x97, 0x94, 0x97, 0x93, 0xA7, 0x93, 0xA7, 0x93, 0xA7, 0xF0,
+  0x77, 0xF0, 0x77, 0xF0, 0x77, 0xF0, 0x77, 0x93, 0xA7, 0x93, 0xA7, 0x93,
+  0xA7, 0x93, 0xA7, 0xF0, 0x77, 0xF0, 0x7F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x01, 0xF0, 0x77, 0x77, 0x87, 0x5B,
+  0x67, 0x4D, 0x57, 0x44, 0x55, 0x47, 0x34, 0x84, 0x37, 0x33, 0x94, 0x37,
+  0x33, 0xA3, 0x37, 0x24, 0xA3, 0x37, 0x24, 0xA3, 0x37, 0xF4, 0x37, 0xF4,
+  0x37, 0xE4, 0x47, 0xD4, 0x57, 0xC4, 0x67, 0xB4, 0x77, 0xA4, 0x87, 0x94,
+  0x97, 0x94, 0x97, 0x93, 0xA7, 0x93, 0xA7, 0x93, 0xA7, 0xF0, 0x77, 0xF0,
+  0x77, 0xF0, 0x77, 0xF0, 0x77, 0x93, 0xA7, 0x93, 0xA7, 0x93, 0xA7, 0x93,
+  0xA7, 0xF0, 0x77, 0xF0, 0x7F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x01, 0xF0, 0x77, 0x77, 0x87, 0x5B, 0x67, 0x4D,
+  0x57, 0x44, 0x55, 0x47, 0x34, 0x84, 0x37, 0x33, 0x94, 0x37, 0x33, 0xA3,
+  0x37, 0x24, 0xA3, 0x37, 0x24, 0xA3, 0x37, 0xF4, 0x37, 0xF4, 0x37, 0xE4,
+  0x47, 0xD4, 0x57, 0xC4, 0x67, 0xB4, 0x77, 0xA4, 0x87, 0x94, 0x97, 0x94,
+  0x97, 0x93, 0xA7, 0x93, 0xA7, 0x93, 0xA7, 0xF0, 0x77, 0xF0, 0x77, 0xF0,
+  0x77, 0xF0, 0x77, 0x93, 0xA7, 0x93, 0xA7, 0x93, 0xA7, 0x93, 0xA7, 0xF0,
+  0x77, 0xF0, 0x7F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x01, 0xF0, 0x77, 0x77, 0x87, 0x5B, 0x67, 0x4D, 0x57, 0x44,
+  0x55, 0x47, 0x34, 0x84, 0x37, 0x33, 0x94, 0x37, 0x33, 0xA3, 0x37, 0x24,
+  0xA3, 0x37, 0x24, 0xA3, 0x37, 0xF4, 0x37, 0xF4, 0x37, 0xE4, 0x47, 0xD4,
+  0x57, 0xC4, 0x67, 0xB4, 0x77, 0xA4, 0x87, 0x94, 0x97, 0x94, 0x97, 0x93,
+  0xA7, 0x93, 0xA7, 0x93, 0xA7, 0xF0, 0x77, 0xF0, 0x77, 0xF0, 0x77, 0xF0,
+  0x77, 0x93, 0xA7, 0x93, 0xA7, 0x93, 0xA7, 0x93, 0xA7, 0xF0, 0x77, 0xF0,
+  0x7F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x01, 0xF0, 0x77, 0x77, 0x87, 0x5B, 0x67, 0x4D, 0x57, 0x44, 0x55, 0x47,
+  0x34, 0x84, 0x37, 0x33, 0x94, 0x37, 0x33, 0xA3, 0x37, 0x24, 0xA3, 0x37,
+  0x24, 0xA3, 0x37, 0xF4, 0x37, 0xF4, 0x37, 0xE4, 0x47, 0xD4, 0x57, 0xC4,
+  0x67, 0xB4, 0x77, 0xA4, 0x87, 0x94, 0x97, 0x94, 0x97, 0x93, 0xA7, 0x93,
+  0xA7, 0x93, 0xA7, 0xF0, 0x77, 0xF0, 0x77, 0xF0, 0x77, 0xF0, 0x77, 0x93,
+  0xA7, 0x93, 0xA7, 0x93, 0xA7, 0x93, 0xA7, 0xF0, 0x77, 0xF0, 0x7F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x01, 0xF0,
+  0x77, 0x77, 0x87, 0x5B, 0x67, 0x4D, 0x57, 0x44, 0x55, 0x47, 0x34, 0x84,
+  0x37, 0x33, 0x94, 0x37, 0x33, 0xA3, 0x37, 0x24, 0xA3, 0x37, 0x24, 0xA3,
+  0x37, 0xF4, 0x37, 0xF4, 0x37, 0xE4, 0x47, 0xD4, 0x57, 0xC4, 0x67, 0xB4,
+  0x77, 0xA4, 0x87, 0x94, 0x97, 0x94, 0x97, 0x93, 0xA7, 0x93, 0xA7, 0x93,
+  0xA7, 0xF0, 0x77, 0xF0, 0x77, 0xF0, 0x77, 0xF0, 0x77, 0x93, 0xA7, 0x93,
+  0xA7, 0x93, 0xA7, 0x93, 0xA7, 0xF0, 0x77, 0xF0, 0x7F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x01, 0xF0, 0x77, 0x77,
+  0x87, 0x5B, 0x67, 0x4D, 0x57, 0x44, 0x55, 0x47, 0x34, 0x84, 0x37, 0x33,
+  0x94, 0x37, 0x33, 0xA3, 0x37, 0x24, 0xA3, 0x37, 0x24, 0xA3, 0x37, 0xF4,
+  0x37, 0xF4, 0x37, 0xE4, 0x47, 0xD4, 0x57, 0xC4, 0x67, 0xB4, 0x77, 0xA4,
+  0x87, 0x94, 0x97, 0x94, 0x97, 0x93, 0xA7, 0x93, 0xA7, 0x93, 0xA7, 0xF0,
+  0x77, 0xF0, 0x77, 0xF0, 0x77, 0xF0, 0x77, 0x93, 0xA7, 0x93, 0xA7, 0x93,
+  0xA7, 0x93, 0xA7, 0xF0, 0x77, 0xF0, 0x7F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x01, 0xF0, 0x77, 0x77, 0x87, 0x5B,
+  0x67, 0x4D, 0x57, 0x44, 0x55, 0x47, 0x34, 0x84, 0x37, 0x33, 0x94, 0x37,
+  0x33, 0xA3, 0x37, 0x24, 0xA3, 0x37, 0x24, 0xA3, 0x37, 0xF4, 0x37, 0xF4,
+  0x37, 0xE4, 0x47, 0xD4, 0x57, 0xC4, 0x67, 0xB4, 0x77, 0xA4, 0x87, 0x94,
+  0x97, 0x94, 0x97, 0x93, 0xA7, 0x93, 0xA7, 0x93, 0xA7, 0xF0, 0x77, 0xF0,
+  0x77, 0xF0, 0x77, 0xF0, 0x77, 0x93, 0xA7, 0x93, 0xA7, 0x93, 0xA7, 0x93,
+  0xA7, 0xF0, 0x77, 0xF0, 0x7F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x01, 0xF0, 0x77, 0x77, 0x87, 0x5B, 0x67, 0x4D,
+  0x57, 0x44, 0x55, 0x47, 0x34, 0x84, 0x37, 0x33, 0x94, 0x37, 0x33, 0xA3,
+  0x37, 0x24, 0xA3, 0x37, 0x24, 0xA3, 0x37, 0xF4, 0x37, 0xF4, 0x37, 0xE4,
+  0x47, 0xD4, 0x57, 0xC4, 0x67, 0xB4, 0x77, 0xA4, 0x87, 0x94, 0x97, 0x94,
+  0x97, 0x93, 0xA7, 0x93, 0xA7, 0x93, 0xA7, 0xF0, 0x77, 0xF0, 0x77, 0xF0,
+  0x77, 0xF0, 0x77, 0x93, 0xA7, 0x93, 0xA7, 0x93, 0xA7, 0x93, 0xA7, 0xF0,
+  0x77, 0xF0, 0x7F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x01, 0xF0, 0x77, 0x77, 0x87, 0x5B, 0x67, 0x4D, 0x57, 0x44,
+  0x55, 0x47, 0x34, 0x84, 0x37, 0x33, 0x94, 0x37, 0x33, 0xA3, 0x37, 0x24,
+  0xA3, 0x37, 0x24, 0xA3, 0x37, 0xF4, 0x37, 0xF4, 0x37, 0xE4, 0x47, 0xD4,
+  0x57, 0xC4, 0x67, 0xB4, 0x77, 0xA4, 0x87, 0x94, 0x97, 0x94, 0x97, 0x93,
+  0xA7, 0x93, 0xA7, 0x93, 0xA7, 0xF0, 0x77, 0xF0, 0x77, 0xF0, 0x77, 0xF0,
+  0x77, 0x93, 0xA7, 0x93, 0xA7, 0x93, 0xA7, 0x93, 0xA7, 0xF0, 0x77, 0xF0,
+  0x7F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x10, 0x0F, 0x71, 0x12, 0x12, 0x1F,
+  0x0F, 0x0F, 0x0C, 0x91, 0xF0, 0x21, 0xF0, 0x21, 0xF0, 0x21, 0xE7, 0x9B,
+  0x6D, 0x45, 0x21, 0x25, 0x25, 0x31, 0x34, 0x24, 0x41, 0x43, 0x23, 0x51,
+  0x48, 0x51, 0x84, 0x51, 0x83, 0x61, 0x83, 0x61, 0x83, 0x61, 0x84, 0x51,
+  0x84, 0x51, 0x53, 0x13, 0x51, 0x44, 0x14, 0x41, 0x44, 0x14, 0x41, 0x34,
+  0x35, 0x21, 0x25, 0x4D, 0x6B, 0x97, 0xE1, 0xF0, 0x21, 0xF0, 0x21, 0xF0,
+  0x21, 0x80, 0x77, 0xBB, 0x8D, 0x65, 0x55, 0x44, 0x84, 0x43, 0xA4, 0x24,
+  0xA4, 0x24, 0xA4, 0x24, 0xA4, 0x24, 0xF0, 0x14, 0xF0, 0x24, 0xF0, 0x14,
+  0xF0, 0x24, 0xDD, 0x7D, 0xC3, 0xF0, 0x23, 0xF0, 0x24, 0xF0, 0x13, 0xF0,
+  0x23, 0xF0, 0x14, 0xF0, 0x13, 0xF0, 0x13, 0xF0, 0x13, 0x16, 0x9F, 0x03,
+  0x2F, 0x04, 0x14, 0x4A, 0x31, 0x95, 0x30, 0x11, 0xB1, 0x23, 0x25, 0x23,
+  0x1F, 0x01, 0x1E, 0x25, 0x44, 0x34, 0x64, 0x23, 0x83, 0x14, 0x83, 0x14,
+  0x83, 0x23, 0x83, 0x24, 0x63, 0x35, 0x44, 0x3E, 0x1F, 0x01, 0x13, 0x15,
+  0x23, 0x31, 0xA1, 0x20, 0x13, 0xE3, 0x14, 0xC3, 0x33, 0xC3, 0x43, 0xA3,
+  0x54, 0x84, 0x63, 0x83, 0x74, 0x63, 0x93, 0x63, 0xA3, 0x43, 0xB4, 0x24,
+  0xC3, 0x23, 0xE6, 0xF6, 0xAF, 0x01, 0x5F, 0x01, 0xB4, 0xF0, 0x24, 0xF0,
+  0x24, 0xBF, 0x01, 0x5F, 0x01, 0xB4, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24,
+  0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0x80, 0x0F, 0x0F, 0x02, 0xAF, 0x0F,
+  0x02, 0x66, 0xB9, 0x7C, 0x64, 0x44, 0x54, 0x64, 0x44, 0x73, 0x44, 0x73,
+  0x44, 0x73, 0x45, 0xE5, 0xE5, 0xB9, 0x84, 0x16, 0x64, 0x46, 0x43, 0x66,
+  0x33, 0x85, 0x23, 0x95, 0x13, 0xA4, 0x14, 0xA9, 0x94, 0x15, 0x93, 0x16,
+  0x83, 0x27, 0x53, 0x56, 0x43, 0x66, 0x23, 0x98, 0xB6, 0xD5, 0xF4, 0xF3,
+  0x43, 0x84, 0x34, 0x74, 0x34, 0x73, 0x54, 0x54, 0x5C, 0x7A, 0xA6, 0x70,
+  0x04, 0x38, 0x38, 0x38, 0x34, 0xA8, 0xF0, 0x2D, 0xD6, 0x56, 0xA5, 0xA4,
+  0x84, 0x53, 0x63, 0x64, 0x48, 0x43, 0x53, 0x3B, 0x43, 0x33, 0x43, 0x54,
+  0x42, 0x23, 0x43, 0x73, 0x43, 0x13, 0x42, 0x92, 0x52, 0x12, 0x43, 0xF0,
+  0x12, 0x12, 0x43, 0xF0, 0x15, 0x43, 0xF0, 0x15, 0x43, 0xF0, 0x15, 0x43,
+  0xF0, 0x15, 0x43, 0x93, 0x45, 0x43, 0x93, 0x42, 0x13, 0x43, 0x82, 0x52,
+  0x22, 0x43, 0x73, 0x43, 0x23, 0x44, 0x44, 0x42, 0x43, 0x4A, 0x43, 0x44,
+  0x47, 0x53, 0x64, 0xE3, 0x85, 0xA4, 0xA7, 0x46, 0xDD, 0xF0, 0x38, 0xA0,
+  0x36, 0x58, 0x33, 0x43, 0x22, 0x53, 0x93, 0x66, 0x39, 0x23, 0x52, 0x13,
+  0x62, 0x13, 0x53, 0x22, 0x44, 0x27, 0x13, 0x25, 0x23, 0xF0, 0xAB, 0x1B,
+  0x51, 0x71, 0x42, 0x62, 0x33, 0x53, 0x14, 0x44, 0x14, 0x44, 0x23, 0x53,
+  0x32, 0x62, 0x43, 0x53, 0x34, 0x44, 0x34, 0x44, 0x43, 0x53, 0x42, 0x62,
+  0x51, 0x71, 0x0F, 0x0F, 0x0F, 0x0C, 0xF0, 0x22, 0xF0, 0x22, 0xF0, 0x22,
+  0xF0, 0x22, 0xF0, 0x22, 0xF0, 0x22, 0xF0, 0x22, 0xF0, 0x22, 0xF0, 0x22,
+  0x0F, 0x0C, 0xA8, 0xF0, 0x2D, 0xD6, 0x56, 0xA5, 0xA4, 0x84, 0xE3, 0x64,
+  0x1B, 0x43, 0x53, 0x2C, 0x43, 0x33, 0x33, 0x73, 0x42, 0x23, 0x43, 0x73,
+  0x43, 0x13, 0x43, 0x82, 0x52, 0x12, 0x53, 0x82, 0x52, 0x12, 0x53, 0x73,
+  0x55, 0x5C, 0x65, 0x5B, 0x75, 0x5C, 0x65, 0x53, 0x73, 0x55, 0x53, 0x73,
+  0x52, 0x13, 0x43, 0x73, 0x52, 0x22, 0x43, 0x73, 0x43, 0x23, 0x33, 0x73,
+  0x42, 0x43, 0x23, 0x82, 0x33, 0x44, 0x13, 0x83, 0x13, 0x64, 0xE3, 0x85,
+  0xA4, 0xA7, 0x46, 0xDD, 0xF0, 0x38, 0xA0, 0x0F, 0x0F, 0x03, 0x35, 0x68,
+  0x34, 0x24, 0x13, 0x62, 0x12, 0x75, 0x75, 0x75, 0x76, 0x62, 0x23, 0x34,
+  0x38, 0x55, 0x40, 0x83, 0xF0, 0x13, 0xF0, 0x13, 0xF0, 0x13, 0xF0, 0x13,
+  0xF0, 0x13, 0xF0, 0x13, 0xF0, 0x13, 0x8F, 0x0F, 0x0F, 0x0C, 0x83, 0xF0,
+  0x13, 0xF0, 0x13, 0xF0, 0x13, 0xF0, 0x13, 0xF0, 0x13, 0xF0, 0x13, 0xF0,
+  0x13, 0xF0, 0xF0, 0xF0, 0xF0, 0x5F, 0x0F, 0x0F, 0x0C, 0x36, 0x58, 0x33,
+  0x43, 0x13, 0x66, 0x66, 0x63, 0x93, 0x83, 0x83, 0x74, 0x64, 0x74, 0x73,
+  0x83, 0x93, 0x9F, 0x09, 0x35, 0x59, 0x33, 0x34, 0x13, 0x53, 0x12, 0x72,
+  0x93, 0x93, 0x56, 0x66, 0xA3, 0xA2, 0xA5, 0x75, 0x72, 0x13, 0x53, 0x29,
+  0x56, 0x30, 0x34, 0x34, 0x43, 0x43, 0x43, 0x52, 0x60, 0x03, 0xA3, 0x23,
+  0xA3, 0x23, 0xA3, 0x23, 0xA3, 0x23, 0xA3, 0x23, 0xA3, 0x23, 0xA3, 0x23,
+  0xA3, 0x23, 0xA3, 0x23, 0xA3, 0x23, 0xA3, 0x23, 0xA3, 0x23, 0x94, 0x23,
+  0x94, 0x23, 0x94, 0x23, 0x94, 0x23, 0x85, 0x24, 0x66, 0x2C, 0x1F, 0x01,
+  0x28, 0x15, 0x57, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF0, 0x6C,
+  0x4E, 0x3F, 0x28, 0x42, 0x39, 0x42, 0x39, 0x42, 0x2A, 0x42, 0x2A, 0x42,
+  0x2A, 0x42, 0x2A, 0x42, 0x2A, 0x42, 0x2A, 0x42, 0x2A, 0x42, 0x39, 0x42,
+  0x39, 0x42, 0x48, 0x42, 0x57, 0x42, 0x66, 0x42, 0xA2, 0x42, 0xA2, 0x42,
+  0xA2, 0x42, 0xA2, 0x42, 0xA2, 0x42, 0xA2, 0x42, 0xA2, 0x42, 0xA2, 0x42,
+  0xA2, 0x42, 0xA2, 0x42, 0xA2, 0x42, 0xA2, 0x42, 0xA2, 0x42, 0xA2, 0x42,
+  0xA2, 0x42, 0xA2, 0x42, 0xA2, 0x42, 0xA2, 0x42, 0x20, 0x0F, 0x01, 0x42,
+  0x71, 0x75, 0x41, 0x14, 0x63, 0x65, 0x4B, 0x51, 0x40, 0x42, 0x42, 0x3F,
+  0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x35,
+  0x48, 0x23, 0x43, 0x13, 0x52, 0x12, 0x62, 0x12, 0x65, 0x65, 0x65, 0x62,
+  0x13, 0x52, 0x13, 0x43, 0x28, 0x55, 0xF0, 0xAA, 0x1A, 0x10, 0x01, 0x71,
+  0x52, 0x62, 0x43, 0x53, 0x34, 0x44, 0x44, 0x44, 0x33, 0x53, 0x42, 0x62,
+  0x24, 0x53, 0x14, 0x44, 0x14, 0x44, 0x23, 0x53, 0x32, 0x62, 0xF0, 0x30,
+  0x52, 0xF0, 0xE2, 0xF0, 0x12, 0xA3, 0xF2, 0x77, 0xF2, 0x77, 0xE2, 0xC3,
+  0xD3, 0xC3, 0xD2, 0xD3, 0xC2, 0xE3, 0xB3, 0xE3, 0xB2, 0xF3, 0xA2, 0xF0,
+  0x13, 0x93, 0xF0, 0x13, 0x92, 0x83, 0x63, 0x83, 0x74, 0x63, 0x82, 0x84,
+  0x63, 0x72, 0x85, 0xF3, 0x72, 0x13, 0xF2, 0x73, 0x13, 0xE2, 0x73, 0x23,
+  0xD3, 0x72, 0x33, 0xD2, 0x72, 0x43, 0xC2, 0x73, 0x43, 0xB3, 0x7C, 0x92,
+  0x8C, 0x83, 0xF3, 0xA2, 0xF0, 0x13, 0x92, 0xF0, 0x23, 0x83, 0xF0, 0x23,
+  0x82, 0xF0, 0x80, 0x52, 0xF0, 0xE2, 0xF0, 0xD3, 0xF2, 0xA4, 0xE3, 0x77,
+  0xE2, 0x87, 0xD2, 0xD3, 0xC3, 0xD3, 0xC2, 0xE3, 0xB2, 0xF3, 0xA3, 0xF3,
+  0xA2, 0xF0, 0x13, 0x92, 0xF0, 0x23, 0x83, 0xF0, 0x23, 0x82, 0x56, 0x73,
+  0x72, 0x59, 0x53, 0x63, 0x43, 0x43, 0x53, 0x62, 0x52, 0x63, 0x43, 0x52,
+  0x62, 0x72, 0xB3, 0x53, 0x63, 0xB2, 0xF3, 0xA2, 0xE4, 0xA3, 0xC5, 0xB2,
+  0xC4, 0xC2, 0xB4, 0xD3, 0xA4, 0xE2, 0xB3, 0xE2, 0xB3, 0xF2, 0xBC, 0x52,
+  0xCC, 0x36, 0xF0, 0xA8, 0xF0, 0x83, 0x43, 0xD2, 0x72, 0x62, 0xC2, 0x73,
+  0x62, 0xB3, 0xF0, 0x12, 0xB2, 0xF0, 0x13, 0xA2, 0xE5, 0xB2, 0xE5, 0xA2,
+  0xF0, 0x33, 0x83, 0xF0, 0x43, 0x72, 0xF0, 0x53, 0x62, 0xC3, 0x63, 0x53,
+  0x72, 0x33, 0x63, 0x52, 0x73, 0x43, 0x43, 0x52, 0x74, 0x4A, 0x43, 0x74,
+  0x66, 0x62, 0x72, 0x12, 0xF0, 0x22, 0x73, 0x12, 0xF0, 0x22, 0x63, 0x22,
+  0xF0, 0x12, 0x72, 0x32, 0xF3, 0x62, 0x42, 0xF2, 0x63, 0x42, 0xE2, 0x63,
+  0x52, 0xD3, 0x6D, 0xA2, 0x7D, 0x92, 0xF0, 0x12, 0xB3, 0xF0, 0x12, 0xB2,
+  0xF0, 0x22, 0xA2, 0xF0, 0x32, 0xA2, 0xF0, 0x80, 0x73, 0xE3, 0xE3, 0xE3,
+  0xE3, 0xF0, 0xF0, 0xF0, 0xF0, 0x53, 0xE3, 0xE3, 0xE3, 0xD4, 0xC4, 0xC5,
+  0xB5, 0xB5, 0xB5, 0xC4, 0xC4, 0xD4, 0x97, 0xA7, 0xA8, 0x93, 0x14, 0x84,
+  0x24, 0x74, 0x2E, 0x4C, 0x79, 0xC1, 0x80, 0x75, 0xF0, 0x55, 0xF0, 0x63,
+  0xF0, 0x73, 0xF0, 0x73, 0xF0, 0xF0, 0xF0, 0xF0, 0x75, 0xF0, 0x36, 0xF0,
+  0x36, 0xF0, 0x37, 0xF0, 0x18, 0xF0, 0x14, 0x13, 0xF4, 0x24, 0xE4, 0x24,
+  0xE3, 0x43, 0xD4, 0x44, 0xC4, 0x44, 0xC3, 0x63, 0xB4, 0x64, 0xA4, 0x64,
+  0xA3, 0x83, 0x94, 0x84, 0x84, 0x84, 0x8F, 0x02, 0x6F, 0x03, 0x6F, 0x03,
+  0x63, 0xC4, 0x44, 0xC4, 0x44, 0xC4, 0x43, 0xE4, 0x24, 0xE4, 0x24, 0xE4,
+  0x14, 0xF0, 0x18, 0xF0, 0x18, 0xF0, 0x14, 0xD5, 0xF0, 0x35, 0xF0, 0x43,
+  0xF0, 0x53, 0xF0, 0x53, 0xF0, 0xF0, 0xF0, 0xF0, 0x95, 0xF0, 0x36, 0xF0,
+  0x36, 0xF0, 0x37, 0xF0, 0x18, 0xF0, 0x14, 0x13, 0xF4, 0x24, 0xE4, 0x24,
+  0xE3, 0x43, 0xD4, 0x44, 0xC4, 0x44, 0xC3, 0x63, 0xB4, 0x64, 0xA4, 0x64,
+  0xA3, 0x83, 0x94, 0x84, 0x84, 0x84, 0x8F, 0x02, 0x6F, 0x03, 0x6F, 0x03,
+  0x63, 0xC4, 0x44, 0xC4, 0x44, 0xC4, 0x43, 0xE4, 0x24, 0xE4, 0x24, 0xE4,
+  0x14, 0xF0, 0x18, 0xF0, 0x18, 0xF0, 0x14, 0xA4, 0xF0, 0x46, 0xF0, 0x28,
+  0xF0, 0x13, 0x24, 0xE3, 0x52, 0xF0, 0xF0, 0xF0, 0xF0, 0x55, 0xF0, 0x36,
+  0xF0, 0x36, 0xF0, 0x37, 0xF0, 0x18, 0xF0, 0x14, 0x13, 0xF4, 0x24, 0xE4,
+  0x24, 0xE3, 0x43, 0xD4, 0x44, 0xC4, 0x44, 0xC3, 0x63, 0xB4, 0x64, 0xA4,
+  0x64, 0xA3, 0x83, 0x94, 0x84, 0x84, 0x84, 0x8F, 0x02, 0x6F, 0x03, 0x6F,
+  0x03, 0x63, 0xC4, 0x44, 0xC4, 0x44, 0xC4, 0x43, 0xE4, 0x24, 0xE4, 0x24,
+  0xE4, 0x14, 0xF0, 0x18, 0xF0, 0x18, 0xF0, 0x14, 0x84, 0x42, 0xDB, 0xCC,
+  0xC3, 0x44, 0xF0, 0xF0, 0xF0, 0xF0, 0x55, 0xF0, 0x36, 0xF0, 0x36, 0xF0,
+  0x37, 0xF0, 0x18, 0xF0, 0x14, 0x13, 0xF4, 0x24, 0xE4, 0x24, 0xE3, 0x43,
+  0xD4, 0x44, 0xC4, 0x44, 0xC3, 0x63, 0xB4, 0x64, 0xA4, 0x64, 0xA3, 0x83,
+  0x94, 0x84, 0x84, 0x84, 0x8F, 0x02, 0x6F, 0x03, 0x6F, 0x03, 0x63, 0xC4,
+  0x44, 0xC4, 0x44, 0xC4, 0x43, 0xE4, 0x24, 0xE4, 0x24, 0xE4, 0x14, 0xF0,
+  0x18, 0xF0, 0x18, 0xF0, 0x14, 0x74, 0x34, 0xD4, 0x34, 0xD4, 0x34, 0xD4,
+  0x34, 0xF0, 0xF0, 0xF0, 0xF0, 0x45, 0xF0, 0x36, 0xF0, 0x36, 0xF0, 0x37,
+  0xF0, 0x18, 0xF0, 0x14, 0x13, 0xF4, 0x24, 0xE4, 0x24, 0xE3, 0x43, 0xD4,
+  0x44, 0xC4, 0x44, 0xC3, 0x63, 0xB4, 0x64, 0xA4, 0x64, 0xA3, 0x83, 0x94,
+  0x84, 0x84, 0x84, 0x8F, 0x02, 0x6F, 0x03, 0x6F, 0x03, 0x63, 0xC4, 0x44,
+  0xC4, 0x44, 0xC4, 0x43, 0xE4, 0x24, 0xE4, 0x24, 0xE4, 0x14, 0xF0, 0x18,
+  0xF0, 0x18, 0xF0, 0x14, 0x96, 0xF0, 0x37, 0xF0, 0x13, 0x23, 0xF0, 0x12,
+  0x42, 0xF0, 0x13, 0x32, 0xF0, 0x14, 0x13, 0xF0, 0x26, 0xF0, 0x44, 0xF0,
+  0xF0, 0xE5, 0xF0, 0x36, 0xF0, 0x36, 0xF0, 0x37, 0xF0, 0x18, 0xF0, 0x14,
+  0x13, 0xF4, 0x24, 0xE4, 0x24, 0xE3, 0x43, 0xD4, 0x44, 0xC4, 0x44, 0xC3,
+  0x63, 0xB4, 0x64, 0xA4, 0x64, 0xA3, 0x83, 0x94, 0x84, 0x84, 0x84, 0x8F,
+  0x02, 0x6F, 0x03, 0x6F, 0x03, 0x63, 0xC4, 0x44, 0xC4, 0x44, 0xC4, 0x43,
+  0xE4, 0x24, 0xE4, 0x24, 0xE4, 0x14, 0xF0, 0x18, 0xF0, 0x18, 0xF0, 0x14,
+  0xBF, 0x0A, 0xBF, 0x0A, 0xAF, 0x0B, 0xA3, 0x44, 0xF0, 0x94, 0x44, 0xF0,
+  0x94, 0x44, 0xF0, 0x93, 0x54, 0xF0, 0x84, 0x54, 0xF0, 0x83, 0x64, 0xF0,
+  0x74, 0x64, 0xF0, 0x74, 0x64, 0xF0, 0x73, 0x74, 0xF0, 0x64, 0x74, 0xF0,
+  0x64, 0x7F, 0x03, 0x64, 0x8F, 0x03, 0x64, 0x8F, 0x03, 0x63, 0x94, 0xF0,
+  0x4F, 0x02, 0xF0, 0x4F, 0x02, 0xF0, 0x3F, 0x03, 0xF0, 0x34, 0xA4, 0xF0,
+  0x33, 0xB4, 0xF0, 0x24, 0xB4, 0xF0, 0x24, 0xB4, 0xF0, 0x14, 0xC4, 0xF0,
+  0x14, 0xC4, 0xF0, 0x14, 0xCF, 0x08, 0xDF, 0x08, 0xDF, 0x04, 0x98, 0xDD,
+  0xAF, 0x77, 0x47, 0x65, 0x95, 0x44, 0xC4, 0x34, 0xE4, 0x24, 0xE4, 0x23,
+  0xF0, 0x13, 0x14, 0xF0, 0x54, 0xF0, 0x53, 0xF0, 0x63, 0xF0, 0x63, 0xF0,
+  0x63, 0xF0, 0x63, 0xF0, 0x63, 0xF0, 0x63, 0xF0, 0x64, 0xF0, 0x18, 0xF0,
+  0x18, 0xF0, 0x14, 0x14, 0xE4, 0x24, 0xE4, 0x34, 0xC5, 0x45, 0x95, 0x57,
+  0x56, 0x8F, 0xAD, 0xD8, 0xF0, 0x41, 0xF0, 0x75, 0xF0, 0x41, 0x14, 0xF0,
+  0x63, 0xF0, 0x63, 0xF2, 0x43, 0xF8, 0xF0, 0x51, 0xC0, 0x55, 0xF0, 0x34,
+  0xF0, 0x34, 0xF0, 0x34, 0xF0, 0x42, 0xF0, 0xF0, 0xF0, 0x5F, 0x05, 0x1F,
+  0x05, 0x1F, 0x05, 0x14, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24,
+  0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x2F,
+  0x04, 0x2F, 0x04, 0x2F, 0x04, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24,
+  0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24,
+  0xF0, 0x2F, 0x0F, 0x0F, 0x0F, 0x03, 0xA5, 0xF5, 0xF4, 0xF0, 0x23, 0xF0,
+  0x23, 0xF0, 0xF0, 0xF0, 0x8F, 0x05, 0x1F, 0x05, 0x1F, 0x05, 0x14, 0xF0,
+  0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0,
+  0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x2F, 0x04, 0x2F, 0x04, 0x2F, 0x04,
+  0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0,
+  0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x2F, 0x0F, 0x0F, 0x0F,
+  0x03, 0x84, 0xF0, 0x16, 0xE8, 0xD3, 0x24, 0xB3, 0x52, 0xF0, 0xF0, 0xF0,
+  0x3F, 0x05, 0x1F, 0x05, 0x1F, 0x05, 0x14, 0xF0, 0x24, 0xF0, 0x24, 0xF0,
+  0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0,
+  0x24, 0xF0, 0x2F, 0x04, 0x2F, 0x04, 0x2F, 0x04, 0x24, 0xF0, 0x24, 0xF0,
+  0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0,
+  0x24, 0xF0, 0x24, 0xF0, 0x2F, 0x0F, 0x0F, 0x0F, 0x03, 0x54, 0x34, 0xA4,
+  0x34, 0xA4, 0x34, 0xA4, 0x34, 0xF0, 0xF0, 0xF0, 0x2F, 0x05, 0x1F, 0x05,
+  0x1F, 0x05, 0x14, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0,
+  0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x2F, 0x04,
+  0x2F, 0x04, 0x2F, 0x04, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0,
+  0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0,
+  0x2F, 0x0F, 0x0F, 0x0F, 0x03, 0x14, 0x64, 0x64, 0x64, 0x73, 0xF0, 0x74,
+  0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
+  0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
+  0x54, 0x54, 0x54, 0x54, 0x10, 0x44, 0x44, 0x44, 0x43, 0x53, 0xF0, 0xB4,
+  0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
+  0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
+  0x54, 0x54, 0x54, 0x54, 0x30, 0x44, 0x76, 0x58, 0x43, 0x23, 0x33, 0x43,
+  0xF0, 0xE4, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84,
+  0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84,
+  0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x40, 0x04, 0x38, 0x38, 0x38, 0x34,
+  0xF0, 0xB4, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
+  0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
+  0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x30, 0x2F, 0xAF, 0x02, 0x8F, 0x04,
+  0x64, 0x97, 0x54, 0xC4, 0x54, 0xD4, 0x44, 0xE4, 0x34, 0xE4, 0x34, 0xF3,
+  0x34, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xFF, 0x02, 0x8F, 0x02, 0x8F,
+  0x02, 0x84, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF3,
+  0x34, 0xE4, 0x34, 0xE4, 0x34, 0xD4, 0x44, 0xC5, 0x44, 0x97, 0x5F, 0x04,
+  0x6F, 0x02, 0x8F, 0x80, 0xF2, 0xB6, 0x32, 0xBB, 0xA3, 0x26, 0xF0, 0x41,
+  0xF0, 0xF4, 0xF8, 0xE9, 0xD9, 0xDA, 0xCB, 0xBB, 0xB7, 0x14, 0xA7, 0x14,
+  0xA7, 0x24, 0x97, 0x34, 0x87, 0x34, 0x87, 0x44, 0x77, 0x54, 0x67, 0x54,
+  0x67, 0x64, 0x57, 0x64, 0x57, 0x74, 0x47, 0x84, 0x37, 0x84, 0x37, 0x94,
+  0x27, 0xA4, 0x17, 0xA4, 0x17, 0xBB, 0xCA, 0xCA, 0xD9, 0xD9, 0xE4, 0x85,
+  0xF0, 0x85, 0xF0, 0x93, 0xF0, 0xA3, 0xF0, 0xA3, 0xF0, 0xF0, 0xF0, 0x28,
+  0xF0, 0x2D, 0xCF, 0x02, 0x97, 0x57, 0x75, 0xA6, 0x55, 0xD4, 0x45, 0xF4,
+  0x34, 0xF0, 0x24, 0x24, 0xF0, 0x24, 0x14, 0xF0, 0x43, 0x14, 0xF0, 0x47,
+  0xF0, 0x57, 0xF0, 0x57, 0xF0, 0x57, 0xF0, 0x57, 0xF0, 0x57, 0xF0, 0x57,
+  0xF0, 0x58, 0xF0, 0x48, 0xF0, 0x43, 0x23, 0xF0, 0x34, 0x24, 0xF0, 0x24,
+  0x34, 0xF4, 0x45, 0xD5, 0x55, 0xA6, 0x77, 0x57, 0x9F, 0x02, 0xCD, 0xF0,
+  0x18, 0xA0, 0xE5, 0xF0, 0x65, 0xF0, 0x73, 0xF0, 0x83, 0xF0, 0x83, 0xF0,
+  0xF0, 0xF0, 0x48, 0xF0, 0x2D, 0xCF, 0x02, 0x97, 0x57, 0x75, 0xA6, 0x55,
+  0xD4, 0x45, 0xF4, 0x34, 0xF0, 0x24, 0x24, 0xF0, 0x24, 0x14, 0xF0, 0x43,
+  0x14, 0xF0, 0x47, 0xF0, 0x57, 0xF0, 0x57, 0xF0, 0x57, 0xF0, 0x57, 0xF0,
+  0x57, 0xF0, 0x57, 0xF0, 0x58, 0xF0, 0x48, 0xF0, 0x43, 0x23, 0xF0, 0x34,
+  0x24, 0xF0, 0x24, 0x34, 0xF4, 0x45, 0xD5, 0x55, 0xA6, 0x77, 0x57, 0x9F,
+  0x02, 0xCD, 0xF0, 0x18, 0xA0, 0xB5, 0xF0, 0x66, 0xF0, 0x67, 0xF0, 0x43,
+  0x33, 0xF0, 0x23, 0x53, 0xF0, 0xF0, 0xE8, 0xF0, 0x2D, 0xCF, 0x02, 0x97,
+  0x57, 0x75, 0xA6, 0x55, 0xD4, 0x45, 0xF4, 0x34, 0xF0, 0x24, 0x24, 0xF0,
+  0x24, 0x14, 0xF0, 0x43, 0x14, 0xF0, 0x47, 0xF0, 0x57, 0xF0, 0x57, 0xF0,
+  0x57, 0xF0, 0x57, 0xF0, 0x57, 0xF0, 0x57, 0xF0, 0x58, 0xF0, 0x48, 0xF0,
+  0x43, 0x23, 0xF0, 0x34, 0x24, 0xF0, 0x24, 0x34, 0xF4, 0x45, 0xD5, 0x55,
+  0xA6, 0x77, 0x57, 0x9F, 0x02, 0xCD, 0xF0, 0x18, 0xA0, 0xF0, 0x22, 0xF0,
+  0x16, 0x32, 0xF0, 0x1B, 0xF3, 0x26, 0xF0, 0x91, 0xF0, 0xF0, 0xF0, 0x28,
+  0xF0, 0x2D, 0xCF, 0x02, 0x97, 0x57, 0x75, 0xA6, 0x55, 0xD4, 0x45, 0xF4,
+  0x34, 0xF0, 0x24, 0x24, 0xF0, 0x24, 0x14, 0xF0, 0x43, 0x14, 0xF0, 0x47,
+  0xF0, 0x57, 0xF0, 0x57, 0xF0, 0x57, 0xF0, 0x57, 0xF0, 0x57, 0xF0, 0x57,
+  0xF0, 0x58, 0xF0, 0x48, 0xF0, 0x43, 0x23, 0xF0, 0x34, 0x24, 0xF0, 0x24,
+  0x34, 0xF4, 0x45, 0xD5, 0x55, 0xA6, 0x77, 0x57, 0x9F, 0x02, 0xCD, 0xF0,
+  0x18, 0xA0, 0x84, 0x34, 0xF0, 0x14, 0x34, 0xF0, 0x14, 0x34, 0xF0, 0x14,
+  0x34, 0xF0, 0xF0, 0xF0, 0xF0, 0xB8, 0xF0, 0x2D, 0xCF, 0x02, 0x97, 0x57,
+  0x75, 0xA6, 0x55, 0xD4, 0x45, 0xF4, 0x34, 0xF0, 0x24, 0x24, 0xF0, 0x24,
+  0x14, 0xF0, 0x43, 0x14, 0xF0, 0x47, 0xF0, 0x57, 0xF0, 0x57, 0xF0, 0x57,
+  0xF0, 0x57, 0xF0, 0x57, 0xF0, 0x57, 0xF0, 0x58, 0xF0, 0x48, 0xF0, 0x43,
+  0x23, 0xF0, 0x34, 0x24, 0xF0, 0x24, 0x34, 0xF4, 0x45, 0xD5, 0x55, 0xA6,
+  0x77, 0x57, 0x9F, 0x02, 0xCD, 0xF0, 0x18, 0xA0, 0x11, 0xD3, 0x92, 0x14,
+  0x74, 0x14, 0x54, 0x34, 0x34, 0x54, 0x14, 0x77, 0x95, 0xA5, 0x97, 0x74,
+  0x14, 0x54, 0x34, 0x34, 0x54, 0x14, 0x74, 0x12, 0x92, 0xF0, 0x10, 0xF0,
+  0xF0, 0x88, 0x82, 0x8D, 0x43, 0x6F, 0x01, 0x23, 0x67, 0x59, 0x65, 0xA6,
+  0x65, 0xD4, 0x55, 0xD6, 0x44, 0xD3, 0x14, 0x34, 0xC3, 0x24, 0x24, 0xC3,
+  0x43, 0x24, 0xB3, 0x54, 0x13, 0xB3, 0x64, 0x13, 0xA3, 0x74, 0x13, 0xA2,
+  0x84, 0x13, 0x92, 0x94, 0x13, 0x82, 0xA4, 0x13, 0x72, 0xB4, 0x14, 0x53,
+  0xB4, 0x14, 0x43, 0xC4, 0x14, 0x33, 0xD3, 0x34, 0x13, 0xD4, 0x37, 0xE4,
+  0x45, 0xE4, 0x55, 0xD5, 0x56, 0xA6, 0x5A, 0x57, 0x53, 0x2F, 0x02, 0x62,
+  0x5D, 0xF0, 0x28, 0xA0, 0x65, 0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x43, 0xF0,
+  0x53, 0xF0, 0xF0, 0xF0, 0x74, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8,
+  0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8,
+  0xE8, 0xE8, 0xE8, 0xE4, 0x14, 0xC4, 0x25, 0xA5, 0x37, 0x47, 0x5F, 0x01,
+  0x7E, 0xB8, 0x70, 0xC4, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x23, 0xF0, 0x33,
+  0xF0, 0xF0, 0xF0, 0xA4, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8,
+  0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8,
+  0xE8, 0xE8, 0xE4, 0x14, 0xC4, 0x25, 0xA5, 0x37, 0x47, 0x5F, 0x01, 0x7E,
+  0xB8, 0x70, 0x94, 0xF0, 0x26, 0xF0, 0x17, 0xE3, 0x24, 0xC3, 0x52, 0xF0,
+  0xF0, 0xF0, 0x54, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8,
+  0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8,
+  0xE8, 0xE4, 0x14, 0xC4, 0x25, 0xA5, 0x37, 0x47, 0x5F, 0x01, 0x7E, 0xB8,
+  0x70, 0x64, 0x34, 0xB4, 0x34, 0xB4, 0x34, 0xB4, 0x34, 0xF0, 0xF0, 0xF0,
+  0x44, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8,
+  0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE4,
+  0x14, 0xC4, 0x25, 0xA5, 0x37, 0x47, 0x5F, 0x01, 0x7E, 0xB8, 0x70, 0xD5,
+  0xF0, 0x44, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x62, 0xF0, 0xF0, 0xF0, 0xF0,
+  0x34, 0xF0, 0x1A, 0xF4, 0x25, 0xD4, 0x44, 0xD4, 0x45, 0xB4, 0x64, 0xA5,
+  0x74, 0x94, 0x85, 0x74, 0xA4, 0x74, 0xA5, 0x54, 0xC4, 0x54, 0xD4, 0x34,
+  0xE5, 0x14, 0xF0, 0x14, 0x14, 0xF0, 0x27, 0xF0, 0x37, 0xF0, 0x45, 0xF0,
+  0x54, 0xF0, 0x73, 0xF0, 0x73, 0xF0, 0x73, 0xF0, 0x73, 0xF0, 0x73, 0xF0,
+  0x73, 0xF0, 0x73, 0xF0, 0x73, 0xF0, 0x73, 0xF0, 0x73, 0xF0, 0x73, 0xB0,
+  0x04, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x2F, 0x01,
+  0x5F, 0x03, 0x3F, 0x04, 0x24, 0xA6, 0x14, 0xB5, 0x14, 0xC4, 0x14, 0xD8,
+  0xD8, 0xD8, 0xD8, 0xC4, 0x14, 0xB5, 0x14, 0xA6, 0x1F, 0x04, 0x2F, 0x03,
+  0x3F, 0x01, 0x54, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0,
+  0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x20, 0x57, 0xAC, 0x6E, 0x45, 0x55,
+  0x44, 0x84, 0x24, 0xA3, 0x24, 0xA3, 0x24, 0xA3, 0x24, 0xA3, 0x24, 0x94,
+  0x24, 0x84, 0x34, 0x47, 0x44, 0x47, 0x44, 0x48, 0x34, 0x85, 0x24, 0xA4,
+  0x14, 0xA4, 0x14, 0xB8, 0xB8, 0xB8, 0xB8, 0xB3, 0x14, 0xB3, 0x14, 0xA4,
+  0x14, 0x94, 0x24, 0x76, 0x24, 0x39, 0x34, 0x38, 0x44, 0x36, 0x60, 0x54,
+  0xF0, 0x13, 0xF0, 0x23, 0xF0, 0x23, 0xF0, 0x22, 0xF0, 0x32, 0xF0, 0xF0,
+  0xF0, 0x67, 0x9C, 0x6E, 0x54, 0x65, 0x34, 0x84, 0x34, 0x93, 0xF0, 0x13,
+  0xF0, 0x13, 0xE5, 0x8B, 0x5E, 0x38, 0x53, 0x34, 0x93, 0x24, 0xA3, 0x24,
+  0xA3, 0x24, 0x94, 0x24, 0x85, 0x34, 0x66, 0x3C, 0x15, 0x2A, 0x25, 0x46,
+  0x54, 0xA4, 0xE4, 0xE4, 0xF3, 0xF3, 0xF3, 0xF0, 0xF0, 0xF0, 0x97, 0x9C,
+  0x6E, 0x54, 0x65, 0x34, 0x84, 0x34, 0x93, 0xF0, 0x13, 0xF0, 0x13, 0xE5,
+  0x8B, 0x5E, 0x38, 0x53, 0x34, 0x93, 0x24, 0xA3, 0x24, 0xA3, 0x24, 0x94,
+  0x24, 0x85, 0x34, 0x66, 0x3C, 0x15, 0x2A, 0x25, 0x46, 0x54, 0x84, 0xE6,
+  0xC3, 0x13, 0xC3, 0x23, 0xA3, 0x43, 0x83, 0x62, 0xF0, 0xE7, 0x9C, 0x6E,
+  0x54, 0x65, 0x34, 0x84, 0x34, 0x93, 0xF0, 0x13, 0xF0, 0x13, 0xE5, 0x8B,
+  0x5E, 0x38, 0x53, 0x34, 0x93, 0x24, 0xA3, 0x24, 0xA3, 0x24, 0x94, 0x24,
+  0x85, 0x34, 0x66, 0x3C, 0x15, 0x2A, 0x25, 0x46, 0x54, 0x54, 0x43, 0x7C,
+  0x7B, 0x82, 0x44, 0xF0, 0xF0, 0xF0, 0x47, 0x9C, 0x6E, 0x54, 0x65, 0x34,
+  0x84, 0x34, 0x93, 0xF0, 0x13, 0xF0, 0x13, 0xE5, 0x8B, 0x5E, 0x38, 0x53,
+  0x34, 0x93, 0x24, 0xA3, 0x24, 0xA3, 0x24, 0x94, 0x24, 0x85, 0x34, 0x66,
+  0x3C, 0x15, 0x2A, 0x25, 0x46, 0x54, 0x44, 0x34, 0x84, 0x34, 0x84, 0x34,
+  0x84, 0x34, 0xF0, 0xF0, 0xF0, 0xF0, 0x77, 0x9C, 0x6E, 0x54, 0x65, 0x34,
+  0x84, 0x34, 0x93, 0xF0, 0x13, 0xF0, 0x13, 0xE5, 0x8B, 0x5E, 0x38, 0x53,
+  0x34, 0x93, 0x24, 0xA3, 0x24, 0xA3, 0x24, 0x94, 0x24, 0x85, 0x34, 0x66,
+  0x3C, 0x15, 0x2A, 0x25, 0x46, 0x54, 0x84, 0xE6, 0xC8, 0xB2, 0x33, 0xB2,
+  0x33, 0xB3, 0x14, 0xC6, 0xE4, 0xF0, 0xF0, 0x27, 0x9C, 0x6E, 0x54, 0x65,
+  0x34, 0x84, 0x34, 0x93, 0xF0, 0x13, 0xF0, 0x13, 0xE5, 0x8B, 0x5E, 0x38,
+  0x53, 0x34, 0x93, 0x24, 0xA3, 0x24, 0xA3, 0x24, 0x94, 0x24, 0x85, 0x34,
+  0x66, 0x3C, 0x15, 0x2A, 0x25, 0x46, 0x54, 0x67, 0x76, 0x9C, 0x3A, 0x6E,
+  0x1C, 0x54, 0x68, 0x55, 0x34, 0x86, 0x84, 0x24, 0x94, 0x94, 0x23, 0xA3,
+  0xB4, 0xE3, 0xB4, 0xD4, 0xB4, 0x6F, 0x0B, 0x3F, 0x0E, 0x29, 0x3F, 0x03,
+  0x15, 0x83, 0xF4, 0xA3, 0xF4, 0xA3, 0xB3, 0x14, 0x95, 0xA3, 0x14, 0x87,
+  0x84, 0x24, 0x64, 0x14, 0x55, 0x3C, 0x3D, 0x5A, 0x5B, 0x86, 0x97, 0x60,
+  0x67, 0x9A, 0x7D, 0x45, 0x54, 0x44, 0x74, 0x24, 0x93, 0x23, 0xA3, 0x14,
+  0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xA4, 0x13, 0xA3, 0x24, 0x93, 0x24,
+  0x84, 0x35, 0x54, 0x5D, 0x6A, 0xA7, 0xC2, 0xF0, 0x15, 0xD6, 0xF3, 0xF3,
+  0x92, 0x34, 0x98, 0xD2, 0x90, 0x54, 0xF0, 0x14, 0xF0, 0x13, 0xF0, 0x23,
+  0xF0, 0x23, 0xF0, 0x22, 0xF0, 0xF0, 0xF0, 0x67, 0xAB, 0x7D, 0x55, 0x55,
+  0x44, 0x74, 0x34, 0x94, 0x23, 0xB3, 0x23, 0xB3, 0x14, 0xB3, 0x1F, 0x0F,
+  0x0F, 0x0F, 0x01, 0xF4, 0xF0, 0x13, 0xB3, 0x24, 0x94, 0x24, 0x94, 0x35,
+  0x55, 0x5D, 0x7B, 0xA7, 0x60, 0xA4, 0xF3, 0xF3, 0xF3, 0xF0, 0x12, 0xF0,
+  0x12, 0xF0, 0xF0, 0xF0, 0x97, 0xAB, 0x7D, 0x55, 0x55, 0x44, 0x74, 0x34,
+  0x94, 0x23, 0xB3, 0x23, 0xB3, 0x14, 0xB3, 0x1F, 0x0F, 0x0F, 0x0F, 0x01,
+  0xF4, 0xF0, 0x13, 0xB3, 0x24, 0x94, 0x24, 0x94, 0x35, 0x55, 0x5D, 0x7B,
+  0xA7, 0x60, 0x84, 0xE6, 0xC7, 0xC3, 0x23, 0xA3, 0x43, 0x83, 0x62, 0xF0,
+  0xE7, 0xAB, 0x7D, 0x55, 0x55, 0x44, 0x74, 0x34, 0x94, 0x23, 0xB3, 0x23,
+  0xB3, 0x14, 0xB3, 0x1F, 0x0F, 0x0F, 0x0F, 0x01, 0xF4, 0xF0, 0x13, 0xB3,
+  0x24, 0x94, 0x24, 0x94, 0x35, 0x55, 0x5D, 0x7B, 0xA7, 0x60, 0x44, 0x34,
+  0x84, 0x34, 0x84, 0x34, 0x84, 0x34, 0xF0, 0xF0, 0xF0, 0xF0, 0x77, 0xAB,
+  0x7D, 0x55, 0x55, 0x44, 0x74, 0x34, 0x94, 0x23, 0xB3, 0x23, 0xB3, 0x14,
+  0xB3, 0x1F, 0x0F, 0x0F, 0x0F, 0x01, 0xF4, 0xF0, 0x13, 0xB3, 0x24, 0x94,
+  0x24, 0x94, 0x35, 0x55, 0x5D, 0x7B, 0xA7, 0x60, 0x05, 0x44, 0x54, 0x54,
+  0x53, 0x63, 0xF0, 0x43, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
+  0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
+  0x20, 0x44, 0x44, 0x53, 0x53, 0x53, 0x62, 0xF0, 0xC3, 0x63, 0x63, 0x63,
+  0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
+  0x63, 0x63, 0x63, 0x63, 0x63, 0x30, 0x34, 0x66, 0x57, 0x33, 0x23, 0x23,
+  0x43, 0x12, 0x63, 0xF0, 0xB3, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
+  0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
+  0x83, 0x40, 0x04, 0x38, 0x38, 0x38, 0x34, 0xF0, 0xF0, 0xF0, 0x33, 0x83,
+  0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
+  0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x40, 0x32, 0xF0, 0x15, 0x33,
+  0xA9, 0xB6, 0xC7, 0xA4, 0x24, 0xA1, 0x54, 0xF0, 0x14, 0xB9, 0x8C, 0x6E,
+  0x45, 0x55, 0x35, 0x75, 0x24, 0x94, 0x23, 0xB3, 0x14, 0xB3, 0x14, 0xB8,
+  0xB8, 0xB8, 0xB8, 0xB8, 0xB3, 0x23, 0xB3, 0x24, 0x94, 0x25, 0x74, 0x45,
+  0x55, 0x5D, 0x7B, 0xA7, 0x60, 0x53, 0x52, 0x6B, 0x5B, 0x62, 0x44, 0xF0,
+  0xF0, 0x83, 0x37, 0x43, 0x2A, 0x23, 0x1C, 0x17, 0x54, 0x15, 0x89, 0x88,
+  0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
+  0x98, 0x98, 0x94, 0x54, 0xF0, 0x14, 0xF0, 0x13, 0xF0, 0x23, 0xF0, 0x23,
+  0xF0, 0x22, 0xF0, 0xF0, 0xF0, 0x67, 0xAB, 0x7D, 0x55, 0x55, 0x35, 0x74,
+  0x34, 0x94, 0x23, 0xB3, 0x14, 0xB3, 0x14, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8,
+  0xB3, 0x23, 0xB3, 0x24, 0x94, 0x25, 0x74, 0x45, 0x55, 0x5D, 0x7B, 0xA7,
+  0x60, 0xA4, 0xE4, 0xF3, 0xF3, 0xF3, 0xF0, 0x12, 0xF0, 0xF0, 0xF0, 0x97,
+  0xAB, 0x7D, 0x55, 0x55, 0x35, 0x74, 0x34, 0x94, 0x23, 0xB3, 0x14, 0xB3,
+  0x14, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB3, 0x23, 0xB3, 0x24, 0x94, 0x25,
+  0x74, 0x45, 0x55, 0x5D, 0x7B, 0xA7, 0x60, 0x75, 0xE5, 0xD3, 0x13, 0xB3,
+  0x23, 0xB2, 0x43, 0x93, 0x53, 0xF0, 0xF0, 0xF0, 0x37, 0xAB, 0x7D, 0x55,
+  0x55, 0x35, 0x74, 0x34, 0x94, 0x23, 0xB3, 0x14, 0xB3, 0x14, 0xB8, 0xB8,
+  0xB8, 0xB8, 0xB8, 0xB3, 0x23, 0xB3, 0x24, 0x94, 0x25, 0x74, 0x45, 0x55,
+  0x5D, 0x7B, 0xA7, 0x60, 0x54, 0x43, 0x7B, 0x8B, 0x82, 0x44, 0xF0, 0xF0,
+  0xF0, 0x47, 0xAB, 0x7D, 0x55, 0x55, 0x35, 0x74, 0x34, 0x94, 0x23, 0xB3,
+  0x14, 0xB3, 0x14, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB3, 0x23, 0xB3, 0x24,
+  0x94, 0x25, 0x74, 0x45, 0x55, 0x5D, 0x7B, 0xA7, 0x60, 0x44, 0x34, 0x84,
+  0x34, 0x84, 0x34, 0x84, 0x34, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xB7, 0xAB,
+  0x7D, 0x55, 0x55, 0x35, 0x74, 0x34, 0x94, 0x23, 0xB3, 0x14, 0xB3, 0x14,
+  0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB3, 0x23, 0xB3, 0x24, 0x94, 0x25, 0x74,
+  0x45, 0x55, 0x5D, 0x7B, 0xA7, 0x60, 0x74, 0xF4, 0xF4, 0xF4, 0xF0, 0xF0,
+  0xF0, 0xF0, 0x5F, 0x0F, 0x0F, 0x0C, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x84,
+  0xF4, 0xF4, 0xF4, 0x80, 0x77, 0x51, 0x5B, 0x22, 0x4F, 0x45, 0x55, 0x45,
+  0x74, 0x44, 0x85, 0x33, 0x82, 0x13, 0x24, 0x72, 0x23, 0x24, 0x63, 0x24,
+  0x14, 0x53, 0x34, 0x14, 0x43, 0x44, 0x14, 0x33, 0x54, 0x14, 0x23, 0x64,
+  0x14, 0x22, 0x73, 0x33, 0x12, 0x74, 0x35, 0x84, 0x35, 0x74, 0x55, 0x55,
+  0x4F, 0x42, 0x2B, 0x51, 0x57, 0x60, 0x35, 0xD4, 0xE4, 0xE4, 0xE3, 0xF3,
+  0xF0, 0xF0, 0xA4, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
+  0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x89, 0x85, 0x14, 0x57, 0x1C, 0x13,
+  0x2B, 0x13, 0x47, 0x33, 0xF0, 0x20, 0xA4, 0xC4, 0xC4, 0xD3, 0xD3, 0xD3,
+  0xF0, 0xF0, 0xC4, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
+  0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x89, 0x85, 0x14, 0x57, 0x1C, 0x13,
+  0x2B, 0x13, 0x47, 0x33, 0xF0, 0x20, 0x65, 0xC5, 0xB3, 0x13, 0x93, 0x33,
+  0x83, 0x33, 0x73, 0x53, 0xF0, 0xF0, 0x74, 0x98, 0x98, 0x98, 0x98, 0x98,
+  0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x89, 0x85,
+  0x14, 0x57, 0x1C, 0x13, 0x2B, 0x13, 0x47, 0x33, 0xF0, 0x20, 0x34, 0x34,
+  0x64, 0x34, 0x64, 0x34, 0x64, 0x34, 0xF0, 0xF0, 0xF0, 0xF0, 0xB4, 0x98,
+  0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
+  0x98, 0x98, 0x89, 0x85, 0x14, 0x57, 0x1C, 0x13, 0x2B, 0x13, 0x47, 0x33,
+  0xF0, 0x20, 0xB4, 0xD4, 0xD4, 0xE3, 0xE3, 0xE3, 0xF0, 0xF0, 0xF3, 0xB3,
+  0x13, 0xA4, 0x14, 0x93, 0x33, 0x93, 0x33, 0x84, 0x34, 0x73, 0x53, 0x64,
+  0x53, 0x64, 0x54, 0x53, 0x73, 0x44, 0x73, 0x43, 0x84, 0x33, 0x93, 0x24,
+  0x93, 0x23, 0xA4, 0x13, 0xB7, 0xB6, 0xC6, 0xD5, 0xD4, 0xE4, 0xE3, 0xF3,
+  0xE4, 0xE3, 0xE4, 0xB6, 0xC6, 0xC5, 0xB0, 0x04, 0xF4, 0xF4, 0xF4, 0xF4,
+  0xF4, 0xF4, 0xF4, 0x36, 0x64, 0x1A, 0x4F, 0x01, 0x37, 0x46, 0x26, 0x74,
+  0x25, 0x94, 0x14, 0xA4, 0x14, 0xB3, 0x14, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8,
+  0xB3, 0x14, 0xA4, 0x15, 0x94, 0x16, 0x74, 0x27, 0x46, 0x2F, 0x01, 0x34,
+  0x1A, 0x44, 0x36, 0x64, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF0,
+  0x44, 0x34, 0x74, 0x34, 0x74, 0x34, 0x74, 0x34, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xF0, 0x13, 0xB3, 0x13, 0xA4, 0x14, 0x93, 0x33, 0x93, 0x33, 0x84, 0x34,
+  0x73, 0x53, 0x64, 0x53, 0x64, 0x54, 0x53, 0x73, 0x44, 0x73, 0x43, 0x84,
+  0x33, 0x93, 0x24, 0x93, 0x23, 0xA4, 0x13, 0xB7, 0xB6, 0xC6, 0xD5, 0xD4,
+  0xE4, 0xE3, 0xF3, 0xE4, 0xE3, 0xE4, 0xB6, 0xC6, 0xC5, 0xB0 };
+
+constexpr GFXglyph FreeSans_RLE_20pt8bGlyphs[] PROGMEM = {
+  {     0,   1,   1,  10,    0,    0 },   // 0x20 ' '
+  {     1,   3,  29,  13,    5,  -28 },   // 0x21 '!'
+  {     8,   9,  10,  13,    2,  -26 },   // 0x22 '"'
+  {    21,  20,  27,  22,    1,  -26 },   // 0x23 '#'
+  {    76,  19,  35,  22,    1,  -30 },   // 0x24 '$'
+  {   143,  33,  27,  35,    1,  -26 },   // 0x25 '%'
+  {   218,  23,  27,  26,    2,  -26 },   // 0x26 '&'
+  {   272,   4,  10,   8,    2,  -26 },   // 0x27 '''
+  {   278,   8,  37,  13,    3,  -28 },   // 0x28 '('
+  {   315,   9,  37,  13,    1,  -28 },   // 0x29 ')'
+  {   353,  11,  11,  15,    2,  -28 },   // 0x2A '*'
+  {   369,  19,  19,  23,    2,  -18 },   // 0x2B '+'
+  {   404,   5,  10,  11,    3,   -3 },   // 0x2C ','
+  {   413,   9,   3,  13,    2,  -11 },   // 0x2D '-'
+  {   415,   4,   4,  10,    3,   -3 },   // 0x2E '.'
+  {   417,  11,  29,  11,    0,  -28 },   // 0x2F '/'
+  {   447,  18,  27,  22,    2,  -26 },   // 0x30 '0'
+  {   487,  10,  27,  22,    4,  -26 },   // 0x31 '1'
+  {   513,  19,  27,  22,    1,  -26 },   // 0x32 '2'
+  {   549,  19,  27,  22,    1,  -26 },   // 0x33 '3'
+  {   588,  19,  27,  22,    1,  -26 },   // 0x34 '4'
+  {   635,  19,  27,  22,    1,  -26 },   // 0x35 '5'
+  {   676,  18,  27,  22,    2,  -26 },   // 0x36 '6'
+  {   717,  18,  27,  22,    2,  -26 },   // 0x37 '7'
+  {   746,  19,  27,  22,    1,  -26 },   // 0x38 '8'
+  {   790,  19,  27,  22,    1,  -26 },   // 0x39 '9'
+  {   836,   4,  21,  10,    3,  -20 },   // 0x3A ':'
+  {   843,   4,  27,  10,    3,  -20 },   // 0x3B ';'
+  {   856,  19,  19,  23,    2,  -18 },   // 0x3C '<'
+  {   878,  19,  10,  23,    2,  -13 },   // 0x3D '='
+  {   891,  19,  19,  23,    2,  -18 },   // 0x3E '>'
+  {   914,  17,  29,  22,    3,  -28 },   // 0x3F '?'
+  {   948,  36,  35,  40,    1,  -28 },   // 0x40 '@'
+  {  1058,  24,  29,  26,    1,  -28 },   // 0x41 'A'
+  {  1117,  21,  29,  26,    3,  -28 },   // 0x42 'B'
+  {  1167,  24,  29,  28,    2,  -28 },   // 0x43 'C'
+  {  1222,  23,  29,  27,    3,  -28 },   // 0x44 'D'
+  {  1272,  21,  29,  25,    3,  -28 },   // 0x45 'E'
+  {  1329,  19,  29,  23,    3,  -28 },   // 0x46 'F'
+  {  1363,  26,  30,  30,    2,  -28 },   // 0x47 'G'
+  {  1424,  22,  29,  28,    3,  -28 },   // 0x48 'H'
+  {  1455,   4,  29,  11,    4,  -28 },   // 0x49 'I'
+  {  1463,  16,  29,  21,    1,  -28 },   // 0x4A 'J'
+  {  1496,  23,  29,  26,    3,  -28 },   // 0x4B 'K'
+  {  1555,  18,  29,  22,    3,  -28 },   // 0x4C 'L'
+  {  1585,  27,  29,  33,    3,  -28 },   // 0x4D 'M'
+  {  1657,  22,  29,  29,    3,  -28 },   // 0x4E 'N'
+  {  1703,  27,  29,  31,    2,  -28 },   // 0x4F 'O'
+  {  1766,  21,  29,  26,    3,  -28 },   // 0x50 'P'
+  {  1819,  27,  30,  31,    2,  -28 },   // 0x51 'Q'
+  {  1886,  23,  29,  28,    3,  -28 },   // 0x52 'R'
+  {  1944,  22,  29,  26,    2,  -28 },   // 0x53 'S'
+  {  1992,  23,  29,  25,    1,  -28 },   // 0x54 'T'
+  {  2049,  22,  29,  28,    3,  -28 },   // 0x55 'U'
+  {  2084,  24,  29,  25,    1,  -28 },   // 0x56 'V'
+  {  2144,  35,  29,  37,    1,  -28 },   // 0x57 'W'
+  {  2239,  24,  29,  26,    1,  -28 },   // 0x58 'X'
+  {  2296,  25,  29,  27,    1,  -28 },   // 0x59 'Y'
+  {  2357,  22,  29,  24,    1,  -28 },   // 0x5A 'Z'
+  {  2415,   8,  37,  11,    2,  -28 },   // 0x5B '['
+  {  2449,  11,  29,  11,    0,  -28 },   // 0x5C '\'
+  {  2478,   7,  37,  11,    1,  -28 },   // 0x5D ']'
+  {  2512,  15,  15,  18,    2,  -26 },   // 0x5E '^'
+  {  2539,  24,   2,  22,   -1,    6 },   // 0x5F '_'
+  {  2543,   8,   6,  10,    1,  -28 },   // 0x60 '`'
+  {  2549,  19,  21,  21,    1,  -20 },   // 0x61 'a'
+  {  2585,  19,  29,  22,    2,  -28 },   // 0x62 'b'
+  {  2631,  18,  21,  20,    1,  -20 },   // 0x63 'c'
+  {  2662,  19,  30,  22,    1,  -28 },   // 0x64 'd'
+  {  2707,  19,  21,  21,    1,  -20 },   // 0x65 'e'
+  {  2741,   9,  29,  11,    1,  -28 },   // 0x66 'f'
+  {  2770,  18,  29,  22,    1,  -20 },   // 0x67 'g'
+  {  2817,  17,  29,  21,    2,  -28 },   // 0x68 'h'
+  {  2851,   3,  29,   9,    3,  -28 },   // 0x69 'i'
+  {  2857,   7,  38,  10,    0,  -28 },   // 0x6A 'j'
+  {  2893,  18,  29,  20,    2,  -28 },   // 0x6B 'k'
+  {  2942,   4,  29,   8,    2,  -28 },   // 0x6C 'l'
+  {  2950,  27,  22,  32,    2,  -21 },   // 0x6D 'm'
+  {  2997,  17,  22,  21,    2,  -21 },   // 0x6E 'n'
+  {  3024,  19,  21,  21,    1,  -20 },   // 0x6F 'o'
+  {  3056,  19,  30,  22,    2,  -21 },   // 0x70 'p'
+  {  3103,  19,  29,  22,    1,  -20 },   // 0x71 'q'
+  {  3146,  10,  21,  13,    2,  -20 },   // 0x72 'r'
+  {  3168,  17,  21,  19,    1,  -20 },   // 0x73 's'
+  {  3195,   9,  27,  11,    1,  -26 },   // 0x74 't'
+  {  3221,  17,  22,  21,    2,  -20 },   // 0x75 'u'
+  {  3249,  19,  21,  19,    0,  -20 },   // 0x76 'v'
+  {  3288,  28,  21,  28,    0,  -20 },   // 0x77 'w'
+  {  3354,  18,  21,  19,    0,  -20 },   // 0x78 'x'
+  {  3391,  18,  29,  19,    0,  -20 },   // 0x79 'y'
+  {  3436,  17,  21,  19,    1,  -20 },   // 0x7A 'z'
+  {  3458,   9,  38,  13,    2,  -28 },   // 0x7B '{'
+  {  3496,   2,  37,  10,    4,  -28 },   // 0x7C '|'
+  {  3501,   9,  38,  13,    2,  -28 },   // 0x7D '}'
+  {  3540,  17,   7,  20,    1,  -16 },   // 0x7E '~'
+  {  3552,  29,  38,  31,    1,  -31 },   // 0x7F ''
+  {  3634,  29,  38,  31,    1,  -31 },   // 0x80 ''
+  {  3716,  29,  38,  31,    1,  -31 },   // 0x81 ''
+  {  3798,  29,  38,  31,    1,  -31 },   // 0x82 ''
+  {  3880,  29,  38,  31,    1,  -31 },   // 0x83 ''
+  {  3962,  29,  38,  31,    1,  -31 },   // 0x84 ''
+  {  4044,  29,  38,  31,    1,  -31 },   // 0x85 ''
+  {  4126,  29,  38,  31,    1,  -31 },   // 0x86 ''
+  {  4208,  29,  38,  31,    1,  -31 },   // 0x87 ''
+  {  4290,  29,  38,  31,    1,  -31 },   // 0x88 ''
+  {  4372,  29,  38,  31,    1,  -31 },   // 0x89 ''
+  {  4454,  29,  38,  31,    1,  -31 },   // 0x8A ''
+  {  4536,  29,  38,  31,    1,  -31 },   // 0x8B ''
+  {  4618,  29,  38,  31,    1,  -31 },   // 0x8C ''
+  {  4700,  29,  38,  31,    1,  -31 },   // 0x8D ''
+  {  4782,  29,  38,  31,    1,  -31 },   // 0x8E ''
+  {  4864,  29,  38,  31,    1,  -31 },   // 0x8F ''
+  {  4946,  29,  38,  31,    1,  -31 },   // 0x90 ''
+  {  5028,  29,  38,  31,    1,  -31 },   // 0x91 ''
+  {  5110,  29,  38,  31,    1,  -31 },   // 0x92 ''
+  {  5192,  29,  38,  31,    1,  -31 },   // 0x93 ''
+  {  5274,  29,  38,  31,    1,  -31 },   // 0x94 ''
+  {  5356,  29,  38,  31,    1,  -31 },   // 0x95 ''
+  {  5438,  29,  38,  31,    1,  -31 },   // 0x96 ''
+  {  5520,  29,  38,  31,    1,  -31 },   // 0x97 ''
+  {  5602,  29,  38,  31,    1,  -31 },   // 0x98 ''
+  {  5684,  29,  38,  31,    1,  -31 },   // 0x99 ''
+  {  5766,  29,  38,  31,    1,  -31 },   // 0x9A ''
+  {  5848,  29,  38,  31,    1,  -31 },   // 0x9B ''
+  {  5930,  29,  38,  31,    1,  -31 },   // 0x9C ''
+  {  6012,  29,  38,  31,    1,  -31 },   // 0x9D ''
+  {  6094,  29,  38,  31,    1,  -31 },   // 0x9E ''
+  {  6176,  29,  38,  31,    1,  -31 },   // 0x9F ''
+  {  6258,   1,   1,  11,    0,    0 },   // 0xA0 ''
+  {  6259,   3,  29,  13,    5,  -20 },   // 0xA1 ''
+  {  6267,  18,  29,  22,    2,  -24 },   // 0xA2 ''
+  {  6326,  20,  29,  22,    1,  -28 },   // 0xA3 ''
+  {  6379,  16,  16,  22,    3,  -20 },   // 0xA4 ''
+  {  6412,  21,  27,  22,    0,  -26 },   // 0xA5 ''
+  {  6463,   2,  37,  10,    4,  -28 },   // 0xA6 ''
+  {  6469,  18,  37,  22,    2,  -28 },   // 0xA7 ''
+  {  6528,  11,   4,  13,    1,  -27 },   // 0xA8 ''
+  {  6533,  28,  27,  31,    2,  -26 },   // 0xA9 ''
+  {  6612,  12,  17,  15,    1,  -28 },   // 0xAA ''
+  {  6636,  14,  13,  20,    3,  -16 },   // 0xAB ''
+  {  6662,  19,  12,  23,    2,  -14 },   // 0xAC ''
+  {  6684,   9,   3,  13,    2,  -11 },   // 0xAD ''
+  {  6686,  28,  27,  31,    2,  -26 },   // 0xAE ''
+  {  6763,  11,   3,  13,    1,  -26 },   // 0xAF ''
+  {  6766,  12,  12,  24,    6,  -26 },   // 0xB0 ''
+  {  6783,  19,  25,  23,    2,  -24 },   // 0xB1 ''
+  {  6825,  12,  17,  14,    1,  -31 },   // 0xB2 ''
+  {  6844,  12,  17,  14,    1,  -31 },   // 0xB3 ''
+  {  6866,   8,   6,  13,    4,  -28 },   // 0xB4 ''
+  {  6873,  18,  29,  22,    3,  -20 },   // 0xB5 ''
+  {  6923,  18,  36,  21,    2,  -28 },   // 0xB6 ''
+  {  6993,   4,   4,  10,    3,  -12 },   // 0xB7 ''
+  {  6995,   9,   9,  13,    2,    1 },   // 0xB8 ''
+  {  7005,   6,  16,  14,    3,  -31 },   // 0xB9 ''
+  {  7019,  11,  17,  14,    2,  -28 },   // 0xBA ''
+  {  7042,  14,  13,  20,    3,  -16 },   // 0xBB ''
+  {  7068,  31,  29,  34,    2,  -27 },   // 0xBC ''
+  {  7143,  31,  29,  34,    2,  -28 },   // 0xBD ''
+  {  7213,  32,  30,  34,    1,  -28 },   // 0xBE ''
+  {  7304,  17,  30,  22,    4,  -20 },   // 0xBF ''
+  {  7339,  24,  36,  26,    1,  -35 },   // 0xC0 ''
+  {  7411,  24,  36,  26,    1,  -35 },   // 0xC1 ''
+  {  7483,  24,  36,  26,    1,  -35 },   // 0xC2 ''
+  {  7556,  24,  35,  26,    1,  -34 },   // 0xC3 ''
+  {  7625,  24,  35,  26,    1,  -34 },   // 0xC4 ''
+  {  7696,  24,  38,  26,    1,  -37 },   // 0xC5 ''
+  {  7776,  36,  29,  39,    1,  -28 },   // 0xC6 ''
+  {  7858,  24,  37,  28,    2,  -28 },   // 0xC7 ''
+  {  7929,  21,  36,  25,    3,  -35 },   // 0xC8 ''
+  {  7998,  21,  36,  25,    3,  -35 },   // 0xC9 ''
+  {  8065,  21,  36,  25,    3,  -35 },   // 0xCA ''
+  {  8133,  21,  35,  25,    3,  -34 },   // 0xCB ''
+  {  8201,   9,  36,  11,    0,  -35 },   // 0xCC ''
+  {  8237,   9,  36,  11,    2,  -35 },   // 0xCD ''
+  {  8273,  12,  36,  12,    0,  -35 },   // 0xCE ''
+  {  8311,  11,  35,  12,    0,  -34 },   // 0xCF ''
+  {  8347,  25,  29,  28,    1,  -28 },   // 0xD0 ''
+  {  8404,  22,  35,  29,    3,  -34 },   // 0xD1 ''
+  {  8459,  27,  35,  31,    2,  -34 },   // 0xD2 ''
+  {  8534,  27,  35,  31,    2,  -34 },   // 0xD3 ''
+  {  8609,  27,  35,  31,    2,  -34 },   // 0xD4 ''
+  {  8685,  27,  35,  31,    2,  -34 },   // 0xD5 ''
+  {  8762,  27,  35,  31,    2,  -34 },   // 0xD6 ''
+  {  8840,  15,  16,  23,    4,  -16 },   // 0xD7 ''
+  {  8867,  28,  30,  31,    1,  -29 },   // 0xD8 ''
+  {  8944,  22,  36,  28,    3,  -35 },   // 0xD9 ''
+  {  8991,  22,  36,  28,    3,  -35 },   // 0xDA ''
+  {  9038,  22,  36,  28,    3,  -35 },   // 0xDB ''
+  {  9085,  22,  35,  28,    3,  -34 },   // 0xDC ''
+  {  9131,  25,  36,  27,    1,  -35 },   // 0xDD ''
+  {  9204,  21,  29,  25,    3,  -28 },   // 0xDE ''
+  {  9259,  19,  29,  23,    3,  -28 },   // 0xDF ''
+  {  9311,  19,  29,  21,    1,  -28 },   // 0xE0 ''
+  {  9361,  19,  29,  21,    1,  -28 },   // 0xE1 ''
+  {  9406,  19,  28,  21,    1,  -27 },   // 0xE2 ''
+  {  9453,  19,  27,  21,    1,  -26 },   // 0xE3 ''
+  {  9498,  19,  28,  21,    1,  -27 },   // 0xE4 ''
+  {  9546,  19,  30,  21,    1,  -29 },   // 0xE5 ''
+  {  9595,  32,  21,  34,    1,  -20 },   // 0xE6 ''
+  {  9648,  18,  29,  20,    1,  -20 },   // 0xE7 ''
+  {  9689,  19,  29,  21,    1,  -28 },   // 0xE8 ''
+  {  9737,  19,  29,  21,    1,  -28 },   // 0xE9 ''
+  {  9782,  19,  28,  21,    1,  -27 },   // 0xEA ''
+  {  9826,  19,  28,  21,    1,  -27 },   // 0xEB ''
+  {  9872,   8,  29,   9,    0,  -28 },   // 0xEC ''
+  {  9901,   9,  29,   9,    0,  -28 },   // 0xED ''
+  {  9930,  11,  29,  10,    0,  -28 },   // 0xEE ''
+  {  9962,  11,  29,  10,    0,  -28 },   // 0xEF ''
+  {  9992,  19,  29,  21,    1,  -28 },   // 0xF0 ''
+  { 10037,  17,  27,  21,    2,  -26 },   // 0xF1 ''
+  { 10071,  19,  29,  21,    1,  -28 },   // 0xF2 ''
+  { 10117,  19,  29,  21,    1,  -28 },   // 0xF3 ''
+  { 10159,  19,  29,  21,    1,  -28 },   // 0xF4 ''
+  { 10204,  19,  27,  21,    1,  -26 },   // 0xF5 ''
+  { 10245,  19,  29,  21,    1,  -28 },   // 0xF6 ''
+  { 10290,  19,  18,  23,    2,  -17 },   // 0xF7 ''
+  { 10312,  20,  21,  21,    0,  -20 },   // 0xF8 ''
+  { 10362,  17,  30,  21,    2,  -28 },   // 0xF9 ''
+  { 10398,  17,  30,  21,    2,  -28 },   // 0xFA ''
+  { 10434,  17,  30,  21,    2,  -28 },   // 0xFB ''
+  { 10474,  17,  30,  21,    2,  -28 },   // 0xFC ''
+  { 10514,  18,  37,  19,    0,  -28 },   // 0xFD ''
+  { 10567,  19,  36,  22,    2,  -27 },   // 0xFE ''
+  { 10620,  18,  37,  19,    0,  -28 } }; // 0xFF ''
+
+constexpr GFXfont FreeSans_RLE_20pt8b PROGMEM = {
+  (uint8_t  *)FreeSans_RLE_20pt8bBitmaps,
+  (GFXglyph *)FreeSans_RLE_20pt8bGlyphs,
+  0x20, 0xFF, 47 };
+
+// Approx. 12253 bytes
@@ -0,0 +1,1284 @@
+// Run-length encoded glyph bitmaps (fontconvert -r)
+#define FreeSans_RLE_22pt8b_RLE
+
+const uint8_t FreeSans_RLE_22pt8bBitmaps[] PROGMEM = {
+  0x10, 0x0F, 0x0F, 0x0F, 0x0F, 0x04, 0x13, 0x13, 0x13, 0x12, 0x22, 0x22,
+  0x22, 0x22, 0xDF, 0x01, 0x04, 0x38, 0x38, 0x38, 0x38, 0x38, 0x33, 0x13,
+  0x43, 0x13, 0x43, 0x13, 0x43, 0x22, 0x52, 0x22, 0x51, 0x20, 0x83, 0x54,
+  0xA3, 0x54, 0x94, 0x53, 0xA4, 0x53, 0xA3, 0x63, 0xA3, 0x63, 0xA3, 0x54,
+  0xA3, 0x53, 0x5F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x63, 0x54, 0xA3, 0x54,
+  0x94, 0x53, 0xA4, 0x53, 0xA3, 0x63, 0xA3, 0x63, 0xA3, 0x54, 0xA3, 0x54,
+  0x5F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x53, 0x54, 0xA3, 0x54, 0x94, 0x53,
+  0xA4, 0x53, 0xA3, 0x63, 0xA3, 0x63, 0xA3, 0x54, 0xA3, 0x54, 0x94, 0x53,
+  0x80, 0x93, 0xF0, 0x33, 0xF0, 0x18, 0xBC, 0x7F, 0x56, 0x13, 0x25, 0x44,
+  0x33, 0x35, 0x24, 0x43, 0x44, 0x24, 0x43, 0x53, 0x23, 0x53, 0x53, 0x23,
+  0x53, 0x53, 0x24, 0x43, 0xA4, 0x43, 0xA5, 0x33, 0xB5, 0x23, 0xBA, 0xCB,
+  0xCC, 0xBB, 0xCB, 0xA3, 0x26, 0xA3, 0x45, 0x93, 0x54, 0x93, 0x67, 0x53,
+  0x67, 0x53, 0x63, 0x13, 0x53, 0x63, 0x13, 0x53, 0x54, 0x14, 0x43, 0x54,
+  0x15, 0x33, 0x44, 0x35, 0x23, 0x26, 0x4F, 0x01, 0x6D, 0xB8, 0xF3, 0xF0,
+  0x33, 0xF0, 0x33, 0xF0, 0x33, 0x90, 0xF0, 0xA3, 0xD5, 0xE3, 0xC9, 0xC3,
+  0xBB, 0xA3, 0xB5, 0x35, 0x93, 0xB3, 0x73, 0x83, 0xB4, 0x74, 0x73, 0xB3,
+  0x93, 0x63, 0xC3, 0x93, 0x63, 0xC3, 0x93, 0x53, 0xD4, 0x74, 0x52, 0xF3,
+  0x73, 0x53, 0xF5, 0x44, 0x52, 0xF0, 0x2B, 0x53, 0xF0, 0x39, 0x62, 0xF0,
+  0x65, 0x73, 0xF0, 0xF0, 0x23, 0xF0, 0xF0, 0x33, 0x75, 0xF0, 0x53, 0x69,
+  0xF0, 0x33, 0x5B, 0xF0, 0x13, 0x55, 0x44, 0xF3, 0x53, 0x73, 0xE3, 0x63,
+  0x83, 0xD3, 0x53, 0x93, 0xC3, 0x63, 0x93, 0xC3, 0x63, 0x93, 0xB3, 0x83,
+  0x83, 0xB2, 0x93, 0x73, 0xB3, 0x95, 0x44, 0xB2, 0xBB, 0xB3, 0xC9, 0xB3,
+  0xF5, 0x50, 0x86, 0xF0, 0x2A, 0xEC, 0xD4, 0x44, 0xC4, 0x64, 0xB3, 0x74,
+  0xB3, 0x83, 0xB3, 0x83, 0xB4, 0x64, 0xB4, 0x64, 0xC4, 0x35, 0xD5, 0x15,
+  0xF9, 0xF0, 0x27, 0xF0, 0x26, 0xF0, 0x38, 0xFB, 0x54, 0x45, 0x35, 0x44,
+  0x44, 0x54, 0x43, 0x44, 0x74, 0x33, 0x43, 0x94, 0x14, 0x34, 0x99, 0x34,
+  0xA7, 0x44, 0xB6, 0x44, 0xC4, 0x54, 0xB6, 0x54, 0x98, 0x45, 0x7A, 0x47,
+  0x26, 0x24, 0x4E, 0x44, 0x5B, 0x55, 0x66, 0xD0, 0x0F, 0x09, 0x13, 0x13,
+  0x13, 0x12, 0x22, 0x10, 0x72, 0x73, 0x63, 0x73, 0x63, 0x73, 0x63, 0x73,
+  0x64, 0x63, 0x73, 0x64, 0x63, 0x73, 0x73, 0x73, 0x64, 0x64, 0x64, 0x64,
+  0x64, 0x64, 0x64, 0x64, 0x64, 0x73, 0x73, 0x73, 0x74, 0x73, 0x73, 0x73,
+  0x83, 0x73, 0x73, 0x83, 0x82, 0x83, 0x82, 0x83, 0x83, 0x02, 0x73, 0x73,
+  0x72, 0x73, 0x63, 0x73, 0x63, 0x73, 0x63, 0x63, 0x64, 0x63, 0x63, 0x63,
+  0x64, 0x54, 0x54, 0x54, 0x54, 0x63, 0x54, 0x54, 0x54, 0x54, 0x54, 0x53,
+  0x63, 0x63, 0x54, 0x53, 0x63, 0x53, 0x63, 0x63, 0x53, 0x63, 0x53, 0x62,
+  0x63, 0x62, 0x70, 0x53, 0xA3, 0xA2, 0x61, 0x42, 0x41, 0x14, 0x12, 0x14,
+  0x1D, 0x28, 0x74, 0x86, 0x64, 0x13, 0x53, 0x33, 0x42, 0x42, 0x30, 0x93,
+  0xF0, 0x33, 0xF0, 0x33, 0xF0, 0x33, 0xF0, 0x33, 0xF0, 0x33, 0xF0, 0x33,
+  0xF0, 0x33, 0xF0, 0x33, 0x9F, 0x0F, 0x0F, 0x0F, 0x03, 0x93, 0xF0, 0x33,
+  0xF0, 0x33, 0xF0, 0x33, 0xF0, 0x33, 0xF0, 0x33, 0xF0, 0x33, 0xF0, 0x33,
+  0xF0, 0x33, 0x90, 0x0F, 0x01, 0x22, 0x22, 0x22, 0x22, 0x16, 0x11, 0x30,
+  0x0F, 0x0F, 0x0F, 0x05, 0xA2, 0x93, 0x92, 0xA2, 0x93, 0x92, 0xA2, 0x93,
+  0x93, 0x92, 0xA2, 0x93, 0x92, 0xA2, 0x93, 0x92, 0xA2, 0x93, 0x92, 0xA2,
+  0x93, 0x92, 0xA2, 0x93, 0x92, 0xA2, 0x93, 0x92, 0xA2, 0x93, 0x92, 0xA2,
+  0xA0, 0x76, 0xCA, 0x9C, 0x76, 0x26, 0x55, 0x65, 0x44, 0x84, 0x34, 0x94,
+  0x34, 0xA4, 0x24, 0xA4, 0x14, 0xB4, 0x14, 0xC3, 0x14, 0xC8, 0xC8, 0xC8,
+  0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC3, 0x14, 0xB4, 0x24, 0xA4,
+  0x24, 0xA4, 0x24, 0x94, 0x44, 0x84, 0x44, 0x75, 0x55, 0x45, 0x7C, 0x9A,
+  0xC6, 0x70, 0x83, 0x83, 0x83, 0x74, 0x65, 0x4F, 0x0F, 0x0A, 0x74, 0x74,
+  0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
+  0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x78, 0xBC, 0x8E, 0x67,
+  0x27, 0x54, 0x85, 0x34, 0xA4, 0x34, 0xA5, 0x14, 0xC4, 0x14, 0xC4, 0x14,
+  0xC4, 0x14, 0xC4, 0xF0, 0x24, 0xF0, 0x14, 0xF0, 0x15, 0xF5, 0xF5, 0xE6,
+  0xD7, 0xC8, 0xC7, 0xD6, 0xE5, 0xF5, 0xF5, 0xF0, 0x14, 0xF0, 0x14, 0xF0,
+  0x24, 0xF0, 0x2F, 0x05, 0x1F, 0x05, 0x1F, 0x0F, 0x0B, 0x77, 0xCB, 0x9E,
+  0x66, 0x36, 0x55, 0x75, 0x44, 0x94, 0x34, 0xB4, 0x24, 0xB4, 0x24, 0xB4,
+  0x24, 0xB4, 0xF0, 0x24, 0xF0, 0x14, 0xF0, 0x24, 0xE6, 0xC8, 0xD7, 0xE9,
+  0xF0, 0x25, 0xF0, 0x25, 0xF0, 0x24, 0xF0, 0x34, 0xF0, 0x28, 0xD8, 0xD4,
+  0x14, 0xC4, 0x14, 0xB4, 0x24, 0xB4, 0x34, 0x95, 0x38, 0x18, 0x5F, 0x7D,
+  0xB7, 0x70, 0xE3, 0xF0, 0x24, 0xF0, 0x15, 0xF0, 0x15, 0xF6, 0xE7, 0xD8,
+  0xD3, 0x14, 0xC4, 0x14, 0xB4, 0x24, 0xB3, 0x34, 0xA4, 0x34, 0x94, 0x44,
+  0x84, 0x54, 0x83, 0x64, 0x74, 0x64, 0x64, 0x74, 0x63, 0x84, 0x54, 0x84,
+  0x44, 0x94, 0x4F, 0x0F, 0x0F, 0x0F, 0x03, 0xD4, 0xF0, 0x24, 0xF0, 0x24,
+  0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0x40, 0x4F,
+  0x01, 0x5F, 0x01, 0x4F, 0x02, 0x4F, 0x02, 0x44, 0xF0, 0x24, 0xF0, 0x23,
+  0xF0, 0x33, 0xF0, 0x33, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0x19, 0x7F,
+  0x6F, 0x01, 0x56, 0x56, 0x44, 0x95, 0x33, 0xB4, 0xF0, 0x25, 0xF0, 0x24,
+  0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x28, 0xD4, 0x14, 0xC4, 0x14,
+  0xB4, 0x25, 0xA4, 0x35, 0x75, 0x48, 0x27, 0x5F, 0x8B, 0xC7, 0x70, 0x86,
+  0xBB, 0x8D, 0x67, 0x17, 0x45, 0x74, 0x44, 0x94, 0x24, 0xA4, 0x24, 0xB3,
+  0x24, 0xF0, 0x13, 0xF0, 0x14, 0xF0, 0x14, 0xF0, 0x14, 0x38, 0x54, 0x1B,
+  0x4F, 0x03, 0x28, 0x55, 0x26, 0x85, 0x15, 0xA4, 0x15, 0xB8, 0xC8, 0xC8,
+  0xC8, 0xC8, 0xC4, 0x13, 0xC4, 0x14, 0xA4, 0x25, 0x94, 0x35, 0x74, 0x56,
+  0x27, 0x5E, 0x8B, 0xB6, 0x70, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x05, 0xF0,
+  0x13, 0xF0, 0x14, 0xF0, 0x13, 0xF0, 0x13, 0xF0, 0x14, 0xF0, 0x13, 0xF0,
+  0x14, 0xF4, 0xF0, 0x13, 0xF0, 0x14, 0xF0, 0x13, 0xF0, 0x14, 0xF0, 0x13,
+  0xF0, 0x14, 0xF0, 0x14, 0xF4, 0xF0, 0x14, 0xF0, 0x13, 0xF0, 0x14, 0xF0,
+  0x14, 0xF0, 0x13, 0xF0, 0x14, 0xF0, 0x14, 0xF0, 0x14, 0xF4, 0xF0, 0x14,
+  0xF0, 0x14, 0xC0, 0x67, 0xBB, 0x8E, 0x57, 0x27, 0x35, 0x75, 0x34, 0x95,
+  0x24, 0xA4, 0x24, 0xA4, 0x24, 0xA4, 0x24, 0xA4, 0x24, 0xA4, 0x25, 0x84,
+  0x45, 0x55, 0x6D, 0x9A, 0x8E, 0x56, 0x46, 0x35, 0x85, 0x15, 0xA4, 0x14,
+  0xC8, 0xC8, 0xC7, 0xD8, 0xC8, 0xC8, 0xBA, 0xA4, 0x25, 0x85, 0x37, 0x27,
+  0x5E, 0x7C, 0xA7, 0x70, 0x67, 0xBB, 0x8D, 0x66, 0x36, 0x45, 0x75, 0x34,
+  0x94, 0x24, 0xB4, 0x14, 0xB4, 0x14, 0xC3, 0x14, 0xC3, 0x14, 0xC8, 0xC8,
+  0xB9, 0xBA, 0xA5, 0x14, 0x96, 0x16, 0x58, 0x2F, 0x03, 0x3B, 0x24, 0x58,
+  0x34, 0xF0, 0x14, 0xF0, 0x13, 0xF0, 0x14, 0xF0, 0x14, 0x14, 0xB4, 0x24,
+  0x94, 0x34, 0x94, 0x35, 0x74, 0x56, 0x27, 0x6D, 0x8A, 0xC6, 0x80, 0x0F,
+  0x05, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0x05, 0x0F, 0x05, 0xF0, 0xF0, 0xF0,
+  0xF0, 0xFF, 0x05, 0x32, 0x32, 0x32, 0x23, 0x22, 0x14, 0x11, 0x40, 0xF0,
+  0x51, 0xF0, 0x33, 0xF0, 0x15, 0xD8, 0xB8, 0xA8, 0xB8, 0xB8, 0xA8, 0xC7,
+  0xE4, 0xF0, 0x26, 0xF0, 0x18, 0xF8, 0xF0, 0x18, 0xF8, 0xF8, 0xF0, 0x18,
+  0xF6, 0xF0, 0x24, 0xF0, 0x51, 0x0F, 0x0F, 0x0F, 0x0F, 0x03, 0xF0, 0xF0,
+  0xF0, 0xF0, 0xF0, 0x9F, 0x0F, 0x0F, 0x0F, 0x03, 0x01, 0xF0, 0x53, 0xF0,
+  0x36, 0xF8, 0xF8, 0xF0, 0x18, 0xF8, 0xF8, 0xF0, 0x18, 0xF7, 0xF0, 0x24,
+  0xF6, 0xD7, 0xB8, 0xB8, 0xA8, 0xB8, 0xA8, 0xD6, 0xF4, 0xF0, 0x21, 0xF0,
+  0x50, 0x67, 0xAB, 0x7E, 0x46, 0x28, 0x25, 0x75, 0x24, 0x94, 0x23, 0xB8,
+  0xB8, 0xB8, 0xB4, 0xF4, 0xE4, 0xE5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xE4,
+  0xE5, 0xE4, 0xF4, 0xF4, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x54,
+  0xF4, 0xF4, 0xF4, 0x80, 0xF0, 0x29, 0xF0, 0xDF, 0xF0, 0x8F, 0x04, 0xF0,
+  0x49, 0x4A, 0xF0, 0x16, 0xC7, 0xD6, 0xF0, 0x16, 0xB5, 0xF0, 0x55, 0x95,
+  0xF0, 0x75, 0x84, 0xF0, 0x95, 0x64, 0xB4, 0xB4, 0x54, 0xA8, 0x33, 0x44,
+  0x44, 0x8B, 0x14, 0x44, 0x34, 0x85, 0x43, 0x13, 0x55, 0x24, 0x75, 0x66,
+  0x64, 0x14, 0x75, 0x85, 0x64, 0x14, 0x74, 0x94, 0x74, 0x14, 0x64, 0xA4,
+  0x74, 0x13, 0x74, 0xA4, 0x74, 0x13, 0x74, 0xA4, 0x78, 0x64, 0xB3, 0x88,
+  0x64, 0xA4, 0x74, 0x14, 0x64, 0xA4, 0x74, 0x23, 0x64, 0x94, 0x74, 0x34,
+  0x64, 0x84, 0x74, 0x34, 0x64, 0x75, 0x64, 0x44, 0x65, 0x56, 0x46, 0x54,
+  0x6B, 0x1C, 0x64, 0x79, 0x2A, 0x94, 0x85, 0x57, 0xB5, 0xF0, 0xF0, 0x65,
+  0xF0, 0xF0, 0x65, 0xF0, 0xF0, 0x66, 0xF0, 0xF0, 0x57, 0xE1, 0xF0, 0x4A,
+  0x47, 0xF0, 0x6F, 0x05, 0xF0, 0x7F, 0x02, 0xF0, 0xC9, 0xF0, 0xB5, 0xF0,
+  0x67, 0xF0, 0x57, 0xF0, 0x57, 0xF0, 0x49, 0xF0, 0x34, 0x14, 0xF0, 0x25,
+  0x14, 0xF0, 0x24, 0x25, 0xF0, 0x14, 0x34, 0xF5, 0x34, 0xF4, 0x45, 0xE4,
+  0x54, 0xD4, 0x64, 0xD4, 0x65, 0xC4, 0x74, 0xB4, 0x85, 0xA4, 0x85, 0xA4,
+  0x94, 0x94, 0xA5, 0x8F, 0x04, 0x7F, 0x05, 0x7F, 0x06, 0x64, 0xC5, 0x55,
+  0xD4, 0x54, 0xE5, 0x44, 0xF4, 0x35, 0xF4, 0x34, 0xF0, 0x15, 0x24, 0xF0,
+  0x24, 0x14, 0xF0, 0x39, 0xF0, 0x35, 0x0F, 0x02, 0x7F, 0x04, 0x5F, 0x05,
+  0x4F, 0x06, 0x34, 0xD5, 0x24, 0xE4, 0x24, 0xE4, 0x24, 0xE4, 0x24, 0xE4,
+  0x24, 0xE4, 0x24, 0xE4, 0x24, 0xE4, 0x24, 0xD4, 0x3F, 0x05, 0x4F, 0x04,
+  0x5F, 0x05, 0x4F, 0x06, 0x34, 0xD5, 0x24, 0xE5, 0x14, 0xF4, 0x14, 0xF0,
+  0x18, 0xF0, 0x18, 0xF0, 0x18, 0xF0, 0x18, 0xF9, 0xF4, 0x14, 0xE5, 0x1F,
+  0x07, 0x2F, 0x06, 0x3F, 0x05, 0x4F, 0x03, 0x60, 0xA8, 0xF0, 0x1E, 0xCF,
+  0x01, 0x9F, 0x04, 0x85, 0x96, 0x65, 0xC5, 0x45, 0xE4, 0x44, 0xF4, 0x34,
+  0xF0, 0x24, 0x24, 0xF0, 0x24, 0x24, 0xF0, 0x74, 0xF0, 0x84, 0xF0, 0x84,
+  0xF0, 0x84, 0xF0, 0x84, 0xF0, 0x84, 0xF0, 0x84, 0xF0, 0x84, 0xF0, 0x84,
+  0xF0, 0x84, 0xF0, 0x84, 0xF0, 0x3A, 0xF0, 0x24, 0x24, 0xF0, 0x24, 0x24,
+  0xF0, 0x24, 0x34, 0xF5, 0x35, 0xD5, 0x55, 0xC5, 0x57, 0x86, 0x7F, 0x04,
+  0xAF, 0x01, 0xCE, 0xF0, 0x18, 0x90, 0x0F, 0x01, 0x9F, 0x04, 0x6F, 0x05,
+  0x5F, 0x06, 0x44, 0xC6, 0x34, 0xE5, 0x24, 0xF4, 0x24, 0xF0, 0x14, 0x14,
+  0xF0, 0x14, 0x14, 0xF0, 0x19, 0xF0, 0x28, 0xF0, 0x28, 0xF0, 0x28, 0xF0,
+  0x28, 0xF0, 0x28, 0xF0, 0x28, 0xF0, 0x28, 0xF0, 0x28, 0xF0, 0x28, 0xF0,
+  0x28, 0xF0, 0x28, 0xF0, 0x19, 0xF0, 0x14, 0x14, 0xF0, 0x14, 0x14, 0xF4,
+  0x24, 0xE5, 0x24, 0xC6, 0x3F, 0x06, 0x4F, 0x05, 0x5F, 0x04, 0x6F, 0x01,
+  0x90, 0x0F, 0x07, 0x1F, 0x07, 0x1F, 0x07, 0x1F, 0x07, 0x14, 0xF0, 0x44,
+  0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x44,
+  0xF0, 0x44, 0xF0, 0x4F, 0x07, 0x1F, 0x07, 0x1F, 0x07, 0x1F, 0x07, 0x14,
+  0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x44,
+  0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x4F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x02, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x02, 0xF0, 0x34, 0xF0,
+  0x34, 0xF0, 0x34, 0xF0, 0x34, 0xF0, 0x34, 0xF0, 0x34, 0xF0, 0x34, 0xF0,
+  0x34, 0xF0, 0x3F, 0x04, 0x3F, 0x04, 0x3F, 0x04, 0x3F, 0x04, 0x34, 0xF0,
+  0x34, 0xF0, 0x34, 0xF0, 0x34, 0xF0, 0x34, 0xF0, 0x34, 0xF0, 0x34, 0xF0,
+  0x34, 0xF0, 0x34, 0xF0, 0x34, 0xF0, 0x34, 0xF0, 0x34, 0xF0, 0x34, 0xF0,
+  0x34, 0xF0, 0x30, 0xA9, 0xF0, 0x2E, 0xCF, 0x02, 0xAF, 0x05, 0x76, 0x96,
+  0x65, 0xD5, 0x45, 0xF5, 0x34, 0xF0, 0x24, 0x25, 0xF0, 0x25, 0x14, 0xF0,
+  0x44, 0x14, 0xF0, 0x84, 0xF0, 0x94, 0xF0, 0x94, 0xF0, 0x94, 0xF0, 0x94,
+  0xBF, 0x02, 0xBF, 0x02, 0xBF, 0x02, 0xBF, 0x02, 0xF0, 0x67, 0xF0, 0x67,
+  0xF0, 0x68, 0xF0, 0x44, 0x14, 0xF0, 0x44, 0x15, 0xF0, 0x34, 0x24, 0xF0,
+  0x25, 0x25, 0xF6, 0x35, 0xD7, 0x46, 0x95, 0x13, 0x5F, 0x03, 0x23, 0x6F,
+  0x01, 0x33, 0x8C, 0x62, 0xA8, 0xA0, 0x04, 0xF0, 0x28, 0xF0, 0x28, 0xF0,
+  0x28, 0xF0, 0x28, 0xF0, 0x28, 0xF0, 0x28, 0xF0, 0x28, 0xF0, 0x28, 0xF0,
+  0x28, 0xF0, 0x28, 0xF0, 0x28, 0xF0, 0x28, 0xF0, 0x2F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x03, 0xF0, 0x28, 0xF0, 0x28, 0xF0, 0x28, 0xF0, 0x28,
+  0xF0, 0x28, 0xF0, 0x28, 0xF0, 0x28, 0xF0, 0x28, 0xF0, 0x28, 0xF0, 0x28,
+  0xF0, 0x28, 0xF0, 0x28, 0xF0, 0x28, 0xF0, 0x24, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x04, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4,
+  0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4,
+  0xE4, 0xE9, 0x99, 0x99, 0x94, 0x14, 0x94, 0x14, 0x94, 0x14, 0x85, 0x15,
+  0x74, 0x37, 0x26, 0x4D, 0x6B, 0x97, 0x50, 0x04, 0xF0, 0x19, 0xF5, 0x14,
+  0xE5, 0x24, 0xD5, 0x34, 0xC5, 0x44, 0xB5, 0x54, 0xA5, 0x64, 0x95, 0x74,
+  0x85, 0x84, 0x75, 0x94, 0x65, 0xA4, 0x55, 0xB4, 0x45, 0xC4, 0x36, 0xC4,
+  0x28, 0xB4, 0x14, 0x14, 0xB8, 0x34, 0xA7, 0x45, 0x96, 0x65, 0x85, 0x84,
+  0x84, 0x95, 0x74, 0xA5, 0x64, 0xB4, 0x64, 0xB5, 0x54, 0xC5, 0x44, 0xD5,
+  0x34, 0xD5, 0x34, 0xE5, 0x24, 0xF5, 0x14, 0xF0, 0x14, 0x14, 0xF0, 0x15,
+  0x04, 0xF0, 0x14, 0xF0, 0x14, 0xF0, 0x14, 0xF0, 0x14, 0xF0, 0x14, 0xF0,
+  0x14, 0xF0, 0x14, 0xF0, 0x14, 0xF0, 0x14, 0xF0, 0x14, 0xF0, 0x14, 0xF0,
+  0x14, 0xF0, 0x14, 0xF0, 0x14, 0xF0, 0x14, 0xF0, 0x14, 0xF0, 0x14, 0xF0,
+  0x14, 0xF0, 0x14, 0xF0, 0x14, 0xF0, 0x14, 0xF0, 0x14, 0xF0, 0x14, 0xF0,
+  0x14, 0xF0, 0x14, 0xF0, 0x14, 0xF0, 0x1F, 0x0F, 0x0F, 0x0F, 0x0F, 0x05,
+  0x06, 0xF0, 0x3D, 0xF0, 0x2D, 0xF0, 0x2D, 0xF0, 0x1F, 0xFF, 0xFB, 0x13,
+  0xEC, 0x14, 0xD3, 0x18, 0x14, 0xD3, 0x18, 0x23, 0xC4, 0x18, 0x24, 0xB3,
+  0x28, 0x24, 0xB3, 0x28, 0x33, 0xA4, 0x28, 0x34, 0x93, 0x38, 0x34, 0x93,
+  0x38, 0x43, 0x84, 0x38, 0x44, 0x73, 0x48, 0x44, 0x73, 0x48, 0x53, 0x64,
+  0x48, 0x54, 0x53, 0x58, 0x63, 0x44, 0x58, 0x63, 0x44, 0x58, 0x64, 0x33,
+  0x68, 0x73, 0x24, 0x68, 0x73, 0x24, 0x68, 0x74, 0x13, 0x78, 0x87, 0x78,
+  0x87, 0x78, 0x86, 0x88, 0x95, 0x88, 0x95, 0x84, 0x05, 0xF0, 0x1A, 0xFA,
+  0xFB, 0xEC, 0xDC, 0xD8, 0x14, 0xC8, 0x15, 0xB8, 0x24, 0xB8, 0x34, 0xA8,
+  0x35, 0x98, 0x44, 0x98, 0x54, 0x88, 0x55, 0x78, 0x64, 0x78, 0x65, 0x68,
+  0x74, 0x68, 0x84, 0x58, 0x85, 0x48, 0x94, 0x48, 0xA4, 0x38, 0xA5, 0x28,
+  0xB4, 0x28, 0xC4, 0x18, 0xCD, 0xDC, 0xEB, 0xEB, 0xFA, 0xFA, 0xF0, 0x15,
+  0xB8, 0xF0, 0x4E, 0xEF, 0x02, 0xCF, 0x05, 0x96, 0x97, 0x76, 0xC6, 0x55,
+  0xF5, 0x54, 0xF0, 0x25, 0x35, 0xF0, 0x34, 0x34, 0xF0, 0x45, 0x24, 0xF0,
+  0x54, 0x14, 0xF0, 0x64, 0x14, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0,
+  0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0,
+  0x64, 0x24, 0xF0, 0x54, 0x24, 0xF0, 0x54, 0x25, 0xF0, 0x34, 0x44, 0xF0,
+  0x25, 0x45, 0xF5, 0x66, 0xC6, 0x76, 0x97, 0x9F, 0x05, 0xBF, 0x03, 0xEE,
+  0xF0, 0x48, 0xB0, 0x0F, 0x02, 0x6F, 0x04, 0x4F, 0x06, 0x2F, 0x06, 0x24,
+  0xD5, 0x14, 0xE9, 0xE9, 0xF8, 0xF8, 0xF8, 0xF8, 0xE9, 0xE9, 0xD5, 0x1F,
+  0x07, 0x1F, 0x06, 0x2F, 0x05, 0x3F, 0x02, 0x64, 0xF0, 0x44, 0xF0, 0x44,
+  0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x44,
+  0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x40, 0xB8, 0xF0,
+  0x4E, 0xEF, 0x02, 0xCF, 0x05, 0x96, 0x97, 0x76, 0xC6, 0x55, 0xF5, 0x54,
+  0xF0, 0x25, 0x35, 0xF0, 0x34, 0x34, 0xF0, 0x45, 0x24, 0xF0, 0x54, 0x14,
+  0xF0, 0x64, 0x14, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0,
+  0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x64, 0x24,
+  0xF0, 0x54, 0x24, 0xF0, 0x45, 0x25, 0xC2, 0x44, 0x44, 0xB5, 0x15, 0x45,
+  0xB9, 0x65, 0xB8, 0x76, 0x97, 0x9F, 0x07, 0x9F, 0x07, 0xAE, 0x25, 0xC8,
+  0x64, 0xF0, 0xC2, 0xF0, 0xF0, 0x20, 0x0F, 0x04, 0x7F, 0x06, 0x5F, 0x07,
+  0x4F, 0x08, 0x34, 0xE6, 0x24, 0xF5, 0x24, 0xF0, 0x14, 0x24, 0xF0, 0x14,
+  0x24, 0xF0, 0x14, 0x24, 0xF0, 0x14, 0x24, 0xF0, 0x14, 0x24, 0xF0, 0x14,
+  0x24, 0xF4, 0x34, 0xD6, 0x3F, 0x06, 0x5F, 0x05, 0x6F, 0x06, 0x5F, 0x07,
+  0x44, 0xE5, 0x34, 0xF4, 0x34, 0xF0, 0x14, 0x24, 0xF0, 0x14, 0x24, 0xF0,
+  0x14, 0x24, 0xF0, 0x14, 0x24, 0xF0, 0x14, 0x24, 0xF0, 0x14, 0x24, 0xF0,
+  0x14, 0x24, 0xF0, 0x14, 0x24, 0xF0, 0x14, 0x24, 0xF0, 0x15, 0x14, 0xF0,
+  0x25, 0x88, 0xEE, 0xAF, 0x02, 0x78, 0x29, 0x55, 0xA5, 0x54, 0xC5, 0x35,
+  0xD4, 0x34, 0xE4, 0x34, 0xF4, 0x24, 0xF4, 0x24, 0xF0, 0x65, 0xF0, 0x66,
+  0xF0, 0x49, 0xF0, 0x2B, 0xFE, 0xEE, 0xFB, 0xF0, 0x29, 0xF0, 0x47, 0xF0,
+  0x55, 0xF0, 0x69, 0xF0, 0x28, 0xF0, 0x28, 0xF0, 0x29, 0xF4, 0x24, 0xF4,
+  0x25, 0xD5, 0x36, 0xA5, 0x5F, 0x04, 0x7F, 0x02, 0x9F, 0xD9, 0x80, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0A, 0xB4, 0xF0, 0x64, 0xF0, 0x64, 0xF0,
+  0x64, 0xF0, 0x64, 0xF0, 0x64, 0xF0, 0x64, 0xF0, 0x64, 0xF0, 0x64, 0xF0,
+  0x64, 0xF0, 0x64, 0xF0, 0x64, 0xF0, 0x64, 0xF0, 0x64, 0xF0, 0x64, 0xF0,
+  0x64, 0xF0, 0x64, 0xF0, 0x64, 0xF0, 0x64, 0xF0, 0x64, 0xF0, 0x64, 0xF0,
+  0x64, 0xF0, 0x64, 0xF0, 0x64, 0xF0, 0x64, 0xF0, 0x64, 0xF0, 0x64, 0xA0,
+  0x04, 0xF0, 0x28, 0xF0, 0x28, 0xF0, 0x28, 0xF0, 0x28, 0xF0, 0x28, 0xF0,
+  0x28, 0xF0, 0x28, 0xF0, 0x28, 0xF0, 0x28, 0xF0, 0x28, 0xF0, 0x28, 0xF0,
+  0x28, 0xF0, 0x28, 0xF0, 0x28, 0xF0, 0x28, 0xF0, 0x28, 0xF0, 0x28, 0xF0,
+  0x28, 0xF0, 0x28, 0xF0, 0x28, 0xF0, 0x28, 0xF0, 0x28, 0xF0, 0x24, 0x14,
+  0xF4, 0x24, 0xF4, 0x24, 0xE5, 0x25, 0xD4, 0x46, 0x96, 0x5F, 0x04, 0x7F,
+  0x02, 0x9E, 0xE9, 0x80, 0x04, 0xF0, 0x38, 0xF0, 0x25, 0x14, 0xF0, 0x14,
+  0x24, 0xF0, 0x14, 0x25, 0xE5, 0x34, 0xE4, 0x44, 0xE4, 0x45, 0xC4, 0x64,
+  0xC4, 0x64, 0xC4, 0x65, 0xA4, 0x84, 0xA4, 0x84, 0xA4, 0x94, 0x84, 0xA4,
+  0x84, 0xA4, 0x84, 0xB4, 0x64, 0xC4, 0x64, 0xC4, 0x64, 0xD4, 0x44, 0xE4,
+  0x44, 0xE5, 0x34, 0xF4, 0x24, 0xF0, 0x14, 0x24, 0xF0, 0x24, 0x14, 0xF0,
+  0x28, 0xF0, 0x38, 0xF0, 0x46, 0xF0, 0x56, 0xF0, 0x56, 0xF0, 0x64, 0xB0,
+  0x04, 0xD4, 0xD9, 0xD5, 0xC4, 0x15, 0xB6, 0xC4, 0x24, 0xB6, 0xB5, 0x24,
+  0xB7, 0xA5, 0x24, 0xA8, 0xA4, 0x35, 0x98, 0xA4, 0x44, 0x94, 0x13, 0xA4,
+  0x44, 0x93, 0x24, 0x85, 0x44, 0x84, 0x24, 0x84, 0x55, 0x74, 0x33, 0x84,
+  0x64, 0x73, 0x44, 0x74, 0x64, 0x73, 0x44, 0x64, 0x74, 0x64, 0x44, 0x64,
+  0x75, 0x54, 0x53, 0x64, 0x84, 0x53, 0x64, 0x54, 0x84, 0x44, 0x64, 0x44,
+  0x94, 0x44, 0x64, 0x44, 0x94, 0x44, 0x74, 0x34, 0xA4, 0x33, 0x84, 0x34,
+  0xA4, 0x24, 0x84, 0x33, 0xB4, 0x24, 0x93, 0x24, 0xB4, 0x23, 0xA4, 0x14,
+  0xC8, 0xA4, 0x14, 0xC8, 0xA4, 0x13, 0xD8, 0xB7, 0xD7, 0xC7, 0xE6, 0xC7,
+  0xE6, 0xD5, 0xF6, 0xD5, 0xF0, 0x14, 0xE5, 0x80, 0x15, 0xF5, 0x25, 0xE5,
+  0x45, 0xD4, 0x65, 0xB5, 0x65, 0xA5, 0x85, 0x94, 0xA5, 0x75, 0xA5, 0x65,
+  0xC5, 0x54, 0xE5, 0x34, 0xF0, 0x14, 0x25, 0xF0, 0x15, 0x14, 0xF0, 0x38,
+  0xF0, 0x57, 0xF0, 0x56, 0xF0, 0x66, 0xF0, 0x67, 0xF0, 0x48, 0xF0, 0x3A,
+  0xF0, 0x24, 0x25, 0xF5, 0x34, 0xE5, 0x45, 0xD4, 0x65, 0xB5, 0x74, 0xA5,
+  0x85, 0x85, 0xA5, 0x74, 0xC5, 0x55, 0xC5, 0x45, 0xE5, 0x34, 0xF0, 0x15,
+  0x15, 0xF0, 0x15, 0x10, 0x05, 0xF0, 0x25, 0x25, 0xF0, 0x15, 0x25, 0xF5,
+  0x45, 0xE4, 0x64, 0xD5, 0x65, 0xC4, 0x85, 0xA4, 0x95, 0x95, 0xA5, 0x84,
+  0xC4, 0x75, 0xC5, 0x64, 0xE5, 0x44, 0xF0, 0x14, 0x35, 0xF0, 0x15, 0x24,
+  0xF0, 0x34, 0x14, 0xF0, 0x58, 0xF0, 0x57, 0xF0, 0x76, 0xF0, 0x84, 0xF0,
+  0x94, 0xF0, 0x94, 0xF0, 0x94, 0xF0, 0x94, 0xF0, 0x94, 0xF0, 0x94, 0xF0,
+  0x94, 0xF0, 0x94, 0xF0, 0x94, 0xF0, 0x94, 0xF0, 0x94, 0xF0, 0x94, 0xC0,
+  0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0xF0, 0x35, 0xF0, 0x45,
+  0xF0, 0x35, 0xF0, 0x35, 0xF0, 0x35, 0xF0, 0x35, 0xF0, 0x45, 0xF0, 0x35,
+  0xF0, 0x35, 0xF0, 0x35, 0xF0, 0x36, 0xF0, 0x35, 0xF0, 0x35, 0xF0, 0x35,
+  0xF0, 0x35, 0xF0, 0x45, 0xF0, 0x35, 0xF0, 0x35, 0xF0, 0x35, 0xF0, 0x35,
+  0xF0, 0x45, 0xF0, 0x35, 0xF0, 0x35, 0xF0, 0x3F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x06, 0x0F, 0x0C, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
+  0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
+  0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
+  0x53, 0x5F, 0x09, 0x02, 0xA3, 0x93, 0xA2, 0xA2, 0xA3, 0xA2, 0xA2, 0xA3,
+  0xA2, 0xA2, 0xA3, 0xA2, 0xA2, 0xA3, 0xA2, 0xA2, 0xA3, 0xA2, 0xA2, 0xA3,
+  0x93, 0xA2, 0xA3, 0x93, 0xA2, 0xA2, 0xA3, 0xA2, 0xA2, 0xA3, 0xA2, 0x0F,
+  0x09, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+  0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+  0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x4F, 0x0D,
+  0x64, 0xC4, 0xB6, 0xA6, 0xA6, 0x93, 0x23, 0x83, 0x23, 0x73, 0x43, 0x63,
+  0x43, 0x63, 0x53, 0x43, 0x63, 0x43, 0x63, 0x33, 0x83, 0x23, 0x83, 0x23,
+  0x96, 0xA3, 0x0F, 0x0F, 0x0F, 0x07, 0x05, 0x55, 0x54, 0x64, 0x64, 0x63,
+  0x10, 0x68, 0xCC, 0x9F, 0x67, 0x36, 0x64, 0x85, 0x53, 0xA4, 0x44, 0xA4,
+  0x44, 0xA4, 0xF0, 0x34, 0xF0, 0x34, 0xE8, 0x8E, 0x6F, 0x01, 0x59, 0x44,
+  0x46, 0x84, 0x44, 0xA4, 0x34, 0xB4, 0x34, 0xB4, 0x34, 0xB4, 0x34, 0xA5,
+  0x44, 0x86, 0x45, 0x58, 0x5C, 0x17, 0x3A, 0x36, 0x56, 0x65, 0x03, 0xF0,
+  0x23, 0xF0, 0x23, 0xF0, 0x23, 0xF0, 0x23, 0xF0, 0x23, 0xF0, 0x23, 0xF0,
+  0x23, 0x46, 0x73, 0x2A, 0x53, 0x1C, 0x48, 0x36, 0x36, 0x75, 0x25, 0x94,
+  0x24, 0xB4, 0x14, 0xB4, 0x14, 0xB4, 0x13, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7,
+  0xD7, 0xD8, 0xB4, 0x14, 0xB4, 0x14, 0xB4, 0x15, 0x94, 0x26, 0x75, 0x28,
+  0x36, 0x33, 0x1C, 0x43, 0x2A, 0xC6, 0x70, 0x77, 0xBB, 0x8D, 0x66, 0x27,
+  0x45, 0x74, 0x44, 0x94, 0x24, 0xA4, 0x24, 0xA4, 0x24, 0xF4, 0xF0, 0x14,
+  0xF0, 0x14, 0xF0, 0x14, 0xF0, 0x14, 0xF0, 0x14, 0xF0, 0x14, 0xF0, 0x23,
+  0xC3, 0x24, 0xB3, 0x24, 0xA4, 0x34, 0x94, 0x35, 0x74, 0x56, 0x27, 0x6D,
+  0x8B, 0xB7, 0x60, 0xF0, 0x23, 0xF0, 0x23, 0xF0, 0x23, 0xF0, 0x23, 0xF0,
+  0x23, 0xF0, 0x23, 0xF0, 0x23, 0x76, 0x43, 0x5A, 0x23, 0x4C, 0x13, 0x37,
+  0x28, 0x25, 0x76, 0x24, 0x95, 0x14, 0xB4, 0x14, 0xB4, 0x14, 0xB8, 0xD7,
+  0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD3, 0x14, 0xB4, 0x14, 0xB4, 0x14, 0xB4,
+  0x24, 0x95, 0x25, 0x76, 0x36, 0x38, 0x4C, 0x13, 0x5A, 0x23, 0x76, 0x70,
+  0x77, 0xCB, 0x9D, 0x76, 0x36, 0x55, 0x75, 0x44, 0x94, 0x34, 0xB4, 0x24,
+  0xB4, 0x24, 0xB4, 0x23, 0xD3, 0x14, 0xD3, 0x1F, 0x0F, 0x0F, 0x0F, 0x07,
+  0xF0, 0x24, 0xF0, 0x33, 0xF0, 0x34, 0xB4, 0x24, 0xB4, 0x34, 0x94, 0x45,
+  0x75, 0x56, 0x36, 0x7D, 0x9B, 0xC7, 0x70, 0x64, 0x46, 0x37, 0x35, 0x54,
+  0x63, 0x73, 0x73, 0x73, 0x4F, 0x0F, 0x33, 0x73, 0x73, 0x73, 0x73, 0x73,
+  0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73,
+  0x73, 0x73, 0x40, 0x76, 0xC9, 0x24, 0x4B, 0x23, 0x36, 0x34, 0x13, 0x25,
+  0x76, 0x24, 0x95, 0x14, 0xA5, 0x14, 0xB4, 0x14, 0xB4, 0x13, 0xC8, 0xC8,
+  0xC8, 0xC8, 0xC8, 0xC8, 0xC4, 0x13, 0xC4, 0x14, 0xB4, 0x14, 0xA5, 0x24,
+  0x95, 0x25, 0x76, 0x36, 0x38, 0x4B, 0x14, 0x59, 0x24, 0x75, 0x44, 0xF0,
+  0x14, 0x14, 0xB4, 0x14, 0xA4, 0x25, 0x94, 0x35, 0x65, 0x5E, 0x7C, 0xA8,
+  0x60, 0x03, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0x47, 0x43, 0x2A,
+  0x33, 0x1C, 0x27, 0x46, 0x16, 0x74, 0x15, 0x84, 0x14, 0xA8, 0xA7, 0xB7,
+  0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7,
+  0xB7, 0xB7, 0xB4, 0x0F, 0x9F, 0x0F, 0x0F, 0x0F, 0x09, 0x43, 0x43, 0x43,
+  0x43, 0x43, 0xF0, 0xA3, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+  0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+  0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3F, 0x02, 0x15, 0x20, 0x03,
+  0xF0, 0x13, 0xF0, 0x13, 0xF0, 0x13, 0xF0, 0x13, 0xF0, 0x13, 0xF0, 0x13,
+  0xF0, 0x13, 0xF0, 0x13, 0x95, 0x23, 0x85, 0x33, 0x75, 0x43, 0x65, 0x53,
+  0x55, 0x63, 0x45, 0x73, 0x35, 0x83, 0x25, 0x93, 0x16, 0x9A, 0x9B, 0x86,
+  0x15, 0x75, 0x34, 0x74, 0x45, 0x63, 0x65, 0x53, 0x74, 0x53, 0x75, 0x43,
+  0x84, 0x43, 0x85, 0x33, 0x95, 0x23, 0xA4, 0x23, 0xA5, 0x13, 0xB4, 0x10,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x03, 0x85, 0x76, 0x33, 0x29, 0x4A,
+  0x13, 0x1B, 0x2B, 0x17, 0x3A, 0x3B, 0x76, 0x78, 0x85, 0x88, 0x94, 0x96,
+  0xA4, 0x96, 0xA3, 0xA6, 0xA3, 0xA6, 0xA3, 0xA6, 0xA3, 0xA6, 0xA3, 0xA6,
+  0xA3, 0xA6, 0xA3, 0xA6, 0xA3, 0xA6, 0xA3, 0xA6, 0xA3, 0xA6, 0xA3, 0xA6,
+  0xA3, 0xA6, 0xA3, 0xA6, 0xA3, 0xA6, 0xA3, 0xA6, 0xA3, 0xA3, 0x85, 0x53,
+  0x39, 0x33, 0x2B, 0x23, 0x13, 0x46, 0x16, 0x74, 0x15, 0x89, 0xA8, 0xA7,
+  0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7,
+  0xB7, 0xB7, 0xB7, 0xB4, 0x77, 0xCB, 0x9D, 0x76, 0x36, 0x55, 0x75, 0x44,
+  0x94, 0x34, 0xB4, 0x24, 0xB4, 0x24, 0xB4, 0x14, 0xD3, 0x14, 0xD8, 0xD8,
+  0xD8, 0xD8, 0xD8, 0xD4, 0x14, 0xB4, 0x24, 0xB4, 0x24, 0xB4, 0x34, 0x94,
+  0x45, 0x75, 0x56, 0x36, 0x7D, 0x9B, 0xC7, 0x70, 0x85, 0x73, 0x39, 0x53,
+  0x1C, 0x43, 0x14, 0x36, 0x36, 0x75, 0x25, 0x94, 0x25, 0xA4, 0x14, 0xB4,
+  0x14, 0xB4, 0x13, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD8, 0xB4, 0x14,
+  0xB4, 0x14, 0xB4, 0x15, 0x94, 0x26, 0x75, 0x28, 0x36, 0x33, 0x1C, 0x43,
+  0x2A, 0x53, 0x46, 0x73, 0xF0, 0x23, 0xF0, 0x23, 0xF0, 0x23, 0xF0, 0x23,
+  0xF0, 0x23, 0xF0, 0x23, 0xF0, 0x23, 0xF0, 0x20, 0x76, 0xCA, 0x23, 0x4C,
+  0x13, 0x37, 0x28, 0x25, 0x76, 0x24, 0x95, 0x14, 0xB4, 0x14, 0xB4, 0x14,
+  0xB4, 0x13, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD3, 0x14, 0xB4, 0x14,
+  0xB4, 0x14, 0xB4, 0x24, 0x95, 0x25, 0x76, 0x36, 0x38, 0x4C, 0x13, 0x5A,
+  0x23, 0x76, 0x43, 0xF0, 0x23, 0xF0, 0x23, 0xF0, 0x23, 0xF0, 0x23, 0xF0,
+  0x23, 0xF0, 0x23, 0xF0, 0x23, 0xF0, 0x23, 0x76, 0x28, 0x19, 0x1D, 0x35,
+  0x54, 0x64, 0x64, 0x63, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73,
+  0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x70, 0x67, 0xAB, 0x7D, 0x56, 0x36,
+  0x35, 0x74, 0x34, 0x94, 0x24, 0x94, 0x24, 0xF4, 0xF6, 0xE8, 0xCB, 0x9C,
+  0xAA, 0xD7, 0xF4, 0xF0, 0x18, 0xB4, 0x14, 0xA4, 0x14, 0xA4, 0x15, 0x84,
+  0x27, 0x37, 0x3F, 0x5D, 0x97, 0x60, 0x33, 0x73, 0x73, 0x73, 0x73, 0x73,
+  0x4F, 0x0F, 0x33, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73,
+  0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x74, 0x64, 0x67, 0x37, 0x55, 0x03,
+  0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7,
+  0xB7, 0xB7, 0xB7, 0xB7, 0xA8, 0xA9, 0x8A, 0x7D, 0x48, 0x1C, 0x14, 0x2A,
+  0x24, 0x37, 0x80, 0x14, 0xC4, 0x14, 0xB4, 0x24, 0xB4, 0x34, 0xA4, 0x34,
+  0x94, 0x44, 0x94, 0x54, 0x83, 0x64, 0x74, 0x64, 0x74, 0x74, 0x63, 0x84,
+  0x54, 0x84, 0x54, 0x94, 0x43, 0xA4, 0x34, 0xA4, 0x33, 0xC3, 0x33, 0xC4,
+  0x14, 0xC4, 0x13, 0xE3, 0x13, 0xE7, 0xE6, 0xF0, 0x15, 0xF0, 0x14, 0x90,
+  0x14, 0x85, 0x85, 0x14, 0x85, 0x84, 0x24, 0x85, 0x84, 0x24, 0x77, 0x74,
+  0x34, 0x67, 0x64, 0x44, 0x63, 0x13, 0x64, 0x44, 0x63, 0x13, 0x64, 0x53,
+  0x54, 0x14, 0x54, 0x54, 0x44, 0x14, 0x44, 0x64, 0x43, 0x33, 0x44, 0x64,
+  0x43, 0x33, 0x44, 0x73, 0x43, 0x34, 0x33, 0x84, 0x24, 0x34, 0x24, 0x84,
+  0x23, 0x53, 0x24, 0x93, 0x23, 0x53, 0x23, 0xA3, 0x23, 0x54, 0x13, 0xA8,
+  0x58, 0xA7, 0x77, 0xB6, 0x76, 0xC6, 0x76, 0xC6, 0x76, 0xD4, 0x94, 0xE4,
+  0x94, 0x70, 0x14, 0xA5, 0x24, 0x94, 0x44, 0x74, 0x54, 0x73, 0x74, 0x54,
+  0x84, 0x34, 0x94, 0x33, 0xB4, 0x14, 0xC7, 0xD6, 0xF5, 0xF5, 0xF5, 0xE7,
+  0xC9, 0xB3, 0x24, 0xA4, 0x34, 0x84, 0x44, 0x74, 0x64, 0x64, 0x74, 0x44,
+  0x84, 0x34, 0xA4, 0x24, 0xB4, 0x13, 0xC4, 0x14, 0xB4, 0x14, 0xA4, 0x33,
+  0xA4, 0x34, 0x94, 0x34, 0x84, 0x53, 0x84, 0x54, 0x73, 0x64, 0x64, 0x73,
+  0x64, 0x74, 0x53, 0x84, 0x44, 0x93, 0x44, 0x94, 0x33, 0xA4, 0x24, 0xB3,
+  0x24, 0xB4, 0x13, 0xC8, 0xD6, 0xE6, 0xE6, 0xF4, 0xF0, 0x14, 0xF0, 0x14,
+  0xF0, 0x13, 0xF0, 0x14, 0xF0, 0x14, 0xF4, 0xF0, 0x14, 0xC7, 0xD7, 0xD6,
+  0xF2, 0xF0, 0x1F, 0x02, 0x2F, 0x02, 0x2F, 0x02, 0xE5, 0xE4, 0xE4, 0xE4,
+  0xE5, 0xD5, 0xE4, 0xE4, 0xE4, 0xE5, 0xD5, 0xE4, 0xE4, 0xE4, 0xE5, 0xD5,
+  0xD5, 0xEF, 0x0F, 0x0F, 0x0C, 0x64, 0x46, 0x46, 0x34, 0x64, 0x64, 0x64,
+  0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x63, 0x73, 0x73, 0x64, 0x55,
+  0x45, 0x53, 0x75, 0x64, 0x74, 0x73, 0x73, 0x74, 0x64, 0x64, 0x64, 0x64,
+  0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x76, 0x46, 0x64, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x03, 0x05, 0x56, 0x47, 0x64, 0x73, 0x73,
+  0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x74, 0x73,
+  0x74, 0x74, 0x73, 0x64, 0x54, 0x54, 0x64, 0x63, 0x73, 0x73, 0x73, 0x73,
+  0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x64, 0x37, 0x36, 0x45, 0x50, 0x34,
+  0xE7, 0x82, 0x1A, 0x62, 0x13, 0x35, 0x43, 0x12, 0x6D, 0x78, 0xD5, 0x20,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0A, 0xF0, 0x98, 0x89, 0x78, 0x6D,
+  0x58, 0x5F, 0x48, 0x46, 0x55, 0x48, 0x44, 0x85, 0x38, 0x43, 0xA4, 0x38,
+  0x34, 0xB4, 0x28, 0x34, 0xB4, 0x28, 0x34, 0xB4, 0x28, 0x34, 0xB3, 0x38,
+  0xF0, 0x24, 0x38, 0xF0, 0x15, 0x38, 0xF0, 0x14, 0x48, 0xF4, 0x58, 0xD6,
+  0x58, 0xC5, 0x78, 0xC4, 0x88, 0xB4, 0x98, 0xA5, 0x98, 0xA4, 0xA8, 0xA4,
+  0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xF0, 0x98, 0xF0, 0x98, 0xF0, 0x98, 0xF0,
+  0x98, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xF0, 0x98, 0xF0,
+  0x9F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0A, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0A, 0xF0, 0x98, 0x89, 0x78, 0x6D, 0x58, 0x5F, 0x48, 0x46, 0x55,
+  0x48, 0x44, 0x85, 0x38, 0x43, 0xA4, 0x38, 0x34, 0xB4, 0x28, 0x34, 0xB4,
+  0x28, 0x34, 0xB4, 0x28, 0x34, 0xB3, 0x38, 0xF0, 0x24, 0x38, 0xF0, 0x15,
+  0x38, 0xF0, 0x14, 0x48, 0xF4, 0x58, 0xD6, 0x58, 0xC5, 0x78, 0xC4, 0x88,
+  0xB4, 0x98, 0xA5, 0x98, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8,
+  0xF0, 0x98, 0xF0, 0x98, 0xF0, 0x98, 0xF0, 0x98, 0xA4, 0xA8, 0xA4, 0xA8,
+  0xA4, 0xA8, 0xA4, 0xA8, 0xF0, 0x98, 0xF0, 0x9F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0A, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0A, 0xF0, 0x98, 0x89,
+  0x78, 0x6D, 0x58, 0x5F, 0x48, 0x46, 0x55, 0x48, 0x44, 0x85, 0x38, 0x43,
+  0xA4, 0x38, 0x34, 0xB4, 0x28, 0x34, 0xB4, 0x28, 0x34, 0xB4, 0x28, 0x34,
+  0xB3, 0x38, 0xF0, 0x24, 0x38, 0xF0, 0x15, 0x38, 0xF0, 0x14, 0x48, 0xF4,
+  0x58, 0xD6, 0x58, 0xC5, 0x78, 0xC4, 0x88, 0xB4, 0x98, 0xA5, 0x98, 0xA4,
+  0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xF0, 0x98, 0xF0, 0x98, 0xF0,
+  0x98, 0xF0, 0x98, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xF0,
+  0x98, 0xF0, 0x9F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0A, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0A, 0xF0, 0x98, 0x89, 0x78, 0x6D, 0x58, 0x5F, 0x48,
+  0x46, 0x55, 0x48, 0x44, 0x85, 0x38, 0x43, 0xA4, 0x38, 0x34, 0xB4, 0x28,
+  0x34, 0xB4, 0x28, 0x34, 0xB4, 0x28, 0x34, 0xB3, 0x38, 0xF0, 0x24, 0x38,
+  0xF0, 0x15, 0x38, 0xF0, 0x14, 0x48, 0xF4, 0x58, 0xD6, 0x58, 0xC5, 0x78,
+  0xC4, 0x88, 0xB4, 0x98, 0xA5, 0x98, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8,
+  0xA4, 0xA8, 0xF0, 0x98, 0xF0, 0x98, 0xF0, 0x98, 0xF0, 0x98, 0xA4, 0xA8,
+  0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xF0, 0x98, 0xF0, 0x9F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0A, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0A, 0xF0,
+  0x98, 0x89, 0x78, 0x6D, 0x58, 0x5F, 0x48, 0x46, 0x55, 0x48, 0x44, 0x85,
+  0x38, 0x43, 0xA4, 0x38, 0x34, 0xB4, 0x28, 0x34, 0xB4, 0x28, 0x34, 0xB4,
+  0x28, 0x34, 0xB3, 0x38, 0xF0, 0x24, 0x38, 0xF0, 0x15, 0x38, 0xF0, 0x14,
+  0x48, 0xF4, 0x58, 0xD6, 0x58, 0xC5, 0x78, 0xC4, 0x88, 0xB4, 0x98, 0xA5,
+  0x98, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xF0, 0x98, 0xF0,
+  0x98, 0xF0, 0x98, 0xF0, 0x98, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4,
+  0xA8, 0xF0, 0x98, 0xF0, 0x9F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0A, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0A, 0xF0, 0x98, 0x89, 0x78, 0x6D, 0x58,
+  0x5F, 0x48, 0x46, 0x55, 0x48, 0x44, 0x85, 0x38, 0x43, 0xA4, 0x38, 0x34,
+  0xB4, 0x28, 0x34, 0xB4, 0x28, 0x34, 0xB4, 0x28, 0x34, 0xB3, 0x38, 0xF0,
+  0x24, 0x38, 0xF0, 0x15, 0x38, 0xF0, 0x14, 0x48, 0xF4, 0x58, 0xD6, 0x58,
+  0xC5, 0x78, 0xC4, 0x88, 0xB4, 0x98, 0xA5, 0x98, 0xA4, 0xA8, 0xA4, 0xA8,
+  0xA4, 0xA8, 0xA4, 0xA8, 0xF0, 0x98, 0xF0, 0x98, 0xF0, 0x98, 0xF0, 0x98,
+  0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xF0, 0x98, 0xF0, 0x9F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0A, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0A, 0xF0, 0x98, 0x89, 0x78, 0x6D, 0x58, 0x5F, 0x48, 0x46, 0x55, 0x48,
+  0x44, 0x85, 0x38, 0x43, 0xA4, 0x38, 0x34, 0xB4, 0x28, 0x34, 0xB4, 0x28,
+  0x34, 0xB4, 0x28, 0x34, 0xB3, 0x38, 0xF0, 0x24, 0x38, 0xF0, 0x15, 0x38,
+  0xF0, 0x14, 0x48, 0xF4, 0x58, 0xD6, 0x58, 0xC5, 0x78, 0xC4, 0x88, 0xB4,
+  0x98, 0xA5, 0x98, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xF0,
+  0x98, 0xF0, 0x98, 0xF0, 0x98, 0xF0, 0x98, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4,
+  0xA8, 0xA4, 0xA8, 0xF0, 0x98, 0xF0, 0x9F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0A, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0A, 0xF0, 0x98, 0x89, 0x78,
+  0x6D, 0x58, 0x5F, 0x48, 0x46, 0x55, 0x48, 0x44, 0x85, 0x38, 0x43, 0xA4,
+  0x38, 0x34, 0xB4, 0x28, 0x34, 0xB4, 0x28, 0x34, 0xB4, 0x28, 0x34, 0xB3,
+  0x38, 0xF0, 0x24, 0x38, 0xF0, 0x15, 0x38, 0xF0, 0x14, 0x48, 0xF4, 0x58,
+  0xD6, 0x58, 0xC5, 0x78, 0xC4, 0x88, 0xB4, 0x98, 0xA5, 0x98, 0xA4, 0xA8,
+  0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xF0, 0x98, 0xF0, 0x98, 0xF0, 0x98,
+  0xF0, 0x98, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xF0, 0x98,
+  0xF0, 0x9F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0A, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0A, 0xF0, 0x98, 0x89, 0x78, 0x6D, 0x58, 0x5F, 0x48, 0x46,
+  0x55, 0x48, 0x44, 0x85, 0x38, 0x43, 0xA4, 0x38, 0x34, 0xB4, 0x28, 0x34,
+  0xB4, 0x28, 0x34, 0xB4, 0x28, 0x34, 0xB3, 0x38, 0xF0, 0x24, 0x38, 0xF0,
+  0x15, 0x38, 0xF0, 0x14, 0x48, 0xF4, 0x58, 0xD6, 0x58, 0xC5, 0x78, 0xC4,
+  0x88, 0xB4, 0x98, 0xA5, 0x98, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4,
+  0xA8, 0xF0, 0x98, 0xF0, 0x98, 0xF0, 0x98, 0xF0, 0x98, 0xA4, 0xA8, 0xA4,
+  0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xF0, 0x98, 0xF0, 0x9F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0A, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0A, 0xF0, 0x98,
+  0x89, 0x78, 0x6D, 0x58, 0x5F, 0x48, 0x46, 0x55, 0x48, 0x44, 0x85, 0x38,
+  0x43, 0xA4, 0x38, 0x34, 0xB4, 0x28, 0x34, 0xB4, 0x28, 0x34, 0xB4, 0x28,
+  0x34, 0xB3, 0x38, 0xF0, 0x24, 0x38, 0xF0, 0x15, 0x38, 0xF0, 0x14, 0x48,
+  0xF4, 0x58, 0xD6, 0x58, 0xC5, 0x78, 0xC4, 0x88, 0xB4, 0x98, 0xA5, 0x98,
+  0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xF0, 0x98, 0xF0, 0x98,
+  0xF0, 0x98, 0xF0, 0x98, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8,
+  0xF0, 0x98, 0xF0, 0x9F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0A, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0A, 0xF0, 0x98, 0x89, 0x78, 0x6D, 0x58, 0x5F,
+  0x48, 0x46, 0x55, 0x48, 0x44, 0x85, 0x38, 0x43, 0xA4, 0x38, 0x34, 0xB4,
+  0x28, 0x34, 0xB4, 0x28, 0x34, 0xB4, 0x28, 0x34, 0xB3, 0x38, 0xF0, 0x24,
+  0x38, 0xF0, 0x15, 0x38, 0xF0, 0x14, 0x48, 0xF4, 0x58, 0xD6, 0x58, 0xC5,
+  0x78, 0xC4, 0x88, 0xB4, 0x98, 0xA5, 0x98, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4,
+  0xA8, 0xA4, 0xA8, 0xF0, 0x98, 0xF0, 0x98, 0xF0, 0x98, 0xF0, 0x98, 0xA4,
+  0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xF0, 0x98, 0xF0, 0x9F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0A, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0A,
+  0xF0, 0x98, 0x89, 0x78, 0x6D, 0x58, 0x5F, 0x48, 0x46, 0x55, 0x48, 0x44,
+  0x85, 0x38, 0x43, 0xA4, 0x38, 0x34, 0xB4, 0x28, 0x34, 0xB4, 0x28, 0x34,
+  0xB4, 0x28, 0x34, 0xB3, 0x38, 0xF0, 0x24, 0x38, 0xF0, 0x15, 0x38, 0xF0,
+  0x14, 0x48, 0xF4, 0x58, 0xD6, 0x58, 0xC5, 0x78, 0xC4, 0x88, 0xB4, 0x98,
+  0xA5, 0x98, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xF0, 0x98,
+  0xF0, 0x98, 0xF0, 0x98, 0xF0, 0x98, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8,
+  0xA4, 0xA8, 0xF0, 0x98, 0xF0, 0x9F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0A,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0A, 0xF0, 0x98, 0x89, 0x78, 0x6D,
+  0x58, 0x5F, 0x48, 0x46, 0x55, 0x48, 0x44, 0x85, 0x38, 0x43, 0xA4, 0x38,
+  0x34, 0xB4, 0x28, 0x34, 0xB4, 0x28, 0x34, 0xB4, 0x28, 0x34, 0xB3, 0x38,
+  0xF0, 0x24, 0x38, 0xF0, 0x15, 0x38, 0xF0, 0x14, 0x48, 0xF4, 0x58, 0xD6,
+  0x58, 0xC5, 0x78, 0xC4, 0x88, 0xB4, 0x98, 0xA5, 0x98, 0xA4, 0xA8, 0xA4,
+  0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xF0, 0x98, 0xF0, 0x98, 0xF0, 0x98, 0xF0,
+  0x98, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xF0, 0x98, 0xF0,
+  0x9F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0A, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0A, 0xF0, 0x98, 0x89, 0x78, 0x6D, 0x58, 0x5F, 0x48, 0x46, 0x55,
+  0x48, 0x44, 0x85, 0x38, 0x43, 0xA4, 0x38, 0x34, 0xB4, 0x28, 0x34, 0xB4,
+  0x28, 0x34, 0xB4, 0x28, 0x34, 0xB3, 0x38, 0xF0, 0x24, 0x38, 0xF0, 0x15,
+  0x38, 0xF0, 0x14, 0x48, 0xF4, 0x58, 0xD6, 0x58, 0xC5, 0x78, 0xC4, 0x88,
+  0xB4, 0x98, 0xA5, 0x98, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8,
+  0xF0, 0x98, 0xF0, 0x98, 0xF0, 0x98, 0xF0, 0x98, 0xA4, 0xA8, 0xA4, 0xA8,
+  0xA4, 0xA8, 0xA4, 0xA8, 0xF0, 0x98, 0xF0, 0x9F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0A, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0A, 0xF0, 0x98, 0x89,
+  0x78, 0x6D, 0x58, 0x5F, 0x48, 0x46, 0x55, 0x48, 0x44, 0x85, 0x38, 0x43,
+  0xA4, 0x38, 0x34, 0xB4, 0x28, 0x34, 0xB4, 0x28, 0x34, 0xB4, 0x28, 0x34,
+  0xB3, 0x38, 0xF0, 0x24, 0x38, 0xF0, 0x15, 0x38, 0xF0, 0x14, 0x48, 0xF4,
+  0x58, 0xD6, 0x58, 0xC5, 0x78, 0xC4, 0x88, 0xB4, 0x98, 0xA5, 0x98, 0xA4,
+  0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xF0, 0x98, 0xF0, 0x98, 0xF0,
+  0x98, 0xF0, 0x98, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xF0,
+  0x98, 0xF0, 0x9F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0A, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0A, 0xF0, 0x98, 0x89, 0x78, 0x6D, 0x58, 0x5F, 0x48,
+  0x46, 0x55, 0x48, 0x44, 0x85, 0x38, 0x43, 0xA4, 0x38, 0x34, 0xB4, 0x28,
+  0x34, 0xB4, 0x28, 0x34, 0xB4, 0x28, 0x34, 0xB3, 0x38, 0xF0, 0x24, 0x38,
+  0xF0, 0x15, 0x38, 0xF0, 0x14, 0x48, 0xF4, 0x58, 0xD6, 0x58, 0xC5, 0x78,
+  0xC4, 0x88, 0xB4, 0x98, 0xA5, 0x98, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8,
+  0xA4, 0xA8, 0xF0, 0x98, 0xF0, 0x98, 0xF0, 0x98, 0xF0, 0x98, 0xA4, 0xA8,
+  0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xF0, 0x98, 0xF0, 0x9F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0A, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0A, 0xF0,
+  0x98, 0x89, 0x78, 0x6D, 0x58, 0x5F, 0x48, 0x46, 0x55, 0x48, 0x44, 0x85,
+  0x38, 0x43, 0xA4, 0x38, 0x34, 0xB4, 0x28, 0x34, 0xB4, 0x28, 0x34, 0xB4,
+  0x28, 0x34, 0xB3, 0x38, 0xF0, 0x24, 0x38, 0xF0, 0x15, 0x38, 0xF0, 0x14,
+  0x48, 0xF4, 0x58, 0xD6, 0x58, 0xC5, 0x78, 0xC4, 0x88, 0xB4, 0x98, 0xA5,
+  0x98, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xF0, 0x98, 0xF0,
+  0x98, 0xF0, 0x98, 0xF0, 0x98, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4,
+  0xA8, 0xF0, 0x98, 0xF0, 0x9F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0A, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0A, 0xF0, 0x98, 0x89, 0x78, 0x6D, 0x58,
+  0x5F, 0x48, 0x46, 0x55, 0x48, 0x44, 0x85, 0x38, 0x43, 0xA4, 0x38, 0x34,
+  0xB4, 0x28, 0x34, 0xB4, 0x28, 0x34, 0xB4, 0x28, 0x34, 0xB3, 0x38, 0xF0,
+  0x24, 0x38, 0xF0, 0x15, 0x38, 0xF0, 0x14, 0x48, 0xF4, 0x58, 0xD6, 0x58,
+  0xC5, 0x78, 0xC4, 0x88, 0xB4, 0x98, 0xA5, 0x98, 0xA4, 0xA8, 0xA4, 0xA8,
+  0xA4, 0xA8, 0xA4, 0xA8, 0xF0, 0x98, 0xF0, 0x98, 0xF0, 0x98, 0xF0, 0x98,
+  0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xF0, 0x98, 0xF0, 0x9F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0A, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0A, 0xF0, 0x98, 0x89, 0x78, 0x6D, 0x58, 0x5F, 0x48, 0x46, 0x55, 0x48,
+  0x44, 0x85, 0x38, 0x43, 0xA4, 0x38, 0x34, 0xB4, 0x28, 0x34, 0xB4, 0x28,
+  0x34, 0xB4, 0x28, 0x34, 0xB3, 0x38, 0xF0, 0x24, 0x38, 0xF0, 0x15, 0x38,
+  0xF0, 0x14, 0x48, 0xF4, 0x58, 0xD6, 0x58, 0xC5, 0x78, 0xC4, 0x88, 0xB4,
+  0x98, 0xA5, 0x98, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xF0,
+  0x98, 0xF0, 0x98, 0xF0, 0x98, 0xF0, 0x98, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4,
+  0xA8, 0xA4, 0xA8, 0xF0, 0x98, 0xF0, 0x9F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0A, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0A, 0xF0, 0x98, 0x89, 0x78,
+  0x6D, 0x58, 0x5F, 0x48, 0x46, 0x55, 0x48, 0x44, 0x85, 0x38, 0x43, 0xA4,
+  0x38, 0x34, 0xB4, 0x28, 0x34, 0xB4, 0x28, 0x34, 0xB4, 0x28, 0x34, 0xB3,
+  0x38, 0xF0, 0x24, 0x38, 0xF0, 0x15, 0x38, 0xF0, 0x14, 0x48, 0xF4, 0x58,
+  0xD6, 0x58, 0xC5, 0x78, 0xC4, 0x88, 0xB4, 0x98, 0xA5, 0x98, 0xA4, 0xA8,
+  0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xF0, 0x98, 0xF0, 0x98, 0xF0, 0x98,
+  0xF0, 0x98, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xF0, 0x98,
+  0xF0, 0x9F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0A, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0A, 0xF0, 0x98, 0x89, 0x78, 0x6D, 0x58, 0x5F, 0x48, 0x46,
+  0x55, 0x48, 0x44, 0x85, 0x38, 0x43, 0xA4, 0x38, 0x34, 0xB4, 0x28, 0x34,
+  0xB4, 0x28, 0x34, 0xB4, 0x28, 0x34, 0xB3, 0x38, 0xF0, 0x24, 0x38, 0xF0,
+  0x15, 0x38, 0xF0, 0x14, 0x48, 0xF4, 0x58, 0xD6, 0x58, 0xC5, 0x78, 0xC4,
+  0x88, 0xB4, 0x98, 0xA5, 0x98, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4,
+  0xA8, 0xF0, 0x98, 0xF0, 0x98, 0xF0, 0x98, 0xF0, 0x98, 0xA4, 0xA8, 0xA4,
+  0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xF0, 0x98, 0xF0, 0x9F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0A, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0A, 0xF0, 0x98,
+  0x89, 0x78, 0x6D, 0x58, 0x5F, 0x48, 0x46, 0x55, 0x48, 0x44, 0x85, 0x38,
+  0x43, 0xA4, 0x38, 0x34, 0xB4, 0x28, 0x34, 0xB4, 0x28, 0x34, 0xB4, 0x28,
+  0x34, 0xB3, 0x38, 0xF0, 0x24, 0x38, 0xF0, 0x15, 0x38, 0xF0, 0x14, 0x48,
+  0xF4, 0x58, 0xD6, 0x58, 0xC5, 0x78, 0xC4, 0x88, 0xB4, 0x98, 0xA5, 0x98,
+  0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xF0, 0x98, 0xF0, 0x98,
+  0xF0, 0x98, 0xF0, 0x98, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8,
+  0xF0, 0x98, 0xF0, 0x9F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0A, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0A, 0xF0, 0x98, 0x89, 0x78, 0x6D, 0x58, 0x5F,
+  0x48, 0x46, 0x55, 0x48, 0x44, 0x85, 0x38, 0x43, 0xA4, 0x38, 0x34, 0xB4,
+  0x28, 0x34, 0xB4, 0x28, 0x34, 0xB4, 0x28, 0x34, 0xB3, 0x38, 0xF0, 0x24,
+  0x38, 0xF0, 0x15, 0x38, 0xF0, 0x14, 0x48, 0xF4, 0x58, 0xD6, 0x58, 0xC5,
+  0x78, 0xC4, 0x88, 0xB4, 0x98, 0xA5, 0x98, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4,
+  0xA8, 0xA4, 0xA8, 0xF0, 0x98, 0xF0, 0x98, 0xF0, 0x98, 0xF0, 0x98, 0xA4,
+  0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xF0, 0x98, 0xF0, 0x9F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0A, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0A,
+  0xF0, 0x98, 0x89, 0x78, 0x6D, 0x58, 0x5F, 0x48, 0x46, 0x55, 0x48, 0x44,
+  0x85, 0x38, 0x43, 0xA4, 0x38, 0x34, 0xB4, 0x28, 0x34, 0xB4, 0x28, 0x34,
+  0xB4, 0x28, 0x34, 0xB3, 0x38, 0xF0, 0x24, 0x38, 0xF0, 0x15, 0x38, 0xF0,
+  0x14, 0x48, 0xF4, 0x58, 0xD6, 0x58, 0xC5, 0x78, 0xC4, 0x88, 0xB4, 0x98,
+  0xA5, 0x98, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xF0, 0x98,
+  0xF0, 0x98, 0xF0, 0x98, 0xF0, 0x98, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8,
+  0xA4, 0xA8, 0xF0, 0x98, 0xF0, 0x9F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0A,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0A, 0xF0, 0x98, 0x89, 0x78, 0x6D,
+  0x58, 0x5F, 0x48, 0x46, 0x55, 0x48, 0x44, 0x85, 0x38, 0x43, 0xA4, 0x38,
+  0x34, 0xB4, 0x28, 0x34, 0xB4, 0x28, 0x34, 0xB4, 0x28, 0x34, 0xB3, 0x38,
+  0xF0, 0x24, 0x38, 0xF0, 0x15, 0x38, 0xF0, 0x14, 0x48, 0xF4, 0x58, 0xD6,
+  0x58, 0xC5, 0x78, 0xC4, 0x88, 0xB4, 0x98, 0xA5, 0x98, 0xA4, 0xA8, 0xA4,
+  0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xF0, 0x98, 0xF0, 0x98, 0xF0, 0x98, 0xF0,
+  0x98, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xF0, 0x98, 0xF0,
+  0x9F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0A, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0A, 0xF0, 0x98, 0x89, 0x78, 0x6D, 0x58, 0x5F, 0x48, 0x46, 0x55,
+  0x48, 0x44, 0x85, 0x38, 0x43, 0xA4, 0x38, 0x34, 0xB4, 0x28, 0x34, 0xB4,
+  0x28, 0x34, 0xB4, 0x28, 0x34, 0xB3, 0x38, 0xF0, 0x24, 0x38, 0xF0, 0x15,
+  0x38, 0xF0, 0x14, 0x48, 0xF4, 0x58, 0xD6, 0x58, 0xC5, 0x78, 0xC4, 0x88,
+  0xB4, 0x98, 0xA5, 0x98, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8,
+  0xF0, 0x98, 0xF0, 0x98, 0xF0, 0x98, 0xF0, 0x98, 0xA4, 0xA8, 0xA4, 0xA8,
+  0xA4, 0xA8, 0xA4, 0xA8, 0xF0, 0x98, 0xF0, 0x9F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0A, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0A, 0xF0, 0x98, 0x89,
+  0x78, 0x6D, 0x58, 0x5F, 0x48, 0x46, 0x55, 0x48, 0x44, 0x85, 0x38, 0x43,
+  0xA4, 0x38, 0x34, 0xB4, 0x28, 0x34, 0xB4, 0x28, 0x34, 0xB4, 0x28, 0x34,
+  0xB3, 0x38, 0xF0, 0x24, 0x38, 0xF0, 0x15, 0x38, 0xF0, 0x14, 0x48, 0xF4,
+  0x58, 0xD6, 0x58, 0xC5, 0x78, 0xC4, 0x88, 0xB4, 0x98, 0xA5, 0x98, 0xA4,
+  0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xF0, 0x98, 0xF0, 0x98, 0xF0,
+  0x98, 0xF0, 0x98, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xF0,
+  0x98, 0xF0, 0x9F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0A, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0A, 0xF0, 0x98, 0x89, 0x78, 0x6D, 0x58, 0x5F, 0x48,
+  0x46, 0x55, 0x48, 0x44, 0x85, 0x38, 0x43, 0xA4, 0x38, 0x34, 0xB4, 0x28,
+  0x34, 0xB4, 0x28, 0x34, 0xB4, 0x28, 0x34, 0xB3, 0x38, 0xF0, 0x24, 0x38,
+  0xF0, 0x15, 0x38, 0xF0, 0x14, 0x48, 0xF4, 0x58, 0xD6, 0x58, 0xC5, 0x78,
+  0xC4, 0x88, 0xB4, 0x98, 0xA5, 0x98, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8,
+  0xA4, 0xA8, 0xF0, 0x98, 0xF0, 0x98, 0xF0, 0x98, 0xF0, 0x98, 0xA4, 0xA8,
+  0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xF0, 0x98, 0xF0, 0x9F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0A, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0A, 0xF0,
+  0x98, 0x89, 0x78, 0x6D, 0x58, 0x5F, 0x48, 0x46, 0x55, 0x48, 0x44, 0x85,
+  0x38, 0x43, 0xA4, 0x38, 0x34, 0xB4, 0x28, 0x34, 0xB4, 0x28, 0x34, 0xB4,
+  0x28, 0x34, 0xB3, 0x38, 0xF0, 0x24, 0x38, 0xF0, 0x15, 0x38, 0xF0, 0x14,
+  0x48, 0xF4, 0x58, 0xD6, 0x58, 0xC5, 0x78, 0xC4, 0x88, 0xB4, 0x98, 0xA5,
+  0x98, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xF0, 0x98, 0xF0,
+  0x98, 0xF0, 0x98, 0xF0, 0x98, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4,
+  0xA8, 0xF0, 0x98, 0xF0, 0x9F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0A, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0A, 0xF0, 0x98, 0x89, 0x78, 0x6D, 0x58,
+  0x5F, 0x48, 0x46, 0x55, 0x48, 0x44, 0x85, 0x38, 0x43, 0xA4, 0x38, 0x34,
+  0xB4, 0x28, 0x34, 0xB4, 0x28, 0x34, 0xB4, 0x28, 0x34, 0xB3, 0x38, 0xF0,
+  0x24, 0x38, 0xF0, 0x15, 0x38, 0xF0, 0x14, 0x48, 0xF4, 0x58, 0xD6, 0x58,
+  0xC5, 0x78, 0xC4, 0x88, 0xB4, 0x98, 0xA5, 0x98, 0xA4, 0xA8, 0xA4, 0xA8,
+  0xA4, 0xA8, 0xA4, 0xA8, 0xF0, 0x98, 0xF0, 0x98, 0xF0, 0x98, 0xF0, 0x98,
+  0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xF0, 0x98, 0xF0, 0x9F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0A, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0A, 0xF0, 0x98, 0x89, 0x78, 0x6D, 0x58, 0x5F, 0x48, 0x46, 0x55, 0x48,
+  0x44, 0x85, 0x38, 0x43, 0xA4, 0x38, 0x34, 0xB4, 0x28, 0x34, 0xB4, 0x28,
+  0x34, 0xB4, 0x28, 0x34, 0xB3, 0x38, 0xF0, 0x24, 0x38, 0xF0, 0x15, 0x38,
+  0xF0, 0x14, 0x48, 0xF4, 0x58, 0xD6, 0x58, 0xC5, 0x78, 0xC4, 0x88, 0xB4,
+  0x98, 0xA5, 0x98, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xF0,
+  0x98, 0xF0, 0x98, 0xF0, 0x98, 0xF0, 0x98, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4,
+  0xA8, 0xA4, 0xA8, 0xF0, 0x98, 0xF0, 0x9F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0A, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0A, 0xF0, 0x98, 0x89, 0x78,
+  0x6D, 0x58, 0x5F, 0x48, 0x46, 0x55, 0x48, 0x44, 0x85, 0x38, 0x43, 0xA4,
+  0x38, 0x34, 0xB4, 0x28, 0x34, 0xB4, 0x28, 0x34, 0xB4, 0x28, 0x34, 0xB3,
+  0x38, 0xF0, 0x24, 0x38, 0xF0, 0x15, 0x38, 0xF0, 0x14, 0x48, 0xF4, 0x58,
+  0xD6, 0x58, 0xC5, 0x78, 0xC4, 0x88, 0xB4, 0x98, 0xA5, 0x98, 0xA4, 0xA8,
+  0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xF0, 0x98, 0xF0, 0x98, 0xF0, 0x98,
+  0xF0, 0x98, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xF0, 0x98,
+  0xF0, 0x9F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0A, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0A, 0xF0, 0x98, 0x89, 0x78, 0x6D, 0x58, 0x5F, 0x48, 0x46,
+  0x55, 0x48, 0x44, 0x85, 0x38, 0x43, 0xA4, 0x38, 0x34, 0xB4, 0x28, 0x34,
+  0xB4, 0x28, 0x34, 0xB4, 0x28, 0x34, 0xB3, 0x38, 0xF0, 0x24, 0x38, 0xF0,
+  0x15, 0x38, 0xF0, 0x14, 0x48, 0xF4, 0x58, 0xD6, 0x58, 0xC5, 0x78, 0xC4,
+  0x88, 0xB4, 0x98, 0xA5, 0x98, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4,
+  0xA8, 0xF0, 0x98, 0xF0, 0x98, 0xF0, 0x98, 0xF0, 0x98, 0xA4, 0xA8, 0xA4,
+  0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xF0, 0x98, 0xF0, 0x9F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0A, 0x10, 0x0F, 0x05, 0xD2, 0x22, 0x22, 0x22, 0x22, 0x22,
+  0x2F, 0x0F, 0x0F, 0x0F, 0x0B, 0xA1, 0xF0, 0x41, 0xF0, 0x41, 0xF0, 0x41,
+  0xF0, 0x17, 0xBB, 0x8D, 0x66, 0x11, 0x16, 0x45, 0x31, 0x35, 0x34, 0x41,
+  0x44, 0x24, 0x51, 0x53, 0x24, 0x51, 0x54, 0x13, 0x61, 0x94, 0x61, 0x94,
+  0x61, 0x94, 0x61, 0x94, 0x61, 0x94, 0x61, 0x94, 0x61, 0x94, 0x61, 0xA3,
+  0x61, 0x54, 0x14, 0x51, 0x54, 0x14, 0x51, 0x54, 0x24, 0x41, 0x44, 0x35,
+  0x31, 0x35, 0x46, 0x11, 0x16, 0x6D, 0x8B, 0xB7, 0xF0, 0x11, 0xF0, 0x41,
+  0xF0, 0x41, 0xF0, 0x41, 0x90, 0x87, 0xDB, 0x9E, 0x78, 0x17, 0x64, 0x85,
+  0x44, 0xA4, 0x44, 0xB4, 0x24, 0xC4, 0x24, 0xC4, 0x24, 0xC4, 0x25, 0xF0,
+  0x34, 0xF0, 0x34, 0xF0, 0x44, 0xF0, 0x35, 0xEF, 0x7F, 0xC4, 0xF0, 0x34,
+  0xF0, 0x43, 0xF0, 0x44, 0xF0, 0x33, 0xF0, 0x43, 0xF0, 0x34, 0xF0, 0x33,
+  0xF0, 0x33, 0xF0, 0x33, 0xF0, 0x33, 0x18, 0x52, 0x2F, 0x05, 0x2F, 0x06,
+  0x23, 0x5B, 0x31, 0xA6, 0x30, 0xF0, 0x42, 0xC1, 0x24, 0x17, 0x14, 0x2F,
+  0x02, 0x2F, 0x35, 0x45, 0x34, 0x74, 0x34, 0x84, 0x23, 0x94, 0x23, 0x94,
+  0x23, 0x94, 0x24, 0x83, 0x44, 0x64, 0x46, 0x26, 0x3F, 0x01, 0x1F, 0x03,
+  0x13, 0x26, 0x23, 0x31, 0xC1, 0x20, 0x13, 0xF0, 0x13, 0x14, 0xE4, 0x24,
+  0xC4, 0x34, 0xC4, 0x44, 0xA4, 0x63, 0xA3, 0x74, 0x84, 0x83, 0x83, 0x94,
+  0x64, 0xA3, 0x63, 0xB4, 0x44, 0xC4, 0x33, 0xD4, 0x24, 0xE4, 0x13, 0xF0,
+  0x17, 0xF0, 0x16, 0xBF, 0x03, 0x5F, 0x03, 0xC4, 0xF0, 0x44, 0xF0, 0x44,
+  0xCF, 0x03, 0x5F, 0x03, 0xC4, 0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x44, 0xF0,
+  0x44, 0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x44, 0x90, 0x0F, 0x0F, 0x0F, 0x06,
+  0xF0, 0x3F, 0x0F, 0x0F, 0x09, 0x76, 0xCA, 0x9C, 0x85, 0x26, 0x64, 0x64,
+  0x64, 0x74, 0x44, 0x84, 0x44, 0x84, 0x54, 0x74, 0x55, 0xF6, 0xF6, 0xD9,
+  0xA4, 0x17, 0x73, 0x47, 0x54, 0x67, 0x33, 0x87, 0x23, 0xA6, 0x13, 0xB5,
+  0x14, 0xBA, 0xB4, 0x15, 0xA4, 0x16, 0x94, 0x27, 0x74, 0x37, 0x63, 0x66,
+  0x44, 0x77, 0x14, 0xA9, 0xC6, 0xF0, 0x15, 0xF0, 0x15, 0xF0, 0x14, 0x44,
+  0x84, 0x44, 0x84, 0x53, 0x84, 0x54, 0x74, 0x55, 0x55, 0x6D, 0x8B, 0xA8,
+  0x70, 0x05, 0x39, 0x39, 0x39, 0x34, 0xB8, 0xF0, 0x6D, 0xF0, 0x17, 0x37,
+  0xC6, 0x95, 0xA5, 0xD4, 0x84, 0xF0, 0x14, 0x73, 0x66, 0x64, 0x53, 0x69,
+  0x53, 0x44, 0x4C, 0x53, 0x33, 0x54, 0x54, 0x43, 0x32, 0x53, 0x83, 0x53,
+  0x13, 0x53, 0x93, 0x43, 0x13, 0x43, 0xF0, 0x32, 0x12, 0x53, 0xF0, 0x35,
+  0x53, 0xF0, 0x35, 0x53, 0xF0, 0x35, 0x53, 0xF0, 0x35, 0x53, 0xF0, 0x36,
+  0x43, 0xA3, 0x56, 0x43, 0xA3, 0x52, 0x13, 0x53, 0x93, 0x43, 0x23, 0x44,
+  0x73, 0x53, 0x23, 0x54, 0x54, 0x43, 0x34, 0x4C, 0x53, 0x43, 0x69, 0x53,
+  0x63, 0x75, 0x64, 0x64, 0xF0, 0x14, 0x85, 0xD4, 0xA6, 0x95, 0xDF, 0x02,
+  0xF0, 0x1D, 0xF0, 0x58, 0xC0, 0x36, 0x49, 0x33, 0x34, 0x13, 0x53, 0x13,
+  0x53, 0x93, 0x57, 0x2A, 0x14, 0x43, 0x12, 0x63, 0x12, 0x63, 0x12, 0x63,
+  0x13, 0x35, 0x18, 0x13, 0x25, 0x23, 0xF0, 0x9F, 0x09, 0x61, 0x71, 0x52,
+  0x71, 0x34, 0x53, 0x25, 0x44, 0x14, 0x54, 0x14, 0x54, 0x23, 0x63, 0x32,
+  0x72, 0x44, 0x54, 0x34, 0x45, 0x34, 0x54, 0x34, 0x53, 0x43, 0x62, 0x61,
+  0x71, 0x0F, 0x0F, 0x0F, 0x0F, 0x03, 0xF0, 0x33, 0xF0, 0x33, 0xF0, 0x33,
+  0xF0, 0x33, 0xF0, 0x33, 0xF0, 0x33, 0xF0, 0x33, 0xF0, 0x33, 0xF0, 0x33,
+  0x0F, 0x0F, 0xB8, 0xF0, 0x6D, 0xF0, 0x17, 0x37, 0xC6, 0x95, 0xA5, 0xD4,
+  0x84, 0xF0, 0x14, 0x73, 0xF0, 0x34, 0x53, 0x3C, 0x53, 0x44, 0x3D, 0x53,
+  0x33, 0x43, 0x74, 0x43, 0x32, 0x53, 0x83, 0x53, 0x13, 0x53, 0x92, 0x53,
+  0x13, 0x53, 0x92, 0x62, 0x12, 0x63, 0x83, 0x65, 0x63, 0x74, 0x65, 0x6D,
+  0x75, 0x6D, 0x75, 0x63, 0x64, 0x76, 0x53, 0x83, 0x66, 0x53, 0x83, 0x62,
+  0x13, 0x53, 0x83, 0x53, 0x23, 0x43, 0x83, 0x53, 0x23, 0x43, 0x83, 0x43,
+  0x34, 0x33, 0x83, 0x43, 0x43, 0x33, 0x93, 0x23, 0x63, 0xF0, 0x34, 0x64,
+  0xF0, 0x14, 0x85, 0xD4, 0xA6, 0x95, 0xDF, 0x02, 0xF0, 0x1D, 0xF0, 0x58,
+  0xC0, 0x0F, 0x0F, 0x06, 0x46, 0x6A, 0x43, 0x44, 0x23, 0x63, 0x22, 0x82,
+  0x22, 0x86, 0x83, 0x12, 0x82, 0x23, 0x63, 0x33, 0x44, 0x3A, 0x66, 0x40,
+  0x93, 0xF0, 0x33, 0xF0, 0x33, 0xF0, 0x33, 0xF0, 0x33, 0xF0, 0x33, 0xF0,
+  0x33, 0xF0, 0x33, 0xF0, 0x33, 0x9F, 0x0F, 0x0F, 0x0F, 0x03, 0x93, 0xF0,
+  0x33, 0xF0, 0x33, 0xF0, 0x33, 0xF0, 0x33, 0xF0, 0x33, 0xF0, 0x33, 0xF0,
+  0x33, 0xF0, 0x33, 0xF0, 0xF0, 0xF0, 0xF0, 0xCF, 0x0F, 0x0F, 0x0F, 0x03,
+  0x46, 0x59, 0x35, 0x24, 0x23, 0x66, 0x76, 0x73, 0xA3, 0x94, 0x84, 0x75,
+  0x66, 0x65, 0x74, 0x83, 0x93, 0xA3, 0xAF, 0x0B, 0x37, 0x4A, 0x33, 0x44,
+  0x13, 0x63, 0x13, 0x63, 0x13, 0x72, 0xA3, 0x93, 0x75, 0x86, 0xB3, 0xB3,
+  0xA5, 0x86, 0x76, 0x63, 0x24, 0x34, 0x2A, 0x56, 0x40, 0x44, 0x44, 0x44,
+  0x53, 0x53, 0x53, 0x60, 0x03, 0xB4, 0x23, 0xB4, 0x23, 0xB4, 0x23, 0xB4,
+  0x23, 0xB4, 0x23, 0xB4, 0x23, 0xB4, 0x23, 0xB4, 0x23, 0xB4, 0x23, 0xB4,
+  0x23, 0xB4, 0x23, 0xB4, 0x23, 0xB4, 0x23, 0xB4, 0x23, 0xB4, 0x23, 0xB4,
+  0x23, 0xB4, 0x24, 0x95, 0x24, 0x95, 0x24, 0x86, 0x26, 0x48, 0x2D, 0x1F,
+  0x03, 0x38, 0x25, 0x67, 0xF0, 0x23, 0xF0, 0x23, 0xF0, 0x23, 0xF0, 0x23,
+  0xF0, 0x23, 0xF0, 0x23, 0xF0, 0x23, 0xF0, 0x23, 0xF0, 0x20, 0x7D, 0x5F,
+  0x3F, 0x02, 0x2A, 0x33, 0x4A, 0x33, 0x3B, 0x33, 0x3B, 0x33, 0x2C, 0x33,
+  0x2C, 0x33, 0x2C, 0x33, 0x2C, 0x33, 0x2C, 0x33, 0x2C, 0x33, 0x2C, 0x33,
+  0x3B, 0x33, 0x3B, 0x33, 0x4A, 0x33, 0x59, 0x33, 0x68, 0x33, 0x77, 0x33,
+  0xB3, 0x33, 0xB3, 0x33, 0xB3, 0x33, 0xB3, 0x33, 0xB3, 0x33, 0xB3, 0x33,
+  0xB3, 0x33, 0xB3, 0x33, 0xB3, 0x33, 0xB3, 0x33, 0xB3, 0x33, 0xB3, 0x33,
+  0xB3, 0x33, 0xB3, 0x33, 0xB3, 0x33, 0xB3, 0x33, 0xB3, 0x33, 0xB3, 0x33,
+  0xB3, 0x33, 0x20, 0x0F, 0x01, 0x52, 0x72, 0x84, 0x66, 0x73, 0x75, 0x5C,
+  0x36, 0x20, 0x52, 0x52, 0x43, 0x3F, 0x03, 0x43, 0x43, 0x43, 0x43, 0x43,
+  0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x35, 0x68, 0x34, 0x24,
+  0x13, 0x53, 0x13, 0x65, 0x75, 0x75, 0x75, 0x75, 0x76, 0x66, 0x53, 0x24,
+  0x24, 0x38, 0x55, 0xF0, 0xDF, 0x09, 0x01, 0xE2, 0x72, 0x43, 0x63, 0x34,
+  0x54, 0x35, 0x44, 0x35, 0x44, 0x43, 0x53, 0x43, 0x62, 0x34, 0x53, 0x24,
+  0x54, 0x14, 0x45, 0x14, 0x54, 0x23, 0x62, 0x41, 0x81, 0x50, 0x52, 0xF0,
+  0xF0, 0x13, 0xF0, 0x23, 0xB3, 0xF0, 0x22, 0xB4, 0xF0, 0x13, 0x87, 0xF0,
+  0x12, 0x97, 0xF2, 0xE3, 0xE3, 0xE3, 0xE2, 0xF3, 0xD3, 0xF3, 0xC3, 0xF0,
+  0x13, 0xC2, 0xF0, 0x23, 0xB3, 0xF0, 0x23, 0xB2, 0xF0, 0x33, 0xA3, 0x92,
+  0x73, 0x93, 0x93, 0x73, 0x92, 0x94, 0x73, 0x83, 0x85, 0x73, 0x82, 0x86,
+  0x73, 0x73, 0x82, 0x13, 0xF0, 0x13, 0x83, 0x13, 0xF0, 0x12, 0x83, 0x23,
+  0xF3, 0x73, 0x33, 0xF2, 0x82, 0x43, 0xE2, 0x83, 0x43, 0xD3, 0x73, 0x53,
+  0xD2, 0x8E, 0x93, 0x8E, 0x83, 0xF0, 0x23, 0xB2, 0xF0, 0x33, 0xA3, 0xF0,
+  0x33, 0xA2, 0xF0, 0x43, 0x93, 0xF0, 0x43, 0x83, 0xF0, 0xB0, 0x52, 0xF0,
+  0x13, 0xB3, 0xF0, 0x12, 0xB4, 0xF3, 0x87, 0xF2, 0x97, 0xE2, 0xE3, 0xD3,
+  0xE3, 0xD2, 0xF3, 0xC3, 0xF3, 0xB3, 0xF0, 0x13, 0xB2, 0xF0, 0x23, 0xA3,
+  0xF0, 0x23, 0xA2, 0xF0, 0x33, 0x93, 0xF0, 0x33, 0x83, 0x57, 0x73, 0x82,
+  0x5A, 0x53, 0x73, 0x44, 0x44, 0x43, 0x72, 0x53, 0x63, 0x43, 0x63, 0x52,
+  0x82, 0xC3, 0x62, 0x82, 0xC2, 0xF0, 0x13, 0xB3, 0xF0, 0x13, 0xB2, 0xF4,
+  0xB2, 0xF4, 0xB3, 0xD5, 0xC2, 0xC5, 0xD3, 0xB4, 0xF2, 0xB3, 0xF0, 0x12,
+  0xC3, 0xF3, 0xB3, 0xF0, 0x12, 0xCD, 0x53, 0xCD, 0x43, 0xF0, 0xB0, 0x45,
+  0xF0, 0xD9, 0xF3, 0x75, 0x24, 0xE2, 0x83, 0x53, 0xD3, 0x82, 0x73, 0xB3,
+  0x92, 0x73, 0xB2, 0xF0, 0x43, 0xA3, 0xF0, 0x33, 0xB2, 0xF6, 0xB2, 0xF0,
+  0x16, 0xA3, 0xF0, 0x53, 0x92, 0xF0, 0x73, 0x73, 0xF0, 0x73, 0x72, 0xD3,
+  0x82, 0x62, 0x92, 0x33, 0x73, 0x53, 0x83, 0x43, 0x63, 0x52, 0x93, 0x44,
+  0x34, 0x53, 0x84, 0x59, 0x53, 0x85, 0x67, 0x62, 0x86, 0xF0, 0x33, 0x73,
+  0x13, 0xF0, 0x32, 0x82, 0x23, 0xF0, 0x23, 0x73, 0x23, 0xF0, 0x13, 0x73,
+  0x33, 0xF0, 0x12, 0x73, 0x43, 0xF3, 0x72, 0x53, 0xF2, 0x7E, 0xB2, 0x8E,
+  0xA3, 0xF0, 0x13, 0xD2, 0xF0, 0x23, 0xC3, 0xF0, 0x23, 0xC2, 0xF0, 0x33,
+  0xB2, 0xF0, 0x43, 0xA3, 0xF0, 0xA0, 0x84, 0xF4, 0xF4, 0xF4, 0xF4, 0xF0,
+  0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x14, 0xF4, 0xF4, 0xF4, 0xE4, 0xE5, 0xD5,
+  0xD5, 0xD5, 0xD5, 0xD5, 0xE4, 0xE5, 0xE4, 0xB8, 0xB8, 0xB8, 0xB3, 0x15,
+  0x94, 0x24, 0x94, 0x26, 0x55, 0x4F, 0x5D, 0x89, 0x50, 0x85, 0xF0, 0x94,
+  0xF0, 0x94, 0xF0, 0x94, 0xF0, 0xA3, 0xF0, 0xF0, 0xF0, 0xF0, 0xF5, 0xF0,
+  0x67, 0xF0, 0x57, 0xF0, 0x57, 0xF0, 0x49, 0xF0, 0x34, 0x14, 0xF0, 0x25,
+  0x14, 0xF0, 0x24, 0x25, 0xF0, 0x14, 0x34, 0xF5, 0x34, 0xF4, 0x45, 0xE4,
+  0x54, 0xD4, 0x64, 0xD4, 0x65, 0xC4, 0x74, 0xB4, 0x85, 0xA4, 0x85, 0xA4,
+  0x94, 0x94, 0xA5, 0x8F, 0x04, 0x7F, 0x05, 0x7F, 0x06, 0x64, 0xC5, 0x55,
+  0xD4, 0x54, 0xE5, 0x44, 0xF4, 0x35, 0xF4, 0x34, 0xF0, 0x15, 0x24, 0xF0,
+  0x24, 0x14, 0xF0, 0x39, 0xF0, 0x35, 0xE6, 0xF0, 0x64, 0xF0, 0x74, 0xF0,
+  0x73, 0xF0, 0x83, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x35, 0xF0, 0x67, 0xF0,
+  0x57, 0xF0, 0x57, 0xF0, 0x49, 0xF0, 0x34, 0x14, 0xF0, 0x25, 0x14, 0xF0,
+  0x24, 0x25, 0xF0, 0x14, 0x34, 0xF5, 0x34, 0xF4, 0x45, 0xE4, 0x54, 0xD4,
+  0x64, 0xD4, 0x65, 0xC4, 0x74, 0xB4, 0x85, 0xA4, 0x85, 0xA4, 0x94, 0x94,
+  0xA5, 0x8F, 0x04, 0x7F, 0x05, 0x7F, 0x06, 0x64, 0xC5, 0x55, 0xD4, 0x54,
+  0xE5, 0x44, 0xF4, 0x35, 0xF4, 0x34, 0xF0, 0x15, 0x24, 0xF0, 0x24, 0x14,
+  0xF0, 0x39, 0xF0, 0x35, 0xB5, 0xF0, 0x67, 0xF0, 0x49, 0xF0, 0x24, 0x33,
+  0xF0, 0x23, 0x53, 0xF0, 0xF0, 0xF0, 0xF0, 0xD5, 0xF0, 0x67, 0xF0, 0x57,
+  0xF0, 0x57, 0xF0, 0x49, 0xF0, 0x34, 0x14, 0xF0, 0x25, 0x14, 0xF0, 0x24,
+  0x25, 0xF0, 0x14, 0x34, 0xF5, 0x34, 0xF4, 0x45, 0xE4, 0x54, 0xD4, 0x64,
+  0xD4, 0x65, 0xC4, 0x74, 0xB4, 0x85, 0xA4, 0x85, 0xA4, 0x94, 0x94, 0xA5,
+  0x8F, 0x04, 0x7F, 0x05, 0x7F, 0x06, 0x64, 0xC5, 0x55, 0xD4, 0x54, 0xE5,
+  0x44, 0xF4, 0x35, 0xF4, 0x34, 0xF0, 0x15, 0x24, 0xF0, 0x24, 0x14, 0xF0,
+  0x39, 0xF0, 0x35, 0x92, 0x72, 0xF6, 0x33, 0xED, 0xE3, 0x27, 0xF2, 0x63,
+  0xF0, 0xF0, 0xF0, 0xF0, 0xE5, 0xF0, 0x67, 0xF0, 0x57, 0xF0, 0x57, 0xF0,
+  0x49, 0xF0, 0x34, 0x14, 0xF0, 0x25, 0x14, 0xF0, 0x24, 0x25, 0xF0, 0x14,
+  0x34, 0xF5, 0x34, 0xF4, 0x45, 0xE4, 0x54, 0xD4, 0x64, 0xD4, 0x65, 0xC4,
+  0x74, 0xB4, 0x85, 0xA4, 0x85, 0xA4, 0x94, 0x94, 0xA5, 0x8F, 0x04, 0x7F,
+  0x05, 0x7F, 0x06, 0x64, 0xC5, 0x55, 0xD4, 0x54, 0xE5, 0x44, 0xF4, 0x35,
+  0xF4, 0x34, 0xF0, 0x15, 0x24, 0xF0, 0x24, 0x14, 0xF0, 0x39, 0xF0, 0x35,
+  0x84, 0x35, 0xF4, 0x35, 0xF4, 0x35, 0xF4, 0x35, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xC5, 0xF0, 0x67, 0xF0, 0x57, 0xF0, 0x57, 0xF0, 0x49, 0xF0, 0x34, 0x14,
+  0xF0, 0x25, 0x14, 0xF0, 0x24, 0x25, 0xF0, 0x14, 0x34, 0xF5, 0x34, 0xF4,
+  0x45, 0xE4, 0x54, 0xD4, 0x64, 0xD4, 0x65, 0xC4, 0x74, 0xB4, 0x85, 0xA4,
+  0x85, 0xA4, 0x94, 0x94, 0xA5, 0x8F, 0x04, 0x7F, 0x05, 0x7F, 0x06, 0x64,
+  0xC5, 0x55, 0xD4, 0x54, 0xE5, 0x44, 0xF4, 0x35, 0xF4, 0x34, 0xF0, 0x15,
+  0x24, 0xF0, 0x24, 0x14, 0xF0, 0x39, 0xF0, 0x35, 0xB5, 0xF0, 0x67, 0xF0,
+  0x48, 0xF0, 0x43, 0x33, 0xF0, 0x33, 0x33, 0xF0, 0x33, 0x33, 0xF0, 0x39,
+  0xF0, 0x47, 0xF0, 0x65, 0xF0, 0xF0, 0xF0, 0x45, 0xF0, 0x67, 0xF0, 0x57,
+  0xF0, 0x57, 0xF0, 0x49, 0xF0, 0x34, 0x14, 0xF0, 0x25, 0x14, 0xF0, 0x24,
+  0x25, 0xF0, 0x14, 0x34, 0xF5, 0x34, 0xF4, 0x45, 0xE4, 0x54, 0xD4, 0x64,
+  0xD4, 0x65, 0xC4, 0x74, 0xB4, 0x85, 0xA4, 0x85, 0xA4, 0x94, 0x94, 0xA5,
+  0x8F, 0x04, 0x7F, 0x05, 0x7F, 0x06, 0x64, 0xC5, 0x55, 0xD4, 0x54, 0xE5,
+  0x44, 0xF4, 0x35, 0xF4, 0x34, 0xF0, 0x15, 0x24, 0xF0, 0x24, 0x14, 0xF0,
+  0x39, 0xF0, 0x35, 0xCF, 0x0C, 0xDF, 0x0C, 0xCF, 0x0D, 0xCF, 0x0D, 0xC4,
+  0x44, 0xF0, 0xC4, 0x54, 0xF0, 0xC4, 0x54, 0xF0, 0xB4, 0x64, 0xF0, 0xB4,
+  0x64, 0xF0, 0xB4, 0x64, 0xF0, 0xA4, 0x74, 0xF0, 0xA4, 0x74, 0xF0, 0x94,
+  0x84, 0xF0, 0x94, 0x8F, 0x05, 0x75, 0x8F, 0x05, 0x74, 0x9F, 0x05, 0x74,
+  0x9F, 0x05, 0x64, 0xA4, 0xF0, 0x7F, 0x03, 0xF0, 0x6F, 0x04, 0xF0, 0x6F,
+  0x04, 0xF0, 0x6F, 0x04, 0xF0, 0x55, 0xB4, 0xF0, 0x54, 0xC4, 0xF0, 0x45,
+  0xC4, 0xF0, 0x44, 0xD4, 0xF0, 0x44, 0xD4, 0xF0, 0x35, 0xDF, 0x06, 0x14,
+  0xEF, 0x0B, 0xEF, 0x0A, 0xFF, 0x06, 0xA8, 0xF0, 0x1E, 0xCF, 0x01, 0x9F,
+  0x04, 0x85, 0x96, 0x65, 0xC5, 0x45, 0xE4, 0x44, 0xF4, 0x34, 0xF0, 0x24,
+  0x24, 0xF0, 0x24, 0x24, 0xF0, 0x74, 0xF0, 0x84, 0xF0, 0x84, 0xF0, 0x84,
+  0xF0, 0x84, 0xF0, 0x84, 0xF0, 0x84, 0xF0, 0x84, 0xF0, 0x84, 0xF0, 0x84,
+  0xF0, 0x84, 0xF0, 0x3A, 0xF0, 0x24, 0x24, 0xF0, 0x24, 0x24, 0xF0, 0x24,
+  0x34, 0xF5, 0x35, 0xE4, 0x55, 0xC5, 0x56, 0x96, 0x7F, 0x04, 0xAF, 0x01,
+  0xCE, 0xF0, 0x18, 0xF0, 0x62, 0xF0, 0xA4, 0xF0, 0x76, 0xF0, 0x94, 0xF0,
+  0x93, 0xF0, 0x22, 0x44, 0xF0, 0x1A, 0xF0, 0x56, 0xB0, 0x66, 0xF0, 0x45,
+  0xF0, 0x44, 0xF0, 0x63, 0xF0, 0x63, 0xF0, 0xF0, 0xF0, 0x9F, 0x07, 0x1F,
+  0x07, 0x1F, 0x07, 0x1F, 0x07, 0x14, 0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x44,
+  0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x4F,
+  0x07, 0x1F, 0x07, 0x1F, 0x07, 0x1F, 0x07, 0x14, 0xF0, 0x44, 0xF0, 0x44,
+  0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x44,
+  0xF0, 0x44, 0xF0, 0x4F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x02, 0xB6, 0xF0,
+  0x15, 0xF0, 0x24, 0xF0, 0x43, 0xF0, 0x43, 0xF0, 0xF0, 0xF0, 0xDF, 0x07,
+  0x1F, 0x07, 0x1F, 0x07, 0x1F, 0x07, 0x14, 0xF0, 0x44, 0xF0, 0x44, 0xF0,
+  0x44, 0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x44, 0xF0,
+  0x4F, 0x07, 0x1F, 0x07, 0x1F, 0x07, 0x1F, 0x07, 0x14, 0xF0, 0x44, 0xF0,
+  0x44, 0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x44, 0xF0,
+  0x44, 0xF0, 0x44, 0xF0, 0x4F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x02, 0x95,
+  0xF0, 0x27, 0xF9, 0xD4, 0x33, 0xD3, 0x53, 0xF0, 0xF0, 0xF0, 0x7F, 0x07,
+  0x1F, 0x07, 0x1F, 0x07, 0x1F, 0x07, 0x14, 0xF0, 0x44, 0xF0, 0x44, 0xF0,
+  0x44, 0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x44, 0xF0,
+  0x4F, 0x07, 0x1F, 0x07, 0x1F, 0x07, 0x1F, 0x07, 0x14, 0xF0, 0x44, 0xF0,
+  0x44, 0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x44, 0xF0,
+  0x44, 0xF0, 0x44, 0xF0, 0x4F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x02, 0x55,
+  0x35, 0xA5, 0x35, 0xA5, 0x35, 0xA5, 0x35, 0xF0, 0xF0, 0xF0, 0x6F, 0x07,
+  0x1F, 0x07, 0x1F, 0x07, 0x1F, 0x07, 0x14, 0xF0, 0x44, 0xF0, 0x44, 0xF0,
+  0x44, 0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x44, 0xF0,
+  0x4F, 0x07, 0x1F, 0x07, 0x1F, 0x07, 0x1F, 0x07, 0x14, 0xF0, 0x44, 0xF0,
+  0x44, 0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x44, 0xF0,
+  0x44, 0xF0, 0x44, 0xF0, 0x4F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x02, 0x15,
+  0x65, 0x74, 0x74, 0x73, 0xF0, 0xA4, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+  0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+  0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+  0x20, 0x45, 0x45, 0x44, 0x54, 0x63, 0xF0, 0xD4, 0x64, 0x64, 0x64, 0x64,
+  0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+  0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+  0x64, 0x64, 0x40, 0x45, 0x77, 0x54, 0x14, 0x43, 0x34, 0x23, 0x53, 0xF0,
+  0xF0, 0x24, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94,
+  0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94,
+  0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x40, 0x05, 0x3A, 0x3A,
+  0x3A, 0x35, 0xF0, 0xF4, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94,
+  0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94,
+  0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x50, 0x3F,
+  0x01, 0xCF, 0x03, 0xAF, 0x05, 0x8F, 0x06, 0x74, 0xC6, 0x64, 0xD5, 0x64,
+  0xE5, 0x54, 0xF4, 0x54, 0xF5, 0x44, 0xF0, 0x14, 0x44, 0xF0, 0x14, 0x44,
+  0xF0, 0x14, 0x44, 0xF0, 0x15, 0x34, 0xF0, 0x2F, 0x03, 0xAF, 0x03, 0xAF,
+  0x03, 0xA4, 0x34, 0xF0, 0x24, 0x34, 0xF0, 0x24, 0x34, 0xF0, 0x14, 0x44,
+  0xF0, 0x14, 0x44, 0xF0, 0x14, 0x44, 0xF5, 0x44, 0xF4, 0x54, 0xE5, 0x54,
+  0xD5, 0x64, 0xC6, 0x6F, 0x06, 0x7F, 0x05, 0x8F, 0x03, 0xAF, 0x01, 0x90,
+  0x85, 0x33, 0xDC, 0xCD, 0xC3, 0x45, 0xF0, 0xF0, 0xF0, 0xC5, 0xF0, 0x1A,
+  0xFA, 0xFB, 0xEC, 0xDC, 0xD8, 0x14, 0xC8, 0x15, 0xB8, 0x24, 0xB8, 0x34,
+  0xA8, 0x35, 0x98, 0x44, 0x98, 0x54, 0x88, 0x55, 0x78, 0x64, 0x78, 0x65,
+  0x68, 0x74, 0x68, 0x84, 0x58, 0x85, 0x48, 0x94, 0x48, 0xA4, 0x38, 0xA5,
+  0x28, 0xB4, 0x28, 0xC4, 0x18, 0xCD, 0xDC, 0xEB, 0xEB, 0xFA, 0xFA, 0xF0,
+  0x15, 0x95, 0xF0, 0xB5, 0xF0, 0xC4, 0xF0, 0xC4, 0xF0, 0xC4, 0xF0, 0xF0,
+  0xF0, 0xF0, 0xF0, 0x88, 0xF0, 0x4E, 0xEF, 0x02, 0xCF, 0x05, 0x96, 0x97,
+  0x76, 0xC6, 0x55, 0xF5, 0x54, 0xF0, 0x25, 0x35, 0xF0, 0x34, 0x34, 0xF0,
+  0x45, 0x24, 0xF0, 0x54, 0x14, 0xF0, 0x64, 0x14, 0xF0, 0x78, 0xF0, 0x78,
+  0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78,
+  0xF0, 0x78, 0xF0, 0x64, 0x24, 0xF0, 0x54, 0x24, 0xF0, 0x54, 0x25, 0xF0,
+  0x34, 0x44, 0xF0, 0x25, 0x45, 0xF5, 0x66, 0xC6, 0x76, 0x97, 0x9F, 0x05,
+  0xBF, 0x03, 0xEE, 0xF0, 0x48, 0xB0, 0xF0, 0x15, 0xF0, 0x95, 0xF0, 0x94,
+  0xF0, 0xA4, 0xF0, 0xA4, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xA8, 0xF0, 0x4E,
+  0xEF, 0x02, 0xCF, 0x05, 0x96, 0x97, 0x76, 0xC6, 0x55, 0xF5, 0x54, 0xF0,
+  0x25, 0x35, 0xF0, 0x34, 0x34, 0xF0, 0x45, 0x24, 0xF0, 0x54, 0x14, 0xF0,
+  0x64, 0x14, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78,
+  0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x64, 0x24, 0xF0,
+  0x54, 0x24, 0xF0, 0x54, 0x25, 0xF0, 0x34, 0x44, 0xF0, 0x25, 0x45, 0xF5,
+  0x66, 0xC6, 0x76, 0x97, 0x9F, 0x05, 0xBF, 0x03, 0xEE, 0xF0, 0x48, 0xB0,
+  0xD4, 0xF0, 0xA6, 0xF0, 0x88, 0xF0, 0x64, 0x24, 0xF0, 0x44, 0x43, 0xF0,
+  0xF1, 0xF0, 0xF0, 0xF0, 0x58, 0xF0, 0x4E, 0xEF, 0x02, 0xCF, 0x05, 0x96,
+  0x97, 0x76, 0xC6, 0x55, 0xF5, 0x54, 0xF0, 0x25, 0x35, 0xF0, 0x34, 0x34,
+  0xF0, 0x45, 0x24, 0xF0, 0x54, 0x14, 0xF0, 0x64, 0x14, 0xF0, 0x78, 0xF0,
+  0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0,
+  0x78, 0xF0, 0x78, 0xF0, 0x64, 0x24, 0xF0, 0x54, 0x24, 0xF0, 0x54, 0x25,
+  0xF0, 0x34, 0x44, 0xF0, 0x25, 0x45, 0xF5, 0x66, 0xC6, 0x76, 0x97, 0x9F,
+  0x05, 0xBF, 0x03, 0xEE, 0xF0, 0x48, 0xB0, 0xA5, 0x42, 0xF0, 0x3C, 0xF0,
+  0x2D, 0xF0, 0x23, 0x45, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x68, 0xF0, 0x4E,
+  0xEF, 0x02, 0xCF, 0x05, 0x96, 0x97, 0x76, 0xC6, 0x55, 0xF5, 0x54, 0xF0,
+  0x25, 0x35, 0xF0, 0x34, 0x34, 0xF0, 0x45, 0x24, 0xF0, 0x54, 0x14, 0xF0,
+  0x64, 0x14, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78,
+  0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x64, 0x24, 0xF0,
+  0x54, 0x24, 0xF0, 0x54, 0x25, 0xF0, 0x34, 0x44, 0xF0, 0x25, 0x45, 0xF5,
+  0x66, 0xC6, 0x76, 0x97, 0x9F, 0x05, 0xBF, 0x03, 0xEE, 0xF0, 0x48, 0xB0,
+  0x94, 0x44, 0xF0, 0x34, 0x44, 0xF0, 0x34, 0x44, 0xF0, 0x34, 0x44, 0xF0,
+  0xF0, 0xF0, 0xF0, 0xF0, 0x58, 0xF0, 0x4E, 0xEF, 0x02, 0xCF, 0x05, 0x96,
+  0x97, 0x76, 0xC6, 0x55, 0xF5, 0x54, 0xF0, 0x25, 0x35, 0xF0, 0x34, 0x34,
+  0xF0, 0x45, 0x24, 0xF0, 0x54, 0x14, 0xF0, 0x64, 0x14, 0xF0, 0x78, 0xF0,
+  0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0,
+  0x78, 0xF0, 0x78, 0xF0, 0x64, 0x24, 0xF0, 0x54, 0x24, 0xF0, 0x54, 0x25,
+  0xF0, 0x34, 0x44, 0xF0, 0x25, 0x45, 0xF5, 0x66, 0xC6, 0x76, 0x97, 0x9F,
+  0x05, 0xBF, 0x03, 0xEE, 0xF0, 0x48, 0xB0, 0x12, 0xB2, 0x14, 0x94, 0x14,
+  0x74, 0x34, 0x54, 0x54, 0x34, 0x74, 0x14, 0x97, 0xB5, 0xC5, 0xB7, 0x94,
+  0x14, 0x74, 0x34, 0x54, 0x54, 0x34, 0x74, 0x14, 0x94, 0x12, 0xB2, 0xF0,
+  0x30, 0xF0, 0xE1, 0xD8, 0x92, 0x9E, 0x53, 0x7F, 0x02, 0x33, 0x7F, 0x08,
+  0x76, 0x98, 0x76, 0xC6, 0x65, 0xF5, 0x64, 0xF7, 0x45, 0xE3, 0x14, 0x44,
+  0xE3, 0x34, 0x34, 0xD4, 0x34, 0x24, 0xE3, 0x44, 0x24, 0xD3, 0x64, 0x14,
+  0xC3, 0x74, 0x14, 0xB3, 0x84, 0x14, 0xA3, 0x94, 0x14, 0x93, 0xA4, 0x14,
+  0x83, 0xB4, 0x14, 0x73, 0xC4, 0x14, 0x63, 0xD4, 0x14, 0x53, 0xE4, 0x14,
+  0x43, 0xE4, 0x34, 0x24, 0xE4, 0x34, 0x23, 0xF4, 0x38, 0xF4, 0x56, 0xF5,
+  0x55, 0xF5, 0x76, 0xC6, 0x68, 0x97, 0x63, 0x1F, 0x05, 0x63, 0x3F, 0x02,
+  0x82, 0x6E, 0xF0, 0x49, 0xB0, 0x76, 0xF0, 0x64, 0xF0, 0x74, 0xF0, 0x83,
+  0xF0, 0x83, 0xF0, 0xF0, 0xF0, 0xE4, 0xF0, 0x28, 0xF0, 0x28, 0xF0, 0x28,
+  0xF0, 0x28, 0xF0, 0x28, 0xF0, 0x28, 0xF0, 0x28, 0xF0, 0x28, 0xF0, 0x28,
+  0xF0, 0x28, 0xF0, 0x28, 0xF0, 0x28, 0xF0, 0x28, 0xF0, 0x28, 0xF0, 0x28,
+  0xF0, 0x28, 0xF0, 0x28, 0xF0, 0x28, 0xF0, 0x28, 0xF0, 0x28, 0xF0, 0x28,
+  0xF0, 0x28, 0xF0, 0x24, 0x14, 0xF4, 0x24, 0xF4, 0x24, 0xE5, 0x25, 0xD4,
+  0x46, 0x96, 0x5F, 0x04, 0x7F, 0x02, 0x9E, 0xE9, 0x80, 0xD5, 0xF0, 0x44,
+  0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x53, 0xF0, 0xF0, 0xF0, 0xF0, 0x34, 0xF0,
+  0x28, 0xF0, 0x28, 0xF0, 0x28, 0xF0, 0x28, 0xF0, 0x28, 0xF0, 0x28, 0xF0,
+  0x28, 0xF0, 0x28, 0xF0, 0x28, 0xF0, 0x28, 0xF0, 0x28, 0xF0, 0x28, 0xF0,
+  0x28, 0xF0, 0x28, 0xF0, 0x28, 0xF0, 0x28, 0xF0, 0x28, 0xF0, 0x28, 0xF0,
+  0x28, 0xF0, 0x28, 0xF0, 0x28, 0xF0, 0x28, 0xF0, 0x24, 0x14, 0xF4, 0x24,
+  0xF4, 0x24, 0xE5, 0x25, 0xD4, 0x46, 0x96, 0x5F, 0x04, 0x7F, 0x02, 0x9E,
+  0xE9, 0x80, 0xA5, 0xF0, 0x47, 0xF0, 0x24, 0x14, 0xF0, 0x13, 0x34, 0xE3,
+  0x53, 0xF0, 0xF0, 0xF0, 0xC4, 0xF0, 0x28, 0xF0, 0x28, 0xF0, 0x28, 0xF0,
+  0x28, 0xF0, 0x28, 0xF0, 0x28, 0xF0, 0x28, 0xF0, 0x28, 0xF0, 0x28, 0xF0,
+  0x28, 0xF0, 0x28, 0xF0, 0x28, 0xF0, 0x28, 0xF0, 0x28, 0xF0, 0x28, 0xF0,
+  0x28, 0xF0, 0x28, 0xF0, 0x28, 0xF0, 0x28, 0xF0, 0x28, 0xF0, 0x28, 0xF0,
+  0x28, 0xF0, 0x24, 0x14, 0xF4, 0x24, 0xF4, 0x24, 0xE5, 0x25, 0xD4, 0x46,
+  0x96, 0x5F, 0x04, 0x7F, 0x02, 0x9E, 0xE9, 0x80, 0x74, 0x35, 0xD4, 0x35,
+  0xD4, 0x35, 0xD4, 0x35, 0xF0, 0xF0, 0xF0, 0xB4, 0xF0, 0x28, 0xF0, 0x28,
+  0xF0, 0x28, 0xF0, 0x28, 0xF0, 0x28, 0xF0, 0x28, 0xF0, 0x28, 0xF0, 0x28,
+  0xF0, 0x28, 0xF0, 0x28, 0xF0, 0x28, 0xF0, 0x28, 0xF0, 0x28, 0xF0, 0x28,
+  0xF0, 0x28, 0xF0, 0x28, 0xF0, 0x28, 0xF0, 0x28, 0xF0, 0x28, 0xF0, 0x28,
+  0xF0, 0x28, 0xF0, 0x28, 0xF0, 0x24, 0x14, 0xF4, 0x24, 0xF4, 0x24, 0xE5,
+  0x25, 0xD4, 0x46, 0x96, 0x5F, 0x04, 0x7F, 0x02, 0x9E, 0xE9, 0x80, 0xE5,
+  0xF0, 0x75, 0xF0, 0x74, 0xF0, 0x84, 0xF0, 0x93, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xA5, 0xF0, 0x25, 0x25, 0xF0, 0x15, 0x25, 0xF5, 0x45, 0xE4, 0x64, 0xD5,
+  0x65, 0xC4, 0x85, 0xA4, 0x95, 0x95, 0xA5, 0x84, 0xC4, 0x75, 0xC5, 0x64,
+  0xE5, 0x44, 0xF0, 0x14, 0x35, 0xF0, 0x15, 0x24, 0xF0, 0x34, 0x14, 0xF0,
+  0x58, 0xF0, 0x57, 0xF0, 0x76, 0xF0, 0x84, 0xF0, 0x94, 0xF0, 0x94, 0xF0,
+  0x94, 0xF0, 0x94, 0xF0, 0x94, 0xF0, 0x94, 0xF0, 0x94, 0xF0, 0x94, 0xF0,
+  0x94, 0xF0, 0x94, 0xF0, 0x94, 0xF0, 0x94, 0xC0, 0x04, 0xF0, 0x44, 0xF0,
+  0x44, 0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x4F, 0x02, 0x6F, 0x04, 0x4F, 0x06,
+  0x2F, 0x06, 0x24, 0xC6, 0x14, 0xE4, 0x14, 0xE9, 0xF8, 0xF8, 0xF8, 0xF8,
+  0xE9, 0xE4, 0x14, 0xD5, 0x1F, 0x06, 0x2F, 0x06, 0x2F, 0x04, 0x4F, 0x02,
+  0x64, 0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x44, 0xF0,
+  0x44, 0xF0, 0x44, 0xF0, 0x40, 0x59, 0xBC, 0x7F, 0x01, 0x55, 0x65, 0x45,
+  0x85, 0x34, 0xA4, 0x34, 0xA4, 0x24, 0xC3, 0x24, 0xC3, 0x24, 0xB4, 0x24,
+  0xB4, 0x24, 0xA4, 0x34, 0x86, 0x34, 0x58, 0x44, 0x58, 0x44, 0x59, 0x34,
+  0x96, 0x24, 0xB5, 0x14, 0xC4, 0x14, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD3,
+  0x14, 0xC4, 0x14, 0xB5, 0x14, 0xA5, 0x24, 0x42, 0x18, 0x24, 0x4A, 0x34,
+  0x48, 0xD6, 0x70, 0x55, 0xF0, 0x34, 0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x43,
+  0xF0, 0x53, 0xF0, 0xF0, 0xF0, 0xE8, 0xCC, 0x9F, 0x67, 0x36, 0x64, 0x85,
+  0x53, 0xA4, 0x44, 0xA4, 0x44, 0xA4, 0xF0, 0x34, 0xF0, 0x34, 0xE8, 0x8E,
+  0x6F, 0x01, 0x59, 0x44, 0x46, 0x84, 0x44, 0xA4, 0x34, 0xB4, 0x34, 0xB4,
+  0x34, 0xB4, 0x34, 0xA5, 0x44, 0x86, 0x45, 0x58, 0x5C, 0x17, 0x3A, 0x36,
+  0x56, 0x65, 0xB4, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x33, 0xF0, 0x33, 0xF0,
+  0x33, 0xF0, 0xF0, 0xF0, 0xF0, 0x28, 0xCC, 0x9F, 0x67, 0x36, 0x64, 0x85,
+  0x53, 0xA4, 0x44, 0xA4, 0x44, 0xA4, 0xF0, 0x34, 0xF0, 0x34, 0xE8, 0x8E,
+  0x6F, 0x01, 0x59, 0x44, 0x46, 0x84, 0x44, 0xA4, 0x34, 0xB4, 0x34, 0xB4,
+  0x34, 0xB4, 0x34, 0xA5, 0x44, 0x86, 0x45, 0x58, 0x5C, 0x17, 0x3A, 0x36,
+  0x56, 0x65, 0x85, 0xF0, 0x26, 0xF8, 0xE3, 0x23, 0xD3, 0x43, 0xB3, 0x53,
+  0xF0, 0x71, 0xF0, 0xF0, 0x38, 0xCC, 0x9F, 0x67, 0x36, 0x64, 0x85, 0x53,
+  0xA4, 0x44, 0xA4, 0x44, 0xA4, 0xF0, 0x34, 0xF0, 0x34, 0xE8, 0x8E, 0x6F,
+  0x01, 0x59, 0x44, 0x46, 0x84, 0x44, 0xA4, 0x34, 0xB4, 0x34, 0xB4, 0x34,
+  0xB4, 0x34, 0xA5, 0x44, 0x86, 0x45, 0x58, 0x5C, 0x17, 0x3A, 0x36, 0x56,
+  0x65, 0x62, 0x72, 0xA6, 0x33, 0xAC, 0x93, 0x36, 0xF0, 0x33, 0xF0, 0xF0,
+  0xF0, 0xC8, 0xCC, 0x9F, 0x67, 0x36, 0x64, 0x85, 0x53, 0xA4, 0x44, 0xA4,
+  0x44, 0xA4, 0xF0, 0x34, 0xF0, 0x34, 0xE8, 0x8E, 0x6F, 0x01, 0x59, 0x44,
+  0x46, 0x84, 0x44, 0xA4, 0x34, 0xB4, 0x34, 0xB4, 0x34, 0xB4, 0x34, 0xA5,
+  0x44, 0x86, 0x45, 0x58, 0x5C, 0x17, 0x3A, 0x36, 0x56, 0x65, 0x54, 0x44,
+  0xA4, 0x44, 0xA4, 0x44, 0xA4, 0x44, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+  0x98, 0xCC, 0x9F, 0x67, 0x36, 0x64, 0x85, 0x53, 0xA4, 0x44, 0xA4, 0x44,
+  0xA4, 0xF0, 0x34, 0xF0, 0x34, 0xE8, 0x8E, 0x6F, 0x01, 0x59, 0x44, 0x46,
+  0x84, 0x44, 0xA4, 0x34, 0xB4, 0x34, 0xB4, 0x34, 0xB4, 0x34, 0xA5, 0x44,
+  0x86, 0x45, 0x58, 0x5C, 0x17, 0x3A, 0x36, 0x56, 0x65, 0x94, 0xF0, 0x17,
+  0xF8, 0xD3, 0x33, 0xD3, 0x42, 0xD3, 0x33, 0xE8, 0xE7, 0xF0, 0x24, 0xF0,
+  0xF0, 0x78, 0xCC, 0x9F, 0x67, 0x36, 0x64, 0x85, 0x53, 0xA4, 0x44, 0xA4,
+  0x44, 0xA4, 0xF0, 0x34, 0xF0, 0x34, 0xE8, 0x8E, 0x6F, 0x01, 0x59, 0x44,
+  0x46, 0x84, 0x44, 0xA4, 0x34, 0xB4, 0x34, 0xB4, 0x34, 0xB4, 0x34, 0xA5,
+  0x44, 0x86, 0x45, 0x58, 0x5C, 0x17, 0x3A, 0x36, 0x56, 0x65, 0x68, 0x86,
+  0xBC, 0x4B, 0x7E, 0x2D, 0x57, 0x3C, 0x27, 0x44, 0x88, 0x74, 0x44, 0x96,
+  0x94, 0x24, 0xA5, 0xA4, 0x24, 0xA4, 0xC4, 0xF4, 0xC4, 0xF4, 0xC4, 0xE5,
+  0xC4, 0x7F, 0x0D, 0x4F, 0x0F, 0x01, 0x2B, 0x2F, 0x05, 0x17, 0x74, 0xF0,
+  0x24, 0xA4, 0xF0, 0x14, 0xB4, 0xF0, 0x14, 0xB4, 0xC8, 0xB5, 0xB3, 0x14,
+  0xA6, 0xA4, 0x24, 0x88, 0x85, 0x25, 0x55, 0x26, 0x27, 0x4C, 0x4E, 0x6A,
+  0x7B, 0x87, 0xB7, 0x60, 0x77, 0xBB, 0x8D, 0x66, 0x27, 0x45, 0x74, 0x44,
+  0x94, 0x24, 0xA4, 0x24, 0xA4, 0x24, 0xF4, 0xF0, 0x14, 0xF0, 0x14, 0xF0,
+  0x14, 0xF0, 0x14, 0xF0, 0x14, 0xF0, 0x14, 0xF0, 0x23, 0xC3, 0x24, 0xB3,
+  0x24, 0xA4, 0x34, 0x94, 0x35, 0x74, 0x56, 0x36, 0x6D, 0x8B, 0xB7, 0xE2,
+  0xF0, 0x34, 0xF0, 0x16, 0xF0, 0x23, 0xF0, 0x23, 0xA2, 0x53, 0xA9, 0xD6,
+  0x80, 0x55, 0xF0, 0x25, 0xF0, 0x24, 0xF0, 0x34, 0xF0, 0x34, 0xF0, 0x33,
+  0xF0, 0xF0, 0xF0, 0xC7, 0xCB, 0x9D, 0x76, 0x36, 0x55, 0x75, 0x44, 0x94,
+  0x34, 0xB4, 0x24, 0xB4, 0x24, 0xB4, 0x23, 0xD3, 0x14, 0xD3, 0x1F, 0x0F,
+  0x0F, 0x0F, 0x07, 0xF0, 0x24, 0xF0, 0x33, 0xF0, 0x34, 0xB4, 0x24, 0xB4,
+  0x34, 0x94, 0x45, 0x75, 0x56, 0x36, 0x7D, 0x9B, 0xC7, 0x70, 0xB5, 0xF0,
+  0x14, 0xF0, 0x14, 0xF0, 0x14, 0xF0, 0x23, 0xF0, 0x23, 0xF0, 0xF0, 0xF0,
+  0xE7, 0xCB, 0x9D, 0x76, 0x36, 0x55, 0x75, 0x44, 0x94, 0x34, 0xB4, 0x24,
+  0xB4, 0x24, 0xB4, 0x23, 0xD3, 0x14, 0xD3, 0x1F, 0x0F, 0x0F, 0x0F, 0x07,
+  0xF0, 0x24, 0xF0, 0x33, 0xF0, 0x34, 0xB4, 0x24, 0xB4, 0x34, 0x94, 0x45,
+  0x75, 0x56, 0x36, 0x7D, 0x9B, 0xC7, 0x70, 0x94, 0xF0, 0x16, 0xE8, 0xD3,
+  0x23, 0xC3, 0x43, 0xA3, 0x62, 0xF0, 0x61, 0xF0, 0xF0, 0x27, 0xCB, 0x9D,
+  0x76, 0x36, 0x55, 0x75, 0x44, 0x94, 0x34, 0xB4, 0x24, 0xB4, 0x24, 0xB4,
+  0x23, 0xD3, 0x14, 0xD3, 0x1F, 0x0F, 0x0F, 0x0F, 0x07, 0xF0, 0x24, 0xF0,
+  0x33, 0xF0, 0x34, 0xB4, 0x24, 0xB4, 0x34, 0x94, 0x45, 0x75, 0x56, 0x36,
+  0x7D, 0x9B, 0xC7, 0x70, 0x54, 0x35, 0x94, 0x35, 0x94, 0x35, 0x94, 0x35,
+  0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x57, 0xCB, 0x9D, 0x76, 0x36, 0x55,
+  0x75, 0x44, 0x94, 0x34, 0xB4, 0x24, 0xB4, 0x24, 0xB4, 0x23, 0xD3, 0x14,
+  0xD3, 0x1F, 0x0F, 0x0F, 0x0F, 0x07, 0xF0, 0x24, 0xF0, 0x33, 0xF0, 0x34,
+  0xB4, 0x24, 0xB4, 0x34, 0x94, 0x45, 0x75, 0x56, 0x36, 0x7D, 0x9B, 0xC7,
+  0x70, 0x05, 0x55, 0x54, 0x64, 0x64, 0x63, 0x91, 0xF0, 0x64, 0x54, 0x54,
+  0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
+  0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x20, 0x35, 0x44, 0x44,
+  0x44, 0x53, 0x53, 0xF0, 0xF0, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
+  0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
+  0x54, 0x54, 0x54, 0x54, 0x30, 0x45, 0x86, 0x67, 0x54, 0x23, 0x43, 0x34,
+  0x23, 0x53, 0xF0, 0xF0, 0xF3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3,
+  0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3,
+  0xA3, 0xA3, 0xA3, 0x50, 0x04, 0x39, 0x39, 0x39, 0x35, 0xF0, 0xF0, 0xF0,
+  0xF0, 0x43, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93,
+  0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93,
+  0x50, 0x41, 0xF0, 0x44, 0x52, 0xA6, 0x15, 0xB8, 0xE6, 0xCA, 0xB4, 0x25,
+  0xF0, 0x25, 0xF0, 0x25, 0xCA, 0x9C, 0x8E, 0x66, 0x37, 0x45, 0x75, 0x35,
+  0x94, 0x34, 0xB4, 0x24, 0xB4, 0x23, 0xC4, 0x14, 0xD3, 0x14, 0xD8, 0xD8,
+  0xD8, 0xD8, 0xD8, 0xD3, 0x24, 0xB4, 0x24, 0xB4, 0x24, 0xB4, 0x34, 0x94,
+  0x45, 0x75, 0x56, 0x36, 0x7D, 0x9B, 0xC7, 0x70, 0x42, 0x73, 0x57, 0x32,
+  0x6C, 0x53, 0x36, 0xE3, 0xF0, 0xF0, 0xF0, 0x45, 0x53, 0x39, 0x33, 0x2B,
+  0x23, 0x13, 0x46, 0x16, 0x74, 0x15, 0x89, 0xA8, 0xA7, 0xB7, 0xB7, 0xB7,
+  0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7,
+  0xB4, 0x55, 0xF0, 0x25, 0xF0, 0x24, 0xF0, 0x34, 0xF0, 0x34, 0xF0, 0x33,
+  0xF0, 0xF0, 0xF0, 0xC7, 0xCB, 0x9D, 0x76, 0x36, 0x55, 0x75, 0x44, 0x94,
+  0x34, 0xB4, 0x24, 0xB4, 0x24, 0xB4, 0x14, 0xD3, 0x14, 0xD8, 0xD8, 0xD8,
+  0xD8, 0xD8, 0xD4, 0x14, 0xB4, 0x24, 0xB4, 0x24, 0xB4, 0x34, 0x94, 0x45,
+  0x75, 0x56, 0x36, 0x7D, 0x9B, 0xC7, 0x70, 0xB5, 0xF5, 0xF0, 0x14, 0xF0,
+  0x14, 0xF0, 0x14, 0xF0, 0x23, 0xF0, 0xF0, 0xF0, 0xE7, 0xCB, 0x9D, 0x76,
+  0x36, 0x55, 0x75, 0x44, 0x94, 0x34, 0xB4, 0x24, 0xB4, 0x24, 0xB4, 0x14,
+  0xD3, 0x14, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD4, 0x14, 0xB4, 0x24, 0xB4,
+  0x24, 0xB4, 0x34, 0x94, 0x45, 0x75, 0x56, 0x36, 0x7D, 0x9B, 0xC7, 0x70,
+  0x85, 0xF6, 0xF7, 0xD3, 0x24, 0xB4, 0x33, 0xB3, 0x53, 0xF0, 0xF0, 0x37,
+  0xCB, 0x9D, 0x76, 0x36, 0x55, 0x75, 0x44, 0x94, 0x34, 0xB4, 0x24, 0xB4,
+  0x24, 0xB4, 0x14, 0xD3, 0x14, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD4, 0x14,
+  0xB4, 0x24, 0xB4, 0x24, 0xB4, 0x34, 0x94, 0x45, 0x75, 0x56, 0x36, 0x7D,
+  0x9B, 0xC7, 0x70, 0x63, 0x62, 0x96, 0x33, 0x8D, 0x83, 0x27, 0xF0, 0x23,
+  0xF0, 0xF0, 0xF0, 0xA7, 0xCB, 0x9D, 0x76, 0x36, 0x55, 0x75, 0x44, 0x94,
+  0x34, 0xB4, 0x24, 0xB4, 0x24, 0xB4, 0x14, 0xD3, 0x14, 0xD8, 0xD8, 0xD8,
+  0xD8, 0xD8, 0xD4, 0x14, 0xB4, 0x24, 0xB4, 0x24, 0xB4, 0x34, 0x94, 0x45,
+  0x75, 0x56, 0x36, 0x7D, 0x9B, 0xC7, 0x70, 0x45, 0x35, 0x85, 0x35, 0x85,
+  0x35, 0x85, 0x35, 0xF0, 0xF0, 0xF0, 0xF0, 0xE7, 0xCB, 0x9D, 0x76, 0x36,
+  0x55, 0x75, 0x44, 0x94, 0x34, 0xB4, 0x24, 0xB4, 0x24, 0xB4, 0x14, 0xD3,
+  0x14, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD4, 0x14, 0xB4, 0x24, 0xB4, 0x24,
+  0xB4, 0x34, 0x94, 0x45, 0x75, 0x56, 0x36, 0x7D, 0x9B, 0xC7, 0x70, 0x85,
+  0xF0, 0x15, 0xF0, 0x15, 0xF0, 0x15, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+  0x2F, 0x0F, 0x0F, 0x0F, 0x03, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+  0x85, 0xF0, 0x15, 0xF0, 0x15, 0xF0, 0x15, 0x80, 0x87, 0x61, 0x6B, 0x32,
+  0x5D, 0x12, 0x56, 0x37, 0x55, 0x75, 0x54, 0x94, 0x44, 0x96, 0x34, 0x96,
+  0x33, 0x92, 0x14, 0x24, 0x82, 0x33, 0x24, 0x72, 0x44, 0x14, 0x63, 0x44,
+  0x14, 0x53, 0x54, 0x14, 0x43, 0x64, 0x14, 0x42, 0x74, 0x14, 0x32, 0x83,
+  0x33, 0x22, 0x84, 0x37, 0x84, 0x36, 0x94, 0x35, 0x94, 0x55, 0x75, 0x57,
+  0x36, 0x52, 0x1D, 0x52, 0x3B, 0x62, 0x57, 0x70, 0x34, 0xF4, 0xF4, 0xF3,
+  0xF0, 0x13, 0xF0, 0x13, 0xF0, 0xF0, 0xF0, 0xF0, 0x13, 0xB7, 0xB7, 0xB7,
+  0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7,
+  0xB7, 0xA8, 0xA9, 0x8A, 0x7D, 0x48, 0x1C, 0x14, 0x2A, 0x24, 0x37, 0x80,
+  0xA4, 0xD4, 0xD4, 0xE3, 0xE3, 0xE3, 0xF0, 0xF0, 0xF0, 0xF0, 0x33, 0xB7,
+  0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7,
+  0xB7, 0xB7, 0xB7, 0xA8, 0xA9, 0x8A, 0x7D, 0x48, 0x1C, 0x14, 0x2A, 0x24,
+  0x37, 0x80, 0x65, 0xD6, 0xB3, 0x13, 0xA4, 0x23, 0x93, 0x33, 0x83, 0x53,
+  0xF0, 0xF0, 0xA3, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7,
+  0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xA8, 0xA9, 0x8A, 0x7D, 0x48,
+  0x1C, 0x14, 0x2A, 0x24, 0x37, 0x80, 0x34, 0x35, 0x64, 0x35, 0x64, 0x35,
+  0x64, 0x35, 0xF0, 0xF0, 0xF0, 0xF0, 0xF3, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7,
+  0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xA8,
+  0xA9, 0x8A, 0x7D, 0x48, 0x1C, 0x14, 0x2A, 0x24, 0x37, 0x80, 0xC4, 0xF4,
+  0xF4, 0xF0, 0x13, 0xF0, 0x13, 0xF0, 0x13, 0xF0, 0xF0, 0xF0, 0xF0, 0xA3,
+  0xC4, 0x14, 0xB4, 0x14, 0xA4, 0x33, 0xA4, 0x34, 0x94, 0x34, 0x84, 0x53,
+  0x84, 0x54, 0x73, 0x64, 0x64, 0x73, 0x64, 0x74, 0x53, 0x84, 0x44, 0x93,
+  0x44, 0x94, 0x33, 0xA4, 0x24, 0xB3, 0x24, 0xB4, 0x13, 0xC8, 0xD6, 0xE6,
+  0xE6, 0xF4, 0xF0, 0x14, 0xF0, 0x14, 0xF0, 0x13, 0xF0, 0x14, 0xF0, 0x14,
+  0xF4, 0xF0, 0x14, 0xC7, 0xD7, 0xD6, 0xF2, 0xF0, 0x03, 0xF0, 0x23, 0xF0,
+  0x23, 0xF0, 0x23, 0xF0, 0x23, 0xF0, 0x23, 0xF0, 0x23, 0xF0, 0x23, 0xF0,
+  0x23, 0x46, 0x73, 0x2A, 0x53, 0x1C, 0x48, 0x36, 0x36, 0x75, 0x25, 0x94,
+  0x24, 0xB4, 0x14, 0xB4, 0x14, 0xB4, 0x13, 0xD3, 0x13, 0xD7, 0xD7, 0xD7,
+  0xD7, 0xD7, 0xD8, 0xB4, 0x14, 0xB4, 0x14, 0xB4, 0x15, 0x94, 0x26, 0x75,
+  0x28, 0x36, 0x33, 0x1C, 0x43, 0x2A, 0x53, 0x46, 0x73, 0xF0, 0x23, 0xF0,
+  0x23, 0xF0, 0x23, 0xF0, 0x23, 0xF0, 0x23, 0xF0, 0x23, 0xF0, 0x23, 0xF0,
+  0x20, 0x54, 0x35, 0x84, 0x35, 0x84, 0x35, 0x84, 0x35, 0xF0, 0xF0, 0xF0,
+  0xF0, 0xF0, 0x93, 0xC4, 0x14, 0xB4, 0x14, 0xA4, 0x33, 0xA4, 0x34, 0x94,
+  0x34, 0x84, 0x53, 0x84, 0x54, 0x73, 0x64, 0x64, 0x73, 0x64, 0x74, 0x53,
+  0x84, 0x44, 0x93, 0x44, 0x94, 0x33, 0xA4, 0x24, 0xB3, 0x24, 0xB4, 0x13,
+  0xC8, 0xD6, 0xE6, 0xE6, 0xF4, 0xF0, 0x14, 0xF0, 0x14, 0xF0, 0x13, 0xF0,
+  0x14, 0xF0, 0x14, 0xF4, 0xF0, 0x14, 0xC7, 0xD7, 0xD6, 0xF2, 0xF0 };
+
+constexpr GFXglyph FreeSans_RLE_22pt8bGlyphs[] PROGMEM = {
+  {     0,   1,   1,  11,    0,    0 },   // 0x20 ' '
+  {     1,   4,  31,  14,    5,  -30 },   // 0x21 '!'
+  {    16,  11,  11,  14,    2,  -30 },   // 0x22 '"'
+  {    34,  22,  31,  24,    1,  -29 },   // 0x23 '#'
+  {    97,  21,  38,  24,    1,  -32 },   // 0x24 '$'
+  {   174,  36,  32,  38,    1,  -30 },   // 0x25 '%'
+  {   266,  25,  32,  29,    2,  -30 },   // 0x26 '&'
+  {   332,   4,  11,   9,    2,  -30 },   // 0x27 '''
+  {   340,  10,  41,  14,    3,  -30 },   // 0x28 '('
+  {   381,   9,  41,  14,    2,  -30 },   // 0x29 ')'
+  {   423,  13,  12,  17,    2,  -30 },   // 0x2A '*'
+  {   443,  21,  21,  25,    2,  -19 },   // 0x2B '+'
+  {   483,   4,  11,  12,    4,   -3 },   // 0x2C ','
+  {   492,  10,   3,  14,    2,  -12 },   // 0x2D '-'
+  {   494,   5,   4,  11,    3,   -3 },   // 0x2E '.'
+  {   496,  12,  32,  12,    0,  -30 },   // 0x2F '/'
+  {   529,  20,  32,  24,    2,  -30 },   // 0x30 '0'
+  {   578,  11,  31,  24,    4,  -30 },   // 0x31 '1'
+  {   608,  21,  31,  24,    1,  -30 },   // 0x32 '2'
+  {   657,  21,  32,  24,    1,  -30 },   // 0x33 '3'
+  {   710,  21,  31,  24,    1,  -30 },   // 0x34 '4'
+  {   767,  21,  32,  24,    1,  -30 },   // 0x35 '5'
+  {   827,  20,  32,  24,    2,  -30 },   // 0x36 '6'
+  {   881,  20,  31,  24,    2,  -30 },   // 0x37 '7'
+  {   939,  20,  32,  24,    2,  -30 },   // 0x38 '8'
+  {   988,  20,  32,  24,    2,  -30 },   // 0x39 '9'
+  {  1043,   5,  23,  11,    3,  -22 },   // 0x3A ':'
+  {  1051,   5,  30,  11,    3,  -22 },   // 0x3B ';'
+  {  1067,  21,  21,  25,    2,  -19 },   // 0x3C '<'
+  {  1097,  21,  10,  25,    2,  -14 },   // 0x3D '='
+  {  1112,  21,  21,  25,    2,  -19 },   // 0x3E '>'
+  {  1141,  19,  32,  24,    3,  -31 },   // 0x3F '?'
+  {  1180,  40,  38,  44,    1,  -31 },   // 0x40 '@'
+  {  1306,  27,  31,  29,    1,  -30 },   // 0x41 'A'
+  {  1374,  24,  31,  29,    3,  -30 },   // 0x42 'B'
+  {  1436,  27,  33,  31,    2,  -31 },   // 0x43 'C'
+  {  1506,  25,  31,  30,    3,  -30 },   // 0x44 'D'
+  {  1573,  23,  31,  27,    3,  -30 },   // 0x45 'E'
+  {  1634,  22,  31,  26,    3,  -30 },   // 0x46 'F'
+  {  1695,  28,  33,  33,    2,  -31 },   // 0x47 'G'
+  {  1770,  25,  31,  31,    3,  -30 },   // 0x48 'H'
+  {  1832,   4,  31,  12,    4,  -30 },   // 0x49 'I'
+  {  1841,  18,  32,  23,    1,  -30 },   // 0x4A 'J'
+  {  1879,  25,  31,  29,    3,  -30 },   // 0x4B 'K'
+  {  1944,  20,  31,  24,    3,  -30 },   // 0x4C 'L'
+  {  2004,  30,  31,  36,    3,  -30 },   // 0x4D 'M'
+  {  2084,  25,  31,  31,    3,  -30 },   // 0x4E 'N'
+  {  2136,  30,  33,  34,    2,  -31 },   // 0x4F 'O'
+  {  2211,  23,  31,  28,    3,  -30 },   // 0x50 'P'
+  {  2266,  30,  35,  34,    2,  -31 },   // 0x51 'Q'
+  {  2346,  26,  31,  31,    3,  -30 },   // 0x52 'R'
+  {  2425,  25,  33,  29,    2,  -31 },   // 0x53 'S'
+  {  2483,  25,  31,  27,    1,  -30 },   // 0x54 'T'
+  {  2544,  25,  32,  31,    3,  -30 },   // 0x55 'U'
+  {  2608,  26,  31,  28,    1,  -30 },   // 0x56 'V'
+  {  2676,  39,  31,  40,    1,  -30 },   // 0x57 'W'
+  {  2780,  27,  31,  28,    1,  -30 },   // 0x58 'X'
+  {  2848,  28,  31,  29,    1,  -30 },   // 0x59 'Y'
+  {  2916,  24,  31,  27,    1,  -30 },   // 0x5A 'Z'
+  {  2978,   8,  40,  12,    3,  -30 },   // 0x5B '['
+  {  3015,  12,  32,  12,    0,  -30 },   // 0x5C '\'
+  {  3047,   8,  40,  12,    1,  -30 },   // 0x5D ']'
+  {  3084,  16,  16,  20,    2,  -30 },   // 0x5E '^'
+  {  3110,  26,   2,  24,   -1,    7 },   // 0x5F '_'
+  {  3114,   9,   6,  11,    1,  -31 },   // 0x60 '`'
+  {  3121,  22,  25,  23,    1,  -23 },   // 0x61 'a'
+  {  3166,  20,  32,  24,    3,  -30 },   // 0x62 'b'
+  {  3223,  20,  25,  22,    1,  -23 },   // 0x63 'c'
+  {  3267,  20,  32,  24,    1,  -30 },   // 0x64 'd'
+  {  3324,  21,  25,  23,    1,  -23 },   // 0x65 'e'
+  {  3367,  10,  32,  12,    1,  -31 },   // 0x66 'f'
+  {  3399,  20,  33,  24,    1,  -23 },   // 0x67 'g'
+  {  3457,  18,  31,  23,    3,  -30 },   // 0x68 'h'
+  {  3495,   3,  31,  10,    3,  -30 },   // 0x69 'i'
+  {  3501,   7,  40,  10,    0,  -30 },   // 0x6A 'j'
+  {  3539,  19,  31,  22,    3,  -30 },   // 0x6B 'k'
+  {  3600,   3,  31,   9,    3,  -30 },   // 0x6C 'l'
+  {  3607,  29,  24,  35,    3,  -23 },   // 0x6D 'm'
+  {  3658,  18,  24,  23,    3,  -23 },   // 0x6E 'n'
+  {  3688,  21,  25,  23,    1,  -23 },   // 0x6F 'o'
+  {  3728,  20,  33,  24,    3,  -23 },   // 0x70 'p'
+  {  3788,  20,  33,  24,    1,  -23 },   // 0x71 'q'
+  {  3847,  10,  24,  14,    3,  -23 },   // 0x72 'r'
+  {  3871,  19,  25,  21,    1,  -23 },   // 0x73 's'
+  {  3906,  10,  30,  12,    1,  -28 },   // 0x74 't'
+  {  3935,  18,  24,  23,    3,  -22 },   // 0x75 'u'
+  {  3963,  21,  23,  21,    0,  -22 },   // 0x76 'v'
+  {  4008,  31,  23,  31,    0,  -22 },   // 0x77 'w'
+  {  4082,  20,  23,  21,    0,  -22 },   // 0x78 'x'
+  {  4121,  20,  33,  21,    0,  -22 },   // 0x79 'y'
+  {  4178,  19,  23,  21,    1,  -22 },   // 0x7A 'z'
+  {  4205,  10,  40,  14,    2,  -30 },   // 0x7B '{'
+  {  4245,   3,  41,  11,    4,  -30 },   // 0x7C '|'
+  {  4254,  10,  40,  14,    2,  -30 },   // 0x7D '}'
+  {  4295,  19,   7,  22,    1,  -18 },   // 0x7E '~'
+  {  4308,  32,  40,  34,    1,  -33 },   // 0x7F ''
+  {  4399,  32,  40,  34,    1,  -33 },   // 0x80 ''
+  {  4490,  32,  40,  34,    1,  -33 },   // 0x81 ''
+  {  4581,  32,  40,  34,    1,  -33 },   // 0x82 ''
+  {  4672,  32,  40,  34,    1,  -33 },   // 0x83 ''
+  {  4763,  32,  40,  34,    1,  -33 },   // 0x84 ''
+  {  4854,  32,  40,  34,    1,  -33 },   // 0x85 ''
+  {  4945,  32,  40,  34,    1,  -33 },   // 0x86 ''
+  {  5036,  32,  40,  34,    1,  -33 },   // 0x87 ''
+  {  5127,  32,  40,  34,    1,  -33 },   // 0x88 ''
+  {  5218,  32,  40,  34,    1,  -33 },   // 0x89 ''
+  {  5309,  32,  40,  34,    1,  -33 },   // 0x8A ''
+  {  5400,  32,  40,  34,    1,  -33 },   // 0x8B ''
+  {  5491,  32,  40,  34,    1,  -33 },   // 0x8C ''
+  {  5582,  32,  40,  34,    1,  -33 },   // 0x8D ''
+  {  5673,  32,  40,  34,    1,  -33 },   // 0x8E ''
+  {  5764,  32,  40,  34,    1,  -33 },   // 0x8F ''
+  {  5855,  32,  40,  34,    1,  -33 },   // 0x90 ''
+  {  5946,  32,  40,  34,    1,  -33 },   // 0x91 ''
+  {  6037,  32,  40,  34,    1,  -33 },   // 0x92 ''
+  {  6128,  32,  40,  34,    1,  -33 },   // 0x93 ''
+  {  6219,  32,  40,  34,    1,  -33 },   // 0x94 ''
+  {  6310,  32,  40,  34,    1,  -33 },   // 0x95 ''
+  {  6401,  32,  40,  34,    1,  -33 },   // 0x96 ''
+  {  6492,  32,  40,  34,    1,  -33 },   // 0x97 ''
+  {  6583,  32,  40,  34,    1,  -33 },   // 0x98 ''
+  {  6674,  32,  40,  34,    1,  -33 },   // 0x99 ''
+  {  6765,  32,  40,  34,    1,  -33 },   // 0x9A ''
+  {  6856,  32,  40,  34,    1,  -33 },   // 0x9B ''
+  {  6947,  32,  40,  34,    1,  -33 },   // 0x9C ''
+  {  7038,  32,  40,  34,    1,  -33 },   // 0x9D ''
+  {  7129,  32,  40,  34,    1,  -33 },   // 0x9E ''
+  {  7220,  32,  40,  34,    1,  -33 },   // 0x9F ''
+  {  7311,   1,   1,  12,    0,    0 },   // 0xA0 ''
+  {  7312,   4,  32,  14,    5,  -22 },   // 0xA1 ''
+  {  7325,  20,  33,  24,    2,  -27 },   // 0xA2 ''
+  {  7397,  22,  32,  24,    1,  -30 },   // 0xA3 ''
+  {  7457,  18,  18,  24,    3,  -23 },   // 0xA4 ''
+  {  7494,  23,  31,  24,    0,  -30 },   // 0xA5 ''
+  {  7556,   3,  41,  11,    4,  -30 },   // 0xA6 ''
+  {  7565,  20,  40,  24,    2,  -30 },   // 0xA7 ''
+  {  7633,  12,   4,  14,    1,  -30 },   // 0xA8 ''
+  {  7638,  31,  32,  34,    2,  -30 },   // 0xA9 ''
+  {  7733,  12,  19,  16,    2,  -31 },   // 0xAA ''
+  {  7761,  15,  14,  22,    3,  -18 },   // 0xAB ''
+  {  7789,  21,  12,  25,    2,  -15 },   // 0xAC ''
+  {  7812,  10,   3,  14,    2,  -12 },   // 0xAD ''
+  {  7814,  31,  32,  34,    2,  -30 },   // 0xAE ''
+  {  7909,  12,   3,  14,    1,  -29 },   // 0xAF ''
+  {  7912,  14,  12,  26,    6,  -28 },   // 0xB0 ''
+  {  7932,  21,  27,  25,    2,  -25 },   // 0xB1 ''
+  {  7980,  13,  18,  15,    1,  -34 },   // 0xB2 ''
+  {  8000,  13,  19,  15,    1,  -34 },   // 0xB3 ''
+  {  8025,   9,   6,  14,    4,  -31 },   // 0xB4 ''
+  {  8032,  20,  33,  24,    3,  -22 },   // 0xB5 ''
+  {  8098,  20,  39,  23,    2,  -30 },   // 0xB6 ''
+  {  8175,   4,   4,  11,    4,  -13 },   // 0xB7 ''
+  {  8177,  10,   9,  14,    2,    1 },   // 0xB8 ''
+  {  8186,   7,  19,  15,    3,  -35 },   // 0xB9 ''
+  {  8204,  12,  19,  16,    2,  -31 },   // 0xBA ''
+  {  8226,  15,  14,  22,    3,  -18 },   // 0xBB ''
+  {  8254,  34,  33,  37,    3,  -31 },   // 0xBC ''
+  {  8350,  33,  32,  37,    3,  -30 },   // 0xBD ''
+  {  8435,  35,  33,  38,    1,  -31 },   // 0xBE ''
+  {  8538,  19,  32,  24,    4,  -22 },   // 0xBF ''
+  {  8577,  27,  38,  29,    1,  -37 },   // 0xC0 ''
+  {  8658,  27,  38,  29,    1,  -37 },   // 0xC1 ''
+  {  8740,  27,  38,  29,    1,  -37 },   // 0xC2 ''
+  {  8823,  27,  38,  29,    1,  -37 },   // 0xC3 ''
+  {  8904,  27,  37,  29,    1,  -36 },   // 0xC4 ''
+  {  8984,  27,  41,  29,    1,  -40 },   // 0xC5 ''
+  {  9075,  40,  31,  42,    1,  -30 },   // 0xC6 ''
+  {  9162,  27,  41,  31,    2,  -31 },   // 0xC7 ''
+  {  9249,  23,  38,  27,    3,  -37 },   // 0xC8 ''
+  {  9322,  23,  38,  27,    3,  -37 },   // 0xC9 ''
+  {  9395,  23,  38,  27,    3,  -37 },   // 0xCA ''
+  {  9467,  23,  37,  27,    3,  -36 },   // 0xCB ''
+  {  9539,  10,  38,  12,    0,  -37 },   // 0xCC ''
+  {  9577,  10,  38,  12,    2,  -37 },   // 0xCD ''
+  {  9615,  13,  38,  13,    0,  -37 },   // 0xCE ''
+  {  9657,  13,  37,  13,    0,  -36 },   // 0xCF ''
+  {  9695,  28,  31,  30,    1,  -30 },   // 0xD0 ''
+  {  9768,  25,  37,  31,    3,  -36 },   // 0xD1 ''
+  {  9829,  30,  40,  34,    2,  -38 },   // 0xD2 ''
+  {  9918,  30,  40,  34,    2,  -38 },   // 0xD3 ''
+  { 10008,  30,  40,  34,    2,  -38 },   // 0xD4 ''
+  { 10099,  30,  39,  34,    2,  -37 },   // 0xD5 ''
+  { 10188,  30,  39,  34,    2,  -37 },   // 0xD6 ''
+  { 10279,  17,  17,  25,    4,  -17 },   // 0xD7 ''
+  { 10309,  31,  34,  34,    1,  -32 },   // 0xD8 ''
+  { 10397,  25,  39,  31,    3,  -37 },   // 0xD9 ''
+  { 10473,  25,  39,  31,    3,  -37 },   // 0xDA ''
+  { 10550,  25,  39,  31,    3,  -37 },   // 0xDB ''
+  { 10628,  25,  38,  31,    3,  -36 },   // 0xDC ''
+  { 10703,  28,  38,  29,    1,  -37 },   // 0xDD ''
+  { 10784,  23,  31,  28,    3,  -30 },   // 0xDE ''
+  { 10841,  21,  32,  26,    3,  -30 },   // 0xDF ''
+  { 10899,  22,  33,  23,    1,  -31 },   // 0xE0 ''
+  { 10958,  22,  33,  23,    1,  -31 },   // 0xE1 ''
+  { 11018,  22,  33,  23,    1,  -31 },   // 0xE2 ''
+  { 11077,  22,  32,  23,    1,  -30 },   // 0xE3 ''
+  { 11134,  22,  33,  23,    1,  -31 },   // 0xE4 ''
+  { 11193,  22,  35,  23,    1,  -33 },   // 0xE5 ''
+  { 11254,  35,  25,  38,    1,  -23 },   // 0xE6 ''
+  { 11320,  20,  33,  22,    1,  -23 },   // 0xE7 ''
+  { 11377,  21,  33,  23,    1,  -31 },   // 0xE8 ''
+  { 11434,  21,  33,  23,    1,  -31 },   // 0xE9 ''
+  { 11491,  21,  33,  23,    1,  -31 },   // 0xEA ''
+  { 11548,  21,  33,  23,    1,  -31 },   // 0xEB ''
+  { 11605,   9,  32,  10,    0,  -31 },   // 0xEC ''
+  { 11637,   9,  32,  10,    1,  -31 },   // 0xED ''
+  { 11669,  13,  32,  11,   -1,  -31 },   // 0xEE ''
+  { 11704,  12,  32,  11,    0,  -31 },   // 0xEF ''
+  { 11737,  21,  34,  23,    1,  -32 },   // 0xF0 ''
+  { 11792,  18,  31,  23,    3,  -30 },   // 0xF1 ''
+  { 11833,  21,  33,  23,    1,  -31 },   // 0xF2 ''
+  { 11887,  21,  33,  23,    1,  -31 },   // 0xF3 ''
+  { 11940,  21,  32,  23,    1,  -30 },   // 0xF4 ''
+  { 11991,  21,  32,  23,    1,  -30 },   // 0xF5 ''
+  { 12043,  21,  32,  23,    1,  -30 },   // 0xF6 ''
+  { 12095,  21,  20,  25,    2,  -19 },   // 0xF7 ''
+  { 12128,  22,  25,  23,    0,  -23 },   // 0xF8 ''
+  { 12188,  18,  33,  23,    3,  -31 },   // 0xF9 ''
+  { 12228,  18,  33,  23,    3,  -31 },   // 0xFA ''
+  { 12266,  18,  32,  23,    3,  -30 },   // 0xFB ''
+  { 12306,  18,  32,  23,    3,  -30 },   // 0xFC ''
+  { 12346,  20,  42,  21,    0,  -31 },   // 0xFD ''
+  { 12416,  20,  41,  24,    3,  -31 },   // 0xFE ''
+  { 12493,  20,  41,  21,    0,  -30 } }; // 0xFF ''
+
+constexpr GFXfont FreeSans_RLE_22pt8b PROGMEM = {
+  (uint8_t  *)FreeSans_RLE_22pt8bBitmaps,
+  (GFXglyph *)FreeSans_RLE_22pt8bGlyphs,
+  0x20, 0xFF, 52 };
+
+// Approx. 14138 bytes
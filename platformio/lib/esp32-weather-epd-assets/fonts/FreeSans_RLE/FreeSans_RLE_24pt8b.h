@@ -0,0 +1,1420 @@
+// Run-length encoded glyph bitmaps (fontconvert -r)
+#define FreeSans_RLE_24pt8b_RLE
+
+const uint8_t FreeSans_RLE_24pt8bBitmaps[] PROGMEM = {
+  0x10, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x13, 0x13, 0x13, 0x22, 0x22, 0x22,
+  0x22, 0xDF, 0x05, 0x04, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x48, 0x43,
+  0x23, 0x43, 0x22, 0x53, 0x22, 0x53, 0x22, 0x62, 0x10, 0x93, 0x64, 0xA4,
+  0x63, 0xB4, 0x63, 0xB4, 0x54, 0xB3, 0x64, 0xB3, 0x64, 0xA4, 0x64, 0xA4,
+  0x63, 0xB4, 0x63, 0x5F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x64, 0x63, 0xB4,
+  0x63, 0xB4, 0x54, 0xB3, 0x64, 0xB3, 0x64, 0xA4, 0x63, 0xB4, 0x63, 0xB4,
+  0x63, 0x6F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x54, 0x63, 0xB4, 0x63, 0xB4,
+  0x54, 0xB3, 0x64, 0xB3, 0x64, 0xA4, 0x63, 0xB4, 0x63, 0xB4, 0x63, 0xB3,
+  0x64, 0xB3, 0x64, 0x80, 0x93, 0xF0, 0x43, 0xF0, 0x43, 0xF0, 0x28, 0xBD,
+  0x8F, 0x01, 0x5A, 0x16, 0x45, 0x33, 0x35, 0x34, 0x43, 0x45, 0x24, 0x43,
+  0x54, 0x14, 0x53, 0x54, 0x14, 0x53, 0x63, 0x14, 0x53, 0xA4, 0x53, 0xA5,
+  0x43, 0xB4, 0x43, 0xB5, 0x33, 0xBB, 0xCC, 0xCD, 0xAE, 0xBC, 0xB3, 0x18,
+  0xA3, 0x36, 0xA3, 0x55, 0x93, 0x64, 0x93, 0x67, 0x63, 0x67, 0x63, 0x68,
+  0x53, 0x68, 0x53, 0x68, 0x53, 0x69, 0x43, 0x54, 0x25, 0x33, 0x45, 0x36,
+  0x13, 0x17, 0x4F, 0x02, 0x7E, 0xA9, 0xF0, 0x13, 0xF0, 0x43, 0xF0, 0x43,
+  0xF0, 0x43, 0xF0, 0x43, 0xA0, 0xF0, 0xC3, 0xF5, 0xF0, 0x13, 0xD9, 0xD3,
+  0xDB, 0xC3, 0xC5, 0x26, 0xA3, 0xC4, 0x65, 0x93, 0xC3, 0x84, 0x83, 0xD3,
+  0x93, 0x83, 0xC4, 0x93, 0x73, 0xD4, 0x93, 0x73, 0xD4, 0x93, 0x63, 0xF3,
+  0x93, 0x63, 0xF4, 0x74, 0x53, 0xF0, 0x24, 0x45, 0x54, 0xF0, 0x2C, 0x63,
+  0xF0, 0x4A, 0x64, 0xF0, 0x67, 0x73, 0xF0, 0xF0, 0x53, 0xF0, 0xF0, 0x63,
+  0xF0, 0xF0, 0x53, 0x87, 0xF0, 0x63, 0x6A, 0xF0, 0x43, 0x6C, 0xF0, 0x33,
+  0x64, 0x45, 0xF0, 0x13, 0x64, 0x74, 0xF3, 0x63, 0x84, 0xE3, 0x64, 0x93,
+  0xE3, 0x64, 0x93, 0xD3, 0x74, 0x93, 0xD3, 0x74, 0x93, 0xC3, 0x93, 0x84,
+  0xB4, 0x94, 0x65, 0xB3, 0xB5, 0x26, 0xB4, 0xCB, 0xC3, 0xE9, 0xC3, 0xF0,
+  0x25, 0x50, 0x96, 0xF0, 0x5A, 0xF0, 0x2C, 0xF6, 0x26, 0xE4, 0x64, 0xD4,
+  0x84, 0xC4, 0x84, 0xC4, 0x84, 0xC4, 0x84, 0xC5, 0x74, 0xD4, 0x64, 0xE5,
+  0x45, 0xF5, 0x16, 0xF0, 0x2A, 0xF0, 0x39, 0xF0, 0x56, 0xF0, 0x58, 0xF0,
+  0x4A, 0xF0, 0x16, 0x25, 0x54, 0x56, 0x44, 0x54, 0x55, 0x55, 0x44, 0x45,
+  0x75, 0x33, 0x54, 0x95, 0x14, 0x54, 0xA9, 0x44, 0xC7, 0x54, 0xC7, 0x55,
+  0xC5, 0x74, 0xC6, 0x64, 0xB8, 0x55, 0x99, 0x65, 0x7B, 0x5F, 0x02, 0x25,
+  0x5E, 0x55, 0x5C, 0x66, 0x77, 0xE0, 0x0F, 0x0A, 0x14, 0x14, 0x13, 0x23,
+  0x23, 0x32, 0x32, 0x10, 0x82, 0x83, 0x73, 0x83, 0x73, 0x83, 0x73, 0x83,
+  0x74, 0x73, 0x83, 0x74, 0x73, 0x83, 0x74, 0x74, 0x74, 0x73, 0x83, 0x83,
+  0x74, 0x74, 0x74, 0x74, 0x74, 0x83, 0x83, 0x84, 0x74, 0x74, 0x83, 0x83,
+  0x84, 0x74, 0x83, 0x84, 0x83, 0x83, 0x84, 0x83, 0x93, 0x83, 0x93, 0x92,
+  0x10, 0x03, 0x82, 0x83, 0x83, 0x73, 0x83, 0x73, 0x74, 0x73, 0x74, 0x64,
+  0x73, 0x74, 0x64, 0x64, 0x73, 0x74, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+  0x64, 0x64, 0x64, 0x64, 0x64, 0x63, 0x64, 0x64, 0x64, 0x63, 0x73, 0x64,
+  0x63, 0x73, 0x63, 0x73, 0x63, 0x73, 0x63, 0x73, 0x63, 0x70, 0x62, 0xC2,
+  0xC2, 0xC2, 0x64, 0x22, 0x2F, 0x03, 0x1C, 0x56, 0x86, 0x86, 0x73, 0x23,
+  0x53, 0x43, 0x52, 0x42, 0xF0, 0x20, 0xA3, 0xF0, 0x53, 0xF0, 0x53, 0xF0,
+  0x53, 0xF0, 0x53, 0xF0, 0x53, 0xF0, 0x53, 0xF0, 0x53, 0xF0, 0x53, 0xF0,
+  0x53, 0xAF, 0x0F, 0x0F, 0x0F, 0x09, 0xA3, 0xF0, 0x53, 0xF0, 0x53, 0xF0,
+  0x53, 0xF0, 0x53, 0xF0, 0x53, 0xF0, 0x53, 0xF0, 0x53, 0xF0, 0x53, 0xF0,
+  0x53, 0xA0, 0x0F, 0x0A, 0x32, 0x32, 0x23, 0x23, 0x22, 0x14, 0x13, 0x20,
+  0x0F, 0x0F, 0x03, 0x0F, 0x0A, 0xB2, 0xA3, 0xA3, 0xA2, 0xA3, 0xA3, 0xA2,
+  0xA3, 0xA3, 0xA2, 0xA3, 0xA3, 0xA2, 0xA3, 0xA3, 0xA2, 0xB2, 0xA3, 0xA2,
+  0xB2, 0xA3, 0xA3, 0xA2, 0xA3, 0xA3, 0xA2, 0xA3, 0xA3, 0xA2, 0xA3, 0xA3,
+  0xA2, 0xA3, 0xA3, 0xA2, 0xB0, 0x86, 0xEA, 0xAD, 0x8F, 0x75, 0x65, 0x55,
+  0x85, 0x44, 0xA4, 0x35, 0xA4, 0x34, 0xB5, 0x24, 0xC4, 0x24, 0xC4, 0x15,
+  0xC4, 0x15, 0xC9, 0xD9, 0xD9, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xD9, 0xD9,
+  0xDA, 0xC4, 0x24, 0xC4, 0x24, 0xC4, 0x24, 0xC4, 0x25, 0xA4, 0x44, 0xA4,
+  0x45, 0x85, 0x55, 0x65, 0x67, 0x17, 0x8D, 0xBA, 0xE6, 0x80, 0x83, 0x83,
+  0x83, 0x74, 0x74, 0x65, 0x3F, 0x0F, 0x0B, 0x74, 0x74, 0x74, 0x74, 0x74,
+  0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
+  0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x78, 0xCC, 0x9F, 0x6F, 0x02,
+  0x46, 0x75, 0x45, 0x95, 0x25, 0xB4, 0x24, 0xC5, 0x14, 0xD9, 0xD9, 0xD8,
+  0xE4, 0xF0, 0x25, 0xF0, 0x24, 0xF0, 0x25, 0xF0, 0x15, 0xF0, 0x16, 0xE7,
+  0xD8, 0xD7, 0xD8, 0xD7, 0xD7, 0xE6, 0xF6, 0xF0, 0x15, 0xF0, 0x15, 0xF0,
+  0x24, 0xF0, 0x25, 0xF0, 0x24, 0xF0, 0x3F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0D,
+  0x87, 0xDD, 0x9F, 0x7F, 0x02, 0x65, 0x76, 0x45, 0x95, 0x44, 0xB4, 0x44,
+  0xB5, 0x25, 0xB5, 0x24, 0xD4, 0x24, 0xC5, 0xF0, 0x35, 0xF0, 0x34, 0xF0,
+  0x35, 0xF0, 0x16, 0xCA, 0xD8, 0xFA, 0xDC, 0xF0, 0x35, 0xF0, 0x45, 0xF0,
+  0x44, 0xF0, 0x45, 0xF0, 0x35, 0x14, 0xE4, 0x14, 0xD5, 0x14, 0xD5, 0x14,
+  0xD4, 0x25, 0xC4, 0x34, 0xB5, 0x36, 0x76, 0x5F, 0x02, 0x7F, 0x9D, 0xD7,
+  0x80, 0xF4, 0xF0, 0x35, 0xF0, 0x35, 0xF0, 0x26, 0xF0, 0x17, 0xF0, 0x17,
+  0xF8, 0xE9, 0xD4, 0x15, 0xD4, 0x15, 0xC4, 0x25, 0xB4, 0x35, 0xB4, 0x35,
+  0xA4, 0x45, 0x94, 0x55, 0x85, 0x55, 0x84, 0x65, 0x74, 0x75, 0x64, 0x85,
+  0x64, 0x85, 0x54, 0x95, 0x44, 0xA5, 0x4F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x02, 0xE5, 0xF0, 0x35, 0xF0, 0x35, 0xF0, 0x35, 0xF0, 0x35, 0xF0, 0x35,
+  0xF0, 0x35, 0xF0, 0x35, 0x40, 0x3F, 0x02, 0x5F, 0x02, 0x5F, 0x02, 0x5F,
+  0x02, 0x53, 0xF0, 0x34, 0xF0, 0x34, 0xF0, 0x34, 0xF0, 0x34, 0xF0, 0x34,
+  0xF0, 0x34, 0xF0, 0x33, 0x44, 0xA4, 0x29, 0x7F, 0x02, 0x5F, 0x03, 0x47,
+  0x57, 0x35, 0x96, 0x24, 0xB5, 0xF0, 0x34, 0xF0, 0x35, 0xF0, 0x34, 0xF0,
+  0x34, 0xF0, 0x34, 0xF0, 0x34, 0xF0, 0x34, 0xF0, 0x38, 0xD9, 0xD4, 0x15,
+  0xB5, 0x25, 0xA4, 0x36, 0x76, 0x4F, 0x02, 0x6F, 0x8D, 0xC7, 0x80, 0x87,
+  0xDB, 0xAD, 0x8F, 0x66, 0x65, 0x54, 0x94, 0x45, 0x95, 0x34, 0xB4, 0x25,
+  0xB4, 0x24, 0xF0, 0x34, 0xF0, 0x34, 0xF0, 0x25, 0xF0, 0x24, 0x56, 0x74,
+  0x2B, 0x54, 0x1E, 0x3F, 0x05, 0x28, 0x75, 0x27, 0x95, 0x16, 0xB4, 0x15,
+  0xCA, 0xD9, 0xD8, 0xE9, 0xD4, 0x14, 0xD4, 0x14, 0xC5, 0x14, 0xC5, 0x24,
+  0xB4, 0x35, 0x95, 0x45, 0x66, 0x5F, 0x01, 0x7E, 0x9C, 0xD7, 0x70, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0D, 0xF0, 0x34, 0xF0, 0x24, 0xF0, 0x24, 0xF0,
+  0x34, 0xF0, 0x24, 0xF0, 0x33, 0xF0, 0x34, 0xF0, 0x24, 0xF0, 0x34, 0xF0,
+  0x24, 0xF0, 0x33, 0xF0, 0x34, 0xF0, 0x33, 0xF0, 0x34, 0xF0, 0x34, 0xF0,
+  0x24, 0xF0, 0x34, 0xF0, 0x24, 0xF0, 0x34, 0xF0, 0x25, 0xF0, 0x24, 0xF0,
+  0x34, 0xF0, 0x25, 0xF0, 0x24, 0xF0, 0x34, 0xF0, 0x34, 0xF0, 0x25, 0xF0,
+  0x24, 0xF0, 0x34, 0xF0, 0x34, 0xD0, 0x77, 0xDC, 0x9E, 0x7F, 0x01, 0x56,
+  0x66, 0x44, 0x95, 0x35, 0xA5, 0x24, 0xB5, 0x24, 0xC4, 0x24, 0xC4, 0x24,
+  0xC4, 0x25, 0xA5, 0x34, 0xA4, 0x45, 0x76, 0x5F, 0x01, 0x7D, 0xAC, 0x8F,
+  0x01, 0x56, 0x66, 0x35, 0xA5, 0x24, 0xC4, 0x15, 0xC9, 0xE8, 0xE8, 0xE8,
+  0xE8, 0xE9, 0xCA, 0xC4, 0x25, 0xA5, 0x26, 0x76, 0x4F, 0x03, 0x5F, 0x01,
+  0x8C, 0xC8, 0x70, 0x77, 0xDB, 0xAE, 0x7F, 0x01, 0x55, 0x75, 0x45, 0x95,
+  0x34, 0xB4, 0x25, 0xC4, 0x14, 0xD4, 0x14, 0xD4, 0x14, 0xD4, 0x14, 0xD9,
+  0xD9, 0xDA, 0xCA, 0xB6, 0x15, 0x97, 0x16, 0x78, 0x2F, 0x14, 0x3E, 0x14,
+  0x4B, 0x34, 0x76, 0x45, 0xF0, 0x24, 0xF0, 0x34, 0xF0, 0x34, 0xF0, 0x34,
+  0x24, 0xB5, 0x24, 0xB4, 0x34, 0xA5, 0x35, 0x85, 0x55, 0x66, 0x6F, 0x7E,
+  0xAB, 0xD6, 0x90, 0x0F, 0x0A, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0x0A, 0x0F,
+  0x0A, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0x0A, 0x23, 0x23, 0x23, 0x22, 0x23,
+  0x13, 0x22, 0x30, 0xF0, 0xF0, 0xD3, 0xF0, 0x35, 0xF0, 0x17, 0xD9, 0xC9,
+  0xB9, 0xC9, 0xC8, 0xC9, 0xD7, 0xF0, 0x15, 0xF0, 0x37, 0xF0, 0x28, 0xF0,
+  0x29, 0xF0, 0x19, 0xF0, 0x28, 0xF0, 0x29, 0xF0, 0x19, 0xF0, 0x28, 0xF0,
+  0x26, 0xF0, 0x53, 0xF0, 0x71, 0x0F, 0x0F, 0x0F, 0x0F, 0x09, 0xF0, 0xF0,
+  0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xAF, 0x0F, 0x0F, 0x0F, 0x09, 0x01, 0xF0,
+  0x73, 0xF0, 0x56, 0xF0, 0x28, 0xF0, 0x19, 0xF0, 0x29, 0xF0, 0x19, 0xF0,
+  0x28, 0xF0, 0x29, 0xF0, 0x19, 0xF0, 0x27, 0xF0, 0x35, 0xF0, 0x26, 0xE9,
+  0xC8, 0xD8, 0xC9, 0xC8, 0xC9, 0xC9, 0xE6, 0xF0, 0x24, 0xF0, 0x42, 0xF0,
+  0x60, 0x68, 0xAC, 0x6F, 0x5F, 0x01, 0x35, 0x76, 0x15, 0x95, 0x14, 0xB9,
+  0xB9, 0xC8, 0xC8, 0xB5, 0xF5, 0xF4, 0xF5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5,
+  0xE5, 0xF4, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xF0, 0x55, 0xF5, 0xF5, 0xF5, 0xF5, 0x80, 0xF0, 0x39, 0xF0, 0xFF, 0x02,
+  0xF0, 0x9F, 0x06, 0xF0, 0x5F, 0x0A, 0xF0, 0x28, 0xB8, 0xF6, 0xF0, 0x17,
+  0xD5, 0xF0, 0x56, 0xB5, 0xF0, 0x76, 0x95, 0xF0, 0x96, 0x75, 0xF0, 0xB5,
+  0x65, 0xB6, 0xB5, 0x54, 0xA9, 0x34, 0x44, 0x44, 0xAB, 0x24, 0x45, 0x34,
+  0x95, 0x48, 0x64, 0x24, 0x94, 0x86, 0x64, 0x24, 0x84, 0x96, 0x69, 0x85,
+  0xA4, 0x79, 0x84, 0xB4, 0x88, 0x75, 0xB4, 0x88, 0x74, 0xB4, 0x89, 0x74,
+  0xB4, 0x84, 0x14, 0x74, 0xB4, 0x84, 0x14, 0x65, 0xB4, 0x84, 0x14, 0x65,
+  0xA4, 0x85, 0x14, 0x65, 0xA4, 0x84, 0x24, 0x74, 0x95, 0x75, 0x24, 0x74,
+  0x85, 0x75, 0x35, 0x65, 0x75, 0x65, 0x54, 0x75, 0x48, 0x46, 0x55, 0x7B,
+  0x1D, 0x65, 0x89, 0x2B, 0x95, 0x86, 0x67, 0xC5, 0xF0, 0xF0, 0x86, 0xF0,
+  0xF0, 0x86, 0xF0, 0xF0, 0x87, 0xF0, 0xF0, 0x78, 0xF0, 0xF0, 0x79, 0x95,
+  0xF0, 0x6F, 0x07, 0xF0, 0x8F, 0x06, 0xF0, 0xAF, 0xF0, 0xF0, 0x44, 0xF0,
+  0x40, 0xC6, 0xF0, 0x87, 0xF0, 0x87, 0xF0, 0x88, 0xF0, 0x69, 0xF0, 0x64,
+  0x15, 0xF0, 0x54, 0x15, 0xF0, 0x45, 0x24, 0xF0, 0x44, 0x35, 0xF0, 0x25,
+  0x35, 0xF0, 0x25, 0x44, 0xF0, 0x24, 0x55, 0xF5, 0x55, 0xF4, 0x74, 0xF4,
+  0x75, 0xD5, 0x75, 0xD4, 0x94, 0xD4, 0x95, 0xB5, 0x95, 0xB4, 0xB4, 0xBF,
+  0x05, 0x9F, 0x06, 0x9F, 0x07, 0x7F, 0x08, 0x75, 0xD5, 0x74, 0xF5, 0x55,
+  0xF5, 0x55, 0xF5, 0x54, 0xF0, 0x25, 0x35, 0xF0, 0x25, 0x35, 0xF0, 0x25,
+  0x34, 0xF0, 0x45, 0x15, 0xF0, 0x45, 0x15, 0xF0, 0x54, 0x10, 0x0F, 0x03,
+  0x7F, 0x05, 0x5F, 0x06, 0x4F, 0x07, 0x34, 0xD6, 0x24, 0xE5, 0x24, 0xF5,
+  0x14, 0xF5, 0x14, 0xF5, 0x14, 0xF5, 0x14, 0xF5, 0x14, 0xF4, 0x24, 0xF4,
+  0x24, 0xE5, 0x24, 0xC6, 0x3F, 0x06, 0x4F, 0x04, 0x6F, 0x06, 0x4F, 0x08,
+  0x24, 0xE6, 0x14, 0xF5, 0x14, 0xF0, 0x19, 0xF0, 0x28, 0xF0, 0x28, 0xF0,
+  0x28, 0xF0, 0x28, 0xF0, 0x28, 0xF0, 0x19, 0xFA, 0xE6, 0x1F, 0x08, 0x2F,
+  0x07, 0x3F, 0x06, 0x4F, 0x04, 0x60, 0xB9, 0xF0, 0x2F, 0xDF, 0x02, 0xAF,
+  0x05, 0x87, 0x87, 0x75, 0xC6, 0x55, 0xE5, 0x45, 0xF0, 0x15, 0x35, 0xF0,
+  0x15, 0x25, 0xF0, 0x34, 0x25, 0xF0, 0x35, 0x14, 0xF0, 0x95, 0xF0, 0x95,
+  0xF0, 0x95, 0xF0, 0x94, 0xF0, 0xA4, 0xF0, 0xA4, 0xF0, 0xA4, 0xF0, 0xA4,
+  0xF0, 0xA4, 0xF0, 0xA4, 0xF0, 0xA5, 0xF0, 0x59, 0xF0, 0x54, 0x14, 0xF0,
+  0x45, 0x15, 0xF0, 0x35, 0x15, 0xF0, 0x35, 0x25, 0xF0, 0x15, 0x35, 0xF0,
+  0x15, 0x45, 0xE5, 0x57, 0xB6, 0x68, 0x77, 0x8F, 0x05, 0xBF, 0x02, 0xDF,
+  0xF0, 0x29, 0x90, 0x0F, 0x02, 0xAF, 0x04, 0x8F, 0x06, 0x6F, 0x07, 0x54,
+  0xC7, 0x44, 0xE6, 0x34, 0xF5, 0x34, 0xF0, 0x15, 0x24, 0xF0, 0x24, 0x24,
+  0xF0, 0x25, 0x14, 0xF0, 0x34, 0x14, 0xF0, 0x34, 0x14, 0xF0, 0x39, 0xF0,
+  0x39, 0xF0, 0x39, 0xF0, 0x39, 0xF0, 0x48, 0xF0, 0x48, 0xF0, 0x48, 0xF0,
+  0x39, 0xF0, 0x39, 0xF0, 0x39, 0xF0, 0x34, 0x14, 0xF0, 0x34, 0x14, 0xF0,
+  0x25, 0x14, 0xF0, 0x24, 0x24, 0xF0, 0x15, 0x24, 0xF6, 0x24, 0xE6, 0x34,
+  0xC7, 0x4F, 0x07, 0x5F, 0x06, 0x6F, 0x04, 0x8F, 0x02, 0xA0, 0x0F, 0x08,
+  0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x14, 0xF0, 0x54, 0xF0, 0x54, 0xF0,
+  0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0,
+  0x54, 0xF0, 0x54, 0xF0, 0x5F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08,
+  0x14, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0,
+  0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x5F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x06, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x06,
+  0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x44,
+  0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x4F, 0x05, 0x3F,
+  0x05, 0x3F, 0x05, 0x3F, 0x05, 0x34, 0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x44,
+  0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x44,
+  0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x40,
+  0xC9, 0xF0, 0x4F, 0xEF, 0x03, 0xCF, 0x06, 0x97, 0x88, 0x76, 0xC6, 0x66,
+  0xF5, 0x55, 0xF0, 0x25, 0x35, 0xF0, 0x35, 0x34, 0xF0, 0x54, 0x25, 0xF0,
+  0x55, 0x14, 0xF0, 0xC4, 0xF0, 0xB5, 0xF0, 0xB5, 0xF0, 0xB4, 0xF0, 0xC4,
+  0xF0, 0xC4, 0xDF, 0x03, 0xDF, 0x03, 0xDF, 0x03, 0xDF, 0x04, 0xF0, 0x79,
+  0xF0, 0x79, 0xF0, 0x74, 0x14, 0xF0, 0x74, 0x15, 0xF0, 0x64, 0x15, 0xF0,
+  0x55, 0x25, 0xF0, 0x45, 0x26, 0xF0, 0x26, 0x36, 0xF7, 0x46, 0xD8, 0x57,
+  0x86, 0x14, 0x6F, 0x04, 0x33, 0x7F, 0x02, 0x43, 0x9D, 0x63, 0xC7, 0xC0,
+  0x04, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0,
+  0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0,
+  0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x3F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x07, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38,
+  0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38,
+  0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x34, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x01, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5,
+  0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5,
+  0xE5, 0xE5, 0xE5, 0xE5, 0xE9, 0xA9, 0xA9, 0xA9, 0xA9, 0xAA, 0x94, 0x15,
+  0x85, 0x25, 0x66, 0x2F, 0x01, 0x4E, 0x6C, 0xA7, 0x60, 0x04, 0xF0, 0x25,
+  0x14, 0xF0, 0x15, 0x24, 0xF5, 0x34, 0xE5, 0x44, 0xD5, 0x54, 0xC5, 0x64,
+  0xB5, 0x74, 0xA5, 0x84, 0x95, 0x94, 0x85, 0xA4, 0x75, 0xB4, 0x65, 0xC4,
+  0x55, 0xD4, 0x45, 0xE4, 0x36, 0xE4, 0x28, 0xD4, 0x1A, 0xC9, 0x15, 0xC8,
+  0x35, 0xB7, 0x55, 0xA6, 0x66, 0x95, 0x85, 0x94, 0xA5, 0x84, 0xB5, 0x74,
+  0xB5, 0x74, 0xC5, 0x64, 0xD5, 0x54, 0xD5, 0x54, 0xE5, 0x44, 0xF5, 0x34,
+  0xF6, 0x24, 0xF0, 0x15, 0x24, 0xF0, 0x25, 0x14, 0xF0, 0x26, 0x04, 0xF0,
+  0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0,
+  0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0,
+  0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0,
+  0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0,
+  0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x2F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x09, 0x06, 0xF0, 0x5C, 0xF0, 0x4E, 0xF0, 0x3E, 0xF0,
+  0x3E, 0xF0, 0x2F, 0x01, 0xF0, 0x1F, 0x01, 0xF0, 0x1C, 0x13, 0xF4, 0x18,
+  0x14, 0xE4, 0x18, 0x14, 0xE4, 0x18, 0x23, 0xD4, 0x28, 0x24, 0xC4, 0x28,
+  0x24, 0xC3, 0x38, 0x33, 0xB4, 0x38, 0x34, 0xA4, 0x38, 0x34, 0xA3, 0x48,
+  0x43, 0x94, 0x48, 0x44, 0x84, 0x48, 0x44, 0x83, 0x58, 0x54, 0x64, 0x58,
+  0x54, 0x64, 0x58, 0x54, 0x63, 0x68, 0x64, 0x44, 0x68, 0x64, 0x44, 0x68,
+  0x64, 0x43, 0x78, 0x74, 0x24, 0x78, 0x74, 0x24, 0x78, 0x74, 0x23, 0x88,
+  0x88, 0x88, 0x88, 0x88, 0x87, 0x98, 0x96, 0x98, 0x96, 0x98, 0x95, 0xA4,
+  0x05, 0xF0, 0x2A, 0xF0, 0x2B, 0xF0, 0x1C, 0xFC, 0xFD, 0xEE, 0xD9, 0x14,
+  0xD9, 0x15, 0xC9, 0x25, 0xB9, 0x25, 0xB9, 0x35, 0xA9, 0x45, 0x99, 0x45,
+  0x99, 0x55, 0x89, 0x65, 0x79, 0x65, 0x79, 0x75, 0x69, 0x84, 0x69, 0x85,
+  0x59, 0x95, 0x49, 0xA4, 0x49, 0xA5, 0x39, 0xB5, 0x29, 0xB5, 0x29, 0xC5,
+  0x19, 0xDE, 0xDE, 0xED, 0xFC, 0xFC, 0xF0, 0x1B, 0xF0, 0x2A, 0xF0, 0x26,
+  0xC9, 0xF0, 0x6F, 0xF0, 0x1F, 0x03, 0xEF, 0x06, 0xB7, 0x88, 0x96, 0xD6,
+  0x76, 0xF6, 0x65, 0xF0, 0x25, 0x55, 0xF0, 0x45, 0x35, 0xF0, 0x55, 0x35,
+  0xF0, 0x65, 0x24, 0xF0, 0x75, 0x24, 0xF0, 0x84, 0x15, 0xF0, 0x84, 0x15,
+  0xF0, 0x89, 0xF0, 0x99, 0xF0, 0xA8, 0xF0, 0xA8, 0xF0, 0xA8, 0xF0, 0xA8,
+  0xF0, 0x9A, 0xF0, 0x8A, 0xF0, 0x8A, 0xF0, 0x84, 0x24, 0xF0, 0x75, 0x25,
+  0xF0, 0x65, 0x25, 0xF0, 0x55, 0x45, 0xF0, 0x45, 0x55, 0xF0, 0x25, 0x66,
+  0xF6, 0x76, 0xD6, 0x97, 0x88, 0xBF, 0x06, 0xDF, 0x03, 0xF0, 0x2F, 0xF0,
+  0x69, 0xC0, 0x0F, 0x03, 0x6F, 0x05, 0x4F, 0x07, 0x2F, 0x07, 0x24, 0xD6,
+  0x14, 0xEA, 0xF9, 0xF9, 0xF0, 0x18, 0xF0, 0x18, 0xF0, 0x18, 0xF0, 0x18,
+  0xF9, 0xF9, 0xEA, 0xC7, 0x1F, 0x07, 0x2F, 0x07, 0x2F, 0x05, 0x4F, 0x03,
+  0x64, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0,
+  0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0,
+  0x54, 0xF0, 0x54, 0xF0, 0x50, 0xC9, 0xF0, 0x6F, 0xF0, 0x1F, 0x03, 0xEF,
+  0x06, 0xB7, 0x88, 0x96, 0xD6, 0x76, 0xF6, 0x65, 0xF0, 0x25, 0x55, 0xF0,
+  0x45, 0x35, 0xF0, 0x55, 0x35, 0xF0, 0x65, 0x24, 0xF0, 0x75, 0x24, 0xF0,
+  0x84, 0x15, 0xF0, 0x8A, 0xF0, 0x89, 0xF0, 0x99, 0xF0, 0xA8, 0xF0, 0xA8,
+  0xF0, 0xA8, 0xF0, 0xA8, 0xF0, 0x9A, 0xF0, 0x8A, 0xF0, 0x8A, 0xF0, 0x84,
+  0x24, 0xF0, 0x75, 0x25, 0xE1, 0x65, 0x25, 0xE2, 0x45, 0x45, 0xC4, 0x35,
+  0x55, 0xBB, 0x66, 0xBA, 0x76, 0xC7, 0x97, 0x88, 0xBF, 0x09, 0xAF, 0x09,
+  0xBF, 0x26, 0xD9, 0x74, 0xF0, 0xF2, 0xF0, 0xF0, 0x50, 0x0F, 0x05, 0x7F,
+  0x07, 0x5F, 0x08, 0x4F, 0x09, 0x34, 0xF6, 0x24, 0xF0, 0x15, 0x24, 0xF0,
+  0x25, 0x14, 0xF0, 0x25, 0x14, 0xF0, 0x25, 0x14, 0xF0, 0x25, 0x14, 0xF0,
+  0x25, 0x14, 0xF0, 0x25, 0x14, 0xF0, 0x24, 0x24, 0xF0, 0x15, 0x24, 0xF5,
+  0x3F, 0x08, 0x4F, 0x06, 0x6F, 0x07, 0x5F, 0x08, 0x44, 0xE6, 0x34, 0xF0,
+  0x15, 0x24, 0xF0, 0x15, 0x24, 0xF0, 0x24, 0x24, 0xF0, 0x24, 0x24, 0xF0,
+  0x24, 0x24, 0xF0, 0x24, 0x24, 0xF0, 0x24, 0x24, 0xF0, 0x24, 0x24, 0xF0,
+  0x24, 0x24, 0xF0, 0x24, 0x24, 0xF0, 0x25, 0x14, 0xF0, 0x25, 0x14, 0xF0,
+  0x2A, 0xF0, 0x35, 0x99, 0xFF, 0xBF, 0x02, 0x9F, 0x04, 0x76, 0x96, 0x55,
+  0xD5, 0x45, 0xE4, 0x44, 0xF5, 0x25, 0xF0, 0x14, 0x25, 0xF0, 0x14, 0x25,
+  0xF0, 0x14, 0x25, 0xF0, 0x85, 0xF0, 0x76, 0xF0, 0x69, 0xF0, 0x4C, 0xF0,
+  0x1F, 0xEF, 0x01, 0xEE, 0xF0, 0x2C, 0xF0, 0x49, 0xF0, 0x66, 0xF0, 0x76,
+  0xF0, 0x79, 0xF0, 0x48, 0xF0, 0x49, 0xF0, 0x34, 0x14, 0xF0, 0x34, 0x15,
+  0xF0, 0x15, 0x15, 0xF0, 0x14, 0x35, 0xE5, 0x47, 0x96, 0x5F, 0x06, 0x8F,
+  0x03, 0xAF, 0x01, 0xEA, 0x80, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x03, 0xC4, 0xF0, 0x84, 0xF0, 0x84, 0xF0, 0x84, 0xF0, 0x84, 0xF0, 0x84,
+  0xF0, 0x84, 0xF0, 0x84, 0xF0, 0x84, 0xF0, 0x84, 0xF0, 0x84, 0xF0, 0x84,
+  0xF0, 0x84, 0xF0, 0x84, 0xF0, 0x84, 0xF0, 0x84, 0xF0, 0x84, 0xF0, 0x84,
+  0xF0, 0x84, 0xF0, 0x84, 0xF0, 0x84, 0xF0, 0x84, 0xF0, 0x84, 0xF0, 0x84,
+  0xF0, 0x84, 0xF0, 0x84, 0xF0, 0x84, 0xF0, 0x84, 0xF0, 0x84, 0xF0, 0x84,
+  0xB0, 0x04, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38,
+  0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38,
+  0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38,
+  0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38,
+  0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x39, 0xF0, 0x1A, 0xF0, 0x14, 0x25, 0xE5,
+  0x26, 0xC6, 0x37, 0x87, 0x5F, 0x05, 0x7F, 0x03, 0xAE, 0xE9, 0x90, 0x05,
+  0xF0, 0x44, 0x15, 0xF0, 0x35, 0x24, 0xF0, 0x35, 0x25, 0xF0, 0x24, 0x35,
+  0xF0, 0x15, 0x44, 0xF0, 0x15, 0x45, 0xF4, 0x55, 0xE5, 0x64, 0xE5, 0x65,
+  0xD4, 0x75, 0xC5, 0x84, 0xC5, 0x85, 0xB4, 0xA4, 0xA5, 0xA4, 0xA5, 0xA5,
+  0x94, 0xC4, 0x94, 0xC5, 0x74, 0xD5, 0x74, 0xE4, 0x74, 0xE5, 0x54, 0xF5,
+  0x54, 0xF0, 0x14, 0x54, 0xF0, 0x15, 0x34, 0xF0, 0x34, 0x34, 0xF0, 0x34,
+  0x34, 0xF0, 0x35, 0x14, 0xF0, 0x54, 0x14, 0xF0, 0x54, 0x14, 0xF0, 0x58,
+  0xF0, 0x77, 0xF0, 0x77, 0xF0, 0x76, 0xF0, 0x95, 0xC0, 0x05, 0xD6, 0xDA,
+  0xD6, 0xDA, 0xD6, 0xD5, 0x14, 0xD6, 0xD4, 0x25, 0xB8, 0xB5, 0x25, 0xB8,
+  0xB5, 0x25, 0xB8, 0xB5, 0x34, 0xB8, 0xB4, 0x45, 0x94, 0x24, 0xA4, 0x45,
+  0x94, 0x24, 0x95, 0x45, 0x94, 0x24, 0x95, 0x54, 0x84, 0x35, 0x84, 0x65,
+  0x74, 0x44, 0x84, 0x65, 0x74, 0x44, 0x75, 0x65, 0x74, 0x44, 0x75, 0x74,
+  0x64, 0x64, 0x64, 0x84, 0x64, 0x64, 0x64, 0x85, 0x54, 0x64, 0x55, 0x85,
+  0x54, 0x65, 0x45, 0x94, 0x44, 0x84, 0x44, 0xA4, 0x44, 0x84, 0x44, 0xA5,
+  0x34, 0x84, 0x44, 0xA5, 0x24, 0xA4, 0x25, 0xB4, 0x24, 0xA4, 0x24, 0xC4,
+  0x24, 0xA4, 0x24, 0xC5, 0x14, 0xA5, 0x14, 0xD8, 0xC9, 0xD8, 0xC8, 0xE8,
+  0xC8, 0xE8, 0xD7, 0xF6, 0xE7, 0xF6, 0xE6, 0xF0, 0x16, 0xE6, 0xF0, 0x15,
+  0xF0, 0x15, 0x80, 0x15, 0xF0, 0x25, 0x26, 0xF6, 0x35, 0xF5, 0x55, 0xD5,
+  0x75, 0xB5, 0x85, 0xB5, 0x95, 0x95, 0xB5, 0x75, 0xC5, 0x75, 0xD5, 0x55,
+  0xF5, 0x35, 0xF0, 0x15, 0x35, 0xF0, 0x25, 0x15, 0xF0, 0x49, 0xF0, 0x58,
+  0xF0, 0x77, 0xF0, 0x85, 0xF0, 0x87, 0xF0, 0x68, 0xF0, 0x69, 0xF0, 0x45,
+  0x15, 0xF0, 0x25, 0x25, 0xF0, 0x25, 0x35, 0xF5, 0x55, 0xD5, 0x66, 0xC5,
+  0x75, 0xB5, 0x95, 0x95, 0xA6, 0x85, 0xB5, 0x75, 0xD5, 0x55, 0xE6, 0x36,
+  0xF5, 0x35, 0xF0, 0x25, 0x15, 0xF0, 0x36, 0x05, 0xF0, 0x55, 0x15, 0xF0,
+  0x35, 0x26, 0xF0, 0x16, 0x35, 0xF0, 0x15, 0x55, 0xE5, 0x65, 0xE5, 0x75,
+  0xC5, 0x86, 0xA5, 0xA5, 0xA5, 0xB5, 0x85, 0xC6, 0x75, 0xD5, 0x65, 0xF5,
+  0x54, 0xF0, 0x15, 0x45, 0xF0, 0x25, 0x25, 0xF0, 0x45, 0x15, 0xF0, 0x4A,
+  0xF0, 0x68, 0xF0, 0x78, 0xF0, 0x86, 0xF0, 0xA4, 0xF0, 0xB4, 0xF0, 0xB4,
+  0xF0, 0xB4, 0xF0, 0xB4, 0xF0, 0xB4, 0xF0, 0xB4, 0xF0, 0xB4, 0xF0, 0xB4,
+  0xF0, 0xB4, 0xF0, 0xB4, 0xF0, 0xB4, 0xF0, 0xB4, 0xF0, 0xB4, 0xD0, 0x2F,
+  0x09, 0x2F, 0x09, 0x2F, 0x09, 0x2F, 0x09, 0xF0, 0x56, 0xF0, 0x55, 0xF0,
+  0x55, 0xF0, 0x56, 0xF0, 0x46, 0xF0, 0x55, 0xF0, 0x55, 0xF0, 0x55, 0xF0,
+  0x56, 0xF0, 0x46, 0xF0, 0x55, 0xF0, 0x55, 0xF0, 0x56, 0xF0, 0x46, 0xF0,
+  0x55, 0xF0, 0x55, 0xF0, 0x55, 0xF0, 0x56, 0xF0, 0x46, 0xF0, 0x55, 0xF0,
+  0x55, 0xF0, 0x56, 0xF0, 0x46, 0xF0, 0x46, 0xF0, 0x55, 0xF0, 0x55, 0xF0,
+  0x5F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0E, 0x0F, 0x0F, 0x01, 0x54, 0x54,
+  0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
+  0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
+  0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x5F,
+  0x0C, 0x02, 0xB3, 0xA3, 0xB2, 0xB3, 0xA3, 0xB2, 0xB3, 0xA3, 0xB2, 0xB3,
+  0xA3, 0xB2, 0xB3, 0xA3, 0xB2, 0xB2, 0xB3, 0xA3, 0xB2, 0xB3, 0xA3, 0xB2,
+  0xB3, 0xA3, 0xB2, 0xB3, 0xA3, 0xB2, 0xB3, 0xA3, 0xB2, 0xB3, 0xA3, 0xB2,
+  0x0F, 0x0C, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
+  0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
+  0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
+  0x54, 0x54, 0x54, 0x5F, 0x0F, 0x01, 0x74, 0xE4, 0xD6, 0xC6, 0xB8, 0xA3,
+  0x23, 0xA3, 0x23, 0x93, 0x34, 0x83, 0x43, 0x74, 0x44, 0x63, 0x63, 0x63,
+  0x63, 0x53, 0x83, 0x43, 0x83, 0x34, 0x84, 0x23, 0xA3, 0x23, 0xA3, 0x13,
+  0xC3, 0x0F, 0x0F, 0x0F, 0x0B, 0x15, 0x64, 0x74, 0x74, 0x73, 0x83, 0x83,
+  0x79, 0xDD, 0xAF, 0x8F, 0x02, 0x65, 0x85, 0x64, 0xA4, 0x64, 0xB4, 0x45,
+  0xB4, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x45, 0xEA, 0x9F, 0x6F, 0x03, 0x5B,
+  0x44, 0x47, 0x94, 0x45, 0xB4, 0x44, 0xC4, 0x35, 0xC4, 0x34, 0xC5, 0x35,
+  0xB5, 0x44, 0xA6, 0x45, 0x87, 0x48, 0x1C, 0x4E, 0x17, 0x3B, 0x37, 0x57,
+  0x75, 0x04, 0xF0, 0x34, 0xF0, 0x34, 0xF0, 0x34, 0xF0, 0x34, 0xF0, 0x34,
+  0xF0, 0x34, 0xF0, 0x34, 0xF0, 0x34, 0x47, 0x74, 0x2B, 0x54, 0x1D, 0x4F,
+  0x04, 0x38, 0x66, 0x26, 0x95, 0x25, 0xB5, 0x15, 0xB5, 0x15, 0xC4, 0x14,
+  0xD9, 0xD9, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xD9, 0xD4, 0x14, 0xD4, 0x15,
+  0xB5, 0x16, 0xA5, 0x16, 0x95, 0x28, 0x65, 0x33, 0x1F, 0x33, 0x2D, 0x43,
+  0x3B, 0xD6, 0x80, 0x87, 0xCB, 0x8E, 0x7F, 0x55, 0x75, 0x35, 0x94, 0x34,
+  0xA5, 0x15, 0xB4, 0x14, 0xC4, 0x14, 0xF0, 0x24, 0xF0, 0x15, 0xF0, 0x15,
+  0xF0, 0x14, 0xF0, 0x24, 0xF0, 0x25, 0xF0, 0x24, 0xF0, 0x24, 0xC4, 0x14,
+  0xC4, 0x15, 0xB4, 0x24, 0xA5, 0x25, 0x94, 0x45, 0x75, 0x4F, 0x01, 0x6E,
+  0x9B, 0xC7, 0x60, 0xF0, 0x43, 0xF0, 0x43, 0xF0, 0x43, 0xF0, 0x43, 0xF0,
+  0x43, 0xF0, 0x43, 0xF0, 0x43, 0xF0, 0x43, 0x86, 0x53, 0x6A, 0x33, 0x4D,
+  0x23, 0x3F, 0x13, 0x36, 0x67, 0x25, 0x96, 0x24, 0xB5, 0x15, 0xB5, 0x14,
+  0xD4, 0x14, 0xD4, 0x14, 0xD9, 0xD8, 0xE8, 0xF8, 0xE8, 0xD4, 0x14, 0xD4,
+  0x14, 0xD4, 0x14, 0xD4, 0x15, 0xB5, 0x24, 0xB5, 0x25, 0x96, 0x35, 0x77,
+  0x3F, 0x13, 0x4E, 0x13, 0x6A, 0x33, 0x87, 0x70, 0x87, 0xEB, 0xBE, 0x8F,
+  0x01, 0x65, 0x75, 0x55, 0x95, 0x44, 0xB4, 0x35, 0xB5, 0x24, 0xD4, 0x24,
+  0xD4, 0x24, 0xD4, 0x24, 0xD4, 0x1F, 0x0F, 0x0F, 0x0F, 0x0E, 0xF0, 0x44,
+  0xF0, 0x44, 0xF0, 0x44, 0xD4, 0x24, 0xD4, 0x34, 0xB5, 0x35, 0x95, 0x55,
+  0x76, 0x5F, 0x02, 0x7F, 0xAC, 0xD7, 0x80, 0x65, 0x56, 0x47, 0x36, 0x54,
+  0x74, 0x74, 0x74, 0x74, 0x4F, 0x0F, 0x03, 0x34, 0x74, 0x74, 0x74, 0x74,
+  0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
+  0x74, 0x74, 0x74, 0x74, 0x74, 0x40, 0x86, 0xEA, 0x24, 0x4D, 0x14, 0x4F,
+  0x03, 0x35, 0x68, 0x25, 0x96, 0x24, 0xA6, 0x15, 0xB5, 0x14, 0xC5, 0x14,
+  0xD4, 0x14, 0xD9, 0xD8, 0xE8, 0xE9, 0xD9, 0xD4, 0x14, 0xD4, 0x14, 0xD4,
+  0x14, 0xC5, 0x15, 0xB5, 0x24, 0xA6, 0x25, 0x96, 0x35, 0x68, 0x3E, 0x14,
+  0x4C, 0x24, 0x69, 0x34, 0x76, 0x54, 0xF0, 0x34, 0xF0, 0x33, 0x24, 0xC4,
+  0x25, 0xB4, 0x35, 0x94, 0x46, 0x66, 0x5F, 0x01, 0x7E, 0xAA, 0x60, 0x04,
+  0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0x47, 0x44, 0x2B, 0x24,
+  0x1D, 0x1A, 0x1F, 0x7B, 0x99, 0xA9, 0xA8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8,
+  0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8,
+  0xB4, 0x0F, 0x05, 0xF0, 0x1F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0A, 0x44,
+  0x44, 0x44, 0x44, 0x44, 0xF0, 0xF0, 0x64, 0x44, 0x44, 0x44, 0x44, 0x44,
+  0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+  0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+  0x44, 0x3F, 0x05, 0x16, 0x20, 0x04, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24,
+  0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24,
+  0xA5, 0x24, 0x95, 0x34, 0x85, 0x44, 0x75, 0x54, 0x65, 0x64, 0x55, 0x74,
+  0x45, 0x84, 0x35, 0x94, 0x25, 0xA4, 0x16, 0xAC, 0x97, 0x14, 0x96, 0x25,
+  0x86, 0x35, 0x75, 0x45, 0x74, 0x65, 0x64, 0x74, 0x64, 0x75, 0x54, 0x85,
+  0x44, 0x85, 0x44, 0x95, 0x34, 0xA5, 0x24, 0xA5, 0x24, 0xB5, 0x14, 0xC4,
+  0x10, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x01, 0x86,
+  0x86, 0x43, 0x3A, 0x4A, 0x23, 0x2C, 0x2C, 0x13, 0x15, 0x17, 0x15, 0x1E,
+  0x78, 0x6A, 0x87, 0x89, 0x95, 0x98, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8,
+  0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8,
+  0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8,
+  0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA4, 0x96, 0x43, 0x4A, 0x23,
+  0x3C, 0x13, 0x25, 0x1B, 0x13, 0x7B, 0x99, 0xA9, 0xA8, 0xC7, 0xC7, 0xC7,
+  0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7,
+  0xC7, 0xC7, 0xC3, 0x87, 0xEB, 0xAF, 0x7F, 0x02, 0x65, 0x75, 0x55, 0x95,
+  0x44, 0xB4, 0x35, 0xB5, 0x24, 0xD4, 0x24, 0xD4, 0x24, 0xD4, 0x15, 0xD9,
+  0xF8, 0xF9, 0xE9, 0xD5, 0x14, 0xD4, 0x24, 0xD4, 0x24, 0xD4, 0x25, 0xB5,
+  0x34, 0xB4, 0x45, 0x95, 0x55, 0x75, 0x6F, 0x02, 0x7F, 0xAB, 0xE7, 0x80,
+  0x96, 0x73, 0x4A, 0x53, 0x2D, 0x43, 0x1F, 0x33, 0x14, 0x66, 0x26, 0x95,
+  0x26, 0xA5, 0x15, 0xB5, 0x15, 0xC4, 0x14, 0xD4, 0x14, 0xD9, 0xE8, 0xE8,
+  0xE8, 0xE8, 0xE8, 0xD9, 0xDA, 0xC4, 0x15, 0xB5, 0x16, 0xA5, 0x16, 0x95,
+  0x28, 0x66, 0x2F, 0x04, 0x34, 0x1D, 0x44, 0x2B, 0x54, 0x47, 0x74, 0xF0,
+  0x34, 0xF0, 0x34, 0xF0, 0x34, 0xF0, 0x34, 0xF0, 0x34, 0xF0, 0x34, 0xF0,
+  0x34, 0xF0, 0x34, 0xF0, 0x30, 0x86, 0xEA, 0x33, 0x4D, 0x23, 0x4E, 0x13,
+  0x36, 0x67, 0x25, 0x96, 0x24, 0xB5, 0x15, 0xB5, 0x14, 0xD4, 0x14, 0xD4,
+  0x14, 0xD9, 0xD8, 0xE8, 0xF8, 0xE8, 0xD4, 0x14, 0xD4, 0x14, 0xD4, 0x14,
+  0xD4, 0x15, 0xB5, 0x24, 0xB5, 0x25, 0x96, 0x26, 0x77, 0x3F, 0x13, 0x4D,
+  0x23, 0x5B, 0x33, 0x77, 0x53, 0xF0, 0x43, 0xF0, 0x43, 0xF0, 0x43, 0xF0,
+  0x43, 0xF0, 0x43, 0xF0, 0x43, 0xF0, 0x43, 0xF0, 0x43, 0xF0, 0x43, 0x87,
+  0x39, 0x2A, 0x2A, 0x15, 0x36, 0x65, 0x75, 0x74, 0x84, 0x84, 0x84, 0x84,
+  0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84,
+  0x84, 0x80, 0x67, 0xBC, 0x6F, 0x4F, 0x02, 0x35, 0x75, 0x25, 0x94, 0x24,
+  0xA4, 0x24, 0xA5, 0x14, 0xF0, 0x15, 0xF0, 0x16, 0xEA, 0xBC, 0xAD, 0x9C,
+  0xC9, 0xE6, 0xF0, 0x14, 0x14, 0xB9, 0xB9, 0xB4, 0x15, 0xA4, 0x16, 0x85,
+  0x2F, 0x02, 0x4F, 0x6D, 0x98, 0x70, 0x34, 0x74, 0x74, 0x74, 0x74, 0x74,
+  0x74, 0x4F, 0x0F, 0x03, 0x34, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
+  0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x76,
+  0x11, 0x38, 0x47, 0x56, 0x04, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7,
+  0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xB8, 0xB8, 0xB8, 0xB8,
+  0xA9, 0x9B, 0x77, 0x17, 0x16, 0x13, 0x1D, 0x23, 0x2B, 0x33, 0x47, 0x80,
+  0x14, 0xD5, 0x14, 0xD4, 0x25, 0xC4, 0x34, 0xB5, 0x34, 0xB4, 0x45, 0xA4,
+  0x54, 0x94, 0x64, 0x94, 0x65, 0x75, 0x74, 0x74, 0x84, 0x74, 0x85, 0x54,
+  0xA4, 0x54, 0xA4, 0x54, 0xA5, 0x34, 0xC4, 0x34, 0xC4, 0x34, 0xD4, 0x14,
+  0xE4, 0x14, 0xE4, 0x13, 0xF0, 0x17, 0xF0, 0x17, 0xF0, 0x16, 0xF0, 0x35,
+  0xF0, 0x35, 0x90, 0x14, 0x95, 0xA4, 0x14, 0x96, 0x94, 0x14, 0x96, 0x85,
+  0x15, 0x86, 0x84, 0x34, 0x77, 0x84, 0x34, 0x78, 0x74, 0x34, 0x78, 0x65,
+  0x44, 0x63, 0x14, 0x64, 0x54, 0x54, 0x23, 0x64, 0x54, 0x54, 0x24, 0x54,
+  0x55, 0x44, 0x24, 0x44, 0x74, 0x43, 0x34, 0x44, 0x74, 0x34, 0x43, 0x44,
+  0x74, 0x34, 0x44, 0x34, 0x84, 0x24, 0x44, 0x24, 0x94, 0x23, 0x54, 0x24,
+  0x94, 0x23, 0x63, 0x24, 0x94, 0x14, 0x64, 0x13, 0xB8, 0x68, 0xB7, 0x78,
+  0xB7, 0x87, 0xC6, 0x86, 0xD6, 0x86, 0xD5, 0x96, 0xD5, 0xA4, 0x70, 0x15,
+  0xB4, 0x34, 0xA5, 0x44, 0x94, 0x55, 0x74, 0x74, 0x65, 0x84, 0x54, 0x95,
+  0x34, 0xB4, 0x25, 0xC4, 0x14, 0xD8, 0xF6, 0xF0, 0x25, 0xF0, 0x25, 0xF0,
+  0x16, 0xF0, 0x17, 0xE9, 0xC4, 0x24, 0xC4, 0x25, 0xA4, 0x45, 0x85, 0x54,
+  0x84, 0x65, 0x64, 0x85, 0x45, 0x94, 0x35, 0xA5, 0x24, 0xC5, 0x14, 0xD4,
+  0x14, 0xC4, 0x24, 0xC4, 0x34, 0xB4, 0x34, 0xA4, 0x44, 0xA4, 0x54, 0x85,
+  0x54, 0x84, 0x64, 0x84, 0x74, 0x65, 0x74, 0x64, 0x84, 0x64, 0x94, 0x44,
+  0xA4, 0x44, 0xA4, 0x44, 0xB4, 0x24, 0xC4, 0x24, 0xC4, 0x24, 0xD8, 0xE8,
+  0xE7, 0xF0, 0x16, 0xF0, 0x16, 0xF0, 0x15, 0xF0, 0x34, 0xF0, 0x34, 0xF0,
+  0x24, 0xF0, 0x34, 0xF0, 0x25, 0xF0, 0x24, 0xF0, 0x25, 0xD8, 0xE8, 0xE7,
+  0xF5, 0xF0, 0x1F, 0x04, 0x1F, 0x04, 0x1F, 0x04, 0xF5, 0xE5, 0xE5, 0xF4,
+  0xF5, 0xE5, 0xE5, 0xE5, 0xF4, 0xF5, 0xE5, 0xE5, 0xE5, 0xE5, 0xF4, 0xF5,
+  0xE5, 0xE5, 0xE5, 0xFF, 0x0F, 0x0F, 0x0F, 0x65, 0x56, 0x47, 0x44, 0x73,
+  0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x74,
+  0x74, 0x74, 0x55, 0x55, 0x64, 0x75, 0x75, 0x74, 0x84, 0x74, 0x83, 0x83,
+  0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x84,
+  0x77, 0x56, 0x65, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0C,
+  0x04, 0x76, 0x56, 0x84, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
+  0x74, 0x74, 0x74, 0x74, 0x83, 0x83, 0x84, 0x84, 0x85, 0x74, 0x65, 0x55,
+  0x54, 0x74, 0x73, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
+  0x74, 0x74, 0x74, 0x74, 0x65, 0x46, 0x56, 0x54, 0x70, 0x25, 0xE7, 0x93,
+  0x19, 0x77, 0x26, 0x56, 0x46, 0x36, 0x7A, 0x12, 0x89, 0xD6, 0x20, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x01, 0xF0, 0xB8, 0xB4, 0xB8, 0x8A,
+  0x88, 0x6E, 0x68, 0x5F, 0x01, 0x58, 0x46, 0x66, 0x48, 0x44, 0x95, 0x48,
+  0x35, 0xA5, 0x38, 0x34, 0xC4, 0x38, 0x34, 0xC4, 0x38, 0x34, 0xC4, 0x38,
+  0x34, 0xC4, 0x38, 0xF0, 0x35, 0x38, 0xF0, 0x35, 0x38, 0xF0, 0x25, 0x48,
+  0xF0, 0x15, 0x58, 0xF6, 0x58, 0xE6, 0x68, 0xD6, 0x78, 0xC5, 0x98, 0xB5,
+  0xA8, 0xB5, 0xA8, 0xB4, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xA5,
+  0xB8, 0xF0, 0xB8, 0xF0, 0xB8, 0xF0, 0xB8, 0xF0, 0xB8, 0xA5, 0xB8, 0xA5,
+  0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xF0, 0xB8, 0xF0, 0xBF, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x01, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x01, 0xF0, 0xB8, 0xB4, 0xB8, 0x8A, 0x88, 0x6E, 0x68, 0x5F, 0x01,
+  0x58, 0x46, 0x66, 0x48, 0x44, 0x95, 0x48, 0x35, 0xA5, 0x38, 0x34, 0xC4,
+  0x38, 0x34, 0xC4, 0x38, 0x34, 0xC4, 0x38, 0x34, 0xC4, 0x38, 0xF0, 0x35,
+  0x38, 0xF0, 0x35, 0x38, 0xF0, 0x25, 0x48, 0xF0, 0x15, 0x58, 0xF6, 0x58,
+  0xE6, 0x68, 0xD6, 0x78, 0xC5, 0x98, 0xB5, 0xA8, 0xB5, 0xA8, 0xB4, 0xB8,
+  0xA5, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xF0, 0xB8, 0xF0, 0xB8,
+  0xF0, 0xB8, 0xF0, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8,
+  0xA5, 0xB8, 0xF0, 0xB8, 0xF0, 0xBF, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x01, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x01, 0xF0, 0xB8, 0xB4,
+  0xB8, 0x8A, 0x88, 0x6E, 0x68, 0x5F, 0x01, 0x58, 0x46, 0x66, 0x48, 0x44,
+  0x95, 0x48, 0x35, 0xA5, 0x38, 0x34, 0xC4, 0x38, 0x34, 0xC4, 0x38, 0x34,
+  0xC4, 0x38, 0x34, 0xC4, 0x38, 0xF0, 0x35, 0x38, 0xF0, 0x35, 0x38, 0xF0,
+  0x25, 0x48, 0xF0, 0x15, 0x58, 0xF6, 0x58, 0xE6, 0x68, 0xD6, 0x78, 0xC5,
+  0x98, 0xB5, 0xA8, 0xB5, 0xA8, 0xB4, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xA5,
+  0xB8, 0xA5, 0xB8, 0xF0, 0xB8, 0xF0, 0xB8, 0xF0, 0xB8, 0xF0, 0xB8, 0xA5,
+  0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xF0, 0xB8, 0xF0,
+  0xBF, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x01, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x01, 0xF0, 0xB8, 0xB4, 0xB8, 0x8A, 0x88, 0x6E, 0x68,
+  0x5F, 0x01, 0x58, 0x46, 0x66, 0x48, 0x44, 0x95, 0x48, 0x35, 0xA5, 0x38,
+  0x34, 0xC4, 0x38, 0x34, 0xC4, 0x38, 0x34, 0xC4, 0x38, 0x34, 0xC4, 0x38,
+  0xF0, 0x35, 0x38, 0xF0, 0x35, 0x38, 0xF0, 0x25, 0x48, 0xF0, 0x15, 0x58,
+  0xF6, 0x58, 0xE6, 0x68, 0xD6, 0x78, 0xC5, 0x98, 0xB5, 0xA8, 0xB5, 0xA8,
+  0xB4, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xF0, 0xB8,
+  0xF0, 0xB8, 0xF0, 0xB8, 0xF0, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8,
+  0xA5, 0xB8, 0xA5, 0xB8, 0xF0, 0xB8, 0xF0, 0xBF, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x01, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x01, 0xF0,
+  0xB8, 0xB4, 0xB8, 0x8A, 0x88, 0x6E, 0x68, 0x5F, 0x01, 0x58, 0x46, 0x66,
+  0x48, 0x44, 0x95, 0x48, 0x35, 0xA5, 0x38, 0x34, 0xC4, 0x38, 0x34, 0xC4,
+  0x38, 0x34, 0xC4, 0x38, 0x34, 0xC4, 0x38, 0xF0, 0x35, 0x38, 0xF0, 0x35,
+  0x38, 0xF0, 0x25, 0x48, 0xF0, 0x15, 0x58, 0xF6, 0x58, 0xE6, 0x68, 0xD6,
+  0x78, 0xC5, 0x98, 0xB5, 0xA8, 0xB5, 0xA8, 0xB4, 0xB8, 0xA5, 0xB8, 0xA5,
+  0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xF0, 0xB8, 0xF0, 0xB8, 0xF0, 0xB8, 0xF0,
+  0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xF0,
+  0xB8, 0xF0, 0xBF, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x01, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x01, 0xF0, 0xB8, 0xB4, 0xB8, 0x8A, 0x88,
+  0x6E, 0x68, 0x5F, 0x01, 0x58, 0x46, 0x66, 0x48, 0x44, 0x95, 0x48, 0x35,
+  0xA5, 0x38, 0x34, 0xC4, 0x38, 0x34, 0xC4, 0x38, 0x34, 0xC4, 0x38, 0x34,
+  0xC4, 0x38, 0xF0, 0x35, 0x38, 0xF0, 0x35, 0x38, 0xF0, 0x25, 0x48, 0xF0,
+  0x15, 0x58, 0xF6, 0x58, 0xE6, 0x68, 0xD6, 0x78, 0xC5, 0x98, 0xB5, 0xA8,
+  0xB5, 0xA8, 0xB4, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8,
+  0xF0, 0xB8, 0xF0, 0xB8, 0xF0, 0xB8, 0xF0, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8,
+  0xA5, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xF0, 0xB8, 0xF0, 0xBF, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x01, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x01, 0xF0, 0xB8, 0xB4, 0xB8, 0x8A, 0x88, 0x6E, 0x68, 0x5F, 0x01, 0x58,
+  0x46, 0x66, 0x48, 0x44, 0x95, 0x48, 0x35, 0xA5, 0x38, 0x34, 0xC4, 0x38,
+  0x34, 0xC4, 0x38, 0x34, 0xC4, 0x38, 0x34, 0xC4, 0x38, 0xF0, 0x35, 0x38,
+  0xF0, 0x35, 0x38, 0xF0, 0x25, 0x48, 0xF0, 0x15, 0x58, 0xF6, 0x58, 0xE6,
+  0x68, 0xD6, 0x78, 0xC5, 0x98, 0xB5, 0xA8, 0xB5, 0xA8, 0xB4, 0xB8, 0xA5,
+  0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xF0, 0xB8, 0xF0, 0xB8, 0xF0,
+  0xB8, 0xF0, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xA5,
+  0xB8, 0xF0, 0xB8, 0xF0, 0xBF, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x01,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x01, 0xF0, 0xB8, 0xB4, 0xB8,
+  0x8A, 0x88, 0x6E, 0x68, 0x5F, 0x01, 0x58, 0x46, 0x66, 0x48, 0x44, 0x95,
+  0x48, 0x35, 0xA5, 0x38, 0x34, 0xC4, 0x38, 0x34, 0xC4, 0x38, 0x34, 0xC4,
+  0x38, 0x34, 0xC4, 0x38, 0xF0, 0x35, 0x38, 0xF0, 0x35, 0x38, 0xF0, 0x25,
+  0x48, 0xF0, 0x15, 0x58, 0xF6, 0x58, 0xE6, 0x68, 0xD6, 0x78, 0xC5, 0x98,
+  0xB5, 0xA8, 0xB5, 0xA8, 0xB4, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8,
+  0xA5, 0xB8, 0xF0, 0xB8, 0xF0, 0xB8, 0xF0, 0xB8, 0xF0, 0xB8, 0xA5, 0xB8,
+  0xA5, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xF0, 0xB8, 0xF0, 0xBF,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x01, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x01, 0xF0, 0xB8, 0xB4, 0xB8, 0x8A, 0x88, 0x6E, 0x68, 0x5F,
+  0x01, 0x58, 0x46, 0x66, 0x48, 0x44, 0x95, 0x48, 0x35, 0xA5, 0x38, 0x34,
+  0xC4, 0x38, 0x34, 0xC4, 0x38, 0x34, 0xC4, 0x38, 0x34, 0xC4, 0x38, 0xF0,
+  0x35, 0x38, 0xF0, 0x35, 0x38, 0xF0, 0x25, 0x48, 0xF0, 0x15, 0x58, 0xF6,
+  0x58, 0xE6, 0x68, 0xD6, 0x78, 0xC5, 0x98, 0xB5, 0xA8, 0xB5, 0xA8, 0xB4,
+  0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xF0, 0xB8, 0xF0,
+  0xB8, 0xF0, 0xB8, 0xF0, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xA5,
+  0xB8, 0xA5, 0xB8, 0xF0, 0xB8, 0xF0, 0xBF, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x01, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x01, 0xF0, 0xB8,
+  0xB4, 0xB8, 0x8A, 0x88, 0x6E, 0x68, 0x5F, 0x01, 0x58, 0x46, 0x66, 0x48,
+  0x44, 0x95, 0x48, 0x35, 0xA5, 0x38, 0x34, 0xC4, 0x38, 0x34, 0xC4, 0x38,
+  0x34, 0xC4, 0x38, 0x34, 0xC4, 0x38, 0xF0, 0x35, 0x38, 0xF0, 0x35, 0x38,
+  0xF0, 0x25, 0x48, 0xF0, 0x15, 0x58, 0xF6, 0x58, 0xE6, 0x68, 0xD6, 0x78,
+  0xC5, 0x98, 0xB5, 0xA8, 0xB5, 0xA8, 0xB4, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8,
+  0xA5, 0xB8, 0xA5, 0xB8, 0xF0, 0xB8, 0xF0, 0xB8, 0xF0, 0xB8, 0xF0, 0xB8,
+  0xA5, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xF0, 0xB8,
+  0xF0, 0xBF, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x01, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x01, 0xF0, 0xB8, 0xB4, 0xB8, 0x8A, 0x88, 0x6E,
+  0x68, 0x5F, 0x01, 0x58, 0x46, 0x66, 0x48, 0x44, 0x95, 0x48, 0x35, 0xA5,
+  0x38, 0x34, 0xC4, 0x38, 0x34, 0xC4, 0x38, 0x34, 0xC4, 0x38, 0x34, 0xC4,
+  0x38, 0xF0, 0x35, 0x38, 0xF0, 0x35, 0x38, 0xF0, 0x25, 0x48, 0xF0, 0x15,
+  0x58, 0xF6, 0x58, 0xE6, 0x68, 0xD6, 0x78, 0xC5, 0x98, 0xB5, 0xA8, 0xB5,
+  0xA8, 0xB4, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xF0,
+  0xB8, 0xF0, 0xB8, 0xF0, 0xB8, 0xF0, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xA5,
+  0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xF0, 0xB8, 0xF0, 0xBF, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x01, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x01,
+  0xF0, 0xB8, 0xB4, 0xB8, 0x8A, 0x88, 0x6E, 0x68, 0x5F, 0x01, 0x58, 0x46,
+  0x66, 0x48, 0x44, 0x95, 0x48, 0x35, 0xA5, 0x38, 0x34, 0xC4, 0x38, 0x34,
+  0xC4, 0x38, 0x34, 0xC4, 0x38, 0x34, 0xC4, 0x38, 0xF0, 0x35, 0x38, 0xF0,
+  0x35, 0x38, 0xF0, 0x25, 0x48, 0xF0, 0x15, 0x58, 0xF6, 0x58, 0xE6, 0x68,
+  0xD6, 0x78, 0xC5, 0x98, 0xB5, 0xA8, 0xB5, 0xA8, 0xB4, 0xB8, 0xA5, 0xB8,
+  0xA5, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xF0, 0xB8, 0xF0, 0xB8, 0xF0, 0xB8,
+  0xF0, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8,
+  0xF0, 0xB8, 0xF0, 0xBF, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x01, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x01, 0xF0, 0xB8, 0xB4, 0xB8, 0x8A,
+  0x88, 0x6E, 0x68, 0x5F, 0x01, 0x58, 0x46, 0x66, 0x48, 0x44, 0x95, 0x48,
+  0x35, 0xA5, 0x38, 0x34, 0xC4, 0x38, 0x34, 0xC4, 0x38, 0x34, 0xC4, 0x38,
+  0x34, 0xC4, 0x38, 0xF0, 0x35, 0x38, 0xF0, 0x35, 0x38, 0xF0, 0x25, 0x48,
+  0xF0, 0x15, 0x58, 0xF6, 0x58, 0xE6, 0x68, 0xD6, 0x78, 0xC5, 0x98, 0xB5,
+  0xA8, 0xB5, 0xA8, 0xB4, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xA5,
+  0xB8, 0xF0, 0xB8, 0xF0, 0xB8, 0xF0, 0xB8, 0xF0, 0xB8, 0xA5, 0xB8, 0xA5,
+  0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xF0, 0xB8, 0xF0, 0xBF, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x01, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x01, 0xF0, 0xB8, 0xB4, 0xB8, 0x8A, 0x88, 0x6E, 0x68, 0x5F, 0x01,
+  0x58, 0x46, 0x66, 0x48, 0x44, 0x95, 0x48, 0x35, 0xA5, 0x38, 0x34, 0xC4,
+  0x38, 0x34, 0xC4, 0x38, 0x34, 0xC4, 0x38, 0x34, 0xC4, 0x38, 0xF0, 0x35,
+  0x38, 0xF0, 0x35, 0x38, 0xF0, 0x25, 0x48, 0xF0, 0x15, 0x58, 0xF6, 0x58,
+  0xE6, 0x68, 0xD6, 0x78, 0xC5, 0x98, 0xB5, 0xA8, 0xB5, 0xA8, 0xB4, 0xB8,
+  0xA5, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xF0, 0xB8, 0xF0, 0xB8,
+  0xF0, 0xB8, 0xF0, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8,
+  0xA5, 0xB8, 0xF0, 0xB8, 0xF0, 0xBF, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x01, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x01, 0xF0, 0xB8, 0xB4,
+  0xB8, 0x8A, 0x88, 0x6E, 0x68, 0x5F, 0x01, 0x58, 0x46, 0x66, 0x48, 0x44,
+  0x95, 0x48, 0x35, 0xA5, 0x38, 0x34, 0xC4, 0x38, 0x34, 0xC4, 0x38, 0x34,
+  0xC4, 0x38, 0x34, 0xC4, 0x38, 0xF0, 0x35, 0x38, 0xF0, 0x35, 0x38, 0xF0,
+  0x25, 0x48, 0xF0, 0x15, 0x58, 0xF6, 0x58, 0xE6, 0x68, 0xD6, 0x78, 0xC5,
+  0x98, 0xB5, 0xA8, 0xB5, 0xA8, 0xB4, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xA5,
+  0xB8, 0xA5, 0xB8, 0xF0, 0xB8, 0xF0, 0xB8, 0xF0, 0xB8, 0xF0, 0xB8, 0xA5,
+  0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xF0, 0xB8, 0xF0,
+  0xBF, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x01, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x01, 0xF0, 0xB8, 0xB4, 0xB8, 0x8A, 0x88, 0x6E, 0x68,
+  0x5F, 0x01, 0x58, 0x46, 0x66, 0x48, 0x44, 0x95, 0x48, 0x35, 0xA5, 0x38,
+  0x34, 0xC4, 0x38, 0x34, 0xC4, 0x38, 0x34, 0xC4, 0x38, 0x34, 0xC4, 0x38,
+  0xF0, 0x35, 0x38, 0xF0, 0x35, 0x38, 0xF0, 0x25, 0x48, 0xF0, 0x15, 0x58,
+  0xF6, 0x58, 0xE6, 0x68, 0xD6, 0x78, 0xC5, 0x98, 0xB5, 0xA8, 0xB5, 0xA8,
+  0xB4, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xF0, 0xB8,
+  0xF0, 0xB8, 0xF0, 0xB8, 0xF0, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8,
+  0xA5, 0xB8, 0xA5, 0xB8, 0xF0, 0xB8, 0xF0, 0xBF, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x01, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x01, 0xF0,
+  0xB8, 0xB4, 0xB8, 0x8A, 0x88, 0x6E, 0x68, 0x5F, 0x01, 0x58, 0x46, 0x66,
+  0x48, 0x44, 0x95, 0x48, 0x35, 0xA5, 0x38, 0x34, 0xC4, 0x38, 0x34, 0xC4,
+  0x38, 0x34, 0xC4, 0x38, 0x34, 0xC4, 0x38, 0xF0, 0x35, 0x38, 0xF0, 0x35,
+  0x38, 0xF0, 0x25, 0x48, 0xF0, 0x15, 0x58, 0xF6, 0x58, 0xE6, 0x68, 0xD6,
+  0x78, 0xC5, 0x98, 0xB5, 0xA8, 0xB5, 0xA8, 0xB4, 0xB8, 0xA5, 0xB8, 0xA5,
+  0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xF0, 0xB8, 0xF0, 0xB8, 0xF0, 0xB8, 0xF0,
+  0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xF0,
+  0xB8, 0xF0, 0xBF, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x01, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x01, 0xF0, 0xB8, 0xB4, 0xB8, 0x8A, 0x88,
+  0x6E, 0x68, 0x5F, 0x01, 0x58, 0x46, 0x66, 0x48, 0x44, 0x95, 0x48, 0x35,
+  0xA5, 0x38, 0x34, 0xC4, 0x38, 0x34, 0xC4, 0x38, 0x34, 0xC4, 0x38, 0x34,
+  0xC4, 0x38, 0xF0, 0x35, 0x38, 0xF0, 0x35, 0x38, 0xF0, 0x25, 0x48, 0xF0,
+  0x15, 0x58, 0xF6, 0x58, 0xE6, 0x68, 0xD6, 0x78, 0xC5, 0x98, 0xB5, 0xA8,
+  0xB5, 0xA8, 0xB4, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8,
+  0xF0, 0xB8, 0xF0, 0xB8, 0xF0, 0xB8, 0xF0, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8,
+  0xA5, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xF0, 0xB8, 0xF0, 0xBF, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x01, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x01, 0xF0, 0xB8, 0xB4, 0xB8, 0x8A, 0x88, 0x6E, 0x68, 0x5F, 0x01, 0x58,
+  0x46, 0x66, 0x48, 0x44, 0x95, 0x48, 0x35, 0xA5, 0x38, 0x34, 0xC4, 0x38,
+  0x34, 0xC4, 0x38, 0x34, 0xC4, 0x38, 0x34, 0xC4, 0x38, 0xF0, 0x35, 0x38,
+  0xF0, 0x35, 0x38, 0xF0, 0x25, 0x48, 0xF0, 0x15, 0x58, 0xF6, 0x58, 0xE6,
+  0x68, 0xD6, 0x78, 0xC5, 0x98, 0xB5, 0xA8, 0xB5, 0xA8, 0xB4, 0xB8, 0xA5,
+  0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xF0, 0xB8, 0xF0, 0xB8, 0xF0,
+  0xB8, 0xF0, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xA5,
+  0xB8, 0xF0, 0xB8, 0xF0, 0xBF, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x01,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x01, 0xF0, 0xB8, 0xB4, 0xB8,
+  0x8A, 0x88, 0x6E, 0x68, 0x5F, 0x01, 0x58, 0x46, 0x66, 0x48, 0x44, 0x95,
+  0x48, 0x35, 0xA5, 0x38, 0x34, 0xC4, 0x38, 0x34, 0xC4, 0x38, 0x34, 0xC4,
+  0x38, 0x34, 0xC4, 0x38, 0xF0, 0x35, 0x38, 0xF0, 0x35, 0x38, 0xF0, 0x25,
+  0x48, 0xF0, 0x15, 0x58, 0xF6, 0x58, 0xE6, 0x68, 0xD6, 0x78, 0xC5, 0x98,
+  0xB5, 0xA8, 0xB5, 0xA8, 0xB4, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8,
+  0xA5, 0xB8, 0xF0, 0xB8, 0xF0, 0xB8, 0xF0, 0xB8, 0xF0, 0xB8, 0xA5, 0xB8,
+  0xA5, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xF0, 0xB8, 0xF0, 0xBF,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x01, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x01, 0xF0, 0xB8, 0xB4, 0xB8, 0x8A, 0x88, 0x6E, 0x68, 0x5F,
+  0x01, 0x58, 0x46, 0x66, 0x48, 0x44, 0x95, 0x48, 0x35, 0xA5, 0x38, 0x34,
+  0xC4, 0x38, 0x34, 0xC4, 0x38, 0x34, 0xC4, 0x38, 0x34, 0xC4, 0x38, 0xF0,
+  0x35, 0x38, 0xF0, 0x35, 0x38, 0xF0, 0x25, 0x48, 0xF0, 0x15, 0x58, 0xF6,
+  0x58, 0xE6, 0x68, 0xD6, 0x78, 0xC5, 0x98, 0xB5, 0xA8, 0xB5, 0xA8, 0xB4,
+  0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xF0, 0xB8, 0xF0,
+  0xB8, 0xF0, 0xB8, 0xF0, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xA5,
+  0xB8, 0xA5, 0xB8, 0xF0, 0xB8, 0xF0, 0xBF, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x01, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x01, 0xF0, 0xB8,
+  0xB4, 0xB8, 0x8A, 0x88, 0x6E, 0x68, 0x5F, 0x01, 0x58, 0x46, 0x66, 0x48,
+  0x44, 0x95, 0x48, 0x35, 0xA5, 0x38, 0x34, 0xC4, 0x38, 0x34, 0xC4, 0x38,
+  0x34, 0xC4, 0x38, 0x34, 0xC4, 0x38, 0xF0, 0x35, 0x38, 0xF0, 0x35, 0x38,
+  0xF0, 0x25, 0x48, 0xF0, 0x15, 0x58, 0xF6, 0x58, 0xE6, 0x68, 0xD6, 0x78,
+  0xC5, 0x98, 0xB5, 0xA8, 0xB5, 0xA8, 0xB4, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8,
+  0xA5, 0xB8, 0xA5, 0xB8, 0xF0, 0xB8, 0xF0, 0xB8, 0xF0, 0xB8, 0xF0, 0xB8,
+  0xA5, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xF0, 0xB8,
+  0xF0, 0xBF, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x01, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x01, 0xF0, 0xB8, 0xB4, 0xB8, 0x8A, 0x88, 0x6E,
+  0x68, 0x5F, 0x01, 0x58, 0x46, 0x66, 0x48, 0x44, 0x95, 0x48, 0x35, 0xA5,
+  0x38, 0x34, 0xC4, 0x38, 0x34, 0xC4, 0x38, 0x34, 0xC4, 0x38, 0x34, 0xC4,
+  0x38, 0xF0, 0x35, 0x38, 0xF0, 0x35, 0x38, 0xF0, 0x25, 0x48, 0xF0, 0x15,
+  0x58, 0xF6, 0x58, 0xE6, 0x68, 0xD6, 0x78, 0xC5, 0x98, 0xB5, 0xA8, 0xB5,
+  0xA8, 0xB4, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xF0,
+  0xB8, 0xF0, 0xB8, 0xF0, 0xB8, 0xF0, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xA5,
+  0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xF0, 0xB8, 0xF0, 0xBF, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x01, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x01,
+  0xF0, 0xB8, 0xB4, 0xB8, 0x8A, 0x88, 0x6E, 0x68, 0x5F, 0x01, 0x58, 0x46,
+  0x66, 0x48, 0x44, 0x95, 0x48, 0x35, 0xA5, 0x38, 0x34, 0xC4, 0x38, 0x34,
+  0xC4, 0x38, 0x34, 0xC4, 0x38, 0x34, 0xC4, 0x38, 0xF0, 0x35, 0x38, 0xF0,
+  0x35, 0x38, 0xF0, 0x25, 0x48, 0xF0, 0x15, 0x58, 0xF6, 0x58, 0xE6, 0x68,
+  0xD6, 0x78, 0xC5, 0x98, 0xB5, 0xA8, 0xB5, 0xA8, 0xB4, 0xB8, 0xA5, 0xB8,
+  0xA5, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xF0, 0xB8, 0xF0, 0xB8, 0xF0, 0xB8,
+  0xF0, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8,
+  0xF0, 0xB8, 0xF0, 0xBF, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x01, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x01, 0xF0, 0xB8, 0xB4, 0xB8, 0x8A,
+  0x88, 0x6E, 0x68, 0x5F, 0x01, 0x58, 0x46, 0x66, 0x48, 0x44, 0x95, 0x48,
+  0x35, 0xA5, 0x38, 0x34, 0xC4, 0x38, 0x34, 0xC4, 0x38, 0x34, 0xC4, 0x38,
+  0x34, 0xC4, 0x38, 0xF0, 0x35, 0x38, 0xF0, 0x35, 0x38, 0xF0, 0x25, 0x48,
+  0xF0, 0x15, 0x58, 0xF6, 0x58, 0xE6, 0x68, 0xD6, 0x78, 0xC5, 0x98, 0xB5,
+  0xA8, 0xB5, 0xA8, 0xB4, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xA5,
+  0xB8, 0xF0, 0xB8, 0xF0, 0xB8, 0xF0, 0xB8, 0xF0, 0xB8, 0xA5, 0xB8, 0xA5,
+  0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xF0, 0xB8, 0xF0, 0xBF, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x01, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x01, 0xF0, 0xB8, 0xB4, 0xB8, 0x8A, 0x88, 0x6E, 0x68, 0x5F, 0x01,
+  0x58, 0x46, 0x66, 0x48, 0x44, 0x95, 0x48, 0x35, 0xA5, 0x38, 0x34, 0xC4,
+  0x38, 0x34, 0xC4, 0x38, 0x34, 0xC4, 0x38, 0x34, 0xC4, 0x38, 0xF0, 0x35,
+  0x38, 0xF0, 0x35, 0x38, 0xF0, 0x25, 0x48, 0xF0, 0x15, 0x58, 0xF6, 0x58,
+  0xE6, 0x68, 0xD6, 0x78, 0xC5, 0x98, 0xB5, 0xA8, 0xB5, 0xA8, 0xB4, 0xB8,
+  0xA5, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xF0, 0xB8, 0xF0, 0xB8,
+  0xF0, 0xB8, 0xF0, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8,
+  0xA5, 0xB8, 0xF0, 0xB8, 0xF0, 0xBF, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x01, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x01, 0xF0, 0xB8, 0xB4,
+  0xB8, 0x8A, 0x88, 0x6E, 0x68, 0x5F, 0x01, 0x58, 0x46, 0x66, 0x48, 0x44,
+  0x95, 0x48, 0x35, 0xA5, 0x38, 0x34, 0xC4, 0x38, 0x34, 0xC4, 0x38, 0x34,
+  0xC4, 0x38, 0x34, 0xC4, 0x38, 0xF0, 0x35, 0x38, 0xF0, 0x35, 0x38, 0xF0,
+  0x25, 0x48, 0xF0, 0x15, 0x58, 0xF6, 0x58, 0xE6, 0x68, 0xD6, 0x78, 0xC5,
+  0x98, 0xB5, 0xA8, 0xB5, 0xA8, 0xB4, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xA5,
+  0xB8, 0xA5, 0xB8, 0xF0, 0xB8, 0xF0, 0xB8, 0xF0, 0xB8, 0xF0, 0xB8, 0xA5,
+  0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xF0, 0xB8, 0xF0,
+  0xBF, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x01, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x01, 0xF0, 0xB8, 0xB4, 0xB8, 0x8A, 0x88, 0x6E, 0x68,
+  0x5F, 0x01, 0x58, 0x46, 0x66, 0x48, 0x44, 0x95, 0x48, 0x35, 0xA5, 0x38,
+  0x34, 0xC4, 0x38, 0x34, 0xC4, 0x38, 0x34, 0xC4, 0x38, 0x34, 0xC4, 0x38,
+  0xF0, 0x35, 0x38, 0xF0, 0x35, 0x38, 0xF0, 0x25, 0x48, 0xF0, 0x15, 0x58,
+  0xF6, 0x58, 0xE6, 0x68, 0xD6, 0x78, 0xC5, 0x98, 0xB5, 0xA8, 0xB5, 0xA8,
+  0xB4, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xF0, 0xB8,
+  0xF0, 0xB8, 0xF0, 0xB8, 0xF0, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8,
+  0xA5, 0xB8, 0xA5, 0xB8, 0xF0, 0xB8, 0xF0, 0xBF, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x01, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x01, 0xF0,
+  0xB8, 0xB4, 0xB8, 0x8A, 0x88, 0x6E, 0x68, 0x5F, 0x01, 0x58, 0x46, 0x66,
+  0x48, 0x44, 0x95, 0x48, 0x35, 0xA5, 0x38, 0x34, 0xC4, 0x38, 0x34, 0xC4,
+  0x38, 0x34, 0xC4, 0x38, 0x34, 0xC4, 0x38, 0xF0, 0x35, 0x38, 0xF0, 0x35,
+  0x38, 0xF0, 0x25, 0x48, 0xF0, 0x15, 0x58, 0xF6, 0x58, 0xE6, 0x68, 0xD6,
+  0x78, 0xC5, 0x98, 0xB5, 0xA8, 0xB5, 0xA8, 0xB4, 0xB8, 0xA5, 0xB8, 0xA5,
+  0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xF0, 0xB8, 0xF0, 0xB8, 0xF0, 0xB8, 0xF0,
+  0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xF0,
+  0xB8, 0xF0, 0xBF, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x01, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x01, 0xF0, 0xB8, 0xB4, 0xB8, 0x8A, 0x88,
+  0x6E, 0x68, 0x5F, 0x01, 0x58, 0x46, 0x66, 0x48, 0x44, 0x95, 0x48, 0x35,
+  0xA5, 0x38, 0x34, 0xC4, 0x38, 0x34, 0xC4, 0x38, 0x34, 0xC4, 0x38, 0x34,
+  0xC4, 0x38, 0xF0, 0x35, 0x38, 0xF0, 0x35, 0x38, 0xF0, 0x25, 0x48, 0xF0,
+  0x15, 0x58, 0xF6, 0x58, 0xE6, 0x68, 0xD6, 0x78, 0xC5, 0x98, 0xB5, 0xA8,
+  0xB5, 0xA8, 0xB4, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8,
+  0xF0, 0xB8, 0xF0, 0xB8, 0xF0, 0xB8, 0xF0, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8,
+  0xA5, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xF0, 0xB8, 0xF0, 0xBF, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x01, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x01, 0xF0, 0xB8, 0xB4, 0xB8, 0x8A, 0x88, 0x6E, 0x68, 0x5F, 0x01, 0x58,
+  0x46, 0x66, 0x48, 0x44, 0x95, 0x48, 0x35, 0xA5, 0x38, 0x34, 0xC4, 0x38,
+  0x34, 0xC4, 0x38, 0x34, 0xC4, 0x38, 0x34, 0xC4, 0x38, 0xF0, 0x35, 0x38,
+  0xF0, 0x35, 0x38, 0xF0, 0x25, 0x48, 0xF0, 0x15, 0x58, 0xF6, 0x58, 0xE6,
+  0x68, 0xD6, 0x78, 0xC5, 0x98, 0xB5, 0xA8, 0xB5, 0xA8, 0xB4, 0xB8, 0xA5,
+  0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xF0, 0xB8, 0xF0, 0xB8, 0xF0,
+  0xB8, 0xF0, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xA5,
+  0xB8, 0xF0, 0xB8, 0xF0, 0xBF, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x01,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x01, 0xF0, 0xB8, 0xB4, 0xB8,
+  0x8A, 0x88, 0x6E, 0x68, 0x5F, 0x01, 0x58, 0x46, 0x66, 0x48, 0x44, 0x95,
+  0x48, 0x35, 0xA5, 0x38, 0x34, 0xC4, 0x38, 0x34, 0xC4, 0x38, 0x34, 0xC4,
+  0x38, 0x34, 0xC4, 0x38, 0xF0, 0x35, 0x38, 0xF0, 0x35, 0x38, 0xF0, 0x25,
+  0x48, 0xF0, 0x15, 0x58, 0xF6, 0x58, 0xE6, 0x68, 0xD6, 0x78, 0xC5, 0x98,
+  0xB5, 0xA8, 0xB5, 0xA8, 0xB4, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8,
+  0xA5, 0xB8, 0xF0, 0xB8, 0xF0, 0xB8, 0xF0, 0xB8, 0xF0, 0xB8, 0xA5, 0xB8,
+  0xA5, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xF0, 0xB8, 0xF0, 0xBF,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x01, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x01, 0xF0, 0xB8, 0xB4, 0xB8, 0x8A, 0x88, 0x6E, 0x68, 0x5F,
+  0x01, 0x58, 0x46, 0x66, 0x48, 0x44, 0x95, 0x48, 0x35, 0xA5, 0x38, 0x34,
+  0xC4, 0x38, 0x34, 0xC4, 0x38, 0x34, 0xC4, 0x38, 0x34, 0xC4, 0x38, 0xF0,
+  0x35, 0x38, 0xF0, 0x35, 0x38, 0xF0, 0x25, 0x48, 0xF0, 0x15, 0x58, 0xF6,
+  0x58, 0xE6, 0x68, 0xD6, 0x78, 0xC5, 0x98, 0xB5, 0xA8, 0xB5, 0xA8, 0xB4,
+  0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xF0, 0xB8, 0xF0,
+  0xB8, 0xF0, 0xB8, 0xF0, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xA5, 0xB8, 0xA5,
+  0xB8, 0xA5, 0xB8, 0xF0, 0xB8, 0xF0, 0xBF, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x01, 0x10, 0x0F, 0x05, 0xD2, 0x22, 0x22, 0x13, 0x13, 0x13, 0x13,
+  0x13, 0x13, 0x1F, 0x0F, 0x0F, 0x0F, 0x0C, 0xB2, 0xF0, 0x52, 0xF0, 0x52,
+  0xF0, 0x52, 0xF0, 0x28, 0xCC, 0x9E, 0x7F, 0x01, 0x55, 0x32, 0x25, 0x45,
+  0x42, 0x35, 0x34, 0x52, 0x44, 0x25, 0x52, 0x44, 0x24, 0x62, 0x54, 0x14,
+  0x62, 0xA4, 0x62, 0xA4, 0x62, 0x95, 0x62, 0x95, 0x62, 0x95, 0x62, 0x95,
+  0x62, 0xA4, 0x62, 0xA4, 0x62, 0x54, 0x14, 0x62, 0x54, 0x15, 0x52, 0x45,
+  0x24, 0x52, 0x44, 0x35, 0x42, 0x35, 0x45, 0x32, 0x25, 0x6F, 0x01, 0x7E,
+  0x9C, 0xC8, 0xF0, 0x22, 0xF0, 0x52, 0xF0, 0x52, 0xF0, 0x52, 0xF0, 0x52,
+  0x90, 0x97, 0xFC, 0xAF, 0x8F, 0x02, 0x66, 0x76, 0x55, 0x95, 0x45, 0xB4,
+  0x44, 0xC5, 0x34, 0xD4, 0x34, 0xD4, 0x34, 0xD4, 0x34, 0xF0, 0x54, 0xF0,
+  0x55, 0xF0, 0x55, 0xF0, 0x45, 0xF0, 0x1F, 0x01, 0x8F, 0x01, 0x8F, 0x01,
+  0xE4, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0,
+  0x54, 0xF0, 0x44, 0xF0, 0x53, 0xF0, 0x54, 0xF0, 0x44, 0x32, 0xEE, 0x34,
+  0x2F, 0x08, 0x1F, 0x08, 0x24, 0x5C, 0x41, 0xA7, 0x30, 0x21, 0xE1, 0x33,
+  0x52, 0x53, 0x15, 0x18, 0x15, 0x1F, 0x03, 0x3F, 0x01, 0x46, 0x45, 0x54,
+  0x75, 0x44, 0x84, 0x34, 0xA3, 0x34, 0xA4, 0x24, 0xA4, 0x24, 0xA3, 0x44,
+  0x84, 0x44, 0x75, 0x46, 0x45, 0x5F, 0x01, 0x3F, 0x03, 0x24, 0x18, 0x14,
+  0x32, 0x53, 0x42, 0xF0, 0x70, 0x04, 0xF0, 0x14, 0x14, 0xF0, 0x14, 0x24,
+  0xE4, 0x34, 0xE4, 0x44, 0xC4, 0x64, 0xB4, 0x64, 0xA4, 0x84, 0x93, 0x94,
+  0x84, 0xA4, 0x64, 0xB4, 0x64, 0xC4, 0x44, 0xE4, 0x34, 0xE4, 0x24, 0xF0,
+  0x14, 0x14, 0xF0, 0x18, 0xF0, 0x36, 0xCF, 0x05, 0x5F, 0x05, 0xD4, 0xF0,
+  0x64, 0xF0, 0x64, 0xF0, 0x64, 0xDF, 0x05, 0x5F, 0x05, 0xD4, 0xF0, 0x64,
+  0xF0, 0x64, 0xF0, 0x64, 0xF0, 0x64, 0xF0, 0x64, 0xF0, 0x64, 0xF0, 0x64,
+  0xF0, 0x64, 0xB0, 0x0F, 0x0F, 0x0F, 0x0C, 0xF0, 0x3F, 0x0F, 0x0F, 0x0C,
+  0x87, 0xDB, 0xAD, 0x8E, 0x85, 0x55, 0x65, 0x74, 0x64, 0x85, 0x54, 0x94,
+  0x54, 0x94, 0x55, 0x84, 0x55, 0xF0, 0x36, 0xF0, 0x26, 0xF9, 0xBC, 0x95,
+  0x37, 0x74, 0x57, 0x54, 0x87, 0x34, 0x97, 0x24, 0xB6, 0x14, 0xC5, 0x14,
+  0xDA, 0xC5, 0x16, 0xB4, 0x17, 0xA4, 0x27, 0x94, 0x38, 0x73, 0x67, 0x54,
+  0x77, 0x34, 0xAB, 0xC9, 0xF6, 0xF0, 0x26, 0xF0, 0x25, 0xF0, 0x35, 0x54,
+  0x94, 0x54, 0x94, 0x54, 0x94, 0x54, 0x85, 0x55, 0x65, 0x7F, 0x8D, 0xAB,
+  0xD6, 0x90, 0x05, 0x49, 0x49, 0x49, 0x49, 0x44, 0xD8, 0xF0, 0x8E, 0xF0,
+  0x3F, 0x03, 0xF5, 0xA5, 0xC5, 0xE4, 0xA5, 0xF0, 0x14, 0x94, 0xF0, 0x34,
+  0x74, 0x68, 0x64, 0x54, 0x5B, 0x63, 0x53, 0x5D, 0x63, 0x33, 0x64, 0x64,
+  0x53, 0x33, 0x54, 0x83, 0x63, 0x14, 0x53, 0x94, 0x53, 0x13, 0x54, 0xA3,
+  0x53, 0x13, 0x53, 0xF0, 0x52, 0x13, 0x53, 0xF0, 0x56, 0x53, 0xF0, 0x56,
+  0x53, 0xF0, 0x56, 0x53, 0xF0, 0x56, 0x53, 0xF0, 0x56, 0x53, 0xB3, 0x62,
+  0x13, 0x54, 0xA3, 0x53, 0x23, 0x44, 0xA3, 0x53, 0x23, 0x54, 0x84, 0x53,
+  0x24, 0x45, 0x64, 0x53, 0x43, 0x5D, 0x63, 0x44, 0x5C, 0x53, 0x64, 0x68,
+  0x64, 0x74, 0xF0, 0x34, 0x85, 0xF0, 0x14, 0xA5, 0xD5, 0xD6, 0x86, 0xFF,
+  0x03, 0xF0, 0x3E, 0xF0, 0x88, 0xD0, 0x37, 0x69, 0x45, 0x15, 0x33, 0x53,
+  0x23, 0x63, 0xB3, 0xA4, 0x59, 0x3B, 0x24, 0x53, 0x23, 0x63, 0x22, 0x73,
+  0x23, 0x63, 0x23, 0x45, 0x29, 0x14, 0x17, 0x24, 0xF0, 0xF0, 0xCD, 0x1D,
+  0x10, 0xF0, 0x81, 0x91, 0x52, 0x82, 0x43, 0x64, 0x25, 0x55, 0x15, 0x55,
+  0x15, 0x54, 0x33, 0x73, 0x43, 0x73, 0x44, 0x64, 0x44, 0x55, 0x45, 0x45,
+  0x44, 0x64, 0x43, 0x73, 0x61, 0x82, 0x61, 0x91, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0C, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0,
+  0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0x0F, 0x0F, 0x03,
+  0xD8, 0xF0, 0x8E, 0xF0, 0x3F, 0x03, 0xF5, 0xA5, 0xC5, 0xE4, 0xA5, 0xF0,
+  0x14, 0x94, 0xF0, 0x34, 0x74, 0x2B, 0x74, 0x54, 0x3E, 0x53, 0x53, 0x4F,
+  0x53, 0x33, 0x53, 0x84, 0x53, 0x33, 0x53, 0x94, 0x53, 0x14, 0x53, 0xA3,
+  0x53, 0x13, 0x63, 0xA3, 0x53, 0x13, 0x63, 0x94, 0x62, 0x13, 0x63, 0x93,
+  0x76, 0x6F, 0x76, 0x6D, 0x96, 0x6E, 0x86, 0x63, 0x84, 0x76, 0x63, 0x93,
+  0x72, 0x13, 0x63, 0x93, 0x63, 0x23, 0x53, 0x93, 0x63, 0x23, 0x53, 0x93,
+  0x63, 0x24, 0x43, 0x93, 0x53, 0x43, 0x43, 0x93, 0x53, 0x44, 0x33, 0xA3,
+  0x33, 0x64, 0x23, 0xA3, 0x24, 0x74, 0xF0, 0x34, 0x85, 0xF0, 0x14, 0xA5,
+  0xD5, 0xD6, 0x86, 0xFF, 0x03, 0xF0, 0x3E, 0xF0, 0x88, 0xD0, 0x0F, 0x0F,
+  0x09, 0x55, 0x79, 0x4B, 0x24, 0x53, 0x23, 0x76, 0x86, 0x95, 0x95, 0x83,
+  0x13, 0x73, 0x14, 0x53, 0x3B, 0x49, 0x66, 0x40, 0xA3, 0xF0, 0x53, 0xF0,
+  0x53, 0xF0, 0x53, 0xF0, 0x53, 0xF0, 0x53, 0xF0, 0x53, 0xF0, 0x53, 0xF0,
+  0x53, 0xF0, 0x53, 0xAF, 0x0F, 0x0F, 0x0F, 0x09, 0xA3, 0xF0, 0x53, 0xF0,
+  0x53, 0xF0, 0x53, 0xF0, 0x53, 0xF0, 0x53, 0xF0, 0x53, 0xF0, 0x53, 0xF0,
+  0x53, 0xF0, 0x53, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xCF, 0x0F, 0x0F,
+  0x0F, 0x09, 0x38, 0x5B, 0x24, 0x45, 0x13, 0x73, 0x13, 0x76, 0x86, 0x83,
+  0xB3, 0xA3, 0x95, 0x76, 0x75, 0x75, 0x84, 0x94, 0xA3, 0xA4, 0xAF, 0x0F,
+  0x0C, 0x38, 0x5A, 0x34, 0x44, 0x23, 0x63, 0x13, 0x73, 0x13, 0x73, 0xB3,
+  0xA4, 0x67, 0x77, 0xA5, 0xB4, 0xB6, 0x86, 0x86, 0x87, 0x64, 0x1C, 0x3A,
+  0x66, 0x40, 0x46, 0x45, 0x45, 0x54, 0x54, 0x54, 0x63, 0x60, 0x04, 0xC4,
+  0x34, 0xC4, 0x34, 0xC4, 0x34, 0xC4, 0x34, 0xC4, 0x34, 0xC4, 0x34, 0xC4,
+  0x34, 0xC4, 0x34, 0xC4, 0x34, 0xC4, 0x34, 0xC4, 0x34, 0xC4, 0x34, 0xC4,
+  0x34, 0xC4, 0x34, 0xC4, 0x34, 0xC4, 0x34, 0xB5, 0x34, 0xB5, 0x34, 0xB5,
+  0x34, 0xA6, 0x35, 0x96, 0x36, 0x77, 0x38, 0x2B, 0x2F, 0x1F, 0x05, 0x3B,
+  0x16, 0x79, 0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x44,
+  0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x40, 0x8F, 0x5F, 0x03, 0x4F,
+  0x04, 0x3A, 0x43, 0x5B, 0x43, 0x5B, 0x43, 0x4C, 0x43, 0x4C, 0x43, 0x4C,
+  0x43, 0x3D, 0x43, 0x3D, 0x43, 0x3D, 0x43, 0x3D, 0x43, 0x3D, 0x43, 0x4C,
+  0x43, 0x4C, 0x43, 0x4C, 0x43, 0x5B, 0x43, 0x6A, 0x43, 0x79, 0x43, 0x88,
+  0x43, 0xA6, 0x43, 0xD3, 0x43, 0xD3, 0x43, 0xD3, 0x43, 0xD3, 0x43, 0xD3,
+  0x43, 0xD3, 0x43, 0xD3, 0x43, 0xD3, 0x43, 0xD3, 0x43, 0xD3, 0x43, 0xD3,
+  0x43, 0xD3, 0x43, 0xD3, 0x43, 0xD3, 0x43, 0xD3, 0x43, 0xD3, 0x43, 0xD3,
+  0x43, 0xD3, 0x43, 0xD3, 0x43, 0xD3, 0x43, 0xD3, 0x43, 0x30, 0x0F, 0x0A,
+  0x52, 0x92, 0x94, 0x67, 0x74, 0x83, 0x86, 0x4E, 0x46, 0x20, 0x62, 0x53,
+  0x53, 0x3F, 0x06, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
+  0x53, 0x53, 0x53, 0x53, 0x53, 0x45, 0x69, 0x35, 0x15, 0x23, 0x53, 0x13,
+  0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x73, 0x13, 0x53, 0x24, 0x34,
+  0x39, 0x57, 0xF0, 0xF0, 0xCF, 0x0B, 0xF0, 0x22, 0x81, 0x63, 0x73, 0x44,
+  0x64, 0x45, 0x45, 0x45, 0x45, 0x45, 0x54, 0x44, 0x63, 0x53, 0x72, 0x44,
+  0x54, 0x25, 0x55, 0x15, 0x55, 0x15, 0x54, 0x34, 0x63, 0x42, 0x82, 0x51,
+  0x91, 0x60, 0x52, 0xF0, 0xF0, 0x52, 0xF0, 0x53, 0xB3, 0xF0, 0x43, 0xB4,
+  0xF0, 0x42, 0x97, 0xF0, 0x33, 0x97, 0xF0, 0x23, 0xF2, 0xF0, 0x23, 0xF2,
+  0xF0, 0x13, 0xF0, 0x12, 0xF0, 0x12, 0xF0, 0x22, 0xF3, 0xF0, 0x22, 0xE3,
+  0xF0, 0x32, 0xE3, 0xF0, 0x32, 0xD3, 0xF0, 0x42, 0xD2, 0xF0, 0x52, 0xC3,
+  0xA2, 0x82, 0xB3, 0xA3, 0x82, 0xB3, 0x94, 0x82, 0xA3, 0x95, 0x82, 0xA2,
+  0xA5, 0x82, 0x93, 0x96, 0xF0, 0x33, 0x93, 0x13, 0xF0, 0x32, 0x93, 0x23,
+  0xF0, 0x23, 0x93, 0x23, 0xF0, 0x22, 0x93, 0x33, 0xF0, 0x13, 0x83, 0x43,
+  0xF3, 0x83, 0x53, 0xF2, 0x93, 0x53, 0xE3, 0x83, 0x63, 0xD3, 0x9F, 0xA3,
+  0x9F, 0x93, 0xF0, 0x43, 0xC2, 0xF0, 0x53, 0xB3, 0xF0, 0x53, 0xA3, 0xF0,
+  0x63, 0xA3, 0xF0, 0x63, 0x93, 0xF0, 0xD0, 0x52, 0xF0, 0x43, 0xD2, 0xF0,
+  0x33, 0xC4, 0xF0, 0x32, 0xA7, 0xF0, 0x23, 0xA7, 0xF0, 0x13, 0xF0, 0x12,
+  0xF0, 0x12, 0xF0, 0x22, 0xF3, 0xF0, 0x22, 0xF2, 0xF0, 0x32, 0xE3, 0xF0,
+  0x32, 0xD3, 0xF0, 0x42, 0xD2, 0xF0, 0x52, 0xC3, 0xF0, 0x52, 0xC2, 0xF0,
+  0x62, 0xB3, 0xF0, 0x62, 0xA3, 0x59, 0x82, 0xA2, 0x5B, 0x72, 0x93, 0x54,
+  0x44, 0x62, 0x83, 0x53, 0x73, 0x62, 0x83, 0x53, 0x74, 0xE3, 0x63, 0x83,
+  0xE2, 0x73, 0x83, 0xD3, 0xF0, 0x23, 0xD3, 0xF0, 0x24, 0xD3, 0xF0, 0x14,
+  0xD3, 0xF5, 0xE2, 0xE6, 0xE3, 0xD5, 0xF3, 0xD4, 0xF0, 0x23, 0xC4, 0xF0,
+  0x23, 0xC4, 0xF0, 0x32, 0xD3, 0xF0, 0x33, 0xCF, 0x63, 0xDF, 0x62, 0xEF,
+  0x53, 0xF0, 0xE0, 0x46, 0xF0, 0xF0, 0x19, 0xF0, 0x23, 0x8B, 0xF3, 0x84,
+  0x54, 0xE2, 0x93, 0x73, 0xD3, 0x93, 0x73, 0xC3, 0xA3, 0x73, 0xC2, 0xF0,
+  0x54, 0xB3, 0xF0, 0x35, 0xC2, 0xF0, 0x26, 0xC3, 0xF0, 0x27, 0xA3, 0xF0,
+  0x74, 0x92, 0xF0, 0x93, 0x83, 0xF0, 0x94, 0x63, 0xE3, 0x93, 0x63, 0xE3,
+  0x93, 0x53, 0x93, 0x34, 0x73, 0x62, 0xA3, 0x43, 0x64, 0x53, 0x94, 0x46,
+  0x15, 0x53, 0x95, 0x5A, 0x63, 0x86, 0x76, 0x73, 0x96, 0xF0, 0x52, 0x93,
+  0x13, 0xF0, 0x43, 0x83, 0x23, 0xF0, 0x33, 0x83, 0x33, 0xF0, 0x33, 0x74,
+  0x33, 0xF0, 0x23, 0x83, 0x43, 0xF0, 0x22, 0x83, 0x53, 0xF0, 0x13, 0x73,
+  0x63, 0xF3, 0x8F, 0xC2, 0x9F, 0xB3, 0xF0, 0x33, 0xE2, 0xF0, 0x43, 0xD3,
+  0xF0, 0x43, 0xC3, 0xF0, 0x53, 0xC2, 0xF0, 0x63, 0xB3, 0xF0, 0xC0, 0x94,
+  0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xF0, 0xF0, 0xF0, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0,
+  0x15, 0xF0, 0x14, 0xF0, 0x15, 0xE6, 0xE6, 0xE6, 0xE6, 0xF5, 0xF5, 0xF0,
+  0x14, 0xF0, 0x24, 0xC4, 0x14, 0xC9, 0xC4, 0x14, 0xB5, 0x14, 0xB4, 0x25,
+  0xA4, 0x26, 0x85, 0x38, 0x18, 0x5F, 0x7D, 0xA9, 0x60, 0x95, 0xF0, 0xB5,
+  0xF0, 0xB5, 0xF0, 0xC4, 0xF0, 0xC4, 0xF0, 0xC3, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xF0, 0x96, 0xF0, 0x87, 0xF0, 0x87, 0xF0, 0x88, 0xF0, 0x69, 0xF0, 0x64,
+  0x15, 0xF0, 0x54, 0x15, 0xF0, 0x45, 0x24, 0xF0, 0x44, 0x35, 0xF0, 0x25,
+  0x35, 0xF0, 0x25, 0x44, 0xF0, 0x24, 0x55, 0xF5, 0x55, 0xF4, 0x74, 0xF4,
+  0x75, 0xD5, 0x75, 0xD4, 0x94, 0xD4, 0x95, 0xB5, 0x95, 0xB4, 0xB4, 0xBF,
+  0x05, 0x9F, 0x06, 0x9F, 0x07, 0x7F, 0x08, 0x75, 0xD5, 0x74, 0xF5, 0x55,
+  0xF5, 0x55, 0xF5, 0x54, 0xF0, 0x25, 0x35, 0xF0, 0x25, 0x35, 0xF0, 0x25,
+  0x34, 0xF0, 0x45, 0x15, 0xF0, 0x45, 0x15, 0xF0, 0x54, 0x10, 0xF0, 0x16,
+  0xF0, 0x85, 0xF0, 0x95, 0xF0, 0xA4, 0xF0, 0xA4, 0xF0, 0xA3, 0xF0, 0xF0,
+  0xF0, 0xF0, 0xF0, 0xC6, 0xF0, 0x87, 0xF0, 0x87, 0xF0, 0x88, 0xF0, 0x69,
+  0xF0, 0x64, 0x15, 0xF0, 0x54, 0x15, 0xF0, 0x45, 0x24, 0xF0, 0x44, 0x35,
+  0xF0, 0x25, 0x35, 0xF0, 0x25, 0x44, 0xF0, 0x24, 0x55, 0xF5, 0x55, 0xF4,
+  0x74, 0xF4, 0x75, 0xD5, 0x75, 0xD4, 0x94, 0xD4, 0x95, 0xB5, 0x95, 0xB4,
+  0xB4, 0xBF, 0x05, 0x9F, 0x06, 0x9F, 0x07, 0x7F, 0x08, 0x75, 0xD5, 0x74,
+  0xF5, 0x55, 0xF5, 0x55, 0xF5, 0x54, 0xF0, 0x25, 0x35, 0xF0, 0x25, 0x35,
+  0xF0, 0x25, 0x34, 0xF0, 0x45, 0x15, 0xF0, 0x45, 0x15, 0xF0, 0x54, 0x10,
+  0xC5, 0xF0, 0x97, 0xF0, 0x88, 0xF0, 0x64, 0x15, 0xF0, 0x44, 0x43, 0xF0,
+  0x33, 0x73, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x66, 0xF0, 0x87, 0xF0, 0x87,
+  0xF0, 0x88, 0xF0, 0x69, 0xF0, 0x64, 0x15, 0xF0, 0x54, 0x15, 0xF0, 0x45,
+  0x24, 0xF0, 0x44, 0x35, 0xF0, 0x25, 0x35, 0xF0, 0x25, 0x44, 0xF0, 0x24,
+  0x55, 0xF5, 0x55, 0xF4, 0x74, 0xF4, 0x75, 0xD5, 0x75, 0xD4, 0x94, 0xD4,
+  0x95, 0xB5, 0x95, 0xB4, 0xB4, 0xBF, 0x05, 0x9F, 0x06, 0x9F, 0x07, 0x7F,
+  0x08, 0x75, 0xD5, 0x74, 0xF5, 0x55, 0xF5, 0x55, 0xF5, 0x54, 0xF0, 0x25,
+  0x35, 0xF0, 0x25, 0x35, 0xF0, 0x25, 0x34, 0xF0, 0x45, 0x15, 0xF0, 0x45,
+  0x15, 0xF0, 0x54, 0x10, 0xB2, 0xF0, 0xC6, 0x33, 0xF0, 0x2D, 0xF0, 0x1D,
+  0xF0, 0x23, 0x46, 0xF0, 0x13, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x26,
+  0xF0, 0x87, 0xF0, 0x87, 0xF0, 0x88, 0xF0, 0x69, 0xF0, 0x64, 0x15, 0xF0,
+  0x54, 0x15, 0xF0, 0x45, 0x24, 0xF0, 0x44, 0x35, 0xF0, 0x25, 0x35, 0xF0,
+  0x25, 0x44, 0xF0, 0x24, 0x55, 0xF5, 0x55, 0xF4, 0x74, 0xF4, 0x75, 0xD5,
+  0x75, 0xD4, 0x94, 0xD4, 0x95, 0xB5, 0x95, 0xB4, 0xB4, 0xBF, 0x05, 0x9F,
+  0x06, 0x9F, 0x07, 0x7F, 0x08, 0x75, 0xD5, 0x74, 0xF5, 0x55, 0xF5, 0x55,
+  0xF5, 0x54, 0xF0, 0x25, 0x35, 0xF0, 0x25, 0x35, 0xF0, 0x25, 0x34, 0xF0,
+  0x45, 0x15, 0xF0, 0x45, 0x15, 0xF0, 0x54, 0x10, 0x85, 0x45, 0xF0, 0x15,
+  0x45, 0xF0, 0x15, 0x45, 0xF0, 0x15, 0x45, 0xF0, 0x15, 0x45, 0xF0, 0xF0,
+  0xF0, 0xF0, 0xF0, 0x56, 0xF0, 0x87, 0xF0, 0x87, 0xF0, 0x88, 0xF0, 0x69,
+  0xF0, 0x64, 0x15, 0xF0, 0x54, 0x15, 0xF0, 0x45, 0x24, 0xF0, 0x44, 0x35,
+  0xF0, 0x25, 0x35, 0xF0, 0x25, 0x44, 0xF0, 0x24, 0x55, 0xF5, 0x55, 0xF4,
+  0x74, 0xF4, 0x75, 0xD5, 0x75, 0xD4, 0x94, 0xD4, 0x95, 0xB5, 0x95, 0xB4,
+  0xB4, 0xBF, 0x05, 0x9F, 0x06, 0x9F, 0x07, 0x7F, 0x08, 0x75, 0xD5, 0x74,
+  0xF5, 0x55, 0xF5, 0x55, 0xF5, 0x54, 0xF0, 0x25, 0x35, 0xF0, 0x25, 0x35,
+  0xF0, 0x25, 0x34, 0xF0, 0x45, 0x15, 0xF0, 0x45, 0x15, 0xF0, 0x54, 0x10,
+  0xD4, 0xF0, 0x97, 0xF0, 0x79, 0xF0, 0x63, 0x33, 0xF0, 0x63, 0x43, 0xF0,
+  0x53, 0x43, 0xF0, 0x53, 0x33, 0xF0, 0x69, 0xF0, 0x77, 0xF0, 0xA4, 0xF0,
+  0xF0, 0xF0, 0xA6, 0xF0, 0x87, 0xF0, 0x87, 0xF0, 0x88, 0xF0, 0x69, 0xF0,
+  0x64, 0x15, 0xF0, 0x54, 0x15, 0xF0, 0x45, 0x24, 0xF0, 0x44, 0x35, 0xF0,
+  0x25, 0x35, 0xF0, 0x25, 0x44, 0xF0, 0x24, 0x55, 0xF5, 0x55, 0xF4, 0x74,
+  0xF4, 0x75, 0xD5, 0x75, 0xD4, 0x94, 0xD4, 0x95, 0xB5, 0x95, 0xB4, 0xB4,
+  0xBF, 0x05, 0x9F, 0x06, 0x9F, 0x07, 0x7F, 0x08, 0x75, 0xD5, 0x74, 0xF5,
+  0x55, 0xF5, 0x55, 0xF5, 0x54, 0xF0, 0x25, 0x35, 0xF0, 0x25, 0x35, 0xF0,
+  0x25, 0x34, 0xF0, 0x45, 0x15, 0xF0, 0x45, 0x15, 0xF0, 0x54, 0x10, 0xEF,
+  0x0E, 0xEF, 0x0F, 0xEF, 0x0F, 0xDF, 0x0F, 0x01, 0xD4, 0x55, 0xF0, 0xE5,
+  0x55, 0xF0, 0xE4, 0x65, 0xF0, 0xE4, 0x65, 0xF0, 0xD5, 0x65, 0xF0, 0xD4,
+  0x75, 0xF0, 0xC5, 0x75, 0xF0, 0xC4, 0x85, 0xF0, 0xC4, 0x85, 0xF0, 0xB5,
+  0x85, 0xF0, 0xB4, 0x95, 0xF0, 0xA5, 0x9F, 0x06, 0x94, 0xAF, 0x06, 0x94,
+  0xAF, 0x06, 0x85, 0xAF, 0x06, 0x84, 0xB5, 0xF0, 0x8F, 0x06, 0xF0, 0x8F,
+  0x06, 0xF0, 0x7F, 0x07, 0xF0, 0x7F, 0x07, 0xF0, 0x74, 0xD5, 0xF0, 0x65,
+  0xD5, 0xF0, 0x65, 0xD5, 0xF0, 0x55, 0xE5, 0xF0, 0x55, 0xE5, 0xF0, 0x54,
+  0xF5, 0xF0, 0x45, 0xFF, 0x08, 0x15, 0xFF, 0x0D, 0xF0, 0x1F, 0x0D, 0xF0,
+  0x1F, 0x08, 0xB9, 0xF0, 0x2F, 0xDF, 0x02, 0xAF, 0x05, 0x87, 0x87, 0x75,
+  0xC6, 0x55, 0xE5, 0x45, 0xF0, 0x15, 0x35, 0xF0, 0x15, 0x25, 0xF0, 0x34,
+  0x25, 0xF0, 0x35, 0x14, 0xF0, 0x95, 0xF0, 0x95, 0xF0, 0x95, 0xF0, 0x94,
+  0xF0, 0xA4, 0xF0, 0xA4, 0xF0, 0xA4, 0xF0, 0xA4, 0xF0, 0xA4, 0xF0, 0xA4,
+  0xF0, 0xA5, 0xF0, 0x59, 0xF0, 0x54, 0x14, 0xF0, 0x45, 0x15, 0xF0, 0x35,
+  0x15, 0xF0, 0x35, 0x25, 0xF0, 0x15, 0x35, 0xF0, 0x15, 0x45, 0xE5, 0x66,
+  0xB6, 0x67, 0x87, 0x8F, 0x05, 0xBF, 0x02, 0xDE, 0xF0, 0x39, 0xF0, 0x72,
+  0xF0, 0xC5, 0xF0, 0x87, 0xF0, 0xB4, 0xF0, 0xA4, 0xF0, 0xA4, 0xF0, 0x32,
+  0x44, 0xF0, 0x3B, 0xF0, 0x66, 0xC0, 0x66, 0xF0, 0x46, 0xF0, 0x54, 0xF0,
+  0x64, 0xF0, 0x64, 0xF0, 0x73, 0xF0, 0xF0, 0xF0, 0xBF, 0x08, 0x1F, 0x08,
+  0x1F, 0x08, 0x1F, 0x08, 0x14, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0,
+  0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0,
+  0x54, 0xF0, 0x5F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x14, 0xF0,
+  0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0,
+  0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x5F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x06, 0xC5, 0xF0, 0x35, 0xF0, 0x35, 0xF0, 0x34, 0xF0, 0x44,
+  0xF0, 0x53, 0xF0, 0xF0, 0xF0, 0xF0, 0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08,
+  0x1F, 0x08, 0x14, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0,
+  0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0,
+  0x5F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x14, 0xF0, 0x54, 0xF0,
+  0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0,
+  0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x5F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x06, 0x95, 0xF0, 0x37, 0xF0, 0x28, 0xF4, 0x15, 0xD4, 0x43, 0xC3, 0x73,
+  0xF0, 0xF0, 0xF0, 0x9F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x14,
+  0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54,
+  0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x5F, 0x08, 0x1F,
+  0x08, 0x1F, 0x08, 0x1F, 0x08, 0x14, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54,
+  0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54,
+  0xF0, 0x54, 0xF0, 0x5F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x06, 0x55, 0x44,
+  0xB5, 0x44, 0xB5, 0x44, 0xB5, 0x44, 0xB5, 0x44, 0xF0, 0xF0, 0xF0, 0x9F,
+  0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x14, 0xF0, 0x54, 0xF0, 0x54,
+  0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54,
+  0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x5F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F,
+  0x08, 0x14, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54,
+  0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x5F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x06, 0x15, 0x75, 0x75, 0x84, 0x84, 0x83,
+  0xF0, 0xD4, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
+  0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
+  0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x20,
+  0x55, 0x55, 0x55, 0x54, 0x64, 0x73, 0xF0, 0xF0, 0x24, 0x74, 0x74, 0x74,
+  0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
+  0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
+  0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x40, 0x55, 0x87, 0x68, 0x55, 0x14,
+  0x43, 0x44, 0x23, 0x64, 0xF0, 0xF0, 0x34, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4,
+  0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4,
+  0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4,
+  0xA4, 0xA4, 0xA4, 0xA4, 0x50, 0x05, 0x4A, 0x4A, 0x4A, 0x4A, 0x45, 0xF0,
+  0xF0, 0x34, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4,
+  0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4,
+  0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0x50,
+  0x3F, 0x02, 0xDF, 0x05, 0xAF, 0x06, 0x9F, 0x08, 0x75, 0xC7, 0x65, 0xD6,
+  0x65, 0xF5, 0x55, 0xF0, 0x14, 0x55, 0xF0, 0x15, 0x45, 0xF0, 0x24, 0x45,
+  0xF0, 0x25, 0x35, 0xF0, 0x25, 0x35, 0xF0, 0x34, 0x35, 0xF0, 0x34, 0x35,
+  0xF0, 0x3F, 0x05, 0xAF, 0x05, 0xAF, 0x05, 0xA4, 0x35, 0xF0, 0x34, 0x35,
+  0xF0, 0x34, 0x35, 0xF0, 0x34, 0x35, 0xF0, 0x34, 0x35, 0xF0, 0x25, 0x35,
+  0xF0, 0x25, 0x35, 0xF0, 0x24, 0x45, 0xF0, 0x15, 0x45, 0xF0, 0x14, 0x55,
+  0xF5, 0x55, 0xD6, 0x65, 0xC7, 0x6F, 0x08, 0x7F, 0x07, 0x8F, 0x05, 0xAF,
+  0x02, 0xA0, 0x83, 0x63, 0xE7, 0x33, 0xDE, 0xD3, 0x28, 0xE2, 0x55, 0xF0,
+  0xF0, 0xF0, 0xF0, 0x35, 0xF0, 0x2A, 0xF0, 0x2B, 0xF0, 0x1C, 0xFC, 0xFD,
+  0xEE, 0xD9, 0x14, 0xD9, 0x15, 0xC9, 0x25, 0xB9, 0x25, 0xB9, 0x35, 0xA9,
+  0x45, 0x99, 0x45, 0x99, 0x55, 0x89, 0x65, 0x79, 0x65, 0x79, 0x75, 0x69,
+  0x84, 0x69, 0x85, 0x59, 0x95, 0x49, 0xA4, 0x49, 0xA5, 0x39, 0xB5, 0x29,
+  0xB5, 0x29, 0xC5, 0x19, 0xDE, 0xDE, 0xED, 0xFC, 0xFC, 0xF0, 0x1B, 0xF0,
+  0x2A, 0xF0, 0x26, 0xA5, 0xF0, 0xE5, 0xF0, 0xE5, 0xF0, 0xF4, 0xF0, 0xF4,
+  0xF0, 0xF4, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x19, 0xF0, 0x6F, 0xF0,
+  0x1F, 0x03, 0xEF, 0x06, 0xB7, 0x88, 0x96, 0xD6, 0x76, 0xF6, 0x65, 0xF0,
+  0x25, 0x55, 0xF0, 0x45, 0x35, 0xF0, 0x55, 0x35, 0xF0, 0x65, 0x24, 0xF0,
+  0x75, 0x24, 0xF0, 0x84, 0x15, 0xF0, 0x84, 0x15, 0xF0, 0x89, 0xF0, 0x99,
+  0xF0, 0xA8, 0xF0, 0xA8, 0xF0, 0xA8, 0xF0, 0xA8, 0xF0, 0x9A, 0xF0, 0x8A,
+  0xF0, 0x8A, 0xF0, 0x84, 0x24, 0xF0, 0x75, 0x25, 0xF0, 0x65, 0x25, 0xF0,
+  0x55, 0x45, 0xF0, 0x45, 0x55, 0xF0, 0x25, 0x66, 0xF6, 0x76, 0xD6, 0x97,
+  0x88, 0xBF, 0x06, 0xDF, 0x03, 0xF0, 0x2F, 0xF0, 0x69, 0xC0, 0xF0, 0x35,
+  0xF0, 0xC5, 0xF0, 0xC5, 0xF0, 0xC4, 0xF0, 0xD4, 0xF0, 0xD4, 0xF0, 0xF0,
+  0xF0, 0xF0, 0xF0, 0xF0, 0x49, 0xF0, 0x6F, 0xF0, 0x1F, 0x03, 0xEF, 0x06,
+  0xB7, 0x88, 0x96, 0xD6, 0x76, 0xF6, 0x65, 0xF0, 0x25, 0x55, 0xF0, 0x45,
+  0x35, 0xF0, 0x55, 0x35, 0xF0, 0x65, 0x24, 0xF0, 0x75, 0x24, 0xF0, 0x84,
+  0x15, 0xF0, 0x84, 0x15, 0xF0, 0x89, 0xF0, 0x99, 0xF0, 0xA8, 0xF0, 0xA8,
+  0xF0, 0xA8, 0xF0, 0xA8, 0xF0, 0x9A, 0xF0, 0x8A, 0xF0, 0x8A, 0xF0, 0x84,
+  0x24, 0xF0, 0x75, 0x25, 0xF0, 0x65, 0x25, 0xF0, 0x55, 0x45, 0xF0, 0x45,
+  0x55, 0xF0, 0x25, 0x66, 0xF6, 0x76, 0xD6, 0x97, 0x88, 0xBF, 0x06, 0xDF,
+  0x03, 0xF0, 0x2F, 0xF0, 0x69, 0xC0, 0xE5, 0xF0, 0xC7, 0xF0, 0xA9, 0xF0,
+  0x94, 0x14, 0xF0, 0x84, 0x34, 0xF0, 0x63, 0x73, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xF0, 0xD9, 0xF0, 0x6F, 0xF0, 0x1F, 0x03, 0xEF, 0x06, 0xB7, 0x88, 0x96,
+  0xD6, 0x76, 0xF6, 0x65, 0xF0, 0x25, 0x55, 0xF0, 0x45, 0x35, 0xF0, 0x55,
+  0x35, 0xF0, 0x65, 0x24, 0xF0, 0x75, 0x24, 0xF0, 0x84, 0x15, 0xF0, 0x84,
+  0x15, 0xF0, 0x89, 0xF0, 0x99, 0xF0, 0xA8, 0xF0, 0xA8, 0xF0, 0xA8, 0xF0,
+  0xA8, 0xF0, 0x9A, 0xF0, 0x8A, 0xF0, 0x8A, 0xF0, 0x84, 0x24, 0xF0, 0x75,
+  0x25, 0xF0, 0x65, 0x25, 0xF0, 0x55, 0x45, 0xF0, 0x45, 0x55, 0xF0, 0x25,
+  0x66, 0xF6, 0x76, 0xD6, 0x97, 0x88, 0xBF, 0x06, 0xDF, 0x03, 0xF0, 0x2F,
+  0xF0, 0x69, 0xC0, 0xB3, 0x73, 0xF0, 0x47, 0x33, 0xF0, 0x5D, 0xF0, 0x43,
+  0x28, 0xF0, 0x53, 0x54, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF9, 0xF0, 0x6F,
+  0xF0, 0x1F, 0x03, 0xEF, 0x06, 0xB7, 0x88, 0x96, 0xD6, 0x76, 0xF6, 0x65,
+  0xF0, 0x25, 0x55, 0xF0, 0x45, 0x35, 0xF0, 0x55, 0x35, 0xF0, 0x65, 0x24,
+  0xF0, 0x75, 0x24, 0xF0, 0x84, 0x15, 0xF0, 0x84, 0x15, 0xF0, 0x89, 0xF0,
+  0x99, 0xF0, 0xA8, 0xF0, 0xA8, 0xF0, 0xA8, 0xF0, 0xA8, 0xF0, 0x9A, 0xF0,
+  0x8A, 0xF0, 0x8A, 0xF0, 0x84, 0x24, 0xF0, 0x75, 0x25, 0xF0, 0x65, 0x25,
+  0xF0, 0x55, 0x45, 0xF0, 0x45, 0x55, 0xF0, 0x25, 0x66, 0xF6, 0x76, 0xD6,
+  0x97, 0x88, 0xBF, 0x06, 0xDF, 0x03, 0xF0, 0x2F, 0xF0, 0x69, 0xC0, 0xA5,
+  0x35, 0xF0, 0x55, 0x35, 0xF0, 0x55, 0x35, 0xF0, 0x55, 0x35, 0xF0, 0x55,
+  0x35, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xD9, 0xF0, 0x6F, 0xF0, 0x1F, 0x03,
+  0xEF, 0x06, 0xB7, 0x88, 0x96, 0xD6, 0x76, 0xF6, 0x65, 0xF0, 0x25, 0x55,
+  0xF0, 0x45, 0x35, 0xF0, 0x55, 0x35, 0xF0, 0x65, 0x24, 0xF0, 0x75, 0x24,
+  0xF0, 0x84, 0x15, 0xF0, 0x84, 0x15, 0xF0, 0x89, 0xF0, 0x99, 0xF0, 0xA8,
+  0xF0, 0xA8, 0xF0, 0xA8, 0xF0, 0xA8, 0xF0, 0x9A, 0xF0, 0x8A, 0xF0, 0x8A,
+  0xF0, 0x84, 0x24, 0xF0, 0x75, 0x25, 0xF0, 0x65, 0x25, 0xF0, 0x55, 0x45,
+  0xF0, 0x45, 0x55, 0xF0, 0x25, 0x66, 0xF6, 0x76, 0xD6, 0x97, 0x88, 0xBF,
+  0x06, 0xDF, 0x03, 0xF0, 0x2F, 0xF0, 0x69, 0xC0, 0x21, 0xD1, 0x33, 0xB3,
+  0x24, 0x95, 0x24, 0x75, 0x44, 0x55, 0x64, 0x35, 0x84, 0x15, 0xA8, 0xC6,
+  0xD5, 0xD7, 0xB9, 0x95, 0x24, 0x75, 0x44, 0x55, 0x64, 0x35, 0x84, 0x24,
+  0xA3, 0x32, 0xC1, 0x20, 0xF0, 0xF0, 0xF9, 0x93, 0x9F, 0x54, 0x7F, 0x03,
+  0x34, 0x7F, 0x0A, 0x77, 0x8A, 0x76, 0xD6, 0x76, 0xF6, 0x65, 0xF0, 0x16,
+  0x55, 0xF0, 0x18, 0x35, 0xF0, 0x13, 0x15, 0x35, 0xF4, 0x25, 0x24, 0xF4,
+  0x35, 0x15, 0xE4, 0x54, 0x15, 0xD4, 0x64, 0x15, 0xC4, 0x79, 0xD3, 0x89,
+  0xC3, 0xA8, 0xB3, 0xB8, 0xA3, 0xC8, 0x93, 0xD8, 0x83, 0xDA, 0x63, 0xEA,
+  0x54, 0xE5, 0x14, 0x44, 0xF4, 0x24, 0x34, 0xF5, 0x25, 0x14, 0xF0, 0x15,
+  0x34, 0x13, 0xF0, 0x15, 0x47, 0xF0, 0x25, 0x55, 0xF0, 0x25, 0x66, 0xF6,
+  0x67, 0xD6, 0x6A, 0x88, 0x63, 0x2F, 0x06, 0x64, 0x3F, 0x04, 0x73, 0x6F,
+  0xA1, 0xA9, 0xC0, 0x76, 0xF0, 0x65, 0xF0, 0x84, 0xF0, 0x84, 0xF0, 0x84,
+  0xF0, 0x93, 0xF0, 0xF0, 0xF0, 0xF0, 0x14, 0xF0, 0x38, 0xF0, 0x38, 0xF0,
+  0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0,
+  0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0,
+  0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0,
+  0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x39, 0xF0,
+  0x1A, 0xF0, 0x14, 0x25, 0xE5, 0x26, 0xC6, 0x37, 0x87, 0x5F, 0x05, 0x7F,
+  0x03, 0xAE, 0xE9, 0x90, 0xE5, 0xF0, 0x55, 0xF0, 0x55, 0xF0, 0x54, 0xF0,
+  0x64, 0xF0, 0x64, 0xF0, 0xF0, 0xF0, 0xF0, 0x54, 0xF0, 0x38, 0xF0, 0x38,
+  0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38,
+  0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38,
+  0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38,
+  0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x39,
+  0xF0, 0x1A, 0xF0, 0x14, 0x25, 0xE5, 0x26, 0xC6, 0x37, 0x87, 0x5F, 0x05,
+  0x7F, 0x03, 0xAE, 0xE9, 0x90, 0xA6, 0xF0, 0x56, 0xF0, 0x48, 0xF0, 0x24,
+  0x24, 0xF4, 0x44, 0xE3, 0x64, 0xF0, 0xF0, 0xF0, 0xD4, 0xF0, 0x38, 0xF0,
+  0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0,
+  0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0,
+  0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0,
+  0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0,
+  0x39, 0xF0, 0x1A, 0xF0, 0x14, 0x25, 0xE5, 0x26, 0xC6, 0x37, 0x87, 0x5F,
+  0x05, 0x7F, 0x03, 0xAE, 0xE9, 0x90, 0x75, 0x35, 0xD5, 0x35, 0xD5, 0x35,
+  0xD5, 0x35, 0xD5, 0x35, 0xF0, 0xF0, 0xF0, 0xD4, 0xF0, 0x38, 0xF0, 0x38,
+  0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38,
+  0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38,
+  0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38,
+  0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x39,
+  0xF0, 0x1A, 0xF0, 0x14, 0x25, 0xE5, 0x26, 0xC6, 0x37, 0x87, 0x5F, 0x05,
+  0x7F, 0x03, 0xAE, 0xE9, 0x90, 0xF0, 0x15, 0xF0, 0x95, 0xF0, 0x95, 0xF0,
+  0x94, 0xF0, 0xA4, 0xF0, 0xA4, 0xF0, 0xF0, 0xF0, 0xF0, 0xF5, 0xF0, 0x55,
+  0x15, 0xF0, 0x35, 0x26, 0xF0, 0x16, 0x35, 0xF0, 0x15, 0x55, 0xE5, 0x65,
+  0xE5, 0x75, 0xC5, 0x86, 0xA5, 0xA5, 0xA5, 0xB5, 0x85, 0xC6, 0x75, 0xD5,
+  0x65, 0xF5, 0x54, 0xF0, 0x15, 0x45, 0xF0, 0x25, 0x25, 0xF0, 0x45, 0x15,
+  0xF0, 0x4A, 0xF0, 0x68, 0xF0, 0x78, 0xF0, 0x86, 0xF0, 0xA4, 0xF0, 0xB4,
+  0xF0, 0xB4, 0xF0, 0xB4, 0xF0, 0xB4, 0xF0, 0xB4, 0xF0, 0xB4, 0xF0, 0xB4,
+  0xF0, 0xB4, 0xF0, 0xB4, 0xF0, 0xB4, 0xF0, 0xB4, 0xF0, 0xB4, 0xF0, 0xB4,
+  0xD0, 0x04, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54,
+  0xF0, 0x5F, 0x03, 0x6F, 0x05, 0x4F, 0x06, 0x3F, 0x07, 0x24, 0xD6, 0x14,
+  0xEA, 0xF9, 0xF9, 0xF0, 0x18, 0xF0, 0x18, 0xF0, 0x18, 0xF9, 0xF9, 0xEA,
+  0xD6, 0x1F, 0x07, 0x2F, 0x07, 0x2F, 0x05, 0x4F, 0x03, 0x64, 0xF0, 0x54,
+  0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54,
+  0xF0, 0x54, 0xF0, 0x50, 0x92, 0xF0, 0x1B, 0x9E, 0x7F, 0x01, 0x56, 0x66,
+  0x45, 0x95, 0x25, 0xA5, 0x24, 0xC4, 0x24, 0xC4, 0x24, 0xC4, 0x24, 0xC4,
+  0x24, 0xC4, 0x24, 0xB5, 0x24, 0xB4, 0x34, 0x96, 0x34, 0x59, 0x44, 0x58,
+  0x54, 0x5A, 0x34, 0x6A, 0x24, 0xB6, 0x14, 0xC5, 0x14, 0xD9, 0xD9, 0xE8,
+  0xE8, 0xE8, 0xE8, 0xD9, 0xD4, 0x14, 0xC5, 0x14, 0xC5, 0x14, 0xA6, 0x24,
+  0x4B, 0x34, 0x4A, 0x44, 0x49, 0xD7, 0x70, 0x65, 0xF0, 0x54, 0xF0, 0x64,
+  0xF0, 0x64, 0xF0, 0x63, 0xF0, 0x73, 0xF0, 0x73, 0xF0, 0xF0, 0xF0, 0xF0,
+  0x49, 0xDD, 0xAF, 0x8F, 0x02, 0x65, 0x85, 0x64, 0xA4, 0x64, 0xB4, 0x45,
+  0xB4, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x45, 0xEA, 0x9F, 0x6F, 0x03, 0x5B,
+  0x44, 0x47, 0x94, 0x45, 0xB4, 0x44, 0xC4, 0x35, 0xC4, 0x34, 0xC5, 0x35,
+  0xB5, 0x44, 0xA6, 0x45, 0x87, 0x48, 0x1C, 0x4E, 0x17, 0x3B, 0x37, 0x57,
+  0x75, 0xC5, 0xF0, 0x35, 0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x53,
+  0xF0, 0x53, 0xF0, 0xF0, 0xF0, 0xF0, 0x89, 0xDD, 0xAF, 0x8F, 0x02, 0x65,
+  0x85, 0x64, 0xA4, 0x64, 0xB4, 0x45, 0xB4, 0xF0, 0x54, 0xF0, 0x54, 0xF0,
+  0x45, 0xEA, 0x9F, 0x6F, 0x03, 0x5B, 0x44, 0x47, 0x94, 0x45, 0xB4, 0x44,
+  0xC4, 0x35, 0xC4, 0x34, 0xC5, 0x35, 0xB5, 0x44, 0xA6, 0x45, 0x87, 0x48,
+  0x1C, 0x4E, 0x17, 0x3B, 0x37, 0x57, 0x75, 0x96, 0xF0, 0x36, 0xF0, 0x28,
+  0xF4, 0x23, 0xF3, 0x43, 0xD4, 0x44, 0xC3, 0x63, 0xF0, 0xF0, 0xF0, 0xF0,
+  0x19, 0xDD, 0xAF, 0x8F, 0x02, 0x65, 0x85, 0x64, 0xA4, 0x64, 0xB4, 0x45,
+  0xB4, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x45, 0xEA, 0x9F, 0x6F, 0x03, 0x5B,
+  0x44, 0x47, 0x94, 0x45, 0xB4, 0x44, 0xC4, 0x35, 0xC4, 0x34, 0xC5, 0x35,
+  0xB5, 0x44, 0xA6, 0x45, 0x87, 0x48, 0x1C, 0x4E, 0x17, 0x3B, 0x37, 0x57,
+  0x75, 0x74, 0x53, 0xB7, 0x33, 0xAE, 0xA3, 0x28, 0xB2, 0x64, 0xF0, 0xF0,
+  0xF0, 0xF0, 0xF0, 0xB9, 0xDD, 0xAF, 0x8F, 0x02, 0x65, 0x85, 0x64, 0xA4,
+  0x64, 0xB4, 0x45, 0xB4, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x45, 0xEA, 0x9F,
+  0x6F, 0x03, 0x5B, 0x44, 0x47, 0x94, 0x45, 0xB4, 0x44, 0xC4, 0x35, 0xC4,
+  0x34, 0xC5, 0x35, 0xB5, 0x44, 0xA6, 0x45, 0x87, 0x48, 0x1C, 0x4E, 0x17,
+  0x3B, 0x37, 0x57, 0x75, 0x55, 0x45, 0xA5, 0x45, 0xA5, 0x45, 0xA5, 0x45,
+  0xA5, 0x45, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x39, 0xDD, 0xAF,
+  0x8F, 0x02, 0x65, 0x85, 0x64, 0xA4, 0x64, 0xB4, 0x45, 0xB4, 0xF0, 0x54,
+  0xF0, 0x54, 0xF0, 0x45, 0xEA, 0x9F, 0x6F, 0x03, 0x5B, 0x44, 0x47, 0x94,
+  0x45, 0xB4, 0x44, 0xC4, 0x35, 0xC4, 0x34, 0xC5, 0x35, 0xB5, 0x44, 0xA6,
+  0x45, 0x87, 0x48, 0x1C, 0x4E, 0x17, 0x3B, 0x37, 0x57, 0x75, 0xA4, 0xF0,
+  0x37, 0xF0, 0x28, 0xF4, 0x24, 0xE3, 0x43, 0xE3, 0x43, 0xE4, 0x24, 0xF8,
+  0xF0, 0x17, 0xF0, 0x44, 0xF0, 0xF0, 0xB9, 0xDD, 0xAF, 0x8F, 0x02, 0x65,
+  0x85, 0x64, 0xA4, 0x64, 0xB4, 0x45, 0xB4, 0xF0, 0x54, 0xF0, 0x54, 0xF0,
+  0x45, 0xEA, 0x9F, 0x6F, 0x03, 0x5B, 0x44, 0x47, 0x94, 0x45, 0xB4, 0x44,
+  0xC4, 0x35, 0xC4, 0x34, 0xC5, 0x35, 0xB5, 0x44, 0xA6, 0x45, 0x87, 0x48,
+  0x1C, 0x4E, 0x17, 0x3B, 0x37, 0x57, 0x75, 0x78, 0x97, 0xDC, 0x5B, 0xAE,
+  0x3E, 0x7F, 0x01, 0x1F, 0x01, 0x55, 0x89, 0x75, 0x54, 0xA7, 0x95, 0x44,
+  0xB5, 0xB4, 0x44, 0xB5, 0xB5, 0xF0, 0x34, 0xD4, 0xF0, 0x34, 0xD4, 0xF0,
+  0x25, 0xD4, 0xF6, 0xE4, 0x8F, 0x0F, 0x01, 0x5F, 0x0F, 0x04, 0x4C, 0x2F,
+  0x07, 0x27, 0x83, 0xF0, 0x55, 0xB3, 0xF0, 0x54, 0xC4, 0xF0, 0x35, 0xC4,
+  0xD4, 0x14, 0xC5, 0xD4, 0x15, 0xB6, 0xB4, 0x34, 0xA8, 0x95, 0x35, 0x75,
+  0x15, 0x76, 0x38, 0x17, 0x2F, 0x02, 0x5E, 0x4F, 0x7B, 0x8B, 0xB7, 0xC7,
+  0x80, 0x87, 0xCB, 0x8E, 0x7F, 0x55, 0x75, 0x35, 0x94, 0x34, 0xA5, 0x15,
+  0xB4, 0x14, 0xC4, 0x14, 0xF0, 0x24, 0xF0, 0x15, 0xF0, 0x15, 0xF0, 0x14,
+  0xF0, 0x24, 0xF0, 0x25, 0xF0, 0x24, 0xF0, 0x24, 0xC4, 0x14, 0xC4, 0x15,
+  0xB4, 0x24, 0xA5, 0x25, 0x94, 0x45, 0x75, 0x4F, 0x01, 0x6E, 0x9B, 0xC7,
+  0xF2, 0xF0, 0x45, 0xF7, 0xF0, 0x34, 0xF0, 0x24, 0xF0, 0x24, 0xA2, 0x44,
+  0xAB, 0xD6, 0x80, 0x65, 0xF0, 0x45, 0xF0, 0x44, 0xF0, 0x54, 0xF0, 0x53,
+  0xF0, 0x63, 0xF0, 0x63, 0xF0, 0xF0, 0xF0, 0xF0, 0x27, 0xEB, 0xBE, 0x8F,
+  0x01, 0x65, 0x75, 0x55, 0x95, 0x44, 0xB4, 0x35, 0xB5, 0x24, 0xD4, 0x24,
+  0xD4, 0x24, 0xD4, 0x24, 0xD4, 0x1F, 0x0F, 0x0F, 0x0F, 0x0E, 0xF0, 0x44,
+  0xF0, 0x44, 0xF0, 0x44, 0xD4, 0x24, 0xD4, 0x34, 0xB5, 0x35, 0x95, 0x55,
+  0x76, 0x5F, 0x02, 0x7F, 0xAC, 0xD7, 0x80, 0xC6, 0xF0, 0x25, 0xF0, 0x25,
+  0xF0, 0x34, 0xF0, 0x34, 0xF0, 0x34, 0xF0, 0x43, 0xF0, 0xF0, 0xF0, 0xF0,
+  0x57, 0xEB, 0xBE, 0x8F, 0x01, 0x65, 0x75, 0x55, 0x95, 0x44, 0xB4, 0x35,
+  0xB5, 0x24, 0xD4, 0x24, 0xD4, 0x24, 0xD4, 0x24, 0xD4, 0x1F, 0x0F, 0x0F,
+  0x0F, 0x0E, 0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x44, 0xD4, 0x24, 0xD4, 0x34,
+  0xB5, 0x35, 0x95, 0x55, 0x76, 0x5F, 0x02, 0x7F, 0xAC, 0xD7, 0x80, 0x96,
+  0xF0, 0x26, 0xF0, 0x18, 0xF3, 0x23, 0xE3, 0x43, 0xC4, 0x44, 0xB3, 0x63,
+  0xF0, 0xF0, 0xF0, 0xE7, 0xEB, 0xBE, 0x8F, 0x01, 0x65, 0x75, 0x55, 0x95,
+  0x44, 0xB4, 0x35, 0xB5, 0x24, 0xD4, 0x24, 0xD4, 0x24, 0xD4, 0x24, 0xD4,
+  0x1F, 0x0F, 0x0F, 0x0F, 0x0E, 0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x44, 0xD4,
+  0x24, 0xD4, 0x34, 0xB5, 0x35, 0x95, 0x55, 0x76, 0x5F, 0x02, 0x7F, 0xAC,
+  0xD7, 0x80, 0x55, 0x45, 0x95, 0x45, 0x95, 0x45, 0x95, 0x45, 0x95, 0x45,
+  0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE7, 0xEB, 0xBE, 0x8F, 0x01, 0x65,
+  0x75, 0x55, 0x95, 0x44, 0xB4, 0x35, 0xB5, 0x24, 0xD4, 0x24, 0xD4, 0x24,
+  0xD4, 0x24, 0xD4, 0x1F, 0x0F, 0x0F, 0x0F, 0x0E, 0xF0, 0x44, 0xF0, 0x44,
+  0xF0, 0x44, 0xD4, 0x24, 0xD4, 0x34, 0xB5, 0x35, 0x95, 0x55, 0x76, 0x5F,
+  0x02, 0x7F, 0xAC, 0xD7, 0x80, 0x06, 0x55, 0x65, 0x65, 0x73, 0x83, 0x83,
+  0xF0, 0xF0, 0x34, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+  0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+  0x64, 0x64, 0x64, 0x30, 0x45, 0x35, 0x35, 0x44, 0x44, 0x53, 0x53, 0xF0,
+  0xF0, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
+  0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
+  0x54, 0x54, 0x30, 0x55, 0x86, 0x78, 0x63, 0x24, 0x44, 0x33, 0x34, 0x53,
+  0x23, 0x64, 0xF0, 0xF0, 0xF0, 0x24, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4,
+  0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4,
+  0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0x50, 0x05, 0x4A, 0x4A, 0x4A, 0x4A,
+  0x45, 0xF0, 0xF0, 0xF0, 0xF0, 0xF4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4,
+  0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4,
+  0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0x50, 0xF0, 0xC3, 0x71, 0xB6, 0x34,
+  0xCA, 0xE7, 0xF8, 0xDB, 0xC4, 0x36, 0xB1, 0x66, 0xF0, 0x35, 0xEA, 0xAE,
+  0x8F, 0x01, 0x6F, 0x02, 0x65, 0x76, 0x45, 0x95, 0x44, 0xB5, 0x25, 0xB5,
+  0x24, 0xD4, 0x24, 0xD4, 0x24, 0xD4, 0x15, 0xD9, 0xF8, 0xF9, 0xE9, 0xD5,
+  0x14, 0xD4, 0x24, 0xD4, 0x24, 0xD4, 0x25, 0xB5, 0x34, 0xB4, 0x45, 0x95,
+  0x55, 0x75, 0x6F, 0x02, 0x7F, 0xAC, 0xD7, 0x80, 0x54, 0x62, 0x67, 0x33,
+  0x5E, 0x53, 0x28, 0x63, 0x54, 0xF0, 0xF0, 0xF0, 0xF0, 0xA6, 0x43, 0x4A,
+  0x23, 0x3C, 0x13, 0x25, 0x1B, 0x13, 0x7B, 0x99, 0xA9, 0xA8, 0xC7, 0xC7,
+  0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7,
+  0xC7, 0xC7, 0xC7, 0xC3, 0x65, 0xF0, 0x45, 0xF0, 0x44, 0xF0, 0x54, 0xF0,
+  0x54, 0xF0, 0x53, 0xF0, 0x63, 0xF0, 0xF0, 0xF0, 0xF0, 0x27, 0xEB, 0xAF,
+  0x7F, 0x02, 0x65, 0x75, 0x55, 0x95, 0x44, 0xB4, 0x35, 0xB5, 0x24, 0xD4,
+  0x24, 0xD4, 0x24, 0xD4, 0x15, 0xD9, 0xF8, 0xF9, 0xE9, 0xD5, 0x14, 0xD4,
+  0x24, 0xD4, 0x24, 0xD4, 0x25, 0xB5, 0x34, 0xB4, 0x45, 0x95, 0x55, 0x75,
+  0x6F, 0x02, 0x7F, 0xAB, 0xE7, 0x80, 0xC5, 0xF0, 0x25, 0xF0, 0x34, 0xF0,
+  0x34, 0xF0, 0x43, 0xF0, 0x43, 0xF0, 0x43, 0xF0, 0xF0, 0xF0, 0xF0, 0x67,
+  0xEB, 0xAF, 0x7F, 0x02, 0x65, 0x75, 0x55, 0x95, 0x44, 0xB4, 0x35, 0xB5,
+  0x24, 0xD4, 0x24, 0xD4, 0x24, 0xD4, 0x15, 0xD9, 0xF8, 0xF9, 0xE9, 0xD5,
+  0x14, 0xD4, 0x24, 0xD4, 0x24, 0xD4, 0x25, 0xB5, 0x34, 0xB4, 0x45, 0x95,
+  0x55, 0x75, 0x6F, 0x02, 0x7F, 0xAB, 0xE7, 0x80, 0x95, 0xF0, 0x27, 0xF0,
+  0x17, 0xF4, 0x14, 0xD4, 0x34, 0xC3, 0x53, 0xB3, 0x73, 0xF0, 0xF0, 0x67,
+  0xEB, 0xAF, 0x7F, 0x02, 0x65, 0x75, 0x55, 0x95, 0x44, 0xB4, 0x35, 0xB5,
+  0x24, 0xD4, 0x24, 0xD4, 0x24, 0xD4, 0x15, 0xD9, 0xF8, 0xF9, 0xE9, 0xD5,
+  0x14, 0xD4, 0x24, 0xD4, 0x24, 0xD4, 0x25, 0xB5, 0x34, 0xB4, 0x45, 0x95,
+  0x55, 0x75, 0x6F, 0x02, 0x7F, 0xAB, 0xE7, 0x80, 0x73, 0x63, 0xA7, 0x33,
+  0x9D, 0xA3, 0x28, 0x93, 0x64, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x87, 0xEB,
+  0xAF, 0x7F, 0x02, 0x65, 0x75, 0x55, 0x95, 0x44, 0xB4, 0x35, 0xB5, 0x24,
+  0xD4, 0x24, 0xD4, 0x24, 0xD4, 0x15, 0xD9, 0xF8, 0xF9, 0xE9, 0xD5, 0x14,
+  0xD4, 0x24, 0xD4, 0x24, 0xD4, 0x25, 0xB5, 0x34, 0xB4, 0x45, 0x95, 0x55,
+  0x75, 0x6F, 0x02, 0x7F, 0xAB, 0xE7, 0x80, 0x55, 0x35, 0xA5, 0x35, 0xA5,
+  0x35, 0xA5, 0x35, 0xA5, 0x35, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x77, 0xEB,
+  0xAF, 0x7F, 0x02, 0x65, 0x75, 0x55, 0x95, 0x44, 0xB4, 0x35, 0xB5, 0x24,
+  0xD4, 0x24, 0xD4, 0x24, 0xD4, 0x15, 0xD9, 0xF8, 0xF9, 0xE9, 0xD5, 0x14,
+  0xD4, 0x24, 0xD4, 0x24, 0xD4, 0x25, 0xB5, 0x34, 0xB4, 0x45, 0x95, 0x55,
+  0x75, 0x6F, 0x02, 0x7F, 0xAB, 0xE7, 0x80, 0x95, 0xF0, 0x35, 0xF0, 0x35,
+  0xF0, 0x35, 0xF0, 0x35, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xBF, 0x0F,
+  0x0F, 0x0F, 0x09, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x45,
+  0xF0, 0x35, 0xF0, 0x35, 0xF0, 0x35, 0xF0, 0x35, 0x90, 0x97, 0x71, 0x7B,
+  0x42, 0x5F, 0x12, 0x5F, 0x04, 0x55, 0x76, 0x55, 0x95, 0x45, 0xA5, 0x45,
+  0x97, 0x34, 0xA2, 0x14, 0x34, 0x92, 0x24, 0x25, 0x83, 0x24, 0x24, 0x83,
+  0x34, 0x24, 0x73, 0x45, 0x14, 0x63, 0x55, 0x14, 0x53, 0x65, 0x14, 0x52,
+  0x74, 0x25, 0x32, 0x84, 0x34, 0x23, 0x84, 0x34, 0x13, 0x94, 0x37, 0x95,
+  0x36, 0xA4, 0x55, 0x95, 0x65, 0x75, 0x6F, 0x03, 0x52, 0x1F, 0x53, 0x3B,
+  0x72, 0x67, 0x80, 0x35, 0xF5, 0xF5, 0xF4, 0xF0, 0x14, 0xF0, 0x14, 0xF0,
+  0x13, 0xF0, 0xF0, 0xF0, 0xF0, 0x44, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7,
+  0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xB8, 0xB8, 0xB8,
+  0xB8, 0xA9, 0x9B, 0x77, 0x17, 0x16, 0x13, 0x1D, 0x23, 0x2B, 0x33, 0x47,
+  0x80, 0xB5, 0xD5, 0xE4, 0xE4, 0xE4, 0xF3, 0xF3, 0xF0, 0xF0, 0xF0, 0xF0,
+  0x64, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7,
+  0xC7, 0xC7, 0xC7, 0xC7, 0xB8, 0xB8, 0xB8, 0xB8, 0xA9, 0x9B, 0x77, 0x17,
+  0x16, 0x13, 0x1D, 0x23, 0x2B, 0x33, 0x47, 0x80, 0x75, 0xD7, 0xC7, 0xB4,
+  0x14, 0x94, 0x34, 0x83, 0x53, 0x73, 0x73, 0xF0, 0xF0, 0xB4, 0xC7, 0xC7,
+  0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7,
+  0xC7, 0xB8, 0xB8, 0xB8, 0xB8, 0xA9, 0x9B, 0x77, 0x17, 0x16, 0x13, 0x1D,
+  0x23, 0x2B, 0x33, 0x47, 0x80, 0x35, 0x35, 0x65, 0x35, 0x65, 0x35, 0x65,
+  0x35, 0x65, 0x35, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x44, 0xC7, 0xC7, 0xC7,
+  0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7,
+  0xB8, 0xB8, 0xB8, 0xB8, 0xA9, 0x9B, 0x77, 0x17, 0x16, 0x13, 0x1D, 0x23,
+  0x2B, 0x33, 0x47, 0x80, 0xD5, 0xF0, 0x15, 0xF0, 0x15, 0xF0, 0x24, 0xF0,
+  0x24, 0xF0, 0x24, 0xF0, 0x33, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x24, 0xD4,
+  0x14, 0xC4, 0x24, 0xC4, 0x34, 0xB4, 0x34, 0xA4, 0x44, 0xA4, 0x54, 0x85,
+  0x54, 0x84, 0x64, 0x84, 0x74, 0x65, 0x74, 0x64, 0x84, 0x64, 0x94, 0x44,
+  0xA4, 0x44, 0xA4, 0x44, 0xB4, 0x24, 0xC4, 0x24, 0xC4, 0x24, 0xD8, 0xE8,
+  0xE7, 0xF0, 0x16, 0xF0, 0x16, 0xF0, 0x15, 0xF0, 0x34, 0xF0, 0x34, 0xF0,
+  0x24, 0xF0, 0x34, 0xF0, 0x25, 0xF0, 0x24, 0xF0, 0x25, 0xD8, 0xE8, 0xE7,
+  0xF5, 0xF0, 0x04, 0xF0, 0x34, 0xF0, 0x34, 0xF0, 0x34, 0xF0, 0x34, 0xF0,
+  0x34, 0xF0, 0x34, 0xF0, 0x34, 0xF0, 0x34, 0x46, 0x84, 0x2B, 0x54, 0x1D,
+  0x4F, 0x04, 0x38, 0x66, 0x26, 0x95, 0x25, 0xB4, 0x25, 0xB5, 0x15, 0xC4,
+  0x14, 0xD4, 0x14, 0xD9, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xD9, 0xD4, 0x14,
+  0xD4, 0x15, 0xB5, 0x16, 0xA5, 0x16, 0x95, 0x28, 0x66, 0x2F, 0x04, 0x34,
+  0x1D, 0x44, 0x2B, 0x54, 0x47, 0x74, 0xF0, 0x34, 0xF0, 0x34, 0xF0, 0x34,
+  0xF0, 0x34, 0xF0, 0x34, 0xF0, 0x34, 0xF0, 0x34, 0xF0, 0x34, 0xF0, 0x30,
+  0x55, 0x45, 0x85, 0x45, 0x85, 0x45, 0x85, 0x45, 0x85, 0x45, 0xF0, 0xF0,
+  0xF0, 0xF0, 0xF0, 0xF0, 0x24, 0xD4, 0x14, 0xC4, 0x24, 0xC4, 0x34, 0xB4,
+  0x34, 0xA4, 0x44, 0xA4, 0x54, 0x85, 0x54, 0x84, 0x64, 0x84, 0x74, 0x65,
+  0x74, 0x64, 0x84, 0x64, 0x94, 0x44, 0xA4, 0x44, 0xA4, 0x44, 0xB4, 0x24,
+  0xC4, 0x24, 0xC4, 0x24, 0xD8, 0xE8, 0xE7, 0xF0, 0x16, 0xF0, 0x16, 0xF0,
+  0x15, 0xF0, 0x34, 0xF0, 0x34, 0xF0, 0x24, 0xF0, 0x34, 0xF0, 0x25, 0xF0,
+  0x24, 0xF0, 0x25, 0xD8, 0xE8, 0xE7, 0xF5, 0xF0 };
+
+constexpr GFXglyph FreeSans_RLE_24pt8bGlyphs[] PROGMEM = {
+  {     0,   1,   1,  12,    0,    0 },   // 0x20 ' '
+  {     1,   4,  34,  16,    6,  -33 },   // 0x21 '!'
+  {    15,  12,  12,  16,    2,  -33 },   // 0x22 '"'
+  {    33,  24,  33,  26,    1,  -31 },   // 0x23 '#'
+  {   100,  22,  43,  26,    2,  -36 },   // 0x24 '$'
+  {   185,  39,  35,  42,    1,  -33 },   // 0x25 '%'
+  {   290,  28,  35,  31,    2,  -33 },   // 0x26 '&'
+  {   366,   5,  12,   9,    2,  -33 },   // 0x27 '''
+  {   376,  11,  44,  16,    3,  -33 },   // 0x28 '('
+  {   421,  10,  44,  16,    2,  -33 },   // 0x29 ')'
+  {   466,  14,  14,  18,    2,  -33 },   // 0x2A '*'
+  {   486,  23,  23,  27,    2,  -21 },   // 0x2B '+'
+  {   530,   5,  12,  13,    4,   -4 },   // 0x2C ','
+  {   540,  11,   3,  16,    2,  -13 },   // 0x2D '-'
+  {   543,   5,   5,  12,    4,   -4 },   // 0x2E '.'
+  {   545,  13,  35,  13,    0,  -33 },   // 0x2F '/'
+  {   581,  22,  35,  26,    2,  -33 },   // 0x30 '0'
+  {   634,  11,  34,  26,    5,  -33 },   // 0x31 '1'
+  {   667,  22,  34,  26,    2,  -33 },   // 0x32 '2'
+  {   720,  23,  35,  26,    1,  -33 },   // 0x33 '3'
+  {   781,  23,  34,  26,    1,  -33 },   // 0x34 '4'
+  {   845,  22,  35,  26,    2,  -33 },   // 0x35 '5'
+  {   911,  22,  35,  26,    2,  -33 },   // 0x36 '6'
+  {   971,  22,  34,  26,    2,  -33 },   // 0x37 '7'
+  {  1038,  22,  35,  26,    2,  -33 },   // 0x38 '8'
+  {  1095,  22,  35,  26,    2,  -33 },   // 0x39 '9'
+  {  1155,   5,  25,  12,    4,  -24 },   // 0x3A ':'
+  {  1163,   5,  32,  12,    4,  -24 },   // 0x3B ';'
+  {  1179,  23,  23,  27,    2,  -21 },   // 0x3C '<'
+  {  1217,  23,  11,  27,    2,  -15 },   // 0x3D '='
+  {  1234,  23,  23,  27,    2,  -21 },   // 0x3E '>'
+  {  1273,  20,  35,  26,    4,  -34 },   // 0x3F '?'
+  {  1315,  43,  42,  48,    2,  -34 },   // 0x40 '@'
+  {  1453,  30,  34,  31,    1,  -33 },   // 0x41 'A'
+  {  1534,  25,  34,  31,    4,  -33 },   // 0x42 'B'
+  {  1602,  29,  36,  33,    2,  -34 },   // 0x43 'C'
+  {  1683,  27,  34,  33,    4,  -33 },   // 0x44 'D'
+  {  1762,  24,  34,  30,    4,  -33 },   // 0x45 'E'
+  {  1829,  23,  34,  28,    4,  -33 },   // 0x46 'F'
+  {  1896,  31,  36,  36,    2,  -34 },   // 0x47 'G'
+  {  1980,  26,  34,  34,    4,  -33 },   // 0x48 'H'
+  {  2048,   4,  34,  13,    5,  -33 },   // 0x49 'I'
+  {  2058,  19,  35,  25,    2,  -33 },   // 0x4A 'J'
+  {  2097,  27,  34,  32,    4,  -33 },   // 0x4B 'K'
+  {  2170,  21,  34,  26,    4,  -33 },   // 0x4C 'L'
+  {  2236,  32,  34,  40,    4,  -33 },   // 0x4D 'M'
+  {  2328,  27,  34,  34,    4,  -33 },   // 0x4E 'N'
+  {  2388,  33,  36,  37,    2,  -34 },   // 0x4F 'O'
+  {  2474,  24,  34,  31,    4,  -33 },   // 0x50 'P'
+  {  2537,  33,  38,  37,    2,  -34 },   // 0x51 'Q'
+  {  2625,  27,  34,  33,    4,  -33 },   // 0x52 'R'
+  {  2715,  27,  36,  31,    2,  -34 },   // 0x53 'S'
+  {  2789,  27,  34,  30,    1,  -33 },   // 0x54 'T'
+  {  2857,  26,  35,  34,    4,  -33 },   // 0x55 'U'
+  {  2927,  29,  34,  30,    1,  -33 },   // 0x56 'V'
+  {  3009,  42,  34,  44,    1,  -33 },   // 0x57 'W'
+  {  3123,  29,  34,  31,    1,  -33 },   // 0x58 'X'
+  {  3199,  30,  34,  32,    1,  -33 },   // 0x59 'Y'
+  {  3275,  26,  34,  29,    1,  -33 },   // 0x5A 'Z'
+  {  3343,   9,  44,  13,    3,  -33 },   // 0x5B '['
+  {  3385,  13,  35,  13,    0,  -33 },   // 0x5C '\'
+  {  3420,   9,  44,  13,    1,  -33 },   // 0x5D ']'
+  {  3462,  18,  18,  22,    2,  -33 },   // 0x5E '^'
+  {  3493,  28,   2,  26,   -1,    7 },   // 0x5F '_'
+  {  3497,  10,   7,  12,    1,  -34 },   // 0x60 '`'
+  {  3504,  24,  27,  26,    1,  -25 },   // 0x61 'a'
+  {  3553,  22,  35,  26,    3,  -33 },   // 0x62 'b'
+  {  3615,  21,  27,  24,    1,  -25 },   // 0x63 'c'
+  {  3663,  22,  35,  26,    1,  -33 },   // 0x64 'd'
+  {  3728,  23,  27,  25,    1,  -25 },   // 0x65 'e'
+  {  3775,  11,  34,  13,    1,  -33 },   // 0x66 'f'
+  {  3810,  22,  36,  26,    1,  -25 },   // 0x67 'g'
+  {  3875,  19,  34,  25,    3,  -33 },   // 0x68 'h'
+  {  3913,   4,  34,  10,    3,  -33 },   // 0x69 'i'
+  {  3923,   8,  44,  11,    0,  -33 },   // 0x6A 'j'
+  {  3965,  21,  34,  24,    3,  -33 },   // 0x6B 'k'
+  {  4033,   4,  34,  10,    3,  -33 },   // 0x6C 'l'
+  {  4043,  32,  26,  38,    3,  -25 },   // 0x6D 'm'
+  {  4100,  19,  26,  25,    3,  -25 },   // 0x6E 'n'
+  {  4131,  23,  27,  25,    1,  -25 },   // 0x6F 'o'
+  {  4176,  22,  36,  26,    3,  -25 },   // 0x70 'p'
+  {  4241,  22,  36,  26,    1,  -25 },   // 0x71 'q'
+  {  4307,  12,  26,  16,    3,  -25 },   // 0x72 'r'
+  {  4334,  20,  27,  23,    2,  -25 },   // 0x73 's'
+  {  4374,  11,  33,  13,    1,  -31 },   // 0x74 't'
+  {  4408,  19,  26,  25,    3,  -24 },   // 0x75 'u'
+  {  4440,  23,  25,  23,    0,  -24 },   // 0x76 'v'
+  {  4491,  33,  25,  34,    0,  -24 },   // 0x77 'w'
+  {  4571,  22,  25,  22,    0,  -24 },   // 0x78 'x'
+  {  4618,  22,  35,  22,    0,  -24 },   // 0x79 'y'
+  {  4682,  20,  25,  23,    1,  -24 },   // 0x7A 'z'
+  {  4711,  11,  44,  16,    2,  -33 },   // 0x7B '{'
+  {  4755,   3,  44,  12,    4,  -33 },   // 0x7C '|'
+  {  4764,  11,  44,  16,    3,  -33 },   // 0x7D '}'
+  {  4809,  20,   8,  24,    2,  -20 },   // 0x7E '~'
+  {  4823,  34,  44,  38,    2,  -37 },   // 0x7F ''
+  {  4926,  34,  44,  38,    2,  -37 },   // 0x80 ''
+  {  5029,  34,  44,  38,    2,  -37 },   // 0x81 ''
+  {  5132,  34,  44,  38,    2,  -37 },   // 0x82 ''
+  {  5235,  34,  44,  38,    2,  -37 },   // 0x83 ''
+  {  5338,  34,  44,  38,    2,  -37 },   // 0x84 ''
+  {  5441,  34,  44,  38,    2,  -37 },   // 0x85 ''
+  {  5544,  34,  44,  38,    2,  -37 },   // 0x86 ''
+  {  5647,  34,  44,  38,    2,  -37 },   // 0x87 ''
+  {  5750,  34,  44,  38,    2,  -37 },   // 0x88 ''
+  {  5853,  34,  44,  38,    2,  -37 },   // 0x89 ''
+  {  5956,  34,  44,  38,    2,  -37 },   // 0x8A ''
+  {  6059,  34,  44,  38,    2,  -37 },   // 0x8B ''
+  {  6162,  34,  44,  38,    2,  -37 },   // 0x8C ''
+  {  6265,  34,  44,  38,    2,  -37 },   // 0x8D ''
+  {  6368,  34,  44,  38,    2,  -37 },   // 0x8E ''
+  {  6471,  34,  44,  38,    2,  -37 },   // 0x8F ''
+  {  6574,  34,  44,  38,    2,  -37 },   // 0x90 ''
+  {  6677,  34,  44,  38,    2,  -37 },   // 0x91 ''
+  {  6780,  34,  44,  38,    2,  -37 },   // 0x92 ''
+  {  6883,  34,  44,  38,    2,  -37 },   // 0x93 ''
+  {  6986,  34,  44,  38,    2,  -37 },   // 0x94 ''
+  {  7089,  34,  44,  38,    2,  -37 },   // 0x95 ''
+  {  7192,  34,  44,  38,    2,  -37 },   // 0x96 ''
+  {  7295,  34,  44,  38,    2,  -37 },   // 0x97 ''
+  {  7398,  34,  44,  38,    2,  -37 },   // 0x98 ''
+  {  7501,  34,  44,  38,    2,  -37 },   // 0x99 ''
+  {  7604,  34,  44,  38,    2,  -37 },   // 0x9A ''
+  {  7707,  34,  44,  38,    2,  -37 },   // 0x9B ''
+  {  7810,  34,  44,  38,    2,  -37 },   // 0x9C ''
+  {  7913,  34,  44,  38,    2,  -37 },   // 0x9D ''
+  {  8016,  34,  44,  38,    2,  -37 },   // 0x9E ''
+  {  8119,  34,  44,  38,    2,  -37 },   // 0x9F ''
+  {  8222,   1,   1,  13,    0,    0 },   // 0xA0 ''
+  {  8223,   4,  35,  16,    6,  -24 },   // 0xA1 ''
+  {  8239,  22,  36,  26,    2,  -29 },   // 0xA2 ''
+  {  8317,  24,  35,  26,    1,  -33 },   // 0xA3 ''
+  {  8385,  20,  20,  26,    3,  -25 },   // 0xA4 ''
+  {  8429,  25,  34,  26,    1,  -33 },   // 0xA5 ''
+  {  8499,   3,  44,  12,    5,  -33 },   // 0xA6 ''
+  {  8508,  22,  44,  26,    2,  -33 },   // 0xA7 ''
+  {  8582,  13,   5,  16,    1,  -33 },   // 0xA8 ''
+  {  8588,  34,  35,  38,    2,  -33 },   // 0xA9 ''
+  {  8694,  14,  21,  17,    2,  -34 },   // 0xAA ''
+  {  8725,  17,  16,  24,    3,  -20 },   // 0xAB ''
+  {  8756,  24,  13,  27,    2,  -16 },   // 0xAC ''
+  {  8781,  11,   3,  16,    2,  -13 },   // 0xAD ''
+  {  8784,  34,  35,  38,    2,  -33 },   // 0xAE ''
+  {  8890,  13,   3,  16,    1,  -32 },   // 0xAF ''
+  {  8893,  14,  14,  28,    7,  -31 },   // 0xB0 ''
+  {  8912,  23,  30,  27,    2,  -28 },   // 0xB1 ''
+  {  8966,  14,  20,  16,    1,  -37 },   // 0xB2 ''
+  {  8989,  14,  20,  16,    1,  -37 },   // 0xB3 ''
+  {  9014,  10,   7,  16,    4,  -34 },   // 0xB4 ''
+  {  9022,  23,  35,  26,    3,  -24 },   // 0xB5 ''
+  {  9092,  23,  43,  25,    2,  -33 },   // 0xB6 ''
+  {  9178,   5,   5,  12,    4,  -15 },   // 0xB7 ''
+  {  9180,  11,  10,  16,    2,    1 },   // 0xB8 ''
+  {  9190,   8,  20,  16,    3,  -37 },   // 0xB9 ''
+  {  9209,  13,  21,  17,    2,  -34 },   // 0xBA ''
+  {  9234,  17,  16,  24,    3,  -20 },   // 0xBB ''
+  {  9266,  37,  36,  41,    3,  -34 },   // 0xBC ''
+  {  9379,  37,  35,  41,    3,  -33 },   // 0xBD ''
+  {  9483,  38,  36,  41,    1,  -34 },   // 0xBE ''
+  {  9599,  21,  35,  26,    4,  -24 },   // 0xBF ''
+  {  9657,  30,  42,  31,    1,  -41 },   // 0xC0 ''
+  {  9754,  30,  42,  31,    1,  -41 },   // 0xC1 ''
+  {  9852,  30,  42,  31,    1,  -41 },   // 0xC2 ''
+  {  9952,  30,  42,  31,    1,  -41 },   // 0xC3 ''
+  { 10052,  30,  41,  31,    1,  -40 },   // 0xC4 ''
+  { 10152,  30,  45,  31,    1,  -44 },   // 0xC5 ''
+  { 10259,  44,  34,  46,    1,  -33 },   // 0xC6 ''
+  { 10358,  29,  45,  33,    2,  -34 },   // 0xC7 ''
+  { 10458,  24,  42,  30,    4,  -41 },   // 0xC8 ''
+  { 10539,  24,  42,  30,    4,  -41 },   // 0xC9 ''
+  { 10621,  24,  42,  30,    4,  -41 },   // 0xCA ''
+  { 10702,  24,  41,  30,    4,  -40 },   // 0xCB ''
+  { 10782,  11,  42,  13,    0,  -41 },   // 0xCC ''
+  { 10824,  11,  42,  13,    2,  -41 },   // 0xCD ''
+  { 10867,  14,  42,  14,    0,  -41 },   // 0xCE ''
+  { 10913,  14,  41,  14,    0,  -40 },   // 0xCF ''
+  { 10956,  30,  34,  33,    1,  -33 },   // 0xD0 ''
+  { 11042,  27,  41,  34,    4,  -40 },   // 0xD1 ''
+  { 11115,  33,  44,  37,    2,  -42 },   // 0xD2 ''
+  { 11218,  33,  44,  37,    2,  -42 },   // 0xD3 ''
+  { 11322,  33,  44,  37,    2,  -42 },   // 0xD4 ''
+  { 11427,  33,  43,  37,    2,  -41 },   // 0xD5 ''
+  { 11531,  33,  43,  37,    2,  -41 },   // 0xD6 ''
+  { 11636,  19,  18,  27,    4,  -19 },   // 0xD7 ''
+  { 11668,  33,  37,  37,    2,  -35 },   // 0xD8 ''
+  { 11763,  26,  43,  34,    4,  -41 },   // 0xD9 ''
+  { 11848,  26,  43,  34,    4,  -41 },   // 0xDA ''
+  { 11933,  26,  43,  34,    4,  -41 },   // 0xDB ''
+  { 12018,  26,  42,  34,    4,  -40 },   // 0xDC ''
+  { 12101,  30,  42,  32,    1,  -41 },   // 0xDD ''
+  { 12193,  24,  34,  30,    4,  -33 },   // 0xDE ''
+  { 12256,  22,  36,  28,    4,  -34 },   // 0xDF ''
+  { 12319,  24,  36,  26,    1,  -34 },   // 0xE0 ''
+  { 12385,  24,  36,  26,    1,  -34 },   // 0xE1 ''
+  { 12451,  24,  36,  26,    1,  -34 },   // 0xE2 ''
+  { 12517,  24,  35,  26,    1,  -33 },   // 0xE3 ''
+  { 12580,  24,  36,  26,    1,  -34 },   // 0xE4 ''
+  { 12646,  24,  38,  26,    1,  -36 },   // 0xE5 ''
+  { 12715,  39,  27,  41,    1,  -25 },   // 0xE6 ''
+  { 12793,  21,  36,  24,    1,  -25 },   // 0xE7 ''
+  { 12855,  23,  36,  25,    1,  -34 },   // 0xE8 ''
+  { 12919,  23,  36,  25,    1,  -34 },   // 0xE9 ''
+  { 12983,  23,  36,  25,    1,  -34 },   // 0xEA ''
+  { 13046,  23,  36,  25,    1,  -34 },   // 0xEB ''
+  { 13109,  10,  35,  10,    0,  -34 },   // 0xEC ''
+  { 13144,   9,  35,  10,    1,  -34 },   // 0xED ''
+  { 13179,  14,  35,  12,   -1,  -34 },   // 0xEE ''
+  { 13219,  14,  35,  12,   -1,  -34 },   // 0xEF ''
+  { 13255,  23,  37,  25,    1,  -35 },   // 0xF0 ''
+  { 13316,  19,  34,  25,    3,  -33 },   // 0xF1 ''
+  { 13360,  23,  36,  25,    1,  -34 },   // 0xF2 ''
+  { 13422,  23,  36,  25,    1,  -34 },   // 0xF3 ''
+  { 13484,  23,  35,  25,    1,  -33 },   // 0xF4 ''
+  { 13544,  23,  35,  25,    1,  -33 },   // 0xF5 ''
+  { 13603,  23,  35,  25,    1,  -33 },   // 0xF6 ''
+  { 13663,  23,  22,  27,    2,  -21 },   // 0xF7 ''
+  { 13701,  24,  27,  25,    0,  -25 },   // 0xF8 ''
+  { 13767,  19,  36,  25,    3,  -34 },   // 0xF9 ''
+  { 13813,  19,  36,  25,    3,  -34 },   // 0xFA ''
+  { 13856,  19,  35,  25,    3,  -33 },   // 0xFB ''
+  { 13901,  19,  35,  25,    3,  -33 },   // 0xFC ''
+  { 13948,  22,  45,  22,    0,  -34 },   // 0xFD ''
+  { 14030,  22,  44,  26,    3,  -33 },   // 0xFE ''
+  { 14112,  22,  44,  22,    0,  -33 } }; // 0xFF ''
+
+constexpr GFXfont FreeSans_RLE_24pt8b PROGMEM = {
+  (uint8_t  *)FreeSans_RLE_24pt8bBitmaps,
+  (GFXglyph *)FreeSans_RLE_24pt8bGlyphs,
+  0x20, 0xFF, 56 };
+
+// Approx. 15767 bytes
@@ -0,0 +1,1565 @@
+// Run-length encoded glyph bitmaps (fontconvert -r)
+#define FreeSans_RLE_26pt8b_RLE
+
+const uint8_t FreeSans_RLE_26pt8bBitmaps[] PROGMEM = {
+  0x10, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x04, 0x23, 0x23, 0x23, 0x23,
+  0x23, 0x23, 0x23, 0x23, 0x23, 0xF0, 0x6F, 0x0A, 0x05, 0x3A, 0x3A, 0x3A,
+  0x3A, 0x3A, 0x3A, 0x39, 0x54, 0x13, 0x53, 0x23, 0x53, 0x23, 0x53, 0x23,
+  0x53, 0x10, 0x94, 0x74, 0xC4, 0x64, 0xD4, 0x64, 0xD4, 0x64, 0xD4, 0x64,
+  0xC4, 0x74, 0xC4, 0x73, 0xD4, 0x64, 0xD4, 0x64, 0xD4, 0x64, 0x7F, 0x0A,
+  0x2F, 0x0A, 0x2F, 0x0A, 0x74, 0x64, 0xD4, 0x64, 0xD4, 0x64, 0xC4, 0x74,
+  0xC4, 0x73, 0xD4, 0x64, 0xD4, 0x64, 0xD4, 0x64, 0xD3, 0x74, 0x7F, 0x0A,
+  0x2F, 0x0A, 0x2F, 0x0A, 0x74, 0x64, 0xD4, 0x64, 0xC4, 0x74, 0xC4, 0x73,
+  0xD4, 0x64, 0xD4, 0x64, 0xD4, 0x64, 0xD3, 0x74, 0xC4, 0x73, 0xD4, 0x64,
+  0xD4, 0x64, 0xA0, 0xA3, 0xF0, 0x63, 0xF0, 0x64, 0xF0, 0x1C, 0xAF, 0x01,
+  0x7F, 0x03, 0x56, 0x23, 0x36, 0x36, 0x33, 0x45, 0x35, 0x43, 0x55, 0x24,
+  0x53, 0x64, 0x15, 0x53, 0x64, 0x14, 0x63, 0x64, 0x14, 0x63, 0xB5, 0x53,
+  0xB5, 0x53, 0xC5, 0x43, 0xC6, 0x33, 0xC7, 0x23, 0xDB, 0xED, 0xDE, 0xCE,
+  0xDC, 0xC3, 0x28, 0xB3, 0x46, 0xB3, 0x65, 0xA3, 0x65, 0xA3, 0x78, 0x63,
+  0x78, 0x63, 0x78, 0x63, 0x78, 0x63, 0x78, 0x63, 0x79, 0x53, 0x65, 0x15,
+  0x43, 0x55, 0x26, 0x33, 0x46, 0x3F, 0x05, 0x5F, 0x03, 0x8E, 0xC9, 0xF0,
+  0x33, 0xF0, 0x63, 0xF0, 0x63, 0xF0, 0x63, 0xF0, 0x63, 0xB0, 0xF0, 0xF3,
+  0xF0, 0x32, 0xF0, 0x44, 0xF8, 0xF0, 0x13, 0xFB, 0xD4, 0xED, 0xC3, 0xE5,
+  0x45, 0xB3, 0xE5, 0x74, 0xA3, 0xE4, 0x93, 0x93, 0xF3, 0xA4, 0x83, 0xE4,
+  0xA4, 0x73, 0xF4, 0xA4, 0x64, 0xF0, 0x13, 0xA4, 0x63, 0xF0, 0x24, 0x94,
+  0x54, 0xF0, 0x24, 0x84, 0x63, 0xF0, 0x44, 0x65, 0x54, 0xF0, 0x4E, 0x63,
+  0xF0, 0x6C, 0x64, 0xF0, 0x7A, 0x73, 0xF0, 0xA6, 0x84, 0xF0, 0xF0, 0x93,
+  0xF0, 0xF0, 0x94, 0xA2, 0xF0, 0xC3, 0x88, 0xF0, 0x83, 0x7C, 0xF0, 0x63,
+  0x6E, 0xF0, 0x43, 0x75, 0x45, 0xF0, 0x43, 0x64, 0x84, 0xF0, 0x23, 0x74,
+  0x84, 0xF0, 0x14, 0x73, 0xA4, 0xF3, 0x74, 0xA4, 0xE4, 0x74, 0xA4, 0xE3,
+  0x84, 0xA4, 0xD4, 0x93, 0xA3, 0xE3, 0xA4, 0x84, 0xD4, 0xA5, 0x65, 0xD3,
+  0xCE, 0xD4, 0xDC, 0xE3, 0xFA, 0xE4, 0xF0, 0x26, 0x60, 0x97, 0xF0, 0x5A,
+  0xF0, 0x3D, 0xFE, 0xF4, 0x65, 0xD5, 0x74, 0xD4, 0x94, 0xC4, 0x94, 0xC4,
+  0x94, 0xC4, 0x85, 0xC5, 0x74, 0xD5, 0x65, 0xE5, 0x46, 0xF5, 0x17, 0xF0,
+  0x1C, 0xF0, 0x39, 0xF0, 0x67, 0xF0, 0x58, 0xF0, 0x5A, 0xF0, 0x3C, 0xF0,
+  0x15, 0x35, 0x64, 0x55, 0x55, 0x54, 0x45, 0x75, 0x44, 0x35, 0x95, 0x25,
+  0x35, 0x96, 0x14, 0x44, 0xB5, 0x14, 0x44, 0xC9, 0x44, 0xD7, 0x54, 0xE6,
+  0x54, 0xE6, 0x55, 0xC7, 0x55, 0xB9, 0x55, 0x9B, 0x47, 0x57, 0x16, 0x4F,
+  0x02, 0x35, 0x5F, 0x55, 0x5C, 0x76, 0x77, 0xF0, 0x0F, 0x0F, 0x0A, 0x13,
+  0x12, 0x10, 0x83, 0x73, 0x73, 0x83, 0x73, 0x83, 0x73, 0x83, 0x74, 0x73,
+  0x74, 0x74, 0x73, 0x74, 0x74, 0x74, 0x73, 0x74, 0x74, 0x74, 0x74, 0x74,
+  0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x83, 0x84, 0x74,
+  0x74, 0x83, 0x84, 0x74, 0x83, 0x84, 0x83, 0x83, 0x93, 0x83, 0x93, 0x83,
+  0x93, 0x93, 0x03, 0x93, 0x83, 0x93, 0x84, 0x83, 0x84, 0x83, 0x84, 0x74,
+  0x83, 0x84, 0x74, 0x83, 0x84, 0x74, 0x74, 0x74, 0x84, 0x74, 0x74, 0x74,
+  0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x65, 0x64, 0x74, 0x74, 0x74,
+  0x73, 0x74, 0x74, 0x73, 0x74, 0x74, 0x73, 0x74, 0x73, 0x74, 0x73, 0x73,
+  0x83, 0x73, 0x80, 0x63, 0xC3, 0xC3, 0xC3, 0x72, 0x33, 0x3C, 0x1F, 0x05,
+  0x3A, 0x75, 0xA6, 0x83, 0x14, 0x64, 0x23, 0x54, 0x34, 0x52, 0x53, 0x61,
+  0xA0, 0xA4, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54,
+  0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xAF, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x06, 0xA4, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54,
+  0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54,
+  0xA0, 0x0F, 0x0F, 0x33, 0x33, 0x33, 0x33, 0x32, 0x33, 0x14, 0x23, 0x30,
+  0x0F, 0x0F, 0x0F, 0x07, 0x0F, 0x0A, 0xB3, 0xB3, 0xB3, 0xB2, 0xB3, 0xB3,
+  0xB2, 0xB3, 0xB3, 0xB2, 0xB3, 0xB3, 0xB2, 0xB3, 0xB3, 0xB3, 0xA3, 0xB3,
+  0xB3, 0xA3, 0xB3, 0xB3, 0xA3, 0xB3, 0xB3, 0xB2, 0xB3, 0xB3, 0xB2, 0xB3,
+  0xB3, 0xB2, 0xB3, 0xB3, 0xB2, 0xB3, 0xB3, 0xB3, 0xB0, 0x96, 0xFC, 0xBE,
+  0x9F, 0x01, 0x77, 0x47, 0x65, 0x85, 0x55, 0xA5, 0x45, 0xA5, 0x44, 0xC4,
+  0x35, 0xC5, 0x25, 0xC5, 0x24, 0xE4, 0x24, 0xE4, 0x15, 0xE4, 0x15, 0xEA,
+  0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xE5, 0x14, 0xE4,
+  0x24, 0xE4, 0x25, 0xC5, 0x25, 0xC5, 0x34, 0xC4, 0x45, 0xA5, 0x45, 0xA5,
+  0x55, 0x85, 0x66, 0x66, 0x7F, 0x01, 0x9E, 0xBC, 0xE7, 0x90, 0xA3, 0x94,
+  0x94, 0x94, 0x85, 0x76, 0x67, 0x2F, 0x0F, 0x0F, 0x05, 0x85, 0x85, 0x85,
+  0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85,
+  0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x88,
+  0xED, 0x9F, 0x01, 0x7F, 0x03, 0x66, 0x67, 0x46, 0x96, 0x35, 0xB5, 0x25,
+  0xD5, 0x15, 0xD5, 0x14, 0xE5, 0x14, 0xE5, 0x14, 0xE5, 0x14, 0xE5, 0xF0,
+  0x45, 0xF0, 0x35, 0xF0, 0x45, 0xF0, 0x35, 0xF0, 0x36, 0xF0, 0x17, 0xF8,
+  0xF8, 0xE8, 0xE9, 0xE8, 0xF7, 0xF0, 0x16, 0xF0, 0x26, 0xF0, 0x26, 0xF0,
+  0x35, 0xF0, 0x35, 0xF0, 0x44, 0xF0, 0x45, 0xF0, 0x45, 0xF0, 0x4F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x06, 0x88, 0xDD, 0xAF, 0x01, 0x7F, 0x03, 0x57,
+  0x66, 0x55, 0x96, 0x35, 0xB5, 0x35, 0xC4, 0x34, 0xD5, 0x24, 0xD5, 0x15,
+  0xD5, 0x15, 0xD5, 0xF0, 0x44, 0xF0, 0x45, 0xF0, 0x36, 0xF0, 0x17, 0xCB,
+  0xD9, 0xFB, 0xDC, 0xF0, 0x46, 0xF0, 0x46, 0xF0, 0x45, 0xF0, 0x54, 0xF0,
+  0x55, 0xF0, 0x49, 0xF9, 0xF9, 0xFA, 0xE4, 0x15, 0xD5, 0x25, 0xC5, 0x26,
+  0xA5, 0x46, 0x77, 0x4F, 0x04, 0x6F, 0x02, 0x9D, 0xD9, 0x80, 0xF0, 0x14,
+  0xF0, 0x64, 0xF0, 0x55, 0xF0, 0x46, 0xF0, 0x46, 0xF0, 0x37, 0xF0, 0x28,
+  0xF0, 0x28, 0xF0, 0x14, 0x14, 0xF4, 0x24, 0xE5, 0x24, 0xE4, 0x34, 0xD4,
+  0x44, 0xC5, 0x44, 0xC4, 0x54, 0xB4, 0x64, 0xA5, 0x64, 0x95, 0x74, 0x94,
+  0x84, 0x85, 0x84, 0x75, 0x94, 0x74, 0xA4, 0x64, 0xB4, 0x55, 0xB4, 0x5F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0A, 0xF0, 0x14, 0xF0, 0x64, 0xF0, 0x64,
+  0xF0, 0x64, 0xF0, 0x64, 0xF0, 0x64, 0xF0, 0x64, 0xF0, 0x64, 0xF0, 0x64,
+  0x50, 0x4F, 0x03, 0x5F, 0x04, 0x5F, 0x04, 0x5F, 0x04, 0x54, 0xF0, 0x54,
+  0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x45, 0xF0, 0x45, 0xF0, 0x44, 0xF0, 0x54,
+  0xF0, 0x54, 0xF0, 0x54, 0x37, 0xA4, 0x1B, 0x8F, 0x03, 0x5F, 0x05, 0x48,
+  0x67, 0x36, 0x97, 0x25, 0xC5, 0xF0, 0x45, 0xF0, 0x55, 0xF0, 0x45, 0xF0,
+  0x45, 0xF0, 0x45, 0xF0, 0x54, 0xF0, 0x45, 0xF0, 0x49, 0xFA, 0xE4, 0x15,
+  0xD5, 0x25, 0xC5, 0x26, 0xA5, 0x47, 0x66, 0x6F, 0x03, 0x7F, 0xAD, 0xE7,
+  0x90, 0x97, 0xFC, 0xBE, 0x9F, 0x01, 0x76, 0x56, 0x66, 0x85, 0x55, 0x95,
+  0x45, 0xB5, 0x35, 0xB5, 0x34, 0xD4, 0x25, 0xF0, 0x44, 0xF0, 0x54, 0xF0,
+  0x54, 0xF0, 0x45, 0x57, 0x75, 0x2C, 0x55, 0x1E, 0x4F, 0x06, 0x3A, 0x57,
+  0x28, 0x96, 0x17, 0xB5, 0x16, 0xD4, 0x16, 0xDA, 0xEA, 0xEA, 0xE5, 0x14,
+  0xF4, 0x14, 0xE5, 0x14, 0xE5, 0x15, 0xD5, 0x24, 0xC5, 0x35, 0xB5, 0x45,
+  0x95, 0x57, 0x57, 0x6F, 0x02, 0x8F, 0xAC, 0xF7, 0x80, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x06, 0xF0, 0x54, 0xF0, 0x44, 0xF0, 0x45, 0xF0, 0x44,
+  0xF0, 0x44, 0xF0, 0x45, 0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x54, 0xF0, 0x44,
+  0xF0, 0x45, 0xF0, 0x44, 0xF0, 0x45, 0xF0, 0x44, 0xF0, 0x45, 0xF0, 0x44,
+  0xF0, 0x45, 0xF0, 0x44, 0xF0, 0x45, 0xF0, 0x44, 0xF0, 0x54, 0xF0, 0x45,
+  0xF0, 0x44, 0xF0, 0x54, 0xF0, 0x45, 0xF0, 0x44, 0xF0, 0x54, 0xF0, 0x45,
+  0xF0, 0x45, 0xF0, 0x44, 0xF0, 0x54, 0xF0, 0x45, 0xF0, 0x45, 0xE0, 0x88,
+  0xEC, 0xAF, 0x01, 0x7F, 0x03, 0x66, 0x66, 0x56, 0x86, 0x45, 0xA5, 0x35,
+  0xC5, 0x25, 0xC5, 0x25, 0xC5, 0x25, 0xC5, 0x25, 0xC5, 0x25, 0xC5, 0x35,
+  0xA5, 0x46, 0x86, 0x56, 0x66, 0x7F, 0x01, 0xAC, 0xBE, 0x8F, 0x03, 0x56,
+  0x77, 0x36, 0xA6, 0x25, 0xC5, 0x15, 0xEA, 0xEA, 0xE9, 0xF0, 0x18, 0xFA,
+  0xEA, 0xEA, 0xE5, 0x15, 0xC5, 0x26, 0xA6, 0x37, 0x67, 0x5F, 0x03, 0x7F,
+  0x01, 0x9D, 0xE8, 0x80, 0x87, 0xFC, 0xAF, 0x8F, 0x02, 0x67, 0x57, 0x55,
+  0x95, 0x45, 0xB5, 0x35, 0xC4, 0x25, 0xD5, 0x15, 0xE4, 0x15, 0xE4, 0x15,
+  0xE4, 0x15, 0xEA, 0xEA, 0xEA, 0xD6, 0x14, 0xD6, 0x15, 0xB7, 0x16, 0x98,
+  0x27, 0x5A, 0x3F, 0x06, 0x4E, 0x15, 0x5C, 0x25, 0x77, 0x55, 0xF0, 0x44,
+  0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x45, 0x24, 0xD5, 0x24, 0xD4, 0x35, 0xB5,
+  0x35, 0xA5, 0x55, 0x86, 0x57, 0x56, 0x7F, 0x01, 0x9E, 0xBC, 0xE7, 0xA0,
+  0x0F, 0x0A, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xAF, 0x0A, 0x0F, 0x0A, 0xF0,
+  0xF0, 0xF0, 0xF0, 0xF0, 0xAF, 0x0A, 0x32, 0x32, 0x32, 0x32, 0x23, 0x27,
+  0x12, 0x30, 0xF0, 0xF0, 0xF0, 0x32, 0xF0, 0x55, 0xF0, 0x37, 0xF0, 0x19,
+  0xDA, 0xD9, 0xDA, 0xD9, 0xE9, 0xD9, 0xF8, 0xF0, 0x25, 0xF0, 0x57, 0xF0,
+  0x3A, 0xF0, 0x39, 0xF0, 0x39, 0xF0, 0x3A, 0xF0, 0x39, 0xF0, 0x3A, 0xF0,
+  0x39, 0xF0, 0x38, 0xF0, 0x46, 0xF0, 0x73, 0xF0, 0x91, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x06, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x06, 0xF0, 0x92, 0xF0, 0x74, 0xF0, 0x57,
+  0xF0, 0x29, 0xF0, 0x2A, 0xF0, 0x1A, 0xF0, 0x29, 0xF0, 0x2A, 0xF0, 0x29,
+  0xF0, 0x29, 0xF0, 0x37, 0xF0, 0x45, 0xF0, 0x36, 0xF9, 0xD9, 0xCA, 0xC9,
+  0xD9, 0xCA, 0xC9, 0xE8, 0xF0, 0x15, 0xF0, 0x43, 0xF0, 0x61, 0xF0, 0x80,
+  0x78, 0xCC, 0x8F, 0x01, 0x5F, 0x03, 0x46, 0x67, 0x25, 0x96, 0x24, 0xB5,
+  0x15, 0xCA, 0xC9, 0xD9, 0xD9, 0xD5, 0xF0, 0x25, 0xF0, 0x15, 0xF0, 0x16,
+  0xF0, 0x15, 0xF0, 0x15, 0xF6, 0xF6, 0xF6, 0xF0, 0x15, 0xF0, 0x15, 0xF0,
+  0x25, 0xF0, 0x15, 0xF0, 0x25, 0xF0, 0x25, 0xF0, 0x25, 0xF0, 0x25, 0xF0,
+  0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x75, 0xF0, 0x25, 0xF0, 0x25,
+  0xF0, 0x25, 0xF0, 0x25, 0x90, 0xF0, 0x5A, 0xF0, 0xF0, 0x2F, 0x02, 0xF0,
+  0xCF, 0x06, 0xF0, 0x8F, 0x0A, 0xF0, 0x4A, 0x9A, 0xF0, 0x18, 0xF8, 0xE6,
+  0xF0, 0x57, 0xC6, 0xF0, 0x77, 0xA6, 0xF0, 0xA6, 0x85, 0xF0, 0xD5, 0x75,
+  0xF0, 0xF5, 0x65, 0xC6, 0xC6, 0x45, 0xBA, 0x34, 0x45, 0x35, 0xAD, 0x15,
+  0x55, 0x25, 0x97, 0x25, 0x14, 0x65, 0x24, 0x96, 0x68, 0x65, 0x15, 0x86,
+  0x87, 0x74, 0x14, 0x95, 0xA5, 0x84, 0x14, 0x85, 0xB5, 0x89, 0x84, 0xC5,
+  0x88, 0x85, 0xC4, 0x98, 0x85, 0xC4, 0x98, 0x84, 0xD4, 0x98, 0x84, 0xC5,
+  0x89, 0x75, 0xC4, 0x99, 0x75, 0xC4, 0x94, 0x14, 0x75, 0xB5, 0x85, 0x14,
+  0x84, 0xB4, 0x94, 0x25, 0x75, 0x95, 0x85, 0x25, 0x75, 0x86, 0x75, 0x44,
+  0x85, 0x67, 0x66, 0x45, 0x77, 0x2A, 0x37, 0x55, 0x8C, 0x1E, 0x75, 0x8A,
+  0x3B, 0x96, 0x96, 0x68, 0xC6, 0xF0, 0xF0, 0xB6, 0xF0, 0xF0, 0xB6, 0xF0,
+  0xF0, 0xB7, 0xF0, 0xF0, 0xA8, 0xF0, 0xF0, 0x9A, 0xB4, 0xF0, 0x8F, 0x09,
+  0xF0, 0x9F, 0x07, 0xF0, 0xBF, 0x04, 0xF0, 0xF0, 0x1B, 0xF0, 0x20, 0xD6,
+  0xF0, 0xA8, 0xF0, 0x98, 0xF0, 0x98, 0xF0, 0x8A, 0xF0, 0x7A, 0xF0, 0x7A,
+  0xF0, 0x65, 0x25, 0xF0, 0x55, 0x25, 0xF0, 0x54, 0x35, 0xF0, 0x45, 0x45,
+  0xF0, 0x35, 0x45, 0xF0, 0x34, 0x56, 0xF0, 0x15, 0x65, 0xF0, 0x15, 0x65,
+  0xF5, 0x76, 0xE5, 0x85, 0xE5, 0x85, 0xD5, 0x96, 0xC5, 0xA5, 0xC4, 0xB5,
+  0xB5, 0xC5, 0xAF, 0x07, 0xAF, 0x07, 0x9F, 0x09, 0x8F, 0x09, 0x85, 0xE5,
+  0x75, 0xF0, 0x15, 0x65, 0xF0, 0x15, 0x55, 0xF0, 0x26, 0x45, 0xF0, 0x35,
+  0x45, 0xF0, 0x35, 0x35, 0xF0, 0x46, 0x25, 0xF0, 0x55, 0x25, 0xF0, 0x55,
+  0x15, 0xF0, 0x6B, 0xF0, 0x75, 0x0F, 0x04, 0x9F, 0x07, 0x6F, 0x08, 0x5F,
+  0x09, 0x45, 0xC8, 0x35, 0xE6, 0x35, 0xF6, 0x25, 0xF0, 0x15, 0x25, 0xF0,
+  0x15, 0x25, 0xF0, 0x15, 0x25, 0xF0, 0x15, 0x25, 0xF0, 0x15, 0x25, 0xF0,
+  0x15, 0x25, 0xF5, 0x35, 0xF5, 0x35, 0xD6, 0x4F, 0x08, 0x5F, 0x06, 0x7F,
+  0x08, 0x5F, 0x0A, 0x35, 0xD8, 0x25, 0xF0, 0x15, 0x25, 0xF0, 0x25, 0x15,
+  0xF0, 0x25, 0x15, 0xF0, 0x3A, 0xF0, 0x3A, 0xF0, 0x3A, 0xF0, 0x3A, 0xF0,
+  0x3A, 0xF0, 0x25, 0x15, 0xF0, 0x25, 0x15, 0xF0, 0x16, 0x15, 0xE7, 0x2F,
+  0x0A, 0x3F, 0x09, 0x4F, 0x08, 0x5F, 0x05, 0x80, 0xC9, 0xF0, 0x5F, 0xF0,
+  0x1F, 0x03, 0xCF, 0x06, 0xA9, 0x59, 0x87, 0xB7, 0x76, 0xE5, 0x66, 0xF6,
+  0x46, 0xF0, 0x25, 0x45, 0xF0, 0x45, 0x35, 0xF0, 0x45, 0x25, 0xF0, 0x55,
+  0x25, 0xF0, 0xC4, 0xF0, 0xC5, 0xF0, 0xC5, 0xF0, 0xC5, 0xF0, 0xC5, 0xF0,
+  0xC5, 0xF0, 0xC5, 0xF0, 0xC5, 0xF0, 0xC5, 0xF0, 0xC5, 0xF0, 0xC5, 0xF0,
+  0xC5, 0xF0, 0x75, 0x14, 0xF0, 0x75, 0x15, 0xF0, 0x65, 0x15, 0xF0, 0x55,
+  0x35, 0xF0, 0x45, 0x35, 0xF0, 0x45, 0x36, 0xF0, 0x26, 0x46, 0xF6, 0x66,
+  0xE6, 0x67, 0xB7, 0x89, 0x68, 0xAF, 0x06, 0xDF, 0x03, 0xFF, 0xF0, 0x5A,
+  0xA0, 0x0F, 0x03, 0xCF, 0x06, 0x9F, 0x08, 0x7F, 0x09, 0x65, 0xC8, 0x55,
+  0xE7, 0x45, 0xF0, 0x16, 0x35, 0xF0, 0x25, 0x35, 0xF0, 0x26, 0x25, 0xF0,
+  0x35, 0x25, 0xF0, 0x35, 0x25, 0xF0, 0x45, 0x15, 0xF0, 0x45, 0x15, 0xF0,
+  0x45, 0x15, 0xF0, 0x45, 0x15, 0xF0, 0x54, 0x15, 0xF0, 0x54, 0x15, 0xF0,
+  0x54, 0x15, 0xF0, 0x54, 0x15, 0xF0, 0x54, 0x15, 0xF0, 0x54, 0x15, 0xF0,
+  0x54, 0x15, 0xF0, 0x45, 0x15, 0xF0, 0x45, 0x15, 0xF0, 0x45, 0x15, 0xF0,
+  0x45, 0x15, 0xF0, 0x35, 0x25, 0xF0, 0x35, 0x25, 0xF0, 0x26, 0x25, 0xF0,
+  0x25, 0x35, 0xF0, 0x16, 0x35, 0xE7, 0x45, 0xC8, 0x5F, 0x09, 0x6F, 0x08,
+  0x7F, 0x06, 0x9F, 0x03, 0xC0, 0x0F, 0x0B, 0x1F, 0x0B, 0x1F, 0x0B, 0x1F,
+  0x0B, 0x15, 0xF0, 0x75, 0xF0, 0x75, 0xF0, 0x75, 0xF0, 0x75, 0xF0, 0x75,
+  0xF0, 0x75, 0xF0, 0x75, 0xF0, 0x75, 0xF0, 0x75, 0xF0, 0x75, 0xF0, 0x75,
+  0xF0, 0x7F, 0x0A, 0x2F, 0x0A, 0x2F, 0x0A, 0x2F, 0x0A, 0x25, 0xF0, 0x75,
+  0xF0, 0x75, 0xF0, 0x75, 0xF0, 0x75, 0xF0, 0x75, 0xF0, 0x75, 0xF0, 0x75,
+  0xF0, 0x75, 0xF0, 0x75, 0xF0, 0x75, 0xF0, 0x75, 0xF0, 0x75, 0xF0, 0x7F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x03, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0xF0, 0x55, 0xF0, 0x55, 0xF0, 0x55, 0xF0, 0x55, 0xF0, 0x55,
+  0xF0, 0x55, 0xF0, 0x55, 0xF0, 0x55, 0xF0, 0x55, 0xF0, 0x55, 0xF0, 0x55,
+  0xF0, 0x5F, 0x08, 0x2F, 0x08, 0x2F, 0x08, 0x2F, 0x08, 0x25, 0xF0, 0x55,
+  0xF0, 0x55, 0xF0, 0x55, 0xF0, 0x55, 0xF0, 0x55, 0xF0, 0x55, 0xF0, 0x55,
+  0xF0, 0x55, 0xF0, 0x55, 0xF0, 0x55, 0xF0, 0x55, 0xF0, 0x55, 0xF0, 0x55,
+  0xF0, 0x55, 0xF0, 0x55, 0xF0, 0x55, 0xF0, 0x50, 0xD9, 0xF0, 0x7F, 0x01,
+  0xF0, 0x1F, 0x04, 0xEF, 0x07, 0xB9, 0x69, 0x97, 0xC7, 0x76, 0xF6, 0x66,
+  0xF0, 0x26, 0x55, 0xF0, 0x45, 0x45, 0xF0, 0x65, 0x35, 0xF0, 0x65, 0x25,
+  0xF0, 0x75, 0x25, 0xF0, 0xE5, 0xF0, 0xD5, 0xF0, 0xE5, 0xF0, 0xE5, 0xF0,
+  0xE5, 0xF0, 0xE5, 0xDF, 0x06, 0xDF, 0x06, 0xDF, 0x06, 0xDF, 0x06, 0xF0,
+  0xA9, 0xF0, 0xA9, 0xF0, 0xA4, 0x15, 0xF0, 0x94, 0x15, 0xF0, 0x85, 0x15,
+  0xF0, 0x85, 0x25, 0xF0, 0x75, 0x26, 0xF0, 0x56, 0x35, 0xF0, 0x47, 0x36,
+  0xF0, 0x28, 0x46, 0xF9, 0x57, 0xC5, 0x14, 0x69, 0x67, 0x24, 0x7F, 0x05,
+  0x34, 0x8F, 0x03, 0x53, 0xAE, 0x73, 0xD8, 0xD0, 0x05, 0xF0, 0x4A, 0xF0,
+  0x4A, 0xF0, 0x4A, 0xF0, 0x4A, 0xF0, 0x4A, 0xF0, 0x4A, 0xF0, 0x4A, 0xF0,
+  0x4A, 0xF0, 0x4A, 0xF0, 0x4A, 0xF0, 0x4A, 0xF0, 0x4A, 0xF0, 0x4A, 0xF0,
+  0x4A, 0xF0, 0x4A, 0xF0, 0x4F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x06, 0xF0, 0x4A, 0xF0, 0x4A, 0xF0, 0x4A, 0xF0, 0x4A, 0xF0, 0x4A, 0xF0,
+  0x4A, 0xF0, 0x4A, 0xF0, 0x4A, 0xF0, 0x4A, 0xF0, 0x4A, 0xF0, 0x4A, 0xF0,
+  0x4A, 0xF0, 0x4A, 0xF0, 0x4A, 0xF0, 0x4A, 0xF0, 0x4A, 0xF0, 0x45, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x05,
+  0xF0, 0x15, 0xF0, 0x15, 0xF0, 0x15, 0xF0, 0x15, 0xF0, 0x15, 0xF0, 0x15,
+  0xF0, 0x15, 0xF0, 0x15, 0xF0, 0x15, 0xF0, 0x15, 0xF0, 0x15, 0xF0, 0x15,
+  0xF0, 0x15, 0xF0, 0x15, 0xF0, 0x15, 0xF0, 0x15, 0xF0, 0x15, 0xF0, 0x15,
+  0xF0, 0x15, 0xF0, 0x15, 0xF0, 0x15, 0xF0, 0x15, 0xF0, 0x15, 0xF0, 0x15,
+  0xF0, 0x1A, 0xBA, 0xBA, 0xBA, 0xBA, 0xB4, 0x15, 0xA5, 0x16, 0x95, 0x25,
+  0x86, 0x27, 0x56, 0x4F, 0x01, 0x6E, 0x8C, 0xB8, 0x70, 0x05, 0xF0, 0x36,
+  0x15, 0xF0, 0x26, 0x25, 0xF0, 0x16, 0x35, 0xF6, 0x45, 0xE6, 0x55, 0xD6,
+  0x65, 0xC6, 0x75, 0xB6, 0x85, 0xA6, 0x95, 0x96, 0xA5, 0x86, 0xB5, 0x76,
+  0xC5, 0x66, 0xD5, 0x56, 0xE5, 0x46, 0xF5, 0x37, 0xF5, 0x28, 0xF5, 0x1A,
+  0xEA, 0x16, 0xD9, 0x35, 0xD8, 0x55, 0xC7, 0x66, 0xB6, 0x85, 0xB5, 0xA5,
+  0xA5, 0xA6, 0x95, 0xB6, 0x85, 0xC5, 0x85, 0xC6, 0x75, 0xD6, 0x65, 0xE5,
+  0x65, 0xE6, 0x55, 0xF6, 0x45, 0xF0, 0x15, 0x45, 0xF0, 0x25, 0x35, 0xF0,
+  0x26, 0x25, 0xF0, 0x36, 0x15, 0xF0, 0x45, 0x10, 0x05, 0xF0, 0x35, 0xF0,
+  0x35, 0xF0, 0x35, 0xF0, 0x35, 0xF0, 0x35, 0xF0, 0x35, 0xF0, 0x35, 0xF0,
+  0x35, 0xF0, 0x35, 0xF0, 0x35, 0xF0, 0x35, 0xF0, 0x35, 0xF0, 0x35, 0xF0,
+  0x35, 0xF0, 0x35, 0xF0, 0x35, 0xF0, 0x35, 0xF0, 0x35, 0xF0, 0x35, 0xF0,
+  0x35, 0xF0, 0x35, 0xF0, 0x35, 0xF0, 0x35, 0xF0, 0x35, 0xF0, 0x35, 0xF0,
+  0x35, 0xF0, 0x35, 0xF0, 0x35, 0xF0, 0x35, 0xF0, 0x35, 0xF0, 0x35, 0xF0,
+  0x35, 0xF0, 0x3F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x02, 0x07, 0xF0, 0x6E,
+  0xF0, 0x6F, 0xF0, 0x5F, 0xF0, 0x4F, 0x01, 0xF0, 0x4F, 0x02, 0xF0, 0x3F,
+  0x02, 0xF0, 0x24, 0x1D, 0xF0, 0x24, 0x1E, 0xF0, 0x14, 0x19, 0x14, 0xF4,
+  0x29, 0x14, 0xF4, 0x29, 0x15, 0xE4, 0x29, 0x24, 0xD4, 0x39, 0x24, 0xD4,
+  0x39, 0x25, 0xC4, 0x39, 0x34, 0xB4, 0x49, 0x34, 0xB4, 0x49, 0x35, 0xA4,
+  0x49, 0x44, 0x94, 0x59, 0x44, 0x94, 0x59, 0x45, 0x84, 0x59, 0x54, 0x74,
+  0x69, 0x54, 0x74, 0x69, 0x55, 0x64, 0x69, 0x64, 0x54, 0x79, 0x64, 0x54,
+  0x79, 0x74, 0x44, 0x79, 0x74, 0x34, 0x89, 0x74, 0x34, 0x89, 0x84, 0x24,
+  0x89, 0x84, 0x14, 0x99, 0x84, 0x14, 0x99, 0x98, 0x99, 0x97, 0xA9, 0x97,
+  0xA9, 0xA6, 0xA9, 0xA5, 0xB4, 0x06, 0xF0, 0x4A, 0xF0, 0x4B, 0xF0, 0x3B,
+  0xF0, 0x3C, 0xF0, 0x2D, 0xF0, 0x1D, 0xF0, 0x1E, 0xFF, 0xE9, 0x15, 0xE9,
+  0x25, 0xD9, 0x26, 0xC9, 0x35, 0xC9, 0x45, 0xB9, 0x46, 0xA9, 0x55, 0xA9,
+  0x65, 0x99, 0x65, 0x99, 0x75, 0x89, 0x85, 0x79, 0x85, 0x79, 0x95, 0x69,
+  0x96, 0x59, 0xA5, 0x59, 0xB5, 0x49, 0xB6, 0x39, 0xC5, 0x39, 0xD5, 0x29,
+  0xD5, 0x29, 0xE5, 0x19, 0xFE, 0xFE, 0xF0, 0x1D, 0xF0, 0x1D, 0xF0, 0x2C,
+  0xF0, 0x3B, 0xF0, 0x36, 0xD9, 0xF0, 0x9F, 0xF0, 0x4F, 0x04, 0xF0, 0x1F,
+  0x07, 0xD9, 0x69, 0xB7, 0xC7, 0x96, 0xF7, 0x76, 0xF0, 0x36, 0x65, 0xF0,
+  0x55, 0x56, 0xF0, 0x56, 0x45, 0xF0, 0x75, 0x35, 0xF0, 0x86, 0x25, 0xF0,
+  0x95, 0x25, 0xF0, 0x95, 0x15, 0xF0, 0xB4, 0x15, 0xF0, 0xBA, 0xF0, 0xBA,
+  0xF0, 0xBA, 0xF0, 0xBA, 0xF0, 0xBA, 0xF0, 0xBA, 0xF0, 0xBA, 0xF0, 0xBA,
+  0xF0, 0xBA, 0xF0, 0xB4, 0x25, 0xF0, 0x95, 0x25, 0xF0, 0x95, 0x25, 0xF0,
+  0x86, 0x35, 0xF0, 0x75, 0x46, 0xF0, 0x56, 0x55, 0xF0, 0x55, 0x66, 0xF0,
+  0x36, 0x76, 0xF7, 0x97, 0xC7, 0xB9, 0x69, 0xDF, 0x07, 0xF0, 0x1F, 0x03,
+  0xF0, 0x4F, 0xF0, 0xA9, 0xD0, 0x0F, 0x04, 0x8F, 0x07, 0x5F, 0x08, 0x4F,
+  0x0A, 0x25, 0xC8, 0x25, 0xE7, 0x15, 0xF0, 0x15, 0x15, 0xF0, 0x15, 0x15,
+  0xF0, 0x2A, 0xF0, 0x2A, 0xF0, 0x2A, 0xF0, 0x2A, 0xF0, 0x2A, 0xF0, 0x1B,
+  0xF0, 0x15, 0x15, 0xF6, 0x15, 0xD7, 0x2F, 0x0A, 0x2F, 0x09, 0x3F, 0x08,
+  0x4F, 0x06, 0x65, 0xF0, 0x75, 0xF0, 0x75, 0xF0, 0x75, 0xF0, 0x75, 0xF0,
+  0x75, 0xF0, 0x75, 0xF0, 0x75, 0xF0, 0x75, 0xF0, 0x75, 0xF0, 0x75, 0xF0,
+  0x75, 0xF0, 0x75, 0xF0, 0x75, 0xF0, 0x75, 0xF0, 0x75, 0xF0, 0x70, 0xD9,
+  0xF0, 0x9F, 0xF0, 0x4F, 0x04, 0xF0, 0x1F, 0x07, 0xD9, 0x69, 0xB7, 0xC7,
+  0x97, 0xE7, 0x76, 0xF0, 0x36, 0x65, 0xF0, 0x55, 0x56, 0xF0, 0x56, 0x45,
+  0xF0, 0x75, 0x35, 0xF0, 0x86, 0x25, 0xF0, 0x95, 0x25, 0xF0, 0x95, 0x15,
+  0xF0, 0xB4, 0x15, 0xF0, 0xBA, 0xF0, 0xBA, 0xF0, 0xBA, 0xF0, 0xBA, 0xF0,
+  0xBA, 0xF0, 0xBA, 0xF0, 0xBA, 0xF0, 0xBA, 0xF0, 0xBA, 0xF0, 0xB4, 0x25,
+  0xF0, 0x95, 0x25, 0xF0, 0x95, 0x25, 0xF0, 0x11, 0x66, 0x35, 0xF2, 0x55,
+  0x46, 0xD4, 0x36, 0x55, 0xD5, 0x25, 0x66, 0xDB, 0x76, 0xD9, 0x97, 0xC7,
+  0xB9, 0x6A, 0xCF, 0x0B, 0xCF, 0x0A, 0xCF, 0x01, 0x36, 0xF8, 0x85, 0xF0,
+  0xF0, 0x23, 0xF0, 0xF0, 0x80, 0x0F, 0x06, 0x9F, 0x09, 0x6F, 0x0A, 0x5F,
+  0x0B, 0x45, 0xE8, 0x35, 0xF0, 0x26, 0x25, 0xF0, 0x26, 0x25, 0xF0, 0x35,
+  0x25, 0xF0, 0x35, 0x25, 0xF0, 0x35, 0x25, 0xF0, 0x44, 0x25, 0xF0, 0x35,
+  0x25, 0xF0, 0x35, 0x25, 0xF0, 0x35, 0x25, 0xF0, 0x25, 0x35, 0xF0, 0x16,
+  0x35, 0xE7, 0x4F, 0x0A, 0x5F, 0x08, 0x7F, 0x09, 0x6F, 0x0A, 0x55, 0xF6,
+  0x45, 0xF0, 0x25, 0x35, 0xF0, 0x25, 0x35, 0xF0, 0x35, 0x25, 0xF0, 0x35,
+  0x25, 0xF0, 0x35, 0x25, 0xF0, 0x35, 0x25, 0xF0, 0x35, 0x25, 0xF0, 0x35,
+  0x25, 0xF0, 0x35, 0x25, 0xF0, 0x35, 0x25, 0xF0, 0x35, 0x25, 0xF0, 0x35,
+  0x25, 0xF0, 0x36, 0x15, 0xF0, 0x45, 0x15, 0xF0, 0x46, 0xA9, 0xF0, 0x3F,
+  0xEF, 0x03, 0xAF, 0x06, 0x97, 0x87, 0x76, 0xC6, 0x56, 0xE5, 0x55, 0xF0,
+  0x15, 0x45, 0xF0, 0x15, 0x44, 0xF0, 0x34, 0x44, 0xF0, 0x34, 0x44, 0xF0,
+  0x34, 0x45, 0xF0, 0xA6, 0xF0, 0x97, 0xF0, 0x98, 0xF0, 0x7C, 0xF0, 0x4F,
+  0xF0, 0x2F, 0x01, 0xF0, 0x1F, 0x02, 0xF0, 0x2E, 0xF0, 0x5B, 0xF0, 0x79,
+  0xF0, 0x97, 0xF0, 0x96, 0xF0, 0xA5, 0x15, 0xF0, 0x5A, 0xF0, 0x55, 0x14,
+  0xF0, 0x55, 0x14, 0xF0, 0x54, 0x25, 0xF0, 0x35, 0x26, 0xF0, 0x25, 0x36,
+  0xF5, 0x47, 0xD6, 0x59, 0x78, 0x7F, 0x07, 0x9F, 0x05, 0xCF, 0x01, 0xF0,
+  0x2A, 0xA0, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0B, 0xC4, 0xF0,
+  0xA4, 0xF0, 0xA4, 0xF0, 0xA4, 0xF0, 0xA4, 0xF0, 0xA4, 0xF0, 0xA4, 0xF0,
+  0xA4, 0xF0, 0xA4, 0xF0, 0xA4, 0xF0, 0xA4, 0xF0, 0xA4, 0xF0, 0xA4, 0xF0,
+  0xA4, 0xF0, 0xA4, 0xF0, 0xA4, 0xF0, 0xA4, 0xF0, 0xA4, 0xF0, 0xA4, 0xF0,
+  0xA4, 0xF0, 0xA4, 0xF0, 0xA4, 0xF0, 0xA4, 0xF0, 0xA4, 0xF0, 0xA4, 0xF0,
+  0xA4, 0xF0, 0xA4, 0xF0, 0xA4, 0xF0, 0xA4, 0xF0, 0xA4, 0xF0, 0xA4, 0xF0,
+  0xA4, 0xF0, 0xA4, 0xD0, 0x05, 0xF0, 0x4A, 0xF0, 0x4A, 0xF0, 0x4A, 0xF0,
+  0x4A, 0xF0, 0x4A, 0xF0, 0x4A, 0xF0, 0x4A, 0xF0, 0x4A, 0xF0, 0x4A, 0xF0,
+  0x4A, 0xF0, 0x4A, 0xF0, 0x4A, 0xF0, 0x4A, 0xF0, 0x4A, 0xF0, 0x4A, 0xF0,
+  0x4A, 0xF0, 0x4A, 0xF0, 0x4A, 0xF0, 0x4A, 0xF0, 0x4A, 0xF0, 0x4A, 0xF0,
+  0x4A, 0xF0, 0x4A, 0xF0, 0x4A, 0xF0, 0x4A, 0xF0, 0x4A, 0xF0, 0x4A, 0xF0,
+  0x44, 0x15, 0xF0, 0x35, 0x25, 0xF0, 0x25, 0x25, 0xF0, 0x16, 0x26, 0xE6,
+  0x46, 0xC7, 0x59, 0x59, 0x7F, 0x06, 0x9F, 0x04, 0xCF, 0xF0, 0x1A, 0xA0,
+  0x05, 0xF0, 0x6A, 0xF0, 0x65, 0x15, 0xF0, 0x45, 0x25, 0xF0, 0x45, 0x25,
+  0xF0, 0x45, 0x35, 0xF0, 0x25, 0x45, 0xF0, 0x25, 0x45, 0xF0, 0x24, 0x65,
+  0xF5, 0x65, 0xF5, 0x75, 0xE4, 0x85, 0xD5, 0x85, 0xD5, 0x95, 0xC4, 0xA5,
+  0xB5, 0xA5, 0xB5, 0xB5, 0xA4, 0xC5, 0x95, 0xC5, 0x95, 0xD5, 0x84, 0xE5,
+  0x75, 0xE5, 0x75, 0xF5, 0x64, 0xF0, 0x15, 0x55, 0xF0, 0x24, 0x55, 0xF0,
+  0x25, 0x44, 0xF0, 0x35, 0x35, 0xF0, 0x44, 0x35, 0xF0, 0x45, 0x24, 0xF0,
+  0x55, 0x15, 0xF0, 0x64, 0x14, 0xF0, 0x79, 0xF0, 0x79, 0xF0, 0x87, 0xF0,
+  0x97, 0xF0, 0xA6, 0xF0, 0xA5, 0xD0, 0x05, 0xF6, 0xFA, 0xF6, 0xEC, 0xE6,
+  0xE5, 0x25, 0xD7, 0xE5, 0x25, 0xD8, 0xD5, 0x25, 0xD8, 0xC6, 0x26, 0xB9,
+  0xC5, 0x45, 0xBA, 0xB5, 0x45, 0xB4, 0x15, 0xB5, 0x45, 0xB4, 0x24, 0xA6,
+  0x46, 0x95, 0x24, 0xA5, 0x65, 0x94, 0x35, 0x95, 0x65, 0x94, 0x35, 0x95,
+  0x65, 0x94, 0x44, 0x94, 0x75, 0x85, 0x44, 0x85, 0x85, 0x74, 0x55, 0x75,
+  0x85, 0x74, 0x64, 0x75, 0x85, 0x65, 0x64, 0x74, 0x95, 0x65, 0x65, 0x55,
+  0xA5, 0x54, 0x75, 0x55, 0xA5, 0x54, 0x84, 0x55, 0xA5, 0x45, 0x84, 0x54,
+  0xC4, 0x44, 0x95, 0x44, 0xC5, 0x34, 0xA4, 0x35, 0xC5, 0x34, 0xA4, 0x35,
+  0xC5, 0x25, 0xA5, 0x24, 0xE4, 0x24, 0xB5, 0x24, 0xE4, 0x24, 0xC4, 0x15,
+  0xEA, 0xC4, 0x15, 0xEA, 0xC9, 0xF0, 0x18, 0xD9, 0xF0, 0x18, 0xE8, 0xF0,
+  0x18, 0xE8, 0xF0, 0x17, 0xF7, 0xF0, 0x36, 0xF0, 0x16, 0xF0, 0x36, 0xF0,
+  0x16, 0xF0, 0x36, 0xF0, 0x16, 0x90, 0x16, 0xF0, 0x36, 0x35, 0xF0, 0x26,
+  0x46, 0xF0, 0x15, 0x66, 0xE6, 0x75, 0xD6, 0x86, 0xC5, 0xA6, 0xA6, 0xB5,
+  0x96, 0xC6, 0x85, 0xE6, 0x65, 0xF0, 0x15, 0x56, 0xF0, 0x16, 0x45, 0xF0,
+  0x36, 0x25, 0xF0, 0x55, 0x25, 0xF0, 0x5B, 0xF0, 0x79, 0xF0, 0x98, 0xF0,
+  0xA6, 0xF0, 0xB6, 0xF0, 0xA8, 0xF0, 0x89, 0xF0, 0x7B, 0xF0, 0x65, 0x16,
+  0xF0, 0x45, 0x35, 0xF0, 0x36, 0x45, 0xF0, 0x25, 0x56, 0xF5, 0x75, 0xE6,
+  0x85, 0xD5, 0x96, 0xB5, 0xB6, 0x96, 0xC5, 0x95, 0xD6, 0x75, 0xF6, 0x56,
+  0xF0, 0x15, 0x46, 0xF0, 0x26, 0x36, 0xF0, 0x36, 0x16, 0xF0, 0x46, 0x10,
+  0x06, 0xF0, 0x65, 0x26, 0xF0, 0x46, 0x26, 0xF0, 0x45, 0x46, 0xF0, 0x26,
+  0x55, 0xF0, 0x16, 0x66, 0xF5, 0x86, 0xD6, 0x86, 0xD5, 0xA6, 0xB5, 0xC5,
+  0xB5, 0xC6, 0x95, 0xE6, 0x76, 0xF5, 0x75, 0xF0, 0x16, 0x55, 0xF0, 0x35,
+  0x55, 0xF0, 0x45, 0x35, 0xF0, 0x56, 0x16, 0xF0, 0x65, 0x15, 0xF0, 0x7A,
+  0xF0, 0x99, 0xF0, 0xA7, 0xF0, 0xB6, 0xF0, 0xD5, 0xF0, 0xD5, 0xF0, 0xD5,
+  0xF0, 0xD5, 0xF0, 0xD5, 0xF0, 0xD5, 0xF0, 0xD5, 0xF0, 0xD5, 0xF0, 0xD5,
+  0xF0, 0xD5, 0xF0, 0xD5, 0xF0, 0xD5, 0xF0, 0xD5, 0xF0, 0xD5, 0xF0, 0xD5,
+  0xE0, 0x1F, 0x0C, 0x1F, 0x0C, 0x1F, 0x0C, 0x1F, 0x0C, 0xF0, 0x75, 0xF0,
+  0x76, 0xF0, 0x66, 0xF0, 0x66, 0xF0, 0x66, 0xF0, 0x76, 0xF0, 0x66, 0xF0,
+  0x66, 0xF0, 0x66, 0xF0, 0x76, 0xF0, 0x66, 0xF0, 0x66, 0xF0, 0x66, 0xF0,
+  0x66, 0xF0, 0x76, 0xF0, 0x66, 0xF0, 0x66, 0xF0, 0x66, 0xF0, 0x76, 0xF0,
+  0x66, 0xF0, 0x66, 0xF0, 0x66, 0xF0, 0x66, 0xF0, 0x76, 0xF0, 0x66, 0xF0,
+  0x66, 0xF0, 0x66, 0xF0, 0x76, 0xF0, 0x66, 0xF0, 0x7F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x07, 0x0F, 0x0F, 0x0E, 0x64, 0x64, 0x64, 0x64, 0x64,
+  0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+  0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+  0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x6F, 0x0F,
+  0x0A, 0x03, 0xB3, 0xB3, 0xC3, 0xB3, 0xB3, 0xC2, 0xC3, 0xB3, 0xC2, 0xC3,
+  0xB3, 0xC2, 0xC3, 0xB3, 0xB3, 0xC3, 0xB3, 0xB3, 0xC3, 0xB3, 0xB3, 0xC3,
+  0xB3, 0xB3, 0xC3, 0xB3, 0xB3, 0xC2, 0xC3, 0xB3, 0xC2, 0xC3, 0xB3, 0xC2,
+  0xC3, 0xB3, 0xB3, 0x0F, 0x0F, 0x0A, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5F, 0x0F, 0x0F,
+  0x84, 0xF5, 0xF6, 0xE6, 0xD8, 0xC3, 0x14, 0xB4, 0x23, 0xB4, 0x24, 0xA3,
+  0x43, 0x94, 0x44, 0x83, 0x63, 0x74, 0x63, 0x74, 0x64, 0x63, 0x83, 0x54,
+  0x84, 0x43, 0xA3, 0x34, 0xA3, 0x34, 0xA4, 0x23, 0xC3, 0x10, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x15, 0x75, 0x74, 0x84, 0x84, 0x83, 0x93, 0x93,
+  0x79, 0xED, 0xAF, 0x02, 0x7F, 0x03, 0x76, 0x76, 0x55, 0xA5, 0x55, 0xB4,
+  0x54, 0xC4, 0x54, 0xC4, 0xF0, 0x64, 0xF0, 0x64, 0xF0, 0x46, 0xEB, 0x9F,
+  0x01, 0x7F, 0x03, 0x5C, 0x44, 0x57, 0x94, 0x46, 0xB4, 0x45, 0xC4, 0x44,
+  0xD4, 0x44, 0xD4, 0x44, 0xD4, 0x44, 0xC5, 0x45, 0xA6, 0x46, 0x79, 0x4F,
+  0x09, 0x1F, 0x27, 0x3B, 0x47, 0x57, 0x76, 0x04, 0xF0, 0x54, 0xF0, 0x54,
+  0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54,
+  0xF0, 0x54, 0x57, 0x84, 0x3B, 0x64, 0x2E, 0x44, 0x1F, 0x01, 0x39, 0x57,
+  0x38, 0x86, 0x27, 0xA5, 0x26, 0xC5, 0x15, 0xD5, 0x15, 0xE4, 0x15, 0xEA,
+  0xE9, 0xF9, 0xF9, 0xF9, 0xF9, 0xFA, 0xEA, 0xEA, 0xE4, 0x15, 0xD5, 0x16,
+  0xC5, 0x17, 0xA5, 0x28, 0x86, 0x29, 0x57, 0x34, 0x1F, 0x44, 0x2D, 0x54,
+  0x3B, 0xF7, 0x80, 0x87, 0xDB, 0x9F, 0x6F, 0x02, 0x47, 0x56, 0x45, 0x95,
+  0x25, 0xA5, 0x24, 0xCA, 0xCA, 0xD8, 0xF0, 0x34, 0xF0, 0x34, 0xF0, 0x34,
+  0xF0, 0x34, 0xF0, 0x34, 0xF0, 0x34, 0xF0, 0x34, 0xF0, 0x34, 0xF0, 0x35,
+  0xD9, 0xC5, 0x14, 0xC5, 0x15, 0xB4, 0x35, 0x95, 0x37, 0x56, 0x5F, 0x02,
+  0x6F, 0x8C, 0xD7, 0x70, 0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x44,
+  0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x44, 0x86, 0x54,
+  0x5B, 0x34, 0x4E, 0x14, 0x3F, 0x05, 0x27, 0x59, 0x25, 0x97, 0x15, 0xB6,
+  0x15, 0xCA, 0xDA, 0xD9, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8,
+  0xF9, 0xDA, 0xD5, 0x15, 0xC5, 0x15, 0xB6, 0x25, 0x97, 0x27, 0x59, 0x3F,
+  0x01, 0x13, 0x4E, 0x23, 0x5C, 0x33, 0x87, 0x80, 0x87, 0xFC, 0xAF, 0x8F,
+  0x02, 0x67, 0x57, 0x55, 0x96, 0x35, 0xB5, 0x34, 0xD4, 0x25, 0xD5, 0x14,
+  0xF4, 0x14, 0xF4, 0x14, 0xF4, 0x1F, 0x08, 0x1F, 0x0F, 0x0F, 0x07, 0xF0,
+  0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x55, 0xE4, 0x15, 0xD5, 0x24, 0xD5,
+  0x25, 0xB5, 0x45, 0x96, 0x47, 0x66, 0x6F, 0x02, 0x8F, 0xBC, 0xE8, 0x80,
+  0x75, 0x57, 0x48, 0x48, 0x44, 0x84, 0x84, 0x84, 0x84, 0x84, 0x4F, 0x0F,
+  0x06, 0x44, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84,
+  0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84,
+  0x84, 0x40, 0x86, 0xEB, 0x34, 0x4D, 0x24, 0x3F, 0x14, 0x27, 0x59, 0x25,
+  0x97, 0x15, 0xB6, 0x14, 0xCB, 0xDA, 0xD9, 0xE9, 0xE9, 0xE9, 0xF8, 0xF8,
+  0xF8, 0xF8, 0xE9, 0xEA, 0xDA, 0xD5, 0x14, 0xC6, 0x15, 0xB6, 0x25, 0x97,
+  0x27, 0x54, 0x14, 0x3F, 0x14, 0x4D, 0x24, 0x5B, 0x34, 0x77, 0x45, 0xF0,
+  0x35, 0xF0, 0x34, 0x15, 0xD4, 0x24, 0xC5, 0x25, 0xB4, 0x36, 0x86, 0x4F,
+  0x03, 0x6F, 0x01, 0x9D, 0xC8, 0x80, 0x04, 0xF0, 0x24, 0xF0, 0x24, 0xF0,
+  0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0,
+  0x24, 0x57, 0x54, 0x3B, 0x34, 0x2D, 0x24, 0x1F, 0x18, 0x7D, 0x9B, 0xAA,
+  0xC9, 0xC9, 0xC8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8,
+  0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD4, 0x0F, 0x0A, 0xF0,
+  0xAF, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x45, 0x45, 0x45,
+  0x45, 0x45, 0xF0, 0xF0, 0xF0, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45,
+  0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45,
+  0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45,
+  0x45, 0x45, 0x4D, 0x18, 0x17, 0x25, 0x40, 0x04, 0xF0, 0x44, 0xF0, 0x44,
+  0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x44,
+  0xF0, 0x44, 0xF0, 0x44, 0xB6, 0x24, 0xA6, 0x34, 0x96, 0x44, 0x86, 0x54,
+  0x76, 0x64, 0x66, 0x74, 0x56, 0x84, 0x46, 0x94, 0x36, 0xA4, 0x26, 0xB4,
+  0x17, 0xBD, 0xAE, 0x97, 0x25, 0x96, 0x45, 0x85, 0x56, 0x74, 0x75, 0x74,
+  0x85, 0x64, 0x85, 0x64, 0x95, 0x54, 0x96, 0x44, 0xA5, 0x44, 0xB5, 0x34,
+  0xB6, 0x24, 0xC5, 0x24, 0xC6, 0x14, 0xD5, 0x10, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0D, 0x96, 0x97, 0x44, 0x3A, 0x5B, 0x24,
+  0x2C, 0x3D, 0x14, 0x1E, 0x1E, 0x18, 0x5A, 0x6C, 0x88, 0x8B, 0x96, 0xA9,
+  0xA6, 0xA9, 0xA5, 0xB8, 0xC4, 0xB8, 0xC4, 0xB8, 0xC4, 0xB8, 0xC4, 0xB8,
+  0xC4, 0xB8, 0xC4, 0xB8, 0xC4, 0xB8, 0xC4, 0xB8, 0xC4, 0xB8, 0xC4, 0xB8,
+  0xC4, 0xB8, 0xC4, 0xB8, 0xC4, 0xB8, 0xC4, 0xB8, 0xC4, 0xB8, 0xC4, 0xB8,
+  0xC4, 0xB8, 0xC4, 0xB8, 0xC4, 0xB4, 0xA6, 0x54, 0x4A, 0x34, 0x2E, 0x14,
+  0x1F, 0x14, 0x13, 0x7D, 0x9B, 0xAA, 0xC9, 0xC9, 0xC9, 0xC8, 0xD8, 0xD8,
+  0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8,
+  0xD8, 0xD8, 0xD4, 0x87, 0xED, 0xAF, 0x8F, 0x02, 0x67, 0x57, 0x55, 0x96,
+  0x35, 0xB5, 0x35, 0xC4, 0x25, 0xD5, 0x15, 0xD5, 0x14, 0xF4, 0x14, 0xF4,
+  0x14, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF4, 0x14, 0xF4, 0x15, 0xD5, 0x15,
+  0xD5, 0x24, 0xD5, 0x25, 0xB5, 0x45, 0x96, 0x47, 0x57, 0x6F, 0x02, 0x8F,
+  0xAD, 0xE7, 0x90, 0xA6, 0x84, 0x3B, 0x64, 0x2D, 0x54, 0x1F, 0x49, 0x57,
+  0x38, 0x86, 0x27, 0xA5, 0x26, 0xC5, 0x15, 0xD5, 0x15, 0xE4, 0x15, 0xEA,
+  0xE9, 0xF9, 0xF9, 0xF9, 0xF9, 0xFA, 0xEA, 0xEA, 0xE4, 0x15, 0xD5, 0x16,
+  0xC5, 0x17, 0xA5, 0x28, 0x86, 0x29, 0x57, 0x34, 0x1F, 0x01, 0x34, 0x2E,
+  0x44, 0x3B, 0x64, 0x57, 0x84, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0,
+  0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0,
+  0x50, 0x86, 0xEB, 0x43, 0x4E, 0x23, 0x3F, 0x01, 0x13, 0x27, 0x59, 0x25,
+  0x97, 0x15, 0xB6, 0x15, 0xCA, 0xDA, 0xD9, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8,
+  0xF8, 0xF8, 0xF8, 0xF9, 0xDA, 0xD5, 0x15, 0xC5, 0x15, 0xB6, 0x16, 0x97,
+  0x27, 0x59, 0x3F, 0x05, 0x4E, 0x14, 0x5C, 0x24, 0x87, 0x44, 0xF0, 0x44,
+  0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x44,
+  0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x44, 0x98, 0x3A, 0x2B, 0x1C, 0x1F, 0x01,
+  0x57, 0x66, 0x75, 0x85, 0x85, 0x84, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94,
+  0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x90, 0x78,
+  0xAD, 0x7F, 0x5F, 0x02, 0x36, 0x76, 0x25, 0x95, 0x24, 0xA5, 0x15, 0xB4,
+  0x15, 0xF0, 0x15, 0xF0, 0x25, 0xF0, 0x17, 0xFA, 0xCD, 0x9E, 0xAC, 0xD9,
+  0xF7, 0xF0, 0x15, 0xF0, 0x28, 0xD9, 0xC9, 0xCA, 0xA5, 0x16, 0x76, 0x2F,
+  0x04, 0x3F, 0x02, 0x5E, 0xA9, 0x60, 0x44, 0x84, 0x84, 0x84, 0x84, 0x84,
+  0x84, 0x4F, 0x0F, 0x06, 0x44, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84,
+  0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84,
+  0x84, 0x88, 0x48, 0x57, 0x66, 0x04, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8,
+  0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8,
+  0xD8, 0xC9, 0xCA, 0xAB, 0x97, 0x16, 0x68, 0x1F, 0x05, 0x2E, 0x14, 0x3B,
+  0x34, 0x58, 0x80, 0x14, 0xF5, 0x15, 0xD5, 0x25, 0xD5, 0x34, 0xD4, 0x45,
+  0xB5, 0x45, 0xB5, 0x54, 0xB4, 0x65, 0x95, 0x65, 0x95, 0x74, 0x94, 0x85,
+  0x75, 0x85, 0x74, 0xA4, 0x74, 0xA5, 0x55, 0xB4, 0x54, 0xC4, 0x54, 0xC5,
+  0x34, 0xE4, 0x34, 0xE4, 0x34, 0xE5, 0x14, 0xF0, 0x14, 0x14, 0xF0, 0x14,
+  0x14, 0xF0, 0x18, 0xF0, 0x37, 0xF0, 0x36, 0xF0, 0x46, 0xF0, 0x55, 0xA0,
+  0x14, 0xB5, 0xA5, 0x15, 0x96, 0xA5, 0x15, 0x97, 0x95, 0x15, 0x97, 0x94,
+  0x34, 0x97, 0x85, 0x35, 0x78, 0x85, 0x35, 0x79, 0x74, 0x54, 0x74, 0x14,
+  0x74, 0x54, 0x74, 0x14, 0x65, 0x55, 0x54, 0x24, 0x64, 0x65, 0x54, 0x25,
+  0x54, 0x74, 0x54, 0x34, 0x54, 0x74, 0x54, 0x34, 0x45, 0x75, 0x34, 0x44,
+  0x44, 0x94, 0x34, 0x45, 0x34, 0x94, 0x34, 0x54, 0x34, 0x94, 0x34, 0x54,
+  0x24, 0xA5, 0x14, 0x64, 0x24, 0xB4, 0x14, 0x65, 0x14, 0xB4, 0x14, 0x74,
+  0x14, 0xB9, 0x78, 0xD7, 0x88, 0xD7, 0x88, 0xD7, 0x96, 0xF6, 0x96, 0xF5,
+  0xA6, 0xF5, 0xA6, 0x70, 0x15, 0xC5, 0x35, 0xB4, 0x55, 0x95, 0x55, 0x85,
+  0x75, 0x74, 0x94, 0x65, 0x95, 0x45, 0xB5, 0x34, 0xD4, 0x25, 0xDA, 0xF8,
+  0xF0, 0x27, 0xF0, 0x26, 0xF0, 0x45, 0xF0, 0x36, 0xF0, 0x28, 0xF0, 0x19,
+  0xE5, 0x14, 0xD5, 0x25, 0xC4, 0x45, 0xA5, 0x54, 0x95, 0x65, 0x84, 0x85,
+  0x65, 0x94, 0x55, 0xA5, 0x44, 0xC5, 0x25, 0xC5, 0x10, 0x14, 0xE5, 0x15,
+  0xD4, 0x25, 0xC5, 0x34, 0xC5, 0x35, 0xB4, 0x45, 0xA5, 0x54, 0xA4, 0x64,
+  0xA4, 0x65, 0x85, 0x74, 0x84, 0x84, 0x84, 0x85, 0x65, 0x94, 0x64, 0xA4,
+  0x55, 0xA5, 0x45, 0xB4, 0x44, 0xC4, 0x35, 0xC5, 0x24, 0xE4, 0x24, 0xE4,
+  0x15, 0xE9, 0xF0, 0x18, 0xF0, 0x18, 0xF0, 0x17, 0xF0, 0x36, 0xF0, 0x36,
+  0xF0, 0x35, 0xF0, 0x45, 0xF0, 0x44, 0xF0, 0x54, 0xF0, 0x45, 0xF0, 0x44,
+  0xF0, 0x45, 0xF0, 0x36, 0xE9, 0xF8, 0xF0, 0x18, 0xF0, 0x16, 0xF0, 0x10,
+  0x1F, 0x05, 0x1F, 0x05, 0x1F, 0x05, 0x1F, 0x05, 0xF5, 0xF5, 0xF5, 0xF5,
+  0xF0, 0x15, 0xF5, 0xF5, 0xF5, 0xF5, 0xF6, 0xF5, 0xF5, 0xF5, 0xF5, 0xF6,
+  0xF5, 0xF5, 0xF5, 0xF5, 0xF0, 0x1F, 0x0F, 0x0F, 0x0F, 0x0F, 0x09, 0x75,
+  0x66, 0x57, 0x55, 0x64, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84,
+  0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x74, 0x75, 0x56, 0x65, 0x75,
+  0x76, 0x85, 0x84, 0x94, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84,
+  0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x95, 0x77, 0x66, 0x75, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x09, 0x05, 0x76, 0x67,
+  0x75, 0x94, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84,
+  0x84, 0x84, 0x84, 0x84, 0x84, 0x94, 0x85, 0x86, 0x84, 0x75, 0x66, 0x55,
+  0x74, 0x74, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84,
+  0x84, 0x84, 0x84, 0x84, 0x84, 0x65, 0x57, 0x56, 0x65, 0x70, 0x26, 0xF9,
+  0x93, 0x1A, 0x87, 0x36, 0x66, 0x57, 0x33, 0x13, 0x7B, 0x12, 0x99, 0xF7,
+  0x20, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x02,
+  0xF0, 0xE8, 0xB7, 0xB8, 0x8D, 0x88, 0x7F, 0x78, 0x6F, 0x02, 0x68, 0x56,
+  0x67, 0x58, 0x55, 0x96, 0x48, 0x45, 0xB5, 0x48, 0x44, 0xC5, 0x48, 0x44,
+  0xD4, 0x48, 0x44, 0xD5, 0x38, 0x44, 0xD4, 0x48, 0x44, 0xD4, 0x48, 0xF0,
+  0x55, 0x48, 0xF0, 0x55, 0x48, 0xF0, 0x45, 0x58, 0xF0, 0x36, 0x58, 0xF0,
+  0x26, 0x68, 0xF0, 0x16, 0x78, 0xF6, 0x88, 0xE5, 0xA8, 0xD5, 0xB8, 0xC6,
+  0xB8, 0xC5, 0xC8, 0xC5, 0xC8, 0xC4, 0xD8, 0xC4, 0xD8, 0xC4, 0xD8, 0xF0,
+  0xE8, 0xF0, 0xE8, 0xF0, 0xE8, 0xF0, 0xE8, 0xF0, 0xE8, 0xC4, 0xD8, 0xC4,
+  0xD8, 0xC4, 0xD8, 0xC4, 0xD8, 0xC4, 0xD8, 0xF0, 0xE8, 0xF0, 0xEF, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x02, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x02, 0xF0, 0xE8, 0xB7, 0xB8,
+  0x8D, 0x88, 0x7F, 0x78, 0x6F, 0x02, 0x68, 0x56, 0x67, 0x58, 0x55, 0x96,
+  0x48, 0x45, 0xB5, 0x48, 0x44, 0xC5, 0x48, 0x44, 0xD4, 0x48, 0x44, 0xD5,
+  0x38, 0x44, 0xD4, 0x48, 0x44, 0xD4, 0x48, 0xF0, 0x55, 0x48, 0xF0, 0x55,
+  0x48, 0xF0, 0x45, 0x58, 0xF0, 0x36, 0x58, 0xF0, 0x26, 0x68, 0xF0, 0x16,
+  0x78, 0xF6, 0x88, 0xE5, 0xA8, 0xD5, 0xB8, 0xC6, 0xB8, 0xC5, 0xC8, 0xC5,
+  0xC8, 0xC4, 0xD8, 0xC4, 0xD8, 0xC4, 0xD8, 0xF0, 0xE8, 0xF0, 0xE8, 0xF0,
+  0xE8, 0xF0, 0xE8, 0xF0, 0xE8, 0xC4, 0xD8, 0xC4, 0xD8, 0xC4, 0xD8, 0xC4,
+  0xD8, 0xC4, 0xD8, 0xF0, 0xE8, 0xF0, 0xEF, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x02, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x02, 0xF0, 0xE8, 0xB7, 0xB8, 0x8D, 0x88, 0x7F, 0x78,
+  0x6F, 0x02, 0x68, 0x56, 0x67, 0x58, 0x55, 0x96, 0x48, 0x45, 0xB5, 0x48,
+  0x44, 0xC5, 0x48, 0x44, 0xD4, 0x48, 0x44, 0xD5, 0x38, 0x44, 0xD4, 0x48,
+  0x44, 0xD4, 0x48, 0xF0, 0x55, 0x48, 0xF0, 0x55, 0x48, 0xF0, 0x45, 0x58,
+  0xF0, 0x36, 0x58, 0xF0, 0x26, 0x68, 0xF0, 0x16, 0x78, 0xF6, 0x88, 0xE5,
+  0xA8, 0xD5, 0xB8, 0xC6, 0xB8, 0xC5, 0xC8, 0xC5, 0xC8, 0xC4, 0xD8, 0xC4,
+  0xD8, 0xC4, 0xD8, 0xF0, 0xE8, 0xF0, 0xE8, 0xF0, 0xE8, 0xF0, 0xE8, 0xF0,
+  0xE8, 0xC4, 0xD8, 0xC4, 0xD8, 0xC4, 0xD8, 0xC4, 0xD8, 0xC4, 0xD8, 0xF0,
+  0xE8, 0xF0, 0xEF, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x02, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x02,
+  0xF0, 0xE8, 0xB7, 0xB8, 0x8D, 0x88, 0x7F, 0x78, 0x6F, 0x02, 0x68, 0x56,
+  0x67, 0x58, 0x55, 0x96, 0x48, 0x45, 0xB5, 0x48, 0x44, 0xC5, 0x48, 0x44,
+  0xD4, 0x48, 0x44, 0xD5, 0x38, 0x44, 0xD4, 0x48, 0x44, 0xD4, 0x48, 0xF0,
+  0x55, 0x48, 0xF0, 0x55, 0x48, 0xF0, 0x45, 0x58, 0xF0, 0x36, 0x58, 0xF0,
+  0x26, 0x68, 0xF0, 0x16, 0x78, 0xF6, 0x88, 0xE5, 0xA8, 0xD5, 0xB8, 0xC6,
+  0xB8, 0xC5, 0xC8, 0xC5, 0xC8, 0xC4, 0xD8, 0xC4, 0xD8, 0xC4, 0xD8, 0xF0,
+  0xE8, 0xF0, 0xE8, 0xF0, 0xE8, 0xF0, 0xE8, 0xF0, 0xE8, 0xC4, 0xD8, 0xC4,
+  0xD8, 0xC4, 0xD8, 0xC4, 0xD8, 0xC4, 0xD8, 0xF0, 0xE8, 0xF0, 0xEF, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x02, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x02, 0xF0, 0xE8, 0xB7, 0xB8,
+  0x8D, 0x88, 0x7F, 0x78, 0x6F, 0x02, 0x68, 0x56, 0x67, 0x58, 0x55, 0x96,
+  0x48, 0x45, 0xB5, 0x48, 0x44, 0xC5, 0x48, 0x44, 0xD4, 0x48, 0x44, 0xD5,
+  0x38, 0x44, 0xD4, 0x48, 0x44, 0xD4, 0x48, 0xF0, 0x55, 0x48, 0xF0, 0x55,
+  0x48, 0xF0, 0x45, 0x58, 0xF0, 0x36, 0x58, 0xF0, 0x26, 0x68, 0xF0, 0x16,
+  0x78, 0xF6, 0x88, 0xE5, 0xA8, 0xD5, 0xB8, 0xC6, 0xB8, 0xC5, 0xC8, 0xC5,
+  0xC8, 0xC4, 0xD8, 0xC4, 0xD8, 0xC4, 0xD8, 0xF0, 0xE8, 0xF0, 0xE8, 0xF0,
+  0xE8, 0xF0, 0xE8, 0xF0, 0xE8, 0xC4, 0xD8, 0xC4, 0xD8, 0xC4, 0xD8, 0xC4,
+  0xD8, 0xC4, 0xD8, 0xF0, 0xE8, 0xF0, 0xEF, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x02, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x02, 0xF0, 0xE8, 0xB7, 0xB8, 0x8D, 0x88, 0x7F, 0x78,
+  0x6F, 0x02, 0x68, 0x56, 0x67, 0x58, 0x55, 0x96, 0x48, 0x45, 0xB5, 0x48,
+  0x44, 0xC5, 0x48, 0x44, 0xD4, 0x48, 0x44, 0xD5, 0x38, 0x44, 0xD4, 0x48,
+  0x44, 0xD4, 0x48, 0xF0, 0x55, 0x48, 0xF0, 0x55, 0x48, 0xF0, 0x45, 0x58,
+  0xF0, 0x36, 0x58, 0xF0, 0x26, 0x68, 0xF0, 0x16, 0x78, 0xF6, 0x88, 0xE5,
+  0xA8, 0xD5, 0xB8, 0xC6, 0xB8, 0xC5, 0xC8, 0xC5, 0xC8, 0xC4, 0xD8, 0xC4,
+  0xD8, 0xC4, 0xD8, 0xF0, 0xE8, 0xF0, 0xE8, 0xF0, 0xE8, 0xF0, 0xE8, 0xF0,
+  0xE8, 0xC4, 0xD8, 0xC4, 0xD8, 0xC4, 0xD8, 0xC4, 0xD8, 0xC4, 0xD8, 0xF0,
+  0xE8, 0xF0, 0xEF, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x02, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x02,
+  0xF0, 0xE8, 0xB7, 0xB8, 0x8D, 0x88, 0x7F, 0x78, 0x6F, 0x02, 0x68, 0x56,
+  0x67, 0x58, 0x55, 0x96, 0x48, 0x45, 0xB5, 0x48, 0x44, 0xC5, 0x48, 0x44,
+  0xD4, 0x48, 0x44, 0xD5, 0x38, 0x44, 0xD4, 0x48, 0x44, 0xD4, 0x48, 0xF0,
+  0x55, 0x48, 0xF0, 0x55, 0x48, 0xF0, 0x45, 0x58, 0xF0, 0x36, 0x58, 0xF0,
+  0x26, 0x68, 0xF0, 0x16, 0x78, 0xF6, 0x88, 0xE5, 0xA8, 0xD5, 0xB8, 0xC6,
+  0xB8, 0xC5, 0xC8, 0xC5, 0xC8, 0xC4, 0xD8, 0xC4, 0xD8, 0xC4, 0xD8, 0xF0,
+  0xE8, 0xF0, 0xE8, 0xF0, 0xE8, 0xF0, 0xE8, 0xF0, 0xE8, 0xC4, 0xD8, 0xC4,
+  0xD8, 0xC4, 0xD8, 0xC4, 0xD8, 0xC4, 0xD8, 0xF0, 0xE8, 0xF0, 0xEF, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x02, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x02, 0xF0, 0xE8, 0xB7, 0xB8,
+  0x8D, 0x88, 0x7F, 0x78, 0x6F, 0x02, 0x68, 0x56, 0x67, 0x58, 0x55, 0x96,
+  0x48, 0x45, 0xB5, 0x48, 0x44, 0xC5, 0x48, 0x44, 0xD4, 0x48, 0x44, 0xD5,
+  0x38, 0x44, 0xD4, 0x48, 0x44, 0xD4, 0x48, 0xF0, 0x55, 0x48, 0xF0, 0x55,
+  0x48, 0xF0, 0x45, 0x58, 0xF0, 0x36, 0x58, 0xF0, 0x26, 0x68, 0xF0, 0x16,
+  0x78, 0xF6, 0x88, 0xE5, 0xA8, 0xD5, 0xB8, 0xC6, 0xB8, 0xC5, 0xC8, 0xC5,
+  0xC8, 0xC4, 0xD8, 0xC4, 0xD8, 0xC4, 0xD8, 0xF0, 0xE8, 0xF0, 0xE8, 0xF0,
+  0xE8, 0xF0, 0xE8, 0xF0, 0xE8, 0xC4, 0xD8, 0xC4, 0xD8, 0xC4, 0xD8, 0xC4,
+  0xD8, 0xC4, 0xD8, 0xF0, 0xE8, 0xF0, 0xEF, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x02, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x02, 0xF0, 0xE8, 0xB7, 0xB8, 0x8D, 0x88, 0x7F, 0x78,
+  0x6F, 0x02, 0x68, 0x56, 0x67, 0x58, 0x55, 0x96, 0x48, 0x45, 0xB5, 0x48,
+  0x44, 0xC5, 0x48, 0x44, 0xD4, 0x48, 0x44, 0xD5, 0x38, 0x44, 0xD4, 0x48,
+  0x44, 0xD4, 0x48, 0xF0, 0x55, 0x48, 0xF0, 0x55, 0x48, 0xF0, 0x45, 0x58,
+  0xF0, 0x36, 0x58, 0xF0, 0x26, 0x68, 0xF0, 0x16, 0x78, 0xF6, 0x88, 0xE5,
+  0xA8, 0xD5, 0xB8, 0xC6, 0xB8, 0xC5, 0xC8, 0xC5, 0xC8, 0xC4, 0xD8, 0xC4,
+  0xD8, 0xC4, 0xD8, 0xF0, 0xE8, 0xF0, 0xE8, 0xF0, 0xE8, 0xF0, 0xE8, 0xF0,
+  0xE8, 0xC4, 0xD8, 0xC4, 0xD8, 0xC4, 0xD8, 0xC4, 0xD8, 0xC4, 0xD8, 0xF0,
+  0xE8, 0xF0, 0xEF, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x02, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x02,
+  0xF0, 0xE8, 0xB7, 0xB8, 0x8D, 0x88, 0x7F, 0x78, 0x6F, 0x02, 0x68, 0x56,
+  0x67, 0x58, 0x55, 0x96, 0x48, 0x45, 0xB5, 0x48, 0x44, 0xC5, 0x48, 0x44,
+  0xD4, 0x48, 0x44, 0xD5, 0x38, 0x44, 0xD4, 0x48, 0x44, 0xD4, 0x48, 0xF0,
+  0x55, 0x48, 0xF0, 0x55, 0x48, 0xF0, 0x45, 0x58, 0xF0, 0x36, 0x58, 0xF0,
+  0x26, 0x68, 0xF0, 0x16, 0x78, 0xF6, 0x88, 0xE5, 0xA8, 0xD5, 0xB8, 0xC6,
+  0xB8, 0xC5, 0xC8, 0xC5, 0xC8, 0xC4, 0xD8, 0xC4, 0xD8, 0xC4, 0xD8, 0xF0,
+  0xE8, 0xF0, 0xE8, 0xF0, 0xE8, 0xF0, 0xE8, 0xF0, 0xE8, 0xC4, 0xD8, 0xC4,
+  0xD8, 0xC4, 0xD8, 0xC4, 0xD8, 0xC4, 0xD8, 0xF0, 0xE8, 0xF0, 0xEF, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x02, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x02, 0xF0, 0xE8, 0xB7, 0xB8,
+  0x8D, 0x88, 0x7F, 0x78, 0x6F, 0x02, 0x68, 0x56, 0x67, 0x58, 0x55, 0x96,
+  0x48, 0x45, 0xB5, 0x48, 0x44, 0xC5, 0x48, 0x44, 0xD4, 0x48, 0x44, 0xD5,
+  0x38, 0x44, 0xD4, 0x48, 0x44, 0xD4, 0x48, 0xF0, 0x55, 0x48, 0xF0, 0x55,
+  0x48, 0xF0, 0x45, 0x58, 0xF0, 0x36, 0x58, 0xF0, 0x26, 0x68, 0xF0, 0x16,
+  0x78, 0xF6, 0x88, 0xE5, 0xA8, 0xD5, 0xB8, 0xC6, 0xB8, 0xC5, 0xC8, 0xC5,
+  0xC8, 0xC4, 0xD8, 0xC4, 0xD8, 0xC4, 0xD8, 0xF0, 0xE8, 0xF0, 0xE8, 0xF0,
+  0xE8, 0xF0, 0xE8, 0xF0, 0xE8, 0xC4, 0xD8, 0xC4, 0xD8, 0xC4, 0xD8, 0xC4,
+  0xD8, 0xC4, 0xD8, 0xF0, 0xE8, 0xF0, 0xEF, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x02, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x02, 0xF0, 0xE8, 0xB7, 0xB8, 0x8D, 0x88, 0x7F, 0x78,
+  0x6F, 0x02, 0x68, 0x56, 0x67, 0x58, 0x55, 0x96, 0x48, 0x45, 0xB5, 0x48,
+  0x44, 0xC5, 0x48, 0x44, 0xD4, 0x48, 0x44, 0xD5, 0x38, 0x44, 0xD4, 0x48,
+  0x44, 0xD4, 0x48, 0xF0, 0x55, 0x48, 0xF0, 0x55, 0x48, 0xF0, 0x45, 0x58,
+  0xF0, 0x36, 0x58, 0xF0, 0x26, 0x68, 0xF0, 0x16, 0x78, 0xF6, 0x88, 0xE5,
+  0xA8, 0xD5, 0xB8, 0xC6, 0xB8, 0xC5, 0xC8, 0xC5, 0xC8, 0xC4, 0xD8, 0xC4,
+  0xD8, 0xC4, 0xD8, 0xF0, 0xE8, 0xF0, 0xE8, 0xF0, 0xE8, 0xF0, 0xE8, 0xF0,
+  0xE8, 0xC4, 0xD8, 0xC4, 0xD8, 0xC4, 0xD8, 0xC4, 0xD8, 0xC4, 0xD8, 0xF0,
+  0xE8, 0xF0, 0xEF, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x02, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x02,
+  0xF0, 0xE8, 0xB7, 0xB8, 0x8D, 0x88, 0x7F, 0x78, 0x6F, 0x02, 0x68, 0x56,
+  0x67, 0x58, 0x55, 0x96, 0x48, 0x45, 0xB5, 0x48, 0x44, 0xC5, 0x48, 0x44,
+  0xD4, 0x48, 0x44, 0xD5, 0x38, 0x44, 0xD4, 0x48, 0x44, 0xD4, 0x48, 0xF0,
+  0x55, 0x48, 0xF0, 0x55, 0x48, 0xF0, 0x45, 0x58, 0xF0, 0x36, 0x58, 0xF0,
+  0x26, 0x68, 0xF0, 0x16, 0x78, 0xF6, 0x88, 0xE5, 0xA8, 0xD5, 0xB8, 0xC6,
+  0xB8, 0xC5, 0xC8, 0xC5, 0xC8, 0xC4, 0xD8, 0xC4, 0xD8, 0xC4, 0xD8, 0xF0,
+  0xE8, 0xF0, 0xE8, 0xF0, 0xE8, 0xF0, 0xE8, 0xF0, 0xE8, 0xC4, 0xD8, 0xC4,
+  0xD8, 0xC4, 0xD8, 0xC4, 0xD8, 0xC4, 0xD8, 0xF0, 0xE8, 0xF0, 0xEF, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x02, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x02, 0xF0, 0xE8, 0xB7, 0xB8,
+  0x8D, 0x88, 0x7F, 0x78, 0x6F, 0x02, 0x68, 0x56, 0x67, 0x58, 0x55, 0x96,
+  0x48, 0x45, 0xB5, 0x48, 0x44, 0xC5, 0x48, 0x44, 0xD4, 0x48, 0x44, 0xD5,
+  0x38, 0x44, 0xD4, 0x48, 0x44, 0xD4, 0x48, 0xF0, 0x55, 0x48, 0xF0, 0x55,
+  0x48, 0xF0, 0x45, 0x58, 0xF0, 0x36, 0x58, 0xF0, 0x26, 0x68, 0xF0, 0x16,
+  0x78, 0xF6, 0x88, 0xE5, 0xA8, 0xD5, 0xB8, 0xC6, 0xB8, 0xC5, 0xC8, 0xC5,
+  0xC8, 0xC4, 0xD8, 0xC4, 0xD8, 0xC4, 0xD8, 0xF0, 0xE8, 0xF0, 0xE8, 0xF0,
+  0xE8, 0xF0, 0xE8, 0xF0, 0xE8, 0xC4, 0xD8, 0xC4, 0xD8, 0xC4, 0xD8, 0xC4,
+  0xD8, 0xC4, 0xD8, 0xF0, 0xE8, 0xF0, 0xEF, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x02, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x02, 0xF0, 0xE8, 0xB7, 0xB8, 0x8D, 0x88, 0x7F, 0x78,
+  0x6F, 0x02, 0x68, 0x56, 0x67, 0x58, 0x55, 0x96, 0x48, 0x45, 0xB5, 0x48,
+  0x44, 0xC5, 0x48, 0x44, 0xD4, 0x48, 0x44, 0xD5, 0x38, 0x44, 0xD4, 0x48,
+  0x44, 0xD4, 0x48, 0xF0, 0x55, 0x48, 0xF0, 0x55, 0x48, 0xF0, 0x45, 0x58,
+  0xF0, 0x36, 0x58, 0xF0, 0x26, 0x68, 0xF0, 0x16, 0x78, 0xF6, 0x88, 0xE5,
+  0xA8, 0xD5, 0xB8, 0xC6, 0xB8, 0xC5, 0xC8, 0xC5, 0xC8, 0xC4, 0xD8, 0xC4,
+  0xD8, 0xC4, 0xD8, 0xF0, 0xE8, 0xF0, 0xE8, 0xF0, 0xE8, 0xF0, 0xE8, 0xF0,
+  0xE8, 0xC4, 0xD8, 0xC4, 0xD8, 0xC4, 0xD8, 0xC4, 0xD8, 0xC4, 0xD8, 0xF0,
+  0xE8, 0xF0, 0xEF, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x02, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x02,
+  0xF0, 0xE8, 0xB7, 0xB8, 0x8D, 0x88, 0x7F, 0x78, 0x6F, 0x02, 0x68, 0x56,
+  0x67, 0x58, 0x55, 0x96, 0x48, 0x45, 0xB5, 0x48, 0x44, 0xC5, 0x48, 0x44,
+  0xD4, 0x48, 0x44, 0xD5, 0x38, 0x44, 0xD4, 0x48, 0x44, 0xD4, 0x48, 0xF0,
+  0x55, 0x48, 0xF0, 0x55, 0x48, 0xF0, 0x45, 0x58, 0xF0, 0x36, 0x58, 0xF0,
+  0x26, 0x68, 0xF0, 0x16, 0x78, 0xF6, 0x88, 0xE5, 0xA8, 0xD5, 0xB8, 0xC6,
+  0xB8, 0xC5, 0xC8, 0xC5, 0xC8, 0xC4, 0xD8, 0xC4, 0xD8, 0xC4, 0xD8, 0xF0,
+  0xE8, 0xF0, 0xE8, 0xF0, 0xE8, 0xF0, 0xE8, 0xF0, 0xE8, 0xC4, 0xD8, 0xC4,
+  0xD8, 0xC4, 0xD8, 0xC4, 0xD8, 0xC4, 0xD8, 0xF0, 0xE8, 0xF0, 0xEF, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x02, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x02, 0xF0, 0xE8, 0xB7, 0xB8,
+  0x8D, 0x88, 0x7F, 0x78, 0x6F, 0x02, 0x68, 0x56, 0x67, 0x58, 0x55, 0x96,
+  0x48, 0x45, 0xB5, 0x48, 0x44, 0xC5, 0x48, 0x44, 0xD4, 0x48, 0x44, 0xD5,
+  0x38, 0x44, 0xD4, 0x48, 0x44, 0xD4, 0x48, 0xF0, 0x55, 0x48, 0xF0, 0x55,
+  0x48, 0xF0, 0x45, 0x58, 0xF0, 0x36, 0x58, 0xF0, 0x26, 0x68, 0xF0, 0x16,
+  0x78, 0xF6, 0x88, 0xE5, 0xA8, 0xD5, 0xB8, 0xC6, 0xB8, 0xC5, 0xC8, 0xC5,
+  0xC8, 0xC4, 0xD8, 0xC4, 0xD8, 0xC4, 0xD8, 0xF0, 0xE8, 0xF0, 0xE8, 0xF0,
+  0xE8, 0xF0, 0xE8, 0xF0, 0xE8, 0xC4, 0xD8, 0xC4, 0xD8, 0xC4, 0xD8, 0xC4,
+  0xD8, 0xC4, 0xD8, 0xF0, 0xE8, 0xF0, 0xEF, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x02, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x02, 0xF0, 0xE8, 0xB7, 0xB8, 0x8D, 0x88, 0x7F, 0x78,
+  0x6F, 0x02, 0x68, 0x56, 0x67, 0x58, 0x55, 0x96, 0x48, 0x45, 0xB5, 0x48,
+  0x44, 0xC5, 0x48, 0x44, 0xD4, 0x48, 0x44, 0xD5, 0x38, 0x44, 0xD4, 0x48,
+  0x44, 0xD4, 0x48, 0xF0, 0x55, 0x48, 0xF0, 0x55, 0x48, 0xF0, 0x45, 0x58,
+  0xF0, 0x36, 0x58, 0xF0, 0x26, 0x68, 0xF0, 0x16, 0x78, 0xF6, 0x88, 0xE5,
+  0xA8, 0xD5, 0xB8, 0xC6, 0xB8, 0xC5, 0xC8, 0xC5, 0xC8, 0xC4, 0xD8, 0xC4,
+  0xD8, 0xC4, 0xD8, 0xF0, 0xE8, 0xF0, 0xE8, 0xF0, 0xE8, 0xF0, 0xE8, 0xF0,
+  0xE8, 0xC4, 0xD8, 0xC4, 0xD8, 0xC4, 0xD8, 0xC4, 0xD8, 0xC4, 0xD8, 0xF0,
+  0xE8, 0xF0, 0xEF, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x02, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x02,
+  0xF0, 0xE8, 0xB7, 0xB8, 0x8D, 0x88, 0x7F, 0x78, 0x6F, 0x02, 0x68, 0x56,
+  0x67, 0x58, 0x55, 0x96, 0x48, 0x45, 0xB5, 0x48, 0x44, 0xC5, 0x48, 0x44,
+  0xD4, 0x48, 0x44, 0xD5, 0x38, 0x44, 0xD4, 0x48, 0x44, 0xD4, 0x48, 0xF0,
+  0x55, 0x48, 0xF0, 0x55, 0x48, 0xF0, 0x45, 0x58, 0xF0, 0x36, 0x58, 0xF0,
+  0x26, 0x68, 0xF0, 0x16, 0x78, 0xF6, 0x88, 0xE5, 0xA8, 0xD5, 0xB8, 0xC6,
+  0xB8, 0xC5, 0xC8, 0xC5, 0xC8, 0xC4, 0xD8, 0xC4, 0xD8, 0xC4, 0xD8, 0xF0,
+  0xE8, 0xF0, 0xE8, 0xF0, 0xE8, 0xF0, 0xE8, 0xF0, 0xE8, 0xC4, 0xD8, 0xC4,
+  0xD8, 0xC4, 0xD8, 0xC4, 0xD8, 0xC4, 0xD8, 0xF0, 0xE8, 0xF0, 0xEF, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x02, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x02, 0xF0, 0xE8, 0xB7, 0xB8,
+  0x8D, 0x88, 0x7F, 0x78, 0x6F, 0x02, 0x68, 0x56, 0x67, 0x58, 0x55, 0x96,
+  0x48, 0x45, 0xB5, 0x48, 0x44, 0xC5, 0x48, 0x44, 0xD4, 0x48, 0x44, 0xD5,
+  0x38, 0x44, 0xD4, 0x48, 0x44, 0xD4, 0x48, 0xF0, 0x55, 0x48, 0xF0, 0x55,
+  0x48, 0xF0, 0x45, 0x58, 0xF0, 0x36, 0x58, 0xF0, 0x26, 0x68, 0xF0, 0x16,
+  0x78, 0xF6, 0x88, 0xE5, 0xA8, 0xD5, 0xB8, 0xC6, 0xB8, 0xC5, 0xC8, 0xC5,
+  0xC8, 0xC4, 0xD8, 0xC4, 0xD8, 0xC4, 0xD8, 0xF0, 0xE8, 0xF0, 0xE8, 0xF0,
+  0xE8, 0xF0, 0xE8, 0xF0, 0xE8, 0xC4, 0xD8, 0xC4, 0xD8, 0xC4, 0xD8, 0xC4,
+  0xD8, 0xC4, 0xD8, 0xF0, 0xE8, 0xF0, 0xEF, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x02, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x02, 0xF0, 0xE8, 0xB7, 0xB8, 0x8D, 0x88, 0x7F, 0x78,
+  0x6F, 0x02, 0x68, 0x56, 0x67, 0x58, 0x55, 0x96, 0x48, 0x45, 0xB5, 0x48,
+  0x44, 0xC5, 0x48, 0x44, 0xD4, 0x48, 0x44, 0xD5, 0x38, 0x44, 0xD4, 0x48,
+  0x44, 0xD4, 0x48, 0xF0, 0x55, 0x48, 0xF0, 0x55, 0x48, 0xF0, 0x45, 0x58,
+  0xF0, 0x36, 0x58, 0xF0, 0x26, 0x68, 0xF0, 0x16, 0x78, 0xF6, 0x88, 0xE5,
+  0xA8, 0xD5, 0xB8, 0xC6, 0xB8, 0xC5, 0xC8, 0xC5, 0xC8, 0xC4, 0xD8, 0xC4,
+  0xD8, 0xC4, 0xD8, 0xF0, 0xE8, 0xF0, 0xE8, 0xF0, 0xE8, 0xF0, 0xE8, 0xF0,
+  0xE8, 0xC4, 0xD8, 0xC4, 0xD8, 0xC4, 0xD8, 0xC4, 0xD8, 0xC4, 0xD8, 0xF0,
+  0xE8, 0xF0, 0xEF, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x02, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x02,
+  0xF0, 0xE8, 0xB7, 0xB8, 0x8D, 0x88, 0x7F, 0x78, 0x6F, 0x02, 0x68, 0x56,
+  0x67, 0x58, 0x55, 0x96, 0x48, 0x45, 0xB5, 0x48, 0x44, 0xC5, 0x48, 0x44,
+  0xD4, 0x48, 0x44, 0xD5, 0x38, 0x44, 0xD4, 0x48, 0x44, 0xD4, 0x48, 0xF0,
+  0x55, 0x48, 0xF0, 0x55, 0x48, 0xF0, 0x45, 0x58, 0xF0, 0x36, 0x58, 0xF0,
+  0x26, 0x68, 0xF0, 0x16, 0x78, 0xF6, 0x88, 0xE5, 0xA8, 0xD5, 0xB8, 0xC6,
+  0xB8, 0xC5, 0xC8, 0xC5, 0xC8, 0xC4, 0xD8, 0xC4, 0xD8, 0xC4, 0xD8, 0xF0,
+  0xE8, 0xF0, 0xE8, 0xF0, 0xE8, 0xF0, 0xE8, 0xF0, 0xE8, 0xC4, 0xD8, 0xC4,
+  0xD8, 0xC4, 0xD8, 0xC4, 0xD8, 0xC4, 0xD8, 0xF0, 0xE8, 0xF0, 0xEF, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x02, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x02, 0xF0, 0xE8, 0xB7, 0xB8,
+  0x8D, 0x88, 0x7F, 0x78, 0x6F, 0x02, 0x68, 0x56, 0x67, 0x58, 0x55, 0x96,
+  0x48, 0x45, 0xB5, 0x48, 0x44, 0xC5, 0x48, 0x44, 0xD4, 0x48, 0x44, 0xD5,
+  0x38, 0x44, 0xD4, 0x48, 0x44, 0xD4, 0x48, 0xF0, 0x55, 0x48, 0xF0, 0x55,
+  0x48, 0xF0, 0x45, 0x58, 0xF0, 0x36, 0x58, 0xF0, 0x26, 0x68, 0xF0, 0x16,
+  0x78, 0xF6, 0x88, 0xE5, 0xA8, 0xD5, 0xB8, 0xC6, 0xB8, 0xC5, 0xC8, 0xC5,
+  0xC8, 0xC4, 0xD8, 0xC4, 0xD8, 0xC4, 0xD8, 0xF0, 0xE8, 0xF0, 0xE8, 0xF0,
+  0xE8, 0xF0, 0xE8, 0xF0, 0xE8, 0xC4, 0xD8, 0xC4, 0xD8, 0xC4, 0xD8, 0xC4,
+  0xD8, 0xC4, 0xD8, 0xF0, 0xE8, 0xF0, 0xEF, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x02, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x02, 0xF0, 0xE8, 0xB7, 0xB8, 0x8D, 0x88, 0x7F, 0x78,
+  0x6F, 0x02, 0x68, 0x56, 0x67, 0x58, 0x55, 0x96, 0x48, 0x45, 0xB5, 0x48,
+  0x44, 0xC5, 0x48, 0x44, 0xD4, 0x48, 0x44, 0xD5, 0x38, 0x44, 0xD4, 0x48,
+  0x44, 0xD4, 0x48, 0xF0, 0x55, 0x48, 0xF0, 0x55, 0x48, 0xF0, 0x45, 0x58,
+  0xF0, 0x36, 0x58, 0xF0, 0x26, 0x68, 0xF0, 0x16, 0x78, 0xF6, 0x88, 0xE5,
+  0xA8, 0xD5, 0xB8, 0xC6, 0xB8, 0xC5, 0xC8, 0xC5, 0xC8, 0xC4, 0xD8, 0xC4,
+  0xD8, 0xC4, 0xD8, 0xF0, 0xE8, 0xF0, 0xE8, 0xF0, 0xE8, 0xF0, 0xE8, 0xF0,
+  0xE8, 0xC4, 0xD8, 0xC4, 0xD8, 0xC4, 0xD8, 0xC4, 0xD8, 0xC4, 0xD8, 0xF0,
+  0xE8, 0xF0, 0xEF, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x02, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x02,
+  0xF0, 0xE8, 0xB7, 0xB8, 0x8D, 0x88, 0x7F, 0x78, 0x6F, 0x02, 0x68, 0x56,
+  0x67, 0x58, 0x55, 0x96, 0x48, 0x45, 0xB5, 0x48, 0x44, 0xC5, 0x48, 0x44,
+  0xD4, 0x48, 0x44, 0xD5, 0x38, 0x44, 0xD4, 0x48, 0x44, 0xD4, 0x48, 0xF0,
+  0x55, 0x48, 0xF0, 0x55, 0x48, 0xF0, 0x45, 0x58, 0xF0, 0x36, 0x58, 0xF0,
+  0x26, 0x68, 0xF0, 0x16, 0x78, 0xF6, 0x88, 0xE5, 0xA8, 0xD5, 0xB8, 0xC6,
+  0xB8, 0xC5, 0xC8, 0xC5, 0xC8, 0xC4, 0xD8, 0xC4, 0xD8, 0xC4, 0xD8, 0xF0,
+  0xE8, 0xF0, 0xE8, 0xF0, 0xE8, 0xF0, 0xE8, 0xF0, 0xE8, 0xC4, 0xD8, 0xC4,
+  0xD8, 0xC4, 0xD8, 0xC4, 0xD8, 0xC4, 0xD8, 0xF0, 0xE8, 0xF0, 0xEF, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x02, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x02, 0xF0, 0xE8, 0xB7, 0xB8,
+  0x8D, 0x88, 0x7F, 0x78, 0x6F, 0x02, 0x68, 0x56, 0x67, 0x58, 0x55, 0x96,
+  0x48, 0x45, 0xB5, 0x48, 0x44, 0xC5, 0x48, 0x44, 0xD4, 0x48, 0x44, 0xD5,
+  0x38, 0x44, 0xD4, 0x48, 0x44, 0xD4, 0x48, 0xF0, 0x55, 0x48, 0xF0, 0x55,
+  0x48, 0xF0, 0x45, 0x58, 0xF0, 0x36, 0x58, 0xF0, 0x26, 0x68, 0xF0, 0x16,
+  0x78, 0xF6, 0x88, 0xE5, 0xA8, 0xD5, 0xB8, 0xC6, 0xB8, 0xC5, 0xC8, 0xC5,
+  0xC8, 0xC4, 0xD8, 0xC4, 0xD8, 0xC4, 0xD8, 0xF0, 0xE8, 0xF0, 0xE8, 0xF0,
+  0xE8, 0xF0, 0xE8, 0xF0, 0xE8, 0xC4, 0xD8, 0xC4, 0xD8, 0xC4, 0xD8, 0xC4,
+  0xD8, 0xC4, 0xD8, 0xF0, 0xE8, 0xF0, 0xEF, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x02, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x02, 0xF0, 0xE8, 0xB7, 0xB8, 0x8D, 0x88, 0x7F, 0x78,
+  0x6F, 0x02, 0x68, 0x56, 0x67, 0x58, 0x55, 0x96, 0x48, 0x45, 0xB5, 0x48,
+  0x44, 0xC5, 0x48, 0x44, 0xD4, 0x48, 0x44, 0xD5, 0x38, 0x44, 0xD4, 0x48,
+  0x44, 0xD4, 0x48, 0xF0, 0x55, 0x48, 0xF0, 0x55, 0x48, 0xF0, 0x45, 0x58,
+  0xF0, 0x36, 0x58, 0xF0, 0x26, 0x68, 0xF0, 0x16, 0x78, 0xF6, 0x88, 0xE5,
+  0xA8, 0xD5, 0xB8, 0xC6, 0xB8, 0xC5, 0xC8, 0xC5, 0xC8, 0xC4, 0xD8, 0xC4,
+  0xD8, 0xC4, 0xD8, 0xF0, 0xE8, 0xF0, 0xE8, 0xF0, 0xE8, 0xF0, 0xE8, 0xF0,
+  0xE8, 0xC4, 0xD8, 0xC4, 0xD8, 0xC4, 0xD8, 0xC4, 0xD8, 0xC4, 0xD8, 0xF0,
+  0xE8, 0xF0, 0xEF, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x02, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x02,
+  0xF0, 0xE8, 0xB7, 0xB8, 0x8D, 0x88, 0x7F, 0x78, 0x6F, 0x02, 0x68, 0x56,
+  0x67, 0x58, 0x55, 0x96, 0x48, 0x45, 0xB5, 0x48, 0x44, 0xC5, 0x48, 0x44,
+  0xD4, 0x48, 0x44, 0xD5, 0x38, 0x44, 0xD4, 0x48, 0x44, 0xD4, 0x48, 0xF0,
+  0x55, 0x48, 0xF0, 0x55, 0x48, 0xF0, 0x45, 0x58, 0xF0, 0x36, 0x58, 0xF0,
+  0x26, 0x68, 0xF0, 0x16, 0x78, 0xF6, 0x88, 0xE5, 0xA8, 0xD5, 0xB8, 0xC6,
+  0xB8, 0xC5, 0xC8, 0xC5, 0xC8, 0xC4, 0xD8, 0xC4, 0xD8, 0xC4, 0xD8, 0xF0,
+  0xE8, 0xF0, 0xE8, 0xF0, 0xE8, 0xF0, 0xE8, 0xF0, 0xE8, 0xC4, 0xD8, 0xC4,
+  0xD8, 0xC4, 0xD8, 0xC4, 0xD8, 0xC4, 0xD8, 0xF0, 0xE8, 0xF0, 0xEF, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x02, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x02, 0xF0, 0xE8, 0xB7, 0xB8,
+  0x8D, 0x88, 0x7F, 0x78, 0x6F, 0x02, 0x68, 0x56, 0x67, 0x58, 0x55, 0x96,
+  0x48, 0x45, 0xB5, 0x48, 0x44, 0xC5, 0x48, 0x44, 0xD4, 0x48, 0x44, 0xD5,
+  0x38, 0x44, 0xD4, 0x48, 0x44, 0xD4, 0x48, 0xF0, 0x55, 0x48, 0xF0, 0x55,
+  0x48, 0xF0, 0x45, 0x58, 0xF0, 0x36, 0x58, 0xF0, 0x26, 0x68, 0xF0, 0x16,
+  0x78, 0xF6, 0x88, 0xE5, 0xA8, 0xD5, 0xB8, 0xC6, 0xB8, 0xC5, 0xC8, 0xC5,
+  0xC8, 0xC4, 0xD8, 0xC4, 0xD8, 0xC4, 0xD8, 0xF0, 0xE8, 0xF0, 0xE8, 0xF0,
+  0xE8, 0xF0, 0xE8, 0xF0, 0xE8, 0xC4, 0xD8, 0xC4, 0xD8, 0xC4, 0xD8, 0xC4,
+  0xD8, 0xC4, 0xD8, 0xF0, 0xE8, 0xF0, 0xEF, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x02, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x02, 0xF0, 0xE8, 0xB7, 0xB8, 0x8D, 0x88, 0x7F, 0x78,
+  0x6F, 0x02, 0x68, 0x56, 0x67, 0x58, 0x55, 0x96, 0x48, 0x45, 0xB5, 0x48,
+  0x44, 0xC5, 0x48, 0x44, 0xD4, 0x48, 0x44, 0xD5, 0x38, 0x44, 0xD4, 0x48,
+  0x44, 0xD4, 0x48, 0xF0, 0x55, 0x48, 0xF0, 0x55, 0x48, 0xF0, 0x45, 0x58,
+  0xF0, 0x36, 0x58, 0xF0, 0x26, 0x68, 0xF0, 0x16, 0x78, 0xF6, 0x88, 0xE5,
+  0xA8, 0xD5, 0xB8, 0xC6, 0xB8, 0xC5, 0xC8, 0xC5, 0xC8, 0xC4, 0xD8, 0xC4,
+  0xD8, 0xC4, 0xD8, 0xF0, 0xE8, 0xF0, 0xE8, 0xF0, 0xE8, 0xF0, 0xE8, 0xF0,
+  0xE8, 0xC4, 0xD8, 0xC4, 0xD8, 0xC4, 0xD8, 0xC4, 0xD8, 0xC4, 0xD8, 0xF0,
+  0xE8, 0xF0, 0xEF, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x02, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x02,
+  0xF0, 0xE8, 0xB7, 0xB8, 0x8D, 0x88, 0x7F, 0x78, 0x6F, 0x02, 0x68, 0x56,
+  0x67, 0x58, 0x55, 0x96, 0x48, 0x45, 0xB5, 0x48, 0x44, 0xC5, 0x48, 0x44,
+  0xD4, 0x48, 0x44, 0xD5, 0x38, 0x44, 0xD4, 0x48, 0x44, 0xD4, 0x48, 0xF0,
+  0x55, 0x48, 0xF0, 0x55, 0x48, 0xF0, 0x45, 0x58, 0xF0, 0x36, 0x58, 0xF0,
+  0x26, 0x68, 0xF0, 0x16, 0x78, 0xF6, 0x88, 0xE5, 0xA8, 0xD5, 0xB8, 0xC6,
+  0xB8, 0xC5, 0xC8, 0xC5, 0xC8, 0xC4, 0xD8, 0xC4, 0xD8, 0xC4, 0xD8, 0xF0,
+  0xE8, 0xF0, 0xE8, 0xF0, 0xE8, 0xF0, 0xE8, 0xF0, 0xE8, 0xC4, 0xD8, 0xC4,
+  0xD8, 0xC4, 0xD8, 0xC4, 0xD8, 0xC4, 0xD8, 0xF0, 0xE8, 0xF0, 0xEF, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x02, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x02, 0xF0, 0xE8, 0xB7, 0xB8,
+  0x8D, 0x88, 0x7F, 0x78, 0x6F, 0x02, 0x68, 0x56, 0x67, 0x58, 0x55, 0x96,
+  0x48, 0x45, 0xB5, 0x48, 0x44, 0xC5, 0x48, 0x44, 0xD4, 0x48, 0x44, 0xD5,
+  0x38, 0x44, 0xD4, 0x48, 0x44, 0xD4, 0x48, 0xF0, 0x55, 0x48, 0xF0, 0x55,
+  0x48, 0xF0, 0x45, 0x58, 0xF0, 0x36, 0x58, 0xF0, 0x26, 0x68, 0xF0, 0x16,
+  0x78, 0xF6, 0x88, 0xE5, 0xA8, 0xD5, 0xB8, 0xC6, 0xB8, 0xC5, 0xC8, 0xC5,
+  0xC8, 0xC4, 0xD8, 0xC4, 0xD8, 0xC4, 0xD8, 0xF0, 0xE8, 0xF0, 0xE8, 0xF0,
+  0xE8, 0xF0, 0xE8, 0xF0, 0xE8, 0xC4, 0xD8, 0xC4, 0xD8, 0xC4, 0xD8, 0xC4,
+  0xD8, 0xC4, 0xD8, 0xF0, 0xE8, 0xF0, 0xEF, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x02, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x02, 0xF0, 0xE8, 0xB7, 0xB8, 0x8D, 0x88, 0x7F, 0x78,
+  0x6F, 0x02, 0x68, 0x56, 0x67, 0x58, 0x55, 0x96, 0x48, 0x45, 0xB5, 0x48,
+  0x44, 0xC5, 0x48, 0x44, 0xD4, 0x48, 0x44, 0xD5, 0x38, 0x44, 0xD4, 0x48,
+  0x44, 0xD4, 0x48, 0xF0, 0x55, 0x48, 0xF0, 0x55, 0x48, 0xF0, 0x45, 0x58,
+  0xF0, 0x36, 0x58, 0xF0, 0x26, 0x68, 0xF0, 0x16, 0x78, 0xF6, 0x88, 0xE5,
+  0xA8, 0xD5, 0xB8, 0xC6, 0xB8, 0xC5, 0xC8, 0xC5, 0xC8, 0xC4, 0xD8, 0xC4,
+  0xD8, 0xC4, 0xD8, 0xF0, 0xE8, 0xF0, 0xE8, 0xF0, 0xE8, 0xF0, 0xE8, 0xF0,
+  0xE8, 0xC4, 0xD8, 0xC4, 0xD8, 0xC4, 0xD8, 0xC4, 0xD8, 0xC4, 0xD8, 0xF0,
+  0xE8, 0xF0, 0xEF, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x02, 0x10, 0x0F, 0x09, 0xD2, 0x22, 0x23, 0x13, 0x13, 0x13, 0x13, 0x1F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x08, 0xB2, 0xF0, 0x62, 0xF0, 0x62, 0xF0, 0x62,
+  0xF0, 0x62, 0xF0, 0x38, 0xDC, 0x9F, 0x01, 0x6F, 0x02, 0x66, 0x22, 0x26,
+  0x45, 0x42, 0x36, 0x25, 0x52, 0x45, 0x25, 0x52, 0x54, 0x24, 0x62, 0x5A,
+  0x62, 0x59, 0x72, 0xA4, 0x72, 0xA4, 0x72, 0xA4, 0x72, 0xA4, 0x72, 0xA4,
+  0x72, 0xA4, 0x72, 0xA4, 0x72, 0xA4, 0x72, 0xA5, 0x62, 0x5A, 0x62, 0x55,
+  0x15, 0x52, 0x54, 0x25, 0x52, 0x45, 0x35, 0x42, 0x36, 0x37, 0x22, 0x26,
+  0x5F, 0x02, 0x7F, 0xAC, 0xD8, 0xF0, 0x32, 0xF0, 0x62, 0xF0, 0x62, 0xF0,
+  0x62, 0xF0, 0x62, 0xA0, 0xA8, 0xF0, 0x1C, 0xCF, 0x01, 0x9F, 0x03, 0x77,
+  0x66, 0x66, 0x96, 0x55, 0xB5, 0x45, 0xD4, 0x45, 0xD5, 0x35, 0xD5, 0x34,
+  0xE5, 0x35, 0xE4, 0x35, 0xF0, 0x65, 0xF0, 0x66, 0xF0, 0x65, 0xF0, 0x75,
+  0xF0, 0x65, 0xF0, 0x2F, 0x03, 0x8F, 0x03, 0x8F, 0x03, 0xE5, 0xF0, 0x74,
+  0xF0, 0x74, 0xF0, 0x74, 0xF0, 0x74, 0xF0, 0x74, 0xF0, 0x74, 0xF0, 0x64,
+  0xF0, 0x73, 0xF0, 0x74, 0xF0, 0x64, 0xF0, 0x64, 0x17, 0x82, 0x3F, 0x08,
+  0x2F, 0x0A, 0x1F, 0x0A, 0x24, 0x7C, 0x41, 0xC7, 0x30, 0x22, 0xE2, 0x34,
+  0x36, 0x34, 0x2F, 0x06, 0x2F, 0x04, 0x4F, 0x02, 0x56, 0x46, 0x55, 0x85,
+  0x44, 0x95, 0x44, 0xA4, 0x44, 0xA4, 0x44, 0xA4, 0x44, 0xA4, 0x44, 0xA4,
+  0x44, 0x95, 0x45, 0x85, 0x56, 0x46, 0x6F, 0x02, 0x4F, 0x04, 0x2F, 0x06,
+  0x23, 0x36, 0x33, 0x51, 0xE1, 0x30, 0x04, 0xF0, 0x34, 0x15, 0xF0, 0x24,
+  0x24, 0xF0, 0x14, 0x44, 0xF4, 0x44, 0xE4, 0x64, 0xC5, 0x65, 0xB4, 0x84,
+  0xA5, 0x85, 0x94, 0xA4, 0x84, 0xB5, 0x74, 0xC4, 0x64, 0xE4, 0x54, 0xE5,
+  0x34, 0xF0, 0x14, 0x25, 0xF0, 0x15, 0x14, 0xF0, 0x39, 0xF0, 0x38, 0xCF,
+  0x07, 0x5F, 0x07, 0x5F, 0x07, 0xE5, 0xF0, 0x75, 0xF0, 0x75, 0xF0, 0x75,
+  0xDF, 0x07, 0x5F, 0x07, 0x5F, 0x07, 0xE5, 0xF0, 0x75, 0xF0, 0x75, 0xF0,
+  0x75, 0xF0, 0x75, 0xF0, 0x75, 0xF0, 0x75, 0xF0, 0x75, 0xF0, 0x75, 0xB0,
+  0x0F, 0x0F, 0x0F, 0x0F, 0xF0, 0x6F, 0x0F, 0x0F, 0x0F, 0x03, 0xA6, 0xFB,
+  0xCD, 0xAF, 0x86, 0x56, 0x75, 0x75, 0x65, 0x94, 0x65, 0x95, 0x55, 0x95,
+  0x55, 0x95, 0x65, 0xF0, 0x46, 0xF0, 0x47, 0xF0, 0x28, 0xFB, 0xB5, 0x27,
+  0xA4, 0x48, 0x74, 0x68, 0x63, 0x98, 0x34, 0xA8, 0x24, 0xC6, 0x24, 0xD6,
+  0x15, 0xD5, 0x15, 0xE5, 0x15, 0xD5, 0x17, 0xC4, 0x27, 0xB4, 0x37, 0xA4,
+  0x48, 0x74, 0x68, 0x64, 0x87, 0x44, 0xAD, 0xDA, 0xF7, 0xF0, 0x37, 0xF0,
+  0x46, 0xF0, 0x45, 0xF0, 0x55, 0x54, 0xA5, 0x54, 0xA5, 0x55, 0x95, 0x55,
+  0x95, 0x65, 0x75, 0x76, 0x56, 0x8F, 0xAD, 0xCB, 0xF6, 0xA0, 0x06, 0x3C,
+  0x3C, 0x3C, 0x3C, 0x36, 0xE9, 0xF0, 0xAF, 0xF0, 0x5F, 0x04, 0xF0, 0x26,
+  0x96, 0xE6, 0xD5, 0xC5, 0xF0, 0x24, 0xA5, 0xF0, 0x44, 0x94, 0xA1, 0xA4,
+  0x74, 0x79, 0x74, 0x54, 0x6D, 0x63, 0x54, 0x5E, 0x64, 0x34, 0x64, 0x74,
+  0x63, 0x33, 0x64, 0x94, 0x54, 0x23, 0x63, 0xA4, 0x63, 0x14, 0x54, 0xB3,
+  0x63, 0x13, 0x63, 0xF0, 0x63, 0x13, 0x63, 0xF0, 0x67, 0x63, 0xF0, 0x76,
+  0x54, 0xF0, 0x76, 0x54, 0xF0, 0x76, 0x54, 0xF0, 0x76, 0x63, 0xF0, 0x67,
+  0x63, 0xC4, 0x53, 0x14, 0x54, 0xB3, 0x63, 0x23, 0x54, 0xA4, 0x63, 0x24,
+  0x54, 0x94, 0x54, 0x24, 0x55, 0x74, 0x63, 0x44, 0x56, 0x36, 0x54, 0x44,
+  0x6D, 0x63, 0x64, 0x6B, 0x64, 0x74, 0x77, 0x74, 0x85, 0xF0, 0x44, 0xA5,
+  0xF0, 0x15, 0xC6, 0xD5, 0xF7, 0x77, 0xF0, 0x2F, 0x03, 0xF0, 0x6F, 0xF0,
+  0xA9, 0xE0, 0x62, 0xA9, 0x4C, 0x34, 0x44, 0x33, 0x63, 0x24, 0x63, 0xC3,
+  0xA5, 0x5A, 0x38, 0x13, 0x24, 0x63, 0x23, 0x73, 0x23, 0x73, 0x23, 0x73,
+  0x24, 0x45, 0x39, 0x14, 0x18, 0x24, 0x43, 0x52, 0xF0, 0xF0, 0x1E, 0x1E,
+  0x1E, 0x10, 0x61, 0xA1, 0x52, 0x92, 0x43, 0x83, 0x34, 0x65, 0x25, 0x55,
+  0x25, 0x55, 0x24, 0x65, 0x33, 0x74, 0x42, 0x82, 0x63, 0x74, 0x45, 0x55,
+  0x45, 0x55, 0x45, 0x56, 0x34, 0x65, 0x43, 0x83, 0x61, 0x92, 0xF0, 0x21,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0E, 0xF0, 0x74, 0xF0, 0x74, 0xF0,
+  0x74, 0xF0, 0x74, 0xF0, 0x74, 0xF0, 0x74, 0xF0, 0x74, 0xF0, 0x74, 0xF0,
+  0x74, 0xF0, 0x74, 0xF0, 0x74, 0x0F, 0x0F, 0x0F, 0x07, 0xE9, 0xF0, 0xAF,
+  0xF0, 0x5F, 0x04, 0xF0, 0x26, 0x96, 0xE6, 0xD5, 0xC5, 0xF0, 0x24, 0xA5,
+  0xF0, 0x44, 0x94, 0xF0, 0x64, 0x74, 0x3D, 0x74, 0x54, 0x4F, 0x63, 0x54,
+  0x4F, 0x01, 0x54, 0x34, 0x53, 0x94, 0x63, 0x33, 0x63, 0xA4, 0x54, 0x23,
+  0x63, 0xA4, 0x63, 0x14, 0x63, 0xB3, 0x63, 0x13, 0x73, 0xA4, 0x63, 0x13,
+  0x73, 0xA4, 0x67, 0x73, 0x94, 0x86, 0x7F, 0x96, 0x7E, 0xA6, 0x7F, 0x96,
+  0x73, 0x94, 0x77, 0x73, 0xA3, 0x73, 0x14, 0x63, 0xA3, 0x73, 0x23, 0x63,
+  0xA3, 0x73, 0x24, 0x53, 0xA3, 0x64, 0x24, 0x53, 0xA3, 0x63, 0x44, 0x43,
+  0xA4, 0x44, 0x44, 0x43, 0xA4, 0x43, 0x64, 0x33, 0xB4, 0x24, 0x74, 0xF0,
+  0x64, 0x85, 0xF0, 0x44, 0xA5, 0xF0, 0x15, 0xC6, 0xD5, 0xF7, 0x77, 0xF0,
+  0x2F, 0x03, 0xF0, 0x6F, 0xF0, 0xA9, 0xE0, 0x0F, 0x0F, 0x0F, 0x0B, 0x55,
+  0x89, 0x5B, 0x34, 0x45, 0x14, 0x73, 0x13, 0x96, 0x96, 0x96, 0x96, 0x96,
+  0x97, 0x73, 0x24, 0x45, 0x3B, 0x59, 0x85, 0x50, 0xA4, 0xF0, 0x54, 0xF0,
+  0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0,
+  0x54, 0xF0, 0x54, 0xAF, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x06, 0xA4, 0xF0,
+  0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0,
+  0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+  0x1F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x06, 0x72, 0xAA, 0x5C, 0x35, 0x45,
+  0x24, 0x64, 0x23, 0x83, 0x23, 0x88, 0x84, 0xC3, 0xC4, 0xB4, 0xA5, 0x96,
+  0x95, 0x95, 0xA5, 0xA4, 0xC3, 0xC4, 0xCF, 0x1F, 0x1F, 0x10, 0x64, 0x89,
+  0x5B, 0x34, 0x54, 0x23, 0x73, 0x14, 0x77, 0x84, 0xB4, 0xB3, 0x77, 0x86,
+  0x98, 0xB5, 0xB4, 0xC6, 0x96, 0x96, 0x97, 0x74, 0x14, 0x54, 0x3C, 0x49,
+  0x84, 0x60, 0x46, 0x45, 0x45, 0x45, 0x54, 0x54, 0x54, 0x63, 0x70, 0x05,
+  0xC4, 0x45, 0xC4, 0x45, 0xC4, 0x45, 0xC4, 0x45, 0xC4, 0x45, 0xC4, 0x45,
+  0xC4, 0x45, 0xC4, 0x45, 0xC4, 0x45, 0xC4, 0x45, 0xC4, 0x45, 0xC4, 0x45,
+  0xC4, 0x45, 0xC4, 0x45, 0xC4, 0x45, 0xC4, 0x45, 0xC4, 0x45, 0xC4, 0x45,
+  0xC4, 0x45, 0xC4, 0x45, 0xB5, 0x45, 0xA6, 0x46, 0x96, 0x47, 0x69, 0x3F,
+  0x0F, 0x0B, 0x2F, 0x07, 0x3C, 0x16, 0x7B, 0xF0, 0x55, 0xF0, 0x55, 0xF0,
+  0x55, 0xF0, 0x55, 0xF0, 0x55, 0xF0, 0x55, 0xF0, 0x55, 0xF0, 0x55, 0xF0,
+  0x55, 0xF0, 0x50, 0x8F, 0x02, 0x6F, 0x04, 0x5F, 0x05, 0x4A, 0x44, 0x6B,
+  0x44, 0x5C, 0x44, 0x5C, 0x44, 0x4D, 0x44, 0x4D, 0x44, 0x4D, 0x44, 0x4D,
+  0x44, 0x3E, 0x44, 0x3E, 0x44, 0x3E, 0x44, 0x4D, 0x44, 0x4D, 0x44, 0x4D,
+  0x44, 0x4D, 0x44, 0x5C, 0x44, 0x6B, 0x44, 0x6B, 0x44, 0x7A, 0x44, 0x98,
+  0x44, 0xB6, 0x44, 0xE3, 0x44, 0xE3, 0x44, 0xE3, 0x44, 0xE3, 0x44, 0xE3,
+  0x44, 0xE3, 0x44, 0xE3, 0x44, 0xE3, 0x44, 0xE3, 0x44, 0xE3, 0x44, 0xE3,
+  0x44, 0xE3, 0x44, 0xE3, 0x44, 0xE3, 0x44, 0xE3, 0x44, 0xE3, 0x44, 0xE3,
+  0x44, 0xE3, 0x44, 0xE3, 0x44, 0xE3, 0x44, 0xE3, 0x44, 0xE3, 0x44, 0x30,
+  0x0F, 0x0F, 0x62, 0xB2, 0xA2, 0xB6, 0x68, 0x95, 0x94, 0x93, 0x14, 0x44,
+  0x1B, 0x57, 0x30, 0x63, 0x63, 0x54, 0x4F, 0x08, 0x63, 0x63, 0x63, 0x63,
+  0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
+  0x88, 0x5A, 0x34, 0x44, 0x23, 0x68, 0x76, 0x86, 0x86, 0x86, 0x95, 0x86,
+  0x87, 0x73, 0x13, 0x64, 0x14, 0x44, 0x3A, 0x58, 0x93, 0xF0, 0xF0, 0x4D,
+  0x1D, 0x1D, 0x01, 0x91, 0x72, 0x82, 0x63, 0x74, 0x44, 0x65, 0x36, 0x55,
+  0x45, 0x55, 0x44, 0x65, 0x43, 0x83, 0x52, 0x83, 0x34, 0x74, 0x25, 0x56,
+  0x15, 0x55, 0x25, 0x55, 0x34, 0x64, 0x42, 0x83, 0x51, 0x91, 0xF0, 0xA0,
+  0x62, 0xF0, 0xF0, 0x82, 0xF0, 0x63, 0xD3, 0xF0, 0x63, 0xD3, 0xF0, 0x53,
+  0xA7, 0xF0, 0x53, 0x98, 0xF0, 0x43, 0xA8, 0xF0, 0x33, 0xF0, 0x13, 0xF0,
+  0x33, 0xF0, 0x13, 0xF0, 0x23, 0xF0, 0x23, 0xF0, 0x23, 0xF0, 0x23, 0xF0,
+  0x13, 0xF0, 0x33, 0xF3, 0xF0, 0x43, 0xF3, 0xF0, 0x43, 0xE3, 0xF0, 0x53,
+  0xE3, 0xF0, 0x53, 0xD3, 0xF0, 0x63, 0xC3, 0xB3, 0x83, 0xC3, 0xA4, 0x83,
+  0xB3, 0xB4, 0x83, 0xB2, 0xB5, 0x83, 0xA3, 0xA6, 0x83, 0x93, 0xA3, 0x13,
+  0xF0, 0x53, 0x94, 0x13, 0xF0, 0x43, 0xA3, 0x23, 0xF0, 0x42, 0xA3, 0x33,
+  0xF0, 0x33, 0x93, 0x43, 0xF0, 0x23, 0x94, 0x43, 0xF0, 0x23, 0x93, 0x53,
+  0xF0, 0x13, 0x93, 0x63, 0xF3, 0x93, 0x73, 0xF3, 0x9F, 0x01, 0xB3, 0xAF,
+  0x01, 0xB3, 0xAF, 0x01, 0xA3, 0xF0, 0x63, 0xC3, 0xF0, 0x73, 0xC3, 0xF0,
+  0x73, 0xB3, 0xF0, 0x83, 0xB3, 0xF0, 0x83, 0xA3, 0xF0, 0xF0, 0x62, 0xF0,
+  0x53, 0xF2, 0xF0, 0x53, 0xE3, 0xF0, 0x43, 0xC6, 0xF0, 0x33, 0xB8, 0xF0,
+  0x33, 0xB8, 0xF0, 0x23, 0xF0, 0x23, 0xF0, 0x23, 0xF0, 0x23, 0xF0, 0x13,
+  0xF0, 0x33, 0xF3, 0xF0, 0x43, 0xF3, 0xF0, 0x43, 0xE3, 0xF0, 0x53, 0xE2,
+  0xF0, 0x63, 0xD3, 0xF0, 0x63, 0xC3, 0xF0, 0x73, 0xC3, 0xF0, 0x73, 0xB3,
+  0x77, 0x93, 0xB2, 0x6A, 0x83, 0xA3, 0x5D, 0x63, 0x93, 0x64, 0x54, 0x63,
+  0x93, 0x54, 0x74, 0x53, 0x83, 0x63, 0x93, 0xF3, 0x73, 0x93, 0xF3, 0x73,
+  0x93, 0xE3, 0xF0, 0x44, 0xE3, 0xF0, 0x34, 0xE3, 0xF0, 0x35, 0xD3, 0xF0,
+  0x26, 0xE3, 0xF6, 0xF3, 0xF6, 0xF0, 0x13, 0xD6, 0xF0, 0x23, 0xD5, 0xF0,
+  0x33, 0xE4, 0xF0, 0x43, 0xD4, 0xF0, 0x43, 0xE3, 0xF0, 0x53, 0xEF, 0x73,
+  0xEF, 0x01, 0x63, 0xFF, 0x01, 0x63, 0xF0, 0xF0, 0x10, 0x56, 0xF0, 0xF0,
+  0x4A, 0xF0, 0x33, 0xAC, 0xF0, 0x23, 0xA3, 0x64, 0xF3, 0xA3, 0x83, 0xE3,
+  0xB3, 0x83, 0xE3, 0xB3, 0x83, 0xD3, 0xF0, 0x83, 0xD3, 0xF0, 0x74, 0xC3,
+  0xF0, 0x38, 0xC3, 0xF0, 0x46, 0xE3, 0xF0, 0x48, 0xB3, 0xF0, 0xA4, 0xA3,
+  0xF0, 0xB4, 0x83, 0xF0, 0xC4, 0x73, 0xF0, 0x13, 0xA3, 0x73, 0xF0, 0x14,
+  0x93, 0x63, 0xA3, 0x44, 0x84, 0x63, 0xA3, 0x53, 0x83, 0x63, 0xA4, 0x55,
+  0x45, 0x53, 0xA5, 0x6C, 0x63, 0x96, 0x7A, 0x63, 0xA6, 0xA3, 0xA3, 0x93,
+  0x13, 0xF0, 0x73, 0x93, 0x23, 0xF0, 0x63, 0x94, 0x23, 0xF0, 0x63, 0x93,
+  0x33, 0xF0, 0x53, 0x93, 0x43, 0xF0, 0x53, 0x83, 0x53, 0xF0, 0x43, 0x84,
+  0x53, 0xF0, 0x33, 0x93, 0x63, 0xF0, 0x33, 0x8F, 0x02, 0xD3, 0x9F, 0x02,
+  0xD2, 0xAF, 0x02, 0xC3, 0xF0, 0x53, 0xF3, 0xF0, 0x63, 0xF3, 0xF0, 0x63,
+  0xE3, 0xF0, 0x73, 0xD3, 0xF0, 0x83, 0xD3, 0xF0, 0xF0, 0x95, 0xF0, 0x25,
+  0xF0, 0x25, 0xF0, 0x25, 0xF0, 0x25, 0xF0, 0x25, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xF0, 0xF0, 0xF5, 0xF0, 0x25, 0xF0, 0x25, 0xF0, 0x25, 0xF0, 0x24, 0xF0,
+  0x25, 0xF0, 0x25, 0xF0, 0x15, 0xF0, 0x16, 0xF6, 0xF6, 0xF5, 0xF0, 0x15,
+  0xF0, 0x15, 0xF0, 0x25, 0xF0, 0x15, 0xF0, 0x25, 0xD9, 0xC9, 0xDA, 0xCA,
+  0xC4, 0x15, 0xB5, 0x25, 0xA5, 0x27, 0x66, 0x4F, 0x03, 0x5F, 0x01, 0x7D,
+  0xC8, 0x70, 0x97, 0xF0, 0xC6, 0xF0, 0xD4, 0xF0, 0xE4, 0xF0, 0xE4, 0xF0,
+  0xE4, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE6, 0xF0, 0xA8, 0xF0, 0x98, 0xF0,
+  0x98, 0xF0, 0x8A, 0xF0, 0x7A, 0xF0, 0x74, 0x15, 0xF0, 0x65, 0x25, 0xF0,
+  0x55, 0x25, 0xF0, 0x54, 0x35, 0xF0, 0x45, 0x45, 0xF0, 0x35, 0x45, 0xF0,
+  0x34, 0x56, 0xF0, 0x15, 0x65, 0xF0, 0x15, 0x65, 0xF5, 0x76, 0xE5, 0x85,
+  0xE5, 0x85, 0xD5, 0xA5, 0xC5, 0xA5, 0xC4, 0xB5, 0xB5, 0xC5, 0xAF, 0x07,
+  0xAF, 0x07, 0x9F, 0x09, 0x8F, 0x09, 0x85, 0xE5, 0x75, 0xF0, 0x15, 0x65,
+  0xF0, 0x15, 0x55, 0xF0, 0x26, 0x45, 0xF0, 0x35, 0x45, 0xF0, 0x35, 0x35,
+  0xF0, 0x46, 0x25, 0xF0, 0x55, 0x25, 0xF0, 0x55, 0x15, 0xF0, 0x6B, 0xF0,
+  0x75, 0xF0, 0x36, 0xF0, 0xA5, 0xF0, 0xB5, 0xF0, 0xB5, 0xF0, 0xB4, 0xF0,
+  0xC4, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x46, 0xF0, 0xA8,
+  0xF0, 0x98, 0xF0, 0x98, 0xF0, 0x8A, 0xF0, 0x7A, 0xF0, 0x74, 0x15, 0xF0,
+  0x65, 0x25, 0xF0, 0x55, 0x25, 0xF0, 0x54, 0x35, 0xF0, 0x45, 0x45, 0xF0,
+  0x35, 0x45, 0xF0, 0x34, 0x56, 0xF0, 0x15, 0x65, 0xF0, 0x15, 0x65, 0xF5,
+  0x76, 0xE5, 0x85, 0xE5, 0x85, 0xD5, 0xA5, 0xC5, 0xA5, 0xC4, 0xB5, 0xB5,
+  0xC5, 0xAF, 0x07, 0xAF, 0x07, 0x9F, 0x09, 0x8F, 0x09, 0x85, 0xE5, 0x75,
+  0xF0, 0x15, 0x65, 0xF0, 0x15, 0x55, 0xF0, 0x26, 0x45, 0xF0, 0x35, 0x45,
+  0xF0, 0x35, 0x35, 0xF0, 0x46, 0x25, 0xF0, 0x55, 0x25, 0xF0, 0x55, 0x15,
+  0xF0, 0x6B, 0xF0, 0x75, 0xD6, 0xF0, 0xA8, 0xF0, 0x98, 0xF0, 0x8A, 0xF0,
+  0x64, 0x44, 0xF0, 0x44, 0x64, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xD6, 0xF0, 0xA8, 0xF0, 0x98, 0xF0, 0x98, 0xF0, 0x8A, 0xF0, 0x7A, 0xF0,
+  0x74, 0x15, 0xF0, 0x65, 0x25, 0xF0, 0x55, 0x25, 0xF0, 0x54, 0x35, 0xF0,
+  0x45, 0x45, 0xF0, 0x35, 0x45, 0xF0, 0x34, 0x56, 0xF0, 0x15, 0x65, 0xF0,
+  0x15, 0x65, 0xF5, 0x76, 0xE5, 0x85, 0xE5, 0x85, 0xD5, 0xA5, 0xC5, 0xA5,
+  0xC4, 0xB5, 0xB5, 0xC5, 0xAF, 0x07, 0xAF, 0x07, 0x9F, 0x09, 0x8F, 0x09,
+  0x85, 0xE5, 0x75, 0xF0, 0x15, 0x65, 0xF0, 0x15, 0x55, 0xF0, 0x26, 0x45,
+  0xF0, 0x35, 0x45, 0xF0, 0x35, 0x35, 0xF0, 0x46, 0x25, 0xF0, 0x55, 0x25,
+  0xF0, 0x55, 0x15, 0xF0, 0x6B, 0xF0, 0x75, 0xB4, 0x63, 0xF0, 0x37, 0x34,
+  0xF0, 0x2E, 0xF0, 0x33, 0x1A, 0xF0, 0x23, 0x56, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xF0, 0xF0, 0xF0, 0xE6, 0xF0, 0xA8, 0xF0, 0x98, 0xF0, 0x98, 0xF0, 0x8A,
+  0xF0, 0x7A, 0xF0, 0x74, 0x15, 0xF0, 0x65, 0x25, 0xF0, 0x55, 0x25, 0xF0,
+  0x54, 0x35, 0xF0, 0x45, 0x45, 0xF0, 0x35, 0x45, 0xF0, 0x34, 0x56, 0xF0,
+  0x15, 0x65, 0xF0, 0x15, 0x65, 0xF5, 0x76, 0xE5, 0x85, 0xE5, 0x85, 0xD5,
+  0xA5, 0xC5, 0xA5, 0xC4, 0xB5, 0xB5, 0xC5, 0xAF, 0x07, 0xAF, 0x07, 0x9F,
+  0x09, 0x8F, 0x09, 0x85, 0xE5, 0x75, 0xF0, 0x15, 0x65, 0xF0, 0x15, 0x55,
+  0xF0, 0x26, 0x45, 0xF0, 0x35, 0x45, 0xF0, 0x35, 0x35, 0xF0, 0x46, 0x25,
+  0xF0, 0x55, 0x25, 0xF0, 0x55, 0x15, 0xF0, 0x6B, 0xF0, 0x75, 0x95, 0x46,
+  0xF0, 0x25, 0x46, 0xF0, 0x25, 0x46, 0xF0, 0x25, 0x46, 0xF0, 0x25, 0x46,
+  0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xC6, 0xF0, 0xA8, 0xF0, 0x98,
+  0xF0, 0x98, 0xF0, 0x8A, 0xF0, 0x7A, 0xF0, 0x74, 0x15, 0xF0, 0x65, 0x25,
+  0xF0, 0x55, 0x25, 0xF0, 0x54, 0x35, 0xF0, 0x45, 0x45, 0xF0, 0x35, 0x45,
+  0xF0, 0x34, 0x56, 0xF0, 0x15, 0x65, 0xF0, 0x15, 0x65, 0xF5, 0x76, 0xE5,
+  0x85, 0xE5, 0x85, 0xD5, 0xA5, 0xC5, 0xA5, 0xC4, 0xB5, 0xB5, 0xC5, 0xAF,
+  0x07, 0xAF, 0x07, 0x9F, 0x09, 0x8F, 0x09, 0x85, 0xE5, 0x75, 0xF0, 0x15,
+  0x65, 0xF0, 0x15, 0x55, 0xF0, 0x26, 0x45, 0xF0, 0x35, 0x45, 0xF0, 0x35,
+  0x35, 0xF0, 0x46, 0x25, 0xF0, 0x55, 0x25, 0xF0, 0x55, 0x15, 0xF0, 0x6B,
+  0xF0, 0x75, 0xE4, 0xF0, 0xB8, 0xF0, 0x99, 0xF0, 0x74, 0x24, 0xF0, 0x73,
+  0x43, 0xF0, 0x73, 0x43, 0xF0, 0x73, 0x43, 0xF0, 0x74, 0x24, 0xF0, 0x89,
+  0xF0, 0x88, 0xF0, 0xB4, 0xF0, 0xF0, 0xF0, 0xE6, 0xF0, 0xA8, 0xF0, 0x98,
+  0xF0, 0x98, 0xF0, 0x8A, 0xF0, 0x7A, 0xF0, 0x74, 0x15, 0xF0, 0x65, 0x25,
+  0xF0, 0x55, 0x25, 0xF0, 0x54, 0x35, 0xF0, 0x45, 0x45, 0xF0, 0x35, 0x45,
+  0xF0, 0x34, 0x56, 0xF0, 0x15, 0x65, 0xF0, 0x15, 0x65, 0xF5, 0x76, 0xE5,
+  0x85, 0xE5, 0x85, 0xD5, 0xA5, 0xC5, 0xA5, 0xC4, 0xB5, 0xB5, 0xC5, 0xAF,
+  0x07, 0xAF, 0x07, 0x9F, 0x09, 0x8F, 0x09, 0x85, 0xE5, 0x75, 0xF0, 0x15,
+  0x65, 0xF0, 0x15, 0x55, 0xF0, 0x26, 0x45, 0xF0, 0x35, 0x45, 0xF0, 0x35,
+  0x35, 0xF0, 0x46, 0x25, 0xF0, 0x55, 0x25, 0xF0, 0x55, 0x15, 0xF0, 0x6B,
+  0xF0, 0x75, 0xFF, 0x0F, 0x02, 0xFF, 0x0F, 0x03, 0xFF, 0x0F, 0x03, 0xFF,
+  0x0F, 0x03, 0xE5, 0x55, 0xF0, 0xF0, 0x34, 0x65, 0xF0, 0xF0, 0x25, 0x65,
+  0xF0, 0xF0, 0x25, 0x65, 0xF0, 0xF0, 0x15, 0x75, 0xF0, 0xF0, 0x15, 0x75,
+  0xF0, 0xF0, 0x14, 0x85, 0xF0, 0xF5, 0x85, 0xF0, 0xF5, 0x85, 0xF0, 0xE5,
+  0x95, 0xF0, 0xE5, 0x95, 0xF0, 0xE4, 0xA5, 0xF0, 0xD5, 0xAF, 0x08, 0xA5,
+  0xAF, 0x08, 0x95, 0xBF, 0x08, 0x95, 0xBF, 0x08, 0x95, 0xB5, 0xF0, 0xB5,
+  0xC5, 0xF0, 0xBF, 0x07, 0xF0, 0xAF, 0x08, 0xF0, 0xAF, 0x08, 0xF0, 0x9F,
+  0x09, 0xF0, 0x95, 0xE5, 0xF0, 0x95, 0xE5, 0xF0, 0x85, 0xF5, 0xF0, 0x85,
+  0xF5, 0xF0, 0x76, 0xF5, 0xF0, 0x75, 0xF0, 0x15, 0xF0, 0x75, 0xF0, 0x15,
+  0xF0, 0x65, 0xF0, 0x2F, 0x0A, 0x15, 0xF0, 0x2F, 0x0F, 0x01, 0xF0, 0x2F,
+  0x0F, 0xF0, 0x3F, 0x0A, 0xC9, 0xF0, 0x5F, 0xF0, 0x1F, 0x03, 0xCF, 0x06,
+  0xA9, 0x59, 0x87, 0xB7, 0x76, 0xE5, 0x66, 0xF0, 0x15, 0x46, 0xF0, 0x25,
+  0x45, 0xF0, 0x45, 0x35, 0xF0, 0x45, 0x25, 0xF0, 0x55, 0x25, 0xF0, 0xC4,
+  0xF0, 0xC5, 0xF0, 0xC5, 0xF0, 0xC5, 0xF0, 0xC5, 0xF0, 0xC5, 0xF0, 0xC5,
+  0xF0, 0xC5, 0xF0, 0xC5, 0xF0, 0xC5, 0xF0, 0xC5, 0xF0, 0xC5, 0xF0, 0x75,
+  0x14, 0xF0, 0x75, 0x15, 0xF0, 0x65, 0x15, 0xF0, 0x55, 0x35, 0xF0, 0x45,
+  0x35, 0xF0, 0x45, 0x36, 0xF0, 0x26, 0x46, 0xF0, 0x15, 0x66, 0xE6, 0x67,
+  0xB7, 0x89, 0x68, 0xAF, 0x06, 0xDF, 0x03, 0xFF, 0xF0, 0x5A, 0xF0, 0xA2,
+  0xF0, 0xE2, 0xF0, 0xF6, 0xF0, 0xB7, 0xF0, 0xD5, 0xF0, 0xD4, 0xF0, 0x51,
+  0x74, 0xF0, 0x44, 0x44, 0xF0, 0x6A, 0xF0, 0x96, 0xE0, 0x76, 0xF0, 0x85,
+  0xF0, 0x85, 0xF0, 0x85, 0xF0, 0x94, 0xF0, 0x94, 0xF0, 0xF0, 0xF0, 0xF0,
+  0x3F, 0x0B, 0x1F, 0x0B, 0x1F, 0x0B, 0x1F, 0x0B, 0x15, 0xF0, 0x75, 0xF0,
+  0x75, 0xF0, 0x75, 0xF0, 0x75, 0xF0, 0x75, 0xF0, 0x75, 0xF0, 0x75, 0xF0,
+  0x75, 0xF0, 0x75, 0xF0, 0x75, 0xF0, 0x75, 0xF0, 0x7F, 0x0A, 0x2F, 0x0A,
+  0x2F, 0x0A, 0x2F, 0x0A, 0x25, 0xF0, 0x75, 0xF0, 0x75, 0xF0, 0x75, 0xF0,
+  0x75, 0xF0, 0x75, 0xF0, 0x75, 0xF0, 0x75, 0xF0, 0x75, 0xF0, 0x75, 0xF0,
+  0x75, 0xF0, 0x75, 0xF0, 0x75, 0xF0, 0x7F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x03, 0xD6, 0xF0, 0x56, 0xF0, 0x56, 0xF0, 0x64, 0xF0, 0x74, 0xF0,
+  0x74, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x5F, 0x0B, 0x1F, 0x0B, 0x1F,
+  0x0B, 0x1F, 0x0B, 0x15, 0xF0, 0x75, 0xF0, 0x75, 0xF0, 0x75, 0xF0, 0x75,
+  0xF0, 0x75, 0xF0, 0x75, 0xF0, 0x75, 0xF0, 0x75, 0xF0, 0x75, 0xF0, 0x75,
+  0xF0, 0x75, 0xF0, 0x7F, 0x0A, 0x2F, 0x0A, 0x2F, 0x0A, 0x2F, 0x0A, 0x25,
+  0xF0, 0x75, 0xF0, 0x75, 0xF0, 0x75, 0xF0, 0x75, 0xF0, 0x75, 0xF0, 0x75,
+  0xF0, 0x75, 0xF0, 0x75, 0xF0, 0x75, 0xF0, 0x75, 0xF0, 0x75, 0xF0, 0x75,
+  0xF0, 0x7F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x03, 0xA6, 0xF0, 0x58,
+  0xF0, 0x48, 0xF0, 0x3A, 0xF0, 0x14, 0x44, 0xE4, 0x64, 0xF0, 0xF0, 0xF0,
+  0xF0, 0xF0, 0xDF, 0x0B, 0x1F, 0x0B, 0x1F, 0x0B, 0x1F, 0x0B, 0x15, 0xF0,
+  0x75, 0xF0, 0x75, 0xF0, 0x75, 0xF0, 0x75, 0xF0, 0x75, 0xF0, 0x75, 0xF0,
+  0x75, 0xF0, 0x75, 0xF0, 0x75, 0xF0, 0x75, 0xF0, 0x75, 0xF0, 0x7F, 0x0A,
+  0x2F, 0x0A, 0x2F, 0x0A, 0x2F, 0x0A, 0x25, 0xF0, 0x75, 0xF0, 0x75, 0xF0,
+  0x75, 0xF0, 0x75, 0xF0, 0x75, 0xF0, 0x75, 0xF0, 0x75, 0xF0, 0x75, 0xF0,
+  0x75, 0xF0, 0x75, 0xF0, 0x75, 0xF0, 0x75, 0xF0, 0x7F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x03, 0x65, 0x45, 0xD5, 0x45, 0xD5, 0x45, 0xD5, 0x45,
+  0xD5, 0x45, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xDF, 0x0B, 0x1F, 0x0B, 0x1F,
+  0x0B, 0x1F, 0x0B, 0x15, 0xF0, 0x75, 0xF0, 0x75, 0xF0, 0x75, 0xF0, 0x75,
+  0xF0, 0x75, 0xF0, 0x75, 0xF0, 0x75, 0xF0, 0x75, 0xF0, 0x75, 0xF0, 0x75,
+  0xF0, 0x75, 0xF0, 0x7F, 0x0A, 0x2F, 0x0A, 0x2F, 0x0A, 0x2F, 0x0A, 0x25,
+  0xF0, 0x75, 0xF0, 0x75, 0xF0, 0x75, 0xF0, 0x75, 0xF0, 0x75, 0xF0, 0x75,
+  0xF0, 0x75, 0xF0, 0x75, 0xF0, 0x75, 0xF0, 0x75, 0xF0, 0x75, 0xF0, 0x75,
+  0xF0, 0x7F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x03, 0x16, 0x76, 0x85,
+  0x85, 0x84, 0xA3, 0xF0, 0xF5, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75,
+  0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75,
+  0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75,
+  0x75, 0x75, 0x75, 0x75, 0x75, 0x20, 0x57, 0x55, 0x65, 0x65, 0x64, 0x74,
+  0xF0, 0xF0, 0xF0, 0x15, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75,
+  0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75,
+  0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75,
+  0x75, 0x75, 0x75, 0x75, 0x40, 0x56, 0x87, 0x79, 0x6A, 0x44, 0x35, 0x24,
+  0x63, 0xF1, 0xF0, 0xF0, 0x55, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+  0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+  0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+  0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0x50, 0x06, 0x4B, 0x4B, 0x4B, 0x4B, 0x45,
+  0xF0, 0xF0, 0xF0, 0x55, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+  0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+  0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+  0xA5, 0xA5, 0xA5, 0xA5, 0x50, 0x4F, 0x03, 0xFF, 0x06, 0xCF, 0x07, 0xBF,
+  0x08, 0xA4, 0xC8, 0x94, 0xF6, 0x84, 0xF0, 0x16, 0x74, 0xF0, 0x26, 0x64,
+  0xF0, 0x35, 0x64, 0xF0, 0x35, 0x64, 0xF0, 0x45, 0x54, 0xF0, 0x45, 0x54,
+  0xF0, 0x45, 0x54, 0xF0, 0x55, 0x44, 0xF0, 0x55, 0x44, 0xF0, 0x55, 0x44,
+  0xF0, 0x5F, 0x07, 0xBF, 0x07, 0xBF, 0x07, 0xB5, 0x44, 0xF0, 0x55, 0x44,
+  0xF0, 0x55, 0x44, 0xF0, 0x55, 0x44, 0xF0, 0x55, 0x44, 0xF0, 0x54, 0x54,
+  0xF0, 0x45, 0x54, 0xF0, 0x45, 0x54, 0xF0, 0x36, 0x54, 0xF0, 0x35, 0x64,
+  0xF0, 0x26, 0x64, 0xF0, 0x16, 0x74, 0xF6, 0x84, 0xC9, 0x8F, 0x09, 0x9F,
+  0x07, 0xBF, 0x06, 0xCF, 0x03, 0xB0, 0x95, 0x53, 0xF9, 0x14, 0xEF, 0xE4,
+  0x19, 0xF3, 0x64, 0xF0, 0xF0, 0xF0, 0xF0, 0x76, 0xF0, 0x4A, 0xF0, 0x4B,
+  0xF0, 0x3B, 0xF0, 0x3C, 0xF0, 0x2D, 0xF0, 0x1D, 0xF0, 0x1E, 0xFF, 0xE9,
+  0x15, 0xE9, 0x25, 0xD9, 0x26, 0xC9, 0x35, 0xC9, 0x45, 0xB9, 0x46, 0xA9,
+  0x55, 0xA9, 0x65, 0x99, 0x65, 0x99, 0x75, 0x89, 0x85, 0x79, 0x85, 0x79,
+  0x95, 0x69, 0x96, 0x59, 0xA5, 0x59, 0xB5, 0x49, 0xB6, 0x39, 0xC5, 0x39,
+  0xD5, 0x29, 0xD5, 0x29, 0xE5, 0x19, 0xFE, 0xFE, 0xF0, 0x1D, 0xF0, 0x1D,
+  0xF0, 0x2C, 0xF0, 0x3B, 0xF0, 0x36, 0xB6, 0xF0, 0xF0, 0x16, 0xF0, 0xF0,
+  0x25, 0xF0, 0xF0, 0x25, 0xF0, 0xF0, 0x24, 0xF0, 0xF0, 0x34, 0xF0, 0xF0,
+  0xF0, 0xF0, 0xF0, 0xF0, 0xA9, 0xF0, 0x9F, 0xF0, 0x4F, 0x04, 0xF0, 0x1F,
+  0x07, 0xD9, 0x69, 0xB7, 0xC7, 0x96, 0xF7, 0x76, 0xF0, 0x36, 0x65, 0xF0,
+  0x55, 0x56, 0xF0, 0x56, 0x45, 0xF0, 0x75, 0x35, 0xF0, 0x86, 0x25, 0xF0,
+  0x95, 0x25, 0xF0, 0x95, 0x15, 0xF0, 0xB4, 0x15, 0xF0, 0xBA, 0xF0, 0xBA,
+  0xF0, 0xBA, 0xF0, 0xBA, 0xF0, 0xBA, 0xF0, 0xBA, 0xF0, 0xBA, 0xF0, 0xBA,
+  0xF0, 0xBA, 0xF0, 0xB4, 0x25, 0xF0, 0x95, 0x25, 0xF0, 0x95, 0x25, 0xF0,
+  0x86, 0x35, 0xF0, 0x75, 0x46, 0xF0, 0x56, 0x55, 0xF0, 0x55, 0x66, 0xF0,
+  0x36, 0x76, 0xF7, 0x97, 0xC7, 0xB9, 0x69, 0xDF, 0x07, 0xF0, 0x1F, 0x03,
+  0xF0, 0x4F, 0xF0, 0xA9, 0xD0, 0xF0, 0x46, 0xF0, 0xE6, 0xF0, 0xE6, 0xF0,
+  0xF4, 0xF0, 0xF0, 0x14, 0xF0, 0xF0, 0x14, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xF0, 0xC9, 0xF0, 0x9F, 0xF0, 0x4F, 0x04, 0xF0, 0x1F, 0x07, 0xD9, 0x69,
+  0xB7, 0xC7, 0x96, 0xF7, 0x76, 0xF0, 0x36, 0x65, 0xF0, 0x55, 0x56, 0xF0,
+  0x56, 0x45, 0xF0, 0x75, 0x35, 0xF0, 0x86, 0x25, 0xF0, 0x95, 0x25, 0xF0,
+  0x95, 0x15, 0xF0, 0xB4, 0x15, 0xF0, 0xBA, 0xF0, 0xBA, 0xF0, 0xBA, 0xF0,
+  0xBA, 0xF0, 0xBA, 0xF0, 0xBA, 0xF0, 0xBA, 0xF0, 0xBA, 0xF0, 0xBA, 0xF0,
+  0xB4, 0x25, 0xF0, 0x95, 0x25, 0xF0, 0x95, 0x25, 0xF0, 0x86, 0x35, 0xF0,
+  0x75, 0x46, 0xF0, 0x56, 0x55, 0xF0, 0x55, 0x66, 0xF0, 0x36, 0x76, 0xF7,
+  0x97, 0xC7, 0xB9, 0x69, 0xDF, 0x07, 0xF0, 0x1F, 0x03, 0xF0, 0x4F, 0xF0,
+  0xA9, 0xD0, 0xF6, 0xF0, 0xE8, 0xF0, 0xD8, 0xF0, 0xCA, 0xF0, 0xA4, 0x44,
+  0xF0, 0x84, 0x64, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x69, 0xF0, 0x9F,
+  0xF0, 0x4F, 0x04, 0xF0, 0x1F, 0x07, 0xD9, 0x69, 0xB7, 0xC7, 0x96, 0xF7,
+  0x76, 0xF0, 0x36, 0x65, 0xF0, 0x55, 0x56, 0xF0, 0x56, 0x45, 0xF0, 0x75,
+  0x35, 0xF0, 0x86, 0x25, 0xF0, 0x95, 0x25, 0xF0, 0x95, 0x15, 0xF0, 0xB4,
+  0x15, 0xF0, 0xBA, 0xF0, 0xBA, 0xF0, 0xBA, 0xF0, 0xBA, 0xF0, 0xBA, 0xF0,
+  0xBA, 0xF0, 0xBA, 0xF0, 0xBA, 0xF0, 0xBA, 0xF0, 0xB4, 0x25, 0xF0, 0x95,
+  0x25, 0xF0, 0x95, 0x25, 0xF0, 0x86, 0x35, 0xF0, 0x75, 0x46, 0xF0, 0x56,
+  0x55, 0xF0, 0x55, 0x66, 0xF0, 0x36, 0x76, 0xF7, 0x97, 0xC7, 0xB9, 0x69,
+  0xDF, 0x07, 0xF0, 0x1F, 0x03, 0xF0, 0x4F, 0xF0, 0xA9, 0xD0, 0xC5, 0x63,
+  0xF0, 0x69, 0x14, 0xF0, 0x7E, 0xF0, 0x64, 0x29, 0xF0, 0x63, 0x65, 0xF0,
+  0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x79, 0xF0, 0x9F, 0xF0, 0x4F, 0x04, 0xF0,
+  0x1F, 0x07, 0xD9, 0x69, 0xB7, 0xC7, 0x96, 0xF7, 0x76, 0xF0, 0x36, 0x65,
+  0xF0, 0x55, 0x56, 0xF0, 0x56, 0x45, 0xF0, 0x75, 0x35, 0xF0, 0x86, 0x25,
+  0xF0, 0x95, 0x25, 0xF0, 0x95, 0x15, 0xF0, 0xB4, 0x15, 0xF0, 0xBA, 0xF0,
+  0xBA, 0xF0, 0xBA, 0xF0, 0xBA, 0xF0, 0xBA, 0xF0, 0xBA, 0xF0, 0xBA, 0xF0,
+  0xBA, 0xF0, 0xBA, 0xF0, 0xB4, 0x25, 0xF0, 0x95, 0x25, 0xF0, 0x95, 0x25,
+  0xF0, 0x86, 0x35, 0xF0, 0x75, 0x46, 0xF0, 0x56, 0x55, 0xF0, 0x55, 0x66,
+  0xF0, 0x36, 0x76, 0xF7, 0x97, 0xC7, 0xB9, 0x69, 0xDF, 0x07, 0xF0, 0x1F,
+  0x03, 0xF0, 0x4F, 0xF0, 0xA9, 0xD0, 0xB5, 0x45, 0xF0, 0x75, 0x45, 0xF0,
+  0x75, 0x45, 0xF0, 0x75, 0x45, 0xF0, 0x75, 0x45, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xF0, 0xF0, 0x69, 0xF0, 0x9F, 0xF0, 0x4F, 0x04, 0xF0, 0x1F, 0x07, 0xD9,
+  0x69, 0xB7, 0xC7, 0x96, 0xF7, 0x76, 0xF0, 0x36, 0x65, 0xF0, 0x55, 0x56,
+  0xF0, 0x56, 0x45, 0xF0, 0x75, 0x35, 0xF0, 0x86, 0x25, 0xF0, 0x95, 0x25,
+  0xF0, 0x95, 0x15, 0xF0, 0xB4, 0x15, 0xF0, 0xBA, 0xF0, 0xBA, 0xF0, 0xBA,
+  0xF0, 0xBA, 0xF0, 0xBA, 0xF0, 0xBA, 0xF0, 0xBA, 0xF0, 0xBA, 0xF0, 0xBA,
+  0xF0, 0xB4, 0x25, 0xF0, 0x95, 0x25, 0xF0, 0x95, 0x25, 0xF0, 0x86, 0x35,
+  0xF0, 0x75, 0x46, 0xF0, 0x56, 0x55, 0xF0, 0x55, 0x66, 0xF0, 0x36, 0x76,
+  0xF7, 0x97, 0xC7, 0xB9, 0x69, 0xDF, 0x07, 0xF0, 0x1F, 0x03, 0xF0, 0x4F,
+  0xF0, 0xA9, 0xD0, 0x21, 0xE1, 0x33, 0xC3, 0x15, 0xA4, 0x25, 0x85, 0x35,
+  0x65, 0x55, 0x45, 0x75, 0x25, 0x9A, 0xB8, 0xD6, 0xE6, 0xD8, 0xBA, 0x95,
+  0x25, 0x75, 0x45, 0x55, 0x65, 0x35, 0x85, 0x15, 0xA5, 0x13, 0xC3, 0x31,
+  0xE1, 0x20, 0xF0, 0xF0, 0xF0, 0x49, 0xB2, 0xBF, 0x01, 0x64, 0x8F, 0x04,
+  0x44, 0x8F, 0x07, 0x14, 0x89, 0x6C, 0x87, 0xC8, 0x87, 0xE7, 0x76, 0xF0,
+  0x36, 0x65, 0xF0, 0x37, 0x56, 0xF0, 0x29, 0x45, 0xF0, 0x24, 0x15, 0x35,
+  0xF0, 0x24, 0x26, 0x25, 0xF0, 0x14, 0x45, 0x25, 0xF4, 0x55, 0x15, 0xF4,
+  0x74, 0x15, 0xE4, 0x8A, 0xD4, 0x9A, 0xC4, 0xAA, 0xC3, 0xBA, 0xB3, 0xCA,
+  0xA3, 0xDA, 0x94, 0xDA, 0x84, 0xEA, 0x74, 0xFA, 0x64, 0xF0, 0x14, 0x25,
+  0x44, 0xF0, 0x15, 0x25, 0x34, 0xF0, 0x25, 0x25, 0x24, 0xF0, 0x26, 0x39,
+  0xF0, 0x35, 0x48, 0xF0, 0x36, 0x56, 0xF0, 0x45, 0x66, 0xF0, 0x36, 0x76,
+  0xF7, 0x79, 0xC7, 0x7D, 0x69, 0x74, 0x2F, 0x07, 0x74, 0x4F, 0x04, 0x93,
+  0x7F, 0x01, 0xF0, 0x89, 0xE0, 0x86, 0xF0, 0xA5, 0xF0, 0xA5, 0xF0, 0xA5,
+  0xF0, 0xB4, 0xF0, 0xB4, 0xF0, 0xF0, 0xF0, 0xF0, 0x85, 0xF0, 0x4A, 0xF0,
+  0x4A, 0xF0, 0x4A, 0xF0, 0x4A, 0xF0, 0x4A, 0xF0, 0x4A, 0xF0, 0x4A, 0xF0,
+  0x4A, 0xF0, 0x4A, 0xF0, 0x4A, 0xF0, 0x4A, 0xF0, 0x4A, 0xF0, 0x4A, 0xF0,
+  0x4A, 0xF0, 0x4A, 0xF0, 0x4A, 0xF0, 0x4A, 0xF0, 0x4A, 0xF0, 0x4A, 0xF0,
+  0x4A, 0xF0, 0x4A, 0xF0, 0x4A, 0xF0, 0x4A, 0xF0, 0x4A, 0xF0, 0x4A, 0xF0,
+  0x4A, 0xF0, 0x4A, 0xF0, 0x44, 0x15, 0xF0, 0x35, 0x25, 0xF0, 0x25, 0x25,
+  0xF0, 0x16, 0x26, 0xE6, 0x46, 0xC7, 0x59, 0x59, 0x7F, 0x06, 0x9F, 0x04,
+  0xCF, 0xF0, 0x1A, 0xA0, 0xF6, 0xF0, 0x76, 0xF0, 0x76, 0xF0, 0x84, 0xF0,
+  0x94, 0xF0, 0x94, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xB5, 0xF0, 0x4A,
+  0xF0, 0x4A, 0xF0, 0x4A, 0xF0, 0x4A, 0xF0, 0x4A, 0xF0, 0x4A, 0xF0, 0x4A,
+  0xF0, 0x4A, 0xF0, 0x4A, 0xF0, 0x4A, 0xF0, 0x4A, 0xF0, 0x4A, 0xF0, 0x4A,
+  0xF0, 0x4A, 0xF0, 0x4A, 0xF0, 0x4A, 0xF0, 0x4A, 0xF0, 0x4A, 0xF0, 0x4A,
+  0xF0, 0x4A, 0xF0, 0x4A, 0xF0, 0x4A, 0xF0, 0x4A, 0xF0, 0x4A, 0xF0, 0x4A,
+  0xF0, 0x4A, 0xF0, 0x4A, 0xF0, 0x44, 0x15, 0xF0, 0x35, 0x25, 0xF0, 0x25,
+  0x25, 0xF0, 0x16, 0x26, 0xE6, 0x46, 0xC7, 0x59, 0x59, 0x7F, 0x06, 0x9F,
+  0x04, 0xCF, 0xF0, 0x1A, 0xA0, 0xC5, 0xF0, 0x87, 0xF0, 0x69, 0xF0, 0x45,
+  0x15, 0xF0, 0x34, 0x34, 0xF0, 0x24, 0x54, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xF0, 0x55, 0xF0, 0x4A, 0xF0, 0x4A, 0xF0, 0x4A, 0xF0, 0x4A, 0xF0, 0x4A,
+  0xF0, 0x4A, 0xF0, 0x4A, 0xF0, 0x4A, 0xF0, 0x4A, 0xF0, 0x4A, 0xF0, 0x4A,
+  0xF0, 0x4A, 0xF0, 0x4A, 0xF0, 0x4A, 0xF0, 0x4A, 0xF0, 0x4A, 0xF0, 0x4A,
+  0xF0, 0x4A, 0xF0, 0x4A, 0xF0, 0x4A, 0xF0, 0x4A, 0xF0, 0x4A, 0xF0, 0x4A,
+  0xF0, 0x4A, 0xF0, 0x4A, 0xF0, 0x4A, 0xF0, 0x4A, 0xF0, 0x44, 0x15, 0xF0,
+  0x35, 0x25, 0xF0, 0x25, 0x25, 0xF0, 0x16, 0x26, 0xE6, 0x46, 0xC7, 0x59,
+  0x59, 0x7F, 0x06, 0x9F, 0x04, 0xCF, 0xF0, 0x1A, 0xA0, 0x85, 0x45, 0xF5,
+  0x45, 0xF5, 0x45, 0xF5, 0x45, 0xF5, 0x45, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xF0, 0x45, 0xF0, 0x4A, 0xF0, 0x4A, 0xF0, 0x4A, 0xF0, 0x4A, 0xF0, 0x4A,
+  0xF0, 0x4A, 0xF0, 0x4A, 0xF0, 0x4A, 0xF0, 0x4A, 0xF0, 0x4A, 0xF0, 0x4A,
+  0xF0, 0x4A, 0xF0, 0x4A, 0xF0, 0x4A, 0xF0, 0x4A, 0xF0, 0x4A, 0xF0, 0x4A,
+  0xF0, 0x4A, 0xF0, 0x4A, 0xF0, 0x4A, 0xF0, 0x4A, 0xF0, 0x4A, 0xF0, 0x4A,
+  0xF0, 0x4A, 0xF0, 0x4A, 0xF0, 0x4A, 0xF0, 0x4A, 0xF0, 0x44, 0x15, 0xF0,
+  0x35, 0x25, 0xF0, 0x25, 0x25, 0xF0, 0x16, 0x26, 0xE6, 0x46, 0xC7, 0x59,
+  0x59, 0x7F, 0x06, 0x9F, 0x04, 0xCF, 0xF0, 0x1A, 0xA0, 0xF0, 0x26, 0xF0,
+  0xB6, 0xF0, 0xB6, 0xF0, 0xC4, 0xF0, 0xD4, 0xF0, 0xD4, 0xF0, 0xF0, 0xF0,
+  0xF0, 0xF0, 0xF0, 0xF0, 0xA6, 0xF0, 0x65, 0x26, 0xF0, 0x46, 0x26, 0xF0,
+  0x45, 0x46, 0xF0, 0x26, 0x55, 0xF0, 0x16, 0x66, 0xF5, 0x86, 0xD6, 0x95,
+  0xD5, 0xA6, 0xB5, 0xC5, 0xB5, 0xC6, 0x95, 0xE6, 0x76, 0xF5, 0x75, 0xF0,
+  0x16, 0x55, 0xF0, 0x35, 0x55, 0xF0, 0x45, 0x35, 0xF0, 0x56, 0x16, 0xF0,
+  0x65, 0x15, 0xF0, 0x89, 0xF0, 0x99, 0xF0, 0xA7, 0xF0, 0xB6, 0xF0, 0xD5,
+  0xF0, 0xD5, 0xF0, 0xD5, 0xF0, 0xD5, 0xF0, 0xD5, 0xF0, 0xD5, 0xF0, 0xD5,
+  0xF0, 0xD5, 0xF0, 0xD5, 0xF0, 0xD5, 0xF0, 0xD5, 0xF0, 0xD5, 0xF0, 0xD5,
+  0xF0, 0xD5, 0xF0, 0xD5, 0xE0, 0x05, 0xF0, 0x75, 0xF0, 0x75, 0xF0, 0x75,
+  0xF0, 0x75, 0xF0, 0x75, 0xF0, 0x7F, 0x04, 0x8F, 0x07, 0x5F, 0x08, 0x4F,
+  0x09, 0x35, 0xC8, 0x25, 0xE7, 0x15, 0xF6, 0x15, 0xF0, 0x15, 0x15, 0xF0,
+  0x1B, 0xF0, 0x2A, 0xF0, 0x2A, 0xF0, 0x2A, 0xF0, 0x1B, 0xF0, 0x15, 0x15,
+  0xF0, 0x15, 0x15, 0xF6, 0x15, 0xD7, 0x2F, 0x0A, 0x2F, 0x09, 0x3F, 0x07,
+  0x5F, 0x05, 0x75, 0xF0, 0x75, 0xF0, 0x75, 0xF0, 0x75, 0xF0, 0x75, 0xF0,
+  0x75, 0xF0, 0x75, 0xF0, 0x75, 0xF0, 0x75, 0xF0, 0x75, 0xF0, 0x70, 0x78,
+  0xED, 0x9F, 0x02, 0x6F, 0x03, 0x57, 0x76, 0x45, 0xA6, 0x35, 0xB5, 0x25,
+  0xD4, 0x25, 0xD4, 0x25, 0xD4, 0x25, 0xD4, 0x25, 0xD4, 0x25, 0xC5, 0x25,
+  0xB5, 0x35, 0x97, 0x35, 0x5A, 0x45, 0x59, 0x55, 0x5B, 0x35, 0x5C, 0x25,
+  0xB6, 0x25, 0xC6, 0x15, 0xD5, 0x15, 0xEA, 0xEA, 0xEA, 0xF9, 0xF9, 0xEA,
+  0xEA, 0xEA, 0xD5, 0x15, 0xD5, 0x15, 0xC5, 0x25, 0xA7, 0x25, 0x4C, 0x35,
+  0x4B, 0x45, 0x4A, 0xE7, 0x80, 0x56, 0xF0, 0x55, 0xF0, 0x65, 0xF0, 0x65,
+  0xF0, 0x64, 0xF0, 0x74, 0xF0, 0x74, 0xF0, 0x73, 0xF0, 0xF0, 0xF0, 0xF0,
+  0x79, 0xED, 0xAF, 0x02, 0x7F, 0x03, 0x76, 0x76, 0x55, 0xA5, 0x55, 0xB4,
+  0x54, 0xC4, 0x54, 0xC4, 0xF0, 0x64, 0xF0, 0x64, 0xF0, 0x46, 0xEB, 0x9F,
+  0x01, 0x7F, 0x03, 0x5C, 0x44, 0x57, 0x94, 0x46, 0xB4, 0x45, 0xC4, 0x44,
+  0xD4, 0x44, 0xD4, 0x44, 0xD4, 0x44, 0xC5, 0x45, 0xA6, 0x46, 0x79, 0x4F,
+  0x09, 0x1F, 0x27, 0x3B, 0x47, 0x57, 0x76, 0xC6, 0xF0, 0x36, 0xF0, 0x45,
+  0xF0, 0x45, 0xF0, 0x44, 0xF0, 0x63, 0xF0, 0x63, 0xF0, 0x63, 0xF0, 0xF0,
+  0xF0, 0xF0, 0xC9, 0xED, 0xAF, 0x02, 0x7F, 0x03, 0x76, 0x76, 0x55, 0xA5,
+  0x55, 0xB4, 0x54, 0xC4, 0x54, 0xC4, 0xF0, 0x64, 0xF0, 0x64, 0xF0, 0x46,
+  0xEB, 0x9F, 0x01, 0x7F, 0x03, 0x5C, 0x44, 0x57, 0x94, 0x46, 0xB4, 0x45,
+  0xC4, 0x44, 0xD4, 0x44, 0xD4, 0x44, 0xD4, 0x44, 0xC5, 0x45, 0xA6, 0x46,
+  0x79, 0x4F, 0x09, 0x1F, 0x27, 0x3B, 0x47, 0x57, 0x76, 0xA5, 0xF0, 0x46,
+  0xF0, 0x38, 0xF0, 0x28, 0xF0, 0x14, 0x24, 0xE4, 0x44, 0xD3, 0x63, 0xC3,
+  0x83, 0xF0, 0xF0, 0xF0, 0xF0, 0x39, 0xED, 0xAF, 0x02, 0x7F, 0x03, 0x76,
+  0x76, 0x55, 0xA5, 0x55, 0xB4, 0x54, 0xC4, 0x54, 0xC4, 0xF0, 0x64, 0xF0,
+  0x64, 0xF0, 0x46, 0xEB, 0x9F, 0x01, 0x7F, 0x03, 0x5C, 0x44, 0x57, 0x94,
+  0x46, 0xB4, 0x45, 0xC4, 0x44, 0xD4, 0x44, 0xD4, 0x44, 0xD4, 0x44, 0xC5,
+  0x45, 0xA6, 0x46, 0x79, 0x4F, 0x09, 0x1F, 0x27, 0x3B, 0x47, 0x57, 0x76,
+  0x73, 0x73, 0xA8, 0x34, 0xAE, 0xA4, 0x1A, 0xA3, 0x56, 0xF0, 0xF0, 0xF0,
+  0xF0, 0xF0, 0xF0, 0xF0, 0x99, 0xED, 0xAF, 0x02, 0x7F, 0x03, 0x76, 0x76,
+  0x55, 0xA5, 0x55, 0xB4, 0x54, 0xC4, 0x54, 0xC4, 0xF0, 0x64, 0xF0, 0x64,
+  0xF0, 0x46, 0xEB, 0x9F, 0x01, 0x7F, 0x03, 0x5C, 0x44, 0x57, 0x94, 0x46,
+  0xB4, 0x45, 0xC4, 0x44, 0xD4, 0x44, 0xD4, 0x44, 0xD4, 0x44, 0xC5, 0x45,
+  0xA6, 0x46, 0x79, 0x4F, 0x09, 0x1F, 0x27, 0x3B, 0x47, 0x57, 0x76, 0x55,
+  0x45, 0xB5, 0x45, 0xB5, 0x45, 0xB5, 0x45, 0xB5, 0x45, 0xF0, 0xF0, 0xF0,
+  0xF0, 0xF0, 0xF0, 0xF0, 0x89, 0xED, 0xAF, 0x02, 0x7F, 0x03, 0x76, 0x76,
+  0x55, 0xA5, 0x55, 0xB4, 0x54, 0xC4, 0x54, 0xC4, 0xF0, 0x64, 0xF0, 0x64,
+  0xF0, 0x46, 0xEB, 0x9F, 0x01, 0x7F, 0x03, 0x5C, 0x44, 0x57, 0x94, 0x46,
+  0xB4, 0x45, 0xC4, 0x44, 0xD4, 0x44, 0xD4, 0x44, 0xD4, 0x44, 0xC5, 0x45,
+  0xA6, 0x46, 0x79, 0x4F, 0x09, 0x1F, 0x27, 0x3B, 0x47, 0x57, 0x76, 0xA4,
+  0xF0, 0x48, 0xF0, 0x1A, 0xF4, 0x24, 0xF3, 0x43, 0xF3, 0x43, 0xF3, 0x43,
+  0xF4, 0x24, 0xFA, 0xF0, 0x18, 0xF0, 0x44, 0xF0, 0xF0, 0xD9, 0xED, 0xAF,
+  0x02, 0x7F, 0x03, 0x76, 0x76, 0x55, 0xA5, 0x55, 0xB4, 0x54, 0xC4, 0x54,
+  0xC4, 0xF0, 0x64, 0xF0, 0x64, 0xF0, 0x46, 0xEB, 0x9F, 0x01, 0x7F, 0x03,
+  0x5C, 0x44, 0x57, 0x94, 0x46, 0xB4, 0x45, 0xC4, 0x44, 0xD4, 0x44, 0xD4,
+  0x44, 0xD4, 0x44, 0xC5, 0x45, 0xA6, 0x46, 0x79, 0x4F, 0x09, 0x1F, 0x27,
+  0x3B, 0x47, 0x57, 0x76, 0x78, 0xB7, 0xDD, 0x5C, 0x9F, 0x01, 0x3E, 0x7F,
+  0x03, 0x1F, 0x02, 0x56, 0x7B, 0x66, 0x45, 0xA8, 0x96, 0x35, 0xB6, 0xB6,
+  0x24, 0xC6, 0xC5, 0x24, 0xC5, 0xE4, 0xF0, 0x35, 0xE4, 0xF0, 0x34, 0xF5,
+  0xF6, 0xF5, 0x8F, 0x0F, 0x03, 0x4F, 0x0F, 0x07, 0x2F, 0x0F, 0x09, 0x1B,
+  0x54, 0xF0, 0x66, 0xA4, 0xF0, 0x55, 0xC4, 0xF0, 0x54, 0xD4, 0xF0, 0x54,
+  0xD5, 0xE4, 0x14, 0xD5, 0xE4, 0x14, 0xC7, 0xC5, 0x14, 0xB8, 0xB5, 0x25,
+  0x9A, 0x96, 0x26, 0x75, 0x26, 0x66, 0x4F, 0x01, 0x3F, 0x03, 0x4F, 0x5F,
+  0x01, 0x7B, 0x9C, 0xB7, 0xD8, 0x80, 0x87, 0xDB, 0x9F, 0x6F, 0x02, 0x47,
+  0x56, 0x45, 0x95, 0x25, 0xA5, 0x24, 0xCA, 0xCA, 0xD8, 0xF0, 0x34, 0xF0,
+  0x34, 0xF0, 0x34, 0xF0, 0x34, 0xF0, 0x34, 0xF0, 0x34, 0xF0, 0x34, 0xF0,
+  0x34, 0xF0, 0x35, 0xD9, 0xC5, 0x14, 0xC5, 0x15, 0xB4, 0x35, 0x95, 0x36,
+  0x66, 0x5F, 0x02, 0x6F, 0x9B, 0xD7, 0xF0, 0x12, 0xF0, 0x52, 0xF0, 0x46,
+  0xF0, 0x18, 0xF0, 0x34, 0xF0, 0x34, 0xA1, 0x74, 0xA3, 0x45, 0xAB, 0xE6,
+  0x90, 0x56, 0xF0, 0x46, 0xF0, 0x45, 0xF0, 0x55, 0xF0, 0x54, 0xF0, 0x64,
+  0xF0, 0x64, 0xF0, 0x63, 0xF0, 0xF0, 0xF0, 0xF0, 0x57, 0xFC, 0xAF, 0x8F,
+  0x02, 0x67, 0x57, 0x55, 0x96, 0x35, 0xB5, 0x34, 0xD4, 0x25, 0xD5, 0x14,
+  0xF4, 0x14, 0xF4, 0x14, 0xF4, 0x1F, 0x08, 0x1F, 0x0F, 0x0F, 0x07, 0xF0,
+  0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x55, 0xE4, 0x15, 0xD5, 0x24, 0xD5,
+  0x25, 0xB5, 0x45, 0x96, 0x47, 0x66, 0x6F, 0x02, 0x8F, 0xBC, 0xE8, 0x80,
+  0xD5, 0xF0, 0x35, 0xF0, 0x35, 0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x44, 0xF0,
+  0x53, 0xF0, 0x53, 0xF0, 0xF0, 0xF0, 0xF0, 0x97, 0xFC, 0xAF, 0x8F, 0x02,
+  0x67, 0x57, 0x55, 0x96, 0x35, 0xB5, 0x34, 0xD4, 0x25, 0xD5, 0x14, 0xF4,
+  0x14, 0xF4, 0x14, 0xF4, 0x1F, 0x08, 0x1F, 0x0F, 0x0F, 0x07, 0xF0, 0x54,
+  0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x55, 0xE4, 0x15, 0xD5, 0x24, 0xD5, 0x25,
+  0xB5, 0x45, 0x96, 0x47, 0x66, 0x6F, 0x02, 0x8F, 0xBC, 0xE8, 0x80, 0xA5,
+  0xF0, 0x36, 0xF0, 0x28, 0xF0, 0x18, 0xF4, 0x24, 0xD4, 0x44, 0xC3, 0x63,
+  0xB3, 0x83, 0xF0, 0xF0, 0xF0, 0xF0, 0x17, 0xFC, 0xAF, 0x8F, 0x02, 0x67,
+  0x57, 0x55, 0x96, 0x35, 0xB5, 0x34, 0xD4, 0x25, 0xD5, 0x14, 0xF4, 0x14,
+  0xF4, 0x14, 0xF4, 0x1F, 0x08, 0x1F, 0x0F, 0x0F, 0x07, 0xF0, 0x54, 0xF0,
+  0x54, 0xF0, 0x54, 0xF0, 0x55, 0xE4, 0x15, 0xD5, 0x24, 0xD5, 0x25, 0xB5,
+  0x45, 0x96, 0x47, 0x66, 0x6F, 0x02, 0x8F, 0xBC, 0xE8, 0x80, 0x55, 0x45,
+  0xA5, 0x45, 0xA5, 0x45, 0xA5, 0x45, 0xA5, 0x45, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xF0, 0xF0, 0xF0, 0x47, 0xFC, 0xAF, 0x8F, 0x02, 0x67, 0x57, 0x55, 0x96,
+  0x35, 0xB5, 0x34, 0xD4, 0x25, 0xD5, 0x14, 0xF4, 0x14, 0xF4, 0x14, 0xF4,
+  0x1F, 0x08, 0x1F, 0x0F, 0x0F, 0x07, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54,
+  0xF0, 0x55, 0xE4, 0x15, 0xD5, 0x24, 0xD5, 0x25, 0xB5, 0x45, 0x96, 0x47,
+  0x66, 0x6F, 0x02, 0x8F, 0xBC, 0xE8, 0x80, 0x06, 0x66, 0x65, 0x75, 0x84,
+  0x83, 0x93, 0x93, 0xF0, 0xF0, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
+  0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
+  0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x30, 0x46, 0x45, 0x45,
+  0x45, 0x54, 0x54, 0x54, 0x63, 0xF0, 0xF0, 0xA4, 0x64, 0x64, 0x64, 0x64,
+  0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+  0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x30, 0x55,
+  0xA6, 0x87, 0x74, 0x14, 0x64, 0x24, 0x44, 0x43, 0x34, 0x54, 0x23, 0x74,
+  0xF0, 0xF0, 0xF0, 0x64, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4,
+  0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4,
+  0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0x50, 0x06, 0x4B, 0x4B, 0x4B, 0x4B,
+  0x45, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x64, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4,
+  0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4,
+  0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0x50, 0x33, 0xF0,
+  0x56, 0x53, 0xB7, 0x16, 0xCA, 0xF7, 0xFA, 0xC6, 0x16, 0xC3, 0x46, 0xF0,
+  0x55, 0xF0, 0x55, 0xD6, 0x15, 0xAF, 0x8F, 0x01, 0x7F, 0x03, 0x57, 0x66,
+  0x46, 0x96, 0x35, 0xB5, 0x34, 0xD5, 0x15, 0xD5, 0x15, 0xD5, 0x14, 0xF4,
+  0x14, 0xF4, 0x14, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF4, 0x14, 0xF4, 0x15,
+  0xD5, 0x15, 0xD5, 0x25, 0xC5, 0x25, 0xB5, 0x36, 0x96, 0x47, 0x57, 0x6F,
+  0x02, 0x8F, 0xAD, 0xE8, 0x80, 0x64, 0x63, 0x77, 0x34, 0x6E, 0x73, 0x1A,
+  0x63, 0x56, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x86, 0x54, 0x4A, 0x34,
+  0x2E, 0x14, 0x1F, 0x14, 0x13, 0x7D, 0x9B, 0xAA, 0xC9, 0xC9, 0xC9, 0xC8,
+  0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8,
+  0xD8, 0xD8, 0xD8, 0xD8, 0xD4, 0x56, 0xF0, 0x46, 0xF0, 0x45, 0xF0, 0x55,
+  0xF0, 0x54, 0xF0, 0x64, 0xF0, 0x64, 0xF0, 0x63, 0xF0, 0xF0, 0xF0, 0xF0,
+  0x57, 0xED, 0xAF, 0x8F, 0x02, 0x67, 0x57, 0x55, 0x96, 0x35, 0xB5, 0x35,
+  0xC4, 0x25, 0xD5, 0x15, 0xD5, 0x14, 0xF4, 0x14, 0xF4, 0x14, 0xF9, 0xF9,
+  0xF9, 0xF9, 0xF9, 0xF4, 0x14, 0xF4, 0x15, 0xD5, 0x15, 0xD5, 0x24, 0xD5,
+  0x25, 0xB5, 0x45, 0x96, 0x47, 0x57, 0x6F, 0x02, 0x8F, 0xAD, 0xE7, 0x90,
+  0xC6, 0xF0, 0x35, 0xF0, 0x35, 0xF0, 0x35, 0xF0, 0x44, 0xF0, 0x44, 0xF0,
+  0x44, 0xF0, 0x53, 0xF0, 0xF0, 0xF0, 0xF0, 0x97, 0xED, 0xAF, 0x8F, 0x02,
+  0x67, 0x57, 0x55, 0x96, 0x35, 0xB5, 0x35, 0xC4, 0x25, 0xD5, 0x15, 0xD5,
+  0x14, 0xF4, 0x14, 0xF4, 0x14, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF4, 0x14,
+  0xF4, 0x15, 0xD5, 0x15, 0xD5, 0x24, 0xD5, 0x25, 0xB5, 0x45, 0x96, 0x47,
+  0x57, 0x6F, 0x02, 0x8F, 0xAD, 0xE7, 0x90, 0x95, 0xF0, 0x37, 0xF0, 0x18,
+  0xF0, 0x14, 0x14, 0xE4, 0x34, 0xC4, 0x53, 0xC3, 0x73, 0xA3, 0x84, 0xF0,
+  0xF0, 0x77, 0xED, 0xAF, 0x8F, 0x02, 0x67, 0x57, 0x55, 0x96, 0x35, 0xB5,
+  0x35, 0xC4, 0x25, 0xD5, 0x15, 0xD5, 0x14, 0xF4, 0x14, 0xF4, 0x14, 0xF9,
+  0xF9, 0xF9, 0xF9, 0xF9, 0xF4, 0x14, 0xF4, 0x15, 0xD5, 0x15, 0xD5, 0x24,
+  0xD5, 0x25, 0xB5, 0x45, 0x96, 0x47, 0x57, 0x6F, 0x02, 0x8F, 0xAD, 0xE7,
+  0x90, 0x64, 0x73, 0x98, 0x34, 0x9E, 0x94, 0x1A, 0x93, 0x56, 0xF0, 0xF0,
+  0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x57, 0xED, 0xAF, 0x8F, 0x02, 0x67, 0x57,
+  0x55, 0x96, 0x35, 0xB5, 0x35, 0xC4, 0x25, 0xD5, 0x15, 0xD5, 0x14, 0xF4,
+  0x14, 0xF4, 0x14, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF4, 0x14, 0xF4, 0x15,
+  0xD5, 0x15, 0xD5, 0x24, 0xD5, 0x25, 0xB5, 0x45, 0x96, 0x47, 0x57, 0x6F,
+  0x02, 0x8F, 0xAD, 0xE7, 0x90, 0x46, 0x36, 0x96, 0x36, 0x96, 0x36, 0x96,
+  0x36, 0x96, 0x36, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x47, 0xED,
+  0xAF, 0x8F, 0x02, 0x67, 0x57, 0x55, 0x96, 0x35, 0xB5, 0x35, 0xC4, 0x25,
+  0xD5, 0x15, 0xD5, 0x14, 0xF4, 0x14, 0xF4, 0x14, 0xF9, 0xF9, 0xF9, 0xF9,
+  0xF9, 0xF4, 0x14, 0xF4, 0x15, 0xD5, 0x15, 0xD5, 0x24, 0xD5, 0x25, 0xB5,
+  0x45, 0x96, 0x47, 0x57, 0x6F, 0x02, 0x8F, 0xAD, 0xE7, 0x90, 0x96, 0xF0,
+  0x36, 0xF0, 0x36, 0xF0, 0x36, 0xF0, 0x36, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xF0, 0xF0, 0xF0, 0x9F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x06, 0xF0, 0xF0,
+  0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x96, 0xF0, 0x36, 0xF0, 0x36, 0xF0,
+  0x36, 0xF0, 0x36, 0x90, 0xA7, 0x71, 0x9D, 0x42, 0x7F, 0x23, 0x6F, 0x05,
+  0x67, 0x58, 0x66, 0x96, 0x65, 0xB5, 0x64, 0xB6, 0x55, 0xA8, 0x45, 0xA2,
+  0x15, 0x44, 0xA3, 0x24, 0x44, 0x93, 0x34, 0x35, 0x83, 0x44, 0x35, 0x73,
+  0x55, 0x25, 0x63, 0x65, 0x25, 0x53, 0x75, 0x25, 0x43, 0x84, 0x44, 0x43,
+  0x84, 0x44, 0x33, 0x94, 0x45, 0x13, 0x95, 0x48, 0xA5, 0x47, 0xB4, 0x65,
+  0xB5, 0x66, 0x96, 0x77, 0x57, 0x7F, 0x04, 0x73, 0x1F, 0x73, 0x3D, 0x82,
+  0x77, 0xA0, 0x45, 0xF0, 0x25, 0xF0, 0x25, 0xF0, 0x24, 0xF0, 0x34, 0xF0,
+  0x34, 0xF0, 0x33, 0xF0, 0x43, 0xF0, 0xF0, 0xF0, 0xF0, 0xA4, 0xD8, 0xD8,
+  0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8,
+  0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xC9, 0xCA, 0xAB, 0x97, 0x16, 0x68, 0x1F,
+  0x05, 0x2E, 0x14, 0x3B, 0x34, 0x58, 0x80, 0xC6, 0xE6, 0xF5, 0xF5, 0xF5,
+  0xF0, 0x14, 0xF0, 0x14, 0xF0, 0x23, 0xF0, 0xF0, 0xF0, 0xF0, 0xD4, 0xD8,
+  0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8,
+  0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xC9, 0xCA, 0xAB, 0x97, 0x16, 0x68,
+  0x1F, 0x05, 0x2E, 0x14, 0x3B, 0x34, 0x58, 0x80, 0x85, 0xF7, 0xE8, 0xC4,
+  0x14, 0xB4, 0x34, 0xA3, 0x54, 0x84, 0x63, 0x74, 0x83, 0xF0, 0xF0, 0xF4,
+  0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8,
+  0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xC9, 0xCA, 0xAB, 0x97, 0x16,
+  0x68, 0x1F, 0x05, 0x2E, 0x14, 0x3B, 0x34, 0x58, 0x80, 0x45, 0x45, 0x75,
+  0x45, 0x75, 0x45, 0x75, 0x45, 0x75, 0x45, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xF0, 0xF0, 0x34, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8,
+  0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xC9, 0xCA,
+  0xAB, 0x97, 0x16, 0x68, 0x1F, 0x05, 0x2E, 0x14, 0x3B, 0x34, 0x58, 0x80,
+  0xE5, 0xF0, 0x35, 0xF0, 0x35, 0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x53, 0xF0,
+  0x53, 0xF0, 0x53, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xA4, 0xE5, 0x15, 0xD4,
+  0x25, 0xC5, 0x34, 0xC5, 0x35, 0xB4, 0x45, 0xA5, 0x54, 0xA4, 0x64, 0xA4,
+  0x65, 0x85, 0x74, 0x84, 0x84, 0x84, 0x85, 0x65, 0x94, 0x64, 0xA4, 0x64,
+  0xA5, 0x45, 0xB4, 0x44, 0xC4, 0x35, 0xC5, 0x24, 0xE4, 0x24, 0xE4, 0x15,
+  0xE9, 0xF0, 0x18, 0xF0, 0x18, 0xF0, 0x17, 0xF0, 0x36, 0xF0, 0x36, 0xF0,
+  0x35, 0xF0, 0x45, 0xF0, 0x44, 0xF0, 0x54, 0xF0, 0x45, 0xF0, 0x44, 0xF0,
+  0x45, 0xF0, 0x36, 0xE9, 0xF8, 0xF0, 0x18, 0xF0, 0x16, 0xF0, 0x10, 0x04,
+  0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54,
+  0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0x57, 0x84, 0x3B, 0x64, 0x2D, 0x54,
+  0x1F, 0x49, 0x57, 0x38, 0x86, 0x27, 0xA5, 0x26, 0xC5, 0x15, 0xD5, 0x15,
+  0xE4, 0x15, 0xE4, 0x15, 0xE9, 0xF9, 0xF9, 0xF9, 0xF9, 0xFA, 0xEA, 0xEA,
+  0xE4, 0x15, 0xD5, 0x16, 0xC5, 0x17, 0xA5, 0x28, 0x86, 0x29, 0x57, 0x34,
+  0x1F, 0x44, 0x2D, 0x54, 0x3B, 0x64, 0x57, 0x84, 0xF0, 0x54, 0xF0, 0x54,
+  0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54,
+  0xF0, 0x54, 0xF0, 0x50, 0x65, 0x45, 0xA5, 0x45, 0xA5, 0x45, 0xA5, 0x45,
+  0xA5, 0x45, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x54, 0xE5,
+  0x15, 0xD4, 0x25, 0xC5, 0x34, 0xC5, 0x35, 0xB4, 0x45, 0xA5, 0x54, 0xA4,
+  0x64, 0xA4, 0x65, 0x85, 0x74, 0x84, 0x84, 0x84, 0x85, 0x65, 0x94, 0x64,
+  0xA4, 0x64, 0xA5, 0x45, 0xB4, 0x44, 0xC4, 0x35, 0xC5, 0x24, 0xE4, 0x24,
+  0xE4, 0x15, 0xE9, 0xF0, 0x18, 0xF0, 0x18, 0xF0, 0x17, 0xF0, 0x36, 0xF0,
+  0x36, 0xF0, 0x35, 0xF0, 0x45, 0xF0, 0x44, 0xF0, 0x54, 0xF0, 0x45, 0xF0,
+  0x44, 0xF0, 0x45, 0xF0, 0x36, 0xE9, 0xF8, 0xF0, 0x18, 0xF0, 0x16, 0xF0,
+  0x10 };
+
+constexpr GFXglyph FreeSans_RLE_26pt8bGlyphs[] PROGMEM = {
+  {     0,   1,   1,  13,    0,    0 },   // 0x20 ' '
+  {     1,   5,  37,  17,    6,  -36 },   // 0x21 '!'
+  {    20,  13,  12,  17,    2,  -36 },   // 0x22 '"'
+  {    38,  27,  36,  28,    1,  -34 },   // 0x23 '#'
+  {   111,  24,  45,  28,    2,  -38 },   // 0x24 '$'
+  {   202,  43,  38,  45,    1,  -36 },   // 0x25 '%'
+  {   321,  29,  38,  34,    3,  -36 },   // 0x26 '&'
+  {   404,   4,  12,  10,    3,  -36 },   // 0x27 '''
+  {   410,  11,  48,  17,    4,  -36 },   // 0x28 '('
+  {   458,  11,  48,  17,    2,  -36 },   // 0x29 ')'
+  {   507,  15,  15,  20,    2,  -36 },   // 0x2A '*'
+  {   529,  24,  25,  30,    3,  -23 },   // 0x2B '+'
+  {   577,   6,  13,  14,    4,   -4 },   // 0x2C ','
+  {   588,  13,   4,  17,    2,  -15 },   // 0x2D '-'
+  {   592,   5,   5,  13,    4,   -4 },   // 0x2E '.'
+  {   594,  14,  38,  14,    0,  -36 },   // 0x2F '/'
+  {   633,  24,  38,  28,    2,  -36 },   // 0x30 '0'
+  {   694,  13,  37,  28,    5,  -36 },   // 0x31 '1'
+  {   731,  24,  37,  28,    2,  -36 },   // 0x32 '2'
+  {   797,  24,  38,  28,    2,  -36 },   // 0x33 '3'
+  {   862,  25,  37,  28,    1,  -36 },   // 0x34 '4'
+  {   937,  24,  38,  28,    2,  -36 },   // 0x35 '5'
+  {  1009,  24,  38,  28,    2,  -36 },   // 0x36 '6'
+  {  1077,  24,  37,  28,    2,  -36 },   // 0x37 '7'
+  {  1151,  24,  38,  28,    2,  -36 },   // 0x38 '8'
+  {  1216,  24,  38,  28,    2,  -36 },   // 0x39 '9'
+  {  1284,   5,  27,  13,    4,  -26 },   // 0x3A ':'
+  {  1293,   5,  35,  13,    4,  -26 },   // 0x3B ';'
+  {  1310,  25,  25,  30,    2,  -23 },   // 0x3C '<'
+  {  1353,  24,  13,  30,    3,  -17 },   // 0x3D '='
+  {  1374,  24,  25,  30,    3,  -23 },   // 0x3E '>'
+  {  1416,  22,  38,  28,    4,  -37 },   // 0x3F '?'
+  {  1481,  46,  45,  52,    2,  -37 },   // 0x40 '@'
+  {  1631,  32,  37,  34,    1,  -36 },   // 0x41 'A'
+  {  1721,  28,  37,  34,    4,  -36 },   // 0x42 'B'
+  {  1808,  32,  39,  36,    2,  -37 },   // 0x43 'C'
+  {  1897,  30,  37,  36,    4,  -36 },   // 0x44 'D'
+  {  1997,  27,  37,  32,    4,  -36 },   // 0x45 'E'
+  {  2071,  25,  37,  31,    4,  -36 },   // 0x46 'F'
+  {  2144,  34,  39,  39,    2,  -37 },   // 0x47 'G'
+  {  2240,  29,  37,  37,    4,  -36 },   // 0x48 'H'
+  {  2315,   5,  37,  14,    5,  -36 },   // 0x49 'I'
+  {  2328,  21,  38,  27,    2,  -36 },   // 0x4A 'J'
+  {  2397,  30,  37,  34,    4,  -36 },   // 0x4B 'K'
+  {  2480,  23,  37,  29,    4,  -36 },   // 0x4C 'L'
+  {  2553,  35,  37,  43,    4,  -36 },   // 0x4D 'M'
+  {  2657,  29,  37,  37,    4,  -36 },   // 0x4E 'N'
+  {  2728,  36,  39,  40,    2,  -37 },   // 0x4F 'O'
+  {  2825,  27,  37,  33,    4,  -36 },   // 0x50 'P'
+  {  2903,  36,  41,  40,    2,  -37 },   // 0x51 'Q'
+  {  3005,  30,  37,  36,    4,  -36 },   // 0x52 'R'
+  {  3105,  30,  39,  34,    2,  -37 },   // 0x53 'S'
+  {  3194,  29,  37,  32,    2,  -36 },   // 0x54 'T'
+  {  3268,  29,  38,  37,    4,  -36 },   // 0x55 'U'
+  {  3348,  31,  37,  33,    1,  -36 },   // 0x56 'V'
+  {  3438,  46,  37,  48,    1,  -36 },   // 0x57 'W'
+  {  3570,  32,  37,  33,    1,  -36 },   // 0x58 'X'
+  {  3660,  33,  37,  35,    1,  -36 },   // 0x59 'Y'
+  {  3745,  28,  37,  31,    2,  -36 },   // 0x5A 'Z'
+  {  3820,  10,  48,  14,    3,  -36 },   // 0x5B '['
+  {  3865,  14,  38,  14,    0,  -36 },   // 0x5C '\'
+  {  3903,  10,  48,  14,    1,  -36 },   // 0x5D ']'
+  {  3948,  20,  19,  24,    2,  -36 },   // 0x5E '^'
+  {  3982,  30,   3,  28,   -1,    7 },   // 0x5F '_'
+  {  3988,  11,   8,  13,    1,  -37 },   // 0x60 '`'
+  {  3996,  25,  29,  28,    2,  -27 },   // 0x61 'a'
+  {  4051,  24,  38,  28,    3,  -36 },   // 0x62 'b'
+  {  4119,  22,  29,  26,    2,  -27 },   // 0x63 'c'
+  {  4168,  23,  38,  28,    2,  -36 },   // 0x64 'd'
+  {  4232,  24,  29,  27,    2,  -27 },   // 0x65 'e'
+  {  4284,  12,  37,  14,    1,  -36 },   // 0x66 'f'
+  {  4322,  23,  39,  28,    2,  -27 },   // 0x67 'g'
+  {  4386,  21,  37,  27,    3,  -36 },   // 0x68 'h'
+  {  4437,   5,  37,  11,    3,  -36 },   // 0x69 'i'
+  {  4449,   9,  48,  12,    0,  -36 },   // 0x6A 'j'
+  {  4495,  23,  37,  26,    3,  -36 },   // 0x6B 'k'
+  {  4568,   4,  37,  11,    3,  -36 },   // 0x6C 'l'
+  {  4578,  35,  28,  41,    3,  -27 },   // 0x6D 'm'
+  {  4638,  21,  28,  27,    3,  -27 },   // 0x6E 'n'
+  {  4671,  24,  29,  27,    2,  -27 },   // 0x6F 'o'
+  {  4719,  24,  39,  28,    3,  -27 },   // 0x70 'p'
+  {  4789,  23,  39,  28,    2,  -27 },   // 0x71 'q'
+  {  4854,  13,  28,  17,    3,  -27 },   // 0x72 'r'
+  {  4883,  21,  29,  25,    2,  -27 },   // 0x73 's'
+  {  4926,  12,  35,  14,    1,  -33 },   // 0x74 't'
+  {  4961,  21,  28,  27,    3,  -26 },   // 0x75 'u'
+  {  4995,  25,  27,  25,    0,  -26 },   // 0x76 'v'
+  {  5052,  36,  27,  37,    0,  -26 },   // 0x77 'w'
+  {  5140,  24,  27,  24,    0,  -26 },   // 0x78 'x'
+  {  5193,  24,  38,  24,    0,  -26 },   // 0x79 'y'
+  {  5268,  21,  27,  25,    2,  -26 },   // 0x7A 'z'
+  {  5303,  12,  48,  17,    2,  -36 },   // 0x7B '{'
+  {  5351,   3,  48,  13,    5,  -36 },   // 0x7C '|'
+  {  5361,  12,  48,  17,    3,  -36 },   // 0x7D '}'
+  {  5410,  22,   8,  25,    2,  -21 },   // 0x7E '~'
+  {  5425,  37,  48,  41,    2,  -40 },   // 0x7F ''
+  {  5541,  37,  48,  41,    2,  -40 },   // 0x80 ''
+  {  5657,  37,  48,  41,    2,  -40 },   // 0x81 ''
+  {  5773,  37,  48,  41,    2,  -40 },   // 0x82 ''
+  {  5889,  37,  48,  41,    2,  -40 },   // 0x83 ''
+  {  6005,  37,  48,  41,    2,  -40 },   // 0x84 ''
+  {  6121,  37,  48,  41,    2,  -40 },   // 0x85 ''
+  {  6237,  37,  48,  41,    2,  -40 },   // 0x86 ''
+  {  6353,  37,  48,  41,    2,  -40 },   // 0x87 ''
+  {  6469,  37,  48,  41,    2,  -40 },   // 0x88 ''
+  {  6585,  37,  48,  41,    2,  -40 },   // 0x89 ''
+  {  6701,  37,  48,  41,    2,  -40 },   // 0x8A ''
+  {  6817,  37,  48,  41,    2,  -40 },   // 0x8B ''
+  {  6933,  37,  48,  41,    2,  -40 },   // 0x8C ''
+  {  7049,  37,  48,  41,    2,  -40 },   // 0x8D ''
+  {  7165,  37,  48,  41,    2,  -40 },   // 0x8E ''
+  {  7281,  37,  48,  41,    2,  -40 },   // 0x8F ''
+  {  7397,  37,  48,  41,    2,  -40 },   // 0x90 ''
+  {  7513,  37,  48,  41,    2,  -40 },   // 0x91 ''
+  {  7629,  37,  48,  41,    2,  -40 },   // 0x92 ''
+  {  7745,  37,  48,  41,    2,  -40 },   // 0x93 ''
+  {  7861,  37,  48,  41,    2,  -40 },   // 0x94 ''
+  {  7977,  37,  48,  41,    2,  -40 },   // 0x95 ''
+  {  8093,  37,  48,  41,    2,  -40 },   // 0x96 ''
+  {  8209,  37,  48,  41,    2,  -40 },   // 0x97 ''
+  {  8325,  37,  48,  41,    2,  -40 },   // 0x98 ''
+  {  8441,  37,  48,  41,    2,  -40 },   // 0x99 ''
+  {  8557,  37,  48,  41,    2,  -40 },   // 0x9A ''
+  {  8673,  37,  48,  41,    2,  -40 },   // 0x9B ''
+  {  8789,  37,  48,  41,    2,  -40 },   // 0x9C ''
+  {  8905,  37,  48,  41,    2,  -40 },   // 0x9D ''
+  {  9021,  37,  48,  41,    2,  -40 },   // 0x9E ''
+  {  9137,  37,  48,  41,    2,  -40 },   // 0x9F ''
+  {  9253,   1,   1,  14,    0,    0 },   // 0xA0 ''
+  {  9254,   4,  37,  17,    6,  -26 },   // 0xA1 ''
+  {  9269,  23,  39,  28,    3,  -32 },   // 0xA2 ''
+  {  9352,  26,  38,  28,    1,  -36 },   // 0xA3 ''
+  {  9429,  22,  21,  28,    3,  -27 },   // 0xA4 ''
+  {  9474,  27,  37,  28,    1,  -36 },   // 0xA5 ''
+  {  9552,   3,  48,  13,    5,  -36 },   // 0xA6 ''
+  {  9562,  24,  48,  28,    2,  -36 },   // 0xA7 ''
+  {  9646,  15,   5,  17,    1,  -35 },   // 0xA8 ''
+  {  9652,  37,  38,  41,    2,  -36 },   // 0xA9 ''
+  {  9770,  15,  23,  19,    2,  -37 },   // 0xAA ''
+  {  9806,  18,  17,  25,    4,  -21 },   // 0xAB ''
+  {  9840,  26,  15,  30,    2,  -18 },   // 0xAC ''
+  {  9869,  13,   4,  17,    2,  -15 },   // 0xAD ''
+  {  9873,  37,  38,  41,    2,  -36 },   // 0xAE ''
+  {  9991,  14,   4,  17,    1,  -35 },   // 0xAF ''
+  {  9995,  15,  16,  31,    8,  -34 },   // 0xB0 ''
+  { 10016,  24,  32,  30,    3,  -30 },   // 0xB1 ''
+  { 10075,  16,  22,  18,    1,  -41 },   // 0xB2 ''
+  { 10102,  15,  23,  18,    1,  -41 },   // 0xB3 ''
+  { 10130,  10,   8,  17,    5,  -37 },   // 0xB4 ''
+  { 10139,  25,  38,  28,    3,  -26 },   // 0xB5 ''
+  { 10215,  25,  46,  27,    2,  -36 },   // 0xB6 ''
+  { 10308,   6,   5,  13,    4,  -16 },   // 0xB7 ''
+  { 10310,  13,  11,  17,    2,    1 },   // 0xB8 ''
+  { 10323,   9,  21,  18,    3,  -40 },   // 0xB9 ''
+  { 10343,  14,  23,  19,    2,  -37 },   // 0xBA ''
+  { 10370,  18,  17,  25,    4,  -21 },   // 0xBB ''
+  { 10404,  40,  39,  44,    3,  -37 },   // 0xBC ''
+  { 10534,  40,  38,  44,    3,  -36 },   // 0xBD ''
+  { 10653,  42,  39,  45,    1,  -37 },   // 0xBE ''
+  { 10785,  22,  38,  28,    5,  -26 },   // 0xBF ''
+  { 10850,  32,  45,  34,    1,  -44 },   // 0xC0 ''
+  { 10957,  32,  46,  34,    1,  -45 },   // 0xC1 ''
+  { 11068,  32,  46,  34,    1,  -45 },   // 0xC2 ''
+  { 11179,  32,  45,  34,    1,  -44 },   // 0xC3 ''
+  { 11290,  32,  45,  34,    1,  -44 },   // 0xC4 ''
+  { 11402,  32,  49,  34,    1,  -48 },   // 0xC5 ''
+  { 11522,  48,  37,  50,    1,  -36 },   // 0xC6 ''
+  { 11644,  32,  49,  36,    2,  -37 },   // 0xC7 ''
+  { 11757,  27,  45,  32,    4,  -44 },   // 0xC8 ''
+  { 11846,  27,  46,  32,    4,  -45 },   // 0xC9 ''
+  { 11937,  27,  46,  32,    4,  -45 },   // 0xCA ''
+  { 12028,  27,  45,  32,    4,  -44 },   // 0xCB ''
+  { 12117,  12,  45,  14,    0,  -44 },   // 0xCC ''
+  { 12162,  12,  46,  14,    2,  -45 },   // 0xCD ''
+  { 12209,  15,  46,  15,    0,  -45 },   // 0xCE ''
+  { 12258,  15,  45,  15,    0,  -44 },   // 0xCF ''
+  { 12305,  33,  37,  36,    1,  -36 },   // 0xD0 ''
+  { 12402,  29,  44,  37,    4,  -43 },   // 0xD1 ''
+  { 12486,  36,  47,  40,    2,  -45 },   // 0xD2 ''
+  { 12605,  36,  47,  40,    2,  -45 },   // 0xD3 ''
+  { 12722,  36,  47,  40,    2,  -45 },   // 0xD4 ''
+  { 12838,  36,  46,  40,    2,  -44 },   // 0xD5 ''
+  { 12954,  36,  46,  40,    2,  -44 },   // 0xD6 ''
+  { 13071,  20,  20,  30,    5,  -21 },   // 0xD7 ''
+  { 13106,  36,  40,  40,    2,  -38 },   // 0xD8 ''
+  { 13217,  29,  46,  37,    4,  -44 },   // 0xD9 ''
+  { 13312,  29,  47,  37,    4,  -45 },   // 0xDA ''
+  { 13409,  29,  47,  37,    4,  -45 },   // 0xDB ''
+  { 13509,  29,  46,  37,    4,  -44 },   // 0xDC ''
+  { 13605,  33,  46,  35,    1,  -45 },   // 0xDD ''
+  { 13709,  27,  37,  33,    4,  -36 },   // 0xDE ''
+  { 13787,  24,  38,  30,    4,  -36 },   // 0xDF ''
+  { 13853,  25,  39,  28,    2,  -37 },   // 0xE0 ''
+  { 13927,  25,  39,  28,    2,  -37 },   // 0xE1 ''
+  { 14001,  25,  39,  28,    2,  -37 },   // 0xE2 ''
+  { 14076,  25,  38,  28,    2,  -36 },   // 0xE3 ''
+  { 14147,  25,  38,  28,    2,  -36 },   // 0xE4 ''
+  { 14219,  25,  41,  28,    2,  -39 },   // 0xE5 ''
+  { 14296,  41,  29,  44,    2,  -27 },   // 0xE6 ''
+  { 14382,  22,  39,  26,    2,  -27 },   // 0xE7 ''
+  { 14449,  24,  39,  27,    2,  -37 },   // 0xE8 ''
+  { 14520,  24,  39,  27,    2,  -37 },   // 0xE9 ''
+  { 14591,  24,  39,  27,    2,  -37 },   // 0xEA ''
+  { 14662,  24,  38,  27,    2,  -36 },   // 0xEB ''
+  { 14731,  11,  38,  11,    0,  -37 },   // 0xEC ''
+  { 14769,  10,  38,  11,    1,  -37 },   // 0xED ''
+  { 14807,  15,  38,  13,   -1,  -37 },   // 0xEE ''
+  { 14851,  15,  37,  13,   -1,  -36 },   // 0xEF ''
+  { 14890,  24,  39,  27,    2,  -37 },   // 0xF0 ''
+  { 14957,  21,  37,  27,    3,  -36 },   // 0xF1 ''
+  { 15005,  24,  39,  27,    2,  -37 },   // 0xF2 ''
+  { 15072,  24,  39,  27,    2,  -37 },   // 0xF3 ''
+  { 15139,  24,  38,  27,    2,  -36 },   // 0xF4 ''
+  { 15205,  24,  38,  27,    2,  -36 },   // 0xF5 ''
+  { 15269,  24,  38,  27,    2,  -36 },   // 0xF6 ''
+  { 15334,  24,  24,  30,    3,  -23 },   // 0xF7 ''
+  { 15376,  27,  29,  27,    0,  -27 },   // 0xF8 ''
+  { 15446,  21,  39,  27,    3,  -37 },   // 0xF9 ''
+  { 15499,  21,  39,  27,    3,  -37 },   // 0xFA ''
+  { 15548,  21,  38,  27,    3,  -36 },   // 0xFB ''
+  { 15597,  21,  38,  27,    3,  -36 },   // 0xFC ''
+  { 15648,  24,  49,  24,    0,  -37 },   // 0xFD ''
+  { 15743,  24,  48,  28,    3,  -36 },   // 0xFE ''
+  { 15832,  24,  48,  24,    0,  -36 } }; // 0xFF ''
+
+constexpr GFXfont FreeSans_RLE_26pt8b PROGMEM = {
+  (uint8_t  *)FreeSans_RLE_26pt8bBitmaps,
+  (GFXglyph *)FreeSans_RLE_26pt8bGlyphs,
+  0x20, 0xFF, 61 };
+
+// Approx. 17500 bytes
@@ -0,0 +1,418 @@
+// Run-length encoded glyph bitmaps (fontconvert -r)
+#define FreeSans_RLE_48pt8b_temperature_RLE
+
+const uint8_t FreeSans_RLE_48pt8b_temperatureBitmaps[] PROGMEM = {
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0B,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x10, 0xF0, 0x2A, 0xF0, 0xF0, 0x1F,
+  0x01, 0xF0, 0xBF, 0x05, 0xF0, 0x7F, 0x08, 0xF0, 0x5F, 0x0A, 0xF0, 0x3F,
+  0x0D, 0xFF, 0x0E, 0xEF, 0x2E, 0xDB, 0xAB, 0xBA, 0xDA, 0xB9, 0xFA, 0x99,
+  0xF0, 0x2A, 0x89, 0xF0, 0x39, 0x79, 0xF0, 0x58, 0x79, 0xF0, 0x59, 0x59,
+  0xF0, 0x69, 0x59, 0xF0, 0x78, 0x58, 0xF0, 0x89, 0x48, 0xF0, 0x89, 0x39,
+  0xF0, 0x98, 0x39, 0xF0, 0x98, 0x39, 0xF0, 0x99, 0x28, 0xF0, 0xA9, 0x28,
+  0xF0, 0xA9, 0x28, 0xF0, 0xB8, 0x19, 0xF0, 0xB8, 0x19, 0xF0, 0xB8, 0x19,
+  0xF0, 0xB8, 0x19, 0xF0, 0xB8, 0x19, 0xF0, 0xB8, 0x19, 0xF0, 0xBF, 0x03,
+  0xF0, 0xBF, 0x03, 0xF0, 0xBF, 0x03, 0xF0, 0xBF, 0x03, 0xF0, 0xBF, 0x03,
+  0xF0, 0xBF, 0x03, 0xF0, 0xBF, 0x03, 0xF0, 0xBF, 0x03, 0xF0, 0xBF, 0x03,
+  0xF0, 0xBF, 0x03, 0xF0, 0xB8, 0x19, 0xF0, 0xB8, 0x19, 0xF0, 0xB8, 0x19,
+  0xF0, 0xB8, 0x28, 0xF0, 0xB8, 0x28, 0xF0, 0xB8, 0x28, 0xF0, 0xA9, 0x28,
+  0xF0, 0xA9, 0x29, 0xF0, 0x98, 0x39, 0xF0, 0x98, 0x48, 0xF0, 0x98, 0x48,
+  0xF0, 0x89, 0x49, 0xF0, 0x78, 0x59, 0xF0, 0x78, 0x68, 0xF0, 0x69, 0x69,
+  0xF0, 0x58, 0x88, 0xF0, 0x49, 0x89, 0xF0, 0x39, 0x99, 0xF0, 0x19, 0xAA,
+  0xE9, 0xCA, 0xCA, 0xCC, 0x7C, 0xEF, 0x0E, 0xF0, 0x1F, 0x0D, 0xF0, 0x2F,
+  0x0A, 0xF0, 0x5F, 0x08, 0xF0, 0x8F, 0x05, 0xF0, 0xBF, 0x01, 0xF0, 0xF0,
+  0x1A, 0xF0, 0x20, 0xF0, 0x26, 0xF0, 0x26, 0xF0, 0x17, 0xF0, 0x17, 0xF0,
+  0x17, 0xF8, 0xF8, 0xE9, 0xDA, 0xCB, 0xBC, 0x8F, 0x4F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x07, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9,
+  0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9,
+  0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9,
+  0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9,
+  0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xF0, 0x3B, 0xF0, 0xFF, 0x04,
+  0xF0, 0x9F, 0x08, 0xF0, 0x5F, 0x0B, 0xF0, 0x3F, 0x0E, 0xFF, 0x0F, 0x01,
+  0xDF, 0x0F, 0x03, 0xBF, 0x5F, 0x9C, 0xCD, 0x8B, 0xFB, 0x7A, 0xF0, 0x3B,
+  0x69, 0xF0, 0x5A, 0x5A, 0xF0, 0x6A, 0x49, 0xF0, 0x89, 0x49, 0xF0, 0x89,
+  0x48, 0xF0, 0xA9, 0x29, 0xF0, 0xA9, 0x29, 0xF0, 0xA9, 0x29, 0xF0, 0xA9,
+  0x28, 0xF0, 0xC8, 0x28, 0xF0, 0xC8, 0x28, 0xF0, 0xB9, 0x28, 0xF0, 0xB9,
+  0xF0, 0xF0, 0x69, 0xF0, 0xF0, 0x68, 0xF0, 0xF0, 0x69, 0xF0, 0xF0, 0x69,
+  0xF0, 0xF0, 0x59, 0xF0, 0xF0, 0x5A, 0xF0, 0xF0, 0x4A, 0xF0, 0xF0, 0x4B,
+  0xF0, 0xF0, 0x3B, 0xF0, 0xF0, 0x2C, 0xF0, 0xF0, 0x2C, 0xF0, 0xF0, 0x1D,
+  0xF0, 0xFE, 0xF0, 0xFE, 0xF0, 0xEF, 0xF0, 0xDF, 0xF0, 0xDF, 0x01, 0xF0,
+  0xDF, 0xF0, 0xDF, 0xF0, 0xEE, 0xF0, 0xFD, 0xF0, 0xFD, 0xF0, 0xF0, 0x1D,
+  0xF0, 0xF0, 0x1C, 0xF0, 0xF0, 0x2B, 0xF0, 0xF0, 0x4A, 0xF0, 0xF0, 0x4A,
+  0xF0, 0xF0, 0x4A, 0xF0, 0xF0, 0x59, 0xF0, 0xF0, 0x59, 0xF0, 0xF0, 0x68,
+  0xF0, 0xF0, 0x69, 0xF0, 0xF0, 0x68, 0xF0, 0xF0, 0x78, 0xF0, 0xF0, 0x69,
+  0xF0, 0xF0, 0x69, 0xF0, 0xF0, 0x6F, 0x0F, 0x0E, 0x1F, 0x0F, 0x0E, 0x1F,
+  0x0F, 0x0E, 0x1F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0E, 0xF0, 0x2B, 0xF0, 0xFF, 0x03, 0xF0, 0xAF,
+  0x08, 0xF0, 0x5F, 0x0B, 0xF0, 0x3F, 0x0E, 0xFF, 0x0F, 0x01, 0xDF, 0x0F,
+  0x03, 0xBF, 0x5E, 0xBB, 0xCC, 0x9A, 0xF0, 0x1B, 0x7A, 0xF0, 0x3A, 0x79,
+  0xF0, 0x5A, 0x69, 0xF0, 0x69, 0x59, 0xF0, 0x79, 0x59, 0xF0, 0x88, 0x58,
+  0xF0, 0x98, 0x58, 0xF0, 0x99, 0x48, 0xF0, 0x99, 0x48, 0xF0, 0x99, 0x39,
+  0xF0, 0x99, 0x39, 0xF0, 0x98, 0x49, 0xF0, 0x98, 0xF0, 0xF0, 0x78, 0xF0,
+  0xF0, 0x69, 0xF0, 0xF0, 0x68, 0xF0, 0xF0, 0x69, 0xF0, 0xF0, 0x59, 0xF0,
+  0xF0, 0x4B, 0xF0, 0xFE, 0xF0, 0x9F, 0x05, 0xF0, 0xAF, 0x03, 0xF0, 0xCF,
+  0x02, 0xF0, 0xDF, 0x01, 0xF0, 0xEF, 0x04, 0xF0, 0xBF, 0x05, 0xF0, 0xAF,
+  0x07, 0xF0, 0xF0, 0x2E, 0xF0, 0xF0, 0x4C, 0xF0, 0xF0, 0x5A, 0xF0, 0xF0,
+  0x6A, 0xF0, 0xF0, 0x69, 0xF0, 0xF0, 0x79, 0xF0, 0xF0, 0x69, 0xF0, 0xF0,
+  0x69, 0xF0, 0xF0, 0x78, 0xF0, 0xF0, 0x78, 0xF0, 0xF0, 0x7F, 0x02, 0xF0,
+  0xDF, 0x02, 0xF0, 0xDF, 0x02, 0xF0, 0xD8, 0x19, 0xF0, 0xC8, 0x19, 0xF0,
+  0xC8, 0x28, 0xF0, 0xC8, 0x28, 0xF0, 0xB9, 0x29, 0xF0, 0xA9, 0x29, 0xF0,
+  0x99, 0x49, 0xF0, 0x89, 0x49, 0xF0, 0x7A, 0x59, 0xF0, 0x5A, 0x6B, 0xF0,
+  0x2B, 0x7C, 0xDC, 0x8F, 0x01, 0x4F, 0x01, 0xAF, 0x0F, 0x04, 0xCF, 0x0F,
+  0x02, 0xEF, 0x0F, 0xF0, 0x1F, 0x0D, 0xF0, 0x4F, 0x09, 0xF0, 0x8F, 0x04,
+  0xF0, 0xFC, 0xF0, 0x20, 0xF0, 0xF6, 0xF0, 0xF0, 0x97, 0xF0, 0xF0, 0x88,
+  0xF0, 0xF0, 0x79, 0xF0, 0xF0, 0x79, 0xF0, 0xF0, 0x6A, 0xF0, 0xF0, 0x5B,
+  0xF0, 0xF0, 0x5B, 0xF0, 0xF0, 0x4C, 0xF0, 0xF0, 0x3D, 0xF0, 0xF0, 0x2E,
+  0xF0, 0xF0, 0x2E, 0xF0, 0xF0, 0x1F, 0xF0, 0xFF, 0x01, 0xF0, 0xEF, 0x02,
+  0xF0, 0xE8, 0x18, 0xF0, 0xD8, 0x28, 0xF0, 0xC8, 0x38, 0xF0, 0xC8, 0x38,
+  0xF0, 0xB8, 0x48, 0xF0, 0xA8, 0x58, 0xF0, 0x99, 0x58, 0xF0, 0x98, 0x68,
+  0xF0, 0x88, 0x78, 0xF0, 0x78, 0x88, 0xF0, 0x78, 0x88, 0xF0, 0x68, 0x98,
+  0xF0, 0x58, 0xA8, 0xF0, 0x49, 0xA8, 0xF0, 0x48, 0xB8, 0xF0, 0x38, 0xC8,
+  0xF0, 0x28, 0xD8, 0xF0, 0x28, 0xD8, 0xF0, 0x18, 0xE8, 0xF8, 0xF8, 0xE9,
+  0xF8, 0xE8, 0xF0, 0x18, 0xD8, 0xF0, 0x28, 0xC8, 0xF0, 0x38, 0xC8, 0xF0,
+  0x38, 0xB8, 0xF0, 0x48, 0xA8, 0xF0, 0x58, 0xA8, 0xF0, 0x58, 0xA7, 0xF0,
+  0x68, 0xAF, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x07, 0xF0,
+  0xD8, 0xF0, 0xF0, 0x88, 0xF0, 0xF0, 0x88, 0xF0, 0xF0, 0x88, 0xF0, 0xF0,
+  0x88, 0xF0, 0xF0, 0x88, 0xF0, 0xF0, 0x88, 0xF0, 0xF0, 0x88, 0xF0, 0xF0,
+  0x88, 0xF0, 0xF0, 0x88, 0xF0, 0xF0, 0x88, 0xF0, 0xF0, 0x88, 0xF0, 0xF0,
+  0x88, 0xF0, 0xF0, 0x88, 0xF0, 0xF0, 0x88, 0xF0, 0xF0, 0x88, 0xA0, 0x7F,
+  0x0F, 0x05, 0xAF, 0x0F, 0x05, 0xAF, 0x0F, 0x05, 0xAF, 0x0F, 0x05, 0xAF,
+  0x0F, 0x05, 0xAF, 0x0F, 0x05, 0x9F, 0x0F, 0x06, 0x9F, 0x0F, 0x06, 0x98,
+  0xF0, 0xF0, 0x78, 0xF0, 0xF0, 0x78, 0xF0, 0xF0, 0x78, 0xF0, 0xF0, 0x77,
+  0xF0, 0xF0, 0x78, 0xF0, 0xF0, 0x78, 0xF0, 0xF0, 0x78, 0xF0, 0xF0, 0x78,
+  0xF0, 0xF0, 0x78, 0xF0, 0xF0, 0x78, 0xF0, 0xF0, 0x77, 0xF0, 0xF0, 0x87,
+  0xF0, 0xF0, 0x78, 0xF0, 0xF0, 0x78, 0xF0, 0xF0, 0x78, 0x6C, 0xF0, 0x48,
+  0x3F, 0x03, 0xF0, 0x18, 0x1F, 0x07, 0xE7, 0x1F, 0x09, 0xDF, 0x0F, 0x04,
+  0xAF, 0x0F, 0x06, 0x9F, 0x0F, 0x07, 0x8F, 0x8F, 0x7C, 0xEC, 0x7B, 0xF0,
+  0x2B, 0x6A, 0xF0, 0x4B, 0x59, 0xF0, 0x6A, 0x49, 0xF0, 0x89, 0xF0, 0xF0,
+  0x6A, 0xF0, 0xF0, 0x69, 0xF0, 0xF0, 0x69, 0xF0, 0xF0, 0x79, 0xF0, 0xF0,
+  0x69, 0xF0, 0xF0, 0x69, 0xF0, 0xF0, 0x69, 0xF0, 0xF0, 0x78, 0xF0, 0xF0,
+  0x78, 0xF0, 0xF0, 0x78, 0xF0, 0xF0, 0x78, 0xF0, 0xF0, 0x78, 0xF0, 0xF0,
+  0x78, 0xF0, 0xF0, 0x6F, 0x03, 0xF0, 0xCF, 0x03, 0xF0, 0xC8, 0x28, 0xF0,
+  0xC8, 0x29, 0xF0, 0xA9, 0x29, 0xF0, 0xA9, 0x39, 0xF0, 0x89, 0x49, 0xF0,
+  0x89, 0x4A, 0xF0, 0x69, 0x6A, 0xF0, 0x4A, 0x6B, 0xF0, 0x1B, 0x8C, 0xCC,
+  0xAF, 0x4F, 0x01, 0xAF, 0x0F, 0x04, 0xCF, 0x0F, 0x02, 0xFF, 0x0D, 0xF0,
+  0x3F, 0x0B, 0xF0, 0x6F, 0x07, 0xF0, 0xAF, 0x03, 0xF0, 0xFC, 0xF0, 0x20,
+  0xF0, 0x4A, 0xF0, 0xF0, 0x1F, 0x01, 0xF0, 0xAF, 0x06, 0xF0, 0x7F, 0x08,
+  0xF0, 0x4F, 0x0B, 0xF0, 0x2F, 0x0D, 0xFF, 0x0F, 0xDF, 0x3E, 0xCB, 0xAC,
+  0xAA, 0xEA, 0x9A, 0xF0, 0x1A, 0x89, 0xF0, 0x39, 0x79, 0xF0, 0x59, 0x69,
+  0xF0, 0x59, 0x59, 0xF0, 0x78, 0x58, 0xF0, 0x89, 0x48, 0xF0, 0x89, 0x39,
+  0xF0, 0xF0, 0x58, 0xF0, 0xF0, 0x68, 0xF0, 0xF0, 0x68, 0xF0, 0xF0, 0x59,
+  0xF0, 0xF0, 0x58, 0xF0, 0xF0, 0x68, 0xF0, 0xF0, 0x68, 0xF0, 0xF0, 0x68,
+  0xA9, 0xF0, 0x28, 0x7F, 0x01, 0xC9, 0x5F, 0x05, 0xA9, 0x3F, 0x09, 0x89,
+  0x2F, 0x0B, 0x79, 0x1F, 0x0D, 0x6F, 0x0F, 0x09, 0x5F, 0x06, 0x4F, 0x4F,
+  0x02, 0xCC, 0x3F, 0xFB, 0x3E, 0xF0, 0x2B, 0x2D, 0xF0, 0x4A, 0x2C, 0xF0,
+  0x6A, 0x1B, 0xF0, 0x89, 0x1B, 0xF0, 0x89, 0x1A, 0xF0, 0xAF, 0x04, 0xF0,
+  0xAF, 0x03, 0xF0, 0xBF, 0x03, 0xF0, 0xBF, 0x03, 0xF0, 0xC8, 0x18, 0xF0,
+  0xC8, 0x18, 0xF0, 0xC8, 0x18, 0xF0, 0xC8, 0x18, 0xF0, 0xC8, 0x18, 0xF0,
+  0xC8, 0x18, 0xF0, 0xB9, 0x28, 0xF0, 0xA9, 0x28, 0xF0, 0xA8, 0x38, 0xF0,
+  0x99, 0x48, 0xF0, 0x89, 0x48, 0xF0, 0x7A, 0x49, 0xF0, 0x69, 0x69, 0xF0,
+  0x4A, 0x6A, 0xF0, 0x2A, 0x8A, 0xFB, 0x8C, 0xBC, 0xAF, 0x3F, 0xCF, 0x0F,
+  0x01, 0xEF, 0x0E, 0xF0, 0x1F, 0x0C, 0xF0, 0x3F, 0x0A, 0xF0, 0x6F, 0x06,
+  0xF0, 0xAF, 0x02, 0xF0, 0xFA, 0xF0, 0x20, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0E, 0xF0, 0xF0, 0x78, 0xF0, 0xF0,
+  0x68, 0xF0, 0xF0, 0x77, 0xF0, 0xF0, 0x78, 0xF0, 0xF0, 0x68, 0xF0, 0xF0,
+  0x77, 0xF0, 0xF0, 0x78, 0xF0, 0xF0, 0x68, 0xF0, 0xF0, 0x77, 0xF0, 0xF0,
+  0x78, 0xF0, 0xF0, 0x68, 0xF0, 0xF0, 0x77, 0xF0, 0xF0, 0x78, 0xF0, 0xF0,
+  0x68, 0xF0, 0xF0, 0x77, 0xF0, 0xF0, 0x78, 0xF0, 0xF0, 0x77, 0xF0, 0xF0,
+  0x78, 0xF0, 0xF0, 0x68, 0xF0, 0xF0, 0x78, 0xF0, 0xF0, 0x68, 0xF0, 0xF0,
+  0x77, 0xF0, 0xF0, 0x78, 0xF0, 0xF0, 0x77, 0xF0, 0xF0, 0x78, 0xF0, 0xF0,
+  0x77, 0xF0, 0xF0, 0x78, 0xF0, 0xF0, 0x78, 0xF0, 0xF0, 0x68, 0xF0, 0xF0,
+  0x78, 0xF0, 0xF0, 0x68, 0xF0, 0xF0, 0x78, 0xF0, 0xF0, 0x68, 0xF0, 0xF0,
+  0x78, 0xF0, 0xF0, 0x69, 0xF0, 0xF0, 0x68, 0xF0, 0xF0, 0x78, 0xF0, 0xF0,
+  0x68, 0xF0, 0xF0, 0x78, 0xF0, 0xF0, 0x78, 0xF0, 0xF0, 0x68, 0xF0, 0xF0,
+  0x78, 0xF0, 0xF0, 0x69, 0xF0, 0xF0, 0x68, 0xF0, 0xF0, 0x78, 0xF0, 0xF0,
+  0x78, 0xF0, 0xF0, 0x69, 0xF0, 0xF0, 0x68, 0xF0, 0xF0, 0x78, 0xF0, 0xF0,
+  0x69, 0xF0, 0xF0, 0x69, 0xF0, 0xF0, 0x68, 0xF0, 0xF0, 0x78, 0xF0, 0xF0,
+  0x69, 0xF0, 0xF0, 0x69, 0xF0, 0xF0, 0x68, 0xF0, 0xF0, 0x78, 0xF0, 0xF0,
+  0x69, 0xF0, 0xF0, 0x69, 0xF0, 0xC0, 0xF0, 0x3A, 0xF0, 0xF0, 0x1F, 0x02,
+  0xF0, 0xBF, 0x07, 0xF0, 0x6F, 0x0A, 0xF0, 0x4F, 0x0D, 0xF0, 0x1F, 0x0F,
+  0xEF, 0x0F, 0x02, 0xCF, 0x4F, 0xAC, 0xCB, 0xAA, 0xFB, 0x8A, 0xF0, 0x39,
+  0x89, 0xF0, 0x4A, 0x79, 0xF0, 0x59, 0x69, 0xF0, 0x78, 0x69, 0xF0, 0x79,
+  0x58, 0xF0, 0x89, 0x58, 0xF0, 0x89, 0x58, 0xF0, 0x89, 0x58, 0xF0, 0x89,
+  0x58, 0xF0, 0x89, 0x59, 0xF0, 0x79, 0x59, 0xF0, 0x78, 0x69, 0xF0, 0x69,
+  0x79, 0xF0, 0x59, 0x7A, 0xF0, 0x39, 0x9A, 0xF0, 0x1A, 0xAA, 0xDB, 0xCC,
+  0x8C, 0xEF, 0x0F, 0xF0, 0x1F, 0x0D, 0xF0, 0x3F, 0x0A, 0xF0, 0x7F, 0x07,
+  0xF0, 0x6F, 0x0B, 0xF0, 0x2F, 0x0F, 0xEF, 0x0F, 0x02, 0xCD, 0x8D, 0xAB,
+  0xEB, 0x8A, 0xF0, 0x2B, 0x6A, 0xF0, 0x59, 0x69, 0xF0, 0x79, 0x49, 0xF0,
+  0x8A, 0x39, 0xF0, 0x99, 0x29, 0xF0, 0xB8, 0x29, 0xF0, 0xB9, 0x18, 0xF0,
+  0xC9, 0x18, 0xF0, 0xC9, 0x18, 0xF0, 0xDF, 0x02, 0xF0, 0xDF, 0x02, 0xF0,
+  0xDF, 0x02, 0xF0, 0xD8, 0x18, 0xF0, 0xD8, 0x18, 0xF0, 0xC9, 0x18, 0xF0,
+  0xC9, 0x19, 0xF0, 0xB9, 0x19, 0xF0, 0xA9, 0x39, 0xF0, 0x99, 0x39, 0xF0,
+  0x8A, 0x3A, 0xF0, 0x6A, 0x5A, 0xF0, 0x4B, 0x6B, 0xF0, 0x1B, 0x7D, 0xCC,
+  0x9F, 0x01, 0x4F, 0x01, 0xAF, 0x0F, 0x04, 0xCF, 0x0F, 0x02, 0xEF, 0x0E,
+  0xF0, 0x3F, 0x0B, 0xF0, 0x6F, 0x07, 0xF0, 0xAF, 0x03, 0xF0, 0xF0, 0x1A,
+  0xF0, 0x20, 0xF0, 0x1A, 0xF0, 0xF0, 0x1F, 0x02, 0xF0, 0xAF, 0x06, 0xF0,
+  0x6F, 0x0A, 0xF0, 0x3F, 0x0C, 0xF0, 0x1F, 0x0E, 0xEF, 0x0F, 0x01, 0xCE,
+  0x5E, 0xAC, 0xBB, 0x9B, 0xFA, 0x8A, 0xF0, 0x2A, 0x6A, 0xF0, 0x49, 0x69,
+  0xF0, 0x69, 0x49, 0xF0, 0x79, 0x49, 0xF0, 0x88, 0x39, 0xF0, 0x99, 0x29,
+  0xF0, 0xA8, 0x29, 0xF0, 0xA8, 0x28, 0xF0, 0xB8, 0x28, 0xF0, 0xC8, 0x18,
+  0xF0, 0xC8, 0x18, 0xF0, 0xC8, 0x18, 0xF0, 0xC8, 0x18, 0xF0, 0xC8, 0x18,
+  0xF0, 0xC8, 0x18, 0xF0, 0xC8, 0x18, 0xF0, 0xBF, 0x04, 0xF0, 0xAF, 0x04,
+  0xF0, 0xAF, 0x04, 0xF0, 0x9B, 0x19, 0xF0, 0x8B, 0x1A, 0xF0, 0x6C, 0x29,
+  0xF0, 0x5D, 0x2A, 0xF0, 0x3E, 0x3A, 0xF0, 0x1F, 0x3C, 0xCF, 0x02, 0x4F,
+  0x4F, 0x06, 0x5F, 0x0E, 0x19, 0x6F, 0x0D, 0x19, 0x7F, 0x0A, 0x39, 0x8F,
+  0x08, 0x48, 0xBF, 0x05, 0x58, 0xDF, 0x01, 0x78, 0xF0, 0x1A, 0xA8, 0xF0,
+  0xF0, 0x68, 0xF0, 0xF0, 0x68, 0xF0, 0xF0, 0x59, 0xF0, 0xF0, 0x58, 0xF0,
+  0xF0, 0x68, 0xF0, 0xF0, 0x68, 0xF0, 0xF0, 0x59, 0xF0, 0xF0, 0x58, 0x48,
+  0xF0, 0x98, 0x49, 0xF0, 0x79, 0x49, 0xF0, 0x78, 0x68, 0xF0, 0x69, 0x69,
+  0xF0, 0x49, 0x7A, 0xF0, 0x39, 0x8A, 0xF0, 0x19, 0x9B, 0xDB, 0xAB, 0xBB,
+  0xCD, 0x4E, 0xDF, 0x0F, 0xFF, 0x0D, 0xF0, 0x2F, 0x0B, 0xF0, 0x4F, 0x09,
+  0xF0, 0x7F, 0x05, 0xF0, 0xBF, 0x01, 0xF0, 0xF0, 0x1A, 0xF0, 0x40, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0xA9, 0xF0, 0x2E,
+  0xEF, 0x02, 0xBF, 0x04, 0x9F, 0x06, 0x79, 0x59, 0x58, 0x98, 0x46, 0xD6,
+  0x36, 0xF6, 0x26, 0xF6, 0x25, 0xF0, 0x25, 0x16, 0xF0, 0x25, 0x16, 0xF0,
+  0x2C, 0xF0, 0x2C, 0xF0, 0x2C, 0xF0, 0x2C, 0xF0, 0x25, 0x25, 0xF0, 0x16,
+  0x26, 0xF6, 0x27, 0xD6, 0x47, 0xB7, 0x48, 0x97, 0x6A, 0x3A, 0x7F, 0x06,
+  0x9F, 0x04, 0xBF, 0x02, 0xED, 0xF0, 0x38, 0xB0, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10 };
+
+constexpr GFXglyph FreeSans_RLE_48pt8b_temperatureGlyphs[] PROGMEM = {
+  {     0,   1,   1,  75,    0,    0 },   // 0x20 ' '
+  {     1,   1,   1,  75,    0,    0 },   // 0x21 '!'
+  {     2,   1,   1,  75,    0,    0 },   // 0x22 '"'
+  {     3,   1,   1,  75,    0,    0 },   // 0x23 '#'
+  {     4,   1,   1,  75,    0,    0 },   // 0x24 '$'
+  {     5,   1,   1,  75,    0,    0 },   // 0x25 '%'
+  {     6,   1,   1,  75,    0,    0 },   // 0x26 '&'
+  {     7,   1,   1,  75,    0,    0 },   // 0x27 '''
+  {     8,   1,   1,  75,    0,    0 },   // 0x28 '('
+  {     9,   1,   1,  75,    0,    0 },   // 0x29 ')'
+  {    10,   1,   1,  75,    0,    0 },   // 0x2A '*'
+  {    11,   1,   1,  75,    0,    0 },   // 0x2B '+'
+  {    12,   1,   1,  75,    0,    0 },   // 0x2C ','
+  {    13,  23,   7,  31,    4,  -28 },   // 0x2D '-'
+  {    24,   9,  10,  24,    8,   -9 },   // 0x2E '.'
+  {    30,   1,   1,  75,    0,    0 },   // 0x2F '/'
+  {    31,  44,  69,  52,    4,  -66 },   // 0x30 '0'
+  {   231,  23,  67,  52,   10,  -66 },   // 0x31 '1'
+  {   307,  45,  67,  52,    3,  -66 },   // 0x32 '2'
+  {   497,  45,  69,  52,    3,  -66 },   // 0x33 '3'
+  {   700,  46,  67,  52,    3,  -66 },   // 0x34 '4'
+  {   899,  45,  69,  52,    3,  -66 },   // 0x35 '5'
+  {  1104,  44,  69,  52,    4,  -66 },   // 0x36 '6'
+  {  1303,  45,  67,  52,    4,  -66 },   // 0x37 '7'
+  {  1506,  45,  69,  52,    3,  -66 },   // 0x38 '8'
+  {  1706,  44,  69,  52,    4,  -66 },   // 0x39 '9'
+  {  1907,   1,   1,  75,    0,    0 },   // 0x3A ':'
+  {  1908,   1,   1,  75,    0,    0 },   // 0x3B ';'
+  {  1909,   1,   1,  75,    0,    0 },   // 0x3C '<'
+  {  1910,   1,   1,  75,    0,    0 },   // 0x3D '='
+  {  1911,   1,   1,  75,    0,    0 },   // 0x3E '>'
+  {  1912,   1,   1,  75,    0,    0 },   // 0x3F '?'
+  {  1913,   1,   1,  75,    0,    0 },   // 0x40 '@'
+  {  1914,   1,   1,  75,    0,    0 },   // 0x41 'A'
+  {  1915,   1,   1,  75,    0,    0 },   // 0x42 'B'
+  {  1916,   1,   1,  75,    0,    0 },   // 0x43 'C'
+  {  1917,   1,   1,  75,    0,    0 },   // 0x44 'D'
+  {  1918,   1,   1,  75,    0,    0 },   // 0x45 'E'
+  {  1919,   1,   1,  75,    0,    0 },   // 0x46 'F'
+  {  1920,   1,   1,  75,    0,    0 },   // 0x47 'G'
+  {  1921,   1,   1,  75,    0,    0 },   // 0x48 'H'
+  {  1922,   1,   1,  75,    0,    0 },   // 0x49 'I'
+  {  1923,   1,   1,  75,    0,    0 },   // 0x4A 'J'
+  {  1924,   1,   1,  75,    0,    0 },   // 0x4B 'K'
+  {  1925,   1,   1,  75,    0,    0 },   // 0x4C 'L'
+  {  1926,   1,   1,  75,    0,    0 },   // 0x4D 'M'
+  {  1927,   1,   1,  75,    0,    0 },   // 0x4E 'N'
+  {  1928,   1,   1,  75,    0,    0 },   // 0x4F 'O'
+  {  1929,   1,   1,  75,    0,    0 },   // 0x50 'P'
+  {  1930,   1,   1,  75,    0,    0 },   // 0x51 'Q'
+  {  1931,   1,   1,  75,    0,    0 },   // 0x52 'R'
+  {  1932,   1,   1,  75,    0,    0 },   // 0x53 'S'
+  {  1933,   1,   1,  75,    0,    0 },   // 0x54 'T'
+  {  1934,   1,   1,  75,    0,    0 },   // 0x55 'U'
+  {  1935,   1,   1,  75,    0,    0 },   // 0x56 'V'
+  {  1936,   1,   1,  75,    0,    0 },   // 0x57 'W'
+  {  1937,   1,   1,  75,    0,    0 },   // 0x58 'X'
+  {  1938,   1,   1,  75,    0,    0 },   // 0x59 'Y'
+  {  1939,   1,   1,  75,    0,    0 },   // 0x5A 'Z'
+  {  1940,   1,   1,  75,    0,    0 },   // 0x5B '['
+  {  1941,   1,   1,  75,    0,    0 },   // 0x5C '\'
+  {  1942,   1,   1,  75,    0,    0 },   // 0x5D ']'
+  {  1943,   1,   1,  75,    0,    0 },   // 0x5E '^'
+  {  1944,   1,   1,  75,    0,    0 },   // 0x5F '_'
+  {  1945,   1,   1,  75,    0,    0 },   // 0x60 '`'
+  {  1946,   1,   1,  75,    0,    0 },   // 0x61 'a'
+  {  1947,   1,   1,  75,    0,    0 },   // 0x62 'b'
+  {  1948,   1,   1,  75,    0,    0 },   // 0x63 'c'
+  {  1949,   1,   1,  75,    0,    0 },   // 0x64 'd'
+  {  1950,   1,   1,  75,    0,    0 },   // 0x65 'e'
+  {  1951,   1,   1,  75,    0,    0 },   // 0x66 'f'
+  {  1952,   1,   1,  75,    0,    0 },   // 0x67 'g'
+  {  1953,   1,   1,  75,    0,    0 },   // 0x68 'h'
+  {  1954,   1,   1,  75,    0,    0 },   // 0x69 'i'
+  {  1955,   1,   1,  75,    0,    0 },   // 0x6A 'j'
+  {  1956,   1,   1,  75,    0,    0 },   // 0x6B 'k'
+  {  1957,   1,   1,  75,    0,    0 },   // 0x6C 'l'
+  {  1958,   1,   1,  75,    0,    0 },   // 0x6D 'm'
+  {  1959,   1,   1,  75,    0,    0 },   // 0x6E 'n'
+  {  1960,   1,   1,  75,    0,    0 },   // 0x6F 'o'
+  {  1961,   1,   1,  75,    0,    0 },   // 0x70 'p'
+  {  1962,   1,   1,  75,    0,    0 },   // 0x71 'q'
+  {  1963,   1,   1,  75,    0,    0 },   // 0x72 'r'
+  {  1964,   1,   1,  75,    0,    0 },   // 0x73 's'
+  {  1965,   1,   1,  75,    0,    0 },   // 0x74 't'
+  {  1966,   1,   1,  75,    0,    0 },   // 0x75 'u'
+  {  1967,   1,   1,  75,    0,    0 },   // 0x76 'v'
+  {  1968,   1,   1,  75,    0,    0 },   // 0x77 'w'
+  {  1969,   1,   1,  75,    0,    0 },   // 0x78 'x'
+  {  1970,   1,   1,  75,    0,    0 },   // 0x79 'y'
+  {  1971,   1,   1,  75,    0,    0 },   // 0x7A 'z'
+  {  1972,   1,   1,  75,    0,    0 },   // 0x7B '{'
+  {  1973,   1,   1,  75,    0,    0 },   // 0x7C '|'
+  {  1974,   1,   1,  75,    0,    0 },   // 0x7D '}'
+  {  1975,   1,   1,  75,    0,    0 },   // 0x7E '~'
+  {  1976,   1,   1,  75,    0,    0 },   // 0x7F ''
+  {  1977,   1,   1,  75,    0,    0 },   // 0x80 ''
+  {  1978,   1,   1,  75,    0,    0 },   // 0x81 ''
+  {  1979,   1,   1,  75,    0,    0 },   // 0x82 ''
+  {  1980,   1,   1,  75,    0,    0 },   // 0x83 ''
+  {  1981,   1,   1,  75,    0,    0 },   // 0x84 ''
+  {  1982,   1,   1,  75,    0,    0 },   // 0x85 ''
+  {  1983,   1,   1,  75,    0,    0 },   // 0x86 ''
+  {  1984,   1,   1,  75,    0,    0 },   // 0x87 ''
+  {  1985,   1,   1,  75,    0,    0 },   // 0x88 ''
+  {  1986,   1,   1,  75,    0,    0 },   // 0x89 ''
+  {  1987,   1,   1,  75,    0,    0 },   // 0x8A ''
+  {  1988,   1,   1,  75,    0,    0 },   // 0x8B ''
+  {  1989,   1,   1,  75,    0,    0 },   // 0x8C ''
+  {  1990,   1,   1,  75,    0,    0 },   // 0x8D ''
+  {  1991,   1,   1,  75,    0,    0 },   // 0x8E ''
+  {  1992,   1,   1,  75,    0,    0 },   // 0x8F ''
+  {  1993,   1,   1,  75,    0,    0 },   // 0x90 ''
+  {  1994,   1,   1,  75,    0,    0 },   // 0x91 ''
+  {  1995,   1,   1,  75,    0,    0 },   // 0x92 ''
+  {  1996,   1,   1,  75,    0,    0 },   // 0x93 ''
+  {  1997,   1,   1,  75,    0,    0 },   // 0x94 ''
+  {  1998,   1,   1,  75,    0,    0 },   // 0x95 ''
+  {  1999,   1,   1,  75,    0,    0 },   // 0x96 ''
+  {  2000,   1,   1,  75,    0,    0 },   // 0x97 ''
+  {  2001,   1,   1,  75,    0,    0 },   // 0x98 ''
+  {  2002,   1,   1,  75,    0,    0 },   // 0x99 ''
+  {  2003,   1,   1,  75,    0,    0 },   // 0x9A ''
+  {  2004,   1,   1,  75,    0,    0 },   // 0x9B ''
+  {  2005,   1,   1,  75,    0,    0 },   // 0x9C ''
+  {  2006,   1,   1,  75,    0,    0 },   // 0x9D ''
+  {  2007,   1,   1,  75,    0,    0 },   // 0x9E ''
+  {  2008,   1,   1,  75,    0,    0 },   // 0x9F ''
+  {  2009,   1,   1,  75,    0,    0 },   // 0xA0 ''
+  {  2010,   1,   1,  75,    0,    0 },   // 0xA1 ''
+  {  2011,   1,   1,  75,    0,    0 },   // 0xA2 ''
+  {  2012,   1,   1,  75,    0,    0 },   // 0xA3 ''
+  {  2013,   1,   1,  75,    0,    0 },   // 0xA4 ''
+  {  2014,   1,   1,  75,    0,    0 },   // 0xA5 ''
+  {  2015,   1,   1,  75,    0,    0 },   // 0xA6 ''
+  {  2016,   1,   1,  75,    0,    0 },   // 0xA7 ''
+  {  2017,   1,   1,  75,    0,    0 },   // 0xA8 ''
+  {  2018,   1,   1,  75,    0,    0 },   // 0xA9 ''
+  {  2019,   1,   1,  75,    0,    0 },   // 0xAA ''
+  {  2020,   1,   1,  75,    0,    0 },   // 0xAB ''
+  {  2021,   1,   1,  75,    0,    0 },   // 0xAC ''
+  {  2022,   1,   1,  75,    0,    0 },   // 0xAD ''
+  {  2023,   1,   1,  75,    0,    0 },   // 0xAE ''
+  {  2024,   1,   1,  75,    0,    0 },   // 0xAF ''
+  {  2025,  29,  28,  57,   14,  -63 },   // 0xB0 ''
+  {  2084,   1,   1,  75,    0,    0 },   // 0xB1 ''
+  {  2085,   1,   1,  75,    0,    0 },   // 0xB2 ''
+  {  2086,   1,   1,  75,    0,    0 },   // 0xB3 ''
+  {  2087,   1,   1,  75,    0,    0 },   // 0xB4 ''
+  {  2088,   1,   1,  75,    0,    0 },   // 0xB5 ''
+  {  2089,   1,   1,  75,    0,    0 },   // 0xB6 ''
+  {  2090,   1,   1,  75,    0,    0 },   // 0xB7 ''
+  {  2091,   1,   1,  75,    0,    0 },   // 0xB8 ''
+  {  2092,   1,   1,  75,    0,    0 },   // 0xB9 ''
+  {  2093,   1,   1,  75,    0,    0 },   // 0xBA ''
+  {  2094,   1,   1,  75,    0,    0 },   // 0xBB ''
+  {  2095,   1,   1,  75,    0,    0 },   // 0xBC ''
+  {  2096,   1,   1,  75,    0,    0 },   // 0xBD ''
+  {  2097,   1,   1,  75,    0,    0 },   // 0xBE ''
+  {  2098,   1,   1,  75,    0,    0 },   // 0xBF ''
+  {  2099,   1,   1,  75,    0,    0 },   // 0xC0 ''
+  {  2100,   1,   1,  75,    0,    0 },   // 0xC1 ''
+  {  2101,   1,   1,  75,    0,    0 },   // 0xC2 ''
+  {  2102,   1,   1,  75,    0,    0 },   // 0xC3 ''
+  {  2103,   1,   1,  75,    0,    0 },   // 0xC4 ''
+  {  2104,   1,   1,  75,    0,    0 },   // 0xC5 ''
+  {  2105,   1,   1,  75,    0,    0 },   // 0xC6 ''
+  {  2106,   1,   1,  75,    0,    0 },   // 0xC7 ''
+  {  2107,   1,   1,  75,    0,    0 },   // 0xC8 ''
+  {  2108,   1,   1,  75,    0,    0 },   // 0xC9 ''
+  {  2109,   1,   1,  75,    0,    0 },   // 0xCA ''
+  {  2110,   1,   1,  75,    0,    0 },   // 0xCB ''
+  {  2111,   1,   1,  75,    0,    0 },   // 0xCC ''
+  {  2112,   1,   1,  75,    0,    0 },   // 0xCD ''
+  {  2113,   1,   1,  75,    0,    0 },   // 0xCE ''
+  {  2114,   1,   1,  75,    0,    0 },   // 0xCF ''
+  {  2115,   1,   1,  75,    0,    0 },   // 0xD0 ''
+  {  2116,   1,   1,  75,    0,    0 },   // 0xD1 ''
+  {  2117,   1,   1,  75,    0,    0 },   // 0xD2 ''
+  {  2118,   1,   1,  75,    0,    0 },   // 0xD3 ''
+  {  2119,   1,   1,  75,    0,    0 },   // 0xD4 ''
+  {  2120,   1,   1,  75,    0,    0 },   // 0xD5 ''
+  {  2121,   1,   1,  75,    0,    0 },   // 0xD6 ''
+  {  2122,   1,   1,  75,    0,    0 },   // 0xD7 ''
+  {  2123,   1,   1,  75,    0,    0 },   // 0xD8 ''
+  {  2124,   1,   1,  75,    0,    0 },   // 0xD9 ''
+  {  2125,   1,   1,  75,    0,    0 },   // 0xDA ''
+  {  2126,   1,   1,  75,    0,    0 },   // 0xDB ''
+  {  2127,   1,   1,  75,    0,    0 },   // 0xDC ''
+  {  2128,   1,   1,  75,    0,    0 },   // 0xDD ''
+  {  2129,   1,   1,  75,    0,    0 },   // 0xDE ''
+  {  2130,   1,   1,  75,    0,    0 },   // 0xDF ''
+  {  2131,   1,   1,  75,    0,    0 },   // 0xE0 ''
+  {  2132,   1,   1,  75,    0,    0 },   // 0xE1 ''
+  {  2133,   1,   1,  75,    0,    0 },   // 0xE2 ''
+  {  2134,   1,   1,  75,    0,    0 },   // 0xE3 ''
+  {  2135,   1,   1,  75,    0,    0 },   // 0xE4 ''
+  {  2136,   1,   1,  75,    0,    0 },   // 0xE5 ''
+  {  2137,   1,   1,  75,    0,    0 },   // 0xE6 ''
+  {  2138,   1,   1,  75,    0,    0 },   // 0xE7 ''
+  {  2139,   1,   1,  75,    0,    0 },   // 0xE8 ''
+  {  2140,   1,   1,  75,    0,    0 },   // 0xE9 ''
+  {  2141,   1,   1,  75,    0,    0 },   // 0xEA ''
+  {  2142,   1,   1,  75,    0,    0 },   // 0xEB ''
+  {  2143,   1,   1,  75,    0,    0 },   // 0xEC ''
+  {  2144,   1,   1,  75,    0,    0 },   // 0xED ''
+  {  2145,   1,   1,  75,    0,    0 },   // 0xEE ''
+  {  2146,   1,   1,  75,    0,    0 },   // 0xEF ''
+  {  2147,   1,   1,  75,    0,    0 },   // 0xF0 ''
+  {  2148,   1,   1,  75,    0,    0 },   // 0xF1 ''
+  {  2149,   1,   1,  75,    0,    0 },   // 0xF2 ''
+  {  2150,   1,   1,  75,    0,    0 },   // 0xF3 ''
+  {  2151,   1,   1,  75,    0,    0 },   // 0xF4 ''
+  {  2152,   1,   1,  75,    0,    0 },   // 0xF5 ''
+  {  2153,   1,   1,  75,    0,    0 },   // 0xF6 ''
+  {  2154,   1,   1,  75,    0,    0 },   // 0xF7 ''
+  {  2155,   1,   1,  75,    0,    0 },   // 0xF8 ''
+  {  2156,   1,   1,  75,    0,    0 },   // 0xF9 ''
+  {  2157,   1,   1,  75,    0,    0 },   // 0xFA ''
+  {  2158,   1,   1,  75,    0,    0 },   // 0xFB ''
+  {  2159,   1,   1,  75,    0,    0 },   // 0xFC ''
+  {  2160,   1,   1,  75,    0,    0 },   // 0xFD ''
+  {  2161,   1,   1,  75,    0,    0 },   // 0xFE ''
+  {  2162,   1,   1,  75,    0,    0 } }; // 0xFF ''
+
+constexpr GFXfont FreeSans_RLE_48pt8b_temperature PROGMEM = {
+  (uint8_t  *)FreeSans_RLE_48pt8b_temperatureBitmaps,
+  (GFXglyph *)FreeSans_RLE_48pt8b_temperatureGlyphs,
+  0x20, 0xFF, 113 };
+
+// Approx. 3738 bytes
@@ -0,0 +1,303 @@
+const uint8_t FreeSans_RLE_4pt8bBitmaps[] PROGMEM = {
+  0x00, 0xF4, 0xE0, 0x15, 0xF6, 0xFA, 0x6D, 0x47, 0xD7, 0x00, 0x49, 0x51,
+  0xC1, 0x22, 0xA9, 0x80, 0x62, 0x89, 0xC9, 0x34, 0x80, 0x7E, 0x15, 0x58,
+  0x48, 0x22, 0xF2, 0x80, 0xC0, 0x00, 0x1A, 0xA0, 0x69, 0x99, 0x96, 0x75,
+  0x50, 0x79, 0x12, 0xCF, 0x69, 0x21, 0x96, 0x26, 0x6A, 0xF2, 0x78, 0x61,
+  0x96, 0x69, 0xAD, 0x96, 0xF2, 0x24, 0x44, 0x69, 0x69, 0x96, 0x69, 0x97,
+  0x96, 0x00, 0x00, 0x07, 0x43, 0xFF, 0x86, 0x1E, 0xE4, 0xA0, 0x80, 0x3C,
+  0x86, 0x7D, 0x5A, 0xA8, 0x8F, 0x00, 0x22, 0x94, 0xE8, 0xC4, 0xE9, 0xE9,
+  0x9E, 0x74, 0x61, 0x08, 0xB8, 0xE9, 0x99, 0x9E, 0xF8, 0xE8, 0x8F, 0xF3,
+  0xC9, 0x00, 0x7A, 0x08, 0x27, 0x85, 0xF0, 0x99, 0xF9, 0x99, 0xFC, 0x24,
+  0x9A, 0xC0, 0x9A, 0xCC, 0xA9, 0x92, 0x49, 0xC0, 0x8C, 0x67, 0xDE, 0xD4,
+  0x99, 0xDB, 0xB9, 0x7A, 0x28, 0x61, 0x85, 0xE0, 0xE9, 0x9E, 0x88, 0x7A,
+  0x28, 0x61, 0x85, 0xE0, 0xF9, 0x9E, 0x99, 0x74, 0x50, 0x78, 0xB8, 0xF9,
+  0x08, 0x42, 0x10, 0x99, 0x99, 0x9E, 0x8C, 0x94, 0xA6, 0x10, 0x93, 0x26,
+  0xAB, 0x66, 0x4C, 0x80, 0x8A, 0x88, 0x45, 0x44, 0x8A, 0x94, 0x42, 0x10,
+  0xF8, 0x88, 0x84, 0x7C, 0xEA, 0xAB, 0xAA, 0x40, 0xD5, 0x57, 0x54, 0x00,
+  0x70, 0x80, 0x61, 0x79, 0xF0, 0x8F, 0x99, 0x9F, 0x69, 0x89, 0x60, 0x17,
+  0x99, 0x97, 0x69, 0xF9, 0x60, 0x7A, 0xA0, 0x79, 0x99, 0x79, 0x60, 0x8F,
+  0x99, 0x99, 0x7C, 0x7F, 0x8A, 0xCE, 0xA9, 0xFC, 0xEE, 0x59, 0x65, 0x94,
+  0xF9, 0x99, 0x90, 0x69, 0x99, 0x60, 0xF9, 0x99, 0xF8, 0x80, 0x79, 0x99,
+  0x71, 0x10, 0xEA, 0x80, 0x68, 0x69, 0x60, 0xBA, 0x90, 0x99, 0x99, 0x70,
+  0x9A, 0xA6, 0x40, 0xAA, 0xEB, 0x96, 0x50, 0xA6, 0x46, 0xA0, 0xAA, 0xA6,
+  0x44, 0x80, 0xE2, 0x44, 0xF0, 0x56, 0x94, 0x7C, 0xD5, 0x56, 0x0F, 0xFE,
+  0x1B, 0xF3, 0x96, 0x18, 0x61, 0xFC, 0xFE, 0x1B, 0xF3, 0x96, 0x18, 0x61,
+  0xFC, 0xFE, 0x1B, 0xF3, 0x96, 0x18, 0x61, 0xFC, 0xFE, 0x1B, 0xF3, 0x96,
+  0x18, 0x61, 0xFC, 0xFE, 0x1B, 0xF3, 0x96, 0x18, 0x61, 0xFC, 0xFE, 0x1B,
+  0xF3, 0x96, 0x18, 0x61, 0xFC, 0xFE, 0x1B, 0xF3, 0x96, 0x18, 0x61, 0xFC,
+  0xFE, 0x1B, 0xF3, 0x96, 0x18, 0x61, 0xFC, 0xFE, 0x1B, 0xF3, 0x96, 0x18,
+  0x61, 0xFC, 0xFE, 0x1B, 0xF3, 0x96, 0x18, 0x61, 0xFC, 0xFE, 0x1B, 0xF3,
+  0x96, 0x18, 0x61, 0xFC, 0xFE, 0x1B, 0xF3, 0x96, 0x18, 0x61, 0xFC, 0xFE,
+  0x1B, 0xF3, 0x96, 0x18, 0x61, 0xFC, 0xFE, 0x1B, 0xF3, 0x96, 0x18, 0x61,
+  0xFC, 0xFE, 0x1B, 0xF3, 0x96, 0x18, 0x61, 0xFC, 0xFE, 0x1B, 0xF3, 0x96,
+  0x18, 0x61, 0xFC, 0xFE, 0x1B, 0xF3, 0x96, 0x18, 0x61, 0xFC, 0xFE, 0x1B,
+  0xF3, 0x96, 0x18, 0x61, 0xFC, 0xFE, 0x1B, 0xF3, 0x96, 0x18, 0x61, 0xFC,
+  0xFE, 0x1B, 0xF3, 0x96, 0x18, 0x61, 0xFC, 0xFE, 0x1B, 0xF3, 0x96, 0x18,
+  0x61, 0xFC, 0xFE, 0x1B, 0xF3, 0x96, 0x18, 0x61, 0xFC, 0xFE, 0x1B, 0xF3,
+  0x96, 0x18, 0x61, 0xFC, 0xFE, 0x1B, 0xF3, 0x96, 0x18, 0x61, 0xFC, 0xFE,
+  0x1B, 0xF3, 0x96, 0x18, 0x61, 0xFC, 0xFE, 0x1B, 0xF3, 0x96, 0x18, 0x61,
+  0xFC, 0xFE, 0x1B, 0xF3, 0x96, 0x18, 0x61, 0xFC, 0xFE, 0x1B, 0xF3, 0x96,
+  0x18, 0x61, 0xFC, 0xFE, 0x1B, 0xF3, 0x96, 0x18, 0x61, 0xFC, 0xFE, 0x1B,
+  0xF3, 0x96, 0x18, 0x61, 0xFC, 0xFE, 0x1B, 0xF3, 0x96, 0x18, 0x61, 0xFC,
+  0xFE, 0x1B, 0xF3, 0x96, 0x18, 0x61, 0xFC, 0xFE, 0x1B, 0xF3, 0x96, 0x18,
+  0x61, 0xFC, 0x00, 0xBC, 0x07, 0xDC, 0xD7, 0x00, 0x79, 0x84, 0x4F, 0xF5,
+  0x80, 0x96, 0x62, 0x62, 0x44, 0x65, 0x4B, 0x52, 0xA6, 0x80, 0x3B, 0x1E,
+  0x71, 0xB5, 0xE0, 0xCB, 0x20, 0x3C, 0xF1, 0xC0, 0x3B, 0x1F, 0x6D, 0x85,
+  0xE0, 0xC0, 0xF8, 0x2F, 0x20, 0xF0, 0xEB, 0x00, 0xCB, 0x00, 0x80, 0x99,
+  0x99, 0xF8, 0x80, 0x7D, 0xD5, 0x55, 0x50, 0x00, 0x30, 0xF0, 0xD7, 0x00,
+  0xF0, 0x40, 0x91, 0x41, 0x62, 0xC0, 0x00, 0x40, 0xB1, 0x43, 0x72, 0x41,
+  0x80, 0xC0, 0x92, 0xC3, 0x62, 0xC0, 0x00, 0x49, 0x4B, 0x80, 0x20, 0x08,
+  0xA5, 0x3A, 0x31, 0x00, 0x08, 0xA5, 0x3A, 0x31, 0x20, 0x08, 0xA5, 0x3A,
+  0x31, 0x71, 0x14, 0xA7, 0x46, 0x20, 0x10, 0x08, 0xA5, 0x3A, 0x31, 0x60,
+  0x08, 0xA5, 0x3A, 0x31, 0x3E, 0x61, 0x3A, 0x87, 0x11, 0xC0, 0x74, 0x61,
+  0x08, 0xB8, 0x82, 0x40, 0xF8, 0xE8, 0x8F, 0x40, 0xF8, 0xE8, 0x8F, 0x40,
+  0xF8, 0xE8, 0x8F, 0x20, 0xF8, 0xE8, 0x8F, 0x95, 0x54, 0x55, 0x54, 0xD5,
+  0x54, 0xD5, 0x54, 0x74, 0x7B, 0x18, 0xB8, 0x69, 0x9D, 0xBB, 0x90, 0x00,
+  0x07, 0xA2, 0x86, 0x18, 0x5E, 0x10, 0x07, 0xA2, 0x86, 0x18, 0x5E, 0x30,
+  0x07, 0xA2, 0x86, 0x18, 0x5E, 0x31, 0xE8, 0xA1, 0x86, 0x17, 0x80, 0x30,
+  0x07, 0xA2, 0x86, 0x18, 0x5E, 0xCA, 0x80, 0x7E, 0x29, 0x69, 0x47, 0xE0,
+  0x40, 0x99, 0x99, 0x9E, 0x00, 0x99, 0x99, 0x9E, 0x60, 0x99, 0x99, 0x9E,
+  0x60, 0x99, 0x99, 0x9E, 0x24, 0x54, 0xA2, 0x10, 0x80, 0x8E, 0x99, 0xE8,
+  0xF7, 0xDB, 0xC0, 0x46, 0x17, 0x9F, 0x26, 0x17, 0x9F, 0x66, 0x17, 0x9F,
+  0x66, 0x17, 0x9F, 0x60, 0x61, 0x79, 0xF0, 0x66, 0x61, 0x79, 0xF0, 0x6C,
+  0x25, 0xFC, 0x8E, 0xC0, 0x69, 0x89, 0x64, 0x20, 0x42, 0x69, 0xF9, 0x60,
+  0x20, 0x69, 0xF9, 0x60, 0x66, 0x9F, 0x96, 0x60, 0x69, 0xF9, 0x60, 0xAA,
+  0xA0, 0xAA, 0xA0, 0xCA, 0xA8, 0xCA, 0xA8, 0x06, 0x69, 0x99, 0x60, 0x6F,
+  0x99, 0x99, 0x42, 0x69, 0x99, 0x60, 0x20, 0x69, 0x99, 0x60, 0x66, 0x99,
+  0x96, 0x66, 0x99, 0x96, 0x66, 0x99, 0x96, 0x20, 0xF2, 0x79, 0xFD, 0xE0,
+  0x49, 0x99, 0x97, 0x29, 0x99, 0x97, 0x69, 0x99, 0x97, 0x69, 0x99, 0x97,
+  0x20, 0xAA, 0xA6, 0x44, 0x80, 0x8F, 0x99, 0x9F, 0x88, 0x6A, 0xAA, 0x64,
+  0x48 };
+
+constexpr GFXglyph FreeSans_RLE_4pt8bGlyphs[] PROGMEM = {
+  {     0,   1,   1,   2,    0,    0 },   // 0x20 ' '
+  {     1,   1,   6,   3,    1,   -5 },   // 0x21 '!'
+  {     2,   2,   2,   3,    0,   -5 },   // 0x22 '"'
+  {     3,   4,   6,   4,    0,   -5 },   // 0x23 '#'
+  {     6,   4,   7,   4,    0,   -5 },   // 0x24 '$'
+  {    10,   7,   6,   7,    0,   -5 },   // 0x25 '%'
+  {    16,   5,   6,   5,    0,   -5 },   // 0x26 '&'
+  {    20,   1,   2,   2,    0,   -5 },   // 0x27 '''
+  {    21,   1,   7,   3,    1,   -5 },   // 0x28 '('
+  {    22,   2,   7,   3,    0,   -5 },   // 0x29 ')'
+  {    24,   3,   2,   3,    0,   -5 },   // 0x2A '*'
+  {    25,   4,   4,   5,    0,   -3 },   // 0x2B '+'
+  {    27,   1,   2,   2,    1,    0 },   // 0x2C ','
+  {    28,   2,   1,   3,    0,   -2 },   // 0x2D '-'
+  {    29,   1,   1,   2,    1,    0 },   // 0x2E '.'
+  {    30,   2,   6,   2,    0,   -5 },   // 0x2F '/'
+  {    32,   4,   6,   4,    0,   -5 },   // 0x30 '0'
+  {    35,   2,   6,   4,    1,   -5 },   // 0x31 '1'
+  {    37,   4,   6,   4,    0,   -5 },   // 0x32 '2'
+  {    40,   4,   6,   4,    0,   -5 },   // 0x33 '3'
+  {    43,   4,   6,   4,    0,   -5 },   // 0x34 '4'
+  {    46,   4,   6,   4,    0,   -5 },   // 0x35 '5'
+  {    49,   4,   6,   4,    0,   -5 },   // 0x36 '6'
+  {    52,   4,   6,   4,    0,   -5 },   // 0x37 '7'
+  {    55,   4,   6,   4,    0,   -5 },   // 0x38 '8'
+  {    58,   4,   6,   4,    0,   -5 },   // 0x39 '9'
+  {    61,   1,   5,   2,    1,   -4 },   // 0x3A ':'
+  {    62,   1,   6,   2,    1,   -4 },   // 0x3B ';'
+  {    63,   4,   4,   5,    0,   -3 },   // 0x3C '<'
+  {    65,   4,   2,   5,    0,   -2 },   // 0x3D '='
+  {    66,   4,   4,   5,    0,   -3 },   // 0x3E '>'
+  {    68,   3,   6,   4,    1,   -5 },   // 0x3F '?'
+  {    71,   7,   7,   8,    0,   -5 },   // 0x40 '@'
+  {    78,   5,   6,   5,    0,   -5 },   // 0x41 'A'
+  {    82,   4,   6,   5,    1,   -5 },   // 0x42 'B'
+  {    85,   5,   6,   6,    0,   -5 },   // 0x43 'C'
+  {    89,   4,   6,   5,    1,   -5 },   // 0x44 'D'
+  {    92,   4,   6,   5,    1,   -5 },   // 0x45 'E'
+  {    95,   3,   6,   5,    1,   -5 },   // 0x46 'F'
+  {    98,   6,   6,   6,    0,   -5 },   // 0x47 'G'
+  {   103,   4,   6,   6,    1,   -5 },   // 0x48 'H'
+  {   106,   1,   6,   2,    1,   -5 },   // 0x49 'I'
+  {   107,   3,   6,   4,    0,   -5 },   // 0x4A 'J'
+  {   110,   4,   6,   5,    1,   -5 },   // 0x4B 'K'
+  {   113,   3,   6,   4,    1,   -5 },   // 0x4C 'L'
+  {   116,   5,   6,   7,    1,   -5 },   // 0x4D 'M'
+  {   120,   4,   6,   6,    1,   -5 },   // 0x4E 'N'
+  {   123,   6,   6,   6,    0,   -5 },   // 0x4F 'O'
+  {   128,   4,   6,   5,    1,   -5 },   // 0x50 'P'
+  {   131,   6,   6,   6,    0,   -5 },   // 0x51 'Q'
+  {   136,   4,   6,   6,    1,   -5 },   // 0x52 'R'
+  {   139,   5,   6,   5,    0,   -5 },   // 0x53 'S'
+  {   143,   5,   6,   5,    0,   -5 },   // 0x54 'T'
+  {   147,   4,   6,   6,    1,   -5 },   // 0x55 'U'
+  {   150,   5,   6,   5,    0,   -5 },   // 0x56 'V'
+  {   154,   7,   6,   7,    0,   -5 },   // 0x57 'W'
+  {   160,   5,   6,   5,    0,   -5 },   // 0x58 'X'
+  {   164,   5,   6,   5,    0,   -5 },   // 0x59 'Y'
+  {   168,   5,   6,   5,    0,   -5 },   // 0x5A 'Z'
+  {   172,   2,   8,   2,    0,   -5 },   // 0x5B '['
+  {   174,   2,   6,   2,    0,   -5 },   // 0x5C '\'
+  {   176,   2,   8,   2,    0,   -5 },   // 0x5D ']'
+  {   178,   3,   3,   4,    0,   -5 },   // 0x5E '^'
+  {   180,   5,   1,   4,    0,    2 },   // 0x5F '_'
+  {   181,   2,   1,   2,    0,   -5 },   // 0x60 '`'
+  {   182,   4,   5,   4,    0,   -4 },   // 0x61 'a'
+  {   185,   4,   6,   4,    0,   -5 },   // 0x62 'b'
+  {   188,   4,   5,   4,    0,   -4 },   // 0x63 'c'
+  {   191,   4,   6,   4,    0,   -5 },   // 0x64 'd'
+  {   194,   4,   5,   4,    0,   -4 },   // 0x65 'e'
+  {   197,   2,   6,   2,    0,   -5 },   // 0x66 'f'
+  {   199,   4,   7,   4,    0,   -4 },   // 0x67 'g'
+  {   203,   4,   6,   4,    0,   -5 },   // 0x68 'h'
+  {   206,   1,   6,   2,    0,   -5 },   // 0x69 'i'
+  {   207,   1,   8,   2,    0,   -5 },   // 0x6A 'j'
+  {   208,   4,   6,   4,    0,   -5 },   // 0x6B 'k'
+  {   211,   1,   6,   2,    0,   -5 },   // 0x6C 'l'
+  {   212,   6,   5,   6,    0,   -4 },   // 0x6D 'm'
+  {   216,   4,   5,   4,    0,   -4 },   // 0x6E 'n'
+  {   219,   4,   5,   4,    0,   -4 },   // 0x6F 'o'
+  {   222,   4,   7,   4,    0,   -4 },   // 0x70 'p'
+  {   226,   4,   7,   4,    0,   -4 },   // 0x71 'q'
+  {   230,   2,   5,   3,    0,   -4 },   // 0x72 'r'
+  {   232,   4,   5,   4,    0,   -4 },   // 0x73 's'
+  {   235,   2,   6,   2,    0,   -5 },   // 0x74 't'
+  {   237,   4,   5,   4,    0,   -4 },   // 0x75 'u'
+  {   240,   4,   5,   4,    0,   -4 },   // 0x76 'v'
+  {   243,   6,   5,   6,    0,   -4 },   // 0x77 'w'
+  {   247,   4,   5,   4,    0,   -4 },   // 0x78 'x'
+  {   250,   4,   7,   4,    0,   -4 },   // 0x79 'y'
+  {   254,   4,   5,   4,    0,   -4 },   // 0x7A 'z'
+  {   257,   2,   8,   3,    0,   -5 },   // 0x7B '{'
+  {   259,   1,   7,   2,    0,   -5 },   // 0x7C '|'
+  {   260,   2,   8,   3,    0,   -5 },   // 0x7D '}'
+  {   262,   4,   2,   4,    0,   -3 },   // 0x7E '~'
+  {   263,   6,   9,   6,    0,   -6 },   // 0x7F ''
+  {   270,   6,   9,   6,    0,   -6 },   // 0x80 ''
+  {   277,   6,   9,   6,    0,   -6 },   // 0x81 ''
+  {   284,   6,   9,   6,    0,   -6 },   // 0x82 ''
+  {   291,   6,   9,   6,    0,   -6 },   // 0x83 ''
+  {   298,   6,   9,   6,    0,   -6 },   // 0x84 ''
+  {   305,   6,   9,   6,    0,   -6 },   // 0x85 ''
+  {   312,   6,   9,   6,    0,   -6 },   // 0x86 ''
+  {   319,   6,   9,   6,    0,   -6 },   // 0x87 ''
+  {   326,   6,   9,   6,    0,   -6 },   // 0x88 ''
+  {   333,   6,   9,   6,    0,   -6 },   // 0x89 ''
+  {   340,   6,   9,   6,    0,   -6 },   // 0x8A ''
+  {   347,   6,   9,   6,    0,   -6 },   // 0x8B ''
+  {   354,   6,   9,   6,    0,   -6 },   // 0x8C ''
+  {   361,   6,   9,   6,    0,   -6 },   // 0x8D ''
+  {   368,   6,   9,   6,    0,   -6 },   // 0x8E ''
+  {   375,   6,   9,   6,    0,   -6 },   // 0x8F ''
+  {   382,   6,   9,   6,    0,   -6 },   // 0x90 ''
+  {   389,   6,   9,   6,    0,   -6 },   // 0x91 ''
+  {   396,   6,   9,   6,    0,   -6 },   // 0x92 ''
+  {   403,   6,   9,   6,    0,   -6 },   // 0x93 ''
+  {   410,   6,   9,   6,    0,   -6 },   // 0x94 ''
+  {   417,   6,   9,   6,    0,   -6 },   // 0x95 ''
+  {   424,   6,   9,   6,    0,   -6 },   // 0x96 ''
+  {   431,   6,   9,   6,    0,   -6 },   // 0x97 ''
+  {   438,   6,   9,   6,    0,   -6 },   // 0x98 ''
+  {   445,   6,   9,   6,    0,   -6 },   // 0x99 ''
+  {   452,   6,   9,   6,    0,   -6 },   // 0x9A ''
+  {   459,   6,   9,   6,    0,   -6 },   // 0x9B ''
+  {   466,   6,   9,   6,    0,   -6 },   // 0x9C ''
+  {   473,   6,   9,   6,    0,   -6 },   // 0x9D ''
+  {   480,   6,   9,   6,    0,   -6 },   // 0x9E ''
+  {   487,   6,   9,   6,    0,   -6 },   // 0x9F ''
+  {   494,   1,   1,   2,    0,    0 },   // 0xA0 ''
+  {   495,   1,   6,   3,    1,   -3 },   // 0xA1 ''
+  {   496,   4,   7,   4,    0,   -5 },   // 0xA2 ''
+  {   500,   4,   6,   4,    0,   -5 },   // 0xA3 ''
+  {   503,   3,   3,   4,    1,   -3 },   // 0xA4 ''
+  {   505,   4,   6,   4,    0,   -5 },   // 0xA5 ''
+  {   508,   1,   7,   2,    1,   -5 },   // 0xA6 ''
+  {   509,   4,   8,   4,    0,   -5 },   // 0xA7 ''
+  {   513,   2,   1,   3,    0,   -5 },   // 0xA8 ''
+  {   514,   6,   6,   6,    0,   -5 },   // 0xA9 ''
+  {   519,   3,   4,   3,    0,   -5 },   // 0xAA ''
+  {   521,   2,   3,   4,    1,   -3 },   // 0xAB ''
+  {   522,   4,   2,   5,    0,   -2 },   // 0xAC ''
+  {   523,   2,   1,   3,    0,   -2 },   // 0xAD ''
+  {   524,   6,   6,   6,    0,   -5 },   // 0xAE ''
+  {   529,   2,   1,   3,    0,   -5 },   // 0xAF ''
+  {   530,   3,   2,   5,    1,   -4 },   // 0xB0 ''
+  {   531,   4,   5,   5,    0,   -4 },   // 0xB1 ''
+  {   534,   3,   3,   3,    0,   -5 },   // 0xB2 ''
+  {   536,   3,   3,   3,    0,   -5 },   // 0xB3 ''
+  {   538,   1,   1,   3,    1,   -5 },   // 0xB4 ''
+  {   539,   4,   7,   4,    0,   -4 },   // 0xB5 ''
+  {   543,   4,   7,   4,    0,   -5 },   // 0xB6 ''
+  {   547,   1,   1,   2,    1,   -2 },   // 0xB7 ''
+  {   548,   2,   2,   3,    0,    1 },   // 0xB8 ''
+  {   549,   1,   4,   3,    1,   -6 },   // 0xB9 ''
+  {   550,   3,   4,   3,    0,   -5 },   // 0xBA ''
+  {   552,   2,   2,   4,    1,   -2 },   // 0xBB ''
+  {   553,   7,   6,   7,    0,   -5 },   // 0xBC ''
+  {   559,   7,   6,   7,    0,   -5 },   // 0xBD ''
+  {   565,   7,   6,   7,    0,   -5 },   // 0xBE ''
+  {   571,   3,   6,   4,    1,   -3 },   // 0xBF ''
+  {   574,   5,   8,   5,    0,   -7 },   // 0xC0 ''
+  {   579,   5,   8,   5,    0,   -7 },   // 0xC1 ''
+  {   584,   5,   8,   5,    0,   -7 },   // 0xC2 ''
+  {   589,   5,   7,   5,    0,   -6 },   // 0xC3 ''
+  {   594,   5,   8,   5,    0,   -7 },   // 0xC4 ''
+  {   599,   5,   8,   5,    0,   -7 },   // 0xC5 ''
+  {   604,   7,   6,   8,    0,   -5 },   // 0xC6 ''
+  {   610,   5,   8,   6,    0,   -5 },   // 0xC7 ''
+  {   615,   4,   8,   5,    1,   -7 },   // 0xC8 ''
+  {   619,   4,   8,   5,    1,   -7 },   // 0xC9 ''
+  {   623,   4,   8,   5,    1,   -7 },   // 0xCA ''
+  {   627,   4,   8,   5,    1,   -7 },   // 0xCB ''
+  {   631,   2,   7,   2,    0,   -6 },   // 0xCC ''
+  {   633,   2,   7,   2,    0,   -6 },   // 0xCD ''
+  {   635,   2,   7,   2,    0,   -6 },   // 0xCE ''
+  {   637,   2,   7,   2,    0,   -6 },   // 0xCF ''
+  {   639,   5,   6,   6,    0,   -5 },   // 0xD0 ''
+  {   643,   4,   7,   6,    1,   -6 },   // 0xD1 ''
+  {   647,   6,   8,   6,    0,   -7 },   // 0xD2 ''
+  {   653,   6,   8,   6,    0,   -7 },   // 0xD3 ''
+  {   659,   6,   8,   6,    0,   -7 },   // 0xD4 ''
+  {   665,   6,   7,   6,    0,   -6 },   // 0xD5 ''
+  {   671,   6,   8,   6,    0,   -7 },   // 0xD6 ''
+  {   677,   3,   3,   5,    1,   -2 },   // 0xD7 ''
+  {   679,   6,   6,   6,    0,   -5 },   // 0xD8 ''
+  {   684,   4,   8,   6,    1,   -7 },   // 0xD9 ''
+  {   688,   4,   8,   6,    1,   -7 },   // 0xDA ''
+  {   692,   4,   8,   6,    1,   -7 },   // 0xDB ''
+  {   696,   4,   8,   6,    1,   -7 },   // 0xDC ''
+  {   700,   5,   7,   5,    0,   -6 },   // 0xDD ''
+  {   705,   4,   6,   5,    1,   -5 },   // 0xDE ''
+  {   708,   3,   6,   5,    1,   -5 },   // 0xDF ''
+  {   711,   4,   6,   4,    0,   -5 },   // 0xE0 ''
+  {   714,   4,   6,   4,    0,   -5 },   // 0xE1 ''
+  {   717,   4,   6,   4,    0,   -5 },   // 0xE2 ''
+  {   720,   4,   6,   4,    0,   -5 },   // 0xE3 ''
+  {   723,   4,   7,   4,    0,   -6 },   // 0xE4 ''
+  {   727,   4,   7,   4,    0,   -6 },   // 0xE5 ''
+  {   731,   7,   5,   7,    0,   -4 },   // 0xE6 ''
+  {   736,   4,   7,   4,    0,   -4 },   // 0xE7 ''
+  {   740,   4,   7,   4,    0,   -6 },   // 0xE8 ''
+  {   744,   4,   7,   4,    0,   -6 },   // 0xE9 ''
+  {   748,   4,   6,   4,    0,   -5 },   // 0xEA ''
+  {   751,   4,   7,   4,    0,   -6 },   // 0xEB ''
+  {   755,   2,   6,   2,    0,   -5 },   // 0xEC ''
+  {   757,   2,   6,   2,    0,   -5 },   // 0xED ''
+  {   759,   2,   7,   2,    0,   -6 },   // 0xEE ''
+  {   761,   2,   7,   2,    0,   -6 },   // 0xEF ''
+  {   763,   4,   7,   4,    0,   -6 },   // 0xF0 ''
+  {   767,   4,   6,   4,    0,   -5 },   // 0xF1 ''
+  {   770,   4,   7,   4,    0,   -6 },   // 0xF2 ''
+  {   774,   4,   7,   4,    0,   -6 },   // 0xF3 ''
+  {   778,   4,   6,   4,    0,   -5 },   // 0xF4 ''
+  {   781,   4,   6,   4,    0,   -5 },   // 0xF5 ''
+  {   784,   4,   6,   4,    0,   -5 },   // 0xF6 ''
+  {   787,   4,   4,   5,    0,   -3 },   // 0xF7 ''
+  {   789,   4,   5,   4,    0,   -4 },   // 0xF8 ''
+  {   792,   4,   6,   4,    0,   -5 },   // 0xF9 ''
+  {   795,   4,   6,   4,    0,   -5 },   // 0xFA ''
+  {   798,   4,   6,   4,    0,   -5 },   // 0xFB ''
+  {   801,   4,   6,   4,    0,   -5 },   // 0xFC ''
+  {   804,   4,   9,   4,    0,   -6 },   // 0xFD ''
+  {   809,   4,   8,   4,    0,   -5 },   // 0xFE ''
+  {   813,   4,   8,   4,    0,   -5 } }; // 0xFF ''
+
+constexpr GFXfont FreeSans_RLE_4pt8b PROGMEM = {
+  (uint8_t  *)FreeSans_RLE_4pt8bBitmaps,
+  (GFXglyph *)FreeSans_RLE_4pt8bGlyphs,
+  0x20, 0xFF, 9 };
+
+// Approx. 2392 bytes
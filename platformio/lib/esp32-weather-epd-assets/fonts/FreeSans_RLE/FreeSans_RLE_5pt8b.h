@@ -0,0 +1,331 @@
+const uint8_t FreeSans_RLE_5pt8bBitmaps[] PROGMEM = {
+  0x00, 0xFD, 0xB4, 0x29, 0xBE, 0xAF, 0xA9, 0x40, 0x23, 0xAB, 0x47, 0x16,
+  0xAE, 0x20, 0x64, 0x94, 0x68, 0x08, 0x13, 0x15, 0x23, 0x31, 0x23, 0x18,
+  0x9A, 0x27, 0x40, 0xC0, 0x6A, 0xAA, 0x80, 0x89, 0x24, 0x92, 0x80, 0x4C,
+  0x80, 0x01, 0x3E, 0x42, 0x00, 0xC0, 0xE0, 0x80, 0x29, 0x29, 0x24, 0x72,
+  0x63, 0x18, 0xA5, 0xC0, 0x75, 0x54, 0x72, 0x42, 0x26, 0x23, 0xE0, 0x74,
+  0x42, 0x60, 0xC5, 0xC0, 0x11, 0x94, 0xAF, 0x88, 0x40, 0x7A, 0x1C, 0x10,
+  0xC5, 0xC0, 0x32, 0x61, 0x6C, 0xC5, 0xC0, 0xF8, 0x44, 0x42, 0x11, 0x00,
+  0x72, 0x52, 0xE8, 0xC5, 0xC0, 0x74, 0x62, 0x97, 0x85, 0xC0, 0x84, 0x86,
+  0x01, 0xF0, 0x41, 0x80, 0xF8, 0x3E, 0x83, 0x06, 0x6C, 0x00, 0xE9, 0x92,
+  0x24, 0x04, 0x1E, 0x10, 0x93, 0x32, 0x59, 0x2D, 0x25, 0x6C, 0x80, 0x20,
+  0x0F, 0x00, 0x10, 0xC2, 0x8A, 0x49, 0xF4, 0x61, 0xF4, 0x63, 0xE8, 0xC6,
+  0x3E, 0x38, 0x89, 0x04, 0x08, 0x08, 0x91, 0x1C, 0xF4, 0x63, 0x18, 0xC6,
+  0x3E, 0xFC, 0x21, 0xF8, 0x42, 0x1F, 0xFC, 0x21, 0xE8, 0x42, 0x10, 0x3C,
+  0x89, 0x0C, 0x08, 0xF0, 0x50, 0x9F, 0x8C, 0x63, 0xF8, 0xC6, 0x31, 0xFF,
+  0x11, 0x11, 0x19, 0x97, 0x8C, 0xA9, 0xCA, 0x4A, 0x71, 0x88, 0x88, 0x88,
+  0x8F, 0x87, 0x8F, 0x2E, 0x5C, 0xB6, 0x6C, 0xC9, 0x8E, 0x73, 0x5A, 0xCE,
+  0x71, 0x3C, 0x85, 0x0C, 0x18, 0x28, 0x50, 0x9E, 0xF4, 0x63, 0x1F, 0x42,
+  0x10, 0x3C, 0x8D, 0x0C, 0x18, 0x28, 0x51, 0x9F, 0xFA, 0x28, 0xA2, 0xF2,
+  0x28, 0xA2, 0x79, 0x14, 0x1C, 0x0E, 0x14, 0x5E, 0xFC, 0x41, 0x04, 0x10,
+  0x41, 0x04, 0x8C, 0x63, 0x18, 0xC6, 0x2E, 0x85, 0x14, 0x92, 0x28, 0xC3,
+  0x04, 0x88, 0xC4, 0x55, 0x4A, 0xA5, 0x52, 0xA8, 0x8C, 0x44, 0x45, 0x22,
+  0x8C, 0x30, 0xA4, 0xB1, 0xC5, 0x12, 0x8A, 0x10, 0x41, 0x04, 0x7C, 0x21,
+  0x84, 0x21, 0x84, 0x3F, 0xFF, 0xC0, 0x92, 0x44, 0x91, 0xD5, 0x55, 0x70,
+  0x26, 0x51, 0xFC, 0x40, 0x70, 0x47, 0xD8, 0xBC, 0x88, 0xE9, 0x99, 0x9E,
+  0x74, 0x61, 0x08, 0xB8, 0x08, 0x5F, 0x18, 0xC6, 0x2F, 0x74, 0x7F, 0x08,
+  0xB8, 0x6B, 0xA4, 0x92, 0x7C, 0x63, 0x18, 0xBE, 0x2E, 0x88, 0xE9, 0x99,
+  0x99, 0xBF, 0x45, 0x55, 0x70, 0x88, 0xAC, 0xCA, 0xA9, 0xFF, 0xEE, 0x5A,
+  0x69, 0xA6, 0x90, 0xE9, 0x99, 0x99, 0x74, 0x63, 0x18, 0xB8, 0xE9, 0x99,
+  0x9E, 0x80, 0x7C, 0x63, 0x18, 0xBC, 0x21, 0xEA, 0xA0, 0x79, 0x43, 0x97,
+  0x5D, 0x24, 0x98, 0x99, 0x99, 0x9F, 0x8C, 0x94, 0xA6, 0x10, 0x93, 0x65,
+  0xB3, 0x66, 0xCD, 0x80, 0x92, 0x88, 0x45, 0x48, 0x94, 0x94, 0xC6, 0x11,
+  0x18, 0xF1, 0x24, 0x4F, 0x69, 0x25, 0x12, 0x4C, 0xFF, 0x80, 0xAA, 0x9A,
+  0xA0, 0x45, 0x44, 0xFF, 0x36, 0x9C, 0x38, 0xB2, 0x60, 0xC9, 0x83, 0xFC,
+  0xFF, 0x36, 0x9C, 0x38, 0xB2, 0x60, 0xC9, 0x83, 0xFC, 0xFF, 0x36, 0x9C,
+  0x38, 0xB2, 0x60, 0xC9, 0x83, 0xFC, 0xFF, 0x36, 0x9C, 0x38, 0xB2, 0x60,
+  0xC9, 0x83, 0xFC, 0xFF, 0x36, 0x9C, 0x38, 0xB2, 0x60, 0xC9, 0x83, 0xFC,
+  0xFF, 0x36, 0x9C, 0x38, 0xB2, 0x60, 0xC9, 0x83, 0xFC, 0xFF, 0x36, 0x9C,
+  0x38, 0xB2, 0x60, 0xC9, 0x83, 0xFC, 0xFF, 0x36, 0x9C, 0x38, 0xB2, 0x60,
+  0xC9, 0x83, 0xFC, 0xFF, 0x36, 0x9C, 0x38, 0xB2, 0x60, 0xC9, 0x83, 0xFC,
+  0xFF, 0x36, 0x9C, 0x38, 0xB2, 0x60, 0xC9, 0x83, 0xFC, 0xFF, 0x36, 0x9C,
+  0x38, 0xB2, 0x60, 0xC9, 0x83, 0xFC, 0xFF, 0x36, 0x9C, 0x38, 0xB2, 0x60,
+  0xC9, 0x83, 0xFC, 0xFF, 0x36, 0x9C, 0x38, 0xB2, 0x60, 0xC9, 0x83, 0xFC,
+  0xFF, 0x36, 0x9C, 0x38, 0xB2, 0x60, 0xC9, 0x83, 0xFC, 0xFF, 0x36, 0x9C,
+  0x38, 0xB2, 0x60, 0xC9, 0x83, 0xFC, 0xFF, 0x36, 0x9C, 0x38, 0xB2, 0x60,
+  0xC9, 0x83, 0xFC, 0xFF, 0x36, 0x9C, 0x38, 0xB2, 0x60, 0xC9, 0x83, 0xFC,
+  0xFF, 0x36, 0x9C, 0x38, 0xB2, 0x60, 0xC9, 0x83, 0xFC, 0xFF, 0x36, 0x9C,
+  0x38, 0xB2, 0x60, 0xC9, 0x83, 0xFC, 0xFF, 0x36, 0x9C, 0x38, 0xB2, 0x60,
+  0xC9, 0x83, 0xFC, 0xFF, 0x36, 0x9C, 0x38, 0xB2, 0x60, 0xC9, 0x83, 0xFC,
+  0xFF, 0x36, 0x9C, 0x38, 0xB2, 0x60, 0xC9, 0x83, 0xFC, 0xFF, 0x36, 0x9C,
+  0x38, 0xB2, 0x60, 0xC9, 0x83, 0xFC, 0xFF, 0x36, 0x9C, 0x38, 0xB2, 0x60,
+  0xC9, 0x83, 0xFC, 0xFF, 0x36, 0x9C, 0x38, 0xB2, 0x60, 0xC9, 0x83, 0xFC,
+  0xFF, 0x36, 0x9C, 0x38, 0xB2, 0x60, 0xC9, 0x83, 0xFC, 0xFF, 0x36, 0x9C,
+  0x38, 0xB2, 0x60, 0xC9, 0x83, 0xFC, 0xFF, 0x36, 0x9C, 0x38, 0xB2, 0x60,
+  0xC9, 0x83, 0xFC, 0xFF, 0x36, 0x9C, 0x38, 0xB2, 0x60, 0xC9, 0x83, 0xFC,
+  0xFF, 0x36, 0x9C, 0x38, 0xB2, 0x60, 0xC9, 0x83, 0xFC, 0xFF, 0x36, 0x9C,
+  0x38, 0xB2, 0x60, 0xC9, 0x83, 0xFC, 0xFF, 0x36, 0x9C, 0x38, 0xB2, 0x60,
+  0xC9, 0x83, 0xFC, 0xFF, 0x36, 0x9C, 0x38, 0xB2, 0x60, 0xC9, 0x83, 0xFC,
+  0x00, 0xBE, 0x03, 0x9B, 0x4A, 0x35, 0xC0, 0x72, 0x62, 0x8F, 0x21, 0x93,
+  0xFA, 0xAF, 0x8A, 0x94, 0x43, 0x3C, 0x80, 0xF7, 0x80, 0x32, 0x59, 0x68,
+  0xA4, 0xA2, 0x53, 0x80, 0xA0, 0x3C, 0xB6, 0x9D, 0x1A, 0x6B, 0x4F, 0x00,
+  0x1F, 0xF4, 0xBA, 0x80, 0xF8, 0x42, 0xE0, 0x3C, 0xF6, 0x9D, 0xDA, 0xAC,
+  0xCF, 0x00, 0xE0, 0x1D, 0x80, 0x21, 0x3E, 0x40, 0x7C, 0x65, 0x70, 0x75,
+  0xD4, 0x80, 0x99, 0x99, 0x9F, 0x80, 0x7B, 0x7A, 0xD2, 0x94, 0xA5, 0x28,
+  0x80, 0x5C, 0x70, 0x1E, 0xB4, 0xB4, 0x00, 0x85, 0x12, 0x44, 0x92, 0x69,
+  0xD0, 0x80, 0x81, 0x12, 0x24, 0x8A, 0x64, 0x51, 0x27, 0x60, 0xA2, 0x64,
+  0xA9, 0x4B, 0x15, 0x27, 0x21, 0x20, 0x24, 0x89, 0xF0, 0x20, 0x41, 0x0C,
+  0x28, 0xA4, 0x9F, 0x46, 0x10, 0x10, 0x01, 0x0C, 0x28, 0xA4, 0x9F, 0x46,
+  0x10, 0x30, 0x01, 0x0C, 0x28, 0xA4, 0x9F, 0x46, 0x10, 0x28, 0x41, 0x0C,
+  0x28, 0xA4, 0x9F, 0x46, 0x10, 0x28, 0x01, 0x0C, 0x28, 0xA4, 0x9F, 0x46,
+  0x10, 0x10, 0xC1, 0x04, 0x30, 0xA2, 0x92, 0x7D, 0x18, 0x40, 0x1F, 0x92,
+  0x09, 0x04, 0xF4, 0x43, 0xE1, 0x11, 0x0F, 0x38, 0x89, 0x04, 0x08, 0x08,
+  0x91, 0x1C, 0x10, 0x60, 0x20, 0x3F, 0x08, 0x7E, 0x10, 0x87, 0xC0, 0x20,
+  0x3F, 0x08, 0x7E, 0x10, 0x87, 0xC0, 0x60, 0x3F, 0x08, 0x7E, 0x10, 0x87,
+  0xC0, 0x50, 0x3F, 0x08, 0x7E, 0x10, 0x87, 0xC0, 0x45, 0x55, 0x50, 0x41,
+  0x24, 0x92, 0x48, 0x41, 0x24, 0x92, 0x48, 0xA9, 0x24, 0x92, 0x40, 0x78,
+  0x89, 0x17, 0x14, 0x28, 0x91, 0x3C, 0x51, 0x23, 0x9C, 0xD6, 0xB3, 0x9C,
+  0x40, 0x10, 0x00, 0xF2, 0x14, 0x30, 0x60, 0xA1, 0x42, 0x78, 0x08, 0x00,
+  0xF2, 0x14, 0x30, 0x60, 0xA1, 0x42, 0x78, 0x18, 0x00, 0xF2, 0x14, 0x30,
+  0x60, 0xA1, 0x42, 0x78, 0x00, 0x30, 0xF2, 0x14, 0x30, 0x60, 0xA1, 0x42,
+  0x78, 0x28, 0x00, 0xF2, 0x14, 0x30, 0x60, 0xA1, 0x42, 0x78, 0x96, 0x68,
+  0x3E, 0x8D, 0x2C, 0x59, 0x2C, 0x50, 0xDE, 0x20, 0x23, 0x18, 0xC6, 0x31,
+  0x8B, 0x80, 0x20, 0x23, 0x18, 0xC6, 0x31, 0x8B, 0x80, 0x20, 0x23, 0x18,
+  0xC6, 0x31, 0x8B, 0x80, 0x50, 0x23, 0x18, 0xC6, 0x31, 0x8B, 0x80, 0x10,
+  0x0C, 0x51, 0x28, 0xA1, 0x04, 0x10, 0x40, 0x87, 0xA3, 0x18, 0xFA, 0x10,
+  0xF9, 0xA9, 0x99, 0xF0, 0x20, 0x1C, 0x11, 0xF6, 0x2F, 0x20, 0x1C, 0x11,
+  0xF6, 0x2F, 0x20, 0x9C, 0x11, 0xF6, 0x2F, 0x73, 0x82, 0x3E, 0xC5, 0xE0,
+  0x50, 0x1C, 0x11, 0xF6, 0x2F, 0x22, 0x88, 0xE0, 0x8F, 0xB1, 0x78, 0x76,
+  0x09, 0x3F, 0xD0, 0x99, 0x66, 0x74, 0x61, 0x08, 0xB9, 0x0C, 0x20, 0x1D,
+  0x1F, 0xC2, 0x2E, 0x20, 0x1D, 0x1F, 0xC2, 0x2E, 0x20, 0x9D, 0x1F, 0xC2,
+  0x2E, 0x50, 0x1D, 0x1F, 0xC2, 0x2E, 0x9A, 0xAA, 0x4A, 0xAA, 0xC1, 0x24,
+  0x92, 0xA1, 0x24, 0x92, 0x53, 0x1D, 0x18, 0xC6, 0x2E, 0xEE, 0x99, 0x99,
+  0x90, 0x20, 0x1D, 0x18, 0xC6, 0x2E, 0x20, 0x1D, 0x18, 0xC6, 0x2E, 0x20,
+  0x1D, 0x18, 0xC6, 0x2E, 0x73, 0xA3, 0x18, 0xC5, 0xC0, 0x50, 0x1D, 0x18,
+  0xC6, 0x2E, 0x20, 0x3E, 0x02, 0x00, 0x7C, 0x6F, 0x5C, 0xF8, 0x40, 0x99,
+  0x99, 0x9F, 0x20, 0x99, 0x99, 0x9F, 0x42, 0x99, 0x99, 0x9F, 0xA0, 0x99,
+  0x99, 0x9F, 0x20, 0x25, 0x25, 0x31, 0x84, 0x46, 0x00, 0x08, 0xE9, 0x99,
+  0x9E, 0x80, 0x50, 0x25, 0x25, 0x31, 0x84, 0x46, 0x00 };
+
+constexpr GFXglyph FreeSans_RLE_5pt8bGlyphs[] PROGMEM = {
+  {     0,   1,   1,   2,    0,    0 },   // 0x20 ' '
+  {     1,   1,   8,   3,    1,   -7 },   // 0x21 '!'
+  {     2,   3,   2,   3,    0,   -6 },   // 0x22 '"'
+  {     3,   5,   7,   5,    0,   -6 },   // 0x23 '#'
+  {     8,   5,   9,   5,    0,   -7 },   // 0x24 '$'
+  {    14,   8,   7,   9,    0,   -6 },   // 0x25 '%'
+  {    21,   6,   7,   7,    0,   -6 },   // 0x26 '&'
+  {    27,   1,   2,   2,    0,   -6 },   // 0x27 '''
+  {    28,   2,   9,   3,    1,   -7 },   // 0x28 '('
+  {    31,   3,   9,   3,    0,   -7 },   // 0x29 ')'
+  {    35,   3,   3,   4,    0,   -7 },   // 0x2A '*'
+  {    37,   5,   5,   6,    0,   -4 },   // 0x2B '+'
+  {    41,   1,   2,   3,    1,    0 },   // 0x2C ','
+  {    42,   3,   1,   3,    0,   -2 },   // 0x2D '-'
+  {    43,   1,   1,   2,    1,    0 },   // 0x2E '.'
+  {    44,   3,   8,   3,    0,   -7 },   // 0x2F '/'
+  {    47,   5,   7,   5,    0,   -6 },   // 0x30 '0'
+  {    52,   2,   7,   5,    1,   -6 },   // 0x31 '1'
+  {    54,   5,   7,   5,    0,   -6 },   // 0x32 '2'
+  {    59,   5,   7,   5,    0,   -6 },   // 0x33 '3'
+  {    64,   5,   7,   5,    0,   -6 },   // 0x34 '4'
+  {    69,   5,   7,   5,    0,   -6 },   // 0x35 '5'
+  {    74,   5,   7,   5,    0,   -6 },   // 0x36 '6'
+  {    79,   5,   7,   5,    0,   -6 },   // 0x37 '7'
+  {    84,   5,   7,   5,    0,   -6 },   // 0x38 '8'
+  {    89,   5,   7,   5,    0,   -6 },   // 0x39 '9'
+  {    94,   1,   6,   2,    1,   -5 },   // 0x3A ':'
+  {    95,   1,   7,   2,    1,   -5 },   // 0x3B ';'
+  {    96,   5,   5,   6,    0,   -4 },   // 0x3C '<'
+  {   100,   5,   3,   6,    0,   -3 },   // 0x3D '='
+  {   102,   5,   5,   6,    0,   -4 },   // 0x3E '>'
+  {   106,   4,   8,   5,    1,   -7 },   // 0x3F '?'
+  {   110,   9,  10,  10,    0,   -7 },   // 0x40 '@'
+  {   122,   6,   8,   7,    0,   -7 },   // 0x41 'A'
+  {   128,   5,   8,   7,    1,   -7 },   // 0x42 'B'
+  {   133,   7,   8,   7,    0,   -7 },   // 0x43 'C'
+  {   140,   5,   8,   7,    1,   -7 },   // 0x44 'D'
+  {   145,   5,   8,   6,    1,   -7 },   // 0x45 'E'
+  {   150,   5,   8,   6,    1,   -7 },   // 0x46 'F'
+  {   155,   7,   8,   8,    0,   -7 },   // 0x47 'G'
+  {   162,   5,   8,   7,    1,   -7 },   // 0x48 'H'
+  {   167,   1,   8,   3,    1,   -7 },   // 0x49 'I'
+  {   168,   4,   8,   5,    0,   -7 },   // 0x4A 'J'
+  {   172,   5,   8,   7,    1,   -7 },   // 0x4B 'K'
+  {   177,   4,   8,   6,    1,   -7 },   // 0x4C 'L'
+  {   181,   7,   8,   8,    1,   -7 },   // 0x4D 'M'
+  {   188,   5,   8,   7,    1,   -7 },   // 0x4E 'N'
+  {   193,   7,   8,   8,    0,   -7 },   // 0x4F 'O'
+  {   200,   5,   8,   6,    1,   -7 },   // 0x50 'P'
+  {   205,   7,   8,   8,    0,   -7 },   // 0x51 'Q'
+  {   212,   6,   8,   7,    1,   -7 },   // 0x52 'R'
+  {   218,   6,   8,   7,    0,   -7 },   // 0x53 'S'
+  {   224,   6,   8,   6,    0,   -7 },   // 0x54 'T'
+  {   230,   5,   8,   7,    1,   -7 },   // 0x55 'U'
+  {   235,   6,   8,   6,    0,   -7 },   // 0x56 'V'
+  {   241,   9,   8,   9,    0,   -7 },   // 0x57 'W'
+  {   250,   6,   8,   6,    0,   -7 },   // 0x58 'X'
+  {   256,   6,   8,   7,    0,   -7 },   // 0x59 'Y'
+  {   262,   6,   8,   6,    0,   -7 },   // 0x5A 'Z'
+  {   268,   1,  10,   3,    1,   -7 },   // 0x5B '['
+  {   270,   3,   8,   3,    0,   -7 },   // 0x5C '\'
+  {   273,   2,  10,   3,    0,   -7 },   // 0x5D ']'
+  {   276,   4,   4,   5,    0,   -6 },   // 0x5E '^'
+  {   278,   6,   1,   5,    0,    2 },   // 0x5F '_'
+  {   279,   2,   1,   2,    0,   -7 },   // 0x60 '`'
+  {   280,   5,   6,   5,    0,   -5 },   // 0x61 'a'
+  {   284,   4,   8,   5,    1,   -7 },   // 0x62 'b'
+  {   288,   5,   6,   5,    0,   -5 },   // 0x63 'c'
+  {   292,   5,   8,   5,    0,   -7 },   // 0x64 'd'
+  {   297,   5,   6,   5,    0,   -5 },   // 0x65 'e'
+  {   301,   3,   8,   3,    0,   -7 },   // 0x66 'f'
+  {   304,   5,   8,   5,    0,   -5 },   // 0x67 'g'
+  {   309,   4,   8,   5,    1,   -7 },   // 0x68 'h'
+  {   313,   1,   8,   2,    1,   -7 },   // 0x69 'i'
+  {   314,   2,  10,   2,    0,   -7 },   // 0x6A 'j'
+  {   317,   4,   8,   5,    1,   -7 },   // 0x6B 'k'
+  {   321,   1,   8,   2,    0,   -7 },   // 0x6C 'l'
+  {   322,   6,   6,   8,    1,   -5 },   // 0x6D 'm'
+  {   327,   4,   6,   5,    1,   -5 },   // 0x6E 'n'
+  {   330,   5,   6,   5,    0,   -5 },   // 0x6F 'o'
+  {   334,   4,   8,   5,    1,   -5 },   // 0x70 'p'
+  {   338,   5,   8,   5,    0,   -5 },   // 0x71 'q'
+  {   343,   2,   6,   3,    1,   -5 },   // 0x72 'r'
+  {   345,   4,   6,   5,    0,   -5 },   // 0x73 's'
+  {   348,   3,   7,   3,    0,   -6 },   // 0x74 't'
+  {   351,   4,   6,   5,    1,   -5 },   // 0x75 'u'
+  {   354,   5,   6,   5,    0,   -5 },   // 0x76 'v'
+  {   358,   7,   6,   7,    0,   -5 },   // 0x77 'w'
+  {   364,   5,   6,   5,    0,   -5 },   // 0x78 'x'
+  {   368,   5,   8,   5,    0,   -5 },   // 0x79 'y'
+  {   373,   4,   6,   5,    0,   -5 },   // 0x7A 'z'
+  {   376,   3,  10,   3,    0,   -7 },   // 0x7B '{'
+  {   380,   1,   9,   2,    1,   -7 },   // 0x7C '|'
+  {   382,   2,  10,   3,    1,   -7 },   // 0x7D '}'
+  {   385,   5,   3,   5,    0,   -4 },   // 0x7E '~'
+  {   387,   7,  10,   8,    0,   -7 },   // 0x7F ''
+  {   396,   7,  10,   8,    0,   -7 },   // 0x80 ''
+  {   405,   7,  10,   8,    0,   -7 },   // 0x81 ''
+  {   414,   7,  10,   8,    0,   -7 },   // 0x82 ''
+  {   423,   7,  10,   8,    0,   -7 },   // 0x83 ''
+  {   432,   7,  10,   8,    0,   -7 },   // 0x84 ''
+  {   441,   7,  10,   8,    0,   -7 },   // 0x85 ''
+  {   450,   7,  10,   8,    0,   -7 },   // 0x86 ''
+  {   459,   7,  10,   8,    0,   -7 },   // 0x87 ''
+  {   468,   7,  10,   8,    0,   -7 },   // 0x88 ''
+  {   477,   7,  10,   8,    0,   -7 },   // 0x89 ''
+  {   486,   7,  10,   8,    0,   -7 },   // 0x8A ''
+  {   495,   7,  10,   8,    0,   -7 },   // 0x8B ''
+  {   504,   7,  10,   8,    0,   -7 },   // 0x8C ''
+  {   513,   7,  10,   8,    0,   -7 },   // 0x8D ''
+  {   522,   7,  10,   8,    0,   -7 },   // 0x8E ''
+  {   531,   7,  10,   8,    0,   -7 },   // 0x8F ''
+  {   540,   7,  10,   8,    0,   -7 },   // 0x90 ''
+  {   549,   7,  10,   8,    0,   -7 },   // 0x91 ''
+  {   558,   7,  10,   8,    0,   -7 },   // 0x92 ''
+  {   567,   7,  10,   8,    0,   -7 },   // 0x93 ''
+  {   576,   7,  10,   8,    0,   -7 },   // 0x94 ''
+  {   585,   7,  10,   8,    0,   -7 },   // 0x95 ''
+  {   594,   7,  10,   8,    0,   -7 },   // 0x96 ''
+  {   603,   7,  10,   8,    0,   -7 },   // 0x97 ''
+  {   612,   7,  10,   8,    0,   -7 },   // 0x98 ''
+  {   621,   7,  10,   8,    0,   -7 },   // 0x99 ''
+  {   630,   7,  10,   8,    0,   -7 },   // 0x9A ''
+  {   639,   7,  10,   8,    0,   -7 },   // 0x9B ''
+  {   648,   7,  10,   8,    0,   -7 },   // 0x9C ''
+  {   657,   7,  10,   8,    0,   -7 },   // 0x9D ''
+  {   666,   7,  10,   8,    0,   -7 },   // 0x9E ''
+  {   675,   7,  10,   8,    0,   -7 },   // 0x9F ''
+  {   684,   1,   1,   3,    0,    0 },   // 0xA0 ''
+  {   685,   1,   7,   3,    1,   -4 },   // 0xA1 ''
+  {   686,   5,   8,   5,    0,   -6 },   // 0xA2 ''
+  {   691,   5,   8,   5,    0,   -7 },   // 0xA3 ''
+  {   696,   4,   4,   5,    1,   -4 },   // 0xA4 ''
+  {   698,   5,   7,   5,    0,   -6 },   // 0xA5 ''
+  {   703,   1,   9,   3,    1,   -7 },   // 0xA6 ''
+  {   705,   5,  10,   5,    0,   -7 },   // 0xA7 ''
+  {   712,   3,   1,   3,    0,   -6 },   // 0xA8 ''
+  {   713,   7,   7,   8,    0,   -6 },   // 0xA9 ''
+  {   720,   3,   5,   4,    0,   -7 },   // 0xAA ''
+  {   722,   3,   3,   5,    1,   -3 },   // 0xAB ''
+  {   724,   5,   3,   6,    0,   -3 },   // 0xAC ''
+  {   726,   3,   1,   3,    0,   -2 },   // 0xAD ''
+  {   727,   7,   7,   8,    0,   -6 },   // 0xAE ''
+  {   734,   3,   1,   3,    0,   -6 },   // 0xAF ''
+  {   735,   3,   3,   6,    1,   -6 },   // 0xB0 ''
+  {   737,   5,   6,   6,    0,   -5 },   // 0xB1 ''
+  {   741,   3,   4,   3,    0,   -7 },   // 0xB2 ''
+  {   743,   3,   5,   3,    0,   -7 },   // 0xB3 ''
+  {   745,   2,   1,   3,    1,   -7 },   // 0xB4 ''
+  {   746,   4,   8,   5,    1,   -5 },   // 0xB5 ''
+  {   750,   5,   9,   5,    0,   -7 },   // 0xB6 ''
+  {   756,   1,   1,   2,    1,   -2 },   // 0xB7 ''
+  {   757,   3,   2,   3,    0,    1 },   // 0xB8 ''
+  {   758,   1,   4,   3,    1,   -8 },   // 0xB9 ''
+  {   759,   3,   5,   4,    0,   -7 },   // 0xBA ''
+  {   761,   3,   3,   5,    1,   -3 },   // 0xBB ''
+  {   763,   7,   7,   9,    1,   -6 },   // 0xBC ''
+  {   770,   7,   8,   9,    1,   -7 },   // 0xBD ''
+  {   777,   8,   8,   9,    0,   -7 },   // 0xBE ''
+  {   785,   4,   7,   5,    1,   -4 },   // 0xBF ''
+  {   789,   6,  10,   7,    0,   -9 },   // 0xC0 ''
+  {   797,   6,  10,   7,    0,   -9 },   // 0xC1 ''
+  {   805,   6,  10,   7,    0,   -9 },   // 0xC2 ''
+  {   813,   6,  10,   7,    0,   -9 },   // 0xC3 ''
+  {   821,   6,  10,   7,    0,   -9 },   // 0xC4 ''
+  {   829,   6,  11,   7,    0,  -10 },   // 0xC5 ''
+  {   838,   9,   8,  10,    0,   -7 },   // 0xC6 ''
+  {   847,   7,  10,   7,    0,   -7 },   // 0xC7 ''
+  {   856,   5,  10,   6,    1,   -9 },   // 0xC8 ''
+  {   863,   5,  10,   6,    1,   -9 },   // 0xC9 ''
+  {   870,   5,  10,   6,    1,   -9 },   // 0xCA ''
+  {   877,   5,  10,   6,    1,   -9 },   // 0xCB ''
+  {   884,   2,  10,   3,    0,   -9 },   // 0xCC ''
+  {   887,   3,  10,   3,    0,   -9 },   // 0xCD ''
+  {   891,   3,  10,   3,    0,   -9 },   // 0xCE ''
+  {   895,   3,   9,   3,    0,   -8 },   // 0xCF ''
+  {   899,   7,   8,   7,    0,   -7 },   // 0xD0 ''
+  {   906,   5,  10,   7,    1,   -9 },   // 0xD1 ''
+  {   913,   7,  10,   8,    0,   -9 },   // 0xD2 ''
+  {   922,   7,  10,   8,    0,   -9 },   // 0xD3 ''
+  {   931,   7,  10,   8,    0,   -9 },   // 0xD4 ''
+  {   940,   7,  10,   8,    0,   -9 },   // 0xD5 ''
+  {   949,   7,  10,   8,    0,   -9 },   // 0xD6 ''
+  {   958,   4,   4,   6,    1,   -3 },   // 0xD7 ''
+  {   960,   7,   8,   8,    0,   -7 },   // 0xD8 ''
+  {   967,   5,  10,   7,    1,   -9 },   // 0xD9 ''
+  {   974,   5,  10,   7,    1,   -9 },   // 0xDA ''
+  {   981,   5,  10,   7,    1,   -9 },   // 0xDB ''
+  {   988,   5,  10,   7,    1,   -9 },   // 0xDC ''
+  {   995,   6,  10,   7,    0,   -9 },   // 0xDD ''
+  {  1003,   5,   8,   6,    1,   -7 },   // 0xDE ''
+  {  1008,   4,   7,   6,    1,   -6 },   // 0xDF ''
+  {  1012,   5,   8,   5,    0,   -7 },   // 0xE0 ''
+  {  1017,   5,   8,   5,    0,   -7 },   // 0xE1 ''
+  {  1022,   5,   8,   5,    0,   -7 },   // 0xE2 ''
+  {  1027,   5,   7,   5,    0,   -6 },   // 0xE3 ''
+  {  1032,   5,   8,   5,    0,   -7 },   // 0xE4 ''
+  {  1037,   5,   9,   5,    0,   -8 },   // 0xE5 ''
+  {  1043,   8,   6,   9,    0,   -5 },   // 0xE6 ''
+  {  1049,   5,   8,   5,    0,   -5 },   // 0xE7 ''
+  {  1054,   5,   8,   5,    0,   -7 },   // 0xE8 ''
+  {  1059,   5,   8,   5,    0,   -7 },   // 0xE9 ''
+  {  1064,   5,   8,   5,    0,   -7 },   // 0xEA ''
+  {  1069,   5,   8,   5,    0,   -7 },   // 0xEB ''
+  {  1074,   2,   8,   2,    0,   -7 },   // 0xEC ''
+  {  1076,   2,   8,   2,    0,   -7 },   // 0xED ''
+  {  1078,   3,   8,   3,    0,   -7 },   // 0xEE ''
+  {  1081,   3,   8,   3,    0,   -7 },   // 0xEF ''
+  {  1084,   5,   8,   5,    0,   -7 },   // 0xF0 ''
+  {  1089,   4,   7,   5,    1,   -6 },   // 0xF1 ''
+  {  1093,   5,   8,   5,    0,   -7 },   // 0xF2 ''
+  {  1098,   5,   8,   5,    0,   -7 },   // 0xF3 ''
+  {  1103,   5,   8,   5,    0,   -7 },   // 0xF4 ''
+  {  1108,   5,   7,   5,    0,   -6 },   // 0xF5 ''
+  {  1113,   5,   8,   5,    0,   -7 },   // 0xF6 ''
+  {  1118,   5,   5,   6,    0,   -4 },   // 0xF7 ''
+  {  1122,   5,   6,   5,    0,   -5 },   // 0xF8 ''
+  {  1126,   4,   8,   5,    1,   -7 },   // 0xF9 ''
+  {  1130,   4,   8,   5,    1,   -7 },   // 0xFA ''
+  {  1134,   4,   8,   5,    1,   -7 },   // 0xFB ''
+  {  1138,   4,   8,   5,    1,   -7 },   // 0xFC ''
+  {  1142,   5,  10,   5,    0,   -7 },   // 0xFD ''
+  {  1149,   4,  10,   5,    1,   -7 },   // 0xFE ''
+  {  1154,   5,  10,   5,    0,   -7 } }; // 0xFF ''
+
+constexpr GFXfont FreeSans_RLE_5pt8b PROGMEM = {
+  (uint8_t  *)FreeSans_RLE_5pt8bBitmaps,
+  (GFXglyph *)FreeSans_RLE_5pt8bGlyphs,
+  0x20, 0xFF, 12 };
+
+// Approx. 2736 bytes
@@ -0,0 +1,373 @@
+const uint8_t FreeSans_RLE_6pt8bBitmaps[] PROGMEM = {
+  0x00, 0xFC, 0x80, 0xEC, 0x00, 0x24, 0xA7, 0xCA, 0x4B, 0xF5, 0x14, 0x39,
+  0x59, 0x54, 0x38, 0x59, 0x55, 0x78, 0x40, 0x01, 0x1C, 0x89, 0x21, 0xD0,
+  0x04, 0x02, 0x60, 0xA4, 0x49, 0x11, 0x80, 0x71, 0x45, 0x1C, 0x62, 0x58,
+  0xA6, 0xF4, 0xC0, 0x5A, 0xAA, 0x94, 0x89, 0x12, 0x49, 0x4A, 0x00, 0x2F,
+  0x60, 0x21, 0x3E, 0x42, 0x00, 0xE0, 0xC0, 0x80, 0x24, 0xA4, 0xA4, 0x80,
+  0x39, 0x24, 0x51, 0xC5, 0x14, 0x52, 0x38, 0x27, 0x92, 0x49, 0x20, 0x39,
+  0x14, 0x41, 0x08, 0xC4, 0x10, 0xFC, 0x79, 0x34, 0x42, 0x18, 0x18, 0x51,
+  0x78, 0x08, 0x62, 0x8A, 0x49, 0x2F, 0xC2, 0x08, 0x7D, 0x04, 0x1E, 0x4C,
+  0x10, 0x51, 0x78, 0x39, 0x14, 0x1E, 0xCD, 0x14, 0x51, 0x38, 0xF8, 0x44,
+  0x22, 0x11, 0x08, 0x40, 0x39, 0x34, 0x53, 0x39, 0x18, 0x51, 0x78, 0x39,
+  0x2C, 0x71, 0x4C, 0xD0, 0x52, 0x78, 0x82, 0x83, 0x80, 0x00, 0xF9, 0x07,
+  0x04, 0xF8, 0x3E, 0x06, 0x0E, 0x36, 0x40, 0x74, 0x62, 0x33, 0x10, 0x80,
+  0x20, 0x0F, 0x06, 0x18, 0x81, 0xA3, 0x54, 0x93, 0x22, 0x64, 0x4A, 0x7E,
+  0x60, 0x06, 0x00, 0x3C, 0x00, 0x18, 0x18, 0x28, 0x24, 0x24, 0x7C, 0x42,
+  0x42, 0x82, 0xFA, 0x18, 0x61, 0xFA, 0x18, 0x61, 0xF8, 0x3C, 0x62, 0x43,
+  0x40, 0xC0, 0x40, 0x41, 0x62, 0x3C, 0xF9, 0x0A, 0x14, 0x18, 0x30, 0x61,
+  0x42, 0xF8, 0xFE, 0x08, 0x20, 0xFE, 0x08, 0x20, 0xFC, 0xFE, 0x08, 0x20,
+  0xFA, 0x08, 0x20, 0x80, 0x3E, 0x63, 0x41, 0x40, 0xC7, 0x41, 0x41, 0x63,
+  0x3F, 0x87, 0x0E, 0x1C, 0x3F, 0xF0, 0xE1, 0xC3, 0x86, 0xFF, 0x80, 0x08,
+  0x42, 0x10, 0x87, 0x29, 0x70, 0x85, 0x12, 0x45, 0x0F, 0x12, 0x22, 0x46,
+  0x84, 0x84, 0x21, 0x08, 0x42, 0x10, 0xF8, 0xC3, 0xC3, 0xC3, 0xA5, 0xA5,
+  0xA5, 0x99, 0x99, 0x99, 0x83, 0x87, 0x8D, 0x19, 0x32, 0x62, 0xC7, 0x86,
+  0x1E, 0x31, 0x90, 0x48, 0x1C, 0x0A, 0x05, 0x04, 0xC6, 0x1E, 0x00, 0xFA,
+  0x18, 0x61, 0xFA, 0x08, 0x20, 0x80, 0x1E, 0x31, 0x90, 0x48, 0x1C, 0x0A,
+  0x05, 0x04, 0xC6, 0x1F, 0x00, 0xFD, 0x0A, 0x14, 0x2F, 0x90, 0xA1, 0x42,
+  0x86, 0x7A, 0x18, 0x70, 0x78, 0x18, 0x61, 0x78, 0xFE, 0x20, 0x40, 0x81,
+  0x02, 0x04, 0x08, 0x10, 0x87, 0x0E, 0x1C, 0x38, 0x70, 0xE1, 0x62, 0x78,
+  0xC2, 0x85, 0x1A, 0x22, 0x44, 0x8A, 0x0C, 0x18, 0xC4, 0x28, 0x89, 0x29,
+  0x25, 0x24, 0xA4, 0x63, 0x8C, 0x61, 0x8C, 0x31, 0x80, 0x42, 0x64, 0x24,
+  0x18, 0x18, 0x38, 0x24, 0x46, 0x42, 0xC2, 0x42, 0x24, 0x34, 0x18, 0x18,
+  0x18, 0x18, 0x18, 0x7E, 0x08, 0x30, 0x41, 0x06, 0x18, 0x20, 0xFE, 0xEA,
+  0xAA, 0xAB, 0x92, 0x24, 0x89, 0x20, 0xD5, 0x55, 0x57, 0x46, 0xA9, 0xFE,
+  0x44, 0x79, 0x20, 0x9E, 0xCA, 0x27, 0x40, 0x84, 0x3D, 0x18, 0xC6, 0x31,
+  0xF0, 0x39, 0x28, 0x20, 0x85, 0x23, 0x80, 0x04, 0x17, 0x53, 0x86, 0x18,
+  0x53, 0x7C, 0x39, 0x38, 0x7F, 0x81, 0x33, 0x80, 0x6B, 0xA4, 0x92, 0x40,
+  0x35, 0x38, 0x61, 0x85, 0x37, 0x51, 0x78, 0x84, 0x3D, 0x38, 0xC6, 0x31,
+  0x88, 0xBF, 0x80, 0x45, 0x55, 0x57, 0x84, 0x25, 0x4C, 0x52, 0xD2, 0x98,
+  0xFF, 0x80, 0xF6, 0x99, 0x91, 0x91, 0x91, 0x91, 0x91, 0xF4, 0xE3, 0x18,
+  0xC6, 0x20, 0x39, 0x38, 0x61, 0x85, 0x37, 0x80, 0xF4, 0x63, 0x18, 0xC7,
+  0xD0, 0x80, 0x3D, 0x38, 0x61, 0x85, 0x37, 0x41, 0x04, 0xF2, 0x49, 0x20,
+  0x7A, 0x50, 0xF0, 0xE5, 0xE0, 0x4B, 0xA4, 0x92, 0x60, 0x8C, 0x63, 0x18,
+  0xCF, 0xA0, 0x8D, 0x24, 0x92, 0x70, 0xC3, 0x00, 0x89, 0xD9, 0x59, 0x56,
+  0x56, 0x26, 0x26, 0x4A, 0x8C, 0x43, 0x2F, 0x20, 0x8A, 0x52, 0xA5, 0x18,
+  0x84, 0x22, 0x00, 0x78, 0x44, 0x46, 0x23, 0xE0, 0x29, 0x25, 0x92, 0x49,
+  0x10, 0xFF, 0xE0, 0xA5, 0x55, 0x5A, 0x45, 0xE6, 0xFF, 0xC0, 0x67, 0x34,
+  0x5A, 0x2C, 0x36, 0x33, 0x11, 0x80, 0xC4, 0x60, 0x3F, 0xF0, 0xFF, 0xC0,
+  0x67, 0x34, 0x5A, 0x2C, 0x36, 0x33, 0x11, 0x80, 0xC4, 0x60, 0x3F, 0xF0,
+  0xFF, 0xC0, 0x67, 0x34, 0x5A, 0x2C, 0x36, 0x33, 0x11, 0x80, 0xC4, 0x60,
+  0x3F, 0xF0, 0xFF, 0xC0, 0x67, 0x34, 0x5A, 0x2C, 0x36, 0x33, 0x11, 0x80,
+  0xC4, 0x60, 0x3F, 0xF0, 0xFF, 0xC0, 0x67, 0x34, 0x5A, 0x2C, 0x36, 0x33,
+  0x11, 0x80, 0xC4, 0x60, 0x3F, 0xF0, 0xFF, 0xC0, 0x67, 0x34, 0x5A, 0x2C,
+  0x36, 0x33, 0x11, 0x80, 0xC4, 0x60, 0x3F, 0xF0, 0xFF, 0xC0, 0x67, 0x34,
+  0x5A, 0x2C, 0x36, 0x33, 0x11, 0x80, 0xC4, 0x60, 0x3F, 0xF0, 0xFF, 0xC0,
+  0x67, 0x34, 0x5A, 0x2C, 0x36, 0x33, 0x11, 0x80, 0xC4, 0x60, 0x3F, 0xF0,
+  0xFF, 0xC0, 0x67, 0x34, 0x5A, 0x2C, 0x36, 0x33, 0x11, 0x80, 0xC4, 0x60,
+  0x3F, 0xF0, 0xFF, 0xC0, 0x67, 0x34, 0x5A, 0x2C, 0x36, 0x33, 0x11, 0x80,
+  0xC4, 0x60, 0x3F, 0xF0, 0xFF, 0xC0, 0x67, 0x34, 0x5A, 0x2C, 0x36, 0x33,
+  0x11, 0x80, 0xC4, 0x60, 0x3F, 0xF0, 0xFF, 0xC0, 0x67, 0x34, 0x5A, 0x2C,
+  0x36, 0x33, 0x11, 0x80, 0xC4, 0x60, 0x3F, 0xF0, 0xFF, 0xC0, 0x67, 0x34,
+  0x5A, 0x2C, 0x36, 0x33, 0x11, 0x80, 0xC4, 0x60, 0x3F, 0xF0, 0xFF, 0xC0,
+  0x67, 0x34, 0x5A, 0x2C, 0x36, 0x33, 0x11, 0x80, 0xC4, 0x60, 0x3F, 0xF0,
+  0xFF, 0xC0, 0x67, 0x34, 0x5A, 0x2C, 0x36, 0x33, 0x11, 0x80, 0xC4, 0x60,
+  0x3F, 0xF0, 0xFF, 0xC0, 0x67, 0x34, 0x5A, 0x2C, 0x36, 0x33, 0x11, 0x80,
+  0xC4, 0x60, 0x3F, 0xF0, 0xFF, 0xC0, 0x67, 0x34, 0x5A, 0x2C, 0x36, 0x33,
+  0x11, 0x80, 0xC4, 0x60, 0x3F, 0xF0, 0xFF, 0xC0, 0x67, 0x34, 0x5A, 0x2C,
+  0x36, 0x33, 0x11, 0x80, 0xC4, 0x60, 0x3F, 0xF0, 0xFF, 0xC0, 0x67, 0x34,
+  0x5A, 0x2C, 0x36, 0x33, 0x11, 0x80, 0xC4, 0x60, 0x3F, 0xF0, 0xFF, 0xC0,
+  0x67, 0x34, 0x5A, 0x2C, 0x36, 0x33, 0x11, 0x80, 0xC4, 0x60, 0x3F, 0xF0,
+  0xFF, 0xC0, 0x67, 0x34, 0x5A, 0x2C, 0x36, 0x33, 0x11, 0x80, 0xC4, 0x60,
+  0x3F, 0xF0, 0xFF, 0xC0, 0x67, 0x34, 0x5A, 0x2C, 0x36, 0x33, 0x11, 0x80,
+  0xC4, 0x60, 0x3F, 0xF0, 0xFF, 0xC0, 0x67, 0x34, 0x5A, 0x2C, 0x36, 0x33,
+  0x11, 0x80, 0xC4, 0x60, 0x3F, 0xF0, 0xFF, 0xC0, 0x67, 0x34, 0x5A, 0x2C,
+  0x36, 0x33, 0x11, 0x80, 0xC4, 0x60, 0x3F, 0xF0, 0xFF, 0xC0, 0x67, 0x34,
+  0x5A, 0x2C, 0x36, 0x33, 0x11, 0x80, 0xC4, 0x60, 0x3F, 0xF0, 0xFF, 0xC0,
+  0x67, 0x34, 0x5A, 0x2C, 0x36, 0x33, 0x11, 0x80, 0xC4, 0x60, 0x3F, 0xF0,
+  0xFF, 0xC0, 0x67, 0x34, 0x5A, 0x2C, 0x36, 0x33, 0x11, 0x80, 0xC4, 0x60,
+  0x3F, 0xF0, 0xFF, 0xC0, 0x67, 0x34, 0x5A, 0x2C, 0x36, 0x33, 0x11, 0x80,
+  0xC4, 0x60, 0x3F, 0xF0, 0xFF, 0xC0, 0x67, 0x34, 0x5A, 0x2C, 0x36, 0x33,
+  0x11, 0x80, 0xC4, 0x60, 0x3F, 0xF0, 0xFF, 0xC0, 0x67, 0x34, 0x5A, 0x2C,
+  0x36, 0x33, 0x11, 0x80, 0xC4, 0x60, 0x3F, 0xF0, 0xFF, 0xC0, 0x67, 0x34,
+  0x5A, 0x2C, 0x36, 0x33, 0x11, 0x80, 0xC4, 0x60, 0x3F, 0xF0, 0xFF, 0xC0,
+  0x67, 0x34, 0x5A, 0x2C, 0x36, 0x33, 0x11, 0x80, 0xC4, 0x60, 0x3F, 0xF0,
+  0xFF, 0xC0, 0x67, 0x34, 0x5A, 0x2C, 0x36, 0x33, 0x11, 0x80, 0xC4, 0x60,
+  0x3F, 0xF0, 0x00, 0xBF, 0x23, 0xAB, 0x4A, 0x56, 0xAE, 0x20, 0x39, 0x14,
+  0x50, 0xF0, 0x82, 0x1C, 0x9C, 0xFC, 0xA5, 0xF0, 0x85, 0x14, 0x8A, 0x7C,
+  0x47, 0xC4, 0x10, 0xFB, 0xE0, 0x39, 0x22, 0x14, 0x8D, 0x16, 0x4E, 0x09,
+  0x24, 0x8C, 0xF0, 0x1E, 0x10, 0x93, 0x52, 0x5A, 0x0D, 0x05, 0x4A, 0x5A,
+  0x1E, 0x00, 0x61, 0xF7, 0x0F, 0x5A, 0xA5, 0xFC, 0x10, 0x40, 0xC0, 0x1E,
+  0x10, 0x97, 0x52, 0x59, 0x4C, 0xE5, 0x4A, 0x42, 0x1E, 0x00, 0xF0, 0xF6,
+  0xA0, 0x21, 0x3E, 0x42, 0x03, 0xE0, 0x69, 0x16, 0x8F, 0x69, 0x21, 0x96,
+  0x50, 0x8C, 0x63, 0x18, 0xCF, 0xB0, 0x80, 0x7F, 0xBD, 0xEF, 0x18, 0xC6,
+  0x31, 0x88, 0x80, 0x0C, 0x75, 0x40, 0x69, 0x96, 0x07, 0xA5, 0x92, 0x42,
+  0x62, 0x11, 0x09, 0x04, 0x90, 0x98, 0x54, 0x4F, 0x41, 0x00, 0x42, 0x62,
+  0x12, 0x09, 0x65, 0x48, 0x84, 0x84, 0x44, 0x47, 0x80, 0x61, 0x24, 0x82,
+  0x20, 0x50, 0x94, 0x9A, 0x61, 0x28, 0x4F, 0x20, 0x80, 0x20, 0x08, 0x44,
+  0x42, 0x3B, 0x20, 0x10, 0x00, 0x18, 0x18, 0x28, 0x24, 0x24, 0x7C, 0x42,
+  0x42, 0x82, 0x08, 0x00, 0x18, 0x18, 0x28, 0x24, 0x24, 0x7C, 0x42, 0x42,
+  0x82, 0x18, 0x00, 0x18, 0x18, 0x28, 0x24, 0x24, 0x7C, 0x42, 0x42, 0x82,
+  0x1C, 0x00, 0x18, 0x18, 0x28, 0x24, 0x24, 0x7C, 0x42, 0x42, 0x82, 0x3C,
+  0x00, 0x18, 0x18, 0x28, 0x24, 0x24, 0x7C, 0x42, 0x42, 0x82, 0x18, 0x28,
+  0x18, 0x18, 0x18, 0x28, 0x24, 0x24, 0x7C, 0x42, 0x42, 0x82, 0x1F, 0xE2,
+  0x40, 0x48, 0x19, 0x02, 0x3E, 0x44, 0x1F, 0x82, 0x10, 0xC3, 0xE0, 0x3C,
+  0x62, 0x43, 0x40, 0xC0, 0x40, 0x41, 0x62, 0x3C, 0x10, 0x18, 0x20, 0x4F,
+  0xE0, 0x82, 0x0F, 0xE0, 0x82, 0x0F, 0xC0, 0x10, 0x8F, 0xE0, 0x82, 0x0F,
+  0xE0, 0x82, 0x0F, 0xC0, 0x30, 0x0F, 0xE0, 0x82, 0x0F, 0xE0, 0x82, 0x0F,
+  0xC0, 0x78, 0x0F, 0xE0, 0x82, 0x0F, 0xE0, 0x82, 0x0F, 0xC0, 0x41, 0x24,
+  0x92, 0x49, 0x00, 0xCA, 0xAA, 0xA8, 0x61, 0x24, 0x92, 0x49, 0x00, 0xA1,
+  0x24, 0x92, 0x49, 0x00, 0x7C, 0x42, 0x43, 0x41, 0xF1, 0x41, 0x43, 0x42,
+  0x7C, 0x08, 0x62, 0x0E, 0x1E, 0x34, 0x64, 0xC9, 0x8B, 0x1E, 0x18, 0x18,
+  0x00, 0x07, 0x8C, 0x64, 0x12, 0x07, 0x02, 0x81, 0x41, 0x31, 0x87, 0x80,
+  0x04, 0x04, 0x07, 0x8C, 0x64, 0x12, 0x07, 0x02, 0x81, 0x41, 0x31, 0x87,
+  0x80, 0x0C, 0x08, 0x07, 0x8C, 0x64, 0x12, 0x07, 0x02, 0x81, 0x41, 0x31,
+  0x87, 0x80, 0x10, 0x06, 0x07, 0x8C, 0x64, 0x12, 0x07, 0x02, 0x81, 0x41,
+  0x31, 0x87, 0x80, 0x14, 0x00, 0x07, 0x8C, 0x64, 0x12, 0x07, 0x02, 0x81,
+  0x41, 0x31, 0x87, 0x80, 0x8A, 0x88, 0xA0, 0x00, 0x1E, 0xB1, 0x90, 0xC8,
+  0x9C, 0x8A, 0x85, 0x84, 0xC6, 0x9E, 0x00, 0x20, 0x22, 0x1C, 0x38, 0x70,
+  0xE1, 0xC3, 0x85, 0x89, 0xE0, 0x10, 0x02, 0x1C, 0x38, 0x70, 0xE1, 0xC3,
+  0x85, 0x89, 0xE0, 0x30, 0x02, 0x1C, 0x38, 0x70, 0xE1, 0xC3, 0x85, 0x89,
+  0xE0, 0x28, 0x02, 0x1C, 0x38, 0x70, 0xE1, 0xC3, 0x85, 0x89, 0xE0, 0x08,
+  0x00, 0xC2, 0x42, 0x24, 0x34, 0x18, 0x18, 0x18, 0x18, 0x18, 0x83, 0xE8,
+  0xE1, 0x86, 0x3F, 0xA0, 0x80, 0x72, 0x28, 0xA2, 0xBA, 0x28, 0xA2, 0xB0,
+  0x20, 0x47, 0x92, 0x09, 0xEC, 0xA2, 0x74, 0x10, 0x87, 0x92, 0x09, 0xEC,
+  0xA2, 0x74, 0x30, 0xA7, 0x92, 0x09, 0xEC, 0xA2, 0x74, 0x38, 0x07, 0x92,
+  0x09, 0xEC, 0xA2, 0x74, 0x28, 0x07, 0x92, 0x09, 0xEC, 0xA2, 0x74, 0x10,
+  0xC1, 0x1E, 0x48, 0x27, 0xB2, 0x89, 0xD0, 0x7B, 0x93, 0x30, 0x85, 0xFF,
+  0xC8, 0x23, 0x37, 0x38, 0x39, 0x28, 0x20, 0x85, 0x27, 0x88, 0x30, 0x20,
+  0x43, 0x93, 0x87, 0xF8, 0x13, 0x38, 0x10, 0x83, 0x93, 0x87, 0xF8, 0x13,
+  0x38, 0x30, 0xA3, 0x93, 0x87, 0xF8, 0x13, 0x38, 0x28, 0x03, 0x93, 0x87,
+  0xF8, 0x13, 0x38, 0xD5, 0x55, 0x40, 0x51, 0x24, 0x92, 0x40, 0x54, 0x24,
+  0x92, 0x48, 0xA1, 0x24, 0x92, 0x40, 0x71, 0x47, 0x93, 0x86, 0x18, 0x53,
+  0x78, 0x70, 0x3D, 0x38, 0xC6, 0x31, 0x88, 0x20, 0x43, 0x93, 0x86, 0x18,
+  0x53, 0x78, 0x10, 0x83, 0x93, 0x86, 0x18, 0x53, 0x78, 0x30, 0x23, 0x93,
+  0x86, 0x18, 0x53, 0x78, 0x38, 0x03, 0x93, 0x86, 0x18, 0x53, 0x78, 0x68,
+  0x03, 0x93, 0x86, 0x18, 0x53, 0x78, 0x20, 0x3E, 0x02, 0x00, 0x7D, 0x39,
+  0x69, 0xA5, 0x3F, 0x80, 0x41, 0x23, 0x18, 0xC6, 0x33, 0xE8, 0x20, 0x23,
+  0x18, 0xC6, 0x33, 0xE8, 0x60, 0xA3, 0x18, 0xC6, 0x33, 0xE8, 0x50, 0x23,
+  0x18, 0xC6, 0x33, 0xE8, 0x11, 0x22, 0x94, 0xA9, 0x46, 0x21, 0x08, 0x80,
+  0x84, 0x3D, 0x18, 0xC6, 0x31, 0xF4, 0x20, 0x78, 0x22, 0x94, 0xA9, 0x46,
+  0x21, 0x08, 0x80 };
+
+constexpr GFXglyph FreeSans_RLE_6pt8bGlyphs[] PROGMEM = {
+  {     0,   1,   1,   3,    0,    0 },   // 0x20 ' '
+  {     1,   1,   9,   4,    1,   -8 },   // 0x21 '!'
+  {     3,   3,   3,   4,    0,   -8 },   // 0x22 '"'
+  {     5,   6,   8,   7,    0,   -7 },   // 0x23 '#'
+  {    11,   6,  10,   7,    0,   -8 },   // 0x24 '$'
+  {    19,  10,   9,  10,    0,   -8 },   // 0x25 '%'
+  {    31,   6,   9,   8,    1,   -8 },   // 0x26 '&'
+  {    38,   1,   3,   2,    1,   -8 },   // 0x27 '''
+  {    39,   2,  11,   4,    1,   -8 },   // 0x28 '('
+  {    42,   3,  11,   4,    0,   -8 },   // 0x29 ')'
+  {    47,   4,   3,   5,    0,   -8 },   // 0x2A '*'
+  {    49,   5,   5,   7,    1,   -4 },   // 0x2B '+'
+  {    53,   1,   3,   3,    1,    0 },   // 0x2C ','
+  {    54,   2,   1,   4,    1,   -3 },   // 0x2D '-'
+  {    55,   1,   1,   3,    1,    0 },   // 0x2E '.'
+  {    56,   3,   9,   3,    0,   -8 },   // 0x2F '/'
+  {    60,   6,   9,   7,    0,   -8 },   // 0x30 '0'
+  {    67,   3,   9,   7,    1,   -8 },   // 0x31 '1'
+  {    71,   6,   9,   7,    0,   -8 },   // 0x32 '2'
+  {    78,   6,   9,   7,    0,   -8 },   // 0x33 '3'
+  {    85,   6,   9,   7,    0,   -8 },   // 0x34 '4'
+  {    92,   6,   9,   7,    0,   -8 },   // 0x35 '5'
+  {    99,   6,   9,   7,    0,   -8 },   // 0x36 '6'
+  {   106,   5,   9,   7,    1,   -8 },   // 0x37 '7'
+  {   112,   6,   9,   7,    0,   -8 },   // 0x38 '8'
+  {   119,   6,   9,   7,    0,   -8 },   // 0x39 '9'
+  {   126,   1,   7,   3,    1,   -6 },   // 0x3A ':'
+  {   127,   1,   9,   3,    1,   -6 },   // 0x3B ';'
+  {   129,   5,   6,   7,    1,   -5 },   // 0x3C '<'
+  {   133,   5,   3,   7,    1,   -3 },   // 0x3D '='
+  {   135,   5,   6,   7,    1,   -5 },   // 0x3E '>'
+  {   139,   5,   9,   7,    1,   -8 },   // 0x3F '?'
+  {   145,  11,  11,  12,    0,   -8 },   // 0x40 '@'
+  {   161,   8,   9,   8,    0,   -8 },   // 0x41 'A'
+  {   170,   6,   9,   8,    1,   -8 },   // 0x42 'B'
+  {   177,   8,   9,   8,    0,   -8 },   // 0x43 'C'
+  {   186,   7,   9,   8,    1,   -8 },   // 0x44 'D'
+  {   194,   6,   9,   7,    1,   -8 },   // 0x45 'E'
+  {   201,   6,   9,   7,    1,   -8 },   // 0x46 'F'
+  {   208,   8,   9,   9,    0,   -8 },   // 0x47 'G'
+  {   217,   7,   9,   8,    1,   -8 },   // 0x48 'H'
+  {   225,   1,   9,   3,    1,   -8 },   // 0x49 'I'
+  {   227,   5,   9,   6,    0,   -8 },   // 0x4A 'J'
+  {   233,   7,   9,   8,    1,   -8 },   // 0x4B 'K'
+  {   241,   5,   9,   7,    1,   -8 },   // 0x4C 'L'
+  {   247,   8,   9,  10,    1,   -8 },   // 0x4D 'M'
+  {   256,   7,   9,   9,    1,   -8 },   // 0x4E 'N'
+  {   264,   9,   9,   9,    0,   -8 },   // 0x4F 'O'
+  {   275,   6,   9,   8,    1,   -8 },   // 0x50 'P'
+  {   282,   9,   9,   9,    0,   -8 },   // 0x51 'Q'
+  {   293,   7,   9,   8,    1,   -8 },   // 0x52 'R'
+  {   301,   6,   9,   8,    1,   -8 },   // 0x53 'S'
+  {   308,   7,   9,   7,    0,   -8 },   // 0x54 'T'
+  {   316,   7,   9,   8,    1,   -8 },   // 0x55 'U'
+  {   324,   7,   9,   8,    0,   -8 },   // 0x56 'V'
+  {   332,  11,   9,  11,    0,   -8 },   // 0x57 'W'
+  {   345,   8,   9,   8,    0,   -8 },   // 0x58 'X'
+  {   354,   8,   9,   8,    0,   -8 },   // 0x59 'Y'
+  {   363,   7,   9,   7,    0,   -8 },   // 0x5A 'Z'
+  {   371,   2,  12,   3,    1,   -8 },   // 0x5B '['
+  {   374,   3,   9,   3,    0,   -8 },   // 0x5C '\'
+  {   378,   2,  12,   3,    0,   -8 },   // 0x5D ']'
+  {   381,   4,   4,   6,    1,   -8 },   // 0x5E '^'
+  {   383,   7,   1,   7,    0,    2 },   // 0x5F '_'
+  {   384,   3,   2,   3,    0,   -8 },   // 0x60 '`'
+  {   385,   6,   7,   6,    0,   -6 },   // 0x61 'a'
+  {   391,   5,   9,   7,    1,   -8 },   // 0x62 'b'
+  {   397,   6,   7,   6,    0,   -6 },   // 0x63 'c'
+  {   403,   6,   9,   7,    0,   -8 },   // 0x64 'd'
+  {   410,   6,   7,   6,    0,   -6 },   // 0x65 'e'
+  {   416,   3,   9,   3,    0,   -8 },   // 0x66 'f'
+  {   420,   6,   9,   6,    0,   -6 },   // 0x67 'g'
+  {   427,   5,   9,   6,    1,   -8 },   // 0x68 'h'
+  {   433,   1,   9,   3,    1,   -8 },   // 0x69 'i'
+  {   435,   2,  12,   3,    0,   -8 },   // 0x6A 'j'
+  {   438,   5,   9,   6,    1,   -8 },   // 0x6B 'k'
+  {   444,   1,   9,   3,    1,   -8 },   // 0x6C 'l'
+  {   446,   8,   7,  10,    1,   -6 },   // 0x6D 'm'
+  {   453,   5,   7,   6,    1,   -6 },   // 0x6E 'n'
+  {   458,   6,   7,   6,    0,   -6 },   // 0x6F 'o'
+  {   464,   5,   9,   7,    1,   -6 },   // 0x70 'p'
+  {   470,   6,   9,   7,    0,   -6 },   // 0x71 'q'
+  {   477,   3,   7,   4,    1,   -6 },   // 0x72 'r'
+  {   480,   5,   7,   6,    0,   -6 },   // 0x73 's'
+  {   485,   3,   9,   3,    0,   -8 },   // 0x74 't'
+  {   489,   5,   7,   6,    1,   -6 },   // 0x75 'u'
+  {   494,   6,   7,   6,    0,   -6 },   // 0x76 'v'
+  {   500,   8,   7,   8,    0,   -6 },   // 0x77 'w'
+  {   507,   5,   7,   6,    0,   -6 },   // 0x78 'x'
+  {   512,   5,  10,   6,    0,   -6 },   // 0x79 'y'
+  {   519,   5,   7,   6,    0,   -6 },   // 0x7A 'z'
+  {   524,   3,  12,   4,    0,   -8 },   // 0x7B '{'
+  {   529,   1,  11,   3,    1,   -8 },   // 0x7C '|'
+  {   531,   2,  12,   4,    1,   -8 },   // 0x7D '}'
+  {   534,   5,   3,   6,    0,   -5 },   // 0x7E '~'
+  {   536,   9,  12,   9,    0,   -9 },   // 0x7F ''
+  {   550,   9,  12,   9,    0,   -9 },   // 0x80 ''
+  {   564,   9,  12,   9,    0,   -9 },   // 0x81 ''
+  {   578,   9,  12,   9,    0,   -9 },   // 0x82 ''
+  {   592,   9,  12,   9,    0,   -9 },   // 0x83 ''
+  {   606,   9,  12,   9,    0,   -9 },   // 0x84 ''
+  {   620,   9,  12,   9,    0,   -9 },   // 0x85 ''
+  {   634,   9,  12,   9,    0,   -9 },   // 0x86 ''
+  {   648,   9,  12,   9,    0,   -9 },   // 0x87 ''
+  {   662,   9,  12,   9,    0,   -9 },   // 0x88 ''
+  {   676,   9,  12,   9,    0,   -9 },   // 0x89 ''
+  {   690,   9,  12,   9,    0,   -9 },   // 0x8A ''
+  {   704,   9,  12,   9,    0,   -9 },   // 0x8B ''
+  {   718,   9,  12,   9,    0,   -9 },   // 0x8C ''
+  {   732,   9,  12,   9,    0,   -9 },   // 0x8D ''
+  {   746,   9,  12,   9,    0,   -9 },   // 0x8E ''
+  {   760,   9,  12,   9,    0,   -9 },   // 0x8F ''
+  {   774,   9,  12,   9,    0,   -9 },   // 0x90 ''
+  {   788,   9,  12,   9,    0,   -9 },   // 0x91 ''
+  {   802,   9,  12,   9,    0,   -9 },   // 0x92 ''
+  {   816,   9,  12,   9,    0,   -9 },   // 0x93 ''
+  {   830,   9,  12,   9,    0,   -9 },   // 0x94 ''
+  {   844,   9,  12,   9,    0,   -9 },   // 0x95 ''
+  {   858,   9,  12,   9,    0,   -9 },   // 0x96 ''
+  {   872,   9,  12,   9,    0,   -9 },   // 0x97 ''
+  {   886,   9,  12,   9,    0,   -9 },   // 0x98 ''
+  {   900,   9,  12,   9,    0,   -9 },   // 0x99 ''
+  {   914,   9,  12,   9,    0,   -9 },   // 0x9A ''
+  {   928,   9,  12,   9,    0,   -9 },   // 0x9B ''
+  {   942,   9,  12,   9,    0,   -9 },   // 0x9C ''
+  {   956,   9,  12,   9,    0,   -9 },   // 0x9D ''
+  {   970,   9,  12,   9,    0,   -9 },   // 0x9E ''
+  {   984,   9,  12,   9,    0,   -9 },   // 0x9F ''
+  {   998,   1,   1,   3,    0,    0 },   // 0xA0 ''
+  {   999,   1,   8,   4,    1,   -5 },   // 0xA1 ''
+  {  1000,   5,   9,   7,    1,   -7 },   // 0xA2 ''
+  {  1006,   6,   9,   7,    0,   -8 },   // 0xA3 ''
+  {  1013,   5,   4,   7,    1,   -5 },   // 0xA4 ''
+  {  1016,   6,   9,   7,    0,   -8 },   // 0xA5 ''
+  {  1023,   1,  11,   3,    1,   -8 },   // 0xA6 ''
+  {  1025,   6,  12,   7,    0,   -8 },   // 0xA7 ''
+  {  1034,   4,   1,   4,    0,   -7 },   // 0xA8 ''
+  {  1035,   9,   9,   9,    0,   -8 },   // 0xA9 ''
+  {  1046,   4,   6,   4,    0,   -8 },   // 0xAA ''
+  {  1049,   4,   4,   6,    1,   -4 },   // 0xAB ''
+  {  1051,   6,   3,   7,    0,   -3 },   // 0xAC ''
+  {  1054,   2,   1,   4,    1,   -3 },   // 0xAD ''
+  {  1055,   9,   9,   9,    0,   -8 },   // 0xAE ''
+  {  1066,   4,   1,   4,    0,   -8 },   // 0xAF ''
+  {  1067,   3,   4,   7,    2,   -7 },   // 0xB0 ''
+  {  1069,   5,   7,   7,    1,   -6 },   // 0xB1 ''
+  {  1074,   4,   6,   4,    0,   -9 },   // 0xB2 ''
+  {  1077,   4,   6,   4,    0,   -9 },   // 0xB3 ''
+  {  1080,   3,   2,   4,    1,   -8 },   // 0xB4 ''
+  {  1081,   5,   9,   7,    1,   -6 },   // 0xB5 ''
+  {  1087,   5,  11,   6,    1,   -8 },   // 0xB6 ''
+  {  1094,   1,   1,   3,    1,   -3 },   // 0xB7 ''
+  {  1095,   3,   2,   4,    0,    1 },   // 0xB8 ''
+  {  1096,   2,   5,   4,    1,   -9 },   // 0xB9 ''
+  {  1098,   4,   6,   4,    0,   -8 },   // 0xBA ''
+  {  1101,   4,   4,   6,    1,   -4 },   // 0xBB ''
+  {  1103,   9,   9,  10,    1,   -8 },   // 0xBC ''
+  {  1114,   9,   9,  10,    1,   -8 },   // 0xBD ''
+  {  1125,  10,   9,  10,    0,   -8 },   // 0xBE ''
+  {  1137,   5,   9,   7,    1,   -5 },   // 0xBF ''
+  {  1143,   8,  11,   8,    0,  -10 },   // 0xC0 ''
+  {  1154,   8,  11,   8,    0,  -10 },   // 0xC1 ''
+  {  1165,   8,  11,   8,    0,  -10 },   // 0xC2 ''
+  {  1176,   8,  11,   8,    0,  -10 },   // 0xC3 ''
+  {  1187,   8,  11,   8,    0,  -10 },   // 0xC4 ''
+  {  1198,   8,  12,   8,    0,  -11 },   // 0xC5 ''
+  {  1210,  11,   9,  12,    0,   -8 },   // 0xC6 ''
+  {  1223,   8,  11,   8,    0,   -8 },   // 0xC7 ''
+  {  1234,   6,  11,   7,    1,  -10 },   // 0xC8 ''
+  {  1243,   6,  11,   7,    1,  -10 },   // 0xC9 ''
+  {  1252,   6,  11,   7,    1,  -10 },   // 0xCA ''
+  {  1261,   6,  11,   7,    1,  -10 },   // 0xCB ''
+  {  1270,   3,  11,   3,    0,  -10 },   // 0xCC ''
+  {  1275,   2,  11,   3,    1,  -10 },   // 0xCD ''
+  {  1278,   3,  11,   4,    0,  -10 },   // 0xCE ''
+  {  1283,   3,  11,   4,    0,  -10 },   // 0xCF ''
+  {  1288,   8,   9,   8,    0,   -8 },   // 0xD0 ''
+  {  1297,   7,  11,   9,    1,  -10 },   // 0xD1 ''
+  {  1307,   9,  11,   9,    0,  -10 },   // 0xD2 ''
+  {  1320,   9,  11,   9,    0,  -10 },   // 0xD3 ''
+  {  1333,   9,  11,   9,    0,  -10 },   // 0xD4 ''
+  {  1346,   9,  11,   9,    0,  -10 },   // 0xD5 ''
+  {  1359,   9,  11,   9,    0,  -10 },   // 0xD6 ''
+  {  1372,   5,   5,   7,    1,   -4 },   // 0xD7 ''
+  {  1376,   9,   9,   9,    0,   -8 },   // 0xD8 ''
+  {  1387,   7,  11,   8,    1,  -10 },   // 0xD9 ''
+  {  1397,   7,  11,   8,    1,  -10 },   // 0xDA ''
+  {  1407,   7,  11,   8,    1,  -10 },   // 0xDB ''
+  {  1417,   7,  11,   8,    1,  -10 },   // 0xDC ''
+  {  1427,   8,  11,   8,    0,  -10 },   // 0xDD ''
+  {  1438,   6,   9,   8,    1,   -8 },   // 0xDE ''
+  {  1445,   6,   9,   7,    1,   -8 },   // 0xDF ''
+  {  1452,   6,   9,   6,    0,   -8 },   // 0xE0 ''
+  {  1459,   6,   9,   6,    0,   -8 },   // 0xE1 ''
+  {  1466,   6,   9,   6,    0,   -8 },   // 0xE2 ''
+  {  1473,   6,   9,   6,    0,   -8 },   // 0xE3 ''
+  {  1480,   6,   9,   6,    0,   -8 },   // 0xE4 ''
+  {  1487,   6,  10,   6,    0,   -9 },   // 0xE5 ''
+  {  1495,  10,   7,  10,    0,   -6 },   // 0xE6 ''
+  {  1504,   6,   9,   6,    0,   -6 },   // 0xE7 ''
+  {  1511,   6,   9,   6,    0,   -8 },   // 0xE8 ''
+  {  1518,   6,   9,   6,    0,   -8 },   // 0xE9 ''
+  {  1525,   6,   9,   6,    0,   -8 },   // 0xEA ''
+  {  1532,   6,   9,   6,    0,   -8 },   // 0xEB ''
+  {  1539,   2,   9,   3,    0,   -8 },   // 0xEC ''
+  {  1542,   3,   9,   3,    0,   -8 },   // 0xED ''
+  {  1546,   3,  10,   3,    0,   -9 },   // 0xEE ''
+  {  1550,   3,   9,   3,    0,   -8 },   // 0xEF ''
+  {  1554,   6,   9,   6,    0,   -8 },   // 0xF0 ''
+  {  1561,   5,   9,   6,    1,   -8 },   // 0xF1 ''
+  {  1567,   6,   9,   6,    0,   -8 },   // 0xF2 ''
+  {  1574,   6,   9,   6,    0,   -8 },   // 0xF3 ''
+  {  1581,   6,   9,   6,    0,   -8 },   // 0xF4 ''
+  {  1588,   6,   9,   6,    0,   -8 },   // 0xF5 ''
+  {  1595,   6,   9,   6,    0,   -8 },   // 0xF6 ''
+  {  1602,   5,   5,   7,    1,   -4 },   // 0xF7 ''
+  {  1606,   6,   7,   6,    0,   -6 },   // 0xF8 ''
+  {  1612,   5,   9,   6,    1,   -8 },   // 0xF9 ''
+  {  1618,   5,   9,   6,    1,   -8 },   // 0xFA ''
+  {  1624,   5,   9,   6,    1,   -8 },   // 0xFB ''
+  {  1630,   5,   9,   6,    1,   -8 },   // 0xFC ''
+  {  1636,   5,  12,   6,    0,   -8 },   // 0xFD ''
+  {  1644,   5,  11,   7,    1,   -8 },   // 0xFE ''
+  {  1651,   5,  12,   6,    0,   -8 } }; // 0xFF ''
+
+constexpr GFXfont FreeSans_RLE_6pt8b PROGMEM = {
+  (uint8_t  *)FreeSans_RLE_6pt8bBitmaps,
+  (GFXglyph *)FreeSans_RLE_6pt8bGlyphs,
+  0x20, 0xFF, 14 };
+
+// Approx. 3234 bytes
@@ -0,0 +1,409 @@
+const uint8_t FreeSans_RLE_7pt8bBitmaps[] PROGMEM = {
+  0x00, 0xFF, 0x40, 0xB6, 0x80, 0x12, 0x28, 0x93, 0xF2, 0x44, 0xBF, 0xB4,
+  0x48, 0x90, 0x10, 0x79, 0x5A, 0x95, 0x0F, 0x07, 0x89, 0xD2, 0xAC, 0xF0,
+  0x80, 0x00, 0x87, 0x10, 0xC9, 0x08, 0xA0, 0x72, 0x00, 0x40, 0x04, 0xE0,
+  0x91, 0x09, 0x11, 0x0E, 0x38, 0x48, 0x48, 0x78, 0x30, 0xD2, 0x8A, 0x8C,
+  0x8E, 0x72, 0xE0, 0x29, 0x49, 0x24, 0x99, 0x22, 0x91, 0x24, 0x92, 0x49,
+  0x48, 0x4F, 0x4A, 0x00, 0x82, 0x3F, 0x20, 0x82, 0x00, 0xD8, 0xE0, 0xC0,
+  0x12, 0x22, 0x44, 0x48, 0x88, 0x73, 0x28, 0xE1, 0x86, 0x18, 0x63, 0xC9,
+  0xC0, 0x13, 0xF1, 0x11, 0x11, 0x11, 0x3C, 0xCD, 0x08, 0x10, 0x61, 0x8C,
+  0x20, 0x41, 0xFC, 0x3C, 0x89, 0x18, 0x21, 0x80, 0xC0, 0xA1, 0x46, 0x78,
+  0x0C, 0x18, 0x71, 0xE2, 0xC9, 0x93, 0x7F, 0x0C, 0x18, 0x7E, 0x81, 0x03,
+  0xE4, 0x60, 0x40, 0xA1, 0x44, 0x78, 0x7B, 0x28, 0x60, 0xFA, 0x38, 0x61,
+  0xCD, 0xE0, 0xFC, 0x10, 0x86, 0x10, 0x82, 0x08, 0x41, 0x00, 0x3C, 0xC9,
+  0x1A, 0x23, 0x88, 0xD0, 0xA1, 0x46, 0x78, 0x72, 0x28, 0x61, 0x8D, 0xD0,
+  0x63, 0x89, 0xC0, 0xC0, 0x03, 0xC0, 0x03, 0x60, 0x00, 0x37, 0x20, 0xE0,
+  0x60, 0x40, 0xFC, 0x0F, 0xC0, 0x03, 0x03, 0x81, 0x1D, 0x88, 0x00, 0x7B,
+  0x38, 0x43, 0x08, 0x43, 0x00, 0x00, 0xC0, 0x07, 0xC0, 0xC3, 0x08, 0x04,
+  0xCE, 0xB4, 0xCC, 0xA4, 0x47, 0x22, 0x29, 0x32, 0x4E, 0xE1, 0x00, 0x0E,
+  0x00, 0x1F, 0x80, 0x0C, 0x0E, 0x05, 0x02, 0xC2, 0x21, 0x11, 0xFC, 0x82,
+  0x41, 0x60, 0xC0, 0xFC, 0x86, 0x82, 0x82, 0xFC, 0x82, 0x83, 0x83, 0x82,
+  0xFC, 0x3C, 0x42, 0x83, 0x80, 0x80, 0x80, 0x81, 0x83, 0x42, 0x3C, 0xFC,
+  0x86, 0x83, 0x81, 0x81, 0x81, 0x81, 0x83, 0x86, 0xFC, 0xFF, 0x02, 0x04,
+  0x0F, 0xF0, 0x20, 0x40, 0x81, 0xFC, 0xFF, 0x02, 0x04, 0x0F, 0xD0, 0x20,
+  0x40, 0x81, 0x00, 0x3E, 0x31, 0xB0, 0x50, 0x08, 0x04, 0x7E, 0x03, 0x03,
+  0x63, 0x9F, 0x40, 0x83, 0x83, 0x83, 0x83, 0xFF, 0x83, 0x83, 0x83, 0x83,
+  0x83, 0xFF, 0xFF, 0xF0, 0x04, 0x10, 0x41, 0x04, 0x10, 0x71, 0x4D, 0xE0,
+  0x82, 0x84, 0x88, 0x90, 0xB0, 0xD8, 0x8C, 0x84, 0x86, 0x83, 0x82, 0x08,
+  0x20, 0x82, 0x08, 0x20, 0x83, 0xF0, 0xC0, 0xE0, 0xE8, 0x74, 0x3A, 0x2C,
+  0x96, 0x4B, 0x29, 0x8C, 0xC6, 0x40, 0xC1, 0xC1, 0xA1, 0xB1, 0x91, 0x89,
+  0x8D, 0x85, 0x87, 0x83, 0x3E, 0x31, 0xB0, 0x70, 0x18, 0x0C, 0x06, 0x03,
+  0x83, 0x63, 0x1F, 0x00, 0xFD, 0x0E, 0x0C, 0x18, 0x7F, 0xA0, 0x40, 0x81,
+  0x00, 0x3E, 0x31, 0xB0, 0x70, 0x18, 0x0C, 0x06, 0x03, 0x8B, 0x63, 0x1F,
+  0xC0, 0x00, 0xFE, 0x82, 0x83, 0x83, 0x82, 0xFC, 0x82, 0x83, 0x83, 0x83,
+  0x7C, 0xC6, 0x82, 0xC0, 0x78, 0x0E, 0x02, 0x82, 0xC6, 0x7C, 0xFF, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x83, 0x83, 0x83, 0x83,
+  0x83, 0x83, 0x83, 0x83, 0x42, 0x3C, 0xC1, 0x20, 0x90, 0xCC, 0x42, 0x21,
+  0x30, 0x50, 0x28, 0x1C, 0x04, 0x00, 0xC2, 0x12, 0x38, 0x91, 0x44, 0x8A,
+  0x66, 0xD2, 0x14, 0xD0, 0xA2, 0x85, 0x14, 0x38, 0xC0, 0x82, 0x00, 0x41,
+  0x31, 0x8D, 0x82, 0x81, 0xC0, 0xE0, 0x50, 0x44, 0x63, 0x20, 0x80, 0x41,
+  0xB0, 0x88, 0xC6, 0x41, 0x40, 0x60, 0x20, 0x10, 0x08, 0x04, 0x00, 0x7F,
+  0x03, 0x06, 0x04, 0x08, 0x18, 0x30, 0x60, 0x40, 0xFF, 0xEA, 0xAA, 0xAA,
+  0xC0, 0x88, 0x84, 0x44, 0x22, 0x21, 0xE4, 0x92, 0x49, 0x24, 0x9E, 0x63,
+  0x15, 0x28, 0x80, 0xFF, 0x44, 0x3C, 0x88, 0x10, 0xE6, 0x58, 0xB1, 0x3F,
+  0x82, 0x0B, 0xB3, 0x86, 0x18, 0x61, 0xCF, 0xE0, 0x38, 0x89, 0x16, 0x0C,
+  0x08, 0x91, 0x1C, 0x02, 0x04, 0xEB, 0x34, 0x78, 0x70, 0xA3, 0x66, 0x74,
+  0x3C, 0x89, 0x0F, 0xFC, 0x08, 0xD1, 0x1C, 0x34, 0xF4, 0x44, 0x44, 0x44,
+  0x3A, 0x8D, 0x1E, 0x1C, 0x28, 0xD1, 0x9D, 0x06, 0x88, 0xE0, 0x82, 0x0B,
+  0xB2, 0x8E, 0x38, 0xE3, 0x8E, 0x30, 0xBF, 0xC0, 0x45, 0x55, 0x55, 0xC0,
+  0x82, 0x08, 0xA4, 0xA3, 0x89, 0x24, 0x8A, 0x30, 0xFF, 0xC0, 0xFB, 0xE6,
+  0x62, 0x31, 0x18, 0x8C, 0x46, 0x23, 0x11, 0xFB, 0x28, 0xE3, 0x8E, 0x38,
+  0xE3, 0x38, 0x89, 0x1E, 0x1C, 0x28, 0xD1, 0x1C, 0xFB, 0x38, 0x61, 0x86,
+  0x1C, 0xEE, 0x82, 0x08, 0x00, 0x3A, 0xCD, 0x1E, 0x1C, 0x28, 0xD9, 0x9D,
+  0x02, 0x04, 0x08, 0xBA, 0x49, 0x24, 0x39, 0x14, 0x1C, 0x1F, 0x14, 0x5E,
+  0x44, 0xF4, 0x44, 0x44, 0x47, 0x8E, 0x38, 0xE3, 0x8E, 0x38, 0xFF, 0xC4,
+  0x89, 0x12, 0x42, 0x85, 0x0C, 0x18, 0xCC, 0xD3, 0x24, 0xC9, 0x52, 0x53,
+  0x8C, 0xC3, 0x30, 0xCC, 0x45, 0x22, 0x8C, 0x30, 0xA4, 0xB1, 0x85, 0x14,
+  0xD2, 0x28, 0xE3, 0x0C, 0x30, 0x86, 0x00, 0x7C, 0x30, 0x84, 0x31, 0x84,
+  0x3F, 0x69, 0x25, 0xA6, 0x49, 0x26, 0xFF, 0xF8, 0xC9, 0x24, 0x8A, 0x49,
+  0x28, 0x62, 0x58, 0xC0, 0xFF, 0xF0, 0x1C, 0xF7, 0x45, 0xD1, 0x70, 0x5C,
+  0x27, 0x11, 0xC4, 0x70, 0x1C, 0x47, 0x01, 0xFF, 0xC0, 0xFF, 0xF0, 0x1C,
+  0xF7, 0x45, 0xD1, 0x70, 0x5C, 0x27, 0x11, 0xC4, 0x70, 0x1C, 0x47, 0x01,
+  0xFF, 0xC0, 0xFF, 0xF0, 0x1C, 0xF7, 0x45, 0xD1, 0x70, 0x5C, 0x27, 0x11,
+  0xC4, 0x70, 0x1C, 0x47, 0x01, 0xFF, 0xC0, 0xFF, 0xF0, 0x1C, 0xF7, 0x45,
+  0xD1, 0x70, 0x5C, 0x27, 0x11, 0xC4, 0x70, 0x1C, 0x47, 0x01, 0xFF, 0xC0,
+  0xFF, 0xF0, 0x1C, 0xF7, 0x45, 0xD1, 0x70, 0x5C, 0x27, 0x11, 0xC4, 0x70,
+  0x1C, 0x47, 0x01, 0xFF, 0xC0, 0xFF, 0xF0, 0x1C, 0xF7, 0x45, 0xD1, 0x70,
+  0x5C, 0x27, 0x11, 0xC4, 0x70, 0x1C, 0x47, 0x01, 0xFF, 0xC0, 0xFF, 0xF0,
+  0x1C, 0xF7, 0x45, 0xD1, 0x70, 0x5C, 0x27, 0x11, 0xC4, 0x70, 0x1C, 0x47,
+  0x01, 0xFF, 0xC0, 0xFF, 0xF0, 0x1C, 0xF7, 0x45, 0xD1, 0x70, 0x5C, 0x27,
+  0x11, 0xC4, 0x70, 0x1C, 0x47, 0x01, 0xFF, 0xC0, 0xFF, 0xF0, 0x1C, 0xF7,
+  0x45, 0xD1, 0x70, 0x5C, 0x27, 0x11, 0xC4, 0x70, 0x1C, 0x47, 0x01, 0xFF,
+  0xC0, 0xFF, 0xF0, 0x1C, 0xF7, 0x45, 0xD1, 0x70, 0x5C, 0x27, 0x11, 0xC4,
+  0x70, 0x1C, 0x47, 0x01, 0xFF, 0xC0, 0xFF, 0xF0, 0x1C, 0xF7, 0x45, 0xD1,
+  0x70, 0x5C, 0x27, 0x11, 0xC4, 0x70, 0x1C, 0x47, 0x01, 0xFF, 0xC0, 0xFF,
+  0xF0, 0x1C, 0xF7, 0x45, 0xD1, 0x70, 0x5C, 0x27, 0x11, 0xC4, 0x70, 0x1C,
+  0x47, 0x01, 0xFF, 0xC0, 0xFF, 0xF0, 0x1C, 0xF7, 0x45, 0xD1, 0x70, 0x5C,
+  0x27, 0x11, 0xC4, 0x70, 0x1C, 0x47, 0x01, 0xFF, 0xC0, 0xFF, 0xF0, 0x1C,
+  0xF7, 0x45, 0xD1, 0x70, 0x5C, 0x27, 0x11, 0xC4, 0x70, 0x1C, 0x47, 0x01,
+  0xFF, 0xC0, 0xFF, 0xF0, 0x1C, 0xF7, 0x45, 0xD1, 0x70, 0x5C, 0x27, 0x11,
+  0xC4, 0x70, 0x1C, 0x47, 0x01, 0xFF, 0xC0, 0xFF, 0xF0, 0x1C, 0xF7, 0x45,
+  0xD1, 0x70, 0x5C, 0x27, 0x11, 0xC4, 0x70, 0x1C, 0x47, 0x01, 0xFF, 0xC0,
+  0xFF, 0xF0, 0x1C, 0xF7, 0x45, 0xD1, 0x70, 0x5C, 0x27, 0x11, 0xC4, 0x70,
+  0x1C, 0x47, 0x01, 0xFF, 0xC0, 0xFF, 0xF0, 0x1C, 0xF7, 0x45, 0xD1, 0x70,
+  0x5C, 0x27, 0x11, 0xC4, 0x70, 0x1C, 0x47, 0x01, 0xFF, 0xC0, 0xFF, 0xF0,
+  0x1C, 0xF7, 0x45, 0xD1, 0x70, 0x5C, 0x27, 0x11, 0xC4, 0x70, 0x1C, 0x47,
+  0x01, 0xFF, 0xC0, 0xFF, 0xF0, 0x1C, 0xF7, 0x45, 0xD1, 0x70, 0x5C, 0x27,
+  0x11, 0xC4, 0x70, 0x1C, 0x47, 0x01, 0xFF, 0xC0, 0xFF, 0xF0, 0x1C, 0xF7,
+  0x45, 0xD1, 0x70, 0x5C, 0x27, 0x11, 0xC4, 0x70, 0x1C, 0x47, 0x01, 0xFF,
+  0xC0, 0xFF, 0xF0, 0x1C, 0xF7, 0x45, 0xD1, 0x70, 0x5C, 0x27, 0x11, 0xC4,
+  0x70, 0x1C, 0x47, 0x01, 0xFF, 0xC0, 0xFF, 0xF0, 0x1C, 0xF7, 0x45, 0xD1,
+  0x70, 0x5C, 0x27, 0x11, 0xC4, 0x70, 0x1C, 0x47, 0x01, 0xFF, 0xC0, 0xFF,
+  0xF0, 0x1C, 0xF7, 0x45, 0xD1, 0x70, 0x5C, 0x27, 0x11, 0xC4, 0x70, 0x1C,
+  0x47, 0x01, 0xFF, 0xC0, 0xFF, 0xF0, 0x1C, 0xF7, 0x45, 0xD1, 0x70, 0x5C,
+  0x27, 0x11, 0xC4, 0x70, 0x1C, 0x47, 0x01, 0xFF, 0xC0, 0xFF, 0xF0, 0x1C,
+  0xF7, 0x45, 0xD1, 0x70, 0x5C, 0x27, 0x11, 0xC4, 0x70, 0x1C, 0x47, 0x01,
+  0xFF, 0xC0, 0xFF, 0xF0, 0x1C, 0xF7, 0x45, 0xD1, 0x70, 0x5C, 0x27, 0x11,
+  0xC4, 0x70, 0x1C, 0x47, 0x01, 0xFF, 0xC0, 0xFF, 0xF0, 0x1C, 0xF7, 0x45,
+  0xD1, 0x70, 0x5C, 0x27, 0x11, 0xC4, 0x70, 0x1C, 0x47, 0x01, 0xFF, 0xC0,
+  0xFF, 0xF0, 0x1C, 0xF7, 0x45, 0xD1, 0x70, 0x5C, 0x27, 0x11, 0xC4, 0x70,
+  0x1C, 0x47, 0x01, 0xFF, 0xC0, 0xFF, 0xF0, 0x1C, 0xF7, 0x45, 0xD1, 0x70,
+  0x5C, 0x27, 0x11, 0xC4, 0x70, 0x1C, 0x47, 0x01, 0xFF, 0xC0, 0xFF, 0xF0,
+  0x1C, 0xF7, 0x45, 0xD1, 0x70, 0x5C, 0x27, 0x11, 0xC4, 0x70, 0x1C, 0x47,
+  0x01, 0xFF, 0xC0, 0xFF, 0xF0, 0x1C, 0xF7, 0x45, 0xD1, 0x70, 0x5C, 0x27,
+  0x11, 0xC4, 0x70, 0x1C, 0x47, 0x01, 0xFF, 0xC0, 0xFF, 0xF0, 0x1C, 0xF7,
+  0x45, 0xD1, 0x70, 0x5C, 0x27, 0x11, 0xC4, 0x70, 0x1C, 0x47, 0x01, 0xFF,
+  0xC0, 0x00, 0xBF, 0xC0, 0x21, 0xEE, 0xE9, 0xA2, 0x8A, 0x7B, 0x78, 0x80,
+  0x3C, 0xCD, 0x0A, 0x06, 0x1F, 0x08, 0x10, 0x78, 0x9C, 0xFF, 0x28, 0xB2,
+  0xFC, 0xC2, 0x8C, 0x91, 0x61, 0x8F, 0xC4, 0x3F, 0x10, 0x20, 0xFD, 0xF8,
+  0x71, 0x2C, 0x98, 0xB2, 0x28, 0x71, 0x38, 0x68, 0xB2, 0x70, 0xD0, 0x3E,
+  0x20, 0xA7, 0x34, 0x5A, 0x0D, 0x06, 0x8B, 0x39, 0x41, 0x1F, 0x00, 0x70,
+  0x9D, 0x26, 0xB8, 0x4E, 0xA4, 0x90, 0x00, 0xFC, 0x10, 0x41, 0xE0, 0x3E,
+  0x20, 0xAF, 0x34, 0x5A, 0x2D, 0xE6, 0x8B, 0x45, 0x41, 0x1F, 0x00, 0xF0,
+  0x69, 0x99, 0x60, 0x00, 0x82, 0x3F, 0x20, 0x82, 0x00, 0xFC, 0x79, 0x12,
+  0x4F, 0x79, 0x31, 0x96, 0x68, 0x8E, 0x38, 0xE3, 0x8E, 0x38, 0xFD, 0x82,
+  0x08, 0x00, 0x7F, 0xAE, 0xBA, 0xEB, 0xA2, 0x8A, 0x28, 0xA2, 0x8A, 0xC0,
+  0x4F, 0x80, 0x75, 0x50, 0xF6, 0xD5, 0xC0, 0xA6, 0xD3, 0x20, 0x00, 0x41,
+  0x18, 0x21, 0x08, 0x22, 0x04, 0x44, 0x91, 0x82, 0x50, 0x92, 0x23, 0xE4,
+  0x08, 0x41, 0x18, 0x41, 0x08, 0x22, 0x04, 0x9C, 0x94, 0x44, 0x10, 0x84,
+  0x21, 0x08, 0x7C, 0x70, 0x92, 0x10, 0xC4, 0x09, 0x08, 0xA2, 0xE8, 0xC1,
+  0x28, 0x49, 0x11, 0xE2, 0x04, 0x10, 0x00, 0x04, 0x31, 0x8C, 0x31, 0x45,
+  0xE0, 0x10, 0x04, 0x00, 0x01, 0x81, 0xC0, 0xA0, 0x58, 0x44, 0x22, 0x3F,
+  0x90, 0x48, 0x2C, 0x18, 0x06, 0x04, 0x00, 0x01, 0x81, 0xC0, 0xA0, 0x58,
+  0x44, 0x22, 0x3F, 0x90, 0x48, 0x2C, 0x18, 0x08, 0x0A, 0x00, 0x01, 0x81,
+  0xC0, 0xA0, 0x58, 0x44, 0x22, 0x3F, 0x90, 0x48, 0x2C, 0x18, 0x1E, 0x00,
+  0x03, 0x03, 0x81, 0x40, 0xB0, 0x88, 0x44, 0x7F, 0x20, 0x90, 0x58, 0x30,
+  0x16, 0x00, 0x03, 0x03, 0x81, 0x40, 0xB0, 0x88, 0x44, 0x7F, 0x20, 0x90,
+  0x58, 0x30, 0x0C, 0x0A, 0x07, 0x00, 0x00, 0xC0, 0xE0, 0x50, 0x2C, 0x22,
+  0x11, 0x1F, 0xC8, 0x24, 0x16, 0x0C, 0x0F, 0xF8, 0x58, 0x06, 0xC0, 0x26,
+  0x03, 0x3F, 0x91, 0x80, 0xFC, 0x0C, 0x60, 0x43, 0x06, 0x1F, 0xC0, 0x3C,
+  0x42, 0x83, 0x80, 0x80, 0x80, 0x81, 0x83, 0x42, 0x3C, 0x10, 0x08, 0x30,
+  0x30, 0x20, 0x07, 0xF8, 0x10, 0x20, 0x7F, 0x81, 0x02, 0x04, 0x0F, 0xE0,
+  0x08, 0x20, 0x07, 0xF8, 0x10, 0x20, 0x7F, 0x81, 0x02, 0x04, 0x0F, 0xE0,
+  0x10, 0x50, 0x07, 0xF8, 0x10, 0x20, 0x7F, 0x81, 0x02, 0x04, 0x0F, 0xE0,
+  0x2C, 0x03, 0xFC, 0x08, 0x10, 0x3F, 0xC0, 0x81, 0x02, 0x07, 0xF0, 0x45,
+  0xB6, 0xDB, 0x6D, 0xB0, 0x53, 0x6D, 0xB6, 0xDB, 0x60, 0x69, 0x66, 0x66,
+  0x66, 0x66, 0x66, 0xD0, 0x66, 0x66, 0x66, 0x66, 0x66, 0x7E, 0x21, 0x90,
+  0x68, 0x1F, 0x8A, 0x05, 0x02, 0x83, 0x43, 0x3F, 0x00, 0x24, 0x38, 0xC1,
+  0xC1, 0xA1, 0xB1, 0x91, 0x89, 0x8D, 0x85, 0x87, 0x83, 0x10, 0x04, 0x00,
+  0x07, 0xC6, 0x36, 0x0E, 0x03, 0x01, 0x80, 0xC0, 0x70, 0x6C, 0x63, 0xE0,
+  0x04, 0x04, 0x00, 0x07, 0xC6, 0x36, 0x0E, 0x03, 0x01, 0x80, 0xC0, 0x70,
+  0x6C, 0x63, 0xE0, 0x08, 0x0A, 0x00, 0x07, 0xC6, 0x36, 0x0E, 0x03, 0x01,
+  0x80, 0xC0, 0x70, 0x6C, 0x63, 0xE0, 0x00, 0x1E, 0x0F, 0x8C, 0x6C, 0x1C,
+  0x06, 0x03, 0x01, 0x80, 0xE0, 0xD8, 0xC7, 0xC0, 0x34, 0x00, 0x0F, 0x8C,
+  0x6C, 0x1C, 0x06, 0x03, 0x01, 0x80, 0xE0, 0xD8, 0xC7, 0xC0, 0x01, 0x23,
+  0x0C, 0x48, 0x00, 0x1F, 0x4C, 0x66, 0x1D, 0x09, 0x44, 0x52, 0x15, 0x05,
+  0x83, 0x71, 0x87, 0xC0, 0x30, 0x08, 0x00, 0x83, 0x83, 0x83, 0x83, 0x83,
+  0x83, 0x83, 0x83, 0x42, 0x3C, 0x0C, 0x10, 0x00, 0x83, 0x83, 0x83, 0x83,
+  0x83, 0x83, 0x83, 0x83, 0x42, 0x3C, 0x18, 0x3C, 0x00, 0x83, 0x83, 0x83,
+  0x83, 0x83, 0x83, 0x83, 0x83, 0x42, 0x3C, 0x34, 0x00, 0x83, 0x83, 0x83,
+  0x83, 0x83, 0x83, 0x83, 0x83, 0x42, 0x3C, 0x04, 0x04, 0x10, 0x6C, 0x22,
+  0x31, 0x90, 0x50, 0x18, 0x08, 0x04, 0x02, 0x01, 0x00, 0x81, 0x03, 0xF4,
+  0x18, 0x30, 0x7F, 0x40, 0x81, 0x00, 0x79, 0x9A, 0x14, 0x29, 0x90, 0xA1,
+  0xC2, 0x85, 0x70, 0x30, 0x20, 0xF2, 0x20, 0x43, 0x99, 0x62, 0xC4, 0xFC,
+  0x08, 0x20, 0xF2, 0x20, 0x43, 0x99, 0x62, 0xC4, 0xFC, 0x18, 0x50, 0x01,
+  0xE4, 0x40, 0x87, 0x32, 0xC5, 0x89, 0xF8, 0x3C, 0x00, 0xF2, 0x20, 0x43,
+  0x99, 0x62, 0xC4, 0xFC, 0x2C, 0x00, 0xF2, 0x20, 0x43, 0x99, 0x62, 0xC4,
+  0xFC, 0x18, 0x50, 0x61, 0xE4, 0x40, 0x87, 0x32, 0xC5, 0x89, 0xF8, 0x39,
+  0xC4, 0x62, 0x04, 0x23, 0xFF, 0x44, 0x0C, 0x42, 0x4E, 0x27, 0x1C, 0x38,
+  0x89, 0x16, 0x0C, 0x08, 0x91, 0x1C, 0x20, 0x30, 0xC0, 0x30, 0x20, 0x01,
+  0xE4, 0x48, 0x7F, 0xE0, 0x46, 0x88, 0xE0, 0x08, 0x20, 0x01, 0xE4, 0x48,
+  0x7F, 0xE0, 0x46, 0x88, 0xE0, 0x18, 0x50, 0x01, 0xE4, 0x48, 0x7F, 0xE0,
+  0x46, 0x88, 0xE0, 0x2C, 0x00, 0xF2, 0x24, 0x3F, 0xF0, 0x23, 0x44, 0x70,
+  0xCD, 0x24, 0x92, 0x48, 0x69, 0x24, 0x92, 0x48, 0x6A, 0x04, 0x44, 0x44,
+  0x44, 0x40, 0xB0, 0x04, 0x44, 0x44, 0x44, 0x40, 0x48, 0x60, 0x21, 0xE4,
+  0x48, 0xF0, 0xE1, 0x46, 0x88, 0xE0, 0x78, 0x0F, 0xB2, 0x8E, 0x38, 0xE3,
+  0x8E, 0x30, 0x30, 0x20, 0x01, 0xC4, 0x48, 0xF0, 0xE1, 0x46, 0x88, 0xE0,
+  0x08, 0x20, 0x01, 0xC4, 0x48, 0xF0, 0xE1, 0x46, 0x88, 0xE0, 0x10, 0x50,
+  0x01, 0xC4, 0x48, 0xF0, 0xE1, 0x46, 0x88, 0xE0, 0x3C, 0x00, 0xE2, 0x24,
+  0x78, 0x70, 0xA3, 0x44, 0x70, 0x2C, 0x00, 0xE2, 0x24, 0x78, 0x70, 0xA3,
+  0x44, 0x70, 0x30, 0x0F, 0xC0, 0x00, 0xC0, 0x3A, 0x89, 0x1E, 0xDD, 0x2C,
+  0xD1, 0x5C, 0x60, 0x88, 0xE3, 0x8E, 0x38, 0xE3, 0x8F, 0xF0, 0x10, 0x88,
+  0xE3, 0x8E, 0x38, 0xE3, 0x8F, 0xF0, 0x31, 0x48, 0xE3, 0x8E, 0x38, 0xE3,
+  0x8F, 0xF0, 0x58, 0x08, 0xE3, 0x8E, 0x38, 0xE3, 0x8F, 0xF0, 0x18, 0x40,
+  0x21, 0x45, 0x34, 0x8A, 0x38, 0xC3, 0x0C, 0x21, 0x80, 0x82, 0x0B, 0xB3,
+  0x86, 0x18, 0x61, 0xCE, 0xE8, 0x20, 0x80, 0x28, 0x08, 0x51, 0x4D, 0x22,
+  0x8E, 0x30, 0xC3, 0x08, 0x60 };
+
+constexpr GFXglyph FreeSans_RLE_7pt8bGlyphs[] PROGMEM = {
+  {     0,   1,   1,   3,    0,    0 },   // 0x20 ' '
+  {     1,   1,  10,   5,    2,   -9 },   // 0x21 '!'
+  {     3,   3,   3,   5,    1,   -9 },   // 0x22 '"'
+  {     5,   7,  10,   8,    0,   -9 },   // 0x23 '#'
+  {    14,   7,  12,   8,    0,  -10 },   // 0x24 '$'
+  {    25,  12,  10,  12,    0,   -9 },   // 0x25 '%'
+  {    40,   8,  10,   9,    1,   -9 },   // 0x26 '&'
+  {    50,   1,   3,   3,    1,   -9 },   // 0x27 '''
+  {    51,   3,  13,   5,    1,   -9 },   // 0x28 '('
+  {    56,   3,  13,   5,    1,   -9 },   // 0x29 ')'
+  {    61,   4,   4,   5,    1,   -9 },   // 0x2A '*'
+  {    63,   6,   7,   8,    1,   -6 },   // 0x2B '+'
+  {    69,   2,   3,   4,    1,    0 },   // 0x2C ','
+  {    70,   3,   1,   5,    1,   -3 },   // 0x2D '-'
+  {    71,   2,   1,   3,    1,    0 },   // 0x2E '.'
+  {    72,   4,  10,   4,    0,   -9 },   // 0x2F '/'
+  {    77,   6,  10,   8,    1,   -9 },   // 0x30 '0'
+  {    85,   4,  10,   8,    1,   -9 },   // 0x31 '1'
+  {    90,   7,  10,   8,    0,   -9 },   // 0x32 '2'
+  {    99,   7,  10,   8,    0,   -9 },   // 0x33 '3'
+  {   108,   7,  10,   8,    0,   -9 },   // 0x34 '4'
+  {   117,   7,  10,   8,    0,   -9 },   // 0x35 '5'
+  {   126,   6,  10,   8,    1,   -9 },   // 0x36 '6'
+  {   134,   6,  10,   8,    1,   -9 },   // 0x37 '7'
+  {   142,   7,  10,   8,    0,   -9 },   // 0x38 '8'
+  {   151,   6,  10,   8,    1,   -9 },   // 0x39 '9'
+  {   159,   2,   8,   3,    1,   -7 },   // 0x3A ':'
+  {   161,   2,  10,   3,    1,   -7 },   // 0x3B ';'
+  {   164,   6,   7,   8,    1,   -6 },   // 0x3C '<'
+  {   170,   6,   3,   8,    1,   -4 },   // 0x3D '='
+  {   173,   6,   7,   8,    1,   -6 },   // 0x3E '>'
+  {   179,   6,  10,   8,    1,   -9 },   // 0x3F '?'
+  {   187,  13,  12,  14,    0,   -9 },   // 0x40 '@'
+  {   207,   9,  10,   9,    0,   -9 },   // 0x41 'A'
+  {   219,   8,  10,   9,    1,   -9 },   // 0x42 'B'
+  {   229,   8,  10,  10,    1,   -9 },   // 0x43 'C'
+  {   239,   8,  10,  10,    1,   -9 },   // 0x44 'D'
+  {   249,   7,  10,   9,    1,   -9 },   // 0x45 'E'
+  {   258,   7,  10,   8,    1,   -9 },   // 0x46 'F'
+  {   267,   9,  10,  10,    1,   -9 },   // 0x47 'G'
+  {   279,   8,  10,  10,    1,   -9 },   // 0x48 'H'
+  {   289,   2,  10,   4,    1,   -9 },   // 0x49 'I'
+  {   292,   6,  10,   7,    0,   -9 },   // 0x4A 'J'
+  {   300,   8,  10,   9,    1,   -9 },   // 0x4B 'K'
+  {   310,   6,  10,   8,    1,   -9 },   // 0x4C 'L'
+  {   318,   9,  10,  12,    1,   -9 },   // 0x4D 'M'
+  {   330,   8,  10,  10,    1,   -9 },   // 0x4E 'N'
+  {   340,   9,  10,  11,    1,   -9 },   // 0x4F 'O'
+  {   352,   7,  10,   9,    1,   -9 },   // 0x50 'P'
+  {   361,   9,  11,  11,    1,   -9 },   // 0x51 'Q'
+  {   374,   8,  10,  10,    1,   -9 },   // 0x52 'R'
+  {   384,   8,  10,   9,    1,   -9 },   // 0x53 'S'
+  {   394,   8,  10,   9,    0,   -9 },   // 0x54 'T'
+  {   404,   8,  10,  10,    1,   -9 },   // 0x55 'U'
+  {   414,   9,  10,   9,    0,   -9 },   // 0x56 'V'
+  {   426,  13,  10,  13,    0,   -9 },   // 0x57 'W'
+  {   443,   9,  10,   9,    0,   -9 },   // 0x58 'X'
+  {   455,   9,  10,   9,    0,   -9 },   // 0x59 'Y'
+  {   467,   8,  10,   8,    0,   -9 },   // 0x5A 'Z'
+  {   477,   2,  13,   4,    1,   -9 },   // 0x5B '['
+  {   481,   4,  10,   4,    0,   -9 },   // 0x5C '\'
+  {   486,   3,  13,   4,    0,   -9 },   // 0x5D ']'
+  {   491,   5,   5,   6,    1,   -9 },   // 0x5E '^'
+  {   495,   8,   1,   8,    0,    3 },   // 0x5F '_'
+  {   496,   3,   2,   3,    0,   -9 },   // 0x60 '`'
+  {   497,   7,   8,   7,    0,   -7 },   // 0x61 'a'
+  {   504,   6,  10,   8,    1,   -9 },   // 0x62 'b'
+  {   512,   7,   8,   7,    0,   -7 },   // 0x63 'c'
+  {   519,   7,  10,   8,    0,   -9 },   // 0x64 'd'
+  {   528,   7,   8,   7,    0,   -7 },   // 0x65 'e'
+  {   535,   4,  10,   4,    0,   -9 },   // 0x66 'f'
+  {   540,   7,  11,   8,    0,   -7 },   // 0x67 'g'
+  {   550,   6,  10,   7,    1,   -9 },   // 0x68 'h'
+  {   558,   1,  10,   3,    1,   -9 },   // 0x69 'i'
+  {   560,   2,  13,   3,    0,   -9 },   // 0x6A 'j'
+  {   564,   6,  10,   7,    1,   -9 },   // 0x6B 'k'
+  {   572,   1,  10,   3,    1,   -9 },   // 0x6C 'l'
+  {   574,   9,   8,  11,    1,   -7 },   // 0x6D 'm'
+  {   583,   6,   8,   7,    1,   -7 },   // 0x6E 'n'
+  {   589,   7,   8,   7,    0,   -7 },   // 0x6F 'o'
+  {   596,   6,  11,   8,    1,   -7 },   // 0x70 'p'
+  {   605,   7,  11,   8,    0,   -7 },   // 0x71 'q'
+  {   615,   3,   8,   5,    1,   -7 },   // 0x72 'r'
+  {   618,   6,   8,   7,    0,   -7 },   // 0x73 's'
+  {   624,   4,  10,   4,    0,   -9 },   // 0x74 't'
+  {   629,   6,   8,   7,    1,   -7 },   // 0x75 'u'
+  {   635,   7,   8,   7,    0,   -7 },   // 0x76 'v'
+  {   642,  10,   8,  10,    0,   -7 },   // 0x77 'w'
+  {   652,   6,   8,   7,    0,   -7 },   // 0x78 'x'
+  {   658,   6,  11,   7,    0,   -7 },   // 0x79 'y'
+  {   667,   6,   8,   7,    0,   -7 },   // 0x7A 'z'
+  {   673,   3,  13,   5,    1,   -9 },   // 0x7B '{'
+  {   678,   1,  13,   3,    1,   -9 },   // 0x7C '|'
+  {   680,   3,  13,   5,    1,   -9 },   // 0x7D '}'
+  {   685,   6,   3,   7,    0,   -5 },   // 0x7E '~'
+  {   688,  10,  13,  11,    0,  -10 },   // 0x7F ''
+  {   705,  10,  13,  11,    0,  -10 },   // 0x80 ''
+  {   722,  10,  13,  11,    0,  -10 },   // 0x81 ''
+  {   739,  10,  13,  11,    0,  -10 },   // 0x82 ''
+  {   756,  10,  13,  11,    0,  -10 },   // 0x83 ''
+  {   773,  10,  13,  11,    0,  -10 },   // 0x84 ''
+  {   790,  10,  13,  11,    0,  -10 },   // 0x85 ''
+  {   807,  10,  13,  11,    0,  -10 },   // 0x86 ''
+  {   824,  10,  13,  11,    0,  -10 },   // 0x87 ''
+  {   841,  10,  13,  11,    0,  -10 },   // 0x88 ''
+  {   858,  10,  13,  11,    0,  -10 },   // 0x89 ''
+  {   875,  10,  13,  11,    0,  -10 },   // 0x8A ''
+  {   892,  10,  13,  11,    0,  -10 },   // 0x8B ''
+  {   909,  10,  13,  11,    0,  -10 },   // 0x8C ''
+  {   926,  10,  13,  11,    0,  -10 },   // 0x8D ''
+  {   943,  10,  13,  11,    0,  -10 },   // 0x8E ''
+  {   960,  10,  13,  11,    0,  -10 },   // 0x8F ''
+  {   977,  10,  13,  11,    0,  -10 },   // 0x90 ''
+  {   994,  10,  13,  11,    0,  -10 },   // 0x91 ''
+  {  1011,  10,  13,  11,    0,  -10 },   // 0x92 ''
+  {  1028,  10,  13,  11,    0,  -10 },   // 0x93 ''
+  {  1045,  10,  13,  11,    0,  -10 },   // 0x94 ''
+  {  1062,  10,  13,  11,    0,  -10 },   // 0x95 ''
+  {  1079,  10,  13,  11,    0,  -10 },   // 0x96 ''
+  {  1096,  10,  13,  11,    0,  -10 },   // 0x97 ''
+  {  1113,  10,  13,  11,    0,  -10 },   // 0x98 ''
+  {  1130,  10,  13,  11,    0,  -10 },   // 0x99 ''
+  {  1147,  10,  13,  11,    0,  -10 },   // 0x9A ''
+  {  1164,  10,  13,  11,    0,  -10 },   // 0x9B ''
+  {  1181,  10,  13,  11,    0,  -10 },   // 0x9C ''
+  {  1198,  10,  13,  11,    0,  -10 },   // 0x9D ''
+  {  1215,  10,  13,  11,    0,  -10 },   // 0x9E ''
+  {  1232,  10,  13,  11,    0,  -10 },   // 0x9F ''
+  {  1249,   1,   1,   4,    0,    0 },   // 0xA0 ''
+  {  1250,   1,  10,   5,    2,   -6 },   // 0xA1 ''
+  {  1252,   6,  10,   8,    1,   -8 },   // 0xA2 ''
+  {  1260,   7,  10,   8,    0,   -9 },   // 0xA3 ''
+  {  1269,   6,   5,   8,    1,   -6 },   // 0xA4 ''
+  {  1273,   7,  10,   8,    0,   -9 },   // 0xA5 ''
+  {  1282,   1,  13,   4,    1,   -9 },   // 0xA6 ''
+  {  1284,   6,  13,   8,    1,   -9 },   // 0xA7 ''
+  {  1294,   4,   1,   5,    0,   -9 },   // 0xA8 ''
+  {  1295,   9,  10,  11,    1,   -9 },   // 0xA9 ''
+  {  1307,   5,   6,   5,    0,   -9 },   // 0xAA ''
+  {  1311,   5,   5,   7,    1,   -5 },   // 0xAB ''
+  {  1315,   6,   4,   8,    1,   -4 },   // 0xAC ''
+  {  1318,   3,   1,   5,    1,   -3 },   // 0xAD ''
+  {  1319,   9,  10,  11,    1,   -9 },   // 0xAE ''
+  {  1331,   4,   1,   5,    0,   -9 },   // 0xAF ''
+  {  1332,   4,   5,   8,    2,   -9 },   // 0xB0 ''
+  {  1335,   6,   9,   8,    1,   -8 },   // 0xB1 ''
+  {  1342,   4,   6,   5,    0,  -10 },   // 0xB2 ''
+  {  1345,   4,   6,   5,    0,  -10 },   // 0xB3 ''
+  {  1348,   3,   2,   5,    1,   -9 },   // 0xB4 ''
+  {  1349,   6,  11,   8,    1,   -7 },   // 0xB5 ''
+  {  1358,   6,  12,   7,    1,   -9 },   // 0xB6 ''
+  {  1367,   2,   1,   3,    1,   -3 },   // 0xB7 ''
+  {  1368,   3,   3,   5,    1,    1 },   // 0xB8 ''
+  {  1370,   2,   6,   5,    1,  -10 },   // 0xB9 ''
+  {  1372,   3,   6,   5,    1,   -9 },   // 0xBA ''
+  {  1375,   5,   5,   7,    1,   -5 },   // 0xBB ''
+  {  1379,  11,  10,  12,    1,   -9 },   // 0xBC ''
+  {  1393,  11,  10,  12,    1,   -9 },   // 0xBD ''
+  {  1407,  11,  10,  12,    0,   -9 },   // 0xBE ''
+  {  1421,   6,  10,   8,    1,   -6 },   // 0xBF ''
+  {  1429,   9,  13,   9,    0,  -12 },   // 0xC0 ''
+  {  1444,   9,  13,   9,    0,  -12 },   // 0xC1 ''
+  {  1459,   9,  13,   9,    0,  -12 },   // 0xC2 ''
+  {  1474,   9,  12,   9,    0,  -11 },   // 0xC3 ''
+  {  1488,   9,  12,   9,    0,  -11 },   // 0xC4 ''
+  {  1502,   9,  14,   9,    0,  -13 },   // 0xC5 ''
+  {  1518,  13,  10,  13,    0,   -9 },   // 0xC6 ''
+  {  1535,   8,  13,  10,    1,   -9 },   // 0xC7 ''
+  {  1548,   7,  13,   9,    1,  -12 },   // 0xC8 ''
+  {  1560,   7,  13,   9,    1,  -12 },   // 0xC9 ''
+  {  1572,   7,  13,   9,    1,  -12 },   // 0xCA ''
+  {  1584,   7,  12,   9,    1,  -11 },   // 0xCB ''
+  {  1595,   3,  12,   4,    0,  -11 },   // 0xCC ''
+  {  1600,   3,  12,   4,    1,  -11 },   // 0xCD ''
+  {  1605,   4,  12,   4,    0,  -11 },   // 0xCE ''
+  {  1611,   4,  12,   4,    0,  -11 },   // 0xCF ''
+  {  1617,   9,  10,  10,    0,   -9 },   // 0xD0 ''
+  {  1629,   8,  12,  10,    1,  -11 },   // 0xD1 ''
+  {  1641,   9,  13,  11,    1,  -12 },   // 0xD2 ''
+  {  1656,   9,  13,  11,    1,  -12 },   // 0xD3 ''
+  {  1671,   9,  13,  11,    1,  -12 },   // 0xD4 ''
+  {  1686,   9,  12,  11,    1,  -11 },   // 0xD5 ''
+  {  1700,   9,  12,  11,    1,  -11 },   // 0xD6 ''
+  {  1714,   6,   6,   8,    1,   -5 },   // 0xD7 ''
+  {  1719,  10,  10,  11,    0,   -9 },   // 0xD8 ''
+  {  1732,   8,  13,  10,    1,  -12 },   // 0xD9 ''
+  {  1745,   8,  13,  10,    1,  -12 },   // 0xDA ''
+  {  1758,   8,  13,  10,    1,  -12 },   // 0xDB ''
+  {  1771,   8,  12,  10,    1,  -11 },   // 0xDC ''
+  {  1783,   9,  12,   9,    0,  -11 },   // 0xDD ''
+  {  1797,   7,  10,   9,    1,   -9 },   // 0xDE ''
+  {  1806,   7,  10,   8,    1,   -9 },   // 0xDF ''
+  {  1815,   7,  10,   7,    0,   -9 },   // 0xE0 ''
+  {  1824,   7,  10,   7,    0,   -9 },   // 0xE1 ''
+  {  1833,   7,  11,   7,    0,  -10 },   // 0xE2 ''
+  {  1843,   7,  10,   7,    0,   -9 },   // 0xE3 ''
+  {  1852,   7,  10,   7,    0,   -9 },   // 0xE4 ''
+  {  1861,   7,  11,   7,    0,  -10 },   // 0xE5 ''
+  {  1871,  12,   8,  12,    0,   -7 },   // 0xE6 ''
+  {  1883,   7,  11,   7,    0,   -7 },   // 0xE7 ''
+  {  1893,   7,  11,   7,    0,  -10 },   // 0xE8 ''
+  {  1903,   7,  11,   7,    0,  -10 },   // 0xE9 ''
+  {  1913,   7,  11,   7,    0,  -10 },   // 0xEA ''
+  {  1923,   7,  10,   7,    0,   -9 },   // 0xEB ''
+  {  1932,   3,  10,   3,    0,   -9 },   // 0xEC ''
+  {  1936,   3,  10,   3,    0,   -9 },   // 0xED ''
+  {  1940,   4,  11,   4,    0,  -10 },   // 0xEE ''
+  {  1946,   4,  11,   4,    0,  -10 },   // 0xEF ''
+  {  1952,   7,  11,   7,    0,  -10 },   // 0xF0 ''
+  {  1962,   6,  10,   7,    1,   -9 },   // 0xF1 ''
+  {  1970,   7,  11,   7,    0,  -10 },   // 0xF2 ''
+  {  1980,   7,  11,   7,    0,  -10 },   // 0xF3 ''
+  {  1990,   7,  11,   7,    0,  -10 },   // 0xF4 ''
+  {  2000,   7,  10,   7,    0,   -9 },   // 0xF5 ''
+  {  2009,   7,  10,   7,    0,   -9 },   // 0xF6 ''
+  {  2018,   6,   6,   8,    1,   -5 },   // 0xF7 ''
+  {  2023,   7,   8,   7,    0,   -7 },   // 0xF8 ''
+  {  2030,   6,  10,   7,    1,   -9 },   // 0xF9 ''
+  {  2038,   6,  10,   7,    1,   -9 },   // 0xFA ''
+  {  2046,   6,  10,   7,    1,   -9 },   // 0xFB ''
+  {  2054,   6,  10,   7,    1,   -9 },   // 0xFC ''
+  {  2062,   6,  14,   7,    0,  -10 },   // 0xFD ''
+  {  2073,   6,  13,   8,    1,   -9 },   // 0xFE ''
+  {  2083,   6,  13,   7,    0,   -9 } }; // 0xFF ''
+
+constexpr GFXfont FreeSans_RLE_7pt8b PROGMEM = {
+  (uint8_t  *)FreeSans_RLE_7pt8bBitmaps,
+  (GFXglyph *)FreeSans_RLE_7pt8bGlyphs,
+  0x20, 0xFF, 16 };
+
+// Approx. 3668 bytes
@@ -0,0 +1,457 @@
+const uint8_t FreeSans_RLE_8pt8bBitmaps[] PROGMEM = {
+  0x00, 0xFF, 0xB0, 0xBB, 0xAA, 0x12, 0x12, 0x12, 0x7F, 0x32, 0x26, 0x24,
+  0xFF, 0x24, 0x64, 0x4C, 0x10, 0xF3, 0x54, 0xB9, 0x1A, 0x1E, 0x0E, 0x17,
+  0x26, 0x4E, 0xB7, 0xC2, 0x04, 0x00, 0x00, 0x43, 0xC2, 0x13, 0x20, 0x99,
+  0x07, 0x90, 0x01, 0x00, 0x09, 0xC0, 0x99, 0x04, 0x88, 0x46, 0x42, 0x1C,
+  0x38, 0x32, 0x11, 0x0C, 0x83, 0x83, 0x83, 0x25, 0x1E, 0x86, 0x67, 0x9E,
+  0x60, 0xF0, 0x22, 0x44, 0x4C, 0x88, 0x8C, 0x44, 0x42, 0x00, 0x91, 0x26,
+  0x49, 0x25, 0xA5, 0x20, 0x4D, 0x66, 0x00, 0x10, 0x20, 0x47, 0xF1, 0x02,
+  0x04, 0x00, 0xF5, 0x80, 0xE0, 0xF0, 0x11, 0x12, 0x22, 0x44, 0x44, 0x88,
+  0x38, 0x9B, 0x1C, 0x38, 0x70, 0x61, 0xC3, 0xC6, 0x99, 0xE0, 0x27, 0x92,
+  0x49, 0x24, 0x80, 0x79, 0x8E, 0x1C, 0x10, 0x61, 0x8E, 0x30, 0xC1, 0x03,
+  0xF8, 0x3C, 0x66, 0x43, 0x43, 0x06, 0x1C, 0x03, 0x03, 0x43, 0x62, 0x3C,
+  0x06, 0x0E, 0x0E, 0x16, 0x26, 0x66, 0x46, 0xFF, 0x06, 0x06, 0x06, 0x7C,
+  0x83, 0x06, 0x0F, 0xD8, 0xC1, 0x81, 0x87, 0x99, 0xE0, 0x38, 0xCB, 0x1C,
+  0x0B, 0x98, 0xA1, 0xC1, 0x87, 0x89, 0xE0, 0xFE, 0x04, 0x10, 0x60, 0x82,
+  0x04, 0x18, 0x20, 0x41, 0x80, 0x79, 0x9A, 0x1C, 0x3C, 0x4F, 0x31, 0xC1,
+  0x83, 0x8D, 0xE0, 0x79, 0x9A, 0x1C, 0x38, 0x79, 0xDE, 0x83, 0x85, 0x99,
+  0xE0, 0xF0, 0x03, 0xC0, 0xF0, 0x03, 0xD6, 0x00, 0x0C, 0xE7, 0x0C, 0x0E,
+  0x03, 0x81, 0xFE, 0x03, 0xF8, 0x01, 0x80, 0xE0, 0x70, 0x63, 0xB8, 0x40,
+  0x3C, 0x8F, 0x1E, 0x10, 0x61, 0x86, 0x08, 0x10, 0x00, 0x40, 0x80, 0x07,
+  0xC0, 0x61, 0x83, 0x03, 0x18, 0x06, 0xC7, 0x6E, 0x33, 0x38, 0x84, 0x66,
+  0x33, 0x98, 0x8A, 0x66, 0x6C, 0xEF, 0x18, 0x00, 0x30, 0x00, 0x7F, 0x00,
+  0x0C, 0x03, 0x81, 0xA0, 0x68, 0x13, 0x0C, 0xC3, 0x10, 0xFE, 0x61, 0x98,
+  0x24, 0x0F, 0x03, 0xFE, 0x61, 0xB0, 0x58, 0x2C, 0x37, 0xF3, 0x0D, 0x83,
+  0xC1, 0xE0, 0xF0, 0xDF, 0xC0, 0x3E, 0x31, 0xB0, 0x78, 0x18, 0x04, 0x02,
+  0x01, 0x01, 0xC0, 0xE0, 0xDC, 0xC7, 0xC0, 0xFE, 0x61, 0xB0, 0x78, 0x3C,
+  0x0E, 0x07, 0x03, 0x81, 0xC1, 0xE0, 0xF0, 0xDF, 0xC0, 0xFF, 0xC0, 0xC0,
+  0xC0, 0xC0, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xC0, 0xC0,
+  0xC0, 0xC0, 0xFE, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x1F, 0x1C, 0xE4,
+  0x0F, 0x03, 0x80, 0x20, 0x08, 0x7E, 0x01, 0xC0, 0x70, 0x37, 0x1C, 0x7D,
+  0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x0F, 0xFF, 0x03, 0x81, 0xC0, 0xE0, 0x70,
+  0x38, 0x10, 0xFF, 0xF0, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x8E, 0x3C,
+  0xDE, 0xC1, 0xE1, 0xB1, 0x99, 0x8D, 0x87, 0xC3, 0xB1, 0x88, 0xC6, 0x61,
+  0xB0, 0x58, 0x30, 0xC1, 0x83, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC1, 0x83,
+  0x07, 0xF0, 0xC0, 0x7C, 0x1F, 0x82, 0xF0, 0x5F, 0x0B, 0xA2, 0x74, 0x4E,
+  0xC9, 0xCB, 0x39, 0x47, 0x38, 0xE3, 0x10, 0xC0, 0xF0, 0x78, 0x3E, 0x1D,
+  0x8E, 0x47, 0x33, 0x89, 0xC6, 0xE1, 0xF0, 0x78, 0x30, 0x1F, 0x0E, 0x71,
+  0x03, 0x60, 0x28, 0x07, 0x00, 0xE0, 0x1C, 0x03, 0xC0, 0x48, 0x19, 0xCE,
+  0x0F, 0x80, 0xFE, 0xC3, 0xC1, 0xC1, 0xC1, 0xC3, 0xFE, 0xC0, 0xC0, 0xC0,
+  0xC0, 0xC0, 0x1F, 0x0E, 0x71, 0x03, 0x60, 0x28, 0x07, 0x00, 0xE0, 0x1C,
+  0x03, 0xC2, 0x48, 0x79, 0xCE, 0x0F, 0xE0, 0x00, 0xFF, 0x61, 0xF0, 0x78,
+  0x3C, 0x1E, 0x1B, 0xFD, 0x83, 0xC1, 0xE0, 0xF0, 0x78, 0x30, 0x3E, 0x31,
+  0xB0, 0x58, 0x2C, 0x03, 0xE0, 0x3C, 0x03, 0x81, 0xE0, 0xD8, 0xC7, 0xC0,
+  0xFF, 0x86, 0x03, 0x01, 0x80, 0xC0, 0x60, 0x30, 0x18, 0x0C, 0x06, 0x03,
+  0x01, 0x80, 0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x0E, 0x07, 0x03, 0x81, 0xC0,
+  0xE0, 0xD8, 0xC7, 0xC0, 0xC0, 0xD0, 0x26, 0x09, 0x86, 0x21, 0x0C, 0x43,
+  0x30, 0x48, 0x1A, 0x07, 0x80, 0xC0, 0x30, 0xC3, 0x05, 0x0E, 0x34, 0x38,
+  0xD8, 0xA3, 0x66, 0x88, 0x93, 0x22, 0x4D, 0x8D, 0x16, 0x3C, 0x50, 0x61,
+  0xC1, 0x83, 0x06, 0x0C, 0x60, 0xD8, 0x63, 0x10, 0x4C, 0x1E, 0x03, 0x00,
+  0xC0, 0x78, 0x13, 0x0C, 0x46, 0x19, 0x03, 0x40, 0xD8, 0x22, 0x18, 0xC4,
+  0x1B, 0x02, 0x80, 0xE0, 0x10, 0x04, 0x01, 0x00, 0x40, 0x10, 0x7F, 0x80,
+  0xC0, 0xC0, 0x60, 0x60, 0x60, 0x20, 0x30, 0x30, 0x30, 0x10, 0x1F, 0xF0,
+  0xF2, 0x49, 0x24, 0x92, 0x49, 0x38, 0x88, 0x44, 0x44, 0x22, 0x21, 0x11,
+  0xE4, 0x92, 0x49, 0x24, 0x92, 0x78, 0x21, 0xC5, 0x12, 0x8A, 0x20, 0xFF,
+  0x80, 0x42, 0x3C, 0x66, 0x42, 0x02, 0x7E, 0x42, 0xC2, 0x46, 0x7B, 0x81,
+  0x02, 0x05, 0xEE, 0x78, 0xE0, 0xC1, 0x83, 0x87, 0x15, 0xC0, 0x3C, 0xCD,
+  0x0A, 0x0C, 0x08, 0x10, 0xB3, 0x3C, 0x01, 0x01, 0x01, 0x3D, 0x67, 0x43,
+  0x43, 0xC1, 0x43, 0x43, 0x67, 0x3D, 0x3C, 0x66, 0x43, 0x43, 0xFF, 0x40,
+  0x43, 0x66, 0x3C, 0x36, 0x6F, 0x66, 0x66, 0x66, 0x66, 0x3F, 0x67, 0x43,
+  0x43, 0xC3, 0x43, 0x43, 0x67, 0x3B, 0x02, 0x62, 0x3C, 0x82, 0x08, 0x2F,
+  0xC7, 0x18, 0x61, 0x86, 0x18, 0x61, 0xDF, 0xF0, 0x6C, 0x36, 0xDB, 0x6D,
+  0xB6, 0xF0, 0x81, 0x02, 0x04, 0x69, 0x96, 0x2C, 0x68, 0x99, 0x12, 0x34,
+  0x30, 0xFF, 0xF0, 0xB9, 0xD9, 0xCE, 0x11, 0xC2, 0x38, 0x47, 0x08, 0xE1,
+  0x1C, 0x23, 0x84, 0x60, 0xBF, 0x1C, 0x61, 0x86, 0x18, 0x61, 0x84, 0x3C,
+  0x66, 0x43, 0x43, 0xC1, 0x43, 0x43, 0x66, 0x3C, 0xBD, 0xCF, 0x1C, 0x18,
+  0x30, 0x70, 0xF3, 0xBD, 0x02, 0x04, 0x00, 0x3D, 0x67, 0x43, 0x43, 0xC1,
+  0x43, 0x43, 0x67, 0x3D, 0x01, 0x01, 0x01, 0xBE, 0xC8, 0x88, 0x88, 0x80,
+  0x7B, 0x38, 0xF0, 0x78, 0x38, 0x73, 0x78, 0x66, 0xF6, 0x66, 0x66, 0x66,
+  0x30, 0x86, 0x18, 0x61, 0x86, 0x18, 0x73, 0x7C, 0xC2, 0x42, 0x46, 0x64,
+  0x24, 0x2C, 0x38, 0x18, 0x18, 0xC6, 0x29, 0xCD, 0x29, 0x25, 0x26, 0xA4,
+  0x57, 0x8E, 0x61, 0x8C, 0x31, 0x80, 0x46, 0xC8, 0xB1, 0xC1, 0x87, 0x0B,
+  0x32, 0xC6, 0xC2, 0x8D, 0x13, 0x22, 0xC5, 0x0E, 0x0C, 0x10, 0x20, 0xC3,
+  0x00, 0x7E, 0x0C, 0x30, 0x41, 0x06, 0x18, 0x20, 0xFE, 0x69, 0x24, 0x94,
+  0xC9, 0x24, 0x98, 0xFF, 0xFE, 0xC4, 0x44, 0x44, 0x63, 0x64, 0x44, 0x44,
+  0xC0, 0xC6, 0xD1, 0xC0, 0xFF, 0xF0, 0x06, 0x7C, 0xD8, 0x9A, 0x1B, 0x43,
+  0x60, 0xCC, 0x31, 0x84, 0x31, 0x86, 0x00, 0xC6, 0x18, 0xC3, 0x00, 0x7F,
+  0xF8, 0xFF, 0xF0, 0x06, 0x7C, 0xD8, 0x9A, 0x1B, 0x43, 0x60, 0xCC, 0x31,
+  0x84, 0x31, 0x86, 0x00, 0xC6, 0x18, 0xC3, 0x00, 0x7F, 0xF8, 0xFF, 0xF0,
+  0x06, 0x7C, 0xD8, 0x9A, 0x1B, 0x43, 0x60, 0xCC, 0x31, 0x84, 0x31, 0x86,
+  0x00, 0xC6, 0x18, 0xC3, 0x00, 0x7F, 0xF8, 0xFF, 0xF0, 0x06, 0x7C, 0xD8,
+  0x9A, 0x1B, 0x43, 0x60, 0xCC, 0x31, 0x84, 0x31, 0x86, 0x00, 0xC6, 0x18,
+  0xC3, 0x00, 0x7F, 0xF8, 0xFF, 0xF0, 0x06, 0x7C, 0xD8, 0x9A, 0x1B, 0x43,
+  0x60, 0xCC, 0x31, 0x84, 0x31, 0x86, 0x00, 0xC6, 0x18, 0xC3, 0x00, 0x7F,
+  0xF8, 0xFF, 0xF0, 0x06, 0x7C, 0xD8, 0x9A, 0x1B, 0x43, 0x60, 0xCC, 0x31,
+  0x84, 0x31, 0x86, 0x00, 0xC6, 0x18, 0xC3, 0x00, 0x7F, 0xF8, 0xFF, 0xF0,
+  0x06, 0x7C, 0xD8, 0x9A, 0x1B, 0x43, 0x60, 0xCC, 0x31, 0x84, 0x31, 0x86,
+  0x00, 0xC6, 0x18, 0xC3, 0x00, 0x7F, 0xF8, 0xFF, 0xF0, 0x06, 0x7C, 0xD8,
+  0x9A, 0x1B, 0x43, 0x60, 0xCC, 0x31, 0x84, 0x31, 0x86, 0x00, 0xC6, 0x18,
+  0xC3, 0x00, 0x7F, 0xF8, 0xFF, 0xF0, 0x06, 0x7C, 0xD8, 0x9A, 0x1B, 0x43,
+  0x60, 0xCC, 0x31, 0x84, 0x31, 0x86, 0x00, 0xC6, 0x18, 0xC3, 0x00, 0x7F,
+  0xF8, 0xFF, 0xF0, 0x06, 0x7C, 0xD8, 0x9A, 0x1B, 0x43, 0x60, 0xCC, 0x31,
+  0x84, 0x31, 0x86, 0x00, 0xC6, 0x18, 0xC3, 0x00, 0x7F, 0xF8, 0xFF, 0xF0,
+  0x06, 0x7C, 0xD8, 0x9A, 0x1B, 0x43, 0x60, 0xCC, 0x31, 0x84, 0x31, 0x86,
+  0x00, 0xC6, 0x18, 0xC3, 0x00, 0x7F, 0xF8, 0xFF, 0xF0, 0x06, 0x7C, 0xD8,
+  0x9A, 0x1B, 0x43, 0x60, 0xCC, 0x31, 0x84, 0x31, 0x86, 0x00, 0xC6, 0x18,
+  0xC3, 0x00, 0x7F, 0xF8, 0xFF, 0xF0, 0x06, 0x7C, 0xD8, 0x9A, 0x1B, 0x43,
+  0x60, 0xCC, 0x31, 0x84, 0x31, 0x86, 0x00, 0xC6, 0x18, 0xC3, 0x00, 0x7F,
+  0xF8, 0xFF, 0xF0, 0x06, 0x7C, 0xD8, 0x9A, 0x1B, 0x43, 0x60, 0xCC, 0x31,
+  0x84, 0x31, 0x86, 0x00, 0xC6, 0x18, 0xC3, 0x00, 0x7F, 0xF8, 0xFF, 0xF0,
+  0x06, 0x7C, 0xD8, 0x9A, 0x1B, 0x43, 0x60, 0xCC, 0x31, 0x84, 0x31, 0x86,
+  0x00, 0xC6, 0x18, 0xC3, 0x00, 0x7F, 0xF8, 0xFF, 0xF0, 0x06, 0x7C, 0xD8,
+  0x9A, 0x1B, 0x43, 0x60, 0xCC, 0x31, 0x84, 0x31, 0x86, 0x00, 0xC6, 0x18,
+  0xC3, 0x00, 0x7F, 0xF8, 0xFF, 0xF0, 0x06, 0x7C, 0xD8, 0x9A, 0x1B, 0x43,
+  0x60, 0xCC, 0x31, 0x84, 0x31, 0x86, 0x00, 0xC6, 0x18, 0xC3, 0x00, 0x7F,
+  0xF8, 0xFF, 0xF0, 0x06, 0x7C, 0xD8, 0x9A, 0x1B, 0x43, 0x60, 0xCC, 0x31,
+  0x84, 0x31, 0x86, 0x00, 0xC6, 0x18, 0xC3, 0x00, 0x7F, 0xF8, 0xFF, 0xF0,
+  0x06, 0x7C, 0xD8, 0x9A, 0x1B, 0x43, 0x60, 0xCC, 0x31, 0x84, 0x31, 0x86,
+  0x00, 0xC6, 0x18, 0xC3, 0x00, 0x7F, 0xF8, 0xFF, 0xF0, 0x06, 0x7C, 0xD8,
+  0x9A, 0x1B, 0x43, 0x60, 0xCC, 0x31, 0x84, 0x31, 0x86, 0x00, 0xC6, 0x18,
+  0xC3, 0x00, 0x7F, 0xF8, 0xFF, 0xF0, 0x06, 0x7C, 0xD8, 0x9A, 0x1B, 0x43,
+  0x60, 0xCC, 0x31, 0x84, 0x31, 0x86, 0x00, 0xC6, 0x18, 0xC3, 0x00, 0x7F,
+  0xF8, 0xFF, 0xF0, 0x06, 0x7C, 0xD8, 0x9A, 0x1B, 0x43, 0x60, 0xCC, 0x31,
+  0x84, 0x31, 0x86, 0x00, 0xC6, 0x18, 0xC3, 0x00, 0x7F, 0xF8, 0xFF, 0xF0,
+  0x06, 0x7C, 0xD8, 0x9A, 0x1B, 0x43, 0x60, 0xCC, 0x31, 0x84, 0x31, 0x86,
+  0x00, 0xC6, 0x18, 0xC3, 0x00, 0x7F, 0xF8, 0xFF, 0xF0, 0x06, 0x7C, 0xD8,
+  0x9A, 0x1B, 0x43, 0x60, 0xCC, 0x31, 0x84, 0x31, 0x86, 0x00, 0xC6, 0x18,
+  0xC3, 0x00, 0x7F, 0xF8, 0xFF, 0xF0, 0x06, 0x7C, 0xD8, 0x9A, 0x1B, 0x43,
+  0x60, 0xCC, 0x31, 0x84, 0x31, 0x86, 0x00, 0xC6, 0x18, 0xC3, 0x00, 0x7F,
+  0xF8, 0xFF, 0xF0, 0x06, 0x7C, 0xD8, 0x9A, 0x1B, 0x43, 0x60, 0xCC, 0x31,
+  0x84, 0x31, 0x86, 0x00, 0xC6, 0x18, 0xC3, 0x00, 0x7F, 0xF8, 0xFF, 0xF0,
+  0x06, 0x7C, 0xD8, 0x9A, 0x1B, 0x43, 0x60, 0xCC, 0x31, 0x84, 0x31, 0x86,
+  0x00, 0xC6, 0x18, 0xC3, 0x00, 0x7F, 0xF8, 0xFF, 0xF0, 0x06, 0x7C, 0xD8,
+  0x9A, 0x1B, 0x43, 0x60, 0xCC, 0x31, 0x84, 0x31, 0x86, 0x00, 0xC6, 0x18,
+  0xC3, 0x00, 0x7F, 0xF8, 0xFF, 0xF0, 0x06, 0x7C, 0xD8, 0x9A, 0x1B, 0x43,
+  0x60, 0xCC, 0x31, 0x84, 0x31, 0x86, 0x00, 0xC6, 0x18, 0xC3, 0x00, 0x7F,
+  0xF8, 0xFF, 0xF0, 0x06, 0x7C, 0xD8, 0x9A, 0x1B, 0x43, 0x60, 0xCC, 0x31,
+  0x84, 0x31, 0x86, 0x00, 0xC6, 0x18, 0xC3, 0x00, 0x7F, 0xF8, 0xFF, 0xF0,
+  0x06, 0x7C, 0xD8, 0x9A, 0x1B, 0x43, 0x60, 0xCC, 0x31, 0x84, 0x31, 0x86,
+  0x00, 0xC6, 0x18, 0xC3, 0x00, 0x7F, 0xF8, 0xFF, 0xF0, 0x06, 0x7C, 0xD8,
+  0x9A, 0x1B, 0x43, 0x60, 0xCC, 0x31, 0x84, 0x31, 0x86, 0x00, 0xC6, 0x18,
+  0xC3, 0x00, 0x7F, 0xF8, 0xFF, 0xF0, 0x06, 0x7C, 0xD8, 0x9A, 0x1B, 0x43,
+  0x60, 0xCC, 0x31, 0x84, 0x31, 0x86, 0x00, 0xC6, 0x18, 0xC3, 0x00, 0x7F,
+  0xF8, 0x00, 0xBF, 0xE0, 0x10, 0x79, 0x56, 0xB9, 0x12, 0x24, 0x6B, 0x56,
+  0x78, 0x40, 0x80, 0x1E, 0x62, 0x43, 0x41, 0x40, 0x60, 0xFC, 0x30, 0x30,
+  0x20, 0x7D, 0x4F, 0x01, 0xF9, 0x16, 0x24, 0x5F, 0x80, 0x00, 0xC1, 0x21,
+  0x88, 0x86, 0x81, 0x43, 0xF8, 0x20, 0xFE, 0x08, 0x04, 0x02, 0x00, 0xFC,
+  0xFE, 0x38, 0x99, 0x13, 0x07, 0x13, 0xA1, 0xC1, 0xE2, 0x6C, 0x60, 0x6C,
+  0x59, 0x9E, 0x00, 0xDE, 0xC0, 0x1F, 0x0C, 0x11, 0x39, 0x48, 0xBA, 0x03,
+  0x40, 0x68, 0x4C, 0x8B, 0x5E, 0x4C, 0x10, 0x7C, 0x00, 0xE9, 0x3D, 0x9F,
+  0x0F, 0x45, 0x29, 0x32, 0x44, 0xFF, 0x03, 0x03, 0x03, 0x03, 0xE0, 0x1F,
+  0x0C, 0x11, 0x79, 0x48, 0xB9, 0x13, 0x3C, 0x64, 0x4C, 0x8B, 0x51, 0x4C,
+  0x10, 0x7C, 0x00, 0xF8, 0x72, 0x62, 0x97, 0x00, 0x10, 0x20, 0x47, 0xF1,
+  0x02, 0x04, 0x00, 0x01, 0xFC, 0x72, 0x62, 0x36, 0x23, 0xE0, 0x72, 0x42,
+  0x60, 0xC5, 0xC0, 0x24, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0xCE,
+  0xF7, 0x80, 0x80, 0x80, 0x7F, 0xEB, 0xD7, 0xAF, 0x5E, 0x9D, 0x0A, 0x14,
+  0x28, 0x50, 0xA1, 0x42, 0x80, 0xF0, 0x4C, 0xF0, 0x3C, 0x92, 0x40, 0x69,
+  0x99, 0x96, 0x0F, 0x93, 0x66, 0x53, 0x90, 0x40, 0x4C, 0x08, 0x41, 0x04,
+  0x10, 0x42, 0x04, 0x22, 0x44, 0x60, 0x8A, 0x08, 0xA1, 0x1F, 0x20, 0x20,
+  0x40, 0x04, 0x08, 0xC0, 0x84, 0x10, 0x42, 0x04, 0x26, 0x44, 0x90, 0x89,
+  0x08, 0x31, 0x04, 0x20, 0x82, 0x1F, 0x70, 0x02, 0x41, 0x02, 0x10, 0x61,
+  0x00, 0x88, 0x64, 0x89, 0xC8, 0xC0, 0x4A, 0x04, 0x50, 0x27, 0xC2, 0x04,
+  0x20, 0x20, 0x18, 0x00, 0x00, 0xC1, 0x86, 0x18, 0x20, 0x42, 0x85, 0xF0,
+  0x08, 0x01, 0x00, 0x00, 0x30, 0x0E, 0x06, 0x81, 0xA0, 0x4C, 0x33, 0x0C,
+  0x43, 0xF9, 0x86, 0x60, 0x90, 0x3C, 0x0C, 0x06, 0x01, 0x00, 0x00, 0x30,
+  0x0E, 0x06, 0x81, 0xA0, 0x4C, 0x33, 0x0C, 0x43, 0xF9, 0x86, 0x60, 0x90,
+  0x3C, 0x0C, 0x0C, 0x06, 0x80, 0x00, 0x30, 0x0E, 0x06, 0x81, 0xA0, 0x4C,
+  0x33, 0x0C, 0x43, 0xF9, 0x86, 0x60, 0x90, 0x3C, 0x0C, 0x08, 0x07, 0xC1,
+  0x00, 0x30, 0x0E, 0x06, 0x81, 0xA0, 0x4C, 0x33, 0x0C, 0x43, 0xF9, 0x86,
+  0x60, 0x90, 0x3C, 0x0C, 0x1B, 0x06, 0xC0, 0x00, 0x30, 0x0E, 0x06, 0x81,
+  0xA0, 0x4C, 0x33, 0x0C, 0x43, 0xF9, 0x86, 0x60, 0x90, 0x3C, 0x0C, 0x0C,
+  0x02, 0x80, 0xC0, 0x00, 0x0C, 0x03, 0x81, 0xA0, 0x68, 0x13, 0x0C, 0xC3,
+  0x10, 0xFE, 0x61, 0x98, 0x24, 0x0F, 0x03, 0x07, 0xFE, 0x1B, 0x00, 0x26,
+  0x00, 0x4C, 0x01, 0x98, 0x02, 0x3F, 0x8C, 0x60, 0x1F, 0xC0, 0x21, 0x80,
+  0xC3, 0x01, 0x06, 0x06, 0x0F, 0xF0, 0x3E, 0x31, 0xB0, 0x78, 0x18, 0x04,
+  0x02, 0x01, 0x01, 0xC0, 0xE0, 0xD8, 0xC7, 0xC0, 0x80, 0x60, 0xF0, 0x10,
+  0x08, 0x00, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xC0, 0xFF, 0x0C, 0x10, 0x00, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xC0,
+  0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0x18, 0x34, 0x00, 0xFF, 0xC0, 0xC0, 0xC0,
+  0xC0, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0x34, 0x34, 0x00, 0xFF,
+  0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0x42,
+  0x02, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x70, 0x24, 0x92, 0x49, 0x24,
+  0x90, 0x62, 0x80, 0x42, 0x10, 0x84, 0x21, 0x08, 0x42, 0x10, 0x80, 0xDE,
+  0xC0, 0x42, 0x10, 0x84, 0x21, 0x08, 0x42, 0x10, 0x80, 0x7F, 0x18, 0x66,
+  0x0D, 0x81, 0x60, 0x7F, 0x16, 0x05, 0x81, 0x60, 0x58, 0x36, 0x19, 0xFC,
+  0x00, 0x0F, 0x08, 0x18, 0x1E, 0x0F, 0x07, 0xC3, 0xB1, 0xC8, 0xE6, 0x71,
+  0x38, 0xDC, 0x3E, 0x0F, 0x06, 0x18, 0x00, 0x80, 0x00, 0x0F, 0x87, 0x38,
+  0x81, 0xB0, 0x14, 0x03, 0x80, 0x70, 0x0E, 0x01, 0xE0, 0x24, 0x0C, 0xE7,
+  0x07, 0xC0, 0x06, 0x01, 0x80, 0x00, 0x0F, 0x87, 0x38, 0x81, 0xB0, 0x14,
+  0x03, 0x80, 0x70, 0x0E, 0x01, 0xE0, 0x24, 0x0C, 0xE7, 0x07, 0xC0, 0x0C,
+  0x03, 0x40, 0x00, 0x0F, 0x87, 0x38, 0x81, 0xB0, 0x14, 0x03, 0x80, 0x70,
+  0x0E, 0x01, 0xE0, 0x24, 0x0C, 0xE7, 0x07, 0xC0, 0x00, 0x03, 0xC0, 0x40,
+  0x0F, 0x87, 0x38, 0x81, 0xB0, 0x14, 0x03, 0x80, 0x70, 0x0E, 0x01, 0xE0,
+  0x24, 0x0C, 0xE7, 0x07, 0xC0, 0x1A, 0x03, 0x40, 0x00, 0x0F, 0x87, 0x38,
+  0x81, 0xB0, 0x14, 0x03, 0x80, 0x70, 0x0E, 0x01, 0xE0, 0x24, 0x0C, 0xE7,
+  0x07, 0xC0, 0x00, 0x88, 0xA0, 0x82, 0x88, 0x80, 0x1F, 0x6E, 0x79, 0x03,
+  0x60, 0xA8, 0x27, 0x08, 0xE2, 0x1C, 0x83, 0xE0, 0x48, 0x1B, 0xCE, 0x4F,
+  0x80, 0x18, 0x06, 0x00, 0x18, 0x1C, 0x0E, 0x07, 0x03, 0x81, 0xC0, 0xE0,
+  0x70, 0x38, 0x1C, 0x1B, 0x18, 0xF8, 0x04, 0x04, 0x00, 0x18, 0x1C, 0x0E,
+  0x07, 0x03, 0x81, 0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x1B, 0x18, 0xF8, 0x0C,
+  0x0B, 0x00, 0x18, 0x1C, 0x0E, 0x07, 0x03, 0x81, 0xC0, 0xE0, 0x70, 0x38,
+  0x1C, 0x1B, 0x18, 0xF8, 0x16, 0x0B, 0x00, 0x18, 0x1C, 0x0E, 0x07, 0x03,
+  0x81, 0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x1B, 0x18, 0xF8, 0x06, 0x03, 0x00,
+  0x01, 0x03, 0x60, 0x88, 0x63, 0x10, 0x6C, 0x0A, 0x03, 0x80, 0x40, 0x10,
+  0x04, 0x01, 0x00, 0x40, 0xC0, 0xC0, 0xFE, 0xC3, 0xC1, 0xC1, 0xC1, 0xC3,
+  0xFE, 0xC0, 0xC0, 0xC0, 0x3C, 0x46, 0xC2, 0xC2, 0xC6, 0xDC, 0xC6, 0xC3,
+  0xC3, 0xC2, 0xC6, 0xDC, 0x10, 0x08, 0x00, 0x3C, 0x66, 0x42, 0x02, 0x7E,
+  0x42, 0xC2, 0x46, 0x7B, 0x0C, 0x18, 0x00, 0x3C, 0x66, 0x42, 0x02, 0x7E,
+  0x42, 0xC2, 0x46, 0x7B, 0x18, 0x14, 0x00, 0x3C, 0x66, 0x42, 0x02, 0x7E,
+  0x42, 0xC2, 0x46, 0x7B, 0x32, 0x2C, 0x3C, 0x66, 0x42, 0x02, 0x7E, 0x42,
+  0xC2, 0x46, 0x7B, 0x36, 0x36, 0x00, 0x3C, 0x66, 0x42, 0x02, 0x7E, 0x42,
+  0xC2, 0x46, 0x7B, 0x18, 0x14, 0x14, 0x18, 0x3C, 0x66, 0x42, 0x02, 0x7E,
+  0x42, 0xC2, 0x46, 0x7B, 0x3C, 0xE3, 0x38, 0x90, 0xC6, 0x04, 0x13, 0xFF,
+  0xA1, 0x03, 0x08, 0x28, 0xA3, 0x78, 0xE0, 0x3C, 0xCD, 0x0A, 0x0C, 0x08,
+  0x10, 0xB3, 0x3C, 0x20, 0x61, 0xC0, 0x10, 0x08, 0x00, 0x3C, 0x66, 0x43,
+  0x43, 0xFF, 0x40, 0x43, 0x66, 0x3C, 0x0C, 0x08, 0x00, 0x3C, 0x66, 0x43,
+  0x43, 0xFF, 0x40, 0x43, 0x66, 0x3C, 0x18, 0x14, 0x00, 0x3C, 0x66, 0x43,
+  0x43, 0xFF, 0x40, 0x43, 0x66, 0x3C, 0x36, 0x36, 0x00, 0x3C, 0x66, 0x43,
+  0x43, 0xFF, 0x40, 0x43, 0x66, 0x3C, 0xCC, 0x24, 0x92, 0x49, 0x20, 0x68,
+  0x24, 0x92, 0x49, 0x20, 0x69, 0x06, 0x66, 0x66, 0x66, 0x66, 0x99, 0x06,
+  0x66, 0x66, 0x66, 0x66, 0x6C, 0x38, 0x0C, 0x3E, 0x66, 0x43, 0x43, 0xC1,
+  0x43, 0x43, 0x66, 0x3C, 0x65, 0x6B, 0xF1, 0xC6, 0x18, 0x61, 0x86, 0x18,
+  0x40, 0x10, 0x08, 0x00, 0x3C, 0x66, 0x43, 0x43, 0xC1, 0x43, 0x43, 0x66,
+  0x3C, 0x0C, 0x08, 0x10, 0x3C, 0x66, 0x43, 0x43, 0xC1, 0x43, 0x43, 0x66,
+  0x3C, 0x18, 0x34, 0x00, 0x3C, 0x66, 0x43, 0x43, 0xC1, 0x43, 0x43, 0x66,
+  0x3C, 0x32, 0x2C, 0x3C, 0x66, 0x43, 0x43, 0xC1, 0x43, 0x43, 0x66, 0x3C,
+  0x34, 0x34, 0x00, 0x3C, 0x66, 0x43, 0x43, 0xC1, 0x43, 0x43, 0x66, 0x3C,
+  0x10, 0x20, 0x00, 0x0F, 0xE0, 0x04, 0x08, 0x3D, 0x66, 0x47, 0x47, 0xCB,
+  0xD3, 0x63, 0x66, 0xBC, 0x60, 0xC0, 0x21, 0x86, 0x18, 0x61, 0x86, 0x1C,
+  0xDF, 0x18, 0x40, 0x21, 0x86, 0x18, 0x61, 0x86, 0x1C, 0xDF, 0x31, 0xA0,
+  0x21, 0x86, 0x18, 0x61, 0x86, 0x1C, 0xDF, 0x69, 0xA0, 0x21, 0x86, 0x18,
+  0x61, 0x86, 0x1C, 0xDF, 0x0C, 0x30, 0x06, 0x14, 0x68, 0x99, 0x16, 0x28,
+  0x70, 0x60, 0x81, 0x06, 0x18, 0x00, 0x81, 0x02, 0x05, 0xEE, 0x58, 0xE0,
+  0xC1, 0x83, 0x8F, 0x1D, 0xE8, 0x10, 0x20, 0x00, 0x24, 0x48, 0x06, 0x14,
+  0x68, 0x99, 0x16, 0x28, 0x70, 0x60, 0x81, 0x06, 0x18, 0x00 };
+
+constexpr GFXglyph FreeSans_RLE_8pt8bGlyphs[] PROGMEM = {
+  {     0,   1,   1,   4,    0,    0 },   // 0x20 ' '
+  {     1,   1,  12,   5,    2,  -11 },   // 0x21 '!'
+  {     3,   4,   4,   5,    1,  -10 },   // 0x22 '"'
+  {     5,   8,  11,   9,    0,  -10 },   // 0x23 '#'
+  {    16,   7,  15,   9,    1,  -12 },   // 0x24 '$'
+  {    30,  13,  11,  14,    0,  -10 },   // 0x25 '%'
+  {    48,   9,  11,  10,    1,  -10 },   // 0x26 '&'
+  {    61,   1,   4,   3,    1,  -10 },   // 0x27 '''
+  {    62,   4,  15,   5,    1,  -11 },   // 0x28 '('
+  {    70,   3,  15,   5,    1,  -11 },   // 0x29 ')'
+  {    76,   4,   5,   6,    1,  -11 },   // 0x2A '*'
+  {    79,   7,   7,   9,    1,   -6 },   // 0x2B '+'
+  {    86,   2,   5,   4,    1,   -1 },   // 0x2C ','
+  {    88,   3,   1,   5,    1,   -4 },   // 0x2D '-'
+  {    89,   2,   2,   4,    1,   -1 },   // 0x2E '.'
+  {    90,   4,  12,   4,    0,  -11 },   // 0x2F '/'
+  {    96,   7,  11,   9,    1,  -10 },   // 0x30 '0'
+  {   106,   3,  11,   9,    2,  -10 },   // 0x31 '1'
+  {   111,   7,  11,   9,    1,  -10 },   // 0x32 '2'
+  {   121,   8,  11,   9,    0,  -10 },   // 0x33 '3'
+  {   132,   8,  11,   9,    0,  -10 },   // 0x34 '4'
+  {   143,   7,  11,   9,    1,  -10 },   // 0x35 '5'
+  {   153,   7,  11,   9,    1,  -10 },   // 0x36 '6'
+  {   163,   7,  11,   9,    1,  -10 },   // 0x37 '7'
+  {   173,   7,  11,   9,    1,  -10 },   // 0x38 '8'
+  {   183,   7,  11,   9,    1,  -10 },   // 0x39 '9'
+  {   193,   2,   9,   4,    1,   -8 },   // 0x3A ':'
+  {   196,   2,  12,   4,    1,   -8 },   // 0x3B ';'
+  {   199,   7,   8,   9,    1,   -7 },   // 0x3C '<'
+  {   206,   7,   3,   9,    1,   -4 },   // 0x3D '='
+  {   209,   7,   8,   9,    1,   -7 },   // 0x3E '>'
+  {   216,   7,  12,   9,    1,  -11 },   // 0x3F '?'
+  {   227,  14,  14,  16,    1,  -11 },   // 0x40 '@'
+  {   252,  10,  12,  10,    0,  -11 },   // 0x41 'A'
+  {   267,   9,  12,  10,    1,  -11 },   // 0x42 'B'
+  {   281,   9,  12,  11,    1,  -11 },   // 0x43 'C'
+  {   295,   9,  12,  11,    1,  -11 },   // 0x44 'D'
+  {   309,   8,  12,  10,    1,  -11 },   // 0x45 'E'
+  {   321,   8,  12,   9,    1,  -11 },   // 0x46 'F'
+  {   333,  10,  12,  12,    1,  -11 },   // 0x47 'G'
+  {   348,   9,  12,  11,    1,  -11 },   // 0x48 'H'
+  {   362,   1,  12,   4,    2,  -11 },   // 0x49 'I'
+  {   364,   6,  12,   8,    1,  -11 },   // 0x4A 'J'
+  {   373,   9,  12,  11,    1,  -11 },   // 0x4B 'K'
+  {   387,   7,  12,   9,    1,  -11 },   // 0x4C 'L'
+  {   398,  11,  12,  13,    1,  -11 },   // 0x4D 'M'
+  {   415,   9,  12,  11,    1,  -11 },   // 0x4E 'N'
+  {   429,  11,  12,  12,    1,  -11 },   // 0x4F 'O'
+  {   446,   8,  12,  10,    1,  -11 },   // 0x50 'P'
+  {   458,  11,  13,  12,    1,  -11 },   // 0x51 'Q'
+  {   476,   9,  12,  11,    1,  -11 },   // 0x52 'R'
+  {   490,   9,  12,  10,    1,  -11 },   // 0x53 'S'
+  {   504,   9,  12,  10,    0,  -11 },   // 0x54 'T'
+  {   518,   9,  12,  11,    1,  -11 },   // 0x55 'U'
+  {   532,  10,  12,  10,    0,  -11 },   // 0x56 'V'
+  {   547,  14,  12,  15,    0,  -11 },   // 0x57 'W'
+  {   568,  10,  12,  10,    0,  -11 },   // 0x58 'X'
+  {   583,  10,  12,  11,    0,  -11 },   // 0x59 'Y'
+  {   598,   9,  12,  10,    0,  -11 },   // 0x5A 'Z'
+  {   612,   3,  15,   4,    1,  -11 },   // 0x5B '['
+  {   618,   4,  12,   4,    0,  -11 },   // 0x5C '\'
+  {   624,   3,  15,   4,    0,  -11 },   // 0x5D ']'
+  {   630,   6,   6,   7,    1,  -10 },   // 0x5E '^'
+  {   635,   9,   1,   9,    0,    3 },   // 0x5F '_'
+  {   637,   4,   2,   4,    0,  -11 },   // 0x60 '`'
+  {   638,   8,   9,   9,    0,   -8 },   // 0x61 'a'
+  {   647,   7,  12,   9,    1,  -11 },   // 0x62 'b'
+  {   658,   7,   9,   8,    0,   -8 },   // 0x63 'c'
+  {   666,   8,  12,   9,    0,  -11 },   // 0x64 'd'
+  {   678,   8,   9,   8,    0,   -8 },   // 0x65 'e'
+  {   687,   4,  12,   4,    0,  -11 },   // 0x66 'f'
+  {   693,   8,  12,   9,    0,   -8 },   // 0x67 'g'
+  {   705,   6,  12,   8,    1,  -11 },   // 0x68 'h'
+  {   714,   1,  12,   3,    1,  -11 },   // 0x69 'i'
+  {   716,   3,  15,   4,    0,  -11 },   // 0x6A 'j'
+  {   722,   7,  12,   8,    1,  -11 },   // 0x6B 'k'
+  {   733,   1,  12,   3,    1,  -11 },   // 0x6C 'l'
+  {   735,  11,   9,  13,    1,   -8 },   // 0x6D 'm'
+  {   748,   6,   9,   8,    1,   -8 },   // 0x6E 'n'
+  {   755,   8,   9,   8,    0,   -8 },   // 0x6F 'o'
+  {   764,   7,  12,   9,    1,   -8 },   // 0x70 'p'
+  {   775,   8,  12,   9,    0,   -8 },   // 0x71 'q'
+  {   787,   4,   9,   5,    1,   -8 },   // 0x72 'r'
+  {   792,   6,   9,   8,    1,   -8 },   // 0x73 's'
+  {   799,   4,  11,   4,    0,  -10 },   // 0x74 't'
+  {   805,   6,   9,   8,    1,   -8 },   // 0x75 'u'
+  {   812,   8,   9,   8,    0,   -8 },   // 0x76 'v'
+  {   821,  11,   9,  11,    0,   -8 },   // 0x77 'w'
+  {   834,   7,   9,   7,    0,   -8 },   // 0x78 'x'
+  {   842,   7,  12,   7,    0,   -8 },   // 0x79 'y'
+  {   853,   7,   9,   8,    0,   -8 },   // 0x7A 'z'
+  {   861,   3,  15,   5,    1,  -11 },   // 0x7B '{'
+  {   867,   1,  15,   4,    1,  -11 },   // 0x7C '|'
+  {   869,   4,  15,   5,    1,  -11 },   // 0x7D '}'
+  {   877,   6,   3,   8,    1,   -6 },   // 0x7E '~'
+  {   880,  11,  15,  13,    1,  -12 },   // 0x7F ''
+  {   901,  11,  15,  13,    1,  -12 },   // 0x80 ''
+  {   922,  11,  15,  13,    1,  -12 },   // 0x81 ''
+  {   943,  11,  15,  13,    1,  -12 },   // 0x82 ''
+  {   964,  11,  15,  13,    1,  -12 },   // 0x83 ''
+  {   985,  11,  15,  13,    1,  -12 },   // 0x84 ''
+  {  1006,  11,  15,  13,    1,  -12 },   // 0x85 ''
+  {  1027,  11,  15,  13,    1,  -12 },   // 0x86 ''
+  {  1048,  11,  15,  13,    1,  -12 },   // 0x87 ''
+  {  1069,  11,  15,  13,    1,  -12 },   // 0x88 ''
+  {  1090,  11,  15,  13,    1,  -12 },   // 0x89 ''
+  {  1111,  11,  15,  13,    1,  -12 },   // 0x8A ''
+  {  1132,  11,  15,  13,    1,  -12 },   // 0x8B ''
+  {  1153,  11,  15,  13,    1,  -12 },   // 0x8C ''
+  {  1174,  11,  15,  13,    1,  -12 },   // 0x8D ''
+  {  1195,  11,  15,  13,    1,  -12 },   // 0x8E ''
+  {  1216,  11,  15,  13,    1,  -12 },   // 0x8F ''
+  {  1237,  11,  15,  13,    1,  -12 },   // 0x90 ''
+  {  1258,  11,  15,  13,    1,  -12 },   // 0x91 ''
+  {  1279,  11,  15,  13,    1,  -12 },   // 0x92 ''
+  {  1300,  11,  15,  13,    1,  -12 },   // 0x93 ''
+  {  1321,  11,  15,  13,    1,  -12 },   // 0x94 ''
+  {  1342,  11,  15,  13,    1,  -12 },   // 0x95 ''
+  {  1363,  11,  15,  13,    1,  -12 },   // 0x96 ''
+  {  1384,  11,  15,  13,    1,  -12 },   // 0x97 ''
+  {  1405,  11,  15,  13,    1,  -12 },   // 0x98 ''
+  {  1426,  11,  15,  13,    1,  -12 },   // 0x99 ''
+  {  1447,  11,  15,  13,    1,  -12 },   // 0x9A ''
+  {  1468,  11,  15,  13,    1,  -12 },   // 0x9B ''
+  {  1489,  11,  15,  13,    1,  -12 },   // 0x9C ''
+  {  1510,  11,  15,  13,    1,  -12 },   // 0x9D ''
+  {  1531,  11,  15,  13,    1,  -12 },   // 0x9E ''
+  {  1552,  11,  15,  13,    1,  -12 },   // 0x9F ''
+  {  1573,   1,   1,   4,    0,    0 },   // 0xA0 ''
+  {  1574,   1,  11,   5,    2,   -7 },   // 0xA1 ''
+  {  1576,   7,  12,   9,    1,   -9 },   // 0xA2 ''
+  {  1587,   8,  12,   9,    0,  -11 },   // 0xA3 ''
+  {  1599,   7,   7,   9,    1,   -8 },   // 0xA4 ''
+  {  1606,   9,  11,   9,    0,  -10 },   // 0xA5 ''
+  {  1619,   1,  15,   4,    2,  -11 },   // 0xA6 ''
+  {  1621,   7,  15,   9,    1,  -11 },   // 0xA7 ''
+  {  1635,   5,   2,   5,    0,  -10 },   // 0xA8 ''
+  {  1637,  11,  11,  13,    1,  -10 },   // 0xA9 ''
+  {  1653,   4,   8,   6,    1,  -11 },   // 0xAA ''
+  {  1657,   6,   5,   8,    1,   -6 },   // 0xAB ''
+  {  1661,   8,   5,   9,    1,   -5 },   // 0xAC ''
+  {  1666,   3,   1,   5,    1,   -4 },   // 0xAD ''
+  {  1667,  11,  11,  13,    1,  -10 },   // 0xAE ''
+  {  1683,   5,   1,   5,    0,  -10 },   // 0xAF ''
+  {  1684,   5,   5,  10,    2,  -10 },   // 0xB0 ''
+  {  1688,   7,  10,   9,    1,   -9 },   // 0xB1 ''
+  {  1697,   5,   7,   5,    0,  -12 },   // 0xB2 ''
+  {  1702,   5,   7,   5,    0,  -12 },   // 0xB3 ''
+  {  1707,   4,   2,   5,    1,  -11 },   // 0xB4 ''
+  {  1708,   8,  12,   9,    1,   -8 },   // 0xB5 ''
+  {  1720,   7,  14,   8,    1,  -11 },   // 0xB6 ''
+  {  1733,   2,   2,   4,    1,   -4 },   // 0xB7 ''
+  {  1734,   3,   4,   5,    1,    1 },   // 0xB8 ''
+  {  1736,   3,   6,   5,    1,  -12 },   // 0xB9 ''
+  {  1739,   4,   8,   6,    1,  -11 },   // 0xBA ''
+  {  1743,   6,   5,   8,    1,   -6 },   // 0xBB ''
+  {  1747,  12,  11,  14,    1,  -10 },   // 0xBC ''
+  {  1764,  12,  12,  14,    1,  -11 },   // 0xBD ''
+  {  1782,  13,  12,  14,    0,  -11 },   // 0xBE ''
+  {  1802,   7,  11,   9,    1,   -7 },   // 0xBF ''
+  {  1812,  10,  15,  10,    0,  -14 },   // 0xC0 ''
+  {  1831,  10,  15,  10,    0,  -14 },   // 0xC1 ''
+  {  1850,  10,  15,  10,    0,  -14 },   // 0xC2 ''
+  {  1869,  10,  15,  10,    0,  -14 },   // 0xC3 ''
+  {  1888,  10,  15,  10,    0,  -14 },   // 0xC4 ''
+  {  1907,  10,  16,  10,    0,  -15 },   // 0xC5 ''
+  {  1927,  15,  12,  15,    0,  -11 },   // 0xC6 ''
+  {  1950,   9,  15,  11,    1,  -11 },   // 0xC7 ''
+  {  1967,   8,  15,  10,    1,  -14 },   // 0xC8 ''
+  {  1982,   8,  15,  10,    1,  -14 },   // 0xC9 ''
+  {  1997,   8,  15,  10,    1,  -14 },   // 0xCA ''
+  {  2012,   8,  15,  10,    1,  -14 },   // 0xCB ''
+  {  2027,   4,  15,   4,    0,  -14 },   // 0xCC ''
+  {  2035,   3,  15,   4,    1,  -14 },   // 0xCD ''
+  {  2041,   5,  15,   5,    0,  -14 },   // 0xCE ''
+  {  2051,   5,  15,   5,    0,  -14 },   // 0xCF ''
+  {  2061,  10,  12,  11,    0,  -11 },   // 0xD0 ''
+  {  2076,   9,  15,  11,    1,  -14 },   // 0xD1 ''
+  {  2093,  11,  15,  12,    1,  -14 },   // 0xD2 ''
+  {  2114,  11,  15,  12,    1,  -14 },   // 0xD3 ''
+  {  2135,  11,  15,  12,    1,  -14 },   // 0xD4 ''
+  {  2156,  11,  15,  12,    1,  -14 },   // 0xD5 ''
+  {  2177,  11,  15,  12,    1,  -14 },   // 0xD6 ''
+  {  2198,   7,   6,   9,    1,   -6 },   // 0xD7 ''
+  {  2204,  11,  12,  12,    1,  -11 },   // 0xD8 ''
+  {  2221,   9,  15,  11,    1,  -14 },   // 0xD9 ''
+  {  2238,   9,  15,  11,    1,  -14 },   // 0xDA ''
+  {  2255,   9,  15,  11,    1,  -14 },   // 0xDB ''
+  {  2272,   9,  15,  11,    1,  -14 },   // 0xDC ''
+  {  2289,  10,  15,  11,    0,  -14 },   // 0xDD ''
+  {  2308,   8,  12,  10,    1,  -11 },   // 0xDE ''
+  {  2320,   8,  12,   9,    1,  -11 },   // 0xDF ''
+  {  2332,   8,  12,   9,    0,  -11 },   // 0xE0 ''
+  {  2344,   8,  12,   9,    0,  -11 },   // 0xE1 ''
+  {  2356,   8,  12,   9,    0,  -11 },   // 0xE2 ''
+  {  2368,   8,  11,   9,    0,  -10 },   // 0xE3 ''
+  {  2379,   8,  12,   9,    0,  -11 },   // 0xE4 ''
+  {  2391,   8,  13,   9,    0,  -12 },   // 0xE5 ''
+  {  2404,  13,   9,  14,    0,   -8 },   // 0xE6 ''
+  {  2419,   7,  12,   8,    0,   -8 },   // 0xE7 ''
+  {  2430,   8,  12,   8,    0,  -11 },   // 0xE8 ''
+  {  2442,   8,  12,   8,    0,  -11 },   // 0xE9 ''
+  {  2454,   8,  12,   8,    0,  -11 },   // 0xEA ''
+  {  2466,   8,  12,   8,    0,  -11 },   // 0xEB ''
+  {  2478,   3,  12,   3,    0,  -11 },   // 0xEC ''
+  {  2483,   3,  12,   3,    0,  -11 },   // 0xED ''
+  {  2488,   4,  12,   4,    0,  -11 },   // 0xEE ''
+  {  2494,   4,  12,   4,    0,  -11 },   // 0xEF ''
+  {  2500,   8,  12,   8,    0,  -11 },   // 0xF0 ''
+  {  2512,   6,  11,   8,    1,  -10 },   // 0xF1 ''
+  {  2521,   8,  12,   8,    0,  -11 },   // 0xF2 ''
+  {  2533,   8,  12,   8,    0,  -11 },   // 0xF3 ''
+  {  2545,   8,  12,   8,    0,  -11 },   // 0xF4 ''
+  {  2557,   8,  11,   8,    0,  -10 },   // 0xF5 ''
+  {  2568,   8,  12,   8,    0,  -11 },   // 0xF6 ''
+  {  2580,   7,   8,   9,    1,   -7 },   // 0xF7 ''
+  {  2587,   8,   9,   8,    0,   -8 },   // 0xF8 ''
+  {  2596,   6,  12,   8,    1,  -11 },   // 0xF9 ''
+  {  2605,   6,  12,   8,    1,  -11 },   // 0xFA ''
+  {  2614,   6,  12,   8,    1,  -11 },   // 0xFB ''
+  {  2623,   6,  12,   8,    1,  -11 },   // 0xFC ''
+  {  2632,   7,  15,   7,    0,  -11 },   // 0xFD ''
+  {  2646,   7,  15,   9,    1,  -11 },   // 0xFE ''
+  {  2660,   7,  15,   7,    0,  -11 } }; // 0xFF ''
+
+constexpr GFXfont FreeSans_RLE_8pt8b PROGMEM = {
+  (uint8_t  *)FreeSans_RLE_8pt8bBitmaps,
+  (GFXglyph *)FreeSans_RLE_8pt8bGlyphs,
+  0x20, 0xFF, 19 };
+
+// Approx. 4249 bytes
@@ -0,0 +1,508 @@
+const uint8_t FreeSans_RLE_9pt8bBitmaps[] PROGMEM = {
+  0x00, 0xFF, 0xFF, 0xA3, 0xC0, 0x99, 0x99, 0x19, 0x06, 0x41, 0x11, 0xFF,
+  0x13, 0x04, 0x83, 0x20, 0xC8, 0xFF, 0x89, 0x82, 0x61, 0x90, 0x10, 0x3C,
+  0xD6, 0x93, 0x90, 0xD0, 0xF0, 0x3E, 0x17, 0x11, 0x91, 0x93, 0xD6, 0x7C,
+  0x10, 0x10, 0x00, 0x30, 0x78, 0x41, 0x11, 0x86, 0x32, 0x04, 0x48, 0x07,
+  0x90, 0x00, 0x40, 0x00, 0x9E, 0x02, 0x26, 0x04, 0x84, 0x11, 0x08, 0x21,
+  0x30, 0x83, 0xC0, 0x1C, 0x09, 0x86, 0x21, 0x88, 0x36, 0x07, 0x03, 0x83,
+  0x32, 0xC7, 0xA0, 0xCC, 0x33, 0x9E, 0x3C, 0xC0, 0xFA, 0x12, 0x24, 0x44,
+  0xCC, 0xCC, 0xC4, 0x46, 0x23, 0x10, 0x8C, 0x46, 0x22, 0x22, 0x22, 0x22,
+  0x64, 0x48, 0x80, 0x25, 0x7E, 0xED, 0x00, 0x08, 0x08, 0x08, 0x08, 0xFF,
+  0x08, 0x08, 0x08, 0x08, 0xF0, 0xF0, 0xF0, 0x08, 0x44, 0x21, 0x10, 0x84,
+  0x42, 0x11, 0x08, 0x00, 0x3C, 0x66, 0xC2, 0xC3, 0x83, 0x83, 0x83, 0x83,
+  0x83, 0xC3, 0xC2, 0x66, 0x3C, 0x11, 0x3F, 0x11, 0x11, 0x11, 0x11, 0x10,
+  0x3C, 0x66, 0xC3, 0xC3, 0x83, 0x03, 0x06, 0x1C, 0x30, 0x40, 0xC0, 0xFF,
+  0xFF, 0x3C, 0xE6, 0xC2, 0x83, 0x02, 0x06, 0x1C, 0x03, 0x03, 0x83, 0x83,
+  0xE6, 0x7C, 0x02, 0x03, 0x03, 0x81, 0x41, 0xA1, 0x90, 0x88, 0xC4, 0xC2,
+  0x7F, 0xC0, 0x80, 0x40, 0x20, 0x7E, 0x7E, 0x40, 0xC0, 0xFC, 0xE6, 0xC3,
+  0x03, 0x03, 0x83, 0xC3, 0xE6, 0x3C, 0x3C, 0x66, 0xC3, 0xC0, 0x80, 0xBE,
+  0xC3, 0xC3, 0x83, 0xC3, 0xC3, 0x66, 0x3C, 0xFF, 0xFF, 0x02, 0x06, 0x04,
+  0x0C, 0x08, 0x18, 0x10, 0x30, 0x30, 0x20, 0x20, 0x3C, 0x66, 0xC2, 0xC3,
+  0xC2, 0x66, 0x7C, 0xC2, 0x83, 0x83, 0xC3, 0xE6, 0x3C, 0x3C, 0x66, 0xC2,
+  0x83, 0x83, 0x83, 0xC7, 0x7F, 0x03, 0x03, 0xC2, 0x6E, 0x38, 0xF0, 0x00,
+  0xF0, 0xF0, 0x00, 0xF5, 0x80, 0x00, 0x03, 0x0E, 0x70, 0xC0, 0xE0, 0x3C,
+  0x07, 0x01, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xC0, 0x78, 0x0E, 0x03, 0x07,
+  0x1C, 0xE0, 0x80, 0x3C, 0x66, 0x43, 0xC3, 0x03, 0x06, 0x0C, 0x18, 0x18,
+  0x18, 0x00, 0x18, 0x18, 0x07, 0xE0, 0x1E, 0x78, 0x30, 0x0C, 0x60, 0x06,
+  0x43, 0xD2, 0xC6, 0x73, 0x8C, 0x23, 0x88, 0x23, 0x88, 0x62, 0x88, 0x46,
+  0xCC, 0xEC, 0xC7, 0x78, 0x60, 0x00, 0x38, 0x00, 0x0F, 0xF0, 0x06, 0x01,
+  0xC0, 0x3C, 0x05, 0x81, 0x98, 0x33, 0x04, 0x61, 0x86, 0x3F, 0xCC, 0x19,
+  0x81, 0xB0, 0x3C, 0x06, 0xFF, 0x30, 0xEC, 0x0B, 0x02, 0xC0, 0xB0, 0xEF,
+  0xF3, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x06, 0xFF, 0x00, 0x1F, 0x07, 0x71,
+  0x83, 0x60, 0x2C, 0x01, 0x00, 0x20, 0x04, 0x00, 0xC0, 0x78, 0x09, 0x83,
+  0x1D, 0xC1, 0xF0, 0xFF, 0x18, 0x73, 0x03, 0x60, 0x6C, 0x05, 0x80, 0xF0,
+  0x1E, 0x03, 0xC0, 0x58, 0x1B, 0x03, 0x61, 0xCF, 0xF0, 0xFF, 0xB0, 0x0C,
+  0x03, 0x00, 0xC0, 0x30, 0x0F, 0xFB, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00,
+  0xFF, 0xC0, 0xFF, 0xE0, 0x30, 0x18, 0x0C, 0x06, 0x03, 0xFD, 0x80, 0xC0,
+  0x60, 0x30, 0x18, 0x0C, 0x00, 0x1F, 0x87, 0x39, 0x81, 0xE0, 0x3C, 0x01,
+  0x00, 0x20, 0xFC, 0x01, 0xC0, 0x38, 0x05, 0x81, 0x9C, 0xF1, 0xFA, 0xC0,
+  0x70, 0x1C, 0x07, 0x01, 0xC0, 0x70, 0x1F, 0xFF, 0x01, 0xC0, 0x70, 0x1C,
+  0x07, 0x01, 0xC0, 0x40, 0xFF, 0xF8, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC1,
+  0x83, 0x07, 0x0E, 0x1E, 0x67, 0x80, 0xC0, 0xD8, 0x33, 0x0C, 0x63, 0x0C,
+  0xC1, 0xB0, 0x3F, 0x07, 0x30, 0xC3, 0x18, 0x63, 0x06, 0x60, 0x6C, 0x0C,
+  0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xFF, 0xE0, 0x3E, 0x03, 0xF0, 0x7F, 0x05, 0xD0, 0x5D, 0x8D, 0xD8, 0x9C,
+  0x89, 0xCD, 0x9C, 0xD1, 0xC5, 0x1C, 0x71, 0xC6, 0x10, 0xE0, 0x78, 0x1F,
+  0x07, 0x41, 0xD8, 0x73, 0x1C, 0xC7, 0x19, 0xC3, 0x70, 0xDC, 0x1F, 0x03,
+  0xC0, 0xC0, 0x1F, 0x83, 0x9C, 0x60, 0x6C, 0x03, 0xC0, 0x38, 0x03, 0x80,
+  0x38, 0x03, 0xC0, 0x3C, 0x03, 0x60, 0x63, 0x9C, 0x1F, 0x00, 0xFF, 0x30,
+  0xEC, 0x0F, 0x03, 0xC0, 0xF0, 0x6F, 0xFB, 0x00, 0xC0, 0x30, 0x0C, 0x03,
+  0x00, 0xC0, 0x00, 0x1F, 0x03, 0x9C, 0x60, 0x6C, 0x03, 0xC0, 0x38, 0x03,
+  0x80, 0x38, 0x03, 0xC0, 0x3C, 0x12, 0x61, 0xE3, 0x9E, 0x1F, 0x30, 0x00,
+  0xFF, 0x98, 0x3B, 0x03, 0x60, 0x2C, 0x0D, 0x81, 0xBF, 0xC6, 0x0C, 0xC0,
+  0xD8, 0x1B, 0x03, 0x60, 0x6C, 0x06, 0x3E, 0x1C, 0xEC, 0x0B, 0x02, 0xC0,
+  0x1E, 0x01, 0xF0, 0x0E, 0x00, 0xE0, 0x3C, 0x0D, 0xCE, 0x3F, 0x00, 0xFF,
+  0xC2, 0x00, 0x80, 0x20, 0x08, 0x02, 0x00, 0x80, 0x20, 0x08, 0x02, 0x00,
+  0x80, 0x20, 0x08, 0x00, 0xC0, 0x70, 0x1C, 0x07, 0x01, 0xC0, 0x70, 0x1C,
+  0x07, 0x01, 0xC0, 0x70, 0x16, 0x0D, 0xCE, 0x1F, 0x00, 0xC0, 0x6C, 0x0D,
+  0x81, 0x30, 0x63, 0x0C, 0x61, 0x04, 0x60, 0xCC, 0x19, 0x01, 0x60, 0x38,
+  0x07, 0x00, 0x60, 0xC1, 0x83, 0x41, 0xC3, 0x61, 0xC3, 0x63, 0x42, 0x63,
+  0x46, 0x22, 0x66, 0x32, 0x66, 0x36, 0x24, 0x36, 0x24, 0x14, 0x3C, 0x14,
+  0x3C, 0x1C, 0x18, 0x18, 0x18, 0x60, 0x64, 0x18, 0xC2, 0x0C, 0xC0, 0xB0,
+  0x1C, 0x01, 0x80, 0x78, 0x1B, 0x03, 0x30, 0xC3, 0x30, 0x66, 0x06, 0x60,
+  0x66, 0x06, 0x30, 0xC3, 0x0C, 0x19, 0x80, 0xD0, 0x0F, 0x00, 0x60, 0x06,
+  0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0xFF, 0x80, 0xC0, 0xC0, 0x60,
+  0x60, 0x60, 0x60, 0x30, 0x30, 0x30, 0x30, 0x18, 0x0F, 0xF8, 0xFB, 0x6D,
+  0xB6, 0xDB, 0x6D, 0xB6, 0xE0, 0x84, 0x10, 0x84, 0x10, 0x84, 0x10, 0x84,
+  0x10, 0x80, 0xF3, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0xF0, 0x30,
+  0xC6, 0x92, 0x4E, 0x18, 0x40, 0xFF, 0xC0, 0x62, 0x10, 0x7C, 0xE6, 0xC2,
+  0x02, 0x3E, 0xE2, 0x82, 0x86, 0xCE, 0x7B, 0xC0, 0xC0, 0xC0, 0xDC, 0xE6,
+  0xC3, 0xC1, 0xC1, 0xC1, 0xC1, 0xC3, 0xE6, 0xBC, 0x3C, 0xDF, 0x0C, 0x08,
+  0x10, 0x20, 0xE1, 0xE6, 0x78, 0x03, 0x03, 0x03, 0x3B, 0xEF, 0xC3, 0x83,
+  0x83, 0x83, 0x83, 0xC3, 0xE7, 0x3F, 0x3C, 0x66, 0xC2, 0x83, 0xFF, 0x80,
+  0x80, 0xC2, 0x66, 0x3C, 0x39, 0x09, 0xF2, 0x10, 0x84, 0x21, 0x08, 0x42,
+  0x00, 0x3B, 0x6F, 0xC3, 0x83, 0x83, 0x83, 0x83, 0xC3, 0xEF, 0x3B, 0x02,
+  0xC6, 0x7C, 0xC1, 0x83, 0x06, 0xEE, 0x78, 0x70, 0xE1, 0xC3, 0x87, 0x0E,
+  0x1C, 0x20, 0xF3, 0xFF, 0xFF, 0xC0, 0x24, 0x12, 0x49, 0x24, 0x92, 0x4B,
+  0xC0, 0xC0, 0xC0, 0xC0, 0xC6, 0xCC, 0xD8, 0xF0, 0xF8, 0xD8, 0xCC, 0xC4,
+  0xC6, 0xC3, 0xFF, 0xFF, 0xFF, 0xC0, 0xBC, 0xEE, 0x73, 0xC6, 0x1C, 0x61,
+  0xC6, 0x1C, 0x61, 0xC6, 0x1C, 0x61, 0xC6, 0x1C, 0x61, 0xBD, 0x4F, 0x0E,
+  0x1C, 0x38, 0x70, 0xE1, 0xC3, 0x84, 0x3C, 0xE6, 0xC2, 0x83, 0x83, 0x83,
+  0x83, 0xC2, 0xE6, 0x3C, 0xBC, 0xE6, 0xC3, 0xC1, 0xC1, 0xC1, 0xC1, 0xC3,
+  0xE6, 0xFC, 0xC0, 0xC0, 0xC0, 0x3B, 0x67, 0xC3, 0x83, 0x83, 0x83, 0x83,
+  0xC3, 0xE7, 0x3B, 0x03, 0x03, 0x03, 0x9B, 0xCC, 0xCC, 0xCC, 0xCC, 0x79,
+  0x9A, 0x1E, 0x0F, 0x83, 0xC1, 0xC1, 0xCE, 0xF8, 0x21, 0x09, 0xF2, 0x10,
+  0x84, 0x21, 0x08, 0x43, 0x80, 0xC3, 0x87, 0x0E, 0x1C, 0x38, 0x70, 0xE3,
+  0xCE, 0xF4, 0xC1, 0x21, 0x98, 0xCC, 0x42, 0x61, 0x30, 0xD0, 0x38, 0x1C,
+  0x0C, 0x00, 0xC6, 0x12, 0x38, 0x91, 0xCC, 0xCA, 0x66, 0xD2, 0x16, 0xD0,
+  0xA7, 0x87, 0x1C, 0x38, 0xC0, 0xC6, 0x00, 0x43, 0x62, 0x36, 0x1C, 0x18,
+  0x18, 0x3C, 0x26, 0x62, 0xC3, 0xC3, 0x43, 0x42, 0x62, 0x26, 0x24, 0x34,
+  0x1C, 0x18, 0x18, 0x18, 0x10, 0x30, 0x60, 0xFE, 0x0C, 0x30, 0xC1, 0x06,
+  0x18, 0x60, 0x81, 0xFC, 0x36, 0x44, 0x44, 0x4C, 0x84, 0x44, 0x44, 0x46,
+  0x30, 0xFF, 0xFF, 0x80, 0xC6, 0x66, 0x66, 0x62, 0x12, 0x66, 0x66, 0x66,
+  0xC0, 0xE3, 0x66, 0x38, 0xFF, 0xF8, 0x01, 0x9F, 0x99, 0x0D, 0xB0, 0xDB,
+  0x0D, 0x80, 0xD8, 0x19, 0x83, 0x18, 0x61, 0x86, 0x18, 0x01, 0x80, 0x18,
+  0x61, 0x86, 0x18, 0x01, 0xFF, 0xF0, 0xFF, 0xF8, 0x01, 0x9F, 0x99, 0x0D,
+  0xB0, 0xDB, 0x0D, 0x80, 0xD8, 0x19, 0x83, 0x18, 0x61, 0x86, 0x18, 0x01,
+  0x80, 0x18, 0x61, 0x86, 0x18, 0x01, 0xFF, 0xF0, 0xFF, 0xF8, 0x01, 0x9F,
+  0x99, 0x0D, 0xB0, 0xDB, 0x0D, 0x80, 0xD8, 0x19, 0x83, 0x18, 0x61, 0x86,
+  0x18, 0x01, 0x80, 0x18, 0x61, 0x86, 0x18, 0x01, 0xFF, 0xF0, 0xFF, 0xF8,
+  0x01, 0x9F, 0x99, 0x0D, 0xB0, 0xDB, 0x0D, 0x80, 0xD8, 0x19, 0x83, 0x18,
+  0x61, 0x86, 0x18, 0x01, 0x80, 0x18, 0x61, 0x86, 0x18, 0x01, 0xFF, 0xF0,
+  0xFF, 0xF8, 0x01, 0x9F, 0x99, 0x0D, 0xB0, 0xDB, 0x0D, 0x80, 0xD8, 0x19,
+  0x83, 0x18, 0x61, 0x86, 0x18, 0x01, 0x80, 0x18, 0x61, 0x86, 0x18, 0x01,
+  0xFF, 0xF0, 0xFF, 0xF8, 0x01, 0x9F, 0x99, 0x0D, 0xB0, 0xDB, 0x0D, 0x80,
+  0xD8, 0x19, 0x83, 0x18, 0x61, 0x86, 0x18, 0x01, 0x80, 0x18, 0x61, 0x86,
+  0x18, 0x01, 0xFF, 0xF0, 0xFF, 0xF8, 0x01, 0x9F, 0x99, 0x0D, 0xB0, 0xDB,
+  0x0D, 0x80, 0xD8, 0x19, 0x83, 0x18, 0x61, 0x86, 0x18, 0x01, 0x80, 0x18,
+  0x61, 0x86, 0x18, 0x01, 0xFF, 0xF0, 0xFF, 0xF8, 0x01, 0x9F, 0x99, 0x0D,
+  0xB0, 0xDB, 0x0D, 0x80, 0xD8, 0x19, 0x83, 0x18, 0x61, 0x86, 0x18, 0x01,
+  0x80, 0x18, 0x61, 0x86, 0x18, 0x01, 0xFF, 0xF0, 0xFF, 0xF8, 0x01, 0x9F,
+  0x99, 0x0D, 0xB0, 0xDB, 0x0D, 0x80, 0xD8, 0x19, 0x83, 0x18, 0x61, 0x86,
+  0x18, 0x01, 0x80, 0x18, 0x61, 0x86, 0x18, 0x01, 0xFF, 0xF0, 0xFF, 0xF8,
+  0x01, 0x9F, 0x99, 0x0D, 0xB0, 0xDB, 0x0D, 0x80, 0xD8, 0x19, 0x83, 0x18,
+  0x61, 0x86, 0x18, 0x01, 0x80, 0x18, 0x61, 0x86, 0x18, 0x01, 0xFF, 0xF0,
+  0xFF, 0xF8, 0x01, 0x9F, 0x99, 0x0D, 0xB0, 0xDB, 0x0D, 0x80, 0xD8, 0x19,
+  0x83, 0x18, 0x61, 0x86, 0x18, 0x01, 0x80, 0x18, 0x61, 0x86, 0x18, 0x01,
+  0xFF, 0xF0, 0xFF, 0xF8, 0x01, 0x9F, 0x99, 0x0D, 0xB0, 0xDB, 0x0D, 0x80,
+  0xD8, 0x19, 0x83, 0x18, 0x61, 0x86, 0x18, 0x01, 0x80, 0x18, 0x61, 0x86,
+  0x18, 0x01, 0xFF, 0xF0, 0xFF, 0xF8, 0x01, 0x9F, 0x99, 0x0D, 0xB0, 0xDB,
+  0x0D, 0x80, 0xD8, 0x19, 0x83, 0x18, 0x61, 0x86, 0x18, 0x01, 0x80, 0x18,
+  0x61, 0x86, 0x18, 0x01, 0xFF, 0xF0, 0xFF, 0xF8, 0x01, 0x9F, 0x99, 0x0D,
+  0xB0, 0xDB, 0x0D, 0x80, 0xD8, 0x19, 0x83, 0x18, 0x61, 0x86, 0x18, 0x01,
+  0x80, 0x18, 0x61, 0x86, 0x18, 0x01, 0xFF, 0xF0, 0xFF, 0xF8, 0x01, 0x9F,
+  0x99, 0x0D, 0xB0, 0xDB, 0x0D, 0x80, 0xD8, 0x19, 0x83, 0x18, 0x61, 0x86,
+  0x18, 0x01, 0x80, 0x18, 0x61, 0x86, 0x18, 0x01, 0xFF, 0xF0, 0xFF, 0xF8,
+  0x01, 0x9F, 0x99, 0x0D, 0xB0, 0xDB, 0x0D, 0x80, 0xD8, 0x19, 0x83, 0x18,
+  0x61, 0x86, 0x18, 0x01, 0x80, 0x18, 0x61, 0x86, 0x18, 0x01, 0xFF, 0xF0,
+  0xFF, 0xF8, 0x01, 0x9F, 0x99, 0x0D, 0xB0, 0xDB, 0x0D, 0x80, 0xD8, 0x19,
+  0x83, 0x18, 0x61, 0x86, 0x18, 0x01, 0x80, 0x18, 0x61, 0x86, 0x18, 0x01,
+  0xFF, 0xF0, 0xFF, 0xF8, 0x01, 0x9F, 0x99, 0x0D, 0xB0, 0xDB, 0x0D, 0x80,
+  0xD8, 0x19, 0x83, 0x18, 0x61, 0x86, 0x18, 0x01, 0x80, 0x18, 0x61, 0x86,
+  0x18, 0x01, 0xFF, 0xF0, 0xFF, 0xF8, 0x01, 0x9F, 0x99, 0x0D, 0xB0, 0xDB,
+  0x0D, 0x80, 0xD8, 0x19, 0x83, 0x18, 0x61, 0x86, 0x18, 0x01, 0x80, 0x18,
+  0x61, 0x86, 0x18, 0x01, 0xFF, 0xF0, 0xFF, 0xF8, 0x01, 0x9F, 0x99, 0x0D,
+  0xB0, 0xDB, 0x0D, 0x80, 0xD8, 0x19, 0x83, 0x18, 0x61, 0x86, 0x18, 0x01,
+  0x80, 0x18, 0x61, 0x86, 0x18, 0x01, 0xFF, 0xF0, 0xFF, 0xF8, 0x01, 0x9F,
+  0x99, 0x0D, 0xB0, 0xDB, 0x0D, 0x80, 0xD8, 0x19, 0x83, 0x18, 0x61, 0x86,
+  0x18, 0x01, 0x80, 0x18, 0x61, 0x86, 0x18, 0x01, 0xFF, 0xF0, 0xFF, 0xF8,
+  0x01, 0x9F, 0x99, 0x0D, 0xB0, 0xDB, 0x0D, 0x80, 0xD8, 0x19, 0x83, 0x18,
+  0x61, 0x86, 0x18, 0x01, 0x80, 0x18, 0x61, 0x86, 0x18, 0x01, 0xFF, 0xF0,
+  0xFF, 0xF8, 0x01, 0x9F, 0x99, 0x0D, 0xB0, 0xDB, 0x0D, 0x80, 0xD8, 0x19,
+  0x83, 0x18, 0x61, 0x86, 0x18, 0x01, 0x80, 0x18, 0x61, 0x86, 0x18, 0x01,
+  0xFF, 0xF0, 0xFF, 0xF8, 0x01, 0x9F, 0x99, 0x0D, 0xB0, 0xDB, 0x0D, 0x80,
+  0xD8, 0x19, 0x83, 0x18, 0x61, 0x86, 0x18, 0x01, 0x80, 0x18, 0x61, 0x86,
+  0x18, 0x01, 0xFF, 0xF0, 0xFF, 0xF8, 0x01, 0x9F, 0x99, 0x0D, 0xB0, 0xDB,
+  0x0D, 0x80, 0xD8, 0x19, 0x83, 0x18, 0x61, 0x86, 0x18, 0x01, 0x80, 0x18,
+  0x61, 0x86, 0x18, 0x01, 0xFF, 0xF0, 0xFF, 0xF8, 0x01, 0x9F, 0x99, 0x0D,
+  0xB0, 0xDB, 0x0D, 0x80, 0xD8, 0x19, 0x83, 0x18, 0x61, 0x86, 0x18, 0x01,
+  0x80, 0x18, 0x61, 0x86, 0x18, 0x01, 0xFF, 0xF0, 0xFF, 0xF8, 0x01, 0x9F,
+  0x99, 0x0D, 0xB0, 0xDB, 0x0D, 0x80, 0xD8, 0x19, 0x83, 0x18, 0x61, 0x86,
+  0x18, 0x01, 0x80, 0x18, 0x61, 0x86, 0x18, 0x01, 0xFF, 0xF0, 0xFF, 0xF8,
+  0x01, 0x9F, 0x99, 0x0D, 0xB0, 0xDB, 0x0D, 0x80, 0xD8, 0x19, 0x83, 0x18,
+  0x61, 0x86, 0x18, 0x01, 0x80, 0x18, 0x61, 0x86, 0x18, 0x01, 0xFF, 0xF0,
+  0xFF, 0xF8, 0x01, 0x9F, 0x99, 0x0D, 0xB0, 0xDB, 0x0D, 0x80, 0xD8, 0x19,
+  0x83, 0x18, 0x61, 0x86, 0x18, 0x01, 0x80, 0x18, 0x61, 0x86, 0x18, 0x01,
+  0xFF, 0xF0, 0xFF, 0xF8, 0x01, 0x9F, 0x99, 0x0D, 0xB0, 0xDB, 0x0D, 0x80,
+  0xD8, 0x19, 0x83, 0x18, 0x61, 0x86, 0x18, 0x01, 0x80, 0x18, 0x61, 0x86,
+  0x18, 0x01, 0xFF, 0xF0, 0xFF, 0xF8, 0x01, 0x9F, 0x99, 0x0D, 0xB0, 0xDB,
+  0x0D, 0x80, 0xD8, 0x19, 0x83, 0x18, 0x61, 0x86, 0x18, 0x01, 0x80, 0x18,
+  0x61, 0x86, 0x18, 0x01, 0xFF, 0xF0, 0xFF, 0xF8, 0x01, 0x9F, 0x99, 0x0D,
+  0xB0, 0xDB, 0x0D, 0x80, 0xD8, 0x19, 0x83, 0x18, 0x61, 0x86, 0x18, 0x01,
+  0x80, 0x18, 0x61, 0x86, 0x18, 0x01, 0xFF, 0xF0, 0xFF, 0xF8, 0x01, 0x9F,
+  0x99, 0x0D, 0xB0, 0xDB, 0x0D, 0x80, 0xD8, 0x19, 0x83, 0x18, 0x61, 0x86,
+  0x18, 0x01, 0x80, 0x18, 0x61, 0x86, 0x18, 0x01, 0xFF, 0xF0, 0x00, 0xF2,
+  0xAF, 0xFF, 0xC0, 0x00, 0x10, 0x3C, 0x76, 0xD3, 0xD0, 0x90, 0x90, 0xD3,
+  0xD3, 0x76, 0x3C, 0x10, 0x00, 0x1E, 0x19, 0x98, 0x6C, 0x36, 0x01, 0x03,
+  0xF0, 0x20, 0x10, 0x08, 0x08, 0x0B, 0xF6, 0x78, 0x42, 0x7E, 0x66, 0x42,
+  0x42, 0x66, 0x7E, 0x42, 0xC0, 0x98, 0x62, 0x10, 0xCC, 0x12, 0x07, 0x07,
+  0xF8, 0x30, 0x0C, 0x1F, 0xE0, 0xC0, 0x30, 0x0C, 0x00, 0xFE, 0x3F, 0x80,
+  0x3C, 0x66, 0x42, 0x42, 0x60, 0x78, 0x8E, 0x87, 0xC3, 0x61, 0x3A, 0x1C,
+  0x06, 0xC6, 0xC6, 0x6C, 0x38, 0xCE, 0x40, 0x0F, 0x83, 0x0C, 0x60, 0x2C,
+  0xF3, 0x98, 0x99, 0x01, 0x90, 0x19, 0x01, 0x90, 0x9D, 0x9B, 0x6F, 0x23,
+  0x0C, 0x0F, 0x00, 0xF4, 0x8D, 0xA9, 0x7C, 0x1F, 0x22, 0xCF, 0x26, 0x46,
+  0x44, 0x40, 0xFF, 0x80, 0xC0, 0x60, 0x30, 0x18, 0xF0, 0x0F, 0x83, 0x0C,
+  0x60, 0x2D, 0xF3, 0x90, 0x99, 0x09, 0x9F, 0x99, 0x19, 0x90, 0x9D, 0x0B,
+  0x70, 0xA3, 0x0C, 0x0F, 0x00, 0xF8, 0x74, 0x63, 0x17, 0x00, 0x08, 0x08,
+  0x08, 0x08, 0xFF, 0x08, 0x08, 0x08, 0x00, 0x00, 0xFF, 0x79, 0x34, 0x46,
+  0x21, 0x0F, 0xC0, 0x79, 0x20, 0x8E, 0x0F, 0x37, 0x80, 0x7A, 0x00, 0xC2,
+  0x61, 0x30, 0x98, 0x4C, 0x26, 0x13, 0x09, 0x84, 0xEF, 0x7D, 0xF0, 0x18,
+  0x0C, 0x00, 0x3F, 0x7A, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0x7A, 0x1A, 0x1A,
+  0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0xC0, 0x47, 0x1E, 0x3C, 0x92, 0x48,
+  0x74, 0xA3, 0x19, 0x38, 0x1F, 0x81, 0x91, 0x99, 0x3C, 0xD1, 0x00, 0x20,
+  0x23, 0x81, 0x02, 0x04, 0x08, 0x20, 0x20, 0x80, 0x84, 0x22, 0x21, 0x80,
+  0x8A, 0x04, 0x68, 0x11, 0x20, 0x8F, 0xC4, 0x02, 0x10, 0x08, 0x20, 0x23,
+  0x81, 0x02, 0x08, 0x08, 0x20, 0x21, 0x00, 0x84, 0xE2, 0x24, 0xC1, 0x11,
+  0x04, 0x0C, 0x20, 0xE1, 0x06, 0x04, 0x10, 0x20, 0xFC, 0x78, 0x10, 0x98,
+  0x40, 0x30, 0x80, 0xC2, 0x00, 0xC4, 0x18, 0x90, 0x93, 0x43, 0x3C, 0x8E,
+  0x02, 0x3C, 0x04, 0x58, 0x11, 0xF8, 0x40, 0x60, 0x80, 0xC0, 0x10, 0x20,
+  0x00, 0x81, 0x06, 0x18, 0x60, 0x81, 0x07, 0x1F, 0xF3, 0x80, 0x0C, 0x00,
+  0xC0, 0x00, 0x03, 0x00, 0xE0, 0x1E, 0x02, 0xC0, 0xCC, 0x19, 0x82, 0x30,
+  0xC3, 0x1F, 0xE6, 0x0C, 0xC0, 0xD8, 0x1E, 0x03, 0x03, 0x00, 0xC0, 0x00,
+  0x03, 0x00, 0xE0, 0x1E, 0x02, 0xC0, 0xCC, 0x19, 0x82, 0x30, 0xC3, 0x1F,
+  0xE6, 0x0C, 0xC0, 0xD8, 0x1E, 0x03, 0x06, 0x01, 0x60, 0x00, 0x03, 0x00,
+  0xE0, 0x1E, 0x02, 0xC0, 0xCC, 0x19, 0x82, 0x30, 0xC3, 0x1F, 0xE6, 0x0C,
+  0xC0, 0xD8, 0x1E, 0x03, 0x0C, 0x82, 0x60, 0x00, 0x03, 0x00, 0xE0, 0x1E,
+  0x02, 0xC0, 0xCC, 0x19, 0x82, 0x30, 0xC3, 0x1F, 0xE6, 0x0C, 0xC0, 0xD8,
+  0x1E, 0x03, 0x19, 0x03, 0x20, 0x00, 0x03, 0x00, 0xE0, 0x1E, 0x02, 0xC0,
+  0xCC, 0x19, 0x82, 0x30, 0xC3, 0x1F, 0xE6, 0x0C, 0xC0, 0xD8, 0x1E, 0x03,
+  0x06, 0x01, 0x20, 0x38, 0x00, 0x00, 0x60, 0x1C, 0x03, 0xC0, 0x58, 0x19,
+  0x83, 0x30, 0x46, 0x18, 0x63, 0xFC, 0xC1, 0x98, 0x1B, 0x03, 0xC0, 0x60,
+  0x07, 0xFF, 0x03, 0x60, 0x01, 0x30, 0x01, 0x98, 0x00, 0x8C, 0x00, 0xC6,
+  0x00, 0x63, 0xFC, 0x61, 0x80, 0x3F, 0xC0, 0x10, 0x60, 0x18, 0x30, 0x0C,
+  0x18, 0x0C, 0x0F, 0xF8, 0x1F, 0x07, 0x71, 0x83, 0x60, 0x2C, 0x01, 0x00,
+  0x20, 0x04, 0x00, 0xC0, 0x78, 0x09, 0x83, 0x1D, 0xC1, 0xF0, 0x10, 0x03,
+  0x80, 0x10, 0x1C, 0x00, 0x18, 0x03, 0x00, 0x03, 0xFE, 0xC0, 0x30, 0x0C,
+  0x03, 0x00, 0xC0, 0x3F, 0xEC, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0xFF,
+  0x06, 0x02, 0x00, 0x03, 0xFE, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x3F,
+  0xEC, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0xFF, 0x0C, 0x05, 0x80, 0x03,
+  0xFE, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x3F, 0xEC, 0x03, 0x00, 0xC0,
+  0x30, 0x0C, 0x03, 0xFF, 0x32, 0x0C, 0x80, 0x03, 0xFE, 0xC0, 0x30, 0x0C,
+  0x03, 0x00, 0xC0, 0x3F, 0xEC, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0xFF,
+  0x62, 0x12, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x6C, 0x04, 0x44, 0x44,
+  0x44, 0x44, 0x44, 0x44, 0x72, 0xC0, 0x63, 0x18, 0xC6, 0x31, 0x8C, 0x63,
+  0x18, 0xC6, 0xDE, 0xC0, 0x42, 0x10, 0x84, 0x21, 0x08, 0x42, 0x10, 0x84,
+  0x3F, 0x82, 0x1C, 0x20, 0x62, 0x02, 0x20, 0x32, 0x03, 0xFC, 0x32, 0x03,
+  0x20, 0x32, 0x02, 0x20, 0x62, 0x1C, 0x3F, 0x80, 0x08, 0x07, 0xC1, 0x03,
+  0x81, 0xE0, 0x7C, 0x1D, 0x07, 0x61, 0xCC, 0x73, 0x1C, 0x67, 0x0D, 0xC3,
+  0x70, 0x7C, 0x0F, 0x03, 0x0C, 0x00, 0x60, 0x00, 0x01, 0xF8, 0x39, 0xC6,
+  0x06, 0xC0, 0x3C, 0x03, 0x80, 0x38, 0x03, 0x80, 0x3C, 0x03, 0xC0, 0x36,
+  0x06, 0x39, 0xC1, 0xF0, 0x03, 0x00, 0x60, 0x00, 0x01, 0xF8, 0x39, 0xC6,
+  0x06, 0xC0, 0x3C, 0x03, 0x80, 0x38, 0x03, 0x80, 0x3C, 0x03, 0xC0, 0x36,
+  0x06, 0x39, 0xC1, 0xF0, 0x06, 0x00, 0xB0, 0x00, 0x01, 0xF8, 0x39, 0xC6,
+  0x06, 0xC0, 0x3C, 0x03, 0x80, 0x38, 0x03, 0x80, 0x3C, 0x03, 0xC0, 0x36,
+  0x06, 0x39, 0xC1, 0xF0, 0x00, 0x01, 0xF0, 0x10, 0x01, 0xF8, 0x39, 0xC6,
+  0x06, 0xC0, 0x3C, 0x03, 0x80, 0x38, 0x03, 0x80, 0x3C, 0x03, 0xC0, 0x36,
+  0x06, 0x39, 0xC1, 0xF0, 0x19, 0x01, 0x90, 0x00, 0x01, 0xF8, 0x39, 0xC6,
+  0x06, 0xC0, 0x3C, 0x03, 0x80, 0x38, 0x03, 0x80, 0x3C, 0x03, 0xC0, 0x36,
+  0x06, 0x39, 0xC1, 0xF0, 0x01, 0x89, 0xA1, 0x83, 0x89, 0xA1, 0x80, 0x1F,
+  0x13, 0x9E, 0x60, 0x6C, 0x0A, 0xC1, 0x38, 0x23, 0x84, 0x38, 0x83, 0xD0,
+  0x3E, 0x03, 0x60, 0x6F, 0x9C, 0x9F, 0x00, 0x08, 0x01, 0x00, 0x03, 0x01,
+  0xC0, 0x70, 0x1C, 0x07, 0x01, 0xC0, 0x70, 0x1C, 0x07, 0x01, 0xC0, 0x58,
+  0x37, 0x38, 0x7C, 0x06, 0x01, 0x00, 0x83, 0x01, 0xC0, 0x70, 0x1C, 0x07,
+  0x01, 0xC0, 0x70, 0x1C, 0x07, 0x01, 0xC0, 0x58, 0x37, 0x38, 0x7C, 0x0E,
+  0x06, 0x80, 0x03, 0x01, 0xC0, 0x70, 0x1C, 0x07, 0x01, 0xC0, 0x70, 0x1C,
+  0x07, 0x01, 0xC0, 0x58, 0x37, 0x38, 0x7C, 0x1B, 0x06, 0xC0, 0x03, 0x01,
+  0xC0, 0x70, 0x1C, 0x07, 0x01, 0xC0, 0x70, 0x1C, 0x07, 0x01, 0xC0, 0x58,
+  0x37, 0x38, 0x7C, 0x03, 0x00, 0x60, 0x00, 0x06, 0x06, 0x60, 0x63, 0x0C,
+  0x30, 0xC1, 0x98, 0x0D, 0x00, 0xF0, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60,
+  0x06, 0x00, 0x60, 0xC0, 0x30, 0x0F, 0xF3, 0x0E, 0xC0, 0xB0, 0x3C, 0x0F,
+  0x06, 0xFF, 0xB0, 0x0C, 0x03, 0x00, 0xC0, 0x00, 0x3E, 0x31, 0xB0, 0x58,
+  0x2C, 0x36, 0x73, 0x0D, 0x83, 0xC1, 0xE0, 0xF0, 0x5A, 0xED, 0xE0, 0x30,
+  0x10, 0x08, 0x7C, 0xE6, 0xC2, 0x02, 0x3E, 0xE2, 0x82, 0x86, 0xCE, 0x7B,
+  0x08, 0x10, 0x20, 0x7C, 0xE6, 0xC2, 0x02, 0x3E, 0xE2, 0x82, 0x86, 0xCE,
+  0x7B, 0x18, 0x2C, 0x64, 0x7C, 0xE6, 0xC2, 0x02, 0x3E, 0xE2, 0x82, 0x86,
+  0xCE, 0x7B, 0x36, 0x5C, 0x00, 0x7C, 0xE6, 0xC2, 0x02, 0x3E, 0xE2, 0x82,
+  0x86, 0xCE, 0x7B, 0x64, 0x64, 0x00, 0x7C, 0xE6, 0xC2, 0x02, 0x3E, 0xE2,
+  0x82, 0x86, 0xCE, 0x7B, 0x18, 0x24, 0x2C, 0x18, 0x7C, 0xE6, 0xC2, 0x02,
+  0x3E, 0xE2, 0x82, 0x86, 0xCE, 0x7B, 0x7C, 0xF3, 0x9E, 0x68, 0x30, 0x80,
+  0x83, 0x7F, 0xFF, 0x08, 0x08, 0x20, 0x21, 0xC2, 0xCD, 0x99, 0xC3, 0xC0,
+  0x3C, 0xDF, 0x0C, 0x08, 0x10, 0x20, 0xE1, 0xE6, 0x78, 0x41, 0xC0, 0x8E,
+  0x00, 0x30, 0x10, 0x08, 0x3C, 0x66, 0xC2, 0x83, 0xFF, 0x80, 0x80, 0xC2,
+  0x66, 0x3C, 0x0C, 0x18, 0x10, 0x3C, 0x66, 0xC2, 0x83, 0xFF, 0x80, 0x80,
+  0xC2, 0x66, 0x3C, 0x18, 0x2C, 0x64, 0x3C, 0x66, 0xC2, 0x83, 0xFF, 0x80,
+  0x80, 0xC2, 0x66, 0x3C, 0x6C, 0x6C, 0x00, 0x3C, 0x66, 0xC2, 0x83, 0xFF,
+  0x80, 0x80, 0xC2, 0x66, 0x3C, 0x42, 0x16, 0x66, 0x66, 0x66, 0x66, 0x60,
+  0x24, 0x86, 0x66, 0x66, 0x66, 0x66, 0x60, 0x63, 0xA6, 0x02, 0x10, 0x84,
+  0x21, 0x08, 0x42, 0x10, 0xDE, 0xC0, 0x02, 0x10, 0x84, 0x21, 0x08, 0x42,
+  0x10, 0x40, 0x78, 0x78, 0x0C, 0x3C, 0xE6, 0xC2, 0x83, 0x83, 0x83, 0x83,
+  0xC2, 0xE6, 0x3C, 0x36, 0x98, 0x05, 0xEA, 0x78, 0x70, 0xE1, 0xC3, 0x87,
+  0x0E, 0x1C, 0x20, 0x30, 0x10, 0x08, 0x3C, 0xE6, 0xC2, 0x83, 0x83, 0x83,
+  0x83, 0xC2, 0xE6, 0x3C, 0x0C, 0x18, 0x30, 0x3C, 0xE6, 0xC2, 0x83, 0x83,
+  0x83, 0x83, 0xC2, 0xE6, 0x3C, 0x38, 0x28, 0x44, 0x3C, 0xE6, 0xC2, 0x83,
+  0x83, 0x83, 0x83, 0xC2, 0xE6, 0x3C, 0x34, 0x5C, 0x00, 0x3C, 0xE6, 0xC2,
+  0x83, 0x83, 0x83, 0x83, 0xC2, 0xE6, 0x3C, 0x6C, 0x6C, 0x00, 0x3C, 0xE6,
+  0xC2, 0x83, 0x83, 0x83, 0x83, 0xC2, 0xE6, 0x3C, 0x18, 0x18, 0x00, 0xFF,
+  0x00, 0x00, 0x18, 0x18, 0x1E, 0xBB, 0x98, 0xC8, 0x7C, 0x5E, 0x4D, 0x46,
+  0xC2, 0x73, 0x4F, 0x00, 0x20, 0x20, 0x26, 0x1C, 0x38, 0x70, 0xE1, 0xC3,
+  0x87, 0x1E, 0x77, 0xA0, 0x0C, 0x30, 0x46, 0x1C, 0x38, 0x70, 0xE1, 0xC3,
+  0x87, 0x1E, 0x77, 0xA0, 0x18, 0x59, 0x16, 0x1C, 0x38, 0x70, 0xE1, 0xC3,
+  0x87, 0x1E, 0x77, 0xA0, 0x6C, 0xD8, 0x06, 0x1C, 0x38, 0x70, 0xE1, 0xC3,
+  0x87, 0x1E, 0x77, 0xA0, 0x04, 0x08, 0x10, 0xC3, 0x43, 0x42, 0x66, 0x26,
+  0x24, 0x34, 0x1C, 0x18, 0x18, 0x18, 0x10, 0x30, 0x60, 0xC0, 0xC0, 0xC0,
+  0xFC, 0xE6, 0xC3, 0xC1, 0xC1, 0xC1, 0xC1, 0xC3, 0xE6, 0xFC, 0xC0, 0xC0,
+  0xC0, 0x36, 0x36, 0x00, 0xC3, 0x43, 0x42, 0x66, 0x26, 0x24, 0x34, 0x1C,
+  0x18, 0x18, 0x18, 0x10, 0x30, 0x60 };
+
+constexpr GFXglyph FreeSans_RLE_9pt8bGlyphs[] PROGMEM = {
+  {     0,   1,   1,   4,    0,    0 },   // 0x20 ' '
+  {     1,   2,  13,   6,    2,  -12 },   // 0x21 '!'
+  {     5,   4,   4,   6,    1,  -12 },   // 0x22 '"'
+  {     7,  10,  12,  10,    0,  -11 },   // 0x23 '#'
+  {    22,   8,  16,  10,    1,  -13 },   // 0x24 '$'
+  {    38,  15,  13,  16,    0,  -12 },   // 0x25 '%'
+  {    63,  10,  13,  12,    1,  -12 },   // 0x26 '&'
+  {    80,   2,   4,   4,    1,  -12 },   // 0x27 '''
+  {    81,   4,  17,   6,    1,  -12 },   // 0x28 '('
+  {    90,   4,  17,   6,    1,  -12 },   // 0x29 ')'
+  {    99,   5,   5,   7,    1,  -12 },   // 0x2A '*'
+  {   103,   8,   9,  10,    1,   -8 },   // 0x2B '+'
+  {   112,   1,   5,   5,    2,   -1 },   // 0x2C ','
+  {   113,   4,   1,   6,    1,   -4 },   // 0x2D '-'
+  {   114,   2,   2,   4,    1,   -1 },   // 0x2E '.'
+  {   115,   5,  13,   5,    0,  -12 },   // 0x2F '/'
+  {   124,   8,  13,  10,    1,  -12 },   // 0x30 '0'
+  {   137,   4,  13,  10,    2,  -12 },   // 0x31 '1'
+  {   144,   8,  13,  10,    1,  -12 },   // 0x32 '2'
+  {   157,   8,  13,  10,    1,  -12 },   // 0x33 '3'
+  {   170,   9,  13,  10,    0,  -12 },   // 0x34 '4'
+  {   185,   8,  13,  10,    1,  -12 },   // 0x35 '5'
+  {   198,   8,  13,  10,    1,  -12 },   // 0x36 '6'
+  {   211,   8,  13,  10,    1,  -12 },   // 0x37 '7'
+  {   224,   8,  13,  10,    1,  -12 },   // 0x38 '8'
+  {   237,   8,  13,  10,    1,  -12 },   // 0x39 '9'
+  {   250,   2,  10,   4,    1,   -9 },   // 0x3A ':'
+  {   253,   2,  13,   4,    1,   -9 },   // 0x3B ';'
+  {   257,   8,   9,  10,    1,   -8 },   // 0x3C '<'
+  {   266,   8,   4,  10,    1,   -5 },   // 0x3D '='
+  {   270,   8,   9,  10,    1,   -8 },   // 0x3E '>'
+  {   279,   8,  13,  10,    1,  -12 },   // 0x3F '?'
+  {   292,  16,  15,  18,    1,  -12 },   // 0x40 '@'
+  {   322,  11,  13,  12,    0,  -12 },   // 0x41 'A'
+  {   340,  10,  13,  12,    1,  -12 },   // 0x42 'B'
+  {   357,  11,  13,  13,    1,  -12 },   // 0x43 'C'
+  {   375,  11,  13,  12,    1,  -12 },   // 0x44 'D'
+  {   393,  10,  13,  11,    1,  -12 },   // 0x45 'E'
+  {   410,   9,  13,  11,    1,  -12 },   // 0x46 'F'
+  {   425,  11,  13,  13,    1,  -12 },   // 0x47 'G'
+  {   443,  10,  13,  13,    1,  -12 },   // 0x48 'H'
+  {   460,   1,  13,   5,    2,  -12 },   // 0x49 'I'
+  {   462,   7,  13,   9,    1,  -12 },   // 0x4A 'J'
+  {   474,  11,  13,  12,    1,  -12 },   // 0x4B 'K'
+  {   492,   8,  13,  10,    1,  -12 },   // 0x4C 'L'
+  {   505,  12,  13,  15,    1,  -12 },   // 0x4D 'M'
+  {   525,  10,  13,  13,    1,  -12 },   // 0x4E 'N'
+  {   542,  12,  13,  14,    1,  -12 },   // 0x4F 'O'
+  {   562,  10,  13,  12,    1,  -12 },   // 0x50 'P'
+  {   579,  12,  14,  14,    1,  -12 },   // 0x51 'Q'
+  {   600,  11,  13,  13,    1,  -12 },   // 0x52 'R'
+  {   618,  10,  13,  12,    1,  -12 },   // 0x53 'S'
+  {   635,  10,  13,  11,    1,  -12 },   // 0x54 'T'
+  {   652,  10,  13,  13,    1,  -12 },   // 0x55 'U'
+  {   669,  11,  13,  11,    0,  -12 },   // 0x56 'V'
+  {   687,  16,  13,  17,    0,  -12 },   // 0x57 'W'
+  {   713,  11,  13,  12,    0,  -12 },   // 0x58 'X'
+  {   731,  12,  13,  12,    0,  -12 },   // 0x59 'Y'
+  {   751,   9,  13,  11,    1,  -12 },   // 0x5A 'Z'
+  {   766,   3,  17,   5,    1,  -12 },   // 0x5B '['
+  {   773,   5,  13,   5,    0,  -12 },   // 0x5C '\'
+  {   782,   4,  17,   5,    0,  -12 },   // 0x5D ']'
+  {   791,   6,   7,   8,    1,  -12 },   // 0x5E '^'
+  {   797,  10,   1,  10,    0,    3 },   // 0x5F '_'
+  {   799,   4,   3,   4,    0,  -12 },   // 0x60 '`'
+  {   801,   8,  10,  10,    1,   -9 },   // 0x61 'a'
+  {   811,   8,  13,  10,    1,  -12 },   // 0x62 'b'
+  {   824,   7,  10,   9,    1,   -9 },   // 0x63 'c'
+  {   833,   8,  13,  10,    1,  -12 },   // 0x64 'd'
+  {   846,   8,  10,   9,    1,   -9 },   // 0x65 'e'
+  {   856,   5,  13,   5,    0,  -12 },   // 0x66 'f'
+  {   865,   8,  13,  10,    1,   -9 },   // 0x67 'g'
+  {   878,   7,  13,   9,    1,  -12 },   // 0x68 'h'
+  {   890,   2,  13,   4,    1,  -12 },   // 0x69 'i'
+  {   894,   3,  17,   4,    0,  -12 },   // 0x6A 'j'
+  {   901,   8,  13,   9,    1,  -12 },   // 0x6B 'k'
+  {   914,   2,  13,   4,    1,  -12 },   // 0x6C 'l'
+  {   918,  12,  10,  14,    1,   -9 },   // 0x6D 'm'
+  {   933,   7,  10,   9,    1,   -9 },   // 0x6E 'n'
+  {   942,   8,  10,   9,    1,   -9 },   // 0x6F 'o'
+  {   952,   8,  13,  10,    1,   -9 },   // 0x70 'p'
+  {   965,   8,  13,  10,    1,   -9 },   // 0x71 'q'
+  {   978,   4,  10,   6,    1,   -9 },   // 0x72 'r'
+  {   983,   7,  10,   9,    1,   -9 },   // 0x73 's'
+  {   992,   5,  13,   5,    0,  -12 },   // 0x74 't'
+  {  1001,   7,  10,   9,    1,   -9 },   // 0x75 'u'
+  {  1010,   9,  10,   9,    0,   -9 },   // 0x76 'v'
+  {  1022,  13,  10,  13,    0,   -9 },   // 0x77 'w'
+  {  1039,   8,  10,   8,    0,   -9 },   // 0x78 'x'
+  {  1049,   8,  14,   8,    0,   -9 },   // 0x79 'y'
+  {  1063,   7,  10,   9,    1,   -9 },   // 0x7A 'z'
+  {  1072,   4,  17,   6,    1,  -12 },   // 0x7B '{'
+  {  1081,   1,  17,   4,    2,  -12 },   // 0x7C '|'
+  {  1084,   4,  17,   6,    1,  -12 },   // 0x7D '}'
+  {  1093,   7,   3,   9,    1,   -7 },   // 0x7E '~'
+  {  1096,  12,  17,  14,    1,  -13 },   // 0x7F ''
+  {  1122,  12,  17,  14,    1,  -13 },   // 0x80 ''
+  {  1148,  12,  17,  14,    1,  -13 },   // 0x81 ''
+  {  1174,  12,  17,  14,    1,  -13 },   // 0x82 ''
+  {  1200,  12,  17,  14,    1,  -13 },   // 0x83 ''
+  {  1226,  12,  17,  14,    1,  -13 },   // 0x84 ''
+  {  1252,  12,  17,  14,    1,  -13 },   // 0x85 ''
+  {  1278,  12,  17,  14,    1,  -13 },   // 0x86 ''
+  {  1304,  12,  17,  14,    1,  -13 },   // 0x87 ''
+  {  1330,  12,  17,  14,    1,  -13 },   // 0x88 ''
+  {  1356,  12,  17,  14,    1,  -13 },   // 0x89 ''
+  {  1382,  12,  17,  14,    1,  -13 },   // 0x8A ''
+  {  1408,  12,  17,  14,    1,  -13 },   // 0x8B ''
+  {  1434,  12,  17,  14,    1,  -13 },   // 0x8C ''
+  {  1460,  12,  17,  14,    1,  -13 },   // 0x8D ''
+  {  1486,  12,  17,  14,    1,  -13 },   // 0x8E ''
+  {  1512,  12,  17,  14,    1,  -13 },   // 0x8F ''
+  {  1538,  12,  17,  14,    1,  -13 },   // 0x90 ''
+  {  1564,  12,  17,  14,    1,  -13 },   // 0x91 ''
+  {  1590,  12,  17,  14,    1,  -13 },   // 0x92 ''
+  {  1616,  12,  17,  14,    1,  -13 },   // 0x93 ''
+  {  1642,  12,  17,  14,    1,  -13 },   // 0x94 ''
+  {  1668,  12,  17,  14,    1,  -13 },   // 0x95 ''
+  {  1694,  12,  17,  14,    1,  -13 },   // 0x96 ''
+  {  1720,  12,  17,  14,    1,  -13 },   // 0x97 ''
+  {  1746,  12,  17,  14,    1,  -13 },   // 0x98 ''
+  {  1772,  12,  17,  14,    1,  -13 },   // 0x99 ''
+  {  1798,  12,  17,  14,    1,  -13 },   // 0x9A ''
+  {  1824,  12,  17,  14,    1,  -13 },   // 0x9B ''
+  {  1850,  12,  17,  14,    1,  -13 },   // 0x9C ''
+  {  1876,  12,  17,  14,    1,  -13 },   // 0x9D ''
+  {  1902,  12,  17,  14,    1,  -13 },   // 0x9E ''
+  {  1928,  12,  17,  14,    1,  -13 },   // 0x9F ''
+  {  1954,   1,   1,   5,    0,    0 },   // 0xA0 ''
+  {  1955,   2,  13,   6,    2,   -8 },   // 0xA1 ''
+  {  1959,   8,  14,  10,    1,  -11 },   // 0xA2 ''
+  {  1973,   9,  13,  10,    0,  -12 },   // 0xA3 ''
+  {  1988,   8,   8,  10,    1,   -9 },   // 0xA4 ''
+  {  1996,  10,  13,  10,    0,  -12 },   // 0xA5 ''
+  {  2013,   1,  17,   5,    2,  -12 },   // 0xA6 ''
+  {  2016,   8,  17,  10,    1,  -12 },   // 0xA7 ''
+  {  2033,   5,   2,   6,    0,  -12 },   // 0xA8 ''
+  {  2035,  12,  13,  14,    1,  -12 },   // 0xA9 ''
+  {  2055,   5,   8,   7,    1,  -12 },   // 0xAA ''
+  {  2060,   7,   6,   9,    1,   -7 },   // 0xAB ''
+  {  2066,   9,   5,  10,    1,   -5 },   // 0xAC ''
+  {  2072,   4,   1,   6,    1,   -4 },   // 0xAD ''
+  {  2073,  12,  13,  14,    1,  -12 },   // 0xAE ''
+  {  2093,   5,   1,   6,    0,  -12 },   // 0xAF ''
+  {  2094,   5,   5,  11,    3,  -11 },   // 0xB0 ''
+  {  2098,   8,  11,  10,    1,  -10 },   // 0xB1 ''
+  {  2109,   6,   7,   6,    0,  -13 },   // 0xB2 ''
+  {  2115,   6,   7,   6,    0,  -13 },   // 0xB3 ''
+  {  2121,   3,   3,   6,    2,  -12 },   // 0xB4 ''
+  {  2123,   9,  13,  10,    1,   -9 },   // 0xB5 ''
+  {  2138,   8,  16,   9,    1,  -12 },   // 0xB6 ''
+  {  2154,   1,   2,   4,    2,   -5 },   // 0xB7 ''
+  {  2155,   4,   4,   6,    1,    1 },   // 0xB8 ''
+  {  2157,   3,   7,   6,    1,  -13 },   // 0xB9 ''
+  {  2160,   5,   8,   6,    1,  -12 },   // 0xBA ''
+  {  2165,   7,   6,   9,    1,   -7 },   // 0xBB ''
+  {  2171,  14,  13,  15,    1,  -12 },   // 0xBC ''
+  {  2194,  14,  13,  15,    1,  -12 },   // 0xBD ''
+  {  2217,  15,  13,  16,    0,  -12 },   // 0xBE ''
+  {  2242,   7,  13,  10,    2,   -8 },   // 0xBF ''
+  {  2254,  11,  16,  12,    0,  -15 },   // 0xC0 ''
+  {  2276,  11,  16,  12,    0,  -15 },   // 0xC1 ''
+  {  2298,  11,  16,  12,    0,  -15 },   // 0xC2 ''
+  {  2320,  11,  16,  12,    0,  -15 },   // 0xC3 ''
+  {  2342,  11,  16,  12,    0,  -15 },   // 0xC4 ''
+  {  2364,  11,  17,  12,    0,  -16 },   // 0xC5 ''
+  {  2388,  17,  13,  17,    0,  -12 },   // 0xC6 ''
+  {  2416,  11,  17,  13,    1,  -12 },   // 0xC7 ''
+  {  2440,  10,  16,  11,    1,  -15 },   // 0xC8 ''
+  {  2460,  10,  16,  11,    1,  -15 },   // 0xC9 ''
+  {  2480,  10,  16,  11,    1,  -15 },   // 0xCA ''
+  {  2500,  10,  16,  11,    1,  -15 },   // 0xCB ''
+  {  2520,   4,  16,   5,    0,  -15 },   // 0xCC ''
+  {  2528,   4,  16,   5,    1,  -15 },   // 0xCD ''
+  {  2536,   5,  16,   5,    0,  -15 },   // 0xCE ''
+  {  2546,   5,  16,   5,    0,  -15 },   // 0xCF ''
+  {  2556,  12,  13,  12,    0,  -12 },   // 0xD0 ''
+  {  2576,  10,  16,  13,    1,  -15 },   // 0xD1 ''
+  {  2596,  12,  16,  14,    1,  -15 },   // 0xD2 ''
+  {  2620,  12,  16,  14,    1,  -15 },   // 0xD3 ''
+  {  2644,  12,  16,  14,    1,  -15 },   // 0xD4 ''
+  {  2668,  12,  16,  14,    1,  -15 },   // 0xD5 ''
+  {  2692,  12,  16,  14,    1,  -15 },   // 0xD6 ''
+  {  2716,   7,   7,  10,    2,   -7 },   // 0xD7 ''
+  {  2723,  12,  13,  14,    1,  -12 },   // 0xD8 ''
+  {  2743,  10,  16,  13,    1,  -15 },   // 0xD9 ''
+  {  2763,  10,  16,  13,    1,  -15 },   // 0xDA ''
+  {  2783,  10,  16,  13,    1,  -15 },   // 0xDB ''
+  {  2803,  10,  16,  13,    1,  -15 },   // 0xDC ''
+  {  2823,  12,  16,  12,    0,  -15 },   // 0xDD ''
+  {  2847,  10,  13,  11,    1,  -12 },   // 0xDE ''
+  {  2864,   9,  13,  10,    1,  -12 },   // 0xDF ''
+  {  2879,   8,  13,  10,    1,  -12 },   // 0xE0 ''
+  {  2892,   8,  13,  10,    1,  -12 },   // 0xE1 ''
+  {  2905,   8,  13,  10,    1,  -12 },   // 0xE2 ''
+  {  2918,   8,  13,  10,    1,  -12 },   // 0xE3 ''
+  {  2931,   8,  13,  10,    1,  -12 },   // 0xE4 ''
+  {  2944,   8,  14,  10,    1,  -13 },   // 0xE5 ''
+  {  2958,  14,  10,  15,    1,   -9 },   // 0xE6 ''
+  {  2976,   7,  14,   9,    1,   -9 },   // 0xE7 ''
+  {  2989,   8,  13,   9,    1,  -12 },   // 0xE8 ''
+  {  3002,   8,  13,   9,    1,  -12 },   // 0xE9 ''
+  {  3015,   8,  13,   9,    1,  -12 },   // 0xEA ''
+  {  3028,   8,  13,   9,    1,  -12 },   // 0xEB ''
+  {  3041,   4,  13,   4,    0,  -12 },   // 0xEC ''
+  {  3048,   4,  13,   4,    0,  -12 },   // 0xED ''
+  {  3055,   5,  14,   5,    0,  -13 },   // 0xEE ''
+  {  3064,   5,  14,   5,    0,  -13 },   // 0xEF ''
+  {  3073,   8,  14,   9,    1,  -13 },   // 0xF0 ''
+  {  3087,   7,  13,   9,    1,  -12 },   // 0xF1 ''
+  {  3099,   8,  13,   9,    1,  -12 },   // 0xF2 ''
+  {  3112,   8,  13,   9,    1,  -12 },   // 0xF3 ''
+  {  3125,   8,  13,   9,    1,  -12 },   // 0xF4 ''
+  {  3138,   8,  13,   9,    1,  -12 },   // 0xF5 ''
+  {  3151,   8,  13,   9,    1,  -12 },   // 0xF6 ''
+  {  3164,   8,   8,  10,    1,   -7 },   // 0xF7 ''
+  {  3172,   9,  10,   9,    0,   -9 },   // 0xF8 ''
+  {  3184,   7,  13,   9,    1,  -12 },   // 0xF9 ''
+  {  3196,   7,  13,   9,    1,  -12 },   // 0xFA ''
+  {  3208,   7,  13,   9,    1,  -12 },   // 0xFB ''
+  {  3220,   7,  13,   9,    1,  -12 },   // 0xFC ''
+  {  3232,   8,  17,   8,    0,  -12 },   // 0xFD ''
+  {  3249,   8,  16,  10,    1,  -12 },   // 0xFE ''
+  {  3265,   8,  17,   8,    0,  -12 } }; // 0xFF ''
+
+constexpr GFXfont FreeSans_RLE_9pt8b PROGMEM = {
+  (uint8_t  *)FreeSans_RLE_9pt8bBitmaps,
+  (GFXglyph *)FreeSans_RLE_9pt8bGlyphs,
+  0x20, 0xFF, 21 };
+
+// Approx. 4857 bytes
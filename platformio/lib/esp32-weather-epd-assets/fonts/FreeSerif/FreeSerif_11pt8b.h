@@ -368,7 +368,7 @@ const uint8_t FreeSerif_11pt8bBitmaps[] PROGMEM = {
   0x23, 0x08, 0xC4, 0x19, 0x06, 0x40, 0xE0, 0x38, 0x04, 0x01, 0x00, 0x40,
   0x20, 0x08, 0x3C, 0x06, 0x00 };
 
-const GFXglyph FreeSerif_11pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph FreeSerif_11pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   5,    0,    0 },   // 0x20 ' '
   {     1,   2,  15,   7,    3,  -14 },   // 0x21 '!'
   {     5,   5,   5,   9,    2,  -13 },   // 0x22 '"'
@@ -594,7 +594,7 @@ const GFXglyph FreeSerif_11pt8bGlyphs[] PROGMEM = {
   {  4360,  10,  20,  11,    0,  -14 },   // 0xFE ''
   {  4385,  10,  19,  10,    0,  -13 } }; // 0xFF ''
 
-const GFXfont FreeSerif_11pt8b PROGMEM = {
+constexpr GFXfont FreeSerif_11pt8b PROGMEM = {
   (uint8_t  *)FreeSerif_11pt8bBitmaps,
   (GFXglyph *)FreeSerif_11pt8bGlyphs,
   0x20, 0xFF, 26 };
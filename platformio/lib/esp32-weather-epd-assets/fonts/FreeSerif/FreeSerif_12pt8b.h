@@ -424,7 +424,7 @@ const uint8_t FreeSerif_12pt8bBitmaps[] PROGMEM = {
   0xC4, 0x18, 0x83, 0x20, 0x34, 0x06, 0x80, 0x60, 0x0C, 0x01, 0x00, 0x20,
   0x04, 0x01, 0x01, 0xE0, 0x38, 0x00 };
 
-const GFXglyph FreeSerif_12pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph FreeSerif_12pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   6,    0,    0 },   // 0x20 ' '
   {     1,   3,  16,   8,    3,  -15 },   // 0x21 '!'
   {     7,   6,   6,   9,    2,  -15 },   // 0x22 '"'
@@ -650,7 +650,7 @@ const GFXglyph FreeSerif_12pt8bGlyphs[] PROGMEM = {
   {  5025,  11,  21,  12,    0,  -15 },   // 0xFE ''
   {  5054,  11,  20,  11,    0,  -14 } }; // 0xFF ''
 
-const GFXfont FreeSerif_12pt8b PROGMEM = {
+constexpr GFXfont FreeSerif_12pt8b PROGMEM = {
   (uint8_t  *)FreeSerif_12pt8bBitmaps,
   (GFXglyph *)FreeSerif_12pt8bGlyphs,
   0x20, 0xFF, 28 };
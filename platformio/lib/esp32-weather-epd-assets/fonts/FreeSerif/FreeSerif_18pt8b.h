@@ -927,7 +927,7 @@ const uint8_t FreeSerif_18pt8bBitmaps[] PROGMEM = {
   0x01, 0xE0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0x80, 0x00, 0x80, 0x01, 0x80,
   0x01, 0x00, 0x23, 0x00, 0x7E, 0x00, 0x7C, 0x00, 0x38, 0x00 };
 
-const GFXglyph FreeSerif_18pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph FreeSerif_18pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   9,    0,    0 },   // 0x20 ' '
   {     1,   3,  24,  12,    5,  -23 },   // 0x21 '!'
   {    10,   9,   9,  14,    3,  -23 },   // 0x22 '"'
@@ -1153,7 +1153,7 @@ const GFXglyph FreeSerif_18pt8bGlyphs[] PROGMEM = {
   { 10994,  17,  32,  18,    0,  -23 },   // 0xFE ''
   { 11062,  16,  30,  17,    0,  -21 } }; // 0xFF ''
 
-const GFXfont FreeSerif_18pt8b PROGMEM = {
+constexpr GFXfont FreeSerif_18pt8b PROGMEM = {
   (uint8_t  *)FreeSerif_18pt8bBitmaps,
   (GFXglyph *)FreeSerif_18pt8bGlyphs,
   0x20, 0xFF, 42 };
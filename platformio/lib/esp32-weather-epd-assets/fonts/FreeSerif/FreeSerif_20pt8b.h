@@ -1166,7 +1166,7 @@ const uint8_t FreeSerif_20pt8bBitmaps[] PROGMEM = {
   0x00, 0x02, 0x00, 0x01, 0x80, 0x1E, 0xC0, 0x07, 0xF0, 0x01, 0xF8, 0x00,
   0x3C, 0x00, 0x00 };
 
-const GFXglyph FreeSerif_20pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph FreeSerif_20pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,  10,    0,    0 },   // 0x20 ' '
   {     1,   4,  27,  13,    5,  -26 },   // 0x21 '!'
   {    15,  10,  10,  16,    3,  -26 },   // 0x22 '"'
@@ -1392,7 +1392,7 @@ const GFXglyph FreeSerif_20pt8bGlyphs[] PROGMEM = {
   { 13824,  19,  35,  20,    0,  -26 },   // 0xFE ''
   { 13908,  18,  33,  18,    0,  -24 } }; // 0xFF ''
 
-const GFXfont FreeSerif_20pt8b PROGMEM = {
+constexpr GFXfont FreeSerif_20pt8b PROGMEM = {
   (uint8_t  *)FreeSerif_20pt8bBitmaps,
   (GFXglyph *)FreeSerif_20pt8bGlyphs,
   0x20, 0xFF, 47 };
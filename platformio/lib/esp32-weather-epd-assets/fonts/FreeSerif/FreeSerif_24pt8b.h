@@ -1683,7 +1683,7 @@ const uint8_t FreeSerif_24pt8bBitmaps[] PROGMEM = {
   0x60, 0x00, 0x01, 0x80, 0x03, 0x0C, 0x00, 0x1F, 0xF0, 0x00, 0x7F, 0x80,
   0x01, 0xFC, 0x00, 0x03, 0xE0, 0x00, 0x00 };
 
-const GFXglyph FreeSerif_24pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph FreeSerif_24pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,  12,    0,    0 },   // 0x20 ' '
   {     1,   5,  32,  16,    6,  -30 },   // 0x21 '!'
   {    21,  12,  12,  19,    3,  -31 },   // 0x22 '"'
@@ -1909,7 +1909,7 @@ const GFXglyph FreeSerif_24pt8bGlyphs[] PROGMEM = {
   { 19964,  22,  43,  24,    0,  -32 },   // 0xFE ''
   { 20083,  22,  39,  22,    0,  -28 } }; // 0xFF ''
 
-const GFXfont FreeSerif_24pt8b PROGMEM = {
+constexpr GFXfont FreeSerif_24pt8b PROGMEM = {
   (uint8_t  *)FreeSerif_24pt8bBitmaps,
   (GFXglyph *)FreeSerif_24pt8bGlyphs,
   0x20, 0xFF, 56 };
@@ -290,7 +290,7 @@ const uint8_t FreeSerif_48pt8b_temperatureBitmaps[] PROGMEM = {
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00 };
 
-const GFXglyph FreeSerif_48pt8b_temperatureGlyphs[] PROGMEM = {
+constexpr GFXglyph FreeSerif_48pt8b_temperatureGlyphs[] PROGMEM = {
   {     0,   1,   1,  56,    0,    0 },   // 0x20 ' '
   {     1,   1,   1,  56,    0,    0 },   // 0x21 '!'
   {     2,   1,   1,  56,    0,    0 },   // 0x22 '"'
@@ -516,7 +516,7 @@ const GFXglyph FreeSerif_48pt8b_temperatureGlyphs[] PROGMEM = {
   {  3469,   1,   1,  56,    0,    0 },   // 0xFE ''
   {  3470,   1,   1,  56,    0,    0 } }; // 0xFF ''
 
-const GFXfont FreeSerif_48pt8b_temperature PROGMEM = {
+constexpr GFXfont FreeSerif_48pt8b_temperature PROGMEM = {
   (uint8_t  *)FreeSerif_48pt8b_temperatureBitmaps,
   (GFXglyph *)FreeSerif_48pt8b_temperatureGlyphs,
   0x20, 0xFF, 113 };
@@ -59,7 +59,7 @@ const uint8_t FreeSerif_4pt8bBitmaps[] PROGMEM = {
   0x42, 0xAA, 0xA6, 0x2A, 0xAA, 0x60, 0x20, 0x86, 0x64, 0x4C, 0x86, 0x99,
   0xAC, 0x80, 0x60, 0x86, 0x64, 0x4C };
 
-const GFXglyph FreeSerif_4pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph FreeSerif_4pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   2,    0,    0 },   // 0x20 ' '
   {     1,   1,   5,   3,    1,   -4 },   // 0x21 '!'
   {     2,   2,   2,   3,    1,   -4 },   // 0x22 '"'
@@ -285,7 +285,7 @@ const GFXglyph FreeSerif_4pt8bGlyphs[] PROGMEM = {
   {   694,   4,   7,   4,    0,   -4 },   // 0xFE ''
   {   698,   4,   8,   4,    0,   -5 } }; // 0xFF ''
 
-const GFXfont FreeSerif_4pt8b PROGMEM = {
+constexpr GFXfont FreeSerif_4pt8b PROGMEM = {
   (uint8_t  *)FreeSerif_4pt8bBitmaps,
   (GFXglyph *)FreeSerif_4pt8bGlyphs,
   0x20, 0xFF, 9 };
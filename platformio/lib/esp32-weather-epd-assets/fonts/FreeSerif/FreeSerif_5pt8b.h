@@ -89,7 +89,7 @@ const uint8_t FreeSerif_5pt8bBitmaps[] PROGMEM = {
   0x01, 0x05, 0x28, 0x84, 0x22, 0x30, 0x42, 0x1C, 0x94, 0xA9, 0x4C, 0x42,
   0x00, 0x50, 0x20, 0xA5, 0x10, 0x84, 0x46, 0x00 };
 
-const GFXglyph FreeSerif_5pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph FreeSerif_5pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   2,    0,    0 },   // 0x20 ' '
   {     1,   1,   7,   3,    1,   -6 },   // 0x21 '!'
   {     2,   2,   2,   4,    1,   -5 },   // 0x22 '"'
@@ -315,7 +315,7 @@ const GFXglyph FreeSerif_5pt8bGlyphs[] PROGMEM = {
   {  1050,   5,  10,   5,    0,   -6 },   // 0xFE ''
   {  1057,   5,  10,   5,    0,   -6 } }; // 0xFF ''
 
-const GFXfont FreeSerif_5pt8b PROGMEM = {
+constexpr GFXfont FreeSerif_5pt8b PROGMEM = {
   (uint8_t  *)FreeSerif_5pt8bBitmaps,
   (GFXglyph *)FreeSerif_5pt8bGlyphs,
   0x20, 0xFF, 12 };
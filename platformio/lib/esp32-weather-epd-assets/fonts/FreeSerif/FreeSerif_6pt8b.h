@@ -117,7 +117,7 @@ const uint8_t FreeSerif_6pt8bBitmaps[] PROGMEM = {
   0x49, 0x14, 0x52, 0x71, 0x04, 0x10, 0x48, 0x12, 0x95, 0x18, 0xC4, 0x21,
   0x30 };
 
-const GFXglyph FreeSerif_6pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph FreeSerif_6pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   3,    0,    0 },   // 0x20 ' '
   {     1,   1,   8,   4,    2,   -7 },   // 0x21 '!'
   {     2,   3,   3,   5,    1,   -7 },   // 0x22 '"'
@@ -343,7 +343,7 @@ const GFXglyph FreeSerif_6pt8bGlyphs[] PROGMEM = {
   {  1377,   6,  12,   6,    0,   -8 },   // 0xFE ''
   {  1386,   5,  11,   6,    0,   -7 } }; // 0xFF ''
 
-const GFXfont FreeSerif_6pt8b PROGMEM = {
+constexpr GFXfont FreeSerif_6pt8b PROGMEM = {
   (uint8_t  *)FreeSerif_6pt8bBitmaps,
   (GFXglyph *)FreeSerif_6pt8bGlyphs,
   0x20, 0xFF, 14 };
@@ -157,7 +157,7 @@ const uint8_t FreeSerif_7pt8bBitmaps[] PROGMEM = {
   0x40, 0x81, 0x02, 0xE6, 0x48, 0x91, 0x22, 0x44, 0xD1, 0x42, 0x04, 0x00,
   0x6C, 0x04, 0x51, 0x28, 0xA3, 0x04, 0x10, 0x82, 0x30 };
 
-const GFXglyph FreeSerif_7pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph FreeSerif_7pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   3,    0,    0 },   // 0x20 ' '
   {     1,   1,   9,   5,    2,   -8 },   // 0x21 '!'
   {     3,   3,   3,   5,    1,   -8 },   // 0x22 '"'
@@ -383,7 +383,7 @@ const GFXglyph FreeSerif_7pt8bGlyphs[] PROGMEM = {
   {  1860,   7,  13,   7,    0,   -9 },   // 0xFE ''
   {  1872,   6,  12,   6,    0,   -8 } }; // 0xFF ''
 
-const GFXfont FreeSerif_7pt8b PROGMEM = {
+constexpr GFXfont FreeSerif_7pt8b PROGMEM = {
   (uint8_t  *)FreeSerif_7pt8bBitmaps,
   (GFXglyph *)FreeSerif_7pt8bGlyphs,
   0x20, 0xFF, 16 };
@@ -198,7 +198,7 @@ const uint8_t FreeSerif_8pt8bBitmaps[] PROGMEM = {
   0xCC, 0xD8, 0xB1, 0x62, 0xC5, 0xF3, 0x06, 0x0C, 0x18, 0x00, 0x24, 0x48,
   0x02, 0x16, 0x44, 0x89, 0x0C, 0x18, 0x30, 0x40, 0x86, 0x1C, 0x00 };
 
-const GFXglyph FreeSerif_8pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph FreeSerif_8pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   4,    0,    0 },   // 0x20 ' '
   {     1,   2,  11,   5,    2,  -10 },   // 0x21 '!'
   {     4,   4,   4,   6,    1,  -10 },   // 0x22 '"'
@@ -424,7 +424,7 @@ const GFXglyph FreeSerif_8pt8bGlyphs[] PROGMEM = {
   {  2348,   7,  15,   8,    0,  -10 },   // 0xFE ''
   {  2362,   7,  14,   7,    0,   -9 } }; // 0xFF ''
 
-const GFXfont FreeSerif_8pt8b PROGMEM = {
+constexpr GFXfont FreeSerif_8pt8b PROGMEM = {
   (uint8_t  *)FreeSerif_8pt8bBitmaps,
   (GFXglyph *)FreeSerif_8pt8bGlyphs,
   0x20, 0xFF, 19 };
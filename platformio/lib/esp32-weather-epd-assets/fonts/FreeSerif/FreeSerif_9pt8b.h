@@ -243,7 +243,7 @@ const uint8_t FreeSerif_9pt8bBitmaps[] PROGMEM = {
   0x60, 0x60, 0x60, 0x36, 0x22, 0x00, 0x61, 0x62, 0x22, 0x34, 0x14, 0x1C,
   0x08, 0x08, 0x08, 0x10, 0x50, 0x60 };
 
-const GFXglyph FreeSerif_9pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph FreeSerif_9pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   4,    0,    0 },   // 0x20 ' '
   {     1,   2,  12,   6,    2,  -11 },   // 0x21 '!'
   {     4,   5,   4,   7,    1,  -11 },   // 0x22 '"'
@@ -469,7 +469,7 @@ const GFXglyph FreeSerif_9pt8bGlyphs[] PROGMEM = {
   {  2879,   8,  16,   9,    0,  -11 },   // 0xFE ''
   {  2895,   8,  15,   8,    0,  -10 } }; // 0xFF ''
 
-const GFXfont FreeSerif_9pt8b PROGMEM = {
+constexpr GFXfont FreeSerif_9pt8b PROGMEM = {
   (uint8_t  *)FreeSerif_9pt8bBitmaps,
   (GFXglyph *)FreeSerif_9pt8bGlyphs,
   0x20, 0xFF, 21 };
@@ -295,7 +295,7 @@ const uint8_t Lato_Regular_10pt8bBitmaps[] PROGMEM = {
   0x00, 0x00, 0xC0, 0xD8, 0x26, 0x18, 0xC6, 0x33, 0x06, 0xC1, 0xA0, 0x38,
   0x0C, 0x03, 0x00, 0x80, 0x60, 0x30, 0x00 };
 
-const GFXglyph Lato_Regular_10pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph Lato_Regular_10pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   4,    0,    0 },   // 0x20 ' '
   {     1,   3,  14,   7,    2,  -13 },   // 0x21 '!'
   {     7,   4,   5,   8,    2,  -13 },   // 0x22 '"'
@@ -521,7 +521,7 @@ const GFXglyph Lato_Regular_10pt8bGlyphs[] PROGMEM = {
   {  3493,   9,  17,  11,    1,  -13 },   // 0xFE ''
   {  3513,  10,  17,  10,    0,  -13 } }; // 0xFF ''
 
-const GFXfont Lato_Regular_10pt8b PROGMEM = {
+constexpr GFXfont Lato_Regular_10pt8b PROGMEM = {
   (uint8_t  *)Lato_Regular_10pt8bBitmaps,
   (GFXglyph *)Lato_Regular_10pt8bGlyphs,
   0x20, 0xFF, 24 };
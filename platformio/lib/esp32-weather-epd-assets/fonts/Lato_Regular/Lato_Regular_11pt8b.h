@@ -352,7 +352,7 @@ const uint8_t Lato_Regular_11pt8bBitmaps[] PROGMEM = {
   0x31, 0x86, 0x31, 0x83, 0x30, 0x6C, 0x0D, 0x80, 0xE0, 0x1C, 0x01, 0x80,
   0x60, 0x0C, 0x03, 0x00, 0x60, 0x00 };
 
-const GFXglyph Lato_Regular_11pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph Lato_Regular_11pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   4,    0,    0 },   // 0x20 ' '
   {     1,   3,  15,   8,    2,  -14 },   // 0x21 '!'
   {     7,   5,   5,   9,    2,  -14 },   // 0x22 '"'
@@ -578,7 +578,7 @@ const GFXglyph Lato_Regular_11pt8bGlyphs[] PROGMEM = {
   {  4168,   9,  20,  12,    2,  -15 },   // 0xFE ''
   {  4191,  11,  19,  11,    0,  -14 } }; // 0xFF ''
 
-const GFXfont Lato_Regular_11pt8b PROGMEM = {
+constexpr GFXfont Lato_Regular_11pt8b PROGMEM = {
   (uint8_t  *)Lato_Regular_11pt8bBitmaps,
   (GFXglyph *)Lato_Regular_11pt8bGlyphs,
   0x20, 0xFF, 26 };
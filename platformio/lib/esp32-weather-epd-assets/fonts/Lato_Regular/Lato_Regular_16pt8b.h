@@ -706,7 +706,7 @@ const uint8_t Lato_Regular_16pt8bBitmaps[] PROGMEM = {
   0xE0, 0x03, 0xC0, 0x03, 0xC0, 0x01, 0x80, 0x03, 0x80, 0x03, 0x80, 0x07,
   0x00, 0x07, 0x00, 0x06, 0x00, 0x0E, 0x00 };
 
-const GFXglyph Lato_Regular_16pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph Lato_Regular_16pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   6,    0,    0 },   // 0x20 ' '
   {     1,   4,  22,  11,    3,  -21 },   // 0x21 '!'
   {    12,   8,   8,  12,    2,  -21 },   // 0x22 '"'
@@ -932,7 +932,7 @@ const GFXglyph Lato_Regular_16pt8bGlyphs[] PROGMEM = {
   {  8364,  14,  28,  17,    2,  -22 },   // 0xFE ''
   {  8413,  16,  27,  16,    0,  -21 } }; // 0xFF ''
 
-const GFXfont Lato_Regular_16pt8b PROGMEM = {
+constexpr GFXfont Lato_Regular_16pt8b PROGMEM = {
   (uint8_t  *)Lato_Regular_16pt8bBitmaps,
   (GFXglyph *)Lato_Regular_16pt8bGlyphs,
   0x20, 0xFF, 38 };
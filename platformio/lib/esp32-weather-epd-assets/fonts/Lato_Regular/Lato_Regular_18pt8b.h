@@ -900,7 +900,7 @@ const uint8_t Lato_Regular_18pt8bBitmaps[] PROGMEM = {
   0x1E, 0x00, 0x07, 0x80, 0x01, 0xC0, 0x00, 0x70, 0x00, 0x38, 0x00, 0x0E,
   0x00, 0x07, 0x00, 0x01, 0xC0, 0x00, 0xF0, 0x00 };
 
-const GFXglyph Lato_Regular_18pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph Lato_Regular_18pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   7,    0,    0 },   // 0x20 ' '
   {     1,   4,  25,  12,    4,  -24 },   // 0x21 '!'
   {    14,   8,   9,  14,    3,  -24 },   // 0x22 '"'
@@ -1126,7 +1126,7 @@ const GFXglyph Lato_Regular_18pt8bGlyphs[] PROGMEM = {
   { 10666,  15,  32,  19,    3,  -25 },   // 0xFE ''
   { 10726,  18,  31,  18,    0,  -24 } }; // 0xFF ''
 
-const GFXfont Lato_Regular_18pt8b PROGMEM = {
+constexpr GFXfont Lato_Regular_18pt8b PROGMEM = {
   (uint8_t  *)Lato_Regular_18pt8bBitmaps,
   (GFXglyph *)Lato_Regular_18pt8bGlyphs,
   0x20, 0xFF, 42 };
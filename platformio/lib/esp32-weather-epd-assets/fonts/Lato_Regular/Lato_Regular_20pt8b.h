@@ -1116,7 +1116,7 @@ const uint8_t Lato_Regular_20pt8bBitmaps[] PROGMEM = {
   0xF0, 0x00, 0x0F, 0x00, 0x00, 0xE0, 0x00, 0x0E, 0x00, 0x01, 0xE0, 0x00,
   0x1C, 0x00, 0x03, 0xC0, 0x00, 0x38, 0x00, 0x07, 0x80, 0x00, 0x70, 0x00 };
 
-const GFXglyph Lato_Regular_20pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph Lato_Regular_20pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   8,    0,    0 },   // 0x20 ' '
   {     1,   5,  28,  13,    4,  -27 },   // 0x21 '!'
   {    19,   9,  10,  15,    3,  -27 },   // 0x22 '"'
@@ -1342,7 +1342,7 @@ const GFXglyph Lato_Regular_20pt8bGlyphs[] PROGMEM = {
   { 13230,  17,  36,  22,    3,  -28 },   // 0xFE ''
   { 13307,  20,  34,  20,    0,  -26 } }; // 0xFF ''
 
-const GFXfont Lato_Regular_20pt8b PROGMEM = {
+constexpr GFXfont Lato_Regular_20pt8b PROGMEM = {
   (uint8_t  *)Lato_Regular_20pt8bBitmaps,
   (GFXglyph *)Lato_Regular_20pt8bGlyphs,
   0x20, 0xFF, 47 };
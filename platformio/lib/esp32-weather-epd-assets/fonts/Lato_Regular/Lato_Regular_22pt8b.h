@@ -1354,7 +1354,7 @@ const uint8_t Lato_Regular_22pt8bBitmaps[] PROGMEM = {
   0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x01, 0xE0, 0x00, 0x07, 0x80, 0x00,
   0x3C, 0x00, 0x00, 0xF0, 0x00, 0x07, 0x80, 0x00 };
 
-const GFXglyph Lato_Regular_22pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph Lato_Regular_22pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   8,    0,    0 },   // 0x20 ' '
   {     1,   5,  31,  15,    5,  -30 },   // 0x21 '!'
   {    21,  11,  11,  17,    3,  -30 },   // 0x22 '"'
@@ -1580,7 +1580,7 @@ const GFXglyph Lato_Regular_22pt8bGlyphs[] PROGMEM = {
   { 16051,  19,  38,  24,    3,  -30 },   // 0xFE ''
   { 16142,  22,  37,  22,    0,  -29 } }; // 0xFF ''
 
-const GFXfont Lato_Regular_22pt8b PROGMEM = {
+constexpr GFXfont Lato_Regular_22pt8b PROGMEM = {
   (uint8_t  *)Lato_Regular_22pt8bBitmaps,
   (GFXglyph *)Lato_Regular_22pt8bGlyphs,
   0x20, 0xFF, 52 };
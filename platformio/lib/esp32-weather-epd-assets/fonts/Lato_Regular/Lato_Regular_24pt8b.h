@@ -1594,7 +1594,7 @@ const uint8_t Lato_Regular_24pt8bBitmaps[] PROGMEM = {
   0x00, 0x00, 0x78, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xE0,
   0x00, 0x01, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xC0, 0x00 };
 
-const GFXglyph Lato_Regular_24pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph Lato_Regular_24pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   9,    0,    0 },   // 0x20 ' '
   {     1,   6,  33,  16,    5,  -32 },   // 0x21 '!'
   {    26,  11,  12,  19,    4,  -32 },   // 0x22 '"'
@@ -1820,7 +1820,7 @@ const GFXglyph Lato_Regular_24pt8bGlyphs[] PROGMEM = {
   { 18895,  21,  42,  26,    3,  -33 },   // 0xFE ''
   { 19006,  24,  40,  24,    0,  -31 } }; // 0xFF ''
 
-const GFXfont Lato_Regular_24pt8b PROGMEM = {
+constexpr GFXfont Lato_Regular_24pt8b PROGMEM = {
   (uint8_t  *)Lato_Regular_24pt8bBitmaps,
   (GFXglyph *)Lato_Regular_24pt8bGlyphs,
   0x20, 0xFF, 56 };
@@ -1889,7 +1889,7 @@ const uint8_t Lato_Regular_26pt8bBitmaps[] PROGMEM = {
   0xE0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x1F, 0x00, 0x00,
   0x07, 0x80, 0x00, 0x03, 0xE0, 0x00, 0x00 };
 
-const GFXglyph Lato_Regular_26pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph Lato_Regular_26pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,  10,    0,    0 },   // 0x20 ' '
   {     1,   6,  36,  18,    6,  -35 },   // 0x21 '!'
   {    28,  12,  13,  20,    4,  -35 },   // 0x22 '"'
@@ -2115,7 +2115,7 @@ const GFXglyph Lato_Regular_26pt8bGlyphs[] PROGMEM = {
   { 22383,  23,  46,  28,    4,  -36 },   // 0xFE ''
   { 22516,  26,  45,  26,    0,  -35 } }; // 0xFF ''
 
-const GFXfont Lato_Regular_26pt8b PROGMEM = {
+constexpr GFXfont Lato_Regular_26pt8b PROGMEM = {
   (uint8_t  *)Lato_Regular_26pt8bBitmaps,
   (GFXglyph *)Lato_Regular_26pt8bGlyphs,
   0x20, 0xFF, 61 };
@@ -353,7 +353,7 @@ const uint8_t Lato_Regular_48pt8b_temperatureBitmaps[] PROGMEM = {
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
 
-const GFXglyph Lato_Regular_48pt8b_temperatureGlyphs[] PROGMEM = {
+constexpr GFXglyph Lato_Regular_48pt8b_temperatureGlyphs[] PROGMEM = {
   {     0,   1,   1,  50,    0,    0 },   // 0x20 ' '
   {     1,   1,   1,  50,    0,    0 },   // 0x21 '!'
   {     2,   1,   1,  50,    0,    0 },   // 0x22 '"'
@@ -579,7 +579,7 @@ const GFXglyph Lato_Regular_48pt8b_temperatureGlyphs[] PROGMEM = {
   {  4231,   1,   1,  50,    0,    0 },   // 0xFE ''
   {  4232,   1,   1,  50,    0,    0 } }; // 0xFF ''
 
-const GFXfont Lato_Regular_48pt8b_temperature PROGMEM = {
+constexpr GFXfont Lato_Regular_48pt8b_temperature PROGMEM = {
   (uint8_t  *)Lato_Regular_48pt8b_temperatureBitmaps,
   (GFXglyph *)Lato_Regular_48pt8b_temperatureGlyphs,
   0x20, 0xFF, 113 };
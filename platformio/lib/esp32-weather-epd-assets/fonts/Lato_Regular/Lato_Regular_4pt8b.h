@@ -55,7 +55,7 @@ const uint8_t Lato_Regular_4pt8bBitmaps[] PROGMEM = {
   0x99, 0x97, 0x20, 0x96, 0x64, 0x40, 0x93, 0xDB, 0xE0, 0x60, 0x96, 0x64,
   0x40 };
 
-const GFXglyph Lato_Regular_4pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph Lato_Regular_4pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   2,    0,    0 },   // 0x20 ' '
   {     1,   1,   6,   3,    1,   -5 },   // 0x21 '!'
   {     2,   2,   2,   3,    1,   -5 },   // 0x22 '"'
@@ -281,7 +281,7 @@ const GFXglyph Lato_Regular_4pt8bGlyphs[] PROGMEM = {
   {   642,   3,   7,   4,    1,   -5 },   // 0xFE ''
   {   645,   4,   7,   4,    0,   -5 } }; // 0xFF ''
 
-const GFXfont Lato_Regular_4pt8b PROGMEM = {
+constexpr GFXfont Lato_Regular_4pt8b PROGMEM = {
   (uint8_t  *)Lato_Regular_4pt8bBitmaps,
   (GFXglyph *)Lato_Regular_4pt8bGlyphs,
   0x20, 0xFF, 9 };
@@ -83,7 +83,7 @@ const uint8_t Lato_Regular_5pt8bBitmaps[] PROGMEM = {
   0xA0, 0x99, 0x99, 0xF0, 0x11, 0x22, 0xA5, 0x28, 0x84, 0x40, 0x88, 0xF9,
   0x99, 0xE8, 0x80, 0x50, 0x22, 0xA5, 0x28, 0x84, 0x40 };
 
-const GFXglyph Lato_Regular_5pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph Lato_Regular_5pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   2,    0,    0 },   // 0x20 ' '
   {     1,   1,   7,   3,    1,   -6 },   // 0x21 '!'
   {     2,   2,   3,   4,    1,   -6 },   // 0x22 '"'
@@ -309,7 +309,7 @@ const GFXglyph Lato_Regular_5pt8bGlyphs[] PROGMEM = {
   {   982,   4,   9,   6,    1,   -6 },   // 0xFE ''
   {   987,   5,   9,   5,    0,   -6 } }; // 0xFF ''
 
-const GFXfont Lato_Regular_5pt8b PROGMEM = {
+constexpr GFXfont Lato_Regular_5pt8b PROGMEM = {
   (uint8_t  *)Lato_Regular_5pt8bBitmaps,
   (GFXglyph *)Lato_Regular_5pt8bGlyphs,
   0x20, 0xFF, 12 };
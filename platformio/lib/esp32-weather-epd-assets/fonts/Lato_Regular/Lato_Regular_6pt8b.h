@@ -104,7 +104,7 @@ const uint8_t Lato_Regular_6pt8bBitmaps[] PROGMEM = {
   0x84, 0x21, 0xE8, 0xC6, 0x31, 0xF4, 0x20, 0x58, 0x08, 0x52, 0x48, 0xA3,
   0x04, 0x21, 0x80 };
 
-const GFXglyph Lato_Regular_6pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph Lato_Regular_6pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   2,    0,    0 },   // 0x20 ' '
   {     1,   2,   8,   4,    1,   -7 },   // 0x21 '!'
   {     3,   3,   3,   5,    1,   -7 },   // 0x22 '"'
@@ -330,7 +330,7 @@ const GFXglyph Lato_Regular_6pt8bGlyphs[] PROGMEM = {
   {  1224,   5,  11,   7,    1,   -8 },   // 0xFE ''
   {  1231,   6,  10,   6,    0,   -7 } }; // 0xFF ''
 
-const GFXfont Lato_Regular_6pt8b PROGMEM = {
+constexpr GFXfont Lato_Regular_6pt8b PROGMEM = {
   (uint8_t  *)Lato_Regular_6pt8bBitmaps,
   (GFXglyph *)Lato_Regular_6pt8bGlyphs,
   0x20, 0xFF, 14 };
@@ -149,7 +149,7 @@ const uint8_t Lato_Regular_7pt8bBitmaps[] PROGMEM = {
   0x08, 0x2E, 0xCE, 0x18, 0x61, 0x8F, 0xE8, 0x20, 0x34, 0x00, 0x06, 0x14,
   0x4C, 0x8A, 0x14, 0x18, 0x20, 0xC1, 0x00 };
 
-const GFXglyph Lato_Regular_7pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph Lato_Regular_7pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   3,    0,    0 },   // 0x20 ' '
   {     1,   1,  10,   5,    2,   -9 },   // 0x21 '!'
   {     3,   3,   3,   6,    1,   -9 },   // 0x22 '"'
@@ -375,7 +375,7 @@ const GFXglyph Lato_Regular_7pt8bGlyphs[] PROGMEM = {
   {  1763,   6,  12,   8,    1,   -9 },   // 0xFE ''
   {  1772,   7,  12,   7,    0,   -9 } }; // 0xFF ''
 
-const GFXfont Lato_Regular_7pt8b PROGMEM = {
+constexpr GFXfont Lato_Regular_7pt8b PROGMEM = {
   (uint8_t  *)Lato_Regular_7pt8bBitmaps,
   (GFXglyph *)Lato_Regular_7pt8bGlyphs,
   0x20, 0xFF, 16 };
@@ -187,7 +187,7 @@ const uint8_t Lato_Regular_8pt8bBitmaps[] PROGMEM = {
   0x18, 0x00, 0x36, 0x36, 0x00, 0xC3, 0x42, 0x62, 0x26, 0x34, 0x3C, 0x18,
   0x18, 0x10, 0x10, 0x30 };
 
-const GFXglyph Lato_Regular_8pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph Lato_Regular_8pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   3,    0,    0 },   // 0x20 ' '
   {     1,   2,  11,   5,    2,  -10 },   // 0x21 '!'
   {     4,   4,   4,   6,    1,  -10 },   // 0x22 '"'
@@ -413,7 +413,7 @@ const GFXglyph Lato_Regular_8pt8bGlyphs[] PROGMEM = {
   {  2209,   7,  14,   9,    1,  -10 },   // 0xFE ''
   {  2222,   8,  14,   8,    0,  -10 } }; // 0xFF ''
 
-const GFXfont Lato_Regular_8pt8b PROGMEM = {
+constexpr GFXfont Lato_Regular_8pt8b PROGMEM = {
   (uint8_t  *)Lato_Regular_8pt8bBitmaps,
   (GFXglyph *)Lato_Regular_8pt8bGlyphs,
   0x20, 0xFF, 19 };
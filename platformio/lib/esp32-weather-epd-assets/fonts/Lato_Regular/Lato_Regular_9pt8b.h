@@ -243,7 +243,7 @@ const uint8_t Lato_Regular_9pt8bBitmaps[] PROGMEM = {
   0xC0, 0xC0, 0xC0, 0x36, 0x19, 0x00, 0x00, 0x0C, 0x1B, 0x09, 0x8C, 0x46,
   0x32, 0x0B, 0x07, 0x03, 0x80, 0x80, 0xC0, 0x40, 0x60 };
 
-const GFXglyph Lato_Regular_9pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph Lato_Regular_9pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   3,    0,    0 },   // 0x20 ' '
   {     1,   2,  13,   6,    2,  -12 },   // 0x21 '!'
   {     5,   5,   4,   7,    1,  -12 },   // 0x22 '"'
@@ -469,7 +469,7 @@ const GFXglyph Lato_Regular_9pt8bGlyphs[] PROGMEM = {
   {  2879,   8,  16,  10,    1,  -12 },   // 0xFE ''
   {  2895,   9,  16,   9,    0,  -12 } }; // 0xFF ''
 
-const GFXfont Lato_Regular_9pt8b PROGMEM = {
+constexpr GFXfont Lato_Regular_9pt8b PROGMEM = {
   (uint8_t  *)Lato_Regular_9pt8bBitmaps,
   (GFXglyph *)Lato_Regular_9pt8bGlyphs,
   0x20, 0xFF, 21 };
@@ -309,7 +309,7 @@ const uint8_t Montserrat_Regular_10pt8bBitmaps[] PROGMEM = {
   0x00, 0x00, 0x1C, 0x04, 0x81, 0x98, 0x21, 0x04, 0x31, 0x02, 0x20, 0x4C,
   0x0D, 0x00, 0xE0, 0x18, 0x03, 0x00, 0x40, 0x98, 0x1E, 0x00 };
 
-const GFXglyph Montserrat_Regular_10pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph Montserrat_Regular_10pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   5,    0,    0 },   // 0x20 ' '
   {     1,   3,  14,   5,    1,  -13 },   // 0x21 '!'
   {     7,   5,   5,   7,    1,  -13 },   // 0x22 '"'
@@ -535,7 +535,7 @@ const GFXglyph Montserrat_Regular_10pt8bGlyphs[] PROGMEM = {
   {  3657,  10,  19,  13,    2,  -14 },   // 0xFE ''
   {  3681,  11,  18,  11,    0,  -13 } }; // 0xFF ''
 
-const GFXfont Montserrat_Regular_10pt8b PROGMEM = {
+constexpr GFXfont Montserrat_Regular_10pt8b PROGMEM = {
   (uint8_t  *)Montserrat_Regular_10pt8bBitmaps,
   (GFXglyph *)Montserrat_Regular_10pt8bGlyphs,
   0x20, 0xFF, 24 };
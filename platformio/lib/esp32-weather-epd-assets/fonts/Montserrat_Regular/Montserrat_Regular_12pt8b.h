@@ -439,7 +439,7 @@ const uint8_t Montserrat_Regular_12pt8bBitmaps[] PROGMEM = {
   0x18, 0x04, 0x40, 0x1B, 0x00, 0x68, 0x00, 0xE0, 0x03, 0x00, 0x0C, 0x00,
   0x30, 0x11, 0x80, 0xFC, 0x00, 0xC0, 0x00 };
 
-const GFXglyph Montserrat_Regular_12pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph Montserrat_Regular_12pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   6,    0,    0 },   // 0x20 ' '
   {     1,   2,  16,   6,    2,  -15 },   // 0x21 '!'
   {     5,   5,   6,   9,    2,  -15 },   // 0x22 '"'
@@ -665,7 +665,7 @@ const GFXglyph Montserrat_Regular_12pt8bGlyphs[] PROGMEM = {
   {  5188,  13,  22,  16,    2,  -16 },   // 0xFE ''
   {  5224,  14,  22,  13,   -1,  -16 } }; // 0xFF ''
 
-const GFXfont Montserrat_Regular_12pt8b PROGMEM = {
+constexpr GFXfont Montserrat_Regular_12pt8b PROGMEM = {
   (uint8_t  *)Montserrat_Regular_12pt8bBitmaps,
   (GFXglyph *)Montserrat_Regular_12pt8bGlyphs,
   0x20, 0xFF, 29 };
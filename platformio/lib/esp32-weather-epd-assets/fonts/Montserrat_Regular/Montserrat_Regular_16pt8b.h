@@ -775,7 +775,7 @@ const uint8_t Montserrat_Regular_16pt8bBitmaps[] PROGMEM = {
   0xEE, 0x00, 0x1B, 0x00, 0x07, 0xC0, 0x00, 0xE0, 0x00, 0x38, 0x00, 0x0C,
   0x00, 0x03, 0x00, 0x01, 0x80, 0x10, 0xE0, 0x0F, 0xF0, 0x01, 0xF8, 0x00 };
 
-const GFXglyph Montserrat_Regular_16pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph Montserrat_Regular_16pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   8,    0,    0 },   // 0x20 ' '
   {     1,   4,  22,   8,    2,  -21 },   // 0x21 '!'
   {    12,   7,   8,  12,    2,  -21 },   // 0x22 '"'
@@ -1001,7 +1001,7 @@ const GFXglyph Montserrat_Regular_16pt8bGlyphs[] PROGMEM = {
   {  9175,  17,  29,  21,    3,  -22 },   // 0xFE ''
   {  9237,  18,  28,  17,   -1,  -21 } }; // 0xFF ''
 
-const GFXfont Montserrat_Regular_16pt8b PROGMEM = {
+constexpr GFXfont Montserrat_Regular_16pt8b PROGMEM = {
   (uint8_t  *)Montserrat_Regular_16pt8bBitmaps,
   (GFXglyph *)Montserrat_Regular_16pt8bGlyphs,
   0x20, 0xFF, 38 };
@@ -2044,7 +2044,7 @@ const uint8_t Montserrat_Regular_26pt8bBitmaps[] PROGMEM = {
   0x00, 0x1E, 0x00, 0x02, 0x01, 0xE0, 0x00, 0x3C, 0x1E, 0x00, 0x01, 0xFF,
   0xF0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00 };
 
-const GFXglyph Montserrat_Regular_26pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph Montserrat_Regular_26pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,  13,    0,    0 },   // 0x20 ' '
   {     1,   5,  36,  13,    4,  -35 },   // 0x21 '!'
   {    24,  12,  14,  19,    4,  -35 },   // 0x22 '"'
@@ -2270,7 +2270,7 @@ const GFXglyph Montserrat_Regular_26pt8bGlyphs[] PROGMEM = {
   { 24197,  27,  48,  35,    5,  -37 },   // 0xFE ''
   { 24359,  29,  46,  28,   -1,  -35 } }; // 0xFF ''
 
-const GFXfont Montserrat_Regular_26pt8b PROGMEM = {
+constexpr GFXfont Montserrat_Regular_26pt8b PROGMEM = {
   (uint8_t  *)Montserrat_Regular_26pt8bBitmaps,
   (GFXglyph *)Montserrat_Regular_26pt8bGlyphs,
   0x20, 0xFF, 62 };
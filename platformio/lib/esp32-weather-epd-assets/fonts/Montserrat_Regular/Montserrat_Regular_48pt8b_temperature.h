@@ -356,7 +356,7 @@ const uint8_t Montserrat_Regular_48pt8b_temperatureBitmaps[] PROGMEM = {
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
 
-const GFXglyph Montserrat_Regular_48pt8b_temperatureGlyphs[] PROGMEM = {
+constexpr GFXglyph Montserrat_Regular_48pt8b_temperatureGlyphs[] PROGMEM = {
   {     0,   1,   1,  55,    0,    0 },   // 0x20 ' '
   {     1,   1,   1,  55,    0,    0 },   // 0x21 '!'
   {     2,   1,   1,  55,    0,    0 },   // 0x22 '"'
@@ -582,7 +582,7 @@ const GFXglyph Montserrat_Regular_48pt8b_temperatureGlyphs[] PROGMEM = {
   {  4268,   1,   1,  55,    0,    0 },   // 0xFE ''
   {  4269,   1,   1,  55,    0,    0 } }; // 0xFF ''
 
-const GFXfont Montserrat_Regular_48pt8b_temperature PROGMEM = {
+constexpr GFXfont Montserrat_Regular_48pt8b_temperature PROGMEM = {
   (uint8_t  *)Montserrat_Regular_48pt8b_temperatureBitmaps,
   (GFXglyph *)Montserrat_Regular_48pt8b_temperatureGlyphs,
   0x20, 0xFF, 115 };
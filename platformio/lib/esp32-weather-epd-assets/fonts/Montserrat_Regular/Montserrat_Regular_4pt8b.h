@@ -58,7 +58,7 @@ const uint8_t Montserrat_Regular_4pt8bBitmaps[] PROGMEM = {
   0xC0, 0x30, 0x95, 0x62, 0x48, 0x88, 0xE9, 0x9E, 0x88, 0x50, 0x95, 0x62,
   0x48 };
 
-const GFXglyph Montserrat_Regular_4pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph Montserrat_Regular_4pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   2,    0,    0 },   // 0x20 ' '
   {     1,   1,   5,   2,    1,   -4 },   // 0x21 '!'
   {     2,   1,   2,   3,    1,   -4 },   // 0x22 '"'
@@ -284,7 +284,7 @@ const GFXglyph Montserrat_Regular_4pt8bGlyphs[] PROGMEM = {
   {   677,   4,   8,   5,    1,   -5 },   // 0xFE ''
   {   681,   4,   8,   4,    0,   -5 } }; // 0xFF ''
 
-const GFXfont Montserrat_Regular_4pt8b PROGMEM = {
+constexpr GFXfont Montserrat_Regular_4pt8b PROGMEM = {
   (uint8_t  *)Montserrat_Regular_4pt8bBitmaps,
   (GFXglyph *)Montserrat_Regular_4pt8bGlyphs,
   0x20, 0xFF, 10 };
@@ -86,7 +86,7 @@ const uint8_t Montserrat_Regular_5pt8bBitmaps[] PROGMEM = {
   0x18, 0xC5, 0xE0, 0x38, 0x22, 0x95, 0x28, 0x84, 0xC0, 0x84, 0x3D, 0x18,
   0xC7, 0xD0, 0x80, 0x30, 0x22, 0x95, 0x28, 0x84, 0xC0 };
 
-const GFXglyph Montserrat_Regular_5pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph Montserrat_Regular_5pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   3,    0,    0 },   // 0x20 ' '
   {     1,   1,   7,   3,    1,   -6 },   // 0x21 '!'
   {     2,   2,   3,   4,    1,   -6 },   // 0x22 '"'
@@ -312,7 +312,7 @@ const GFXglyph Montserrat_Regular_5pt8bGlyphs[] PROGMEM = {
   {  1017,   5,   9,   7,    1,   -6 },   // 0xFE ''
   {  1023,   5,   9,   5,    0,   -6 } }; // 0xFF ''
 
-const GFXfont Montserrat_Regular_5pt8b PROGMEM = {
+constexpr GFXfont Montserrat_Regular_5pt8b PROGMEM = {
   (uint8_t  *)Montserrat_Regular_5pt8bBitmaps,
   (GFXglyph *)Montserrat_Regular_5pt8bGlyphs,
   0x20, 0xFF, 12 };
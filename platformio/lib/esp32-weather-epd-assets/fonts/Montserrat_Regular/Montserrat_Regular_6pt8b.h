@@ -111,7 +111,7 @@ const uint8_t Montserrat_Regular_6pt8bBitmaps[] PROGMEM = {
   0x45, 0x22, 0x8C, 0x10, 0x8E, 0x00, 0x82, 0x08, 0x3E, 0x86, 0x18, 0x71,
   0xBA, 0x08, 0x00, 0x28, 0x08, 0x51, 0x48, 0xA3, 0x04, 0x23, 0x80 };
 
-const GFXglyph Montserrat_Regular_6pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph Montserrat_Regular_6pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   3,    0,    0 },   // 0x20 ' '
   {     1,   1,   8,   3,    1,   -7 },   // 0x21 '!'
   {     2,   3,   3,   4,    1,   -7 },   // 0x22 '"'
@@ -337,7 +337,7 @@ const GFXglyph Montserrat_Regular_6pt8bGlyphs[] PROGMEM = {
   {  1314,   6,  11,   8,    1,   -8 },   // 0xFE ''
   {  1323,   6,  10,   6,    0,   -7 } }; // 0xFF ''
 
-const GFXfont Montserrat_Regular_6pt8b PROGMEM = {
+constexpr GFXfont Montserrat_Regular_6pt8b PROGMEM = {
   (uint8_t  *)Montserrat_Regular_6pt8bBitmaps,
   (GFXglyph *)Montserrat_Regular_6pt8bGlyphs,
   0x20, 0xFF, 14 };
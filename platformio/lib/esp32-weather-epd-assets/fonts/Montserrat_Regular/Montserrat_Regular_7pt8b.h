@@ -156,7 +156,7 @@ const uint8_t Montserrat_Regular_7pt8bBitmaps[] PROGMEM = {
   0xC2, 0xBC, 0x80, 0x80, 0x80, 0x48, 0x00, 0x04, 0x14, 0x28, 0x89, 0x14,
   0x18, 0x20, 0x45, 0x0C, 0x00 };
 
-const GFXglyph Montserrat_Regular_7pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph Montserrat_Regular_7pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   4,    0,    0 },   // 0x20 ' '
   {     1,   2,  10,   4,    1,   -9 },   // 0x21 '!'
   {     4,   3,   4,   5,    1,   -9 },   // 0x22 '"'
@@ -382,7 +382,7 @@ const GFXglyph Montserrat_Regular_7pt8bGlyphs[] PROGMEM = {
   {  1840,   8,  13,   9,    1,   -9 },   // 0xFE ''
   {  1853,   7,  13,   7,    0,   -9 } }; // 0xFF ''
 
-const GFXfont Montserrat_Regular_7pt8b PROGMEM = {
+constexpr GFXfont Montserrat_Regular_7pt8b PROGMEM = {
   (uint8_t  *)Montserrat_Regular_7pt8bBitmaps,
   (GFXglyph *)Montserrat_Regular_7pt8bGlyphs,
   0x20, 0xFF, 17 };
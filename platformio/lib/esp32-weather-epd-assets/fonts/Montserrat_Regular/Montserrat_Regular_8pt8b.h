@@ -195,7 +195,7 @@ const uint8_t Montserrat_Regular_8pt8bBitmaps[] PROGMEM = {
   0x00, 0x00, 0x81, 0x41, 0x42, 0x22, 0x24, 0x14, 0x18, 0x18, 0x18, 0x10,
   0xE0 };
 
-const GFXglyph Montserrat_Regular_8pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph Montserrat_Regular_8pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   4,    0,    0 },   // 0x20 ' '
   {     1,   2,  11,   4,    1,  -10 },   // 0x21 '!'
   {     4,   4,   4,   6,    1,  -10 },   // 0x22 '"'
@@ -421,7 +421,7 @@ const GFXglyph Montserrat_Regular_8pt8bGlyphs[] PROGMEM = {
   {  2300,   8,  15,  11,    2,  -11 },   // 0xFE ''
   {  2315,   8,  14,   9,    0,  -10 } }; // 0xFF ''
 
-const GFXfont Montserrat_Regular_8pt8b PROGMEM = {
+constexpr GFXfont Montserrat_Regular_8pt8b PROGMEM = {
   (uint8_t  *)Montserrat_Regular_8pt8bBitmaps,
   (GFXglyph *)Montserrat_Regular_8pt8bGlyphs,
   0x20, 0xFF, 19 };
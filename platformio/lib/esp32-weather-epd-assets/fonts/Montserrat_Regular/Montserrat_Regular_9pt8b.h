@@ -246,7 +246,7 @@ const uint8_t Montserrat_Regular_9pt8bBitmaps[] PROGMEM = {
   0x01, 0x00, 0x24, 0x09, 0x80, 0x00, 0x01, 0xC0, 0x90, 0x26, 0x10, 0x84,
   0x22, 0x04, 0x81, 0x60, 0x70, 0x0C, 0x02, 0x01, 0x83, 0xC0, 0x40, 0x00 };
 
-const GFXglyph Montserrat_Regular_9pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph Montserrat_Regular_9pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   5,    0,    0 },   // 0x20 ' '
   {     1,   2,  12,   5,    1,  -11 },   // 0x21 '!'
   {     4,   4,   4,   7,    1,  -11 },   // 0x22 '"'
@@ -472,7 +472,7 @@ const GFXglyph Montserrat_Regular_9pt8bGlyphs[] PROGMEM = {
   {  2912,   9,  16,  12,    2,  -12 },   // 0xFE ''
   {  2930,  10,  17,  10,    0,  -12 } }; // 0xFF ''
 
-const GFXfont Montserrat_Regular_9pt8b PROGMEM = {
+constexpr GFXfont Montserrat_Regular_9pt8b PROGMEM = {
   (uint8_t  *)Montserrat_Regular_9pt8bBitmaps,
   (GFXglyph *)Montserrat_Regular_9pt8bGlyphs,
   0x20, 0xFF, 21 };
@@ -254,7 +254,7 @@ const uint8_t OpenSans_Regular_10pt8bBitmaps[] PROGMEM = {
   0x80, 0x00, 0x00, 0xC0, 0xD0, 0x26, 0x19, 0x86, 0x21, 0x0C, 0xC1, 0x30,
   0x68, 0x1E, 0x03, 0x80, 0xC0, 0x30, 0x08, 0x06, 0x03, 0x03, 0x80 };
 
-const GFXglyph OpenSans_Regular_10pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph OpenSans_Regular_10pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   5,    0,    0 },   // 0x20 ' '
   {     1,   3,  14,   5,    1,  -13 },   // 0x21 '!'
   {     7,   6,   5,   8,    1,  -13 },   // 0x22 '"'
@@ -480,7 +480,7 @@ const GFXglyph OpenSans_Regular_10pt8bGlyphs[] PROGMEM = {
   {  2999,   9,  20,  12,    2,  -14 },   // 0xFE ''
   {  3022,  10,  20,  10,    0,  -14 } }; // 0xFF ''
 
-const GFXfont OpenSans_Regular_10pt8b PROGMEM = {
+constexpr GFXfont OpenSans_Regular_10pt8b PROGMEM = {
   (uint8_t  *)OpenSans_Regular_10pt8bBitmaps,
   (GFXglyph *)OpenSans_Regular_10pt8bGlyphs,
   0x20, 0xFF, 27 };
@@ -311,7 +311,7 @@ const uint8_t OpenSans_Regular_11pt8bBitmaps[] PROGMEM = {
   0x06, 0xC0, 0x98, 0x33, 0x06, 0x31, 0x86, 0x30, 0x46, 0x0D, 0x81, 0xB0,
   0x14, 0x03, 0x80, 0x30, 0x0C, 0x01, 0x80, 0x60, 0x5C, 0x0F, 0x00 };
 
-const GFXglyph OpenSans_Regular_11pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph OpenSans_Regular_11pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   6,    0,    0 },   // 0x20 ' '
   {     1,   2,  16,   6,    2,  -15 },   // 0x21 '!'
   {     5,   6,   6,   9,    1,  -15 },   // 0x22 '"'
@@ -537,7 +537,7 @@ const GFXglyph OpenSans_Regular_11pt8bGlyphs[] PROGMEM = {
   {  3674,  10,  22,  13,    2,  -16 },   // 0xFE ''
   {  3702,  11,  21,  11,    0,  -15 } }; // 0xFF ''
 
-const GFXfont OpenSans_Regular_11pt8b PROGMEM = {
+constexpr GFXfont OpenSans_Regular_11pt8b PROGMEM = {
   (uint8_t  *)OpenSans_Regular_11pt8bBitmaps,
   (GFXglyph *)OpenSans_Regular_11pt8bGlyphs,
   0x20, 0xFF, 29 };
@@ -368,7 +368,7 @@ const uint8_t OpenSans_Regular_12pt8bBitmaps[] PROGMEM = {
   0x0C, 0x18, 0xC1, 0x98, 0x19, 0x80, 0xD8, 0x0F, 0x00, 0x70, 0x06, 0x00,
   0x60, 0x06, 0x00, 0xC0, 0x0C, 0x0F, 0x80, 0xF0, 0x00 };
 
-const GFXglyph OpenSans_Regular_12pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph OpenSans_Regular_12pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   6,    0,    0 },   // 0x20 ' '
   {     1,   3,  17,   6,    2,  -16 },   // 0x21 '!'
   {     8,   6,   6,  10,    2,  -16 },   // 0x22 '"'
@@ -594,7 +594,7 @@ const GFXglyph OpenSans_Regular_12pt8bGlyphs[] PROGMEM = {
   {  4345,  11,  24,  15,    2,  -17 },   // 0xFE ''
   {  4378,  12,  23,  12,    0,  -16 } }; // 0xFF ''
 
-const GFXfont OpenSans_Regular_12pt8b PROGMEM = {
+constexpr GFXfont OpenSans_Regular_12pt8b PROGMEM = {
   (uint8_t  *)OpenSans_Regular_12pt8bBitmaps,
   (GFXglyph *)OpenSans_Regular_12pt8bGlyphs,
   0x20, 0xFF, 32 };
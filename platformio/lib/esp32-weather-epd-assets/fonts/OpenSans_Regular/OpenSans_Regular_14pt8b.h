@@ -454,7 +454,7 @@ const uint8_t OpenSans_Regular_14pt8bBitmaps[] PROGMEM = {
   0x00, 0xC0, 0x03, 0x00, 0x18, 0x00, 0x60, 0x03, 0x00, 0xFC, 0x03, 0xC0,
   0x00 };
 
-const GFXglyph OpenSans_Regular_14pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph OpenSans_Regular_14pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   7,    0,    0 },   // 0x20 ' '
   {     1,   3,  19,   7,    2,  -18 },   // 0x21 '!'
   {     9,   7,   7,  11,    2,  -18 },   // 0x22 '"'
@@ -680,7 +680,7 @@ const GFXglyph OpenSans_Regular_14pt8bGlyphs[] PROGMEM = {
   {  5347,  13,  27,  17,    2,  -20 },   // 0xFE ''
   {  5391,  14,  26,  14,    0,  -19 } }; // 0xFF ''
 
-const GFXfont OpenSans_Regular_14pt8b PROGMEM = {
+constexpr GFXfont OpenSans_Regular_14pt8b PROGMEM = {
   (uint8_t  *)OpenSans_Regular_14pt8bBitmaps,
   (GFXglyph *)OpenSans_Regular_14pt8bGlyphs,
   0x20, 0xFF, 37 };
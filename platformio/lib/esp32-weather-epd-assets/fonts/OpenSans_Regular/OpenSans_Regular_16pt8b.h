@@ -602,7 +602,7 @@ const uint8_t OpenSans_Regular_16pt8bBitmaps[] PROGMEM = {
   0xE0, 0x07, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x01, 0x80, 0x03, 0x80, 0x03,
   0x80, 0x07, 0x00, 0x07, 0x00, 0x0E, 0x00, 0xFC, 0x00, 0xF8, 0x00 };
 
-const GFXglyph OpenSans_Regular_16pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph OpenSans_Regular_16pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   8,    0,    0 },   // 0x20 ' '
   {     1,   4,  22,   8,    2,  -21 },   // 0x21 '!'
   {    12,   8,   8,  12,    2,  -21 },   // 0x22 '"'
@@ -828,7 +828,7 @@ const GFXglyph OpenSans_Regular_16pt8bGlyphs[] PROGMEM = {
   {  7108,  14,  31,  19,    3,  -23 },   // 0xFE ''
   {  7163,  16,  30,  16,    0,  -22 } }; // 0xFF ''
 
-const GFXfont OpenSans_Regular_16pt8b PROGMEM = {
+constexpr GFXfont OpenSans_Regular_16pt8b PROGMEM = {
   (uint8_t  *)OpenSans_Regular_16pt8bBitmaps,
   (GFXglyph *)OpenSans_Regular_16pt8bGlyphs,
   0x20, 0xFF, 43 };
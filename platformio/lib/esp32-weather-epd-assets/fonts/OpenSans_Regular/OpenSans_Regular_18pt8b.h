@@ -762,7 +762,7 @@ const uint8_t OpenSans_Regular_18pt8bBitmaps[] PROGMEM = {
   0x70, 0x00, 0x1C, 0x00, 0x0E, 0x00, 0x03, 0x80, 0x01, 0xC0, 0x09, 0xF0,
   0x03, 0xF8, 0x00, 0xF8, 0x00, 0x00 };
 
-const GFXglyph OpenSans_Regular_18pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph OpenSans_Regular_18pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   9,    0,    0 },   // 0x20 ' '
   {     1,   4,  25,   9,    3,  -24 },   // 0x21 '!'
   {    14,  10,   9,  14,    2,  -24 },   // 0x22 '"'
@@ -988,7 +988,7 @@ const GFXglyph OpenSans_Regular_18pt8bGlyphs[] PROGMEM = {
   {  8993,  16,  35,  21,    3,  -26 },   // 0xFE ''
   {  9063,  18,  33,  18,    0,  -24 } }; // 0xFF ''
 
-const GFXfont OpenSans_Regular_18pt8b PROGMEM = {
+constexpr GFXfont OpenSans_Regular_18pt8b PROGMEM = {
   (uint8_t  *)OpenSans_Regular_18pt8bBitmaps,
   (GFXglyph *)OpenSans_Regular_18pt8bGlyphs,
   0x20, 0xFF, 48 };
@@ -1368,7 +1368,7 @@ const uint8_t OpenSans_Regular_24pt8bBitmaps[] PROGMEM = {
   0x00, 0x01, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0x80,
   0x00, 0xFE, 0x00, 0x00 };
 
-const GFXglyph OpenSans_Regular_24pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph OpenSans_Regular_24pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,  12,    0,    0 },   // 0x20 ' '
   {     1,   6,  34,  12,    3,  -33 },   // 0x21 '!'
   {    27,  13,  12,  19,    3,  -33 },   // 0x22 '"'
@@ -1594,7 +1594,7 @@ const GFXglyph OpenSans_Regular_24pt8bGlyphs[] PROGMEM = {
   { 16143,  22,  47,  29,    4,  -35 },   // 0xFE ''
   { 16273,  24,  45,  24,    0,  -33 } }; // 0xFF ''
 
-const GFXfont OpenSans_Regular_24pt8b PROGMEM = {
+constexpr GFXfont OpenSans_Regular_24pt8b PROGMEM = {
   (uint8_t  *)OpenSans_Regular_24pt8bBitmaps,
   (GFXglyph *)OpenSans_Regular_24pt8bGlyphs,
   0x20, 0xFF, 64 };
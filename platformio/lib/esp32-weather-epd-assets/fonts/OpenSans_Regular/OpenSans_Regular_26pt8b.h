@@ -1625,7 +1625,7 @@ const uint8_t OpenSans_Regular_26pt8bBitmaps[] PROGMEM = {
   0x03, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x33, 0xF8, 0x00, 0x0F, 0xFC, 0x00,
   0x03, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00 };
 
-const GFXglyph OpenSans_Regular_26pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph OpenSans_Regular_26pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,  13,    0,    0 },   // 0x20 ' '
   {     1,   6,  37,  13,    4,  -35 },   // 0x21 '!'
   {    29,  14,  13,  20,    3,  -35 },   // 0x22 '"'
@@ -1851,7 +1851,7 @@ const GFXglyph OpenSans_Regular_26pt8bGlyphs[] PROGMEM = {
   { 19183,  24,  51,  31,    4,  -38 },   // 0xFE ''
   { 19336,  26,  49,  26,    0,  -36 } }; // 0xFF ''
 
-const GFXfont OpenSans_Regular_26pt8b PROGMEM = {
+constexpr GFXfont OpenSans_Regular_26pt8b PROGMEM = {
   (uint8_t  *)OpenSans_Regular_26pt8bBitmaps,
   (GFXglyph *)OpenSans_Regular_26pt8bGlyphs,
   0x20, 0xFF, 69 };
@@ -49,7 +49,7 @@ const uint8_t OpenSans_Regular_4pt8bBitmaps[] PROGMEM = {
   0xDB, 0xC0, 0xA2, 0xDB, 0xC0, 0x20, 0x96, 0x62, 0x4C, 0x9A, 0xDB, 0xE0,
   0x60, 0x96, 0x62, 0x4C };
 
-const GFXglyph OpenSans_Regular_4pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph OpenSans_Regular_4pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   2,    0,    0 },   // 0x20 ' '
   {     1,   1,   6,   2,    1,   -5 },   // 0x21 '!'
   {     2,   2,   2,   3,    1,   -5 },   // 0x22 '"'
@@ -275,7 +275,7 @@ const GFXglyph OpenSans_Regular_4pt8bGlyphs[] PROGMEM = {
   {   573,   3,   8,   5,    1,   -5 },   // 0xFE ''
   {   576,   4,   8,   4,    0,   -5 } }; // 0xFF ''
 
-const GFXfont OpenSans_Regular_4pt8b PROGMEM = {
+constexpr GFXfont OpenSans_Regular_4pt8b PROGMEM = {
   (uint8_t  *)OpenSans_Regular_4pt8bBitmaps,
   (GFXglyph *)OpenSans_Regular_4pt8bGlyphs,
   0x20, 0xFF, 11 };
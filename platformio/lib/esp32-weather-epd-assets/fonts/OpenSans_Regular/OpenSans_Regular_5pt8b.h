@@ -71,7 +71,7 @@ const uint8_t OpenSans_Regular_5pt8bBitmaps[] PROGMEM = {
   0x9F, 0x20, 0x99, 0x99, 0xF0, 0x10, 0x81, 0x15, 0x29, 0x44, 0x26, 0x00,
   0x84, 0x3D, 0x18, 0xCB, 0xD0, 0x80, 0x10, 0x22, 0xA5, 0x28, 0x84, 0xC0 };
 
-const GFXglyph OpenSans_Regular_5pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph OpenSans_Regular_5pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   3,    0,    0 },   // 0x20 ' '
   {     1,   1,   7,   3,    1,   -6 },   // 0x21 '!'
   {     2,   2,   3,   4,    1,   -6 },   // 0x22 '"'
@@ -297,7 +297,7 @@ const GFXglyph OpenSans_Regular_5pt8bGlyphs[] PROGMEM = {
   {   840,   5,   9,   6,    1,   -6 },   // 0xFE ''
   {   846,   5,   9,   5,    0,   -6 } }; // 0xFF ''
 
-const GFXfont OpenSans_Regular_5pt8b PROGMEM = {
+constexpr GFXfont OpenSans_Regular_5pt8b PROGMEM = {
   (uint8_t  *)OpenSans_Regular_5pt8bBitmaps,
   (GFXglyph *)OpenSans_Regular_5pt8bGlyphs,
   0x20, 0xFF, 13 };
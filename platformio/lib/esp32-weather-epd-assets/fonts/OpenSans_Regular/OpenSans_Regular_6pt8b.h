@@ -100,7 +100,7 @@ const uint8_t OpenSans_Regular_6pt8bBitmaps[] PROGMEM = {
   0x30, 0x82, 0x30, 0x82, 0x08, 0x3E, 0x8A, 0x18, 0x62, 0xFA, 0x08, 0x20,
   0x28, 0x00, 0x21, 0x49, 0x24, 0x8C, 0x30, 0x82, 0x30 };
 
-const GFXglyph OpenSans_Regular_6pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph OpenSans_Regular_6pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   3,    0,    0 },   // 0x20 ' '
   {     1,   1,   9,   3,    1,   -8 },   // 0x21 '!'
   {     3,   3,   3,   5,    1,   -8 },   // 0x22 '"'
@@ -326,7 +326,7 @@ const GFXglyph OpenSans_Regular_6pt8bGlyphs[] PROGMEM = {
   {  1179,   6,  12,   7,    1,   -8 },   // 0xFE ''
   {  1188,   6,  12,   6,    0,   -8 } }; // 0xFF ''
 
-const GFXfont OpenSans_Regular_6pt8b PROGMEM = {
+constexpr GFXfont OpenSans_Regular_6pt8b PROGMEM = {
   (uint8_t  *)OpenSans_Regular_6pt8bBitmaps,
   (GFXglyph *)OpenSans_Regular_6pt8bGlyphs,
   0x20, 0xFF, 16 };
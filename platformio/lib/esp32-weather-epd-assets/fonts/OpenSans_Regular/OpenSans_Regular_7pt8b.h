@@ -131,7 +131,7 @@ const uint8_t OpenSans_Regular_7pt8bBitmaps[] PROGMEM = {
   0xCC, 0x50, 0xE0, 0xC1, 0xC7, 0x8A, 0xE4, 0x08, 0x10, 0x00, 0x48, 0x02,
   0x0A, 0x24, 0x4C, 0x8A, 0x14, 0x18, 0x20, 0x41, 0x0E, 0x00 };
 
-const GFXglyph OpenSans_Regular_7pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph OpenSans_Regular_7pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   4,    0,    0 },   // 0x20 ' '
   {     1,   2,  10,   4,    1,   -9 },   // 0x21 '!'
   {     4,   4,   4,   6,    1,   -9 },   // 0x22 '"'
@@ -357,7 +357,7 @@ const GFXglyph OpenSans_Regular_7pt8bGlyphs[] PROGMEM = {
   {  1545,   7,  14,   9,    1,  -10 },   // 0xFE ''
   {  1558,   7,  13,   7,    0,   -9 } }; // 0xFF ''
 
-const GFXfont OpenSans_Regular_7pt8b PROGMEM = {
+constexpr GFXfont OpenSans_Regular_7pt8b PROGMEM = {
   (uint8_t  *)OpenSans_Regular_7pt8bBitmaps,
   (GFXglyph *)OpenSans_Regular_7pt8bGlyphs,
   0x20, 0xFF, 19 };
@@ -173,7 +173,7 @@ const uint8_t OpenSans_Regular_8pt8bBitmaps[] PROGMEM = {
   0xC3, 0x42, 0x42, 0x66, 0x24, 0x24, 0x1C, 0x18, 0x18, 0x18, 0x10, 0x30,
   0xE0 };
 
-const GFXglyph OpenSans_Regular_8pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph OpenSans_Regular_8pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   4,    0,    0 },   // 0x20 ' '
   {     1,   2,  12,   4,    1,  -11 },   // 0x21 '!'
   {     4,   4,   4,   6,    1,  -11 },   // 0x22 '"'
@@ -399,7 +399,7 @@ const GFXglyph OpenSans_Regular_8pt8bGlyphs[] PROGMEM = {
   {  2032,   8,  17,  10,    1,  -12 },   // 0xFE ''
   {  2049,   8,  16,   8,    0,  -11 } }; // 0xFF ''
 
-const GFXfont OpenSans_Regular_8pt8b PROGMEM = {
+constexpr GFXfont OpenSans_Regular_8pt8b PROGMEM = {
   (uint8_t  *)OpenSans_Regular_8pt8bBitmaps,
   (GFXglyph *)OpenSans_Regular_8pt8bGlyphs,
   0x20, 0xFF, 21 };
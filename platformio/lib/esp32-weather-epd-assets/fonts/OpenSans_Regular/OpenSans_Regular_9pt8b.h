@@ -208,7 +208,7 @@ const uint8_t OpenSans_Regular_9pt8bBitmaps[] PROGMEM = {
   0x8C, 0x44, 0x36, 0x0B, 0x05, 0x03, 0x80, 0x80, 0x40, 0x60, 0x60, 0xE0,
   0x00 };
 
-const GFXglyph OpenSans_Regular_9pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph OpenSans_Regular_9pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   5,    0,    0 },   // 0x20 ' '
   {     1,   2,  13,   5,    1,  -12 },   // 0x21 '!'
   {     5,   5,   5,   7,    1,  -12 },   // 0x22 '"'
@@ -434,7 +434,7 @@ const GFXglyph OpenSans_Regular_9pt8bGlyphs[] PROGMEM = {
   {  2447,   8,  18,  11,    2,  -13 },   // 0xFE ''
   {  2465,   9,  17,   9,    0,  -12 } }; // 0xFF ''
 
-const GFXfont OpenSans_Regular_9pt8b PROGMEM = {
+constexpr GFXfont OpenSans_Regular_9pt8b PROGMEM = {
   (uint8_t  *)OpenSans_Regular_9pt8bBitmaps,
   (GFXglyph *)OpenSans_Regular_9pt8bGlyphs,
   0x20, 0xFF, 24 };
@@ -312,7 +312,7 @@ const uint8_t Poppins_Regular_10pt8bBitmaps[] PROGMEM = {
   0x6C, 0x0D, 0x80, 0xA0, 0x1C, 0x01, 0x80, 0x60, 0x0C, 0x01, 0x00, 0x60,
   0x0C, 0x00 };
 
-const GFXglyph Poppins_Regular_10pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph Poppins_Regular_10pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   5,    0,    0 },   // 0x20 ' '
   {     1,   2,  14,   6,    2,  -13 },   // 0x21 '!'
   {     5,   4,   4,   6,    1,  -15 },   // 0x22 '"'
@@ -538,7 +538,7 @@ const GFXglyph Poppins_Regular_10pt8bGlyphs[] PROGMEM = {
   {  3678,  11,  20,  13,    1,  -14 },   // 0xFE ''
   {  3706,  11,  20,  11,    0,  -14 } }; // 0xFF ''
 
-const GFXfont Poppins_Regular_10pt8b PROGMEM = {
+constexpr GFXfont Poppins_Regular_10pt8b PROGMEM = {
   (uint8_t  *)Poppins_Regular_10pt8bBitmaps,
   (GFXglyph *)Poppins_Regular_10pt8bGlyphs,
   0x20, 0xFF, 29 };
@@ -364,7 +364,7 @@ const uint8_t Poppins_Regular_11pt8bBitmaps[] PROGMEM = {
   0x1D, 0x00, 0xF0, 0x0F, 0x00, 0xE0, 0x0E, 0x00, 0xC0, 0x0C, 0x01, 0x80,
   0x18, 0x01, 0x80 };
 
-const GFXglyph Poppins_Regular_11pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph Poppins_Regular_11pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   6,    0,    0 },   // 0x20 ' '
   {     1,   2,  15,   6,    2,  -14 },   // 0x21 '!'
   {     5,   5,   4,   7,    1,  -16 },   // 0x22 '"'
@@ -590,7 +590,7 @@ const GFXglyph Poppins_Regular_11pt8bGlyphs[] PROGMEM = {
   {  4293,  12,  22,  15,    2,  -15 },   // 0xFE ''
   {  4326,  12,  22,  12,    0,  -15 } }; // 0xFF ''
 
-const GFXfont Poppins_Regular_11pt8b PROGMEM = {
+constexpr GFXfont Poppins_Regular_11pt8b PROGMEM = {
   (uint8_t  *)Poppins_Regular_11pt8bBitmaps,
   (GFXglyph *)Poppins_Regular_11pt8bGlyphs,
   0x20, 0xFF, 32 };
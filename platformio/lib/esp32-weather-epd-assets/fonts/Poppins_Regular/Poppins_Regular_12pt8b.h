@@ -422,7 +422,7 @@ const uint8_t Poppins_Regular_12pt8bBitmaps[] PROGMEM = {
   0x70, 0xC3, 0x0C, 0x38, 0x81, 0x98, 0x19, 0x81, 0xF0, 0x0F, 0x00, 0xE0,
   0x06, 0x00, 0xE0, 0x0C, 0x00, 0xC0, 0x18, 0x01, 0x80, 0x18, 0x00 };
 
-const GFXglyph Poppins_Regular_12pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph Poppins_Regular_12pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   6,    0,    0 },   // 0x20 ' '
   {     1,   3,  16,   7,    2,  -15 },   // 0x21 '!'
   {     7,   5,   4,   7,    1,  -17 },   // 0x22 '"'
@@ -648,7 +648,7 @@ const GFXglyph Poppins_Regular_12pt8bGlyphs[] PROGMEM = {
   {  4990,  13,  23,  16,    2,  -16 },   // 0xFE ''
   {  5028,  12,  23,  12,    0,  -16 } }; // 0xFF ''
 
-const GFXfont Poppins_Regular_12pt8b PROGMEM = {
+constexpr GFXfont Poppins_Regular_12pt8b PROGMEM = {
   (uint8_t  *)Poppins_Regular_12pt8bBitmaps,
   (GFXglyph *)Poppins_Regular_12pt8bGlyphs,
   0x20, 0xFF, 35 };
@@ -576,7 +576,7 @@ const uint8_t Poppins_Regular_14pt8bBitmaps[] PROGMEM = {
   0x00, 0x38, 0x00, 0x60, 0x01, 0xC0, 0x03, 0x00, 0x0E, 0x00, 0x1C, 0x00,
   0x30, 0x00 };
 
-const GFXglyph Poppins_Regular_14pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph Poppins_Regular_14pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   7,    0,    0 },   // 0x20 ' '
   {     1,   3,  19,   7,    2,  -18 },   // 0x21 '!'
   {     9,   6,   5,   8,    1,  -20 },   // 0x22 '"'
@@ -802,7 +802,7 @@ const GFXglyph Poppins_Regular_14pt8bGlyphs[] PROGMEM = {
   {  6800,  15,  27,  18,    2,  -19 },   // 0xFE ''
   {  6851,  15,  27,  15,    0,  -19 } }; // 0xFF ''
 
-const GFXfont Poppins_Regular_14pt8b PROGMEM = {
+constexpr GFXfont Poppins_Regular_14pt8b PROGMEM = {
   (uint8_t  *)Poppins_Regular_14pt8bBitmaps,
   (GFXglyph *)Poppins_Regular_14pt8bGlyphs,
   0x20, 0xFF, 41 };
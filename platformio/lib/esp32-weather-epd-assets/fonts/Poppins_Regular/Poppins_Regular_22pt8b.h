@@ -1421,7 +1421,7 @@ const uint8_t Poppins_Regular_22pt8bBitmaps[] PROGMEM = {
   0x00, 0x0F, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00,
   0x01, 0xE0, 0x00, 0x03, 0x80, 0x00, 0x0F, 0x00, 0x00 };
 
-const GFXglyph Poppins_Regular_22pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph Poppins_Regular_22pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,  12,    0,    0 },   // 0x20 ' '
   {     1,   5,  30,  13,    4,  -29 },   // 0x21 '!'
   {    20,   9,   8,  13,    2,  -33 },   // 0x22 '"'
@@ -1647,7 +1647,7 @@ const GFXglyph Poppins_Regular_22pt8bGlyphs[] PROGMEM = {
   { 16799,  24,  43,  29,    3,  -31 },   // 0xFE ''
   { 16928,  23,  42,  23,    0,  -30 } }; // 0xFF ''
 
-const GFXfont Poppins_Regular_22pt8b PROGMEM = {
+constexpr GFXfont Poppins_Regular_22pt8b PROGMEM = {
   (uint8_t  *)Poppins_Regular_22pt8bBitmaps,
   (GFXglyph *)Poppins_Regular_22pt8bGlyphs,
   0x20, 0xFF, 65 };
@@ -1978,7 +1978,7 @@ const uint8_t Poppins_Regular_26pt8bBitmaps[] PROGMEM = {
   0xE0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x03, 0xE0, 0x00,
   0x00 };
 
-const GFXglyph Poppins_Regular_26pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph Poppins_Regular_26pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,  14,    0,    0 },   // 0x20 ' '
   {     1,   6,  35,  14,    4,  -34 },   // 0x21 '!'
   {    28,  11,  10,  15,    2,  -39 },   // 0x22 '"'
@@ -2204,7 +2204,7 @@ const GFXglyph Poppins_Regular_26pt8bGlyphs[] PROGMEM = {
   { 23380,  28,  51,  34,    4,  -37 },   // 0xFE ''
   { 23559,  27,  49,  28,    1,  -35 } }; // 0xFF ''
 
-const GFXfont Poppins_Regular_26pt8b PROGMEM = {
+constexpr GFXfont Poppins_Regular_26pt8b PROGMEM = {
   (uint8_t  *)Poppins_Regular_26pt8bBitmaps,
   (GFXglyph *)Poppins_Regular_26pt8bGlyphs,
   0x20, 0xFF, 76 };
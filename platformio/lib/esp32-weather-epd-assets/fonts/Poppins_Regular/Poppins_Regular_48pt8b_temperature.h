@@ -347,7 +347,7 @@ const uint8_t Poppins_Regular_48pt8b_temperatureBitmaps[] PROGMEM = {
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
 
-const GFXglyph Poppins_Regular_48pt8b_temperatureGlyphs[] PROGMEM = {
+constexpr GFXglyph Poppins_Regular_48pt8b_temperatureGlyphs[] PROGMEM = {
   {     0,   1,   1,  47,    0,    0 },   // 0x20 ' '
   {     1,   1,   1,  47,    0,    0 },   // 0x21 '!'
   {     2,   1,   1,  47,    0,    0 },   // 0x22 '"'
@@ -573,7 +573,7 @@ const GFXglyph Poppins_Regular_48pt8b_temperatureGlyphs[] PROGMEM = {
   {  4160,   1,   1,  47,    0,    0 },   // 0xFE ''
   {  4161,   1,   1,  47,    0,    0 } }; // 0xFF ''
 
-const GFXfont Poppins_Regular_48pt8b_temperature PROGMEM = {
+constexpr GFXfont Poppins_Regular_48pt8b_temperature PROGMEM = {
   (uint8_t  *)Poppins_Regular_48pt8b_temperatureBitmaps,
   (GFXglyph *)Poppins_Regular_48pt8b_temperatureGlyphs,
   0x20, 0xFF, 141 };
@@ -57,7 +57,7 @@ const uint8_t Poppins_Regular_4pt8bBitmaps[] PROGMEM = {
   0xF0, 0x04, 0x9D, 0x62, 0x44, 0x8E, 0x99, 0xE8, 0x80, 0x69, 0xD6, 0x24,
   0x40 };
 
-const GFXglyph Poppins_Regular_4pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph Poppins_Regular_4pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   2,    0,    0 },   // 0x20 ' '
   {     1,   1,   5,   3,    1,   -4 },   // 0x21 '!'
   {     2,   2,   1,   4,    1,   -5 },   // 0x22 '"'
@@ -283,7 +283,7 @@ const GFXglyph Poppins_Regular_4pt8bGlyphs[] PROGMEM = {
   {   665,   4,   7,   6,    1,   -4 },   // 0xFE ''
   {   669,   4,   7,   4,    0,   -4 } }; // 0xFF ''
 
-const GFXfont Poppins_Regular_4pt8b PROGMEM = {
+constexpr GFXfont Poppins_Regular_4pt8b PROGMEM = {
   (uint8_t  *)Poppins_Regular_4pt8bBitmaps,
   (GFXglyph *)Poppins_Regular_4pt8bGlyphs,
   0x20, 0xFF, 12 };
@@ -155,7 +155,7 @@ const uint8_t Poppins_Regular_7pt8bBitmaps[] PROGMEM = {
   0x60, 0xC1, 0x83, 0x8A, 0xE4, 0x08, 0x10, 0x20, 0x00, 0x28, 0x00, 0x06,
   0x34, 0x48, 0x9B, 0x14, 0x28, 0x70, 0x40, 0x83, 0x04, 0x08, 0x00 };
 
-const GFXglyph Poppins_Regular_7pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph Poppins_Regular_7pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   4,    0,    0 },   // 0x20 ' '
   {     1,   1,  10,   3,    1,   -9 },   // 0x21 '!'
   {     3,   3,   3,   5,    1,  -11 },   // 0x22 '"'
@@ -381,7 +381,7 @@ const GFXglyph Poppins_Regular_7pt8bGlyphs[] PROGMEM = {
   {  1831,   7,  15,   9,    1,  -10 },   // 0xFE ''
   {  1845,   7,  15,   7,    0,  -10 } }; // 0xFF ''
 
-const GFXfont Poppins_Regular_7pt8b PROGMEM = {
+constexpr GFXfont Poppins_Regular_7pt8b PROGMEM = {
   (uint8_t  *)Poppins_Regular_7pt8bBitmaps,
   (GFXglyph *)Poppins_Regular_7pt8bGlyphs,
   0x20, 0xFF, 21 };
@@ -195,7 +195,7 @@ const uint8_t Poppins_Regular_8pt8bBitmaps[] PROGMEM = {
   0x83, 0xC2, 0xBC, 0x80, 0x80, 0x80, 0x80, 0x24, 0x00, 0x00, 0xC3, 0xC2,
   0x42, 0x66, 0x64, 0x34, 0x38, 0x38, 0x18, 0x10, 0x30, 0x20, 0x20 };
 
-const GFXglyph Poppins_Regular_8pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph Poppins_Regular_8pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   4,    0,    0 },   // 0x20 ' '
   {     1,   1,  11,   4,    2,  -10 },   // 0x21 '!'
   {     3,   3,   3,   5,    1,  -12 },   // 0x22 '"'
@@ -421,7 +421,7 @@ const GFXglyph Poppins_Regular_8pt8bGlyphs[] PROGMEM = {
   {  2307,   8,  16,  10,    1,  -11 },   // 0xFE ''
   {  2323,   8,  16,   8,    0,  -11 } }; // 0xFF ''
 
-const GFXfont Poppins_Regular_8pt8b PROGMEM = {
+constexpr GFXfont Poppins_Regular_8pt8b PROGMEM = {
   (uint8_t  *)Poppins_Regular_8pt8bBitmaps,
   (GFXglyph *)Poppins_Regular_8pt8bGlyphs,
   0x20, 0xFF, 24 };
@@ -256,7 +256,7 @@ const uint8_t Poppins_Regular_9pt8bBitmaps[] PROGMEM = {
   0x36, 0x1B, 0x00, 0x18, 0x3C, 0x1A, 0x09, 0x8C, 0xC6, 0x22, 0x1B, 0x05,
   0x03, 0x81, 0xC0, 0xC0, 0x60, 0x20, 0x30, 0x18, 0x00 };
 
-const GFXglyph Poppins_Regular_9pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph Poppins_Regular_9pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   5,    0,    0 },   // 0x20 ' '
   {     1,   2,  13,   6,    2,  -12 },   // 0x21 '!'
   {     5,   4,   3,   6,    1,  -13 },   // 0x22 '"'
@@ -482,7 +482,7 @@ const GFXglyph Poppins_Regular_9pt8bGlyphs[] PROGMEM = {
   {  3025,  10,  18,  12,    1,  -12 },   // 0xFE ''
   {  3048,   9,  18,  11,    1,  -12 } }; // 0xFF ''
 
-const GFXfont Poppins_Regular_9pt8b PROGMEM = {
+constexpr GFXfont Poppins_Regular_9pt8b PROGMEM = {
   (uint8_t  *)Poppins_Regular_9pt8bBitmaps,
   (GFXglyph *)Poppins_Regular_9pt8bGlyphs,
   0x20, 0xFF, 26 };
@@ -278,7 +278,7 @@ const uint8_t Quicksand_Regular_10pt8bBitmaps[] PROGMEM = {
   0x00, 0x00, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x87, 0x7B,
   0x02, 0x02, 0x84, 0x78 };
 
-const GFXglyph Quicksand_Regular_10pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph Quicksand_Regular_10pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   5,    0,    0 },   // 0x20 ' '
   {     1,   2,  14,   4,    1,  -13 },   // 0x21 '!'
   {     5,   6,   5,   8,    1,  -13 },   // 0x22 '"'
@@ -504,7 +504,7 @@ const GFXglyph Quicksand_Regular_10pt8bGlyphs[] PROGMEM = {
   {  3289,   9,  18,  12,    2,  -13 },   // 0xFE ''
   {  3310,   8,  18,  11,    2,  -13 } }; // 0xFF ''
 
-const GFXfont Quicksand_Regular_10pt8b PROGMEM = {
+constexpr GFXfont Quicksand_Regular_10pt8b PROGMEM = {
   (uint8_t  *)Quicksand_Regular_10pt8bBitmaps,
   (GFXglyph *)Quicksand_Regular_10pt8bGlyphs,
   0x20, 0xFF, 24 };
@@ -331,7 +331,7 @@ const uint8_t Quicksand_Regular_11pt8bBitmaps[] PROGMEM = {
   0x02, 0x00, 0x26, 0x13, 0x00, 0x00, 0x08, 0x1C, 0x0E, 0x07, 0x03, 0x81,
   0xC0, 0xE0, 0x70, 0x38, 0x1E, 0x1D, 0xF6, 0x02, 0x01, 0x41, 0x3F, 0x00 };
 
-const GFXglyph Quicksand_Regular_11pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph Quicksand_Regular_11pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   6,    0,    0 },   // 0x20 ' '
   {     1,   2,  15,   4,    1,  -14 },   // 0x21 '!'
   {     5,   6,   6,   8,    1,  -14 },   // 0x22 '"'
@@ -557,7 +557,7 @@ const GFXglyph Quicksand_Regular_11pt8bGlyphs[] PROGMEM = {
   {  3925,  10,  20,  13,    2,  -15 },   // 0xFE ''
   {  3950,   9,  19,  12,    2,  -14 } }; // 0xFF ''
 
-const GFXfont Quicksand_Regular_11pt8b PROGMEM = {
+constexpr GFXfont Quicksand_Regular_11pt8b PROGMEM = {
   (uint8_t  *)Quicksand_Regular_11pt8bBitmaps,
   (GFXglyph *)Quicksand_Regular_11pt8bGlyphs,
   0x20, 0xFF, 27 };
@@ -533,7 +533,7 @@ const uint8_t Quicksand_Regular_14pt8bBitmaps[] PROGMEM = {
   0x0E, 0x01, 0xC0, 0x38, 0x07, 0x00, 0xE0, 0x1C, 0x03, 0x80, 0x70, 0x0E,
   0x03, 0x40, 0xEE, 0x34, 0xFC, 0x80, 0x10, 0x06, 0x00, 0xF8, 0x73, 0xFC };
 
-const GFXglyph Quicksand_Regular_14pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph Quicksand_Regular_14pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   7,    0,    0 },   // 0x20 ' '
   {     1,   3,  19,   5,    1,  -18 },   // 0x21 '!'
   {     9,   8,   7,  11,    1,  -18 },   // 0x22 '"'
@@ -759,7 +759,7 @@ const GFXglyph Quicksand_Regular_14pt8bGlyphs[] PROGMEM = {
   {  6322,  13,  25,  17,    2,  -19 },   // 0xFE ''
   {  6363,  11,  24,  16,    2,  -18 } }; // 0xFF ''
 
-const GFXfont Quicksand_Regular_14pt8b PROGMEM = {
+constexpr GFXfont Quicksand_Regular_14pt8b PROGMEM = {
   (uint8_t  *)Quicksand_Regular_14pt8bBitmaps,
   (GFXglyph *)Quicksand_Regular_14pt8bGlyphs,
   0x20, 0xFF, 34 };
@@ -696,7 +696,7 @@ const uint8_t Quicksand_Regular_16pt8bBitmaps[] PROGMEM = {
   0x1A, 0x00, 0xD8, 0x06, 0xC0, 0x73, 0xDF, 0x8F, 0xCC, 0x00, 0x60, 0x03,
   0x00, 0x32, 0x03, 0x9F, 0xF8, 0x7F, 0x00 };
 
-const GFXglyph Quicksand_Regular_16pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph Quicksand_Regular_16pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   9,    0,    0 },   // 0x20 ' '
   {     1,   2,  22,   6,    2,  -21 },   // 0x21 '!'
   {     7,  10,   8,  12,    1,  -21 },   // 0x22 '"'
@@ -922,7 +922,7 @@ const GFXglyph Quicksand_Regular_16pt8bGlyphs[] PROGMEM = {
   {  8246,  15,  29,  19,    2,  -22 },   // 0xFE ''
   {  8301,  13,  28,  18,    2,  -21 } }; // 0xFF ''
 
-const GFXfont Quicksand_Regular_16pt8b PROGMEM = {
+constexpr GFXfont Quicksand_Regular_16pt8b PROGMEM = {
   (uint8_t  *)Quicksand_Regular_16pt8bBitmaps,
   (GFXglyph *)Quicksand_Regular_16pt8bGlyphs,
   0x20, 0xFF, 39 };
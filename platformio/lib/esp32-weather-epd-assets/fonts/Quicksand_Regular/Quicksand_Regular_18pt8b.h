@@ -886,7 +886,7 @@ const uint8_t Quicksand_Regular_18pt8bBitmaps[] PROGMEM = {
   0xCF, 0xF3, 0x00, 0x0C, 0x00, 0x30, 0x01, 0x80, 0x0E, 0xE0, 0x73, 0xFF,
   0x83, 0xF8, 0x00 };
 
-const GFXglyph Quicksand_Regular_18pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph Quicksand_Regular_18pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,  10,    0,    0 },   // 0x20 ' '
   {     1,   3,  25,   7,    2,  -24 },   // 0x21 '!'
   {    11,  11,  10,  14,    1,  -24 },   // 0x22 '"'
@@ -1112,7 +1112,7 @@ const GFXglyph Quicksand_Regular_18pt8bGlyphs[] PROGMEM = {
   { 10497,  17,  33,  21,    3,  -25 },   // 0xFE ''
   { 10568,  14,  31,  20,    3,  -23 } }; // 0xFF ''
 
-const GFXfont Quicksand_Regular_18pt8b PROGMEM = {
+constexpr GFXfont Quicksand_Regular_18pt8b PROGMEM = {
   (uint8_t  *)Quicksand_Regular_18pt8bBitmaps,
   (GFXglyph *)Quicksand_Regular_18pt8bGlyphs,
   0x20, 0xFF, 44 };
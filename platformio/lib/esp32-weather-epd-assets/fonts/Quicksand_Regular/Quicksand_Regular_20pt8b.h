@@ -1072,7 +1072,7 @@ const uint8_t Quicksand_Regular_20pt8bBitmaps[] PROGMEM = {
   0x03, 0x00, 0x07, 0x00, 0x06, 0x00, 0x0E, 0x40, 0x1C, 0xF8, 0xF8, 0x7F,
   0xF0, 0x0F, 0x80 };
 
-const GFXglyph Quicksand_Regular_20pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph Quicksand_Regular_20pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,  11,    0,    0 },   // 0x20 ' '
   {     1,   3,  27,   7,    2,  -26 },   // 0x21 '!'
   {    12,  11,  10,  15,    2,  -26 },   // 0x22 '"'
@@ -1298,7 +1298,7 @@ const GFXglyph Quicksand_Regular_20pt8bGlyphs[] PROGMEM = {
   { 12697,  19,  37,  24,    3,  -28 },   // 0xFE ''
   { 12785,  16,  35,  22,    3,  -26 } }; // 0xFF ''
 
-const GFXfont Quicksand_Regular_20pt8b PROGMEM = {
+constexpr GFXfont Quicksand_Regular_20pt8b PROGMEM = {
   (uint8_t  *)Quicksand_Regular_20pt8bBitmaps,
   (GFXglyph *)Quicksand_Regular_20pt8bGlyphs,
   0x20, 0xFF, 49 };
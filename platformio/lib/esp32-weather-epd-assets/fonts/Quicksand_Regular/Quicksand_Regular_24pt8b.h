@@ -1570,7 +1570,7 @@ const uint8_t Quicksand_Regular_24pt8bBitmaps[] PROGMEM = {
   0x00, 0x00, 0xE0, 0x00, 0x38, 0xC0, 0x0F, 0x3E, 0x0F, 0xC3, 0xFF, 0xE0,
   0x1F, 0xF8, 0x00 };
 
-const GFXglyph Quicksand_Regular_24pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph Quicksand_Regular_24pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,  13,    0,    0 },   // 0x20 ' '
   {     1,   3,  33,   9,    3,  -32 },   // 0x21 '!'
   {    14,  14,  13,  18,    2,  -32 },   // 0x22 '"'
@@ -1796,7 +1796,7 @@ const GFXglyph Quicksand_Regular_24pt8bGlyphs[] PROGMEM = {
   { 18612,  22,  44,  28,    4,  -34 },   // 0xFE ''
   { 18733,  19,  41,  27,    4,  -31 } }; // 0xFF ''
 
-const GFXfont Quicksand_Regular_24pt8b PROGMEM = {
+constexpr GFXfont Quicksand_Regular_24pt8b PROGMEM = {
   (uint8_t  *)Quicksand_Regular_24pt8bBitmaps,
   (GFXglyph *)Quicksand_Regular_24pt8bGlyphs,
   0x20, 0xFF, 59 };
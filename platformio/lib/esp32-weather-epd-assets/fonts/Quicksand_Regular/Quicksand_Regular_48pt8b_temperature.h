@@ -307,7 +307,7 @@ const uint8_t Quicksand_Regular_48pt8b_temperatureBitmaps[] PROGMEM = {
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
 
-const GFXglyph Quicksand_Regular_48pt8b_temperatureGlyphs[] PROGMEM = {
+constexpr GFXglyph Quicksand_Regular_48pt8b_temperatureGlyphs[] PROGMEM = {
   {     0,   1,   1,  55,    0,    0 },   // 0x20 ' '
   {     1,   1,   1,  55,    0,    0 },   // 0x21 '!'
   {     2,   1,   1,  55,    0,    0 },   // 0x22 '"'
@@ -533,7 +533,7 @@ const GFXglyph Quicksand_Regular_48pt8b_temperatureGlyphs[] PROGMEM = {
   {  3676,   1,   1,  55,    0,    0 },   // 0xFE ''
   {  3677,   1,   1,  55,    0,    0 } }; // 0xFF ''
 
-const GFXfont Quicksand_Regular_48pt8b_temperature PROGMEM = {
+constexpr GFXfont Quicksand_Regular_48pt8b_temperature PROGMEM = {
   (uint8_t  *)Quicksand_Regular_48pt8b_temperatureBitmaps,
   (GFXglyph *)Quicksand_Regular_48pt8b_temperatureGlyphs,
   0x20, 0xFF, 118 };
@@ -53,7 +53,7 @@ const uint8_t Quicksand_Regular_4pt8bBitmaps[] PROGMEM = {
   0x52, 0xDB, 0xC0, 0x52, 0xDB, 0xC0, 0x36, 0xDE, 0x52, 0xDB, 0xCE, 0x93,
   0xDB, 0xE4, 0x36, 0xDE, 0x70 };
 
-const GFXglyph Quicksand_Regular_4pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph Quicksand_Regular_4pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   2,    0,    0 },   // 0x20 ' '
   {     1,   1,   5,   1,    0,   -4 },   // 0x21 '!'
   {     2,   3,   2,   3,    0,   -4 },   // 0x22 '"'
@@ -279,7 +279,7 @@ const GFXglyph Quicksand_Regular_4pt8bGlyphs[] PROGMEM = {
   {   623,   3,   8,   5,    1,   -5 },   // 0xFE ''
   {   626,   3,   7,   4,    1,   -4 } }; // 0xFF ''
 
-const GFXfont Quicksand_Regular_4pt8b PROGMEM = {
+constexpr GFXfont Quicksand_Regular_4pt8b PROGMEM = {
   (uint8_t  *)Quicksand_Regular_4pt8bBitmaps,
   (GFXglyph *)Quicksand_Regular_4pt8bGlyphs,
   0x20, 0xFF, 10 };
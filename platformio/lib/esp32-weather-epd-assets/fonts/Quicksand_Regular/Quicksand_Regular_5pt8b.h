@@ -80,7 +80,7 @@ const uint8_t Quicksand_Regular_5pt8bBitmaps[] PROGMEM = {
   0x99, 0x99, 0xE0, 0x60, 0x99, 0x99, 0xE0, 0x24, 0x99, 0x99, 0xF1, 0xE0,
   0x88, 0xF9, 0x99, 0xF8, 0x80, 0x60, 0x99, 0x99, 0xF1, 0xE0 };
 
-const GFXglyph Quicksand_Regular_5pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph Quicksand_Regular_5pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   3,    0,    0 },   // 0x20 ' '
   {     1,   1,   7,   2,    0,   -6 },   // 0x21 '!'
   {     2,   3,   3,   4,    0,   -6 },   // 0x22 '"'
@@ -306,7 +306,7 @@ const GFXglyph Quicksand_Regular_5pt8bGlyphs[] PROGMEM = {
   {   948,   4,   9,   6,    1,   -6 },   // 0xFE ''
   {   953,   4,   9,   6,    1,   -6 } }; // 0xFF ''
 
-const GFXfont Quicksand_Regular_5pt8b PROGMEM = {
+constexpr GFXfont Quicksand_Regular_5pt8b PROGMEM = {
   (uint8_t  *)Quicksand_Regular_5pt8bBitmaps,
   (GFXglyph *)Quicksand_Regular_5pt8bGlyphs,
   0x20, 0xFF, 12 };
@@ -99,7 +99,7 @@ const uint8_t Quicksand_Regular_6pt8bBitmaps[] PROGMEM = {
   0x3C, 0x8A, 0x18, 0x62, 0xF2, 0x08, 0x00, 0x50, 0x23, 0x18, 0xC6, 0x3F,
   0x0F, 0x80 };
 
-const GFXglyph Quicksand_Regular_6pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph Quicksand_Regular_6pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   3,    0,    0 },   // 0x20 ' '
   {     1,   1,   8,   2,    1,   -7 },   // 0x21 '!'
   {     2,   4,   3,   5,    0,   -7 },   // 0x22 '"'
@@ -325,7 +325,7 @@ const GFXglyph Quicksand_Regular_6pt8bGlyphs[] PROGMEM = {
   {  1162,   6,  11,   7,    1,   -8 },   // 0xFE ''
   {  1171,   5,  10,   7,    1,   -7 } }; // 0xFF ''
 
-const GFXfont Quicksand_Regular_6pt8b PROGMEM = {
+constexpr GFXfont Quicksand_Regular_6pt8b PROGMEM = {
   (uint8_t  *)Quicksand_Regular_6pt8bBitmaps,
   (GFXglyph *)Quicksand_Regular_6pt8bGlyphs,
   0x20, 0xFF, 15 };
@@ -181,7 +181,7 @@ const uint8_t Quicksand_Regular_8pt8bBitmaps[] PROGMEM = {
   0x80, 0x48, 0x90, 0x04, 0x18, 0x30, 0x60, 0xC1, 0x83, 0x8D, 0xE8, 0x10,
   0x5F, 0x00 };
 
-const GFXglyph Quicksand_Regular_8pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph Quicksand_Regular_8pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   4,    0,    0 },   // 0x20 ' '
   {     1,   1,  11,   3,    1,  -10 },   // 0x21 '!'
   {     3,   4,   4,   6,    1,  -10 },   // 0x22 '"'
@@ -407,7 +407,7 @@ const GFXglyph Quicksand_Regular_8pt8bGlyphs[] PROGMEM = {
   {  2134,   8,  15,  10,    1,  -11 },   // 0xFE ''
   {  2149,   7,  14,   9,    1,  -10 } }; // 0xFF ''
 
-const GFXfont Quicksand_Regular_8pt8b PROGMEM = {
+constexpr GFXfont Quicksand_Regular_8pt8b PROGMEM = {
   (uint8_t  *)Quicksand_Regular_8pt8bBitmaps,
   (GFXglyph *)Quicksand_Regular_8pt8bGlyphs,
   0x20, 0xFF, 20 };
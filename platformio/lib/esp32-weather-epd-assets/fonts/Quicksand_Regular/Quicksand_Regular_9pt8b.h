@@ -225,7 +225,7 @@ const uint8_t Quicksand_Regular_9pt8bBitmaps[] PROGMEM = {
   0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0xC3, 0x43, 0x7D, 0x02, 0x02, 0x6C,
   0x10 };
 
-const GFXglyph Quicksand_Regular_9pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph Quicksand_Regular_9pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   5,    0,    0 },   // 0x20 ' '
   {     1,   1,  12,   3,    1,  -11 },   // 0x21 '!'
   {     3,   5,   4,   7,    1,  -11 },   // 0x22 '"'
@@ -451,7 +451,7 @@ const GFXglyph Quicksand_Regular_9pt8bGlyphs[] PROGMEM = {
   {  2653,   9,  17,  11,    1,  -12 },   // 0xFE ''
   {  2673,   8,  16,  10,    1,  -11 } }; // 0xFF ''
 
-const GFXfont Quicksand_Regular_9pt8b PROGMEM = {
+constexpr GFXfont Quicksand_Regular_9pt8b PROGMEM = {
   (uint8_t  *)Quicksand_Regular_9pt8bBitmaps,
   (GFXglyph *)Quicksand_Regular_9pt8bGlyphs,
   0x20, 0xFF, 22 };
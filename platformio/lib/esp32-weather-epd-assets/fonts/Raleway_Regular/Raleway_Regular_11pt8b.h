@@ -365,7 +365,7 @@ const uint8_t Raleway_Regular_11pt8bBitmaps[] PROGMEM = {
   0xD8, 0x19, 0x02, 0x30, 0xC2, 0x10, 0x62, 0x0C, 0xC0, 0x90, 0x1E, 0x01,
   0x80, 0x30, 0x06, 0x00, 0x80, 0x30, 0x06, 0x03, 0x80 };
 
-const GFXglyph Raleway_Regular_11pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph Raleway_Regular_11pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   6,    0,    0 },   // 0x20 ' '
   {     1,   2,  16,   6,    2,  -15 },   // 0x21 '!'
   {     5,   3,   4,   6,    2,  -15 },   // 0x22 '"'
@@ -591,7 +591,7 @@ const GFXglyph Raleway_Regular_11pt8bGlyphs[] PROGMEM = {
   {  4321,  10,  21,  13,    2,  -15 },   // 0xFE ''
   {  4348,  11,  21,  12,    0,  -15 } }; // 0xFF ''
 
-const GFXfont Raleway_Regular_11pt8b PROGMEM = {
+constexpr GFXfont Raleway_Regular_11pt8b PROGMEM = {
   (uint8_t  *)Raleway_Regular_11pt8bBitmaps,
   (GFXglyph *)Raleway_Regular_11pt8bGlyphs,
   0x20, 0xFF, 25 };
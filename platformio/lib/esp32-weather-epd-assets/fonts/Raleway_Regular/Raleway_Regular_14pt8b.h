@@ -552,7 +552,7 @@ const uint8_t Raleway_Regular_14pt8bBitmaps[] PROGMEM = {
   0x00, 0x38, 0x00, 0xE0, 0x03, 0x00, 0x0C, 0x00, 0x60, 0x01, 0x80, 0x1E,
   0x00, 0x70, 0x00 };
 
-const GFXglyph Raleway_Regular_14pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph Raleway_Regular_14pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   7,    0,    0 },   // 0x20 ' '
   {     1,   2,  19,   7,    2,  -18 },   // 0x21 '!'
   {     6,   4,   5,   8,    2,  -18 },   // 0x22 '"'
@@ -778,7 +778,7 @@ const GFXglyph Raleway_Regular_14pt8bGlyphs[] PROGMEM = {
   {  6528,  13,  25,  16,    2,  -18 },   // 0xFE ''
   {  6569,  14,  26,  15,    0,  -19 } }; // 0xFF ''
 
-const GFXfont Raleway_Regular_14pt8b PROGMEM = {
+constexpr GFXfont Raleway_Regular_14pt8b PROGMEM = {
   (uint8_t  *)Raleway_Regular_14pt8bBitmaps,
   (GFXglyph *)Raleway_Regular_14pt8bGlyphs,
   0x20, 0xFF, 32 };
@@ -716,7 +716,7 @@ const uint8_t Raleway_Regular_16pt8bBitmaps[] PROGMEM = {
   0x03, 0x60, 0x01, 0xC0, 0x01, 0xC0, 0x01, 0xC0, 0x01, 0x80, 0x01, 0x80,
   0x03, 0x00, 0x03, 0x00, 0x1E, 0x00, 0x1C, 0x00 };
 
-const GFXglyph Raleway_Regular_16pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph Raleway_Regular_16pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   8,    0,    0 },   // 0x20 ' '
   {     1,   2,  22,   8,    3,  -21 },   // 0x21 '!'
   {     7,   5,   6,   9,    2,  -21 },   // 0x22 '"'
@@ -942,7 +942,7 @@ const GFXglyph Raleway_Regular_16pt8bGlyphs[] PROGMEM = {
   {  8470,  16,  29,  19,    2,  -21 },   // 0xFE ''
   {  8528,  16,  30,  17,    0,  -22 } }; // 0xFF ''
 
-const GFXfont Raleway_Regular_16pt8b PROGMEM = {
+constexpr GFXfont Raleway_Regular_16pt8b PROGMEM = {
   (uint8_t  *)Raleway_Regular_16pt8bBitmaps,
   (GFXglyph *)Raleway_Regular_16pt8bGlyphs,
   0x20, 0xFF, 37 };
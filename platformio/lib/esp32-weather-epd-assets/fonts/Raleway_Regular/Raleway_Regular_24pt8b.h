@@ -1620,7 +1620,7 @@ const uint8_t Raleway_Regular_24pt8bBitmaps[] PROGMEM = {
   0x00, 0x00, 0x70, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xE0, 0x00, 0x01, 0xE0,
   0x00, 0x0F, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0x00, 0x00 };
 
-const GFXglyph Raleway_Regular_24pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph Raleway_Regular_24pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,  12,    0,    0 },   // 0x20 ' '
   {     1,   4,  33,  12,    4,  -32 },   // 0x21 '!'
   {    18,   7,   9,  14,    3,  -32 },   // 0x22 '"'
@@ -1846,7 +1846,7 @@ const GFXglyph Raleway_Regular_24pt8bGlyphs[] PROGMEM = {
   { 19182,  23,  43,  28,    4,  -32 },   // 0xFE ''
   { 19306,  24,  44,  25,    1,  -33 } }; // 0xFF ''
 
-const GFXfont Raleway_Regular_24pt8b PROGMEM = {
+constexpr GFXfont Raleway_Regular_24pt8b PROGMEM = {
   (uint8_t  *)Raleway_Regular_24pt8bBitmaps,
   (GFXglyph *)Raleway_Regular_24pt8bGlyphs,
   0x20, 0xFF, 55 };
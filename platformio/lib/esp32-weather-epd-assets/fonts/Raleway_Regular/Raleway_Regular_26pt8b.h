@@ -1904,7 +1904,7 @@ const uint8_t Raleway_Regular_26pt8bBitmaps[] PROGMEM = {
   0x00, 0x7C, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0x80,
   0x00, 0x00 };
 
-const GFXglyph Raleway_Regular_26pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph Raleway_Regular_26pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,  13,    0,    0 },   // 0x20 ' '
   {     1,   3,  36,  13,    5,  -35 },   // 0x21 '!'
   {    15,   7,  10,  15,    4,  -35 },   // 0x22 '"'
@@ -2130,7 +2130,7 @@ const GFXglyph Raleway_Regular_26pt8bGlyphs[] PROGMEM = {
   { 22531,  25,  47,  31,    4,  -35 },   // 0xFE ''
   { 22678,  26,  49,  28,    1,  -36 } }; // 0xFF ''
 
-const GFXfont Raleway_Regular_26pt8b PROGMEM = {
+constexpr GFXfont Raleway_Regular_26pt8b PROGMEM = {
   (uint8_t  *)Raleway_Regular_26pt8bBitmaps,
   (GFXglyph *)Raleway_Regular_26pt8bGlyphs,
   0x20, 0xFF, 60 };
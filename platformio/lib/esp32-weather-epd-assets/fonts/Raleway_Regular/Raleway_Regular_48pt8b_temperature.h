@@ -321,7 +321,7 @@ const uint8_t Raleway_Regular_48pt8b_temperatureBitmaps[] PROGMEM = {
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00 };
 
-const GFXglyph Raleway_Regular_48pt8b_temperatureGlyphs[] PROGMEM = {
+constexpr GFXglyph Raleway_Regular_48pt8b_temperatureGlyphs[] PROGMEM = {
   {     0,   1,   1,  57,    0,    0 },   // 0x20 ' '
   {     1,   1,   1,  57,    0,    0 },   // 0x21 '!'
   {     2,   1,   1,  57,    0,    0 },   // 0x22 '"'
@@ -547,7 +547,7 @@ const GFXglyph Raleway_Regular_48pt8b_temperatureGlyphs[] PROGMEM = {
   {  3842,   1,   1,  57,    0,    0 },   // 0xFE ''
   {  3843,   1,   1,  57,    0,    0 } }; // 0xFF ''
 
-const GFXfont Raleway_Regular_48pt8b_temperature PROGMEM = {
+constexpr GFXfont Raleway_Regular_48pt8b_temperature PROGMEM = {
   (uint8_t  *)Raleway_Regular_48pt8b_temperatureBitmaps,
   (GFXglyph *)Raleway_Regular_48pt8b_temperatureGlyphs,
   0x20, 0xFF, 110 };
@@ -55,7 +55,7 @@ const uint8_t Raleway_Regular_4pt8bBitmaps[] PROGMEM = {
   0xDB, 0xC0, 0x20, 0x95, 0x62, 0x24, 0x08, 0xE9, 0x9E, 0x80, 0x40, 0x95,
   0x62, 0x24 };
 
-const GFXglyph Raleway_Regular_4pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph Raleway_Regular_4pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   2,    0,    0 },   // 0x20 ' '
   {     1,   1,   6,   2,    1,   -5 },   // 0x21 '!'
   {     2,   1,   2,   2,    1,   -5 },   // 0x22 '"'
@@ -281,7 +281,7 @@ const GFXglyph Raleway_Regular_4pt8bGlyphs[] PROGMEM = {
   {   642,   4,   8,   5,    1,   -5 },   // 0xFE ''
   {   646,   4,   8,   4,    0,   -5 } }; // 0xFF ''
 
-const GFXfont Raleway_Regular_4pt8b PROGMEM = {
+constexpr GFXfont Raleway_Regular_4pt8b PROGMEM = {
   (uint8_t  *)Raleway_Regular_4pt8bBitmaps,
   (GFXglyph *)Raleway_Regular_4pt8bGlyphs,
   0x20, 0xFF, 9 };
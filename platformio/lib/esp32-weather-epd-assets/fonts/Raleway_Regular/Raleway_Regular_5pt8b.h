@@ -94,7 +94,7 @@ const uint8_t Raleway_Regular_5pt8bBitmaps[] PROGMEM = {
   0x99, 0x9F, 0x11, 0x01, 0x14, 0xA9, 0x46, 0x21, 0x10, 0x84, 0x3D, 0x28,
   0xC6, 0x5C, 0x84, 0x00, 0x50, 0x22, 0x95, 0x28, 0xC4, 0x22, 0x00 };
 
-const GFXglyph Raleway_Regular_5pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph Raleway_Regular_5pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   3,    0,    0 },   // 0x20 ' '
   {     1,   1,   8,   3,    1,   -7 },   // 0x21 '!'
   {     2,   1,   2,   3,    1,   -7 },   // 0x22 '"'
@@ -320,7 +320,7 @@ const GFXglyph Raleway_Regular_5pt8bGlyphs[] PROGMEM = {
   {  1113,   5,  10,   6,    1,   -7 },   // 0xFE ''
   {  1120,   5,  10,   5,    0,   -7 } }; // 0xFF ''
 
-const GFXfont Raleway_Regular_5pt8b PROGMEM = {
+constexpr GFXfont Raleway_Regular_5pt8b PROGMEM = {
   (uint8_t  *)Raleway_Regular_5pt8bBitmaps,
   (GFXglyph *)Raleway_Regular_5pt8bGlyphs,
   0x20, 0xFF, 12 };
@@ -161,7 +161,7 @@ const uint8_t Raleway_Regular_7pt8bBitmaps[] PROGMEM = {
   0xE4, 0x08, 0x10, 0x00, 0x14, 0x02, 0x0A, 0x14, 0x44, 0x89, 0x14, 0x18,
   0x20, 0x40, 0x86, 0x00 };
 
-const GFXglyph Raleway_Regular_7pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph Raleway_Regular_7pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   4,    0,    0 },   // 0x20 ' '
   {     1,   1,  11,   4,    1,  -10 },   // 0x21 '!'
   {     3,   2,   3,   4,    1,  -10 },   // 0x22 '"'
@@ -387,7 +387,7 @@ const GFXglyph Raleway_Regular_7pt8bGlyphs[] PROGMEM = {
   {  1899,   7,  14,   8,    1,  -10 },   // 0xFE ''
   {  1912,   7,  13,   8,    0,   -9 } }; // 0xFF ''
 
-const GFXfont Raleway_Regular_7pt8b PROGMEM = {
+constexpr GFXfont Raleway_Regular_7pt8b PROGMEM = {
   (uint8_t  *)Raleway_Regular_7pt8bBitmaps,
   (GFXglyph *)Raleway_Regular_7pt8bGlyphs,
   0x20, 0xFF, 16 };
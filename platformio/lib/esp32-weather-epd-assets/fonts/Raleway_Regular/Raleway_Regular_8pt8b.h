@@ -198,7 +198,7 @@ const uint8_t Raleway_Regular_8pt8bBitmaps[] PROGMEM = {
   0x81, 0x83, 0xC6, 0xBC, 0x80, 0x80, 0x80, 0x80, 0x14, 0x14, 0x00, 0xC1,
   0x41, 0x42, 0x22, 0x22, 0x34, 0x14, 0x14, 0x08, 0x08, 0x18, 0x10, 0x30 };
 
-const GFXglyph Raleway_Regular_8pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph Raleway_Regular_8pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   4,    0,    0 },   // 0x20 ' '
   {     1,   2,  12,   4,    1,  -11 },   // 0x21 '!'
   {     4,   3,   3,   5,    1,  -11 },   // 0x22 '"'
@@ -424,7 +424,7 @@ const GFXglyph Raleway_Regular_8pt8bGlyphs[] PROGMEM = {
   {  2344,   8,  16,  10,    1,  -11 },   // 0xFE ''
   {  2360,   8,  16,   9,    0,  -11 } }; // 0xFF ''
 
-const GFXfont Raleway_Regular_8pt8b PROGMEM = {
+constexpr GFXfont Raleway_Regular_8pt8b PROGMEM = {
   (uint8_t  *)Raleway_Regular_8pt8bBitmaps,
   (GFXglyph *)Raleway_Regular_8pt8bGlyphs,
   0x20, 0xFF, 18 };
@@ -246,7 +246,7 @@ const uint8_t Raleway_Regular_9pt8bBitmaps[] PROGMEM = {
   0x14, 0x0B, 0x08, 0x84, 0x46, 0x12, 0x09, 0x07, 0x81, 0x80, 0xC0, 0x40,
   0x20, 0x30, 0x30, 0x00 };
 
-const GFXglyph Raleway_Regular_9pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph Raleway_Regular_9pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   5,    0,    0 },   // 0x20 ' '
   {     1,   1,  13,   5,    2,  -12 },   // 0x21 '!'
   {     3,   3,   3,   5,    1,  -12 },   // 0x22 '"'
@@ -472,7 +472,7 @@ const GFXglyph Raleway_Regular_9pt8bGlyphs[] PROGMEM = {
   {  2904,   9,  17,  11,    1,  -12 },   // 0xFE ''
   {  2924,   9,  17,  10,    0,  -12 } }; // 0xFF ''
 
-const GFXfont Raleway_Regular_9pt8b PROGMEM = {
+constexpr GFXfont Raleway_Regular_9pt8b PROGMEM = {
   (uint8_t  *)Raleway_Regular_9pt8bBitmaps,
   (GFXglyph *)Raleway_Regular_9pt8bGlyphs,
   0x20, 0xFF, 21 };
@@ -241,7 +241,7 @@ const uint8_t RobotoMono_Regular_10pt8bBitmaps[] PROGMEM = {
   0x33, 0x08, 0xC0, 0x03, 0x03, 0xC0, 0xD8, 0x66, 0x18, 0x86, 0x33, 0x0C,
   0xC1, 0xE0, 0x78, 0x0C, 0x03, 0x00, 0x80, 0x60, 0x30, 0x3C, 0x00 };
 
-const GFXglyph RobotoMono_Regular_10pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph RobotoMono_Regular_10pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,  12,    0,    0 },   // 0x20 ' '
   {     1,   2,  14,  12,    5,  -13 },   // 0x21 '!'
   {     5,   5,   5,  12,    3,  -14 },   // 0x22 '"'
@@ -467,7 +467,7 @@ const GFXglyph RobotoMono_Regular_10pt8bGlyphs[] PROGMEM = {
   {  2846,   9,  19,  12,    2,  -14 },   // 0xFE ''
   {  2868,  10,  18,  12,    1,  -13 } }; // 0xFF ''
 
-const GFXfont RobotoMono_Regular_10pt8b PROGMEM = {
+constexpr GFXfont RobotoMono_Regular_10pt8b PROGMEM = {
   (uint8_t  *)RobotoMono_Regular_10pt8bBitmaps,
   (GFXglyph *)RobotoMono_Regular_10pt8bGlyphs,
   0x20, 0xFF, 26 };
@@ -906,7 +906,7 @@ const uint8_t RobotoMono_Regular_20pt8bBitmaps[] PROGMEM = {
   0x00, 0x07, 0x80, 0x00, 0x38, 0x00, 0x03, 0xC0, 0x01, 0xFC, 0x00, 0x0F,
   0xC0, 0x00, 0x7C, 0x00, 0x00 };
 
-const GFXglyph RobotoMono_Regular_20pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph RobotoMono_Regular_20pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,  23,    0,    0 },   // 0x20 ' '
   {     1,   5,  28,  23,    9,  -27 },   // 0x21 '!'
   {    19,   9,   9,  23,    7,  -28 },   // 0x22 '"'
@@ -1132,7 +1132,7 @@ const GFXglyph RobotoMono_Regular_20pt8bGlyphs[] PROGMEM = {
   { 10684,  18,  38,  23,    3,  -29 },   // 0xFE ''
   { 10770,  21,  36,  23,    1,  -27 } }; // 0xFF ''
 
-const GFXfont RobotoMono_Regular_20pt8b PROGMEM = {
+constexpr GFXfont RobotoMono_Regular_20pt8b PROGMEM = {
   (uint8_t  *)RobotoMono_Regular_20pt8bBitmaps,
   (GFXglyph *)RobotoMono_Regular_20pt8bGlyphs,
   0x20, 0xFF, 52 };
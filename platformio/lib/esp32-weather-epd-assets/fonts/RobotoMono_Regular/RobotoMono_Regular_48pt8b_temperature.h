@@ -327,7 +327,7 @@ const uint8_t RobotoMono_Regular_48pt8b_temperatureBitmaps[] PROGMEM = {
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00 };
 
-const GFXglyph RobotoMono_Regular_48pt8b_temperatureGlyphs[] PROGMEM = {
+constexpr GFXglyph RobotoMono_Regular_48pt8b_temperatureGlyphs[] PROGMEM = {
   {     0,   1,   1,  56,    0,    0 },   // 0x20 ' '
   {     1,   1,   1,  56,    0,    0 },   // 0x21 '!'
   {     2,   1,   1,  56,    0,    0 },   // 0x22 '"'
@@ -553,7 +553,7 @@ const GFXglyph RobotoMono_Regular_48pt8b_temperatureGlyphs[] PROGMEM = {
   {  3913,   1,   1,  56,    0,    0 },   // 0xFE ''
   {  3914,   1,   1,  56,    0,    0 } }; // 0xFF ''
 
-const GFXfont RobotoMono_Regular_48pt8b_temperature PROGMEM = {
+constexpr GFXfont RobotoMono_Regular_48pt8b_temperature PROGMEM = {
   (uint8_t  *)RobotoMono_Regular_48pt8b_temperatureBitmaps,
   (GFXglyph *)RobotoMono_Regular_48pt8b_temperatureGlyphs,
   0x20, 0xFF, 124 };
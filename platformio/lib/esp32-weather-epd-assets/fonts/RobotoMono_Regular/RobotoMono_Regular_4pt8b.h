@@ -47,7 +47,7 @@ const uint8_t RobotoMono_Regular_4pt8bBitmaps[] PROGMEM = {
   0xDB, 0xC0, 0x42, 0xDB, 0xC0, 0xC2, 0xDB, 0xC0, 0xA2, 0xDB, 0xC0, 0x10,
   0x64, 0xA6, 0x10, 0x88, 0x93, 0xDB, 0xE4, 0x50, 0x64, 0xA6, 0x10, 0x88 };
 
-const GFXglyph RobotoMono_Regular_4pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph RobotoMono_Regular_4pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   5,    0,    0 },   // 0x20 ' '
   {     1,   1,   6,   5,    2,   -5 },   // 0x21 '!'
   {     2,   2,   2,   5,    1,   -5 },   // 0x22 '"'
@@ -273,7 +273,7 @@ const GFXglyph RobotoMono_Regular_4pt8bGlyphs[] PROGMEM = {
   {   556,   3,   8,   5,    1,   -5 },   // 0xFE ''
   {   559,   5,   8,   5,    0,   -5 } }; // 0xFF ''
 
-const GFXfont RobotoMono_Regular_4pt8b PROGMEM = {
+constexpr GFXfont RobotoMono_Regular_4pt8b PROGMEM = {
   (uint8_t  *)RobotoMono_Regular_4pt8bBitmaps,
   (GFXglyph *)RobotoMono_Regular_4pt8bGlyphs,
   0x20, 0xFF, 10 };
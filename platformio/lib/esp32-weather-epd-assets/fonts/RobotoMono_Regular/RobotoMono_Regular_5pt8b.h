@@ -66,7 +66,7 @@ const uint8_t RobotoMono_Regular_5pt8bBitmaps[] PROGMEM = {
   0x99, 0x99, 0xF0, 0x1A, 0x14, 0x92, 0x30, 0xC3, 0x08, 0x60, 0x88, 0x8F,
   0x99, 0x9F, 0x88, 0x5A, 0x14, 0x92, 0x30, 0xC3, 0x08, 0x60 };
 
-const GFXglyph RobotoMono_Regular_5pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph RobotoMono_Regular_5pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   6,    0,    0 },   // 0x20 ' '
   {     1,   2,   7,   6,    2,   -6 },   // 0x21 '!'
   {     3,   2,   3,   6,    2,   -7 },   // 0x22 '"'
@@ -292,7 +292,7 @@ const GFXglyph RobotoMono_Regular_5pt8bGlyphs[] PROGMEM = {
   {   778,   4,  10,   6,    1,   -7 },   // 0xFE ''
   {   783,   6,   9,   6,    0,   -6 } }; // 0xFF ''
 
-const GFXfont RobotoMono_Regular_5pt8b PROGMEM = {
+constexpr GFXfont RobotoMono_Regular_5pt8b PROGMEM = {
   (uint8_t  *)RobotoMono_Regular_5pt8bBitmaps,
   (GFXglyph *)RobotoMono_Regular_5pt8bGlyphs,
   0x20, 0xFF, 13 };
@@ -124,7 +124,7 @@ const uint8_t RobotoMono_Regular_7pt8bBitmaps[] PROGMEM = {
   0x24, 0x00, 0x80, 0x43, 0x62, 0x26, 0x34, 0x14, 0x18, 0x08, 0x10, 0x10,
   0x60 };
 
-const GFXglyph RobotoMono_Regular_7pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph RobotoMono_Regular_7pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   8,    0,    0 },   // 0x20 ' '
   {     1,   2,  10,   8,    3,   -9 },   // 0x21 '!'
   {     4,   4,   4,   8,    2,  -10 },   // 0x22 '"'
@@ -350,7 +350,7 @@ const GFXglyph RobotoMono_Regular_7pt8bGlyphs[] PROGMEM = {
   {  1453,   6,  14,   8,    1,  -10 },   // 0xFE ''
   {  1464,   8,  13,   8,    0,   -9 } }; // 0xFF ''
 
-const GFXfont RobotoMono_Regular_7pt8b PROGMEM = {
+constexpr GFXfont RobotoMono_Regular_7pt8b PROGMEM = {
   (uint8_t  *)RobotoMono_Regular_7pt8bBitmaps,
   (GFXglyph *)RobotoMono_Regular_7pt8bGlyphs,
   0x20, 0xFF, 18 };
@@ -435,7 +435,7 @@ const uint8_t RobotoSlab_Regular_12pt8bBitmaps[] PROGMEM = {
   0x06, 0x18, 0x39, 0xC0, 0xCC, 0x06, 0x60, 0x1E, 0x00, 0xF0, 0x07, 0x80,
   0x18, 0x00, 0xC0, 0x0C, 0x00, 0x60, 0x1E, 0x00, 0xE0, 0x00 };
 
-const GFXglyph RobotoSlab_Regular_12pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph RobotoSlab_Regular_12pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   6,    0,    0 },   // 0x20 ' '
   {     1,   2,  17,   6,    2,  -16 },   // 0x21 '!'
   {     6,   6,   6,   9,    2,  -17 },   // 0x22 '"'
@@ -661,7 +661,7 @@ const GFXglyph RobotoSlab_Regular_12pt8bGlyphs[] PROGMEM = {
   {  5142,  13,  23,  14,    0,  -17 },   // 0xFE ''
   {  5180,  13,  23,  14,    0,  -17 } }; // 0xFF ''
 
-const GFXfont RobotoSlab_Regular_12pt8b PROGMEM = {
+constexpr GFXfont RobotoSlab_Regular_12pt8b PROGMEM = {
   (uint8_t  *)RobotoSlab_Regular_12pt8bBitmaps,
   (GFXglyph *)RobotoSlab_Regular_12pt8bGlyphs,
   0x20, 0xFF, 31 };
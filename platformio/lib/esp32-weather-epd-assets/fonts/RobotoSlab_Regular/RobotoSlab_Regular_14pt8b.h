@@ -595,7 +595,7 @@ const uint8_t RobotoSlab_Regular_14pt8bBitmaps[] PROGMEM = {
   0x06, 0x60, 0x07, 0x60, 0x03, 0xE0, 0x03, 0xC0, 0x03, 0xC0, 0x01, 0xC0,
   0x01, 0x80, 0x03, 0x80, 0x03, 0x00, 0x07, 0x00, 0x1E, 0x00, 0x1C, 0x00 };
 
-const GFXglyph RobotoSlab_Regular_14pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph RobotoSlab_Regular_14pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   7,    0,    0 },   // 0x20 ' '
   {     1,   3,  20,   6,    2,  -19 },   // 0x21 '!'
   {     9,   6,   7,  10,    2,  -20 },   // 0x22 '"'
@@ -821,7 +821,7 @@ const GFXglyph RobotoSlab_Regular_14pt8bGlyphs[] PROGMEM = {
   {  7035,  15,  27,  16,    0,  -20 },   // 0xFE ''
   {  7086,  16,  27,  16,    0,  -20 } }; // 0xFF ''
 
-const GFXfont RobotoSlab_Regular_14pt8b PROGMEM = {
+constexpr GFXfont RobotoSlab_Regular_14pt8b PROGMEM = {
   (uint8_t  *)RobotoSlab_Regular_14pt8bBitmaps,
   (GFXglyph *)RobotoSlab_Regular_14pt8bGlyphs,
   0x20, 0xFF, 36 };
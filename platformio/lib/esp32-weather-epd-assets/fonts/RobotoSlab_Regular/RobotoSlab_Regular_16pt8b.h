@@ -757,7 +757,7 @@ const uint8_t RobotoSlab_Regular_16pt8bBitmaps[] PROGMEM = {
   0x80, 0x00, 0xE0, 0x00, 0x70, 0x00, 0x1C, 0x00, 0x0E, 0x00, 0x1F, 0x80,
   0x07, 0xC0, 0x01, 0xC0, 0x00 };
 
-const GFXglyph RobotoSlab_Regular_16pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph RobotoSlab_Regular_16pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   8,    0,    0 },   // 0x20 ' '
   {     1,   3,  22,   7,    2,  -21 },   // 0x21 '!'
   {    10,   7,   8,  12,    3,  -23 },   // 0x22 '"'
@@ -983,7 +983,7 @@ const GFXglyph RobotoSlab_Regular_16pt8bGlyphs[] PROGMEM = {
   {  8943,  17,  30,  18,    0,  -23 },   // 0xFE ''
   {  9007,  18,  31,  18,    0,  -23 } }; // 0xFF ''
 
-const GFXfont RobotoSlab_Regular_16pt8b PROGMEM = {
+constexpr GFXfont RobotoSlab_Regular_16pt8b PROGMEM = {
   (uint8_t  *)RobotoSlab_Regular_16pt8bBitmaps,
   (GFXglyph *)RobotoSlab_Regular_16pt8bGlyphs,
   0x20, 0xFF, 41 };
@@ -958,7 +958,7 @@ const uint8_t RobotoSlab_Regular_18pt8bBitmaps[] PROGMEM = {
   0x07, 0x00, 0x00, 0xE0, 0x00, 0x0E, 0x00, 0x01, 0xE0, 0x00, 0x3C, 0x00,
   0x0F, 0x80, 0x01, 0xF8, 0x00, 0x04, 0x00, 0x00 };
 
-const GFXglyph RobotoSlab_Regular_18pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph RobotoSlab_Regular_18pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   9,    0,    0 },   // 0x20 ' '
   {     1,   4,  25,   8,    2,  -24 },   // 0x21 '!'
   {    14,   8,   9,  13,    3,  -26 },   // 0x22 '"'
@@ -1184,7 +1184,7 @@ const GFXglyph RobotoSlab_Regular_18pt8bGlyphs[] PROGMEM = {
   { 11323,  19,  34,  20,    0,  -26 },   // 0xFE ''
   { 11404,  20,  35,  21,    0,  -26 } }; // 0xFF ''
 
-const GFXfont RobotoSlab_Regular_18pt8b PROGMEM = {
+constexpr GFXfont RobotoSlab_Regular_18pt8b PROGMEM = {
   (uint8_t  *)RobotoSlab_Regular_18pt8bBitmaps,
   (GFXglyph *)RobotoSlab_Regular_18pt8bGlyphs,
   0x20, 0xFF, 46 };
@@ -1193,7 +1193,7 @@ const uint8_t RobotoSlab_Regular_20pt8bBitmaps[] PROGMEM = {
   0xC0, 0x00, 0x1F, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0x3E, 0x00,
   0x00 };
 
-const GFXglyph RobotoSlab_Regular_20pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph RobotoSlab_Regular_20pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,  10,    0,    0 },   // 0x20 ' '
   {     1,   4,  28,   9,    3,  -27 },   // 0x21 '!'
   {    15,   9,  10,  15,    3,  -29 },   // 0x22 '"'
@@ -1419,7 +1419,7 @@ const GFXglyph RobotoSlab_Regular_20pt8bGlyphs[] PROGMEM = {
   { 14100,  21,  38,  23,    0,  -29 },   // 0xFE ''
   { 14200,  22,  38,  23,    0,  -29 } }; // 0xFF ''
 
-const GFXfont RobotoSlab_Regular_20pt8b PROGMEM = {
+constexpr GFXfont RobotoSlab_Regular_20pt8b PROGMEM = {
   (uint8_t  *)RobotoSlab_Regular_20pt8bBitmaps,
   (GFXglyph *)RobotoSlab_Regular_20pt8bGlyphs,
   0x20, 0xFF, 52 };
@@ -329,7 +329,7 @@ const uint8_t RobotoSlab_Regular_48pt8b_temperatureBitmaps[] PROGMEM = {
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00 };
 
-const GFXglyph RobotoSlab_Regular_48pt8b_temperatureGlyphs[] PROGMEM = {
+constexpr GFXglyph RobotoSlab_Regular_48pt8b_temperatureGlyphs[] PROGMEM = {
   {     0,   1,   1,  48,    0,    0 },   // 0x20 ' '
   {     1,   1,   1,  48,    0,    0 },   // 0x21 '!'
   {     2,   1,   1,  48,    0,    0 },   // 0x22 '"'
@@ -555,7 +555,7 @@ const GFXglyph RobotoSlab_Regular_48pt8b_temperatureGlyphs[] PROGMEM = {
   {  3938,   1,   1,  48,    0,    0 },   // 0xFE ''
   {  3939,   1,   1,  48,    0,    0 } }; // 0xFF ''
 
-const GFXfont RobotoSlab_Regular_48pt8b_temperature PROGMEM = {
+constexpr GFXfont RobotoSlab_Regular_48pt8b_temperature PROGMEM = {
   (uint8_t  *)RobotoSlab_Regular_48pt8b_temperatureBitmaps,
   (GFXglyph *)RobotoSlab_Regular_48pt8b_temperatureGlyphs,
   0x20, 0xFF, 124 };
@@ -85,7 +85,7 @@ const uint8_t RobotoSlab_Regular_5pt8bBitmaps[] PROGMEM = {
   0xD2, 0x50, 0xC3, 0x08, 0x60, 0xC2, 0x1E, 0x94, 0xA5, 0xE8, 0xE0, 0x50,
   0x0D, 0xD2, 0x50, 0xC3, 0x08, 0x60 };
 
-const GFXglyph RobotoSlab_Regular_5pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph RobotoSlab_Regular_5pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   2,    0,    0 },   // 0x20 ' '
   {     1,   1,   7,   2,    1,   -6 },   // 0x21 '!'
   {     2,   2,   2,   4,    1,   -6 },   // 0x22 '"'
@@ -311,7 +311,7 @@ const GFXglyph RobotoSlab_Regular_5pt8bGlyphs[] PROGMEM = {
   {  1001,   5,   9,   6,    0,   -6 },   // 0xFE ''
   {  1007,   6,   9,   6,    0,   -6 } }; // 0xFF ''
 
-const GFXfont RobotoSlab_Regular_5pt8b PROGMEM = {
+constexpr GFXfont RobotoSlab_Regular_5pt8b PROGMEM = {
   (uint8_t  *)RobotoSlab_Regular_5pt8bBitmaps,
   (GFXglyph *)RobotoSlab_Regular_5pt8bGlyphs,
   0x20, 0xFF, 13 };
@@ -244,7 +244,7 @@ const uint8_t RobotoSlab_Regular_9pt8bBitmaps[] PROGMEM = {
   0x00, 0x33, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xD8, 0x63, 0x18, 0xC4, 0x13,
   0x06, 0x80, 0xE0, 0x38, 0x0C, 0x03, 0x00, 0x80, 0xE0, 0x30, 0x00 };
 
-const GFXglyph RobotoSlab_Regular_9pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph RobotoSlab_Regular_9pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   4,    0,    0 },   // 0x20 ' '
   {     1,   2,  13,   4,    1,  -12 },   // 0x21 '!'
   {     5,   5,   4,   7,    1,  -12 },   // 0x22 '"'
@@ -470,7 +470,7 @@ const GFXglyph RobotoSlab_Regular_9pt8bGlyphs[] PROGMEM = {
   {  2883,  10,  17,  10,    0,  -12 },   // 0xFE ''
   {  2905,  10,  17,  10,    0,  -12 } }; // 0xFF ''
 
-const GFXfont RobotoSlab_Regular_9pt8b PROGMEM = {
+constexpr GFXfont RobotoSlab_Regular_9pt8b PROGMEM = {
   (uint8_t  *)RobotoSlab_Regular_9pt8bBitmaps,
   (GFXglyph *)RobotoSlab_Regular_9pt8bGlyphs,
   0x20, 0xFF, 23 };
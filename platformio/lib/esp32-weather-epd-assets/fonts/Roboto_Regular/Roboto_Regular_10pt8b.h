@@ -285,7 +285,7 @@ const uint8_t Roboto_Regular_10pt8bBitmaps[] PROGMEM = {
   0x09, 0x8C, 0xC6, 0x22, 0x1B, 0x0D, 0x82, 0x81, 0xC0, 0xE0, 0x20, 0x30,
   0x18, 0x38, 0x18, 0x00 };
 
-const GFXglyph Roboto_Regular_10pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph Roboto_Regular_10pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   5,    0,    0 },   // 0x20 ' '
   {     1,   2,  14,   5,    2,  -13 },   // 0x21 '!'
   {     5,   4,   5,   6,    1,  -14 },   // 0x22 '"'
@@ -511,7 +511,7 @@ const GFXglyph Roboto_Regular_10pt8bGlyphs[] PROGMEM = {
   {  3368,   9,  19,  12,    2,  -14 },   // 0xFE ''
   {  3390,   9,  19,   9,    0,  -14 } }; // 0xFF ''
 
-const GFXfont Roboto_Regular_10pt8b PROGMEM = {
+constexpr GFXfont Roboto_Regular_10pt8b PROGMEM = {
   (uint8_t  *)Roboto_Regular_10pt8bBitmaps,
   (GFXglyph *)Roboto_Regular_10pt8bGlyphs,
   0x20, 0xFF, 23 };
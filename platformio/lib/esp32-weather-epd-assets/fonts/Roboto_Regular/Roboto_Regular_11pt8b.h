@@ -346,7 +346,7 @@ const uint8_t Roboto_Regular_11pt8bBitmaps[] PROGMEM = {
   0x00, 0xC0, 0xD8, 0x66, 0x19, 0x86, 0x33, 0x0C, 0xC3, 0x30, 0x78, 0x1E,
   0x03, 0x80, 0xC0, 0x30, 0x08, 0x06, 0x07, 0x81, 0xC0 };
 
-const GFXglyph Roboto_Regular_11pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph Roboto_Regular_11pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   5,    0,    0 },   // 0x20 ' '
   {     1,   2,  16,   6,    2,  -15 },   // 0x21 '!'
   {     5,   5,   5,   7,    1,  -16 },   // 0x22 '"'
@@ -572,7 +572,7 @@ const GFXglyph Roboto_Regular_11pt8bGlyphs[] PROGMEM = {
   {  4097,  10,  21,  13,    2,  -16 },   // 0xFE ''
   {  4124,  10,  20,  10,    0,  -15 } }; // 0xFF ''
 
-const GFXfont Roboto_Regular_11pt8b PROGMEM = {
+constexpr GFXfont Roboto_Regular_11pt8b PROGMEM = {
   (uint8_t  *)Roboto_Regular_11pt8bBitmaps,
   (GFXglyph *)Roboto_Regular_11pt8bGlyphs,
   0x20, 0xFF, 25 };
@@ -408,7 +408,7 @@ const uint8_t Roboto_Regular_12pt8bBitmaps[] PROGMEM = {
   0x3E, 0x03, 0x80, 0x70, 0x06, 0x01, 0x80, 0x30, 0x0C, 0x07, 0x80, 0xE0,
   0x00 };
 
-const GFXglyph Roboto_Regular_12pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph Roboto_Regular_12pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   6,    0,    0 },   // 0x20 ' '
   {     1,   2,  17,   6,    2,  -16 },   // 0x21 '!'
   {     6,   4,   6,   8,    2,  -17 },   // 0x22 '"'
@@ -634,7 +634,7 @@ const GFXglyph Roboto_Regular_12pt8bGlyphs[] PROGMEM = {
   {  4822,  11,  23,  14,    2,  -17 },   // 0xFE ''
   {  4854,  11,  22,  11,    0,  -16 } }; // 0xFF ''
 
-const GFXfont Roboto_Regular_12pt8b PROGMEM = {
+constexpr GFXfont Roboto_Regular_12pt8b PROGMEM = {
   (uint8_t  *)Roboto_Regular_12pt8bBitmaps,
   (GFXglyph *)Roboto_Regular_12pt8bGlyphs,
   0x20, 0xFF, 28 };
@@ -655,7 +655,7 @@ const uint8_t Roboto_Regular_16pt8bBitmaps[] PROGMEM = {
   0xB8, 0x06, 0xC0, 0x1F, 0x00, 0x7C, 0x00, 0xE0, 0x03, 0x80, 0x0E, 0x00,
   0x30, 0x00, 0xC0, 0x07, 0x00, 0x38, 0x07, 0xC0, 0x1E, 0x00 };
 
-const GFXglyph Roboto_Regular_16pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph Roboto_Regular_16pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   8,    0,    0 },   // 0x20 ' '
   {     1,   4,  22,   8,    2,  -21 },   // 0x21 '!'
   {    12,   6,   7,  10,    2,  -22 },   // 0x22 '"'
@@ -881,7 +881,7 @@ const GFXglyph Roboto_Regular_16pt8bGlyphs[] PROGMEM = {
   {  7758,  14,  29,  18,    2,  -22 },   // 0xFE ''
   {  7809,  14,  28,  15,    0,  -21 } }; // 0xFF ''
 
-const GFXfont Roboto_Regular_16pt8b PROGMEM = {
+constexpr GFXfont Roboto_Regular_16pt8b PROGMEM = {
   (uint8_t  *)Roboto_Regular_16pt8bBitmaps,
   (GFXglyph *)Roboto_Regular_16pt8bGlyphs,
   0x20, 0xFF, 37 };
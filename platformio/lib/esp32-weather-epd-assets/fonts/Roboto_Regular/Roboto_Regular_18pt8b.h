@@ -843,7 +843,7 @@ const uint8_t Roboto_Regular_18pt8bBitmaps[] PROGMEM = {
   0x07, 0x00, 0x0E, 0x00, 0x38, 0x00, 0x70, 0x01, 0xC0, 0x1F, 0x80, 0x3E,
   0x00, 0x78, 0x00 };
 
-const GFXglyph Roboto_Regular_18pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph Roboto_Regular_18pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   9,    0,    0 },   // 0x20 ' '
   {     1,   3,  25,   9,    3,  -24 },   // 0x21 '!'
   {    11,   7,   8,  11,    2,  -25 },   // 0x22 '"'
@@ -1069,7 +1069,7 @@ const GFXglyph Roboto_Regular_18pt8bGlyphs[] PROGMEM = {
   {  9979,  16,  33,  20,    2,  -25 },   // 0xFE ''
   { 10045,  15,  33,  17,    1,  -25 } }; // 0xFF ''
 
-const GFXfont Roboto_Regular_18pt8b PROGMEM = {
+constexpr GFXfont Roboto_Regular_18pt8b PROGMEM = {
   (uint8_t  *)Roboto_Regular_18pt8bBitmaps,
   (GFXglyph *)Roboto_Regular_18pt8bGlyphs,
   0x20, 0xFF, 41 };
@@ -1049,7 +1049,7 @@ const uint8_t Roboto_Regular_20pt8bBitmaps[] PROGMEM = {
   0x00, 0x07, 0x80, 0x01, 0xC0, 0x00, 0x70, 0x00, 0x3C, 0x00, 0x0E, 0x00,
   0x07, 0x80, 0x1F, 0xC0, 0x07, 0xE0, 0x01, 0xF0, 0x00 };
 
-const GFXglyph Roboto_Regular_20pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph Roboto_Regular_20pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,  10,    0,    0 },   // 0x20 ' '
   {     1,   4,  28,  10,    3,  -27 },   // 0x21 '!'
   {    15,   7,   9,  12,    3,  -28 },   // 0x22 '"'
@@ -1275,7 +1275,7 @@ const GFXglyph Roboto_Regular_20pt8bGlyphs[] PROGMEM = {
   { 12425,  17,  37,  22,    3,  -28 },   // 0xFE ''
   { 12504,  18,  36,  18,    0,  -27 } }; // 0xFF ''
 
-const GFXfont Roboto_Regular_20pt8b PROGMEM = {
+constexpr GFXfont Roboto_Regular_20pt8b PROGMEM = {
   (uint8_t  *)Roboto_Regular_20pt8bBitmaps,
   (GFXglyph *)Roboto_Regular_20pt8bGlyphs,
   0x20, 0xFF, 46 };
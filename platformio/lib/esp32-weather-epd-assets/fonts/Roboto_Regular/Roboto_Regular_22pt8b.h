@@ -1276,7 +1276,7 @@ const uint8_t Roboto_Regular_22pt8bBitmaps[] PROGMEM = {
   0x00, 0x0E, 0x00, 0x01, 0xE0, 0x00, 0x1C, 0x00, 0x03, 0xC0, 0x00, 0x7C,
   0x00, 0x3F, 0x80, 0x03, 0xF0, 0x00, 0x3C, 0x00, 0x00 };
 
-const GFXglyph Roboto_Regular_22pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph Roboto_Regular_22pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,  11,    0,    0 },   // 0x20 ' '
   {     1,   5,  31,  11,    3,  -30 },   // 0x21 '!'
   {    21,   8,  10,  14,    3,  -31 },   // 0x22 '"'
@@ -1502,7 +1502,7 @@ const GFXglyph Roboto_Regular_22pt8bGlyphs[] PROGMEM = {
   { 15113,  19,  41,  25,    3,  -31 },   // 0xFE ''
   { 15211,  20,  39,  20,    0,  -29 } }; // 0xFF ''
 
-const GFXfont Roboto_Regular_22pt8b PROGMEM = {
+constexpr GFXfont Roboto_Regular_22pt8b PROGMEM = {
   (uint8_t  *)Roboto_Regular_22pt8bBitmaps,
   (GFXglyph *)Roboto_Regular_22pt8bGlyphs,
   0x20, 0xFF, 50 };
@@ -1542,7 +1542,7 @@ const uint8_t Roboto_Regular_24pt8bBitmaps[] PROGMEM = {
   0x1C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x1E, 0x00, 0x00, 0xF8,
   0x00, 0x3F, 0xC0, 0x00, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0x80, 0x00 };
 
-const GFXglyph Roboto_Regular_24pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph Roboto_Regular_24pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,  12,    0,    0 },   // 0x20 ' '
   {     1,   5,  34,  12,    4,  -33 },   // 0x21 '!'
   {    23,  10,  11,  15,    3,  -34 },   // 0x22 '"'
@@ -1768,7 +1768,7 @@ const GFXglyph Roboto_Regular_24pt8bGlyphs[] PROGMEM = {
   { 18264,  21,  45,  27,    3,  -34 },   // 0xFE ''
   { 18383,  22,  44,  22,    0,  -33 } }; // 0xFF ''
 
-const GFXfont Roboto_Regular_24pt8b PROGMEM = {
+constexpr GFXfont Roboto_Regular_24pt8b PROGMEM = {
   (uint8_t  *)Roboto_Regular_24pt8bBitmaps,
   (GFXglyph *)Roboto_Regular_24pt8bGlyphs,
   0x20, 0xFF, 55 };
@@ -323,7 +323,7 @@ const uint8_t Roboto_Regular_48pt8b_temperatureBitmaps[] PROGMEM = {
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
 
-const GFXglyph Roboto_Regular_48pt8b_temperatureGlyphs[] PROGMEM = {
+constexpr GFXglyph Roboto_Regular_48pt8b_temperatureGlyphs[] PROGMEM = {
   {     0,   1,   1,  42,    0,    0 },   // 0x20 ' '
   {     1,   1,   1,  42,    0,    0 },   // 0x21 '!'
   {     2,   1,   1,  42,    0,    0 },   // 0x22 '"'
@@ -549,7 +549,7 @@ const GFXglyph Roboto_Regular_48pt8b_temperatureGlyphs[] PROGMEM = {
   {  3868,   1,   1,  42,    0,    0 },   // 0xFE ''
   {  3869,   1,   1,  42,    0,    0 } }; // 0xFF ''
 
-const GFXfont Roboto_Regular_48pt8b_temperature PROGMEM = {
+constexpr GFXfont Roboto_Regular_48pt8b_temperature PROGMEM = {
   (uint8_t  *)Roboto_Regular_48pt8b_temperatureBitmaps,
   (GFXglyph *)Roboto_Regular_48pt8b_temperatureGlyphs,
   0x20, 0xFF, 110 };
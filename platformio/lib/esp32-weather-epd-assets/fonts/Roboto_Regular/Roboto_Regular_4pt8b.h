@@ -54,7 +54,7 @@ const uint8_t Roboto_Regular_4pt8bBitmaps[] PROGMEM = {
   0xDB, 0xC0, 0xC6, 0xDB, 0xC0, 0x20, 0xBA, 0x64, 0x48, 0x93, 0xDB, 0xE4,
   0x60, 0xBA, 0x64, 0x48 };
 
-const GFXglyph Roboto_Regular_4pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph Roboto_Regular_4pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   2,    0,    0 },   // 0x20 ' '
   {     1,   1,   6,   2,    1,   -5 },   // 0x21 '!'
   {     2,   1,   2,   3,    1,   -5 },   // 0x22 '"'
@@ -280,7 +280,7 @@ const GFXglyph Roboto_Regular_4pt8bGlyphs[] PROGMEM = {
   {   633,   3,   8,   5,    1,   -5 },   // 0xFE ''
   {   636,   4,   8,   4,    0,   -5 } }; // 0xFF ''
 
-const GFXfont Roboto_Regular_4pt8b PROGMEM = {
+constexpr GFXfont Roboto_Regular_4pt8b PROGMEM = {
   (uint8_t  *)Roboto_Regular_4pt8bBitmaps,
   (GFXglyph *)Roboto_Regular_4pt8bGlyphs,
   0x20, 0xFF, 9 };
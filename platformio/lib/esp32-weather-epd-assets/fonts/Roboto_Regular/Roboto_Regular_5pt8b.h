@@ -80,7 +80,7 @@ const uint8_t Roboto_Regular_5pt8bBitmaps[] PROGMEM = {
   0x22, 0x00, 0x88, 0x8F, 0x99, 0x9F, 0x88, 0xD0, 0x22, 0xA5, 0x30, 0x84,
   0x40 };
 
-const GFXglyph Roboto_Regular_5pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph Roboto_Regular_5pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   2,    0,    0 },   // 0x20 ' '
   {     1,   1,   7,   3,    1,   -6 },   // 0x21 '!'
   {     2,   2,   3,   3,    1,   -7 },   // 0x22 '"'
@@ -306,7 +306,7 @@ const GFXglyph Roboto_Regular_5pt8bGlyphs[] PROGMEM = {
   {   938,   4,  10,   6,    1,   -7 },   // 0xFE ''
   {   943,   5,   9,   5,    0,   -6 } }; // 0xFF ''
 
-const GFXfont Roboto_Regular_5pt8b PROGMEM = {
+constexpr GFXfont Roboto_Regular_5pt8b PROGMEM = {
   (uint8_t  *)Roboto_Regular_5pt8bBitmaps,
   (GFXglyph *)Roboto_Regular_5pt8bGlyphs,
   0x20, 0xFF, 11 };
@@ -115,7 +115,7 @@ const uint8_t Roboto_Regular_6pt8bBitmaps[] PROGMEM = {
   0x18, 0xC6, 0x31, 0xF4, 0x20, 0x28, 0x0C, 0xD2, 0x48, 0xC3, 0x0C, 0x20,
   0x86, 0x00 };
 
-const GFXglyph Roboto_Regular_6pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph Roboto_Regular_6pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   3,    0,    0 },   // 0x20 ' '
   {     1,   1,   9,   3,    1,   -8 },   // 0x21 '!'
   {     3,   2,   3,   4,    1,   -8 },   // 0x22 '"'
@@ -341,7 +341,7 @@ const GFXglyph Roboto_Regular_6pt8bGlyphs[] PROGMEM = {
   {  1354,   5,  11,   7,    1,   -8 },   // 0xFE ''
   {  1361,   6,  11,   6,    0,   -8 } }; // 0xFF ''
 
-const GFXfont Roboto_Regular_6pt8b PROGMEM = {
+constexpr GFXfont Roboto_Regular_6pt8b PROGMEM = {
   (uint8_t  *)Roboto_Regular_6pt8bBitmaps,
   (GFXglyph *)Roboto_Regular_6pt8bGlyphs,
   0x20, 0xFF, 14 };
@@ -140,7 +140,7 @@ const uint8_t Roboto_Regular_7pt8bBitmaps[] PROGMEM = {
   0x18, 0x61, 0x87, 0x3B, 0xA0, 0x82, 0x00, 0x24, 0x03, 0x1A, 0x26, 0x45,
   0x0A, 0x14, 0x18, 0x20, 0x41, 0x06, 0x00 };
 
-const GFXglyph Roboto_Regular_7pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph Roboto_Regular_7pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   3,    0,    0 },   // 0x20 ' '
   {     1,   2,  10,   4,    1,   -9 },   // 0x21 '!'
   {     4,   3,   4,   4,    1,  -10 },   // 0x22 '"'
@@ -366,7 +366,7 @@ const GFXglyph Roboto_Regular_7pt8bGlyphs[] PROGMEM = {
   {  1652,   6,  14,   8,    1,  -10 },   // 0xFE ''
   {  1663,   7,  13,   7,    0,   -9 } }; // 0xFF ''
 
-const GFXfont Roboto_Regular_7pt8b PROGMEM = {
+constexpr GFXfont Roboto_Regular_7pt8b PROGMEM = {
   (uint8_t  *)Roboto_Regular_7pt8bBitmaps,
   (GFXglyph *)Roboto_Regular_7pt8bGlyphs,
   0x20, 0xFF, 16 };
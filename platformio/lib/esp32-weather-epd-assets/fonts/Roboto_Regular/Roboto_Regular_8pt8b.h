@@ -188,7 +188,7 @@ const uint8_t Roboto_Regular_8pt8bBitmaps[] PROGMEM = {
   0x26, 0x36, 0x00, 0xC3, 0x42, 0x66, 0x24, 0x24, 0x3C, 0x18, 0x18, 0x18,
   0x10, 0x10, 0x60 };
 
-const GFXglyph Roboto_Regular_8pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph Roboto_Regular_8pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   4,    0,    0 },   // 0x20 ' '
   {     1,   2,  12,   4,    1,  -11 },   // 0x21 '!'
   {     4,   3,   4,   5,    1,  -11 },   // 0x22 '"'
@@ -414,7 +414,7 @@ const GFXglyph Roboto_Regular_8pt8bGlyphs[] PROGMEM = {
   {  2218,   7,  15,   9,    1,  -11 },   // 0xFE ''
   {  2232,   8,  15,   8,    0,  -11 } }; // 0xFF ''
 
-const GFXfont Roboto_Regular_8pt8b PROGMEM = {
+constexpr GFXfont Roboto_Regular_8pt8b PROGMEM = {
   (uint8_t  *)Roboto_Regular_8pt8bBitmaps,
   (GFXglyph *)Roboto_Regular_8pt8bGlyphs,
   0x20, 0xFF, 18 };
@@ -223,7 +223,7 @@ const uint8_t UbuntuMono_R_10pt8bBitmaps[] PROGMEM = {
   0x36, 0x00, 0x00, 0xC3, 0xC3, 0x67, 0x66, 0x66, 0x36, 0x36, 0x3E, 0x1C,
   0x1C, 0xF8, 0xF0 };
 
-const GFXglyph UbuntuMono_R_10pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph UbuntuMono_R_10pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,  10,    0,    0 },   // 0x20 ' '
   {     1,   3,  12,  10,    4,  -11 },   // 0x21 '!'
   {     6,   6,   5,  10,    3,  -13 },   // 0x22 '"'
@@ -449,7 +449,7 @@ const GFXglyph UbuntuMono_R_10pt8bGlyphs[] PROGMEM = {
   {  2634,   8,  17,  10,    1,  -13 },   // 0xFE ''
   {  2651,   8,  16,  10,    1,  -12 } }; // 0xFF ''
 
-const GFXfont UbuntuMono_R_10pt8b PROGMEM = {
+constexpr GFXfont UbuntuMono_R_10pt8b PROGMEM = {
   (uint8_t  *)UbuntuMono_R_10pt8bBitmaps,
   (GFXglyph *)UbuntuMono_R_10pt8bGlyphs,
   0x20, 0xFF, 20 };
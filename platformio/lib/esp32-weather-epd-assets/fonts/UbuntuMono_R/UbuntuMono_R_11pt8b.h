@@ -280,7 +280,7 @@ const uint8_t UbuntuMono_R_11pt8bBitmaps[] PROGMEM = {
   0x00, 0x0C, 0x1E, 0x0D, 0x8E, 0xC6, 0x63, 0x19, 0x8C, 0xC7, 0xC1, 0xE0,
   0xF0, 0x38, 0x38, 0xF8, 0x78, 0x00 };
 
-const GFXglyph UbuntuMono_R_11pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph UbuntuMono_R_11pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,  11,    0,    0 },   // 0x20 ' '
   {     1,   3,  14,  11,    4,  -13 },   // 0x21 '!'
   {     7,   6,   5,  11,    3,  -14 },   // 0x22 '"'
@@ -506,7 +506,7 @@ const GFXglyph UbuntuMono_R_11pt8bGlyphs[] PROGMEM = {
   {  3314,   8,  19,  11,    2,  -14 },   // 0xFE ''
   {  3333,   9,  18,  11,    1,  -13 } }; // 0xFF ''
 
-const GFXfont UbuntuMono_R_11pt8b PROGMEM = {
+constexpr GFXfont UbuntuMono_R_11pt8b PROGMEM = {
   (uint8_t  *)UbuntuMono_R_11pt8bBitmaps,
   (GFXglyph *)UbuntuMono_R_11pt8bGlyphs,
   0x20, 0xFF, 22 };
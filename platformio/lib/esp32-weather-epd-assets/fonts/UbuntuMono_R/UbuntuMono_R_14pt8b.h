@@ -438,7 +438,7 @@ const uint8_t UbuntuMono_R_14pt8bBitmaps[] PROGMEM = {
   0x06, 0x60, 0x63, 0x06, 0x30, 0xC3, 0x8C, 0x18, 0xC1, 0xD8, 0x0D, 0x80,
   0xF8, 0x07, 0x00, 0x70, 0x06, 0x00, 0xE0, 0xFC, 0x0F, 0x80 };
 
-const GFXglyph UbuntuMono_R_14pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph UbuntuMono_R_14pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,  14,    0,    0 },   // 0x20 ' '
   {     1,   4,  17,  14,    5,  -16 },   // 0x21 '!'
   {    10,   6,   7,  14,    3,  -17 },   // 0x22 '"'
@@ -664,7 +664,7 @@ const GFXglyph UbuntuMono_R_14pt8bGlyphs[] PROGMEM = {
   {  5189,  11,  23,  14,    2,  -18 },   // 0xFE ''
   {  5221,  12,  22,  14,    1,  -17 } }; // 0xFF ''
 
-const GFXfont UbuntuMono_R_14pt8b PROGMEM = {
+constexpr GFXfont UbuntuMono_R_14pt8b PROGMEM = {
   (uint8_t  *)UbuntuMono_R_14pt8bBitmaps,
   (GFXglyph *)UbuntuMono_R_14pt8bGlyphs,
   0x20, 0xFF, 27 };
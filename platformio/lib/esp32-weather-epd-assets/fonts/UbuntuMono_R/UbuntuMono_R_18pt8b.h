@@ -709,7 +709,7 @@ const uint8_t UbuntuMono_R_18pt8bBitmaps[] PROGMEM = {
   0x7E, 0x00, 0xFC, 0x00, 0xF0, 0x01, 0xE0, 0x03, 0xC0, 0x1F, 0x03, 0xFC,
   0x07, 0xF0, 0x0F, 0xC0, 0x00 };
 
-const GFXglyph UbuntuMono_R_18pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph UbuntuMono_R_18pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,  18,    0,    0 },   // 0x20 ' '
   {     1,   5,  22,  18,    7,  -21 },   // 0x21 '!'
   {    15,   9,   9,  18,    5,  -23 },   // 0x22 '"'
@@ -935,7 +935,7 @@ const GFXglyph UbuntuMono_R_18pt8bGlyphs[] PROGMEM = {
   {  8389,  15,  30,  18,    2,  -23 },   // 0xFE ''
   {  8446,  15,  29,  18,    2,  -22 } }; // 0xFF ''
 
-const GFXfont UbuntuMono_R_18pt8b PROGMEM = {
+constexpr GFXfont UbuntuMono_R_18pt8b PROGMEM = {
   (uint8_t  *)UbuntuMono_R_18pt8bBitmaps,
   (GFXglyph *)UbuntuMono_R_18pt8bGlyphs,
   0x20, 0xFF, 35 };
@@ -858,7 +858,7 @@ const uint8_t UbuntuMono_R_20pt8bBitmaps[] PROGMEM = {
   0x07, 0x70, 0x07, 0xF0, 0x03, 0xE0, 0x03, 0xE0, 0x01, 0xE0, 0x03, 0xC0,
   0x03, 0xC0, 0x07, 0x80, 0xFF, 0x00, 0xFE, 0x00, 0xFC, 0x00 };
 
-const GFXglyph UbuntuMono_R_20pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph UbuntuMono_R_20pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,  20,    0,    0 },   // 0x20 ' '
   {     1,   5,  24,  20,    7,  -23 },   // 0x21 '!'
   {    16,   9,  10,  20,    5,  -25 },   // 0x22 '"'
@@ -1084,7 +1084,7 @@ const GFXglyph UbuntuMono_R_20pt8bGlyphs[] PROGMEM = {
   { 10170,  15,  33,  20,    3,  -26 },   // 0xFE ''
   { 10232,  16,  31,  20,    2,  -24 } }; // 0xFF ''
 
-const GFXfont UbuntuMono_R_20pt8b PROGMEM = {
+constexpr GFXfont UbuntuMono_R_20pt8b PROGMEM = {
   (uint8_t  *)UbuntuMono_R_20pt8bBitmaps,
   (GFXglyph *)UbuntuMono_R_20pt8bGlyphs,
   0x20, 0xFF, 39 };
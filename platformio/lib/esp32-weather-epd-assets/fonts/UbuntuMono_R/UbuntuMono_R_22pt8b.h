@@ -1071,7 +1071,7 @@ const uint8_t UbuntuMono_R_22pt8bBitmaps[] PROGMEM = {
   0x00, 0xFE, 0x00, 0x1F, 0xC0, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x1F, 0x80,
   0x07, 0xF0, 0x1F, 0xFC, 0x03, 0xFE, 0x00, 0x7F, 0x00, 0x00 };
 
-const GFXglyph UbuntuMono_R_22pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph UbuntuMono_R_22pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,  22,    0,    0 },   // 0x20 ' '
   {     1,   6,  27,  22,    8,  -26 },   // 0x21 '!'
   {    22,  10,  11,  22,    6,  -28 },   // 0x22 '"'
@@ -1297,7 +1297,7 @@ const GFXglyph UbuntuMono_R_22pt8bGlyphs[] PROGMEM = {
   { 12685,  17,  37,  22,    3,  -29 },   // 0xFE ''
   { 12764,  19,  36,  22,    1,  -28 } }; // 0xFF ''
 
-const GFXfont UbuntuMono_R_22pt8b PROGMEM = {
+constexpr GFXfont UbuntuMono_R_22pt8b PROGMEM = {
   (uint8_t  *)UbuntuMono_R_22pt8bBitmaps,
   (GFXglyph *)UbuntuMono_R_22pt8bGlyphs,
   0x20, 0xFF, 43 };
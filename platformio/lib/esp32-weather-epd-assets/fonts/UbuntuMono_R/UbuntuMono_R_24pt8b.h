@@ -1281,7 +1281,7 @@ const uint8_t UbuntuMono_R_24pt8bBitmaps[] PROGMEM = {
   0xF8, 0x00, 0x0F, 0xC0, 0x00, 0x7C, 0x00, 0x07, 0xE0, 0x00, 0x7E, 0x00,
   0x07, 0xE0, 0x0F, 0xFE, 0x00, 0x7F, 0xE0, 0x03, 0xFC, 0x00, 0x00 };
 
-const GFXglyph UbuntuMono_R_24pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph UbuntuMono_R_24pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,  24,    0,    0 },   // 0x20 ' '
   {     1,   6,  29,  24,    9,  -28 },   // 0x21 '!'
   {    23,  12,  12,  24,    6,  -31 },   // 0x22 '"'
@@ -1507,7 +1507,7 @@ const GFXglyph UbuntuMono_R_24pt8bGlyphs[] PROGMEM = {
   { 15170,  19,  41,  24,    3,  -32 },   // 0xFE ''
   { 15268,  21,  39,  24,    1,  -30 } }; // 0xFF ''
 
-const GFXfont UbuntuMono_R_24pt8b PROGMEM = {
+constexpr GFXfont UbuntuMono_R_24pt8b PROGMEM = {
   (uint8_t  *)UbuntuMono_R_24pt8bBitmaps,
   (GFXglyph *)UbuntuMono_R_24pt8bGlyphs,
   0x20, 0xFF, 47 };
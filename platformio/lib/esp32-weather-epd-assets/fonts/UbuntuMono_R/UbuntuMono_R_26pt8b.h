@@ -1480,7 +1480,7 @@ const uint8_t UbuntuMono_R_26pt8bBitmaps[] PROGMEM = {
   0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x1F, 0x80, 0x0F, 0xFE, 0x00,
   0x3F, 0xF8, 0x00, 0x7F, 0xE0, 0x00, 0x7F, 0x00, 0x00 };
 
-const GFXglyph UbuntuMono_R_26pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph UbuntuMono_R_26pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,  26,    0,    0 },   // 0x20 ' '
   {     1,   7,  32,  26,    9,  -31 },   // 0x21 '!'
   {    29,  12,  13,  26,    7,  -34 },   // 0x22 '"'
@@ -1706,7 +1706,7 @@ const GFXglyph UbuntuMono_R_26pt8bGlyphs[] PROGMEM = {
   { 17531,  20,  43,  26,    4,  -34 },   // 0xFE ''
   { 17639,  23,  41,  26,    1,  -32 } }; // 0xFF ''
 
-const GFXfont UbuntuMono_R_26pt8b PROGMEM = {
+constexpr GFXfont UbuntuMono_R_26pt8b PROGMEM = {
   (uint8_t  *)UbuntuMono_R_26pt8bBitmaps,
   (GFXglyph *)UbuntuMono_R_26pt8bGlyphs,
   0x20, 0xFF, 51 };
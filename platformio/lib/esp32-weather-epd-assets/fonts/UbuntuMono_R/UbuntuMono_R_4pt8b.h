@@ -45,7 +45,7 @@ const uint8_t UbuntuMono_R_4pt8bBitmaps[] PROGMEM = {
   0xE0, 0x88, 0x5B, 0x58, 0x28, 0x5B, 0x58, 0x40, 0x5B, 0x58, 0xA2, 0xDA,
   0xC0, 0x28, 0x5B, 0x56, 0x93, 0x5B, 0xA0, 0xA2, 0xDA, 0xB0 };
 
-const GFXglyph UbuntuMono_R_4pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph UbuntuMono_R_4pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   4,    0,    0 },   // 0x20 ' '
   {     1,   1,   5,   4,    1,   -4 },   // 0x21 '!'
   {     2,   3,   2,   4,    1,   -4 },   // 0x22 '"'
@@ -271,7 +271,7 @@ const GFXglyph UbuntuMono_R_4pt8bGlyphs[] PROGMEM = {
   {   532,   3,   7,   4,    0,   -5 },   // 0xFE ''
   {   535,   3,   7,   4,    0,   -5 } }; // 0xFF ''
 
-const GFXfont UbuntuMono_R_4pt8b PROGMEM = {
+constexpr GFXfont UbuntuMono_R_4pt8b PROGMEM = {
   (uint8_t  *)UbuntuMono_R_4pt8bBitmaps,
   (GFXglyph *)UbuntuMono_R_4pt8bGlyphs,
   0x20, 0xFF, 8 };
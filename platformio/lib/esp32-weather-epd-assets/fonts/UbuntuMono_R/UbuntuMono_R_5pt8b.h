@@ -58,7 +58,7 @@ const uint8_t UbuntuMono_R_5pt8bBitmaps[] PROGMEM = {
   0x01, 0x18, 0xA9, 0x44, 0x26, 0x00, 0x93, 0x5B, 0x74, 0x80, 0x50, 0x23,
   0x15, 0x28, 0x84, 0xC0 };
 
-const GFXglyph UbuntuMono_R_5pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph UbuntuMono_R_5pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   5,    0,    0 },   // 0x20 ' '
   {     1,   1,   6,   5,    2,   -5 },   // 0x21 '!'
   {     2,   3,   2,   5,    1,   -6 },   // 0x22 '"'
@@ -284,7 +284,7 @@ const GFXglyph UbuntuMono_R_5pt8bGlyphs[] PROGMEM = {
   {   678,   3,   9,   5,    1,   -6 },   // 0xFE ''
   {   682,   5,   9,   5,    0,   -6 } }; // 0xFF ''
 
-const GFXfont UbuntuMono_R_5pt8b PROGMEM = {
+constexpr GFXfont UbuntuMono_R_5pt8b PROGMEM = {
   (uint8_t  *)UbuntuMono_R_5pt8bBitmaps,
   (GFXglyph *)UbuntuMono_R_5pt8bGlyphs,
   0x20, 0xFF, 10 };
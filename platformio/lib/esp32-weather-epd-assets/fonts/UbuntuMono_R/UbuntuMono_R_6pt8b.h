@@ -79,7 +79,7 @@ const uint8_t UbuntuMono_R_6pt8bBitmaps[] PROGMEM = {
   0x97, 0x24, 0x09, 0x99, 0x56, 0x22, 0xC0, 0x88, 0xE9, 0x99, 0x9E, 0x88,
   0x50, 0x99, 0x95, 0x62, 0x2C };
 
-const GFXglyph UbuntuMono_R_6pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph UbuntuMono_R_6pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   6,    0,    0 },   // 0x20 ' '
   {     1,   1,   7,   6,    2,   -6 },   // 0x21 '!'
   {     2,   3,   3,   6,    2,   -7 },   // 0x22 '"'
@@ -305,7 +305,7 @@ const GFXglyph UbuntuMono_R_6pt8bGlyphs[] PROGMEM = {
   {   931,   4,  10,   6,    1,   -7 },   // 0xFE ''
   {   936,   4,  10,   6,    1,   -7 } }; // 0xFF ''
 
-const GFXfont UbuntuMono_R_6pt8b PROGMEM = {
+constexpr GFXfont UbuntuMono_R_6pt8b PROGMEM = {
   (uint8_t  *)UbuntuMono_R_6pt8bBitmaps,
   (GFXglyph *)UbuntuMono_R_6pt8bGlyphs,
   0x20, 0xFF, 12 };
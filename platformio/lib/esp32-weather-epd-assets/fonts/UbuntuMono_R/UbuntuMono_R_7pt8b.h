@@ -113,7 +113,7 @@ const uint8_t UbuntuMono_R_7pt8bBitmaps[] PROGMEM = {
   0xA9, 0x4A, 0x51, 0x09, 0x80, 0x84, 0x21, 0xE8, 0xC6, 0x31, 0x8F, 0xA1,
   0x00, 0x50, 0x23, 0x15, 0x29, 0x4A, 0x21, 0x30 };
 
-const GFXglyph UbuntuMono_R_7pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph UbuntuMono_R_7pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   7,    0,    0 },   // 0x20 ' '
   {     1,   1,   9,   7,    3,   -8 },   // 0x21 '!'
   {     3,   3,   3,   7,    2,   -9 },   // 0x22 '"'
@@ -339,7 +339,7 @@ const GFXglyph UbuntuMono_R_7pt8bGlyphs[] PROGMEM = {
   {  1337,   5,  12,   7,    1,   -9 },   // 0xFE ''
   {  1345,   5,  11,   7,    1,   -8 } }; // 0xFF ''
 
-const GFXfont UbuntuMono_R_7pt8b PROGMEM = {
+constexpr GFXfont UbuntuMono_R_7pt8b PROGMEM = {
   (uint8_t  *)UbuntuMono_R_7pt8bBitmaps,
   (GFXglyph *)UbuntuMono_R_7pt8bGlyphs,
   0x20, 0xFF, 14 };
@@ -145,7 +145,7 @@ const uint8_t UbuntuMono_R_8pt8bBitmaps[] PROGMEM = {
   0x1F, 0xA0, 0x82, 0x00, 0x28, 0xA0, 0x00, 0x86, 0x14, 0x92, 0x28, 0xC1,
   0x04, 0x23, 0x00 };
 
-const GFXglyph UbuntuMono_R_8pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph UbuntuMono_R_8pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   8,    0,    0 },   // 0x20 ' '
   {     1,   1,  10,   8,    3,   -9 },   // 0x21 '!'
   {     3,   3,   4,   8,    2,  -10 },   // 0x22 '"'
@@ -371,7 +371,7 @@ const GFXglyph UbuntuMono_R_8pt8bGlyphs[] PROGMEM = {
   {  1709,   6,  14,   8,    1,  -10 },   // 0xFE ''
   {  1720,   6,  14,   8,    1,  -10 } }; // 0xFF ''
 
-const GFXfont UbuntuMono_R_8pt8b PROGMEM = {
+constexpr GFXfont UbuntuMono_R_8pt8b PROGMEM = {
   (uint8_t  *)UbuntuMono_R_8pt8bBitmaps,
   (GFXglyph *)UbuntuMono_R_8pt8bGlyphs,
   0x20, 0xFF, 16 };
@@ -182,7 +182,7 @@ const uint8_t UbuntuMono_R_9pt8bBitmaps[] PROGMEM = {
   0x00, 0x28, 0x50, 0x00, 0x08, 0x28, 0x51, 0x22, 0x24, 0x48, 0x60, 0x41,
   0x02, 0x38, 0x00 };
 
-const GFXglyph UbuntuMono_R_9pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph UbuntuMono_R_9pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   9,    0,    0 },   // 0x20 ' '
   {     1,   1,  11,   9,    3,  -10 },   // 0x21 '!'
   {     3,   4,   4,   9,    2,  -11 },   // 0x22 '"'
@@ -408,7 +408,7 @@ const GFXglyph UbuntuMono_R_9pt8bGlyphs[] PROGMEM = {
   {  2147,   7,  15,   9,    1,  -11 },   // 0xFE ''
   {  2161,   7,  15,   9,    1,  -11 } }; // 0xFF ''
 
-const GFXfont UbuntuMono_R_9pt8b PROGMEM = {
+constexpr GFXfont UbuntuMono_R_9pt8b PROGMEM = {
   (uint8_t  *)UbuntuMono_R_9pt8bBitmaps,
   (GFXglyph *)UbuntuMono_R_9pt8bGlyphs,
   0x20, 0xFF, 18 };
@@ -290,7 +290,7 @@ const uint8_t Ubuntu_R_10pt8bBitmaps[] PROGMEM = {
   0x19, 0x8C, 0xC6, 0x36, 0x1B, 0x0D, 0x86, 0x81, 0xC0, 0xE0, 0x60, 0x30,
   0xF8, 0x70, 0x00 };
 
-const GFXglyph Ubuntu_R_10pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph Ubuntu_R_10pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   5,    0,    0 },   // 0x20 ' '
   {     1,   2,  14,   6,    2,  -13 },   // 0x21 '!'
   {     5,   6,   5,   8,    2,  -15 },   // 0x22 '"'
@@ -516,7 +516,7 @@ const GFXglyph Ubuntu_R_10pt8bGlyphs[] PROGMEM = {
   {  3428,   9,  19,  12,    2,  -14 },   // 0xFE ''
   {  3450,   9,  18,   9,    0,  -13 } }; // 0xFF ''
 
-const GFXfont Ubuntu_R_10pt8b PROGMEM = {
+constexpr GFXfont Ubuntu_R_10pt8b PROGMEM = {
   (uint8_t  *)Ubuntu_R_10pt8bBitmaps,
   (GFXglyph *)Ubuntu_R_10pt8bGlyphs,
   0x20, 0xFF, 23 };
@@ -355,7 +355,7 @@ const uint8_t Ubuntu_R_11pt8bBitmaps[] PROGMEM = {
   0x86, 0x61, 0x8C, 0x63, 0x30, 0xCC, 0x1B, 0x06, 0xC1, 0xE0, 0x38, 0x0E,
   0x03, 0x00, 0xC3, 0xE0, 0xF0, 0x00 };
 
-const GFXglyph Ubuntu_R_11pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph Ubuntu_R_11pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   5,    0,    0 },   // 0x20 ' '
   {     1,   2,  15,   6,    2,  -14 },   // 0x21 '!'
   {     5,   6,   6,   9,    2,  -16 },   // 0x22 '"'
@@ -581,7 +581,7 @@ const GFXglyph Ubuntu_R_11pt8bGlyphs[] PROGMEM = {
   {  4200,  10,  21,  13,    2,  -16 },   // 0xFE ''
   {  4227,  10,  21,  10,    0,  -16 } }; // 0xFF ''
 
-const GFXfont Ubuntu_R_11pt8b PROGMEM = {
+constexpr GFXfont Ubuntu_R_11pt8b PROGMEM = {
   (uint8_t  *)Ubuntu_R_11pt8bBitmaps,
   (GFXglyph *)Ubuntu_R_11pt8bGlyphs,
   0x20, 0xFF, 25 };
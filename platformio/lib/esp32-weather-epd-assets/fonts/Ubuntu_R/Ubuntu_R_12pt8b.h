@@ -431,7 +431,7 @@ const uint8_t Ubuntu_R_12pt8bBitmaps[] PROGMEM = {
   0xC6, 0x18, 0xC3, 0xB0, 0x36, 0x06, 0xC0, 0xF0, 0x0E, 0x01, 0xC0, 0x30,
   0x0E, 0x0F, 0x81, 0xE0, 0x00 };
 
-const GFXglyph Ubuntu_R_12pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph Ubuntu_R_12pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   6,    0,    0 },   // 0x20 ' '
   {     1,   2,  17,   7,    2,  -16 },   // 0x21 '!'
   {     6,   6,   6,  10,    2,  -18 },   // 0x22 '"'
@@ -657,7 +657,7 @@ const GFXglyph Ubuntu_R_12pt8bGlyphs[] PROGMEM = {
   {  5103,  11,  22,  14,    2,  -17 },   // 0xFE ''
   {  5134,  11,  22,  11,    0,  -17 } }; // 0xFF ''
 
-const GFXfont Ubuntu_R_12pt8b PROGMEM = {
+constexpr GFXfont Ubuntu_R_12pt8b PROGMEM = {
   (uint8_t  *)Ubuntu_R_12pt8bBitmaps,
   (GFXglyph *)Ubuntu_R_12pt8bGlyphs,
   0x20, 0xFF, 27 };
@@ -687,7 +687,7 @@ const uint8_t Ubuntu_R_16pt8bBitmaps[] PROGMEM = {
   0x00, 0x78, 0x00, 0xE0, 0x07, 0x80, 0x1C, 0x00, 0xF0, 0x3F, 0x80, 0xF8,
   0x00 };
 
-const GFXglyph Ubuntu_R_16pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph Ubuntu_R_16pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   7,    0,    0 },   // 0x20 ' '
   {     1,   5,  21,   9,    2,  -20 },   // 0x21 '!'
   {    15,   8,   8,  13,    2,  -23 },   // 0x22 '"'
@@ -913,7 +913,7 @@ const GFXglyph Ubuntu_R_16pt8bGlyphs[] PROGMEM = {
   {  8125,  15,  30,  18,    2,  -23 },   // 0xFE ''
   {  8182,  14,  29,  16,    1,  -22 } }; // 0xFF ''
 
-const GFXfont Ubuntu_R_16pt8b PROGMEM = {
+constexpr GFXfont Ubuntu_R_16pt8b PROGMEM = {
   (uint8_t  *)Ubuntu_R_16pt8bBitmaps,
   (GFXglyph *)Ubuntu_R_16pt8bGlyphs,
   0x20, 0xFF, 36 };
@@ -867,7 +867,7 @@ const uint8_t Ubuntu_R_18pt8bBitmaps[] PROGMEM = {
   0x07, 0x60, 0x07, 0xE0, 0x03, 0xE0, 0x03, 0xC0, 0x01, 0xC0, 0x03, 0xC0,
   0x03, 0x80, 0x07, 0x80, 0xFF, 0x00, 0xFE, 0x00, 0xFC, 0x00 };
 
-const GFXglyph Ubuntu_R_18pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph Ubuntu_R_18pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   8,    0,    0 },   // 0x20 ' '
   {     1,   5,  24,  10,    2,  -23 },   // 0x21 '!'
   {    16,   9,   9,  15,    2,  -26 },   // 0x22 '"'
@@ -1093,7 +1093,7 @@ const GFXglyph Ubuntu_R_18pt8bGlyphs[] PROGMEM = {
   { 10272,  16,  33,  21,    3,  -26 },   // 0xFE ''
   { 10338,  16,  32,  18,    1,  -25 } }; // 0xFF ''
 
-const GFXfont Ubuntu_R_18pt8b PROGMEM = {
+constexpr GFXfont Ubuntu_R_18pt8b PROGMEM = {
   (uint8_t  *)Ubuntu_R_18pt8bBitmaps,
   (GFXglyph *)Ubuntu_R_18pt8bGlyphs,
   0x20, 0xFF, 41 };
@@ -1105,7 +1105,7 @@ const uint8_t Ubuntu_R_20pt8bBitmaps[] PROGMEM = {
   0x00, 0xFC, 0x00, 0x0F, 0x80, 0x01, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x80,
   0x03, 0xE0, 0x1F, 0xF8, 0x03, 0xFE, 0x00, 0x7F, 0x00, 0x00 };
 
-const GFXglyph Ubuntu_R_20pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph Ubuntu_R_20pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   9,    0,    0 },   // 0x20 ' '
   {     1,   6,  27,  11,    3,  -26 },   // 0x21 '!'
   {    22,  11,  10,  16,    3,  -30 },   // 0x22 '"'
@@ -1331,7 +1331,7 @@ const GFXglyph Ubuntu_R_20pt8bGlyphs[] PROGMEM = {
   { 13088,  18,  37,  23,    3,  -29 },   // 0xFE ''
   { 13172,  19,  36,  20,    0,  -28 } }; // 0xFF ''
 
-const GFXfont Ubuntu_R_20pt8b PROGMEM = {
+constexpr GFXfont Ubuntu_R_20pt8b PROGMEM = {
   (uint8_t  *)Ubuntu_R_20pt8bBitmaps,
   (GFXglyph *)Ubuntu_R_20pt8bGlyphs,
   0x20, 0xFF, 45 };
@@ -1316,7 +1316,7 @@ const uint8_t Ubuntu_R_22pt8bBitmaps[] PROGMEM = {
   0x00, 0x78, 0x00, 0x07, 0xC0, 0x00, 0x3C, 0x00, 0x07, 0xE0, 0x0F, 0xFE,
   0x00, 0x7F, 0xC0, 0x01, 0xF8, 0x00, 0x00 };
 
-const GFXglyph Ubuntu_R_22pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph Ubuntu_R_22pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,  10,    0,    0 },   // 0x20 ' '
   {     1,   6,  30,  12,    3,  -29 },   // 0x21 '!'
   {    24,  12,  11,  18,    3,  -33 },   // 0x22 '"'
@@ -1542,7 +1542,7 @@ const GFXglyph Ubuntu_R_22pt8bGlyphs[] PROGMEM = {
   { 15586,  19,  41,  25,    4,  -32 },   // 0xFE ''
   { 15684,  21,  39,  22,    0,  -30 } }; // 0xFF ''
 
-const GFXfont Ubuntu_R_22pt8b PROGMEM = {
+constexpr GFXfont Ubuntu_R_22pt8b PROGMEM = {
   (uint8_t  *)Ubuntu_R_22pt8bBitmaps,
   (GFXglyph *)Ubuntu_R_22pt8bGlyphs,
   0x20, 0xFF, 50 };
@@ -1595,7 +1595,7 @@ const uint8_t Ubuntu_R_24pt8bBitmaps[] PROGMEM = {
   0x00, 0x0F, 0x80, 0x00, 0x1E, 0x00, 0x00, 0xFC, 0x00, 0x7F, 0xF0, 0x01,
   0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x03, 0xF8, 0x00, 0x00 };
 
-const GFXglyph Ubuntu_R_24pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph Ubuntu_R_24pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,  11,    0,    0 },   // 0x20 ' '
   {     1,   6,  33,  13,    3,  -32 },   // 0x21 '!'
   {    26,  12,  12,  20,    3,  -36 },   // 0x22 '"'
@@ -1821,7 +1821,7 @@ const GFXglyph Ubuntu_R_24pt8bGlyphs[] PROGMEM = {
   { 18886,  22,  45,  28,    4,  -35 },   // 0xFE ''
   { 19010,  23,  44,  24,    0,  -34 } }; // 0xFF ''
 
-const GFXfont Ubuntu_R_24pt8b PROGMEM = {
+constexpr GFXfont Ubuntu_R_24pt8b PROGMEM = {
   (uint8_t  *)Ubuntu_R_24pt8bBitmaps,
   (GFXglyph *)Ubuntu_R_24pt8bGlyphs,
   0x20, 0xFF, 54 };
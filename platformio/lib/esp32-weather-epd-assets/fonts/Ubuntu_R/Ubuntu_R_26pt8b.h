@@ -1858,7 +1858,7 @@ const uint8_t Ubuntu_R_26pt8bBitmaps[] PROGMEM = {
   0x00, 0x7E, 0x00, 0x01, 0xFC, 0x00, 0x7F, 0xF8, 0x00, 0xFF, 0xF0, 0x00,
   0xFF, 0xE0, 0x00, 0x7F, 0x00, 0x00 };
 
-const GFXglyph Ubuntu_R_26pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph Ubuntu_R_26pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,  12,    0,    0 },   // 0x20 ' '
   {     1,   7,  35,  14,    3,  -34 },   // 0x21 '!'
   {    32,  14,  13,  21,    4,  -39 },   // 0x22 '"'
@@ -2084,7 +2084,7 @@ const GFXglyph Ubuntu_R_26pt8bGlyphs[] PROGMEM = {
   { 22014,  23,  48,  30,    4,  -38 },   // 0xFE ''
   { 22152,  24,  46,  25,    0,  -36 } }; // 0xFF ''
 
-const GFXfont Ubuntu_R_26pt8b PROGMEM = {
+constexpr GFXfont Ubuntu_R_26pt8b PROGMEM = {
   (uint8_t  *)Ubuntu_R_26pt8bBitmaps,
   (GFXglyph *)Ubuntu_R_26pt8bGlyphs,
   0x20, 0xFF, 59 };
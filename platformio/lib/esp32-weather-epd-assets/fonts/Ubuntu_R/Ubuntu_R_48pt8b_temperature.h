@@ -310,7 +310,7 @@ const uint8_t Ubuntu_R_48pt8b_temperatureBitmaps[] PROGMEM = {
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00 };
 
-const GFXglyph Ubuntu_R_48pt8b_temperatureGlyphs[] PROGMEM = {
+constexpr GFXglyph Ubuntu_R_48pt8b_temperatureGlyphs[] PROGMEM = {
   {     0,   1,   1,  47,    0,    0 },   // 0x20 ' '
   {     1,   1,   1,  47,    0,    0 },   // 0x21 '!'
   {     2,   1,   1,  47,    0,    0 },   // 0x22 '"'
@@ -536,7 +536,7 @@ const GFXglyph Ubuntu_R_48pt8b_temperatureGlyphs[] PROGMEM = {
   {  3708,   1,   1,  47,    0,    0 },   // 0xFE ''
   {  3709,   1,   1,  47,    0,    0 } }; // 0xFF ''
 
-const GFXfont Ubuntu_R_48pt8b_temperature PROGMEM = {
+constexpr GFXfont Ubuntu_R_48pt8b_temperature PROGMEM = {
   (uint8_t  *)Ubuntu_R_48pt8b_temperatureBitmaps,
   (GFXglyph *)Ubuntu_R_48pt8b_temperatureGlyphs,
   0x20, 0xFF, 108 };
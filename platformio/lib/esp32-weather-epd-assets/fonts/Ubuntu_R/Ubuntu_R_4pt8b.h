@@ -56,7 +56,7 @@ const uint8_t Ubuntu_R_4pt8bBitmaps[] PROGMEM = {
   0x25, 0x09, 0x99, 0x70, 0x50, 0x99, 0x97, 0x28, 0x5A, 0x94, 0x88, 0xE9,
   0x9E, 0x80, 0xA2, 0xD4, 0xA0 };
 
-const GFXglyph Ubuntu_R_4pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph Ubuntu_R_4pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   2,    0,    0 },   // 0x20 ' '
   {     1,   1,   6,   2,    1,   -5 },   // 0x21 '!'
   {     2,   2,   2,   3,    1,   -5 },   // 0x22 '"'
@@ -282,7 +282,7 @@ const GFXglyph Ubuntu_R_4pt8bGlyphs[] PROGMEM = {
   {   658,   4,   7,   5,    1,   -5 },   // 0xFE ''
   {   662,   3,   7,   4,    1,   -5 } }; // 0xFF ''
 
-const GFXfont Ubuntu_R_4pt8b PROGMEM = {
+constexpr GFXfont Ubuntu_R_4pt8b PROGMEM = {
   (uint8_t  *)Ubuntu_R_4pt8bBitmaps,
   (GFXglyph *)Ubuntu_R_4pt8bGlyphs,
   0x20, 0xFF, 9 };
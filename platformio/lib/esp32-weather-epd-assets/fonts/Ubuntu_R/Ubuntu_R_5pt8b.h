@@ -76,7 +76,7 @@ const uint8_t Ubuntu_R_5pt8bBitmaps[] PROGMEM = {
   0x11, 0x01, 0x15, 0x29, 0x44, 0x26, 0x00, 0x88, 0x8E, 0x99, 0x9E, 0x88,
   0x50, 0x22, 0xA5, 0x28, 0x84, 0xC0 };
 
-const GFXglyph Ubuntu_R_5pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph Ubuntu_R_5pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   2,    0,    0 },   // 0x20 ' '
   {     1,   1,   7,   3,    1,   -6 },   // 0x21 '!'
   {     2,   3,   3,   4,    1,   -7 },   // 0x22 '"'
@@ -302,7 +302,7 @@ const GFXglyph Ubuntu_R_5pt8bGlyphs[] PROGMEM = {
   {   895,   4,  10,   6,    1,   -7 },   // 0xFE ''
   {   900,   5,   9,   5,    0,   -6 } }; // 0xFF ''
 
-const GFXfont Ubuntu_R_5pt8b PROGMEM = {
+constexpr GFXfont Ubuntu_R_5pt8b PROGMEM = {
   (uint8_t  *)Ubuntu_R_5pt8bBitmaps,
   (GFXglyph *)Ubuntu_R_5pt8bGlyphs,
   0x20, 0xFF, 11 };
@@ -99,7 +99,7 @@ const uint8_t Ubuntu_R_6pt8bBitmaps[] PROGMEM = {
   0x11, 0x01, 0x18, 0xA9, 0x4A, 0x21, 0x30, 0x84, 0x21, 0xE8, 0xC6, 0x31,
   0xF4, 0x20, 0x50, 0x23, 0x15, 0x29, 0x44, 0x26, 0x00 };
 
-const GFXglyph Ubuntu_R_6pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph Ubuntu_R_6pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   3,    0,    0 },   // 0x20 ' '
   {     1,   1,   8,   3,    1,   -7 },   // 0x21 '!'
   {     2,   3,   3,   5,    1,   -8 },   // 0x22 '"'
@@ -325,7 +325,7 @@ const GFXglyph Ubuntu_R_6pt8bGlyphs[] PROGMEM = {
   {  1171,   5,  11,   7,    1,   -8 },   // 0xFE ''
   {  1178,   5,  10,   5,    0,   -7 } }; // 0xFF ''
 
-const GFXfont Ubuntu_R_6pt8b PROGMEM = {
+constexpr GFXfont Ubuntu_R_6pt8b PROGMEM = {
   (uint8_t  *)Ubuntu_R_6pt8bBitmaps,
   (GFXglyph *)Ubuntu_R_6pt8bGlyphs,
   0x20, 0xFF, 14 };
@@ -148,7 +148,7 @@ const uint8_t Ubuntu_R_7pt8bBitmaps[] PROGMEM = {
   0x86, 0x1F, 0xA0, 0x82, 0x00, 0x28, 0x50, 0x00, 0x08, 0x28, 0x91, 0x22,
   0x28, 0x50, 0x40, 0x82, 0x18, 0x00 };
 
-const GFXglyph Ubuntu_R_7pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph Ubuntu_R_7pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   3,    0,    0 },   // 0x20 ' '
   {     1,   1,  10,   4,    1,   -9 },   // 0x21 '!'
   {     3,   3,   4,   6,    1,  -10 },   // 0x22 '"'
@@ -374,7 +374,7 @@ const GFXglyph Ubuntu_R_7pt8bGlyphs[] PROGMEM = {
   {  1746,   6,  14,   8,    1,  -10 },   // 0xFE ''
   {  1757,   7,  14,   7,    0,  -10 } }; // 0xFF ''
 
-const GFXfont Ubuntu_R_7pt8b PROGMEM = {
+constexpr GFXfont Ubuntu_R_7pt8b PROGMEM = {
   (uint8_t  *)Ubuntu_R_7pt8bBitmaps,
   (GFXglyph *)Ubuntu_R_7pt8bGlyphs,
   0x20, 0xFF, 16 };
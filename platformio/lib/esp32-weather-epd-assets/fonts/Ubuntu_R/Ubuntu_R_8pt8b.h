@@ -183,7 +183,7 @@ const uint8_t Ubuntu_R_8pt8bBitmaps[] PROGMEM = {
   0x00, 0x28, 0x50, 0x00, 0x08, 0x28, 0x91, 0x22, 0x28, 0x50, 0x40, 0x81,
   0x04, 0x30, 0x00 };
 
-const GFXglyph Ubuntu_R_8pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph Ubuntu_R_8pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   4,    0,    0 },   // 0x20 ' '
   {     1,   1,  11,   4,    1,  -10 },   // 0x21 '!'
   {     3,   4,   4,   7,    1,  -12 },   // 0x22 '"'
@@ -409,7 +409,7 @@ const GFXglyph Ubuntu_R_8pt8bGlyphs[] PROGMEM = {
   {  2159,   7,  15,   9,    1,  -11 },   // 0xFE ''
   {  2173,   7,  15,   7,    0,  -11 } }; // 0xFF ''
 
-const GFXfont Ubuntu_R_8pt8b PROGMEM = {
+constexpr GFXfont Ubuntu_R_8pt8b PROGMEM = {
   (uint8_t  *)Ubuntu_R_8pt8bBitmaps,
   (GFXglyph *)Ubuntu_R_8pt8bGlyphs,
   0x20, 0xFF, 18 };
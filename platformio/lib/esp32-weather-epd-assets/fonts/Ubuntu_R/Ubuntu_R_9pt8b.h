@@ -225,7 +225,7 @@ const uint8_t Ubuntu_R_9pt8bBitmaps[] PROGMEM = {
   0x01, 0x00, 0x80, 0x00, 0x14, 0x0A, 0x00, 0x00, 0x08, 0x0A, 0x09, 0x04,
   0x44, 0x22, 0x0A, 0x05, 0x01, 0x00, 0x80, 0x40, 0x41, 0xC0 };
 
-const GFXglyph Ubuntu_R_9pt8bGlyphs[] PROGMEM = {
+constexpr GFXglyph Ubuntu_R_9pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,   4,    0,    0 },   // 0x20 ' '
   {     1,   1,  12,   5,    2,  -11 },   // 0x21 '!'
   {     3,   4,   5,   8,    1,  -13 },   // 0x22 '"'
@@ -451,7 +451,7 @@ const GFXglyph Ubuntu_R_9pt8bGlyphs[] PROGMEM = {
   {  2660,   9,  17,  11,    1,  -13 },   // 0xFE ''
   {  2680,   9,  16,   9,    0,  -12 } }; // 0xFF ''
 
-const GFXfont Ubuntu_R_9pt8b PROGMEM = {
+constexpr GFXfont Ubuntu_R_9pt8b PROGMEM = {
   (uint8_t  *)Ubuntu_R_9pt8bBitmaps,
   (GFXglyph *)Ubuntu_R_9pt8bGlyphs,
   0x20, 0xFF, 20 };
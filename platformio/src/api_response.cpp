@@ -19,6 +19,118 @@
 #include <ArduinoJson.h>
 #include "api_response.h"
 #include "config.h"
+#include "logger.h"
+
+/*
+ * fillCurrent, fillHourly, fillDaily, fillAlert
+ *
+ * Copy one parsed section of the One Call response.
+ */
+static void fillCurrent(JsonObject current, owm_current_t &r)
+{
+  r.dt         = current["dt"]        .as<int64_t>();
+  r.sunrise    = current["sunrise"]   .as<int64_t>();
+  r.sunset     = current["sunset"]    .as<int64_t>();
+  r.temp       = current["temp"]      .as<float>();
+  r.feels_like = current["feels_like"].as<float>();
+  r.pressure   = current["pressure"]  .as<int>();
+  r.humidity   = current["humidity"]  .as<int>();
+  r.dew_point  = current["dew_point"] .as<float>();
+  r.clouds     = current["clouds"]    .as<int>();
+  r.uvi        = current["uvi"]       .as<float>();
+  r.visibility = current["visibility"].as<int>();
+  r.wind_speed = current["wind_speed"].as<float>();
+  r.wind_gust  = current["wind_gust"] .as<float>();
+  r.wind_deg   = current["wind_deg"]  .as<int>();
+  r.rain_1h    = current["rain"]["1h"].as<float>();
+  r.snow_1h    = current["snow"]["1h"].as<float>();
+  JsonObject current_weather = current["weather"][0];
+  r.weather.id          = current_weather["id"]         .as<int>();
+  r.weather.main        = current_weather["main"]       .as<const char *>();
+  r.weather.description = current_weather["description"].as<const char *>();
+  r.weather.icon        = current_weather["icon"]       .as<const char *>();
+  return;
+} // end fillCurrent
+
+static void fillHourly(JsonObject hourly, owm_hourly_t &r)
+{
+  r.dt         = hourly["dt"]        .as<int64_t>();
+  r.temp       = hourly["temp"]      .as<float>();
+  r.feels_like = hourly["feels_like"].as<float>();
+  r.pressure   = hourly["pressure"]  .as<int>();
+  r.humidity   = hourly["humidity"]  .as<int>();
+  r.dew_point  = hourly["dew_point"] .as<float>();
+  r.clouds     = hourly["clouds"]    .as<int>();
+  r.uvi        = hourly["uvi"]       .as<float>();
+  r.visibility = hourly["visibility"].as<int>();
+  r.wind_speed = hourly["wind_speed"].as<float>();
+  r.wind_gust  = hourly["wind_gust"] .as<float>();
+  r.wind_deg   = hourly["wind_deg"]  .as<int>();
+  r.pop        = hourly["pop"]       .as<float>();
+  r.rain_1h    = hourly["rain"]["1h"].as<float>();
+  r.snow_1h    = hourly["snow"]["1h"].as<float>();
+  JsonObject hourly_weather = hourly["weather"][0];
+  r.weather.id          = hourly_weather["id"]         .as<int>();
+  r.weather.main        = hourly_weather["main"]       .as<const char *>();
+  r.weather.description = hourly_weather["description"].as<const char *>();
+  r.weather.icon        = hourly_weather["icon"]       .as<const char *>();
+  return;
+} // end fillHourly
+
+static void fillDaily(JsonObject daily, owm_daily_t &r)
+{
+  r.dt         = daily["dt"]        .as<int64_t>();
+  r.sunrise    = daily["sunrise"]   .as<int64_t>();
+  r.sunset     = daily["sunset"]    .as<int64_t>();
+  r.moonrise   = daily["moonrise"]  .as<int64_t>();
+  r.moonset    = daily["moonset"]   .as<int64_t>();
+  r.moon_phase = daily["moon_phase"].as<float>();
+  JsonObject daily_temp = daily["temp"];
+  r.temp.morn  = daily_temp["morn"] .as<float>();
+  r.temp.day   = daily_temp["day"]  .as<float>();
+  r.temp.eve   = daily_temp["eve"]  .as<float>();
+  r.temp.night = daily_temp["night"].as<float>();
+  r.temp.min   = daily_temp["min"]  .as<float>();
+  r.temp.max   = daily_temp["max"]  .as<float>();
+  JsonObject daily_feels_like = daily["feels_like"];
+  r.feels_like.morn  = daily_feels_like["morn"] .as<float>();
+  r.feels_like.day   = daily_feels_like["day"]  .as<float>();
+  r.feels_like.eve   = daily_feels_like["eve"]  .as<float>();
+  r.feels_like.night = daily_feels_like["night"].as<float>();
+  r.pressure   = daily["pressure"]  .as<int>();
+  r.humidity   = daily["humidity"]  .as<int>();
+  r.dew_point  = daily["dew_point"] .as<float>();
+  r.clouds     = daily["clouds"]    .as<int>();
+  r.uvi        = daily["uvi"]       .as<float>();
+  r.visibility = daily["visibility"].as<int>();
+  r.wind_speed = daily["wind_speed"].as<float>();
+  r.wind_gust  = daily["wind_gust"] .as<float>();
+  r.wind_deg   = daily["wind_deg"]  .as<int>();
+  r.pop        = daily["pop"]       .as<float>();
+  r.rain       = daily["rain"]      .as<float>();
+  r.snow       = daily["snow"]      .as<float>();
+  JsonObject daily_weather = daily["weather"][0];
+  r.weather.id          = daily_weather["id"]         .as<int>();
+  r.weather.main        = daily_weather["main"]       .as<const char *>();
+  r.weather.description = daily_weather["description"].as<const char *>();
+  r.weather.icon        = daily_weather["icon"]       .as<const char *>();
+  return;
+} // end fillDaily
+
+#if DISPLAY_ALERTS
+static void fillAlert(JsonObject alerts, std::vector<owm_alerts_t> &r)
+{
+  owm_alerts_t new_alert = {};
+  // new_alert.sender_name = alerts["sender_name"].as<const char *>();
+  new_alert.event       = alerts["event"]      .as<const char *>();
+  new_alert.start       = alerts["start"]      .as<int64_t>();
+  new_alert.end         = alerts["end"]        .as<int64_t>();
+  // new_alert.description = alerts["description"].as<const char *>();
+  new_alert.tags        = alerts["tags"][0]    .as<const char *>();
+  r.push_back(new_alert);
+  return;
+} // end fillAlert
+#endif
 
 DeserializationError deserializeOneCall(WiFiClient &json,
                                         owm_resp_onecall_t &r)
@@ -60,10 +172,11 @@ DeserializationError deserializeOneCall(WiFiClient &json,
   DeserializationError error = deserializeJson(doc, json,
                                          DeserializationOption::Filter(filter));
 #if DEBUG_LEVEL >= 1
-  Serial.println("[debug] doc.overflowed() : "
-                 + String(doc.overflowed()));
+  LOG_I("[debug] doc.overflowed() : %d", doc.overflowed());
 #endif
 #if DEBUG_LEVEL >= 2
+  // written directly, after the log lines still queued
+  logFlush(LOG_FLUSH_MS);
   serializeJsonPretty(doc, Serial);
 #endif
   if (error) {
@@ -76,28 +189,7 @@ DeserializationError deserializeOneCall(WiFiClient &json,
   r.timezone_offset = doc["timezone_offset"].as<int>();
   //Serial.printf("TZ=%s, OFF=%d\n", r.timezone.c_str(),  r.timezone_offset);
 
-  JsonObject current = doc["current"];
-  r.current.dt         = current["dt"]        .as<int64_t>();
-  r.current.sunrise    = current["sunrise"]   .as<int64_t>();
-  r.current.sunset     = current["sunset"]    .as<int64_t>();
-  r.current.temp       = current["temp"]      .as<float>();
-  r.current.feels_like = current["feels_like"].as<float>();
-  r.current.pressure   = current["pressure"]  .as<int>();
-  r.current.humidity   = current["humidity"]  .as<int>();
-  r.current.dew_point  = current["dew_point"] .as<float>();
-  r.current.clouds     = current["clouds"]    .as<int>();
-  r.current.uvi        = current["uvi"]       .as<float>();
-  r.current.visibility = current["visibility"].as<int>();
-  r.current.wind_speed = current["wind_speed"].as<float>();
-  r.current.wind_gust  = current["wind_gust"] .as<float>();
-  r.current.wind_deg   = current["wind_deg"]  .as<int>();
-  r.current.rain_1h    = current["rain"]["1h"].as<float>();
-  r.current.snow_1h    = current["snow"]["1h"].as<float>();
-  JsonObject current_weather = current["weather"][0];
-  r.current.weather.id          = current_weather["id"]         .as<int>();
-  r.current.weather.main        = current_weather["main"]       .as<const char *>();
-  r.current.weather.description = current_weather["description"].as<const char *>();
-  r.current.weather.icon        = current_weather["icon"]       .as<const char *>();
+  fillCurrent(doc["current"], r.current);
 
   // minutely forecast is currently unused
   // i = 0;
@@ -116,26 +208,7 @@ DeserializationError deserializeOneCall(WiFiClient &json,
   i = 0;
   for (JsonObject hourly : doc["hourly"].as<JsonArray>())
   {
-    r.hourly[i].dt         = hourly["dt"]        .as<int64_t>();
-    r.hourly[i].temp       = hourly["temp"]      .as<float>();
-    r.hourly[i].feels_like = hourly["feels_like"].as<float>();
-    r.hourly[i].pressure   = hourly["pressure"]  .as<int>();
-    r.hourly[i].humidity   = hourly["humidity"]  .as<int>();
-    r.hourly[i].dew_point  = hourly["dew_point"] .as<float>();
-    r.hourly[i].clouds     = hourly["clouds"]    .as<int>();
-    r.hourly[i].uvi        = hourly["uvi"]       .as<float>();
-    r.hourly[i].visibility = hourly["visibility"].as<int>();
-    r.hourly[i].wind_speed = hourly["wind_speed"].as<float>();
-    r.hourly[i].wind_gust  = hourly["wind_gust"] .as<float>();
-    r.hourly[i].wind_deg   = hourly["wind_deg"]  .as<int>();
-    r.hourly[i].pop        = hourly["pop"]       .as<float>();
-    r.hourly[i].rain_1h    = hourly["rain"]["1h"].as<float>();
-    r.hourly[i].snow_1h    = hourly["snow"]["1h"].as<float>();
-    JsonObject hourly_weather = hourly["weather"][0];
-    r.hourly[i].weather.id          = hourly_weather["id"]         .as<int>();
-    r.hourly[i].weather.main        = hourly_weather["main"]       .as<const char *>();
-    r.hourly[i].weather.description = hourly_weather["description"].as<const char *>();
-    r.hourly[i].weather.icon        = hourly_weather["icon"]       .as<const char *>();
+    fillHourly(hourly, r.hourly[i]);
 
     if (i == OWM_NUM_HOURLY - 1)
     {
@@ -147,41 +220,7 @@ DeserializationError deserializeOneCall(WiFiClient &json,
   i = 0;
   for (JsonObject daily : doc["daily"].as<JsonArray>())
   {
-    r.daily[i].dt         = daily["dt"]        .as<int64_t>();
-    r.daily[i].sunrise    = daily["sunrise"]   .as<int64_t>();
-    r.daily[i].sunset     = daily["sunset"]    .as<int64_t>();
-    r.daily[i].moonrise   = daily["moonrise"]  .as<int64_t>();
-    r.daily[i].moonset    = daily["moonset"]   .as<int64_t>();
-    r.daily[i].moon_phase = daily["moon_phase"].as<float>();
-    JsonObject daily_temp = daily["temp"];
-    r.daily[i].temp.morn  = daily_temp["morn"] .as<float>();
-    r.daily[i].temp.day   = daily_temp["day"]  .as<float>();
-    r.daily[i].temp.eve   = daily_temp["eve"]  .as<float>();
-    r.daily[i].temp.night = daily_temp["night"].as<float>();
-    r.daily[i].temp.min   = daily_temp["min"]  .as<float>();
-    r.daily[i].temp.max   = daily_temp["max"]  .as<float>();
-    JsonObject daily_feels_like = daily["feels_like"];
-    r.daily[i].feels_like.morn  = daily_feels_like["morn"] .as<float>();
-    r.daily[i].feels_like.day   = daily_feels_like["day"]  .as<float>();
-    r.daily[i].feels_like.eve   = daily_feels_like["eve"]  .as<float>();
-    r.daily[i].feels_like.night = daily_feels_like["night"].as<float>();
-    r.daily[i].pressure   = daily["pressure"]  .as<int>();
-    r.daily[i].humidity   = daily["humidity"]  .as<int>();
-    r.daily[i].dew_point  = daily["dew_point"] .as<float>();
-    r.daily[i].clouds     = daily["clouds"]    .as<int>();
-    r.daily[i].uvi        = daily["uvi"]       .as<float>();
-    r.daily[i].visibility = daily["visibility"].as<int>();
-    r.daily[i].wind_speed = daily["wind_speed"].as<float>();
-    r.daily[i].wind_gust  = daily["wind_gust"] .as<float>();
-    r.daily[i].wind_deg   = daily["wind_deg"]  .as<int>();
-    r.daily[i].pop        = daily["pop"]       .as<float>();
-    r.daily[i].rain       = daily["rain"]      .as<float>();
-    r.daily[i].snow       = daily["snow"]      .as<float>();
-    JsonObject daily_weather = daily["weather"][0];
-    r.daily[i].weather.id          = daily_weather["id"]         .as<int>();
-    r.daily[i].weather.main        = daily_weather["main"]       .as<const char *>();
-    r.daily[i].weather.description = daily_weather["description"].as<const char *>();
-    r.daily[i].weather.icon        = daily_weather["icon"]       .as<const char *>();
+    fillDaily(daily, r.daily[i]);
 
     if (i == OWM_NUM_DAILY - 1)
     {
@@ -194,14 +233,7 @@ DeserializationError deserializeOneCall(WiFiClient &json,
   i = 0;
   for (JsonObject alerts : doc["alerts"].as<JsonArray>())
   {
-    owm_alerts_t new_alert = {};
-    // new_alert.sender_name = alerts["sender_name"].as<const char *>();
-    new_alert.event       = alerts["event"]      .as<const char *>();
-    new_alert.start       = alerts["start"]      .as<int64_t>();
-    new_alert.end         = alerts["end"]        .as<int64_t>();
-    // new_alert.description = alerts["description"].as<const char *>();
-    new_alert.tags        = alerts["tags"][0]    .as<const char *>();
-    r.alerts.push_back(new_alert);
+    fillAlert(alerts, r.alerts);
 
     if (i == OWM_NUM_ALERTS - 1)
     {
@@ -214,6 +246,248 @@ DeserializationError deserializeOneCall(WiFiClient &json,
   return error;
 } // end deserializeOneCall
 
+#ifdef PARSE_PIPELINE
+/*
+ * peekNext
+ *
+ * Returns the next character of the stream that is not white space without
+ * consuming it, or -1 if none arrives within the stream timeout.
+ */
+static int peekNext(Stream &json)
+{
+  unsigned long start = millis();
+  while (millis() - start < json.getTimeout())
+  {
+    int c = json.peek();
+    if (c < 0)
+    {
+      delay(1);
+    }
+    else if (isspace(c))
+    {
+      json.read();
+    }
+    else
+    {
+      return c;
+    }
+  }
+  return -1;
+} // end peekNext
+
+static int readNext(Stream &json)
+{
+  int c = peekNext(json);
+  if (c >= 0)
+  {
+    json.read();
+  }
+  return c;
+} // end readNext
+
+/*
+ * deserializeValue
+ *
+ * Parses the value at the head of the stream into doc. Objects, arrays and
+ * strings are read by ArduinoJson, which stops at their closing character.
+ * Other values (numbers, true, false, null) have no closing character and
+ * would lose the one that follows them, they are read here up to the ',' or
+ * '}' that ends them, which is left in the stream.
+ */
+static DeserializationError deserializeValue(Stream &json, JsonDocument &doc,
+                                             JsonDocument &filter)
+{
+  int c = peekNext(json);
+  if (c == '{' || c == '[' || c == '"')
+  {
+    return deserializeJson(doc, json, DeserializationOption::Filter(filter));
+  }
+  char raw[32];
+  size_t n = 0;
+  while ((c = peekNext(json)) >= 0 && c != ',' && c != '}' && c != ']')
+  {
+    if (n == sizeof(raw) - 1)
+    {
+      return DeserializationError::InvalidInput;
+    }
+    raw[n++] = static_cast<char>(json.read());
+  }
+  raw[n] = '\0';
+  if (c < 0)
+  {
+    return DeserializationError::IncompleteInput;
+  }
+  return deserializeJson(doc, raw, DeserializationOption::Filter(filter));
+} // end deserializeValue
+
+/*
+ * deserializeOneCallSections
+ *
+ * Same result as deserializeOneCall(), but the response is parsed one member
+ * at a time (one element at a time for the hourly, daily and alerts arrays)
+ * and published(ctx, sections) is called as soon as a section is complete, so
+ * that it can be used while the rest of the response is received. Sections
+ * missing from the response (there are no alerts most of the time) are
+ * published once the whole response is parsed.
+ */
+DeserializationError deserializeOneCallSections(WiFiClient &json,
+                                                owm_resp_onecall_t &r,
+                                                onecall_published_t published,
+                                                void *ctx)
+{
+  JsonDocument keep;
+  keep.set(true);
+  JsonDocument skip;
+  skip.set(false);
+  JsonDocument alert_filter;
+  alert_filter["event"] = true;
+  alert_filter["start"] = true;
+  alert_filter["end"]   = true;
+  alert_filter["tags"]  = true;
+
+  JsonDocument doc;
+  DeserializationError error;
+  uint32_t sections = 0;
+  bool have_tz = false, have_current = false;
+
+  r.alerts.clear(); // from a failed attempt
+  if (readNext(json) != '{')
+  {
+    return DeserializationError::InvalidInput;
+  }
+  for (;;)
+  {
+    int c = readNext(json);
+    if (c == '}')
+    {
+      break;
+    }
+    if (c == ',')
+    {
+      c = readNext(json);
+    }
+    if (c != '"')
+    {
+      return c < 0 ? DeserializationError::IncompleteInput
+                   : DeserializationError::InvalidInput;
+    }
+    String key = json.readStringUntil('"');
+    if (readNext(json) != ':')
+    {
+      return DeserializationError::InvalidInput;
+    }
+
+    uint32_t section = 0;
+    int16_t max_elements = 0;
+    if (key == "hourly")
+    {
+      section = ONECALL_HOURLY;
+      max_elements = OWM_NUM_HOURLY;
+    }
+    else if (key == "daily")
+    {
+      section = ONECALL_DAILY;
+      max_elements = OWM_NUM_DAILY;
+    }
+#if DISPLAY_ALERTS
+    else if (key == "alerts")
+    {
+      section = ONECALL_ALERTS;
+      max_elements = OWM_NUM_ALERTS;
+    }
+#endif
+
+    if (section != 0 && peekNext(json) == '[')
+    {
+      // arrays are parsed one element at a time
+      json.read();
+      int16_t i = 0;
+      while ((c = peekNext(json)) != ']')
+      {
+        if (c == ',')
+        {
+          json.read();
+          continue;
+        }
+        JsonDocument &filter = (i >= max_elements) ? skip
+                             : (section == ONECALL_ALERTS) ? alert_filter
+                             : keep;
+        error = deserializeJson(doc, json,
+                                DeserializationOption::Filter(filter));
+        if (error)
+        {
+          return error;
+        }
+        if (i < max_elements)
+        {
+          if (section == ONECALL_HOURLY)
+          {
+            fillHourly(doc.as<JsonObject>(), r.hourly[i]);
+          }
+          else if (section == ONECALL_DAILY)
+          {
+            fillDaily(doc.as<JsonObject>(), r.daily[i]);
+          }
+#if DISPLAY_ALERTS
+          else
+          {
+            fillAlert(doc.as<JsonObject>(), r.alerts);
+          }
+#endif
+        }
+        ++i;
+      }
+      json.read(); // ']'
+      sections |= section;
+      published(ctx, section);
+      continue;
+    }
+
+    const bool wanted = key == "lat" || key == "lon" || key == "timezone"
+                     || key == "timezone_offset" || key == "current";
+    error = deserializeValue(json, doc, wanted ? keep : skip);
+    if (error)
+    {
+      return error;
+    }
+    if (key == "lat")
+    {
+      r.lat = doc.as<float>();
+    }
+    else if (key == "lon")
+    {
+      r.lon = doc.as<float>();
+    }
+    else if (key == "timezone")
+    {
+      r.timezone = doc.as<const char *>();
+    }
+    else if (key == "timezone_offset")
+    {
+      r.timezone_offset = doc.as<int>();
+      have_tz = true;
+    }
+    else if (key == "current")
+    {
+      fillCurrent(doc.as<JsonObject>(), r.current);
+      have_current = true;
+    }
+    if (have_tz && have_current && !(sections & ONECALL_CURRENT))
+    {
+      // the time of the update is only known with the timezone offset
+      sections |= ONECALL_CURRENT;
+      published(ctx, ONECALL_CURRENT);
+    }
+  }
+
+  if (sections != ONECALL_ALL)
+  {
+    published(ctx, ONECALL_ALL & ~sections);
+  }
+  return DeserializationError::Ok;
+} // end deserializeOneCallSections
+#endif // PARSE_PIPELINE
+
 DeserializationError deserializeAirQuality(WiFiClient &json,
                                            owm_resp_air_pollution_t &r)
 {
@@ -223,10 +497,11 @@ DeserializationError deserializeAirQuality(WiFiClient &json,
 
   DeserializationError error = deserializeJson(doc, json);
 #if DEBUG_LEVEL >= 1
-  Serial.println("[debug] doc.overflowed() : "
-                 + String(doc.overflowed()));
+  LOG_I("[debug] doc.overflowed() : %d", doc.overflowed());
 #endif
 #if DEBUG_LEVEL >= 2
+  // written directly, after the log lines still queued
+  logFlush(LOG_FLUSH_MS);
   serializeJsonPretty(doc, Serial);
 #endif
   if (error) {
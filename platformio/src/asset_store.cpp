@@ -0,0 +1,326 @@
+/* Asset archive access for esp32-weather-epd.
+ * Copyright (C) 2022-2026  Luke Marzen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "config.h"
+#ifdef USE_ASSET_PARTITION
+
+#include <array>
+#include <cstring>
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#include <esp_idf_version.h>
+#include <esp_partition.h>
+#if ESP_IDF_VERSION_MAJOR > 5 \
+ || (ESP_IDF_VERSION_MAJOR == 5 && ESP_IDF_VERSION_MINOR >= 1)
+typedef esp_partition_mmap_handle_t asset_mmap_handle_t;
+#define ASSET_MMAP_DATA   ESP_PARTITION_MMAP_DATA
+#define ASSET_MUNMAP(h)   esp_partition_munmap(h)
+#else
+// IDF 4.4 (Arduino 2.x) and 5.0
+#include <esp_spi_flash.h>
+typedef spi_flash_mmap_handle_t asset_mmap_handle_t;
+#define ASSET_MMAP_DATA   SPI_FLASH_MMAP_DATA
+#define ASSET_MUNMAP(h)   spi_flash_munmap(h)
+#endif
+#else
+#include <cstdlib>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "asset_store.h"
+#include "asset_fonts.h"
+#include "logger.h"
+
+// Fonts stay empty (first > last, nothing is drawn) until they are bound.
+#define ASSET_FONT_DEF(name) GFXfont asset_FONT_##name = {nullptr, nullptr, 1, 0, 0};
+ASSET_FONTS(ASSET_FONT_DEF)
+#undef ASSET_FONT_DEF
+
+// Returned for missing icons so that a stale archive can not crash the display
+template <size_t N>
+static constexpr std::array<uint8_t, N> filledArray(uint8_t value)
+{
+  std::array<uint8_t, N> a{};
+  for (size_t i = 0; i < N; ++i)
+  {
+    a[i] = value;
+  }
+  return a;
+}
+static constexpr auto asset_blank_bitmap =
+  filledArray<ASSET_MAX_BITMAP_SIZE * ((ASSET_MAX_BITMAP_SIZE + 7) / 8)>(0xFF);
+
+static const uint8_t       *asset_base    = nullptr;
+static const asset_entry_t *asset_entries = nullptr;
+static uint16_t             asset_count   = 0;
+#ifdef ARDUINO
+static asset_mmap_handle_t asset_mmap_handle;
+#else
+static size_t asset_mmap_size = 0;
+#endif
+
+/*
+ * findAsset
+ *
+ * Binary search of the archive index, returns nullptr if the key is not found.
+ */
+static const asset_entry_t *findAsset(uint32_t key)
+{
+  int lo = 0;
+  int hi = static_cast<int>(asset_count) - 1;
+  while (lo <= hi)
+  {
+    int mid = (lo + hi) / 2;
+    if (asset_entries[mid].key == key)
+    {
+      return &asset_entries[mid];
+    }
+    if (asset_entries[mid].key < key)
+    {
+      lo = mid + 1;
+    }
+    else
+    {
+      hi = mid - 1;
+    }
+  }
+  return nullptr;
+} // end findAsset
+
+/*
+ * checkEntries
+ *
+ * Returns false if an entry of the index lies outside the archive (corrupt or
+ * truncated), its data would be read past the mapping.
+ */
+static bool checkEntries(uint32_t total_size)
+{
+  for (uint16_t i = 0; i < asset_count; ++i)
+  {
+    const asset_entry_t &e = asset_entries[i];
+    if (e.offset > total_size || e.size > total_size - e.offset)
+    {
+      return false;
+    }
+  }
+  return true;
+} // end checkEntries
+
+/*
+ * checkFont
+ *
+ * Returns false if the glyph table or a glyph bitmap of the font entry lies
+ * outside the entry. Only the start of the glyph bitmaps is checked, their
+ * length depends on the encoding (see FONT_RLE_LIST).
+ */
+static bool checkFont(const asset_entry_t &e)
+{
+  if (e.size < sizeof(asset_font_t))
+  {
+    return false;
+  }
+  const uint8_t *p = asset_base + e.offset;
+  const asset_font_t *f = reinterpret_cast<const asset_font_t *>(p);
+  if (f->first > f->last
+   || f->glyph_offset > e.size
+   || (f->last - f->first + 1u) * sizeof(GFXglyph) > e.size - f->glyph_offset
+   || f->bitmap_offset > e.size)
+  {
+    return false;
+  }
+  const GFXglyph *glyphs = reinterpret_cast<const GFXglyph *>(
+                             p + f->glyph_offset);
+  const uint32_t bitmap_size = e.size - f->bitmap_offset;
+  for (uint32_t i = 0; i <= static_cast<uint32_t>(f->last - f->first); ++i)
+  {
+    if (glyphs[i].bitmapOffset > bitmap_size)
+    {
+      return false;
+    }
+  }
+  return true;
+} // end checkFont
+
+/*
+ * bindFont
+ *
+ * Points the GFXfont at the glyph table and bitmaps inside the archive.
+ */
+static void bindFont(GFXfont &font, const char *name)
+{
+  const asset_entry_t *e = findAsset(assetKey(name));
+  if (e == nullptr || e->type != ASSET_FONT)
+  {
+    LOG_W("Asset not found: %s", name);
+    return;
+  }
+  if (!checkFont(*e))
+  {
+    LOG_W("Invalid asset: %s", name);
+    return;
+  }
+  const uint8_t *p = asset_base + e->offset;
+  const asset_font_t *f = reinterpret_cast<const asset_font_t *>(p);
+  font.bitmap   = const_cast<uint8_t *>(p + f->bitmap_offset);
+  font.glyph    = reinterpret_cast<GFXglyph *>(
+                    const_cast<uint8_t *>(p + f->glyph_offset));
+  font.first    = f->first;
+  font.last     = f->last;
+  font.yAdvance = f->yAdvance;
+  return;
+} // end bindFont
+
+/*
+ * assetsBegin
+ *
+ * Maps the asset archive (the ASSET_PARTITION_LABEL partition, or on a host
+ * build the file named by $EPD_ASSETS, default assets.bin), checks its header
+ * and binds the fonts. Returns false if the archive is missing or invalid.
+ */
+bool assetsBegin()
+{
+  if (asset_base != nullptr)
+  {
+    return true;
+  }
+  const void *map = nullptr;
+  size_t map_size = 0;
+#ifdef ARDUINO
+  const esp_partition_t *part = esp_partition_find_first(
+    ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, ASSET_PARTITION_LABEL);
+  if (part == nullptr)
+  {
+    LOG_W("Asset partition not found");
+    return false;
+  }
+  if (esp_partition_mmap(part, 0, part->size, ASSET_MMAP_DATA,
+                         &map, &asset_mmap_handle) != ESP_OK)
+  {
+    LOG_W("Failed to map asset partition");
+    return false;
+  }
+  map_size = part->size;
+#else
+  const char *path = getenv("EPD_ASSETS");
+  int fd = open(path ? path : "assets.bin", O_RDONLY);
+  struct stat st;
+  if (fd < 0 || fstat(fd, &st) != 0)
+  {
+    LOG_W("Asset archive not found");
+    if (fd >= 0)
+    {
+      close(fd);
+    }
+    return false;
+  }
+  map_size = st.st_size;
+  map = mmap(nullptr, map_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (map == MAP_FAILED)
+  {
+    LOG_W("Failed to map asset archive");
+    return false;
+  }
+  asset_mmap_size = map_size;
+#endif
+
+  const asset_header_t *hdr = static_cast<const asset_header_t *>(map);
+  asset_base = static_cast<const uint8_t *>(map);
+  if (map_size < sizeof(asset_header_t)
+   || hdr->magic != ASSET_MAGIC
+   || hdr->format_version != ASSET_FORMAT_VERSION
+   || hdr->total_size > map_size
+   || sizeof(asset_header_t) + hdr->entry_count * sizeof(asset_entry_t)
+      > hdr->total_size)
+  {
+    LOG_W("Invalid asset archive");
+    assetsEnd();
+    return false;
+  }
+  asset_entries = reinterpret_cast<const asset_entry_t *>(hdr + 1);
+  asset_count = hdr->entry_count;
+  if (!checkEntries(hdr->total_size))
+  {
+    LOG_W("Invalid asset archive");
+    assetsEnd();
+    return false;
+  }
+
+#define ASSET_FONT_BIND(name) bindFont(asset_FONT_##name, "FONT_" #name);
+  ASSET_FONTS(ASSET_FONT_BIND)
+#undef ASSET_FONT_BIND
+  return true;
+} // end assetsBegin
+
+/*
+ * assetsEnd
+ *
+ * Unmaps the asset archive. Fonts and bitmaps obtained from it must not be used
+ * afterwards.
+ */
+void assetsEnd()
+{
+  if (asset_base == nullptr)
+  {
+    return;
+  }
+#ifdef ARDUINO
+  ASSET_MUNMAP(asset_mmap_handle);
+#else
+  munmap(const_cast<uint8_t *>(asset_base), asset_mmap_size);
+#endif
+  asset_base = nullptr;
+  asset_entries = nullptr;
+  asset_count = 0;
+  return;
+} // end assetsEnd
+
+/*
+ * getAssetsVersion
+ *
+ * Returns the version stamped by the packer, 0 if no archive is mapped.
+ */
+uint32_t getAssetsVersion()
+{
+  if (asset_base == nullptr)
+  {
+    return 0;
+  }
+  return reinterpret_cast<const asset_header_t *>(asset_base)->asset_version;
+} // end getAssetsVersion
+
+/*
+ * getAssetBitmap
+ *
+ * Returns a pointer to the bitmap inside the mapped archive, or a blank bitmap
+ * if it is not there.
+ */
+const uint8_t *getAssetBitmap(uint32_t key)
+{
+  const asset_entry_t *e = (asset_base != nullptr) ? findAsset(key) : nullptr;
+  if (e == nullptr || e->type != ASSET_BITMAP)
+  {
+    return asset_blank_bitmap.data();
+  }
+  return asset_base + e->offset;
+} // end getAssetBitmap
+
+#endif // USE_ASSET_PARTITION
@@ -16,6 +16,7 @@
  */
 
 // built-in C++ libraries
+#include <climits>
 #include <cstring>
 #include <vector>
 
@@ -38,7 +39,14 @@
 #include "aqi.h"
 #include "client_utils.h"
 #include "display_utils.h"
+#include "frame_preview.h"
+#include "logger.h"
+#include "metrics.h"
+#include "parse_pipeline.h"
+#include "profiler.h"
 #include "renderer.h"
+#include "web_template.h"
+#include "web_ui.h"
 #ifndef USE_HTTP
   #include <WiFiClientSecure.h>
 #endif
@@ -78,6 +86,9 @@ unsigned int  WicTemp = DEF_WICTEMP;
 
 // Backup data in NVS
 #include <Preferences.h>
+#include <AsyncJson.h>
+#include <esp_rom_crc.h>
+#include <esp_sleep.h>
 
 #ifdef USE_OTA
 /*****************************************************/
@@ -104,33 +115,40 @@ void ota_ide_setup ( void )
         type = "filesystem";
       }
 
-      Serial.println("Start updating " + type);
+      LOG_I("Start updating %s", type.c_str());
     })
     .onEnd([]() {
-      Serial.println("\nEnd");
+      LOG_I("End");
     })
     .onProgress([](unsigned int progress, unsigned int total) {
-      if (total > 100)
-        Serial.printf("Progress: %u%%\r", (progress / (total / 100)));
+      // every 10%, the ring would only keep the last lines otherwise
+      static unsigned int last = 0;
+      if (total > 100) {
+        unsigned int pc = progress / (total / 100);
+        if (pc != last && !(pc % 10))
+          LOG_I("Progress: %u%%", pc);
+        last = pc;
+      }
     })
     .onError([](ota_error_t error) {
-      Serial.printf("Error[%u]: ", error);
+      const char *msg = "";
       if (error == OTA_AUTH_ERROR) {
-        Serial.println("Auth Failed");
+        msg = "Auth Failed";
       } else if (error == OTA_BEGIN_ERROR) {
-        Serial.println("Begin Failed");
+        msg = "Begin Failed";
       } else if (error == OTA_CONNECT_ERROR) {
-        Serial.println("Connect Failed");
+        msg = "Connect Failed";
       } else if (error == OTA_RECEIVE_ERROR) {
-        Serial.println("Receive Failed");
+        msg = "Receive Failed";
       } else if (error == OTA_END_ERROR) {
-        Serial.println("End Failed");
+        msg = "End Failed";
       }
+      LOG_E("Error[%u]: %s", error, msg);
     });
 
   ArduinoOTA.begin();
 
-  Serial.println("OTA IDE initialised");
+  LOG_I("OTA IDE initialised");
 }
 
 /*****************************************************/
@@ -273,32 +291,35 @@ void handleDoUpdate(AsyncWebServerRequest *request, const String& filename, size
 {
   if (!index)
   {
-    Serial.printf("Update started (len=%d)\n",content_len);
     delay(1000);
 
     pcent = 0;
     content_len = request->contentLength();
+    LOG_I("Update started (len=%u)", (unsigned) content_len);
     // if filename includes spiffs, update the spiffs partition
     int cmd = (filename.indexOf("spiffs") > -1) ? U_PART : U_FLASH;
 
     if (!Update.begin(UPDATE_SIZE_UNKNOWN, cmd))
     {
-      Update.printError(Serial);
+      LOG_E("Update error: %s", Update.errorString());
     }
   }
 
   if (Update.write(data, len) != len)
   {
-    Update.printError(Serial);
+    LOG_E("Update error: %s", Update.errorString());
   }
 
   if (final)
   {
-    Serial.println((Update.hasError()) ? "Upload FAILED, device going to sleep" : "Update completed, device going to sleep");
+    if (Update.hasError())
+      LOG_E("Upload FAILED, device going to sleep");
+    else
+      LOG_I("Update completed, device going to sleep");
 
     if (!Update.end(true))
     {
-      Update.printError(Serial);
+      LOG_E("Update error: %s", Update.errorString());
     }
   }
 }
@@ -312,7 +333,7 @@ void printProgress(size_t prg, size_t sz)
     {
       pcent = lpc;
       if ( !(lpc%10) )
-        Serial.printf("Update progress: %d%%\n", lpc);
+        LOG_I("Update progress: %d%%", lpc);
     }
   }
 }
@@ -331,7 +352,7 @@ static unsigned long ota_progress_millis = 0;
 void onOTAStart()
 {
   // Log when OTA has started
-  Serial.println("OTA update started!");
+  LOG_I("OTA update started!");
 }
 
 void onOTAProgress(size_t current, size_t final)
@@ -339,7 +360,8 @@ void onOTAProgress(size_t current, size_t final)
   // Log every 1 second
   if (millis() - ota_progress_millis > 1000) {
     ota_progress_millis = millis();
-    Serial.printf("OTA Progress Current: %u bytes, Final: %u bytes\n", current, final);
+    LOG_I("OTA Progress Current: %u bytes, Final: %u bytes",
+          (unsigned) current, (unsigned) final);
   }
 }
 
@@ -347,9 +369,9 @@ void onOTAEnd(bool success)
 {
   // Log when OTA has finished
   if (success) {
-    Serial.println("OTA update finished successfully!");
+    LOG_I("OTA update finished successfully!");
   } else {
-    Serial.println("There was an error during OTA update!");
+    LOG_E("There was an error during OTA update!");
   }
 
   // Need to restart in order to take into account the new image
@@ -456,7 +478,7 @@ String WicChecked = "checked";  // Keep in sync wih DEF_WIC
 #define NM_WICTEMP "IconsVpos"
 String WicTempChecked = "checked";  // Keep in sync wih DEF_WICTEMP
 
-// Init flag
+// Init flag (former NVS layout, see RETRIEVE_LEGACY_CONFIG)
 #define NM_INIT "Inited"
 
 // Reset requested flags / time
@@ -464,60 +486,345 @@ static int           reset_pending = 0;
 static unsigned long reset_time;
 
 /*
- * CLEAR_NVS
+ * Configuration blob
  *
- * Used for testing
+ * All the parameters are saved in NVS as a single entry (CFG_KEY), read once
+ * when starting. Strings are stored NUL terminated in fixed size fields.
+ * Increment CFG_VERSION when the layout changes, and convert the previous
+ * layout in retrieve_config (as done for the former one-string-per-key
+ * layout, see RETRIEVE_LEGACY_CONFIG).
  */
-void clear_nvs ( void )
+#define CFG_KEY     "Config"
+#define CFG_VERSION 1
+#define CFG_LOC_LEN 32  // 30 chars in the weather page
+#define CFG_GEO_LEN 16
+#define CFG_SSI_LEN 33  // 32 bytes SSID
+#define CFG_PWD_LEN 65  // 63 chars passphrase or 64 hex digits
+
+typedef struct cfg_blob
 {
-  // Clear all data
-  preferences.clear();
+  uint16_t version;
+  uint16_t size;
+  char     loc[MX_LOC][CFG_LOC_LEN];
+  char     lat[MX_LOC][CFG_GEO_LEN];
+  char     lon[MX_LOC][CFG_GEO_LEN];
+  char     ssi[MX_SSI][CFG_SSI_LEN];
+  char     pwd[MX_SSI][CFG_PWD_LEN];
+  int32_t  defloc;
+  float    popth;
+  float    toff;
+  int32_t  bedtime;
+  int32_t  waketime;
+  int32_t  sleepdly;
+  int32_t  hourlynb;
+  int32_t  minreftim;
+  int32_t  maxacttim;
+  uint32_t wifiapto;
+  uint32_t wifitimeout;
+  uint32_t httptimeout;
+  uint8_t  rerflg;
+  uint8_t  wicflg;
+  uint8_t  wictemp;
+  uint32_t crc;         // of the previous bytes
+} __attribute__((packed)) cfg_blob_t;
+
+// Image last read from / written to NVS, kept in RTC memory so that timer
+// wake-ups do not read NVS. cfg_gen is incremented whenever NVS is modified,
+// cfg_saved_gen tells which generation cfg_saved holds.
+RTC_DATA_ATTR static cfg_blob_t cfg_saved;
+RTC_DATA_ATTR static uint32_t   cfg_gen;
+RTC_DATA_ATTR static uint32_t   cfg_saved_gen;
+
+static uint32_t config_crc ( const cfg_blob_t *b )
+{
+  return esp_rom_crc32_le(0, (const uint8_t *)b, offsetof(cfg_blob_t, crc));
+}
+
+// Also rejects an image left in RTC memory by a firmware with another layout
+static bool config_valid ( const cfg_blob_t *b )
+{
+  return (b->version == CFG_VERSION)  &&
+         (b->size == sizeof(*b))      &&
+         (b->crc == config_crc(b));
+}
+
+static void config_str ( char *dst, size_t size, const String &src,
+                         const String &name )
+{
+  if ( src.length() >= size )
+    LOG_W("%s truncated to %u chars", name.c_str(), (unsigned) (size - 1));
+  strlcpy(dst, src.c_str(), size);
 }
 
 /*
- * CLEAN_NVS
+ * CONFIG_PACK
  *
- * Clear entries that are not in use / no longer exist
- * and recreates the others
+ * Build the blob from the current parameters
  */
-void clean_nvs ( void )
+static void config_pack ( cfg_blob_t *b )
 {
   int i;
 
-  // Clear all data
-  preferences.clear();
+  // unused bytes of the strings shall compare equal
+  memset(b, 0, sizeof(*b));
+  b->version = CFG_VERSION;
+  b->size    = sizeof(*b);
 
-  // And restore what is in use
   for (i=0 ; i<MX_LOC ; i++)
   {
-    preferences.putString(NLoc[i].c_str(), VLoc[i]);
-    preferences.putString(NLat[i].c_str(), VLat[i]);
-    preferences.putString(NLon[i].c_str(), VLon[i]);
+    config_str(b->loc[i], CFG_LOC_LEN, VLoc[i], NLoc[i]);
+    config_str(b->lat[i], CFG_GEO_LEN, VLat[i], NLat[i]);
+    config_str(b->lon[i], CFG_GEO_LEN, VLon[i], NLon[i]);
+  }
+  for (i=0 ; i<MX_SSI ; i++)
+  {
+    config_str(b->ssi[i], CFG_SSI_LEN, VSsi[i], NSsi[i]);
+    config_str(b->pwd[i], CFG_PWD_LEN, VPwd[i], NPwd[i]);
   }
-  preferences.putString(NDloc.c_str(), DefLoc);
 
+  b->defloc      = defloc;
+  b->popth       = PopTh;
+  b->toff        = Toff;
+  b->bedtime     = BedTime;
+  b->waketime    = WakeTime;
+  b->sleepdly    = SleepDly;
+  b->hourlynb    = HourlyNb;
+  b->minreftim   = MinRefTim;
+  b->maxacttim   = MaxActTim;
+  b->wifiapto    = WifiAPto;
+  b->wifitimeout = WifiTimeout;
+  b->httptimeout = HttpTimeout;
+  b->rerflg      = RerFlg;
+  b->wicflg      = WicFlg;
+  b->wictemp     = WicTemp;
+
+  b->crc = config_crc(b);
+}
+
+/*
+ * CONFIG_UNPACK
+ *
+ * Set the current parameters from a valid blob
+ */
+static void config_unpack ( const cfg_blob_t *b )
+{
+  int i;
+
+  for (i=0 ; i<MX_LOC ; i++)
+  {
+    VLoc[i] = b->loc[i];
+    VLat[i] = b->lat[i];
+    VLon[i] = b->lon[i];
+  }
   for (i=0 ; i<MX_SSI ; i++)
   {
-    preferences.putString(NSsi[i].c_str(), VSsi[i]);
-    preferences.putString(NPwd[i].c_str(), VPwd[i]);
+    VSsi[i] = b->ssi[i];
+    VPwd[i] = b->pwd[i];
   }
 
-  preferences.putString(NM_THR, String(PopTh));
-  preferences.putString(NM_TOFF, String(Toff));
-  preferences.putString(NM_BED, String(BedTime));
-  preferences.putString(NM_WAK, String(WakeTime));
-  preferences.putString(NM_SLP, String(SleepDly));
-  preferences.putString(NM_HNB, String(HourlyNb));
-  preferences.putString(NM_MRT, String(MinRefTim));
-  preferences.putString(NM_MAT, String(MaxActTim));
-  preferences.putString(NM_WAT, String(WifiAPto));
-  preferences.putString(NM_WGT, String(WifiTimeout));
-  preferences.putString(NM_HTO, String(HttpTimeout));
-  preferences.putString(NM_RER, String(RerFlg));
-  preferences.putString(NM_WIC, String(WicFlg));
-  preferences.putString(NM_WICTEMP, String(WicTemp));
-
-  preferences.putString(NM_INIT, "yes");
+  defloc      = b->defloc;
+  DefLoc      = String(defloc);
+  PopTh       = b->popth;
+  Toff        = b->toff;
+  BedTime     = b->bedtime;
+  WakeTime    = b->waketime;
+  SleepDly    = b->sleepdly;
+  HourlyNb    = b->hourlynb;
+  MinRefTim   = b->minreftim;
+  MaxActTim   = b->maxacttim;
+  WifiAPto    = b->wifiapto;
+  WifiTimeout = b->wifitimeout;
+  HttpTimeout = b->httptimeout;
+  RerFlg      = b->rerflg;
+  RerChecked  = (RerFlg) ? "checked" : "";
+  WicFlg      = b->wicflg;
+  WicChecked  = (WicFlg) ? "checked" : "";
+  WicTemp     = b->wictemp;
+  WicTempChecked = (WicTemp) ? "checked" : "";
+}
+
+/*
+ * CONFIG_WRITE
+ *
+ * Save a blob in NVS, when it differs from the saved one
+ * Returns 1 when written
+ */
+static int config_write ( const cfg_blob_t *b )
+{
+  if ( memcmp(b, &cfg_saved, sizeof(*b)) == 0 )
+    return 0;
+
+  cfg_gen++;
+  if ( preferences.putBytes(CFG_KEY, b, sizeof(*b)) != sizeof(*b) )
+  {
+    LOG_E("Config: NVS write failed");
+    return 0;
+  }
+  cfg_saved     = *b;
+  cfg_saved_gen = cfg_gen;
+
+  LOG_I("Config: %u bytes written", (unsigned) sizeof(*b));
+  return 1;
+}
+
+/*
+ * CONFIG_COMMIT
+ *
+ * Save the parameters in NVS now (when starting, see CONFIG_POST otherwise)
+ * Returns 1 when written
+ */
+static int config_commit ( void )
+{
+  static cfg_blob_t b;
+
+  config_pack(&b);
+  return config_write(&b);
+}
+
+/*
+ * Write-behind of the parameters
+ *
+ * The Web handlers run in the AsyncTCP task. They update the parameters in
+ * memory and post a packed copy (CONFIG_END); loop() saves the last copy
+ * posted (CONFIG_FLUSH). The handlers do not wait for the flash, and
+ * successive changes make a single NVS write.
+ */
+#define CFG_OP_WRITE 1  // save cfg_next
+#define CFG_OP_CLEAR 2  // clear NVS first
+
+static SemaphoreHandle_t cfg_lock;      // cfg_next, cfg_ops, cfg_hold and
+                                        // the parameters while updated
+static SemaphoreHandle_t cfg_nvs_lock;  // NVS writes
+static cfg_blob_t        cfg_next;
+static int               cfg_ops;
+static int               cfg_hold;      // parameters in use by loop()
+
+// cfg_lock held
+static void config_post_locked ( int ops )
+{
+  if ( ops & CFG_OP_WRITE )
+    config_pack(&cfg_next);
+  if ( ops & CFG_OP_CLEAR )
+    cfg_ops = ops;  // drops the writes posted before
+  else
+    cfg_ops |= ops;
+}
+
+static void config_post_ops ( int ops )
+{
+  xSemaphoreTake(cfg_lock, portMAX_DELAY);
+  config_post_locked(ops);
+  xSemaphoreGive(cfg_lock);
+}
+
+/*
+ * CONFIG_BEGIN
+ *
+ * Start an update of the parameters by a Web handler, ended by CONFIG_END.
+ * Returns 0 if loop() is using them (CONFIG_HOLD): the handler answers
+ * "Busy" rather than blocking the AsyncTCP task for a whole refresh.
+ */
+static int config_begin ( void )
+{
+  xSemaphoreTake(cfg_lock, portMAX_DELAY);
+  if ( cfg_hold )
+  {
+    xSemaphoreGive(cfg_lock);
+    return 0;
+  }
+  return 1;
+}
+
+/*
+ * CONFIG_END
+ *
+ * Save the updated parameters (see CONFIG_FLUSH)
+ */
+static void config_end ( void )
+{
+  config_post_locked(CFG_OP_WRITE);
+  xSemaphoreGive(cfg_lock);
+}
+
+/*
+ * CONFIG_HOLD
+ *
+ * Called from loop() around a refresh, which reads the parameters: the Web
+ * handlers can not update them meanwhile (see CONFIG_BEGIN)
+ */
+void config_hold ( int hold )
+{
+  // Web server not started
+  if ( cfg_lock == nullptr )
+    return;
+
+  xSemaphoreTake(cfg_lock, portMAX_DELAY);
+  cfg_hold = hold;
+  xSemaphoreGive(cfg_lock);
+}
+
+static void send_busy ( AsyncWebServerRequest *request )
+{
+  request->send(503, "text/plain", "Busy");
+}
+
+/*
+ * CONFIG_FLUSH
+ *
+ * Perform the NVS operations posted since the last call
+ * Called from loop(), and before deep sleep
+ */
+void config_flush ( void )
+{
+  static cfg_blob_t b;
+  int               ops;
+
+  // Web server not started
+  if ( cfg_lock == nullptr )
+    return;
+
+  xSemaphoreTake(cfg_nvs_lock, portMAX_DELAY);
+
+  xSemaphoreTake(cfg_lock, portMAX_DELAY);
+  ops     = cfg_ops;
+  cfg_ops = 0;
+  if ( ops & CFG_OP_WRITE )
+    b = cfg_next;
+  xSemaphoreGive(cfg_lock);
+
+  if ( ops & CFG_OP_CLEAR )
+  {
+    preferences.clear();
+    memset(&cfg_saved, 0, sizeof(cfg_saved));
+    cfg_gen++;
+  }
+  if ( ops & CFG_OP_WRITE )
+    config_write(&b);
+
+  xSemaphoreGive(cfg_nvs_lock);
+}
+
+/*
+ * CLEAR_NVS
+ *
+ * Used for testing
+ */
+void clear_nvs ( void )
+{
+  // Clear all data
+  config_post_ops(CFG_OP_CLEAR);
+}
+
+/*
+ * CLEAN_NVS
+ *
+ * Clear entries that are not in use / no longer exist
+ * and recreates the others
+ */
+void clean_nvs ( void )
+{
+  // Clear all data, and restore what is in use
+  config_post_ops(CFG_OP_CLEAR | CFG_OP_WRITE);
 }
 
 /*
@@ -526,6 +833,7 @@ void clean_nvs ( void )
  * Check and rectify parameters :
  * - When fetched from NVS
  * - When modified through Web
+ * The caller saves them (CONFIG_COMMIT)
  * The entry 0 shall always be valid :
  * - Read Only for Wifi
  * - Restored from default values for Location when invalid/unset
@@ -539,11 +847,10 @@ int check_config ( void )
        (VLat[defloc] == "") ||
        (VLon[defloc] == "")  )
   {
-    Serial.println("Resetting current location");
+    LOG_I("Resetting current location");
     Lchecked[defloc] = "";
     defloc = 0;
     DefLoc = "0";
-    preferences.putString(NDloc.c_str(), DefLoc);
     Lchecked[defloc] = "checked";
     rc = 1;
   }
@@ -553,13 +860,10 @@ int check_config ( void )
        (VLat[0] == "") ||
        (VLon[0] == "")  )
   {
-    Serial.println("Resetting location to default");
+    LOG_I("Resetting location to default");
     VLoc[0] = DEFCITY;
     VLat[0] = DEFLAT;
     VLon[0] = DEFLON;
-    preferences.putString(NLoc[0].c_str(), VLoc[0]);
-    preferences.putString(NLat[0].c_str(), VLat[0]);
-    preferences.putString(NLon[0].c_str(), VLon[0]);
     rc = 1;
   }
 
@@ -567,36 +871,23 @@ int check_config ( void )
   if ( (VSsi[0] == "") ||
        (VPwd[0] == "")  )
   {
-    Serial.println("Resetting WiFi to default");
+    LOG_I("Resetting WiFi to default");
     VSsi[0] = WIFI_SSI1;
     VPwd[0] = WIFI_PWD1;
-    preferences.putString(NSsi[0].c_str(), VSsi[0]);
-    preferences.putString(NPwd[0].c_str(), VPwd[0]);
   }
 
   return rc;
 }
 
 /*
- * RETRIEVE_CONFIG
+ * RETRIEVE_LEGACY_CONFIG
  *
- * Load and check parameters from non volatile storage
+ * Load parameters saved in the former layout (one string per parameter)
  */
-void retrieve_config ( void )
+static void retrieve_legacy_config ( void )
 {
   String s;
   int    i;
-  
-  // Retrieve data from remanent backup
-  preferences.begin(NVSNAME, false);
-
-  // Check if NVS has already been init (occurs only once, but avoid tons of log messages)
-  s = preferences.getString(NM_INIT, "");
-  if ( s == "" )
-  {
-    // Clear NVS and recreate default entries
-    clean_nvs();
-  }
 
   for (i=0 ; i<MX_LOC ; i++)
   {
@@ -644,8 +935,89 @@ void retrieve_config ( void )
   s = preferences.getString(NM_WICTEMP, String(DEF_WICTEMP));
   WicTemp = s.toInt();
   WicTempChecked = (WicTemp) ? "checked" : "";
+}
+
+/*
+ * REMOVE_LEGACY_CONFIG
+ *
+ * Remove the entries of the former layout, once the blob is saved
+ * (NM_INIT last: it tells that they are present)
+ */
+static void remove_legacy_config ( void )
+{
+  static const char * const parms[] = {
+    NM_THR, NM_TOFF, NM_BED, NM_WAK, NM_SLP, NM_HNB, NM_MRT, NM_MAT,
+    NM_WAT, NM_WGT, NM_HTO, NM_RER, NM_WIC, NM_WICTEMP, NM_INIT
+  };
+  int i;
+
+  for (i=0 ; i<MX_LOC ; i++)
+  {
+    preferences.remove(NLoc[i].c_str());
+    preferences.remove(NLat[i].c_str());
+    preferences.remove(NLon[i].c_str());
+  }
+  preferences.remove(NDloc.c_str());
+  for (i=0 ; i<MX_SSI ; i++)
+  {
+    preferences.remove(NSsi[i].c_str());
+    preferences.remove(NPwd[i].c_str());
+  }
+  for (i=0 ; i<(int)(sizeof(parms)/sizeof(parms[0])) ; i++)
+    preferences.remove(parms[i]);
+}
+
+/*
+ * RETRIEVE_CONFIG
+ *
+ * Load and check parameters from non volatile storage
+ */
+void retrieve_config ( void )
+{
+  // Timer wake-up: the image in RTC memory is what NVS holds, unless NVS
+  // was modified since it was saved (NVS is read on power-up and manual
+  // wake-up)
+  if ( (esp_sleep_get_wakeup_cause() == ESP_SLEEP_WAKEUP_TIMER) &&
+       (cfg_saved_gen == cfg_gen)                               &&
+       config_valid(&cfg_saved) )
+  {
+    config_unpack(&cfg_saved);
+    LOG_I("Config: generation %u from RTC memory", cfg_gen);
+    return;
+  }
+
+  // Retrieve data from remanent backup
+  preferences.begin(NVSNAME, false);
+
+  if ( preferences.isKey(CFG_KEY)                                        &&
+      (preferences.getBytes(CFG_KEY, &cfg_saved, sizeof(cfg_saved))
+                                                      == sizeof(cfg_saved)) &&
+      config_valid(&cfg_saved) )
+  {
+    config_unpack(&cfg_saved);
+    cfg_saved_gen = cfg_gen;
+  }
+  else
+  {
+    // Former layout (converted once), or first start (defaults)
+    memset(&cfg_saved, 0, sizeof(cfg_saved));
+    if ( preferences.isKey(NM_INIT) )
+    {
+      LOG_I("Config: converting NVS layout");
+      retrieve_legacy_config();
+      check_config();
+      if ( config_commit() )
+        remove_legacy_config();
+      return;
+    }
+
+    LOG_W("Config: no valid NVS entry, using defaults");
+    DefLoc = "0";
+    defloc = 0;
+  }
 
   check_config();
+  config_commit();
 }
 
 /*
@@ -662,14 +1034,10 @@ void reset_weather_config ( void )
     VLoc[i] = i ? "" : DEFCITY;
     VLat[i] = i ? "" : DEFLAT;
     VLon[i] = i ? "" : DEFLON;
-    preferences.putString(NLoc[i].c_str(), VLoc[i]);
-    preferences.putString(NLat[i].c_str(), VLat[i]);
-    preferences.putString(NLon[i].c_str(), VLon[i]);
   }
 
   defloc = 0;
   DefLoc = "0";
-  preferences.putString(NDloc.c_str(), DefLoc);
 }
 
 /*
@@ -685,8 +1053,6 @@ void reset_wifi_config ( void )
   {
     VSsi[i] = i ? "" : WIFI_SSI1;
     VPwd[i] = i ? "" : WIFI_PWD1;
-    preferences.putString(NSsi[i].c_str(), VSsi[i]);
-    preferences.putString(NPwd[i].c_str(), VPwd[i]);
   }
 
   check_config();
@@ -700,35 +1066,21 @@ void reset_wifi_config ( void )
 void reset_parm_config ( void )
 {
   PopTh = PRECIP_THRESHOLD;
-  preferences.putString(NM_THR, String(PopTh));
   Toff = 0;
-  preferences.putString(NM_TOFF, String(Toff));
   BedTime = DEFBED;
-  preferences.putString(NM_BED, String(BedTime));
   WakeTime = DEFWAKE;
-  preferences.putString(NM_WAK, String(WakeTime));
   SleepDly = DEFSLEEP;
-  preferences.putString(NM_SLP, String(SleepDly));
   HourlyNb = DEFHOURNB;
-  preferences.putString(NM_HNB, String(HourlyNb));
   MinRefTim = DEF_MINREF_TIM;
-  preferences.putString(NM_MRT, String(MinRefTim));
   MaxActTim = DEF_MAXACT_TIM;
-  preferences.putString(NM_MAT, String(MaxActTim));
   WifiAPto = DEF_AP_TIMEOUT;
-  preferences.putString(NM_WAT, String(WifiAPto));
   WifiTimeout = DEF_WIFI_TIMEOUT;
-  preferences.putString(NM_WGT, String(WifiTimeout));
   HttpTimeout = DEF_HTTP_TIMEOUT;
-  preferences.putString(NM_HTO, String(HttpTimeout));
   RerFlg = DEF_RER;
   RerChecked = (RerFlg) ? "checked" : "";
-  preferences.putString(NM_RER, String(RerFlg));
   WicFlg = DEF_WIC;
-  preferences.putString(NM_WIC, String(WicFlg));
   WicChecked = (WicFlg) ? "checked" : "";
   WicTemp = DEF_WICTEMP;
-  preferences.putString(NM_WICTEMP, String(WicTemp));
   WicTempChecked = (WicTemp) ? "checked" : "";
 }
 
@@ -764,17 +1116,12 @@ static int check_remoteLogged ( IPAddress *rem )
   {
     if ( remlog[i] == *rem )
     {
-      Serial.print("IP address: ");
-      Serial.print(*rem);
-      Serial.print(" found at entry ");
-      Serial.println(i);
+      LOG_I("IP address: %s found at entry %d", rem->toString().c_str(), i);
       return 1;
     }
   }
 
-  Serial.print("IP address: ");
-  Serial.print(*rem);
-  Serial.println(" not found");
+  LOG_I("IP address: %s not found", rem->toString().c_str());
   return 0;
 }
 
@@ -805,10 +1152,7 @@ static void log_remote ( IPAddress *rem )
 
   remlog[f] = *rem;
 
-  Serial.print("Backup IP address: ");
-  Serial.print(*rem);
-  Serial.print(" at entry ");
-  Serial.println(f);
+  LOG_I("Backup IP address: %s at entry %d", rem->toString().c_str(), f);
 }
 
 #ifdef WEBKEY
@@ -843,8 +1187,53 @@ const String MAIN_PAGE = "<!DOCTYPE HTML><html><head>"
                   "<a href=\"/parm\">"+W_PARMV+"</a><br><br>"
 #ifdef USE_OTA
                   "<a href=\"/ota\">"+W_SOFTUPD+"</a><br><br>"
+#endif
+#ifdef RENDER_PROFILER
+                  "<a href=\"/profile\">Render profile</a><br><br>"
+#endif
+#ifdef WEB_UI
+                  "<a href=\"/ui\">Configuration UI</a><br><br>"
+#endif
+#ifdef WEB_PREVIEW
+                  "<a href=\"/preview\">Preview</a><br><br>"
 #endif
                   "</body></html>";
+#ifdef WEB_PREVIEW
+// Draws /preview.pbm in a canvas
+const String PREVIEW_PAGE = "<!DOCTYPE HTML><html><head>"
+                  "<title>"+W_WEATHER+"</title>"
+                  "<meta name=\"viewport\" content=\"width=device-width, initial-scale=1\">"
+                  "<style>canvas {max-width:100%;border:1px solid #888;}</style>"
+                  "</head><body>"
+                  "<h1>"+W_WEATHER+"</h1>"
+                  "<canvas id=\"c\" width=\"0\" height=\"0\"></canvas>"
+                  "<p id=\"m\"></p>"
+                  "<button onclick=\"show('?render')\">Render</button> "
+                  "<button onclick=\"show('')\">Panel</button><br><br>"
+                  "<a href=\"/\">"+W_RETURN+"</a>"
+                  "<script>"
+                  "async function show(q){"
+                    "const m=document.getElementById('m');"
+                    "m.textContent='...';"
+                    "const r=await fetch('/preview.pbm'+q,{cache:'no-store'});"
+                    "if(!r.ok){m.textContent=r.status+' '+r.statusText;return;}"
+                    "const b=new Uint8Array(await r.arrayBuffer());"
+                    // P4 <width> <height>, each followed by one white space
+                    "let i=0;const f=[];"
+                    "while(f.length<3){let t='';while(b[i]>32)t+=String.fromCharCode(b[i++]);i++;f.push(t);}"
+                    "const w=+f[1],h=+f[2],s=(w+7)>>3,c=document.getElementById('c');"
+                    "c.width=w;c.height=h;"
+                    "const x=c.getContext('2d'),im=x.createImageData(w,h);"
+                    "for(let y=0;y<h;y++)for(let p=0;p<w;p++){"
+                      "const v=(b[i+y*s+(p>>3)]&(0x80>>(p&7)))?0:255,k=(y*w+p)*4;"
+                      "im.data[k]=im.data[k+1]=im.data[k+2]=v;im.data[k+3]=255;}"
+                    "x.putImageData(im,0,0);"
+                    "m.textContent='';"
+                  "}"
+                  "show('');"
+                  "</script>"
+                  "</body></html>";
+#endif
 #ifdef WEBKEY
 const String RSP_INVAL_KEY = "<!DOCTYPE HTML><html><head>"
                   "<meta name=\"viewport\" content=\"width=device-width, initial-scale=1\">"
@@ -883,6 +1272,11 @@ const String RSP_TERMACT1a_DONE = "<!DOCTYPE HTML><html><head>"
                   "<p>"+W_ACT_DONE_MAJ;
 const String RSP_TERMACT1b_DONE = " sec</p>"
                   "</body></html>";
+#ifdef WEB_APPLY_IN_PLACE
+const String RSP_TERMACT1c_DONE = " sec</p>"
+                  "<a href=\"/\">"+W_RETURN+"</a>"
+                  "</body></html>";
+#endif
 const String RSP_TERMACT2_DONE = "<!DOCTYPE HTML><html><head>"
                   "<meta name=\"viewport\" content=\"width=device-width, initial-scale=1\">"
                   "</head><body>"
@@ -890,6 +1284,543 @@ const String RSP_TERMACT2_DONE = "<!DOCTYPE HTML><html><head>"
                   "<p>"+W_ACT_DONE_SLP+"</p>"
                   "</body></html>";
 
+/*
+ * Configuration pages, streamed from templates (see web_template.h): the
+ * values are read from the parameters while the page is sent, the page
+ * itself is never built in RAM.
+ */
+#define PAGE_LINKS_OTA "<a href=\"/ota\">%softupd%</a><br><br>"
+
+static const char WEATHER_HEAD[] =
+      "<!DOCTYPE HTML><html><head>"
+      "<style>"
+      ".lloc {display:inline-block;min-width:50px;width:auto;margin-left:10px;;margin-right:10px;}"
+      ".loc {width:130px;margin-top:8px;}"
+      ".llat {display:inline-block;width:80px;text-align:center;}"
+      ".llon {display:inline-block;width:60px;text-align:center;}"
+      ".geo {width:60px;margin-top:8px;text-align:center;}"
+      ".p1 {max-width:550px;}"
+      ".p2 {max-width:550px;}"
+      ".rst {float:right;}"
+      "@media only screen and (max-width: 550px) {.p1 {max-width:320px;}"
+      ".llat {display:inline-block;width:83px;margin-left:11px;text-align:center;}}"
+      ".llon {display:inline-block;width:83px;text-align:center;}}"
+      "</style>"
+      "<title>%parmm%</title>"
+      "<meta name=\"viewport\" content=\"width=device-width, initial-scale=1\">"
+      "</head><body>"
+      "<h1>%parmm%</h1>"
+      "<form action=\"/weather_get\" method=\"get\">"
+        "<div class=\"p1\">";
+static const char WEATHER_ROW[] =
+        "<input type=\"radio\" id=\"def%n%\" name=\"DefLoc\" value=\"%i%\" %checked%>"
+        "<label for=\"loc%n%\" class=\"lloc\">Loc %n%</label>"
+        "<input type=\"text\" class=\"loc\" id=\"loc%n%\" name=\"%nloc%\" value=\"%loc%\" maxlength=30>"
+        "<label for=\"lat%n%\" class=\"llat\">Lat %n%</label>"
+        "<input type=\"text\" class=\"geo\" id=\"lat%n%\" name=\"%nlat%\" value=\"%lat%\" >"
+        "<label for=\"long%n%\" class=\"llon\">Lon %n%</label>"
+        "<input type=\"text\" class=\"geo\" id=\"long%n%\" name=\"%nlon%\" value=\"%lon%\" ><br>";
+static const char WEATHER_TAIL[] =
+        "<br>"
+        "</div>"
+        "<div class=\"p2\">"
+        "<a href=\"/wifi\">%parmw%</a>"
+        "<a href=\"/weather_reset\" class=\"rst\">%reinitm%</a><br><br>"
+        "<a href=\"/parm\">%parmv%</a><br><br>"
+#ifdef USE_OTA
+        PAGE_LINKS_OTA
+#endif
+        "<input type=\"submit\" value=\"%submit%\">"
+        "</div>"
+      "</form>"
+      "</body></html>";
+static const web_tpl_section_t WEATHER_PAGE[] = {
+  {WEATHER_HEAD, 1},
+  {WEATHER_ROW,  MX_LOC},
+  {WEATHER_TAIL, 1},
+  {nullptr,      0}
+};
+
+static const char WIFI_HEAD[] =
+      "<!DOCTYPE HTML><html><head>"
+      "<style>"
+      "label {display:inline-block;width:80px;text-align:center;}"
+      "input[type=text] {width:150px;;margin-top:10px;}"
+      ".p1 {max-width:520px;}"
+      ".p2 {max-width:520px;}"
+      ".rst {float:right;}"
+      "@media only screen and (max-width: 460px) {.p1 {max-width:300px;}}"
+      "</style>"
+      "<title>%parmw%</title>"
+      "<meta name=\"viewport\" content=\"width=device-width, initial-scale=1\">"
+      "</head><body>"
+      "<h1>%parmw%</h1>"
+      "<form action=\"/wifi_get\" method=\"get\">"
+        "<div class=\"p1\">";
+static const char WIFI_ROW[] =
+        "<label for=\"ssi%n%\">SSID %n%</label>"
+        "<input type=\"text\" class=\"ssi\" id=\"ssi%n%\" name=\"%nssi%\" value=\"%ssi%\">"
+        "<label for=\"pwd%n%\">PWD %n%</label>"
+        "<input type=\"" TAGPWD "\" class=\"pwd\" id=\"pwd%n%\" name=\"%npwd%\" value=\"%pwd%\"><br>";
+static const char WIFI_TAIL[] =
+        "<br>"
+        "</div>"
+        "<div class=\"p2\">"
+        "<a href=\"/wifi_reset\" class=\"rst\">%reinitw%</a>"
+        "<a href=\"/weather\">%parmm%</a><br><br>"
+        "<a href=\"/parm\">%parmv%</a><br><br>"
+#ifdef USE_OTA
+        PAGE_LINKS_OTA
+#endif
+        "<input type=\"submit\" value=\"%submit%\">"
+        "</div>"
+      "</form>"
+      "</body></html>";
+static const web_tpl_section_t WIFI_PAGE[] = {
+  {WIFI_HEAD, 1},
+  {WIFI_ROW,  MX_SSI},
+  {WIFI_TAIL, 1},
+  {nullptr,   0}
+};
+
+static const char PARM_BODY[] =
+      "<!DOCTYPE HTML><html><head>"
+      "<meta name=\"viewport\" content=\"width=device-width, initial-scale=1\">"
+      "<style>"
+      ".p1 {max-width:520px;}"
+      ".l1 {display:inline-block;width:180px;margin-left:8px}"
+      ".l2 {display:inline-block;margin-left:8px}"
+      "input[type=number] {width:60px;margin-top:10px;text-align:center;}"
+      ".rst {float:right;}"
+      "</style>"
+      "<title>%parmv%</title>"
+      "</head><body>"
+      "<h1>%parmv%</h1>"
+      "<form action=\"/parm_get\" method=\"get\">"
+        "<div class=\"p1\">"
+        "<label for=\"popth\" class=\"l1\">%popthr%</label>"
+        "<input type=\"number\" class=\"num\" id=\"popth\" name=\"" NM_THR "\" value=\"%" NM_THR "%\" "
+          "min=0 max=1 step=0.01>"
+        "<label for=\"popth\" class=\"l2\">%%</label><br>"
+        "<label for=\"tempoff\" class=\"l1\">%toff%</label>"
+        "<input type=\"number\" class=\"num\" id=\"tempoff\" name=\"" NM_TOFF "\" value=\"%" NM_TOFF "%\" "
+          "min=-4 max=4 step=0.1>"
+        "<label for=\"tempoff\" class=\"l2\">\260</label><br>"
+        "<label for=\"bed\" class=\"l1\">%bedtim%</label>"
+        "<input type=\"number\" class=\"num\" id=\"bed\" name=\"" NM_BED "\" value=\"%" NM_BED "%\" "
+          "min=0 max=23 step=1>"
+        "<label for=\"bed\" class=\"l2\">H</label><br>"
+        "<label for=\"wake\" class=\"l1\">%waktim%</label>"
+        "<input type=\"number\" class=\"num\" id=\"wake\" name=\"" NM_WAK "\" value=\"%" NM_WAK "%\" "
+          "min=0 max=23 step=1>"
+        "<label for=\"wake\" class=\"l2\">H</label><br>"
+        "<label for=\"sleep\" class=\"l1\">%slpdly%</label>"
+        "<input type=\"number\" class=\"num\" id=\"sleep\" name=\"" NM_SLP "\" value=\"%" NM_SLP "%\" "
+          "min=10 max=60 step=10>"
+        "<label for=\"sleep\" class=\"l2\">min</label><br>"
+        "<label for=\"hrnb\" class=\"l1\">%hournb%</label>"
+        "<input type=\"number\" class=\"num\" id=\"hrnb\" name=\"" NM_HNB "\" value=\"%" NM_HNB "%\" "
+          "min=8 max=48 step=1>"
+        "<label for=\"hrnb\" class=\"l2\">H</label><br>"
+        "<label for=\"minr\"class=\"l1\">%majmin%</label>"
+        "<input type=\"number\" class=\"num\" id=\"minr\" name=\"" NM_MRT "\" value=\"%" NM_MRT "%\" "
+          "min=60 max=300 step=1>"
+        "<label for=\"minr\" class=\"l2\">sec</label><br>"
+        "<label for=\"maxa\" class=\"l1\">%webdly%</label>"
+        "<input type=\"number\" class=\"num\" id=\"maxa\" name=\"" NM_MAT "\" value=\"%" NM_MAT "%\" "
+          "min=60 max=600 step=1>"
+        "<label for=\"maxa\" class=\"l2\">sec</label><br>"
+        "<label for=\"hto\" class=\"l1\">%hto%</label>"
+        "<input type=\"number\" class=\"num\" id=\"hto\" name=\"" NM_HTO "\" value=\"%" NM_HTO "%\" >"
+        "<label for=\"hto\" class=\"l2\">msec</label><br>"
+        "<label for=\"wato\" class=\"l1\">%wato%</label>"
+        "<input type=\"number\" class=\"num\" id=\"wato\" name=\"" NM_WAT "\" value=\"%" NM_WAT "%\" >"
+        "<label for=\"wato\" class=\"l2\">msec</label><br>"
+        "<label for=\"wgto\" class=\"l1\">%wgto%</label>"
+        "<input type=\"number\" class=\"num\" id=\"wgto\" name=\"" NM_WGT "\" value=\"%" NM_WGT "%\" >"
+        "<label for=\"wgto\" class=\"l2\">msec</label><br><br>"
+        "<label for=\"wgto\" class=\"l2\">%wtorec%</label><br><br>"
+        "<label for=\"RerFlg\" class=\"l1\">%rerflg%</label>"
+        "<input type=\"checkbox\" id=\"RerFlg\" name=\"" NM_RER "\" value=active %" NM_RER "%><br><br>"
+        "<label for=\"WicFlg\" class=\"l1\">%wicflg%</label>"
+        "<input type=\"checkbox\" id=\"WicFlg\" name=\"" NM_WIC "\" value=active %" NM_WIC "%><br><br>"
+        "<label for=\"WicTemp\" class=\"l1\">%wictemp%</label>"
+        "<input type=\"checkbox\" id=\"WicTemp\" name=\"" NM_WICTEMP "\" value=active %" NM_WICTEMP "%><br><br>"
+        "<a href=\"/parm_reset\" class=\"rst\">%reinitv%</a>"
+        "<a href=\"/weather\">%parmm%</a><br><br>"
+        "<a href=\"/wifi\">%parmw%</a><br><br>"
+#ifdef USE_OTA
+        PAGE_LINKS_OTA
+#endif
+        "<input type=\"submit\" value=\"%submit%\">"
+        "</div>"
+      "</form>"
+      "</body></html>";
+static const web_tpl_section_t PARM_PAGE[] = {
+  {PARM_BODY, 1},
+  {nullptr,   0}
+};
+
+/*
+ * PAGE_VALUE
+ *
+ * Placeholders shared by the pages: row numbers and locale strings
+ */
+static const char *page_value ( const char *name, size_t len, uint8_t row,
+                                char *scratch )
+{
+  static const struct
+  {
+    const char   *name;
+    const String &text;
+  } texts[] = {
+    {"parmm",   W_PARMM},   {"parmw",   W_PARMW},   {"parmv",   W_PARMV},
+    {"reinitm", W_REINITM}, {"reinitw", W_REINITW}, {"reinitv", W_REINITV},
+    {"softupd", W_SOFTUPD}, {"submit",  W_SUBMIT},  {"popthr",  W_POPTHR},
+    {"toff",    W_TOFF},    {"bedtim",  W_BEDTIM},  {"waktim",  W_WAKTIM},
+    {"slpdly",  W_SLPDLY},  {"hournb",  W_HOURNB},  {"majmin",  W_MAJMIN},
+    {"webdly",  W_WEBDLY},  {"hto",     W_HTO},     {"wato",    W_WATO},
+    {"wgto",    W_WGTO},    {"wtorec",  W_WTOREC},  {"rerflg",  W_RERFLG},
+    {"wicflg",  W_WICFLG},  {"wictemp", W_WICTEMP},
+  };
+
+  // row number, from 0 (i) or 1 (n)
+  if ( webTplIs(name, len, "i") || webTplIs(name, len, "n") )
+  {
+    snprintf(scratch, WEB_TPL_SCRATCH, "%d", row + (name[0] == 'n'));
+    return scratch;
+  }
+  for (const auto &t : texts)
+    if ( webTplIs(name, len, t.name) )
+      return t.text.c_str();
+  return nullptr;
+}
+
+/*
+ * WEATHER_VALUE, WIFI_VALUE, PARM_VALUE
+ *
+ * Placeholders of each page
+ */
+static const char *weather_value ( const char *name, size_t len, uint8_t row,
+                                   char *scratch )
+{
+  if ( webTplIs(name, len, "checked") ) return Lchecked[row].c_str();
+  if ( webTplIs(name, len, "nloc") )    return NLoc[row].c_str();
+  if ( webTplIs(name, len, "loc") )     return VLoc[row].c_str();
+  if ( webTplIs(name, len, "nlat") )    return NLat[row].c_str();
+  if ( webTplIs(name, len, "lat") )     return VLat[row].c_str();
+  if ( webTplIs(name, len, "nlon") )    return NLon[row].c_str();
+  if ( webTplIs(name, len, "lon") )     return VLon[row].c_str();
+  return page_value(name, len, row, scratch);
+}
+
+static const char *wifi_value ( const char *name, size_t len, uint8_t row,
+                                char *scratch )
+{
+  if ( webTplIs(name, len, "nssi") ) return NSsi[row].c_str();
+  if ( webTplIs(name, len, "ssi") )  return VSsi[row].c_str();
+  if ( webTplIs(name, len, "npwd") ) return NPwd[row].c_str();
+  if ( webTplIs(name, len, "pwd") )  return VPwd[row].c_str();
+  return page_value(name, len, row, scratch);
+}
+
+static const char *parm_value ( const char *name, size_t len, uint8_t row,
+                                char *scratch )
+{
+  // same formats as String()
+  if ( webTplIs(name, len, NM_THR) )
+    snprintf(scratch, WEB_TPL_SCRATCH, "%.2f", PopTh);
+  else if ( webTplIs(name, len, NM_TOFF) )
+    snprintf(scratch, WEB_TPL_SCRATCH, "%.2f", Toff);
+  else if ( webTplIs(name, len, NM_BED) )
+    snprintf(scratch, WEB_TPL_SCRATCH, "%d", BedTime);
+  else if ( webTplIs(name, len, NM_WAK) )
+    snprintf(scratch, WEB_TPL_SCRATCH, "%d", WakeTime);
+  else if ( webTplIs(name, len, NM_SLP) )
+    snprintf(scratch, WEB_TPL_SCRATCH, "%ld", SleepDly);
+  else if ( webTplIs(name, len, NM_HNB) )
+    snprintf(scratch, WEB_TPL_SCRATCH, "%d", HourlyNb);
+  else if ( webTplIs(name, len, NM_MRT) )
+    snprintf(scratch, WEB_TPL_SCRATCH, "%d", MinRefTim);
+  else if ( webTplIs(name, len, NM_MAT) )
+    snprintf(scratch, WEB_TPL_SCRATCH, "%d", MaxActTim);
+  else if ( webTplIs(name, len, NM_HTO) )
+    snprintf(scratch, WEB_TPL_SCRATCH, "%u", HttpTimeout);
+  else if ( webTplIs(name, len, NM_WAT) )
+    snprintf(scratch, WEB_TPL_SCRATCH, "%u", WifiAPto);
+  else if ( webTplIs(name, len, NM_WGT) )
+    snprintf(scratch, WEB_TPL_SCRATCH, "%lu", WifiTimeout);
+  else if ( webTplIs(name, len, NM_RER) )
+    return RerChecked.c_str();
+  else if ( webTplIs(name, len, NM_WIC) )
+    return WicChecked.c_str();
+  else if ( webTplIs(name, len, NM_WICTEMP) )
+    return WicTempChecked.c_str();
+  else
+    return page_value(name, len, row, scratch);
+  return scratch;
+}
+
+/*
+ * SEND_TEMPLATE
+ *
+ * Sends a page with a chunked response: each chunk is rendered into the buffer
+ * the server sends from, whose size is bounded by the TCP send window.
+ */
+static void send_template ( AsyncWebServerRequest *request,
+                            const web_tpl_section_t *page,
+                            web_tpl_value_t value )
+{
+  WebTemplate tpl(page, value);
+  request->send(request->beginChunkedResponse("text/html",
+    [tpl](uint8_t *buf, size_t maxLen, size_t) mutable -> size_t {
+      return tpl.read(buf, maxLen);
+    }));
+}
+
+#ifdef WEB_UI
+/*
+ * SEND_UI_FILE
+ *
+ * Sends a file of the UI as stored (gzip), or 304 when the browser already
+ * has it
+ */
+static void send_ui_file ( AsyncWebServerRequest *request,
+                           const web_ui_file_t *file )
+{
+  AsyncWebServerResponse *response;
+
+  if ( request->hasHeader("If-None-Match") &&
+       (request->header("If-None-Match") == web_ui_etag) )
+    response = request->beginResponse(304);
+  else
+  {
+    response = request->beginResponse(200, file->type, file->data, file->len);
+    response->addHeader("Content-Encoding", "gzip");
+  }
+  response->addHeader("ETag", web_ui_etag);
+  response->addHeader("Cache-Control", "no-cache");
+  request->send(response);
+}
+#endif // WEB_UI
+
+/*
+ * CONFIG_TO_JSON
+ *
+ * Current parameters, as sent by GET /api/config (and read by the UI)
+ * Strings are sent as stored, i.e. as entered through the Web pages
+ */
+static void config_to_json ( JsonDocument &doc )
+{
+  int i;
+
+  doc["defloc"] = defloc;
+  JsonArray loc = doc["loc"].to<JsonArray>();
+  for (i=0 ; i<MX_LOC ; i++)
+  {
+    JsonObject l = loc.add<JsonObject>();
+    l["name"] = VLoc[i];
+    l["lat"]  = VLat[i];
+    l["lon"]  = VLon[i];
+  }
+  JsonArray wifi = doc["wifi"].to<JsonArray>();
+  for (i=0 ; i<MX_SSI ; i++)
+  {
+    JsonObject w = wifi.add<JsonObject>();
+    w["ssid"] = VSsi[i];
+    w["pwd"]  = VPwd[i];
+  }
+
+  JsonObject parm = doc["parm"].to<JsonObject>();
+  parm[NM_THR]     = PopTh;
+  parm[NM_TOFF]    = Toff;
+  parm[NM_BED]     = BedTime;
+  parm[NM_WAK]     = WakeTime;
+  parm[NM_SLP]     = SleepDly;
+  parm[NM_HNB]     = HourlyNb;
+  parm[NM_MRT]     = MinRefTim;
+  parm[NM_MAT]     = MaxActTim;
+  parm[NM_HTO]     = HttpTimeout;
+  parm[NM_WAT]     = WifiAPto;
+  parm[NM_WGT]     = WifiTimeout;
+  parm[NM_RER]     = RerFlg;
+  parm[NM_WIC]     = WicFlg;
+  parm[NM_WICTEMP] = WicTemp;
+
+#ifdef USE_OTA
+  doc["ota"] = true;
+#else
+  doc["ota"] = false;
+#endif
+#ifdef WEB_HIDE_PWD
+  doc["hidepwd"] = true;
+#else
+  doc["hidepwd"] = false;
+#endif
+#ifdef WEB_PREVIEW
+  doc["preview"] = true;
+#else
+  doc["preview"] = false;
+#endif
+}
+
+/*
+ * JSON_STR / JSON_NUM / JSON_FLAG
+ *
+ * Check a member of a configuration document and store it in dst (when not
+ * nullptr). An absent member is valid and leaves dst unchanged. Strings
+ * shall fit in size bytes (see cfg_blob_t).
+ */
+static bool json_str ( JsonVariantConst v, size_t size, String *dst )
+{
+  if ( v.isNull() )
+    return true;
+  if ( !v.is<const char *>() || (strlen(v.as<const char *>()) >= size) )
+    return false;
+  if ( dst )
+    *dst = v.as<const char *>();
+  return true;
+}
+
+template <typename T>
+static bool json_num ( JsonVariantConst v, double lo, double hi, T *dst )
+{
+  if ( v.isNull() )
+    return true;
+  if ( !v.is<double>() || (v.as<double>() < lo) || (v.as<double>() > hi) )
+    return false;
+  if ( dst )
+    *dst = (T)v.as<double>();
+  return true;
+}
+
+static bool json_flag ( JsonVariantConst v, unsigned int *dst, String *checked )
+{
+  if ( v.isNull() )
+    return true;
+  if ( !v.is<bool>() && !v.is<int>() )
+    return false;
+  if ( dst )
+  {
+    *dst     = (v.is<bool>() ? v.as<bool>() : (v.as<int>() != 0)) ? 1 : 0;
+    *checked = (*dst) ? "checked" : "";
+  }
+  return true;
+}
+
+/*
+ * CONFIG_FROM_JSON
+ *
+ * Apply a configuration document (same layout as CONFIG_TO_JSON, members
+ * may be omitted, "ota", "hidepwd" and "preview" are ignored). Called first with apply false, to check the whole
+ * document, then with apply true, so that a document is applied entirely
+ * or not at all.
+ * Returns nullptr, or the name of the first invalid member
+ */
+static const char *config_from_json ( JsonVariantConst doc, bool apply )
+{
+  int  i;
+  bool ok;
+
+  if ( !doc.is<JsonObjectConst>() )
+    return "document";
+
+  if ( !doc["defloc"].isNull() )
+  {
+    if ( !json_num(doc["defloc"], 0, MX_LOC - 1, (int *)nullptr) )
+      return "defloc";
+    if ( apply )
+    {
+      Lchecked[defloc] = "";
+      defloc = doc["defloc"].as<int>();
+      DefLoc = String(defloc);
+      Lchecked[defloc] = "checked";
+    }
+  }
+
+  JsonVariantConst loc = doc["loc"];
+  if ( !loc.isNull() )
+  {
+    if ( !loc.is<JsonArrayConst>() || (loc.size() > MX_LOC) )
+      return "loc";
+    for (i=0 ; i<(int)loc.size() ; i++)
+    {
+      ok = json_str(loc[i]["name"], CFG_LOC_LEN, apply ? &VLoc[i] : nullptr) &&
+           json_str(loc[i]["lat"],  CFG_GEO_LEN, apply ? &VLat[i] : nullptr) &&
+           json_str(loc[i]["lon"],  CFG_GEO_LEN, apply ? &VLon[i] : nullptr);
+      if ( !ok )
+        return "loc";
+    }
+  }
+
+  JsonVariantConst wifi = doc["wifi"];
+  if ( !wifi.isNull() )
+  {
+    if ( !wifi.is<JsonArrayConst>() || (wifi.size() > MX_SSI) )
+      return "wifi";
+    for (i=0 ; i<(int)wifi.size() ; i++)
+    {
+      ok = json_str(wifi[i]["ssid"], CFG_SSI_LEN, apply ? &VSsi[i] : nullptr) &&
+           json_str(wifi[i]["pwd"],  CFG_PWD_LEN, apply ? &VPwd[i] : nullptr);
+      if ( !ok )
+        return "wifi";
+    }
+  }
+
+  // Same ranges as the parameters page
+  JsonVariantConst parm = doc["parm"];
+  if ( !parm.isNull() && !parm.is<JsonObjectConst>() )
+    return "parm";
+  if ( !json_num(parm[NM_THR], 0, 1, apply ? &PopTh : nullptr) )
+    return NM_THR;
+  if ( !json_num(parm[NM_TOFF], -4, 4, apply ? &Toff : nullptr) )
+    return NM_TOFF;
+  if ( !json_num(parm[NM_BED], 0, 23, apply ? &BedTime : nullptr) )
+    return NM_BED;
+  if ( !json_num(parm[NM_WAK], 0, 23, apply ? &WakeTime : nullptr) )
+    return NM_WAK;
+  if ( !json_num(parm[NM_SLP], 10, 60, apply ? &SleepDly : nullptr) )
+    return NM_SLP;
+  if ( !json_num(parm[NM_HNB], 8, 48, apply ? &HourlyNb : nullptr) )
+    return NM_HNB;
+  if ( !json_num(parm[NM_MRT], 60, 300, apply ? &MinRefTim : nullptr) )
+    return NM_MRT;
+  if ( !json_num(parm[NM_MAT], 60, 600, apply ? &MaxActTim : nullptr) )
+    return NM_MAT;
+  if ( !json_num(parm[NM_HTO], 0, UINT_MAX, apply ? &HttpTimeout : nullptr) )
+    return NM_HTO;
+  if ( !json_num(parm[NM_WAT], 0, UINT_MAX, apply ? &WifiAPto : nullptr) )
+    return NM_WAT;
+  if ( !json_num(parm[NM_WGT], 0, UINT_MAX, apply ? &WifiTimeout : nullptr) )
+    return NM_WGT;
+  if ( !json_flag(parm[NM_RER], apply ? &RerFlg : nullptr, &RerChecked) )
+    return NM_RER;
+  if ( !json_flag(parm[NM_WIC], apply ? &WicFlg : nullptr, &WicChecked) )
+    return NM_WIC;
+  if ( !json_flag(parm[NM_WICTEMP], apply ? &WicTemp : nullptr,
+                  &WicTempChecked) )
+    return NM_WICTEMP;
+
+  return nullptr;
+}
+
+/*
+ * SEND_CONFIG
+ *
+ * Send the current parameters as JSON
+ */
+static void send_config ( AsyncWebServerRequest *request )
+{
+  JsonDocument doc;
+  config_to_json(doc);
+
+  AsyncResponseStream *response =
+    request->beginResponseStream("application/json");
+  response->addHeader("Cache-Control", "no-store");
+  serializeJson(doc, *response);
+  request->send(response);
+}
+
 /*
  * PAGE_LOST
  *
@@ -901,8 +1832,7 @@ void page_lost ( AsyncWebServerRequest *request )
   request->send(200, "text/html", RSP_INVAL_KEY);
 #else
   IPAddress ip = request->client()->remoteIP();
-  Serial.print("Validate IP address: ");
-  Serial.println(ip);
+  LOG_I("Validate IP address: %s", ip.toString().c_str());
   log_remote(&ip);
 
   request->send(200, "text/html", MAIN_PAGE);
@@ -918,6 +1848,9 @@ void web_svr_setup ( void )
 {
   Lchecked[defloc] = "checked";
 
+  cfg_lock     = xSemaphoreCreateMutex();
+  cfg_nvs_lock = xSemaphoreCreateMutex();
+
 #ifdef WEBKEY
   // Init web page with input fields to client
   server.on("/", HTTP_GET, [](AsyncWebServerRequest *request) {
@@ -929,8 +1862,7 @@ void web_svr_setup ( void )
         (request->getParam("key")->value() == WEBKEY) )
     {
       IPAddress ip = request->client()->remoteIP();
-      Serial.print("Valid key from IP address: ");
-      Serial.println(ip);
+      LOG_I("Valid key from IP address: %s", ip.toString().c_str());
       log_remote(&ip);
 
       request->send(200, "text/html", MAIN_PAGE);
@@ -941,8 +1873,7 @@ void web_svr_setup ( void )
 #else
   server.on("/", HTTP_GET, [] (AsyncWebServerRequest *request) {
     IPAddress ip = request->client()->remoteIP();
-    Serial.print("Validate IP address: ");
-    Serial.println(ip);
+    LOG_I("Validate IP address: %s", ip.toString().c_str());
     log_remote(&ip);
 
     request->send(200, "text/html", MAIN_PAGE);
@@ -954,103 +1885,7 @@ void web_svr_setup ( void )
     IPAddress ip = request->client()->remoteIP();
     if ( check_remoteLogged(&ip) )
     {
-      request->send(200, "text/html",
-      "<!DOCTYPE HTML><html><head>"
-      "<style>"
-      //".lloc {display:inline-block;width:60px;margin-left:10px;}" 
-      ".lloc {display:inline-block;min-width:50px;width:auto;margin-left:10px;;margin-right:10px;}" 
-      ".loc {width:130px;margin-top:8px;}" 
-      ".llat {display:inline-block;width:80px;text-align:center;}" 
-      ".llon {display:inline-block;width:60px;text-align:center;}" 
-      ".geo {width:60px;margin-top:8px;text-align:center;}" 
-      ".p1 {max-width:550px;}" 
-      ".p2 {max-width:550px;}" 
-      ".rst {float:right;}" 
-      "@media only screen and (max-width: 550px) {.p1 {max-width:320px;}"
-      ".llat {display:inline-block;width:83px;margin-left:11px;text-align:center;}}" 
-      ".llon {display:inline-block;width:83px;text-align:center;}}" 
-      "</style>"
-      "<title>"+W_PARMM+"</title>"
-      "<meta name=\"viewport\" content=\"width=device-width, initial-scale=1\">"
-      "</head><body>"
-      "<h1>"+W_PARMM+"</h1>"
-      "<form action=\"/weather_get\" method=\"get\">"
-        "<div class=\"p1\">"
-        "<input type=\"radio\" id=\"def1\" name=\"DefLoc\" value=\"0\" " + Lchecked[0] + ">"
-        "<label for=\"loc1\" class=\"lloc\">Loc 1</label>"
-        "<input type=\"text\" class=\"loc\" id=\"loc1\" name=\"" + NLoc[0] + "\" value=\"" + VLoc[0] + "\" maxlength=30>"
-        "<label for=\"lat1\" class=\"llat\">Lat 1</label>"
-        "<input type=\"text\" class=\"geo\" id=\"lat1\" name=\"" + NLat[0] + "\" value=\"" + VLat[0] + "\" " + ">"
-        "<label for=\"long1\" class=\"llon\">Lon 1</label>"
-        "<input type=\"text\" class=\"geo\" id=\"long\" name=\"" + NLon[0] + "\" value=\"" + VLon[0] + "\" " + "><br>"
-        "<input type=\"radio\" id=\"def2\" name=\"DefLoc\" value=\"1\" " + Lchecked[1] + ">"
-        "<label for=\"loc2\" class=\"lloc\">Loc 2</label>"
-        "<input type=\"text\" class=\"loc\" id=\"loc2\" name=\"" + NLoc[1] + "\" value=\"" + VLoc[1] + "\" maxlength=30>"
-        "<label for=\"lat2\" class=\"llat\">Lat 2</label>"
-        "<input type=\"text\" class=\"geo\" id=\"lat2\" name=\"" + NLat[1] + "\" value=\"" + VLat[1] + "\" " + ">"
-        "<label for=\"long2\" class=\"llon\">Lon 2</label>"
-        "<input type=\"text\" class=\"geo\" id=\"long2\" name=\"" + NLon[1] + "\" value=\"" + VLon[1] + "\" " + "><br>"
-        "<input type=\"radio\" id=\"def3\" name=\"DefLoc\" value=\"2\" " + Lchecked[2] + ">"
-        "<label for=\"loc3\" class=\"lloc\">Loc 3</label>"
-        "<input type=\"text\" class=\"loc\" id=\"loc3\" name=\"" + NLoc[2] + "\" value=\"" + VLoc[2] + "\" maxlength=30>"
-        "<label for=\"lat3\" class=\"llat\">Lat 3</label>"
-        "<input type=\"text\" class=\"geo\" id=\"lat3\" name=\"" + NLat[2] + "\" value=\"" + VLat[2] + "\" " + ">"
-        "<label for=\"long3\" class=\"llon\">Lon 3</label>"
-        "<input type=\"text\" class=\"geo\" id=\"long3\" name=\"" + NLon[2] + "\" value=\"" + VLon[2] + "\" " + "><br>"
-        "<input type=\"radio\" id=\"def4\" name=\"DefLoc\" value=\"3\" " + Lchecked[3] + ">"
-        "<label for=\"loc4\" class=\"lloc\">Loc 4</label>"
-        "<input type=\"text\" class=\"loc\" id=\"loc4\" name=\"" + NLoc[3] + "\" value=\"" + VLoc[3] + "\" maxlength=30>"
-        "<label for=\"lat4\" class=\"llat\">Lat 4</label>"
-        "<input type=\"text\" class=\"geo\" id=\"lat4\" name=\"" + NLat[3] + "\" value=\"" + VLat[3] + "\" " + ">"
-        "<label for=\"long4\" class=\"llon\">Lon 4</label>"
-        "<input type=\"text\" class=\"geo\" id=\"long4\" name=\"" + NLon[3] + "\" value=\"" + VLon[3] + "\" " + "><br>"
-        "<input type=\"radio\" id=\"def5\" name=\"DefLoc\" value=\"4\" " + Lchecked[4] + ">"
-        "<label for=\"loc5\" class=\"lloc\">Loc 5</label>"
-        "<input type=\"text\" class=\"loc\" id=\"loc5\" name=\"" + NLoc[4] + "\" value=\"" + VLoc[4] + "\" maxlength=30>"
-        "<label for=\"lat5\" class=\"llat\">Lat 5</label>"
-        "<input type=\"text\" class=\"geo\" id=\"lat5\" name=\"" + NLat[4] + "\" value=\"" + VLat[4] + "\" " + ">"
-        "<label for=\"long5\" class=\"llon\">Lon 5</label>"
-        "<input type=\"text\" class=\"geo\" id=\"long5\" name=\"" + NLon[4] + "\" value=\"" + VLon[4] + "\" " + "><br>"
-        "<input type=\"radio\" id=\"def6\" name=\"DefLoc\" value=\"5\" " + Lchecked[5] + ">"
-        "<label for=\"loc6\" class=\"lloc\">Loc 6</label>"
-        "<input type=\"text\" class=\"loc\" id=\"loc6\" name=\"" + NLoc[5] + "\" value=\"" + VLoc[5] + "\" maxlength=30>"
-        "<label for=\"lat6\" class=\"llat\">Lat 6</label>"
-        "<input type=\"text\" class=\"geo\" id=\"lat1\" name=\"" + NLat[5] + "\" value=\"" + VLat[5] + "\" " + ">"
-        "<label for=\"long6\" class=\"llon\">Lon 6</label>"
-        "<input type=\"text\" class=\"geo\" id=\"long\" name=\"" + NLon[5] + "\" value=\"" + VLon[5] + "\" " + "><br>"
-        "<input type=\"radio\" id=\"def7\" name=\"DefLoc\" value=\"6\" " + Lchecked[6] + ">"
-        "<label for=\"loc7\" class=\"lloc\">Loc 7</label>"
-        "<input type=\"text\" class=\"loc\" id=\"loc7\" name=\"" + NLoc[6] + "\" value=\"" + VLoc[6] + "\" maxlength=30>"
-        "<label for=\"lat7\" class=\"llat\">Lat 7</label>"
-        "<input type=\"text\" class=\"geo\" id=\"lat7\" name=\"" + NLat[6] + "\" value=\"" + VLat[6] + "\" " + ">"
-        "<label for=\"long7\" class=\"llon\">Lon 7</label>"
-        "<input type=\"text\" class=\"geo\" id=\"long7\" name=\"" + NLon[6] + "\" value=\"" + VLon[6] + "\" " + "><br>"
-        "<input type=\"radio\" id=\"def8\" name=\"DefLoc\" value=\"7\" " + Lchecked[7] + ">"
-        "<label for=\"loc8\" class=\"lloc\">Loc 8</label>"
-        "<input type=\"text\" class=\"loc\" id=\"loc8\" name=\"" + NLoc[7] + "\" value=\"" + VLoc[7] + "\" maxlength=30>"
-        "<label for=\"lat8\" class=\"llat\">Lat 8</label>"
-        "<input type=\"text\" class=\"geo\" id=\"lat8\" name=\"" + NLat[7] + "\" value=\"" + VLat[7] + "\" " + ">"
-        "<label for=\"long8\" class=\"llon\">Lon 8</label>"
-        "<input type=\"text\" class=\"geo\" id=\"long8\" name=\"" + NLon[7] + "\" value=\"" + VLon[7] + "\" " + "><br>"
-        "<input type=\"radio\" id=\"def9\" name=\"DefLoc\" value=\"8\" " + Lchecked[8] + ">"
-        "<label for=\"loc9\" class=\"lloc\">Loc 9</label>"
-        "<input type=\"text\" class=\"loc\" id=\"loc9\" name=\"" + NLoc[8] + "\" value=\"" + VLoc[8] + "\" maxlength=30>"
-        "<label for=\"lat9\" class=\"llat\">Lat 9</label>"
-        "<input type=\"text\" class=\"geo\" id=\"lat9\" name=\"" + NLat[8] + "\" value=\"" + VLat[8] + "\" " + ">"
-        "<label for=\"long9\" class=\"llon\">Lon 9</label>"
-        "<input type=\"text\" class=\"geo\" id=\"long9\" name=\"" + NLon[8] + "\" value=\"" + VLon[8] + "\" " + "><br><br>"
-	"</div>"
-        "<div class=\"p2\">"
-        "<a href=\"/wifi\">"+W_PARMW+"</a>"
-        "<a href=\"/weather_reset\" class=\"rst\">"+W_REINITM+"</a><br><br>"
-        "<a href=\"/parm\">"+W_PARMV+"</a><br><br>"
-#ifdef USE_OTA
-        "<a href=\"/ota\">"+W_SOFTUPD+"</a><br><br>"
-#endif
-        "<input type=\"submit\" value=\""+W_SUBMIT+"\">"
-	"</div>"
-      "</form>"
-      "</body></html>" );
+      send_template(request, WEATHER_PAGE, weather_value);
     }
     else
       page_lost(request);
@@ -1060,23 +1895,27 @@ void web_svr_setup ( void )
     IPAddress ip = request->client()->remoteIP();
     if ( check_remoteLogged(&ip) )
     {
+      if ( !config_begin() )
+      {
+        send_busy(request);
+        restart_wdg();
+        return;
+      }
+
       int i;
       for (i=0 ; i<MX_LOC ; i++)
       {
         if (request->hasParam(NLoc[i])) {
           VLoc[i] = request->getParam(NLoc[i])->value();
-          preferences.putString(NLoc[i].c_str(), VLoc[i]);
-          Serial.printf("Loc[%d]: %s\n", i, VLoc[i].c_str());
+          LOG_I("Loc[%d]: %s", i, VLoc[i].c_str());
         }
         if (request->hasParam(NLat[i])) {
           VLat[i] = request->getParam(NLat[i])->value();
-          preferences.putString(NLat[i].c_str(), VLat[i]);
-          Serial.printf("Lat[%d]: %s\n", i, VLat[i].c_str());
+          LOG_I("Lat[%d]: %s", i, VLat[i].c_str());
         }
         if (request->hasParam(NLon[i])) {
          VLon[i] = request->getParam(NLon[i])->value();
-          preferences.putString(NLon[i].c_str(), VLon[i]);
-          Serial.printf("Lon[%d]: %s\n", i, VLon[i].c_str());
+          LOG_I("Lon[%d]: %s", i, VLon[i].c_str());
         }
       }
       if (request->hasParam("DefLoc")) {
@@ -1084,11 +1923,11 @@ void web_svr_setup ( void )
         Lchecked[defloc] = "";
         defloc = DefLoc.toInt();
         Lchecked[defloc] = "checked";
-        preferences.putString(NDloc.c_str(), DefLoc);
-        Serial.printf("Def Location: %d\n", defloc);
+        LOG_I("Def Location: %d", defloc);
       }
 
       check_config();
+      config_end();
       request->send(200, "text/html", RSP_ACT_DONE);
 
       restart_wdg();
@@ -1099,13 +1938,16 @@ void web_svr_setup ( void )
 
   server.on("/weather_reset", HTTP_GET, [] (AsyncWebServerRequest *request) {
     IPAddress ip = request->client()->remoteIP();
-    if ( check_remoteLogged(&ip) )
+    if ( !check_remoteLogged(&ip) )
+      page_lost(request);
+    else if ( config_begin() )
     {
       reset_weather_config();
+      config_end();
       request->send(200, "text/html", RSP_ACT_DONE);
     }
     else
-      page_lost(request);
+      send_busy(request);
 
     restart_wdg();
   });
@@ -1115,58 +1957,7 @@ void web_svr_setup ( void )
     IPAddress ip = request->client()->remoteIP();
     if ( check_remoteLogged(&ip) )
     {
-      request->send(200, "text/html",
-      "<!DOCTYPE HTML><html><head>"
-      "<style>"
-      "label {display:inline-block;width:80px;text-align:center;}" 
-      "input[type=text] {width:150px;;margin-top:10px;}"
-      ".p1 {max-width:520px;}" 
-      ".p2 {max-width:520px;}" 
-      ".rst {float:right;}" 
-      "@media only screen and (max-width: 460px) {.p1 {max-width:300px;}}"
-      "</style>"
-      "<title>"+W_PARMW+"</title>"
-      "<meta name=\"viewport\" content=\"width=device-width, initial-scale=1\">"
-      "</head><body>"
-      "<h1>"+W_PARMW+"</h1>"
-      "<form action=\"/wifi_get\" method=\"get\">"
-        "<div class=\"p1\">"
-	"<label for=\"ssi1\">SSID 1</label>"
-        "<input type=\"text\" class=\"ssi\" id=\"ssi1\" name=\"" + NSsi[0] + "\" value=\"" + VSsi[0] + "\">"
-        "<label for=\"pwd1\">PWD 1</label>"
-        "<input type=\""+TAGPWD+"\" class=\"pwd\" id=\"pwd1\" name=\"" + NPwd[0] + "\" value=\"" + VPwd[0] + "\"><br>"
-        "<label for=\"ssi2\">SSID 2</label>"
-        "<input type=\"text\" class=\"ssi\" id=\"ssi2\" name=\"" + NSsi[1] + "\" value=\"" + VSsi[1] + "\">"
-        "<label for=\"pwd2\">PWD 2</label>"
-        "<input type=\""+TAGPWD+"\" class=\"pwd\" id=\"pwd2\" name=\"" + NPwd[1] + "\" value=\"" + VPwd[1] + "\"><br>"
-        "<label for=\"ssi3\">SSID 3</label>"
-        "<input type=\"text\" class=\"ssi\" id=\"ssi3\" name=\"" + NSsi[2] + "\" value=\"" + VSsi[2] + "\">"
-        "<label for=\"pwd3\">PWD 3</label>"
-        "<input type=\""+TAGPWD+"\" class=\"pwd\" id=\"pwd3\" name=\"" + NPwd[2] + "\" value=\"" + VPwd[2] + "\"><br>"
-        "<label for=\"ssi4\">SSID 4</label>"
-        "<input type=\"text\" class=\"ssi\" id=\"ssi4\" name=\"" + NSsi[3] + "\" value=\"" + VSsi[3] + "\">"
-        "<label for=\"pwd4\">PWD 4</label>"
-        "<input type=\""+TAGPWD+"\" class=\"pwd\" id=\"pwd4\" name=\"" + NPwd[3] + "\" value=\"" + VPwd[3] + "\"><br>"
-        "<label for=\"ssi5\">SSID 5</label>"
-        "<input type=\"text\" class=\"ssi\" id=\"ssi5\" name=\"" + NSsi[4] + "\" value=\"" + VSsi[4] + "\">"
-        "<label for=\"pwd5\">PWD 5</label>"
-        "<input type=\""+TAGPWD+"\" class=\"pwd\" id=\"pwd5\" name=\"" + NPwd[4] + "\" value=\"" + VPwd[4] + "\"><br>"
-        "<label for=\"ssi6\">SSID 6</label>"
-        "<input type=\"text\" class=\"ssi\" id=\"ssi6\" name=\"" + NSsi[5] + "\" value=\"" + VSsi[5] + "\">"
-        "<label for=\"pwd6\">PWD 6</label>"
-        "<input type=\""+TAGPWD+"\" class=\"pwd\" id=\"pwd6\" name=\"" + NPwd[5] + "\" value=\"" + VPwd[5] + "\"><br><br>"
-	"</div>"
-        "<div class=\"p2\">"
-        "<a href=\"/wifi_reset\" class=\"rst\">"+W_REINITW+"</a>"
-        "<a href=\"/weather\">"+W_PARMM+"</a><br><br>"
-        "<a href=\"/parm\">"+W_PARMV+"</a><br><br>"
-#ifdef USE_OTA
-        "<a href=\"/ota\">"+W_SOFTUPD+"</a><br><br>"
-#endif
-        "<input type=\"submit\" value=\""+W_SUBMIT+"\">"
-	"</div>"
-      "</form>"
-      "</body></html>" );
+      send_template(request, WIFI_PAGE, wifi_value);
     }
     else
       page_lost(request);
@@ -1176,22 +1967,28 @@ void web_svr_setup ( void )
     IPAddress ip = request->client()->remoteIP();
     if ( check_remoteLogged(&ip) )
     {
+      if ( !config_begin() )
+      {
+        send_busy(request);
+        restart_wdg();
+        return;
+      }
+
       int i;
       for (i=0 ; i<MX_SSI ; i++)
       {
         if (request->hasParam(NSsi[i])) {
           VSsi[i] = request->getParam(NSsi[i])->value();
-          preferences.putString(NSsi[i].c_str(), VSsi[i]);
-          Serial.printf("Ssi[%d]: '%s'\n", i, VSsi[i].c_str());
+          LOG_I("Ssi[%d]: '%s'", i, VSsi[i].c_str());
         }
         if (request->hasParam(NPwd[i])) {
           VPwd[i] = request->getParam(NPwd[i])->value();
-          preferences.putString(NPwd[i].c_str(), VPwd[i]);
-          Serial.printf("Pwd[%d]: '%s'\n", i, VPwd[i].c_str());
+          LOG_I("Pwd[%d]: '%s'", i, VPwd[i].c_str());
         }
       }
 
       check_config();
+      config_end();
       request->send(200, "text/html", RSP_ACT_DONE);
 
       restart_wdg();
@@ -1202,13 +1999,16 @@ void web_svr_setup ( void )
 
   server.on("/wifi_reset", HTTP_GET, [] (AsyncWebServerRequest *request) {
     IPAddress ip = request->client()->remoteIP();
-    if ( check_remoteLogged(&ip) )
+    if ( !check_remoteLogged(&ip) )
+      page_lost(request);
+    else if ( config_begin() )
     {
       reset_wifi_config();
+      config_end();
       request->send(200, "text/html", RSP_ACT_DONE);
     }
     else
-      page_lost(request);
+      send_busy(request);
 
     restart_wdg();
   });
@@ -1218,79 +2018,7 @@ void web_svr_setup ( void )
     IPAddress ip = request->client()->remoteIP();
     if ( check_remoteLogged(&ip) )
     {
-      request->send(200, "text/html",
-      "<!DOCTYPE HTML><html><head>"
-      "<meta name=\"viewport\" content=\"width=device-width, initial-scale=1\">"
-      "<style>"
-      ".p1 {max-width:520px;}" 
-      ".l1 {display:inline-block;width:180px;margin-left:8px}" 
-      ".l2 {display:inline-block;margin-left:8px}" 
-      "input[type=number] {width:60px;margin-top:10px;text-align:center;}" 
-      ".rst {float:right;}" 
-      "</style>"
-      "<title>"+W_PARMV+"</title>"
-      "</head><body>"
-      "<h1>"+W_PARMV+"</h1>"
-      "<form action=\"/parm_get\" method=\"get\">"
-        "<div class=\"p1\">"
-        "<label for=\"popth\" class=\"l1\">"+W_POPTHR+"</label>"
-        "<input type=\"number\" class=\"num\" id=\"popth\" name=\"" + NM_THR + "\" value=\"" + String(PopTh) + "\" "
-          "min=0 max=1 step=0.01>"
-        "<label for=\"popth\" class=\"l2\">%</label><br>"
-        "<label for=\"tempoff\" class=\"l1\">"+W_TOFF+"</label>"
-        "<input type=\"number\" class=\"num\" id=\"tempoff\" name=\"" + NM_TOFF + "\" value=\"" + String(Toff) + "\" "
-          "min=-4 max=4 step=0.1>"
-        "<label for=\"tempoff\" class=\"l2\">\260</label><br>"
-        "<label for=\"bed\" class=\"l1\">"+W_BEDTIM+"</label>"
-        "<input type=\"number\" class=\"num\" id=\"bed\" name=\"" + NM_BED + "\" value=\"" + String(BedTime) + "\" "
-          "min=0 max=23 step=1>"
-        "<label for=\"bed\" class=\"l2\">H</label><br>"
-        "<label for=\"wake\" class=\"l1\">"+W_WAKTIM+"</label>"
-        "<input type=\"number\" class=\"num\" id=\"wake\" name=\"" + NM_WAK + "\" value=\"" + String(WakeTime) + "\" "
-          "min=0 max=23 step=1>"
-        "<label for=\"wake\" class=\"l2\">H</label><br>"
-        "<label for=\"sleep\" class=\"l1\">"+W_SLPDLY+"</label>"
-        "<input type=\"number\" class=\"num\" id=\"sleep\" name=\"" + NM_SLP + "\" value=\"" + String(SleepDly) + "\" "
-          "min=10 max=60 step=10>"
-        "<label for=\"sleep\" class=\"l2\">min</label><br>"
-        "<label for=\"hrnb\" class=\"l1\">"+W_HOURNB+"</label>"
-        "<input type=\"number\" class=\"num\" id=\"hrnb\" name=\"" + NM_HNB + "\" value=\"" + String(HourlyNb) + "\" "
-          "min=8 max=48 step=1>"
-        "<label for=\"hrnb\" class=\"l2\">H</label><br>"
-        "<label for=\"minr\"class=\"l1\">"+W_MAJMIN+"</label>"
-        "<input type=\"number\" class=\"num\" id=\"minr\" name=\"" + NM_MRT + "\" value=\"" + String(MinRefTim) + "\" "
-          "min=60 max=300 step=1>"
-        "<label for=\"minr\" class=\"l2\">sec</label><br>"
-        "<label for=\"maxa\" class=\"l1\">"+W_WEBDLY+"</label>"
-        "<input type=\"number\" class=\"num\" id=\"maxa\" name=\"" + NM_MAT + "\" value=\"" + String(MaxActTim) + "\" "
-          "min=60 max=600 step=1>"
-        "<label for=\"maxa\" class=\"l2\">sec</label><br>"
-        "<label for=\"hto\" class=\"l1\">"+W_HTO+"</label>"
-        "<input type=\"number\" class=\"num\" id=\"hto\" name=\"" + NM_HTO + "\" value=\"" + String(HttpTimeout) + "\" >"
-        "<label for=\"hto\" class=\"l2\">msec</label><br>"
-        "<label for=\"wato\" class=\"l1\">"+W_WATO+"</label>"
-        "<input type=\"number\" class=\"num\" id=\"wato\" name=\"" + NM_WAT + "\" value=\"" + String(WifiAPto) + "\" >"
-        "<label for=\"wato\" class=\"l2\">msec</label><br>"
-        "<label for=\"wgto\" class=\"l1\">"+W_WGTO+"</label>"
-        "<input type=\"number\" class=\"num\" id=\"wgto\" name=\"" + NM_WGT + "\" value=\"" + String(WifiTimeout) + "\" >"
-        "<label for=\"wgto\" class=\"l2\">msec</label><br><br>"
-        "<label for=\"wgto\" class=\"l2\">" + W_WTOREC + "</label><br><br>"
-        "<label for=\"RerFlg\" class=\"l1\">" + W_RERFLG + "</label>"
-        "<input type=\"checkbox\" id=\"RerFlg\" name=\"" + NM_RER + "\" value=active " + RerChecked + "><br><br>"
-        "<label for=\"WicFlg\" class=\"l1\">" + W_WICFLG + "</label>"
-        "<input type=\"checkbox\" id=\"WicFlg\" name=\"" + NM_WIC + "\" value=active " + WicChecked + "><br><br>"
-        "<label for=\"WicTemp\" class=\"l1\">" + W_WICTEMP + "</label>"
-        "<input type=\"checkbox\" id=\"WicTemp\" name=\"" + NM_WICTEMP + "\" value=active " + WicTempChecked + "><br><br>"
-        "<a href=\"/parm_reset\" class=\"rst\">"+W_REINITV+"</a>"
-        "<a href=\"/weather\">"+W_PARMM+"</a><br><br>"
-        "<a href=\"/wifi\">"+W_PARMW+"</a><br><br>"
-#ifdef USE_OTA
-        "<a href=\"/ota\">"+W_SOFTUPD+"</a><br><br>"
-#endif
-        "<input type=\"submit\" value=\""+W_SUBMIT+"\">"
-	"</div>"
-      "</form>"
-      "</body></html>" );
+      send_template(request, PARM_PAGE, parm_value);
     }
     else
       page_lost(request);
@@ -1300,71 +2028,67 @@ void web_svr_setup ( void )
     IPAddress ip = request->client()->remoteIP();
     if ( check_remoteLogged(&ip) )
     {
+      if ( !config_begin() )
+      {
+        send_busy(request);
+        restart_wdg();
+        return;
+      }
+
       if (request->hasParam(NM_THR)) {
         String s = request->getParam(NM_THR)->value();
         PopTh = s.toFloat();
-        preferences.putString(NM_THR, String(PopTh));
-        Serial.printf("POP Threshold: %f\n", PopTh);
+        LOG_I("POP Threshold: %f", PopTh);
       }
       if (request->hasParam(NM_TOFF)) {
         String s = request->getParam(NM_TOFF)->value();
         Toff = s.toFloat();
-        preferences.putString(NM_TOFF, String(Toff));
-        Serial.printf("TEMP offset: %f\n", Toff);
+        LOG_I("TEMP offset: %f", Toff);
       }
       if (request->hasParam(NM_BED)) {
         String s = request->getParam(NM_BED)->value();
         BedTime = s.toInt();
-        preferences.putString(NM_BED, s);
-        Serial.printf("BED Time: %d\n", BedTime);
+        LOG_I("BED Time: %d", BedTime);
       }
       if (request->hasParam(NM_WAK)) {
         String s = request->getParam(NM_WAK)->value();
         WakeTime = s.toInt();
-        preferences.putString(NM_WAK, s);
-        Serial.printf("WAKE Time: %d\n", WakeTime);
+        LOG_I("WAKE Time: %d", WakeTime);
       }
       if (request->hasParam(NM_SLP)) {
         String s = request->getParam(NM_SLP)->value();
         SleepDly = (long)s.toInt();
-        preferences.putString(NM_SLP, s);
-        Serial.printf("Sleep-dly: %ld\n", SleepDly);
+        LOG_I("Sleep-dly: %ld", SleepDly);
       }
       if (request->hasParam(NM_HNB)) {
         String s = request->getParam(NM_HNB)->value();
         HourlyNb = s.toInt();
-        preferences.putString(NM_HNB, s);
-        Serial.printf("Hourly-Nb: %d\n", HourlyNb);
+        LOG_I("Hourly-Nb: %d", HourlyNb);
       }
       if (request->hasParam(NM_MRT)) {
         String s = request->getParam(NM_MRT)->value();
         MinRefTim = s.toInt();
-        preferences.putString(NM_MRT, s);
-        Serial.printf("Min-Refresh: %d\n", MinRefTim);
+        LOG_I("Min-Refresh: %d", MinRefTim);
       }
       if (request->hasParam(NM_MAT)) {
         String s = request->getParam(NM_MAT)->value();
         MaxActTim = s.toInt();
-        preferences.putString(NM_MAT, s);
-        Serial.printf("Min-Refresh: %d\n", MaxActTim);
+        LOG_I("Min-Refresh: %d", MaxActTim);
       }
       if (request->hasParam(NM_WAT)) {
         String s = request->getParam(NM_WAT)->value();
         WifiAPto = s.toInt();
-        preferences.putString(NM_WAT, s);
-        Serial.printf("Wifi-AP-to: %d\n", WifiAPto);
+        LOG_I("Wifi-AP-to: %d", WifiAPto);
       }
       if (request->hasParam(NM_WGT)) {
         String s = request->getParam(NM_WGT)->value();
         WifiTimeout = s.toInt();
-        preferences.putString(NM_WGT, s);
-        Serial.printf("Wifi-global-to: %ld\n", WifiTimeout);
+        LOG_I("Wifi-global-to: %lu", WifiTimeout);
       }
       if (request->hasParam(NM_HTO)) {
         String s = request->getParam(NM_HTO)->value();
         HttpTimeout = s.toInt();
-        preferences.putString(NM_HTO, s);
-        Serial.printf("Http-to: %d\n", HttpTimeout);
+        LOG_I("Http-to: %d", HttpTimeout);
       }
       if (request->hasParam(NM_RER)) {
         //String s = request->getParam(NM_RER)->value();
@@ -1376,8 +2100,7 @@ void web_svr_setup ( void )
         RerFlg = 0;
         RerChecked = "";
       }
-      preferences.putString(NM_RER, String(RerFlg));
-      Serial.printf("Report-Error-flag: %d\n", RerFlg);
+      LOG_I("Report-Error-flag: %d", RerFlg);
 
       if (request->hasParam(NM_WIC))
       {
@@ -1389,8 +2112,7 @@ void web_svr_setup ( void )
         WicFlg = 0;
         WicChecked = "";
       }
-      preferences.putString(NM_WIC, String(WicFlg));
-      Serial.printf("Graph-Icons-flag: %d\n", WicFlg);
+      LOG_I("Graph-Icons-flag: %d", WicFlg);
 
       if (request->hasParam(NM_WICTEMP))
       {
@@ -1402,10 +2124,10 @@ void web_svr_setup ( void )
         WicTemp = 0;
         WicTempChecked = "";
       }
-      preferences.putString(NM_WICTEMP, String(WicTemp));
-      Serial.printf("Graph-Icons-Vpos: %d\n", WicTemp);
+      LOG_I("Graph-Icons-Vpos: %d", WicTemp);
 
       check_config();
+      config_end();
       request->send(200, "text/html", RSP_ACT_DONE);
 
       restart_wdg();
@@ -1416,13 +2138,16 @@ void web_svr_setup ( void )
 
   server.on("/parm_reset", HTTP_GET, [] (AsyncWebServerRequest *request) {
     IPAddress ip = request->client()->remoteIP();
-    if ( check_remoteLogged(&ip) )
+    if ( !check_remoteLogged(&ip) )
+      page_lost(request);
+    else if ( config_begin() )
     {
       reset_parm_config();
+      config_end();
       request->send(200, "text/html", RSP_ACT_DONE);
     }
     else
-      page_lost(request);
+      send_busy(request);
 
     restart_wdg();
   });
@@ -1432,7 +2157,7 @@ void web_svr_setup ( void )
     IPAddress ip = request->client()->remoteIP();
     if ( check_remoteLogged(&ip) )
     {
-      Serial.println("Cleaning the NVS");
+      LOG_I("Cleaning the NVS");
 
       clean_nvs();
       request->send(200, "text/html", RSP_ACT_DONE);
@@ -1448,7 +2173,7 @@ void web_svr_setup ( void )
     IPAddress ip = request->client()->remoteIP();
     if ( check_remoteLogged(&ip) )
     {
-      Serial.println("Clearing the NVS");
+      LOG_I("Clearing the NVS");
 
       clear_nvs();
       request->send(200, "text/html", RSP_ACT_DONE);
@@ -1459,15 +2184,180 @@ void web_svr_setup ( void )
     restart_wdg();
   });
 
+#ifdef WEB_UI
+  // Single page UI: the files hold no parameter, they are sent to any client.
+  // "/ui" also matches "/ui/...", so it is registered last.
+  for (size_t i=web_ui_file_count ; i-- > 0 ; )
+  {
+    const web_ui_file_t *file = &web_ui_files[i];
+    server.on(file->path, HTTP_GET, [file] (AsyncWebServerRequest *request) {
+      send_ui_file(request, file);
+    });
+  }
+
+#endif
+
+  // Whole configuration as JSON (see CONFIG_TO_JSON), for the UI and scripts
+  // The client shall be logged in first, like for the pages (/ or /get?key=)
+  server.on("/api/config", HTTP_GET, [] (AsyncWebServerRequest *request) {
+    IPAddress ip = request->client()->remoteIP();
+    if ( check_remoteLogged(&ip) )
+      send_config(request);
+    else
+      request->send(403, "text/plain", W_INVALKEY);
+
+    restart_wdg();
+  });
+
+  // Update from a JSON document (Content-Type: application/json), checked,
+  // then saved with a single NVS commit; answers with the resulting values
+  AsyncCallbackJsonWebHandler *cfg_put = new AsyncCallbackJsonWebHandler(
+    "/api/config", [] (AsyncWebServerRequest *request, JsonVariant &json) {
+    IPAddress ip = request->client()->remoteIP();
+    if ( check_remoteLogged(&ip) )
+    {
+      const char *err = config_from_json(json, false);
+      if ( err != nullptr )
+        request->send(400, "text/plain", String("Invalid ") + err);
+      else if ( config_begin() )
+      {
+        config_from_json(json, true);
+        check_config();
+        config_end();
+        send_config(request);
+      }
+      else
+        send_busy(request);
+    }
+    else
+      request->send(403, "text/plain", W_INVALKEY);
+
+    restart_wdg();
+  });
+  cfg_put->setMethod(HTTP_PUT);
+  server.addHandler(cfg_put);
+
+#ifdef RENDER_PROFILER
+  // Time spent drawing each widget and page of the last weather screen
+  server.on("/profile", HTTP_GET, [] (AsyncWebServerRequest *request) {
+    IPAddress ip = request->client()->remoteIP();
+    if ( check_remoteLogged(&ip) )
+    {
+      static char report[1024];
+      profileFormat(report, sizeof(report));
+      request->send(200, "text/plain", report);
+    }
+    else
+      page_lost(request);
+
+    restart_wdg();
+  });
+#endif
+
+#ifdef STATION_METRICS
+  // For a collector: no login, and a scrape does not restart the watchdog
+  server.on("/metrics", HTTP_GET, [] (AsyncWebServerRequest *request) {
+    MetricsStream metrics;
+    request->send(request->beginChunkedResponse("text/plain; version=0.0.4",
+      [metrics](uint8_t *buf, size_t maxLen, size_t) mutable -> size_t {
+        return metrics.read(buf, maxLen);
+      }));
+  });
+#endif
+
+  // Log lines kept in RTC memory (this wake and the previous ones), oldest
+  // first; level=N changes the run time level first (see LOG_LEVEL)
+  server.on("/log", HTTP_GET, [] (AsyncWebServerRequest *request) {
+    IPAddress ip = request->client()->remoteIP();
+    if ( check_remoteLogged(&ip) )
+    {
+      if ( request->hasParam("level") )
+      {
+        logSetLevel(request->getParam("level")->value().toInt());
+        LOG_I("Log level %u", logGetLevel());
+      }
+      LogStream log;
+      request->send(request->beginChunkedResponse("text/plain",
+        [log](uint8_t *buf, size_t maxLen, size_t) mutable -> size_t {
+          return log.read(buf, maxLen);
+        }));
+    }
+    else
+      page_lost(request);
+
+    restart_wdg();
+  });
+
+#ifdef WEB_PREVIEW
+  server.on("/preview", HTTP_GET, [] (AsyncWebServerRequest *request) {
+    IPAddress ip = request->client()->remoteIP();
+    if ( check_remoteLogged(&ip) )
+      request->send(200, "text/html", PREVIEW_PAGE);
+    else
+      page_lost(request);
+
+    restart_wdg();
+  });
+
+  // The frame is sent once the Web loop has drawn it (see preview_state_t),
+  // one preview at a time
+  server.on("/preview.pbm", HTTP_GET, [] (AsyncWebServerRequest *request) {
+    IPAddress ip = request->client()->remoteIP();
+    if ( !check_remoteLogged(&ip) )
+    {
+      page_lost(request);
+      return;
+    }
+
+    int state = PREVIEW_IDLE;
+    if ( !preview_state.compare_exchange_strong(state,
+           request->hasParam("render") ? PREVIEW_RENDER : PREVIEW_CURRENT) )
+    {
+      request->send(503, "text/plain", "Busy");
+      return;
+    }
+    request->onDisconnect([] () {
+      preview_state = PREVIEW_DONE;
+    });
+
+    PbmStream pbm(display);
+    AsyncWebServerResponse *response = request->beginChunkedResponse(
+      "image/x-portable-bitmap",
+      [pbm](uint8_t *buf, size_t maxLen, size_t) mutable -> size_t {
+        if ( preview_state != PREVIEW_READY )
+          return RESPONSE_TRY_AGAIN;
+        return pbm.read(buf, maxLen);
+      });
+    response->addHeader("Cache-Control", "no-store");
+    // the frame is released when the connection is closed
+    response->addHeader("Connection", "close");
+    request->send(response);
+
+    restart_wdg();
+  });
+#endif // WEB_PREVIEW
+
   server.on("/prm_update", HTTP_GET, [] (AsyncWebServerRequest *request) {
     IPAddress ip = request->client()->remoteIP();
     if ( check_remoteLogged(&ip) )
     {
       // The objective is to wake up and refresh as soon as possible
-      // but with a minimum interval of 'MinRefTim' since the last start
-      unsigned long mintm = millis() - startTime;   // rollover handled by C substract
+      // but with a minimum interval of 'MinRefTim' since the last refresh
+      unsigned long mintm = millis() - refreshTime; // rollover handled by C substract
       mintm = (mintm > (MinRefTim*1000)) ? 500 : ((MinRefTim*1000) - mintm);
 
+#ifdef WEB_APPLY_IN_PLACE
+      if ( WiFi.status() == WL_CONNECTED )
+      {
+        // Internet reachable: refreshed by the Web loop, without reboot
+        request->send(200, "text/html",
+                      RSP_TERMACT1a_DONE+String((mintm+999)/1000)+RSP_TERMACT1c_DONE);
+        refresh_at = millis() + mintm;
+        refresh_pending = 1;
+        restart_wdg();
+        return;
+      }
+#endif
       request->send(200, "text/html",
                     RSP_TERMACT1a_DONE+String((mintm+999)/1000)+RSP_TERMACT1b_DONE);
 
@@ -1550,7 +2440,7 @@ void web_svr_setup ( void )
 
   server.onNotFound(notFound);
 
-  Serial.println("Starting WEB server");
+  LOG_I("Starting WEB server");
 
 #ifdef USE_EOTA
   // Start ElegantOTA
@@ -1600,21 +2490,19 @@ int wifi_check ( void )
   if ( wst != cur_wst )
   {
     cur_wst = wst;
-    Serial.printf("WIFI state : %s (%d)\n",
-                   (wst == WL_CONNECTED) ? "connected" : "off", wst);
+    LOG_I("WIFI state : %s (%d)",
+          (wst == WL_CONNECTED) ? "connected" : "off", wst);
 
     if ( wst == WL_CONNECTED )
     {
-      Serial.print("SSID: ");
-      Serial.println(WiFi.SSID());
-      Serial.print("IP Address: ");
-      Serial.println(WiFi.localIP());
+      LOG_I("SSID: %s", WiFi.SSID().c_str());
+      LOG_I("IP Address: %s", WiFi.localIP().toString().c_str());
 
       // Use mdns for local host name resolution
       if ( !MDNS.begin(HNAME) )
-        Serial.println("Error setting up MDNS responder!");
+        LOG_E("Error setting up MDNS responder!");
       else
-        Serial.printf("MDNS responder set to '%s.local'\n", HNAME);
+        LOG_I("MDNS responder set to '%s.local'", HNAME);
     }
   }
 
@@ -1632,23 +2520,17 @@ void wifi_scanSsid ( void )
   int n;
 
   n = WiFi.scanNetworks();
-  Serial.println("scan done");
+  LOG_I("scan done");
 
   if (n == 0) {
-    Serial.println("no networks found");
+    LOG_I("no networks found");
   } 
   else {
-    Serial.print(n);
-    Serial.println(" networks found");
+    LOG_I("%d networks found", n);
     for (int i = 0; i < n; ++i) {
       // Print SSID and RSSI for each network found
-      Serial.print(i + 1);
-      Serial.print(": ");
-      Serial.print(WiFi.SSID(i));
-      Serial.print(" (");
-      Serial.print(WiFi.RSSI(i));
-      Serial.print(")");
-      Serial.println((WiFi.encryptionType(i) == WIFI_AUTH_OPEN)?" ":"*");
+      LOG_I("%d: %s (%d)%s", i + 1, WiFi.SSID(i).c_str(), (int) WiFi.RSSI(i),
+            (WiFi.encryptionType(i) == WIFI_AUTH_OPEN) ? " " : "*");
       delay(10);
     }
   }
@@ -1669,7 +2551,7 @@ int wifi_addAP ( void )
   {
     if ( VSsi[i] != "" )
     {
-      Serial.printf("Adding AP '%s'\n", VSsi[i].c_str());
+      LOG_I("Adding AP '%s'", VSsi[i].c_str());
       wifiMulti.addAP(VSsi[i].c_str(), VPwd[i].c_str());
       n++;
     }
@@ -1702,19 +2584,17 @@ wl_status_t startWiFi(int &wifiRSSI, int web_mode)
     WiFi.mode(WIFI_AP_STA);
     WiFi.softAP(SOFTAP_SSID, SOFTAP_PWD);
 
-    Serial.print("WIFI AP ");
-    Serial.print(SOFTAP_SSID);
-    Serial.print(" created with IP gateway ");
-    Serial.println(WiFi.softAPIP());
+    LOG_I("WIFI AP %s created with IP gateway %s", SOFTAP_SSID,
+          WiFi.softAPIP().toString().c_str());
   }
   else
 #endif
   {
     WiFi.mode(WIFI_STA);
-    Serial.println("WIFI Station");
+    LOG_I("WIFI Station");
   }
   
-  Serial.printf("%s '%s'\n", TXT_CONNECTING_TO, "WiFi");
+  LOG_I("%s '%s'", TXT_CONNECTING_TO, "WiFi");
 
   n = wifi_addAP();
 
@@ -1729,7 +2609,7 @@ static int prv = -1;
     connection_status = (wl_status_t) wifiMulti.run();
     if ( connection_status != prv )
     {
-      Serial.printf("wifi state = %d\n", connection_status); 
+      LOG_I("wifi state = %d", connection_status); 
       prv = connection_status;
     }
   }
@@ -1763,20 +2643,19 @@ static int prv = -1;
     wifiRSSI = WiFi.RSSI();
 
 #ifdef OLD
-    Serial.print("SSID: ");
-    Serial.println(WiFi.SSID());
-    Serial.println("IP: " + WiFi.localIP().toString());
+    LOG_I("SSID: %s", WiFi.SSID().c_str());
+    LOG_I("IP: %s", WiFi.localIP().toString().c_str());
     //wsta = 1;
 #endif
 
     // Use mdns for local host name resolution
     if ( !MDNS.begin(HNAME) )
-      Serial.println("Error setting up MDNS responder!");
+      LOG_E("Error setting up MDNS responder!");
      else
-      Serial.printf("MDNS responder set to '%s.local'\n", HNAME);
+      LOG_I("MDNS responder set to '%s.local'", HNAME);
   }
   else
-    Serial.printf("%s '%s'\n", TXT_COULD_NOT_CONNECT_TO, "WiFi");
+    LOG_W("%s '%s'", TXT_COULD_NOT_CONNECT_TO, "WiFi");
 
   return connection_status;
 } // startWiFi
@@ -1788,7 +2667,7 @@ static int prv = -1;
  */
 void killWiFi()
 {
-  Serial.println("Killing WIFI");
+  LOG_I("Killing WIFI");
   
   WiFi.disconnect();
   WiFi.mode(WIFI_OFF);
@@ -1800,6 +2679,9 @@ void killWiFi()
  */
 int net_loop ( void )
 {
+  // Save the parameters changed through the Web server
+  config_flush();
+
 #ifdef USE_OTA
   ArduinoOTA.handle();
 #endif
@@ -1825,13 +2707,18 @@ int net_loop ( void )
  * Perform an HTTP GET request to OpenWeatherMap's "One Call" API
  * If data is received, it will be parsed and stored in the global variable
  * owm_onecall.
+ * With PARSE_PIPELINE, when a pipeline is given it is started for each parse
+ * and the sections are published to it as they are parsed. It is ended if the
+ * parse fails, otherwise it keeps running and the caller must end() it.
  *
  * Returns the HTTP Status Code.
  */
 #ifdef USE_HTTP
-  int getOWMonecall(WiFiClient &client, owm_resp_onecall_t &r)
+  int getOWMonecall(WiFiClient &client, owm_resp_onecall_t &r,
+                    ParsePipeline *pipeline)
 #else
-  int getOWMonecall(WiFiClientSecure &client, owm_resp_onecall_t &r)
+  int getOWMonecall(WiFiClientSecure &client, owm_resp_onecall_t &r,
+                    ParsePipeline *pipeline)
 #endif
 {
   int attempts = 0;
@@ -1851,8 +2738,7 @@ int net_loop ( void )
 
   uri += "&appid=" + OWM_APIKEY;
 
-  Serial.print(TXT_ATTEMPTING_HTTP_REQ);
-  Serial.println(": " + sanitizedUri);
+  LOG_I("%s: %s", TXT_ATTEMPTING_HTTP_REQ, sanitizedUri.c_str());
   int httpResponse = 0;
   while (!rxSuccess && attempts < 3)
   {
@@ -1867,10 +2753,28 @@ int net_loop ( void )
     http.setConnectTimeout(HTTP_CLIENT_TCP_TIMEOUT);
     http.setTimeout(HTTP_CLIENT_TCP_TIMEOUT);
     http.begin(client, OWM_ENDPOINT, OWM_PORT, uri);
+    unsigned long requestStart = millis();
     httpResponse = http.GET();
+    unsigned long latency = millis() - requestStart;
+    unsigned long parseTime = 0;
     if (httpResponse == HTTP_CODE_OK)
     {
+#ifdef PARSE_PIPELINE
+      if (pipeline != nullptr)
+      {
+        pipeline->begin();
+        jsonErr = deserializeOneCallSections(http.getStream(), r,
+                                             ParsePipeline::publishTo,
+                                             pipeline);
+        if (jsonErr)
+        {
+          pipeline->end(false);
+        }
+      }
+      else
+#endif
       jsonErr = deserializeOneCall(http.getStream(), r);
+      parseTime = millis() - requestStart - latency;
       if (jsonErr)
       {
         // -256 offset distinguishes these errors from httpClient errors
@@ -1878,10 +2782,15 @@ int net_loop ( void )
       }
       rxSuccess = !jsonErr;
     }
+    METRICS_HTTP(METRICS_ONECALL, httpResponse, latency, parseTime, http.getSize());
+    if (attempts > 0)
+    {
+      METRICS_RETRY(METRICS_ONECALL);
+    }
     client.stop();
     http.end();
-    Serial.println("  " + String(httpResponse, DEC) + " "
-                   + getHttpResponsePhrase(httpResponse));
+    LOG_I("  %d %s (%lu + %lu ms)", httpResponse,
+          getHttpResponsePhrase(httpResponse), latency, parseTime);
     ++attempts;
   }
 
@@ -1927,8 +2836,7 @@ int net_loop ( void )
                + "&start=" + startStr + "&end=" + endStr
                + "&appid={API key}";
 
-  Serial.print(TXT_ATTEMPTING_HTTP_REQ);
-  Serial.println(": " + sanitizedUri);
+  LOG_I("%s: %s", TXT_ATTEMPTING_HTTP_REQ, sanitizedUri.c_str());
   int httpResponse = 0;
   while (!rxSuccess && attempts < 3)
   {
@@ -1943,10 +2851,14 @@ int net_loop ( void )
     http.setConnectTimeout(HTTP_CLIENT_TCP_TIMEOUT);
     http.setTimeout(HTTP_CLIENT_TCP_TIMEOUT);
     http.begin(client, OWM_ENDPOINT, OWM_PORT, uri);
+    unsigned long requestStart = millis();
     httpResponse = http.GET();
+    unsigned long latency = millis() - requestStart;
+    unsigned long parseTime = 0;
     if (httpResponse == HTTP_CODE_OK)
     {
       jsonErr = deserializeAirQuality(http.getStream(), r);
+      parseTime = millis() - requestStart - latency;
       if (jsonErr)
       {
         // -256 offset to distinguishes these errors from httpClient errors
@@ -1954,10 +2866,15 @@ int net_loop ( void )
       }
       rxSuccess = !jsonErr;
     }
+    METRICS_HTTP(METRICS_AIR_POLLUTION, httpResponse, latency, parseTime, http.getSize());
+    if (attempts > 0)
+    {
+      METRICS_RETRY(METRICS_AIR_POLLUTION);
+    }
     client.stop();
     http.end();
-    Serial.println("  " + String(httpResponse, DEC) + " "
-                   + getHttpResponsePhrase(httpResponse));
+    LOG_I("  %d %s (%lu + %lu ms)", httpResponse,
+          getHttpResponsePhrase(httpResponse), latency, parseTime);
     ++attempts;
   }
 
@@ -1974,13 +2891,9 @@ int net_loop ( void )
  * Prints debug information about heap usage.
  */
 void printHeapUsage() {
-  Serial.println("[debug] Heap Size       : "
-                 + String(ESP.getHeapSize()) + " B");
-  Serial.println("[debug] Available Heap  : "
-                 + String(ESP.getFreeHeap()) + " B");
-  Serial.println("[debug] Min Free Heap   : "
-                 + String(ESP.getMinFreeHeap()) + " B");
-  Serial.println("[debug] Max Allocatable : "
-                 + String(ESP.getMaxAllocHeap()) + " B");
+  LOG_I("[debug] Heap Size       : %u B", (unsigned) ESP.getHeapSize());
+  LOG_I("[debug] Available Heap  : %u B", (unsigned) ESP.getFreeHeap());
+  LOG_I("[debug] Min Free Heap   : %u B", (unsigned) ESP.getMinFreeHeap());
+  LOG_I("[debug] Max Allocatable : %u B", (unsigned) ESP.getMaxAllocHeap());
   return;
 }
@@ -36,8 +36,10 @@
 #include "_locale.h"
 #include "_strftime.h"
 #include "api_response.h"
+#include "asset_store.h"
 #include "config.h"
 #include "display_utils.h"
+#include "logger.h"
 
 // icon header files
 #include "icons/icons.h"
@@ -68,15 +70,15 @@ uint32_t readBatteryVoltage()
 #if DEBUG_LEVEL >= 1
   if (val_type == ESP_ADC_CAL_VAL_EFUSE_VREF)
   {
-    Serial.println("[debug] ADC Cal eFuse Vref");
+    LOG_I("[debug] ADC Cal eFuse Vref");
   }
   else if (val_type == ESP_ADC_CAL_VAL_EFUSE_TP)
   {
-    Serial.println("[debug] ADC Cal Two Point");
+    LOG_I("[debug] ADC Cal Two Point");
   }
   else
   {
-    Serial.println("[debug] ADC Cal Default");
+    LOG_I("[debug] ADC Cal Default");
   }
 #endif
 
@@ -131,15 +133,15 @@ uint32_t readBatteryVoltage()
 
   if (val_type == ADC_CALI_LINE_FITTING_EFUSE_VAL_EFUSE_VREF)
   {
-    Serial.println("[debug] ADC Cal eFuse Vref");
+    LOG_I("[debug] ADC Cal eFuse Vref");
   }
   else if (val_type == ADC_CALI_LINE_FITTING_EFUSE_VAL_EFUSE_TP )
   {
-    Serial.println("[debug] ADC Cal Two Point");
+    LOG_I("[debug] ADC Cal Two Point");
   }
   else
   {
-    Serial.println("[debug] ADC Cal Default");
+    LOG_I("[debug] ADC Cal Default");
   }
 #endif
 
@@ -559,6 +561,107 @@ bool isWindy(float wind_speed, float wind_gust) {
       || wind_gust  >= 40.2 /*m/s*/);
 }
 
+#ifdef ICONS_DOWNSCALE
+typedef struct scaled_icon
+{
+  const uint8_t *master;
+  uint16_t       size;
+  uint32_t       last_used;
+  uint8_t        bitmap[ICONS_CACHE_MAX_SIZE
+                        * ((ICONS_CACHE_MAX_SIZE + 7) / 8)];
+} scaled_icon_t;
+
+static scaled_icon_t scaled_icon_cache[ICONS_CACHE_SIZE] = {};
+static uint32_t scaled_icon_clock = 0;
+
+/* Box filters the m x m master bitmap down to n x n. Each output pixel covers a
+ * block of roughly m/n source pixels per side and is dark when at least half of
+ * the block is dark. Bitmaps are 1-bit, rows padded to a whole byte, and a 0
+ * bit is a dark pixel (as drawn by drawInvertedBitmap).
+ */
+static void downscaleBitmap(uint8_t *dst, int n, const uint8_t *src, int m)
+{
+  const int dst_row = (n + 7) / 8;
+  const int src_row = (m + 7) / 8;
+
+  memset(dst, 0xFF, n * dst_row);
+  for (int oy = 0; oy < n; ++oy)
+  {
+    const int y0 = oy * m / n;
+    const int y1 = (oy + 1) * m / n;
+    for (int ox = 0; ox < n; ++ox)
+    {
+      const int x0 = ox * m / n;
+      const int x1 = (ox + 1) * m / n;
+      int dark = 0;
+      for (int y = y0; y < y1; ++y)
+      {
+        const uint8_t *row = src + y * src_row;
+        for (int x = x0; x < x1; ++x)
+        {
+          if (!(pgm_read_byte(&row[x / 8]) & (0x80 >> (x % 8))))
+          {
+            ++dark;
+          }
+        }
+      }
+      if (2 * dark >= (y1 - y0) * (x1 - x0))
+      {
+        dst[oy * dst_row + ox / 8] &= ~(0x80 >> (ox % 8));
+      }
+    }
+  }
+  return;
+} // end downscaleBitmap
+
+/* Returns the master icon downscaled to size x size. The most recently used
+ * ICONS_CACHE_SIZE results are kept, so an icon repeated across the hourly
+ * outlook, or drawn again for every page of the display, is only rasterized
+ * once.
+ */
+const uint8_t *getScaledBitmap(const uint8_t *master, int size)
+{
+  if (size == ICONS_MASTER_SIZE)
+  {
+    return master;
+  }
+
+  ++scaled_icon_clock;
+  scaled_icon_t *lru = &scaled_icon_cache[0];
+  for (scaled_icon_t &entry : scaled_icon_cache)
+  {
+    if (entry.master == master && entry.size == size)
+    {
+      entry.last_used = scaled_icon_clock;
+      return entry.bitmap;
+    }
+    if (entry.last_used < lru->last_used)
+    {
+      lru = &entry;
+    }
+  }
+
+  downscaleBitmap(lru->bitmap, size, master, ICONS_MASTER_SIZE);
+  lru->master = master;
+  lru->size = size;
+  lru->last_used = scaled_icon_clock;
+  return lru->bitmap;
+} // end getScaledBitmap
+
+#endif // end ICONS_DOWNSCALE
+
+#ifdef USE_ASSET_PARTITION
+#define getIconBitmap(icon, size) getAssetBitmap(assetKey(#icon, size))
+#else
+#define getIconBitmap(icon, size) getBitmap(icon, size)
+#endif
+#ifdef ICONS_DOWNSCALE
+#define getConditionsIcon(icon, size) \
+  getScaledBitmap(getIconBitmap(icon, ICONS_MASTER_SIZE), size)
+#else
+#define getConditionsIcon(icon, size) getIconBitmap(icon, size)
+#endif
+
 /* Takes the current weather and today's daily weather forcast (from
  * OpenWeatherMap API response) and returns a pointer to the icon's 196x196
  * bitmap.
@@ -576,6 +679,11 @@ template <int BitmapSize>
 const uint8_t *getConditionsBitmap(int id, bool day, bool moon, bool cloudy,
                                    bool windy)
 {
+#ifdef ICONS_DOWNSCALE
+  static_assert(BitmapSize == ICONS_MASTER_SIZE
+                || BitmapSize <= ICONS_CACHE_MAX_SIZE,
+                "Icon size is not supported by the downscaled icon cache");
+#endif
   switch (id)
   {
   // Group 2xx: Thunderstorm
@@ -586,15 +694,15 @@ const uint8_t *getConditionsBitmap(int id, bool day, bool moon, bool cloudy,
   case 211: // Thunderstorm  thunderstorm                     11d
   case 212: // Thunderstorm  heavy thunderstorm               11d
   case 221: // Thunderstorm  ragged thunderstorm              11d
-    if (!cloudy && day)          {return getBitmap(wi_day_thunderstorm, BitmapSize);}
-    if (!cloudy && !day && moon) {return getBitmap(wi_night_alt_thunderstorm, BitmapSize);}
-    return getBitmap(wi_thunderstorm, BitmapSize);
+    if (!cloudy && day)          {return getConditionsIcon(wi_day_thunderstorm, BitmapSize);}
+    if (!cloudy && !day && moon) {return getConditionsIcon(wi_night_alt_thunderstorm, BitmapSize);}
+    return getConditionsIcon(wi_thunderstorm, BitmapSize);
   case 230: // Thunderstorm  thunderstorm with light drizzle  11d
   case 231: // Thunderstorm  thunderstorm with drizzle        11d
   case 232: // Thunderstorm  thunderstorm with heavy drizzle  11d
-    if (!cloudy && day)          {return getBitmap(wi_day_storm_showers, BitmapSize);}
-    if (!cloudy && !day && moon) {return getBitmap(wi_night_alt_storm_showers, BitmapSize);}
-    return getBitmap(wi_storm_showers, BitmapSize);
+    if (!cloudy && day)          {return getConditionsIcon(wi_day_storm_showers, BitmapSize);}
+    if (!cloudy && !day && moon) {return getConditionsIcon(wi_night_alt_storm_showers, BitmapSize);}
+    return getConditionsIcon(wi_storm_showers, BitmapSize);
   // Group 3xx: Drizzle
   case 300: // Drizzle       light intensity drizzle          09d
   case 301: // Drizzle       drizzle                          09d
@@ -605,114 +713,114 @@ const uint8_t *getConditionsBitmap(int id, bool day, bool moon, bool cloudy,
   case 313: // Drizzle       shower rain and drizzle          09d
   case 314: // Drizzle       heavy shower rain and drizzle    09d
   case 321: // Drizzle       shower drizzle                   09d
-    if (!cloudy && day)          {return getBitmap(wi_day_showers, BitmapSize);}
-    if (!cloudy && !day && moon) {return getBitmap(wi_night_alt_showers, BitmapSize);}
-    return getBitmap(wi_showers, BitmapSize);
+    if (!cloudy && day)          {return getConditionsIcon(wi_day_showers, BitmapSize);}
+    if (!cloudy && !day && moon) {return getConditionsIcon(wi_night_alt_showers, BitmapSize);}
+    return getConditionsIcon(wi_showers, BitmapSize);
   // Group 5xx: Rain
   case 500: // Rain          light rain                       10d
   case 501: // Rain          moderate rain                    10d
   case 502: // Rain          heavy intensity rain             10d
   case 503: // Rain          very heavy rain                  10d
   case 504: // Rain          extreme rain                     10d
-    if (!cloudy && day && windy)          {return getBitmap(wi_day_rain_wind, BitmapSize);}
-    if (!cloudy && day)                   {return getBitmap(wi_day_rain, BitmapSize);}
-    if (!cloudy && !day && moon && windy) {return getBitmap(wi_night_alt_rain_wind, BitmapSize);}
-    if (!cloudy && !day && moon)          {return getBitmap(wi_night_alt_rain, BitmapSize);}
-    if (windy)                            {return getBitmap(wi_rain_wind, BitmapSize);}
-    return getBitmap(wi_rain, BitmapSize);
+    if (!cloudy && day && windy)          {return getConditionsIcon(wi_day_rain_wind, BitmapSize);}
+    if (!cloudy && day)                   {return getConditionsIcon(wi_day_rain, BitmapSize);}
+    if (!cloudy && !day && moon && windy) {return getConditionsIcon(wi_night_alt_rain_wind, BitmapSize);}
+    if (!cloudy && !day && moon)          {return getConditionsIcon(wi_night_alt_rain, BitmapSize);}
+    if (windy)                            {return getConditionsIcon(wi_rain_wind, BitmapSize);}
+    return getConditionsIcon(wi_rain, BitmapSize);
   case 511: // Rain          freezing rain                    13d
-    if (!cloudy && day)          {return getBitmap(wi_day_rain_mix, BitmapSize);}
-    if (!cloudy && !day && moon) {return getBitmap(wi_night_alt_rain_mix, BitmapSize);}
-    return getBitmap(wi_rain_mix, BitmapSize);
+    if (!cloudy && day)          {return getConditionsIcon(wi_day_rain_mix, BitmapSize);}
+    if (!cloudy && !day && moon) {return getConditionsIcon(wi_night_alt_rain_mix, BitmapSize);}
+    return getConditionsIcon(wi_rain_mix, BitmapSize);
   case 520: // Rain          light intensity shower rain      09d
   case 521: // Rain          shower rain                      09d
   case 522: // Rain          heavy intensity shower rain      09d
   case 531: // Rain          ragged shower rain               09d
-    if (!cloudy && day)          {return getBitmap(wi_day_showers, BitmapSize);}
-    if (!cloudy && !day && moon) {return getBitmap(wi_night_alt_showers, BitmapSize);}
-    return getBitmap(wi_showers, BitmapSize);
+    if (!cloudy && day)          {return getConditionsIcon(wi_day_showers, BitmapSize);}
+    if (!cloudy && !day && moon) {return getConditionsIcon(wi_night_alt_showers, BitmapSize);}
+    return getConditionsIcon(wi_showers, BitmapSize);
   // Group 6xx: Snow
   case 600: // Snow          light snow                       13d
   case 601: // Snow          Snow                             13d
   case 602: // Snow          Heavy snow                       13d
-    if (!cloudy && day && windy)          {return getBitmap(wi_day_snow_wind, BitmapSize);}
-    if (!cloudy && day)                   {return getBitmap(wi_day_snow, BitmapSize);}
-    if (!cloudy && !day && moon && windy) {return getBitmap(wi_night_alt_snow_wind, BitmapSize);}
-    if (!cloudy && !day && moon)          {return getBitmap(wi_night_alt_snow, BitmapSize);}
-    if (windy)                            {return getBitmap(wi_snow_wind, BitmapSize);}
-    return getBitmap(wi_snow, BitmapSize);
+    if (!cloudy && day && windy)          {return getConditionsIcon(wi_day_snow_wind, BitmapSize);}
+    if (!cloudy && day)                   {return getConditionsIcon(wi_day_snow, BitmapSize);}
+    if (!cloudy && !day && moon && windy) {return getConditionsIcon(wi_night_alt_snow_wind, BitmapSize);}
+    if (!cloudy && !day && moon)          {return getConditionsIcon(wi_night_alt_snow, BitmapSize);}
+    if (windy)                            {return getConditionsIcon(wi_snow_wind, BitmapSize);}
+    return getConditionsIcon(wi_snow, BitmapSize);
   case 611: // Snow          Sleet                            13d
   case 612: // Snow          Light shower sleet               13d
   case 613: // Snow          Shower sleet                     13d
-    if (!cloudy && day)          {return getBitmap(wi_day_sleet, BitmapSize);}
-    if (!cloudy && !day && moon) {return getBitmap(wi_night_alt_sleet, BitmapSize);}
-    return getBitmap(wi_sleet, BitmapSize);
+    if (!cloudy && day)          {return getConditionsIcon(wi_day_sleet, BitmapSize);}
+    if (!cloudy && !day && moon) {return getConditionsIcon(wi_night_alt_sleet, BitmapSize);}
+    return getConditionsIcon(wi_sleet, BitmapSize);
   case 615: // Snow          Light rain and snow              13d
   case 616: // Snow          Rain and snow                    13d
   case 620: // Snow          Light shower snow                13d
   case 621: // Snow          Shower snow                      13d
   case 622: // Snow          Heavy shower snow                13d
-    if (!cloudy && day)          {return getBitmap(wi_day_rain_mix, BitmapSize);}
-    if (!cloudy && !day && moon) {return getBitmap(wi_night_alt_rain_mix, BitmapSize);}
-    return getBitmap(wi_rain_mix, BitmapSize);
+    if (!cloudy && day)          {return getConditionsIcon(wi_day_rain_mix, BitmapSize);}
+    if (!cloudy && !day && moon) {return getConditionsIcon(wi_night_alt_rain_mix, BitmapSize);}
+    return getConditionsIcon(wi_rain_mix, BitmapSize);
   // Group 7xx: Atmosphere
   case 701: // Mist          mist                             50d
-    if (!cloudy && day)          {return getBitmap(wi_day_fog, BitmapSize);}
-    if (!cloudy && !day && moon) {return getBitmap(wi_night_fog, BitmapSize);}
-    return getBitmap(wi_fog, BitmapSize);
+    if (!cloudy && day)          {return getConditionsIcon(wi_day_fog, BitmapSize);}
+    if (!cloudy && !day && moon) {return getConditionsIcon(wi_night_fog, BitmapSize);}
+    return getConditionsIcon(wi_fog, BitmapSize);
   case 711: // Smoke         Smoke                            50d
-    return getBitmap(wi_smoke, BitmapSize);
+    return getConditionsIcon(wi_smoke, BitmapSize);
   case 721: // Haze          Haze                             50d
-    if (day && !cloudy) {return getBitmap(wi_day_haze, BitmapSize);}
-    return getBitmap(wi_dust, BitmapSize);
+    if (day && !cloudy) {return getConditionsIcon(wi_day_haze, BitmapSize);}
+    return getConditionsIcon(wi_dust, BitmapSize);
   case 731: // Dust          sand/dust whirls                 50d
-    return getBitmap(wi_sandstorm, BitmapSize);
+    return getConditionsIcon(wi_sandstorm, BitmapSize);
   case 741: // Fog           fog                              50d
-    if (!cloudy && day)          {return getBitmap(wi_day_fog, BitmapSize);}
-    if (!cloudy && !day && moon) {return getBitmap(wi_night_fog, BitmapSize);}
-    return getBitmap(wi_fog, BitmapSize);
+    if (!cloudy && day)          {return getConditionsIcon(wi_day_fog, BitmapSize);}
+    if (!cloudy && !day && moon) {return getConditionsIcon(wi_night_fog, BitmapSize);}
+    return getConditionsIcon(wi_fog, BitmapSize);
   case 751: // Sand          sand                             50d
-    return getBitmap(wi_sandstorm, BitmapSize);
+    return getConditionsIcon(wi_sandstorm, BitmapSize);
   case 761: // Dust          dust                             50d
-    return getBitmap(wi_dust, BitmapSize);
+    return getConditionsIcon(wi_dust, BitmapSize);
   case 762: // Ash           volcanic ash                     50d
-    return getBitmap(wi_volcano, BitmapSize);
+    return getConditionsIcon(wi_volcano, BitmapSize);
   case 771: // Squall        squalls                          50d
-    return getBitmap(wi_cloudy_gusts, BitmapSize);
+    return getConditionsIcon(wi_cloudy_gusts, BitmapSize);
   case 781: // Tornado       tornado                          50d
-    return getBitmap(wi_tornado, BitmapSize);
+    return getConditionsIcon(wi_tornado, BitmapSize);
   // Group 800: Clear
   case 800: // Clear         clear sky                        01d 01n
-    if (windy)         {return getBitmap(wi_strong_wind, BitmapSize);}
-    if (!day && moon)  {return getBitmap(wi_night_clear, BitmapSize);}
-    if (!day && !moon) {return getBitmap(wi_stars, BitmapSize);}
-    return getBitmap(wi_day_sunny, BitmapSize);
+    if (windy)         {return getConditionsIcon(wi_strong_wind, BitmapSize);}
+    if (!day && moon)  {return getConditionsIcon(wi_night_clear, BitmapSize);}
+    if (!day && !moon) {return getConditionsIcon(wi_stars, BitmapSize);}
+    return getConditionsIcon(wi_day_sunny, BitmapSize);
   // Group 80x: Clouds
   case 801: // Clouds        few clouds: 11-25%               02d 02n
-    if (windy)         {return getBitmap(wi_strong_wind, BitmapSize);}
-    if (!day && moon)  {return getBitmap(wi_night_alt_partly_cloudy, BitmapSize);}
-    if (!day && !moon) {return getBitmap(wi_stars, BitmapSize);}
-    return getBitmap(wi_day_sunny_overcast, BitmapSize);
+    if (windy)         {return getConditionsIcon(wi_strong_wind, BitmapSize);}
+    if (!day && moon)  {return getConditionsIcon(wi_night_alt_partly_cloudy, BitmapSize);}
+    if (!day && !moon) {return getConditionsIcon(wi_stars, BitmapSize);}
+    return getConditionsIcon(wi_day_sunny_overcast, BitmapSize);
   case 802: // Clouds        scattered clouds: 25-50%         03d 03n
   case 803: // Clouds        broken clouds: 51-84%            04d 04n
-    if (windy && day)           {return getBitmap(wi_day_cloudy_gusts, BitmapSize);}
-    if (windy && !day && moon)  {return getBitmap(wi_night_alt_cloudy_gusts, BitmapSize);}
-    if (windy && !day && !moon) {return getBitmap(wi_cloudy_gusts, BitmapSize);}
-    if (!day && moon)           {return getBitmap(wi_night_alt_cloudy, BitmapSize);}
-    if (!day && !moon)          {return getBitmap(wi_cloud, BitmapSize);}
-    return getBitmap(wi_day_cloudy, BitmapSize);
+    if (windy && day)           {return getConditionsIcon(wi_day_cloudy_gusts, BitmapSize);}
+    if (windy && !day && moon)  {return getConditionsIcon(wi_night_alt_cloudy_gusts, BitmapSize);}
+    if (windy && !day && !moon) {return getConditionsIcon(wi_cloudy_gusts, BitmapSize);}
+    if (!day && moon)           {return getConditionsIcon(wi_night_alt_cloudy, BitmapSize);}
+    if (!day && !moon)          {return getConditionsIcon(wi_cloud, BitmapSize);}
+    return getConditionsIcon(wi_day_cloudy, BitmapSize);
   case 804: // Clouds        overcast clouds: 85-100%         04d 04n
-    if (windy) {return getBitmap(wi_cloudy_gusts, BitmapSize);}
-    return getBitmap(wi_cloudy, BitmapSize);
+    if (windy) {return getConditionsIcon(wi_cloudy_gusts, BitmapSize);}
+    return getConditionsIcon(wi_cloudy, BitmapSize);
   default:
     // maybe this is a new getBitmap in one of the existing groups
-    if (id >= 200 && id < 300) {return getBitmap(wi_thunderstorm, BitmapSize);}
-    if (id >= 300 && id < 400) {return getBitmap(wi_showers, BitmapSize);}
-    if (id >= 500 && id < 600) {return getBitmap(wi_rain, BitmapSize);}
-    if (id >= 600 && id < 700) {return getBitmap(wi_snow, BitmapSize);}
-    if (id >= 700 && id < 800) {return getBitmap(wi_fog, BitmapSize);}
-    if (id >= 800 && id < 900) {return getBitmap(wi_cloudy, BitmapSize);}
-    return getBitmap(wi_na, BitmapSize);
+    if (id >= 200 && id < 300) {return getConditionsIcon(wi_thunderstorm, BitmapSize);}
+    if (id >= 300 && id < 400) {return getConditionsIcon(wi_showers, BitmapSize);}
+    if (id >= 500 && id < 600) {return getConditionsIcon(wi_rain, BitmapSize);}
+    if (id >= 600 && id < 700) {return getConditionsIcon(wi_snow, BitmapSize);}
+    if (id >= 700 && id < 800) {return getConditionsIcon(wi_fog, BitmapSize);}
+    if (id >= 800 && id < 900) {return getConditionsIcon(wi_cloudy, BitmapSize);}
+    return getConditionsIcon(wi_na, BitmapSize);
   }
 } // end getConditionsBitmap
 
@@ -1415,6 +1523,82 @@ static const unsigned char *wind_direction_icon_arr[] = {
   wind_direction_meteorological_358deg_24x24,
   wind_direction_meteorological_359deg_24x24};
 #endif // end WIND_ICONS_360
+#ifdef WIND_ICONS_PROCEDURAL
+// sin(0..90deg) in Q14 fixed point, other quadrants are derived by symmetry
+static const int16_t sin_q14[91] = {
+      0,   286,   572,   857,  1143,  1428,  1713,  1997,  2280,  2563,
+   2845,  3126,  3406,  3686,  3964,  4240,  4516,  4790,  5063,  5334,
+   5604,  5872,  6138,  6402,  6664,  6924,  7182,  7438,  7692,  7943,
+   8192,  8438,  8682,  8923,  9162,  9397,  9630,  9860, 10087, 10311,
+  10531, 10749, 10963, 11174, 11381, 11585, 11786, 11982, 12176, 12365,
+  12551, 12733, 12911, 13085, 13255, 13421, 13583, 13741, 13894, 14044,
+  14189, 14330, 14466, 14598, 14726, 14849, 14968, 15082, 15191, 15296,
+  15396, 15491, 15582, 15668, 15749, 15826, 15897, 15964, 16026, 16083,
+  16135, 16182, 16225, 16262, 16294, 16322, 16344, 16362, 16374, 16382,
+  16384};
+
+#ifndef WIND_ICONS_CACHE_SIZE
+#define WIND_ICONS_CACHE_SIZE 1
+#endif
+static uint8_t wind_icon_cache[WIND_ICONS_CACHE_SIZE][24 * 24 / 8];
+static int16_t wind_icon_cache_deg[WIND_ICONS_CACHE_SIZE];
+static int wind_icon_cache_cnt = 0;  // number of valid cache entries
+static int wind_icon_cache_next = 0; // next cache entry to be replaced
+
+/* Returns sin(deg) in Q14 fixed point for integer angles 0 to 359 degrees.
+ */
+static int32_t sinQ14(int deg)
+{
+  if (deg <= 90)  { return  sin_q14[deg]; }
+  if (deg <= 180) { return  sin_q14[180 - deg]; }
+  if (deg <= 270) { return -sin_q14[deg - 180]; }
+  return -sin_q14[360 - deg];
+} // end sinQ14
+
+/* Rasterizes the 48x48 master arrow (0deg) rotated clockwise by windDeg into a
+ * 24x24 1-bit bitmap, using nearest neighbour sampling. The master is twice the
+ * output resolution so that the rotated edges match the pre-rendered icons.
+ */
+static void rotateWindArrow24(uint8_t *dst, int windDeg)
+{
+  const int N = 24;  // output size
+  const int M = 48;  // master size
+  const uint8_t *src = wind_direction_meteorological_0deg_48x48;
+  const int32_t s = sinQ14(windDeg);
+  const int32_t c = sinQ14((windDeg + 90) % 360);
+  // coordinates are doubled relative to the pixel centres so that the centre of
+  // rotation (11.5, 11.5) stays an integer
+  const int32_t half = M * N * 16384;
+  const int32_t div  = 2 * N * 16384;
+
+  memset(dst, 0xFF, N * N / 8);
+  for (int y = 0; y < N; ++y)
+  {
+    int32_t dy = (2 * y + 1 - N) * M;
+    for (int x = 0; x < N; ++x)
+    {
+      int32_t dx = (2 * x + 1 - N) * M;
+      int32_t sx = dx * c + dy * s + half;
+      int32_t sy = dy * c - dx * s + half;
+      if (sx < 0 || sy < 0)
+      {
+        continue;
+      }
+      int mx = sx / div;
+      int my = sy / div;
+      if (mx >= M || my >= M)
+      {
+        continue;
+      }
+      if (!(pgm_read_byte(&src[my * (M / 8) + mx / 8]) & (0x80 >> (mx % 8))))
+      {
+        dst[y * (N / 8) + x / 8] &= ~(0x80 >> (x % 8));
+      }
+    }
+  }
+  return;
+} // end rotateWindArrow24
+#endif // end WIND_ICONS_PROCEDURAL
 
 /* Returns a 24x24 wind direction icon bitmap for angles 0 to 359 degrees
  * Parameter is meteorological wind direction, arrow points in the direction the
@@ -1423,6 +1607,28 @@ static const unsigned char *wind_direction_icon_arr[] = {
 const uint8_t *getWindBitmap24(int windDeg)
 {
   windDeg %= 360; // enforce domain
+#ifdef WIND_ICONS_PROCEDURAL
+  if (windDeg < 0)
+  {
+    windDeg += 360;
+  }
+  for (int i = 0; i < wind_icon_cache_cnt; ++i)
+  {
+    if (wind_icon_cache_deg[i] == windDeg)
+    {
+      return wind_icon_cache[i];
+    }
+  }
+  int i = wind_icon_cache_next;
+  wind_icon_cache_next = (wind_icon_cache_next + 1) % WIND_ICONS_CACHE_SIZE;
+  rotateWindArrow24(wind_icon_cache[i], windDeg);
+  wind_icon_cache_deg[i] = windDeg;
+  if (wind_icon_cache_cnt < WIND_ICONS_CACHE_SIZE)
+  {
+    ++wind_icon_cache_cnt;
+  }
+  return wind_icon_cache[i];
+#else
   // number of directions
   int n = sizeof(wind_direction_icon_arr)
           / sizeof(wind_direction_icon_arr[0]);
@@ -1430,6 +1636,7 @@ const uint8_t *getWindBitmap24(int windDeg)
                          / ( 360 / (float) n );
 
   return wind_direction_icon_arr[arr_offset];
+#endif
 } // end getWindBitmap24
 
 /* Returns a pointer to a string that expresses the Compass Point Notation (CPN)
@@ -1628,6 +1835,7 @@ void disableBuiltinLED()
   return;
 } // end disableBuiltinLED
 
+#ifndef MOONPHASE_PROCEDURAL
 // Define the set of moon phase icon base on the chosen moon phase style
 #ifdef MOONPHASE_PRIMARY
 static const unsigned char *moon_phase_icon_arr[] = {
@@ -1708,6 +1916,7 @@ const uint8_t *getMoonPhaseBitmap48(const owm_daily_t &daily)
   int n = static_cast<int>(daily.moon_phase * 28 + 0.5);
     return moon_phase_icon_arr[n];
 } // end getMoonPhaseBitmap48
+#endif // end MOONPHASE_PROCEDURAL
 
 
 // Returns the current moon phase string
@@ -1902,12 +2111,12 @@ const uint8_t *getForecastBitmap32(const owm_hourly_t &hourly)
   bool windy  = (hourly.wind_speed >= 32.2 /*m/s*/
               || hourly.wind_gust  >= 40.2 /*m/s*/);
 
-  Serial.printf("[weather] id=%d, desc=%s, icon=%s, clouds=%d, wind=%f-%f\n",
-		hourly.weather.id,
-		hourly.weather.description.c_str(),
-		hourly.weather.icon.c_str(),
-                hourly.clouds,
-                hourly.wind_speed, hourly.wind_gust);
+  LOG_D("[weather] id=%d, desc=%s, icon=%s, clouds=%d, wind=%f-%f",
+        hourly.weather.id,
+        hourly.weather.description.c_str(),
+        hourly.weather.icon.c_str(),
+        hourly.clouds,
+        hourly.wind_speed, hourly.wind_gust);
 
   switch (id)
   {
@@ -0,0 +1,82 @@
+/* Frame buffer preview for esp32-weather-epd.
+ * Copyright (C) 2022-2026  Luke Marzen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "config.h"
+#ifdef WEB_PREVIEW
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include "frame_preview.h"
+
+std::atomic<int> preview_state(PREVIEW_IDLE);
+
+PbmStream::PbmStream(RleFrame &frame)
+  : _frame(frame), _header_sent(0), _y(0), _x(0), _run(nullptr), _left(0)
+{
+  _header_len = snprintf(_header, sizeof(_header), "P4\n%d %d\n",
+                         frame.frameWidth(), frame.frameHeight());
+}
+
+/*
+ * read
+ *
+ * Copies the rest of the header, then packs 8 pixels per byte, MSB first;
+ * the last byte of a row is padded with 0.
+ */
+size_t PbmStream::read(uint8_t *buf, size_t len)
+{
+  const int16_t W = _frame.frameWidth();
+  size_t out = 0;
+  if (_header_sent < _header_len)
+  {
+    out = std::min(_header_len - _header_sent, len);
+    memcpy(buf, _header + _header_sent, out);
+    _header_sent += out;
+  }
+  while (out < len && _y < _frame.frameHeight())
+  {
+    if (_run == nullptr)
+    {
+      _run = _frame.encodedRow(_y) + 1;
+      _left = *_run >> 4;
+    }
+    uint8_t bits = 0;
+    for (uint8_t mask = 0x80; mask != 0 && _x < W; mask >>= 1, ++_x)
+    {
+      while (_left == 0)
+      {
+        _left = *++_run >> 4;
+      }
+      if ((*_run & 0x0F) != RLE_WHITE)
+      {
+        bits |= mask;
+      }
+      --_left;
+    }
+    buf[out++] = bits;
+    if (_x >= W)
+    {
+      _x = 0;
+      _run = nullptr;
+      ++_y;
+    }
+  }
+  return out;
+} // end read
+
+#endif // WEB_PREVIEW
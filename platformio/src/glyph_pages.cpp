@@ -0,0 +1,291 @@
+/* Unicode glyph pages for esp32-weather-epd.
+ * Copyright (C) 2022-2026  Luke Marzen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "config.h"
+#ifdef USE_GLYPH_PAGES
+
+#include <cstdlib>
+#include <cstring>
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#include <esp_partition.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#include "glyph_pages.h"
+#include "logger.h"
+
+#define GLYPH_PAGES_MAX_FONTS 32
+
+typedef struct glyph_cache_entry
+{
+  uint16_t      size_pt; // 0 if the entry is unused
+  bool          found;   // false caches a codepoint missing from the pages
+  uint32_t      codepoint;
+  uint32_t      last_used;
+  uint16_t      bytes;
+  paged_glyph_t glyph;
+} glyph_cache_entry_t;
+
+static glyph_cache_entry_t glyph_cache[GLYPH_CACHE_SIZE] = {};
+static uint32_t glyph_cache_clock = 0;
+static size_t   glyph_cache_bytes = 0;
+
+static glyph_pages_font_t glyph_fonts[GLYPH_PAGES_MAX_FONTS];
+static uint16_t glyph_font_count = 0;
+static uint32_t glyph_pages_size = 0;
+#ifdef ARDUINO
+static const esp_partition_t *glyph_partition = nullptr;
+#else
+static int glyph_fd = -1;
+#endif
+
+/*
+ * readPages
+ *
+ * Reads len bytes at offset from the glyph pages, returns false on error.
+ */
+static bool readPages(uint32_t offset, void *dst, size_t len)
+{
+  if (offset + len > glyph_pages_size)
+  {
+    return false;
+  }
+#ifdef ARDUINO
+  return esp_partition_read(glyph_partition, offset, dst, len) == ESP_OK;
+#else
+  return pread(glyph_fd, dst, len, offset) == static_cast<ssize_t>(len);
+#endif
+} // end readPages
+
+/*
+ * findGlyph
+ *
+ * Binary search of the index of one font, reading one entry per step.
+ */
+static bool findGlyph(const glyph_pages_font_t &font, uint32_t codepoint,
+                      glyph_pages_glyph_t &glyph)
+{
+  int32_t lo = 0;
+  int32_t hi = static_cast<int32_t>(font.glyph_count) - 1;
+  while (lo <= hi)
+  {
+    int32_t mid = (lo + hi) / 2;
+    if (!readPages(font.index_offset + mid * sizeof(glyph_pages_glyph_t),
+                   &glyph, sizeof(glyph)))
+    {
+      return false;
+    }
+    if (glyph.codepoint == codepoint)
+    {
+      return true;
+    }
+    if (glyph.codepoint < codepoint)
+    {
+      lo = mid + 1;
+    }
+    else
+    {
+      hi = mid - 1;
+    }
+  }
+  return false;
+} // end findGlyph
+
+/*
+ * evictGlyph
+ *
+ * Frees the bitmap of a cache entry and marks it unused.
+ */
+static void evictGlyph(glyph_cache_entry_t &entry)
+{
+  free(const_cast<uint8_t *>(entry.glyph.bitmap));
+  glyph_cache_bytes -= entry.bytes;
+  entry = {};
+  return;
+} // end evictGlyph
+
+/*
+ * getPagedGlyph
+ *
+ * Returns the glyph of codepoint at size_pt, or nullptr if the pages do not
+ * have it. Glyphs are cached, the least recently used ones are evicted when
+ * GLYPH_CACHE_SIZE glyphs or GLYPH_CACHE_BYTES bytes of bitmaps are reached.
+ */
+const paged_glyph_t *getPagedGlyph(uint16_t size_pt, uint32_t codepoint)
+{
+  ++glyph_cache_clock;
+  glyph_cache_entry_t *lru = &glyph_cache[0];
+  for (glyph_cache_entry_t &entry : glyph_cache)
+  {
+    if (entry.size_pt == size_pt && entry.codepoint == codepoint)
+    {
+      entry.last_used = glyph_cache_clock;
+      return entry.found ? &entry.glyph : nullptr;
+    }
+    if (entry.last_used < lru->last_used)
+    {
+      lru = &entry;
+    }
+  }
+
+  const glyph_pages_font_t *font = nullptr;
+  for (uint16_t i = 0; i < glyph_font_count; ++i)
+  {
+    if (glyph_fonts[i].size_pt == size_pt)
+    {
+      font = &glyph_fonts[i];
+    }
+  }
+  glyph_pages_glyph_t g;
+  bool found = font != nullptr && findGlyph(*font, codepoint, g);
+  uint16_t bytes = found ? (g.width * g.height + 7) / 8 : 0;
+  if (bytes > GLYPH_CACHE_BYTES)
+  {
+    found = false;
+    bytes = 0;
+  }
+
+  if (lru->size_pt != 0)
+  {
+    evictGlyph(*lru);
+  }
+  while (glyph_cache_bytes + bytes > GLYPH_CACHE_BYTES)
+  {
+    glyph_cache_entry_t *victim = nullptr;
+    for (glyph_cache_entry_t &entry : glyph_cache)
+    {
+      if (entry.bytes != 0
+       && (victim == nullptr || entry.last_used < victim->last_used))
+      {
+        victim = &entry;
+      }
+    }
+    evictGlyph(*victim);
+  }
+
+  uint8_t *bitmap = nullptr;
+  if (bytes != 0)
+  {
+    bitmap = static_cast<uint8_t *>(malloc(bytes));
+    if (bitmap == nullptr
+     || !readPages(font->bitmap_offset + g.bitmap_offset, bitmap, bytes))
+    {
+      free(bitmap);
+      return nullptr;
+    }
+  }
+  lru->size_pt   = size_pt;
+  lru->found     = found;
+  lru->codepoint = codepoint;
+  lru->last_used = glyph_cache_clock;
+  lru->bytes     = bytes;
+  glyph_cache_bytes += bytes;
+  if (found)
+  {
+    lru->glyph = {g.width, g.height, g.xAdvance, g.xOffset, g.yOffset, bitmap};
+    return &lru->glyph;
+  }
+  return nullptr;
+} // end getPagedGlyph
+
+/*
+ * glyphPagesBegin
+ *
+ * Opens the glyph pages (the GLYPH_PARTITION_LABEL partition, or on a host
+ * build the file named by $EPD_GLYPHS, default glyphs.bin) and reads the font
+ * table. Returns false if the pages are missing or invalid, text is then drawn
+ * with the 8-bit fonts only.
+ */
+bool glyphPagesBegin()
+{
+  if (glyph_pages_size != 0)
+  {
+    return true;
+  }
+#ifdef ARDUINO
+  glyph_partition = esp_partition_find_first(
+    ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, GLYPH_PARTITION_LABEL);
+  if (glyph_partition == nullptr)
+  {
+    LOG_W("Glyph partition not found");
+    return false;
+  }
+  glyph_pages_size = glyph_partition->size;
+#else
+  const char *path = getenv("EPD_GLYPHS");
+  glyph_fd = open(path ? path : "glyphs.bin", O_RDONLY);
+  off_t size = (glyph_fd < 0) ? -1 : lseek(glyph_fd, 0, SEEK_END);
+  if (size < 0)
+  {
+    LOG_W("Glyph pages not found");
+    glyphPagesEnd();
+    return false;
+  }
+  glyph_pages_size = static_cast<uint32_t>(size);
+#endif
+
+  glyph_pages_header_t hdr;
+  if (!readPages(0, &hdr, sizeof(hdr))
+   || hdr.magic != GLYPH_PAGES_MAGIC
+   || hdr.format_version != GLYPH_PAGES_FORMAT_VERSION
+   || hdr.total_size > glyph_pages_size
+   || hdr.font_count > GLYPH_PAGES_MAX_FONTS
+   || !readPages(sizeof(hdr), glyph_fonts,
+                 hdr.font_count * sizeof(glyph_pages_font_t)))
+  {
+    LOG_W("Invalid glyph pages");
+    glyphPagesEnd();
+    return false;
+  }
+  glyph_pages_size = hdr.total_size;
+  glyph_font_count = hdr.font_count;
+  return true;
+} // end glyphPagesBegin
+
+/*
+ * glyphPagesEnd
+ *
+ * Releases the cache and closes the glyph pages.
+ */
+void glyphPagesEnd()
+{
+  for (glyph_cache_entry_t &entry : glyph_cache)
+  {
+    if (entry.size_pt != 0)
+    {
+      evictGlyph(entry);
+    }
+  }
+  glyph_font_count = 0;
+  glyph_pages_size = 0;
+#ifdef ARDUINO
+  glyph_partition = nullptr;
+#else
+  if (glyph_fd >= 0)
+  {
+    close(glyph_fd);
+  }
+  glyph_fd = -1;
+#endif
+  return;
+} // end glyphPagesEnd
+
+#endif // USE_GLYPH_PAGES
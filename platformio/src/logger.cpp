@@ -0,0 +1,262 @@
+/* Levelled logging for esp32-weather-epd.
+ * Copyright (C) 2022-2026  Luke Marzen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "config.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdarg>
+#include <cstdio>
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#include <driver/uart.h>
+#include <esp_attr.h>
+#include <freertos/FreeRTOS.h>
+static portMUX_TYPE log_mux = portMUX_INITIALIZER_UNLOCKED;
+#define LOG_LOCK()   portENTER_CRITICAL(&log_mux)
+#define LOG_UNLOCK() portEXIT_CRITICAL(&log_mux)
+#else
+#include <chrono>
+#include <climits>
+#include <mutex>
+#define RTC_DATA_ATTR
+static std::mutex log_mux;
+#define LOG_LOCK()   log_mux.lock()
+#define LOG_UNLOCK() log_mux.unlock()
+static uint32_t millis()
+{
+  static const auto start = std::chrono::steady_clock::now();
+  return std::chrono::duration_cast<std::chrono::milliseconds>(
+    std::chrono::steady_clock::now() - start).count();
+}
+#endif
+
+#include "logger.h"
+
+// Transmit buffer of the UART driver, the drain writes up to its free space
+#define LOG_UART_TX_BUFFER 512
+
+#define LOG_RING_MASK (LOG_RING_SIZE - 1)
+
+// Survive deep sleep; the initial values are set on power on only
+RTC_DATA_ATTR static char     log_ring[LOG_RING_SIZE];
+RTC_DATA_ATTR static uint32_t log_head;  // bytes written since power on
+RTC_DATA_ATTR static uint32_t log_wakes;
+RTC_DATA_ATTR static uint8_t  log_level = LOG_LEVEL;
+
+// Next byte of the ring to send to the serial port, from logBegin()
+static uint32_t log_uart_pos;
+static bool     log_uart;
+
+/*
+ * UART
+ */
+static size_t log_uart_room()
+{
+#ifdef ARDUINO
+  int room = Serial.availableForWrite();
+  return (room > 0) ? room : 0;
+#else
+  return SIZE_MAX;
+#endif
+}
+
+static void log_uart_write(const uint8_t *buf, size_t len)
+{
+#ifdef ARDUINO
+  Serial.write(buf, len);
+#else
+  fwrite(buf, 1, len, stdout);
+#endif
+}
+
+/*
+ * Copies the line into the ring; the oldest bytes are overwritten
+ */
+static void log_append(const char *line, size_t len)
+{
+  LOG_LOCK();
+  for (size_t i = 0; i < len; ++i)
+  {
+    log_ring[(log_head + i) & LOG_RING_MASK] = line[i];
+  }
+  log_head += len;
+  LOG_UNLOCK();
+}
+
+void logBegin(unsigned long baud)
+{
+#ifdef ARDUINO
+  Serial.setTxBufferSize(LOG_UART_TX_BUFFER);
+  Serial.begin(baud);
+#endif
+  // only the lines of this wake go to the serial port
+  log_uart_pos = log_head;
+  log_uart = true;
+
+  char line[32];
+  int len = snprintf(line, sizeof(line), "---- wake %u ----\n",
+                     (unsigned) ++log_wakes);
+  log_append(line, len);
+  logDrain();
+}
+
+void logWrite(uint8_t level, const char *fmt, ...)
+{
+  if (level > log_level)
+  {
+    return;
+  }
+
+  char line[LOG_LINE_MAX];
+  const uint32_t ms = millis();
+  int len = snprintf(line, sizeof(line), "[%6u.%03u] %c ",
+                     (unsigned) (ms / 1000), (unsigned) (ms % 1000),
+                     "-EWID"[level]);
+  // room is kept for the newline
+  va_list args;
+  va_start(args, fmt);
+  int msg = vsnprintf(line + len, sizeof(line) - len - 1, fmt, args);
+  va_end(args);
+  if (msg > 0)
+  {
+    len += std::min<int>(msg, sizeof(line) - len - 2);
+  }
+  line[len++] = '\n';
+
+  log_append(line, len);
+  logDrain();
+}
+
+void logDrain()
+{
+  // one drain at a time, or the chunks could reach the UART out of order
+  static std::atomic_flag busy = ATOMIC_FLAG_INIT;
+
+  if (!log_uart || busy.test_and_set())
+  {
+    return;
+  }
+  for (;;)
+  {
+    uint8_t buf[64];
+    size_t room = log_uart_room();
+    if (room == 0)
+    {
+      break;
+    }
+
+    LOG_LOCK();
+    if (log_head - log_uart_pos > LOG_RING_SIZE)
+    {
+      // overwritten before being sent
+      log_uart_pos = log_head - LOG_RING_SIZE;
+    }
+    size_t n = std::min<size_t>(log_head - log_uart_pos,
+                                std::min(room, sizeof(buf)));
+    for (size_t i = 0; i < n; ++i)
+    {
+      buf[i] = log_ring[(log_uart_pos + i) & LOG_RING_MASK];
+    }
+    log_uart_pos += n;
+    LOG_UNLOCK();
+
+    if (n == 0)
+    {
+      break;
+    }
+    log_uart_write(buf, n);
+  }
+  busy.clear();
+}
+
+void logFlush(uint32_t ms)
+{
+  const uint32_t start = millis();
+
+  for (;;)
+  {
+    logDrain();
+    if (!log_uart || log_uart_pos == log_head || millis() - start >= ms)
+    {
+      break;
+    }
+#ifdef ARDUINO
+    delay(1);
+#endif
+  }
+#ifdef ARDUINO
+  // what the driver still holds, within the same time
+  const uint32_t spent = millis() - start;
+  if (spent < ms)
+  {
+    uart_wait_tx_done(UART_NUM_0, pdMS_TO_TICKS(ms - spent));
+  }
+#endif
+}
+
+void logSetLevel(uint8_t level)
+{
+  log_level = std::min<uint8_t>(level, LOG_LEVEL);
+}
+
+uint8_t logGetLevel()
+{
+  return log_level;
+}
+
+/*
+ * LogStream
+ */
+LogStream::LogStream()
+{
+  LOG_LOCK();
+  _end = log_head;
+  LOG_UNLOCK();
+  _skipPartial = _end > LOG_RING_SIZE;
+  _pos = _skipPartial ? _end - LOG_RING_SIZE : 0;
+}
+
+size_t LogStream::read(uint8_t *buf, size_t len)
+{
+  size_t n = 0;
+
+  LOG_LOCK();
+  if (log_head - _pos > LOG_RING_SIZE)
+  {
+    // overwritten since the last read
+    _pos = log_head - LOG_RING_SIZE;
+    _skipPartial = true;
+    if ((int32_t) (_end - _pos) < 0)
+    {
+      _pos = _end;
+    }
+  }
+  while (_skipPartial && _pos != _end)
+  {
+    _skipPartial = log_ring[_pos++ & LOG_RING_MASK] != '\n';
+  }
+  n = std::min<size_t>(_end - _pos, len);
+  for (size_t i = 0; i < n; ++i)
+  {
+    buf[i] = log_ring[(_pos + i) & LOG_RING_MASK];
+  }
+  _pos += n;
+  LOG_UNLOCK();
+  return n;
+}
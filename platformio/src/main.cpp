@@ -25,10 +25,18 @@
 
 #include "_locale.h"
 #include "api_response.h"
+#include "asset_store.h"
 #include "client_utils.h"
 #include "config.h"
 #include "display_utils.h"
+#include "frame_preview.h"
+#include "metrics.h"
+#include "glyph_pages.h"
 #include "icons/icons_196x196.h"
+#include "logger.h"
+#include "parse_pipeline.h"
+#include "profiler.h"
+#include "refresh_policy.h"
 #include "renderer.h"
 
 #if defined(SENSOR_BME280)
@@ -58,6 +66,12 @@ unsigned long startTime;
 unsigned long actionTime;
 unsigned long restart_delay = 0L;
 
+// Last display refresh, and refresh requested from the Web server
+// (refresh_pending set once refresh_at is reached)
+unsigned long refreshTime;
+volatile unsigned long refresh_at = 0L;
+volatile int refresh_pending = 0;
+
 // When set means Web server started but with no display update
 // (i.e. error while report-error flag disabled)
 int SilentErr = 0;
@@ -97,13 +111,18 @@ void do_deep_sleep ( uint64_t sleepDuration )
   // Enable Wake Up with touch pin
   touchSleepWakeUpEnable(TOUCH_PIN,TOUCH_THR);
 #endif
+
+  // Parameters changed through the Web server and not saved yet
+  config_flush();
 #endif // WEB_SVR
 
+  METRICS_PHASE(METRICS_AWAKE, millis());
+  METRICS_HEAP();
+
   esp_sleep_enable_timer_wakeup(sleepDuration * 1000ULL);
-  Serial.print(TXT_AWAKE_FOR);
-  Serial.println(" "  + String((millis() - startTime) / 1000.0, 3) + "s");
-  Serial.print(TXT_ENTERING_DEEP_SLEEP_FOR);
-  Serial.println(" " + String(sleepDuration/1000ULL) + "s");
+  LOG_I("%s %.3fs", TXT_AWAKE_FOR, (millis() - startTime) / 1000.0);
+  LOG_I("%s %llus", TXT_ENTERING_DEEP_SLEEP_FOR, sleepDuration / 1000ULL);
+  logFlush(LOG_FLUSH_MS);
 
   esp_deep_sleep_start();
 }
@@ -136,8 +155,8 @@ void beginDeepSleep(tm *timeInfo)
   {
     // In case of HTTP error, retry quickly a certain number of time
     sleepDuration = HTTP_RETRY_DLY;
-    Serial.printf("HTTP error: quick wake mode, wake-delay=%lldsec, retry-left=%d\n",
-                  sleepDuration, MaxErrorCnt+1);
+    LOG_W("HTTP error: quick wake mode, wake-delay=%llusec, retry-left=%d",
+          sleepDuration, MaxErrorCnt+1);
     do_deep_sleep(sleepDuration * 1000ULL);
   }
 
@@ -216,15 +235,15 @@ esp_sleep_wakeup_cause_t print_wakeup_reason()
   switch(wakeup_reason)
   {
     case ESP_SLEEP_WAKEUP_EXT0 :
-      Serial.println("Wakeup caused by external signal using RTC_IO"); break;
+      LOG_I("Wakeup caused by external signal using RTC_IO"); break;
     case ESP_SLEEP_WAKEUP_EXT1 :
-      Serial.println("Wakeup caused by external signal using RTC_CNTL"); break;
+      LOG_I("Wakeup caused by external signal using RTC_CNTL"); break;
     case ESP_SLEEP_WAKEUP_TIMER :
-      Serial.println("Wakeup caused by timer"); break;
-    case ESP_SLEEP_WAKEUP_TOUCHPAD : Serial.println("Wakeup caused by touchpad"); break;
-    //case ESP_SLEEP_WAKEUP_ULP : Serial.println("Wakeup caused by ULP program"); break;
+      LOG_I("Wakeup caused by timer"); break;
+    case ESP_SLEEP_WAKEUP_TOUCHPAD : LOG_I("Wakeup caused by touchpad"); break;
+    //case ESP_SLEEP_WAKEUP_ULP : LOG_I("Wakeup caused by ULP program"); break;
     default :
-      Serial.printf("Wakeup was not caused by deep sleep: %d\n",wakeup_reason);
+      LOG_I("Wakeup was not caused by deep sleep: %d", wakeup_reason);
       break;
   }
 
@@ -233,169 +252,59 @@ esp_sleep_wakeup_cause_t print_wakeup_reason()
 #endif // WEB_SVR
 
 /*
- * setup
+ * refreshWeather
  *
- * Program initialization
+ * Fetch the weather of the selected location, read the indoor sensor and
+ * draw the whole screen (WiFi connected). timeInfo is set from the OWM data.
+ * On an HTTP error, the error is reported on the display (report-error flag)
+ * and false is returned; WiFi is then turned off unless keepWiFi is set.
  */
-void setup()
+static bool refreshWeather(int wifiRSSI, uint32_t batteryVoltage,
+                           int manual_wakeup, bool keepWiFi, tm &timeInfo)
 {
-  int manual_wakeup = 0;
-
-  actionTime = startTime = millis();
-  Serial.begin(115200);
-
-#ifdef WEB_SVR
-  // Fetch Weather and Wifi data from non volatile memory
-  retrieve_config();
-
-  // Check if button pressed
-#ifdef BUTTON_PIN
-  manual_wakeup = (print_wakeup_reason() == ESP_SLEEP_WAKEUP_EXT0);
-#else
-  manual_wakeup = (print_wakeup_reason() == ESP_SLEEP_WAKEUP_TOUCHPAD);
-#endif
-  if ( manual_wakeup )
-    Serial.println("Awaked, please press button again to go back to sleep");
-#endif // WEB_SVR
-
-#if DEBUG_LEVEL >= 1
-  printHeapUsage();
-#endif
-
-  disableBuiltinLED();
-
-  // Open namespace for read/write to non-volatile storage
-  prefs.begin(NVS_NAMESPACE, false);
-
-#if BATTERY_MONITORING
-  uint32_t batteryVoltage = readBatteryVoltage();
-  Serial.print(TXT_BATTERY_VOLTAGE);
-  Serial.println(": " + String(batteryVoltage) + "mv");
-
-  // When the battery is low, the display should be updated to reflect that, but
-  // only the first time we detect low voltage. The next time the display will
-  // refresh is when voltage is no longer low. To keep track of that we will
-  // make use of non-volatile storage.
-  bool lowBat = prefs.getBool("lowBat", false);
-
-  // low battery, deep sleep now
-  if (batteryVoltage <= LOW_BATTERY_VOLTAGE)
-  {
-    if (lowBat == false)
-    { // battery is now low for the first time
-      prefs.putBool("lowBat", true);
-      prefs.end();
-      initDisplay(0);
-      do
-      {
-        drawError(battery_alert_0deg_196x196, TXT_LOW_BATTERY);
-      } while (display.nextPage());
-      powerOffDisplay();
-    }
-
-    if (batteryVoltage <= CRIT_LOW_BATTERY_VOLTAGE)
-    { // critically low battery
-      // don't set esp_sleep_enable_timer_wakeup();
-      // We won't wake up again until someone manually presses the RST button.
-      Serial.println(TXT_CRIT_LOW_BATTERY_VOLTAGE);
-      Serial.println(TXT_HIBERNATING_INDEFINITELY_NOTICE);
-    }
-    else if (batteryVoltage <= VERY_LOW_BATTERY_VOLTAGE)
-    { // very low battery
-      esp_sleep_enable_timer_wakeup(VERY_LOW_BATTERY_SLEEP_INTERVAL
-                                    * 60ULL * 1000000ULL);
-      Serial.println(TXT_VERY_LOW_BATTERY_VOLTAGE);
-      Serial.print(TXT_ENTERING_DEEP_SLEEP_FOR);
-      Serial.println(" " + String(VERY_LOW_BATTERY_SLEEP_INTERVAL) + "min");
-    }
-    else
-    { // low battery
-      esp_sleep_enable_timer_wakeup(LOW_BATTERY_SLEEP_INTERVAL
-                                    * 60ULL * 1000000ULL);
-      Serial.println(TXT_LOW_BATTERY_VOLTAGE);
-      Serial.print(TXT_ENTERING_DEEP_SLEEP_FOR);
-      Serial.println(" " + String(LOW_BATTERY_SLEEP_INTERVAL) + "min");
-    }
-    esp_deep_sleep_start();
-  }
-  // battery is no longer low, reset variable in non-volatile storage
-  if (lowBat == true)
-  {
-    prefs.putBool("lowBat", false);
-  }
-#else
-  uint32_t batteryVoltage = UINT32_MAX;
-#endif
-
-  // All data should have been loaded from NVS. Close filesystem.
-  prefs.end();
-
   String statusStr = {};
   String tmpStr = {};
-  tm timeInfo = {};
 
-  // START WIFI
-  int wifiRSSI = 0; // Received Signal Strength Indicator
-  wl_status_t wifiStatus = startWiFi(wifiRSSI, manual_wakeup);
-  if (wifiStatus != WL_CONNECTED)
+  PROFILE_RESET();
+  METRICS_MARK();
+#ifdef PARSE_PIPELINE
+  // On single page displays, the widgets that only need the One Call response
+  // are drawn on the other core while it is parsed and while the air pollution
+  // and the sensor are read (a retry starts again from a blank frame)
+  ParsePipeline pipeline;
+  ParsePipeline *onecallPipeline = nullptr;
+  tm onecallTime = {};
+  String onecallDate;
+  initDisplay(0);
+  if (display.pages() == 1)
   {
-    // WiFi Connection Failed
-    if ( RerFlg )
-    {
-      // Report Error enabled
-      initDisplay(0);
-
-      if (wifiStatus == WL_NO_SSID_AVAIL)
-      {
-        Serial.println(TXT_NETWORK_NOT_AVAILABLE);
-        do
-        {
-#ifdef WEB_SVR
-          if ( manual_wakeup )
-            // Draw Web (AP) symbol in upper left corner
-            drawWebIcon(2);
-#endif
-          drawError(wifi_x_196x196, TXT_NETWORK_NOT_AVAILABLE);
-        }
-        while (display.nextPage());
-      }
-      else
-      {
-        Serial.println(TXT_WIFI_CONNECTION_FAILED);
-        do
-        {
-#ifdef WEB_SVR
-          if ( manual_wakeup )
-            // Draw Web (AP) symbol in upper left corner
-            drawWebIcon(2);
+    onecallPipeline = &pipeline;
+    pipeline.addStage(0, [] {
+      display.fillScreen(GxEPD_WHITE);
+#ifdef STATIC_LAYER
+      drawStaticLayer();
 #endif
-          drawError(wifi_x_196x196, TXT_WIFI_CONNECTION_FAILED);
-        }
-        while (display.nextPage());
-      }
-    }
-    else
-      SilentErr = 1;
-
-#ifdef WEB_SVR
-    if ( manual_wakeup )
-    { // Waked-up by Web button ; start Web server using local Wifi AP
-      pinMode(GPIO_NUM_27, INPUT_PULLUP);
-
-      // Start Web serveur and exit setup
-      web_svr_setup();
-      return;
-    }
-    else
+    });
+    pipeline.addStage(ONECALL_CURRENT, [&] {
+      time_t ts = owm_onecall.current.dt + owm_onecall.timezone_offset;
+      localtime_r(&ts, &onecallTime);
+      getDateStr(onecallDate, &onecallTime);
+      drawLocationDate(CITY_STRING, onecallDate);
+    });
+    pipeline.addStage(ONECALL_CURRENT | ONECALL_DAILY, [&] {
+      drawForecast(owm_onecall.daily, onecallTime);
+    });
+    pipeline.addStage(ONECALL_CURRENT | ONECALL_HOURLY | ONECALL_DAILY, [] {
+      drawOutlookGraph(owm_onecall.hourly, owm_onecall.daily,
+                       owm_onecall.timezone_offset);
+    });
+#if DISPLAY_ALERTS
+    pipeline.addStage(ONECALL_CURRENT | ONECALL_ALERTS, [&] {
+      drawAlerts(owm_onecall.alerts, CITY_STRING, onecallDate);
+    });
 #endif
-    { // Not waked-up by Web button
-      killWiFi();
-      powerOffDisplay();
-      beginDeepSleep(&timeInfo);
-    }
   }
-
-  /* AUTO_TZ no need for time synchronisation */
+#endif
 
   // MAKE API REQUESTS
   HttpError = 0;
@@ -408,16 +317,26 @@ void setup()
   WiFiClientSecure client;
   client.setCACert(cert_Sectigo_Public_Server_Authentication_Root_R46);
 #endif
+#ifdef PARSE_PIPELINE
+  int rxStatus = getOWMonecall(client, owm_onecall, onecallPipeline);
+#else
   int rxStatus = getOWMonecall(client, owm_onecall);
+#endif
   if (rxStatus != HTTP_CODE_OK)
   {
     // Attempt a second time before given up (transient error)
     delay(10000);
+    METRICS_RETRY(METRICS_ONECALL);
+#ifdef PARSE_PIPELINE
+    rxStatus = getOWMonecall(client, owm_onecall, onecallPipeline);
+#else
     rxStatus = getOWMonecall(client, owm_onecall);
+#endif
   }
   if (rxStatus != HTTP_CODE_OK)
   {
-    killWiFi();
+    if ( !keepWiFi )
+      killWiFi();
     if ( RerFlg )
     {
       statusStr = "One Call " + OWM_ONECALL_VERSION + " API";
@@ -432,18 +351,23 @@ void setup()
     }
 
     HttpError = 1;
-    beginDeepSleep(&timeInfo);
+    return false;
   }
   rxStatus = getOWMairpollution(client, owm_air_pollution, owm_onecall.current.dt); /* AUTO_TZ */
   if (rxStatus != HTTP_CODE_OK)
   {
     // Attempt a second time before given up (transient error)
     delay(10000);
+    METRICS_RETRY(METRICS_AIR_POLLUTION);
     rxStatus = getOWMairpollution(client, owm_air_pollution, owm_onecall.current.dt); /* AUTO_TZ */
   }
   if (rxStatus != HTTP_CODE_OK)
   {
-    killWiFi();
+#ifdef PARSE_PIPELINE
+    pipeline.end(false);
+#endif
+    if ( !keepWiFi )
+      killWiFi();
     if ( RerFlg )
     {
       statusStr = "Air Pollution API";
@@ -458,8 +382,9 @@ void setup()
     }
 
     HttpError = 1;
-    beginDeepSleep(&timeInfo);
+    return false;
   }
+  METRICS_PHASE_END(METRICS_FETCH);
 #ifdef WEB_SVR
   if ( !manual_wakeup )
     killWiFi(); // WiFi no longer needed
@@ -478,7 +403,7 @@ void setup()
   I2C_bme.begin(PIN_BME_SDA, PIN_BME_SCL, 100000); // 100kHz
 
 #if defined(SENSOR_BME280)
-  Serial.println(String(TXT_READING_FROM) + " BME280... ");
+  LOG_I("%s BME280...", TXT_READING_FROM);
   Adafruit_BME280 bme;
 
   if(bme.begin(BME_ADDRESS, &I2C_bme))
@@ -496,7 +421,7 @@ void setup()
 #endif // SENSOR_BME280
 
 #if defined(SENSOR_BME680)
-  Serial.print(String(TXT_READING_FROM) + " BME680... ");
+  LOG_I("%s BME680...", TXT_READING_FROM);
   Adafruit_BME680 bme(&I2C_bme);
 
   if(bme.begin(BME_ADDRESS))
@@ -512,44 +437,33 @@ void setup()
     if (std::isnan(inTemp) || std::isnan(inHumidity))
     {
       statusStr = "BME " + String(TXT_READ_FAILED);
-      Serial.println(statusStr);
+      LOG_W("%s", statusStr.c_str());
     }
     else
     {
 //#define seaLevelPressure (1013.25) // sea level pressure at your location
 #define seaLevelPressure (1021) // sea level pressure at your location
 
-      Serial.print("Temperature = ");
-      Serial.print(inTemp);
       if ( TEMP_OFF )
       {
+        LOG_I("Temperature = %.2f -> %.2f °C", inTemp, inTemp + TEMP_OFF);
         inTemp += TEMP_OFF;
-        Serial.print(" -> ");
-        Serial.print(inTemp);
       }
-      Serial.println(" °C");
-    
-      Serial.print("Humidity = ");
-      Serial.print(inHumidity);
-      Serial.println(" %");
-    
-      Serial.print("Pressure = ");
-      Serial.print(bme.readPressure() / 100.0F);
-      Serial.println(" hPa");
- 
-      Serial.print("Altitude = ");
-      Serial.print(bme.readAltitude(seaLevelPressure));
-      Serial.println(" m");
-
-      Serial.println(TXT_SUCCESS);
+      else
+        LOG_I("Temperature = %.2f °C", inTemp);
+      LOG_I("Humidity = %.2f %%", inHumidity);
+      LOG_I("Pressure = %.2f hPa", bme.readPressure() / 100.0F);
+      LOG_I("Altitude = %.2f m", bme.readAltitude(seaLevelPressure));
+      LOG_I("%s", TXT_SUCCESS);
     }
   }
   else
   {
     statusStr = "BME " + String(TXT_NOT_FOUND); // check wiring
-    Serial.println(statusStr);
+    LOG_W("%s", statusStr.c_str());
   }
   digitalWrite(PIN_BME_PWR, LOW);
+  METRICS_PHASE_END(METRICS_SENSOR);
 
   String refreshTimeStr;
 
@@ -565,19 +479,57 @@ void setup()
   getDateStr(dateStr, &timeInfo);
 
   // RENDER FULL REFRESH
+#if LOG_LEVEL >= LOG_LEVEL_DEBUG
+  unsigned long renderStart = millis();
+  unsigned long drawTime = 0;
+#endif
+#ifdef PARSE_PIPELINE
+  // the frame already holds the widgets drawn by the pipeline
+  pipeline.end(true);
+  if (onecallPipeline == nullptr)
+#endif
   initDisplay(0); // WEB_SVR
+#ifdef FAST_REFRESH
+  refresh_mode_t refreshMode = REFRESH_CLEAN;
+#ifdef WEB_PREVIEW
+  // a preview does not change the panel nor the refresh policy
+  if (!display.previewing())
+#endif
+  {
+    refreshMode = selectRefreshMode(owm_onecall, &timeInfo, inTemp);
+    if (!setFastRefresh(refreshMode == REFRESH_FAST))
+    {
+      refreshMode = REFRESH_CLEAN;
+    }
+  }
+#endif
   do
   {
+    PROFILE_SCOPE(PROF_PAGE);
+#if LOG_LEVEL >= LOG_LEVEL_DEBUG || defined(STATION_METRICS)
+    unsigned long pageStart = millis();
+#endif
+#ifdef STATIC_LAYER
+#ifdef PARSE_PIPELINE
+    if (onecallPipeline == nullptr)
+#endif
+    drawStaticLayer();
+#endif
     drawCurrentConditions(owm_onecall.current, owm_onecall.daily[0],
                           owm_air_pollution, inTemp, inHumidity,
 			  owm_onecall.timezone_offset);  // AUTO_TZ
-    drawForecast(owm_onecall.daily, timeInfo);
-    drawLocationDate(CITY_STRING, dateStr);
-    drawOutlookGraph(owm_onecall.hourly, owm_onecall.daily,
-		     owm_onecall.timezone_offset); // AUTO_TZ
+#ifdef PARSE_PIPELINE
+    if (onecallPipeline == nullptr)
+#endif
+    {
+      drawForecast(owm_onecall.daily, timeInfo);
+      drawLocationDate(CITY_STRING, dateStr);
+      drawOutlookGraph(owm_onecall.hourly, owm_onecall.daily,
+		       owm_onecall.timezone_offset); // AUTO_TZ
 #if DISPLAY_ALERTS
-    drawAlerts(owm_onecall.alerts, CITY_STRING, dateStr);
+      drawAlerts(owm_onecall.alerts, CITY_STRING, dateStr);
 #endif
+    }
     drawStatusBar(statusStr, refreshTimeStr, wifiRSSI, batteryVoltage);
 
 #ifdef WEB_SVR
@@ -585,8 +537,300 @@ void setup()
       // Draw Web (Internet) symbol in upper left corner
       drawWebIcon(1);
 #endif
+#if LOG_LEVEL >= LOG_LEVEL_DEBUG
+    drawTime += millis() - pageStart;
+#endif
+    METRICS_PAGE(millis() - pageStart);
   }
   while (display.nextPage());
+  METRICS_PHASE_END(METRICS_RENDER);
+#if LOG_LEVEL >= LOG_LEVEL_DEBUG
+  logRenderStats(drawTime, millis() - renderStart);
+#endif
+  PROFILE_PRINT();
+#ifdef FAST_REFRESH
+#ifdef WEB_PREVIEW
+  // a preview does not change the panel
+  if (!display.previewing())
+#endif
+  refreshCompleted(refreshMode);
+#endif
+
+  return true;
+} // end refreshWeather
+
+#if defined(WEB_APPLY_IN_PLACE) || defined(WEB_PREVIEW)
+/*
+ * refreshFromWeb
+ *
+ * refreshWeather() from the Web loop, with the current parameters and the
+ * WiFi connection in use
+ */
+static bool refreshFromWeb(tm &timeInfo)
+{
+  // The refresh reads the saved parameters
+  config_flush();
+
+#if BATTERY_MONITORING
+  uint32_t batteryVoltage = readBatteryVoltage();
+#else
+  uint32_t batteryVoltage = UINT32_MAX;
+#endif
+  // The Web handlers do not change the parameters during the refresh
+  config_hold(1);
+  bool ok = refreshWeather(WiFi.RSSI(), batteryVoltage, 1, true, timeInfo);
+  config_hold(0);
+  return ok;
+} // end refreshFromWeb
+#endif
+
+#ifdef WEB_APPLY_IN_PLACE
+/*
+ * refreshInPlace
+ *
+ * Refresh the display with the current parameters from the Web loop, using
+ * the WiFi connection in use, instead of a deep sleep and a new boot.
+ * The Web server stays active whatever the result.
+ */
+static void refreshInPlace()
+{
+  tm timeInfo = {};
+  unsigned long start = millis();
+
+  if (refreshFromWeb(timeInfo))
+  {
+    // The display shows the weather and the Web icon
+    SilentErr = 0;
+  }
+  LOG_I("Refreshed in place in %.3fs", (millis() - start) / 1000.0);
+
+  refreshTime = millis();
+  restart_wdg(0);
+} // end refreshInPlace
+#endif // WEB_APPLY_IN_PLACE
+
+#ifdef WEB_PREVIEW
+/*
+ * previewLoop
+ *
+ * Draws the frame requested for a preview by the Web server (without
+ * refreshing the panel), then drops it once sent (see preview_state_t)
+ */
+static void previewLoop()
+{
+  int state = preview_state;
+
+  if (state == PREVIEW_RENDER)
+  {
+    tm timeInfo = {};
+    unsigned long start = millis();
+
+    display.beginPreview();
+    refreshFromWeb(timeInfo);
+    LOG_I("Preview drawn in %.3fs", (millis() - start) / 1000.0);
+  }
+  if (state == PREVIEW_CURRENT || state == PREVIEW_RENDER)
+  {
+    // unless the client already left
+    preview_state.compare_exchange_strong(state, PREVIEW_READY);
+  }
+  else if (state == PREVIEW_DONE)
+  {
+    display.endPreview();
+    preview_state = PREVIEW_IDLE;
+  }
+} // end previewLoop
+#endif // WEB_PREVIEW
+
+/*
+ * setup
+ *
+ * Program initialization
+ */
+void setup()
+{
+  int manual_wakeup = 0;
+
+  actionTime = startTime = refreshTime = millis();
+  logBegin(115200);
+  METRICS_BEGIN_CYCLE();
+
+#ifdef WEB_SVR
+  // Fetch Weather and Wifi data from non volatile memory
+  retrieve_config();
+
+  // Check if button pressed
+#ifdef BUTTON_PIN
+  manual_wakeup = (print_wakeup_reason() == ESP_SLEEP_WAKEUP_EXT0);
+#else
+  manual_wakeup = (print_wakeup_reason() == ESP_SLEEP_WAKEUP_TOUCHPAD);
+#endif
+  if ( manual_wakeup )
+    LOG_I("Awaked, please press button again to go back to sleep");
+#endif // WEB_SVR
+
+#if DEBUG_LEVEL >= 1
+  printHeapUsage();
+#endif
+
+  disableBuiltinLED();
+
+#ifdef USE_ASSET_PARTITION
+  // Without the archive text and icons are blank, but the device keeps running
+  // so the web server and OTA remain available to fix it.
+  if (assetsBegin())
+  {
+    LOG_I("Assets version %u", (unsigned) getAssetsVersion());
+  }
+#endif
+#ifdef USE_GLYPH_PAGES
+  // without glyph pages text is drawn with the 8-bit fonts only
+  glyphPagesBegin();
+#endif
+
+  // Open namespace for read/write to non-volatile storage
+  prefs.begin(NVS_NAMESPACE, false);
+
+#if BATTERY_MONITORING
+  uint32_t batteryVoltage = readBatteryVoltage();
+  LOG_I("%s: %umv", TXT_BATTERY_VOLTAGE, (unsigned) batteryVoltage);
+  METRICS_BATTERY(batteryVoltage);
+
+  // When the battery is low, the display should be updated to reflect that, but
+  // only the first time we detect low voltage. The next time the display will
+  // refresh is when voltage is no longer low. To keep track of that we will
+  // make use of non-volatile storage.
+  bool lowBat = prefs.getBool("lowBat", false);
+
+  // low battery, deep sleep now
+  if (batteryVoltage <= LOW_BATTERY_VOLTAGE)
+  {
+    if (lowBat == false)
+    { // battery is now low for the first time
+      prefs.putBool("lowBat", true);
+      prefs.end();
+      initDisplay(0);
+      do
+      {
+        drawError(battery_alert_0deg_196x196, TXT_LOW_BATTERY);
+      } while (display.nextPage());
+      powerOffDisplay();
+    }
+
+    if (batteryVoltage <= CRIT_LOW_BATTERY_VOLTAGE)
+    { // critically low battery
+      // don't set esp_sleep_enable_timer_wakeup();
+      // We won't wake up again until someone manually presses the RST button.
+      LOG_W("%s", TXT_CRIT_LOW_BATTERY_VOLTAGE);
+      LOG_W("%s", TXT_HIBERNATING_INDEFINITELY_NOTICE);
+    }
+    else if (batteryVoltage <= VERY_LOW_BATTERY_VOLTAGE)
+    { // very low battery
+      esp_sleep_enable_timer_wakeup(VERY_LOW_BATTERY_SLEEP_INTERVAL
+                                    * 60ULL * 1000000ULL);
+      LOG_W("%s", TXT_VERY_LOW_BATTERY_VOLTAGE);
+      LOG_I("%s %lumin", TXT_ENTERING_DEEP_SLEEP_FOR,
+            VERY_LOW_BATTERY_SLEEP_INTERVAL);
+    }
+    else
+    { // low battery
+      esp_sleep_enable_timer_wakeup(LOW_BATTERY_SLEEP_INTERVAL
+                                    * 60ULL * 1000000ULL);
+      LOG_W("%s", TXT_LOW_BATTERY_VOLTAGE);
+      LOG_I("%s %lumin", TXT_ENTERING_DEEP_SLEEP_FOR,
+            LOW_BATTERY_SLEEP_INTERVAL);
+    }
+    logFlush(LOG_FLUSH_MS);
+    esp_deep_sleep_start();
+  }
+  // battery is no longer low, reset variable in non-volatile storage
+  if (lowBat == true)
+  {
+    prefs.putBool("lowBat", false);
+  }
+#else
+  uint32_t batteryVoltage = UINT32_MAX;
+#endif
+
+  // All data should have been loaded from NVS. Close filesystem.
+  prefs.end();
+
+  tm timeInfo = {};
+
+  // START WIFI
+  int wifiRSSI = 0; // Received Signal Strength Indicator
+  METRICS_PHASE_END(METRICS_BOOT);
+  wl_status_t wifiStatus = startWiFi(wifiRSSI, manual_wakeup);
+  METRICS_PHASE_END(METRICS_WIFI);
+  if (wifiStatus == WL_CONNECTED)
+  {
+    METRICS_WIFI(wifiRSSI);
+  }
+  if (wifiStatus != WL_CONNECTED)
+  {
+    // WiFi Connection Failed
+    if ( RerFlg )
+    {
+      // Report Error enabled
+      initDisplay(0);
+
+      if (wifiStatus == WL_NO_SSID_AVAIL)
+      {
+        LOG_E("%s", TXT_NETWORK_NOT_AVAILABLE);
+        do
+        {
+#ifdef WEB_SVR
+          if ( manual_wakeup )
+            // Draw Web (AP) symbol in upper left corner
+            drawWebIcon(2);
+#endif
+          drawError(wifi_x_196x196, TXT_NETWORK_NOT_AVAILABLE);
+        }
+        while (display.nextPage());
+      }
+      else
+      {
+        LOG_E("%s", TXT_WIFI_CONNECTION_FAILED);
+        do
+        {
+#ifdef WEB_SVR
+          if ( manual_wakeup )
+            // Draw Web (AP) symbol in upper left corner
+            drawWebIcon(2);
+#endif
+          drawError(wifi_x_196x196, TXT_WIFI_CONNECTION_FAILED);
+        }
+        while (display.nextPage());
+      }
+    }
+    else
+      SilentErr = 1;
+
+#ifdef WEB_SVR
+    if ( manual_wakeup )
+    { // Waked-up by Web button ; start Web server using local Wifi AP
+      pinMode(GPIO_NUM_27, INPUT_PULLUP);
+
+      // Start Web serveur and exit setup
+      web_svr_setup();
+      return;
+    }
+    else
+#endif
+    { // Not waked-up by Web button
+      killWiFi();
+      powerOffDisplay();
+      beginDeepSleep(&timeInfo);
+    }
+  }
+
+  /* AUTO_TZ no need for time synchronisation */
+
+  if (!refreshWeather(wifiRSSI, batteryVoltage, manual_wakeup, false,
+                      timeInfo))
+  {
+    beginDeepSleep(&timeInfo);
+  }
 
 #ifdef WEB_SVR
   if ( manual_wakeup )
@@ -626,6 +870,8 @@ void loop()
 
   // Perform net related tasks during loop
   net_loop();
+  // Log lines the serial port could not take yet
+  logDrain();
 
 #ifdef BUTTON_PIN
   // Avoid checking button too early after manual wakeup
@@ -635,12 +881,12 @@ void loop()
 
     if (lastState && !currentState)
     {
-      Serial.println("The button is pressed");
+      LOG_I("The button is pressed");
     }
     else if (!lastState && currentState)
     {
       // Once button is pressed, go back to sleep
-      Serial.println("The button is released");
+      LOG_I("The button is released");
 
       if ( !SilentErr )
         drawWebIcon(0);
@@ -658,7 +904,7 @@ void loop()
     if ( touchRead(TOUCH_PIN) <= TOUCH_THR )
     {
       // Once touchpin hit, go back to sleep
-      Serial.println("The touchpin is hit");
+      LOG_I("The touchpin is hit");
 
       if ( !SilentErr )
         drawWebIcon(0);
@@ -675,10 +921,27 @@ void loop()
      do_deep_sleep(restart_delay);
   }
 
+#ifdef WEB_PREVIEW
+  previewLoop();
+#endif
+
+#ifdef WEB_APPLY_IN_PLACE
+  if ( refresh_pending && (long)(millis() - refresh_at) >= 0
+#ifdef WEB_PREVIEW
+       // not while a preview is sent
+       && preview_state == PREVIEW_IDLE
+#endif
+     )
+  {
+    refresh_pending = 0;
+    refreshInPlace();
+  }
+#endif
+
   if ( (millis() - actionTime) >= (MaxActTim*1000) )  // Rollover handled by C substract
   {
     // Deep sleep also on timeout
-    Serial.println("Watch dog timer elapsed");
+    LOG_I("Watch dog timer elapsed");
 
     if ( !SilentErr )
       drawWebIcon(0);
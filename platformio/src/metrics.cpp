@@ -0,0 +1,398 @@
+/* Station metrics for esp32-weather-epd.
+ * Copyright (C) 2022-2026  Luke Marzen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "config.h"
+#ifdef STATION_METRICS
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#include <esp_attr.h>
+#include <esp_heap_caps.h>
+#include <WiFi.h>
+#else
+#include <chrono>
+#define RTC_DATA_ATTR
+static uint32_t millis()
+{
+  static const auto start = std::chrono::steady_clock::now();
+  return std::chrono::duration_cast<std::chrono::milliseconds>(
+    std::chrono::steady_clock::now() - start).count();
+}
+#endif
+
+#include "metrics.h"
+
+// Upper bounds of the histogram buckets (ms), +Inf is added
+static const uint32_t metrics_bounds[] = {
+  10, 50, 100, 250, 500, 1000, 2500, 5000, 10000, 30000
+};
+#define METRICS_BUCKETS (sizeof(metrics_bounds) / sizeof(metrics_bounds[0]))
+
+typedef struct metrics_hist
+{
+  uint32_t bucket[METRICS_BUCKETS + 1]; // per bucket, not cumulative
+  uint32_t count;
+  uint64_t sum_ms;
+} metrics_hist_t;
+
+typedef struct metrics_rtc
+{
+  uint32_t       cycles;
+  metrics_hist_t phase[METRICS_PHASE_COUNT];
+  metrics_hist_t latency[METRICS_ENDPOINT_COUNT];
+  metrics_hist_t parse[METRICS_ENDPOINT_COUNT];
+  metrics_hist_t page;
+  uint32_t       requests[METRICS_ENDPOINT_COUNT];
+  uint32_t       errors[METRICS_ENDPOINT_COUNT];
+  uint32_t       retries[METRICS_ENDPOINT_COUNT];
+  uint64_t       bytes[METRICS_ENDPOINT_COUNT];
+  uint32_t       heap_min;    // lowest free heap of the past cycles, 0 if none
+  int32_t        rssi;
+  uint32_t       battery_mv;
+} metrics_rtc_t;
+
+RTC_DATA_ATTR static metrics_rtc_t metrics;
+
+// end of the previous phase (ms since reset)
+static uint32_t phase_mark = 0;
+
+static const char *const phase_names[METRICS_PHASE_COUNT] = {
+  "boot", "wifi", "fetch", "sensor", "render", "awake",
+};
+static const char *const endpoint_names[METRICS_ENDPOINT_COUNT] = {
+  "onecall", "air_pollution",
+};
+
+static void histAdd(metrics_hist_t &h, uint32_t ms)
+{
+  size_t i = 0;
+  while (i < METRICS_BUCKETS && ms > metrics_bounds[i])
+  {
+    ++i;
+  }
+  ++h.bucket[i];
+  ++h.count;
+  h.sum_ms += ms;
+  return;
+} // end histAdd
+
+void metricsBeginCycle()
+{
+  ++metrics.cycles;
+  return;
+} // end metricsBeginCycle
+
+void metricsPhase(metrics_phase_t phase, uint32_t ms)
+{
+  histAdd(metrics.phase[phase], ms);
+  return;
+} // end metricsPhase
+
+void metricsMark()
+{
+  phase_mark = millis();
+  return;
+} // end metricsMark
+
+void metricsPhaseEnd(metrics_phase_t phase)
+{
+  const uint32_t now = millis();
+  histAdd(metrics.phase[phase], now - phase_mark);
+  phase_mark = now;
+  return;
+} // end metricsPhaseEnd
+
+void metricsHttp(metrics_endpoint_t endpoint, int status, uint32_t latency_ms,
+                 uint32_t parse_ms, int32_t bytes)
+{
+  ++metrics.requests[endpoint];
+  histAdd(metrics.latency[endpoint], latency_ms);
+  if (status != 200)
+  {
+    ++metrics.errors[endpoint];
+  }
+  if (parse_ms > 0)
+  {
+    histAdd(metrics.parse[endpoint], parse_ms);
+  }
+  if (bytes > 0)
+  {
+    metrics.bytes[endpoint] += bytes;
+  }
+  return;
+} // end metricsHttp
+
+void metricsRetry(metrics_endpoint_t endpoint)
+{
+  ++metrics.retries[endpoint];
+  return;
+} // end metricsRetry
+
+void metricsPage(uint32_t ms)
+{
+  histAdd(metrics.page, ms);
+  return;
+} // end metricsPage
+
+void metricsWiFi(int rssi)
+{
+  metrics.rssi = rssi;
+  return;
+} // end metricsWiFi
+
+void metricsBattery(uint32_t mv)
+{
+  metrics.battery_mv = mv;
+  return;
+} // end metricsBattery
+
+/*
+ * heapMinFree
+ *
+ * Lowest free heap of the past cycles and of this one
+ */
+static uint32_t heapMinFree()
+{
+#ifdef ARDUINO
+  uint32_t min = ESP.getMinFreeHeap();
+#else
+  uint32_t min = 0;
+#endif
+  return metrics.heap_min ? std::min(metrics.heap_min, min) : min;
+} // end heapMinFree
+
+/*
+ * metricsHeap
+ *
+ * Keeps the lowest free heap of the cycle, called before deep sleep
+ */
+void metricsHeap()
+{
+  metrics.heap_min = heapMinFree();
+  return;
+} // end metricsHeap
+
+/*
+ * A metric family: scalar series are read with value(), histograms with
+ * hist(), series is the index in labels (no label when labels is nullptr).
+ */
+typedef struct metrics_family
+{
+  const char  *name;
+  const char  *help;
+  const char  *type;
+  const char  *label;
+  const char *const *labels;
+  uint8_t      series;
+  double     (*value)(uint8_t series);
+  const metrics_hist_t *(*hist)(uint8_t series);
+} metrics_family_t;
+
+static const metrics_family_t families[] = {
+  {"weather_cycles_total", "Wake cycles since power on", "counter",
+   nullptr, nullptr, 1,
+   [](uint8_t) -> double { return metrics.cycles; }, nullptr},
+  {"weather_phase_duration_seconds", "Duration of the wake phases",
+   "histogram", "phase", phase_names, METRICS_PHASE_COUNT,
+   nullptr, [](uint8_t s) -> const metrics_hist_t * {
+     return &metrics.phase[s];
+   }},
+  {"weather_http_request_duration_seconds",
+   "Time to the response headers of the OWM requests", "histogram",
+   "endpoint", endpoint_names, METRICS_ENDPOINT_COUNT,
+   nullptr, [](uint8_t s) -> const metrics_hist_t * {
+     return &metrics.latency[s];
+   }},
+  {"weather_parse_duration_seconds",
+   "Time to receive and parse the OWM responses", "histogram",
+   "endpoint", endpoint_names, METRICS_ENDPOINT_COUNT,
+   nullptr, [](uint8_t s) -> const metrics_hist_t * {
+     return &metrics.parse[s];
+   }},
+  {"weather_http_requests_total", "OWM requests", "counter",
+   "endpoint", endpoint_names, METRICS_ENDPOINT_COUNT,
+   [](uint8_t s) -> double { return metrics.requests[s]; }, nullptr},
+  {"weather_http_errors_total", "OWM requests that failed", "counter",
+   "endpoint", endpoint_names, METRICS_ENDPOINT_COUNT,
+   [](uint8_t s) -> double { return metrics.errors[s]; }, nullptr},
+  {"weather_http_retries_total", "OWM requests made again after an error",
+   "counter", "endpoint", endpoint_names, METRICS_ENDPOINT_COUNT,
+   [](uint8_t s) -> double { return metrics.retries[s]; }, nullptr},
+  {"weather_http_response_bytes_total",
+   "Content-Length of the OWM responses", "counter",
+   "endpoint", endpoint_names, METRICS_ENDPOINT_COUNT,
+   [](uint8_t s) -> double { return metrics.bytes[s]; }, nullptr},
+  {"weather_render_page_duration_seconds",
+   "Time to draw each page of the weather screen", "histogram",
+   nullptr, nullptr, 1,
+   nullptr, [](uint8_t) -> const metrics_hist_t * {
+     return &metrics.page;
+   }},
+  {"weather_heap_free_bytes", "Free heap", "gauge", nullptr, nullptr, 1,
+   [](uint8_t) -> double {
+#ifdef ARDUINO
+     return ESP.getFreeHeap();
+#else
+     return 0;
+#endif
+   }, nullptr},
+  {"weather_heap_min_free_bytes", "Lowest free heap since power on",
+   "gauge", nullptr, nullptr, 1,
+   [](uint8_t) -> double { return heapMinFree(); }, nullptr},
+  {"weather_heap_largest_free_block_bytes", "Largest free heap block",
+   "gauge", nullptr, nullptr, 1,
+   [](uint8_t) -> double {
+#ifdef ARDUINO
+     return heap_caps_get_largest_free_block(MALLOC_CAP_8BIT);
+#else
+     return 0;
+#endif
+   }, nullptr},
+  {"weather_wifi_rssi_dbm", "WiFi signal strength", "gauge",
+   nullptr, nullptr, 1,
+   [](uint8_t) -> double {
+#ifdef ARDUINO
+     if (WiFi.status() == WL_CONNECTED)
+     {
+       return WiFi.RSSI();
+     }
+#endif
+     return metrics.rssi;
+   }, nullptr},
+  {"weather_battery_volts", "Battery voltage at the last wake", "gauge",
+   nullptr, nullptr, 1,
+   [](uint8_t) -> double { return metrics.battery_mv / 1000.0; }, nullptr},
+};
+#define METRICS_FAMILIES (sizeof(families) / sizeof(families[0]))
+
+MetricsStream::MetricsStream()
+  : _family(0), _series(0), _line(0), _len(0), _sent(0)
+{
+}
+
+/*
+ * nextLine
+ *
+ * Formats the next line into _text: HELP and TYPE before the first series
+ * of a family, then one line per scalar series, or the cumulative buckets,
+ * sum and count of a histogram. Returns false at the end.
+ */
+bool MetricsStream::nextLine()
+{
+  while (_family < METRICS_FAMILIES)
+  {
+    const metrics_family_t &f = families[_family];
+    const int line = _line++ - (_series == 0 ? 2 : 0);
+    // label="value", or nothing
+    char label[40] = "";
+    if (f.labels != nullptr)
+    {
+      snprintf(label, sizeof(label), "%s=\"%s\"", f.label,
+               f.labels[_series]);
+    }
+    const char *open = (f.labels != nullptr) ? "{" : "";
+    const char *close = (f.labels != nullptr) ? "}" : "";
+    int n = 0;
+
+    if (line == -2)
+    {
+      n = snprintf(_text, sizeof(_text), "# HELP %s %s\n", f.name, f.help);
+    }
+    else if (line == -1)
+    {
+      n = snprintf(_text, sizeof(_text), "# TYPE %s %s\n", f.name, f.type);
+    }
+    else if (f.hist == nullptr && line == 0)
+    {
+      n = snprintf(_text, sizeof(_text), "%s%s%s%s %.15g\n", f.name,
+                   open, label, close, f.value(_series));
+    }
+    else if (f.hist != nullptr && line <= static_cast<int>(METRICS_BUCKETS) + 2)
+    {
+      const metrics_hist_t *h = f.hist(_series);
+      const char *sep = (f.labels != nullptr) ? "," : "";
+      if (line <= static_cast<int>(METRICS_BUCKETS))
+      {
+        uint32_t cumulative = 0;
+        for (int i = 0; i <= line; ++i)
+        {
+          cumulative += h->bucket[i];
+        }
+        char le[16];
+        if (line < static_cast<int>(METRICS_BUCKETS))
+        {
+          snprintf(le, sizeof(le), "%g", metrics_bounds[line] / 1000.0);
+        }
+        else
+        {
+          strcpy(le, "+Inf");
+        }
+        n = snprintf(_text, sizeof(_text), "%s_bucket{%s%sle=\"%s\"} %u\n",
+                     f.name, label, sep, le,
+                     static_cast<unsigned>(cumulative));
+      }
+      else if (line == static_cast<int>(METRICS_BUCKETS) + 1)
+      {
+        n = snprintf(_text, sizeof(_text), "%s_sum%s%s%s %.3f\n", f.name,
+                     open, label, close, h->sum_ms / 1000.0);
+      }
+      else
+      {
+        n = snprintf(_text, sizeof(_text), "%s_count%s%s%s %u\n", f.name,
+                     open, label, close, static_cast<unsigned>(h->count));
+      }
+    }
+
+    if (n > 0)
+    {
+      _len = std::min(static_cast<size_t>(n), sizeof(_text) - 1);
+      _sent = 0;
+      return true;
+    }
+    // end of the series
+    _line = 0;
+    if (++_series >= f.series)
+    {
+      _series = 0;
+      ++_family;
+    }
+  }
+  return false;
+} // end nextLine
+
+size_t MetricsStream::read(uint8_t *buf, size_t len)
+{
+  size_t out = 0;
+  while (out < len)
+  {
+    if (_sent == _len && !nextLine())
+    {
+      break;
+    }
+    const size_t n = std::min(_len - _sent, len - out);
+    memcpy(buf + out, _text + _sent, n);
+    out += n;
+    _sent += n;
+  }
+  return out;
+} // end read
+
+#endif // STATION_METRICS
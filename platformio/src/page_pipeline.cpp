@@ -0,0 +1,413 @@
+/* Double-buffered page rendering for esp32-weather-epd.
+ * Copyright (C) 2022-2026  Luke Marzen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "config.h"
+#ifdef DISPLAY_PAGE_PIPELINE
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#else
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#endif
+
+#include "page_pipeline.h"
+#include "rle_frame.h" // panel color codes
+
+/*
+ * PageTransfer worker
+ */
+#ifdef ARDUINO
+struct PageTransfer::impl
+{
+  TaskHandle_t      task;
+  SemaphoreHandle_t start; // given by start(), taken by the worker
+  SemaphoreHandle_t done;  // given by the worker when the job is complete
+  job_t job;
+  void *ctx;
+
+  static void run(void *arg)
+  {
+    impl *self = static_cast<impl *>(arg);
+    for (;;)
+    {
+      xSemaphoreTake(self->start, portMAX_DELAY);
+      self->job(self->ctx);
+      xSemaphoreGive(self->done);
+    }
+  }
+};
+
+PageTransfer::PageTransfer() : _impl(new impl)
+{
+  // the display is a global, the task is created by the first start() since
+  // the scheduler is not running yet
+  _impl->task  = nullptr;
+  _impl->start = xSemaphoreCreateBinary();
+  _impl->done  = xSemaphoreCreateBinary();
+  xSemaphoreGive(_impl->done); // idle
+}
+
+PageTransfer::~PageTransfer()
+{
+  wait();
+  if (_impl->task != nullptr)
+  {
+    vTaskDelete(_impl->task);
+  }
+  vSemaphoreDelete(_impl->start);
+  vSemaphoreDelete(_impl->done);
+  delete _impl;
+}
+
+void PageTransfer::start(job_t job, void *ctx)
+{
+  if (_impl->task == nullptr)
+  {
+    xTaskCreatePinnedToCore(impl::run, "page_xfer", 4096, _impl,
+                            configMAX_PRIORITIES - 2, &_impl->task,
+                            PAGE_PIPELINE_CORE);
+  }
+  xSemaphoreTake(_impl->done, portMAX_DELAY);
+  _impl->job = job;
+  _impl->ctx = ctx;
+  xSemaphoreGive(_impl->start);
+  return;
+} // end start
+
+void PageTransfer::wait()
+{
+  xSemaphoreTake(_impl->done, portMAX_DELAY);
+  xSemaphoreGive(_impl->done);
+  return;
+} // end wait
+#else
+struct PageTransfer::impl
+{
+  std::mutex m;
+  std::condition_variable cv;
+  bool busy = false;
+  bool quit = false;
+  job_t job = nullptr;
+  void *ctx = nullptr;
+  std::thread worker;
+
+  void run()
+  {
+    std::unique_lock<std::mutex> lock(m);
+    for (;;)
+    {
+      cv.wait(lock, [this] { return (busy && job != nullptr) || quit; });
+      if (quit)
+      {
+        return;
+      }
+      job_t j = job;
+      job = nullptr;
+      lock.unlock();
+      j(ctx);
+      lock.lock();
+      busy = false;
+      cv.notify_all();
+    }
+  }
+};
+
+PageTransfer::PageTransfer() : _impl(new impl)
+{
+  _impl->worker = std::thread(&impl::run, _impl);
+}
+
+PageTransfer::~PageTransfer()
+{
+  wait();
+  {
+    std::lock_guard<std::mutex> lock(_impl->m);
+    _impl->quit = true;
+  }
+  _impl->cv.notify_all();
+  _impl->worker.join();
+  delete _impl;
+}
+
+void PageTransfer::start(job_t job, void *ctx)
+{
+  std::unique_lock<std::mutex> lock(_impl->m);
+  _impl->cv.wait(lock, [this] { return !_impl->busy; });
+  _impl->busy = true;
+  _impl->job = job;
+  _impl->ctx = ctx;
+  _impl->cv.notify_all();
+  return;
+} // end start
+
+void PageTransfer::wait()
+{
+  std::unique_lock<std::mutex> lock(_impl->m);
+  _impl->cv.wait(lock, [this] { return !_impl->busy; });
+  return;
+} // end wait
+#endif
+
+/*
+ * PagedFrame
+ */
+size_t PagedFrame::bufferSize(int16_t w, int16_t page_height)
+{
+#if defined(DISP_7C_F)
+  return static_cast<size_t>(w) * page_height / 2;
+#elif defined(DISP_3C_B)
+  return static_cast<size_t>(w) * page_height / 8 * 2;
+#else
+  return static_cast<size_t>(w) * page_height / 8;
+#endif
+} // end bufferSize
+
+PagedFrame::PagedFrame(int16_t w, int16_t h, int16_t page_height)
+  : Adafruit_GFX(w, h), _page_height(page_height), _cur(0), _page_y(0),
+    _page_rows(0), _y0(0), _y1(h), _bx(0), _bw(w), _partial(false),
+    _again(false), _wx(0), _wy(0), _ww(w), _wh(h),
+    _job_buf(nullptr), _job_y(0), _job_rows(0), _job_mode(PAGE_WRITE_FULL)
+{
+  _buf[0] = static_cast<uint8_t *>(malloc(bufferSize(w, page_height)));
+  _buf[1] = static_cast<uint8_t *>(malloc(bufferSize(w, page_height)));
+}
+
+PagedFrame::~PagedFrame()
+{
+  _transfer.wait();
+  free(_buf[0]);
+  free(_buf[1]);
+}
+
+uint16_t PagedFrame::pageHeight() const
+{
+  return _page_height;
+} // end pageHeight
+
+uint16_t PagedFrame::pages() const
+{
+  return (_y1 - _y0 + _page_height - 1) / _page_height;
+} // end pages
+
+void PagedFrame::setFullWindow()
+{
+  _partial = false;
+  _y0 = 0;
+  _y1 = HEIGHT;
+  _bx = 0;
+  _bw = WIDTH;
+  return;
+} // end setFullWindow
+
+/*
+ * setPartialWindow
+ *
+ * Pages cover the rows of the window, and its columns widened to whole bytes
+ * as GxEPD2 does.
+ */
+void PagedFrame::setPartialWindow(int16_t x, int16_t y, int16_t w, int16_t h)
+{
+  _partial = true;
+  _wx = std::max<int16_t>(x, 0);
+  _wy = std::max<int16_t>(y, 0);
+  _ww = std::min<int16_t>(x + w, WIDTH) - _wx;
+  _wh = std::min<int16_t>(y + h, HEIGHT) - _wy;
+  _y0 = _wy;
+  _y1 = _wy + _wh;
+  _bx = _wx & ~7;
+  _bw = std::min<int16_t>((_wx + _ww + 7) & ~7, WIDTH) - _bx;
+  return;
+} // end setPartialWindow
+
+void PagedFrame::startPage(int16_t y)
+{
+  _page_y = y;
+  _page_rows = std::min<int16_t>(_page_height, _y1 - y);
+  fillScreen(RLE_GXEPD_WHITE);
+  return;
+} // end startPage
+
+void PagedFrame::firstPage()
+{
+  _cur = 0;
+  _again = false;
+  _transfer.wait(); // buffer 0 may still be sent from a previous frame
+  startPage(_y0);
+  return;
+} // end firstPage
+
+void PagedFrame::transferJob(void *ctx)
+{
+  PagedFrame *self = static_cast<PagedFrame *>(ctx);
+  self->writePage(self->_job_buf, self->_bx, self->_job_y, self->_bw,
+                  self->_job_rows, self->_job_mode);
+  return;
+} // end transferJob
+
+/*
+ * nextPage
+ *
+ * Hands the page to the transfer worker and starts the next one in the other
+ * buffer. The worker must first be done with the previous page, which was
+ * sent from that buffer, so it can be overwritten. After the last page the
+ * panel is refreshed and false is returned, unless the pages must be written
+ * again: they are then drawn a second time.
+ */
+bool PagedFrame::nextPage()
+{
+  _transfer.wait();
+  _job_buf = _buf[_cur];
+  _job_y = _page_y;
+  _job_rows = _page_rows;
+  _job_mode = _again   ? PAGE_WRITE_AGAIN
+            : _partial ? PAGE_WRITE_CURRENT : PAGE_WRITE_FULL;
+  _transfer.start(transferJob, this);
+
+  int16_t next = _page_y + _page_rows;
+  if (next >= _y1)
+  {
+    _transfer.wait();
+    if (_again)
+    {
+      _again = false;
+      return false;
+    }
+    refresh(_partial, _wx, _wy, _ww, _wh);
+    if (!writeAgain())
+    {
+      return false;
+    }
+    _again = true;
+    next = _y0;
+  }
+  _cur ^= 1;
+  startPage(next);
+  return true;
+} // end nextPage
+
+void PagedFrame::fillScreen(uint16_t color)
+{
+  const rle_color_t c = RleFrame::colorCode(color);
+  uint8_t *buf = _buf[_cur];
+  const size_t plane = static_cast<size_t>(_bw) * _page_rows / 8;
+#if defined(DISP_7C_F)
+  memset(buf, (c << 4) | c, plane * 4);
+#elif defined(DISP_3C_B)
+  memset(buf, (c == RLE_BLACK || c == RLE_GREEN || c == RLE_BLUE) ? 0x00 : 0xFF,
+         plane);
+  memset(buf + plane, (c >= RLE_RED) ? 0x00 : 0xFF, plane);
+#else
+  memset(buf, (c == RLE_WHITE) ? 0xFF : 0x00, plane);
+#endif
+  return;
+} // end fillScreen
+
+void PagedFrame::drawPixel(int16_t x, int16_t y, uint16_t color)
+{
+  if (x < 0 || y < 0 || x >= width() || y >= height())
+  {
+    return;
+  }
+  switch (getRotation())
+  {
+  case 1:
+    std::swap(x, y);
+    x = WIDTH - x - 1;
+    break;
+  case 2:
+    x = WIDTH - x - 1;
+    y = HEIGHT - y - 1;
+    break;
+  case 3:
+    std::swap(x, y);
+    y = HEIGHT - y - 1;
+    break;
+  }
+  x -= _bx;
+  y -= _page_y;
+  if (x < 0 || x >= _bw || y < 0 || y >= _page_rows)
+  {
+    return;
+  }
+
+  const rle_color_t c = RleFrame::colorCode(color);
+  uint8_t *buf = _buf[_cur];
+#if defined(DISP_7C_F)
+  uint8_t &b = buf[(static_cast<size_t>(y) * _bw + x) / 2];
+  b = (x & 1) ? (b & 0xF0) | c : (b & 0x0F) | (c << 4);
+#else
+  const size_t i = (static_cast<size_t>(y) * _bw + x) / 8;
+  const uint8_t mask = 0x80 >> (x & 7);
+#if defined(DISP_3C_B)
+  uint8_t *color_plane = buf + static_cast<size_t>(_bw) * _page_rows / 8;
+  if (c >= RLE_RED)
+  {
+    buf[i] |= mask;
+    color_plane[i] &= ~mask;
+    return;
+  }
+  color_plane[i] |= mask;
+#endif
+  if (c == RLE_WHITE)
+  {
+    buf[i] |= mask;
+  }
+  else
+  {
+    buf[i] &= ~mask;
+  }
+#endif
+  return;
+} // end drawPixel
+
+/*
+ * drawInvertedBitmap
+ *
+ * Bitmaps drawn without rotation skip the rows outside the page.
+ */
+void PagedFrame::drawInvertedBitmap(int16_t x, int16_t y,
+                                    const uint8_t bitmap[], int16_t w,
+                                    int16_t h, uint16_t color)
+{
+  const int16_t byteWidth = (w + 7) / 8;
+  int16_t j0 = 0, j1 = h;
+  if (getRotation() == 0)
+  {
+    j0 = std::max<int16_t>(0, _page_y - y);
+    j1 = std::min<int16_t>(h, _page_y + _page_rows - y);
+  }
+  for (int16_t j = j0; j < j1; ++j)
+  {
+    const uint8_t *row = bitmap + j * byteWidth;
+    for (int16_t i = 0; i < w; ++i)
+    {
+      if (!(row[i / 8] & (0x80 >> (i & 7))))
+      {
+        drawPixel(x + i, y + j, color);
+      }
+    }
+  }
+  return;
+} // end drawInvertedBitmap
+
+#endif // DISPLAY_PAGE_PIPELINE
@@ -0,0 +1,207 @@
+/* Parse-to-render pipeline for esp32-weather-epd.
+ * Copyright (C) 2022-2026  Luke Marzen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "config.h"
+#ifdef PARSE_PIPELINE
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#endif
+
+#include "parse_pipeline.h"
+
+/*
+ * pipelineYield
+ *
+ * Lets the other tasks run while waiting on the queue.
+ */
+static void pipelineYield()
+{
+#ifdef ARDUINO
+  vTaskDelay(1);
+#else
+  std::this_thread::yield();
+#endif
+} // end pipelineYield
+
+ParsePipeline::~ParsePipeline()
+{
+  end(false);
+#ifdef ARDUINO
+  if (_done != nullptr)
+  {
+    vSemaphoreDelete(static_cast<SemaphoreHandle_t>(_done));
+  }
+#endif
+}
+
+bool ParsePipeline::addStage(uint32_t inputs, stage_t stage)
+{
+  if (_stage_count == PARSE_PIPELINE_MAX_STAGES)
+  {
+    return false;
+  }
+  _stages[_stage_count++] = {inputs, false, stage};
+  return true;
+} // end addStage
+
+bool ParsePipeline::running() const
+{
+  return _running;
+} // end running
+
+void ParsePipeline::publish(uint32_t sections)
+{
+  if (!_running)
+  {
+    return;
+  }
+  while (!_events.push(sections))
+  {
+    pipelineYield();
+  }
+  return;
+} // end publish
+
+void ParsePipeline::publishTo(void *ctx, uint32_t sections)
+{
+  static_cast<ParsePipeline *>(ctx)->publish(sections);
+  return;
+} // end publishTo
+
+void ParsePipeline::runStages(uint32_t ready)
+{
+  for (size_t i = 0; i < _stage_count; ++i)
+  {
+    stage_s &s = _stages[i];
+    if (!s.done && (s.inputs & ready) == s.inputs)
+    {
+      s.done = true;
+      s.fn();
+    }
+  }
+  return;
+} // end runStages
+
+/*
+ * work
+ *
+ * Worker loop: collects the published sections and runs the stages that
+ * became ready, until end().
+ */
+void ParsePipeline::work(void *arg)
+{
+  ParsePipeline *self = static_cast<ParsePipeline *>(arg);
+  uint32_t ready = 0;
+  self->runStages(ready); // stages without inputs
+  for (;;)
+  {
+    // sections published before end() set _stop are popped below
+    const int stop = self->_stop.load(std::memory_order_acquire);
+    uint32_t sections;
+    bool popped = false;
+    while (self->_events.pop(sections))
+    {
+      ready |= sections;
+      popped = true;
+    }
+    if (stop == PIPELINE_ABORT)
+    {
+      break;
+    }
+    if (popped)
+    {
+      self->runStages(ready);
+    }
+    else if (stop == PIPELINE_FINISH)
+    {
+      break;
+    }
+    else
+    {
+      pipelineYield();
+    }
+  }
+#ifdef ARDUINO
+  xSemaphoreGive(static_cast<SemaphoreHandle_t>(self->_done));
+  vTaskDelete(nullptr);
+#endif
+  return;
+} // end work
+
+void ParsePipeline::begin()
+{
+  end(false);
+  _events.clear();
+  for (size_t i = 0; i < _stage_count; ++i)
+  {
+    _stages[i].done = false;
+  }
+  _stop.store(PIPELINE_RUN, std::memory_order_relaxed);
+  _running = true;
+#ifdef ARDUINO
+  if (_done == nullptr)
+  {
+    _done = xSemaphoreCreateBinary();
+  }
+  if (xTaskCreatePinnedToCore(work, "pipeline", PARSE_PIPELINE_STACK, this,
+                              uxTaskPriorityGet(nullptr), nullptr,
+                              PARSE_PIPELINE_CORE) != pdPASS)
+  {
+    // no memory for the task, the stages run in end()
+    _running = false;
+    _inline = true;
+  }
+#else
+  _worker = std::thread(work, this);
+#endif
+  return;
+} // end begin
+
+void ParsePipeline::end(bool complete)
+{
+  if (_inline)
+  {
+    // the worker could not be started, the stages run here
+    _inline = false;
+    if (complete)
+    {
+      runStages(~0u);
+    }
+    return;
+  }
+  if (!_running)
+  {
+    return;
+  }
+  if (complete)
+  {
+    // whatever was not published is final
+    publish(~0u);
+  }
+  _stop.store(complete ? PIPELINE_FINISH : PIPELINE_ABORT,
+              std::memory_order_release);
+#ifdef ARDUINO
+  xSemaphoreTake(static_cast<SemaphoreHandle_t>(_done), portMAX_DELAY);
+#else
+  _worker.join();
+#endif
+  _running = false;
+  return;
+} // end end
+
+#endif // PARSE_PIPELINE
@@ -0,0 +1,159 @@
+/* Render profiler for esp32-weather-epd.
+ * Copyright (C) 2022-2026  Luke Marzen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "config.h"
+#ifdef RENDER_PROFILER
+
+#include <cstdio>
+#include <cstring>
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#endif
+
+#include "logger.h"
+#include "profiler.h"
+
+typedef struct profile_stat
+{
+  uint32_t calls;
+  uint32_t max_ticks;
+  uint64_t total_ticks;
+} profile_stat_t;
+
+static const char *const profile_names[PROF_SECTION_COUNT] = {
+  "page",
+  "drawCurrentConditions",
+  "drawForecast",
+  "drawLocationDate",
+  "drawOutlookGraph",
+  "drawAlerts",
+  "drawStatusBar",
+  "drawStaticLayer",
+  "drawError",
+};
+
+static profile_stat_t profile_stats[PROF_SECTION_COUNT];
+static uint32_t profile_pages[PROFILE_MAX_PAGES]; // ticks of each page
+
+/*
+ * ticksPerUs
+ */
+static uint32_t ticksPerUs()
+{
+#ifdef ARDUINO
+  return getCpuFrequencyMhz();
+#else
+  return 1000;
+#endif
+} // end ticksPerUs
+
+void profileAdd(profile_section_t section, uint32_t ticks)
+{
+  profile_stat_t &s = profile_stats[section];
+  if (section == PROF_PAGE && s.calls < PROFILE_MAX_PAGES)
+  {
+    profile_pages[s.calls] = ticks;
+  }
+  ++s.calls;
+  s.total_ticks += ticks;
+  if (ticks > s.max_ticks)
+  {
+    s.max_ticks = ticks;
+  }
+  return;
+} // end profileAdd
+
+void profileReset()
+{
+  memset(profile_stats, 0, sizeof(profile_stats));
+  memset(profile_pages, 0, sizeof(profile_pages));
+  return;
+} // end profileReset
+
+/*
+ * profileFormat
+ *
+ * Writes the report of the frames drawn since the last profileReset() as a
+ * text table (times in microseconds) and returns its length. The output is
+ * truncated to len - 1 characters.
+ */
+size_t profileFormat(char *buf, size_t len)
+{
+  const uint32_t tpu = ticksPerUs();
+  size_t n = 0;
+  auto append = [&](int r) {
+    if (r > 0)
+    {
+      n += static_cast<size_t>(r);
+      if (n >= len)
+      {
+        n = len - 1;
+      }
+    }
+  };
+  if (len == 0)
+  {
+    return 0;
+  }
+  buf[0] = '\0';
+  append(snprintf(buf + n, len - n, "%-22s %6s %10s %10s %10s\n",
+                  "section", "calls", "total_us", "avg_us", "max_us"));
+  for (int i = 0; i < PROF_SECTION_COUNT; ++i)
+  {
+    const profile_stat_t &s = profile_stats[i];
+    if (s.calls == 0)
+    {
+      continue;
+    }
+    append(snprintf(buf + n, len - n, "%-22s %6u %10llu %10llu %10u\n",
+                    profile_names[i], static_cast<unsigned>(s.calls),
+                    static_cast<unsigned long long>(s.total_ticks / tpu),
+                    static_cast<unsigned long long>(
+                      s.total_ticks / s.calls / tpu),
+                    static_cast<unsigned>(s.max_ticks / tpu)));
+  }
+  const uint32_t pages = profile_stats[PROF_PAGE].calls;
+  for (uint32_t p = 0; p < pages && p < PROFILE_MAX_PAGES; ++p)
+  {
+    append(snprintf(buf + n, len - n, "page %-17u %6s %10u\n",
+                    static_cast<unsigned>(p), "",
+                    static_cast<unsigned>(profile_pages[p] / tpu)));
+  }
+  return n;
+} // end profileFormat
+
+/*
+ * profilePrint
+ *
+ * Prints the report on the serial monitor (stdout on host builds).
+ */
+void profilePrint()
+{
+  static char buf[1024];
+  profileFormat(buf, sizeof(buf));
+#ifdef ARDUINO
+  // written directly, after the log lines still queued
+  logFlush(LOG_FLUSH_MS);
+  Serial.print(buf);
+#else
+  fputs(buf, stdout);
+#endif
+  return;
+} // end profilePrint
+
+#endif // RENDER_PROFILER
@@ -0,0 +1,149 @@
+/* Refresh waveform policy for esp32-weather-epd.
+ * Copyright (C) 2022-2026  Luke Marzen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "config.h"
+#ifdef FAST_REFRESH
+
+#include <cmath>
+#include <cstring>
+#include <Arduino.h>
+
+#include "logger.h"
+#include "refresh_policy.h"
+
+// current icon, 5 forecast icons, alert count, day of the year
+#define REFRESH_SIG_SLOTS 8
+
+RTC_DATA_ATTR static bool     refresh_valid = false;
+RTC_DATA_ATTR static uint16_t fast_refresh_count = 0;
+RTC_DATA_ATTR static int16_t  last_clean_yday = -1;
+RTC_DATA_ATTR static int32_t  refresh_sig[REFRESH_SIG_SLOTS];
+
+// screen being drawn, committed by refreshCompleted()
+static int32_t pending_sig[REFRESH_SIG_SLOTS];
+static int16_t pending_yday = -1;
+static bool    pending_after_clean_hour = false;
+
+/*
+ * getSignature
+ *
+ * The parts of the screen that change most of its dark area when they change.
+ */
+static void getSignature(const owm_resp_onecall_t &onecall, const tm *timeInfo,
+                         int32_t *sig)
+{
+  sig[0] = onecall.current.weather.id;
+  for (int i = 0; i < 5; ++i)
+  {
+    sig[1 + i] = onecall.daily[i].weather.id;
+  }
+#if DISPLAY_ALERTS
+  sig[6] = static_cast<int32_t>(onecall.alerts.size());
+#else
+  sig[6] = 0;
+#endif
+  sig[7] = timeInfo->tm_yday;
+  return;
+} // end getSignature
+
+/*
+ * selectRefreshMode
+ *
+ * Returns the waveform to use for the weather screen about to be drawn. The
+ * choice only takes effect once the refresh is reported by refreshCompleted().
+ */
+refresh_mode_t selectRefreshMode(const owm_resp_onecall_t &onecall,
+                                 const tm *timeInfo, float inTemp)
+{
+  getSignature(onecall, timeInfo, pending_sig);
+  pending_yday = timeInfo->tm_yday;
+  pending_after_clean_hour = FAST_REFRESH_CLEAN_HOUR >= 0
+                          && timeInfo->tm_hour >= FAST_REFRESH_CLEAN_HOUR;
+
+  int changes = 0;
+  for (int i = 0; i < REFRESH_SIG_SLOTS; ++i)
+  {
+    changes += pending_sig[i] != refresh_sig[i];
+  }
+
+  const char *reason = nullptr;
+  if (!refresh_valid)
+  {
+    reason = "previous screen unknown";
+  }
+  else if (fast_refresh_count >= FAST_REFRESH_CLEAN_INTERVAL)
+  {
+    reason = "interval";
+  }
+  else if (pending_after_clean_hour && last_clean_yday != pending_yday)
+  {
+    reason = "daily";
+  }
+  else if (!std::isnan(inTemp) && inTemp < FAST_REFRESH_MIN_TEMP)
+  {
+    reason = "low temperature";
+  }
+  else if (changes >= FAST_REFRESH_MAX_CHANGES)
+  {
+    reason = "large change";
+  }
+
+  if (reason != nullptr)
+  {
+    LOG_I("Refresh: clean (%s), %u fast since last clean",
+          reason, fast_refresh_count);
+    return REFRESH_CLEAN;
+  }
+  LOG_I("Refresh: fast (%u since last clean)", fast_refresh_count + 1);
+  return REFRESH_FAST;
+} // end selectRefreshMode
+
+/*
+ * refreshCompleted
+ *
+ * Records the refresh of the screen passed to the last selectRefreshMode().
+ */
+void refreshCompleted(refresh_mode_t mode)
+{
+  memcpy(refresh_sig, pending_sig, sizeof(refresh_sig));
+  refresh_valid = true;
+  if (mode == REFRESH_FAST)
+  {
+    ++fast_refresh_count;
+    return;
+  }
+  fast_refresh_count = 0;
+  if (pending_after_clean_hour)
+  {
+    last_clean_yday = pending_yday;
+  }
+  return;
+} // end refreshCompleted
+
+/*
+ * refreshInvalidate
+ *
+ * Called when another screen (an error) replaces the weather screen, the next
+ * weather screen is then drawn with a clean refresh.
+ */
+void refreshInvalidate()
+{
+  refresh_valid = false;
+  return;
+} // end refreshInvalidate
+
+#endif // FAST_REFRESH
@@ -23,6 +23,12 @@
 #include "conversions.h"
 #include "client_utils.h"
 #include "display_utils.h"
+#include "glyph_pages.h"
+#include "logger.h"
+#include "profiler.h"
+#include "refresh_policy.h"
+#include "static_layer.h"
+#include "text_metrics.h"
 
 // fonts
 #include FONT_HEADER
@@ -39,34 +45,54 @@
 #include "icons/icons_160x160.h"
 #include "icons/icons_196x196.h"
 
-#ifdef DISP_BW_V2
-  GxEPD2_BW<GxEPD2_750_GDEY075T7,
-            GxEPD2_750_GDEY075T7::HEIGHT> display(
-    GxEPD2_750_GDEY075T7(PIN_EPD_CS,
-                  PIN_EPD_DC,
-                  PIN_EPD_RST,
-                  PIN_EPD_BUSY));
-#endif
-#ifdef DISP_3C_B
-  GxEPD2_3C<GxEPD2_750c_GDEY075Z08,
-            GxEPD2_750c_GDEY075Z08::HEIGHT / 2> display(
-    GxEPD2_750c_GDEY075Z08(PIN_EPD_CS,
-                    PIN_EPD_DC,
-                    PIN_EPD_RST,
-                    PIN_EPD_BUSY));
-#endif
-#ifdef DISP_7C_F
-  GxEPD2_7C<GxEPD2_730c_GDEY073D46,
-            GxEPD2_730c_GDEY073D46::HEIGHT / 4> display(
-    GxEPD2_730c_GDEY073D46(PIN_EPD_CS,
-                           PIN_EPD_DC,
-                           PIN_EPD_RST,
-                           PIN_EPD_BUSY));
-#endif
-#ifdef DISP_BW_V1
-  GxEPD2_BW<GxEPD2_750,
-            GxEPD2_750::HEIGHT> display(
-    GxEPD2_750(PIN_EPD_CS,
+#if defined(DISPLAY_RLE_FRAME)
+RleDisplay<epd_driver_t> display(
+  epd_driver_t(PIN_EPD_CS,
+               PIN_EPD_DC,
+               PIN_EPD_RST,
+               PIN_EPD_BUSY));
+#elif defined(DISPLAY_PAGE_PIPELINE)
+PipelinedDisplay<epd_driver_t> display(
+  epd_driver_t(PIN_EPD_CS,
+               PIN_EPD_DC,
+               PIN_EPD_RST,
+               PIN_EPD_BUSY));
+#elif defined(DISPLAY_FULL_FRAME_PSRAM)
+#include <new>
+#include <esp_heap_caps.h>
+typedef epd_display_t<DISP_HEIGHT>     epd_full_frame_t;
+typedef epd_display_t<EPD_PAGE_HEIGHT> epd_paged_t;
+
+static bool display_full_frame = false;
+
+/*
+ * createDisplay
+ *
+ * Constructs the display before setup() runs. When PSRAM is found the display
+ * (and with it the frame buffer) is placed there with a page height of the
+ * whole panel, so every frame is rendered in a single pass. Otherwise the paged
+ * display is allocated from the internal heap.
+ */
+static GxEPD2_GFX &createDisplay()
+{
+  const epd_driver_t driver(PIN_EPD_CS, PIN_EPD_DC, PIN_EPD_RST, PIN_EPD_BUSY);
+  // PSRAM is normally initialized after the global constructors
+  if (psramInit())
+  {
+    void *mem = heap_caps_malloc(sizeof(epd_full_frame_t), MALLOC_CAP_SPIRAM);
+    if (mem != nullptr)
+    {
+      display_full_frame = true;
+      return *new (mem) epd_full_frame_t(driver);
+    }
+  }
+  return *new epd_paged_t(driver);
+} // end createDisplay
+
+GxEPD2_GFX &display = createDisplay();
+#else
+epd_display_t<EPD_PAGE_HEIGHT> display(
+  epd_driver_t(PIN_EPD_CS,
                PIN_EPD_DC,
                PIN_EPD_RST,
                PIN_EPD_BUSY));
@@ -76,6 +102,507 @@
   #define ACCENT_COLOR GxEPD_BLACK
 #endif
 
+#ifdef STATIC_LAYER
+// The text helpers and the static chrome draw on the display, or on the canvas
+// the static layer is captured in
+static Adafruit_GFX *gfx_target = &display;
+#define GFX_TARGET (*gfx_target)
+// True when the static chrome of the frame was drawn from the layer
+static bool chrome_cached = false;
+#else
+#define GFX_TARGET display
+static const bool chrome_cached = false;
+#endif
+
+#if defined(FONT_RLE_LIST) || defined(USE_GLYPH_PAGES)
+// Adafruit_GFX does not expose the selected font, read the protected member
+struct GFXFontAccess : Adafruit_GFX
+{
+  static const GFXfont *get(const Adafruit_GFX &gfx)
+  {
+    return gfx.*(&GFXFontAccess::gfxFont);
+  }
+};
+#endif
+
+#ifdef FONT_RLE_LIST
+// Fonts of FONT_HEADER whose glyph bitmaps are run-length encoded
+// (fontconvert -r). Their metrics are unchanged, only drawing differs.
+static const GFXfont *const rle_fonts[] = {FONT_RLE_LIST};
+
+/*
+ * isRleFont
+ *
+ * Returns true if the font selected on the display is run-length encoded.
+ */
+static bool isRleFont()
+{
+  const GFXfont *font = GFXFontAccess::get(GFX_TARGET);
+  for (const GFXfont *f : rle_fonts)
+  {
+    if (f == font)
+    {
+      return true;
+    }
+  }
+  return false;
+} // end isRleFont
+
+/*
+ * printRle
+ *
+ * Draws text at the cursor with a run-length encoded font and advances the
+ * cursor like Adafruit_GFX::print(). Each glyph is a stream of
+ * background/foreground run pairs packed in nibbles, foreground runs are drawn
+ * as horizontal spans (wrapping to the next glyph row when needed) instead of
+ * testing every bit of the glyph.
+ */
+static void printRle(const char *text, uint16_t color)
+{
+  const GFXfont *font = GFXFontAccess::get(GFX_TARGET);
+  int16_t x = GFX_TARGET.getCursorX();
+  int16_t y = GFX_TARGET.getCursorY();
+  const int16_t x0 = x;
+
+  GFX_TARGET.startWrite();
+  for (; *text; ++text)
+  {
+    uint8_t c = static_cast<uint8_t>(*text);
+    if (c == '\n')
+    {
+      x = x0;
+      y += pgm_read_byte(&font->yAdvance);
+      continue;
+    }
+    if (c == '\r' || c < font->first || c > font->last)
+    {
+      continue;
+    }
+    const GFXglyph *glyph = &font->glyph[c - font->first];
+    const uint8_t *data = font->bitmap + pgm_read_word(&glyph->bitmapOffset);
+    const int16_t w = pgm_read_byte(&glyph->width);
+    const int16_t h = pgm_read_byte(&glyph->height);
+    const int16_t gx = x + static_cast<int8_t>(pgm_read_byte(&glyph->xOffset));
+    const int16_t gy = y + static_cast<int8_t>(pgm_read_byte(&glyph->yOffset));
+
+    int16_t px = 0; // position inside the glyph
+    int16_t py = (w == 0) ? h : 0;
+    while (py < h)
+    {
+      uint8_t pair = pgm_read_byte(data++);
+      px += pair >> 4;
+      while (px >= w && py < h)
+      {
+        px -= w;
+        ++py;
+      }
+      int16_t fg = pair & 0x0F;
+      while (fg > 0 && py < h)
+      {
+        int16_t len = std::min<int16_t>(fg, w - px);
+        GFX_TARGET.writeFastHLine(gx + px, gy + py, len, color);
+        fg -= len;
+        px += len;
+        if (px == w)
+        {
+          px = 0;
+          ++py;
+        }
+      }
+    }
+    x += pgm_read_byte(&glyph->xAdvance);
+  }
+  GFX_TARGET.endWrite();
+  GFX_TARGET.setCursor(x, y);
+  return;
+} // end printRle
+#endif // FONT_RLE_LIST
+
+/*
+ * printGFX
+ *
+ * Draws text at the cursor with the selected 8-bit font.
+ */
+static void printGFX(const char *text, uint16_t color)
+{
+#ifdef FONT_RLE_LIST
+  if (isRleFont())
+  {
+    printRle(text, color);
+    return;
+  }
+#endif
+  GFX_TARGET.print(text);
+  return;
+} // end printGFX
+
+/*
+ * nextCodepoint
+ *
+ * Decodes the UTF-8 sequence at text and advances past it. Bytes that do not
+ * start a valid sequence are returned as they are, so Latin-1 strings (the
+ * locale files) are drawn unchanged.
+ */
+static uint32_t nextCodepoint(const char *&text)
+{
+  const uint8_t *p = reinterpret_cast<const uint8_t *>(text);
+  uint32_t cp = p[0];
+  int n = (cp >= 0xC2 && cp <= 0xDF) ? 1
+        : (cp >= 0xE0 && cp <= 0xEF) ? 2
+        : (cp >= 0xF0 && cp <= 0xF4) ? 3 : 0;
+  uint32_t u = cp & (0x3F >> n);
+  for (int i = 1; i <= n; ++i)
+  {
+    if ((p[i] & 0xC0) != 0x80)
+    {
+      ++text;
+      return cp;
+    }
+    u = (u << 6) | (p[i] & 0x3F);
+  }
+  if (n == 0 || (n == 2 && u < 0x800) || (n == 3 && u < 0x10000))
+  {
+    ++text;
+    return cp;
+  }
+  text += n + 1;
+  return u;
+} // end nextCodepoint
+
+/*
+ * isCjk
+ *
+ * Returns true for the codepoints of the scripts written without spaces (CJK
+ * radicals, punctuation, kana and ideographs, hangul syllables, full width
+ * forms). A line may break before or after any of them.
+ */
+static bool isCjk(uint32_t cp)
+{
+  return (cp >= 0x2E80  && cp <= 0x9FFF)
+      || (cp >= 0xAC00  && cp <= 0xD7AF)
+      || (cp >= 0xF900  && cp <= 0xFAFF)
+      || (cp >= 0xFF00  && cp <= 0xFFEF)
+      || (cp >= 0x20000 && cp <= 0x3FFFF);
+} // end isCjk
+
+/*
+ * isCjkClosing
+ *
+ * Returns true for the CJK punctuation a line must not start with.
+ */
+static bool isCjkClosing(uint32_t cp)
+{
+  switch (cp)
+  {
+  case 0x3001: // ideographic comma
+  case 0x3002: // ideographic full stop
+  case 0x3009: // right angle bracket
+  case 0x300B: // right double angle bracket
+  case 0x300D: // right corner bracket
+  case 0x300F: // right white corner bracket
+  case 0x3011: // right black lenticular bracket
+  case 0xFF01: // full width exclamation mark
+  case 0xFF09: // full width right parenthesis
+  case 0xFF0C: // full width comma
+  case 0xFF0E: // full width full stop
+  case 0xFF1A: // full width colon
+  case 0xFF1B: // full width semicolon
+  case 0xFF1F: // full width question mark
+    return true;
+  default:
+    return false;
+  }
+} // end isCjkClosing
+
+/*
+ * lastCjkBreak
+ *
+ * Returns the index of the last byte before the last place text can break
+ * between two codepoints, one of them CJK, or -1.
+ */
+static int lastCjkBreak(const String &text)
+{
+  const char *start = text.c_str();
+  const char *p = start;
+  const char *prev = nullptr;
+  bool prevCjk = false;
+  int splitAt = -1;
+  while (*p)
+  {
+    const char *cur = p;
+    uint32_t cp = nextCodepoint(p);
+    bool cjk = isCjk(cp);
+    if (prev != nullptr && (cjk || prevCjk) && !isCjkClosing(cp)
+     && *prev != ' ' && *cur != ' ')
+    {
+      splitAt = cur - start - 1;
+    }
+    prev = cur;
+    prevCjk = cjk;
+  }
+  return splitAt;
+} // end lastCjkBreak
+
+#ifdef USE_GLYPH_PAGES
+// Point size of each 8-bit font, glyph pages are read at the size of the
+// selected font.
+static const struct
+{
+  const GFXfont *font;
+  uint16_t size_pt;
+} glyph_page_sizes[] = {
+  {&FONT_4pt8b,   4}, {&FONT_5pt8b,   5}, {&FONT_6pt8b,   6},
+  {&FONT_7pt8b,   7}, {&FONT_8pt8b,   8}, {&FONT_9pt8b,   9},
+  {&FONT_10pt8b, 10}, {&FONT_11pt8b, 11}, {&FONT_12pt8b, 12},
+  {&FONT_14pt8b, 14}, {&FONT_16pt8b, 16}, {&FONT_18pt8b, 18},
+  {&FONT_20pt8b, 20}, {&FONT_22pt8b, 22}, {&FONT_24pt8b, 24},
+  {&FONT_26pt8b, 26},
+};
+
+/*
+ * getFontSize
+ *
+ * Returns the point size of the selected font, 0 if it has no glyph pages.
+ */
+static uint16_t getFontSize()
+{
+  const GFXfont *font = GFXFontAccess::get(GFX_TARGET);
+  for (const auto &s : glyph_page_sizes)
+  {
+    if (s.font == font)
+    {
+      return s.size_pt;
+    }
+  }
+  return 0;
+} // end getFontSize
+
+/*
+ * isPlainText
+ *
+ * Returns true if the text is only 7-bit ASCII, which the 8-bit fonts draw
+ * without decoding.
+ */
+static bool isPlainText(const char *text)
+{
+  for (; *text; ++text)
+  {
+    if (static_cast<uint8_t>(*text) >= 0x80)
+    {
+      return false;
+    }
+  }
+  return true;
+} // end isPlainText
+
+/*
+ * getGlyphMetrics
+ *
+ * Metrics of the glyph used to draw codepoint: the 8-bit font glyph when the
+ * font covers it, else the paged glyph, else the font's '?'. Returns false if
+ * nothing can be drawn. *paged is set to the paged glyph or nullptr.
+ */
+static bool getGlyphMetrics(const GFXfont *font, uint16_t size_pt,
+                            uint32_t cp, GFXglyph &g,
+                            const paged_glyph_t **paged)
+{
+  *paged = nullptr;
+  if (cp < font->first || cp > font->last)
+  {
+    *paged = (size_pt != 0) ? getPagedGlyph(size_pt, cp) : nullptr;
+    if (*paged != nullptr)
+    {
+      g = {0, (*paged)->width, (*paged)->height, (*paged)->xAdvance,
+           (*paged)->xOffset, (*paged)->yOffset};
+      return true;
+    }
+    cp = '?';
+    if (cp < font->first || cp > font->last)
+    {
+      return false;
+    }
+  }
+  memcpy_P(&g, &font->glyph[cp - font->first], sizeof(GFXglyph));
+  return true;
+} // end getGlyphMetrics
+
+/*
+ * getTextBoundsUtf8
+ *
+ * Adafruit_GFX::getTextBounds() for UTF-8 text that may use glyph pages
+ * (text size 1, no wrap).
+ */
+static void getTextBoundsUtf8(const char *text, int16_t x, int16_t y,
+                              int16_t *x1, int16_t *y1,
+                              uint16_t *w, uint16_t *h)
+{
+  const GFXfont *font = GFXFontAccess::get(GFX_TARGET);
+  const uint16_t size_pt = getFontSize();
+  int16_t minx = 0x7FFF, miny = 0x7FFF, maxx = -1, maxy = -1;
+  *x1 = x;
+  *y1 = y;
+  *w = *h = 0;
+  while (*text)
+  {
+    uint32_t cp = nextCodepoint(text);
+    GFXglyph g;
+    const paged_glyph_t *paged;
+    if (cp == '\n')
+    {
+      x = 0;
+      y += pgm_read_byte(&font->yAdvance);
+      continue;
+    }
+    if (cp == '\r' || !getGlyphMetrics(font, size_pt, cp, g, &paged))
+    {
+      continue;
+    }
+    int16_t tx1 = x + g.xOffset;
+    int16_t ty1 = y + g.yOffset;
+    minx = std::min<int16_t>(minx, tx1);
+    miny = std::min<int16_t>(miny, ty1);
+    maxx = std::max<int16_t>(maxx, tx1 + g.width - 1);
+    maxy = std::max<int16_t>(maxy, ty1 + g.height - 1);
+    x += g.xAdvance;
+  }
+  if (maxx >= minx)
+  {
+    *x1 = minx;
+    *w = maxx - minx + 1;
+  }
+  if (maxy >= miny)
+  {
+    *y1 = miny;
+    *h = maxy - miny + 1;
+  }
+  return;
+} // end getTextBoundsUtf8
+
+/*
+ * drawPagedGlyph
+ *
+ * Draws a glyph read from the glyph pages with its baseline origin at (x, y),
+ * as horizontal spans of set bits.
+ */
+static void drawPagedGlyph(int16_t x, int16_t y, const paged_glyph_t &g,
+                           uint16_t color)
+{
+  const uint8_t *bitmap = g.bitmap;
+  uint32_t bit = 0;
+  GFX_TARGET.startWrite();
+  for (int16_t yy = 0; yy < g.height; ++yy)
+  {
+    int16_t run = 0;
+    for (int16_t xx = 0; xx < g.width; ++xx, ++bit)
+    {
+      if (bitmap[bit >> 3] & (0x80 >> (bit & 7)))
+      {
+        ++run;
+        continue;
+      }
+      if (run)
+      {
+        GFX_TARGET.writeFastHLine(x + g.xOffset + xx - run, y + g.yOffset + yy,
+                               run, color);
+        run = 0;
+      }
+    }
+    if (run)
+    {
+      GFX_TARGET.writeFastHLine(x + g.xOffset + g.width - run, y + g.yOffset + yy,
+                             run, color);
+    }
+  }
+  GFX_TARGET.endWrite();
+  return;
+} // end drawPagedGlyph
+
+/*
+ * printUtf8
+ *
+ * Draws UTF-8 text at the cursor. Characters covered by the 8-bit font are
+ * collected and drawn with it, the others are drawn from the glyph pages.
+ */
+static void printUtf8(const char *text, uint16_t color)
+{
+  const GFXfont *font = GFXFontAccess::get(GFX_TARGET);
+  const uint16_t size_pt = getFontSize();
+  char run[64];
+  size_t len = 0;
+  while (*text)
+  {
+    uint32_t cp = nextCodepoint(text);
+    const paged_glyph_t *paged = nullptr;
+    if ((cp < font->first || cp > font->last) && cp != '\n' && cp != '\r')
+    {
+      paged = (size_pt != 0) ? getPagedGlyph(size_pt, cp) : nullptr;
+      if (paged == nullptr)
+      {
+        cp = '?';
+      }
+    }
+    if (paged == nullptr)
+    {
+      run[len++] = static_cast<char>(cp);
+      if (len < sizeof(run) - 1)
+      {
+        continue;
+      }
+    }
+    run[len] = '\0';
+    printGFX(run, color);
+    len = 0;
+    if (paged != nullptr)
+    {
+      drawPagedGlyph(GFX_TARGET.getCursorX(), GFX_TARGET.getCursorY(), *paged,
+                     color);
+      GFX_TARGET.setCursor(GFX_TARGET.getCursorX() + paged->xAdvance,
+                        GFX_TARGET.getCursorY());
+    }
+  }
+  run[len] = '\0';
+  printGFX(run, color);
+  return;
+} // end printUtf8
+#endif // USE_GLYPH_PAGES
+
+/*
+ * printText
+ *
+ * Draws text at the cursor with the selected font.
+ */
+static void printText(const char *text, uint16_t color)
+{
+#ifdef USE_GLYPH_PAGES
+  if (!isPlainText(text))
+  {
+    printUtf8(text, color);
+    return;
+  }
+#endif
+  printGFX(text, color);
+  return;
+} // end printText
+
+/*
+ * getTextBounds
+ *
+ * Bounding box of text drawn at (x, y) with the selected font.
+ */
+static void getTextBounds(const String &text, int16_t x, int16_t y,
+                          int16_t *x1, int16_t *y1, uint16_t *w, uint16_t *h)
+{
+#ifdef USE_GLYPH_PAGES
+  if (!isPlainText(text.c_str()))
+  {
+    getTextBoundsUtf8(text.c_str(), x, y, x1, y1, w, h);
+    return;
+  }
+#endif
+  GFX_TARGET.getTextBounds(text, x, y, x1, y1, w, h);
+  return;
+} // end getTextBounds
+
 /*
  * GetStringWidth
  *
@@ -85,7 +612,7 @@ uint16_t getStringWidth(const String &text)
 {
   int16_t x1, y1;
   uint16_t w, h;
-  display.getTextBounds(text, 0, 0, &x1, &y1, &w, &h);
+  getTextBounds(text, 0, 0, &x1, &y1, &w, &h);
   return w;
 }
 
@@ -98,7 +625,7 @@ uint16_t getStringHeight(const String &text)
 {
   int16_t x1, y1;
   uint16_t w, h;
-  display.getTextBounds(text, 0, 0, &x1, &y1, &w, &h);
+  getTextBounds(text, 0, 0, &x1, &y1, &w, &h);
   return h;
 }
 
@@ -112,8 +639,12 @@ void drawString(int16_t x, int16_t y, const String &text, alignment_t alignment,
 {
   int16_t x1, y1;
   uint16_t w, h;
-  display.setTextColor(color);
-  display.getTextBounds(text, x, y, &x1, &y1, &w, &h);
+  GFX_TARGET.setTextColor(color);
+  // left aligned text does not need to be measured
+  if (alignment != LEFT)
+  {
+    getTextBounds(text, x, y, &x1, &y1, &w, &h);
+  }
   if (alignment == RIGHT)
   {
     x = x - w;
@@ -122,8 +653,31 @@ void drawString(int16_t x, int16_t y, const String &text, alignment_t alignment,
   {
     x = x - w / 2;
   }
-  display.setCursor(x, y);
-  display.print(text);
+  GFX_TARGET.setCursor(x, y);
+  printText(text.c_str(), color);
+  return;
+} // end drawString
+
+/*
+ * DrawString
+ *
+ * Draws a string with alignment, using a width already known by the caller
+ * (typically TEXT_WIDTH() evaluated at compile time, see text_metrics.h)
+ */
+void drawString(int16_t x, int16_t y, const char *text, uint16_t width,
+                alignment_t alignment, uint16_t color)
+{
+  GFX_TARGET.setTextColor(color);
+  if (alignment == RIGHT)
+  {
+    x = x - width;
+  }
+  if (alignment == CENTER)
+  {
+    x = x - width / 2;
+  }
+  GFX_TARGET.setCursor(x, y);
+  printText(text, color);
   return;
 } // end drawString
 
@@ -132,7 +686,8 @@ void drawString(int16_t x, int16_t y, const String &text, alignment_t alignment,
  *
  * Draws a string that will flow into the next line when max_width is reached.
  * If a string exceeds max_lines an ellipsis (...) will terminate the last word.
- * Lines will break at spaces(' ') and dashes('-').
+ * Lines will break at spaces(' ') and dashes('-'), and between characters of
+ * the scripts written without spaces (see isCjk).
  *
  * Note: max_width should be big enough to accommodate the largest word that
  *       will be displayed. If an unbroken string of characters longer than
@@ -152,16 +707,17 @@ void drawMultiLnString(int16_t x, int16_t y, const String &text,
     int16_t  x1, y1;
     uint16_t w, h;
 
-    display.getTextBounds(textRemaining, 0, 0, &x1, &y1, &w, &h);
+    getTextBounds(textRemaining, 0, 0, &x1, &y1, &w, &h);
 
     int endIndex = textRemaining.length();
     // check if remaining text is to wide, if it is then print what we can
     String subStr = textRemaining;
     int splitAt = 0;
     int keepLastChar = 0;
+    int removeLastChar = 0;
     while (w > max_width && splitAt != -1)
     {
-      if (keepLastChar)
+      if (removeLastChar)
       {
         // if we kept the last character during the last iteration of this while
         // loop, remove it now so we don't get stuck in an infinite loop.
@@ -169,6 +725,7 @@ void drawMultiLnString(int16_t x, int16_t y, const String &text,
       }
 
       // find the last place in the string that we can break it.
+      int cjkSplitAt = lastCjkBreak(subStr);
       if (current_line < max_lines - 1)
       {
         splitAt = std::max(subStr.lastIndexOf(" "),
@@ -176,9 +733,15 @@ void drawMultiLnString(int16_t x, int16_t y, const String &text,
       }
       else
       {
-        // this is the last line, only break at spaces so we can add ellipsis
+        // this is the last line, only break at spaces (or between CJK
+        // characters) so we can add ellipsis
         splitAt = subStr.lastIndexOf(" ");
       }
+      bool cjkSplit = cjkSplitAt > splitAt;
+      if (cjkSplit)
+      {
+        splitAt = cjkSplitAt;
+      }
 
       // if splitAt == -1 then there is an unbroken set of characters that is
       // longer than max_width. Otherwise if splitAt != -1 then we can continue
@@ -189,10 +752,18 @@ void drawMultiLnString(int16_t x, int16_t y, const String &text,
         subStr = subStr.substring(0, endIndex + 1);
 
         char lastChar = subStr.charAt(endIndex);
-        if (lastChar == ' ')
+        if (cjkSplit)
+        {
+          // this char is printed on this line, the next break found is before
+          // it
+          keepLastChar = 1;
+          removeLastChar = 0;
+        }
+        else if (lastChar == ' ')
         {
           // remove this char now so it is not counted towards line width
           keepLastChar = 0;
+          removeLastChar = 0;
           subStr.remove(endIndex);
           --endIndex;
         }
@@ -200,18 +771,19 @@ void drawMultiLnString(int16_t x, int16_t y, const String &text,
         {
           // this char will be printed on this line and removed next iteration
           keepLastChar = 1;
+          removeLastChar = 1;
         }
 
         if (current_line < max_lines - 1)
         {
           // this is not the last line
-          display.getTextBounds(subStr, 0, 0, &x1, &y1, &w, &h);
+          getTextBounds(subStr, 0, 0, &x1, &y1, &w, &h);
         }
         else
         {
           // this is the last line, we need to make sure there is space for
           // ellipsis
-          display.getTextBounds(subStr + "...", 0, 0, &x1, &y1, &w, &h);
+          getTextBounds(subStr + "...", 0, 0, &x1, &y1, &w, &h);
           if (w <= max_width)
           {
             // ellipsis fit, add them to subStr
@@ -235,11 +807,11 @@ void drawMultiLnString(int16_t x, int16_t y, const String &text,
 } // end drawMultiLnString
 
 /*
- * InitDisplay
+ * initPanel
  *
- * Initialize e-paper display
+ * Power, reset and initialize the e-paper controller
  */
-void initDisplay ( int partial )
+static void initPanel ( int partial )
 {
   pinMode(PIN_EPD_PWR, OUTPUT);
   digitalWrite(PIN_EPD_PWR, HIGH);
@@ -262,6 +834,26 @@ void initDisplay ( int partial )
             PIN_EPD_MOSI,
             PIN_EPD_CS);
 
+#ifdef FAST_REFRESH
+  // the weather screen selects its waveform after init, others are clean
+  setFastRefresh(false);
+#endif
+  return;
+} // end initPanel
+
+/*
+ * InitDisplay
+ *
+ * Initialize e-paper display
+ */
+void initDisplay ( int partial )
+{
+#ifdef WEB_PREVIEW
+  // a preview is drawn in RAM only, the panel is left as it is
+  if ( !display.previewing() )
+#endif
+  initPanel(partial);
+
   display.setRotation(0);
   display.setTextSize(1);
   display.setTextColor(GxEPD_BLACK);
@@ -269,7 +861,7 @@ void initDisplay ( int partial )
   // display.fillScreen(GxEPD_WHITE);
   if ( partial )
   {
-    Serial.println("Partial Refresh");
+    LOG_I("Partial Refresh");
     display.setPartialWindow(0, 0, 40, 40);
   }
   else
@@ -278,6 +870,9 @@ void initDisplay ( int partial )
   }
     
   display.firstPage(); // use paged drawing mode, sets fillScreen(GxEPD_WHITE)
+#ifdef STATIC_LAYER
+  chrome_cached = false;
+#endif
   return;
 } // end initDisplay
 
@@ -288,12 +883,90 @@ void initDisplay ( int partial )
  */
 void powerOffDisplay()
 {
+#ifdef WEB_PREVIEW
+  if (display.previewing())
+  {
+    return;
+  }
+#endif
   display.hibernate(); // turns powerOff() and sets controller to deep sleep for
                        // minimum power use
   digitalWrite(PIN_EPD_PWR, LOW);
   return;
 } // end powerOffDisplay
 
+#ifdef FAST_REFRESH
+/*
+ * displayDriver
+ *
+ * The GxEPD2 panel driver of the display.
+ */
+static epd_driver_t &displayDriver()
+{
+#ifdef DISPLAY_FULL_FRAME_PSRAM
+  if (display_full_frame)
+  {
+    return static_cast<epd_full_frame_t &>(display).epd2;
+  }
+  return static_cast<epd_paged_t &>(display).epd2;
+#else
+  return display.epd2;
+#endif
+} // end displayDriver
+
+// drivers with a fast full refresh waveform have a useFastFullUpdate member
+template <typename Driver>
+static auto setFastFullUpdate(Driver &epd2, bool fast, int)
+  -> decltype(epd2.useFastFullUpdate = fast, true)
+{
+  epd2.useFastFullUpdate = fast;
+  return true;
+}
+template <typename Driver>
+static bool setFastFullUpdate(Driver &, bool, long)
+{
+  return false;
+}
+
+/*
+ * setFastRefresh
+ *
+ * Selects the fast or standard waveform for the next full refresh. Returns
+ * false if the panel only has the standard waveform.
+ */
+bool setFastRefresh(bool fast)
+{
+  return setFastFullUpdate(displayDriver(), fast, 0);
+} // end setFastRefresh
+#endif
+
+#if LOG_LEVEL >= LOG_LEVEL_DEBUG
+/*
+ * logRenderStats
+ *
+ * Logs (debug level) the time spent drawing and the total frame time
+ * (drawing, transfer and refresh), with the number of pages and the memory
+ * left, to compare the frame buffer modes.
+ */
+void logRenderStats(unsigned long draw_ms, unsigned long total_ms)
+{
+  char buf[64] = "";
+#ifdef DISPLAY_RLE_FRAME
+  snprintf(buf, sizeof(buf), ", RLE frame buffer %u bytes",
+           static_cast<unsigned>(display.frameBytes()));
+#endif
+#ifdef DISPLAY_FULL_FRAME_PSRAM
+  snprintf(buf, sizeof(buf), ", %s frame buffer, PSRAM %u free",
+           display_full_frame ? "PSRAM full" : "paged",
+           ESP.getFreePsram());
+#endif
+  LOG_D("Render: %lums draw, %lums total, %u page(s), heap %u free (%u min)%s",
+        draw_ms, total_ms, display.pages(),
+        ESP.getFreeHeap(), ESP.getMinFreeHeap(), buf);
+  return;
+} // end logRenderStats
+#endif
+
 /*
  * drawWebIcon
  *
@@ -309,6 +982,10 @@ void drawWebIcon ( int drawIcon )
     display.drawInvertedBitmap(0, 0, ap_icon_40x40, 40, 40, GxEPD_BLACK);
   else
   {
+#ifdef WEB_PREVIEW
+    // back to the frame shown on the panel
+    display.endPreview();
+#endif
     // Just clear the Web icon using partial refresh
     initDisplay(1);
     do
@@ -340,6 +1017,239 @@ void drawWebIcon ( int drawIcon )
 #define FT_LVAL FONT_11pt8b
 #endif
 
+/*
+ * Unit symbols of the selected units, drawn after the values with their
+ * widths known at compile time (see text_metrics.h)
+ */
+#if defined(UNITS_TEMP_KELVIN)
+#define UNIT_TEMP TXT_UNITS_TEMP_KELVIN
+#elif defined(UNITS_TEMP_CELSIUS)
+#define UNIT_TEMP TXT_UNITS_TEMP_CELSIUS
+#elif defined(UNITS_TEMP_FAHRENHEIT)
+#define UNIT_TEMP TXT_UNITS_TEMP_FAHRENHEIT
+#endif
+
+#if defined(UNITS_SPEED_METERSPERSECOND)
+#define UNIT_SPEED TXT_UNITS_SPEED_METERSPERSECOND
+#elif defined(UNITS_SPEED_FEETPERSECOND)
+#define UNIT_SPEED TXT_UNITS_SPEED_FEETPERSECOND
+#elif defined(UNITS_SPEED_KILOMETERSPERHOUR)
+#define UNIT_SPEED TXT_UNITS_SPEED_KILOMETERSPERHOUR
+#elif defined(UNITS_SPEED_MILESPERHOUR)
+#define UNIT_SPEED TXT_UNITS_SPEED_MILESPERHOUR
+#elif defined(UNITS_SPEED_KNOTS)
+#define UNIT_SPEED TXT_UNITS_SPEED_KNOTS
+#elif defined(UNITS_SPEED_BEAUFORT)
+#define UNIT_SPEED TXT_UNITS_SPEED_BEAUFORT
+#endif
+
+#if defined(UNITS_PRES_HECTOPASCALS)
+#define UNIT_PRES TXT_UNITS_PRES_HECTOPASCALS
+#elif defined(UNITS_PRES_PASCALS)
+#define UNIT_PRES TXT_UNITS_PRES_PASCALS
+#elif defined(UNITS_PRES_MILLIMETERSOFMERCURY)
+#define UNIT_PRES TXT_UNITS_PRES_MILLIMETERSOFMERCURY
+#elif defined(UNITS_PRES_INCHESOFMERCURY)
+#define UNIT_PRES TXT_UNITS_PRES_INCHESOFMERCURY
+#elif defined(UNITS_PRES_MILLIBARS)
+#define UNIT_PRES TXT_UNITS_PRES_MILLIBARS
+#elif defined(UNITS_PRES_ATMOSPHERES)
+#define UNIT_PRES TXT_UNITS_PRES_ATMOSPHERES
+#elif defined(UNITS_PRES_GRAMSPERSQUARECENTIMETER)
+#define UNIT_PRES TXT_UNITS_PRES_GRAMSPERSQUARECENTIMETER
+#elif defined(UNITS_PRES_POUNDSPERSQUAREINCH)
+#define UNIT_PRES TXT_UNITS_PRES_POUNDSPERSQUAREINCH
+#endif
+
+#if defined(UNITS_DIST_KILOMETERS)
+#define UNIT_DIST TXT_UNITS_DIST_KILOMETERS
+#elif defined(UNITS_DIST_MILES)
+#define UNIT_DIST TXT_UNITS_DIST_MILES
+#endif
+
+#if defined(UNITS_HOURLY_PRECIP_MILLIMETERS)
+#define UNIT_HOURLY_PRECIP TXT_UNITS_PRECIP_MILLIMETERS
+#elif defined(UNITS_HOURLY_PRECIP_CENTIMETERS)
+#define UNIT_HOURLY_PRECIP TXT_UNITS_PRECIP_CENTIMETERS
+#elif defined(UNITS_HOURLY_PRECIP_INCHES)
+#define UNIT_HOURLY_PRECIP TXT_UNITS_PRECIP_INCHES
+#endif
+
+/*
+ * labelWidth
+ *
+ * Width in the label font (or in the small font) of a description drawn in
+ * the slots. The descriptions are locale labels, their widths are evaluated at
+ * compile time; any other text is measured.
+ */
+typedef struct label_width
+{
+  const char *text;
+  uint16_t    w;        // FT_LAB, or the font of the status bar
+  uint16_t    w_small;  // FONT_5pt8b
+} label_width_t;
+
+#define LABEL_WIDTH(text) \
+  {text, TEXT_WIDTH(FT_LAB, text), TEXT_WIDTH(FONT_5pt8b, text)}
+
+#if defined(POS_UVI) || defined(POS_MOONPHASE)
+static uint16_t labelWidth(const char *text, bool small)
+{
+  // local, the asset fonts are only loaded at run time
+  static const label_width_t labels[] = {
+    LABEL_WIDTH(TXT_UV_LOW),
+    LABEL_WIDTH(TXT_UV_MODERATE),
+    LABEL_WIDTH(TXT_UV_HIGH),
+    LABEL_WIDTH(TXT_UV_VERY_HIGH),
+    LABEL_WIDTH(TXT_UV_EXTREME),
+    LABEL_WIDTH(TXT_NEW_MOON),
+    LABEL_WIDTH(TXT_WAXING_CRESCENT),
+    LABEL_WIDTH(TXT_FIRST_QUARTER),
+    LABEL_WIDTH(TXT_WAXING_GIBBOUS),
+    LABEL_WIDTH(TXT_FULL_MOON),
+    LABEL_WIDTH(TXT_WANING_GIBBOUS),
+    LABEL_WIDTH(TXT_THIRD_QUARTER),
+    LABEL_WIDTH(TXT_WANING_CRESCENT),
+  };
+
+  for (const label_width_t &label : labels)
+  {
+    if (label.text == text)
+    {
+      return small ? label.w_small : label.w;
+    }
+  }
+  return getStringWidth(text);
+} // end labelWidth
+#endif
+
+/*
+ * The parts of the current conditions slots that do not depend on the data:
+ * slot pos (column pos % 2, row pos / 2) has an icon and a label.
+ */
+typedef struct slot_chrome
+{
+  int            pos;
+  const uint8_t *icon;   // 48x48, nullptr when the icon shows the data
+  const uint8_t *badge;  // 24x24 over the top right of the icon, or nullptr
+  const char    *label;
+} slot_chrome_t;
+
+#ifdef POS_AIR_QULITY
+static const char *airQualityLabel()
+{
+  if (aqi_desc_type(AQI_SCALE) == AIR_QUALITY_DESC)
+  {
+    return TXT_AIR_QUALITY;
+  }
+  return TXT_AIR_POLLUTION; // (aqi_desc_type(AQI_SCALE) == AIR_POLLUTION_DESC)
+} // end airQualityLabel
+#endif
+
+static const slot_chrome_t slot_chromes[] = {
+#ifdef POS_SUNRISE
+  {POS_SUNRISE,    wi_sunrise_48x48,        nullptr, TXT_SUNRISE},
+#endif
+#ifdef POS_SUNSET
+  {POS_SUNSET,     wi_sunset_48x48,         nullptr, TXT_SUNSET},
+#endif
+#ifdef POS_WIND
+  {POS_WIND,       wi_strong_wind_48x48,    nullptr, TXT_WIND},
+#endif
+#ifdef POS_HUMIDITY
+  {POS_HUMIDITY,   wi_humidity_48x48,       nullptr, TXT_HUMIDITY},
+#endif
+#ifdef POS_UVI
+  {POS_UVI,        wi_day_sunny_48x48,      nullptr, TXT_UV_INDEX},
+#endif
+#ifdef POS_PRESSURE
+  {POS_PRESSURE,   wi_barometer_48x48,      nullptr, TXT_PRESSURE},
+#endif
+#ifdef POS_VISIBILITY
+  {POS_VISIBILITY, visibility_icon_48x48,   nullptr, TXT_VISIBILITY},
+#endif
+#ifdef POS_AIR_QULITY
+  {POS_AIR_QULITY, air_filter_48x48,        nullptr, airQualityLabel()},
+#endif
+#ifdef POS_INTEMP
+  {POS_INTEMP,     house_thermometer_48x48, nullptr, TXT_INDOOR_TEMPERATURE},
+#endif
+#ifdef POS_INHUMIDITY
+  {POS_INHUMIDITY, house_humidity_48x48,    nullptr, TXT_INDOOR_HUMIDITY},
+#endif
+#ifdef POS_MOONRISE
+  {POS_MOONRISE,   wi_moonrise_48x48,       nullptr, TXT_MOONRISE},
+#endif
+#ifdef POS_MOONSET
+  {POS_MOONSET,    wi_moonset_48x48,        nullptr, TXT_MOONSET},
+#endif
+#ifdef POS_MOONPHASE
+  {POS_MOONPHASE,  nullptr,                 nullptr, TXT_MOONPHASE},
+#endif
+#ifdef POS_DEWPOINT
+  {POS_DEWPOINT,   wi_thermometer_48x48, wi_raindrops_24x24, TXT_DEWPOINT},
+#endif
+  {-1, nullptr, nullptr, nullptr} // end
+};
+
+/*
+ * drawChromeBitmap
+ *
+ * drawInvertedBitmap() in black on the drawing target.
+ */
+static void drawChromeBitmap(int16_t x, int16_t y, const uint8_t *bitmap,
+                             int16_t w, int16_t h)
+{
+#ifdef STATIC_LAYER
+  if (gfx_target != &display)
+  {
+    static_cast<LayerCanvas *>(gfx_target)->drawInvertedBitmap(
+      x, y, bitmap, w, h, GxEPD_BLACK);
+    return;
+  }
+#endif
+  display.drawInvertedBitmap(x, y, bitmap, w, h, GxEPD_BLACK);
+  return;
+} // end drawChromeBitmap
+
+static void drawSlotChrome(const slot_chrome_t &slot)
+{
+  const int16_t x = OF_RAW2 * (slot.pos % 2);
+  const int16_t y = 204 + (48 + 8) * (slot.pos / 2);
+  if (slot.icon != nullptr)
+  {
+    drawChromeBitmap(x, y, slot.icon, 48, 48);
+  }
+  if (slot.badge != nullptr)
+  {
+    drawChromeBitmap(x + 48 - 24, y + 4, slot.badge, 24, 24);
+  }
+  GFX_TARGET.setFont(&FT_LAB);
+  drawString(48 + x, y + 10, slot.label, LEFT);
+  return;
+} // end drawSlotChrome
+
+/*
+ * drawSlotChrome
+ *
+ * Icon and label of the slot at pos, unless the static layer drew them.
+ */
+static void drawSlotChrome(int pos)
+{
+  if (chrome_cached)
+  {
+    return;
+  }
+  for (const slot_chrome_t &slot : slot_chromes)
+  {
+    if (slot.pos == pos)
+    {
+      drawSlotChrome(slot);
+    }
+  }
+  return;
+} // end drawSlotChrome
+
 // drawCurrentSunrise
 #ifdef POS_SUNRISE
 void drawCurrentSunrise(const owm_current_t &current, int tz_off) // AUTO_TZ
@@ -347,13 +1257,8 @@ void drawCurrentSunrise(const owm_current_t &current, int tz_off) // AUTO_TZ
   String dataStr, unitStr;
   int PosX = POS_SUNRISE % 2;
   int PosY = static_cast<int>(POS_SUNRISE / 2);
-    // icons
-  display.drawInvertedBitmap(OF_RAW2 * PosX, 204 + (48 + 8) * PosY,
-                             wi_sunrise_48x48, 48, 48, GxEPD_BLACK);
 
-  // labels
-  display.setFont(&FT_LAB);
-  drawString(48 + (OF_RAW2 * PosX), 204 + 10 + (48 + 8) * PosY, TXT_SUNRISE, LEFT);
+  drawSlotChrome(POS_SUNRISE);
 
   // sunrise
   display.setFont(&FT_LVAL);
@@ -376,13 +1281,7 @@ void drawCurrentWind(const owm_current_t &current)
   int PosX = (POS_WIND % 2);
   int PosY = static_cast<int>(POS_WIND / 2);
 
-  // icons
-  display.drawInvertedBitmap(OF_RAW2 * PosX, 204 + (48 + 8) * PosY,
-                             wi_strong_wind_48x48, 48, 48, GxEPD_BLACK);
-
-  // labels
-  display.setFont(&FT_LAB);
-  drawString(48 + (OF_RAW2 * PosX), 204 + 10 + (48 + 8) * PosY, TXT_WIND, LEFT);
+  drawSlotChrome(POS_WIND);
 
   // wind
   display.setFont(&FT_LVAL);
@@ -393,31 +1292,25 @@ void drawCurrentWind(const owm_current_t &current)
 #endif
 #ifdef UNITS_SPEED_METERSPERSECOND
   dataStr = String(static_cast<int>(std::round(current.wind_speed)));
-  unitStr = String(" ") + TXT_UNITS_SPEED_METERSPERSECOND;
 #endif
 #ifdef UNITS_SPEED_FEETPERSECOND
   dataStr = String(static_cast<int>(std::round(
                    meterspersecond_to_feetpersecond(current.wind_speed) )));
-  unitStr = String(" ") + TXT_UNITS_SPEED_FEETPERSECOND;
 #endif
 #ifdef UNITS_SPEED_KILOMETERSPERHOUR
   dataStr = String(static_cast<int>(std::round(
                    meterspersecond_to_kilometersperhour(current.wind_speed) )));
-  unitStr = String(" ") + TXT_UNITS_SPEED_KILOMETERSPERHOUR;
 #endif
 #ifdef UNITS_SPEED_MILESPERHOUR
   dataStr = String(static_cast<int>(std::round(
                    meterspersecond_to_milesperhour(current.wind_speed) )));
-  unitStr = String(" ") + TXT_UNITS_SPEED_MILESPERHOUR;
 #endif
 #ifdef UNITS_SPEED_KNOTS
   dataStr = String(static_cast<int>(std::round(
                    meterspersecond_to_knots(current.wind_speed) )));
-  unitStr = String(" ") + TXT_UNITS_SPEED_KNOTS;
 #endif
 #ifdef UNITS_SPEED_BEAUFORT
   dataStr = String(meterspersecond_to_beaufort(current.wind_speed));
-  unitStr = String(" ") + TXT_UNITS_SPEED_BEAUFORT;
 #endif
 
 #ifdef WIND_INDICATOR_ARROW
@@ -426,8 +1319,9 @@ void drawCurrentWind(const owm_current_t &current)
   drawString(48    + (OF_RAW2 * PosX) , 204 + 17 / 2 + (48 + 8) * PosY + 48 / 2, dataStr, LEFT);
 #endif
   display.setFont(&FONT_8pt8b);
-  drawString(display.getCursorX(), 204 + 17 / 2 + (48 + 8) * PosY + 48 / 2,
-             unitStr, LEFT);
+  drawString(display.getCursorX() + TEXT_ADVANCE(FONT_8pt8b, " "),
+             204 + 17 / 2 + (48 + 8) * PosY + 48 / 2,
+             UNIT_SPEED, TEXT_WIDTH(FONT_8pt8b, UNIT_SPEED), LEFT);
 
 #if defined(WIND_INDICATOR_NUMBER)
   dataStr = String(current.wind_deg) + "\260";
@@ -458,13 +1352,7 @@ void drawCurrentUVI(const owm_current_t &current)
   int PosX = (POS_UVI % 2);
   int PosY = static_cast<int>(POS_UVI / 2);
 
-  // icons
-  display.drawInvertedBitmap(OF_RAW2 * PosX, 204 + (48 + 8) * PosY,
-                             wi_day_sunny_48x48, 48, 48, GxEPD_BLACK);
-
-  // labels
-  display.setFont(&FT_LAB);
-  drawString(48 + (OF_RAW2 * PosX), 204 + 10 + (48 + 8) * PosY, TXT_UV_INDEX, LEFT);
+  drawSlotChrome(POS_UVI);
 
   // spacing between end of index value and start of descriptor text
   const int sp = 8;
@@ -477,9 +1365,10 @@ void drawCurrentUVI(const owm_current_t &current)
   drawString(48 + (OF_RAW2 * PosX), 204 + 17 / 2 + (48 + 8) * PosY + 48 / 2, dataStr, LEFT);
   display.setFont(&FT_LAB);
   //display.setFont(&FONT_7pt8b);
-  dataStr = String(getUVIdesc(uvi));
+  const char *desc = getUVIdesc(uvi);
+  dataStr = desc;
   int max_w = (OF_RAW2 + (PosX * OF_RAW2) - sp) - (display.getCursorX() + sp);
-  if (getStringWidth(dataStr) <= max_w)
+  if (labelWidth(desc, false) <= max_w)
   { // Fits on a single line, draw along bottom
     drawString(display.getCursorX() + sp, 204 + 17 / 2 + (48 + 8) * PosY + 48 / 2,
                dataStr, LEFT);
@@ -487,7 +1376,7 @@ void drawCurrentUVI(const owm_current_t &current)
   else
   { // use smaller font
     display.setFont(&FONT_5pt8b);
-    if (getStringWidth(dataStr) <= max_w)
+    if (labelWidth(desc, true) <= max_w)
     { // Fits on a single line with smaller font, draw along bottom
       drawString(display.getCursorX() + sp,
                  204 + 17 / 2 + (48 + 8) * PosY + 48 / 2,
@@ -513,23 +1402,7 @@ void drawCurrentAirQuality(const owm_resp_air_pollution_t &owm_air_pollution)
   int PosX = (POS_AIR_QULITY % 2);
   int PosY = static_cast<int>(POS_AIR_QULITY / 2);
 
-  // icons
-  display.drawInvertedBitmap(OF_RAW2 * PosX, 204 + (48 + 8) * PosY,
-                             air_filter_48x48, 48, 48, GxEPD_BLACK);
-
-  // labels
-  display.setFont(&FT_LAB);
-
-  const char *air_quality_index_label;
-  if (aqi_desc_type(AQI_SCALE) == AIR_QUALITY_DESC)
-  {
-    air_quality_index_label = TXT_AIR_QUALITY;
-  }
-  else // (aqi_desc_type(AQI_SCALE) == AIR_POLLUTION_DESC)
-  {
-    air_quality_index_label = TXT_AIR_POLLUTION;
-  }
-  drawString(48 + (OF_RAW2 * PosX), 204 + 10 + (48 + 8) * PosY, air_quality_index_label, LEFT);
+  drawSlotChrome(POS_AIR_QULITY);
 
   // spacing between end of index value and start of descriptor text
   const int sp = 8;
@@ -588,13 +1461,7 @@ void drawCurrentInTemp(float inTemp)
   int PosX = (POS_INTEMP % 2);
   int PosY = static_cast<int>(POS_INTEMP / 2);
 
-  // icons
-  display.drawInvertedBitmap(OF_RAW2 * PosX, 204 + (48 + 8) * PosY,
-                             house_thermometer_48x48, 48, 48, GxEPD_BLACK);
-
-  // labels
-  display.setFont(&FT_LAB);
-  drawString(48 + (OF_RAW2 * PosX), 204 + 10 + (48 + 8) * PosY, TXT_INDOOR_TEMPERATURE, LEFT);
+  drawSlotChrome(POS_INTEMP);
 
   // indoor temperature
   display.setFont(&FT_LVAL);
@@ -631,13 +1498,8 @@ void drawCurrentSunset(const owm_current_t &current, int tz_off) // AUTO_TZ
   String dataStr, unitStr;
   int PosX = (POS_SUNSET % 2);
   int PosY = static_cast<int>(POS_SUNSET / 2);
-  // icons
-  display.drawInvertedBitmap(OF_RAW2 * PosX, 204 + (48 + 8) * PosY,
-                             wi_sunset_48x48, 48, 48, GxEPD_BLACK);
 
-  // labels
-  display.setFont(&FT_LAB);
-  drawString(48 + (OF_RAW2 * PosX), 204 + 10 + (48 + 8) * PosY, TXT_SUNSET, LEFT);
+  drawSlotChrome(POS_SUNSET);
 
   // sunset
   display.setFont(&FT_LVAL);
@@ -660,13 +1522,7 @@ void drawCurrentHumidity(const owm_current_t &current)
   int PosX = (POS_HUMIDITY % 2);
   int PosY = static_cast<int>(POS_HUMIDITY / 2);
 
-  // icons
-  display.drawInvertedBitmap(OF_RAW2 * PosX, 204 + (48 + 8) * PosY,
-                             wi_humidity_48x48, 48, 48, GxEPD_BLACK);
-
-  // labels
-  display.setFont(&FT_LAB);
-  drawString(48 + (OF_RAW2 * PosX), 204 + 10 + (48 + 8) * PosY, TXT_HUMIDITY, LEFT);
+  drawSlotChrome(POS_HUMIDITY);
 
   // humidity
   display.setFont(&FT_LVAL);
@@ -687,63 +1543,51 @@ void drawCurrentPressure(const owm_current_t &current)
   String dataStr, unitStr;
   int PosX = (POS_PRESSURE % 2);
   int PosY = static_cast<int>(POS_PRESSURE / 2);
-  //  icons
-  display.drawInvertedBitmap(OF_RAW2 * PosX, 204 + (48 + 8) * PosY,
-                             wi_barometer_48x48, 48, 48, GxEPD_BLACK);
 
-  //  labels
-  display.setFont(&FT_LAB);
-  drawString(48 + (OF_RAW2 * PosX), 204 + 10 + (48 + 8) * PosY, TXT_PRESSURE, LEFT);
+  drawSlotChrome(POS_PRESSURE);
 
   // pressure
 #ifdef UNITS_PRES_HECTOPASCALS
   dataStr = String(current.pressure);
-  unitStr = String(" ") + TXT_UNITS_PRES_HECTOPASCALS;
 #endif
 #ifdef UNITS_PRES_PASCALS
   dataStr = String(static_cast<int>(std::round(
                    hectopascals_to_pascals(current.pressure) )));
-  unitStr = String(" ") + TXT_UNITS_PRES_PASCALS;
 #endif
 #ifdef UNITS_PRES_MILLIMETERSOFMERCURY
   dataStr = String(static_cast<int>(std::round(
                    hectopascals_to_millimetersofmercury(current.pressure) )));
-  unitStr = String(" ") + TXT_UNITS_PRES_MILLIMETERSOFMERCURY;
 #endif
 #ifdef UNITS_PRES_INCHESOFMERCURY
   dataStr = String(std::round(1e1f *
                    hectopascals_to_inchesofmercury(current.pressure)
                    ) / 1e1f, 1);
-  unitStr = String(" ") + TXT_UNITS_PRES_INCHESOFMERCURY;
 #endif
 #ifdef UNITS_PRES_MILLIBARS
   dataStr = String(static_cast<int>(std::round(
                    hectopascals_to_millibars(current.pressure) )));
-  unitStr = String(" ") + TXT_UNITS_PRES_MILLIBARS;
 #endif
 #ifdef UNITS_PRES_ATMOSPHERES
   dataStr = String(std::round(1e3f *
                    hectopascals_to_atmospheres(current.pressure) )
                    / 1e3f, 3);
-  unitStr = String(" ") + TXT_UNITS_PRES_ATMOSPHERES;
 #endif
 #ifdef UNITS_PRES_GRAMSPERSQUARECENTIMETER
   dataStr = String(static_cast<int>(std::round(
                    hectopascals_to_gramspersquarecentimeter(current.pressure)
                    )));
-  unitStr = String(" ") + TXT_UNITS_PRES_GRAMSPERSQUARECENTIMETER;
 #endif
 #ifdef UNITS_PRES_POUNDSPERSQUAREINCH
   dataStr = String(std::round(1e2f *
                    hectopascals_to_poundspersquareinch(current.pressure)
                    ) / 1e2f, 2);
-  unitStr = String(" ") + TXT_UNITS_PRES_POUNDSPERSQUAREINCH;
 #endif
   display.setFont(&FT_LVAL);
   drawString(48 + (OF_RAW2 * PosX), 204 + 17 / 2 + (48 + 8) * PosY + 48 / 2, dataStr, LEFT);
   display.setFont(&FONT_8pt8b);
-  drawString(display.getCursorX(), 204 + 17 / 2 + (48 + 8) * PosY + 48 / 2,
-             unitStr, LEFT);
+  drawString(display.getCursorX() + TEXT_ADVANCE(FONT_8pt8b, " "),
+             204 + 17 / 2 + (48 + 8) * PosY + 48 / 2,
+             UNIT_PRES, TEXT_WIDTH(FONT_8pt8b, UNIT_PRES), LEFT);
 
   return;
 }
@@ -758,23 +1602,15 @@ void drawCurrentVisibility(const owm_current_t &current)
   int PosX = (POS_VISIBILITY % 2);
   int PosY = static_cast<int>(POS_VISIBILITY / 2);
 
-  // icons
-  display.drawInvertedBitmap(OF_RAW2 * PosX, 204 + (48 + 8) * PosY,
-                             visibility_icon_48x48, 48, 48, GxEPD_BLACK);
-
-  // labels
-  display.setFont(&FT_LAB);
-  drawString(48 + (OF_RAW2 * PosX), 204 + 10 + (48 + 8) * PosY, TXT_VISIBILITY, LEFT);
+  drawSlotChrome(POS_VISIBILITY);
 
   // visibility
   display.setFont(&FT_LVAL);
 #ifdef UNITS_DIST_KILOMETERS
   float vis = meters_to_kilometers(current.visibility);
-  unitStr = String(" ") + TXT_UNITS_DIST_KILOMETERS;
 #endif
 #ifdef UNITS_DIST_MILES
   float vis = meters_to_miles(current.visibility);
-  unitStr = String(" ") + TXT_UNITS_DIST_MILES;
 #endif
   // if visibility is less than 1.95, round to 1 decimal place
   // else round to int
@@ -798,8 +1634,9 @@ void drawCurrentVisibility(const owm_current_t &current)
   }
   drawString(48 + (OF_RAW2 * PosX), 204 + 17 / 2 + (48 + 8) * PosY + 48 / 2, dataStr, LEFT);
   display.setFont(&FONT_8pt8b);
-  drawString(display.getCursorX(), 204 + 17 / 2 + (48 + 8) * PosY + 48 / 2,
-             unitStr, LEFT);
+  drawString(display.getCursorX() + TEXT_ADVANCE(FONT_8pt8b, " "),
+             204 + 17 / 2 + (48 + 8) * PosY + 48 / 2,
+             UNIT_DIST, TEXT_WIDTH(FONT_8pt8b, UNIT_DIST), LEFT);
 
   return;
 }
@@ -814,13 +1651,7 @@ void drawCurrentInHumidity(float inHumidity)
   int PosX = (POS_INHUMIDITY % 2);
   int PosY = static_cast<int>(POS_INHUMIDITY / 2);
 
-  // current weather data icons
-  display.drawInvertedBitmap(OF_RAW2 * PosX, 204 + (48 + 8) * PosY,
-                             house_humidity_48x48, 48, 48, GxEPD_BLACK);
-
-  // current weather data labels
-  display.setFont(&FT_LAB);
-  drawString(48 + (OF_RAW2 * PosX), 204 + 10 + (48 + 8) * PosY, TXT_INDOOR_HUMIDITY, LEFT);
+  drawSlotChrome(POS_INHUMIDITY);
 
   // indoor humidity
   display.setFont(&FT_LVAL);
@@ -849,13 +1680,7 @@ void drawCurrentMoonrise(const owm_daily_t &today)
   int PosX = POS_MOONRISE % 2;
   int PosY = static_cast<int>(POS_MOONRISE / 2);
 
-  // icons
-  display.drawInvertedBitmap(OF_RAW2 * PosX, 204 + (48 + 8) * PosY,
-                             wi_moonrise_48x48, 48, 48, GxEPD_BLACK);
-
-  // labels
-  display.setFont(&FT_LAB);
-  drawString(48 + (OF_RAW2 * PosX), 204 + 10 + (48 + 8) * PosY, TXT_MOONRISE, LEFT);
+  drawSlotChrome(POS_MOONRISE);
 
   // moonrise
   display.setFont(&FT_LVAL);
@@ -877,13 +1702,8 @@ void drawCurrentMoonset(const owm_daily_t &today)
   String dataStr, unitStr;
   int PosX = (POS_MOONSET % 2);
   int PosY = static_cast<int>(POS_MOONSET / 2);
-  // icons
-  display.drawInvertedBitmap(OF_RAW2 * PosX, 204 + (48 + 8) * PosY,
-                             wi_moonset_48x48, 48, 48, GxEPD_BLACK);
 
-  // labels
-  display.setFont(&FT_LAB);
-  drawString(48 + (OF_RAW2 * PosX), 204 + 10 + (48 + 8) * PosY, TXT_MOONSET, LEFT);
+  drawSlotChrome(POS_MOONSET);
 
   // moonset
   display.setFont(&FT_LVAL);
@@ -898,6 +1718,85 @@ void drawCurrentMoonset(const owm_daily_t &today)
 #endif
 // end drawCurrentMoonset
 
+#ifdef MOONPHASE_PROCEDURAL
+/*
+ * drawMoonPhase
+ *
+ * Draws the moon for the given phase (0 and 1 new moon, 0.5 full moon) inside
+ * the size x size box at (x, y). The terminator is half an ellipse whose minor
+ * axis is r * cos(2 * PI * phase), so each row of the disc is split into a lit
+ * and a shadowed span which are drawn with horizontal line fills.
+ * As the icons, MOONPHASE_PRIMARY fills the lit part and MOONPHASE_ALTERNATIVE
+ * fills the shadow inside an outline of the disc.
+ */
+void drawMoonPhase(int16_t x, int16_t y, int16_t size, float moon_phase,
+                   uint16_t color)
+{
+  const float r  = size * 3 / 8.f;  // same margin as the icons
+  const float cx = x + size / 2.f;
+  const float cy = y + size / 2.f;
+  const float k  = std::cos(2.f * PI * moon_phase);
+  const bool waxing = moon_phase < 0.5f;
+
+  for (int16_t py = static_cast<int16_t>(cy - r);
+       py < static_cast<int16_t>(std::ceil(cy + r)); ++py)
+  {
+    float dy = py + 0.5f - cy;
+    if (dy * dy >= r * r)
+    {
+      continue;
+    }
+    float w = std::sqrt(r * r - dy * dy);
+    // lit span relative to the centre of the disc
+    float lit0, lit1;
+    if (waxing)
+    {
+      lit0 = w * k;
+      lit1 = w;
+    }
+    else
+    {
+      lit0 = -w;
+      lit1 = -w * k;
+    }
+#ifdef MOONPHASE_SOUTHERN_HEMISPHERE
+    // seen upside down, the lit limb is on the opposite side
+    float tmp = lit0;
+    lit0 = -lit1;
+    lit1 = -tmp;
+#endif
+    int16_t x0 = static_cast<int16_t>(std::round(cx - w));
+    int16_t x1 = static_cast<int16_t>(std::round(cx + lit0));
+    int16_t x2 = static_cast<int16_t>(std::round(cx + lit1));
+    int16_t x3 = static_cast<int16_t>(std::round(cx + w));
+#ifdef MOONPHASE_PRIMARY
+    if (x2 > x1)
+    {
+      display.drawFastHLine(x1, py, x2 - x1, color);
+    }
+#endif
+#ifdef MOONPHASE_ALTERNATIVE
+    if (x1 > x0)
+    {
+      display.drawFastHLine(x0, py, x1 - x0, color);
+    }
+    if (x3 > x2)
+    {
+      display.drawFastHLine(x2, py, x3 - x2, color);
+    }
+#endif
+  }
+#ifdef MOONPHASE_ALTERNATIVE
+  const int16_t ri = static_cast<int16_t>(std::round(r));
+  display.drawCircle(static_cast<int16_t>(cx), static_cast<int16_t>(cy),
+                     ri, color);
+  display.drawCircle(static_cast<int16_t>(cx), static_cast<int16_t>(cy),
+                     ri - 1, color);
+#endif
+  return;
+} // end drawMoonPhase
+#endif // MOONPHASE_PROCEDURAL
+
 // drawCurrentMoonphase
 #ifdef POS_MOONPHASE
 void drawCurrentMoonphase(const owm_daily_t &daily)
@@ -907,18 +1806,22 @@ void drawCurrentMoonphase(const owm_daily_t &daily)
   int PosY = static_cast<int>(POS_MOONPHASE / 2);
 
   // icons
+#ifdef MOONPHASE_PROCEDURAL
+  drawMoonPhase(OF_RAW2 * PosX, 204 + (48 + 8) * PosY, 48, daily.moon_phase);
+#else
   display.drawInvertedBitmap(OF_RAW2 * PosX, 204 + (48 + 8) * PosY,
                              getMoonPhaseBitmap48(daily), 48, 48, GxEPD_BLACK);
+#endif
 
-  // labels
-  display.setFont(&FT_LAB);
-  drawString(48 + (OF_RAW2 * PosX), 204 + 10 + (48 + 8) * PosY, TXT_MOONPHASE, LEFT);
+  drawSlotChrome(POS_MOONPHASE);
 
   // moonphase
+  display.setFont(&FT_LAB);
   const int sp = 8;
-  dataStr = String(getMoonPhaseStr(daily));
+  const char *desc = getMoonPhaseStr(daily);
+  dataStr = desc;
   int max_w = (OF_RAW2 + (PosX * OF_RAW2) - sp) - (48 + (PosX * OF_RAW2));
-  if (getStringWidth(dataStr) <= max_w)
+  if (labelWidth(desc, false) <= max_w)
   { // Fits on a single line, draw along bottom
     drawString(48 + (OF_RAW2 * PosX), 204 + 17 / 2 + (48 + 8) * PosY + 48 / 2,
                dataStr, LEFT);
@@ -926,7 +1829,7 @@ void drawCurrentMoonphase(const owm_daily_t &daily)
   else
   { // use smaller font
     display.setFont(&FONT_5pt8b);
-    if (getStringWidth(dataStr) <= max_w)
+    if (labelWidth(desc, true) <= max_w)
     { // Fits on a single line with smaller font, draw along bottom
       drawString(48 + (OF_RAW2 * PosX),
                  204 + 17 / 2 + (48 + 8) * PosY + 48 / 2,
@@ -953,15 +1856,7 @@ void drawCurrentDewpoint(const owm_current_t &current)
   int PosX = (POS_DEWPOINT % 2);
   int PosY = static_cast<int>(POS_DEWPOINT / 2);
   
-  // icons
-  display.drawInvertedBitmap(OF_RAW2 * PosX, 204 + (48 + 8) * PosY,
-                             wi_thermometer_48x48, 48, 48, GxEPD_BLACK);
-  display.drawInvertedBitmap(OF_RAW2 * PosX + 48 - 24, 204 + (48 + 8) * PosY + 4,
-                             wi_raindrops_24x24, 24, 24, GxEPD_BLACK);
-  
-  // labels
-  display.setFont(&FT_LAB);
-  drawString(48 + (OF_RAW2 * PosX), 204 + 10 + (48 + 8) * PosY, TXT_DEWPOINT, LEFT);
+  drawSlotChrome(POS_DEWPOINT);
 
   // Dew point
   display.setFont(&FT_LVAL);
@@ -1005,6 +1900,7 @@ void drawCurrentConditions(const owm_current_t &current,
                            int tz_off   // AUTO_TZ
                           )
 {
+  PROFILE_SCOPE(PROF_CURRENT_CONDITIONS);
   String dataStr, unitStr;
 
   // current weather icon
@@ -1015,17 +1911,14 @@ void drawCurrentConditions(const owm_current_t &current,
   // current temp
 #ifdef UNITS_TEMP_KELVIN
   dataStr = String(static_cast<int>(std::round(current.temp)));
-  unitStr = TXT_UNITS_TEMP_KELVIN;
 #endif
 #ifdef UNITS_TEMP_CELSIUS
   dataStr = String(static_cast<int>(
             std::round(kelvin_to_celsius(current.temp))));
-  unitStr = TXT_UNITS_TEMP_CELSIUS;
 #endif
 #ifdef UNITS_TEMP_FAHRENHEIT
   dataStr = String(static_cast<int>(
             std::round(kelvin_to_fahrenheit(current.temp))));
-  unitStr = TXT_UNITS_TEMP_FAHRENHEIT;
 #endif
   // FONT_**_temperature fonts only have the character set used for displaying
   // temperature (0123456789.-\260)
@@ -1037,8 +1930,8 @@ void drawCurrentConditions(const owm_current_t &current,
     drawString(156 + 164 / 2 - 20, 196 / 2 + 69 / 2, dataStr, CENTER);
 #endif
   display.setFont(&FONT_14pt8b);
-  //drawString(display.getCursorX(), 196 / 2 - 69 / 2 + 20, unitStr, LEFT);
-  drawString(display.getCursorX(), 196 / 2 - 69 / 2 + 20 + 10, unitStr, LEFT);
+  drawString(display.getCursorX(), 196 / 2 - 69 / 2 + 20 + 10,
+             UNIT_TEMP, TEXT_WIDTH(FONT_14pt8b, UNIT_TEMP), LEFT);
 
   // current feels like
 #ifdef UNITS_TEMP_KELVIN
@@ -1137,6 +2030,7 @@ void drawCurrentConditions(const owm_current_t &current,
  */
 void drawForecast(owm_daily_t *const daily, tm timeInfo)
 {
+  PROFILE_SCOPE(PROF_FORECAST);
   // 5 day, forecast
   String hiStr, loStr;
   String dataStr, unitStr;
@@ -1164,10 +2058,13 @@ void drawForecast(owm_daily_t *const daily, tm timeInfo)
     // high | low
 #ifdef TEMP_FONT_ENH
     display.setFont(&FONT_10pt8b);
+    drawString(x + 31, 98 + 69 / 2 + 38 - 6 + 12, "|",
+               TEXT_WIDTH(FONT_10pt8b, "|"), CENTER);
 #else
     display.setFont(&FONT_8pt8b);
+    drawString(x + 31, 98 + 69 / 2 + 38 - 6 + 12, "|",
+               TEXT_WIDTH(FONT_8pt8b, "|"), CENTER);
 #endif
-    drawString(x + 31, 98 + 69 / 2 + 38 - 6 + 12, "|", CENTER);
 #ifdef UNITS_TEMP_KELVIN
     hiStr = String(static_cast<int>(std::round(daily[i].temp.max)));
     loStr = String(static_cast<int>(std::round(daily[i].temp.min)));
@@ -1287,8 +2184,9 @@ void drawForecast(owm_daily_t *const daily, tm timeInfo)
 void drawAlerts(std::vector<owm_alerts_t> &alerts,
                 const String &city, const String &date)
 {
+  PROFILE_SCOPE(PROF_ALERTS);
 #if DEBUG_LEVEL >= 1
-  Serial.println("[debug] alerts.size()    : " + String(alerts.size()));
+  LOG_I("[debug] alerts.size()    : %u", (unsigned) alerts.size());
 #endif
   if (alerts.size() == 0)
   { // no alerts to draw
@@ -1299,7 +2197,7 @@ void drawAlerts(std::vector<owm_alerts_t> &alerts,
   int *alert_indices = (int *) calloc(alerts.size(), sizeof(*alert_indices));
   if (!ignore_list || !alert_indices)
   {
-    Serial.println("Error: Failed to allocate memory while handling alerts.");
+    LOG_E("Failed to allocate memory while handling alerts.");
     free(ignore_list);
     free(alert_indices);
     return;
@@ -1320,12 +2218,12 @@ void drawAlerts(std::vector<owm_alerts_t> &alerts,
   // find indices of valid alerts
   int num_valid_alerts = 0;
 #if DEBUG_LEVEL >= 1
-  Serial.print("[debug] ignore_list      : [ ");
+  String ignoreStr;
 #endif
   for (int i = 0; i < alerts.size(); ++i)
   {
 #if DEBUG_LEVEL >= 1
-    Serial.print(String(ignore_list[i]) + " ");
+    ignoreStr += String(ignore_list[i]) + " ";
 #endif
     if (!ignore_list[i])
     {
@@ -1334,7 +2232,8 @@ void drawAlerts(std::vector<owm_alerts_t> &alerts,
     }
   }
 #if DEBUG_LEVEL >= 1
-  Serial.println("]\n[debug] num_valid_alerts : " + String(num_valid_alerts));
+  LOG_I("[debug] ignore_list      : [ %s]", ignoreStr.c_str());
+  LOG_I("[debug] num_valid_alerts : %d", num_valid_alerts);
 #endif
 
   if (num_valid_alerts == 1)
@@ -1404,6 +2303,7 @@ void drawAlerts(std::vector<owm_alerts_t> &alerts,
  */
 void drawLocationDate(const String &city, const String &date)
 {
+  PROFILE_SCOPE(PROF_LOCATION_DATE);
   // location, date
   display.setFont(&FONT_16pt8b);
   drawString(DISP_WIDTH - 2, 23, city, RIGHT, ACCENT_COLOR);
@@ -1450,6 +2350,51 @@ int kelvin_to_plot_y(float kelvin, int tempBoundMin, float yPxPerUnit,
 }
 #endif
 
+// Outlook graph area. Without precipitation the graph is extended to the right
+// of graph_x1 (unless BEFORE_EXT_GRAPH), the chrome only covers graph_x1.
+static const int graph_x0 = 340; // 350 -> 340
+#ifdef UNITS_HOURLY_PRECIP_CENTIMETERS
+static const int graph_x1 = DISP_WIDTH - 62; // A little extra room for more decimals
+#else
+static const int graph_x1 = DISP_WIDTH - 56;
+#endif
+static const int graph_y0 = 216;
+static const int graph_y1 = DISP_HEIGHT - 46;
+static const int graph_y_ticks = 5;
+
+/*
+ * graphDotAfter
+ *
+ * x of the first dot of the horizontal dotted lines after x.
+ */
+static int graphDotAfter(int x)
+{
+  return graph_x0 + ((x - graph_x0) / 3 + 1) * 3;
+} // end graphDotAfter
+
+/*
+ * drawOutlookGraphChrome
+ *
+ * x axis and horizontal dotted lines of the outlook graph, up to graph_x1.
+ */
+static void drawOutlookGraphChrome()
+{
+  GFX_TARGET.drawLine(graph_x0, graph_y1    , graph_x1, graph_y1    ,
+                      GxEPD_BLACK);
+  GFX_TARGET.drawLine(graph_x0, graph_y1 - 1, graph_x1, graph_y1 - 1,
+                      GxEPD_BLACK);
+  float yInterval = (graph_y1 - graph_y0) / static_cast<float>(graph_y_ticks);
+  for (int i = 0; i < graph_y_ticks; ++i)
+  {
+    int yTick = static_cast<int>(graph_y0 + (i * yInterval));
+    for (int x = graph_x0; x <= graph_x1 + 1; x += 3)
+    {
+      GFX_TARGET.drawPixel(x, yTick + (yTick % 2), GxEPD_BLACK);
+    }
+  }
+  return;
+} // end drawOutlookGraphChrome
+
 /*
  * drawOutlookGraph
  *
@@ -1460,6 +2405,7 @@ int kelvin_to_plot_y(float kelvin, int tempBoundMin, float yPxPerUnit,
 void drawOutlookGraph(const owm_hourly_t *hourly,
 	              const owm_daily_t *daily, int tz_off) // AUTO_TZ
 {
+  PROFILE_SCOPE(PROF_OUTLOOK_GRAPH);
  /* AUTO_POP_CONTRAST */
   int pop_step = 2;
 
@@ -1471,23 +2417,16 @@ void drawOutlookGraph(const owm_hourly_t *hourly,
   float precipValTotMax;
  /* AUTO_POP_CONTRAST */
 
-  // 350 -> 340
-  const int xPos0 = 340;
+  const int xPos0 = graph_x0;
 #ifdef XXX_STD
   int xPos1 = DISP_WIDTH - 23; // may be moved to make room for decimal places
 #endif
-#ifdef UNITS_HOURLY_PRECIP_CENTIMETERS
-  //const int xPos1 = DISP_WIDTH - 62; // A little extra room for more decimals
-  int xPos1 = DISP_WIDTH - 62; // A little extra room for more decimals
-#else
-  //const int xPos1 = DISP_WIDTH - 56;
-  int xPos1 = DISP_WIDTH - 56;
-#endif
-  const int yPos0 = 216;
-  const int yPos1 = DISP_HEIGHT - 46;
+  int xPos1 = graph_x1;
+  const int yPos0 = graph_y0;
+  const int yPos1 = graph_y1;
 
   // calculate y max/min and intervals
-  int yMajorTicks = 5;
+  int yMajorTicks = graph_y_ticks;
 #ifdef UNITS_TEMP_KELVIN
   float tempMin = hourly[0].temp;
 #endif
@@ -1662,23 +2601,28 @@ void drawOutlookGraph(const owm_hourly_t *hourly,
   /* AUTO_POP_CONTRAST */
   precipValTotMax = precipBoundMax * HOURLY_GRAPH_MAX;
   //Serial.printf("POP: ValToT=%f, ValMax=%f, BoundMax=%f\n", precipValTot, precipValTotMax, precipBoundMax);
-  if ( precipValTotMax )
-    Serial.print("Precipitation graph fill ratio = " + String(precipValTot/precipValTotMax));
-  else
-    Serial.print("Precipitation graph fill ratio = 0 ");
-
-  Serial.println(" Threshold = " + String(PRECIP_THRESHOLD));
+  LOG_D("Precipitation graph fill ratio = %.2f Threshold = %.2f",
+        precipValTotMax ? precipValTot / precipValTotMax : 0.f,
+        (float) PRECIP_THRESHOLD);
   if ( precipValTot > (precipValTotMax * PRECIP_THRESHOLD) )
     pop_step = 3;
 
-  Serial.println("Precipitation graph step = " + String(pop_step));
+  LOG_D("Precipitation graph step = %d", pop_step);
   /* AUTO_POP_CONTRAST */
 
   /*
-   * Draw x axis
+   * Draw x axis and horizontal dotted lines, the extension of the graph is
+   * not part of the chrome
    */
-  display.drawLine(xPos0, yPos1    , xPos1, yPos1    , GxEPD_BLACK);
-  display.drawLine(xPos0, yPos1 - 1, xPos1, yPos1 - 1, GxEPD_BLACK);
+  if (!chrome_cached)
+  {
+    drawOutlookGraphChrome();
+  }
+  if (xPos1 > graph_x1)
+  {
+    display.drawLine(graph_x1, yPos1    , xPos1, yPos1    , GxEPD_BLACK);
+    display.drawLine(graph_x1, yPos1 - 1, xPos1, yPos1 - 1, GxEPD_BLACK);
+  }
 
   /*
    * Draw y axis
@@ -1705,7 +2649,9 @@ void drawOutlookGraph(const owm_hourly_t *hourly,
 #endif
 
 #ifdef POP_AND_VOL
-    String precipUnit2, dataStr2;
+    String dataStr2;
+    const char *precipUnit2 = "";
+    uint16_t precipUnit2W = 0;
 #endif
 
     /*
@@ -1717,7 +2663,9 @@ void drawOutlookGraph(const owm_hourly_t *hourly,
 #ifdef UNITS_HOURLY_PRECIP_POP
       // PoP
       dataStr = String(100 - (i * 20));
-      String precipUnit = "%";
+      const char *precipUnit = "%";
+      const int16_t precipSpace = 0;
+      const uint16_t precipUnitW = TEXT_WIDTH(FONT_5pt8b, "%");
 #ifdef POP_AND_VOL
       if ( precipBoundMax2 )
       {
@@ -1728,12 +2676,15 @@ void drawOutlookGraph(const owm_hourly_t *hourly,
 
 #ifdef POP_VOL_MM
         precipUnit2 = "mm";
+        precipUnit2W = TEXT_WIDTH(FONT_5pt8b, "mm");
 #endif
 #ifdef POP_VOL_CM
         precipUnit2 = "cm";
+        precipUnit2W = TEXT_WIDTH(FONT_5pt8b, "cm");
 #endif
 #ifdef POP_VOL_INCHES
         precipUnit2 = "in";
+        precipUnit2W = TEXT_WIDTH(FONT_5pt8b, "in");
 #endif
       }
 #endif // POP_AND_VOL
@@ -1743,28 +2694,23 @@ void drawOutlookGraph(const owm_hourly_t *hourly,
       precipTick = std::round(precipTick * precipRoundingMultiplier)
                               / precipRoundingMultiplier;
       dataStr = String(precipTick, yPrecipMajorTickDecimals);
-#ifdef UNITS_HOURLY_PRECIP_MILLIMETERS
-      String precipUnit = String(" ") + TXT_UNITS_PRECIP_MILLIMETERS;
-#endif
-#ifdef UNITS_HOURLY_PRECIP_CENTIMETERS
-      String precipUnit = String(" ") + TXT_UNITS_PRECIP_CENTIMETERS;
-#endif
-#ifdef UNITS_HOURLY_PRECIP_INCHES
-      String precipUnit = String(" ") + TXT_UNITS_PRECIP_INCHES;
-#endif
+      const char *precipUnit = UNIT_HOURLY_PRECIP;
+      const int16_t precipSpace = TEXT_ADVANCE(FONT_5pt8b, " ");
+      const uint16_t precipUnitW = TEXT_WIDTH(FONT_5pt8b, UNIT_HOURLY_PRECIP);
 #endif // UNITS_HOURLY_PRECIP_POP
 
       drawString(xPos1 + 8, yTick + 4, dataStr, LEFT);
       display.setFont(&FONT_5pt8b);
-      drawString(display.getCursorX(), yTick + 4, precipUnit, LEFT);
+      drawString(display.getCursorX() + precipSpace, yTick + 4,
+                 precipUnit, precipUnitW, LEFT);
     } // end draw labels if precip is >0
 
     /*
-     * Draw horizontal dotted line
+     * Draw horizontal dotted line over the extension of the graph
      */
     if (i < yMajorTicks)
     {
-      for (int x = xPos0; x <= xPos1 + 1; x += 3)
+      for (int x = graphDotAfter(graph_x1 + 1); x <= xPos1 + 1; x += 3)
       {
         display.drawPixel(x, yTick + (yTick % 2), GxEPD_BLACK);
       }
@@ -1775,9 +2721,11 @@ void drawOutlookGraph(const owm_hourly_t *hourly,
       display.setFont(&FONT_7pt8b);
       drawString(xPos1 + 4, yTick + 15 + 4, dataStr2, LEFT);
       display.setFont(&FONT_5pt8b);
-      drawString(display.getCursorX(), yTick + 15 + 4, precipUnit2, LEFT);
+      drawString(display.getCursorX(), yTick + 15 + 4,
+                 precipUnit2, precipUnit2W, LEFT);
       display.setFont(&FONT_7pt8b);
-      drawString(display.getCursorX(), yTick + 15 + 4, ")", LEFT);
+      drawString(display.getCursorX(), yTick + 15 + 4,
+                 ")", TEXT_WIDTH(FONT_7pt8b, ")"), LEFT);
     }
 #endif // POP_AND_VOL
   }
@@ -2020,12 +2968,100 @@ void drawOutlookGraph(const owm_hourly_t *hourly,
   return;
 } // end drawOutlookGraph
 
+#ifdef STATIC_LAYER
+/*
+ * captureChrome
+ *
+ * Draws the static chrome of the screen on the canvas of the static layer.
+ */
+static void captureChrome(LayerCanvas &canvas)
+{
+  gfx_target = &canvas;
+  for (const slot_chrome_t &slot : slot_chromes)
+  {
+    if (slot.pos >= 0)
+    {
+      drawSlotChrome(slot);
+    }
+  }
+  drawOutlookGraphChrome();
+  gfx_target = &display;
+  return;
+} // end captureChrome
+
+/*
+ * layoutKey
+ *
+ * Key of the static layer. Units, slot positions and the locale are compile
+ * time settings covered by the build, the others may be changed at runtime.
+ */
+static uint32_t layoutKey()
+{
+  static const char build[] = __DATE__ " " __TIME__;
+  const int32_t layout[] = {DISP_WIDTH, DISP_HEIGHT, HOURLY_GRAPH_MAX,
+                            static_cast<int32_t>(WicFlg),
+                            static_cast<int32_t>(WicTemp)};
+  return staticLayerHash(layout, sizeof(layout),
+                         staticLayerHash(build, sizeof(build)));
+} // end layoutKey
+
+/*
+ * drawStaticLayer
+ *
+ * Draws the static chrome from the stored layer, rendering and storing it
+ * first if the layout changed. Returns false if the layer is unavailable, the
+ * widgets then draw their own chrome.
+ */
+bool drawStaticLayer()
+{
+  PROFILE_SCOPE(PROF_STATIC_LAYER);
+  const uint32_t key = layoutKey();
+  chrome_cached = staticLayerLoad(key)
+               || staticLayerBuild(key, DISP_WIDTH, DISP_HEIGHT, captureChrome);
+  if (chrome_cached)
+  {
+    staticLayerBlit(display, GxEPD_BLACK);
+  }
+  return chrome_cached;
+} // end drawStaticLayer
+#endif
+
+#if STATUS_BAR_EXTRAS_WIFI_STRENGTH && !STATUS_BAR_EXTRAS_WIFI_RSSI
+/*
+ * statusLabelWidth
+ *
+ * Width in the status bar font of a WiFi strength label, evaluated at compile
+ * time; any other text is measured.
+ */
+static uint16_t statusLabelWidth(const char *text)
+{
+  // local, the asset fonts are only loaded at run time
+  static const label_width_t labels[] = {
+    {TXT_WIFI_EXCELLENT,     TEXT_WIDTH(FONT_6pt8b, TXT_WIFI_EXCELLENT)},
+    {TXT_WIFI_GOOD,          TEXT_WIDTH(FONT_6pt8b, TXT_WIFI_GOOD)},
+    {TXT_WIFI_FAIR,          TEXT_WIDTH(FONT_6pt8b, TXT_WIFI_FAIR)},
+    {TXT_WIFI_WEAK,          TEXT_WIDTH(FONT_6pt8b, TXT_WIFI_WEAK)},
+    {TXT_WIFI_NO_CONNECTION, TEXT_WIDTH(FONT_6pt8b, TXT_WIFI_NO_CONNECTION)},
+  };
+
+  for (const label_width_t &label : labels)
+  {
+    if (label.text == text)
+    {
+      return label.w;
+    }
+  }
+  return getStringWidth(text);
+} // end statusLabelWidth
+#endif
+
 /* This function is responsible for drawing the status bar along the bottom of
  * the display.
  */
 void drawStatusBar(const String &statusStr, const String &refreshTimeStr,
                    int rssi, uint32_t batVoltage)
 {
+  PROFILE_SCOPE(PROF_STATUS_BAR);
   String dataStr;
   uint16_t dataColor = GxEPD_BLACK;
   display.setFont(&FONT_6pt8b);
@@ -2062,7 +3098,13 @@ void drawStatusBar(const String &statusStr, const String &refreshTimeStr,
 
   // WiFi
   dataColor = rssi >= -70 ? GxEPD_BLACK : ACCENT_COLOR;
-#if STATUS_BAR_EXTRAS_WIFI_STRENGTH || STATUS_BAR_EXTRAS_WIFI_RSSI
+#if STATUS_BAR_EXTRAS_WIFI_STRENGTH && !STATUS_BAR_EXTRAS_WIFI_RSSI
+  // the locale label alone, its width is known at compile time
+  const char *wifiDesc = getWiFidesc(rssi);
+  const uint16_t wifiDescW = statusLabelWidth(wifiDesc);
+  drawString(pos, DISP_HEIGHT - 1 - 2, wifiDesc, wifiDescW, RIGHT, dataColor);
+  pos -= wifiDescW + 1;
+#elif STATUS_BAR_EXTRAS_WIFI_STRENGTH || STATUS_BAR_EXTRAS_WIFI_RSSI
   dataStr = "";
 #if STATUS_BAR_EXTRAS_WIFI_STRENGTH
   dataStr += String(getWiFidesc(rssi));
@@ -2111,6 +3153,14 @@ void drawStatusBar(const String &statusStr, const String &refreshTimeStr,
 void drawError(const uint8_t *bitmap_196x196,
                const String &errMsgLn1, const String &errMsgLn2)
 {
+  PROFILE_SCOPE(PROF_ERROR);
+#ifdef FAST_REFRESH
+#ifdef WEB_PREVIEW
+  // a preview does not replace the screen shown
+  if (!display.previewing())
+#endif
+  refreshInvalidate();
+#endif
   display.setFont(&FONT_26pt8b);
   if (!errMsgLn2.isEmpty())
   {
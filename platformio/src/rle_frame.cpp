@@ -0,0 +1,465 @@
+/* Run-length encoded frame buffer for esp32-weather-epd.
+ * Copyright (C) 2022-2026  Luke Marzen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "config.h"
+#ifdef DISPLAY_RLE_FRAME
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include "rle_frame.h"
+
+RleFrame::RleFrame(int16_t w, int16_t h)
+  : Adafruit_GFX(w, h), _prev_rows(nullptr), _clock(0)
+{
+  _blank[0] = 1;
+  _blank[1] = static_cast<uint16_t>(w << 4) | RLE_WHITE;
+  _rows = static_cast<uint16_t **>(malloc(h * sizeof(uint16_t *)));
+  for (int16_t y = 0; y < h; ++y)
+  {
+    _rows[y] = _blank;
+  }
+  for (row_cache_t &line : _cache)
+  {
+    line = {-1, false, 0, static_cast<uint8_t *>(malloc(w))};
+  }
+}
+
+RleFrame::~RleFrame()
+{
+  beginFrame(false); // frees the rows not shared with the previous frame
+  beginFrame(false); // and the previous frame
+  free(_prev_rows);
+  free(_rows);
+  for (row_cache_t &line : _cache)
+  {
+    free(line.px);
+  }
+}
+
+/*
+ * ownsRow
+ *
+ * Returns true if the encoded row y belongs to the current frame only (it is
+ * neither the blank row nor shared with the previous frame).
+ */
+bool RleFrame::ownsRow(int16_t y) const
+{
+  return _rows[y] != _blank
+      && (_prev_rows == nullptr || _rows[y] != _prev_rows[y]);
+} // end ownsRow
+
+void RleFrame::freeRow(uint16_t *row) const
+{
+  if (row != _blank)
+  {
+    free(row);
+  }
+  return;
+} // end freeRow
+
+/*
+ * setRow
+ *
+ * Replaces the encoded row y of the current frame.
+ */
+void RleFrame::setRow(int16_t y, uint16_t *row)
+{
+  if (ownsRow(y))
+  {
+    free(_rows[y]);
+  }
+  _rows[y] = row;
+  return;
+} // end setRow
+
+/*
+ * decodeRow
+ *
+ * Expands an encoded row into one color code per pixel.
+ */
+void RleFrame::decodeRow(const uint16_t *row, uint8_t *dst) const
+{
+  const uint16_t *run = row + 1;
+  for (uint16_t i = 0; i < row[0]; ++i, ++run)
+  {
+    uint16_t len = *run >> 4;
+    memset(dst, *run & 0x0F, len);
+    dst += len;
+  }
+  return;
+} // end decodeRow
+
+/*
+ * flushRow
+ *
+ * Encodes a modified cached line back into its row. Rows that become white
+ * share the blank row, others are (re)allocated to their exact size since
+ * the previous frame may still reference the old encoding.
+ */
+void RleFrame::flushRow(row_cache_t &line)
+{
+  if (line.y < 0 || !line.dirty)
+  {
+    return;
+  }
+  line.dirty = false;
+
+  uint16_t count = 1;
+  for (int16_t x = 1; x < WIDTH; ++x)
+  {
+    count += line.px[x] != line.px[x - 1];
+  }
+  if (count == 1 && line.px[0] == RLE_WHITE)
+  {
+    setRow(line.y, _blank);
+    return;
+  }
+
+  uint16_t *row = static_cast<uint16_t *>(
+    malloc((count + 1) * sizeof(uint16_t)));
+  if (row == nullptr)
+  {
+    return; // out of memory, the row keeps its previous content
+  }
+  row[0] = count;
+  uint16_t *run = row + 1;
+  int16_t start = 0;
+  for (int16_t x = 1; x <= WIDTH; ++x)
+  {
+    if (x == WIDTH || line.px[x] != line.px[start])
+    {
+      *run++ = static_cast<uint16_t>((x - start) << 4) | line.px[start];
+      start = x;
+    }
+  }
+  setRow(line.y, row);
+  return;
+} // end flushRow
+
+void RleFrame::flushAll()
+{
+  for (row_cache_t &line : _cache)
+  {
+    flushRow(line);
+  }
+  return;
+} // end flushAll
+
+/*
+ * lockRow
+ *
+ * Returns the decoded pixels of row y for modification, decoding it into the
+ * least recently used cache line if it is not cached.
+ */
+uint8_t *RleFrame::lockRow(int16_t y)
+{
+  ++_clock;
+  row_cache_t *lru = &_cache[0];
+  for (row_cache_t &line : _cache)
+  {
+    if (line.y == y)
+    {
+      line.last_used = _clock;
+      line.dirty = true;
+      return line.px;
+    }
+    if (line.last_used < lru->last_used)
+    {
+      lru = &line;
+    }
+  }
+  flushRow(*lru);
+  decodeRow(_rows[y], lru->px);
+  lru->y = y;
+  lru->dirty = true;
+  lru->last_used = _clock;
+  return lru->px;
+} // end lockRow
+
+/*
+ * hline
+ *
+ * Horizontal span in frame coordinates, already clipped.
+ */
+void RleFrame::hline(int16_t x, int16_t y, int16_t w, rle_color_t c)
+{
+  if (w == WIDTH && c == RLE_WHITE)
+  {
+    // whole white rows do not need to be decoded
+    for (row_cache_t &line : _cache)
+    {
+      if (line.y == y)
+      {
+        line.y = -1;
+        line.dirty = false;
+      }
+    }
+    setRow(y, _blank);
+    return;
+  }
+  memset(lockRow(y) + x, c, w);
+  return;
+} // end hline
+
+void RleFrame::drawPixel(int16_t x, int16_t y, uint16_t color)
+{
+  if (x < 0 || y < 0 || x >= width() || y >= height())
+  {
+    return;
+  }
+  switch (getRotation())
+  {
+  case 1:
+    std::swap(x, y);
+    x = WIDTH - x - 1;
+    break;
+  case 2:
+    x = WIDTH - x - 1;
+    y = HEIGHT - y - 1;
+    break;
+  case 3:
+    std::swap(x, y);
+    y = HEIGHT - y - 1;
+    break;
+  }
+  lockRow(y)[x] = colorCode(color);
+  return;
+} // end drawPixel
+
+void RleFrame::writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color)
+{
+  if (getRotation() != 0)
+  {
+    for (int16_t i = 0; i < w; ++i)
+    {
+      drawPixel(x + i, y, color);
+    }
+    return;
+  }
+  if (y < 0 || y >= HEIGHT)
+  {
+    return;
+  }
+  int16_t x2 = std::min<int16_t>(x + w, WIDTH);
+  x = std::max<int16_t>(x, 0);
+  if (x < x2)
+  {
+    hline(x, y, x2 - x, colorCode(color));
+  }
+  return;
+} // end writeFastHLine
+
+void RleFrame::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color)
+{
+  writeFastHLine(x, y, w, color);
+  return;
+} // end drawFastHLine
+
+void RleFrame::fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                        uint16_t color)
+{
+  if (getRotation() != 0)
+  {
+    Adafruit_GFX::fillRect(x, y, w, h, color);
+    return;
+  }
+  for (int16_t yy = std::max<int16_t>(y, 0);
+       yy < std::min<int16_t>(y + h, HEIGHT); ++yy)
+  {
+    writeFastHLine(x, yy, w, color);
+  }
+  return;
+} // end fillRect
+
+void RleFrame::fillScreen(uint16_t color)
+{
+  const uint16_t rotation = getRotation();
+  setRotation(0);
+  fillRect(0, 0, WIDTH, HEIGHT, color);
+  setRotation(rotation);
+  return;
+} // end fillScreen
+
+/*
+ * drawInvertedBitmap
+ *
+ * Draws each run of clear bits of a bitmap row as one horizontal line.
+ */
+void RleFrame::drawInvertedBitmap(int16_t x, int16_t y, const uint8_t bitmap[],
+                                  int16_t w, int16_t h, uint16_t color)
+{
+  const int16_t byteWidth = (w + 7) / 8;
+  for (int16_t j = 0; j < h; ++j)
+  {
+    const uint8_t *row = bitmap + j * byteWidth;
+    int16_t i = 0;
+    while (i < w)
+    {
+      if (row[i / 8] & (0x80 >> (i & 7)))
+      {
+        ++i;
+        continue;
+      }
+      int16_t start = i;
+      while (i < w && !(row[i / 8] & (0x80 >> (i & 7))))
+      {
+        ++i;
+      }
+      writeFastHLine(x + start, y + j, i - start, color);
+    }
+  }
+  return;
+} // end drawInvertedBitmap
+
+/*
+ * beginFrame
+ *
+ * The rows of the previous frame that the current frame does not share are
+ * freed, then the current frame becomes the previous one.
+ */
+void RleFrame::beginFrame(bool keep)
+{
+  flushAll();
+  if (_prev_rows != nullptr)
+  {
+    for (int16_t y = 0; y < HEIGHT; ++y)
+    {
+      if (_prev_rows[y] != _rows[y])
+      {
+        freeRow(_prev_rows[y]);
+      }
+    }
+  }
+  else
+  {
+    _prev_rows = static_cast<uint16_t **>(malloc(HEIGHT * sizeof(uint16_t *)));
+  }
+  std::swap(_prev_rows, _rows);
+  for (int16_t y = 0; y < HEIGHT; ++y)
+  {
+    _rows[y] = keep ? _prev_rows[y] : _blank;
+  }
+  return;
+} // end beginFrame
+
+/*
+ * getChangedArea
+ *
+ * Rows that share their encoding with the previous frame are unchanged
+ * without being compared, the others are compared encoded and then decoded
+ * to find the horizontal extent of the change.
+ */
+bool RleFrame::getChangedArea(int16_t &x, int16_t &y, int16_t &w, int16_t &h)
+{
+  flushAll();
+  int16_t x1 = WIDTH, y1 = HEIGHT, x2 = -1, y2 = -1;
+  // the first two cache lines are used as scratch
+  uint8_t *cur = _cache[0].px;
+  uint8_t *prev = _cache[1].px;
+  _cache[0].y = -1;
+  _cache[1].y = -1;
+  for (int16_t yy = 0; yy < HEIGHT; ++yy)
+  {
+    const uint16_t *a = _rows[yy];
+    const uint16_t *b = _prev_rows ? _prev_rows[yy] : _blank;
+    if (a == b
+     || (a[0] == b[0] && memcmp(a + 1, b + 1, a[0] * sizeof(uint16_t)) == 0))
+    {
+      continue;
+    }
+    y1 = std::min(y1, yy);
+    y2 = yy;
+    decodeRow(a, cur);
+    decodeRow(b, prev);
+    int16_t l = 0, r = WIDTH - 1;
+    while (l < r && cur[l] == prev[l])
+    {
+      ++l;
+    }
+    while (r > l && cur[r] == prev[r])
+    {
+      --r;
+    }
+    x1 = std::min(x1, l);
+    x2 = std::max(x2, r);
+  }
+  if (y2 < 0)
+  {
+    return false;
+  }
+  x = x1;
+  y = y1;
+  w = x2 - x1 + 1;
+  h = y2 - y1 + 1;
+  return true;
+} // end getChangedArea
+
+void RleFrame::readRows(int16_t y, int16_t n, uint8_t *dst)
+{
+  flushAll();
+  for (int16_t i = 0; i < n; ++i)
+  {
+    decodeRow(_rows[y + i], dst + i * WIDTH);
+  }
+  return;
+} // end readRows
+
+/*
+ * dropFrame
+ *
+ * The rows drawn in the current frame are freed, with the pending changes of
+ * the cached lines.
+ */
+void RleFrame::dropFrame()
+{
+  for (row_cache_t &line : _cache)
+  {
+    line.y = -1;
+    line.dirty = false;
+  }
+  for (int16_t y = 0; y < HEIGHT; ++y)
+  {
+    if (ownsRow(y))
+    {
+      free(_rows[y]);
+    }
+    _rows[y] = _prev_rows ? _prev_rows[y] : _blank;
+  }
+  return;
+} // end dropFrame
+
+const uint16_t *RleFrame::encodedRow(int16_t y)
+{
+  flushAll();
+  return _rows[y];
+} // end encodedRow
+
+size_t RleFrame::frameBytes() const
+{
+  size_t bytes = 0;
+  for (int16_t y = 0; y < HEIGHT; ++y)
+  {
+    if (_rows[y] != _blank)
+    {
+      bytes += (_rows[y][0] + 1) * sizeof(uint16_t);
+    }
+  }
+  return bytes;
+} // end frameBytes
+
+#endif // DISPLAY_RLE_FRAME
@@ -0,0 +1,439 @@
+/* Cached static layer for esp32-weather-epd.
+ * Copyright (C) 2022-2026  Luke Marzen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "config.h"
+#ifdef STATIC_LAYER
+
+#include <cstdlib>
+#include <cstring>
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#include <esp_partition.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#include "static_layer.h"
+#include "logger.h"
+
+#define LAYER_WHITE       0xFFFF // GxEPD_WHITE
+#define LAYER_SECTOR_SIZE 4096   // flash erase unit
+
+// loaded layer
+static uint8_t *layer_data   = nullptr;
+static uint32_t layer_key    = 0;
+static uint32_t layer_size   = 0;
+static int16_t  layer_width  = 0;
+static int16_t  layer_height = 0;
+
+/*
+ * Storage: the STATIC_LAYER_PARTITION_LABEL partition, or on a host build the
+ * file named by $EPD_LAYER (default layer.bin).
+ */
+#ifdef ARDUINO
+static const esp_partition_t *layerPartition()
+{
+  static const esp_partition_t *partition = esp_partition_find_first(
+    ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY,
+    STATIC_LAYER_PARTITION_LABEL);
+  return partition;
+} // end layerPartition
+
+static bool storeFound()
+{
+  return layerPartition() != nullptr;
+} // end storeFound
+
+static bool readStore(uint32_t offset, void *dst, size_t len)
+{
+  const esp_partition_t *p = layerPartition();
+  return p != nullptr && offset + len <= p->size
+      && esp_partition_read(p, offset, dst, len) == ESP_OK;
+} // end readStore
+
+static bool writeStore(uint32_t offset, const void *src, size_t len)
+{
+  const esp_partition_t *p = layerPartition();
+  return p != nullptr && offset + len <= p->size
+      && esp_partition_write(p, offset, src, len) == ESP_OK;
+} // end writeStore
+
+/*
+ * eraseStore
+ *
+ * Erases the sectors holding len bytes from the start, which also invalidates
+ * the stored layer.
+ */
+static bool eraseStore(size_t len)
+{
+  const esp_partition_t *p = layerPartition();
+  if (p == nullptr)
+  {
+    return false;
+  }
+  len = (len + LAYER_SECTOR_SIZE - 1) / LAYER_SECTOR_SIZE * LAYER_SECTOR_SIZE;
+  return len <= p->size && esp_partition_erase_range(p, 0, len) == ESP_OK;
+} // end eraseStore
+#else
+static int layerFile()
+{
+  static int fd = -2;
+  if (fd == -2)
+  {
+    const char *path = getenv("EPD_LAYER");
+    fd = open(path ? path : "layer.bin", O_RDWR | O_CREAT, 0644);
+  }
+  return fd;
+} // end layerFile
+
+static bool storeFound()
+{
+  return layerFile() >= 0;
+} // end storeFound
+
+static bool readStore(uint32_t offset, void *dst, size_t len)
+{
+  return layerFile() >= 0
+      && pread(layerFile(), dst, len, offset) == static_cast<ssize_t>(len);
+} // end readStore
+
+static bool writeStore(uint32_t offset, const void *src, size_t len)
+{
+  return layerFile() >= 0
+      && pwrite(layerFile(), src, len, offset) == static_cast<ssize_t>(len);
+} // end writeStore
+
+static bool eraseStore(size_t)
+{
+  static const static_layer_header_t none = {};
+  return writeStore(0, &none, sizeof(none));
+} // end eraseStore
+#endif
+
+/*
+ * packRow
+ *
+ * PackBits: a control byte n in [0, 127] is followed by n + 1 literal bytes,
+ * n in [-127, -1] by one byte repeated 1 - n times. dst must hold
+ * len + (len + 127) / 128 bytes. Returns the packed length.
+ */
+static size_t packRow(const uint8_t *src, size_t len, uint8_t *dst)
+{
+  size_t out = 0;
+  size_t i = 0;
+  while (i < len)
+  {
+    size_t run = 1;
+    while (i + run < len && run < 128 && src[i + run] == src[i])
+    {
+      ++run;
+    }
+    if (run >= 2)
+    {
+      dst[out++] = static_cast<uint8_t>(1 - static_cast<int>(run));
+      dst[out++] = src[i];
+      i += run;
+      continue;
+    }
+    // literals, up to the next run of 2
+    size_t lit = 1;
+    while (i + lit < len && lit < 128
+        && !(i + lit + 1 < len && src[i + lit] == src[i + lit + 1]))
+    {
+      ++lit;
+    }
+    dst[out++] = static_cast<uint8_t>(lit - 1);
+    memcpy(dst + out, src + i, lit);
+    out += lit;
+    i += lit;
+  }
+  return out;
+} // end packRow
+
+/*
+ * unpackRow
+ *
+ * Expands a PackBits row of len bytes, returns the position after it or
+ * nullptr if the data is invalid.
+ */
+static const uint8_t *unpackRow(const uint8_t *src, const uint8_t *end,
+                                uint8_t *dst, size_t len)
+{
+  size_t i = 0;
+  while (i < len && src < end)
+  {
+    const int8_t n = static_cast<int8_t>(*src++);
+    if (n >= 0)
+    {
+      if (i + n + 1 > len || src + n + 1 > end)
+      {
+        return nullptr;
+      }
+      memcpy(dst + i, src, n + 1);
+      src += n + 1;
+      i += n + 1;
+    }
+    else if (n != -128)
+    {
+      if (i + 1 - n > len || src == end)
+      {
+        return nullptr;
+      }
+      memset(dst + i, *src++, 1 - n);
+      i += 1 - n;
+    }
+  }
+  return (i == len) ? src : nullptr;
+} // end unpackRow
+
+/*
+ * LayerCanvas
+ */
+LayerCanvas::LayerCanvas(int16_t w, int16_t h, int16_t band_rows)
+  : Adafruit_GFX(w, h), _band_y(0), _band_rows(band_rows)
+{
+  _buf = static_cast<uint8_t *>(malloc((w + 7) / 8 * band_rows));
+}
+
+LayerCanvas::~LayerCanvas()
+{
+  free(_buf);
+}
+
+bool LayerCanvas::valid() const
+{
+  return _buf != nullptr;
+} // end valid
+
+int16_t LayerCanvas::bandRows() const
+{
+  return _band_rows;
+} // end bandRows
+
+void LayerCanvas::setBand(int16_t y)
+{
+  _band_y = y;
+  memset(_buf, 0, (WIDTH + 7) / 8 * _band_rows);
+  return;
+} // end setBand
+
+const uint8_t *LayerCanvas::row(int16_t y) const
+{
+  return _buf + (WIDTH + 7) / 8 * y;
+} // end row
+
+void LayerCanvas::drawPixel(int16_t x, int16_t y, uint16_t color)
+{
+  y -= _band_y;
+  if (x < 0 || x >= WIDTH || y < 0 || y >= _band_rows)
+  {
+    return;
+  }
+  uint8_t &b = _buf[(WIDTH + 7) / 8 * y + x / 8];
+  const uint8_t mask = 0x80 >> (x & 7);
+  b = (color == LAYER_WHITE) ? (b & ~mask) : (b | mask);
+  return;
+} // end drawPixel
+
+/*
+ * drawInvertedBitmap
+ *
+ * Only the rows of the bitmap inside the band are drawn.
+ */
+void LayerCanvas::drawInvertedBitmap(int16_t x, int16_t y,
+                                     const uint8_t bitmap[], int16_t w,
+                                     int16_t h, uint16_t color)
+{
+  const int16_t byteWidth = (w + 7) / 8;
+  const int16_t j0 = (_band_y > y) ? _band_y - y : 0;
+  const int16_t j1 = (_band_y + _band_rows - y < h) ? _band_y + _band_rows - y
+                                                    : h;
+  for (int16_t j = j0; j < j1; ++j)
+  {
+    const uint8_t *row = bitmap + j * byteWidth;
+    for (int16_t i = 0; i < w; ++i)
+    {
+      if (!(row[i / 8] & (0x80 >> (i & 7))))
+      {
+        drawPixel(x + i, y + j, color);
+      }
+    }
+  }
+  return;
+} // end drawInvertedBitmap
+
+/*
+ * staticLayerHash
+ *
+ * FNV-1a, chain calls with the previous result as seed.
+ */
+uint32_t staticLayerHash(const void *data, size_t len, uint32_t seed)
+{
+  const uint8_t *p = static_cast<const uint8_t *>(data);
+  uint32_t h = seed;
+  for (size_t i = 0; i < len; ++i)
+  {
+    h = (h ^ p[i]) * 16777619u;
+  }
+  return h;
+} // end staticLayerHash
+
+bool staticLayerLoad(uint32_t key)
+{
+  static_layer_header_t hdr;
+  if (!readStore(0, &hdr, sizeof(hdr))
+   || hdr.magic != STATIC_LAYER_MAGIC
+   || hdr.key != key
+   || hdr.size > STATIC_LAYER_MAX_BYTES)
+  {
+    return false;
+  }
+  if (layer_data != nullptr && layer_key == key)
+  {
+    return true; // already loaded
+  }
+  free(layer_data);
+  layer_data = static_cast<uint8_t *>(malloc(hdr.size));
+  layer_size = 0;
+  if (layer_data == nullptr
+   || !readStore(sizeof(hdr), layer_data, hdr.size))
+  {
+    free(layer_data);
+    layer_data = nullptr;
+    return false;
+  }
+  layer_key    = key;
+  layer_size   = hdr.size;
+  layer_width  = hdr.width;
+  layer_height = hdr.height;
+  return true;
+} // end staticLayerLoad
+
+/*
+ * staticLayerBuild
+ *
+ * Each band is drawn, packed and appended to the store. The layer is dropped
+ * when it does not fit in STATIC_LAYER_MAX_BYTES. Without a store it is not
+ * drawn at all, and the missing store is reported once.
+ */
+bool staticLayerBuild(uint32_t key, int16_t w, int16_t h, layer_draw_t draw)
+{
+  static bool no_store = false;
+  if (no_store)
+  {
+    return false;
+  }
+  if (!storeFound())
+  {
+    no_store = true;
+    LOG_W("Static layer partition not found");
+    return false;
+  }
+
+  free(layer_data);
+  layer_data = nullptr;
+  layer_size = 0;
+
+  LayerCanvas canvas(w, h, STATIC_LAYER_BAND_ROWS);
+  const size_t row_bytes = (w + 7) / 8;
+  const size_t packed_max = row_bytes + (row_bytes + 127) / 128;
+  uint8_t *packed = static_cast<uint8_t *>(
+    malloc(packed_max * STATIC_LAYER_BAND_ROWS));
+  bool ok = canvas.valid() && packed != nullptr
+         && eraseStore(sizeof(static_layer_header_t) + STATIC_LAYER_MAX_BYTES);
+  uint32_t size = 0;
+  for (int16_t y = 0; ok && y < h; y += STATIC_LAYER_BAND_ROWS)
+  {
+    canvas.setBand(y);
+    draw(canvas);
+    const int16_t rows = (h - y < STATIC_LAYER_BAND_ROWS)
+                         ? h - y : STATIC_LAYER_BAND_ROWS;
+    size_t len = 0;
+    for (int16_t r = 0; r < rows; ++r)
+    {
+      len += packRow(canvas.row(r), row_bytes, packed + len);
+    }
+    ok = size + len <= STATIC_LAYER_MAX_BYTES
+      && writeStore(sizeof(static_layer_header_t) + size, packed, len);
+    size += len;
+  }
+  free(packed);
+  if (!ok)
+  {
+    LOG_W("Static layer not stored");
+    return false;
+  }
+
+  const static_layer_header_t hdr = {
+    STATIC_LAYER_MAGIC, key, static_cast<uint16_t>(w),
+    static_cast<uint16_t>(h), size};
+  return writeStore(0, &hdr, sizeof(hdr)) && staticLayerLoad(key);
+} // end staticLayerBuild
+
+/*
+ * staticLayerBlit
+ *
+ * Each row is unpacked and its runs of set bits are drawn as horizontal
+ * lines, whole empty bytes are skipped.
+ */
+void staticLayerBlit(Adafruit_GFX &gfx, uint16_t color)
+{
+  if (layer_data == nullptr)
+  {
+    return;
+  }
+  const size_t row_bytes = (layer_width + 7) / 8;
+  uint8_t *row = static_cast<uint8_t *>(malloc(row_bytes));
+  if (row == nullptr)
+  {
+    return;
+  }
+  const uint8_t *src = layer_data;
+  const uint8_t *end = layer_data + layer_size;
+  gfx.startWrite();
+  for (int16_t y = 0; y < layer_height && src != nullptr; ++y)
+  {
+    src = unpackRow(src, end, row, row_bytes);
+    int16_t x = 0;
+    while (src != nullptr && x < layer_width)
+    {
+      if ((x & 7) == 0 && row[x / 8] == 0)
+      {
+        x += 8;
+        continue;
+      }
+      if (!(row[x / 8] & (0x80 >> (x & 7))))
+      {
+        ++x;
+        continue;
+      }
+      const int16_t start = x;
+      while (x < layer_width && (row[x / 8] & (0x80 >> (x & 7))))
+      {
+        ++x;
+      }
+      gfx.writeFastHLine(start, y, x - start, color);
+    }
+  }
+  gfx.endWrite();
+  free(row);
+  return;
+} // end staticLayerBlit
+
+#endif // STATIC_LAYER
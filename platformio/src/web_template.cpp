@@ -0,0 +1,97 @@
+/* Streaming HTML templates for esp32-weather-epd.
+ * Copyright (C) 2022-2026  Luke Marzen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "config.h"
+#ifdef WEB_SVR
+
+#include <algorithm>
+#include "web_template.h"
+
+WebTemplate::WebTemplate(const web_tpl_section_t *page, web_tpl_value_t value)
+  : _section(page), _pos(page->text), _row(0), _name(nullptr), _name_len(0),
+    _sent(0), _value(value)
+{
+}
+
+/*
+ * read
+ *
+ * Copies literal text up to the next placeholder, then the value of the
+ * placeholder, until buf is full or the page is complete.
+ */
+size_t WebTemplate::read(uint8_t *buf, size_t len)
+{
+  size_t out = 0;
+  while (out < len && _section->text != nullptr)
+  {
+    if (_name != nullptr)
+    {
+      const char *v = _value(_name, _name_len, _row, _scratch);
+      const size_t vlen = (v != nullptr) ? strlen(v) : 0;
+      if (_sent < vlen)
+      {
+        const size_t n = std::min(vlen - _sent, len - out);
+        memcpy(buf + out, v + _sent, n);
+        out += n;
+        _sent += n;
+        if (_sent < vlen)
+        {
+          break; // buf is full
+        }
+      }
+      _name = nullptr;
+      _sent = 0;
+      continue;
+    }
+
+    if (*_pos == '\0')
+    {
+      // next row or next section
+      if (++_row >= _section->rows)
+      {
+        ++_section;
+        _row = 0;
+      }
+      _pos = _section->text;
+      continue;
+    }
+
+    if (*_pos == '%')
+    {
+      const char *end = strchr(_pos + 1, '%');
+      if (end == _pos + 1 || end == nullptr)
+      {
+        // %% or an unterminated %
+        buf[out++] = '%';
+        _pos += (end == nullptr) ? 1 : 2;
+        continue;
+      }
+      _name = _pos + 1;
+      _name_len = end - _name;
+      _pos = end + 1;
+      continue;
+    }
+
+    const size_t n = std::min(strcspn(_pos, "%"), len - out);
+    memcpy(buf + out, _pos, n);
+    out += n;
+    _pos += n;
+  }
+  return out;
+} // end read
+
+#endif // WEB_SVR
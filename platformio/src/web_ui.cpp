@@ -0,0 +1,30 @@
+/* Precompressed configuration UI for esp32-weather-epd.
+ * Copyright (C) 2022-2026  Luke Marzen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "config.h"
+#ifdef WEB_UI
+
+#include "web_ui.h"
+// written to the build directory by web/pack_web.py
+#include "web_ui_data.h"
+
+// web_ui_files[] is defined there
+const size_t       web_ui_file_count = sizeof(web_ui_files)
+                                       / sizeof(web_ui_files[0]);
+const char * const web_ui_etag = WEB_UI_ETAG;
+
+#endif // WEB_UI
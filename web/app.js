@@ -0,0 +1,148 @@
+// Configuration UI for esp32-weather-epd, see web/README
+'use strict';
+
+// Locale strings (W_* of the selected locale, without the prefix), written by
+// pack_web.py
+const L = /*@LABELS@*/{};
+
+// General parameters: [name, label, unit, min, max, step]
+const PARMS = [
+  ['PopTh',    'POPTHR', '%',      0,  1,   0.01],
+  ['TempOff',  'TOFF',   '\u00b0', -4, 4,   0.1],
+  ['BedTim',   'BEDTIM', 'H',      0,  23,  1],
+  ['WakTim',   'WAKTIM', 'H',      0,  23,  1],
+  ['SlpDly',   'SLPDLY', 'min',    10, 60,  10],
+  ['HourNb',   'HOURNB', 'H',      8,  48,  1],
+  ['MinRef',   'MAJMIN', 'sec',    60, 300, 1],
+  ['MajAct',   'WEBDLY', 'sec',    60, 600, 1],
+  ['HttpTo',   'HTO',    'msec'],
+  ['WifiAPto', 'WATO',   'msec'],
+  ['WifiGLto', 'WGTO',   'msec'],
+];
+const FLAGS = [
+  ['ReportError', 'RERFLG'],
+  ['GraphIcons',  'WICFLG'],
+  ['IconsVpos',   'WICTEMP'],
+];
+
+function el(tag, attrs, text) {
+  const e = document.createElement(tag);
+  for (const k in attrs) {
+    if (attrs[k] !== undefined && attrs[k] !== false) {
+      e.setAttribute(k, attrs[k] === true ? '' : attrs[k]);
+    }
+  }
+  if (text !== undefined) {
+    e.textContent = text;
+  }
+  return e;
+}
+
+function row(parent, children) {
+  const r = el('div', {class: 'row'});
+  children.forEach(c => r.appendChild(c));
+  parent.appendChild(r);
+}
+
+function buildWeather(cfg) {
+  const locs = document.getElementById('locs');
+  cfg.loc.forEach((loc, i) => {
+    const n = i + 1;
+    row(locs, [
+      el('input', {type: 'radio', name: 'DefLoc', value: i,
+                   checked: i === cfg.defloc}),
+      el('label', {for: 'loc' + n}, 'Loc ' + n),
+      el('input', {type: 'text', id: 'loc' + n, name: 'loc' + n,
+                   value: loc.name, maxlength: 30}),
+      el('label', {for: 'lat' + n}, 'Lat'),
+      el('input', {type: 'text', class: 'geo', id: 'lat' + n,
+                   name: 'lat' + n, value: loc.lat}),
+      el('label', {for: 'lon' + n}, 'Lon'),
+      el('input', {type: 'text', class: 'geo', id: 'lon' + n,
+                   name: 'lon' + n, value: loc.lon}),
+    ]);
+  });
+}
+
+function buildWifi(cfg) {
+  const ssids = document.getElementById('ssids');
+  cfg.wifi.forEach((ap, i) => {
+    const n = i + 1;
+    row(ssids, [
+      el('label', {for: 'ssi' + n}, 'SSID ' + n),
+      el('input', {type: 'text', id: 'ssi' + n, name: 'ssi' + n,
+                   value: ap.ssid}),
+      el('label', {for: 'pwd' + n}, 'PWD ' + n),
+      el('input', {type: cfg.hidepwd ? 'password' : 'text', id: 'pwd' + n,
+                   name: 'pwd' + n, value: ap.pwd}),
+    ]);
+  });
+}
+
+function buildParm(cfg) {
+  const parms = document.getElementById('parms');
+  PARMS.forEach(([name, label, unit, min, max, step]) => {
+    const r = el('div', {class: 'prm'});
+    r.appendChild(el('label', {for: name}, L[label]));
+    r.appendChild(el('input', {type: 'number', id: name, name: name,
+                               value: cfg.parm[name], min: min, max: max,
+                               step: step}));
+    r.appendChild(el('span', {}, unit));
+    parms.appendChild(r);
+  });
+  FLAGS.forEach(([name, label]) => {
+    const r = el('div', {class: 'prm'});
+    r.appendChild(el('label', {for: name}, L[label]));
+    r.appendChild(el('input', {type: 'checkbox', id: name, name: name,
+                               value: 'active', checked: !!cfg.parm[name]}));
+    parms.appendChild(r);
+  });
+}
+
+// Shows the form named by the location hash
+function showTab() {
+  const tab = (location.hash || '#weather').slice(1);
+  ['weather', 'wifi', 'parm'].forEach(id => {
+    document.getElementById(id).hidden = id !== tab;
+  });
+  document.querySelectorAll('nav a').forEach(a => {
+    a.classList.toggle('cur', a.getAttribute('href') === '#' + tab);
+  });
+}
+
+async function load() {
+  document.querySelectorAll('[data-l]').forEach(e => {
+    const text = L[e.getAttribute('data-l')] || '';
+    if (e.tagName === 'INPUT') {
+      e.value = text;
+    } else {
+      e.textContent = text;
+    }
+  });
+  document.title = L.WEATHER || document.title;
+
+  const msg = document.getElementById('msg');
+  let cfg;
+  try {
+    const r = await fetch('/api/config', {cache: 'no-store'});
+    if (!r.ok) {
+      throw new Error(r.status === 403 ? L.INVALKEY : r.statusText);
+    }
+    // the parameters are stored as typed in the former pages (windows-1252)
+    const text = new TextDecoder('windows-1252').decode(await r.arrayBuffer());
+    cfg = JSON.parse(text);
+  } catch (e) {
+    msg.textContent = e.message;
+    msg.hidden = false;
+    return;
+  }
+  buildWeather(cfg);
+  buildWifi(cfg);
+  buildParm(cfg);
+  document.getElementById('ota').hidden = !cfg.ota;
+  document.getElementById('preview').hidden = !cfg.preview;
+  window.addEventListener('hashchange', showTab);
+  showTab();
+}
+
+load();
@@ -0,0 +1,156 @@
+#!/usr/bin/env python3
+# Packs the configuration web UI for esp32-weather-epd.
+# Copyright (C) 2022-2026  Luke Marzen
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <https://www.gnu.org/licenses/>.
+#
+# Writes web_ui_data.h: index.html, app.js and app.css gzip-compressed as C
+# arrays, served as they are by the firmware (see platformio/src/web_ui.cpp).
+# The W_* strings of the selected locale are written into app.js. The ETag is
+# a hash of the compressed files, so browsers keep their copy until the UI or
+# the locale changes.
+#
+# Runs as a PlatformIO pre-build script (extra_scripts in platformio.ini). When
+# WEB_UI is defined in include/config.h the header is written to
+# $BUILD_DIR/web_ui, which is added to the include path.
+# It can also be run by hand:
+#   python3 pack_web.py --locale fr_FR -o out
+
+import argparse
+import gzip
+import json
+import os
+import re
+import zlib
+
+WEB_DIR = os.path.dirname(os.path.abspath(__file__))
+
+# path, file, content type
+FILES = [
+    ('/ui',        'index.html', 'text/html; charset=windows-1252'),
+    ('/ui/app.js',  'app.js',    'application/javascript'),
+    ('/ui/app.css', 'app.css',   'text/css'),
+]
+
+
+def c_unescape(lit):
+    """Bytes of the body of a C string literal (bytes)."""
+    out = bytearray()
+    i = 0
+    while i < len(lit):
+        if lit[i] != ord('\\'):
+            out.append(lit[i])
+            i += 1
+            continue
+        m = re.match(rb'\\([0-7]{1,3}|x[0-9A-Fa-f]+|.)', lit[i:])
+        esc = m.group(1)
+        if esc[:1].isdigit():
+            out.append(int(esc, 8) & 0xFF)
+        elif esc[:1] == b'x':
+            out.append(int(esc[1:], 16) & 0xFF)
+        else:
+            out += {b'n': b'\n', b't': b'\t'}.get(esc, esc)
+        i += len(m.group(0))
+    return bytes(out)
+
+
+def locale_labels(project, locale):
+    """W_* strings of the locale, without the prefix."""
+    path = os.path.join(project, 'include', 'locales', 'locale_%s.inc' % locale)
+    with open(path, 'rb') as f:
+        data = f.read()
+    labels = {}
+    for name, lit in re.findall(
+            rb'^const String W_(\w+)\s*=\s*"((?:[^"\\\n]|\\.)*)"', data, re.M):
+        # the firmware sends them as Latin-1 (windows-1252) bytes
+        labels[name.decode()] = c_unescape(lit).decode('cp1252', 'replace')
+    return labels
+
+
+def c_array(name, data):
+    lines = ['static const uint8_t %s[%d] = {' % (name, len(data))]
+    for i in range(0, len(data), 16):
+        lines.append('  ' + ', '.join('0x%02x' % b for b in data[i:i + 16])
+                     + ',')
+    lines.append('};')
+    return '\n'.join(lines)
+
+
+def run(project, locale, out_dir):
+    labels = locale_labels(project, locale)
+    parts = []
+    entries = []
+    etag = 0
+    for path, name, content_type in FILES:
+        with open(os.path.join(WEB_DIR, name), 'rb') as f:
+            data = f.read()
+        if name == 'app.js':
+            # ASCII only, whatever the charset of the page
+            data = data.replace(b'/*@LABELS@*/{}', json.dumps(
+                labels, sort_keys=True, ensure_ascii=True).encode())
+        gz = gzip.compress(data, compresslevel=9, mtime=0)
+        etag = zlib.crc32(gz, etag)
+        var = 'web_ui_' + re.sub(r'\W', '_', name)
+        parts.append(c_array(var, gz))
+        entries.append('  {"%s", "%s", %s, sizeof(%s)},'
+                       % (path, content_type, var, var))
+        print('Web UI %s: %d -> %d bytes' % (name, len(data), len(gz)))
+
+    os.makedirs(out_dir, exist_ok=True)
+    header = [
+        '// Generated by web/pack_web.py for locale %s, do not edit' % locale,
+        '#pragma once',
+        '',
+        '#define WEB_UI_ETAG "\\"%08x\\""' % etag,
+        '',
+    ] + parts + [
+        '',
+        'const web_ui_file_t web_ui_files[] = {',
+    ] + entries + [
+        '};',
+        '',
+    ]
+    with open(os.path.join(out_dir, 'web_ui_data.h'), 'w') as f:
+        f.write('\n'.join(header))
+
+
+def config_define(config, name):
+    m = re.search(r'^#define %s\s+(.*?)\s*$' % name, config, re.M)
+    return m.group(1) if m else None
+
+
+def main(argv=None):
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument('--locale', required=True, help='e.g. en_US')
+    parser.add_argument('--project', default=os.path.join(
+        WEB_DIR, '..', 'platformio'))
+    parser.add_argument('-o', '--output', required=True)
+    args = parser.parse_args(argv)
+    run(args.project, args.locale, args.output)
+
+
+try:
+    Import('env')  # noqa: F821
+except NameError:
+    if __name__ == '__main__':
+        main()
+else:
+    # PlatformIO pre-build script
+    project = env.subst('$PROJECT_DIR')  # noqa: F821
+    with open(os.path.join(project, 'include', 'config.h')) as f:
+        config = f.read()
+    if config_define(config, 'WEB_UI') is not None:
+        out_dir = os.path.join(env.subst('$BUILD_DIR'), 'web_ui')  # noqa: F821
+        run(project, config_define(config, 'LOCALE'), out_dir)
+        env.Append(CPPPATH=[out_dir])  # noqa: F821